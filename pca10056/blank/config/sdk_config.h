@@ -80,6 +80,54 @@
 #define BLE_ADVERTISING_ENABLED 1
 #endif
 
+// <e> BLE_ADVERTISING_RECONNECT_ENABLED - Directed fast reconnection of ranked peers
+
+// <i> After a disconnection from a bonded peer, high duty cycle directed advertising is run to the
+// <i> disconnected peer and then to the highest ranked peers of the Peer Manager, one after another,
+// <i> before the undirected modes. Requires the Peer Manager.
+//==========================================================
+#ifndef BLE_ADVERTISING_RECONNECT_ENABLED
+#define BLE_ADVERTISING_RECONNECT_ENABLED 0
+#endif
+// <o> BLE_ADVERTISING_RECONNECT_PEERS - Maximum number of peers tried after a disconnection.  <1-8> 
+
+#ifndef BLE_ADVERTISING_RECONNECT_PEERS
+#define BLE_ADVERTISING_RECONNECT_PEERS 3
+#endif
+
+// </e>
+
+// <e> BLE_ADV_SCHED_ENABLED - ble_adv_sched - Advertising set scheduler
+
+// <i> Shares the advertising set of the SoftDevice between logical sets that take turns.
+//==========================================================
+#ifndef BLE_ADV_SCHED_ENABLED
+#define BLE_ADV_SCHED_ENABLED 0
+#endif
+// <o> BLE_ADV_SCHED_SET_CNT - Maximum number of logical advertising sets.  <1-255> 
+
+#ifndef BLE_ADV_SCHED_SET_CNT
+#define BLE_ADV_SCHED_SET_CNT 4
+#endif
+
+// </e>
+
+// <e> BLE_CONN_STATE_STATS_ENABLED - ble_conn_state - Per-connection traffic and radio statistics
+
+// <i> Counts the GATT traffic of each connection and tracks its RSSI, connection interval, PHY and ATT MTU.
+//==========================================================
+#ifndef BLE_CONN_STATE_STATS_ENABLED
+#define BLE_CONN_STATE_STATS_ENABLED 0
+#endif
+// <o> BLE_CONN_STATE_STATS_RSSI_SHIFT - Weight of a new RSSI sample in the average, as a power of two.  <0-7> 
+// <i> Each sample moves the average by 1/(2^shift) of its distance to the sample. 0 keeps the last sample.
+
+#ifndef BLE_CONN_STATE_STATS_RSSI_SHIFT
+#define BLE_CONN_STATE_STATS_RSSI_SHIFT 3
+#endif
+
+// </e>
+
 // <q> BLE_DB_DISCOVERY_ENABLED  - ble_db_discovery - Database discovery module
  
 #define S140 1
@@ -89,6 +137,51 @@
 #define BLE_DB_DISCOVERY_ENABLED 1
 #endif
 
+// <q> BLE_DB_DISCOVERY_CACHE_ENABLED  - Enables caching the discovered database of bonded peers.
+ 
+
+// <i> The discovered services are stored with the Peer Manager as the remote GATT data of the peer.
+// <i> On reconnection they are replayed as discovery events if the Database Hash of the peer is unchanged.
+
+#ifndef BLE_DB_DISCOVERY_CACHE_ENABLED
+#define BLE_DB_DISCOVERY_CACHE_ENABLED 0
+#endif
+
+// <q> BLE_DB_DISCOVERY_FILTER_ENABLED  - Enables discovering only the characteristics a user needs.
+ 
+
+// <i> Services registered with ble_db_discovery_evt_register_filtered() skip the characteristics
+// <i> and descriptors their user does not list.
+
+#ifndef BLE_DB_DISCOVERY_FILTER_ENABLED
+#define BLE_DB_DISCOVERY_FILTER_ENABLED 0
+#endif
+
+// <o> BLE_DB_DISCOVERY_MAX_CONCURRENT - Maximum number of discoveries in progress at the same time.  <0-255> 
+// <i> Discoveries started on more connections wait and are started in order as those in progress finish.
+// <i> 0 places no limit on the number of discoveries run on separate connections at the same time.
+
+#ifndef BLE_DB_DISCOVERY_MAX_CONCURRENT
+#define BLE_DB_DISCOVERY_MAX_CONCURRENT 0
+#endif
+
+// <q> BLE_DB_DISCOVERY_COMPACT_ENABLED  - Enables packing the discovered services in an arena shared by all instances.
+ 
+
+// <i> The instances keep no fixed service records. Discoveries in progress use one of BLE_DB_DISCOVERY_MAX_CONCURRENT
+// <i> shared storages, which must be at least 1. Cannot be used with BLE_DB_DISCOVERY_CACHE_ENABLED.
+
+#ifndef BLE_DB_DISCOVERY_COMPACT_ENABLED
+#define BLE_DB_DISCOVERY_COMPACT_ENABLED 0
+#endif
+
+// <o> BLE_DB_DISCOVERY_COMPACT_ARENA_SIZE - Size of the arena holding the services of all connections in bytes.  <64-65535> 
+// <i> A service takes 8 bytes, and each characteristic 9 bytes plus 2 for each descriptor found.
+
+#ifndef BLE_DB_DISCOVERY_COMPACT_ARENA_SIZE
+#define BLE_DB_DISCOVERY_COMPACT_ARENA_SIZE 1024
+#endif
+
 // <e> BLE_DTM_ENABLED - ble_dtm - Module for testing RF/PHY using DTM commands
 //==========================================================
 #ifndef BLE_DTM_ENABLED
@@ -165,6 +258,22 @@
 #define NRF_DTM_TIMER_INSTANCE 0
 #endif
 
+// <e> DTM_SWEEP_ENABLED - Enable the on-target channel, PHY, length and TX power sweep.
+
+// <i> Runs a programmed sequence of test steps and collects the packet count, PER and RSSI of each step.
+//==========================================================
+#ifndef DTM_SWEEP_ENABLED
+#define DTM_SWEEP_ENABLED 0
+#endif
+// <o> DTM_SWEEP_MAX_STEPS - Maximum number of steps in one sweep.  <1-1024> 
+// <i> Each step takes 11 bytes of RAM in the sweep report.
+
+#ifndef DTM_SWEEP_MAX_STEPS
+#define DTM_SWEEP_MAX_STEPS 160
+#endif
+
+// </e>
+
 // </e>
 
 // <q> BLE_RACP_ENABLED  - ble_racp - Record Access Control Point library
@@ -174,6 +283,56 @@
 #define BLE_RACP_ENABLED 0
 #endif
 
+// <e> BLE_RADIO_NOTIFICATION_SCHED_ENABLED - ble_radio_notification - Task scheduler around radio activity
+
+// <i> Runs registered tasks from the Radio Notification interrupt, just before or just after radio events.
+//==========================================================
+#ifndef BLE_RADIO_NOTIFICATION_SCHED_ENABLED
+#define BLE_RADIO_NOTIFICATION_SCHED_ENABLED 0
+#endif
+// <o> BLE_RADIO_NOTIFICATION_SCHED_IDLE_BUDGET_US - Time (in us) given to the tasks after each radio event.  <0-65535> 
+// <i> Should not exceed the shortest gap between radio events of the application.
+
+#ifndef BLE_RADIO_NOTIFICATION_SCHED_IDLE_BUDGET_US
+#define BLE_RADIO_NOTIFICATION_SCHED_IDLE_BUDGET_US 2000
+#endif
+
+// </e>
+
+// <e> BLE_UUID_CACHE_ENABLED - ble_uuid_cache - Cache of encoded vendor specific UUIDs
+
+// <i> Used by ble_advdata, so encoding the advertising data does not call sd_ble_uuid_encode()
+// <i> for UUIDs encoded before.
+//==========================================================
+#ifndef BLE_UUID_CACHE_ENABLED
+#define BLE_UUID_CACHE_ENABLED 0
+#endif
+// <o> BLE_UUID_CACHE_SIZE - Number of vendor specific UUIDs kept. <1-32> 
+
+#ifndef BLE_UUID_CACHE_SIZE
+#define BLE_UUID_CACHE_SIZE 8
+#endif
+
+// </e>
+
+// <q> NRF_BLE_ASYNC_ENABLED  - nrf_ble_async - GATT client operations for cooperative tasks
+ 
+
+// <i> Requires nrf_async and nrf_ble_gq. Service discoveries are awaited through ble_db_discovery.
+
+#ifndef NRF_BLE_ASYNC_ENABLED
+#define NRF_BLE_ASYNC_ENABLED 0
+#endif
+
+// <q> NRF_BLE_CHMAP_ENABLED  - nrf_ble_chmap - Adaptive channel map for central links
+ 
+
+// <i> Removes the data channels with a high energy in the QoS channel survey from the channel map of the central links.
+
+#ifndef NRF_BLE_CHMAP_ENABLED
+#define NRF_BLE_CHMAP_ENABLED 0
+#endif
+
 // <e> NRF_BLE_CONN_PARAMS_ENABLED - ble_conn_params - Initiating and executing a connection parameters negotiation procedure
 //==========================================================
 #ifndef NRF_BLE_CONN_PARAMS_ENABLED
@@ -193,8 +352,69 @@
 #define NRF_BLE_CONN_PARAMS_MAX_SUPERVISION_TIMEOUT_DEVIATION 65535
 #endif
 
+// <e> NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED - Switch between an active and an idle parameter set depending on traffic.
+
+// <i> Links busy with traffic are moved to the active set given at initialization (short interval),
+// <i> links idle for a while to the idle set (long interval with slave latency).
+//==========================================================
+#ifndef NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED
+#define NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED 0
+#endif
+// <o> NRF_BLE_CONN_PARAMS_ADAPTIVE_SAMPLE_MS - Period (in ms) over which the traffic of a link is counted.  <10-60000> 
+
+#ifndef NRF_BLE_CONN_PARAMS_ADAPTIVE_SAMPLE_MS
+#define NRF_BLE_CONN_PARAMS_ADAPTIVE_SAMPLE_MS 500
+#endif
+
+// <o> NRF_BLE_CONN_PARAMS_ADAPTIVE_BUSY_THRESHOLD - Packets per period that move a link to the active set.  <1-65535> 
+// <i> Packets sent and received are counted, plus the demand reported with ble_conn_params_adaptive_demand_set().
+
+#ifndef NRF_BLE_CONN_PARAMS_ADAPTIVE_BUSY_THRESHOLD
+#define NRF_BLE_CONN_PARAMS_ADAPTIVE_BUSY_THRESHOLD 4
+#endif
+
+// <o> NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_THRESHOLD - Periods with fewer packets count as idle.  <1-65535> 
+// <i> Must not be larger than NRF_BLE_CONN_PARAMS_ADAPTIVE_BUSY_THRESHOLD. Periods in between keep the current set.
+
+#ifndef NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_THRESHOLD
+#define NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_THRESHOLD 1
+#endif
+
+// <o> NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_TIMEOUT_MS - Time (in ms) a link must be idle before it is moved to the idle set.  <1-65535> 
+
+#ifndef NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_TIMEOUT_MS
+#define NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_TIMEOUT_MS 5000
+#endif
+
+// <o> NRF_BLE_CONN_PARAMS_ADAPTIVE_HOLDOFF_MS - Minimum time (in ms) between two switches of a link.  <0-65535> 
+// <i> After the peer declines a set, the next switch waits for next_conn_params_update_delay instead if that is longer.
+
+#ifndef NRF_BLE_CONN_PARAMS_ADAPTIVE_HOLDOFF_MS
+#define NRF_BLE_CONN_PARAMS_ADAPTIVE_HOLDOFF_MS 5000
+#endif
+
+// </e>
+
 // </e>
 
+// <q> NRF_BLE_CONN_CFG_ENABLED  - nrf_ble_conn_cfg - Connection configuration profiles
+ 
+
+// <i> Sets one SoftDevice connection configuration per profile, so that links can be sized by their needs.
+
+#ifndef NRF_BLE_CONN_CFG_ENABLED
+#define NRF_BLE_CONN_CFG_ENABLED 0
+#endif
+
+// <q> NRF_BLE_CONN_PLAN_ENABLED  - nrf_ble_conn_plan - Connection event spacing for central links
+ 
+
+// <i> Chooses one connection interval and event length so that the events of all central links fit in the interval.
+
+#ifndef NRF_BLE_CONN_PLAN_ENABLED
+#define NRF_BLE_CONN_PLAN_ENABLED 0
+#endif
+
 // <e> NRF_BLE_GATT_ENABLED - nrf_ble_gatt - GATT module
 //==========================================================
 #ifndef NRF_BLE_GATT_ENABLED
@@ -207,6 +427,17 @@
 #define NRF_BLE_GATT_MTU_EXCHANGE_INITIATION_ENABLED 1
 #endif
 
+// <q> NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED  - Enable the throughput profile
+ 
+
+// <i> Adds nrf_ble_gatt_throughput_profile_set(). On new connections, the ATT MTU exchange,
+// <i> data length update and update to the 2 Mbps PHY are run one after another, and
+// <i> connection event extension is enabled.
+
+#ifndef NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+#define NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED 0
+#endif
+
 // </e>
 
 // <e> NRF_BLE_GQ_ENABLED - nrf_ble_gq - BLE GATT Queue Module
@@ -234,1170 +465,1414 @@
 #define NRF_BLE_GQ_GATTS_HVX_MAX_DATA_LEN 16
 #endif
 
-// </e>
+// <o> NRF_BLE_GQ_INLINE_DATA_LEN - Maximal size of the data kept inside a queued request (in bytes).  <0-255> 
+// <i> Queued writes and notifications with data up to this size are kept inside the request
+// <i> descriptor instead of a memory object from the data pool. Each queued request grows by
+// <i> this size plus 2 bytes. Set to 0 to always use the data pool.
 
-// <e> NRF_BLE_QWR_ENABLED - nrf_ble_qwr - Queued writes support module (prepare/execute write)
+#ifndef NRF_BLE_GQ_INLINE_DATA_LEN
+#define NRF_BLE_GQ_INLINE_DATA_LEN 4
+#endif
+
+// <q> NRF_BLE_GQ_COALESCE_ENABLED  - Enable coalescing of queued requests.
+ 
+
+// <i> Adds nrf_ble_gq_coalesce_set(). Request types selected with it are merged with
+// <i> a matching request that is already queued instead of being queued again.
+
+#ifndef NRF_BLE_GQ_COALESCE_ENABLED
+#define NRF_BLE_GQ_COALESCE_ENABLED 0
+#endif
+
+// <e> NRF_BLE_GQ_SCHED_ENABLED - Schedule the queues of all connections with deficit round-robin.
+
+// <i> Every GATT event processes the queues of all registered connections. In each round,
+// <i> a connection issues up to its quantum of requests, and the connection served first rotates.
 //==========================================================
-#ifndef NRF_BLE_QWR_ENABLED
-#define NRF_BLE_QWR_ENABLED 1
+#ifndef NRF_BLE_GQ_SCHED_ENABLED
+#define NRF_BLE_GQ_SCHED_ENABLED 0
 #endif
-// <o> NRF_BLE_QWR_MAX_ATTR - Maximum number of attribute handles that can be registered. This number must be adjusted according to the number of attributes for which Queued Writes will be enabled. If it is zero, the module will reject all Queued Write requests. 
-#ifndef NRF_BLE_QWR_MAX_ATTR
-#define NRF_BLE_QWR_MAX_ATTR 0
+// <o> NRF_BLE_GQ_SCHED_DEFAULT_QUANTUM - Default number of requests per connection and round.  <1-255> 
+// <i> Changed per connection with nrf_ble_gq_conn_quantum_set().
+
+#ifndef NRF_BLE_GQ_SCHED_DEFAULT_QUANTUM
+#define NRF_BLE_GQ_SCHED_DEFAULT_QUANTUM 1
 #endif
 
 // </e>
 
-// <e> PEER_MANAGER_ENABLED - peer_manager - Peer Manager
+// <e> NRF_BLE_GQ_CREDITS_ENABLED - Pipeline write commands and notifications.
+
+// <i> Write commands and notifications are sent while there is room in the SoftDevice TX queues
+// <i> of the connection, which is freed by the TX complete events.
 //==========================================================
-#ifndef PEER_MANAGER_ENABLED
-#define PEER_MANAGER_ENABLED 1
+#ifndef NRF_BLE_GQ_CREDITS_ENABLED
+#define NRF_BLE_GQ_CREDITS_ENABLED 0
 #endif
-// <o> PM_MAX_REGISTRANTS - Number of event handlers that can be registered. 
-#ifndef PM_MAX_REGISTRANTS
-#define PM_MAX_REGISTRANTS 3
+// <o> NRF_BLE_GQ_WRITE_CMD_TX_QUEUE_SIZE - Default write command TX queue size.  <1-255> 
+// <i> Must match write_cmd_tx_queue_size of the connection configuration.
+
+#ifndef NRF_BLE_GQ_WRITE_CMD_TX_QUEUE_SIZE
+#define NRF_BLE_GQ_WRITE_CMD_TX_QUEUE_SIZE 1
 #endif
 
-// <o> PM_FLASH_BUFFERS - Number of internal buffers for flash operations. 
-// <i> Decrease this value to lower RAM usage.
+// <o> NRF_BLE_GQ_HVN_TX_QUEUE_SIZE - Default notification TX queue size.  <1-255> 
+// <i> Must match hvn_tx_queue_size of the connection configuration.
 
-#ifndef PM_FLASH_BUFFERS
-#define PM_FLASH_BUFFERS 4
+#ifndef NRF_BLE_GQ_HVN_TX_QUEUE_SIZE
+#define NRF_BLE_GQ_HVN_TX_QUEUE_SIZE 1
 #endif
 
-// <q> PM_CENTRAL_ENABLED  - Enable/disable central-specific Peer Manager functionality.
- 
+// </e>
 
-// <i> Enable/disable central-specific Peer Manager functionality.
+// </e>
 
-#ifndef PM_CENTRAL_ENABLED
-#define PM_CENTRAL_ENABLED 0
+// <e> NRF_BLE_CCCD_ENABLED - nrf_ble_cccd - CCCD configuration module
+//==========================================================
+#ifndef NRF_BLE_CCCD_ENABLED
+#define NRF_BLE_CCCD_ENABLED 0
 #endif
+// <o> NRF_BLE_CCCD_MAX_ENTRIES - Maximum number of CCCDs written per link in one go.  <1-255> 
 
-// <q> PM_SERVICE_CHANGED_ENABLED  - Enable/disable the service changed management for GATT server in Peer Manager.
- 
+#ifndef NRF_BLE_CCCD_MAX_ENTRIES
+#define NRF_BLE_CCCD_MAX_ENTRIES 8
+#endif
 
-// <i> If not using a GATT server, or using a server wihout a service changed characteristic,
-// <i> disable this to save code space.
+// </e>
 
-#ifndef PM_SERVICE_CHANGED_ENABLED
-#define PM_SERVICE_CHANGED_ENABLED 1
+// <e> NRF_BLE_FANOUT_ENABLED - nrf_ble_fanout - Measurement fan-out module
+//==========================================================
+#ifndef NRF_BLE_FANOUT_ENABLED
+#define NRF_BLE_FANOUT_ENABLED 0
 #endif
+// <o> NRF_BLE_FANOUT_MAX_DATA_LEN - Maximum length of a measurement sent to all links (in bytes).  <1-244> 
 
-// <q> PM_PEER_RANKS_ENABLED  - Enable/disable the peer rank management in Peer Manager.
- 
+#ifndef NRF_BLE_FANOUT_MAX_DATA_LEN
+#define NRF_BLE_FANOUT_MAX_DATA_LEN 20
+#endif
 
-// <i> Set this to false to save code space if not using the peer rank API.
+// </e>
 
-#ifndef PM_PEER_RANKS_ENABLED
-#define PM_PEER_RANKS_ENABLED 1
+// <e> NRF_BLE_IND_BACKLOG_ENABLED - nrf_ble_ind_backlog - Stored measurement backlog
+//==========================================================
+#ifndef NRF_BLE_IND_BACKLOG_ENABLED
+#define NRF_BLE_IND_BACKLOG_ENABLED 0
 #endif
+// <o> NRF_BLE_IND_BACKLOG_MAX_DATA_LEN - Maximum length of a stored measurement (in bytes).  <1-244> 
 
-// <q> PM_LESC_ENABLED  - Enable/disable LESC support in Peer Manager.
- 
+#ifndef NRF_BLE_IND_BACKLOG_MAX_DATA_LEN
+#define NRF_BLE_IND_BACKLOG_MAX_DATA_LEN 20
+#endif
 
-// <i> If set to true, you need to call nrf_ble_lesc_request_handler() in the main loop to respond to LESC-related BLE events. If LESC support is not required, set this to false to save code space.
+// <o> NRF_BLE_IND_BACKLOG_MAX_SERVICES - Maximum number of services with a backlog.  <1-255> 
 
-#ifndef PM_LESC_ENABLED
-#define PM_LESC_ENABLED 0
+#ifndef NRF_BLE_IND_BACKLOG_MAX_SERVICES
+#define NRF_BLE_IND_BACKLOG_MAX_SERVICES 4
 #endif
 
-// <e> PM_RA_PROTECTION_ENABLED - Enable/disable protection against repeated pairing attempts in Peer Manager.
+// </e>
+
+// <e> NRF_BLE_LESC_ENABLED - nrf_ble_lesc - LE Secure Connections
 //==========================================================
-#ifndef PM_RA_PROTECTION_ENABLED
-#define PM_RA_PROTECTION_ENABLED 0
-#endif
-// <o> PM_RA_PROTECTION_TRACKED_PEERS_NUM - Maximum number of peers whose authorization status can be tracked. 
-#ifndef PM_RA_PROTECTION_TRACKED_PEERS_NUM
-#define PM_RA_PROTECTION_TRACKED_PEERS_NUM 8
+#ifndef NRF_BLE_LESC_ENABLED
+#define NRF_BLE_LESC_ENABLED 0
 #endif
+// <q> NRF_BLE_LESC_GENERATE_NEW_KEYS  - Generate new LESC keys after each pairing procedure.
+ 
 
-// <o> PM_RA_PROTECTION_MIN_WAIT_INTERVAL - Minimum waiting interval (in ms) before a new pairing attempt can be initiated. 
-#ifndef PM_RA_PROTECTION_MIN_WAIT_INTERVAL
-#define PM_RA_PROTECTION_MIN_WAIT_INTERVAL 4000
+#ifndef NRF_BLE_LESC_GENERATE_NEW_KEYS
+#define NRF_BLE_LESC_GENERATE_NEW_KEYS 1
 #endif
 
-// <o> PM_RA_PROTECTION_MAX_WAIT_INTERVAL - Maximum waiting interval (in ms) before a new pairing attempt can be initiated. 
-#ifndef PM_RA_PROTECTION_MAX_WAIT_INTERVAL
-#define PM_RA_PROTECTION_MAX_WAIT_INTERVAL 64000
+// <o> NRF_BLE_LESC_KEYPAIR_POOL_SIZE - Number of spare key pairs generated in the background.  <0-8> 
+// <i> Spare key pairs are generated by nrf_ble_lesc_request_handler() when no DH key is requested,
+// <i> so that nrf_ble_lesc_keypair_generate() only has to switch to one. 0 disables the pool.
+
+#ifndef NRF_BLE_LESC_KEYPAIR_POOL_SIZE
+#define NRF_BLE_LESC_KEYPAIR_POOL_SIZE 0
 #endif
 
-// <o> PM_RA_PROTECTION_REWARD_PERIOD - Reward period (in ms). 
-// <i> The waiting interval is gradually decreased when no new failed pairing attempts are made during reward period.
+// <o> NRF_BLE_LESC_MAX_OPS_PER_CALL - Maximum number of ECC operations in one call to nrf_ble_lesc_request_handler().  <0-255> 
+// <i> Bounds the time spent in each call. Remaining work is done in the following calls, and the
+// <i> main loop is woken up for them. 0 means no limit.
 
-#ifndef PM_RA_PROTECTION_REWARD_PERIOD
-#define PM_RA_PROTECTION_REWARD_PERIOD 10000
+#ifndef NRF_BLE_LESC_MAX_OPS_PER_CALL
+#define NRF_BLE_LESC_MAX_OPS_PER_CALL 0
 #endif
 
 // </e>
 
-// <o> PM_HANDLER_SEC_DELAY_MS - Delay before starting security. 
-// <i>  This might be necessary for interoperability reasons, especially as peripheral.
-
-#ifndef PM_HANDLER_SEC_DELAY_MS
-#define PM_HANDLER_SEC_DELAY_MS 0
+// <e> NRF_BLE_QWR_ENABLED - nrf_ble_qwr - Queued writes support module (prepare/execute write)
+//==========================================================
+#ifndef NRF_BLE_QWR_ENABLED
+#define NRF_BLE_QWR_ENABLED 1
+#endif
+// <o> NRF_BLE_QWR_MAX_ATTR - Maximum number of attribute handles that can be registered. This number must be adjusted according to the number of attributes for which Queued Writes will be enabled. If it is zero, the module will reject all Queued Write requests. 
+#ifndef NRF_BLE_QWR_MAX_ATTR
+#define NRF_BLE_QWR_MAX_ATTR 0
 #endif
 
 // </e>
 
-// </h> 
+// <e> NRF_BLE_SCAN_ENABLED - nrf_ble_scan - Scanning Module
 //==========================================================
+#ifndef NRF_BLE_SCAN_ENABLED
+#define NRF_BLE_SCAN_ENABLED 0
+#endif
+// <o> NRF_BLE_SCAN_BUFFER - Data length for an advertising set. 
+#ifndef NRF_BLE_SCAN_BUFFER
+#define NRF_BLE_SCAN_BUFFER 31
+#endif
 
-// <h> nRF_BLE_Services 
+// <o> NRF_BLE_SCAN_NAME_MAX_LEN - Maximum size for the name to search in the advertisement report. 
+#ifndef NRF_BLE_SCAN_NAME_MAX_LEN
+#define NRF_BLE_SCAN_NAME_MAX_LEN 32
+#endif
 
-//==========================================================
-// <q> BLE_ANCS_C_ENABLED  - ble_ancs_c - Apple Notification Service Client
- 
+// <o> NRF_BLE_SCAN_SHORT_NAME_MAX_LEN - Maximum size of the short name to search for in the advertisement report. 
+#ifndef NRF_BLE_SCAN_SHORT_NAME_MAX_LEN
+#define NRF_BLE_SCAN_SHORT_NAME_MAX_LEN 32
+#endif
 
-#ifndef BLE_ANCS_C_ENABLED
-#define BLE_ANCS_C_ENABLED 0
+// <o> NRF_BLE_SCAN_SCAN_INTERVAL - Scanning interval. Determines the scan interval in units of 0.625 millisecond. 
+#ifndef NRF_BLE_SCAN_SCAN_INTERVAL
+#define NRF_BLE_SCAN_SCAN_INTERVAL 160
 #endif
 
-// <q> BLE_ANS_C_ENABLED  - ble_ans_c - Alert Notification Service Client
- 
+// <o> NRF_BLE_SCAN_SCAN_DURATION - Duration of a scanning session in units of 10 ms. Range: 0x0001 - 0xFFFF (10 ms to 10.9225 ms). If set to 0x0000, the scanning continues until it is explicitly disabled. 
+#ifndef NRF_BLE_SCAN_SCAN_DURATION
+#define NRF_BLE_SCAN_SCAN_DURATION 0
+#endif
 
-#ifndef BLE_ANS_C_ENABLED
-#define BLE_ANS_C_ENABLED 0
+// <o> NRF_BLE_SCAN_SCAN_WINDOW - Scanning window. Determines the scanning window in units of 0.625 millisecond. 
+#ifndef NRF_BLE_SCAN_SCAN_WINDOW
+#define NRF_BLE_SCAN_SCAN_WINDOW 80
 #endif
 
-// <q> BLE_BAS_C_ENABLED  - ble_bas_c - Battery Service Client
+// <o> NRF_BLE_SCAN_MIN_CONNECTION_INTERVAL - Determines minimum connection interval in milliseconds. 
+#ifndef NRF_BLE_SCAN_MIN_CONNECTION_INTERVAL
+#define NRF_BLE_SCAN_MIN_CONNECTION_INTERVAL 7.5
+#endif
+
+// <o> NRF_BLE_SCAN_MAX_CONNECTION_INTERVAL - Determines maximum connection interval in milliseconds. 
+#ifndef NRF_BLE_SCAN_MAX_CONNECTION_INTERVAL
+#define NRF_BLE_SCAN_MAX_CONNECTION_INTERVAL 30
+#endif
+
+// <o> NRF_BLE_SCAN_SLAVE_LATENCY - Determines the slave latency in counts of connection events. 
+#ifndef NRF_BLE_SCAN_SLAVE_LATENCY
+#define NRF_BLE_SCAN_SLAVE_LATENCY 0
+#endif
+
+// <o> NRF_BLE_SCAN_SUPERVISION_TIMEOUT - Determines the supervision time-out in units of 10 millisecond. 
+#ifndef NRF_BLE_SCAN_SUPERVISION_TIMEOUT
+#define NRF_BLE_SCAN_SUPERVISION_TIMEOUT 4000
+#endif
+
+// <o> NRF_BLE_SCAN_SCAN_PHY  - PHY to scan on.
  
+// <0=> BLE_GAP_PHY_AUTO 
+// <1=> BLE_GAP_PHY_1MBPS 
+// <2=> BLE_GAP_PHY_2MBPS 
+// <4=> BLE_GAP_PHY_CODED 
+// <5=> BLE_GAP_PHY_1MBPS and BLE_GAP_PHY_CODED 
+// <255=> BLE_GAP_PHY_NOT_SET 
 
-#ifndef BLE_BAS_C_ENABLED
-#define BLE_BAS_C_ENABLED 0
+// <i> When both 1M and Coded PHY are scanned, NRF_BLE_SCAN_SCAN_INTERVAL and NRF_BLE_SCAN_SCAN_WINDOW
+// <i> apply to 1M PHY, and NRF_BLE_SCAN_CODED_SCAN_INTERVAL and NRF_BLE_SCAN_CODED_SCAN_WINDOW to Coded PHY.
+// <i> Scanning on Coded PHY requires NRF_BLE_SCAN_BUFFER of at least 255.
+
+#ifndef NRF_BLE_SCAN_SCAN_PHY
+#define NRF_BLE_SCAN_SCAN_PHY 1
 #endif
 
-// <e> BLE_BAS_ENABLED - ble_bas - Battery Service
-//==========================================================
-#ifndef BLE_BAS_ENABLED
-#define BLE_BAS_ENABLED 1
+// <o> NRF_BLE_SCAN_CODED_SCAN_INTERVAL - Scanning interval on Coded PHY, in units of 0.625 millisecond. 
+#ifndef NRF_BLE_SCAN_CODED_SCAN_INTERVAL
+#define NRF_BLE_SCAN_CODED_SCAN_INTERVAL 320
 #endif
-// <e> BLE_BAS_CONFIG_LOG_ENABLED - Enables logging in the module.
+
+// <o> NRF_BLE_SCAN_CODED_SCAN_WINDOW - Scanning window on Coded PHY, in units of 0.625 millisecond. 
+#ifndef NRF_BLE_SCAN_CODED_SCAN_WINDOW
+#define NRF_BLE_SCAN_CODED_SCAN_WINDOW 80
+#endif
+
+// <e> NRF_BLE_SCAN_FILTER_ENABLE - Enabling filters for the Scanning Module.
 //==========================================================
-#ifndef BLE_BAS_CONFIG_LOG_ENABLED
-#define BLE_BAS_CONFIG_LOG_ENABLED 0
+#ifndef NRF_BLE_SCAN_FILTER_ENABLE
+#define NRF_BLE_SCAN_FILTER_ENABLE 1
+#endif
+// <o> NRF_BLE_SCAN_UUID_CNT - Number of filters for UUIDs. 
+#ifndef NRF_BLE_SCAN_UUID_CNT
+#define NRF_BLE_SCAN_UUID_CNT 0
 #endif
-// <o> BLE_BAS_CONFIG_LOG_LEVEL  - Default Severity level
- 
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef BLE_BAS_CONFIG_LOG_LEVEL
-#define BLE_BAS_CONFIG_LOG_LEVEL 3
+// <o> NRF_BLE_SCAN_NAME_CNT - Number of name filters. 
+#ifndef NRF_BLE_SCAN_NAME_CNT
+#define NRF_BLE_SCAN_NAME_CNT 0
 #endif
 
-// <o> BLE_BAS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <o> NRF_BLE_SCAN_SHORT_NAME_CNT - Number of short name filters. 
+#ifndef NRF_BLE_SCAN_SHORT_NAME_CNT
+#define NRF_BLE_SCAN_SHORT_NAME_CNT 0
+#endif
 
-#ifndef BLE_BAS_CONFIG_INFO_COLOR
-#define BLE_BAS_CONFIG_INFO_COLOR 0
+// <o> NRF_BLE_SCAN_ADDRESS_CNT - Number of address filters. 
+#ifndef NRF_BLE_SCAN_ADDRESS_CNT
+#define NRF_BLE_SCAN_ADDRESS_CNT 0
 #endif
 
-// <o> BLE_BAS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRF_BLE_SCAN_APPEARANCE_CNT - Number of appearance filters. 
+#ifndef NRF_BLE_SCAN_APPEARANCE_CNT
+#define NRF_BLE_SCAN_APPEARANCE_CNT 0
+#endif
+
+// <q> NRF_BLE_SCAN_ADDR_TABLE_ENABLED  - Keep address filters in a hash table.
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef BLE_BAS_CONFIG_DEBUG_COLOR
-#define BLE_BAS_CONFIG_DEBUG_COLOR 0
-#endif
+// <i> Adds nrf_ble_scan_addr_table_set(). Address filters are then added to a table in a buffer
+// <i> supplied by the application and looked up by hashing. Requires NRF_BLE_SCAN_ADDRESS_CNT > 0.
 
-// </e>
+#ifndef NRF_BLE_SCAN_ADDR_TABLE_ENABLED
+#define NRF_BLE_SCAN_ADDR_TABLE_ENABLED 0
+#endif
 
 // </e>
 
-// <q> BLE_CSCS_ENABLED  - ble_cscs - Cycling Speed and Cadence Service
- 
+// <e> NRF_BLE_SCAN_DEDUP_ENABLED - Suppress repeated advertising reports.
 
-#ifndef BLE_CSCS_ENABLED
-#define BLE_CSCS_ENABLED 0
+// <i> Reports with the address and data of a report forwarded within the window are
+// <i> not passed to the event handler, unless the RSSI changed by the threshold or more.
+// <i> Requires app_timer.
+//==========================================================
+#ifndef NRF_BLE_SCAN_DEDUP_ENABLED
+#define NRF_BLE_SCAN_DEDUP_ENABLED 0
 #endif
+// <o> NRF_BLE_SCAN_DEDUP_CACHE_SIZE - Number of reports remembered.  <1-255> 
+// <i> The least recently received report is replaced when the cache is full.
 
-// <q> BLE_CTS_C_ENABLED  - ble_cts_c - Current Time Service Client
- 
-
-#ifndef BLE_CTS_C_ENABLED
-#define BLE_CTS_C_ENABLED 0
+#ifndef NRF_BLE_SCAN_DEDUP_CACHE_SIZE
+#define NRF_BLE_SCAN_DEDUP_CACHE_SIZE 16
 #endif
 
-// <q> BLE_DIS_ENABLED  - ble_dis - Device Information Service
- 
+// <o> NRF_BLE_SCAN_DEDUP_WINDOW_MS - Time in milliseconds during which an unchanged report is suppressed. 
+// <i> Changed per instance with nrf_ble_scan_dedup_set().
 
-#ifndef BLE_DIS_ENABLED
-#define BLE_DIS_ENABLED 0
+#ifndef NRF_BLE_SCAN_DEDUP_WINDOW_MS
+#define NRF_BLE_SCAN_DEDUP_WINDOW_MS 1000
 #endif
 
-// <q> BLE_GLS_ENABLED  - ble_gls - Glucose Service
- 
+// <o> NRF_BLE_SCAN_DEDUP_RSSI_THRESHOLD - RSSI change in dBm that forwards an unchanged report.  <1-127> 
+// <i> Changed per instance with nrf_ble_scan_dedup_set().
 
-#ifndef BLE_GLS_ENABLED
-#define BLE_GLS_ENABLED 0
+#ifndef NRF_BLE_SCAN_DEDUP_RSSI_THRESHOLD
+#define NRF_BLE_SCAN_DEDUP_RSSI_THRESHOLD 6
 #endif
 
-// <q> BLE_HIDS_ENABLED  - ble_hids - Human Interface Device Service
- 
-
-#ifndef BLE_HIDS_ENABLED
-#define BLE_HIDS_ENABLED 0
-#endif
+// </e>
 
-// <q> BLE_HRS_C_ENABLED  - ble_hrs_c - Heart Rate Service Client
- 
+// <e> NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED - Connect to matched devices one after the other.
 
-#ifndef BLE_HRS_C_ENABLED
-#define BLE_HRS_C_ENABLED 0
+// <i> With automatic connection enabled, matched devices are queued while scanning, and
+// <i> connected to back-to-back once the collection window has elapsed or the queue holds
+// <i> as many devices as there are free central links. Scanning is resumed when the queue
+// <i> is empty. Requires app_timer.
+//==========================================================
+#ifndef NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED
+#define NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED 0
+#endif
+// <o> NRF_BLE_SCAN_CONNECT_QUEUE_SIZE - Number of matched devices queued.  <1-255> 
+#ifndef NRF_BLE_SCAN_CONNECT_QUEUE_SIZE
+#define NRF_BLE_SCAN_CONNECT_QUEUE_SIZE 8
 #endif
 
-// <q> BLE_HRS_ENABLED  - ble_hrs - Heart Rate Service
- 
+// <o> NRF_BLE_SCAN_CONNECT_QUEUE_COLLECT_MS - Time in milliseconds during which matched devices are collected before connecting. 
+// <i> Counted from the first queued device, and checked when advertising reports are received.
+// <i> 0 connects to each device as soon as it is matched.
 
-#ifndef BLE_HRS_ENABLED
-#define BLE_HRS_ENABLED 0
+#ifndef NRF_BLE_SCAN_CONNECT_QUEUE_COLLECT_MS
+#define NRF_BLE_SCAN_CONNECT_QUEUE_COLLECT_MS 200
 #endif
 
-// <q> BLE_HTS_ENABLED  - ble_hts - Health Thermometer Service
- 
+// </e>
 
-#ifndef BLE_HTS_ENABLED
-#define BLE_HTS_ENABLED 0
-#endif
+// </e>
 
-// <q> BLE_IAS_C_ENABLED  - ble_ias_c - Immediate Alert Service Client
+// <q> NRF_BLE_TPUT_ENABLED  - nrf_ble_tput - Throughput and latency benchmark over the Nordic UART Service
  
 
-#ifndef BLE_IAS_C_ENABLED
-#define BLE_IAS_C_ENABLED 1
+// <i> Requires app_timer, and ble_nus on the peripheral or ble_nus_c on the central.
+
+#ifndef NRF_BLE_TPUT_ENABLED
+#define NRF_BLE_TPUT_ENABLED 0
 #endif
 
-// <e> BLE_IAS_ENABLED - ble_ias - Immediate Alert Service
+// <e> PEER_MANAGER_ENABLED - peer_manager - Peer Manager
 //==========================================================
-#ifndef BLE_IAS_ENABLED
-#define BLE_IAS_ENABLED 1
+#ifndef PEER_MANAGER_ENABLED
+#define PEER_MANAGER_ENABLED 1
 #endif
-// <e> BLE_IAS_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef BLE_IAS_CONFIG_LOG_ENABLED
-#define BLE_IAS_CONFIG_LOG_ENABLED 0
+// <o> PM_MAX_REGISTRANTS - Number of event handlers that can be registered. 
+#ifndef PM_MAX_REGISTRANTS
+#define PM_MAX_REGISTRANTS 3
 #endif
-// <o> BLE_IAS_CONFIG_LOG_LEVEL  - Default Severity level
- 
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef BLE_IAS_CONFIG_LOG_LEVEL
-#define BLE_IAS_CONFIG_LOG_LEVEL 3
+// <o> PM_FLASH_BUFFERS - Number of internal buffers for flash operations. 
+// <i> Decrease this value to lower RAM usage.
+
+#ifndef PM_FLASH_BUFFERS
+#define PM_FLASH_BUFFERS 4
 #endif
 
-// <o> BLE_IAS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> PM_CENTRAL_ENABLED  - Enable/disable central-specific Peer Manager functionality.
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef BLE_IAS_CONFIG_INFO_COLOR
-#define BLE_IAS_CONFIG_INFO_COLOR 0
+// <i> Enable/disable central-specific Peer Manager functionality.
+
+#ifndef PM_CENTRAL_ENABLED
+#define PM_CENTRAL_ENABLED 0
 #endif
 
-// <o> BLE_IAS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> PM_SERVICE_CHANGED_ENABLED  - Enable/disable the service changed management for GATT server in Peer Manager.
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
-
-#ifndef BLE_IAS_CONFIG_DEBUG_COLOR
-#define BLE_IAS_CONFIG_DEBUG_COLOR 0
-#endif
 
-// </e>
+// <i> If not using a GATT server, or using a server wihout a service changed characteristic,
+// <i> disable this to save code space.
 
-// </e>
+#ifndef PM_SERVICE_CHANGED_ENABLED
+#define PM_SERVICE_CHANGED_ENABLED 1
+#endif
 
-// <q> BLE_LBS_C_ENABLED  - ble_lbs_c - Nordic LED Button Service Client
+// <q> PM_PEER_RANKS_ENABLED  - Enable/disable the peer rank management in Peer Manager.
  
 
-#ifndef BLE_LBS_C_ENABLED
-#define BLE_LBS_C_ENABLED 0
+// <i> Set this to false to save code space if not using the peer rank API.
+
+#ifndef PM_PEER_RANKS_ENABLED
+#define PM_PEER_RANKS_ENABLED 1
 #endif
 
-// <q> BLE_LBS_ENABLED  - ble_lbs - LED Button Service
- 
+// <e> PM_RANK_INDEX_ENABLED - Enable/disable the RAM index of peer ranks in Peer Manager.
 
-#ifndef BLE_LBS_ENABLED
-#define BLE_LBS_ENABLED 0
+// <i> Keeps the peers ordered by rank in RAM, so that pm_peer_ranks_get() finds the highest and
+// <i> lowest ranked peers without reading flash. pm_peer_rank_highest() only updates the index,
+// <i> and the changed ranks are written to flash when the delay expires, one record per peer
+// <i> however often it was ranked highest, or before shutdown through nrf_pwr_mgmt. Ranks given
+// <i> during the delay are lost on a reset. Uses 8 bytes of RAM per peer ID. Requires app_timer
+// <i> and PM_PEER_RANKS_ENABLED.
+//==========================================================
+#ifndef PM_RANK_INDEX_ENABLED
+#define PM_RANK_INDEX_ENABLED 0
 #endif
+// <o> PM_RANK_INDEX_STORE_DELAY_MS - Maximum time (in ms) a rank is held before it is written to flash. 
+// <i> Limited by the longest timeout app_timer supports.
 
-// <q> BLE_LLS_ENABLED  - ble_lls - Link Loss Service
- 
-
-#ifndef BLE_LLS_ENABLED
-#define BLE_LLS_ENABLED 1
+#ifndef PM_RANK_INDEX_STORE_DELAY_MS
+#define PM_RANK_INDEX_STORE_DELAY_MS 300000
 #endif
 
-// <q> BLE_NUS_C_ENABLED  - ble_nus_c - Nordic UART Central Service
+// </e>
+
+// <q> PM_LESC_ENABLED  - Enable/disable LESC support in Peer Manager.
  
 
-#ifndef BLE_NUS_C_ENABLED
-#define BLE_NUS_C_ENABLED 0
+// <i> If set to true, you need to call nrf_ble_lesc_request_handler() in the main loop to respond to LESC-related BLE events. If LESC support is not required, set this to false to save code space.
+
+#ifndef PM_LESC_ENABLED
+#define PM_LESC_ENABLED 0
 #endif
 
-// <e> BLE_NUS_ENABLED - ble_nus - Nordic UART Service
+// <e> PM_RA_PROTECTION_ENABLED - Enable/disable protection against repeated pairing attempts in Peer Manager.
 //==========================================================
-#ifndef BLE_NUS_ENABLED
-#define BLE_NUS_ENABLED 0
+#ifndef PM_RA_PROTECTION_ENABLED
+#define PM_RA_PROTECTION_ENABLED 0
 #endif
-// <e> BLE_NUS_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef BLE_NUS_CONFIG_LOG_ENABLED
-#define BLE_NUS_CONFIG_LOG_ENABLED 0
+// <o> PM_RA_PROTECTION_TRACKED_PEERS_NUM - Maximum number of peers whose authorization status can be tracked. 
+#ifndef PM_RA_PROTECTION_TRACKED_PEERS_NUM
+#define PM_RA_PROTECTION_TRACKED_PEERS_NUM 8
 #endif
-// <o> BLE_NUS_CONFIG_LOG_LEVEL  - Default Severity level
- 
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef BLE_NUS_CONFIG_LOG_LEVEL
-#define BLE_NUS_CONFIG_LOG_LEVEL 3
+// <o> PM_RA_PROTECTION_MIN_WAIT_INTERVAL - Minimum waiting interval (in ms) before a new pairing attempt can be initiated. 
+#ifndef PM_RA_PROTECTION_MIN_WAIT_INTERVAL
+#define PM_RA_PROTECTION_MIN_WAIT_INTERVAL 4000
 #endif
 
-// <o> BLE_NUS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
-
-#ifndef BLE_NUS_CONFIG_INFO_COLOR
-#define BLE_NUS_CONFIG_INFO_COLOR 0
+// <o> PM_RA_PROTECTION_MAX_WAIT_INTERVAL - Maximum waiting interval (in ms) before a new pairing attempt can be initiated. 
+#ifndef PM_RA_PROTECTION_MAX_WAIT_INTERVAL
+#define PM_RA_PROTECTION_MAX_WAIT_INTERVAL 64000
 #endif
 
-// <o> BLE_NUS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <o> PM_RA_PROTECTION_REWARD_PERIOD - Reward period (in ms). 
+// <i> The waiting interval is gradually decreased when no new failed pairing attempts are made during reward period.
 
-#ifndef BLE_NUS_CONFIG_DEBUG_COLOR
-#define BLE_NUS_CONFIG_DEBUG_COLOR 0
+#ifndef PM_RA_PROTECTION_REWARD_PERIOD
+#define PM_RA_PROTECTION_REWARD_PERIOD 10000
 #endif
 
 // </e>
 
-// </e>
-
-// <q> BLE_RSCS_C_ENABLED  - ble_rscs_c - Running Speed and Cadence Client
- 
+// <e> PM_PEER_DATA_CACHE_ENABLED - Enable/disable the RAM cache of peer data records in Peer Manager.
 
-#ifndef BLE_RSCS_C_ENABLED
-#define BLE_RSCS_C_ENABLED 0
+// <i> Keeps the flash descriptors of recently used peer data records, so that reading them again
+// <i> does not search the flash. Records known to be missing are cached as well.
+//==========================================================
+#ifndef PM_PEER_DATA_CACHE_ENABLED
+#define PM_PEER_DATA_CACHE_ENABLED 0
 #endif
+// <o> PM_PEER_DATA_CACHE_SIZE - Number of cached records.  <1-255> 
+// <i> Each entry uses 20 bytes of RAM. Up to 7 records are kept for each peer.
 
-// <q> BLE_RSCS_ENABLED  - ble_rscs - Running Speed and Cadence Service
- 
-
-#ifndef BLE_RSCS_ENABLED
-#define BLE_RSCS_ENABLED 0
+#ifndef PM_PEER_DATA_CACHE_SIZE
+#define PM_PEER_DATA_CACHE_SIZE 32
 #endif
 
-// <q> BLE_TPS_ENABLED  - ble_tps - TX Power Service
- 
+// </e>
 
-#ifndef BLE_TPS_ENABLED
-#define BLE_TPS_ENABLED 1
-#endif
+// <e> PM_DEFERRED_STORE_ENABLED - Enable/disable deferred storing of the local GATT database in Peer Manager.
 
-// </h> 
+// <i> Holds updated local GATT database (CCCD) data in RAM and merges later updates into it, so that
+// <i> only the latest version is written to flash. The data is written when the delay expires, when
+// <i> the peer disconnects, or before shutdown through nrf_pwr_mgmt. Requires app_timer, running at
+// <i> the same interrupt priority as the SoftDevice events.
 //==========================================================
+#ifndef PM_DEFERRED_STORE_ENABLED
+#define PM_DEFERRED_STORE_ENABLED 0
+#endif
+// <o> PM_DEFERRED_STORE_DELAY_MS - Maximum time (in ms) data is held before it is written to flash. 
+#ifndef PM_DEFERRED_STORE_DELAY_MS
+#define PM_DEFERRED_STORE_DELAY_MS 30000
+#endif
 
-// <h> nRF_Core 
+// </e>
 
+// <e> PM_RPA_CACHE_ENABLED - Enable/disable the cache of resolved private addresses in Peer Manager.
+
+// <i> Keeps the IRKs of bonded peers in RAM and resolves addresses against them in batches using
+// <i> the ECB. Recently resolved addresses are remembered, so that looking them up again needs no
+// <i> AES operations. The entry of a peer is replaced when the peer is seen with a new address.
 //==========================================================
-// <e> NRF_MPU_LIB_ENABLED - nrf_mpu_lib - Module for MPU
-//==========================================================
-#ifndef NRF_MPU_LIB_ENABLED
-#define NRF_MPU_LIB_ENABLED 0
+#ifndef PM_RPA_CACHE_ENABLED
+#define PM_RPA_CACHE_ENABLED 0
 #endif
-// <q> NRF_MPU_LIB_CLI_CMDS  - Enable CLI commands specific to the module.
- 
+// <o> PM_RPA_CACHE_SIZE - Number of cached addresses.  <1-255> 
+// <i> Each entry uses 16 bytes of RAM. Addresses that do not belong to any bonded peer are cached as well.
 
-#ifndef NRF_MPU_LIB_CLI_CMDS
-#define NRF_MPU_LIB_CLI_CMDS 0
+#ifndef PM_RPA_CACHE_SIZE
+#define PM_RPA_CACHE_SIZE 16
 #endif
 
-// </e>
-
-// <e> NRF_STACK_GUARD_ENABLED - nrf_stack_guard - Stack guard
-//==========================================================
-#ifndef NRF_STACK_GUARD_ENABLED
-#define NRF_STACK_GUARD_ENABLED 0
-#endif
-// <o> NRF_STACK_GUARD_CONFIG_SIZE  - Size of the stack guard.
- 
-// <5=> 32 bytes 
-// <6=> 64 bytes 
-// <7=> 128 bytes 
-// <8=> 256 bytes 
-// <9=> 512 bytes 
-// <10=> 1024 bytes 
-// <11=> 2048 bytes 
-// <12=> 4096 bytes 
+// <o> PM_RPA_CACHE_IRK_COUNT - Number of IRKs kept in RAM.  <1-255> 
+// <i> Each entry uses 18 bytes of RAM. If there are more bonded peers with IRKs, the remaining ones are read from flash.
 
-#ifndef NRF_STACK_GUARD_CONFIG_SIZE
-#define NRF_STACK_GUARD_CONFIG_SIZE 7
+#ifndef PM_RPA_CACHE_IRK_COUNT
+#define PM_RPA_CACHE_IRK_COUNT 16
 #endif
 
 // </e>
 
-// </h> 
-//==========================================================
-
-// <h> nRF_Crypto 
+// <e> PM_ID_INDEX_ENABLED - Enable/disable the RAM index of bonded peer identities in Peer Manager.
 
+// <i> Keeps a hash table from master IDs (EDIV and Rand), identity addresses and IRKs to peer IDs,
+// <i> so that finding the bond for an encryption request, a connecting peer or a duplicate bond
+// <i> reads a single record from flash instead of every bond.
 //==========================================================
-// <e> NRF_CRYPTO_ENABLED - nrf_crypto - Cryptography library.
-//==========================================================
-#ifndef NRF_CRYPTO_ENABLED
-#define NRF_CRYPTO_ENABLED 1
+#ifndef PM_ID_INDEX_ENABLED
+#define PM_ID_INDEX_ENABLED 0
 #endif
-// <o> NRF_CRYPTO_ALLOCATOR  - Memory allocator
+// <o> PM_ID_INDEX_SIZE  - Number of slots in the hash table.
  
 
-// <i> Choose memory allocator used by nrf_crypto. Default is alloca if possible or nrf_malloc otherwise. If 'User macros' are selected, the user has to create 'nrf_crypto_allocator.h' file that contains NRF_CRYPTO_ALLOC, NRF_CRYPTO_FREE, and NRF_CRYPTO_ALLOC_ON_STACK.
-// <0=> Default 
-// <1=> User macros 
-// <2=> On stack (alloca) 
-// <3=> C dynamic memory (malloc) 
-// <4=> SDK Memory Manager (nrf_malloc) 
+// <i> Each slot uses 8 bytes of RAM, and each bonded peer uses up to 4 slots. If the table is
+// <i> full, lookups that miss search the flash.
+// <16=> 16 
+// <32=> 32 
+// <64=> 64 
+// <128=> 128 
+// <256=> 256 
+// <512=> 512 
 
-#ifndef NRF_CRYPTO_ALLOCATOR
-#define NRF_CRYPTO_ALLOCATOR 0
+#ifndef PM_ID_INDEX_SIZE
+#define PM_ID_INDEX_SIZE 64
 #endif
 
-// <e> NRF_CRYPTO_BACKEND_CC310_BL_ENABLED - Enable the ARM Cryptocell CC310 reduced backend.
+// </e>
 
-// <i> The CC310 hardware-accelerated cryptography backend with reduced functionality and footprint (only available on nRF52840).
+// <e> PM_ID_KEY_CACHE_ENABLED - Enable/disable the RAM copy of bonded peer identity keys in Peer Manager.
+
+// <i> Keeps the identity address and IRK of each bond in RAM, updated as bonds are added and
+// <i> deleted, so that setting and getting the whitelist and the device identities list does not
+// <i> read flash. Also enables pm_whitelist_all_bonded_set().
 //==========================================================
-#ifndef NRF_CRYPTO_BACKEND_CC310_BL_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_BL_ENABLED 0
+#ifndef PM_ID_KEY_CACHE_ENABLED
+#define PM_ID_KEY_CACHE_ENABLED 0
 #endif
-// <q> NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP224R1_ENABLED  - Enable the secp224r1 elliptic curve support using CC310_BL.
- 
+// <o> PM_ID_KEY_CACHE_SIZE - Number of bonds kept in RAM. <1-255> 
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP224R1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP224R1_ENABLED 0
+
+// <i> Each bond uses 26 bytes of RAM. Bonds that do not fit are read from flash.
+
+#ifndef PM_ID_KEY_CACHE_SIZE
+#define PM_ID_KEY_CACHE_SIZE 8
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP256R1_ENABLED  - Enable the secp256r1 elliptic curve support using CC310_BL.
+// </e>
+
+// <q> PM_GATT_CACHING_ENABLED  - Enable/disable the GATT caching characteristics in Peer Manager.
  
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP256R1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP256R1_ENABLED 1
+// <i> Adds the Database Hash and Client Supported Features characteristics (Bluetooth 5.1), so that
+// <i> peers can tell from the hash whether the local database has changed, and skip rediscovery if
+// <i> it has not. The hash is computed when first read, and again after pm_local_database_has_changed().
+// <i> A peer that reads the hash no longer needs a pending service changed indication.
+// <i> Requires PM_SERVICE_CHANGED_ENABLED.
+
+#ifndef PM_GATT_CACHING_ENABLED
+#define PM_GATT_CACHING_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_BL_HASH_SHA256_ENABLED  - CC310_BL SHA-256 hash functionality.
+// <q> PM_CONCURRENT_PAIRING_ENABLED  - Enable/disable separate key buffers for each link in Peer Manager.
  
 
-// <i> CC310_BL backend implementation for hardware-accelerated SHA-256.
+// <i> Keys received during bonding are kept in a RAM buffer owned by the link, instead of one of the
+// <i> PM_FLASH_BUFFERS flash buffers. Pairing on many links at once no longer waits for bonds on
+// <i> other links to be written to flash, and a new bond waits on its own link until a flash buffer
+// <i> is available. Uses about 150 bytes of RAM per link.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_BL_HASH_SHA256_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_BL_HASH_SHA256_ENABLED 1
+#ifndef PM_CONCURRENT_PAIRING_ENABLED
+#define PM_CONCURRENT_PAIRING_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_ENABLED  - nrf_cc310_bl buffers to RAM before running hash operation
+// <q> PM_BULK_DELETE_ENABLED  - Enable/disable bulk deletion of peers in Peer Manager.
  
 
-// <i> Enabling this makes hashing of addresses in FLASH range possible. Size of buffer allocated for hashing is set by NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_SIZE
+// <i> pm_peers_delete() and pm_peers_delete_except() mark all the peers as deleted at once, queue the
+// <i> deletion of their files in Flash Data Storage back-to-back, and run garbage collection once when
+// <i> all files are deleted. A single PM_EVT_PEERS_DELETE_SUCCEEDED or PM_EVT_PEERS_DELETE_FAILED
+// <i> event is sent instead of an event for each peer.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_ENABLED 0
+#ifndef PM_BULK_DELETE_ENABLED
+#define PM_BULK_DELETE_ENABLED 0
 #endif
 
-// <o> NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_SIZE - nrf_cc310_bl hash outputs digests in little endian 
-// <i> Makes the nrf_cc310_bl hash functions output digests in little endian format. Only for use in nRF SDK DFU!
+// <e> PM_COMPACT_SYS_ATTR_ENABLED - Enable/disable compact storage of CCCD states in Peer Manager.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_SIZE
-#define NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_SIZE 4096
+// <i> Stores the system attributes of each peer as 2 bits per CCCD, against a table of the CCCD
+// <i> handles in the local database, instead of the full data from sd_ble_gatts_sys_attr_get().
+// <i> The full data is rebuilt when connecting and applied with one sd_ble_gatts_sys_attr_set().
+// <i> Records are only written when a CCCD has changed. Data that does not fit the table, such as
+// <i> attributes other than CCCDs, is stored in full as before. Records in the compact format are
+// <i> not applied if this option is later disabled, or if the local database changes.
+//==========================================================
+#ifndef PM_COMPACT_SYS_ATTR_ENABLED
+#define PM_COMPACT_SYS_ATTR_ENABLED 0
 #endif
-
-// <q> NRF_CRYPTO_BACKEND_CC310_BL_INTERRUPTS_ENABLED  - Enable Interrupts while support using CC310 bl.
+// <o> PM_COMPACT_SYS_ATTR_MAX_CCCDS  - Maximum number of CCCDs in the local database.
  
 
-// <i> Select a library version compatible with the configuration. When interrupts are disable, a version named _noint must be used
+// <i> Each CCCD uses 8 bytes of RAM. With more CCCDs than this, system attributes are stored in full.
+// <16=> 16 
+// <32=> 32 
+// <64=> 64 
+// <128=> 128 
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_BL_INTERRUPTS_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_BL_INTERRUPTS_ENABLED 1
+#ifndef PM_COMPACT_SYS_ATTR_MAX_CCCDS
+#define PM_COMPACT_SYS_ATTR_MAX_CCCDS 32
 #endif
 
 // </e>
 
-// <e> NRF_CRYPTO_BACKEND_CC310_ENABLED - Enable the ARM Cryptocell CC310 backend.
+// <e> PM_SYS_ATTR_CACHE_ENABLED - Enable/disable the RAM cache of system attributes in Peer Manager.
 
-// <i> The CC310 hardware-accelerated cryptography backend (only available on nRF52840).
+// <i> Keeps the latest system attributes (CCCD states) of the most recently connected bonded peers
+// <i> in RAM. When such a peer reconnects and is identified, its attributes are applied without
+// <i> reading or decoding its flash record, so notifications can be sent right away.
 //==========================================================
-#ifndef NRF_CRYPTO_BACKEND_CC310_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ENABLED 0
+#ifndef PM_SYS_ATTR_CACHE_ENABLED
+#define PM_SYS_ATTR_CACHE_ENABLED 0
 #endif
-// <q> NRF_CRYPTO_BACKEND_CC310_AES_CBC_ENABLED  - Enable the AES CBC mode using CC310.
- 
+// <o> PM_SYS_ATTR_CACHE_SIZE - Number of cached peers.  <1-255> 
+// <i> Each entry uses PM_SYS_ATTR_CACHE_MAX_LEN + 12 bytes of RAM.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CBC_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_AES_CBC_ENABLED 1
+#ifndef PM_SYS_ATTR_CACHE_SIZE
+#define PM_SYS_ATTR_CACHE_SIZE 4
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_AES_CTR_ENABLED  - Enable the AES CTR mode using CC310.
- 
+// <o> PM_SYS_ATTR_CACHE_MAX_LEN - Maximum length of the system attributes of a cached peer.  <8-512> 
+// <i> Each CCCD takes 6 bytes, plus 2 bytes of CRC. Peers with longer system attributes are read from flash.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CTR_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_AES_CTR_ENABLED 1
+#ifndef PM_SYS_ATTR_CACHE_MAX_LEN
+#define PM_SYS_ATTR_CACHE_MAX_LEN 64
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_AES_ECB_ENABLED  - Enable the AES ECB mode using CC310.
- 
-
-#ifndef NRF_CRYPTO_BACKEND_CC310_AES_ECB_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_AES_ECB_ENABLED 1
-#endif
+// </e>
 
-// <q> NRF_CRYPTO_BACKEND_CC310_AES_CBC_MAC_ENABLED  - Enable the AES CBC_MAC mode using CC310.
- 
+// <o> PM_HANDLER_SEC_DELAY_MS - Delay before starting security. 
+// <i>  This might be necessary for interoperability reasons, especially as peripheral.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CBC_MAC_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_AES_CBC_MAC_ENABLED 1
+#ifndef PM_HANDLER_SEC_DELAY_MS
+#define PM_HANDLER_SEC_DELAY_MS 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_AES_CMAC_ENABLED  - Enable the AES CMAC mode using CC310.
- 
+// </e>
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CMAC_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_AES_CMAC_ENABLED 1
-#endif
+// </h> 
+//==========================================================
 
-// <q> NRF_CRYPTO_BACKEND_CC310_AES_CCM_ENABLED  - Enable the AES CCM mode using CC310.
+// <h> nRF_BLE_Services 
+
+//==========================================================
+// <q> BLE_ANCS_C_ENABLED  - ble_ancs_c - Apple Notification Service Client
  
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CCM_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_AES_CCM_ENABLED 1
+#ifndef BLE_ANCS_C_ENABLED
+#define BLE_ANCS_C_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_AES_CCM_STAR_ENABLED  - Enable the AES CCM* mode using CC310.
- 
+// <h> ble_ancs_c - Apple Notification Service Client attribute caches
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CCM_STAR_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_AES_CCM_STAR_ENABLED 1
+//==========================================================
+// <o> BLE_ANCS_C_APP_ATTR_CACHE_SIZE - Number of app display names cached per client instance. <0-32> 
+// <i> App attribute requests for a cached app identifier are answered locally, without GATT traffic.
+// <i> The least recently used entry is replaced when the cache is full. 0 disables the cache.
+
+#ifndef BLE_ANCS_C_APP_ATTR_CACHE_SIZE
+#define BLE_ANCS_C_APP_ATTR_CACHE_SIZE 8
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_CHACHA_POLY_ENABLED  - Enable the CHACHA-POLY mode using CC310.
- 
+// <o> BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE - Number of iOS notifications whose attributes are cached per client instance. <0-16> 
+// <i> Entries are keyed by notification UID and dropped when the notification is modified or removed,
+// <i> and on disconnection. Each entry takes about 300 bytes. 0 disables the cache.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_CHACHA_POLY_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_CHACHA_POLY_ENABLED 1
+#ifndef BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE
+#define BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R1_ENABLED  - Enable the secp160r1 elliptic curve support using CC310.
+// </h> 
+//==========================================================
+
+// <q> BLE_ANS_C_ENABLED  - ble_ans_c - Alert Notification Service Client
  
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R1_ENABLED 1
+#ifndef BLE_ANS_C_ENABLED
+#define BLE_ANS_C_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R2_ENABLED  - Enable the secp160r2 elliptic curve support using CC310.
+// <q> BLE_BAS_C_ENABLED  - ble_bas_c - Battery Service Client
  
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R2_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R2_ENABLED 1
+#ifndef BLE_BAS_C_ENABLED
+#define BLE_BAS_C_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP192R1_ENABLED  - Enable the secp192r1 elliptic curve support using CC310.
+// <e> BLE_BAS_ENABLED - ble_bas - Battery Service
+//==========================================================
+#ifndef BLE_BAS_ENABLED
+#define BLE_BAS_ENABLED 1
+#endif
+// <e> BLE_BAS_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef BLE_BAS_CONFIG_LOG_ENABLED
+#define BLE_BAS_CONFIG_LOG_ENABLED 0
+#endif
+// <o> BLE_BAS_CONFIG_LOG_LEVEL  - Default Severity level
  
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP192R1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP192R1_ENABLED 1
+#ifndef BLE_BAS_CONFIG_LOG_LEVEL
+#define BLE_BAS_CONFIG_LOG_LEVEL 3
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP224R1_ENABLED  - Enable the secp224r1 elliptic curve support using CC310.
+// <o> BLE_BAS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP224R1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP224R1_ENABLED 1
+#ifndef BLE_BAS_CONFIG_INFO_COLOR
+#define BLE_BAS_CONFIG_INFO_COLOR 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP256R1_ENABLED  - Enable the secp256r1 elliptic curve support using CC310.
+// <o> BLE_BAS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP256R1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP256R1_ENABLED 1
+#ifndef BLE_BAS_CONFIG_DEBUG_COLOR
+#define BLE_BAS_CONFIG_DEBUG_COLOR 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP384R1_ENABLED  - Enable the secp384r1 elliptic curve support using CC310.
- 
+// </e>
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP384R1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP384R1_ENABLED 1
-#endif
+// </e>
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP521R1_ENABLED  - Enable the secp521r1 elliptic curve support using CC310.
+// <q> BLE_BAS_MONITOR_ENABLED  - ble_bas_monitor - Battery Level hysteresis and SAADC sourcing
  
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP521R1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP521R1_ENABLED 1
+// <i> Reports the Battery Level only on a minimum change and at a minimum interval, and can take
+// <i> the level from an app_saadc acquisition channel without extra conversions.
+
+#ifndef BLE_BAS_MONITOR_ENABLED
+#define BLE_BAS_MONITOR_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP160K1_ENABLED  - Enable the secp160k1 elliptic curve support using CC310.
+// <q> BLE_CSCS_ENABLED  - ble_cscs - Cycling Speed and Cadence Service
  
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP160K1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP160K1_ENABLED 1
+#ifndef BLE_CSCS_ENABLED
+#define BLE_CSCS_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP192K1_ENABLED  - Enable the secp192k1 elliptic curve support using CC310.
+// <q> BLE_CTS_C_ENABLED  - ble_cts_c - Current Time Service Client
  
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP192K1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP192K1_ENABLED 1
+#ifndef BLE_CTS_C_ENABLED
+#define BLE_CTS_C_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP224K1_ENABLED  - Enable the secp224k1 elliptic curve support using CC310.
- 
+// <e> BLE_CTS_C_CLOCK_ENABLED - ble_cts_c_clock - Local clock synchronized by the Current Time Service client
+//==========================================================
+#ifndef BLE_CTS_C_CLOCK_ENABLED
+#define BLE_CTS_C_CLOCK_ENABLED 0
+#endif
+// <o> BLE_CTS_C_CLOCK_RESYNC_INTERVAL_S - Interval (in seconds) at which the Current Time is read again. 
+// <i> Adjustments made on the server are notified, so this only limits the error caused by the drift of the low frequency clock.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP224K1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP224K1_ENABLED 1
+#ifndef BLE_CTS_C_CLOCK_RESYNC_INTERVAL_S
+#define BLE_CTS_C_CLOCK_RESYNC_INTERVAL_S 86400
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP256K1_ENABLED  - Enable the secp256k1 elliptic curve support using CC310.
- 
+// <o> BLE_CTS_C_CLOCK_MAX_DRIFT_PPM - Largest drift (in ppm) of the low frequency clock that is compensated. 
+// <i> A larger measured drift is assumed to be an adjustment of the time on the server, and is limited to this value.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP256K1_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP256K1_ENABLED 1
+#ifndef BLE_CTS_C_CLOCK_MAX_DRIFT_PPM
+#define BLE_CTS_C_CLOCK_MAX_DRIFT_PPM 250
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_CURVE25519_ENABLED  - Enable the Curve25519 curve support using CC310.
- 
+// <o> BLE_CTS_C_CLOCK_MIN_DRIFT_INTERVAL_S - Shortest interval (in seconds) over which the drift is measured. 
+// <i> The Current Time has a resolution of 1/256 s, so the drift cannot be measured precisely over a short interval.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_CURVE25519_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_CURVE25519_ENABLED 1
+#ifndef BLE_CTS_C_CLOCK_MIN_DRIFT_INTERVAL_S
+#define BLE_CTS_C_CLOCK_MIN_DRIFT_INTERVAL_S 3600
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_ECC_ED25519_ENABLED  - Enable the Ed25519 curve support using CC310.
+// </e>
+
+// <q> BLE_DIS_ENABLED  - ble_dis - Device Information Service
  
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_ED25519_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_ECC_ED25519_ENABLED 1
+#ifndef BLE_DIS_ENABLED
+#define BLE_DIS_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_HASH_SHA256_ENABLED  - CC310 SHA-256 hash functionality.
+// <q> NRF_BLE_ESCS_BULK_CONFIG_ENABLED  - Enables the Bulk Configuration characteristic in nrf_ble_escs.
  
 
-// <i> CC310 backend implementation for hardware-accelerated SHA-256.
+// <i> Adds a vendor specific characteristic to the Eddystone Configuration Service that reads
+// <i> and writes the configuration of all slots in one (long) write, validated as a whole.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_HASH_SHA256_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_HASH_SHA256_ENABLED 1
+#ifndef NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+#define NRF_BLE_ESCS_BULK_CONFIG_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_HASH_SHA512_ENABLED  - CC310 SHA-512 hash functionality
- 
-
-// <i> CC310 backend implementation for SHA-512 (in software).
+// <e> BLE_GLS_ENABLED - ble_gls - Glucose Service
+//==========================================================
+#ifndef BLE_GLS_ENABLED
+#define BLE_GLS_ENABLED 0
+#endif
+// <o> BLE_GLS_DB_MAX_RECORDS - Maximum number of glucose records in the database. <1-256> 
+// <i> Records are kept in a RAM ring in sequence number order.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_HASH_SHA512_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_HASH_SHA512_ENABLED 1
+#ifndef BLE_GLS_DB_MAX_RECORDS
+#define BLE_GLS_DB_MAX_RECORDS 20
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_HMAC_SHA256_ENABLED  - CC310 HMAC using SHA-256
- 
+// </e>
 
-// <i> CC310 backend implementation for HMAC using hardware-accelerated SHA-256.
+// <e> CGMS_DB_FLASH_ENABLED - Store the CGM Service records in flash.
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_HMAC_SHA256_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_HMAC_SHA256_ENABLED 1
+// <i> Keeps the records of the experimental CGM Service database in an append-only ring of flash
+// <i> pages, written through nrf_fstorage, instead of a RAM array of CGMS_DB_MAX_RECORDS records.
+// <i> When the ring is full, the oldest page is erased to make room, so pages wear evenly.
+//==========================================================
+#ifndef CGMS_DB_FLASH_ENABLED
+#define CGMS_DB_FLASH_ENABLED 0
+#endif
+// <o> CGMS_DB_FLASH_START_ADDR - Address of the first flash page. Must be page aligned, and not used by FDS or the application.
+#ifndef CGMS_DB_FLASH_START_ADDR
+#define CGMS_DB_FLASH_START_ADDR 0xE0000
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_HMAC_SHA512_ENABLED  - CC310 HMAC using SHA-512
- 
+// <o> CGMS_DB_FLASH_PAGES - Number of flash pages. <2-64> 
+// <i> Each 4 kB page holds 255 records.
 
-// <i> CC310 backend implementation for HMAC using SHA-512 (in software).
+#ifndef CGMS_DB_FLASH_PAGES
+#define CGMS_DB_FLASH_PAGES 8
+#endif
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_HMAC_SHA512_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_HMAC_SHA512_ENABLED 1
+// <o> CGMS_DB_FLASH_QUEUE_SIZE - Number of records that can wait to be written to flash. 
+#ifndef CGMS_DB_FLASH_QUEUE_SIZE
+#define CGMS_DB_FLASH_QUEUE_SIZE 4
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_RNG_ENABLED  - Enable RNG support using CC310.
+// </e>
+
+// <q> BLE_HIDS_ENABLED  - ble_hids - Human Interface Device Service
  
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_RNG_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_RNG_ENABLED 1
+#ifndef BLE_HIDS_ENABLED
+#define BLE_HIDS_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_CC310_INTERRUPTS_ENABLED  - Enable Interrupts while support using CC310.
- 
+// <e> BLE_HIDS_FAST_ENABLED - ble_hids_fast - HID Service Input Report fast path
 
-// <i> Select a library version compatible with the configuration. When interrupts are disable, a version named _noint must be used
+// <i> Sends Input Reports through precomputed per-link tables, and merges reports while the notification queue is full.
+//==========================================================
+#ifndef BLE_HIDS_FAST_ENABLED
+#define BLE_HIDS_FAST_ENABLED 0
+#endif
+// <o> BLE_HIDS_FAST_INP_REP_MAX - Maximum number of Input Reports.  <1-32> 
 
-#ifndef NRF_CRYPTO_BACKEND_CC310_INTERRUPTS_ENABLED
-#define NRF_CRYPTO_BACKEND_CC310_INTERRUPTS_ENABLED 1
+#ifndef BLE_HIDS_FAST_INP_REP_MAX
+#define BLE_HIDS_FAST_INP_REP_MAX 4
 #endif
 
-// </e>
+// <o> BLE_HIDS_FAST_REP_MAX_LEN - Maximum length of an Input Report held while the notification queue is full. 
+// <i> Each link holds up to BLE_HIDS_FAST_INP_REP_MAX reports of this length.
 
-// <e> NRF_CRYPTO_BACKEND_CIFRA_ENABLED - Enable the Cifra backend.
-//==========================================================
-#ifndef NRF_CRYPTO_BACKEND_CIFRA_ENABLED
-#define NRF_CRYPTO_BACKEND_CIFRA_ENABLED 0
+#ifndef BLE_HIDS_FAST_REP_MAX_LEN
+#define BLE_HIDS_FAST_REP_MAX_LEN 8
 #endif
-// <q> NRF_CRYPTO_BACKEND_CIFRA_AES_EAX_ENABLED  - Enable the AES EAX mode using Cifra.
- 
 
-#ifndef NRF_CRYPTO_BACKEND_CIFRA_AES_EAX_ENABLED
-#define NRF_CRYPTO_BACKEND_CIFRA_AES_EAX_ENABLED 1
+// <o> BLE_HIDS_FAST_REPORT_ID_MAX - Largest Report ID of an Input Report.  <0-255> 
+
+#ifndef BLE_HIDS_FAST_REPORT_ID_MAX
+#define BLE_HIDS_FAST_REPORT_ID_MAX 15
 #endif
 
 // </e>
 
-// <e> NRF_CRYPTO_BACKEND_MBEDTLS_ENABLED - Enable the mbed TLS backend.
+// <e> BLE_HIDS_TX_ENABLED - ble_hids_tx - HID Service transmit scheduler
+
+// <i> Sends the reports of each link in order from a ring of slots, merging reports only when no key state is lost.
 //==========================================================
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ENABLED 0
+#ifndef BLE_HIDS_TX_ENABLED
+#define BLE_HIDS_TX_ENABLED 0
 #endif
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_ENABLED  - Enable the AES CBC mode mbed TLS.
- 
+// <o> BLE_HIDS_TX_INP_REP_MAX - Maximum number of Input Reports.  <1-255> 
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_ENABLED 1
+#ifndef BLE_HIDS_TX_INP_REP_MAX
+#define BLE_HIDS_TX_INP_REP_MAX 4
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CTR_ENABLED  - Enable the AES CTR mode using mbed TLS.
- 
+// <o> BLE_HIDS_TX_REP_MAX_LEN - Maximum length of a scheduled report.  <8-255> 
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CTR_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CTR_ENABLED 1
+#ifndef BLE_HIDS_TX_REP_MAX_LEN
+#define BLE_HIDS_TX_REP_MAX_LEN 8
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CFB_ENABLED  - Enable the AES CFB mode using mbed TLS.
- 
+// <o> BLE_HIDS_TX_QUEUE_SIZE - Number of report slots of each link.  <1-255> 
+// <i> Reports are rejected with NRF_ERROR_NO_MEM while all slots of the link are waiting for the notification queue.
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CFB_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CFB_ENABLED 1
+#ifndef BLE_HIDS_TX_QUEUE_SIZE
+#define BLE_HIDS_TX_QUEUE_SIZE 8
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_ECB_ENABLED  - Enable the AES ECB mode using mbed TLS.
+// </e>
+
+// <q> BLE_HRS_C_ENABLED  - ble_hrs_c - Heart Rate Service Client
  
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_ECB_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_ECB_ENABLED 1
+#ifndef BLE_HRS_C_ENABLED
+#define BLE_HRS_C_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_MAC_ENABLED  - Enable the AES CBC MAC mode using mbed TLS.
+// <q> BLE_HRS_ENABLED  - ble_hrs - Heart Rate Service
  
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_MAC_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_MAC_ENABLED 1
+#ifndef BLE_HRS_ENABLED
+#define BLE_HRS_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CMAC_ENABLED  - Enable the AES CMAC mode using mbed TLS.
- 
+// <e> BLE_HRS_MULTI_ENABLED - ble_hrs_multi - Heart Rate Measurement fan-out to multiple links
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CMAC_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CMAC_ENABLED 1
+// <i> Notifies each Heart Rate Measurement to all connected collectors through nrf_ble_gq, with per-link RR-Interval cursors.
+//==========================================================
+#ifndef BLE_HRS_MULTI_ENABLED
+#define BLE_HRS_MULTI_ENABLED 0
 #endif
+// <o> BLE_HRS_MULTI_RR_INTERVALS_MAX - Number of RR-Intervals buffered for all links.  <1-255> 
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CCM_ENABLED  - Enable the AES CCM mode using mbed TLS.
+#ifndef BLE_HRS_MULTI_RR_INTERVALS_MAX
+#define BLE_HRS_MULTI_RR_INTERVALS_MAX 20
+#endif
+
+// </e>
+
+// <q> BLE_HTS_ENABLED  - ble_hts - Health Thermometer Service
  
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CCM_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CCM_ENABLED 1
+#ifndef BLE_HTS_ENABLED
+#define BLE_HTS_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_GCM_ENABLED  - Enable the AES GCM mode using mbed TLS.
+// <q> BLE_IAS_C_ENABLED  - ble_ias_c - Immediate Alert Service Client
  
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_GCM_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_GCM_ENABLED 1
+#ifndef BLE_IAS_C_ENABLED
+#define BLE_IAS_C_ENABLED 1
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192R1_ENABLED  - Enable secp192r1 (NIST 192-bit) curve
+// <e> BLE_IAS_ENABLED - ble_ias - Immediate Alert Service
+//==========================================================
+#ifndef BLE_IAS_ENABLED
+#define BLE_IAS_ENABLED 1
+#endif
+// <e> BLE_IAS_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef BLE_IAS_CONFIG_LOG_ENABLED
+#define BLE_IAS_CONFIG_LOG_ENABLED 0
+#endif
+// <o> BLE_IAS_CONFIG_LOG_LEVEL  - Default Severity level
  
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-// <i> Enable this setting if you need secp192r1 (NIST 192-bit) support using MBEDTLS
-
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192R1_ENABLED 1
+#ifndef BLE_IAS_CONFIG_LOG_LEVEL
+#define BLE_IAS_CONFIG_LOG_LEVEL 3
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224R1_ENABLED  - Enable secp224r1 (NIST 224-bit) curve
+// <o> BLE_IAS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-// <i> Enable this setting if you need secp224r1 (NIST 224-bit) support using MBEDTLS
-
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224R1_ENABLED 1
+#ifndef BLE_IAS_CONFIG_INFO_COLOR
+#define BLE_IAS_CONFIG_INFO_COLOR 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256R1_ENABLED  - Enable secp256r1 (NIST 256-bit) curve
+// <o> BLE_IAS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-// <i> Enable this setting if you need secp256r1 (NIST 256-bit) support using MBEDTLS
-
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256R1_ENABLED 1
+#ifndef BLE_IAS_CONFIG_DEBUG_COLOR
+#define BLE_IAS_CONFIG_DEBUG_COLOR 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP384R1_ENABLED  - Enable secp384r1 (NIST 384-bit) curve
- 
+// </e>
 
-// <i> Enable this setting if you need secp384r1 (NIST 384-bit) support using MBEDTLS
+// </e>
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP384R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP384R1_ENABLED 1
-#endif
+// <h> ble_ipsp - Internet Protocol Support Profile
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP521R1_ENABLED  - Enable secp521r1 (NIST 521-bit) curve
- 
+//==========================================================
+// <o> BLE_IPSP_MAX_CHANNELS - Maximum number of IPSP channels. 
+// <i> Each channel reserves BLE_IPSP_RX_BUFFER_COUNT receive buffers of BLE_IPSP_MTU bytes.
 
-// <i> Enable this setting if you need secp521r1 (NIST 521-bit) support using MBEDTLS
+#ifndef BLE_IPSP_MAX_CHANNELS
+#define BLE_IPSP_MAX_CHANNELS 1
+#endif
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP521R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP521R1_ENABLED 1
+// <o> BLE_IPSP_RX_BUFFER_COUNT - Number of receive buffers per IPSP channel.  <1-16> 
+// <i> Number of SDUs that can be received while an SDU is being consumed by the 6LoWPAN/IP stack.
+
+#ifndef BLE_IPSP_RX_BUFFER_COUNT
+#define BLE_IPSP_RX_BUFFER_COUNT 4
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192K1_ENABLED  - Enable secp192k1 (Koblitz 192-bit) curve
- 
+// <o> BLE_IPSP_TX_QUEUE_SIZE - Number of frames pending transmission per IPSP channel.
+// <i> Should not exceed the L2CAP TX queue size configured for the SoftDevice.
 
-// <i> Enable this setting if you need secp192k1 (Koblitz 192-bit) support using MBEDTLS
+#ifndef BLE_IPSP_TX_QUEUE_SIZE
+#define BLE_IPSP_TX_QUEUE_SIZE 2
+#endif
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192K1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192K1_ENABLED 1
+// <o> BLE_IPSP_TX_BUFFER_COUNT - Number of transmit gather buffers shared by all channels.
+// <i> Each buffer is BLE_IPSP_MTU bytes and holds a fragment chain that is not contiguous in memory.
+
+#ifndef BLE_IPSP_TX_BUFFER_COUNT
+#define BLE_IPSP_TX_BUFFER_COUNT 1
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224K1_ENABLED  - Enable secp224k1 (Koblitz 224-bit) curve
- 
+// </h> 
+//==========================================================
 
-// <i> Enable this setting if you need secp224k1 (Koblitz 224-bit) support using MBEDTLS
+// <q> BLE_LBS_C_ENABLED  - ble_lbs_c - Nordic LED Button Service Client
+ 
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224K1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224K1_ENABLED 1
+#ifndef BLE_LBS_C_ENABLED
+#define BLE_LBS_C_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256K1_ENABLED  - Enable secp256k1 (Koblitz 256-bit) curve
+// <q> BLE_LBS_ENABLED  - ble_lbs - LED Button Service
  
 
-// <i> Enable this setting if you need secp256k1 (Koblitz 256-bit) support using MBEDTLS
-
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256K1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256K1_ENABLED 1
+#ifndef BLE_LBS_ENABLED
+#define BLE_LBS_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP256R1_ENABLED  - Enable bp256r1 (Brainpool 256-bit) curve
+// <q> BLE_LLS_ENABLED  - ble_lls - Link Loss Service
  
 
-// <i> Enable this setting if you need bp256r1 (Brainpool 256-bit) support using MBEDTLS
-
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP256R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP256R1_ENABLED 1
+#ifndef BLE_LLS_ENABLED
+#define BLE_LLS_ENABLED 1
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP384R1_ENABLED  - Enable bp384r1 (Brainpool 384-bit) curve
+// <q> BLE_NUS_C_ENABLED  - ble_nus_c - Nordic UART Central Service
  
 
-// <i> Enable this setting if you need bp384r1 (Brainpool 384-bit) support using MBEDTLS
-
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP384R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP384R1_ENABLED 1
+#ifndef BLE_NUS_C_ENABLED
+#define BLE_NUS_C_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP512R1_ENABLED  - Enable bp512r1 (Brainpool 512-bit) curve
+// <q> BLE_NUS_C_STREAM_ENABLED  - Enables sending large buffers with ble_nus_c_stream_send().
  
 
-// <i> Enable this setting if you need bp512r1 (Brainpool 512-bit) support using MBEDTLS
+// <i> The buffer is split into write commands written directly to the SoftDevice, bypassing
+// <i> nrf_ble_gq, and the SoftDevice queue is refilled on every write command TX complete event.
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP512R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP512R1_ENABLED 1
+#ifndef BLE_NUS_C_STREAM_ENABLED
+#define BLE_NUS_C_STREAM_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_CURVE25519_ENABLED  - Enable Curve25519 curve
+// <q> BLE_NUS_C_LZ_ENABLED  - Enables compression with ble_nus_c_lz_start().
  
 
-// <i> Enable this setting if you need Curve25519 support using MBEDTLS
+// <i> The format is negotiated through the compression characteristic of the server, then
+// <i> strings, streams and notifications are sent as nrf_lz packets. Requires NRF_LZ_ENABLED.
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_CURVE25519_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_CURVE25519_ENABLED 1
+#ifndef BLE_NUS_C_LZ_ENABLED
+#define BLE_NUS_C_LZ_ENABLED 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA256_ENABLED  - Enable mbed TLS SHA-256 hash functionality.
- 
+// <e> BLE_NUS_C_L2CAP_ENABLED - Enables the L2CAP data channel with ble_nus_c_l2cap_open().
 
-// <i> mbed TLS backend implementation for SHA-256.
+// <i> The PSM is read from the L2CAP PSM characteristic of the server, then an LE credit-based
+// <i> channel is opened on it. The RX and TX characteristics stay usable. The connection
+// <i> configuration of the SoftDevice must have an L2CAP channel.
+//==========================================================
+#ifndef BLE_NUS_C_L2CAP_ENABLED
+#define BLE_NUS_C_L2CAP_ENABLED 0
+#endif
+// <o> BLE_NUS_C_L2CAP_MTU - Largest SDU received, and size of each receive buffer. <23-65535> 
+// <i> Every client instance holds BLE_NUS_C_L2CAP_RX_QUEUE_SIZE of these buffers.
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA256_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA256_ENABLED 1
+#ifndef BLE_NUS_C_L2CAP_MTU
+#define BLE_NUS_C_L2CAP_MTU 1024
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA512_ENABLED  - Enable mbed TLS SHA-512 hash functionality.
- 
+// <o> BLE_NUS_C_L2CAP_MPS - Largest PDU payload received. <23-65533> 
+// <i> Must not exceed rx_mps of the L2CAP connection configuration.
 
-// <i> mbed TLS backend implementation for SHA-512.
+#ifndef BLE_NUS_C_L2CAP_MPS
+#define BLE_NUS_C_L2CAP_MPS 247
+#endif
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA512_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA512_ENABLED 1
+// <o> BLE_NUS_C_L2CAP_RX_QUEUE_SIZE - Number of receive buffers kept posted. <1-8> 
+// <i> Should not exceed rx_queue_size of the L2CAP connection configuration.
+
+#ifndef BLE_NUS_C_L2CAP_RX_QUEUE_SIZE
+#define BLE_NUS_C_L2CAP_RX_QUEUE_SIZE 2
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA256_ENABLED  - Enable mbed TLS HMAC using SHA-256.
- 
+// </e>
 
-// <i> mbed TLS backend implementation for HMAC using SHA-256.
+// <e> BLE_NUS_C_BRIDGE_ENABLED - ble_nus_c_bridge - Framed forwarding between NUS client links and a UARTE
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA256_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA256_ENABLED 1
+// <i> Notifications are queued with nrfx_uarte_tx_queue() without copying when
+// <i> NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE is set. Requires BLE_NUS_C_ENABLED and CRC16_ENABLED.
+//==========================================================
+#ifndef BLE_NUS_C_BRIDGE_ENABLED
+#define BLE_NUS_C_BRIDGE_ENABLED 0
 #endif
+// <o> BLE_NUS_C_BRIDGE_FRAME_COUNT - Number of frames queued on the UART. <2-64> 
+// <i> The SoftDevice event dispatch is suspended when all of them are used.
 
-// <q> NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA512_ENABLED  - Enable mbed TLS HMAC using SHA-512.
- 
+#ifndef BLE_NUS_C_BRIDGE_FRAME_COUNT
+#define BLE_NUS_C_BRIDGE_FRAME_COUNT 8
+#endif
 
-// <i> mbed TLS backend implementation for HMAC using SHA-512.
+// <o> BLE_NUS_C_BRIDGE_TX_RING_SIZE - Size of the ring buffer for copied notifications. 
+// <i> Must be a power of 2 and hold at least two notifications of BLE_NUS_MAX_DATA_LEN bytes.
 
-#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA512_ENABLED
-#define NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA512_ENABLED 1
+#ifndef BLE_NUS_C_BRIDGE_TX_RING_SIZE
+#define BLE_NUS_C_BRIDGE_TX_RING_SIZE 1024
 #endif
 
 // </e>
 
-// <e> NRF_CRYPTO_BACKEND_MICRO_ECC_ENABLED - Enable the micro-ecc backend.
+// <e> BLE_NUS_ENABLED - ble_nus - Nordic UART Service
 //==========================================================
-#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ENABLED
-#define NRF_CRYPTO_BACKEND_MICRO_ECC_ENABLED 0
+#ifndef BLE_NUS_ENABLED
+#define BLE_NUS_ENABLED 0
 #endif
-// <q> NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP192R1_ENABLED  - Enable secp192r1 (NIST 192-bit) curve
- 
-
-// <i> Enable this setting if you need secp192r1 (NIST 192-bit) support using micro-ecc
-
-#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP192R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP192R1_ENABLED 1
+// <e> BLE_NUS_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef BLE_NUS_CONFIG_LOG_ENABLED
+#define BLE_NUS_CONFIG_LOG_ENABLED 0
 #endif
-
-// <q> NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP224R1_ENABLED  - Enable secp224r1 (NIST 224-bit) curve
+// <o> BLE_NUS_CONFIG_LOG_LEVEL  - Default Severity level
  
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-// <i> Enable this setting if you need secp224r1 (NIST 224-bit) support using micro-ecc
-
-#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP224R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP224R1_ENABLED 1
+#ifndef BLE_NUS_CONFIG_LOG_LEVEL
+#define BLE_NUS_CONFIG_LOG_LEVEL 3
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256R1_ENABLED  - Enable secp256r1 (NIST 256-bit) curve
+// <o> BLE_NUS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-// <i> Enable this setting if you need secp256r1 (NIST 256-bit) support using micro-ecc
-
-#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256R1_ENABLED
-#define NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256R1_ENABLED 1
+#ifndef BLE_NUS_CONFIG_INFO_COLOR
+#define BLE_NUS_CONFIG_INFO_COLOR 0
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256K1_ENABLED  - Enable secp256k1 (Koblitz 256-bit) curve
+// <o> BLE_NUS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-// <i> Enable this setting if you need secp256k1 (Koblitz 256-bit) support using micro-ecc
-
-#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256K1_ENABLED
-#define NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256K1_ENABLED 1
+#ifndef BLE_NUS_CONFIG_DEBUG_COLOR
+#define BLE_NUS_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> NRF_CRYPTO_BACKEND_NRF_HW_RNG_ENABLED - Enable the nRF HW RNG backend.
+// <q> BLE_NUS_STREAM_ENABLED  - Enables the streaming TX mode.
+ 
 
-// <i> The nRF HW backend provide access to RNG peripheral in nRF5x devices.
-//==========================================================
-#ifndef NRF_CRYPTO_BACKEND_NRF_HW_RNG_ENABLED
-#define NRF_CRYPTO_BACKEND_NRF_HW_RNG_ENABLED 0
+// <i> Data written with ble_nus_stream_write() is buffered in a ring buffer and sent
+// <i> in notifications of up to the negotiated length, refilled on every HVN TX complete event.
+
+#ifndef BLE_NUS_STREAM_ENABLED
+#define BLE_NUS_STREAM_ENABLED 0
 #endif
-// <q> NRF_CRYPTO_BACKEND_NRF_HW_RNG_MBEDTLS_CTR_DRBG_ENABLED  - Enable mbed TLS CTR-DRBG algorithm.
+
+// <q> BLE_NUS_RX_BUF_ENABLED  - Enables delivering received data to a ring buffer.
  
 
-// <i> Enable mbed TLS CTR-DRBG standardized by NIST (NIST SP 800-90A Rev. 1). The nRF HW RNG is used as an entropy source for seeding.
+// <i> Data written by the peer is stored in the ring buffer given to ble_nus_init()
+// <i> and read with ble_nus_rx_get() and ble_nus_rx_free(), so it outlives the event.
 
-#ifndef NRF_CRYPTO_BACKEND_NRF_HW_RNG_MBEDTLS_CTR_DRBG_ENABLED
-#define NRF_CRYPTO_BACKEND_NRF_HW_RNG_MBEDTLS_CTR_DRBG_ENABLED 1
+#ifndef BLE_NUS_RX_BUF_ENABLED
+#define BLE_NUS_RX_BUF_ENABLED 0
 #endif
 
-// </e>
+// <q> BLE_NUS_RX_CREDITS_ENABLED  - Enables the RX credits characteristic.
+ 
 
-// <e> NRF_CRYPTO_BACKEND_NRF_SW_ENABLED - Enable the legacy nRFx sw for crypto.
+// <i> The characteristic tells the peer how many bytes it may send, so it stops before
+// <i> the RX ring buffer overflows. Requires BLE_NUS_RX_BUF_ENABLED.
 
-// <i> The nRF SW cryptography backend (only used in bootloader context).
-//==========================================================
-#ifndef NRF_CRYPTO_BACKEND_NRF_SW_ENABLED
-#define NRF_CRYPTO_BACKEND_NRF_SW_ENABLED 0
+#ifndef BLE_NUS_RX_CREDITS_ENABLED
+#define BLE_NUS_RX_CREDITS_ENABLED 0
 #endif
-// <q> NRF_CRYPTO_BACKEND_NRF_SW_HASH_SHA256_ENABLED  - nRF SW hash backend support for SHA-256
+
+// <q> BLE_NUS_LZ_ENABLED  - Enables the compression characteristic.
  
 
-// <i> The nRF SW backend provide access to nRF SDK legacy hash implementation of SHA-256.
+// <i> A peer that writes a supported nrf_lz format to the characteristic exchanges compressed
+// <i> packets on the RX and TX characteristics. One link at a time. Requires NRF_LZ_ENABLED.
 
-#ifndef NRF_CRYPTO_BACKEND_NRF_SW_HASH_SHA256_ENABLED
-#define NRF_CRYPTO_BACKEND_NRF_SW_HASH_SHA256_ENABLED 1
+#ifndef BLE_NUS_LZ_ENABLED
+#define BLE_NUS_LZ_ENABLED 0
 #endif
 
-// </e>
-
-// <e> NRF_CRYPTO_BACKEND_OBERON_ENABLED - Enable the Oberon backend
+// <e> BLE_NUS_L2CAP_ENABLED - Enables the L2CAP data channel.
 
-// <i> The Oberon backend
+// <i> Adds the L2CAP PSM characteristic. A peer that reads it can open an LE credit-based
+// <i> channel on that PSM and exchange data in SDUs of up to BLE_NUS_L2CAP_MTU bytes. The
+// <i> RX and TX characteristics stay usable. One channel at a time. The connection
+// <i> configuration of the SoftDevice must have an L2CAP channel.
 //==========================================================
-#ifndef NRF_CRYPTO_BACKEND_OBERON_ENABLED
-#define NRF_CRYPTO_BACKEND_OBERON_ENABLED 0
+#ifndef BLE_NUS_L2CAP_ENABLED
+#define BLE_NUS_L2CAP_ENABLED 0
 #endif
-// <q> NRF_CRYPTO_BACKEND_OBERON_CHACHA_POLY_ENABLED  - Enable the CHACHA-POLY mode using Oberon.
- 
-
-#ifndef NRF_CRYPTO_BACKEND_OBERON_CHACHA_POLY_ENABLED
-#define NRF_CRYPTO_BACKEND_OBERON_CHACHA_POLY_ENABLED 1
+// <o> BLE_NUS_L2CAP_PSM - LE PSM of the channel. <128-255> 
+#ifndef BLE_NUS_L2CAP_PSM
+#define BLE_NUS_L2CAP_PSM 128
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_OBERON_ECC_SECP256R1_ENABLED  - Enable secp256r1 curve
- 
+// <o> BLE_NUS_L2CAP_MTU - Largest SDU received, and size of each receive buffer. <23-65535> 
+#ifndef BLE_NUS_L2CAP_MTU
+#define BLE_NUS_L2CAP_MTU 1024
+#endif
 
-// <i> Enable this setting if you need secp256r1 curve support using Oberon library
+// <o> BLE_NUS_L2CAP_MPS - Largest PDU payload received. <23-65533> 
+// <i> Must not exceed rx_mps of the L2CAP connection configuration.
 
-#ifndef NRF_CRYPTO_BACKEND_OBERON_ECC_SECP256R1_ENABLED
-#define NRF_CRYPTO_BACKEND_OBERON_ECC_SECP256R1_ENABLED 1
+#ifndef BLE_NUS_L2CAP_MPS
+#define BLE_NUS_L2CAP_MPS 247
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_OBERON_ECC_CURVE25519_ENABLED  - Enable Curve25519 ECDH
- 
-
-// <i> Enable this setting if you need Curve25519 ECDH support using Oberon library
+// <o> BLE_NUS_L2CAP_RX_QUEUE_SIZE - Number of receive buffers kept posted. <1-8> 
+// <i> Should not exceed rx_queue_size of the L2CAP connection configuration.
 
-#ifndef NRF_CRYPTO_BACKEND_OBERON_ECC_CURVE25519_ENABLED
-#define NRF_CRYPTO_BACKEND_OBERON_ECC_CURVE25519_ENABLED 1
+#ifndef BLE_NUS_L2CAP_RX_QUEUE_SIZE
+#define BLE_NUS_L2CAP_RX_QUEUE_SIZE 2
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_OBERON_ECC_ED25519_ENABLED  - Enable Ed25519 signature scheme
- 
-
-// <i> Enable this setting if you need Ed25519 support using Oberon library
+// </e>
 
-#ifndef NRF_CRYPTO_BACKEND_OBERON_ECC_ED25519_ENABLED
-#define NRF_CRYPTO_BACKEND_OBERON_ECC_ED25519_ENABLED 1
-#endif
+// </e>
 
-// <q> NRF_CRYPTO_BACKEND_OBERON_HASH_SHA256_ENABLED  - Oberon SHA-256 hash functionality
- 
+// <h> ble_ots - Object Transfer Service
 
-// <i> Oberon backend implementation for SHA-256.
+//==========================================================
+// <o> BLE_OTS_L2CAP_RX_QUEUE_SIZE - Number of SDU buffers kept posted while receiving an object. <1-8> 
+// <i> Should not exceed rx_queue_size of the L2CAP connection configuration.
+// <i> Each buffer takes 1 kB of RAM.
 
-#ifndef NRF_CRYPTO_BACKEND_OBERON_HASH_SHA256_ENABLED
-#define NRF_CRYPTO_BACKEND_OBERON_HASH_SHA256_ENABLED 1
+#ifndef BLE_OTS_L2CAP_RX_QUEUE_SIZE
+#define BLE_OTS_L2CAP_RX_QUEUE_SIZE 2
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_OBERON_HASH_SHA512_ENABLED  - Oberon SHA-512 hash functionality
- 
-
-// <i> Oberon backend implementation for SHA-512.
+// <o> BLE_OTS_L2CAP_TX_QUEUE_SIZE - Number of SDU buffers used while sending an object from a storage backend. <1-8> 
+// <i> Each buffer takes 1 kB of RAM.
 
-#ifndef NRF_CRYPTO_BACKEND_OBERON_HASH_SHA512_ENABLED
-#define NRF_CRYPTO_BACKEND_OBERON_HASH_SHA512_ENABLED 1
+#ifndef BLE_OTS_L2CAP_TX_QUEUE_SIZE
+#define BLE_OTS_L2CAP_TX_QUEUE_SIZE 2
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA256_ENABLED  - Oberon HMAC using SHA-256
- 
+// <e> BLE_OTS_FLASH_ENABLED - Flash storage backend for objects.
 
-// <i> Oberon backend implementation for HMAC using SHA-256.
+// <i> Keeps one object in a range of flash pages, written through nrf_fstorage with two RAM buffers
+// <i> so that an SDU can be received while the previous buffer is written.
+//==========================================================
+#ifndef BLE_OTS_FLASH_ENABLED
+#define BLE_OTS_FLASH_ENABLED 0
+#endif
+// <o> BLE_OTS_FLASH_START_ADDR - Address of the first flash page. Must be page aligned, and not used by FDS or the application.
+#ifndef BLE_OTS_FLASH_START_ADDR
+#define BLE_OTS_FLASH_START_ADDR 0x80000
+#endif
 
-#ifndef NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA256_ENABLED
-#define NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA256_ENABLED 1
+// <o> BLE_OTS_FLASH_PAGES - Number of 4 kB flash pages. <1-256> 
+#ifndef BLE_OTS_FLASH_PAGES
+#define BLE_OTS_FLASH_PAGES 64
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA512_ENABLED  - Oberon HMAC using SHA-512
- 
+// <o> BLE_OTS_FLASH_BUF_SIZE - Size of each of the two write buffers.
 
-// <i> Oberon backend implementation for HMAC using SHA-512.
+// <1024=> 1024 
+// <2048=> 2048 
+// <4096=> 4096 
 
-#ifndef NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA512_ENABLED
-#define NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA512_ENABLED 1
+#ifndef BLE_OTS_FLASH_BUF_SIZE
+#define BLE_OTS_FLASH_BUF_SIZE 1024
 #endif
 
 // </e>
 
-// <e> NRF_CRYPTO_BACKEND_OPTIGA_ENABLED - Enable the nrf_crypto Optiga Trust X backend.
+// </h> 
+//==========================================================
+
+// <h> nrf_ble_ots_c - Object Transfer Service Client
 
-// <i> Enables the nrf_crypto backend for Optiga Trust X devices.
 //==========================================================
-#ifndef NRF_CRYPTO_BACKEND_OPTIGA_ENABLED
-#define NRF_CRYPTO_BACKEND_OPTIGA_ENABLED 0
+// <o> BLE_OTS_C_L2CAP_RX_QUEUE_SIZE - Number of SDU buffers kept posted while fetching an object. <1-8> 
+// <i> Should not exceed rx_queue_size of the L2CAP connection configuration.
+
+#ifndef BLE_OTS_C_L2CAP_RX_QUEUE_SIZE
+#define BLE_OTS_C_L2CAP_RX_QUEUE_SIZE 2
 #endif
-// <q> NRF_CRYPTO_BACKEND_OPTIGA_RNG_ENABLED  - Optiga backend support for RNG
- 
 
-// <i> The Optiga backend provide external chip RNG.
+// <o> BLE_OTS_C_L2CAP_SDU_SIZE - Size of each SDU buffer. 
+// <i> Must not be smaller than the rx_mtu used when setting up the channel.
+// <i> Every client instance holds BLE_OTS_C_L2CAP_RX_QUEUE_SIZE of these buffers.
 
-#ifndef NRF_CRYPTO_BACKEND_OPTIGA_RNG_ENABLED
-#define NRF_CRYPTO_BACKEND_OPTIGA_RNG_ENABLED 0
+#ifndef BLE_OTS_C_L2CAP_SDU_SIZE
+#define BLE_OTS_C_L2CAP_SDU_SIZE 512
 #endif
 
-// <q> NRF_CRYPTO_BACKEND_OPTIGA_ECC_SECP256R1_ENABLED  - Optiga backend support for ECC secp256r1
- 
+// </h> 
+//==========================================================
 
-// <i> The Optiga backend provide external chip ECC using secp256r1.
+// <q> BLE_RSCS_C_ENABLED  - ble_rscs_c - Running Speed and Cadence Client
+ 
 
-#ifndef NRF_CRYPTO_BACKEND_OPTIGA_ECC_SECP256R1_ENABLED
-#define NRF_CRYPTO_BACKEND_OPTIGA_ECC_SECP256R1_ENABLED 1
+#ifndef BLE_RSCS_C_ENABLED
+#define BLE_RSCS_C_ENABLED 0
 #endif
 
-// </e>
+// <q> BLE_RSCS_ENABLED  - ble_rscs - Running Speed and Cadence Service
+ 
 
-// <q> NRF_CRYPTO_CURVE25519_BIG_ENDIAN_ENABLED  - Big-endian byte order in raw Curve25519 data
+#ifndef BLE_RSCS_ENABLED
+#define BLE_RSCS_ENABLED 0
+#endif
+
+// <q> BLE_TPS_ENABLED  - ble_tps - TX Power Service
  
 
-// <i> Enable big-endian byte order in Curve25519 API, if set to 1. Use little-endian, if set to 0.
+#ifndef BLE_TPS_ENABLED
+#define BLE_TPS_ENABLED 1
+#endif
 
-#ifndef NRF_CRYPTO_CURVE25519_BIG_ENDIAN_ENABLED
-#define NRF_CRYPTO_CURVE25519_BIG_ENDIAN_ENABLED 0
+// <e> BLE_TPS_CTRL_ENABLED - ble_tps_ctrl - RSSI-driven TX power control per link
+
+// <i> Steps the TX power of each link to keep the estimated RSSI at the peer within a target band,
+// <i> and updates the TX Power Level characteristic. Requires BLE_CONN_STATE_STATS_ENABLED.
+//==========================================================
+#ifndef BLE_TPS_CTRL_ENABLED
+#define BLE_TPS_CTRL_ENABLED 0
+#endif
+// <o> BLE_TPS_CTRL_RSSI_SKIP_COUNT - Number of RSSI samples with a change of 1 dBm or more skipped before one is reported.  <0-255> 
+
+#ifndef BLE_TPS_CTRL_RSSI_SKIP_COUNT
+#define BLE_TPS_CTRL_RSSI_SKIP_COUNT 4
 #endif
 
 // </e>
@@ -1405,868 +1880,3243 @@
 // </h> 
 //==========================================================
 
-// <h> nRF_DFU 
+// <h> nRF_Core 
 
 //==========================================================
-// <h> ble_dfu - Device Firmware Update
-
+// <e> NRF_MPU_LIB_ENABLED - nrf_mpu_lib - Module for MPU
 //==========================================================
-// <q> BLE_DFU_ENABLED  - Enable DFU Service.
+#ifndef NRF_MPU_LIB_ENABLED
+#define NRF_MPU_LIB_ENABLED 0
+#endif
+// <q> NRF_MPU_LIB_CLI_CMDS  - Enable CLI commands specific to the module.
  
 
-#ifndef BLE_DFU_ENABLED
-#define BLE_DFU_ENABLED 0
+#ifndef NRF_MPU_LIB_CLI_CMDS
+#define NRF_MPU_LIB_CLI_CMDS 0
 #endif
 
-// <q> NRF_DFU_BLE_BUTTONLESS_SUPPORTS_BONDS  - Buttonless DFU supports bonds.
+// </e>
+
+// <e> NRF_STACK_GUARD_ENABLED - nrf_stack_guard - Stack guard
+//==========================================================
+#ifndef NRF_STACK_GUARD_ENABLED
+#define NRF_STACK_GUARD_ENABLED 0
+#endif
+// <o> NRF_STACK_GUARD_CONFIG_SIZE  - Size of the stack guard.
  
+// <5=> 32 bytes 
+// <6=> 64 bytes 
+// <7=> 128 bytes 
+// <8=> 256 bytes 
+// <9=> 512 bytes 
+// <10=> 1024 bytes 
+// <11=> 2048 bytes 
+// <12=> 4096 bytes 
 
-#ifndef NRF_DFU_BLE_BUTTONLESS_SUPPORTS_BONDS
-#define NRF_DFU_BLE_BUTTONLESS_SUPPORTS_BONDS 0
+#ifndef NRF_STACK_GUARD_CONFIG_SIZE
+#define NRF_STACK_GUARD_CONFIG_SIZE 7
 #endif
 
-// </h> 
-//==========================================================
+// </e>
 
 // </h> 
 //==========================================================
 
-// <h> nRF_Drivers 
+// <h> nRF_Crypto 
 
 //==========================================================
-// <e> COMP_ENABLED - nrf_drv_comp - COMP peripheral driver - legacy layer
+// <e> NRF_CRYPTO_ENABLED - nrf_crypto - Cryptography library.
 //==========================================================
-#ifndef COMP_ENABLED
-#define COMP_ENABLED 0
+#ifndef NRF_CRYPTO_ENABLED
+#define NRF_CRYPTO_ENABLED 1
 #endif
-// <o> COMP_CONFIG_REF  - Reference voltage
+// <o> NRF_CRYPTO_ALLOCATOR  - Memory allocator
  
-// <0=> Internal 1.2V 
-// <1=> Internal 1.8V 
-// <2=> Internal 2.4V 
-// <4=> VDD 
-// <7=> ARef 
-
-#ifndef COMP_CONFIG_REF
-#define COMP_CONFIG_REF 1
-#endif
 
-// <o> COMP_CONFIG_MAIN_MODE  - Main mode
- 
-// <0=> Single ended 
-// <1=> Differential 
+// <i> Choose memory allocator used by nrf_crypto. Default is alloca if possible or nrf_malloc otherwise. If 'User macros' are selected, the user has to create 'nrf_crypto_allocator.h' file that contains NRF_CRYPTO_ALLOC, NRF_CRYPTO_FREE, and NRF_CRYPTO_ALLOC_ON_STACK.
+// <0=> Default 
+// <1=> User macros 
+// <2=> On stack (alloca) 
+// <3=> C dynamic memory (malloc) 
+// <4=> SDK Memory Manager (nrf_malloc) 
 
-#ifndef COMP_CONFIG_MAIN_MODE
-#define COMP_CONFIG_MAIN_MODE 0
+#ifndef NRF_CRYPTO_ALLOCATOR
+#define NRF_CRYPTO_ALLOCATOR 0
 #endif
 
-// <o> COMP_CONFIG_SPEED_MODE  - Speed mode
- 
-// <0=> Low power 
-// <1=> Normal 
-// <2=> High speed 
+// <e> NRF_CRYPTO_BACKEND_CC310_BL_ENABLED - Enable the ARM Cryptocell CC310 reduced backend.
 
-#ifndef COMP_CONFIG_SPEED_MODE
-#define COMP_CONFIG_SPEED_MODE 2
+// <i> The CC310 hardware-accelerated cryptography backend with reduced functionality and footprint (only available on nRF52840).
+//==========================================================
+#ifndef NRF_CRYPTO_BACKEND_CC310_BL_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_BL_ENABLED 0
 #endif
-
-// <o> COMP_CONFIG_HYST  - Hystheresis
+// <q> NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP224R1_ENABLED  - Enable the secp224r1 elliptic curve support using CC310_BL.
  
-// <0=> No 
-// <1=> 50mV 
 
-#ifndef COMP_CONFIG_HYST
-#define COMP_CONFIG_HYST 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP224R1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP224R1_ENABLED 0
 #endif
 
-// <o> COMP_CONFIG_ISOURCE  - Current Source
+// <q> NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP256R1_ENABLED  - Enable the secp256r1 elliptic curve support using CC310_BL.
  
-// <0=> Off 
-// <1=> 2.5 uA 
-// <2=> 5 uA 
-// <3=> 10 uA 
 
-#ifndef COMP_CONFIG_ISOURCE
-#define COMP_CONFIG_ISOURCE 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP256R1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_BL_ECC_SECP256R1_ENABLED 1
 #endif
 
-// <o> COMP_CONFIG_INPUT  - Analog input
+// <q> NRF_CRYPTO_BACKEND_CC310_BL_HASH_SHA256_ENABLED  - CC310_BL SHA-256 hash functionality.
  
-// <0=> 0 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef COMP_CONFIG_INPUT
-#define COMP_CONFIG_INPUT 0
+// <i> CC310_BL backend implementation for hardware-accelerated SHA-256.
+
+#ifndef NRF_CRYPTO_BACKEND_CC310_BL_HASH_SHA256_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_BL_HASH_SHA256_ENABLED 1
 #endif
 
-// <o> COMP_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_ENABLED  - nrf_cc310_bl buffers to RAM before running hash operation
  
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+// <i> Enabling this makes hashing of addresses in FLASH range possible. Size of buffer allocated for hashing is set by NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_SIZE
 
-#ifndef COMP_CONFIG_IRQ_PRIORITY
-#define COMP_CONFIG_IRQ_PRIORITY 2
+#ifndef NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_ENABLED 0
 #endif
 
-// </e>
+// <o> NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_SIZE - nrf_cc310_bl hash outputs digests in little endian 
+// <i> Makes the nrf_cc310_bl hash functions output digests in little endian format. Only for use in nRF SDK DFU!
 
-// <q> EGU_ENABLED  - nrf_drv_swi - SWI(EGU) peripheral driver - legacy layer
+#ifndef NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_SIZE
+#define NRF_CRYPTO_BACKEND_CC310_BL_HASH_AUTOMATIC_RAM_BUFFER_SIZE 4096
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_CC310_BL_INTERRUPTS_ENABLED  - Enable Interrupts while support using CC310 bl.
  
 
-#ifndef EGU_ENABLED
-#define EGU_ENABLED 0
+// <i> Select a library version compatible with the configuration. When interrupts are disable, a version named _noint must be used
+
+#ifndef NRF_CRYPTO_BACKEND_CC310_BL_INTERRUPTS_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_BL_INTERRUPTS_ENABLED 1
 #endif
 
-// <e> GPIOTE_ENABLED - nrf_drv_gpiote - GPIOTE peripheral driver - legacy layer
+// </e>
+
+// <e> NRF_CRYPTO_BACKEND_CC310_ENABLED - Enable the ARM Cryptocell CC310 backend.
+
+// <i> The CC310 hardware-accelerated cryptography backend (only available on nRF52840).
 //==========================================================
-#ifndef GPIOTE_ENABLED
-#define GPIOTE_ENABLED 1
+#ifndef NRF_CRYPTO_BACKEND_CC310_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ENABLED 0
 #endif
-// <o> GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS - Number of lower power input pins 
-#ifndef GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS
-#define GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS 4
+// <q> NRF_CRYPTO_BACKEND_CC310_AES_CBC_ENABLED  - Enable the AES CBC mode using CC310.
+ 
+
+#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CBC_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_AES_CBC_ENABLED 1
 #endif
 
-// <o> GPIOTE_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRF_CRYPTO_BACKEND_CC310_AES_CTR_ENABLED  - Enable the AES CTR mode using CC310.
  
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
-
-#ifndef GPIOTE_CONFIG_IRQ_PRIORITY
-#define GPIOTE_CONFIG_IRQ_PRIORITY 2
+#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CTR_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_AES_CTR_ENABLED 1
 #endif
 
-// </e>
+// <q> NRF_CRYPTO_BACKEND_CC310_AES_ECB_ENABLED  - Enable the AES ECB mode using CC310.
+ 
 
-// <e> I2S_ENABLED - nrf_drv_i2s - I2S peripheral driver - legacy layer
-//==========================================================
-#ifndef I2S_ENABLED
-#define I2S_ENABLED 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_AES_ECB_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_AES_ECB_ENABLED 1
 #endif
-// <o> I2S_CONFIG_SCK_PIN - SCK pin  <0-31> 
 
+// <q> NRF_CRYPTO_BACKEND_CC310_AES_CBC_MAC_ENABLED  - Enable the AES CBC_MAC mode using CC310.
+ 
 
-#ifndef I2S_CONFIG_SCK_PIN
-#define I2S_CONFIG_SCK_PIN 31
+#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CBC_MAC_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_AES_CBC_MAC_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_LRCK_PIN - LRCK pin  <1-31> 
-
+// <q> NRF_CRYPTO_BACKEND_CC310_AES_CMAC_ENABLED  - Enable the AES CMAC mode using CC310.
+ 
 
-#ifndef I2S_CONFIG_LRCK_PIN
-#define I2S_CONFIG_LRCK_PIN 30
+#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CMAC_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_AES_CMAC_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_MCK_PIN - MCK pin 
-#ifndef I2S_CONFIG_MCK_PIN
-#define I2S_CONFIG_MCK_PIN 255
+// <q> NRF_CRYPTO_BACKEND_CC310_AES_CCM_ENABLED  - Enable the AES CCM mode using CC310.
+ 
+
+#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CCM_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_AES_CCM_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_SDOUT_PIN - SDOUT pin  <0-31> 
+// <q> NRF_CRYPTO_BACKEND_CC310_AES_CCM_STAR_ENABLED  - Enable the AES CCM* mode using CC310.
+ 
 
+#ifndef NRF_CRYPTO_BACKEND_CC310_AES_CCM_STAR_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_AES_CCM_STAR_ENABLED 1
+#endif
 
-#ifndef I2S_CONFIG_SDOUT_PIN
-#define I2S_CONFIG_SDOUT_PIN 29
+// <q> NRF_CRYPTO_BACKEND_CC310_CHACHA_POLY_ENABLED  - Enable the CHACHA-POLY mode using CC310.
+ 
+
+#ifndef NRF_CRYPTO_BACKEND_CC310_CHACHA_POLY_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_CHACHA_POLY_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_SDIN_PIN - SDIN pin  <0-31> 
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R1_ENABLED  - Enable the secp160r1 elliptic curve support using CC310.
+ 
 
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R1_ENABLED 1
+#endif
 
-#ifndef I2S_CONFIG_SDIN_PIN
-#define I2S_CONFIG_SDIN_PIN 28
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R2_ENABLED  - Enable the secp160r2 elliptic curve support using CC310.
+ 
+
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R2_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP160R2_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_MASTER  - Mode
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP192R1_ENABLED  - Enable the secp192r1 elliptic curve support using CC310.
  
-// <0=> Master 
-// <1=> Slave 
 
-#ifndef I2S_CONFIG_MASTER
-#define I2S_CONFIG_MASTER 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP192R1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP192R1_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_FORMAT  - Format
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP224R1_ENABLED  - Enable the secp224r1 elliptic curve support using CC310.
  
-// <0=> I2S 
-// <1=> Aligned 
 
-#ifndef I2S_CONFIG_FORMAT
-#define I2S_CONFIG_FORMAT 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP224R1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP224R1_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_ALIGN  - Alignment
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP256R1_ENABLED  - Enable the secp256r1 elliptic curve support using CC310.
  
-// <0=> Left 
-// <1=> Right 
 
-#ifndef I2S_CONFIG_ALIGN
-#define I2S_CONFIG_ALIGN 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP256R1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP256R1_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_SWIDTH  - Sample width (bits)
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP384R1_ENABLED  - Enable the secp384r1 elliptic curve support using CC310.
  
-// <0=> 8 
-// <1=> 16 
-// <2=> 24 
 
-#ifndef I2S_CONFIG_SWIDTH
-#define I2S_CONFIG_SWIDTH 1
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP384R1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP384R1_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_CHANNELS  - Channels
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP521R1_ENABLED  - Enable the secp521r1 elliptic curve support using CC310.
  
-// <0=> Stereo 
-// <1=> Left 
-// <2=> Right 
 
-#ifndef I2S_CONFIG_CHANNELS
-#define I2S_CONFIG_CHANNELS 1
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP521R1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP521R1_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_MCK_SETUP  - MCK behavior
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP160K1_ENABLED  - Enable the secp160k1 elliptic curve support using CC310.
  
-// <0=> Disabled 
-// <2147483648=> 32MHz/2 
-// <1342177280=> 32MHz/3 
-// <1073741824=> 32MHz/4 
-// <805306368=> 32MHz/5 
-// <671088640=> 32MHz/6 
-// <536870912=> 32MHz/8 
-// <402653184=> 32MHz/10 
-// <369098752=> 32MHz/11 
-// <285212672=> 32MHz/15 
-// <268435456=> 32MHz/16 
-// <201326592=> 32MHz/21 
-// <184549376=> 32MHz/23 
-// <142606336=> 32MHz/30 
-// <138412032=> 32MHz/31 
-// <134217728=> 32MHz/32 
-// <100663296=> 32MHz/42 
-// <68157440=> 32MHz/63 
-// <34340864=> 32MHz/125 
 
-#ifndef I2S_CONFIG_MCK_SETUP
-#define I2S_CONFIG_MCK_SETUP 536870912
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP160K1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP160K1_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_RATIO  - MCK/LRCK ratio
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP192K1_ENABLED  - Enable the secp192k1 elliptic curve support using CC310.
  
-// <0=> 32x 
-// <1=> 48x 
-// <2=> 64x 
-// <3=> 96x 
-// <4=> 128x 
-// <5=> 192x 
-// <6=> 256x 
-// <7=> 384x 
-// <8=> 512x 
 
-#ifndef I2S_CONFIG_RATIO
-#define I2S_CONFIG_RATIO 2000
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP192K1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP192K1_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP224K1_ENABLED  - Enable the secp224k1 elliptic curve support using CC310.
  
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
-
-#ifndef I2S_CONFIG_IRQ_PRIORITY
-#define I2S_CONFIG_IRQ_PRIORITY 2
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP224K1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP224K1_ENABLED 1
 #endif
 
-// <e> I2S_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef I2S_CONFIG_LOG_ENABLED
-#define I2S_CONFIG_LOG_ENABLED 0
-#endif
-// <o> I2S_CONFIG_LOG_LEVEL  - Default Severity level
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_SECP256K1_ENABLED  - Enable the secp256k1 elliptic curve support using CC310.
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef I2S_CONFIG_LOG_LEVEL
-#define I2S_CONFIG_LOG_LEVEL 3
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_SECP256K1_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_SECP256K1_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_CURVE25519_ENABLED  - Enable the Curve25519 curve support using CC310.
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef I2S_CONFIG_INFO_COLOR
-#define I2S_CONFIG_INFO_COLOR 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_CURVE25519_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_CURVE25519_ENABLED 1
 #endif
 
-// <o> I2S_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> NRF_CRYPTO_BACKEND_CC310_ECC_ED25519_ENABLED  - Enable the Ed25519 curve support using CC310.
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef I2S_CONFIG_DEBUG_COLOR
-#define I2S_CONFIG_DEBUG_COLOR 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_ECC_ED25519_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_ECC_ED25519_ENABLED 1
 #endif
 
-// </e>
+// <q> NRF_CRYPTO_BACKEND_CC310_HASH_SHA256_ENABLED  - CC310 SHA-256 hash functionality.
+ 
 
-// </e>
+// <i> CC310 backend implementation for hardware-accelerated SHA-256.
 
-// <e> LPCOMP_ENABLED - nrf_drv_lpcomp - LPCOMP peripheral driver - legacy layer
-//==========================================================
-#ifndef LPCOMP_ENABLED
-#define LPCOMP_ENABLED 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_HASH_SHA256_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_HASH_SHA256_ENABLED 1
 #endif
-// <o> LPCOMP_CONFIG_REFERENCE  - Reference voltage
+
+// <q> NRF_CRYPTO_BACKEND_CC310_HASH_SHA512_ENABLED  - CC310 SHA-512 hash functionality
  
-// <0=> Supply 1/8 
-// <1=> Supply 2/8 
-// <2=> Supply 3/8 
-// <3=> Supply 4/8 
-// <4=> Supply 5/8 
-// <5=> SupplY 2/8 
-// <6=> Supply 7/8 
-// <8=> Supply 1/16 (nRF52) 
-// <9=> Supply 3/16 (nRF52) 
-// <10=> Supply 5/16 (nRF52) 
-// <11=> Supply 7/16 (nRF52) 
-// <12=> Supply 9/16 (nRF52) 
-// <13=> Supply 11/16 (nRF52) 
-// <14=> Supply 13/16 (nRF52) 
-// <15=> Supply 15/16 (nRF52) 
-// <7=> External Ref 0 
-// <65543=> External Ref 1 
 
-#ifndef LPCOMP_CONFIG_REFERENCE
-#define LPCOMP_CONFIG_REFERENCE 3
+// <i> CC310 backend implementation for SHA-512 (in software).
+
+#ifndef NRF_CRYPTO_BACKEND_CC310_HASH_SHA512_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_HASH_SHA512_ENABLED 1
 #endif
 
-// <o> LPCOMP_CONFIG_DETECTION  - Detection
+// <q> NRF_CRYPTO_BACKEND_CC310_HMAC_SHA256_ENABLED  - CC310 HMAC using SHA-256
  
-// <0=> Crossing 
-// <1=> Up 
-// <2=> Down 
 
-#ifndef LPCOMP_CONFIG_DETECTION
-#define LPCOMP_CONFIG_DETECTION 2
+// <i> CC310 backend implementation for HMAC using hardware-accelerated SHA-256.
+
+#ifndef NRF_CRYPTO_BACKEND_CC310_HMAC_SHA256_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_HMAC_SHA256_ENABLED 1
 #endif
 
-// <o> LPCOMP_CONFIG_INPUT  - Analog input
+// <q> NRF_CRYPTO_BACKEND_CC310_HMAC_SHA512_ENABLED  - CC310 HMAC using SHA-512
  
-// <0=> 0 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef LPCOMP_CONFIG_INPUT
-#define LPCOMP_CONFIG_INPUT 0
+// <i> CC310 backend implementation for HMAC using SHA-512 (in software).
+
+#ifndef NRF_CRYPTO_BACKEND_CC310_HMAC_SHA512_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_HMAC_SHA512_ENABLED 1
 #endif
 
-// <q> LPCOMP_CONFIG_HYST  - Hysteresis
+// <q> NRF_CRYPTO_BACKEND_CC310_RNG_ENABLED  - Enable RNG support using CC310.
  
 
-#ifndef LPCOMP_CONFIG_HYST
-#define LPCOMP_CONFIG_HYST 0
+#ifndef NRF_CRYPTO_BACKEND_CC310_RNG_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_RNG_ENABLED 1
 #endif
 
-// <o> LPCOMP_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRF_CRYPTO_BACKEND_CC310_INTERRUPTS_ENABLED  - Enable Interrupts while support using CC310.
  
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+// <i> Select a library version compatible with the configuration. When interrupts are disable, a version named _noint must be used
 
-#ifndef LPCOMP_CONFIG_IRQ_PRIORITY
-#define LPCOMP_CONFIG_IRQ_PRIORITY 2
+#ifndef NRF_CRYPTO_BACKEND_CC310_INTERRUPTS_ENABLED
+#define NRF_CRYPTO_BACKEND_CC310_INTERRUPTS_ENABLED 1
 #endif
 
 // </e>
 
-// <e> NRFX_CLOCK_ENABLED - nrfx_clock - CLOCK peripheral driver
+// <e> NRF_CRYPTO_BACKEND_CIFRA_ENABLED - Enable the Cifra backend.
 //==========================================================
-#ifndef NRFX_CLOCK_ENABLED
-#define NRFX_CLOCK_ENABLED 1
+#ifndef NRF_CRYPTO_BACKEND_CIFRA_ENABLED
+#define NRF_CRYPTO_BACKEND_CIFRA_ENABLED 0
 #endif
-// <o> NRFX_CLOCK_CONFIG_LF_SRC  - LF Clock Source
+// <q> NRF_CRYPTO_BACKEND_CIFRA_AES_EAX_ENABLED  - Enable the AES EAX mode using Cifra.
  
-// <0=> RC 
-// <1=> XTAL 
-// <2=> Synth 
-// <131073=> External Low Swing 
-// <196609=> External Full Swing 
 
-#ifndef NRFX_CLOCK_CONFIG_LF_SRC
-#define NRFX_CLOCK_CONFIG_LF_SRC 1
+#ifndef NRF_CRYPTO_BACKEND_CIFRA_AES_EAX_ENABLED
+#define NRF_CRYPTO_BACKEND_CIFRA_AES_EAX_ENABLED 1
 #endif
 
-// <o> NRFX_CLOCK_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
-
-#ifndef NRFX_CLOCK_CONFIG_IRQ_PRIORITY
-#define NRFX_CLOCK_CONFIG_IRQ_PRIORITY 2
-#endif
+// </e>
 
-// <e> NRFX_CLOCK_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> NRF_CRYPTO_BACKEND_MBEDTLS_ENABLED - Enable the mbed TLS backend.
 //==========================================================
-#ifndef NRFX_CLOCK_CONFIG_LOG_ENABLED
-#define NRFX_CLOCK_CONFIG_LOG_ENABLED 0
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ENABLED 0
 #endif
-// <o> NRFX_CLOCK_CONFIG_LOG_LEVEL  - Default Severity level
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_ENABLED  - Enable the AES CBC mode mbed TLS.
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_CLOCK_CONFIG_LOG_LEVEL
-#define NRFX_CLOCK_CONFIG_LOG_LEVEL 3
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_ENABLED 1
 #endif
 
-// <o> NRFX_CLOCK_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CTR_ENABLED  - Enable the AES CTR mode using mbed TLS.
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_CLOCK_CONFIG_INFO_COLOR
-#define NRFX_CLOCK_CONFIG_INFO_COLOR 0
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CTR_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CTR_ENABLED 1
 #endif
 
-// <o> NRFX_CLOCK_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CFB_ENABLED  - Enable the AES CFB mode using mbed TLS.
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_CLOCK_CONFIG_DEBUG_COLOR
-#define NRFX_CLOCK_CONFIG_DEBUG_COLOR 0
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CFB_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CFB_ENABLED 1
 #endif
 
-// </e>
-
-// </e>
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_ECB_ENABLED  - Enable the AES ECB mode using mbed TLS.
+ 
 
-// <e> NRFX_COMP_ENABLED - nrfx_comp - COMP peripheral driver
-//==========================================================
-#ifndef NRFX_COMP_ENABLED
-#define NRFX_COMP_ENABLED 0
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_ECB_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_ECB_ENABLED 1
 #endif
-// <o> NRFX_COMP_CONFIG_REF  - Reference voltage
+
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_MAC_ENABLED  - Enable the AES CBC MAC mode using mbed TLS.
  
-// <0=> Internal 1.2V 
-// <1=> Internal 1.8V 
-// <2=> Internal 2.4V 
-// <4=> VDD 
-// <7=> ARef 
 
-#ifndef NRFX_COMP_CONFIG_REF
-#define NRFX_COMP_CONFIG_REF 1
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_MAC_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CBC_MAC_ENABLED 1
 #endif
 
-// <o> NRFX_COMP_CONFIG_MAIN_MODE  - Main mode
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CMAC_ENABLED  - Enable the AES CMAC mode using mbed TLS.
  
-// <0=> Single ended 
-// <1=> Differential 
 
-#ifndef NRFX_COMP_CONFIG_MAIN_MODE
-#define NRFX_COMP_CONFIG_MAIN_MODE 0
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CMAC_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CMAC_ENABLED 1
 #endif
 
-// <o> NRFX_COMP_CONFIG_SPEED_MODE  - Speed mode
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_CCM_ENABLED  - Enable the AES CCM mode using mbed TLS.
  
-// <0=> Low power 
-// <1=> Normal 
-// <2=> High speed 
 
-#ifndef NRFX_COMP_CONFIG_SPEED_MODE
-#define NRFX_COMP_CONFIG_SPEED_MODE 2
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_CCM_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_CCM_ENABLED 1
 #endif
 
-// <o> NRFX_COMP_CONFIG_HYST  - Hystheresis
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_AES_GCM_ENABLED  - Enable the AES GCM mode using mbed TLS.
  
-// <0=> No 
-// <1=> 50mV 
 
-#ifndef NRFX_COMP_CONFIG_HYST
-#define NRFX_COMP_CONFIG_HYST 0
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_AES_GCM_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_AES_GCM_ENABLED 1
 #endif
 
-// <o> NRFX_COMP_CONFIG_ISOURCE  - Current Source
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192R1_ENABLED  - Enable secp192r1 (NIST 192-bit) curve
  
-// <0=> Off 
-// <1=> 2.5 uA 
-// <2=> 5 uA 
-// <3=> 10 uA 
 
-#ifndef NRFX_COMP_CONFIG_ISOURCE
-#define NRFX_COMP_CONFIG_ISOURCE 0
+// <i> Enable this setting if you need secp192r1 (NIST 192-bit) support using MBEDTLS
+
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192R1_ENABLED 1
 #endif
 
-// <o> NRFX_COMP_CONFIG_INPUT  - Analog input
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224R1_ENABLED  - Enable secp224r1 (NIST 224-bit) curve
  
-// <0=> 0 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef NRFX_COMP_CONFIG_INPUT
-#define NRFX_COMP_CONFIG_INPUT 0
+// <i> Enable this setting if you need secp224r1 (NIST 224-bit) support using MBEDTLS
+
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224R1_ENABLED 1
 #endif
 
-// <o> NRFX_COMP_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256R1_ENABLED  - Enable secp256r1 (NIST 256-bit) curve
  
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef NRFX_COMP_CONFIG_IRQ_PRIORITY
-#define NRFX_COMP_CONFIG_IRQ_PRIORITY 2
-#endif
+// <i> Enable this setting if you need secp256r1 (NIST 256-bit) support using MBEDTLS
 
-// <e> NRFX_COMP_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_COMP_CONFIG_LOG_ENABLED
-#define NRFX_COMP_CONFIG_LOG_ENABLED 0
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256R1_ENABLED 1
 #endif
-// <o> NRFX_COMP_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP384R1_ENABLED  - Enable secp384r1 (NIST 384-bit) curve
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_COMP_CONFIG_LOG_LEVEL
-#define NRFX_COMP_CONFIG_LOG_LEVEL 3
+// <i> Enable this setting if you need secp384r1 (NIST 384-bit) support using MBEDTLS
+
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP384R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP384R1_ENABLED 1
 #endif
 
-// <o> NRFX_COMP_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP521R1_ENABLED  - Enable secp521r1 (NIST 521-bit) curve
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_COMP_CONFIG_INFO_COLOR
-#define NRFX_COMP_CONFIG_INFO_COLOR 0
+// <i> Enable this setting if you need secp521r1 (NIST 521-bit) support using MBEDTLS
+
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP521R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP521R1_ENABLED 1
 #endif
 
-// <o> NRFX_COMP_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192K1_ENABLED  - Enable secp192k1 (Koblitz 192-bit) curve
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_COMP_CONFIG_DEBUG_COLOR
-#define NRFX_COMP_CONFIG_DEBUG_COLOR 0
+// <i> Enable this setting if you need secp192k1 (Koblitz 192-bit) support using MBEDTLS
+
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192K1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP192K1_ENABLED 1
 #endif
 
-// </e>
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224K1_ENABLED  - Enable secp224k1 (Koblitz 224-bit) curve
+ 
 
-// </e>
+// <i> Enable this setting if you need secp224k1 (Koblitz 224-bit) support using MBEDTLS
 
-// <e> NRFX_GPIOTE_ENABLED - nrfx_gpiote - GPIOTE peripheral driver
-//==========================================================
-#ifndef NRFX_GPIOTE_ENABLED
-#define NRFX_GPIOTE_ENABLED 1
-#endif
-// <o> NRFX_GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS - Number of lower power input pins 
-#ifndef NRFX_GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS
-#define NRFX_GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS 1
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224K1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP224K1_ENABLED 1
 #endif
 
-// <o> NRFX_GPIOTE_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256K1_ENABLED  - Enable secp256k1 (Koblitz 256-bit) curve
  
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef NRFX_GPIOTE_CONFIG_IRQ_PRIORITY
-#define NRFX_GPIOTE_CONFIG_IRQ_PRIORITY 2
-#endif
+// <i> Enable this setting if you need secp256k1 (Koblitz 256-bit) support using MBEDTLS
 
-// <e> NRFX_GPIOTE_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_GPIOTE_CONFIG_LOG_ENABLED
-#define NRFX_GPIOTE_CONFIG_LOG_ENABLED 0
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256K1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_SECP256K1_ENABLED 1
 #endif
-// <o> NRFX_GPIOTE_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP256R1_ENABLED  - Enable bp256r1 (Brainpool 256-bit) curve
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_GPIOTE_CONFIG_LOG_LEVEL
-#define NRFX_GPIOTE_CONFIG_LOG_LEVEL 3
+// <i> Enable this setting if you need bp256r1 (Brainpool 256-bit) support using MBEDTLS
+
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP256R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP256R1_ENABLED 1
 #endif
 
-// <o> NRFX_GPIOTE_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP384R1_ENABLED  - Enable bp384r1 (Brainpool 384-bit) curve
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_GPIOTE_CONFIG_INFO_COLOR
-#define NRFX_GPIOTE_CONFIG_INFO_COLOR 0
+// <i> Enable this setting if you need bp384r1 (Brainpool 384-bit) support using MBEDTLS
+
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP384R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP384R1_ENABLED 1
 #endif
 
-// <o> NRFX_GPIOTE_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP512R1_ENABLED  - Enable bp512r1 (Brainpool 512-bit) curve
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_GPIOTE_CONFIG_DEBUG_COLOR
-#define NRFX_GPIOTE_CONFIG_DEBUG_COLOR 0
+// <i> Enable this setting if you need bp512r1 (Brainpool 512-bit) support using MBEDTLS
+
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP512R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_BP512R1_ENABLED 1
 #endif
 
-// </e>
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_ECC_CURVE25519_ENABLED  - Enable Curve25519 curve
+ 
 
-// </e>
+// <i> Enable this setting if you need Curve25519 support using MBEDTLS
 
-// <e> NRFX_I2S_ENABLED - nrfx_i2s - I2S peripheral driver
-//==========================================================
-#ifndef NRFX_I2S_ENABLED
-#define NRFX_I2S_ENABLED 0
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_ECC_CURVE25519_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_ECC_CURVE25519_ENABLED 1
 #endif
-// <o> NRFX_I2S_CONFIG_SCK_PIN - SCK pin  <0-31> 
 
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA256_ENABLED  - Enable mbed TLS SHA-256 hash functionality.
+ 
+
+// <i> mbed TLS backend implementation for SHA-256.
 
-#ifndef NRFX_I2S_CONFIG_SCK_PIN
-#define NRFX_I2S_CONFIG_SCK_PIN 31
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA256_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA256_ENABLED 1
 #endif
 
-// <o> NRFX_I2S_CONFIG_LRCK_PIN - LRCK pin  <1-31> 
-
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA512_ENABLED  - Enable mbed TLS SHA-512 hash functionality.
+ 
 
-#ifndef NRFX_I2S_CONFIG_LRCK_PIN
-#define NRFX_I2S_CONFIG_LRCK_PIN 30
-#endif
+// <i> mbed TLS backend implementation for SHA-512.
 
-// <o> NRFX_I2S_CONFIG_MCK_PIN - MCK pin 
-#ifndef NRFX_I2S_CONFIG_MCK_PIN
-#define NRFX_I2S_CONFIG_MCK_PIN 255
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA512_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_HASH_SHA512_ENABLED 1
 #endif
 
-// <o> NRFX_I2S_CONFIG_SDOUT_PIN - SDOUT pin  <0-31> 
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA256_ENABLED  - Enable mbed TLS HMAC using SHA-256.
+ 
 
+// <i> mbed TLS backend implementation for HMAC using SHA-256.
 
-#ifndef NRFX_I2S_CONFIG_SDOUT_PIN
-#define NRFX_I2S_CONFIG_SDOUT_PIN 29
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA256_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA256_ENABLED 1
 #endif
 
-// <o> NRFX_I2S_CONFIG_SDIN_PIN - SDIN pin  <0-31> 
+// <q> NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA512_ENABLED  - Enable mbed TLS HMAC using SHA-512.
+ 
 
+// <i> mbed TLS backend implementation for HMAC using SHA-512.
 
-#ifndef NRFX_I2S_CONFIG_SDIN_PIN
-#define NRFX_I2S_CONFIG_SDIN_PIN 28
+#ifndef NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA512_ENABLED
+#define NRF_CRYPTO_BACKEND_MBEDTLS_HMAC_SHA512_ENABLED 1
 #endif
 
-// <o> NRFX_I2S_CONFIG_MASTER  - Mode
- 
-// <0=> Master 
-// <1=> Slave 
+// </e>
 
-#ifndef NRFX_I2S_CONFIG_MASTER
-#define NRFX_I2S_CONFIG_MASTER 0
+// <e> NRF_CRYPTO_BACKEND_MICRO_ECC_ENABLED - Enable the micro-ecc backend.
+//==========================================================
+#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ENABLED
+#define NRF_CRYPTO_BACKEND_MICRO_ECC_ENABLED 0
+#endif
+// <q> NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP192R1_ENABLED  - Enable secp192r1 (NIST 192-bit) curve
+ 
+
+// <i> Enable this setting if you need secp192r1 (NIST 192-bit) support using micro-ecc
+
+#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP192R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP192R1_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP224R1_ENABLED  - Enable secp224r1 (NIST 224-bit) curve
+ 
+
+// <i> Enable this setting if you need secp224r1 (NIST 224-bit) support using micro-ecc
+
+#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP224R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP224R1_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256R1_ENABLED  - Enable secp256r1 (NIST 256-bit) curve
+ 
+
+// <i> Enable this setting if you need secp256r1 (NIST 256-bit) support using micro-ecc
+
+#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256R1_ENABLED
+#define NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256R1_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256K1_ENABLED  - Enable secp256k1 (Koblitz 256-bit) curve
+ 
+
+// <i> Enable this setting if you need secp256k1 (Koblitz 256-bit) support using micro-ecc
+
+#ifndef NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256K1_ENABLED
+#define NRF_CRYPTO_BACKEND_MICRO_ECC_ECC_SECP256K1_ENABLED 1
+#endif
+
+// </e>
+
+// <e> NRF_CRYPTO_BACKEND_NRF_HW_RNG_ENABLED - Enable the nRF HW RNG backend.
+
+// <i> The nRF HW backend provide access to RNG peripheral in nRF5x devices.
+//==========================================================
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_RNG_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_RNG_ENABLED 0
+#endif
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_RNG_MBEDTLS_CTR_DRBG_ENABLED  - Enable mbed TLS CTR-DRBG algorithm.
+ 
+
+// <i> Enable mbed TLS CTR-DRBG standardized by NIST (NIST SP 800-90A Rev. 1). The nRF HW RNG is used as an entropy source for seeding.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_RNG_MBEDTLS_CTR_DRBG_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_RNG_MBEDTLS_CTR_DRBG_ENABLED 1
+#endif
+
+// </e>
+
+// <e> NRF_CRYPTO_BACKEND_NRF_SW_ENABLED - Enable the legacy nRFx sw for crypto.
+
+// <i> The nRF SW cryptography backend (only used in bootloader context).
+//==========================================================
+#ifndef NRF_CRYPTO_BACKEND_NRF_SW_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_SW_ENABLED 0
+#endif
+// <q> NRF_CRYPTO_BACKEND_NRF_SW_HASH_SHA256_ENABLED  - nRF SW hash backend support for SHA-256
+ 
+
+// <i> The nRF SW backend provide access to nRF SDK legacy hash implementation of SHA-256.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_SW_HASH_SHA256_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_SW_HASH_SHA256_ENABLED 1
+#endif
+
+// </e>
+
+// <e> NRF_CRYPTO_BACKEND_OBERON_ENABLED - Enable the Oberon backend
+
+// <i> The Oberon backend
+//==========================================================
+#ifndef NRF_CRYPTO_BACKEND_OBERON_ENABLED
+#define NRF_CRYPTO_BACKEND_OBERON_ENABLED 0
+#endif
+// <q> NRF_CRYPTO_BACKEND_OBERON_CHACHA_POLY_ENABLED  - Enable the CHACHA-POLY mode using Oberon.
+ 
+
+#ifndef NRF_CRYPTO_BACKEND_OBERON_CHACHA_POLY_ENABLED
+#define NRF_CRYPTO_BACKEND_OBERON_CHACHA_POLY_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_OBERON_ECC_SECP256R1_ENABLED  - Enable secp256r1 curve
+ 
+
+// <i> Enable this setting if you need secp256r1 curve support using Oberon library
+
+#ifndef NRF_CRYPTO_BACKEND_OBERON_ECC_SECP256R1_ENABLED
+#define NRF_CRYPTO_BACKEND_OBERON_ECC_SECP256R1_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_OBERON_ECC_CURVE25519_ENABLED  - Enable Curve25519 ECDH
+ 
+
+// <i> Enable this setting if you need Curve25519 ECDH support using Oberon library
+
+#ifndef NRF_CRYPTO_BACKEND_OBERON_ECC_CURVE25519_ENABLED
+#define NRF_CRYPTO_BACKEND_OBERON_ECC_CURVE25519_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_OBERON_ECC_ED25519_ENABLED  - Enable Ed25519 signature scheme
+ 
+
+// <i> Enable this setting if you need Ed25519 support using Oberon library
+
+#ifndef NRF_CRYPTO_BACKEND_OBERON_ECC_ED25519_ENABLED
+#define NRF_CRYPTO_BACKEND_OBERON_ECC_ED25519_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_OBERON_HASH_SHA256_ENABLED  - Oberon SHA-256 hash functionality
+ 
+
+// <i> Oberon backend implementation for SHA-256.
+
+#ifndef NRF_CRYPTO_BACKEND_OBERON_HASH_SHA256_ENABLED
+#define NRF_CRYPTO_BACKEND_OBERON_HASH_SHA256_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_OBERON_HASH_SHA512_ENABLED  - Oberon SHA-512 hash functionality
+ 
+
+// <i> Oberon backend implementation for SHA-512.
+
+#ifndef NRF_CRYPTO_BACKEND_OBERON_HASH_SHA512_ENABLED
+#define NRF_CRYPTO_BACKEND_OBERON_HASH_SHA512_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA256_ENABLED  - Oberon HMAC using SHA-256
+ 
+
+// <i> Oberon backend implementation for HMAC using SHA-256.
+
+#ifndef NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA256_ENABLED
+#define NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA256_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA512_ENABLED  - Oberon HMAC using SHA-512
+ 
+
+// <i> Oberon backend implementation for HMAC using SHA-512.
+
+#ifndef NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA512_ENABLED
+#define NRF_CRYPTO_BACKEND_OBERON_HMAC_SHA512_ENABLED 1
+#endif
+
+// </e>
+
+// <e> NRF_CRYPTO_BACKEND_OPTIGA_ENABLED - Enable the nrf_crypto Optiga Trust X backend.
+
+// <i> Enables the nrf_crypto backend for Optiga Trust X devices.
+//==========================================================
+#ifndef NRF_CRYPTO_BACKEND_OPTIGA_ENABLED
+#define NRF_CRYPTO_BACKEND_OPTIGA_ENABLED 0
+#endif
+// <q> NRF_CRYPTO_BACKEND_OPTIGA_RNG_ENABLED  - Optiga backend support for RNG
+ 
+
+// <i> The Optiga backend provide external chip RNG.
+
+#ifndef NRF_CRYPTO_BACKEND_OPTIGA_RNG_ENABLED
+#define NRF_CRYPTO_BACKEND_OPTIGA_RNG_ENABLED 0
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_OPTIGA_ECC_SECP256R1_ENABLED  - Optiga backend support for ECC secp256r1
+ 
+
+// <i> The Optiga backend provide external chip ECC using secp256r1.
+
+#ifndef NRF_CRYPTO_BACKEND_OPTIGA_ECC_SECP256R1_ENABLED
+#define NRF_CRYPTO_BACKEND_OPTIGA_ECC_SECP256R1_ENABLED 1
+#endif
+
+// </e>
+
+// <q> NRF_CRYPTO_CURVE25519_BIG_ENDIAN_ENABLED  - Big-endian byte order in raw Curve25519 data
+ 
+
+// <i> Enable big-endian byte order in Curve25519 API, if set to 1. Use little-endian, if set to 0.
+
+#ifndef NRF_CRYPTO_CURVE25519_BIG_ENDIAN_ENABLED
+#define NRF_CRYPTO_CURVE25519_BIG_ENDIAN_ENABLED 0
+#endif
+
+// </e>
+
+// <q> NRF_CRYPTO_JOBQ_ENABLED  - nrf_crypto_jobq - Prioritized queue of crypto jobs
+ 
+
+// <i> Runs long crypto operations from app_scheduler, one job per scheduler event, highest
+// <i> priority first. Eddystone ECDH key exchanges and the nrf_ble_lesc DH key computations
+// <i> are then queued as jobs instead of running in the BLE event handler or only from
+// <i> nrf_ble_lesc_request_handler(). Requires app_scheduler.
+
+#ifndef NRF_CRYPTO_JOBQ_ENABLED
+#define NRF_CRYPTO_JOBQ_ENABLED 0
+#endif
+
+// </h> 
+//==========================================================
+
+// <h> nRF_DFU 
+
+//==========================================================
+// <h> ble_dfu - Device Firmware Update
+
+//==========================================================
+// <q> BLE_DFU_ENABLED  - Enable DFU Service.
+ 
+
+#ifndef BLE_DFU_ENABLED
+#define BLE_DFU_ENABLED 0
+#endif
+
+// <q> NRF_DFU_BLE_BUTTONLESS_SUPPORTS_BONDS  - Buttonless DFU supports bonds.
+ 
+
+#ifndef NRF_DFU_BLE_BUTTONLESS_SUPPORTS_BONDS
+#define NRF_DFU_BLE_BUTTONLESS_SUPPORTS_BONDS 0
+#endif
+
+// <q> NRF_DFU_BLE_BUTTONLESS_FAST_ENTER  - Enter the bootloader without waiting for Service Changed writes.
+ 
+
+// <i> With bonds, Service Changed is marked in GPREGRET2 and set pending for all peers on the next start of the application.
+// <i> The application started after the DFU must also enable this option.
+
+#ifndef NRF_DFU_BLE_BUTTONLESS_FAST_ENTER
+#define NRF_DFU_BLE_BUTTONLESS_FAST_ENTER 0
+#endif
+
+// </h> 
+//==========================================================
+
+// </h> 
+//==========================================================
+
+// <h> nRF_Drivers 
+
+//==========================================================
+// <e> COMP_ENABLED - nrf_drv_comp - COMP peripheral driver - legacy layer
+//==========================================================
+#ifndef COMP_ENABLED
+#define COMP_ENABLED 0
+#endif
+// <o> COMP_CONFIG_REF  - Reference voltage
+ 
+// <0=> Internal 1.2V 
+// <1=> Internal 1.8V 
+// <2=> Internal 2.4V 
+// <4=> VDD 
+// <7=> ARef 
+
+#ifndef COMP_CONFIG_REF
+#define COMP_CONFIG_REF 1
+#endif
+
+// <o> COMP_CONFIG_MAIN_MODE  - Main mode
+ 
+// <0=> Single ended 
+// <1=> Differential 
+
+#ifndef COMP_CONFIG_MAIN_MODE
+#define COMP_CONFIG_MAIN_MODE 0
+#endif
+
+// <o> COMP_CONFIG_SPEED_MODE  - Speed mode
+ 
+// <0=> Low power 
+// <1=> Normal 
+// <2=> High speed 
+
+#ifndef COMP_CONFIG_SPEED_MODE
+#define COMP_CONFIG_SPEED_MODE 2
+#endif
+
+// <o> COMP_CONFIG_HYST  - Hystheresis
+ 
+// <0=> No 
+// <1=> 50mV 
+
+#ifndef COMP_CONFIG_HYST
+#define COMP_CONFIG_HYST 0
+#endif
+
+// <o> COMP_CONFIG_ISOURCE  - Current Source
+ 
+// <0=> Off 
+// <1=> 2.5 uA 
+// <2=> 5 uA 
+// <3=> 10 uA 
+
+#ifndef COMP_CONFIG_ISOURCE
+#define COMP_CONFIG_ISOURCE 0
+#endif
+
+// <o> COMP_CONFIG_INPUT  - Analog input
+ 
+// <0=> 0 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef COMP_CONFIG_INPUT
+#define COMP_CONFIG_INPUT 0
+#endif
+
+// <o> COMP_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef COMP_CONFIG_IRQ_PRIORITY
+#define COMP_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// </e>
+
+// <q> EGU_ENABLED  - nrf_drv_swi - SWI(EGU) peripheral driver - legacy layer
+ 
+
+#ifndef EGU_ENABLED
+#define EGU_ENABLED 0
+#endif
+
+// <e> GPIOTE_ENABLED - nrf_drv_gpiote - GPIOTE peripheral driver - legacy layer
+//==========================================================
+#ifndef GPIOTE_ENABLED
+#define GPIOTE_ENABLED 1
+#endif
+// <o> GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS - Number of lower power input pins 
+#ifndef GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS
+#define GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS 4
+#endif
+
+// <o> GPIOTE_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef GPIOTE_CONFIG_IRQ_PRIORITY
+#define GPIOTE_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// </e>
+
+// <e> I2S_ENABLED - nrf_drv_i2s - I2S peripheral driver - legacy layer
+//==========================================================
+#ifndef I2S_ENABLED
+#define I2S_ENABLED 0
+#endif
+// <o> I2S_CONFIG_SCK_PIN - SCK pin  <0-31> 
+
+
+#ifndef I2S_CONFIG_SCK_PIN
+#define I2S_CONFIG_SCK_PIN 31
+#endif
+
+// <o> I2S_CONFIG_LRCK_PIN - LRCK pin  <1-31> 
+
+
+#ifndef I2S_CONFIG_LRCK_PIN
+#define I2S_CONFIG_LRCK_PIN 30
+#endif
+
+// <o> I2S_CONFIG_MCK_PIN - MCK pin 
+#ifndef I2S_CONFIG_MCK_PIN
+#define I2S_CONFIG_MCK_PIN 255
+#endif
+
+// <o> I2S_CONFIG_SDOUT_PIN - SDOUT pin  <0-31> 
+
+
+#ifndef I2S_CONFIG_SDOUT_PIN
+#define I2S_CONFIG_SDOUT_PIN 29
+#endif
+
+// <o> I2S_CONFIG_SDIN_PIN - SDIN pin  <0-31> 
+
+
+#ifndef I2S_CONFIG_SDIN_PIN
+#define I2S_CONFIG_SDIN_PIN 28
+#endif
+
+// <o> I2S_CONFIG_MASTER  - Mode
+ 
+// <0=> Master 
+// <1=> Slave 
+
+#ifndef I2S_CONFIG_MASTER
+#define I2S_CONFIG_MASTER 0
+#endif
+
+// <o> I2S_CONFIG_FORMAT  - Format
+ 
+// <0=> I2S 
+// <1=> Aligned 
+
+#ifndef I2S_CONFIG_FORMAT
+#define I2S_CONFIG_FORMAT 0
+#endif
+
+// <o> I2S_CONFIG_ALIGN  - Alignment
+ 
+// <0=> Left 
+// <1=> Right 
+
+#ifndef I2S_CONFIG_ALIGN
+#define I2S_CONFIG_ALIGN 0
+#endif
+
+// <o> I2S_CONFIG_SWIDTH  - Sample width (bits)
+ 
+// <0=> 8 
+// <1=> 16 
+// <2=> 24 
+
+#ifndef I2S_CONFIG_SWIDTH
+#define I2S_CONFIG_SWIDTH 1
+#endif
+
+// <o> I2S_CONFIG_CHANNELS  - Channels
+ 
+// <0=> Stereo 
+// <1=> Left 
+// <2=> Right 
+
+#ifndef I2S_CONFIG_CHANNELS
+#define I2S_CONFIG_CHANNELS 1
+#endif
+
+// <o> I2S_CONFIG_MCK_SETUP  - MCK behavior
+ 
+// <0=> Disabled 
+// <2147483648=> 32MHz/2 
+// <1342177280=> 32MHz/3 
+// <1073741824=> 32MHz/4 
+// <805306368=> 32MHz/5 
+// <671088640=> 32MHz/6 
+// <536870912=> 32MHz/8 
+// <402653184=> 32MHz/10 
+// <369098752=> 32MHz/11 
+// <285212672=> 32MHz/15 
+// <268435456=> 32MHz/16 
+// <201326592=> 32MHz/21 
+// <184549376=> 32MHz/23 
+// <142606336=> 32MHz/30 
+// <138412032=> 32MHz/31 
+// <134217728=> 32MHz/32 
+// <100663296=> 32MHz/42 
+// <68157440=> 32MHz/63 
+// <34340864=> 32MHz/125 
+
+#ifndef I2S_CONFIG_MCK_SETUP
+#define I2S_CONFIG_MCK_SETUP 536870912
+#endif
+
+// <o> I2S_CONFIG_RATIO  - MCK/LRCK ratio
+ 
+// <0=> 32x 
+// <1=> 48x 
+// <2=> 64x 
+// <3=> 96x 
+// <4=> 128x 
+// <5=> 192x 
+// <6=> 256x 
+// <7=> 384x 
+// <8=> 512x 
+
+#ifndef I2S_CONFIG_RATIO
+#define I2S_CONFIG_RATIO 2000
+#endif
+
+// <o> I2S_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef I2S_CONFIG_IRQ_PRIORITY
+#define I2S_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> I2S_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef I2S_CONFIG_LOG_ENABLED
+#define I2S_CONFIG_LOG_ENABLED 0
+#endif
+// <o> I2S_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef I2S_CONFIG_LOG_LEVEL
+#define I2S_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> I2S_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef I2S_CONFIG_INFO_COLOR
+#define I2S_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> I2S_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef I2S_CONFIG_DEBUG_COLOR
+#define I2S_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> LPCOMP_ENABLED - nrf_drv_lpcomp - LPCOMP peripheral driver - legacy layer
+//==========================================================
+#ifndef LPCOMP_ENABLED
+#define LPCOMP_ENABLED 0
+#endif
+// <o> LPCOMP_CONFIG_REFERENCE  - Reference voltage
+ 
+// <0=> Supply 1/8 
+// <1=> Supply 2/8 
+// <2=> Supply 3/8 
+// <3=> Supply 4/8 
+// <4=> Supply 5/8 
+// <5=> SupplY 2/8 
+// <6=> Supply 7/8 
+// <8=> Supply 1/16 (nRF52) 
+// <9=> Supply 3/16 (nRF52) 
+// <10=> Supply 5/16 (nRF52) 
+// <11=> Supply 7/16 (nRF52) 
+// <12=> Supply 9/16 (nRF52) 
+// <13=> Supply 11/16 (nRF52) 
+// <14=> Supply 13/16 (nRF52) 
+// <15=> Supply 15/16 (nRF52) 
+// <7=> External Ref 0 
+// <65543=> External Ref 1 
+
+#ifndef LPCOMP_CONFIG_REFERENCE
+#define LPCOMP_CONFIG_REFERENCE 3
+#endif
+
+// <o> LPCOMP_CONFIG_DETECTION  - Detection
+ 
+// <0=> Crossing 
+// <1=> Up 
+// <2=> Down 
+
+#ifndef LPCOMP_CONFIG_DETECTION
+#define LPCOMP_CONFIG_DETECTION 2
+#endif
+
+// <o> LPCOMP_CONFIG_INPUT  - Analog input
+ 
+// <0=> 0 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef LPCOMP_CONFIG_INPUT
+#define LPCOMP_CONFIG_INPUT 0
+#endif
+
+// <q> LPCOMP_CONFIG_HYST  - Hysteresis
+ 
+
+#ifndef LPCOMP_CONFIG_HYST
+#define LPCOMP_CONFIG_HYST 0
+#endif
+
+// <o> LPCOMP_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef LPCOMP_CONFIG_IRQ_PRIORITY
+#define LPCOMP_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// </e>
+
+// <e> NRFX_CLOCK_ENABLED - nrfx_clock - CLOCK peripheral driver
+//==========================================================
+#ifndef NRFX_CLOCK_ENABLED
+#define NRFX_CLOCK_ENABLED 1
+#endif
+// <o> NRFX_CLOCK_CONFIG_LF_SRC  - LF Clock Source
+ 
+// <0=> RC 
+// <1=> XTAL 
+// <2=> Synth 
+// <131073=> External Low Swing 
+// <196609=> External Full Swing 
+
+#ifndef NRFX_CLOCK_CONFIG_LF_SRC
+#define NRFX_CLOCK_CONFIG_LF_SRC 1
+#endif
+
+// <o> NRFX_CLOCK_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_CLOCK_CONFIG_IRQ_PRIORITY
+#define NRFX_CLOCK_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_CLOCK_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_CLOCK_CONFIG_LOG_ENABLED
+#define NRFX_CLOCK_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_CLOCK_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_CLOCK_CONFIG_LOG_LEVEL
+#define NRFX_CLOCK_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_CLOCK_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_CLOCK_CONFIG_INFO_COLOR
+#define NRFX_CLOCK_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_CLOCK_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_CLOCK_CONFIG_DEBUG_COLOR
+#define NRFX_CLOCK_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_COMP_ENABLED - nrfx_comp - COMP peripheral driver
+//==========================================================
+#ifndef NRFX_COMP_ENABLED
+#define NRFX_COMP_ENABLED 0
+#endif
+// <o> NRFX_COMP_CONFIG_REF  - Reference voltage
+ 
+// <0=> Internal 1.2V 
+// <1=> Internal 1.8V 
+// <2=> Internal 2.4V 
+// <4=> VDD 
+// <7=> ARef 
+
+#ifndef NRFX_COMP_CONFIG_REF
+#define NRFX_COMP_CONFIG_REF 1
+#endif
+
+// <o> NRFX_COMP_CONFIG_MAIN_MODE  - Main mode
+ 
+// <0=> Single ended 
+// <1=> Differential 
+
+#ifndef NRFX_COMP_CONFIG_MAIN_MODE
+#define NRFX_COMP_CONFIG_MAIN_MODE 0
+#endif
+
+// <o> NRFX_COMP_CONFIG_SPEED_MODE  - Speed mode
+ 
+// <0=> Low power 
+// <1=> Normal 
+// <2=> High speed 
+
+#ifndef NRFX_COMP_CONFIG_SPEED_MODE
+#define NRFX_COMP_CONFIG_SPEED_MODE 2
+#endif
+
+// <o> NRFX_COMP_CONFIG_HYST  - Hystheresis
+ 
+// <0=> No 
+// <1=> 50mV 
+
+#ifndef NRFX_COMP_CONFIG_HYST
+#define NRFX_COMP_CONFIG_HYST 0
+#endif
+
+// <o> NRFX_COMP_CONFIG_ISOURCE  - Current Source
+ 
+// <0=> Off 
+// <1=> 2.5 uA 
+// <2=> 5 uA 
+// <3=> 10 uA 
+
+#ifndef NRFX_COMP_CONFIG_ISOURCE
+#define NRFX_COMP_CONFIG_ISOURCE 0
+#endif
+
+// <o> NRFX_COMP_CONFIG_INPUT  - Analog input
+ 
+// <0=> 0 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_COMP_CONFIG_INPUT
+#define NRFX_COMP_CONFIG_INPUT 0
+#endif
+
+// <o> NRFX_COMP_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_COMP_CONFIG_IRQ_PRIORITY
+#define NRFX_COMP_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_COMP_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_COMP_CONFIG_LOG_ENABLED
+#define NRFX_COMP_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_COMP_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_COMP_CONFIG_LOG_LEVEL
+#define NRFX_COMP_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_COMP_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_COMP_CONFIG_INFO_COLOR
+#define NRFX_COMP_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_COMP_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_COMP_CONFIG_DEBUG_COLOR
+#define NRFX_COMP_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_GPIOTE_ENABLED - nrfx_gpiote - GPIOTE peripheral driver
+//==========================================================
+#ifndef NRFX_GPIOTE_ENABLED
+#define NRFX_GPIOTE_ENABLED 1
+#endif
+// <o> NRFX_GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS - Number of lower power input pins 
+#ifndef NRFX_GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS
+#define NRFX_GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS 1
+#endif
+
+// <o> NRFX_GPIOTE_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_GPIOTE_CONFIG_IRQ_PRIORITY
+#define NRFX_GPIOTE_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_GPIOTE_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_GPIOTE_CONFIG_LOG_ENABLED
+#define NRFX_GPIOTE_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_GPIOTE_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_GPIOTE_CONFIG_LOG_LEVEL
+#define NRFX_GPIOTE_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_GPIOTE_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_GPIOTE_CONFIG_INFO_COLOR
+#define NRFX_GPIOTE_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_GPIOTE_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_GPIOTE_CONFIG_DEBUG_COLOR
+#define NRFX_GPIOTE_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_I2S_ENABLED - nrfx_i2s - I2S peripheral driver
+//==========================================================
+#ifndef NRFX_I2S_ENABLED
+#define NRFX_I2S_ENABLED 0
+#endif
+// <o> NRFX_I2S_CONFIG_SCK_PIN - SCK pin  <0-31> 
+
+
+#ifndef NRFX_I2S_CONFIG_SCK_PIN
+#define NRFX_I2S_CONFIG_SCK_PIN 31
+#endif
+
+// <o> NRFX_I2S_CONFIG_LRCK_PIN - LRCK pin  <1-31> 
+
+
+#ifndef NRFX_I2S_CONFIG_LRCK_PIN
+#define NRFX_I2S_CONFIG_LRCK_PIN 30
+#endif
+
+// <o> NRFX_I2S_CONFIG_MCK_PIN - MCK pin 
+#ifndef NRFX_I2S_CONFIG_MCK_PIN
+#define NRFX_I2S_CONFIG_MCK_PIN 255
+#endif
+
+// <o> NRFX_I2S_CONFIG_SDOUT_PIN - SDOUT pin  <0-31> 
+
+
+#ifndef NRFX_I2S_CONFIG_SDOUT_PIN
+#define NRFX_I2S_CONFIG_SDOUT_PIN 29
+#endif
+
+// <o> NRFX_I2S_CONFIG_SDIN_PIN - SDIN pin  <0-31> 
+
+
+#ifndef NRFX_I2S_CONFIG_SDIN_PIN
+#define NRFX_I2S_CONFIG_SDIN_PIN 28
+#endif
+
+// <o> NRFX_I2S_CONFIG_MASTER  - Mode
+ 
+// <0=> Master 
+// <1=> Slave 
+
+#ifndef NRFX_I2S_CONFIG_MASTER
+#define NRFX_I2S_CONFIG_MASTER 0
 #endif
 
 // <o> NRFX_I2S_CONFIG_FORMAT  - Format
  
-// <0=> I2S 
-// <1=> Aligned 
+// <0=> I2S 
+// <1=> Aligned 
+
+#ifndef NRFX_I2S_CONFIG_FORMAT
+#define NRFX_I2S_CONFIG_FORMAT 0
+#endif
+
+// <o> NRFX_I2S_CONFIG_ALIGN  - Alignment
+ 
+// <0=> Left 
+// <1=> Right 
+
+#ifndef NRFX_I2S_CONFIG_ALIGN
+#define NRFX_I2S_CONFIG_ALIGN 0
+#endif
+
+// <o> NRFX_I2S_CONFIG_SWIDTH  - Sample width (bits)
+ 
+// <0=> 8 
+// <1=> 16 
+// <2=> 24 
+
+#ifndef NRFX_I2S_CONFIG_SWIDTH
+#define NRFX_I2S_CONFIG_SWIDTH 1
+#endif
+
+// <o> NRFX_I2S_CONFIG_CHANNELS  - Channels
+ 
+// <0=> Stereo 
+// <1=> Left 
+// <2=> Right 
+
+#ifndef NRFX_I2S_CONFIG_CHANNELS
+#define NRFX_I2S_CONFIG_CHANNELS 1
+#endif
+
+// <o> NRFX_I2S_CONFIG_MCK_SETUP  - MCK behavior
+ 
+// <0=> Disabled 
+// <2147483648=> 32MHz/2 
+// <1342177280=> 32MHz/3 
+// <1073741824=> 32MHz/4 
+// <805306368=> 32MHz/5 
+// <671088640=> 32MHz/6 
+// <536870912=> 32MHz/8 
+// <402653184=> 32MHz/10 
+// <369098752=> 32MHz/11 
+// <285212672=> 32MHz/15 
+// <268435456=> 32MHz/16 
+// <201326592=> 32MHz/21 
+// <184549376=> 32MHz/23 
+// <142606336=> 32MHz/30 
+// <138412032=> 32MHz/31 
+// <134217728=> 32MHz/32 
+// <100663296=> 32MHz/42 
+// <68157440=> 32MHz/63 
+// <34340864=> 32MHz/125 
+
+#ifndef NRFX_I2S_CONFIG_MCK_SETUP
+#define NRFX_I2S_CONFIG_MCK_SETUP 536870912
+#endif
+
+// <o> NRFX_I2S_CONFIG_RATIO  - MCK/LRCK ratio
+ 
+// <0=> 32x 
+// <1=> 48x 
+// <2=> 64x 
+// <3=> 96x 
+// <4=> 128x 
+// <5=> 192x 
+// <6=> 256x 
+// <7=> 384x 
+// <8=> 512x 
+
+#ifndef NRFX_I2S_CONFIG_RATIO
+#define NRFX_I2S_CONFIG_RATIO 2000
+#endif
+
+// <o> NRFX_I2S_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_I2S_CONFIG_IRQ_PRIORITY
+#define NRFX_I2S_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_I2S_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_I2S_CONFIG_LOG_ENABLED
+#define NRFX_I2S_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_I2S_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_I2S_CONFIG_LOG_LEVEL
+#define NRFX_I2S_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_I2S_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_I2S_CONFIG_INFO_COLOR
+#define NRFX_I2S_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_I2S_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_I2S_CONFIG_DEBUG_COLOR
+#define NRFX_I2S_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_LPCOMP_ENABLED - nrfx_lpcomp - LPCOMP peripheral driver
+//==========================================================
+#ifndef NRFX_LPCOMP_ENABLED
+#define NRFX_LPCOMP_ENABLED 0
+#endif
+// <o> NRFX_LPCOMP_CONFIG_REFERENCE  - Reference voltage
+ 
+// <0=> Supply 1/8 
+// <1=> Supply 2/8 
+// <2=> Supply 3/8 
+// <3=> Supply 4/8 
+// <4=> Supply 5/8 
+// <5=> SupplY 2/8 
+// <6=> Supply 7/8 
+// <8=> Supply 1/16 (nRF52) 
+// <9=> Supply 3/16 (nRF52) 
+// <10=> Supply 5/16 (nRF52) 
+// <11=> Supply 7/16 (nRF52) 
+// <12=> Supply 9/16 (nRF52) 
+// <13=> Supply 11/16 (nRF52) 
+// <14=> Supply 13/16 (nRF52) 
+// <15=> Supply 15/16 (nRF52) 
+// <7=> External Ref 0 
+// <65543=> External Ref 1 
+
+#ifndef NRFX_LPCOMP_CONFIG_REFERENCE
+#define NRFX_LPCOMP_CONFIG_REFERENCE 3
+#endif
+
+// <o> NRFX_LPCOMP_CONFIG_DETECTION  - Detection
+ 
+// <0=> Crossing 
+// <1=> Up 
+// <2=> Down 
+
+#ifndef NRFX_LPCOMP_CONFIG_DETECTION
+#define NRFX_LPCOMP_CONFIG_DETECTION 2
+#endif
+
+// <o> NRFX_LPCOMP_CONFIG_INPUT  - Analog input
+ 
+// <0=> 0 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_LPCOMP_CONFIG_INPUT
+#define NRFX_LPCOMP_CONFIG_INPUT 0
+#endif
+
+// <q> NRFX_LPCOMP_CONFIG_HYST  - Hysteresis
+ 
+
+#ifndef NRFX_LPCOMP_CONFIG_HYST
+#define NRFX_LPCOMP_CONFIG_HYST 0
+#endif
+
+// <o> NRFX_LPCOMP_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_LPCOMP_CONFIG_IRQ_PRIORITY
+#define NRFX_LPCOMP_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_LPCOMP_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_LPCOMP_CONFIG_LOG_ENABLED
+#define NRFX_LPCOMP_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_LPCOMP_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_LPCOMP_CONFIG_LOG_LEVEL
+#define NRFX_LPCOMP_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_LPCOMP_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_LPCOMP_CONFIG_INFO_COLOR
+#define NRFX_LPCOMP_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_LPCOMP_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_LPCOMP_CONFIG_DEBUG_COLOR
+#define NRFX_LPCOMP_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_NFCT_ENABLED - nrfx_nfct - NFCT peripheral driver
+//==========================================================
+#ifndef NRFX_NFCT_ENABLED
+#define NRFX_NFCT_ENABLED 0
+#endif
+// <o> NRFX_NFCT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_NFCT_CONFIG_IRQ_PRIORITY
+#define NRFX_NFCT_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_NFCT_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_NFCT_CONFIG_LOG_ENABLED
+#define NRFX_NFCT_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_NFCT_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_NFCT_CONFIG_LOG_LEVEL
+#define NRFX_NFCT_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_NFCT_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_NFCT_CONFIG_INFO_COLOR
+#define NRFX_NFCT_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_NFCT_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_NFCT_CONFIG_DEBUG_COLOR
+#define NRFX_NFCT_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_PDM_ENABLED - nrfx_pdm - PDM peripheral driver
+//==========================================================
+#ifndef NRFX_PDM_ENABLED
+#define NRFX_PDM_ENABLED 0
+#endif
+// <o> NRFX_PDM_CONFIG_MODE  - Mode
+ 
+// <0=> Stereo 
+// <1=> Mono 
+
+#ifndef NRFX_PDM_CONFIG_MODE
+#define NRFX_PDM_CONFIG_MODE 1
+#endif
+
+// <o> NRFX_PDM_CONFIG_EDGE  - Edge
+ 
+// <0=> Left falling 
+// <1=> Left rising 
+
+#ifndef NRFX_PDM_CONFIG_EDGE
+#define NRFX_PDM_CONFIG_EDGE 0
+#endif
+
+// <o> NRFX_PDM_CONFIG_CLOCK_FREQ  - Clock frequency
+ 
+// <134217728=> 1000k 
+// <138412032=> 1032k (default) 
+// <142606336=> 1067k 
+
+#ifndef NRFX_PDM_CONFIG_CLOCK_FREQ
+#define NRFX_PDM_CONFIG_CLOCK_FREQ 138412032
+#endif
+
+// <o> NRFX_PDM_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_PDM_CONFIG_IRQ_PRIORITY
+#define NRFX_PDM_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_PDM_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_PDM_CONFIG_LOG_ENABLED
+#define NRFX_PDM_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_PDM_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_PDM_CONFIG_LOG_LEVEL
+#define NRFX_PDM_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_PDM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_PDM_CONFIG_INFO_COLOR
+#define NRFX_PDM_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_PDM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_PDM_CONFIG_DEBUG_COLOR
+#define NRFX_PDM_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_POWER_ENABLED - nrfx_power - POWER peripheral driver
+//==========================================================
+#ifndef NRFX_POWER_ENABLED
+#define NRFX_POWER_ENABLED 0
+#endif
+// <o> NRFX_POWER_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_POWER_CONFIG_IRQ_PRIORITY
+#define NRFX_POWER_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <q> NRFX_POWER_CONFIG_DEFAULT_DCDCEN  - The default configuration of main DCDC regulator
+ 
+
+// <i> This settings means only that components for DCDC regulator are installed and it can be enabled.
+
+#ifndef NRFX_POWER_CONFIG_DEFAULT_DCDCEN
+#define NRFX_POWER_CONFIG_DEFAULT_DCDCEN 0
+#endif
+
+// <q> NRFX_POWER_CONFIG_DEFAULT_DCDCENHV  - The default configuration of High Voltage DCDC regulator
+ 
+
+// <i> This settings means only that components for DCDC regulator are installed and it can be enabled.
+
+#ifndef NRFX_POWER_CONFIG_DEFAULT_DCDCENHV
+#define NRFX_POWER_CONFIG_DEFAULT_DCDCENHV 0
+#endif
+
+// </e>
+
+// <e> NRFX_PPI_ENABLED - nrfx_ppi - PPI peripheral allocator
+//==========================================================
+#ifndef NRFX_PPI_ENABLED
+#define NRFX_PPI_ENABLED 1
+#endif
+// <e> NRFX_PPI_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_PPI_CONFIG_LOG_ENABLED
+#define NRFX_PPI_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_PPI_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_PPI_CONFIG_LOG_LEVEL
+#define NRFX_PPI_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_PPI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_PPI_CONFIG_INFO_COLOR
+#define NRFX_PPI_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_PPI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_PPI_CONFIG_DEBUG_COLOR
+#define NRFX_PPI_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_PRS_ENABLED - nrfx_prs - Peripheral Resource Sharing module
+//==========================================================
+#ifndef NRFX_PRS_ENABLED
+#define NRFX_PRS_ENABLED 1
+#endif
+// <q> NRFX_PRS_BOX_0_ENABLED  - Enables box 0 in the module.
+ 
+
+#ifndef NRFX_PRS_BOX_0_ENABLED
+#define NRFX_PRS_BOX_0_ENABLED 0
+#endif
+
+// <q> NRFX_PRS_BOX_1_ENABLED  - Enables box 1 in the module.
+ 
+
+#ifndef NRFX_PRS_BOX_1_ENABLED
+#define NRFX_PRS_BOX_1_ENABLED 0
+#endif
+
+// <q> NRFX_PRS_BOX_2_ENABLED  - Enables box 2 in the module.
+ 
+
+#ifndef NRFX_PRS_BOX_2_ENABLED
+#define NRFX_PRS_BOX_2_ENABLED 0
+#endif
+
+// <q> NRFX_PRS_BOX_3_ENABLED  - Enables box 3 in the module.
+ 
+
+#ifndef NRFX_PRS_BOX_3_ENABLED
+#define NRFX_PRS_BOX_3_ENABLED 0
+#endif
+
+// <q> NRFX_PRS_BOX_4_ENABLED  - Enables box 4 in the module.
+ 
+
+#ifndef NRFX_PRS_BOX_4_ENABLED
+#define NRFX_PRS_BOX_4_ENABLED 1
+#endif
+
+// <q> NRFX_PRS_CONFIG_SWITCH_ENABLED  - Enable fast switching of shared instances.
+ 
+
+// <i> Adds nrfx_prs_role_capture(), which saves the configuration of an initialized driver so that
+// <i> the instance is switched between drivers by restoring registers, with queued requests.
+
+#ifndef NRFX_PRS_CONFIG_SWITCH_ENABLED
+#define NRFX_PRS_CONFIG_SWITCH_ENABLED 0
+#endif
+
+// <e> NRFX_PRS_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_PRS_CONFIG_LOG_ENABLED
+#define NRFX_PRS_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_PRS_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_PRS_CONFIG_LOG_LEVEL
+#define NRFX_PRS_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_PRS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_PRS_CONFIG_INFO_COLOR
+#define NRFX_PRS_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_PRS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_PRS_CONFIG_DEBUG_COLOR
+#define NRFX_PRS_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_PWM_ENABLED - nrfx_pwm - PWM peripheral driver
+//==========================================================
+#ifndef NRFX_PWM_ENABLED
+#define NRFX_PWM_ENABLED 0
+#endif
+// <q> NRFX_PWM0_ENABLED  - Enable PWM0 instance
+ 
+
+#ifndef NRFX_PWM0_ENABLED
+#define NRFX_PWM0_ENABLED 0
+#endif
+
+// <q> NRFX_PWM1_ENABLED  - Enable PWM1 instance
+ 
+
+#ifndef NRFX_PWM1_ENABLED
+#define NRFX_PWM1_ENABLED 0
+#endif
+
+// <q> NRFX_PWM2_ENABLED  - Enable PWM2 instance
+ 
+
+#ifndef NRFX_PWM2_ENABLED
+#define NRFX_PWM2_ENABLED 0
+#endif
+
+// <q> NRFX_PWM3_ENABLED  - Enable PWM3 instance
+ 
+
+#ifndef NRFX_PWM3_ENABLED
+#define NRFX_PWM3_ENABLED 0
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_OUT0_PIN - Out0 pin  <0-31> 
+
+
+#ifndef NRFX_PWM_DEFAULT_CONFIG_OUT0_PIN
+#define NRFX_PWM_DEFAULT_CONFIG_OUT0_PIN 31
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_OUT1_PIN - Out1 pin  <0-31> 
+
+
+#ifndef NRFX_PWM_DEFAULT_CONFIG_OUT1_PIN
+#define NRFX_PWM_DEFAULT_CONFIG_OUT1_PIN 31
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_OUT2_PIN - Out2 pin  <0-31> 
+
+
+#ifndef NRFX_PWM_DEFAULT_CONFIG_OUT2_PIN
+#define NRFX_PWM_DEFAULT_CONFIG_OUT2_PIN 31
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_OUT3_PIN - Out3 pin  <0-31> 
+
+
+#ifndef NRFX_PWM_DEFAULT_CONFIG_OUT3_PIN
+#define NRFX_PWM_DEFAULT_CONFIG_OUT3_PIN 31
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_BASE_CLOCK  - Base clock
+ 
+// <0=> 16 MHz 
+// <1=> 8 MHz 
+// <2=> 4 MHz 
+// <3=> 2 MHz 
+// <4=> 1 MHz 
+// <5=> 500 kHz 
+// <6=> 250 kHz 
+// <7=> 125 kHz 
+
+#ifndef NRFX_PWM_DEFAULT_CONFIG_BASE_CLOCK
+#define NRFX_PWM_DEFAULT_CONFIG_BASE_CLOCK 4
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_COUNT_MODE  - Count mode
+ 
+// <0=> Up 
+// <1=> Up and Down 
+
+#ifndef NRFX_PWM_DEFAULT_CONFIG_COUNT_MODE
+#define NRFX_PWM_DEFAULT_CONFIG_COUNT_MODE 0
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_TOP_VALUE - Top value 
+#ifndef NRFX_PWM_DEFAULT_CONFIG_TOP_VALUE
+#define NRFX_PWM_DEFAULT_CONFIG_TOP_VALUE 1000
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_LOAD_MODE  - Load mode
+ 
+// <0=> Common 
+// <1=> Grouped 
+// <2=> Individual 
+// <3=> Waveform 
+
+#ifndef NRFX_PWM_DEFAULT_CONFIG_LOAD_MODE
+#define NRFX_PWM_DEFAULT_CONFIG_LOAD_MODE 0
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_STEP_MODE  - Step mode
+ 
+// <0=> Auto 
+// <1=> Triggered 
+
+#ifndef NRFX_PWM_DEFAULT_CONFIG_STEP_MODE
+#define NRFX_PWM_DEFAULT_CONFIG_STEP_MODE 0
+#endif
+
+// <o> NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_PWM_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_PWM_CONFIG_LOG_ENABLED
+#define NRFX_PWM_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_PWM_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_PWM_CONFIG_LOG_LEVEL
+#define NRFX_PWM_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_PWM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_PWM_CONFIG_INFO_COLOR
+#define NRFX_PWM_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_PWM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_PWM_CONFIG_DEBUG_COLOR
+#define NRFX_PWM_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_QDEC_ENABLED - nrfx_qdec - QDEC peripheral driver
+//==========================================================
+#ifndef NRFX_QDEC_ENABLED
+#define NRFX_QDEC_ENABLED 0
+#endif
+// <o> NRFX_QDEC_CONFIG_REPORTPER  - Report period
+ 
+// <0=> 10 Samples 
+// <1=> 40 Samples 
+// <2=> 80 Samples 
+// <3=> 120 Samples 
+// <4=> 160 Samples 
+// <5=> 200 Samples 
+// <6=> 240 Samples 
+// <7=> 280 Samples 
+
+#ifndef NRFX_QDEC_CONFIG_REPORTPER
+#define NRFX_QDEC_CONFIG_REPORTPER 0
+#endif
+
+// <o> NRFX_QDEC_CONFIG_SAMPLEPER  - Sample period
+ 
+// <0=> 128 us 
+// <1=> 256 us 
+// <2=> 512 us 
+// <3=> 1024 us 
+// <4=> 2048 us 
+// <5=> 4096 us 
+// <6=> 8192 us 
+// <7=> 16384 us 
+
+#ifndef NRFX_QDEC_CONFIG_SAMPLEPER
+#define NRFX_QDEC_CONFIG_SAMPLEPER 7
+#endif
+
+// <o> NRFX_QDEC_CONFIG_PIO_A - A pin  <0-31> 
+
+
+#ifndef NRFX_QDEC_CONFIG_PIO_A
+#define NRFX_QDEC_CONFIG_PIO_A 31
+#endif
+
+// <o> NRFX_QDEC_CONFIG_PIO_B - B pin  <0-31> 
+
+
+#ifndef NRFX_QDEC_CONFIG_PIO_B
+#define NRFX_QDEC_CONFIG_PIO_B 31
+#endif
+
+// <o> NRFX_QDEC_CONFIG_PIO_LED - LED pin  <0-31> 
+
+
+#ifndef NRFX_QDEC_CONFIG_PIO_LED
+#define NRFX_QDEC_CONFIG_PIO_LED 31
+#endif
+
+// <o> NRFX_QDEC_CONFIG_LEDPRE - LED pre 
+#ifndef NRFX_QDEC_CONFIG_LEDPRE
+#define NRFX_QDEC_CONFIG_LEDPRE 511
+#endif
+
+// <o> NRFX_QDEC_CONFIG_LEDPOL  - LED polarity
+ 
+// <0=> Active low 
+// <1=> Active high 
+
+#ifndef NRFX_QDEC_CONFIG_LEDPOL
+#define NRFX_QDEC_CONFIG_LEDPOL 1
+#endif
+
+// <q> NRFX_QDEC_CONFIG_DBFEN  - Debouncing enable
+ 
+
+#ifndef NRFX_QDEC_CONFIG_DBFEN
+#define NRFX_QDEC_CONFIG_DBFEN 0
+#endif
+
+// <q> NRFX_QDEC_CONFIG_SAMPLE_INTEN  - Sample ready interrupt enable
+ 
+
+#ifndef NRFX_QDEC_CONFIG_SAMPLE_INTEN
+#define NRFX_QDEC_CONFIG_SAMPLE_INTEN 0
+#endif
+
+// <o> NRFX_QDEC_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_QDEC_CONFIG_IRQ_PRIORITY
+#define NRFX_QDEC_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_QDEC_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_QDEC_CONFIG_LOG_ENABLED
+#define NRFX_QDEC_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_QDEC_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_QDEC_CONFIG_LOG_LEVEL
+#define NRFX_QDEC_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_QDEC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_QDEC_CONFIG_INFO_COLOR
+#define NRFX_QDEC_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_QDEC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_QDEC_CONFIG_DEBUG_COLOR
+#define NRFX_QDEC_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_QSPI_ENABLED - nrfx_qspi - QSPI peripheral driver
+//==========================================================
+#ifndef NRFX_QSPI_ENABLED
+#define NRFX_QSPI_ENABLED 0
+#endif
+// <o> NRFX_QSPI_CONFIG_SCK_DELAY - tSHSL, tWHSL and tSHWL in number of 16 MHz periods (62.5 ns).  <0-255> 
+
+
+#ifndef NRFX_QSPI_CONFIG_SCK_DELAY
+#define NRFX_QSPI_CONFIG_SCK_DELAY 1
+#endif
+
+// <o> NRFX_QSPI_CONFIG_XIP_OFFSET - Address offset in the external memory for Execute in Place operation. 
+#ifndef NRFX_QSPI_CONFIG_XIP_OFFSET
+#define NRFX_QSPI_CONFIG_XIP_OFFSET 0
+#endif
+
+// <o> NRFX_QSPI_CONFIG_READOC  - Number of data lines and opcode used for reading.
+ 
+// <0=> FastRead 
+// <1=> Read2O 
+// <2=> Read2IO 
+// <3=> Read4O 
+// <4=> Read4IO 
+
+#ifndef NRFX_QSPI_CONFIG_READOC
+#define NRFX_QSPI_CONFIG_READOC 0
+#endif
+
+// <o> NRFX_QSPI_CONFIG_WRITEOC  - Number of data lines and opcode used for writing.
+ 
+// <0=> PP 
+// <1=> PP2O 
+// <2=> PP4O 
+// <3=> PP4IO 
+
+#ifndef NRFX_QSPI_CONFIG_WRITEOC
+#define NRFX_QSPI_CONFIG_WRITEOC 0
+#endif
+
+// <o> NRFX_QSPI_CONFIG_ADDRMODE  - Addressing mode.
+ 
+// <0=> 24bit 
+// <1=> 32bit 
+
+#ifndef NRFX_QSPI_CONFIG_ADDRMODE
+#define NRFX_QSPI_CONFIG_ADDRMODE 0
+#endif
+
+// <o> NRFX_QSPI_CONFIG_MODE  - SPI mode.
+ 
+// <0=> Mode 0 
+// <1=> Mode 1 
+
+#ifndef NRFX_QSPI_CONFIG_MODE
+#define NRFX_QSPI_CONFIG_MODE 0
+#endif
+
+// <o> NRFX_QSPI_CONFIG_FREQUENCY  - Frequency divider.
+ 
+// <0=> 32MHz/1 
+// <1=> 32MHz/2 
+// <2=> 32MHz/3 
+// <3=> 32MHz/4 
+// <4=> 32MHz/5 
+// <5=> 32MHz/6 
+// <6=> 32MHz/7 
+// <7=> 32MHz/8 
+// <8=> 32MHz/9 
+// <9=> 32MHz/10 
+// <10=> 32MHz/11 
+// <11=> 32MHz/12 
+// <12=> 32MHz/13 
+// <13=> 32MHz/14 
+// <14=> 32MHz/15 
+// <15=> 32MHz/16 
+
+#ifndef NRFX_QSPI_CONFIG_FREQUENCY
+#define NRFX_QSPI_CONFIG_FREQUENCY 15
+#endif
+
+// <s> NRFX_QSPI_PIN_SCK - SCK pin value.
+#ifndef NRFX_QSPI_PIN_SCK
+#define NRFX_QSPI_PIN_SCK NRF_QSPI_PIN_NOT_CONNECTED
+#endif
+
+// <s> NRFX_QSPI_PIN_CSN - CSN pin value.
+#ifndef NRFX_QSPI_PIN_CSN
+#define NRFX_QSPI_PIN_CSN NRF_QSPI_PIN_NOT_CONNECTED
+#endif
+
+// <s> NRFX_QSPI_PIN_IO0 - IO0 pin value.
+#ifndef NRFX_QSPI_PIN_IO0
+#define NRFX_QSPI_PIN_IO0 NRF_QSPI_PIN_NOT_CONNECTED
+#endif
+
+// <s> NRFX_QSPI_PIN_IO1 - IO1 pin value.
+#ifndef NRFX_QSPI_PIN_IO1
+#define NRFX_QSPI_PIN_IO1 NRF_QSPI_PIN_NOT_CONNECTED
+#endif
+
+// <s> NRFX_QSPI_PIN_IO2 - IO2 pin value.
+#ifndef NRFX_QSPI_PIN_IO2
+#define NRFX_QSPI_PIN_IO2 NRF_QSPI_PIN_NOT_CONNECTED
+#endif
+
+// <s> NRFX_QSPI_PIN_IO3 - IO3 pin value.
+#ifndef NRFX_QSPI_PIN_IO3
+#define NRFX_QSPI_PIN_IO3 NRF_QSPI_PIN_NOT_CONNECTED
+#endif
+
+// <o> NRFX_QSPI_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_QSPI_CONFIG_IRQ_PRIORITY
+#define NRFX_QSPI_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// </e>
+
+// <e> NRFX_RNG_ENABLED - nrfx_rng - RNG peripheral driver
+//==========================================================
+#ifndef NRFX_RNG_ENABLED
+#define NRFX_RNG_ENABLED 0
+#endif
+// <q> NRFX_RNG_CONFIG_ERROR_CORRECTION  - Error correction
+ 
+
+#ifndef NRFX_RNG_CONFIG_ERROR_CORRECTION
+#define NRFX_RNG_CONFIG_ERROR_CORRECTION 1
+#endif
+
+// <o> NRFX_RNG_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_RNG_CONFIG_IRQ_PRIORITY
+#define NRFX_RNG_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_RNG_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_RNG_CONFIG_LOG_ENABLED
+#define NRFX_RNG_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_RNG_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_RNG_CONFIG_LOG_LEVEL
+#define NRFX_RNG_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_RNG_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_RNG_CONFIG_INFO_COLOR
+#define NRFX_RNG_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_RNG_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_RNG_CONFIG_DEBUG_COLOR
+#define NRFX_RNG_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_RTC_ENABLED - nrfx_rtc - RTC peripheral driver
+//==========================================================
+#ifndef NRFX_RTC_ENABLED
+#define NRFX_RTC_ENABLED 1
+#endif
+// <q> NRFX_RTC0_ENABLED  - Enable RTC0 instance
+ 
+
+#ifndef NRFX_RTC0_ENABLED
+#define NRFX_RTC0_ENABLED 0
+#endif
+
+// <q> NRFX_RTC1_ENABLED  - Enable RTC1 instance
+ 
+
+#ifndef NRFX_RTC1_ENABLED
+#define NRFX_RTC1_ENABLED 0
+#endif
+
+// <q> NRFX_RTC2_ENABLED  - Enable RTC2 instance
+ 
+
+#ifndef NRFX_RTC2_ENABLED
+#define NRFX_RTC2_ENABLED 0
+#endif
+
+// <o> NRFX_RTC_MAXIMUM_LATENCY_US - Maximum possible time[us] in highest priority interrupt 
+#ifndef NRFX_RTC_MAXIMUM_LATENCY_US
+#define NRFX_RTC_MAXIMUM_LATENCY_US 2000
+#endif
+
+// <o> NRFX_RTC_DEFAULT_CONFIG_FREQUENCY - Frequency  <16-32768> 
+
+
+#ifndef NRFX_RTC_DEFAULT_CONFIG_FREQUENCY
+#define NRFX_RTC_DEFAULT_CONFIG_FREQUENCY 32768
+#endif
+
+// <q> NRFX_RTC_DEFAULT_CONFIG_RELIABLE  - Ensures safe compare event triggering
+ 
+
+#ifndef NRFX_RTC_DEFAULT_CONFIG_RELIABLE
+#define NRFX_RTC_DEFAULT_CONFIG_RELIABLE 0
+#endif
+
+// <o> NRFX_RTC_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_RTC_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_RTC_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_RTC_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_RTC_CONFIG_LOG_ENABLED
+#define NRFX_RTC_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_RTC_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_RTC_CONFIG_LOG_LEVEL
+#define NRFX_RTC_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_RTC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_RTC_CONFIG_INFO_COLOR
+#define NRFX_RTC_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_RTC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_RTC_CONFIG_DEBUG_COLOR
+#define NRFX_RTC_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+// <e> NRFX_SAADC_ENABLED - nrfx_saadc - SAADC peripheral driver
+//==========================================================
+#ifndef NRFX_SAADC_ENABLED
+#define NRFX_SAADC_ENABLED 1
+#endif
+// <o> NRFX_SAADC_CONFIG_RESOLUTION  - Resolution
+ 
+// <0=> 8 bit 
+// <1=> 10 bit 
+// <2=> 12 bit 
+// <3=> 14 bit 
+
+#ifndef NRFX_SAADC_CONFIG_RESOLUTION
+#define NRFX_SAADC_CONFIG_RESOLUTION 1
+#endif
+
+// <o> NRFX_SAADC_CONFIG_OVERSAMPLE  - Sample period
+ 
+// <0=> Disabled 
+// <1=> 2x 
+// <2=> 4x 
+// <3=> 8x 
+// <4=> 16x 
+// <5=> 32x 
+// <6=> 64x 
+// <7=> 128x 
+// <8=> 256x 
+
+#ifndef NRFX_SAADC_CONFIG_OVERSAMPLE
+#define NRFX_SAADC_CONFIG_OVERSAMPLE 0
+#endif
+
+// <q> NRFX_SAADC_CONFIG_LP_MODE  - Enabling low power mode
+ 
+
+#ifndef NRFX_SAADC_CONFIG_LP_MODE
+#define NRFX_SAADC_CONFIG_LP_MODE 0
+#endif
+
+// <o> NRFX_SAADC_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_SAADC_CONFIG_IRQ_PRIORITY
+#define NRFX_SAADC_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <q> NRFX_SAADC_CONFIG_RAMFUNC_ENABLED  - Run the interrupt handler from RAM.
+ 
+
+// <i> nrfx_saadc_irq_handler and the event helpers it calls run from RAM and do not pay flash wait states.
+// <i> The event handler given to the driver (app_saadc), logging, the trace and profiler hooks, constants
+// <i> and the interrupt vector table stay in flash, so the interrupt still stalls while the NVMC erases
+// <i> or writes a page.
+// <i> The code is placed in the .ramfunc section, which must be present in the linker configuration.
+
+#ifndef NRFX_SAADC_CONFIG_RAMFUNC_ENABLED
+#define NRFX_SAADC_CONFIG_RAMFUNC_ENABLED 1
+#endif
+
+// <e> NRFX_SAADC_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_SAADC_CONFIG_LOG_ENABLED
+#define NRFX_SAADC_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_SAADC_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_SAADC_CONFIG_LOG_LEVEL
+#define NRFX_SAADC_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_SAADC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_SAADC_CONFIG_INFO_COLOR
+#define NRFX_SAADC_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_SAADC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_SAADC_CONFIG_DEBUG_COLOR
+#define NRFX_SAADC_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_SPIM_ENABLED - nrfx_spim - SPIM peripheral driver
+//==========================================================
+#ifndef NRFX_SPIM_ENABLED
+#define NRFX_SPIM_ENABLED 0
+#endif
+// <q> NRFX_SPIM0_ENABLED  - Enable SPIM0 instance
+ 
+
+#ifndef NRFX_SPIM0_ENABLED
+#define NRFX_SPIM0_ENABLED 0
+#endif
+
+// <q> NRFX_SPIM1_ENABLED  - Enable SPIM1 instance
+ 
+
+#ifndef NRFX_SPIM1_ENABLED
+#define NRFX_SPIM1_ENABLED 0
+#endif
+
+// <q> NRFX_SPIM2_ENABLED  - Enable SPIM2 instance
+ 
+
+#ifndef NRFX_SPIM2_ENABLED
+#define NRFX_SPIM2_ENABLED 0
+#endif
+
+// <q> NRFX_SPIM3_ENABLED  - Enable SPIM3 instance
+ 
+
+#ifndef NRFX_SPIM3_ENABLED
+#define NRFX_SPIM3_ENABLED 0
+#endif
+
+// <q> NRFX_SPIM_EXTENDED_ENABLED  - Enable extended SPIM features
+ 
+
+#ifndef NRFX_SPIM_EXTENDED_ENABLED
+#define NRFX_SPIM_EXTENDED_ENABLED 0
+#endif
+
+// <o> NRFX_SPIM_MISO_PULL_CFG  - MISO pin pull configuration.
+ 
+// <0=> NRF_GPIO_PIN_NOPULL 
+// <1=> NRF_GPIO_PIN_PULLDOWN 
+// <3=> NRF_GPIO_PIN_PULLUP 
+
+#ifndef NRFX_SPIM_MISO_PULL_CFG
+#define NRFX_SPIM_MISO_PULL_CFG 1
+#endif
+
+// <o> NRFX_SPIM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_SPIM_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_SPIM_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_SPIM_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_SPIM_CONFIG_LOG_ENABLED
+#define NRFX_SPIM_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_SPIM_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRFX_SPIM_CONFIG_LOG_LEVEL
+#define NRFX_SPIM_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_SPIM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_SPIM_CONFIG_INFO_COLOR
+#define NRFX_SPIM_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_SPIM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRFX_SPIM_CONFIG_DEBUG_COLOR
+#define NRFX_SPIM_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRFX_SPIS_ENABLED - nrfx_spis - SPIS peripheral driver
+//==========================================================
+#ifndef NRFX_SPIS_ENABLED
+#define NRFX_SPIS_ENABLED 0
+#endif
+// <q> NRFX_SPIS0_ENABLED  - Enable SPIS0 instance
+ 
+
+#ifndef NRFX_SPIS0_ENABLED
+#define NRFX_SPIS0_ENABLED 0
+#endif
+
+// <q> NRFX_SPIS1_ENABLED  - Enable SPIS1 instance
+ 
+
+#ifndef NRFX_SPIS1_ENABLED
+#define NRFX_SPIS1_ENABLED 0
+#endif
+
+// <q> NRFX_SPIS2_ENABLED  - Enable SPIS2 instance
+ 
+
+#ifndef NRFX_SPIS2_ENABLED
+#define NRFX_SPIS2_ENABLED 0
+#endif
+
+// <o> NRFX_SPIS_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
 
-#ifndef NRFX_I2S_CONFIG_FORMAT
-#define NRFX_I2S_CONFIG_FORMAT 0
+#ifndef NRFX_SPIS_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_SPIS_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <o> NRFX_I2S_CONFIG_ALIGN  - Alignment
+// <o> NRFX_SPIS_DEFAULT_DEF - SPIS default DEF character  <0-255> 
+
+
+#ifndef NRFX_SPIS_DEFAULT_DEF
+#define NRFX_SPIS_DEFAULT_DEF 255
+#endif
+
+// <o> NRFX_SPIS_DEFAULT_ORC - SPIS default ORC character  <0-255> 
+
+
+#ifndef NRFX_SPIS_DEFAULT_ORC
+#define NRFX_SPIS_DEFAULT_ORC 255
+#endif
+
+// <e> NRFX_SPIS_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_SPIS_CONFIG_LOG_ENABLED
+#define NRFX_SPIS_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_SPIS_CONFIG_LOG_LEVEL  - Default Severity level
  
-// <0=> Left 
-// <1=> Right 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-#ifndef NRFX_I2S_CONFIG_ALIGN
-#define NRFX_I2S_CONFIG_ALIGN 0
+#ifndef NRFX_SPIS_CONFIG_LOG_LEVEL
+#define NRFX_SPIS_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_I2S_CONFIG_SWIDTH  - Sample width (bits)
+// <o> NRFX_SPIS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
-// <0=> 8 
-// <1=> 16 
-// <2=> 24 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRFX_I2S_CONFIG_SWIDTH
-#define NRFX_I2S_CONFIG_SWIDTH 1
+#ifndef NRFX_SPIS_CONFIG_INFO_COLOR
+#define NRFX_SPIS_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_I2S_CONFIG_CHANNELS  - Channels
+// <o> NRFX_SPIS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
-// <0=> Stereo 
-// <1=> Left 
-// <2=> Right 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRFX_I2S_CONFIG_CHANNELS
-#define NRFX_I2S_CONFIG_CHANNELS 1
+#ifndef NRFX_SPIS_CONFIG_DEBUG_COLOR
+#define NRFX_SPIS_CONFIG_DEBUG_COLOR 0
 #endif
 
-// <o> NRFX_I2S_CONFIG_MCK_SETUP  - MCK behavior
+// </e>
+
+// </e>
+
+// <e> NRFX_SPI_ENABLED - nrfx_spi - SPI peripheral driver
+//==========================================================
+#ifndef NRFX_SPI_ENABLED
+#define NRFX_SPI_ENABLED 0
+#endif
+// <q> NRFX_SPI0_ENABLED  - Enable SPI0 instance
  
-// <0=> Disabled 
-// <2147483648=> 32MHz/2 
-// <1342177280=> 32MHz/3 
-// <1073741824=> 32MHz/4 
-// <805306368=> 32MHz/5 
-// <671088640=> 32MHz/6 
-// <536870912=> 32MHz/8 
-// <402653184=> 32MHz/10 
-// <369098752=> 32MHz/11 
-// <285212672=> 32MHz/15 
-// <268435456=> 32MHz/16 
-// <201326592=> 32MHz/21 
-// <184549376=> 32MHz/23 
-// <142606336=> 32MHz/30 
-// <138412032=> 32MHz/31 
-// <134217728=> 32MHz/32 
-// <100663296=> 32MHz/42 
-// <68157440=> 32MHz/63 
-// <34340864=> 32MHz/125 
 
-#ifndef NRFX_I2S_CONFIG_MCK_SETUP
-#define NRFX_I2S_CONFIG_MCK_SETUP 536870912
+#ifndef NRFX_SPI0_ENABLED
+#define NRFX_SPI0_ENABLED 0
 #endif
 
-// <o> NRFX_I2S_CONFIG_RATIO  - MCK/LRCK ratio
+// <q> NRFX_SPI1_ENABLED  - Enable SPI1 instance
  
-// <0=> 32x 
-// <1=> 48x 
-// <2=> 64x 
-// <3=> 96x 
-// <4=> 128x 
-// <5=> 192x 
-// <6=> 256x 
-// <7=> 384x 
-// <8=> 512x 
 
-#ifndef NRFX_I2S_CONFIG_RATIO
-#define NRFX_I2S_CONFIG_RATIO 2000
+#ifndef NRFX_SPI1_ENABLED
+#define NRFX_SPI1_ENABLED 0
 #endif
 
-// <o> NRFX_I2S_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRFX_SPI2_ENABLED  - Enable SPI2 instance
+ 
+
+#ifndef NRFX_SPI2_ENABLED
+#define NRFX_SPI2_ENABLED 0
+#endif
+
+// <o> NRFX_SPI_MISO_PULL_CFG  - MISO pin pull configuration.
+ 
+// <0=> NRF_GPIO_PIN_NOPULL 
+// <1=> NRF_GPIO_PIN_PULLDOWN 
+// <3=> NRF_GPIO_PIN_PULLUP 
+
+#ifndef NRFX_SPI_MISO_PULL_CFG
+#define NRFX_SPI_MISO_PULL_CFG 1
+#endif
+
+// <o> NRFX_SPI_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 // <0=> 0 (highest) 
 // <1=> 1 
@@ -2277,16 +5127,16 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_I2S_CONFIG_IRQ_PRIORITY
-#define NRFX_I2S_CONFIG_IRQ_PRIORITY 2
+#ifndef NRFX_SPI_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_SPI_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_I2S_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> NRFX_SPI_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRFX_I2S_CONFIG_LOG_ENABLED
-#define NRFX_I2S_CONFIG_LOG_ENABLED 0
+#ifndef NRFX_SPI_CONFIG_LOG_ENABLED
+#define NRFX_SPI_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRFX_I2S_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRFX_SPI_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -2294,11 +5144,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRFX_I2S_CONFIG_LOG_LEVEL
-#define NRFX_I2S_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_SPI_CONFIG_LOG_LEVEL
+#define NRFX_SPI_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_I2S_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> NRFX_SPI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2310,11 +5160,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_I2S_CONFIG_INFO_COLOR
-#define NRFX_I2S_CONFIG_INFO_COLOR 0
+#ifndef NRFX_SPI_CONFIG_INFO_COLOR
+#define NRFX_SPI_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_I2S_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRFX_SPI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2326,96 +5176,74 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_I2S_CONFIG_DEBUG_COLOR
-#define NRFX_I2S_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_SPI_CONFIG_DEBUG_COLOR
+#define NRFX_SPI_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
 // </e>
 
-// <e> NRFX_LPCOMP_ENABLED - nrfx_lpcomp - LPCOMP peripheral driver
+// <e> NRFX_SWI_ENABLED - nrfx_swi - SWI/EGU peripheral allocator
 //==========================================================
-#ifndef NRFX_LPCOMP_ENABLED
-#define NRFX_LPCOMP_ENABLED 0
+#ifndef NRFX_SWI_ENABLED
+#define NRFX_SWI_ENABLED 0
 #endif
-// <o> NRFX_LPCOMP_CONFIG_REFERENCE  - Reference voltage
+// <q> NRFX_EGU_ENABLED  - Enable EGU support
  
-// <0=> Supply 1/8 
-// <1=> Supply 2/8 
-// <2=> Supply 3/8 
-// <3=> Supply 4/8 
-// <4=> Supply 5/8 
-// <5=> SupplY 2/8 
-// <6=> Supply 7/8 
-// <8=> Supply 1/16 (nRF52) 
-// <9=> Supply 3/16 (nRF52) 
-// <10=> Supply 5/16 (nRF52) 
-// <11=> Supply 7/16 (nRF52) 
-// <12=> Supply 9/16 (nRF52) 
-// <13=> Supply 11/16 (nRF52) 
-// <14=> Supply 13/16 (nRF52) 
-// <15=> Supply 15/16 (nRF52) 
-// <7=> External Ref 0 
-// <65543=> External Ref 1 
 
-#ifndef NRFX_LPCOMP_CONFIG_REFERENCE
-#define NRFX_LPCOMP_CONFIG_REFERENCE 3
+#ifndef NRFX_EGU_ENABLED
+#define NRFX_EGU_ENABLED 0
 #endif
 
-// <o> NRFX_LPCOMP_CONFIG_DETECTION  - Detection
+// <q> NRFX_SWI0_DISABLED  - Exclude SWI0 from being utilized by the driver
  
-// <0=> Crossing 
-// <1=> Up 
-// <2=> Down 
 
-#ifndef NRFX_LPCOMP_CONFIG_DETECTION
-#define NRFX_LPCOMP_CONFIG_DETECTION 2
+#ifndef NRFX_SWI0_DISABLED
+#define NRFX_SWI0_DISABLED 0
 #endif
 
-// <o> NRFX_LPCOMP_CONFIG_INPUT  - Analog input
+// <q> NRFX_SWI1_DISABLED  - Exclude SWI1 from being utilized by the driver
  
-// <0=> 0 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef NRFX_LPCOMP_CONFIG_INPUT
-#define NRFX_LPCOMP_CONFIG_INPUT 0
+#ifndef NRFX_SWI1_DISABLED
+#define NRFX_SWI1_DISABLED 0
 #endif
 
-// <q> NRFX_LPCOMP_CONFIG_HYST  - Hysteresis
+// <q> NRFX_SWI2_DISABLED  - Exclude SWI2 from being utilized by the driver
  
 
-#ifndef NRFX_LPCOMP_CONFIG_HYST
-#define NRFX_LPCOMP_CONFIG_HYST 0
+#ifndef NRFX_SWI2_DISABLED
+#define NRFX_SWI2_DISABLED 0
 #endif
 
-// <o> NRFX_LPCOMP_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRFX_SWI3_DISABLED  - Exclude SWI3 from being utilized by the driver
+ 
+
+#ifndef NRFX_SWI3_DISABLED
+#define NRFX_SWI3_DISABLED 0
+#endif
+
+// <q> NRFX_SWI4_DISABLED  - Exclude SWI4 from being utilized by the driver
+ 
+
+#ifndef NRFX_SWI4_DISABLED
+#define NRFX_SWI4_DISABLED 0
+#endif
+
+// <q> NRFX_SWI5_DISABLED  - Exclude SWI5 from being utilized by the driver
  
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef NRFX_LPCOMP_CONFIG_IRQ_PRIORITY
-#define NRFX_LPCOMP_CONFIG_IRQ_PRIORITY 2
+#ifndef NRFX_SWI5_DISABLED
+#define NRFX_SWI5_DISABLED 0
 #endif
 
-// <e> NRFX_LPCOMP_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> NRFX_SWI_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRFX_LPCOMP_CONFIG_LOG_ENABLED
-#define NRFX_LPCOMP_CONFIG_LOG_ENABLED 0
+#ifndef NRFX_SWI_CONFIG_LOG_ENABLED
+#define NRFX_SWI_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRFX_LPCOMP_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRFX_SWI_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -2423,11 +5251,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRFX_LPCOMP_CONFIG_LOG_LEVEL
-#define NRFX_LPCOMP_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_SWI_CONFIG_LOG_LEVEL
+#define NRFX_SWI_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_LPCOMP_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> NRFX_SWI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2439,11 +5267,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_LPCOMP_CONFIG_INFO_COLOR
-#define NRFX_LPCOMP_CONFIG_INFO_COLOR 0
+#ifndef NRFX_SWI_CONFIG_INFO_COLOR
+#define NRFX_SWI_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_LPCOMP_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRFX_SWI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2455,121 +5283,92 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_LPCOMP_CONFIG_DEBUG_COLOR
-#define NRFX_LPCOMP_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_SWI_CONFIG_DEBUG_COLOR
+#define NRFX_SWI_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
 // </e>
 
-// <e> NRFX_NFCT_ENABLED - nrfx_nfct - NFCT peripheral driver
+// <e> NRFX_TIMER_ENABLED - nrfx_timer - TIMER periperal driver
 //==========================================================
-#ifndef NRFX_NFCT_ENABLED
-#define NRFX_NFCT_ENABLED 0
+#ifndef NRFX_TIMER_ENABLED
+#define NRFX_TIMER_ENABLED 0
 #endif
-// <o> NRFX_NFCT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRFX_TIMER0_ENABLED  - Enable TIMER0 instance
  
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef NRFX_NFCT_CONFIG_IRQ_PRIORITY
-#define NRFX_NFCT_CONFIG_IRQ_PRIORITY 2
+#ifndef NRFX_TIMER0_ENABLED
+#define NRFX_TIMER0_ENABLED 0
 #endif
 
-// <e> NRFX_NFCT_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_NFCT_CONFIG_LOG_ENABLED
-#define NRFX_NFCT_CONFIG_LOG_ENABLED 0
-#endif
-// <o> NRFX_NFCT_CONFIG_LOG_LEVEL  - Default Severity level
+// <q> NRFX_TIMER1_ENABLED  - Enable TIMER1 instance
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_NFCT_CONFIG_LOG_LEVEL
-#define NRFX_NFCT_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_TIMER1_ENABLED
+#define NRFX_TIMER1_ENABLED 0
 #endif
 
-// <o> NRFX_NFCT_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> NRFX_TIMER2_ENABLED  - Enable TIMER2 instance
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_NFCT_CONFIG_INFO_COLOR
-#define NRFX_NFCT_CONFIG_INFO_COLOR 0
+#ifndef NRFX_TIMER2_ENABLED
+#define NRFX_TIMER2_ENABLED 0
 #endif
 
-// <o> NRFX_NFCT_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> NRFX_TIMER3_ENABLED  - Enable TIMER3 instance
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_NFCT_CONFIG_DEBUG_COLOR
-#define NRFX_NFCT_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_TIMER3_ENABLED
+#define NRFX_TIMER3_ENABLED 0
 #endif
 
-// </e>
-
-// </e>
+// <q> NRFX_TIMER4_ENABLED  - Enable TIMER4 instance
+ 
 
-// <e> NRFX_PDM_ENABLED - nrfx_pdm - PDM peripheral driver
-//==========================================================
-#ifndef NRFX_PDM_ENABLED
-#define NRFX_PDM_ENABLED 0
+#ifndef NRFX_TIMER4_ENABLED
+#define NRFX_TIMER4_ENABLED 0
 #endif
-// <o> NRFX_PDM_CONFIG_MODE  - Mode
+
+// <o> NRFX_TIMER_DEFAULT_CONFIG_FREQUENCY  - Timer frequency if in Timer mode
  
-// <0=> Stereo 
-// <1=> Mono 
+// <0=> 16 MHz 
+// <1=> 8 MHz 
+// <2=> 4 MHz 
+// <3=> 2 MHz 
+// <4=> 1 MHz 
+// <5=> 500 kHz 
+// <6=> 250 kHz 
+// <7=> 125 kHz 
+// <8=> 62.5 kHz 
+// <9=> 31.25 kHz 
 
-#ifndef NRFX_PDM_CONFIG_MODE
-#define NRFX_PDM_CONFIG_MODE 1
+#ifndef NRFX_TIMER_DEFAULT_CONFIG_FREQUENCY
+#define NRFX_TIMER_DEFAULT_CONFIG_FREQUENCY 0
 #endif
 
-// <o> NRFX_PDM_CONFIG_EDGE  - Edge
+// <o> NRFX_TIMER_DEFAULT_CONFIG_MODE  - Timer mode or operation
  
-// <0=> Left falling 
-// <1=> Left rising 
+// <0=> Timer 
+// <1=> Counter 
 
-#ifndef NRFX_PDM_CONFIG_EDGE
-#define NRFX_PDM_CONFIG_EDGE 0
+#ifndef NRFX_TIMER_DEFAULT_CONFIG_MODE
+#define NRFX_TIMER_DEFAULT_CONFIG_MODE 0
 #endif
 
-// <o> NRFX_PDM_CONFIG_CLOCK_FREQ  - Clock frequency
+// <o> NRFX_TIMER_DEFAULT_CONFIG_BIT_WIDTH  - Timer counter bit width
  
-// <134217728=> 1000k 
-// <138412032=> 1032k (default) 
-// <142606336=> 1067k 
+// <0=> 16 bit 
+// <1=> 8 bit 
+// <2=> 24 bit 
+// <3=> 32 bit 
 
-#ifndef NRFX_PDM_CONFIG_CLOCK_FREQ
-#define NRFX_PDM_CONFIG_CLOCK_FREQ 138412032
+#ifndef NRFX_TIMER_DEFAULT_CONFIG_BIT_WIDTH
+#define NRFX_TIMER_DEFAULT_CONFIG_BIT_WIDTH 0
 #endif
 
-// <o> NRFX_PDM_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 // <0=> 0 (highest) 
 // <1=> 1 
@@ -2580,16 +5379,16 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_PDM_CONFIG_IRQ_PRIORITY
-#define NRFX_PDM_CONFIG_IRQ_PRIORITY 2
+#ifndef NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_PDM_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> NRFX_TIMER_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRFX_PDM_CONFIG_LOG_ENABLED
-#define NRFX_PDM_CONFIG_LOG_ENABLED 0
+#ifndef NRFX_TIMER_CONFIG_LOG_ENABLED
+#define NRFX_TIMER_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRFX_PDM_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRFX_TIMER_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -2597,11 +5396,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRFX_PDM_CONFIG_LOG_LEVEL
-#define NRFX_PDM_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_TIMER_CONFIG_LOG_LEVEL
+#define NRFX_TIMER_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_PDM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> NRFX_TIMER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2613,11 +5412,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_PDM_CONFIG_INFO_COLOR
-#define NRFX_PDM_CONFIG_INFO_COLOR 0
+#ifndef NRFX_TIMER_CONFIG_INFO_COLOR
+#define NRFX_TIMER_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_PDM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRFX_TIMER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2629,65 +5428,71 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_PDM_CONFIG_DEBUG_COLOR
-#define NRFX_PDM_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_TIMER_CONFIG_DEBUG_COLOR
+#define NRFX_TIMER_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
 // </e>
 
-// <e> NRFX_POWER_ENABLED - nrfx_power - POWER peripheral driver
+// <e> NRFX_TWIM_ENABLED - nrfx_twim - TWIM peripheral driver
 //==========================================================
-#ifndef NRFX_POWER_ENABLED
-#define NRFX_POWER_ENABLED 0
+#ifndef NRFX_TWIM_ENABLED
+#define NRFX_TWIM_ENABLED 0
 #endif
-// <o> NRFX_POWER_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> NRFX_TWIM0_ENABLED  - Enable TWIM0 instance
  
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef NRFX_POWER_CONFIG_IRQ_PRIORITY
-#define NRFX_POWER_CONFIG_IRQ_PRIORITY 2
+#ifndef NRFX_TWIM0_ENABLED
+#define NRFX_TWIM0_ENABLED 0
 #endif
 
-// <q> NRFX_POWER_CONFIG_DEFAULT_DCDCEN  - The default configuration of main DCDC regulator
+// <q> NRFX_TWIM1_ENABLED  - Enable TWIM1 instance
  
 
-// <i> This settings means only that components for DCDC regulator are installed and it can be enabled.
-
-#ifndef NRFX_POWER_CONFIG_DEFAULT_DCDCEN
-#define NRFX_POWER_CONFIG_DEFAULT_DCDCEN 0
+#ifndef NRFX_TWIM1_ENABLED
+#define NRFX_TWIM1_ENABLED 0
 #endif
 
-// <q> NRFX_POWER_CONFIG_DEFAULT_DCDCENHV  - The default configuration of High Voltage DCDC regulator
+// <o> NRFX_TWIM_DEFAULT_CONFIG_FREQUENCY  - Frequency
  
+// <26738688=> 100k 
+// <67108864=> 250k 
+// <104857600=> 400k 
 
-// <i> This settings means only that components for DCDC regulator are installed and it can be enabled.
+#ifndef NRFX_TWIM_DEFAULT_CONFIG_FREQUENCY
+#define NRFX_TWIM_DEFAULT_CONFIG_FREQUENCY 26738688
+#endif
 
-#ifndef NRFX_POWER_CONFIG_DEFAULT_DCDCENHV
-#define NRFX_POWER_CONFIG_DEFAULT_DCDCENHV 0
+// <q> NRFX_TWIM_DEFAULT_CONFIG_HOLD_BUS_UNINIT  - Enables bus holding after uninit
+ 
+
+#ifndef NRFX_TWIM_DEFAULT_CONFIG_HOLD_BUS_UNINIT
+#define NRFX_TWIM_DEFAULT_CONFIG_HOLD_BUS_UNINIT 0
 #endif
 
-// </e>
+// <o> NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
 
-// <e> NRFX_PPI_ENABLED - nrfx_ppi - PPI peripheral allocator
-//==========================================================
-#ifndef NRFX_PPI_ENABLED
-#define NRFX_PPI_ENABLED 1
+#ifndef NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
-// <e> NRFX_PPI_CONFIG_LOG_ENABLED - Enables logging in the module.
+
+// <e> NRFX_TWIM_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRFX_PPI_CONFIG_LOG_ENABLED
-#define NRFX_PPI_CONFIG_LOG_ENABLED 0
+#ifndef NRFX_TWIM_CONFIG_LOG_ENABLED
+#define NRFX_TWIM_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRFX_PPI_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRFX_TWIM_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -2695,11 +5500,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRFX_PPI_CONFIG_LOG_LEVEL
-#define NRFX_PPI_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_TWIM_CONFIG_LOG_LEVEL
+#define NRFX_TWIM_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_PPI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> NRFX_TWIM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2711,11 +5516,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_PPI_CONFIG_INFO_COLOR
-#define NRFX_PPI_CONFIG_INFO_COLOR 0
+#ifndef NRFX_TWIM_CONFIG_INFO_COLOR
+#define NRFX_TWIM_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_PPI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRFX_TWIM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2727,60 +5532,102 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_PPI_CONFIG_DEBUG_COLOR
-#define NRFX_PPI_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_TWIM_CONFIG_DEBUG_COLOR
+#define NRFX_TWIM_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
 // </e>
 
-// <e> NRFX_PRS_ENABLED - nrfx_prs - Peripheral Resource Sharing module
+// <e> NRFX_TWIS_ENABLED - nrfx_twis - TWIS peripheral driver
 //==========================================================
-#ifndef NRFX_PRS_ENABLED
-#define NRFX_PRS_ENABLED 1
+#ifndef NRFX_TWIS_ENABLED
+#define NRFX_TWIS_ENABLED 0
 #endif
-// <q> NRFX_PRS_BOX_0_ENABLED  - Enables box 0 in the module.
+// <q> NRFX_TWIS0_ENABLED  - Enable TWIS0 instance
  
 
-#ifndef NRFX_PRS_BOX_0_ENABLED
-#define NRFX_PRS_BOX_0_ENABLED 0
+#ifndef NRFX_TWIS0_ENABLED
+#define NRFX_TWIS0_ENABLED 0
 #endif
 
-// <q> NRFX_PRS_BOX_1_ENABLED  - Enables box 1 in the module.
+// <q> NRFX_TWIS1_ENABLED  - Enable TWIS1 instance
  
 
-#ifndef NRFX_PRS_BOX_1_ENABLED
-#define NRFX_PRS_BOX_1_ENABLED 0
+#ifndef NRFX_TWIS1_ENABLED
+#define NRFX_TWIS1_ENABLED 0
 #endif
 
-// <q> NRFX_PRS_BOX_2_ENABLED  - Enables box 2 in the module.
+// <q> NRFX_TWIS_ASSUME_INIT_AFTER_RESET_ONLY  - Assume that any instance would be initialized only once
  
 
-#ifndef NRFX_PRS_BOX_2_ENABLED
-#define NRFX_PRS_BOX_2_ENABLED 0
+// <i> Optimization flag. Registers used by TWIS are shared by other peripherals. Normally, during initialization driver tries to clear all registers to known state before doing the initialization itself. This gives initialization safe procedure, no matter when it would be called. If you activate TWIS only once and do never uninitialize it - set this flag to 1 what gives more optimal code.
+
+#ifndef NRFX_TWIS_ASSUME_INIT_AFTER_RESET_ONLY
+#define NRFX_TWIS_ASSUME_INIT_AFTER_RESET_ONLY 0
 #endif
 
-// <q> NRFX_PRS_BOX_3_ENABLED  - Enables box 3 in the module.
+// <q> NRFX_TWIS_NO_SYNC_MODE  - Remove support for synchronous mode
  
 
-#ifndef NRFX_PRS_BOX_3_ENABLED
-#define NRFX_PRS_BOX_3_ENABLED 0
+// <i> Synchronous mode would be used in specific situations. And it uses some additional code and data memory to safely process state machine by polling it in status functions. If this functionality is not required it may be disabled to free some resources.
+
+#ifndef NRFX_TWIS_NO_SYNC_MODE
+#define NRFX_TWIS_NO_SYNC_MODE 0
 #endif
 
-// <q> NRFX_PRS_BOX_4_ENABLED  - Enables box 4 in the module.
+// <o> NRFX_TWIS_DEFAULT_CONFIG_ADDR0 - Address0 
+#ifndef NRFX_TWIS_DEFAULT_CONFIG_ADDR0
+#define NRFX_TWIS_DEFAULT_CONFIG_ADDR0 0
+#endif
+
+// <o> NRFX_TWIS_DEFAULT_CONFIG_ADDR1 - Address1 
+#ifndef NRFX_TWIS_DEFAULT_CONFIG_ADDR1
+#define NRFX_TWIS_DEFAULT_CONFIG_ADDR1 0
+#endif
+
+// <o> NRFX_TWIS_DEFAULT_CONFIG_SCL_PULL  - SCL pin pull configuration
+ 
+// <0=> Disabled 
+// <1=> Pull down 
+// <3=> Pull up 
+
+#ifndef NRFX_TWIS_DEFAULT_CONFIG_SCL_PULL
+#define NRFX_TWIS_DEFAULT_CONFIG_SCL_PULL 0
+#endif
+
+// <o> NRFX_TWIS_DEFAULT_CONFIG_SDA_PULL  - SDA pin pull configuration
  
+// <0=> Disabled 
+// <1=> Pull down 
+// <3=> Pull up 
 
-#ifndef NRFX_PRS_BOX_4_ENABLED
-#define NRFX_PRS_BOX_4_ENABLED 1
+#ifndef NRFX_TWIS_DEFAULT_CONFIG_SDA_PULL
+#define NRFX_TWIS_DEFAULT_CONFIG_SDA_PULL 0
 #endif
 
-// <e> NRFX_PRS_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <o> NRFX_TWIS_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRFX_TWIS_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_TWIS_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#endif
+
+// <e> NRFX_TWIS_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRFX_PRS_CONFIG_LOG_ENABLED
-#define NRFX_PRS_CONFIG_LOG_ENABLED 0
+#ifndef NRFX_TWIS_CONFIG_LOG_ENABLED
+#define NRFX_TWIS_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRFX_PRS_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRFX_TWIS_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -2788,11 +5635,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRFX_PRS_CONFIG_LOG_LEVEL
-#define NRFX_PRS_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_TWIS_CONFIG_LOG_LEVEL
+#define NRFX_TWIS_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_PRS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> NRFX_TWIS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2804,11 +5651,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_PRS_CONFIG_INFO_COLOR
-#define NRFX_PRS_CONFIG_INFO_COLOR 0
+#ifndef NRFX_TWIS_CONFIG_INFO_COLOR
+#define NRFX_TWIS_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_PRS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRFX_TWIS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2820,125 +5667,177 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_PRS_CONFIG_DEBUG_COLOR
-#define NRFX_PRS_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_TWIS_CONFIG_DEBUG_COLOR
+#define NRFX_TWIS_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
 // </e>
 
-// <e> NRFX_PWM_ENABLED - nrfx_pwm - PWM peripheral driver
+// <e> NRFX_TWI_ENABLED - nrfx_twi - TWI peripheral driver
 //==========================================================
-#ifndef NRFX_PWM_ENABLED
-#define NRFX_PWM_ENABLED 0
+#ifndef NRFX_TWI_ENABLED
+#define NRFX_TWI_ENABLED 0
 #endif
-// <q> NRFX_PWM0_ENABLED  - Enable PWM0 instance
+// <q> NRFX_TWI0_ENABLED  - Enable TWI0 instance
  
 
-#ifndef NRFX_PWM0_ENABLED
-#define NRFX_PWM0_ENABLED 0
+#ifndef NRFX_TWI0_ENABLED
+#define NRFX_TWI0_ENABLED 0
 #endif
 
-// <q> NRFX_PWM1_ENABLED  - Enable PWM1 instance
+// <q> NRFX_TWI1_ENABLED  - Enable TWI1 instance
  
 
-#ifndef NRFX_PWM1_ENABLED
-#define NRFX_PWM1_ENABLED 0
+#ifndef NRFX_TWI1_ENABLED
+#define NRFX_TWI1_ENABLED 0
 #endif
 
-// <q> NRFX_PWM2_ENABLED  - Enable PWM2 instance
+// <o> NRFX_TWI_DEFAULT_CONFIG_FREQUENCY  - Frequency
  
+// <26738688=> 100k 
+// <67108864=> 250k 
+// <104857600=> 400k 
 
-#ifndef NRFX_PWM2_ENABLED
-#define NRFX_PWM2_ENABLED 0
+#ifndef NRFX_TWI_DEFAULT_CONFIG_FREQUENCY
+#define NRFX_TWI_DEFAULT_CONFIG_FREQUENCY 26738688
 #endif
 
-// <q> NRFX_PWM3_ENABLED  - Enable PWM3 instance
+// <q> NRFX_TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT  - Enables bus holding after uninit
  
 
-#ifndef NRFX_PWM3_ENABLED
-#define NRFX_PWM3_ENABLED 0
+#ifndef NRFX_TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT
+#define NRFX_TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT 0
 #endif
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_OUT0_PIN - Out0 pin  <0-31> 
+// <o> NRFX_TWI_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+ 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
 
+#ifndef NRFX_TWI_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_TWI_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#endif
 
-#ifndef NRFX_PWM_DEFAULT_CONFIG_OUT0_PIN
-#define NRFX_PWM_DEFAULT_CONFIG_OUT0_PIN 31
+// <e> NRFX_TWI_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_TWI_CONFIG_LOG_ENABLED
+#define NRFX_TWI_CONFIG_LOG_ENABLED 0
 #endif
+// <o> NRFX_TWI_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_OUT1_PIN - Out1 pin  <0-31> 
+#ifndef NRFX_TWI_CONFIG_LOG_LEVEL
+#define NRFX_TWI_CONFIG_LOG_LEVEL 3
+#endif
 
+// <o> NRFX_TWI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRFX_PWM_DEFAULT_CONFIG_OUT1_PIN
-#define NRFX_PWM_DEFAULT_CONFIG_OUT1_PIN 31
+#ifndef NRFX_TWI_CONFIG_INFO_COLOR
+#define NRFX_TWI_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_OUT2_PIN - Out2 pin  <0-31> 
-
+// <o> NRFX_TWI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRFX_PWM_DEFAULT_CONFIG_OUT2_PIN
-#define NRFX_PWM_DEFAULT_CONFIG_OUT2_PIN 31
+#ifndef NRFX_TWI_CONFIG_DEBUG_COLOR
+#define NRFX_TWI_CONFIG_DEBUG_COLOR 0
 #endif
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_OUT3_PIN - Out3 pin  <0-31> 
+// </e>
 
+// </e>
 
-#ifndef NRFX_PWM_DEFAULT_CONFIG_OUT3_PIN
-#define NRFX_PWM_DEFAULT_CONFIG_OUT3_PIN 31
+// <e> NRFX_UARTE_ENABLED - nrfx_uarte - UARTE peripheral driver
+//==========================================================
+#ifndef NRFX_UARTE_ENABLED
+#define NRFX_UARTE_ENABLED 1
+#endif
+// <o> NRFX_UARTE0_ENABLED - Enable UARTE0 instance 
+#ifndef NRFX_UARTE0_ENABLED
+#define NRFX_UARTE0_ENABLED 0
 #endif
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_BASE_CLOCK  - Base clock
- 
-// <0=> 16 MHz 
-// <1=> 8 MHz 
-// <2=> 4 MHz 
-// <3=> 2 MHz 
-// <4=> 1 MHz 
-// <5=> 500 kHz 
-// <6=> 250 kHz 
-// <7=> 125 kHz 
-
-#ifndef NRFX_PWM_DEFAULT_CONFIG_BASE_CLOCK
-#define NRFX_PWM_DEFAULT_CONFIG_BASE_CLOCK 4
+// <o> NRFX_UARTE1_ENABLED - Enable UARTE1 instance 
+#ifndef NRFX_UARTE1_ENABLED
+#define NRFX_UARTE1_ENABLED 0
 #endif
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_COUNT_MODE  - Count mode
+// <o> NRFX_UARTE_DEFAULT_CONFIG_HWFC  - Hardware Flow Control
  
-// <0=> Up 
-// <1=> Up and Down 
-
-#ifndef NRFX_PWM_DEFAULT_CONFIG_COUNT_MODE
-#define NRFX_PWM_DEFAULT_CONFIG_COUNT_MODE 0
-#endif
+// <0=> Disabled 
+// <1=> Enabled 
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_TOP_VALUE - Top value 
-#ifndef NRFX_PWM_DEFAULT_CONFIG_TOP_VALUE
-#define NRFX_PWM_DEFAULT_CONFIG_TOP_VALUE 1000
+#ifndef NRFX_UARTE_DEFAULT_CONFIG_HWFC
+#define NRFX_UARTE_DEFAULT_CONFIG_HWFC 0
 #endif
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_LOAD_MODE  - Load mode
+// <o> NRFX_UARTE_DEFAULT_CONFIG_PARITY  - Parity
  
-// <0=> Common 
-// <1=> Grouped 
-// <2=> Individual 
-// <3=> Waveform 
+// <0=> Excluded 
+// <14=> Included 
 
-#ifndef NRFX_PWM_DEFAULT_CONFIG_LOAD_MODE
-#define NRFX_PWM_DEFAULT_CONFIG_LOAD_MODE 0
+#ifndef NRFX_UARTE_DEFAULT_CONFIG_PARITY
+#define NRFX_UARTE_DEFAULT_CONFIG_PARITY 0
 #endif
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_STEP_MODE  - Step mode
+// <o> NRFX_UARTE_DEFAULT_CONFIG_BAUDRATE  - Default Baudrate
  
-// <0=> Auto 
-// <1=> Triggered 
+// <323584=> 1200 baud 
+// <643072=> 2400 baud 
+// <1290240=> 4800 baud 
+// <2576384=> 9600 baud 
+// <3862528=> 14400 baud 
+// <5152768=> 19200 baud 
+// <7716864=> 28800 baud 
+// <8388608=> 31250 baud 
+// <10289152=> 38400 baud 
+// <15007744=> 56000 baud 
+// <15400960=> 57600 baud 
+// <20615168=> 76800 baud 
+// <30801920=> 115200 baud 
+// <61865984=> 230400 baud 
+// <67108864=> 250000 baud 
+// <121634816=> 460800 baud 
+// <251658240=> 921600 baud 
+// <268435456=> 1000000 baud 
 
-#ifndef NRFX_PWM_DEFAULT_CONFIG_STEP_MODE
-#define NRFX_PWM_DEFAULT_CONFIG_STEP_MODE 0
+#ifndef NRFX_UARTE_DEFAULT_CONFIG_BAUDRATE
+#define NRFX_UARTE_DEFAULT_CONFIG_BAUDRATE 30801920
 #endif
 
-// <o> NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> NRFX_UARTE_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 // <0=> 0 (highest) 
 // <1=> 1 
@@ -2949,16 +5848,36 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef NRFX_UARTE_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_UARTE_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_PWM_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <q> NRFX_UARTE_CONFIG_RX_CONT_ENABLED  - Enable continuous reception.
+ 
+
+// <i> Adds nrfx_uarte_rx_cont_start(), which receives into a ring buffer without gaps,
+// <i> counting bytes and detecting an idle line with two TIMER instances and PPI.
+
+#ifndef NRFX_UARTE_CONFIG_RX_CONT_ENABLED
+#define NRFX_UARTE_CONFIG_RX_CONT_ENABLED 0
+#endif
+
+// <q> NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED  - Enable the transmission descriptor queue.
+ 
+
+// <i> Adds nrfx_uarte_tx_queue(), which sends scatter-gather descriptors back to back,
+// <i> starting the next buffer from the ENDTX interrupt without stopping the transmitter.
+
+#ifndef NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED
+#define NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED 0
+#endif
+
+// <e> NRFX_UARTE_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRFX_PWM_CONFIG_LOG_ENABLED
-#define NRFX_PWM_CONFIG_LOG_ENABLED 0
+#ifndef NRFX_UARTE_CONFIG_LOG_ENABLED
+#define NRFX_UARTE_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRFX_PWM_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRFX_UARTE_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -2966,11 +5885,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRFX_PWM_CONFIG_LOG_LEVEL
-#define NRFX_PWM_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_UARTE_CONFIG_LOG_LEVEL
+#define NRFX_UARTE_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_PWM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> NRFX_UARTE_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2982,11 +5901,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_PWM_CONFIG_INFO_COLOR
-#define NRFX_PWM_CONFIG_INFO_COLOR 0
+#ifndef NRFX_UARTE_CONFIG_INFO_COLOR
+#define NRFX_UARTE_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_PWM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRFX_UARTE_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -2998,99 +5917,68 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_PWM_CONFIG_DEBUG_COLOR
-#define NRFX_PWM_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_UARTE_CONFIG_DEBUG_COLOR
+#define NRFX_UARTE_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
 // </e>
 
-// <e> NRFX_QDEC_ENABLED - nrfx_qdec - QDEC peripheral driver
+// <e> NRFX_UART_ENABLED - nrfx_uart - UART peripheral driver
 //==========================================================
-#ifndef NRFX_QDEC_ENABLED
-#define NRFX_QDEC_ENABLED 0
-#endif
-// <o> NRFX_QDEC_CONFIG_REPORTPER  - Report period
- 
-// <0=> 10 Samples 
-// <1=> 40 Samples 
-// <2=> 80 Samples 
-// <3=> 120 Samples 
-// <4=> 160 Samples 
-// <5=> 200 Samples 
-// <6=> 240 Samples 
-// <7=> 280 Samples 
-
-#ifndef NRFX_QDEC_CONFIG_REPORTPER
-#define NRFX_QDEC_CONFIG_REPORTPER 0
-#endif
-
-// <o> NRFX_QDEC_CONFIG_SAMPLEPER  - Sample period
- 
-// <0=> 128 us 
-// <1=> 256 us 
-// <2=> 512 us 
-// <3=> 1024 us 
-// <4=> 2048 us 
-// <5=> 4096 us 
-// <6=> 8192 us 
-// <7=> 16384 us 
-
-#ifndef NRFX_QDEC_CONFIG_SAMPLEPER
-#define NRFX_QDEC_CONFIG_SAMPLEPER 7
-#endif
-
-// <o> NRFX_QDEC_CONFIG_PIO_A - A pin  <0-31> 
-
-
-#ifndef NRFX_QDEC_CONFIG_PIO_A
-#define NRFX_QDEC_CONFIG_PIO_A 31
-#endif
-
-// <o> NRFX_QDEC_CONFIG_PIO_B - B pin  <0-31> 
-
-
-#ifndef NRFX_QDEC_CONFIG_PIO_B
-#define NRFX_QDEC_CONFIG_PIO_B 31
-#endif
-
-// <o> NRFX_QDEC_CONFIG_PIO_LED - LED pin  <0-31> 
-
-
-#ifndef NRFX_QDEC_CONFIG_PIO_LED
-#define NRFX_QDEC_CONFIG_PIO_LED 31
+#ifndef NRFX_UART_ENABLED
+#define NRFX_UART_ENABLED 1
 #endif
-
-// <o> NRFX_QDEC_CONFIG_LEDPRE - LED pre 
-#ifndef NRFX_QDEC_CONFIG_LEDPRE
-#define NRFX_QDEC_CONFIG_LEDPRE 511
+// <o> NRFX_UART0_ENABLED - Enable UART0 instance 
+#ifndef NRFX_UART0_ENABLED
+#define NRFX_UART0_ENABLED 0
 #endif
 
-// <o> NRFX_QDEC_CONFIG_LEDPOL  - LED polarity
+// <o> NRFX_UART_DEFAULT_CONFIG_HWFC  - Hardware Flow Control
  
-// <0=> Active low 
-// <1=> Active high 
+// <0=> Disabled 
+// <1=> Enabled 
 
-#ifndef NRFX_QDEC_CONFIG_LEDPOL
-#define NRFX_QDEC_CONFIG_LEDPOL 1
+#ifndef NRFX_UART_DEFAULT_CONFIG_HWFC
+#define NRFX_UART_DEFAULT_CONFIG_HWFC 0
 #endif
 
-// <q> NRFX_QDEC_CONFIG_DBFEN  - Debouncing enable
+// <o> NRFX_UART_DEFAULT_CONFIG_PARITY  - Parity
  
+// <0=> Excluded 
+// <14=> Included 
 
-#ifndef NRFX_QDEC_CONFIG_DBFEN
-#define NRFX_QDEC_CONFIG_DBFEN 0
+#ifndef NRFX_UART_DEFAULT_CONFIG_PARITY
+#define NRFX_UART_DEFAULT_CONFIG_PARITY 0
 #endif
 
-// <q> NRFX_QDEC_CONFIG_SAMPLE_INTEN  - Sample ready interrupt enable
+// <o> NRFX_UART_DEFAULT_CONFIG_BAUDRATE  - Default Baudrate
  
+// <323584=> 1200 baud 
+// <643072=> 2400 baud 
+// <1290240=> 4800 baud 
+// <2576384=> 9600 baud 
+// <3866624=> 14400 baud 
+// <5152768=> 19200 baud 
+// <7729152=> 28800 baud 
+// <8388608=> 31250 baud 
+// <10309632=> 38400 baud 
+// <15007744=> 56000 baud 
+// <15462400=> 57600 baud 
+// <20615168=> 76800 baud 
+// <30924800=> 115200 baud 
+// <61845504=> 230400 baud 
+// <67108864=> 250000 baud 
+// <123695104=> 460800 baud 
+// <247386112=> 921600 baud 
+// <268435456=> 1000000 baud 
 
-#ifndef NRFX_QDEC_CONFIG_SAMPLE_INTEN
-#define NRFX_QDEC_CONFIG_SAMPLE_INTEN 0
+#ifndef NRFX_UART_DEFAULT_CONFIG_BAUDRATE
+#define NRFX_UART_DEFAULT_CONFIG_BAUDRATE 30924800
 #endif
 
-// <o> NRFX_QDEC_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> NRFX_UART_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 // <0=> 0 (highest) 
 // <1=> 1 
@@ -3101,16 +5989,16 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_QDEC_CONFIG_IRQ_PRIORITY
-#define NRFX_QDEC_CONFIG_IRQ_PRIORITY 2
+#ifndef NRFX_UART_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_UART_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_QDEC_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> NRFX_UART_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRFX_QDEC_CONFIG_LOG_ENABLED
-#define NRFX_QDEC_CONFIG_LOG_ENABLED 0
+#ifndef NRFX_UART_CONFIG_LOG_ENABLED
+#define NRFX_UART_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRFX_QDEC_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRFX_UART_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -3118,11 +6006,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRFX_QDEC_CONFIG_LOG_LEVEL
-#define NRFX_QDEC_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_UART_CONFIG_LOG_LEVEL
+#define NRFX_UART_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_QDEC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> NRFX_UART_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -3134,11 +6022,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_QDEC_CONFIG_INFO_COLOR
-#define NRFX_QDEC_CONFIG_INFO_COLOR 0
+#ifndef NRFX_UART_CONFIG_INFO_COLOR
+#define NRFX_UART_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_QDEC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRFX_UART_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -3150,155 +6038,112 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_QDEC_CONFIG_DEBUG_COLOR
-#define NRFX_QDEC_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_UART_CONFIG_DEBUG_COLOR
+#define NRFX_UART_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
 // </e>
 
-// <e> NRFX_QSPI_ENABLED - nrfx_qspi - QSPI peripheral driver
+// <e> NRFX_USBD_ENABLED - nrfx_usbd - USBD peripheral driver
 //==========================================================
-#ifndef NRFX_QSPI_ENABLED
-#define NRFX_QSPI_ENABLED 0
-#endif
-// <o> NRFX_QSPI_CONFIG_SCK_DELAY - tSHSL, tWHSL and tSHWL in number of 16 MHz periods (62.5 ns).  <0-255> 
-
-
-#ifndef NRFX_QSPI_CONFIG_SCK_DELAY
-#define NRFX_QSPI_CONFIG_SCK_DELAY 1
-#endif
-
-// <o> NRFX_QSPI_CONFIG_XIP_OFFSET - Address offset in the external memory for Execute in Place operation. 
-#ifndef NRFX_QSPI_CONFIG_XIP_OFFSET
-#define NRFX_QSPI_CONFIG_XIP_OFFSET 0
-#endif
-
-// <o> NRFX_QSPI_CONFIG_READOC  - Number of data lines and opcode used for reading.
- 
-// <0=> FastRead 
-// <1=> Read2O 
-// <2=> Read2IO 
-// <3=> Read4O 
-// <4=> Read4IO 
-
-#ifndef NRFX_QSPI_CONFIG_READOC
-#define NRFX_QSPI_CONFIG_READOC 0
+#ifndef NRFX_USBD_ENABLED
+#define NRFX_USBD_ENABLED 0
 #endif
-
-// <o> NRFX_QSPI_CONFIG_WRITEOC  - Number of data lines and opcode used for writing.
+// <o> NRFX_USBD_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
-// <0=> PP 
-// <1=> PP2O 
-// <2=> PP4O 
-// <3=> PP4IO 
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
 
-#ifndef NRFX_QSPI_CONFIG_WRITEOC
-#define NRFX_QSPI_CONFIG_WRITEOC 0
+#ifndef NRFX_USBD_CONFIG_IRQ_PRIORITY
+#define NRFX_USBD_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <o> NRFX_QSPI_CONFIG_ADDRMODE  - Addressing mode.
+// <o> NRFX_USBD_CONFIG_DMASCHEDULER_MODE  - USBD DMA scheduler working scheme
  
-// <0=> 24bit 
-// <1=> 32bit 
+// <0=> Prioritized access 
+// <1=> Round Robin 
 
-#ifndef NRFX_QSPI_CONFIG_ADDRMODE
-#define NRFX_QSPI_CONFIG_ADDRMODE 0
+#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_MODE
+#define NRFX_USBD_CONFIG_DMASCHEDULER_MODE 0
 #endif
 
-// <o> NRFX_QSPI_CONFIG_MODE  - SPI mode.
+// <q> NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST  - Give priority to isochronous transfers
  
-// <0=> Mode 0 
-// <1=> Mode 1 
 
-#ifndef NRFX_QSPI_CONFIG_MODE
-#define NRFX_QSPI_CONFIG_MODE 0
+// <i> This option gives priority to isochronous transfers.
+// <i> Enabling it assures that isochronous transfers are always processed,
+// <i> even if multiple other transfers are pending.
+// <i> Isochronous endpoints are prioritized before the usbd_dma_scheduler_algorithm
+// <i> function is called, so the option is independent of the algorithm chosen.
+
+#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST
+#define NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST 1
 #endif
 
-// <o> NRFX_QSPI_CONFIG_FREQUENCY  - Frequency divider.
+// <q> NRFX_USBD_CONFIG_ISO_IN_ZLP  - Respond to an IN token on ISO IN endpoint with ZLP when no data is ready
  
-// <0=> 32MHz/1 
-// <1=> 32MHz/2 
-// <2=> 32MHz/3 
-// <3=> 32MHz/4 
-// <4=> 32MHz/5 
-// <5=> 32MHz/6 
-// <6=> 32MHz/7 
-// <7=> 32MHz/8 
-// <8=> 32MHz/9 
-// <9=> 32MHz/10 
-// <10=> 32MHz/11 
-// <11=> 32MHz/12 
-// <12=> 32MHz/13 
-// <13=> 32MHz/14 
-// <14=> 32MHz/15 
-// <15=> 32MHz/16 
 
-#ifndef NRFX_QSPI_CONFIG_FREQUENCY
-#define NRFX_QSPI_CONFIG_FREQUENCY 15
-#endif
+// <i> If set, ISO IN endpoint will respond to an IN token with ZLP when no data is ready to be sent.
+// <i> Else, there will be no response.
 
-// <s> NRFX_QSPI_PIN_SCK - SCK pin value.
-#ifndef NRFX_QSPI_PIN_SCK
-#define NRFX_QSPI_PIN_SCK NRF_QSPI_PIN_NOT_CONNECTED
+#ifndef NRFX_USBD_CONFIG_ISO_IN_ZLP
+#define NRFX_USBD_CONFIG_ISO_IN_ZLP 0
 #endif
 
-// <s> NRFX_QSPI_PIN_CSN - CSN pin value.
-#ifndef NRFX_QSPI_PIN_CSN
-#define NRFX_QSPI_PIN_CSN NRF_QSPI_PIN_NOT_CONNECTED
-#endif
+// <q> NRFX_USBD_USE_WORKAROUND_FOR_ANOMALY_211  - Use workaround for anomaly 211
+ 
 
-// <s> NRFX_QSPI_PIN_IO0 - IO0 pin value.
-#ifndef NRFX_QSPI_PIN_IO0
-#define NRFX_QSPI_PIN_IO0 NRF_QSPI_PIN_NOT_CONNECTED
-#endif
+// <i> If set, workaround for anomaly 211 will be enabled.
+// <i> Anomaly 211 - Device remains in SUSPEND too long when host resumes
+// <i> bus activity (sending SOF packets) without a RESUME condition.
 
-// <s> NRFX_QSPI_PIN_IO1 - IO1 pin value.
-#ifndef NRFX_QSPI_PIN_IO1
-#define NRFX_QSPI_PIN_IO1 NRF_QSPI_PIN_NOT_CONNECTED
+#ifndef NRFX_USBD_USE_WORKAROUND_FOR_ANOMALY_211
+#define NRFX_USBD_USE_WORKAROUND_FOR_ANOMALY_211 0
 #endif
 
-// <s> NRFX_QSPI_PIN_IO2 - IO2 pin value.
-#ifndef NRFX_QSPI_PIN_IO2
-#define NRFX_QSPI_PIN_IO2 NRF_QSPI_PIN_NOT_CONNECTED
-#endif
+// </e>
 
-// <s> NRFX_QSPI_PIN_IO3 - IO3 pin value.
-#ifndef NRFX_QSPI_PIN_IO3
-#define NRFX_QSPI_PIN_IO3 NRF_QSPI_PIN_NOT_CONNECTED
+// <e> NRFX_WDT_ENABLED - nrfx_wdt - WDT peripheral driver
+//==========================================================
+#ifndef NRFX_WDT_ENABLED
+#define NRFX_WDT_ENABLED 0
 #endif
-
-// <o> NRFX_QSPI_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> NRFX_WDT_CONFIG_BEHAVIOUR  - WDT behavior in CPU SLEEP or HALT mode
  
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+// <1=> Run in SLEEP, Pause in HALT 
+// <8=> Pause in SLEEP, Run in HALT 
+// <9=> Run in SLEEP and HALT 
+// <0=> Pause in SLEEP and HALT 
 
-#ifndef NRFX_QSPI_CONFIG_IRQ_PRIORITY
-#define NRFX_QSPI_CONFIG_IRQ_PRIORITY 2
+#ifndef NRFX_WDT_CONFIG_BEHAVIOUR
+#define NRFX_WDT_CONFIG_BEHAVIOUR 1
 #endif
 
-// </e>
+// <o> NRFX_WDT_CONFIG_RELOAD_VALUE - Reload value in ms  <1-131072000> 
 
-// <e> NRFX_RNG_ENABLED - nrfx_rng - RNG peripheral driver
-//==========================================================
-#ifndef NRFX_RNG_ENABLED
-#define NRFX_RNG_ENABLED 0
+
+#ifndef NRFX_WDT_CONFIG_RELOAD_VALUE
+#define NRFX_WDT_CONFIG_RELOAD_VALUE 2000
 #endif
-// <q> NRFX_RNG_CONFIG_ERROR_CORRECTION  - Error correction
+
+// <o> NRFX_WDT_CONFIG_NO_IRQ  - Remove WDT IRQ handling from WDT driver
  
+// <0=> Include WDT IRQ handling 
+// <1=> Remove WDT IRQ handling 
 
-#ifndef NRFX_RNG_CONFIG_ERROR_CORRECTION
-#define NRFX_RNG_CONFIG_ERROR_CORRECTION 1
+#ifndef NRFX_WDT_CONFIG_NO_IRQ
+#define NRFX_WDT_CONFIG_NO_IRQ 0
 #endif
 
-// <o> NRFX_RNG_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> NRFX_WDT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 // <0=> 0 (highest) 
 // <1=> 1 
@@ -3309,16 +6154,16 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_RNG_CONFIG_IRQ_PRIORITY
-#define NRFX_RNG_CONFIG_IRQ_PRIORITY 2
+#ifndef NRFX_WDT_CONFIG_IRQ_PRIORITY
+#define NRFX_WDT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_RNG_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> NRFX_WDT_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRFX_RNG_CONFIG_LOG_ENABLED
-#define NRFX_RNG_CONFIG_LOG_ENABLED 0
+#ifndef NRFX_WDT_CONFIG_LOG_ENABLED
+#define NRFX_WDT_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRFX_RNG_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRFX_WDT_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -3326,11 +6171,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRFX_RNG_CONFIG_LOG_LEVEL
-#define NRFX_RNG_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_WDT_CONFIG_LOG_LEVEL
+#define NRFX_WDT_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_RNG_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> NRFX_WDT_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -3342,11 +6187,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_RNG_CONFIG_INFO_COLOR
-#define NRFX_RNG_CONFIG_INFO_COLOR 0
+#ifndef NRFX_WDT_CONFIG_INFO_COLOR
+#define NRFX_WDT_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_RNG_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRFX_WDT_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -3358,61 +6203,172 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_RNG_CONFIG_DEBUG_COLOR
-#define NRFX_RNG_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_WDT_CONFIG_DEBUG_COLOR
+#define NRFX_WDT_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
 // </e>
 
-// <e> NRFX_RTC_ENABLED - nrfx_rtc - RTC peripheral driver
+// <e> NRF_CLOCK_ENABLED - nrf_drv_clock - CLOCK peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_RTC_ENABLED
-#define NRFX_RTC_ENABLED 1
+#ifndef NRF_CLOCK_ENABLED
+#define NRF_CLOCK_ENABLED 1
 #endif
-// <q> NRFX_RTC0_ENABLED  - Enable RTC0 instance
+// <o> CLOCK_CONFIG_LF_SRC  - LF Clock Source
  
+// <0=> RC 
+// <1=> XTAL 
+// <2=> Synth 
+// <131073=> External Low Swing 
+// <196609=> External Full Swing 
 
-#ifndef NRFX_RTC0_ENABLED
-#define NRFX_RTC0_ENABLED 0
+#ifndef CLOCK_CONFIG_LF_SRC
+#define CLOCK_CONFIG_LF_SRC 1
 #endif
 
-// <q> NRFX_RTC1_ENABLED  - Enable RTC1 instance
+// <q> CLOCK_CONFIG_LF_CAL_ENABLED  - Calibration enable for LF Clock Source
  
 
-#ifndef NRFX_RTC1_ENABLED
-#define NRFX_RTC1_ENABLED 0
+#ifndef CLOCK_CONFIG_LF_CAL_ENABLED
+#define CLOCK_CONFIG_LF_CAL_ENABLED 0
 #endif
 
-// <q> NRFX_RTC2_ENABLED  - Enable RTC2 instance
+// <o> CLOCK_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 
-#ifndef NRFX_RTC2_ENABLED
-#define NRFX_RTC2_ENABLED 0
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef CLOCK_CONFIG_IRQ_PRIORITY
+#define CLOCK_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <o> NRFX_RTC_MAXIMUM_LATENCY_US - Maximum possible time[us] in highest priority interrupt 
-#ifndef NRFX_RTC_MAXIMUM_LATENCY_US
-#define NRFX_RTC_MAXIMUM_LATENCY_US 2000
+// <e> CLOCK_CONFIG_HF_AHEAD_ENABLED - Enable HFCLK requests ahead of a deadline.
+
+// <i> Adds nrf_drv_clock_hf_user_request_ahead(), which starts HFXO with an app_timer so that
+// <i> it is running at a given time, and per requester wait time statistics.
+//==========================================================
+#ifndef CLOCK_CONFIG_HF_AHEAD_ENABLED
+#define CLOCK_CONFIG_HF_AHEAD_ENABLED 0
 #endif
+// <o> CLOCK_CONFIG_HFXO_STARTUP_US - HFXO start-up time in microseconds. 
+// <i> Initial lead time. The driver uses the longest measured start-up if it is longer.
 
-// <o> NRFX_RTC_DEFAULT_CONFIG_FREQUENCY - Frequency  <16-32768> 
+#ifndef CLOCK_CONFIG_HFXO_STARTUP_US
+#define CLOCK_CONFIG_HFXO_STARTUP_US 400
+#endif
 
+// </e>
 
-#ifndef NRFX_RTC_DEFAULT_CONFIG_FREQUENCY
-#define NRFX_RTC_DEFAULT_CONFIG_FREQUENCY 32768
+// <e> CLOCK_CONFIG_LFRC_SCHED_ENABLED - Enable the drift measuring LFRC calibration scheduler.
+
+// <i> Adds nrf_drv_clock_lfrc_start(), which measures the LFRC error against HFXO, calibrates
+// <i> it when the measured drift requires it (without SoftDevice), and reports the sleep clock
+// <i> accuracy proven by the measurements. Requires app_timer and a TIMER instance.
+//==========================================================
+#ifndef CLOCK_CONFIG_LFRC_SCHED_ENABLED
+#define CLOCK_CONFIG_LFRC_SCHED_ENABLED 0
+#endif
+// <o> CLOCK_CONFIG_LFRC_TARGET_PPM - Sleep clock accuracy the scheduler keeps to, in ppm.  <20-500> 
+// <i> Includes CLOCK_CONFIG_LFRC_HFXO_PPM and the measurement resolution. Ignored with SoftDevice.
+
+#ifndef CLOCK_CONFIG_LFRC_TARGET_PPM
+#define CLOCK_CONFIG_LFRC_TARGET_PPM 250
+#endif
+
+// <o> CLOCK_CONFIG_LFRC_HFXO_PPM - Accuracy of the HFXO crystal, in ppm. 
+#ifndef CLOCK_CONFIG_LFRC_HFXO_PPM
+#define CLOCK_CONFIG_LFRC_HFXO_PPM 40
+#endif
+
+// <o> CLOCK_CONFIG_LFRC_MEASURE_MS - Measurement window in milliseconds.  <8-1000> 
+// <i> HFXO runs during the window. The resolution is 125 / window ppm.
+
+#ifndef CLOCK_CONFIG_LFRC_MEASURE_MS
+#define CLOCK_CONFIG_LFRC_MEASURE_MS 32
+#endif
+
+// <o> CLOCK_CONFIG_LFRC_POLL_MS - Temperature reading interval in milliseconds. 
+// <i> Also the shortest time between two measurements.
+
+#ifndef CLOCK_CONFIG_LFRC_POLL_MS
+#define CLOCK_CONFIG_LFRC_POLL_MS 4000
+#endif
+
+// <o> CLOCK_CONFIG_LFRC_MAX_INTERVAL_S - Longest time between two measurements in seconds.  <1-3600> 
+
+#ifndef CLOCK_CONFIG_LFRC_MAX_INTERVAL_S
+#define CLOCK_CONFIG_LFRC_MAX_INTERVAL_S 300
+#endif
+
+// <o> CLOCK_CONFIG_LFRC_TEMP_STEP - Temperature change which starts a measurement, in 0.25 degree units.  <1-40> 
+
+#ifndef CLOCK_CONFIG_LFRC_TEMP_STEP
+#define CLOCK_CONFIG_LFRC_TEMP_STEP 2
+#endif
+
+// <o> CLOCK_CONFIG_LFRC_TIMER_INSTANCE  - TIMER instance used to measure LFCLK against HFXO.
+ 
+// <0=> 0 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+
+#ifndef CLOCK_CONFIG_LFRC_TIMER_INSTANCE
+#define CLOCK_CONFIG_LFRC_TIMER_INSTANCE 4
+#endif
+
+// </e>
+
+// </e>
+
+// <e> PDM_ENABLED - nrf_drv_pdm - PDM peripheral driver - legacy layer
+//==========================================================
+#ifndef PDM_ENABLED
+#define PDM_ENABLED 0
+#endif
+// <o> PDM_CONFIG_MODE  - Mode
+ 
+// <0=> Stereo 
+// <1=> Mono 
+
+#ifndef PDM_CONFIG_MODE
+#define PDM_CONFIG_MODE 1
+#endif
+
+// <o> PDM_CONFIG_EDGE  - Edge
+ 
+// <0=> Left falling 
+// <1=> Left rising 
+
+#ifndef PDM_CONFIG_EDGE
+#define PDM_CONFIG_EDGE 0
 #endif
 
-// <q> NRFX_RTC_DEFAULT_CONFIG_RELIABLE  - Ensures safe compare event triggering
+// <o> PDM_CONFIG_CLOCK_FREQ  - Clock frequency
  
+// <134217728=> 1000k 
+// <138412032=> 1032k (default) 
+// <142606336=> 1067k 
 
-#ifndef NRFX_RTC_DEFAULT_CONFIG_RELIABLE
-#define NRFX_RTC_DEFAULT_CONFIG_RELIABLE 0
+#ifndef PDM_CONFIG_CLOCK_FREQ
+#define PDM_CONFIG_CLOCK_FREQ 138412032
 #endif
 
-// <o> NRFX_RTC_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> PDM_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -3422,315 +6378,278 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_RTC_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_RTC_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef PDM_CONFIG_IRQ_PRIORITY
+#define PDM_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_RTC_CONFIG_LOG_ENABLED - Enables logging in the module.
+// </e>
+
+// <e> POWER_ENABLED - nrf_drv_power - POWER peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_RTC_CONFIG_LOG_ENABLED
-#define NRFX_RTC_CONFIG_LOG_ENABLED 0
+#ifndef POWER_ENABLED
+#define POWER_ENABLED 0
 #endif
-// <o> NRFX_RTC_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> POWER_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_RTC_CONFIG_LOG_LEVEL
-#define NRFX_RTC_CONFIG_LOG_LEVEL 3
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef POWER_CONFIG_IRQ_PRIORITY
+#define POWER_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <o> NRFX_RTC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> POWER_CONFIG_DEFAULT_DCDCEN  - The default configuration of main DCDC regulator
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_RTC_CONFIG_INFO_COLOR
-#define NRFX_RTC_CONFIG_INFO_COLOR 0
+// <i> This settings means only that components for DCDC regulator are installed and it can be enabled.
+
+#ifndef POWER_CONFIG_DEFAULT_DCDCEN
+#define POWER_CONFIG_DEFAULT_DCDCEN 0
 #endif
 
-// <o> NRFX_RTC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> POWER_CONFIG_DEFAULT_DCDCENHV  - The default configuration of High Voltage DCDC regulator
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_RTC_CONFIG_DEBUG_COLOR
-#define NRFX_RTC_CONFIG_DEBUG_COLOR 0
+// <i> This settings means only that components for DCDC regulator are installed and it can be enabled.
+
+#ifndef POWER_CONFIG_DEFAULT_DCDCENHV
+#define POWER_CONFIG_DEFAULT_DCDCENHV 0
 #endif
 
 // </e>
 
-// </e>
-// <e> NRFX_SAADC_ENABLED - nrfx_saadc - SAADC peripheral driver
-//==========================================================
-#ifndef NRFX_SAADC_ENABLED
-#define NRFX_SAADC_ENABLED 1
-#endif
-// <o> NRFX_SAADC_CONFIG_RESOLUTION  - Resolution
+// <q> PPI_ENABLED  - nrf_drv_ppi - PPI peripheral driver - legacy layer
  
-// <0=> 8 bit 
-// <1=> 10 bit 
-// <2=> 12 bit 
-// <3=> 14 bit 
 
-#ifndef NRFX_SAADC_CONFIG_RESOLUTION
-#define NRFX_SAADC_CONFIG_RESOLUTION 1
+#ifndef PPI_ENABLED
+#define PPI_ENABLED 1
 #endif
 
-// <o> NRFX_SAADC_CONFIG_OVERSAMPLE  - Sample period
- 
-// <0=> Disabled 
-// <1=> 2x 
-// <2=> 4x 
-// <3=> 8x 
-// <4=> 16x 
-// <5=> 32x 
-// <6=> 64x 
-// <7=> 128x 
-// <8=> 256x 
-
-#ifndef NRFX_SAADC_CONFIG_OVERSAMPLE
-#define NRFX_SAADC_CONFIG_OVERSAMPLE 0
+// <e> PWM_ENABLED - nrf_drv_pwm - PWM peripheral driver - legacy layer
+//==========================================================
+#ifndef PWM_ENABLED
+#define PWM_ENABLED 0
 #endif
+// <o> PWM_DEFAULT_CONFIG_OUT0_PIN - Out0 pin  <0-31> 
 
-// <q> NRFX_SAADC_CONFIG_LP_MODE  - Enabling low power mode
- 
 
-#ifndef NRFX_SAADC_CONFIG_LP_MODE
-#define NRFX_SAADC_CONFIG_LP_MODE 0
+#ifndef PWM_DEFAULT_CONFIG_OUT0_PIN
+#define PWM_DEFAULT_CONFIG_OUT0_PIN 31
 #endif
 
-// <o> NRFX_SAADC_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+// <o> PWM_DEFAULT_CONFIG_OUT1_PIN - Out1 pin  <0-31> 
 
-#ifndef NRFX_SAADC_CONFIG_IRQ_PRIORITY
-#define NRFX_SAADC_CONFIG_IRQ_PRIORITY 2
-#endif
 
-// <e> NRFX_SAADC_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_SAADC_CONFIG_LOG_ENABLED
-#define NRFX_SAADC_CONFIG_LOG_ENABLED 0
+#ifndef PWM_DEFAULT_CONFIG_OUT1_PIN
+#define PWM_DEFAULT_CONFIG_OUT1_PIN 31
 #endif
-// <o> NRFX_SAADC_CONFIG_LOG_LEVEL  - Default Severity level
- 
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_SAADC_CONFIG_LOG_LEVEL
-#define NRFX_SAADC_CONFIG_LOG_LEVEL 3
+// <o> PWM_DEFAULT_CONFIG_OUT2_PIN - Out2 pin  <0-31> 
+
+
+#ifndef PWM_DEFAULT_CONFIG_OUT2_PIN
+#define PWM_DEFAULT_CONFIG_OUT2_PIN 31
 #endif
 
-// <o> NRFX_SAADC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <o> PWM_DEFAULT_CONFIG_OUT3_PIN - Out3 pin  <0-31> 
 
-#ifndef NRFX_SAADC_CONFIG_INFO_COLOR
-#define NRFX_SAADC_CONFIG_INFO_COLOR 0
+
+#ifndef PWM_DEFAULT_CONFIG_OUT3_PIN
+#define PWM_DEFAULT_CONFIG_OUT3_PIN 31
 #endif
 
-// <o> NRFX_SAADC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> PWM_DEFAULT_CONFIG_BASE_CLOCK  - Base clock
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <0=> 16 MHz 
+// <1=> 8 MHz 
+// <2=> 4 MHz 
+// <3=> 2 MHz 
+// <4=> 1 MHz 
+// <5=> 500 kHz 
+// <6=> 250 kHz 
+// <7=> 125 kHz 
 
-#ifndef NRFX_SAADC_CONFIG_DEBUG_COLOR
-#define NRFX_SAADC_CONFIG_DEBUG_COLOR 0
+#ifndef PWM_DEFAULT_CONFIG_BASE_CLOCK
+#define PWM_DEFAULT_CONFIG_BASE_CLOCK 4
 #endif
 
-// </e>
+// <o> PWM_DEFAULT_CONFIG_COUNT_MODE  - Count mode
+ 
+// <0=> Up 
+// <1=> Up and Down 
 
-// </e>
+#ifndef PWM_DEFAULT_CONFIG_COUNT_MODE
+#define PWM_DEFAULT_CONFIG_COUNT_MODE 0
+#endif
 
-// <e> NRFX_SPIM_ENABLED - nrfx_spim - SPIM peripheral driver
-//==========================================================
-#ifndef NRFX_SPIM_ENABLED
-#define NRFX_SPIM_ENABLED 0
+// <o> PWM_DEFAULT_CONFIG_TOP_VALUE - Top value 
+#ifndef PWM_DEFAULT_CONFIG_TOP_VALUE
+#define PWM_DEFAULT_CONFIG_TOP_VALUE 1000
 #endif
-// <q> NRFX_SPIM0_ENABLED  - Enable SPIM0 instance
+
+// <o> PWM_DEFAULT_CONFIG_LOAD_MODE  - Load mode
  
+// <0=> Common 
+// <1=> Grouped 
+// <2=> Individual 
+// <3=> Waveform 
 
-#ifndef NRFX_SPIM0_ENABLED
-#define NRFX_SPIM0_ENABLED 0
+#ifndef PWM_DEFAULT_CONFIG_LOAD_MODE
+#define PWM_DEFAULT_CONFIG_LOAD_MODE 0
 #endif
 
-// <q> NRFX_SPIM1_ENABLED  - Enable SPIM1 instance
+// <o> PWM_DEFAULT_CONFIG_STEP_MODE  - Step mode
  
+// <0=> Auto 
+// <1=> Triggered 
 
-#ifndef NRFX_SPIM1_ENABLED
-#define NRFX_SPIM1_ENABLED 0
+#ifndef PWM_DEFAULT_CONFIG_STEP_MODE
+#define PWM_DEFAULT_CONFIG_STEP_MODE 0
 #endif
 
-// <q> NRFX_SPIM2_ENABLED  - Enable SPIM2 instance
+// <o> PWM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 
-#ifndef NRFX_SPIM2_ENABLED
-#define NRFX_SPIM2_ENABLED 0
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef PWM_DEFAULT_CONFIG_IRQ_PRIORITY
+#define PWM_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <q> NRFX_SPIM3_ENABLED  - Enable SPIM3 instance
+// <q> PWM0_ENABLED  - Enable PWM0 instance
  
 
-#ifndef NRFX_SPIM3_ENABLED
-#define NRFX_SPIM3_ENABLED 0
+#ifndef PWM0_ENABLED
+#define PWM0_ENABLED 0
 #endif
 
-// <q> NRFX_SPIM_EXTENDED_ENABLED  - Enable extended SPIM features
+// <q> PWM1_ENABLED  - Enable PWM1 instance
  
 
-#ifndef NRFX_SPIM_EXTENDED_ENABLED
-#define NRFX_SPIM_EXTENDED_ENABLED 0
+#ifndef PWM1_ENABLED
+#define PWM1_ENABLED 0
 #endif
 
-// <o> NRFX_SPIM_MISO_PULL_CFG  - MISO pin pull configuration.
+// <q> PWM2_ENABLED  - Enable PWM2 instance
  
-// <0=> NRF_GPIO_PIN_NOPULL 
-// <1=> NRF_GPIO_PIN_PULLDOWN 
-// <3=> NRF_GPIO_PIN_PULLUP 
 
-#ifndef NRFX_SPIM_MISO_PULL_CFG
-#define NRFX_SPIM_MISO_PULL_CFG 1
+#ifndef PWM2_ENABLED
+#define PWM2_ENABLED 0
 #endif
 
-// <o> NRFX_SPIM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> PWM3_ENABLED  - Enable PWM3 instance
  
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef NRFX_SPIM_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_SPIM_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef PWM3_ENABLED
+#define PWM3_ENABLED 0
 #endif
 
-// <e> NRFX_SPIM_CONFIG_LOG_ENABLED - Enables logging in the module.
+// </e>
+
+// <e> QDEC_ENABLED - nrf_drv_qdec - QDEC peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_SPIM_CONFIG_LOG_ENABLED
-#define NRFX_SPIM_CONFIG_LOG_ENABLED 0
+#ifndef QDEC_ENABLED
+#define QDEC_ENABLED 0
 #endif
-// <o> NRFX_SPIM_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> QDEC_CONFIG_REPORTPER  - Report period
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
+// <0=> 10 Samples 
+// <1=> 40 Samples 
+// <2=> 80 Samples 
+// <3=> 120 Samples 
+// <4=> 160 Samples 
+// <5=> 200 Samples 
+// <6=> 240 Samples 
+// <7=> 280 Samples 
 
-#ifndef NRFX_SPIM_CONFIG_LOG_LEVEL
-#define NRFX_SPIM_CONFIG_LOG_LEVEL 3
+#ifndef QDEC_CONFIG_REPORTPER
+#define QDEC_CONFIG_REPORTPER 0
 #endif
 
-// <o> NRFX_SPIM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> QDEC_CONFIG_SAMPLEPER  - Sample period
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <0=> 128 us 
+// <1=> 256 us 
+// <2=> 512 us 
+// <3=> 1024 us 
+// <4=> 2048 us 
+// <5=> 4096 us 
+// <6=> 8192 us 
+// <7=> 16384 us 
 
-#ifndef NRFX_SPIM_CONFIG_INFO_COLOR
-#define NRFX_SPIM_CONFIG_INFO_COLOR 0
+#ifndef QDEC_CONFIG_SAMPLEPER
+#define QDEC_CONFIG_SAMPLEPER 7
 #endif
 
-// <o> NRFX_SPIM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <o> QDEC_CONFIG_PIO_A - A pin  <0-31> 
 
-#ifndef NRFX_SPIM_CONFIG_DEBUG_COLOR
-#define NRFX_SPIM_CONFIG_DEBUG_COLOR 0
+
+#ifndef QDEC_CONFIG_PIO_A
+#define QDEC_CONFIG_PIO_A 31
 #endif
 
-// </e>
+// <o> QDEC_CONFIG_PIO_B - B pin  <0-31> 
 
-// </e>
 
-// <e> NRFX_SPIS_ENABLED - nrfx_spis - SPIS peripheral driver
-//==========================================================
-#ifndef NRFX_SPIS_ENABLED
-#define NRFX_SPIS_ENABLED 0
+#ifndef QDEC_CONFIG_PIO_B
+#define QDEC_CONFIG_PIO_B 31
 #endif
-// <q> NRFX_SPIS0_ENABLED  - Enable SPIS0 instance
+
+// <o> QDEC_CONFIG_PIO_LED - LED pin  <0-31> 
+
+
+#ifndef QDEC_CONFIG_PIO_LED
+#define QDEC_CONFIG_PIO_LED 31
+#endif
+
+// <o> QDEC_CONFIG_LEDPRE - LED pre 
+#ifndef QDEC_CONFIG_LEDPRE
+#define QDEC_CONFIG_LEDPRE 511
+#endif
+
+// <o> QDEC_CONFIG_LEDPOL  - LED polarity
  
+// <0=> Active low 
+// <1=> Active high 
 
-#ifndef NRFX_SPIS0_ENABLED
-#define NRFX_SPIS0_ENABLED 0
+#ifndef QDEC_CONFIG_LEDPOL
+#define QDEC_CONFIG_LEDPOL 1
 #endif
 
-// <q> NRFX_SPIS1_ENABLED  - Enable SPIS1 instance
+// <q> QDEC_CONFIG_DBFEN  - Debouncing enable
  
 
-#ifndef NRFX_SPIS1_ENABLED
-#define NRFX_SPIS1_ENABLED 0
+#ifndef QDEC_CONFIG_DBFEN
+#define QDEC_CONFIG_DBFEN 0
 #endif
 
-// <q> NRFX_SPIS2_ENABLED  - Enable SPIS2 instance
+// <q> QDEC_CONFIG_SAMPLE_INTEN  - Sample ready interrupt enable
  
 
-#ifndef NRFX_SPIS2_ENABLED
-#define NRFX_SPIS2_ENABLED 0
+#ifndef QDEC_CONFIG_SAMPLE_INTEN
+#define QDEC_CONFIG_SAMPLE_INTEN 0
 #endif
 
-// <o> NRFX_SPIS_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> QDEC_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -3740,115 +6659,127 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_SPIS_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_SPIS_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef QDEC_CONFIG_IRQ_PRIORITY
+#define QDEC_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <o> NRFX_SPIS_DEFAULT_DEF - SPIS default DEF character  <0-255> 
-
+// </e>
 
-#ifndef NRFX_SPIS_DEFAULT_DEF
-#define NRFX_SPIS_DEFAULT_DEF 255
+// <e> QSPI_ENABLED - nrf_drv_qspi - QSPI peripheral driver - legacy layer
+//==========================================================
+#ifndef QSPI_ENABLED
+#define QSPI_ENABLED 0
 #endif
-
-// <o> NRFX_SPIS_DEFAULT_ORC - SPIS default ORC character  <0-255> 
+// <o> QSPI_CONFIG_SCK_DELAY - tSHSL, tWHSL and tSHWL in number of 16 MHz periods (62.5 ns).  <0-255> 
 
 
-#ifndef NRFX_SPIS_DEFAULT_ORC
-#define NRFX_SPIS_DEFAULT_ORC 255
+#ifndef QSPI_CONFIG_SCK_DELAY
+#define QSPI_CONFIG_SCK_DELAY 1
 #endif
 
-// <e> NRFX_SPIS_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_SPIS_CONFIG_LOG_ENABLED
-#define NRFX_SPIS_CONFIG_LOG_ENABLED 0
+// <o> QSPI_CONFIG_XIP_OFFSET - Address offset in the external memory for Execute in Place operation. 
+#ifndef QSPI_CONFIG_XIP_OFFSET
+#define QSPI_CONFIG_XIP_OFFSET 0
 #endif
-// <o> NRFX_SPIS_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <o> QSPI_CONFIG_READOC  - Number of data lines and opcode used for reading.
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
+// <0=> FastRead 
+// <1=> Read2O 
+// <2=> Read2IO 
+// <3=> Read4O 
+// <4=> Read4IO 
 
-#ifndef NRFX_SPIS_CONFIG_LOG_LEVEL
-#define NRFX_SPIS_CONFIG_LOG_LEVEL 3
+#ifndef QSPI_CONFIG_READOC
+#define QSPI_CONFIG_READOC 0
 #endif
 
-// <o> NRFX_SPIS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> QSPI_CONFIG_WRITEOC  - Number of data lines and opcode used for writing.
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <0=> PP 
+// <1=> PP2O 
+// <2=> PP4O 
+// <3=> PP4IO 
 
-#ifndef NRFX_SPIS_CONFIG_INFO_COLOR
-#define NRFX_SPIS_CONFIG_INFO_COLOR 0
+#ifndef QSPI_CONFIG_WRITEOC
+#define QSPI_CONFIG_WRITEOC 0
 #endif
 
-// <o> NRFX_SPIS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> QSPI_CONFIG_ADDRMODE  - Addressing mode.
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <0=> 24bit 
+// <1=> 32bit 
 
-#ifndef NRFX_SPIS_CONFIG_DEBUG_COLOR
-#define NRFX_SPIS_CONFIG_DEBUG_COLOR 0
+#ifndef QSPI_CONFIG_ADDRMODE
+#define QSPI_CONFIG_ADDRMODE 0
 #endif
 
-// </e>
-
-// </e>
+// <o> QSPI_CONFIG_MODE  - SPI mode.
+ 
+// <0=> Mode 0 
+// <1=> Mode 1 
 
-// <e> NRFX_SPI_ENABLED - nrfx_spi - SPI peripheral driver
-//==========================================================
-#ifndef NRFX_SPI_ENABLED
-#define NRFX_SPI_ENABLED 0
+#ifndef QSPI_CONFIG_MODE
+#define QSPI_CONFIG_MODE 0
 #endif
-// <q> NRFX_SPI0_ENABLED  - Enable SPI0 instance
- 
 
-#ifndef NRFX_SPI0_ENABLED
-#define NRFX_SPI0_ENABLED 0
+// <o> QSPI_CONFIG_FREQUENCY  - Frequency divider.
+ 
+// <0=> 32MHz/1 
+// <1=> 32MHz/2 
+// <2=> 32MHz/3 
+// <3=> 32MHz/4 
+// <4=> 32MHz/5 
+// <5=> 32MHz/6 
+// <6=> 32MHz/7 
+// <7=> 32MHz/8 
+// <8=> 32MHz/9 
+// <9=> 32MHz/10 
+// <10=> 32MHz/11 
+// <11=> 32MHz/12 
+// <12=> 32MHz/13 
+// <13=> 32MHz/14 
+// <14=> 32MHz/15 
+// <15=> 32MHz/16 
+
+#ifndef QSPI_CONFIG_FREQUENCY
+#define QSPI_CONFIG_FREQUENCY 15
 #endif
 
-// <q> NRFX_SPI1_ENABLED  - Enable SPI1 instance
- 
+// <s> QSPI_PIN_SCK - SCK pin value.
+#ifndef QSPI_PIN_SCK
+#define QSPI_PIN_SCK NRF_QSPI_PIN_NOT_CONNECTED
+#endif
 
-#ifndef NRFX_SPI1_ENABLED
-#define NRFX_SPI1_ENABLED 0
+// <s> QSPI_PIN_CSN - CSN pin value.
+#ifndef QSPI_PIN_CSN
+#define QSPI_PIN_CSN NRF_QSPI_PIN_NOT_CONNECTED
 #endif
 
-// <q> NRFX_SPI2_ENABLED  - Enable SPI2 instance
- 
+// <s> QSPI_PIN_IO0 - IO0 pin value.
+#ifndef QSPI_PIN_IO0
+#define QSPI_PIN_IO0 NRF_QSPI_PIN_NOT_CONNECTED
+#endif
 
-#ifndef NRFX_SPI2_ENABLED
-#define NRFX_SPI2_ENABLED 0
+// <s> QSPI_PIN_IO1 - IO1 pin value.
+#ifndef QSPI_PIN_IO1
+#define QSPI_PIN_IO1 NRF_QSPI_PIN_NOT_CONNECTED
 #endif
 
-// <o> NRFX_SPI_MISO_PULL_CFG  - MISO pin pull configuration.
- 
-// <0=> NRF_GPIO_PIN_NOPULL 
-// <1=> NRF_GPIO_PIN_PULLDOWN 
-// <3=> NRF_GPIO_PIN_PULLUP 
+// <s> QSPI_PIN_IO2 - IO2 pin value.
+#ifndef QSPI_PIN_IO2
+#define QSPI_PIN_IO2 NRF_QSPI_PIN_NOT_CONNECTED
+#endif
 
-#ifndef NRFX_SPI_MISO_PULL_CFG
-#define NRFX_SPI_MISO_PULL_CFG 1
+// <s> QSPI_PIN_IO3 - IO3 pin value.
+#ifndef QSPI_PIN_IO3
+#define QSPI_PIN_IO3 NRF_QSPI_PIN_NOT_CONNECTED
 #endif
 
-// <o> NRFX_SPI_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> QSPI_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -3858,249 +6789,161 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_SPI_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_SPI_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef QSPI_CONFIG_IRQ_PRIORITY
+#define QSPI_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_SPI_CONFIG_LOG_ENABLED - Enables logging in the module.
+// </e>
+
+// <e> RNG_ENABLED - nrf_drv_rng - RNG peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_SPI_CONFIG_LOG_ENABLED
-#define NRFX_SPI_CONFIG_LOG_ENABLED 0
+#ifndef RNG_ENABLED
+#define RNG_ENABLED 0
 #endif
-// <o> NRFX_SPI_CONFIG_LOG_LEVEL  - Default Severity level
+// <q> RNG_CONFIG_ERROR_CORRECTION  - Error correction
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_SPI_CONFIG_LOG_LEVEL
-#define NRFX_SPI_CONFIG_LOG_LEVEL 3
+#ifndef RNG_CONFIG_ERROR_CORRECTION
+#define RNG_CONFIG_ERROR_CORRECTION 1
 #endif
 
-// <o> NRFX_SPI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
-
-#ifndef NRFX_SPI_CONFIG_INFO_COLOR
-#define NRFX_SPI_CONFIG_INFO_COLOR 0
+// <o> RNG_CONFIG_POOL_SIZE - Pool size 
+#ifndef RNG_CONFIG_POOL_SIZE
+#define RNG_CONFIG_POOL_SIZE 64
 #endif
 
-// <o> NRFX_SPI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> RNG_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_SPI_CONFIG_DEBUG_COLOR
-#define NRFX_SPI_CONFIG_DEBUG_COLOR 0
-#endif
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
 
-// </e>
+#ifndef RNG_CONFIG_IRQ_PRIORITY
+#define RNG_CONFIG_IRQ_PRIORITY 2
+#endif
 
 // </e>
 
-// <e> NRFX_SWI_ENABLED - nrfx_swi - SWI/EGU peripheral allocator
+// <e> RTC_ENABLED - nrf_drv_rtc - RTC peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_SWI_ENABLED
-#define NRFX_SWI_ENABLED 0
-#endif
-// <q> NRFX_EGU_ENABLED  - Enable EGU support
- 
-
-#ifndef NRFX_EGU_ENABLED
-#define NRFX_EGU_ENABLED 0
+#ifndef RTC_ENABLED
+#define RTC_ENABLED 1
 #endif
+// <o> RTC_DEFAULT_CONFIG_FREQUENCY - Frequency  <16-32768> 
 
-// <q> NRFX_SWI0_DISABLED  - Exclude SWI0 from being utilized by the driver
- 
 
-#ifndef NRFX_SWI0_DISABLED
-#define NRFX_SWI0_DISABLED 0
+#ifndef RTC_DEFAULT_CONFIG_FREQUENCY
+#define RTC_DEFAULT_CONFIG_FREQUENCY 32768
 #endif
 
-// <q> NRFX_SWI1_DISABLED  - Exclude SWI1 from being utilized by the driver
+// <q> RTC_DEFAULT_CONFIG_RELIABLE  - Ensures safe compare event triggering
  
 
-#ifndef NRFX_SWI1_DISABLED
-#define NRFX_SWI1_DISABLED 0
+#ifndef RTC_DEFAULT_CONFIG_RELIABLE
+#define RTC_DEFAULT_CONFIG_RELIABLE 0
 #endif
 
-// <q> NRFX_SWI2_DISABLED  - Exclude SWI2 from being utilized by the driver
+// <o> RTC_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 
-#ifndef NRFX_SWI2_DISABLED
-#define NRFX_SWI2_DISABLED 0
-#endif
-
-// <q> NRFX_SWI3_DISABLED  - Exclude SWI3 from being utilized by the driver
- 
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
 
-#ifndef NRFX_SWI3_DISABLED
-#define NRFX_SWI3_DISABLED 0
+#ifndef RTC_DEFAULT_CONFIG_IRQ_PRIORITY
+#define RTC_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <q> NRFX_SWI4_DISABLED  - Exclude SWI4 from being utilized by the driver
+// <q> RTC0_ENABLED  - Enable RTC0 instance
  
 
-#ifndef NRFX_SWI4_DISABLED
-#define NRFX_SWI4_DISABLED 0
+#ifndef RTC0_ENABLED
+#define RTC0_ENABLED 0
 #endif
 
-// <q> NRFX_SWI5_DISABLED  - Exclude SWI5 from being utilized by the driver
+// <q> RTC1_ENABLED  - Enable RTC1 instance
  
 
-#ifndef NRFX_SWI5_DISABLED
-#define NRFX_SWI5_DISABLED 0
+#ifndef RTC1_ENABLED
+#define RTC1_ENABLED 0
 #endif
 
-// <e> NRFX_SWI_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_SWI_CONFIG_LOG_ENABLED
-#define NRFX_SWI_CONFIG_LOG_ENABLED 0
-#endif
-// <o> NRFX_SWI_CONFIG_LOG_LEVEL  - Default Severity level
+// <q> RTC2_ENABLED  - Enable RTC2 instance
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_SWI_CONFIG_LOG_LEVEL
-#define NRFX_SWI_CONFIG_LOG_LEVEL 3
+#ifndef RTC2_ENABLED
+#define RTC2_ENABLED 1
 #endif
 
-// <o> NRFX_SWI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
-
-#ifndef NRFX_SWI_CONFIG_INFO_COLOR
-#define NRFX_SWI_CONFIG_INFO_COLOR 0
+// <o> NRF_MAXIMUM_LATENCY_US - Maximum possible time[us] in highest priority interrupt 
+#ifndef NRF_MAXIMUM_LATENCY_US
+#define NRF_MAXIMUM_LATENCY_US 2000
 #endif
 
-// <o> NRFX_SWI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
-
-#ifndef NRFX_SWI_CONFIG_DEBUG_COLOR
-#define NRFX_SWI_CONFIG_DEBUG_COLOR 0
-#endif
+// Error handling
+#define APP_ERROR_CHECK_ENABLED 1
 
-// </e>
+// GPIO and delay
+#define NRFX_GPIOTE_ENABLED 1
+#define GPIOTE_ENABLED 1
 
 // </e>
-
-// <e> NRFX_TIMER_ENABLED - nrfx_timer - TIMER periperal driver
+// <e> SAADC_ENABLED - nrf_drv_saadc - SAADC peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_TIMER_ENABLED
-#define NRFX_TIMER_ENABLED 0
-#endif
-// <q> NRFX_TIMER0_ENABLED  - Enable TIMER0 instance
- 
-
-#ifndef NRFX_TIMER0_ENABLED
-#define NRFX_TIMER0_ENABLED 0
-#endif
-
-// <q> NRFX_TIMER1_ENABLED  - Enable TIMER1 instance
- 
-
-#ifndef NRFX_TIMER1_ENABLED
-#define NRFX_TIMER1_ENABLED 0
-#endif
-
-// <q> NRFX_TIMER2_ENABLED  - Enable TIMER2 instance
- 
-
-#ifndef NRFX_TIMER2_ENABLED
-#define NRFX_TIMER2_ENABLED 0
-#endif
-
-// <q> NRFX_TIMER3_ENABLED  - Enable TIMER3 instance
- 
-
-#ifndef NRFX_TIMER3_ENABLED
-#define NRFX_TIMER3_ENABLED 0
+#ifndef SAADC_ENABLED
+#define SAADC_ENABLED 1
 #endif
-
-// <q> NRFX_TIMER4_ENABLED  - Enable TIMER4 instance
+// <o> SAADC_CONFIG_RESOLUTION  - Resolution
  
+// <0=> 8 bit 
+// <1=> 10 bit 
+// <2=> 12 bit 
+// <3=> 14 bit 
 
-#ifndef NRFX_TIMER4_ENABLED
-#define NRFX_TIMER4_ENABLED 0
+#ifndef SAADC_CONFIG_RESOLUTION
+#define SAADC_CONFIG_RESOLUTION 1
 #endif
 
-// <o> NRFX_TIMER_DEFAULT_CONFIG_FREQUENCY  - Timer frequency if in Timer mode
+// <o> SAADC_CONFIG_OVERSAMPLE  - Sample period
  
-// <0=> 16 MHz 
-// <1=> 8 MHz 
-// <2=> 4 MHz 
-// <3=> 2 MHz 
-// <4=> 1 MHz 
-// <5=> 500 kHz 
-// <6=> 250 kHz 
-// <7=> 125 kHz 
-// <8=> 62.5 kHz 
-// <9=> 31.25 kHz 
+// <0=> Disabled 
+// <1=> 2x 
+// <2=> 4x 
+// <3=> 8x 
+// <4=> 16x 
+// <5=> 32x 
+// <6=> 64x 
+// <7=> 128x 
+// <8=> 256x 
 
-#ifndef NRFX_TIMER_DEFAULT_CONFIG_FREQUENCY
-#define NRFX_TIMER_DEFAULT_CONFIG_FREQUENCY 0
+#ifndef SAADC_CONFIG_OVERSAMPLE
+#define SAADC_CONFIG_OVERSAMPLE 0
 #endif
 
-// <o> NRFX_TIMER_DEFAULT_CONFIG_MODE  - Timer mode or operation
+// <q> SAADC_CONFIG_LP_MODE  - Enabling low power mode
  
-// <0=> Timer 
-// <1=> Counter 
 
-#ifndef NRFX_TIMER_DEFAULT_CONFIG_MODE
-#define NRFX_TIMER_DEFAULT_CONFIG_MODE 0
+#ifndef SAADC_CONFIG_LP_MODE
+#define SAADC_CONFIG_LP_MODE 0
 #endif
 
-// <o> NRFX_TIMER_DEFAULT_CONFIG_BIT_WIDTH  - Timer counter bit width
+// <o> SAADC_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
-// <0=> 16 bit 
-// <1=> 8 bit 
-// <2=> 24 bit 
-// <3=> 32 bit 
-
-#ifndef NRFX_TIMER_DEFAULT_CONFIG_BIT_WIDTH
-#define NRFX_TIMER_DEFAULT_CONFIG_BIT_WIDTH 0
-#endif
 
-// <o> NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -4110,101 +6953,100 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef SAADC_CONFIG_IRQ_PRIORITY
+#define SAADC_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_TIMER_CONFIG_LOG_ENABLED - Enables logging in the module.
+// </e>
+
+// <e> SPIS_ENABLED - nrf_drv_spis - SPIS peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_TIMER_CONFIG_LOG_ENABLED
-#define NRFX_TIMER_CONFIG_LOG_ENABLED 0
+#ifndef SPIS_ENABLED
+#define SPIS_ENABLED 0
 #endif
-// <o> NRFX_TIMER_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> SPIS_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_TIMER_CONFIG_LOG_LEVEL
-#define NRFX_TIMER_CONFIG_LOG_LEVEL 3
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef SPIS_DEFAULT_CONFIG_IRQ_PRIORITY
+#define SPIS_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <o> NRFX_TIMER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> SPIS_DEFAULT_MODE  - Mode
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <0=> MODE_0 
+// <1=> MODE_1 
+// <2=> MODE_2 
+// <3=> MODE_3 
 
-#ifndef NRFX_TIMER_CONFIG_INFO_COLOR
-#define NRFX_TIMER_CONFIG_INFO_COLOR 0
+#ifndef SPIS_DEFAULT_MODE
+#define SPIS_DEFAULT_MODE 0
 #endif
 
-// <o> NRFX_TIMER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> SPIS_DEFAULT_BIT_ORDER  - SPIS default bit order
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <0=> MSB first 
+// <1=> LSB first 
 
-#ifndef NRFX_TIMER_CONFIG_DEBUG_COLOR
-#define NRFX_TIMER_CONFIG_DEBUG_COLOR 0
+#ifndef SPIS_DEFAULT_BIT_ORDER
+#define SPIS_DEFAULT_BIT_ORDER 0
 #endif
 
-// </e>
+// <o> SPIS_DEFAULT_DEF - SPIS default DEF character  <0-255> 
 
-// </e>
 
-// <e> NRFX_TWIM_ENABLED - nrfx_twim - TWIM peripheral driver
-//==========================================================
-#ifndef NRFX_TWIM_ENABLED
-#define NRFX_TWIM_ENABLED 0
+#ifndef SPIS_DEFAULT_DEF
+#define SPIS_DEFAULT_DEF 255
 #endif
-// <q> NRFX_TWIM0_ENABLED  - Enable TWIM0 instance
- 
 
-#ifndef NRFX_TWIM0_ENABLED
-#define NRFX_TWIM0_ENABLED 0
+// <o> SPIS_DEFAULT_ORC - SPIS default ORC character  <0-255> 
+
+
+#ifndef SPIS_DEFAULT_ORC
+#define SPIS_DEFAULT_ORC 255
 #endif
 
-// <q> NRFX_TWIM1_ENABLED  - Enable TWIM1 instance
+// <q> SPIS0_ENABLED  - Enable SPIS0 instance
  
 
-#ifndef NRFX_TWIM1_ENABLED
-#define NRFX_TWIM1_ENABLED 0
+#ifndef SPIS0_ENABLED
+#define SPIS0_ENABLED 0
 #endif
 
-// <o> NRFX_TWIM_DEFAULT_CONFIG_FREQUENCY  - Frequency
+// <q> SPIS1_ENABLED  - Enable SPIS1 instance
  
-// <26738688=> 100k 
-// <67108864=> 250k 
-// <104857600=> 400k 
 
-#ifndef NRFX_TWIM_DEFAULT_CONFIG_FREQUENCY
-#define NRFX_TWIM_DEFAULT_CONFIG_FREQUENCY 26738688
+#ifndef SPIS1_ENABLED
+#define SPIS1_ENABLED 0
 #endif
 
-// <q> NRFX_TWIM_DEFAULT_CONFIG_HOLD_BUS_UNINIT  - Enables bus holding after uninit
+// <q> SPIS2_ENABLED  - Enable SPIS2 instance
  
 
-#ifndef NRFX_TWIM_DEFAULT_CONFIG_HOLD_BUS_UNINIT
-#define NRFX_TWIM_DEFAULT_CONFIG_HOLD_BUS_UNINIT 0
+#ifndef SPIS2_ENABLED
+#define SPIS2_ENABLED 0
 #endif
 
-// <o> NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// </e>
+
+// <e> SPI_ENABLED - nrf_drv_spi - SPI/SPIM peripheral driver - legacy layer
+//==========================================================
+#ifndef SPI_ENABLED
+#define SPI_ENABLED 0
+#endif
+// <o> SPI_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -4214,132 +7056,110 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef SPI_DEFAULT_CONFIG_IRQ_PRIORITY
+#define SPI_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_TWIM_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_TWIM_CONFIG_LOG_ENABLED
-#define NRFX_TWIM_CONFIG_LOG_ENABLED 0
-#endif
-// <o> NRFX_TWIM_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRF_SPI_DRV_MISO_PULLUP_CFG  - MISO PIN pull-up configuration.
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
+// <0=> NRF_GPIO_PIN_NOPULL 
+// <1=> NRF_GPIO_PIN_PULLDOWN 
+// <3=> NRF_GPIO_PIN_PULLUP 
 
-#ifndef NRFX_TWIM_CONFIG_LOG_LEVEL
-#define NRFX_TWIM_CONFIG_LOG_LEVEL 3
+#ifndef NRF_SPI_DRV_MISO_PULLUP_CFG
+#define NRF_SPI_DRV_MISO_PULLUP_CFG 1
 #endif
 
-// <o> NRFX_TWIM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
-
-#ifndef NRFX_TWIM_CONFIG_INFO_COLOR
-#define NRFX_TWIM_CONFIG_INFO_COLOR 0
+// <e> SPI0_ENABLED - Enable SPI0 instance
+//==========================================================
+#ifndef SPI0_ENABLED
+#define SPI0_ENABLED 0
 #endif
-
-// <o> NRFX_TWIM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> SPI0_USE_EASY_DMA  - Use EasyDMA
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_TWIM_CONFIG_DEBUG_COLOR
-#define NRFX_TWIM_CONFIG_DEBUG_COLOR 0
+#ifndef SPI0_USE_EASY_DMA
+#define SPI0_USE_EASY_DMA 1
 #endif
 
 // </e>
 
-// </e>
-
-// <e> NRFX_TWIS_ENABLED - nrfx_twis - TWIS peripheral driver
+// <e> SPI1_ENABLED - Enable SPI1 instance
 //==========================================================
-#ifndef NRFX_TWIS_ENABLED
-#define NRFX_TWIS_ENABLED 0
-#endif
-// <q> NRFX_TWIS0_ENABLED  - Enable TWIS0 instance
- 
-
-#ifndef NRFX_TWIS0_ENABLED
-#define NRFX_TWIS0_ENABLED 0
-#endif
-
-// <q> NRFX_TWIS1_ENABLED  - Enable TWIS1 instance
- 
-
-#ifndef NRFX_TWIS1_ENABLED
-#define NRFX_TWIS1_ENABLED 0
+#ifndef SPI1_ENABLED
+#define SPI1_ENABLED 0
 #endif
-
-// <q> NRFX_TWIS_ASSUME_INIT_AFTER_RESET_ONLY  - Assume that any instance would be initialized only once
+// <q> SPI1_USE_EASY_DMA  - Use EasyDMA
  
 
-// <i> Optimization flag. Registers used by TWIS are shared by other peripherals. Normally, during initialization driver tries to clear all registers to known state before doing the initialization itself. This gives initialization safe procedure, no matter when it would be called. If you activate TWIS only once and do never uninitialize it - set this flag to 1 what gives more optimal code.
-
-#ifndef NRFX_TWIS_ASSUME_INIT_AFTER_RESET_ONLY
-#define NRFX_TWIS_ASSUME_INIT_AFTER_RESET_ONLY 0
+#ifndef SPI1_USE_EASY_DMA
+#define SPI1_USE_EASY_DMA 1
 #endif
 
-// <q> NRFX_TWIS_NO_SYNC_MODE  - Remove support for synchronous mode
- 
+// </e>
 
-// <i> Synchronous mode would be used in specific situations. And it uses some additional code and data memory to safely process state machine by polling it in status functions. If this functionality is not required it may be disabled to free some resources.
+// <e> SPI2_ENABLED - Enable SPI2 instance
+//==========================================================
+#ifndef SPI2_ENABLED
+#define SPI2_ENABLED 0
+#endif
+// <q> SPI2_USE_EASY_DMA  - Use EasyDMA
+ 
 
-#ifndef NRFX_TWIS_NO_SYNC_MODE
-#define NRFX_TWIS_NO_SYNC_MODE 0
+#ifndef SPI2_USE_EASY_DMA
+#define SPI2_USE_EASY_DMA 1
 #endif
 
-// <o> NRFX_TWIS_DEFAULT_CONFIG_ADDR0 - Address0 
-#ifndef NRFX_TWIS_DEFAULT_CONFIG_ADDR0
-#define NRFX_TWIS_DEFAULT_CONFIG_ADDR0 0
+// </e>
+
+// </e>
+
+// <e> TIMER_ENABLED - nrf_drv_timer - TIMER periperal driver - legacy layer
+//==========================================================
+#ifndef TIMER_ENABLED
+#define TIMER_ENABLED 0
 #endif
+// <o> TIMER_DEFAULT_CONFIG_FREQUENCY  - Timer frequency if in Timer mode
+ 
+// <0=> 16 MHz 
+// <1=> 8 MHz 
+// <2=> 4 MHz 
+// <3=> 2 MHz 
+// <4=> 1 MHz 
+// <5=> 500 kHz 
+// <6=> 250 kHz 
+// <7=> 125 kHz 
+// <8=> 62.5 kHz 
+// <9=> 31.25 kHz 
 
-// <o> NRFX_TWIS_DEFAULT_CONFIG_ADDR1 - Address1 
-#ifndef NRFX_TWIS_DEFAULT_CONFIG_ADDR1
-#define NRFX_TWIS_DEFAULT_CONFIG_ADDR1 0
+#ifndef TIMER_DEFAULT_CONFIG_FREQUENCY
+#define TIMER_DEFAULT_CONFIG_FREQUENCY 0
 #endif
 
-// <o> NRFX_TWIS_DEFAULT_CONFIG_SCL_PULL  - SCL pin pull configuration
+// <o> TIMER_DEFAULT_CONFIG_MODE  - Timer mode or operation
  
-// <0=> Disabled 
-// <1=> Pull down 
-// <3=> Pull up 
+// <0=> Timer 
+// <1=> Counter 
 
-#ifndef NRFX_TWIS_DEFAULT_CONFIG_SCL_PULL
-#define NRFX_TWIS_DEFAULT_CONFIG_SCL_PULL 0
+#ifndef TIMER_DEFAULT_CONFIG_MODE
+#define TIMER_DEFAULT_CONFIG_MODE 0
 #endif
 
-// <o> NRFX_TWIS_DEFAULT_CONFIG_SDA_PULL  - SDA pin pull configuration
+// <o> TIMER_DEFAULT_CONFIG_BIT_WIDTH  - Timer counter bit width
  
-// <0=> Disabled 
-// <1=> Pull down 
-// <3=> Pull up 
+// <0=> 16 bit 
+// <1=> 8 bit 
+// <2=> 24 bit 
+// <3=> 32 bit 
 
-#ifndef NRFX_TWIS_DEFAULT_CONFIG_SDA_PULL
-#define NRFX_TWIS_DEFAULT_CONFIG_SDA_PULL 0
+#ifndef TIMER_DEFAULT_CONFIG_BIT_WIDTH
+#define TIMER_DEFAULT_CONFIG_BIT_WIDTH 0
 #endif
 
-// <o> NRFX_TWIS_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> TIMER_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -4349,227 +7169,166 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_TWIS_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_TWIS_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef TIMER_DEFAULT_CONFIG_IRQ_PRIORITY
+#define TIMER_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_TWIS_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_TWIS_CONFIG_LOG_ENABLED
-#define NRFX_TWIS_CONFIG_LOG_ENABLED 0
+// <q> TIMER0_ENABLED  - Enable TIMER0 instance
+ 
+
+#ifndef TIMER0_ENABLED
+#define TIMER0_ENABLED 0
 #endif
-// <o> NRFX_TWIS_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <q> TIMER1_ENABLED  - Enable TIMER1 instance
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_TWIS_CONFIG_LOG_LEVEL
-#define NRFX_TWIS_CONFIG_LOG_LEVEL 3
+#ifndef TIMER1_ENABLED
+#define TIMER1_ENABLED 0
 #endif
 
-// <o> NRFX_TWIS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> TIMER2_ENABLED  - Enable TIMER2 instance
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_TWIS_CONFIG_INFO_COLOR
-#define NRFX_TWIS_CONFIG_INFO_COLOR 0
+#ifndef TIMER2_ENABLED
+#define TIMER2_ENABLED 0
 #endif
 
-// <o> NRFX_TWIS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> TIMER3_ENABLED  - Enable TIMER3 instance
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_TWIS_CONFIG_DEBUG_COLOR
-#define NRFX_TWIS_CONFIG_DEBUG_COLOR 0
+#ifndef TIMER3_ENABLED
+#define TIMER3_ENABLED 0
 #endif
 
-// </e>
+// <q> TIMER4_ENABLED  - Enable TIMER4 instance
+ 
+
+#ifndef TIMER4_ENABLED
+#define TIMER4_ENABLED 0
+#endif
 
 // </e>
 
-// <e> NRFX_TWI_ENABLED - nrfx_twi - TWI peripheral driver
+// <e> TWIS_ENABLED - nrf_drv_twis - TWIS peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_TWI_ENABLED
-#define NRFX_TWI_ENABLED 0
+#ifndef TWIS_ENABLED
+#define TWIS_ENABLED 0
 #endif
-// <q> NRFX_TWI0_ENABLED  - Enable TWI0 instance
+// <q> TWIS0_ENABLED  - Enable TWIS0 instance
  
 
-#ifndef NRFX_TWI0_ENABLED
-#define NRFX_TWI0_ENABLED 0
+#ifndef TWIS0_ENABLED
+#define TWIS0_ENABLED 0
 #endif
 
-// <q> NRFX_TWI1_ENABLED  - Enable TWI1 instance
+// <q> TWIS1_ENABLED  - Enable TWIS1 instance
  
 
-#ifndef NRFX_TWI1_ENABLED
-#define NRFX_TWI1_ENABLED 0
+#ifndef TWIS1_ENABLED
+#define TWIS1_ENABLED 0
 #endif
 
-// <o> NRFX_TWI_DEFAULT_CONFIG_FREQUENCY  - Frequency
+// <q> TWIS_ASSUME_INIT_AFTER_RESET_ONLY  - Assume that any instance would be initialized only once
  
-// <26738688=> 100k 
-// <67108864=> 250k 
-// <104857600=> 400k 
 
-#ifndef NRFX_TWI_DEFAULT_CONFIG_FREQUENCY
-#define NRFX_TWI_DEFAULT_CONFIG_FREQUENCY 26738688
+// <i> Optimization flag. Registers used by TWIS are shared by other peripherals. Normally, during initialization driver tries to clear all registers to known state before doing the initialization itself. This gives initialization safe procedure, no matter when it would be called. If you activate TWIS only once and do never uninitialize it - set this flag to 1 what gives more optimal code.
+
+#ifndef TWIS_ASSUME_INIT_AFTER_RESET_ONLY
+#define TWIS_ASSUME_INIT_AFTER_RESET_ONLY 0
 #endif
 
-// <q> NRFX_TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT  - Enables bus holding after uninit
+// <q> TWIS_NO_SYNC_MODE  - Remove support for synchronous mode
  
 
-#ifndef NRFX_TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT
-#define NRFX_TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT 0
-#endif
+// <i> Synchronous mode would be used in specific situations. And it uses some additional code and data memory to safely process state machine by polling it in status functions. If this functionality is not required it may be disabled to free some resources.
 
-// <o> NRFX_TWI_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+#ifndef TWIS_NO_SYNC_MODE
+#define TWIS_NO_SYNC_MODE 0
+#endif
 
-#ifndef NRFX_TWI_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_TWI_DEFAULT_CONFIG_IRQ_PRIORITY 2
+// <o> TWIS_DEFAULT_CONFIG_ADDR0 - Address0 
+#ifndef TWIS_DEFAULT_CONFIG_ADDR0
+#define TWIS_DEFAULT_CONFIG_ADDR0 0
 #endif
 
-// <e> NRFX_TWI_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_TWI_CONFIG_LOG_ENABLED
-#define NRFX_TWI_CONFIG_LOG_ENABLED 0
+// <o> TWIS_DEFAULT_CONFIG_ADDR1 - Address1 
+#ifndef TWIS_DEFAULT_CONFIG_ADDR1
+#define TWIS_DEFAULT_CONFIG_ADDR1 0
 #endif
-// <o> NRFX_TWI_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <o> TWIS_DEFAULT_CONFIG_SCL_PULL  - SCL pin pull configuration
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
+// <0=> Disabled 
+// <1=> Pull down 
+// <3=> Pull up 
 
-#ifndef NRFX_TWI_CONFIG_LOG_LEVEL
-#define NRFX_TWI_CONFIG_LOG_LEVEL 3
+#ifndef TWIS_DEFAULT_CONFIG_SCL_PULL
+#define TWIS_DEFAULT_CONFIG_SCL_PULL 0
 #endif
 
-// <o> NRFX_TWI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> TWIS_DEFAULT_CONFIG_SDA_PULL  - SDA pin pull configuration
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// <0=> Disabled 
+// <1=> Pull down 
+// <3=> Pull up 
 
-#ifndef NRFX_TWI_CONFIG_INFO_COLOR
-#define NRFX_TWI_CONFIG_INFO_COLOR 0
+#ifndef TWIS_DEFAULT_CONFIG_SDA_PULL
+#define TWIS_DEFAULT_CONFIG_SDA_PULL 0
 #endif
 
-// <o> NRFX_TWI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> TWIS_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_TWI_CONFIG_DEBUG_COLOR
-#define NRFX_TWI_CONFIG_DEBUG_COLOR 0
-#endif
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
 
-// </e>
+#ifndef TWIS_DEFAULT_CONFIG_IRQ_PRIORITY
+#define TWIS_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#endif
 
 // </e>
 
-// <e> NRFX_UARTE_ENABLED - nrfx_uarte - UARTE peripheral driver
+// <e> TWI_ENABLED - nrf_drv_twi - TWI/TWIM peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_UARTE_ENABLED
-#define NRFX_UARTE_ENABLED 1
-#endif
-// <o> NRFX_UARTE0_ENABLED - Enable UARTE0 instance 
-#ifndef NRFX_UARTE0_ENABLED
-#define NRFX_UARTE0_ENABLED 0
-#endif
-
-// <o> NRFX_UARTE1_ENABLED - Enable UARTE1 instance 
-#ifndef NRFX_UARTE1_ENABLED
-#define NRFX_UARTE1_ENABLED 0
+#ifndef TWI_ENABLED
+#define TWI_ENABLED 0
 #endif
-
-// <o> NRFX_UARTE_DEFAULT_CONFIG_HWFC  - Hardware Flow Control
+// <o> TWI_DEFAULT_CONFIG_FREQUENCY  - Frequency
  
-// <0=> Disabled 
-// <1=> Enabled 
+// <26738688=> 100k 
+// <67108864=> 250k 
+// <104857600=> 400k 
 
-#ifndef NRFX_UARTE_DEFAULT_CONFIG_HWFC
-#define NRFX_UARTE_DEFAULT_CONFIG_HWFC 0
+#ifndef TWI_DEFAULT_CONFIG_FREQUENCY
+#define TWI_DEFAULT_CONFIG_FREQUENCY 26738688
 #endif
 
-// <o> NRFX_UARTE_DEFAULT_CONFIG_PARITY  - Parity
+// <q> TWI_DEFAULT_CONFIG_CLR_BUS_INIT  - Enables bus clearing procedure during init
  
-// <0=> Excluded 
-// <14=> Included 
 
-#ifndef NRFX_UARTE_DEFAULT_CONFIG_PARITY
-#define NRFX_UARTE_DEFAULT_CONFIG_PARITY 0
+#ifndef TWI_DEFAULT_CONFIG_CLR_BUS_INIT
+#define TWI_DEFAULT_CONFIG_CLR_BUS_INIT 0
 #endif
 
-// <o> NRFX_UARTE_DEFAULT_CONFIG_BAUDRATE  - Default Baudrate
+// <q> TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT  - Enables bus holding after uninit
  
-// <323584=> 1200 baud 
-// <643072=> 2400 baud 
-// <1290240=> 4800 baud 
-// <2576384=> 9600 baud 
-// <3862528=> 14400 baud 
-// <5152768=> 19200 baud 
-// <7716864=> 28800 baud 
-// <8388608=> 31250 baud 
-// <10289152=> 38400 baud 
-// <15007744=> 56000 baud 
-// <15400960=> 57600 baud 
-// <20615168=> 76800 baud 
-// <30801920=> 115200 baud 
-// <61865984=> 230400 baud 
-// <67108864=> 250000 baud 
-// <121634816=> 460800 baud 
-// <251658240=> 921600 baud 
-// <268435456=> 1000000 baud 
 
-#ifndef NRFX_UARTE_DEFAULT_CONFIG_BAUDRATE
-#define NRFX_UARTE_DEFAULT_CONFIG_BAUDRATE 30801920
+#ifndef TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT
+#define TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT 0
 #endif
 
-// <o> NRFX_UARTE_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> TWI_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -4579,118 +7338,90 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_UARTE_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_UARTE_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef TWI_DEFAULT_CONFIG_IRQ_PRIORITY
+#define TWI_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_UARTE_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> TWI0_ENABLED - Enable TWI0 instance
 //==========================================================
-#ifndef NRFX_UARTE_CONFIG_LOG_ENABLED
-#define NRFX_UARTE_CONFIG_LOG_ENABLED 0
+#ifndef TWI0_ENABLED
+#define TWI0_ENABLED 0
 #endif
-// <o> NRFX_UARTE_CONFIG_LOG_LEVEL  - Default Severity level
+// <q> TWI0_USE_EASY_DMA  - Use EasyDMA (if present)
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_UARTE_CONFIG_LOG_LEVEL
-#define NRFX_UARTE_CONFIG_LOG_LEVEL 3
+#ifndef TWI0_USE_EASY_DMA
+#define TWI0_USE_EASY_DMA 0
 #endif
 
-// <o> NRFX_UARTE_CONFIG_INFO_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// </e>
 
-#ifndef NRFX_UARTE_CONFIG_INFO_COLOR
-#define NRFX_UARTE_CONFIG_INFO_COLOR 0
+// <e> TWI1_ENABLED - Enable TWI1 instance
+//==========================================================
+#ifndef TWI1_ENABLED
+#define TWI1_ENABLED 0
 #endif
-
-// <o> NRFX_UARTE_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> TWI1_USE_EASY_DMA  - Use EasyDMA (if present)
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_UARTE_CONFIG_DEBUG_COLOR
-#define NRFX_UARTE_CONFIG_DEBUG_COLOR 0
+#ifndef TWI1_USE_EASY_DMA
+#define TWI1_USE_EASY_DMA 0
 #endif
 
 // </e>
 
 // </e>
 
-// <e> NRFX_UART_ENABLED - nrfx_uart - UART peripheral driver
+// <e> UART_ENABLED - nrf_drv_uart - UART/UARTE peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_UART_ENABLED
-#define NRFX_UART_ENABLED 1
-#endif
-// <o> NRFX_UART0_ENABLED - Enable UART0 instance 
-#ifndef NRFX_UART0_ENABLED
-#define NRFX_UART0_ENABLED 0
+#ifndef UART_ENABLED
+#define UART_ENABLED 1
 #endif
-
-// <o> NRFX_UART_DEFAULT_CONFIG_HWFC  - Hardware Flow Control
+// <o> UART_DEFAULT_CONFIG_HWFC  - Hardware Flow Control
  
 // <0=> Disabled 
 // <1=> Enabled 
 
-#ifndef NRFX_UART_DEFAULT_CONFIG_HWFC
-#define NRFX_UART_DEFAULT_CONFIG_HWFC 0
+#ifndef UART_DEFAULT_CONFIG_HWFC
+#define UART_DEFAULT_CONFIG_HWFC 0
 #endif
 
-// <o> NRFX_UART_DEFAULT_CONFIG_PARITY  - Parity
+// <o> UART_DEFAULT_CONFIG_PARITY  - Parity
  
 // <0=> Excluded 
 // <14=> Included 
 
-#ifndef NRFX_UART_DEFAULT_CONFIG_PARITY
-#define NRFX_UART_DEFAULT_CONFIG_PARITY 0
+#ifndef UART_DEFAULT_CONFIG_PARITY
+#define UART_DEFAULT_CONFIG_PARITY 0
 #endif
 
-// <o> NRFX_UART_DEFAULT_CONFIG_BAUDRATE  - Default Baudrate
+// <o> UART_DEFAULT_CONFIG_BAUDRATE  - Default Baudrate
  
 // <323584=> 1200 baud 
 // <643072=> 2400 baud 
 // <1290240=> 4800 baud 
 // <2576384=> 9600 baud 
-// <3866624=> 14400 baud 
+// <3862528=> 14400 baud 
 // <5152768=> 19200 baud 
-// <7729152=> 28800 baud 
-// <8388608=> 31250 baud 
-// <10309632=> 38400 baud 
-// <15007744=> 56000 baud 
-// <15462400=> 57600 baud 
+// <7716864=> 28800 baud 
+// <10289152=> 38400 baud 
+// <15400960=> 57600 baud 
 // <20615168=> 76800 baud 
-// <30924800=> 115200 baud 
-// <61845504=> 230400 baud 
+// <30801920=> 115200 baud 
+// <61865984=> 230400 baud 
 // <67108864=> 250000 baud 
-// <123695104=> 460800 baud 
-// <247386112=> 921600 baud 
+// <121634816=> 460800 baud 
+// <251658240=> 921600 baud 
 // <268435456=> 1000000 baud 
 
-#ifndef NRFX_UART_DEFAULT_CONFIG_BAUDRATE
-#define NRFX_UART_DEFAULT_CONFIG_BAUDRATE 30924800
+#ifndef UART_DEFAULT_CONFIG_BAUDRATE
+#define UART_DEFAULT_CONFIG_BAUDRATE 30801920
 #endif
 
-// <o> NRFX_UART_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> UART_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -4700,70 +7431,58 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_UART_DEFAULT_CONFIG_IRQ_PRIORITY
-#define NRFX_UART_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef UART_DEFAULT_CONFIG_IRQ_PRIORITY
+#define UART_DEFAULT_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <e> NRFX_UART_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_UART_CONFIG_LOG_ENABLED
-#define NRFX_UART_CONFIG_LOG_ENABLED 0
-#endif
-// <o> NRFX_UART_CONFIG_LOG_LEVEL  - Default Severity level
+// <q> UART_EASY_DMA_SUPPORT  - Driver supporting EasyDMA
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_UART_CONFIG_LOG_LEVEL
-#define NRFX_UART_CONFIG_LOG_LEVEL 3
+#ifndef UART_EASY_DMA_SUPPORT
+#define UART_EASY_DMA_SUPPORT 1
 #endif
 
-// <o> NRFX_UART_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> UART_LEGACY_SUPPORT  - Driver supporting Legacy mode
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_UART_CONFIG_INFO_COLOR
-#define NRFX_UART_CONFIG_INFO_COLOR 0
+// <i> When only EasyDMA is supported, nrf_drv_uart calls nrfx_uarte directly, without choosing the backend at run time.
+
+#ifndef UART_LEGACY_SUPPORT
+#define UART_LEGACY_SUPPORT 0
 #endif
 
-// <o> NRFX_UART_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <e> UART0_ENABLED - Enable UART0 instance
+//==========================================================
+#ifndef UART0_ENABLED
+#define UART0_ENABLED 1
+#endif
+// <q> UART0_CONFIG_USE_EASY_DMA  - Default setting for using EasyDMA
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_UART_CONFIG_DEBUG_COLOR
-#define NRFX_UART_CONFIG_DEBUG_COLOR 0
+#ifndef UART0_CONFIG_USE_EASY_DMA
+#define UART0_CONFIG_USE_EASY_DMA 1
 #endif
 
 // </e>
 
+// <e> UART1_ENABLED - Enable UART1 instance
+//==========================================================
+#ifndef UART1_ENABLED
+#define UART1_ENABLED 0
+#endif
+// </e>
+
 // </e>
 
-// <e> NRFX_USBD_ENABLED - nrfx_usbd - USBD peripheral driver
+// <e> USBD_ENABLED - nrf_drv_usbd - Software Component
 //==========================================================
-#ifndef NRFX_USBD_ENABLED
-#define NRFX_USBD_ENABLED 0
+#ifndef USBD_ENABLED
+#define USBD_ENABLED 0
 #endif
-// <o> NRFX_USBD_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> USBD_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
+
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -4773,20 +7492,20 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_USBD_CONFIG_IRQ_PRIORITY
-#define NRFX_USBD_CONFIG_IRQ_PRIORITY 2
+#ifndef USBD_CONFIG_IRQ_PRIORITY
+#define USBD_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <o> NRFX_USBD_CONFIG_DMASCHEDULER_MODE  - USBD DMA scheduler working scheme
+// <o> USBD_CONFIG_DMASCHEDULER_MODE  - USBD SMA scheduler working scheme
  
 // <0=> Prioritized access 
 // <1=> Round Robin 
 
-#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_MODE
-#define NRFX_USBD_CONFIG_DMASCHEDULER_MODE 0
+#ifndef USBD_CONFIG_DMASCHEDULER_MODE
+#define USBD_CONFIG_DMASCHEDULER_MODE 0
 #endif
 
-// <q> NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST  - Give priority to isochronous transfers
+// <q> USBD_CONFIG_DMASCHEDULER_ISO_BOOST  - Give priority to isochronous transfers
  
 
 // <i> This option gives priority to isochronous transfers.
@@ -4795,67 +7514,50 @@
 // <i> Isochronous endpoints are prioritized before the usbd_dma_scheduler_algorithm
 // <i> function is called, so the option is independent of the algorithm chosen.
 
-#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST
-#define NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST 1
+#ifndef USBD_CONFIG_DMASCHEDULER_ISO_BOOST
+#define USBD_CONFIG_DMASCHEDULER_ISO_BOOST 1
 #endif
 
-// <q> NRFX_USBD_CONFIG_ISO_IN_ZLP  - Respond to an IN token on ISO IN endpoint with ZLP when no data is ready
+// <q> USBD_CONFIG_ISO_IN_ZLP  - Respond to an IN token on ISO IN endpoint with ZLP when no data is ready
  
 
 // <i> If set, ISO IN endpoint will respond to an IN token with ZLP when no data is ready to be sent.
 // <i> Else, there will be no response.
+// <i> NOTE: This option does not work on Engineering A chip.
 
-#ifndef NRFX_USBD_CONFIG_ISO_IN_ZLP
-#define NRFX_USBD_CONFIG_ISO_IN_ZLP 0
-#endif
-
-// <q> NRFX_USBD_USE_WORKAROUND_FOR_ANOMALY_211  - Use workaround for anomaly 211
- 
-
-// <i> If set, workaround for anomaly 211 will be enabled.
-// <i> Anomaly 211 - Device remains in SUSPEND too long when host resumes
-// <i> bus activity (sending SOF packets) without a RESUME condition.
-
-#ifndef NRFX_USBD_USE_WORKAROUND_FOR_ANOMALY_211
-#define NRFX_USBD_USE_WORKAROUND_FOR_ANOMALY_211 0
+#ifndef USBD_CONFIG_ISO_IN_ZLP
+#define USBD_CONFIG_ISO_IN_ZLP 0
 #endif
 
 // </e>
 
-// <e> NRFX_WDT_ENABLED - nrfx_wdt - WDT peripheral driver
+// <e> WDT_ENABLED - nrf_drv_wdt - WDT peripheral driver - legacy layer
 //==========================================================
-#ifndef NRFX_WDT_ENABLED
-#define NRFX_WDT_ENABLED 0
+#ifndef WDT_ENABLED
+#define WDT_ENABLED 0
 #endif
-// <o> NRFX_WDT_CONFIG_BEHAVIOUR  - WDT behavior in CPU SLEEP or HALT mode
+// <o> WDT_CONFIG_BEHAVIOUR  - WDT behavior in CPU SLEEP or HALT mode
  
 // <1=> Run in SLEEP, Pause in HALT 
 // <8=> Pause in SLEEP, Run in HALT 
 // <9=> Run in SLEEP and HALT 
 // <0=> Pause in SLEEP and HALT 
 
-#ifndef NRFX_WDT_CONFIG_BEHAVIOUR
-#define NRFX_WDT_CONFIG_BEHAVIOUR 1
+#ifndef WDT_CONFIG_BEHAVIOUR
+#define WDT_CONFIG_BEHAVIOUR 1
 #endif
 
-// <o> NRFX_WDT_CONFIG_RELOAD_VALUE - Reload value in ms  <1-131072000> 
+// <o> WDT_CONFIG_RELOAD_VALUE - Reload value  <15-4294967295> 
 
 
-#ifndef NRFX_WDT_CONFIG_RELOAD_VALUE
-#define NRFX_WDT_CONFIG_RELOAD_VALUE 2000
+#ifndef WDT_CONFIG_RELOAD_VALUE
+#define WDT_CONFIG_RELOAD_VALUE 2000
 #endif
 
-// <o> NRFX_WDT_CONFIG_NO_IRQ  - Remove WDT IRQ handling from WDT driver
+// <o> WDT_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
-// <0=> Include WDT IRQ handling 
-// <1=> Remove WDT IRQ handling 
-
-#ifndef NRFX_WDT_CONFIG_NO_IRQ
-#define NRFX_WDT_CONFIG_NO_IRQ 0
-#endif
 
-// <o> NRFX_WDT_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
+// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
 // <0=> 0 (highest) 
 // <1=> 1 
 // <2=> 2 
@@ -4865,290 +7567,266 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef NRFX_WDT_CONFIG_IRQ_PRIORITY
-#define NRFX_WDT_CONFIG_IRQ_PRIORITY 2
-#endif
-
-// <e> NRFX_WDT_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef NRFX_WDT_CONFIG_LOG_ENABLED
-#define NRFX_WDT_CONFIG_LOG_ENABLED 0
+#ifndef WDT_CONFIG_IRQ_PRIORITY
+#define WDT_CONFIG_IRQ_PRIORITY 2
 #endif
-// <o> NRFX_WDT_CONFIG_LOG_LEVEL  - Default Severity level
- 
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef NRFX_WDT_CONFIG_LOG_LEVEL
-#define NRFX_WDT_CONFIG_LOG_LEVEL 3
-#endif
+// </e>
 
-// <o> NRFX_WDT_CONFIG_INFO_COLOR  - ANSI escape code prefix.
- 
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
+// </h> 
+//==========================================================
 
-#ifndef NRFX_WDT_CONFIG_INFO_COLOR
-#define NRFX_WDT_CONFIG_INFO_COLOR 0
-#endif
+// <h> nRF_Drivers_External 
 
-// <o> NRFX_WDT_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+//==========================================================
+// <q> NRF_TWI_SENSOR_ENABLED  - nrf_twi_sensor - nRF TWI Sensor module
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef NRFX_WDT_CONFIG_DEBUG_COLOR
-#define NRFX_WDT_CONFIG_DEBUG_COLOR 0
+#ifndef NRF_TWI_SENSOR_ENABLED
+#define NRF_TWI_SENSOR_ENABLED 0
 #endif
 
-// </e>
+// </h> 
+//==========================================================
 
-// </e>
+// <h> nRF_Libraries 
 
-// <e> NRF_CLOCK_ENABLED - nrf_drv_clock - CLOCK peripheral driver - legacy layer
 //==========================================================
-#ifndef NRF_CLOCK_ENABLED
-#define NRF_CLOCK_ENABLED 1
-#endif
-// <o> CLOCK_CONFIG_LF_SRC  - LF Clock Source
+// <q> APP_GPIOTE_ENABLED  - app_gpiote - GPIOTE events dispatcher
  
-// <0=> RC 
-// <1=> XTAL 
-// <2=> Synth 
-// <131073=> External Low Swing 
-// <196609=> External Full Swing 
 
-#ifndef CLOCK_CONFIG_LF_SRC
-#define CLOCK_CONFIG_LF_SRC 1
+#ifndef APP_GPIOTE_ENABLED
+#define APP_GPIOTE_ENABLED 0
 #endif
 
-// <q> CLOCK_CONFIG_LF_CAL_ENABLED  - Calibration enable for LF Clock Source
+// <q> APP_PWM_ENABLED  - app_pwm - PWM functionality
  
 
-#ifndef CLOCK_CONFIG_LF_CAL_ENABLED
-#define CLOCK_CONFIG_LF_CAL_ENABLED 0
+#ifndef APP_PWM_ENABLED
+#define APP_PWM_ENABLED 0
 #endif
 
-// <o> CLOCK_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <e> APP_SAADC_ENABLED - app_saadc - Hardware-paced SAADC acquisition
+//==========================================================
+#ifndef APP_SAADC_ENABLED
+#define APP_SAADC_ENABLED 0
+#endif
+// <o> APP_SAADC_CONFIG_TRIGGER  - Sample trigger source
  
+// <0=> TIMER 
+// <1=> RTC 
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
+#ifndef APP_SAADC_CONFIG_TRIGGER
+#define APP_SAADC_CONFIG_TRIGGER 0
+#endif
+
+// <o> APP_SAADC_CONFIG_TIMER_INSTANCE  - TIMER instance used when TIMER is the trigger source.
+ 
+// <i> The instance must be enabled in the nrfx_timer configuration.
+// <0=> 0 
 // <1=> 1 
 // <2=> 2 
 // <3=> 3 
 // <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef CLOCK_CONFIG_IRQ_PRIORITY
-#define CLOCK_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_SAADC_CONFIG_TIMER_INSTANCE
+#define APP_SAADC_CONFIG_TIMER_INSTANCE 1
 #endif
 
-// </e>
+// <o> APP_SAADC_CONFIG_RTC_INSTANCE  - RTC instance used when RTC is the trigger source.
+ 
+// <i> The instance must be enabled in the nrfx_rtc configuration.
+// <i> RTC1 is used by app_timer.
+// <0=> 0 
+// <2=> 2 
 
-// <e> PDM_ENABLED - nrf_drv_pdm - PDM peripheral driver - legacy layer
-//==========================================================
-#ifndef PDM_ENABLED
-#define PDM_ENABLED 0
+#ifndef APP_SAADC_CONFIG_RTC_INSTANCE
+#define APP_SAADC_CONFIG_RTC_INSTANCE 2
 #endif
-// <o> PDM_CONFIG_MODE  - Mode
- 
-// <0=> Stereo 
-// <1=> Mono 
 
-#ifndef PDM_CONFIG_MODE
-#define PDM_CONFIG_MODE 1
+// <o> APP_SAADC_CONFIG_AUX_CHANNEL - SAADC channel used for one-shot auxiliary conversions.  <0-7> 
+
+// <i> Must not be part of the channel mask of the acquisition.
+
+#ifndef APP_SAADC_CONFIG_AUX_CHANNEL
+#define APP_SAADC_CONFIG_AUX_CHANNEL 7
 #endif
 
-// <o> PDM_CONFIG_EDGE  - Edge
- 
-// <0=> Left falling 
-// <1=> Left rising 
+// <o> APP_SAADC_CONFIG_AUX_REQUESTS - Number of auxiliary conversion requests that can be queued.  <1-8> 
 
-#ifndef PDM_CONFIG_EDGE
-#define PDM_CONFIG_EDGE 0
+#ifndef APP_SAADC_CONFIG_AUX_REQUESTS
+#define APP_SAADC_CONFIG_AUX_REQUESTS 2
 #endif
 
-// <o> PDM_CONFIG_CLOCK_FREQ  - Clock frequency
- 
-// <134217728=> 1000k 
-// <138412032=> 1032k (default) 
-// <142606336=> 1067k 
+// </e>
 
-#ifndef PDM_CONFIG_CLOCK_FREQ
-#define PDM_CONFIG_CLOCK_FREQ 138412032
+// <e> APP_SAADC_ACQTIME_ENABLED - app_saadc_acqtime - SAADC acquisition time optimizer
+//==========================================================
+#ifndef APP_SAADC_ACQTIME_ENABLED
+#define APP_SAADC_ACQTIME_ENABLED 0
 #endif
+// <o> APP_SAADC_ACQTIME_FILE_ID - Flash Data Storage file ID of the calibration results. 
+// <i> Must be below 0xC000, which is reserved for the Peer Manager.
 
-// <o> PDM_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
+#ifndef APP_SAADC_ACQTIME_FILE_ID
+#define APP_SAADC_ACQTIME_FILE_ID 0x5AAC
+#endif
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+// <o> APP_SAADC_ACQTIME_RECORD_KEY - Flash Data Storage record key of the calibration results. 
+// <i> Must be between 0x0001 and 0xBFFF.
 
-#ifndef PDM_CONFIG_IRQ_PRIORITY
-#define PDM_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_SAADC_ACQTIME_RECORD_KEY
+#define APP_SAADC_ACQTIME_RECORD_KEY 0x0001
 #endif
 
 // </e>
 
-// <e> POWER_ENABLED - nrf_drv_power - POWER peripheral driver - legacy layer
+// <e> APP_SAADC_BENCH_ENABLED - app_saadc_bench - SAADC latency and throughput benchmark
 //==========================================================
-#ifndef POWER_ENABLED
-#define POWER_ENABLED 0
+#ifndef APP_SAADC_BENCH_ENABLED
+#define APP_SAADC_BENCH_ENABLED 0
 #endif
-// <o> POWER_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> APP_SAADC_BENCH_CONFIG_TIMER_INSTANCE  - TIMER instance used as the capture time base.
  
-
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
+// <0=> 0 
 // <1=> 1 
 // <2=> 2 
 // <3=> 3 
 // <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef POWER_CONFIG_IRQ_PRIORITY
-#define POWER_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_SAADC_BENCH_CONFIG_TIMER_INSTANCE
+#define APP_SAADC_BENCH_CONFIG_TIMER_INSTANCE 2
 #endif
 
-// <q> POWER_CONFIG_DEFAULT_DCDCEN  - The default configuration of main DCDC regulator
- 
+// <o> APP_SAADC_BENCH_CONFIG_PIN - GPIO held high while the SAADC handler runs.  <0-47> 
 
-// <i> This settings means only that components for DCDC regulator are installed and it can be enabled.
 
-#ifndef POWER_CONFIG_DEFAULT_DCDCEN
-#define POWER_CONFIG_DEFAULT_DCDCEN 0
+#ifndef APP_SAADC_BENCH_CONFIG_PIN
+#define APP_SAADC_BENCH_CONFIG_PIN 42
 #endif
 
-// <q> POWER_CONFIG_DEFAULT_DCDCENHV  - The default configuration of High Voltage DCDC regulator
- 
+// <o> APP_SAADC_BENCH_CONFIG_BUFFER_SIZE - Largest buffer size of a scenario, in samples. 
 
-// <i> This settings means only that components for DCDC regulator are installed and it can be enabled.
 
-#ifndef POWER_CONFIG_DEFAULT_DCDCENHV
-#define POWER_CONFIG_DEFAULT_DCDCENHV 0
+#ifndef APP_SAADC_BENCH_CONFIG_BUFFER_SIZE
+#define APP_SAADC_BENCH_CONFIG_BUFFER_SIZE 128
+#endif
+
+// <o> APP_SAADC_BENCH_CONFIG_BUFFER_COUNT - Number of buffers in the benchmark pool. 
+
+
+#ifndef APP_SAADC_BENCH_CONFIG_BUFFER_COUNT
+#define APP_SAADC_BENCH_CONFIG_BUFFER_COUNT 4
 #endif
 
 // </e>
 
-// <q> PPI_ENABLED  - nrf_drv_ppi - PPI peripheral driver - legacy layer
+// <q> APP_SAADC_CALIB_ENABLED  - app_saadc_calib - SAADC offset calibration scheduler
  
 
-#ifndef PPI_ENABLED
-#define PPI_ENABLED 1
+#ifndef APP_SAADC_CALIB_ENABLED
+#define APP_SAADC_CALIB_ENABLED 0
 #endif
 
-// <e> PWM_ENABLED - nrf_drv_pwm - PWM peripheral driver - legacy layer
+// <e> APP_SAADC_FEATURES_ENABLED - app_saadc_features - SAADC spectral feature extraction stage
 //==========================================================
-#ifndef PWM_ENABLED
-#define PWM_ENABLED 0
+#ifndef APP_SAADC_FEATURES_ENABLED
+#define APP_SAADC_FEATURES_ENABLED 0
 #endif
-// <o> PWM_DEFAULT_CONFIG_OUT0_PIN - Out0 pin  <0-31> 
-
+// <o> APP_SAADC_FEATURES_FFT_LOG2  - Samples in each window
+ 
+// <6=> 64 
+// <7=> 128 
+// <8=> 256 
+// <9=> 512 
+// <10=> 1024 
 
-#ifndef PWM_DEFAULT_CONFIG_OUT0_PIN
-#define PWM_DEFAULT_CONFIG_OUT0_PIN 31
+#ifndef APP_SAADC_FEATURES_FFT_LOG2
+#define APP_SAADC_FEATURES_FFT_LOG2 8
 #endif
 
-// <o> PWM_DEFAULT_CONFIG_OUT1_PIN - Out1 pin  <0-31> 
+// <o> APP_SAADC_FEATURES_BANDS_MAX - Maximum number of spectral bands in a frame.  <1-31> 
 
 
-#ifndef PWM_DEFAULT_CONFIG_OUT1_PIN
-#define PWM_DEFAULT_CONFIG_OUT1_PIN 31
+#ifndef APP_SAADC_FEATURES_BANDS_MAX
+#define APP_SAADC_FEATURES_BANDS_MAX 8
 #endif
 
-// <o> PWM_DEFAULT_CONFIG_OUT2_PIN - Out2 pin  <0-31> 
+// </e>
+
+// <e> APP_SAADC_FILTER_ENABLED - app_saadc_filter - SAADC decimation and filter stage
+//==========================================================
+#ifndef APP_SAADC_FILTER_ENABLED
+#define APP_SAADC_FILTER_ENABLED 0
+#endif
+// <o> APP_SAADC_FILTER_MAX_TAPS - Maximum number of FIR coefficients per channel.  <1-64> 
 
 
-#ifndef PWM_DEFAULT_CONFIG_OUT2_PIN
-#define PWM_DEFAULT_CONFIG_OUT2_PIN 31
+#ifndef APP_SAADC_FILTER_MAX_TAPS
+#define APP_SAADC_FILTER_MAX_TAPS 16
 #endif
 
-// <o> PWM_DEFAULT_CONFIG_OUT3_PIN - Out3 pin  <0-31> 
+// </e>
 
+// <e> APP_SAADC_LITE_ENABLED - app_saadc_lite - Compile-time configured SAADC driver
 
-#ifndef PWM_DEFAULT_CONFIG_OUT3_PIN
-#define PWM_DEFAULT_CONFIG_OUT3_PIN 31
+// <i> Replaces nrfx_saadc, which app_saadc and its companion modules are built on. The build
+// <i> fails unless NRFX_SAADC_ENABLED is 0.
+//==========================================================
+#ifndef APP_SAADC_LITE_ENABLED
+#define APP_SAADC_LITE_ENABLED 0
 #endif
+// <o> APP_SAADC_LITE_CONFIG_CHANNEL_MASK - Mask of the SAADC channels converted.  <0x01-0xFF> 
 
-// <o> PWM_DEFAULT_CONFIG_BASE_CLOCK  - Base clock
- 
-// <0=> 16 MHz 
-// <1=> 8 MHz 
-// <2=> 4 MHz 
-// <3=> 2 MHz 
-// <4=> 1 MHz 
-// <5=> 500 kHz 
-// <6=> 250 kHz 
-// <7=> 125 kHz 
 
-#ifndef PWM_DEFAULT_CONFIG_BASE_CLOCK
-#define PWM_DEFAULT_CONFIG_BASE_CLOCK 4
+#ifndef APP_SAADC_LITE_CONFIG_CHANNEL_MASK
+#define APP_SAADC_LITE_CONFIG_CHANNEL_MASK 0x01
 #endif
 
-// <o> PWM_DEFAULT_CONFIG_COUNT_MODE  - Count mode
- 
-// <0=> Up 
-// <1=> Up and Down 
+// <o> APP_SAADC_LITE_CONFIG_FRAMES - Number of sample frames in each buffer.  <1-4096> 
 
-#ifndef PWM_DEFAULT_CONFIG_COUNT_MODE
-#define PWM_DEFAULT_CONFIG_COUNT_MODE 0
-#endif
 
-// <o> PWM_DEFAULT_CONFIG_TOP_VALUE - Top value 
-#ifndef PWM_DEFAULT_CONFIG_TOP_VALUE
-#define PWM_DEFAULT_CONFIG_TOP_VALUE 1000
+#ifndef APP_SAADC_LITE_CONFIG_FRAMES
+#define APP_SAADC_LITE_CONFIG_FRAMES 64
 #endif
 
-// <o> PWM_DEFAULT_CONFIG_LOAD_MODE  - Load mode
+// <o> APP_SAADC_LITE_CONFIG_RESOLUTION  - Resolution
  
-// <0=> Common 
-// <1=> Grouped 
-// <2=> Individual 
-// <3=> Waveform 
+// <0=> 8 bit 
+// <1=> 10 bit 
+// <2=> 12 bit 
+// <3=> 14 bit 
 
-#ifndef PWM_DEFAULT_CONFIG_LOAD_MODE
-#define PWM_DEFAULT_CONFIG_LOAD_MODE 0
+#ifndef APP_SAADC_LITE_CONFIG_RESOLUTION
+#define APP_SAADC_LITE_CONFIG_RESOLUTION 2
 #endif
 
-// <o> PWM_DEFAULT_CONFIG_STEP_MODE  - Step mode
+// <o> APP_SAADC_LITE_CONFIG_OVERSAMPLE  - Sample period
  
-// <0=> Auto 
-// <1=> Triggered 
+// <0=> Disabled 
+// <1=> 2x 
+// <2=> 4x 
+// <3=> 8x 
+// <4=> 16x 
+// <5=> 32x 
+// <6=> 64x 
+// <7=> 128x 
+// <8=> 256x 
 
-#ifndef PWM_DEFAULT_CONFIG_STEP_MODE
-#define PWM_DEFAULT_CONFIG_STEP_MODE 0
+#ifndef APP_SAADC_LITE_CONFIG_OVERSAMPLE
+#define APP_SAADC_LITE_CONFIG_OVERSAMPLE 0
 #endif
 
-// <o> PWM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> APP_SAADC_LITE_CONFIG_SAMPLERATE_CC - Internal sample rate timer compare value, 0 for an external trigger.  <0-2047> 
+
+
+// <i> Sample rate is 16 MHz / CC, CC must be at least 80. Only with a single channel.
+
+#ifndef APP_SAADC_LITE_CONFIG_SAMPLERATE_CC
+#define APP_SAADC_LITE_CONFIG_SAMPLERATE_CC 0
+#endif
+
+// <o> APP_SAADC_LITE_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 
 // <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
@@ -5161,329 +7839,291 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef PWM_DEFAULT_CONFIG_IRQ_PRIORITY
-#define PWM_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_SAADC_LITE_CONFIG_IRQ_PRIORITY
+#define APP_SAADC_LITE_CONFIG_IRQ_PRIORITY 6
 #endif
 
-// <q> PWM0_ENABLED  - Enable PWM0 instance
- 
+// </e>
 
-#ifndef PWM0_ENABLED
-#define PWM0_ENABLED 0
-#endif
+// <e> APP_SAADC_LOG_ENABLED - app_saadc_log - SAADC flash streaming logger
 
-// <q> PWM1_ENABLED  - Enable PWM1 instance
- 
+// <i> Appends SAADC buffers to a ring of flash pages through nrf_fstorage, directly from the
+// <i> buffers, and reads them back for replay over NUS or OTS.
+//==========================================================
+#ifndef APP_SAADC_LOG_ENABLED
+#define APP_SAADC_LOG_ENABLED 0
+#endif
+// <o> APP_SAADC_LOG_START_ADDR - Address of the first flash page. Must be page aligned, and not used by FDS, BLE_OTS_FLASH or the application.
+#ifndef APP_SAADC_LOG_START_ADDR
+#define APP_SAADC_LOG_START_ADDR 0xC0000
+#endif
 
-#ifndef PWM1_ENABLED
-#define PWM1_ENABLED 0
+// <o> APP_SAADC_LOG_PAGES - Number of 4 kB flash pages. <2-256> 
+#ifndef APP_SAADC_LOG_PAGES
+#define APP_SAADC_LOG_PAGES 32
 #endif
 
-// <q> PWM2_ENABLED  - Enable PWM2 instance
- 
+// <o> APP_SAADC_LOG_QUEUE_SIZE - Number of buffers waiting to be written. <1-32> 
 
-#ifndef PWM2_ENABLED
-#define PWM2_ENABLED 0
+
+// <i> Buffers appended while the queue is full are not logged. At least the number of
+// <i> pool buffers that can be in use by the logger at a time.
+
+#ifndef APP_SAADC_LOG_QUEUE_SIZE
+#define APP_SAADC_LOG_QUEUE_SIZE 4
 #endif
 
-// <q> PWM3_ENABLED  - Enable PWM3 instance
+// <q> APP_SAADC_LOG_CONFIG_OTS_BACKEND  - Provide the log as a read-only Object Transfer Service backend.
  
 
-#ifndef PWM3_ENABLED
-#define PWM3_ENABLED 0
+#ifndef APP_SAADC_LOG_CONFIG_OTS_BACKEND
+#define APP_SAADC_LOG_CONFIG_OTS_BACKEND 0
 #endif
 
 // </e>
 
-// <e> QDEC_ENABLED - nrf_drv_qdec - QDEC peripheral driver - legacy layer
+// <e> APP_SAADC_MULTIRATE_ENABLED - app_saadc_multirate - SAADC multi-rate channel scheduling
 //==========================================================
-#ifndef QDEC_ENABLED
-#define QDEC_ENABLED 0
+#ifndef APP_SAADC_MULTIRATE_ENABLED
+#define APP_SAADC_MULTIRATE_ENABLED 0
 #endif
-// <o> QDEC_CONFIG_REPORTPER  - Report period
+// <o> APP_SAADC_MULTIRATE_CONFIG_TIMER_INSTANCE  - TIMER instance counting the SAMPLE tasks.
  
-// <0=> 10 Samples 
-// <1=> 40 Samples 
-// <2=> 80 Samples 
-// <3=> 120 Samples 
-// <4=> 160 Samples 
-// <5=> 200 Samples 
-// <6=> 240 Samples 
-// <7=> 280 Samples 
+// <i> The instance must be enabled in the nrfx_timer configuration.
+// <0=> 0 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
 
-#ifndef QDEC_CONFIG_REPORTPER
-#define QDEC_CONFIG_REPORTPER 0
+#ifndef APP_SAADC_MULTIRATE_CONFIG_TIMER_INSTANCE
+#define APP_SAADC_MULTIRATE_CONFIG_TIMER_INSTANCE 3
 #endif
 
-// <o> QDEC_CONFIG_SAMPLEPER  - Sample period
+// <o> APP_SAADC_MULTIRATE_CONFIG_IRQ_PRIORITY  - Priority of the interrupt applying the schedule changes.
  
-// <0=> 128 us 
-// <1=> 256 us 
-// <2=> 512 us 
-// <3=> 1024 us 
-// <4=> 2048 us 
-// <5=> 4096 us 
-// <6=> 8192 us 
-// <7=> 16384 us 
+// <i> Must be higher (numerically lower) than the SAADC interrupt priority. The interrupt waits
+// <i> for the scan in progress to end before writing a change, up to one scan plus the guard time.
+// <0=> 0 (highest) 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
 
-#ifndef QDEC_CONFIG_SAMPLEPER
-#define QDEC_CONFIG_SAMPLEPER 7
+#ifndef APP_SAADC_MULTIRATE_CONFIG_IRQ_PRIORITY
+#define APP_SAADC_MULTIRATE_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <o> QDEC_CONFIG_PIO_A - A pin  <0-31> 
+// <o> APP_SAADC_MULTIRATE_CONFIG_GUARD_US - Time that must be left before the next SAMPLE task to write a change, in microseconds.  <1-100> 
 
+// <i> Only used with the TIMER trigger. With the RTC trigger, one whole tick must be left.
 
-#ifndef QDEC_CONFIG_PIO_A
-#define QDEC_CONFIG_PIO_A 31
+#ifndef APP_SAADC_MULTIRATE_CONFIG_GUARD_US
+#define APP_SAADC_MULTIRATE_CONFIG_GUARD_US 2
 #endif
 
-// <o> QDEC_CONFIG_PIO_B - B pin  <0-31> 
-
+// <o> APP_SAADC_MULTIRATE_MAX_STEPS - Maximum number of changes of the enabled channels in a schedule period.  <2-64> 
 
-#ifndef QDEC_CONFIG_PIO_B
-#define QDEC_CONFIG_PIO_B 31
+#ifndef APP_SAADC_MULTIRATE_MAX_STEPS
+#define APP_SAADC_MULTIRATE_MAX_STEPS 16
 #endif
 
-// <o> QDEC_CONFIG_PIO_LED - LED pin  <0-31> 
-
+// <o> APP_SAADC_MULTIRATE_LATE_LOG_SIZE  - Number of late changes recorded before the scan stream is split.
+ 
+// <i> A full log resynchronizes the scan stream on the next buffer.
+// <4=> 4 
+// <8=> 8 
+// <16=> 16 
+// <32=> 32 
 
-#ifndef QDEC_CONFIG_PIO_LED
-#define QDEC_CONFIG_PIO_LED 31
+#ifndef APP_SAADC_MULTIRATE_LATE_LOG_SIZE
+#define APP_SAADC_MULTIRATE_LATE_LOG_SIZE 16
 #endif
 
-// <o> QDEC_CONFIG_LEDPRE - LED pre 
-#ifndef QDEC_CONFIG_LEDPRE
-#define QDEC_CONFIG_LEDPRE 511
-#endif
+// </e>
 
-// <o> QDEC_CONFIG_LEDPOL  - LED polarity
+// <q> APP_SAADC_PACK_ENABLED  - app_saadc_pack - SAADC sample buffer encoder
  
-// <0=> Active low 
-// <1=> Active high 
 
-#ifndef QDEC_CONFIG_LEDPOL
-#define QDEC_CONFIG_LEDPOL 1
+#ifndef APP_SAADC_PACK_ENABLED
+#define APP_SAADC_PACK_ENABLED 0
 #endif
 
-// <q> QDEC_CONFIG_DBFEN  - Debouncing enable
- 
-
-#ifndef QDEC_CONFIG_DBFEN
-#define QDEC_CONFIG_DBFEN 0
+// <e> APP_SCHEDULER_ENABLED - app_scheduler - Events scheduler
+//==========================================================
+#ifndef APP_SCHEDULER_ENABLED
+#define APP_SCHEDULER_ENABLED 1
 #endif
-
-// <q> QDEC_CONFIG_SAMPLE_INTEN  - Sample ready interrupt enable
+// <q> APP_SCHEDULER_WITH_PAUSE  - Enabling pause feature
  
 
-#ifndef QDEC_CONFIG_SAMPLE_INTEN
-#define QDEC_CONFIG_SAMPLE_INTEN 0
+#ifndef APP_SCHEDULER_WITH_PAUSE
+#define APP_SCHEDULER_WITH_PAUSE 0
 #endif
 
-// <o> QDEC_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <q> APP_SCHEDULER_WITH_PROFILER  - Enabling scheduler profiling
  
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
-
-#ifndef QDEC_CONFIG_IRQ_PRIORITY
-#define QDEC_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_SCHEDULER_WITH_PROFILER
+#define APP_SCHEDULER_WITH_PROFILER 0
 #endif
 
 // </e>
 
-// <e> QSPI_ENABLED - nrf_drv_qspi - QSPI peripheral driver - legacy layer
+// <e> APP_SCHED_PRIO_ENABLED - app_sched_prio - Scheduler with priority levels
 //==========================================================
-#ifndef QSPI_ENABLED
-#define QSPI_ENABLED 0
-#endif
-// <o> QSPI_CONFIG_SCK_DELAY - tSHSL, tWHSL and tSHWL in number of 16 MHz periods (62.5 ns).  <0-255> 
-
-
-#ifndef QSPI_CONFIG_SCK_DELAY
-#define QSPI_CONFIG_SCK_DELAY 1
+#ifndef APP_SCHED_PRIO_ENABLED
+#define APP_SCHED_PRIO_ENABLED 0
 #endif
+// <o> APP_SCHED_PRIO_EVENT_SIZE - Maximum size of event data in bytes <4-255> 
 
-// <o> QSPI_CONFIG_XIP_OFFSET - Address offset in the external memory for Execute in Place operation. 
-#ifndef QSPI_CONFIG_XIP_OFFSET
-#define QSPI_CONFIG_XIP_OFFSET 0
+#ifndef APP_SCHED_PRIO_EVENT_SIZE
+#define APP_SCHED_PRIO_EVENT_SIZE 16
 #endif
 
-// <o> QSPI_CONFIG_READOC  - Number of data lines and opcode used for reading.
- 
-// <0=> FastRead 
-// <1=> Read2O 
-// <2=> Read2IO 
-// <3=> Read4O 
-// <4=> Read4IO 
+// <o> APP_SCHED_PRIO_AGING_MS - Waiting time after which an event runs before higher levels in milliseconds <0-10000> 
+// <i> 0 disables aging.
 
-#ifndef QSPI_CONFIG_READOC
-#define QSPI_CONFIG_READOC 0
+#ifndef APP_SCHED_PRIO_AGING_MS
+#define APP_SCHED_PRIO_AGING_MS 50
 #endif
 
-// <o> QSPI_CONFIG_WRITEOC  - Number of data lines and opcode used for writing.
- 
-// <0=> PP 
-// <1=> PP2O 
-// <2=> PP4O 
-// <3=> PP4IO 
+// <o> APP_SCHED_PRIO_HIGH_QUEUE_SIZE - Events in the high level queue <1-255> 
 
-#ifndef QSPI_CONFIG_WRITEOC
-#define QSPI_CONFIG_WRITEOC 0
+#ifndef APP_SCHED_PRIO_HIGH_QUEUE_SIZE
+#define APP_SCHED_PRIO_HIGH_QUEUE_SIZE 8
 #endif
 
-// <o> QSPI_CONFIG_ADDRMODE  - Addressing mode.
- 
-// <0=> 24bit 
-// <1=> 32bit 
+// <o> APP_SCHED_PRIO_HIGH_BUDGET - Events run by the high level in a pass <0-255> 
+// <i> 0 runs all events of the level before the lower levels.
 
-#ifndef QSPI_CONFIG_ADDRMODE
-#define QSPI_CONFIG_ADDRMODE 0
+#ifndef APP_SCHED_PRIO_HIGH_BUDGET
+#define APP_SCHED_PRIO_HIGH_BUDGET 0
 #endif
 
-// <o> QSPI_CONFIG_MODE  - SPI mode.
- 
-// <0=> Mode 0 
-// <1=> Mode 1 
+// <o> APP_SCHED_PRIO_NORMAL_QUEUE_SIZE - Events in the normal level queue <1-255> 
 
-#ifndef QSPI_CONFIG_MODE
-#define QSPI_CONFIG_MODE 0
+#ifndef APP_SCHED_PRIO_NORMAL_QUEUE_SIZE
+#define APP_SCHED_PRIO_NORMAL_QUEUE_SIZE 16
 #endif
 
-// <o> QSPI_CONFIG_FREQUENCY  - Frequency divider.
- 
-// <0=> 32MHz/1 
-// <1=> 32MHz/2 
-// <2=> 32MHz/3 
-// <3=> 32MHz/4 
-// <4=> 32MHz/5 
-// <5=> 32MHz/6 
-// <6=> 32MHz/7 
-// <7=> 32MHz/8 
-// <8=> 32MHz/9 
-// <9=> 32MHz/10 
-// <10=> 32MHz/11 
-// <11=> 32MHz/12 
-// <12=> 32MHz/13 
-// <13=> 32MHz/14 
-// <14=> 32MHz/15 
-// <15=> 32MHz/16 
+// <o> APP_SCHED_PRIO_NORMAL_BUDGET - Events run by the normal level in a pass <0-255> 
 
-#ifndef QSPI_CONFIG_FREQUENCY
-#define QSPI_CONFIG_FREQUENCY 15
+#ifndef APP_SCHED_PRIO_NORMAL_BUDGET
+#define APP_SCHED_PRIO_NORMAL_BUDGET 4
 #endif
 
-// <s> QSPI_PIN_SCK - SCK pin value.
-#ifndef QSPI_PIN_SCK
-#define QSPI_PIN_SCK NRF_QSPI_PIN_NOT_CONNECTED
-#endif
+// <o> APP_SCHED_PRIO_LOW_QUEUE_SIZE - Events in the low level queue <1-255> 
 
-// <s> QSPI_PIN_CSN - CSN pin value.
-#ifndef QSPI_PIN_CSN
-#define QSPI_PIN_CSN NRF_QSPI_PIN_NOT_CONNECTED
+#ifndef APP_SCHED_PRIO_LOW_QUEUE_SIZE
+#define APP_SCHED_PRIO_LOW_QUEUE_SIZE 16
 #endif
 
-// <s> QSPI_PIN_IO0 - IO0 pin value.
-#ifndef QSPI_PIN_IO0
-#define QSPI_PIN_IO0 NRF_QSPI_PIN_NOT_CONNECTED
-#endif
+// <o> APP_SCHED_PRIO_LOW_BUDGET - Events run by the low level in a pass <0-255> 
 
-// <s> QSPI_PIN_IO1 - IO1 pin value.
-#ifndef QSPI_PIN_IO1
-#define QSPI_PIN_IO1 NRF_QSPI_PIN_NOT_CONNECTED
+#ifndef APP_SCHED_PRIO_LOW_BUDGET
+#define APP_SCHED_PRIO_LOW_BUDGET 2
 #endif
 
-// <s> QSPI_PIN_IO2 - IO2 pin value.
-#ifndef QSPI_PIN_IO2
-#define QSPI_PIN_IO2 NRF_QSPI_PIN_NOT_CONNECTED
-#endif
+// <o> APP_SCHED_PRIO_APP_TIMER_LEVEL  - Level of app_timer timeouts
+ 
+// <0=> High 
+// <1=> Normal 
+// <2=> Low 
 
-// <s> QSPI_PIN_IO3 - IO3 pin value.
-#ifndef QSPI_PIN_IO3
-#define QSPI_PIN_IO3 NRF_QSPI_PIN_NOT_CONNECTED
+#ifndef APP_SCHED_PRIO_APP_TIMER_LEVEL
+#define APP_SCHED_PRIO_APP_TIMER_LEVEL 1
 #endif
 
-// <o> QSPI_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> APP_SCHED_PRIO_SDH_LEVEL  - Level of SoftDevice events
  
+// <0=> High 
+// <1=> Normal 
+// <2=> Low 
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+#ifndef APP_SCHED_PRIO_SDH_LEVEL
+#define APP_SCHED_PRIO_SDH_LEVEL 2
+#endif
 
-#ifndef QSPI_CONFIG_IRQ_PRIORITY
-#define QSPI_CONFIG_IRQ_PRIORITY 2
+// <o> APP_SCHED_PRIO_PWR_MGMT_LEVEL  - Level of nrf_pwr_mgmt shutdown
+ 
+// <0=> High 
+// <1=> Normal 
+// <2=> Low 
+
+#ifndef APP_SCHED_PRIO_PWR_MGMT_LEVEL
+#define APP_SCHED_PRIO_PWR_MGMT_LEVEL 2
 #endif
 
 // </e>
 
-// <e> RNG_ENABLED - nrf_drv_rng - RNG peripheral driver - legacy layer
+// <e> APP_SDCARD_ENABLED - app_sdcard - SD/MMC card support using SPI
 //==========================================================
-#ifndef RNG_ENABLED
-#define RNG_ENABLED 0
+#ifndef APP_SDCARD_ENABLED
+#define APP_SDCARD_ENABLED 0
 #endif
-// <q> RNG_CONFIG_ERROR_CORRECTION  - Error correction
+// <o> APP_SDCARD_SPI_INSTANCE  - SPI instance used
  
+// <0=> 0 
+// <1=> 1 
+// <2=> 2 
 
-#ifndef RNG_CONFIG_ERROR_CORRECTION
-#define RNG_CONFIG_ERROR_CORRECTION 1
+#ifndef APP_SDCARD_SPI_INSTANCE
+#define APP_SDCARD_SPI_INSTANCE 0
 #endif
 
-// <o> RNG_CONFIG_POOL_SIZE - Pool size 
-#ifndef RNG_CONFIG_POOL_SIZE
-#define RNG_CONFIG_POOL_SIZE 64
+// <o> APP_SDCARD_FREQ_INIT  - SPI frequency
+ 
+// <33554432=> 125 kHz 
+// <67108864=> 250 kHz 
+// <134217728=> 500 kHz 
+// <268435456=> 1 MHz 
+// <536870912=> 2 MHz 
+// <1073741824=> 4 MHz 
+// <2147483648=> 8 MHz 
+
+#ifndef APP_SDCARD_FREQ_INIT
+#define APP_SDCARD_FREQ_INIT 67108864
 #endif
 
-// <o> RNG_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> APP_SDCARD_FREQ_DATA  - SPI frequency
  
+// <33554432=> 125 kHz 
+// <67108864=> 250 kHz 
+// <134217728=> 500 kHz 
+// <268435456=> 1 MHz 
+// <536870912=> 2 MHz 
+// <1073741824=> 4 MHz 
+// <2147483648=> 8 MHz 
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
-
-#ifndef RNG_CONFIG_IRQ_PRIORITY
-#define RNG_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_SDCARD_FREQ_DATA
+#define APP_SDCARD_FREQ_DATA 1073741824
 #endif
 
 // </e>
 
-// <e> RTC_ENABLED - nrf_drv_rtc - RTC peripheral driver - legacy layer
+// <e> APP_TIMER_ENABLED - app_timer - Application timer functionality
 //==========================================================
-#ifndef RTC_ENABLED
-#define RTC_ENABLED 1
-#endif
-// <o> RTC_DEFAULT_CONFIG_FREQUENCY - Frequency  <16-32768> 
-
-
-#ifndef RTC_DEFAULT_CONFIG_FREQUENCY
-#define RTC_DEFAULT_CONFIG_FREQUENCY 32768
+#ifndef APP_TIMER_ENABLED
+#define APP_TIMER_ENABLED 1
 #endif
-
-// <q> RTC_DEFAULT_CONFIG_RELIABLE  - Ensures safe compare event triggering
+// <o> APP_TIMER_CONFIG_RTC_FREQUENCY  - Configure RTC prescaler.
  
+// <0=> 32768 Hz 
+// <1=> 16384 Hz 
+// <3=> 8192 Hz 
+// <7=> 4096 Hz 
+// <15=> 2048 Hz 
+// <31=> 1024 Hz 
 
-#ifndef RTC_DEFAULT_CONFIG_RELIABLE
-#define RTC_DEFAULT_CONFIG_RELIABLE 0
+#ifndef APP_TIMER_CONFIG_RTC_FREQUENCY
+#define APP_TIMER_CONFIG_RTC_FREQUENCY 1
 #endif
 
-// <o> RTC_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> APP_TIMER_CONFIG_IRQ_PRIORITY  - Interrupt priority
  
 
 // <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
@@ -5496,1373 +8136,1426 @@
 // <6=> 6 
 // <7=> 7 
 
-#ifndef RTC_DEFAULT_CONFIG_IRQ_PRIORITY
-#define RTC_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_TIMER_CONFIG_IRQ_PRIORITY
+#define APP_TIMER_CONFIG_IRQ_PRIORITY 2
 #endif
 
-// <q> RTC0_ENABLED  - Enable RTC0 instance
- 
+// <o> APP_TIMER_CONFIG_OP_QUEUE_SIZE - Capacity of timer requests queue. 
+// <i> Size of the queue depends on how many timers are used
+// <i> in the system, how often timers are started and overall
+// <i> system latency. If queue size is too small app_timer calls
+// <i> will fail.
 
-#ifndef RTC0_ENABLED
-#define RTC0_ENABLED 0
+#ifndef APP_TIMER_CONFIG_OP_QUEUE_SIZE
+#define APP_TIMER_CONFIG_OP_QUEUE_SIZE 10
 #endif
 
-// <q> RTC1_ENABLED  - Enable RTC1 instance
+// <q> APP_TIMER_CONFIG_USE_SCHEDULER  - Enable scheduling app_timer events to app_scheduler
  
 
-#ifndef RTC1_ENABLED
-#define RTC1_ENABLED 0
+#ifndef APP_TIMER_CONFIG_USE_SCHEDULER
+#define APP_TIMER_CONFIG_USE_SCHEDULER 0
 #endif
 
-// <q> RTC2_ENABLED  - Enable RTC2 instance
+// <q> APP_TIMER_KEEPS_RTC_ACTIVE  - Enable RTC always on
  
 
-#ifndef RTC2_ENABLED
-#define RTC2_ENABLED 1
+// <i> If option is enabled RTC is kept running even if there is no active timers.
+// <i> This option can be used when app_timer is used for timestamping.
+
+#ifndef APP_TIMER_KEEPS_RTC_ACTIVE
+#define APP_TIMER_KEEPS_RTC_ACTIVE 0
 #endif
 
-// <o> NRF_MAXIMUM_LATENCY_US - Maximum possible time[us] in highest priority interrupt 
-#ifndef NRF_MAXIMUM_LATENCY_US
-#define NRF_MAXIMUM_LATENCY_US 2000
+// <o> APP_TIMER_SAFE_WINDOW_MS - Maximum possible latency (in milliseconds) of handling app_timer event. 
+// <i> Maximum possible timeout that can be set is reduced by safe window.
+// <i> Example: RTC frequency 16384 Hz, maximum possible timeout 1024 seconds - APP_TIMER_SAFE_WINDOW_MS.
+// <i> Since RTC is not stopped when processor is halted in debugging session, this value
+// <i> must cover it if debugging is needed. It is possible to halt processor for APP_TIMER_SAFE_WINDOW_MS
+// <i> without corrupting app_timer behavior.
+
+#ifndef APP_TIMER_SAFE_WINDOW_MS
+#define APP_TIMER_SAFE_WINDOW_MS 300000
 #endif
 
-// Error handling
-#define APP_ERROR_CHECK_ENABLED 1
+// <o> APP_TIMER_CONFIG_RTC_CHANNELS - Number of RTC compare channels used for active timers.  <1-3> 
+// <i> Timers with the shortest timeouts are kept in RTC compare channels 0, 2 and 3 at the
+// <i> same time, so expiries close to each other do not wait for RTC reconfiguration.
+// <i> Channel 1 is always used internally.
 
-// GPIO and delay
-#define NRFX_GPIOTE_ENABLED 1
-#define GPIOTE_ENABLED 1
+#ifndef APP_TIMER_CONFIG_RTC_CHANNELS
+#define APP_TIMER_CONFIG_RTC_CHANNELS 1
+#endif
 
-// </e>
-// <e> SAADC_ENABLED - nrf_drv_saadc - SAADC peripheral driver - legacy layer
+// <e> APP_TIMER_CONFIG_QUEUE_HEAP - Use binary heap for queue of active timers
+// <i> By default active timers are kept in a sorted list, which costs O(n) on every start.
+// <i> Heap based queue costs O(log n) on start, stop and expiry but requires static storage
+// <i> for the maximum number of simultaneously running timers.
 //==========================================================
-#ifndef SAADC_ENABLED
-#define SAADC_ENABLED 1
+#ifndef APP_TIMER_CONFIG_QUEUE_HEAP
+#define APP_TIMER_CONFIG_QUEUE_HEAP 0
 #endif
-// <o> SAADC_CONFIG_RESOLUTION  - Resolution
- 
-// <0=> 8 bit 
-// <1=> 10 bit 
-// <2=> 12 bit 
-// <3=> 14 bit 
+// <o> APP_TIMER_CONFIG_HEAP_SIZE - Maximum number of simultaneously running timers.  <1-255> 
 
-#ifndef SAADC_CONFIG_RESOLUTION
-#define SAADC_CONFIG_RESOLUTION 1
+
+// <i> Starting a timer when all entries are in use fails with NRF_ERROR_NO_MEM.
+
+#ifndef APP_TIMER_CONFIG_HEAP_SIZE
+#define APP_TIMER_CONFIG_HEAP_SIZE 32
 #endif
 
-// <o> SAADC_CONFIG_OVERSAMPLE  - Sample period
- 
-// <0=> Disabled 
-// <1=> 2x 
-// <2=> 4x 
-// <3=> 8x 
-// <4=> 16x 
-// <5=> 32x 
-// <6=> 64x 
-// <7=> 128x 
-// <8=> 256x 
+// </e>
 
-#ifndef SAADC_CONFIG_OVERSAMPLE
-#define SAADC_CONFIG_OVERSAMPLE 0
+// <e> APP_TIMER_CONFIG_COALESCE - Enable timers with expiry tolerance
+// <i> Timers started with app_timer_start_lazy expire within a slack window. Timers with
+// <i> overlapping windows are expired on a single RTC wakeup.
+//==========================================================
+#ifndef APP_TIMER_CONFIG_COALESCE
+#define APP_TIMER_CONFIG_COALESCE 0
 #endif
+// <o> APP_TIMER_CONFIG_COALESCE_TIMERS - Maximum number of timers running with slack.  <1-255> 
 
-// <q> SAADC_CONFIG_LP_MODE  - Enabling low power mode
- 
 
-#ifndef SAADC_CONFIG_LP_MODE
-#define SAADC_CONFIG_LP_MODE 0
+#ifndef APP_TIMER_CONFIG_COALESCE_TIMERS
+#define APP_TIMER_CONFIG_COALESCE_TIMERS 4
 #endif
 
-// <o> SAADC_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
+// </e>
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+// <e> APP_TIMER_CONFIG_BATCH_DISPATCH - Dispatch timeouts expired in one RTC interrupt together
+// <i> Expired timers are collected and their handlers are called in one pass at the end of
+// <i> RTC interrupt or, if APP_TIMER_CONFIG_USE_SCHEDULER is enabled, from a single
+// <i> app_scheduler event.
+//==========================================================
+#ifndef APP_TIMER_CONFIG_BATCH_DISPATCH
+#define APP_TIMER_CONFIG_BATCH_DISPATCH 0
+#endif
+// <o> APP_TIMER_CONFIG_BATCH_SIZE - Maximum number of expired timers waiting for dispatch.  <2-255> 
 
-#ifndef SAADC_CONFIG_IRQ_PRIORITY
-#define SAADC_CONFIG_IRQ_PRIORITY 2
+
+#ifndef APP_TIMER_CONFIG_BATCH_SIZE
+#define APP_TIMER_CONFIG_BATCH_SIZE 16
 #endif
 
 // </e>
 
-// <e> SPIS_ENABLED - nrf_drv_spis - SPIS peripheral driver - legacy layer
+// <e> APP_TIMER_CONFIG_HIRES - Enable high resolution timers
+// <i> Timers created with app_timer_hires_create are served by a TIMER peripheral with
+// <i> 1 us resolution. Selected TIMER instance must be enabled in nrfx_timer configuration.
 //==========================================================
-#ifndef SPIS_ENABLED
-#define SPIS_ENABLED 0
+#ifndef APP_TIMER_CONFIG_HIRES
+#define APP_TIMER_CONFIG_HIRES 0
 #endif
-// <o> SPIS_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> APP_TIMER_CONFIG_HIRES_TIMER_INSTANCE  - TIMER instance used for high resolution timers.
+// <i> Number of high resolution timers is the number of compare channels of the instance minus one.
  
-
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
+// <0=> 0 
 // <1=> 1 
 // <2=> 2 
 // <3=> 3 
 // <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef SPIS_DEFAULT_CONFIG_IRQ_PRIORITY
-#define SPIS_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_TIMER_CONFIG_HIRES_TIMER_INSTANCE
+#define APP_TIMER_CONFIG_HIRES_TIMER_INSTANCE 3
 #endif
 
-// <o> SPIS_DEFAULT_MODE  - Mode
- 
-// <0=> MODE_0 
-// <1=> MODE_1 
-// <2=> MODE_2 
-// <3=> MODE_3 
+// </e>
 
-#ifndef SPIS_DEFAULT_MODE
-#define SPIS_DEFAULT_MODE 0
+// <e> APP_TIMER_CONFIG_STATS - Enable per timer statistics
+// <i> Expiry lateness, handler run time in DWT cycles and fire count are recorded per timer
+// <i> and can be read with app_timer_stats_get or printed with app_timer_stats_log.
+//==========================================================
+#ifndef APP_TIMER_CONFIG_STATS
+#define APP_TIMER_CONFIG_STATS 0
 #endif
+// <o> APP_TIMER_CONFIG_STATS_TIMERS - Maximum number of timers with statistics.  <1-255> 
 
-// <o> SPIS_DEFAULT_BIT_ORDER  - SPIS default bit order
- 
-// <0=> MSB first 
-// <1=> LSB first 
 
-#ifndef SPIS_DEFAULT_BIT_ORDER
-#define SPIS_DEFAULT_BIT_ORDER 0
+#ifndef APP_TIMER_CONFIG_STATS_TIMERS
+#define APP_TIMER_CONFIG_STATS_TIMERS 8
 #endif
 
-// <o> SPIS_DEFAULT_DEF - SPIS default DEF character  <0-255> 
+// </e>
+
+// <e> APP_TIMER_CONFIG_PHASE_LOCK - Enable phase-locked repeated timers
+// <i> Timers started with app_timer_start_phase_locked or app_timer_start_aligned expire on
+// <i> a fixed grid of anchor plus whole periods. Handler latency does not shift later expiries
+// <i> and missed expiries are skipped. The anchor can be taken from connection event timing.
+//==========================================================
+#ifndef APP_TIMER_CONFIG_PHASE_LOCK
+#define APP_TIMER_CONFIG_PHASE_LOCK 0
+#endif
+// <o> APP_TIMER_CONFIG_PHASE_LOCK_TIMERS - Maximum number of phase-locked timers.  <1-255> 
 
 
-#ifndef SPIS_DEFAULT_DEF
-#define SPIS_DEFAULT_DEF 255
+#ifndef APP_TIMER_CONFIG_PHASE_LOCK_TIMERS
+#define APP_TIMER_CONFIG_PHASE_LOCK_TIMERS 4
 #endif
 
-// <o> SPIS_DEFAULT_ORC - SPIS default ORC character  <0-255> 
+// </e>
 
+// <q> APP_TIMER_CONFIG_RAMFUNC_ENABLED  - Run the RTC interrupt path from RAM.
+ 
 
-#ifndef SPIS_DEFAULT_ORC
-#define SPIS_DEFAULT_ORC 255
+// <i> The RTC interrupt handler, the app_timer2.c functions it calls (timer queue and heap, compare slots,
+// <i> batch dispatch) and the drv_rtc accessors run from RAM and do not pay flash wait states. nrf_sortlist,
+// <i> nrf_atfifo (see NRF_ATFIFO_CONFIG_RAMFUNC_ENABLED), app_scheduler, the timeout handlers, logging,
+// <i> the profiler hooks, constants and the interrupt vector table stay in flash, so the interrupt still
+// <i> stalls while the NVMC erases or writes a page.
+// <i> The code is placed in the .ramfunc section, which must be present in the linker configuration.
+
+#ifndef APP_TIMER_CONFIG_RAMFUNC_ENABLED
+#define APP_TIMER_CONFIG_RAMFUNC_ENABLED 1
 #endif
 
-// <q> SPIS0_ENABLED  - Enable SPIS0 instance
+// <o> APP_TIMER_CONFIG_BASEPRI_CEILING  - Priority ceiling of the critical regions.
  
 
-#ifndef SPIS0_ENABLED
-#define SPIS0_ENABLED 0
+// <i> Critical regions of the module mask only interrupts with this priority or lower, using BASEPRI.
+// <i> The ceiling must not be above APP_TIMER_CONFIG_IRQ_PRIORITY, and app_timer must not be used from
+// <i> interrupts with a higher priority. With the SoftDevice, the ceiling must be 6 or 7. Disabled selects CRITICAL_REGION_ENTER.
+// <0=> Disabled 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef APP_TIMER_CONFIG_BASEPRI_CEILING
+#define APP_TIMER_CONFIG_BASEPRI_CEILING 0
 #endif
 
-// <q> SPIS1_ENABLED  - Enable SPIS1 instance
+// <h> App Timer Legacy configuration - Legacy configuration.
+
+//==========================================================
+// <q> APP_TIMER_WITH_PROFILER  - Enable app_timer profiling
  
 
-#ifndef SPIS1_ENABLED
-#define SPIS1_ENABLED 0
+#ifndef APP_TIMER_WITH_PROFILER
+#define APP_TIMER_WITH_PROFILER 0
 #endif
 
-// <q> SPIS2_ENABLED  - Enable SPIS2 instance
+// <q> APP_TIMER_CONFIG_SWI_NUMBER  - Configure SWI instance used.
  
 
-#ifndef SPIS2_ENABLED
-#define SPIS2_ENABLED 0
+#ifndef APP_TIMER_CONFIG_SWI_NUMBER
+#define APP_TIMER_CONFIG_SWI_NUMBER 0
 #endif
 
+// </h> 
+//==========================================================
+
 // </e>
 
-// <e> SPI_ENABLED - nrf_drv_spi - SPI/SPIM peripheral driver - legacy layer
+// <e> APP_TIMESYNC_ENABLED - app_timesync - Network time synchronization over radio timeslots
 //==========================================================
-#ifndef SPI_ENABLED
-#define SPI_ENABLED 0
+#ifndef APP_TIMESYNC_ENABLED
+#define APP_TIMESYNC_ENABLED 0
 #endif
-// <o> SPI_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> APP_TIMESYNC_CONFIG_TIMER_INSTANCE  - TIMER instance used as the local time base.
  
-
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
+// <i> The instance must be enabled in the nrfx_timer configuration. It runs at 1 MHz
+// <i> from the HFXO while synchronization is active.
+// <0=> 0 
 // <1=> 1 
 // <2=> 2 
 // <3=> 3 
 // <4=> 4 
+
+#ifndef APP_TIMESYNC_CONFIG_TIMER_INSTANCE
+#define APP_TIMESYNC_CONFIG_TIMER_INSTANCE 2
+#endif
+
+// <o> APP_TIMESYNC_CONFIG_IRQ_PRIORITY  - Priority of the SWI3 interrupt the events are reported from.
+ 
+// <2=> 2 
+// <3=> 3 
 // <5=> 5 
 // <6=> 6 
 // <7=> 7 
 
-#ifndef SPI_DEFAULT_CONFIG_IRQ_PRIORITY
-#define SPI_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_TIMESYNC_CONFIG_IRQ_PRIORITY
+#define APP_TIMESYNC_CONFIG_IRQ_PRIORITY 6
 #endif
 
-// <o> NRF_SPI_DRV_MISO_PULLUP_CFG  - MISO PIN pull-up configuration.
- 
-// <0=> NRF_GPIO_PIN_NOPULL 
-// <1=> NRF_GPIO_PIN_PULLDOWN 
-// <3=> NRF_GPIO_PIN_PULLUP 
+// <o> APP_TIMESYNC_CONFIG_RX_WINDOW_US - Receive window around the expected sync packet, in microseconds.  <200-20000> 
 
-#ifndef NRF_SPI_DRV_MISO_PULLUP_CFG
-#define NRF_SPI_DRV_MISO_PULLUP_CFG 1
+// <i> Must cover the scheduling jitter of the timeslots on both ends.
+
+#ifndef APP_TIMESYNC_CONFIG_RX_WINDOW_US
+#define APP_TIMESYNC_CONFIG_RX_WINDOW_US 2000
 #endif
 
-// <e> SPI0_ENABLED - Enable SPI0 instance
-//==========================================================
-#ifndef SPI0_ENABLED
-#define SPI0_ENABLED 0
+// <o> APP_TIMESYNC_CONFIG_RX_DELAY_US - Delay of the receive chain, from the end of the access address to the ADDRESS event, in microseconds.  <0-20> 
+
+#ifndef APP_TIMESYNC_CONFIG_RX_DELAY_US
+#define APP_TIMESYNC_CONFIG_RX_DELAY_US 9
 #endif
-// <q> SPI0_USE_EASY_DMA  - Use EasyDMA
- 
 
-#ifndef SPI0_USE_EASY_DMA
-#define SPI0_USE_EASY_DMA 1
+// <o> APP_TIMESYNC_CONFIG_MISS_LIMIT - Number of sync packets missed in a row before the lock is lost.  <1-255> 
+
+#ifndef APP_TIMESYNC_CONFIG_MISS_LIMIT
+#define APP_TIMESYNC_CONFIG_MISS_LIMIT 4
 #endif
 
 // </e>
 
-// <e> SPI1_ENABLED - Enable SPI1 instance
-//==========================================================
-#ifndef SPI1_ENABLED
-#define SPI1_ENABLED 0
-#endif
-// <q> SPI1_USE_EASY_DMA  - Use EasyDMA
+// <q> APP_USBD_AUDIO_ENABLED  - app_usbd_audio - USB AUDIO class
  
 
-#ifndef SPI1_USE_EASY_DMA
-#define SPI1_USE_EASY_DMA 1
+#ifndef APP_USBD_AUDIO_ENABLED
+#define APP_USBD_AUDIO_ENABLED 0
 #endif
 
-// </e>
-
-// <e> SPI2_ENABLED - Enable SPI2 instance
+// <e> APP_USBD_ENABLED - app_usbd - USB Device library
 //==========================================================
-#ifndef SPI2_ENABLED
-#define SPI2_ENABLED 0
+#ifndef APP_USBD_ENABLED
+#define APP_USBD_ENABLED 0
 #endif
-// <q> SPI2_USE_EASY_DMA  - Use EasyDMA
- 
+// <o> APP_USBD_VID - Vendor ID.  <0x0000-0xFFFF> 
 
-#ifndef SPI2_USE_EASY_DMA
-#define SPI2_USE_EASY_DMA 1
+
+// <i> Note: This value is not editable in Configuration Wizard.
+// <i> Vendor ID ordered from USB IF: http://www.usb.org/developers/vendor/
+
+#ifndef APP_USBD_VID
+#define APP_USBD_VID 0
 #endif
 
-// </e>
+// <o> APP_USBD_PID - Product ID.  <0x0000-0xFFFF> 
 
-// </e>
 
-// <e> TIMER_ENABLED - nrf_drv_timer - TIMER periperal driver - legacy layer
-//==========================================================
-#ifndef TIMER_ENABLED
-#define TIMER_ENABLED 0
-#endif
-// <o> TIMER_DEFAULT_CONFIG_FREQUENCY  - Timer frequency if in Timer mode
- 
-// <0=> 16 MHz 
-// <1=> 8 MHz 
-// <2=> 4 MHz 
-// <3=> 2 MHz 
-// <4=> 1 MHz 
-// <5=> 500 kHz 
-// <6=> 250 kHz 
-// <7=> 125 kHz 
-// <8=> 62.5 kHz 
-// <9=> 31.25 kHz 
+// <i> Note: This value is not editable in Configuration Wizard.
+// <i> Selected Product ID
 
-#ifndef TIMER_DEFAULT_CONFIG_FREQUENCY
-#define TIMER_DEFAULT_CONFIG_FREQUENCY 0
+#ifndef APP_USBD_PID
+#define APP_USBD_PID 0
 #endif
 
-// <o> TIMER_DEFAULT_CONFIG_MODE  - Timer mode or operation
- 
-// <0=> Timer 
-// <1=> Counter 
+// <o> APP_USBD_DEVICE_VER_MAJOR - Major device version  <0-99> 
 
-#ifndef TIMER_DEFAULT_CONFIG_MODE
-#define TIMER_DEFAULT_CONFIG_MODE 0
-#endif
 
-// <o> TIMER_DEFAULT_CONFIG_BIT_WIDTH  - Timer counter bit width
- 
-// <0=> 16 bit 
-// <1=> 8 bit 
-// <2=> 24 bit 
-// <3=> 32 bit 
+// <i> Major device version, will be converted automatically to BCD notation. Use just decimal values.
 
-#ifndef TIMER_DEFAULT_CONFIG_BIT_WIDTH
-#define TIMER_DEFAULT_CONFIG_BIT_WIDTH 0
+#ifndef APP_USBD_DEVICE_VER_MAJOR
+#define APP_USBD_DEVICE_VER_MAJOR 1
 #endif
 
-// <o> TIMER_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
+// <o> APP_USBD_DEVICE_VER_MINOR - Minor device version  <0-9> 
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
 
-#ifndef TIMER_DEFAULT_CONFIG_IRQ_PRIORITY
-#define TIMER_DEFAULT_CONFIG_IRQ_PRIORITY 2
+// <i> Minor device version, will be converted automatically to BCD notation. Use just decimal values.
+
+#ifndef APP_USBD_DEVICE_VER_MINOR
+#define APP_USBD_DEVICE_VER_MINOR 0
 #endif
 
-// <q> TIMER0_ENABLED  - Enable TIMER0 instance
- 
+// <o> APP_USBD_DEVICE_VER_SUB - Sub-minor device version  <0-9> 
 
-#ifndef TIMER0_ENABLED
-#define TIMER0_ENABLED 0
-#endif
 
-// <q> TIMER1_ENABLED  - Enable TIMER1 instance
- 
+// <i> Sub-minor device version, will be converted automatically to BCD notation. Use just decimal values.
 
-#ifndef TIMER1_ENABLED
-#define TIMER1_ENABLED 0
+#ifndef APP_USBD_DEVICE_VER_SUB
+#define APP_USBD_DEVICE_VER_SUB 0
 #endif
 
-// <q> TIMER2_ENABLED  - Enable TIMER2 instance
+// <q> APP_USBD_CONFIG_SELF_POWERED  - Self-powered device, as opposed to bus-powered.
  
 
-#ifndef TIMER2_ENABLED
-#define TIMER2_ENABLED 0
+#ifndef APP_USBD_CONFIG_SELF_POWERED
+#define APP_USBD_CONFIG_SELF_POWERED 1
 #endif
 
-// <q> TIMER3_ENABLED  - Enable TIMER3 instance
- 
+// <o> APP_USBD_CONFIG_MAX_POWER - MaxPower field in configuration descriptor in milliamps.  <0-500> 
 
-#ifndef TIMER3_ENABLED
-#define TIMER3_ENABLED 0
+
+#ifndef APP_USBD_CONFIG_MAX_POWER
+#define APP_USBD_CONFIG_MAX_POWER 100
 #endif
 
-// <q> TIMER4_ENABLED  - Enable TIMER4 instance
+// <q> APP_USBD_CONFIG_POWER_EVENTS_PROCESS  - Process power events.
  
 
-#ifndef TIMER4_ENABLED
-#define TIMER4_ENABLED 0
+// <i> Enable processing power events in USB event handler.
+
+#ifndef APP_USBD_CONFIG_POWER_EVENTS_PROCESS
+#define APP_USBD_CONFIG_POWER_EVENTS_PROCESS 1
 #endif
 
-// </e>
+// <e> APP_USBD_CONFIG_EVENT_QUEUE_ENABLE - Enable event queue.
 
-// <e> TWIS_ENABLED - nrf_drv_twis - TWIS peripheral driver - legacy layer
+// <i> This is the default configuration when all the events are placed into internal queue.
+// <i> Disable it when an external queue is used like app_scheduler or if you wish to process all events inside interrupts.
+// <i> Processing all events from the interrupt level adds requirement not to call any functions that modifies the USBD library state from the context higher than USB interrupt context.
+// <i> Functions that modify USBD state are functions for sleep, wakeup, start, stop, enable, and disable.
 //==========================================================
-#ifndef TWIS_ENABLED
-#define TWIS_ENABLED 0
+#ifndef APP_USBD_CONFIG_EVENT_QUEUE_ENABLE
+#define APP_USBD_CONFIG_EVENT_QUEUE_ENABLE 1
 #endif
-// <q> TWIS0_ENABLED  - Enable TWIS0 instance
- 
+// <o> APP_USBD_CONFIG_EVENT_QUEUE_SIZE - The size of the event queue.  <16-64> 
 
-#ifndef TWIS0_ENABLED
-#define TWIS0_ENABLED 0
-#endif
 
-// <q> TWIS1_ENABLED  - Enable TWIS1 instance
- 
+// <i> The size of the queue for the events that would be processed in the main loop.
 
-#ifndef TWIS1_ENABLED
-#define TWIS1_ENABLED 0
+#ifndef APP_USBD_CONFIG_EVENT_QUEUE_SIZE
+#define APP_USBD_CONFIG_EVENT_QUEUE_SIZE 32
 #endif
 
-// <q> TWIS_ASSUME_INIT_AFTER_RESET_ONLY  - Assume that any instance would be initialized only once
+// <o> APP_USBD_CONFIG_SOF_HANDLING_MODE  - Change SOF events handling mode.
  
 
-// <i> Optimization flag. Registers used by TWIS are shared by other peripherals. Normally, during initialization driver tries to clear all registers to known state before doing the initialization itself. This gives initialization safe procedure, no matter when it would be called. If you activate TWIS only once and do never uninitialize it - set this flag to 1 what gives more optimal code.
+// <i> Normal queue   - SOF events are pushed normally into the event queue.
+// <i> Compress queue - SOF events are counted and binded with other events or executed when the queue is empty.
+// <i>                  This prevents the queue from filling up with SOF events.
+// <i> Interrupt      - SOF events are processed in interrupt.
+// <0=> Normal queue 
+// <1=> Compress queue 
+// <2=> Interrupt 
 
-#ifndef TWIS_ASSUME_INIT_AFTER_RESET_ONLY
-#define TWIS_ASSUME_INIT_AFTER_RESET_ONLY 0
+#ifndef APP_USBD_CONFIG_SOF_HANDLING_MODE
+#define APP_USBD_CONFIG_SOF_HANDLING_MODE 1
 #endif
 
-// <q> TWIS_NO_SYNC_MODE  - Remove support for synchronous mode
+// </e>
+
+// <q> APP_USBD_CONFIG_SOF_TIMESTAMP_PROVIDE  - Provide a function that generates timestamps for logs based on the current SOF.
  
 
-// <i> Synchronous mode would be used in specific situations. And it uses some additional code and data memory to safely process state machine by polling it in status functions. If this functionality is not required it may be disabled to free some resources.
+// <i> The function app_usbd_sof_timestamp_get is implemented if the logger is enabled. 
+// <i> Use it when initializing the logger. 
+// <i> SOF processing is always enabled when this configuration parameter is active. 
+// <i> Note: This option is configured outside of APP_USBD_CONFIG_LOG_ENABLED. 
+// <i> This means that it works even if the logging in this very module is disabled. 
 
-#ifndef TWIS_NO_SYNC_MODE
-#define TWIS_NO_SYNC_MODE 0
+#ifndef APP_USBD_CONFIG_SOF_TIMESTAMP_PROVIDE
+#define APP_USBD_CONFIG_SOF_TIMESTAMP_PROVIDE 0
 #endif
 
-// <o> TWIS_DEFAULT_CONFIG_ADDR0 - Address0 
-#ifndef TWIS_DEFAULT_CONFIG_ADDR0
-#define TWIS_DEFAULT_CONFIG_ADDR0 0
-#endif
+// <o> APP_USBD_CONFIG_DESC_STRING_SIZE - Maximum size of the NULL-terminated string of the string descriptor.  <31-254> 
 
-// <o> TWIS_DEFAULT_CONFIG_ADDR1 - Address1 
-#ifndef TWIS_DEFAULT_CONFIG_ADDR1
-#define TWIS_DEFAULT_CONFIG_ADDR1 0
-#endif
 
-// <o> TWIS_DEFAULT_CONFIG_SCL_PULL  - SCL pin pull configuration
- 
-// <0=> Disabled 
-// <1=> Pull down 
-// <3=> Pull up 
+// <i> 31 characters can be stored in the internal USB buffer used for transfers.
+// <i> Any value higher than 31 creates an additional buffer just for descriptor strings.
 
-#ifndef TWIS_DEFAULT_CONFIG_SCL_PULL
-#define TWIS_DEFAULT_CONFIG_SCL_PULL 0
+#ifndef APP_USBD_CONFIG_DESC_STRING_SIZE
+#define APP_USBD_CONFIG_DESC_STRING_SIZE 31
 #endif
 
-// <o> TWIS_DEFAULT_CONFIG_SDA_PULL  - SDA pin pull configuration
+// <q> APP_USBD_CONFIG_DESC_STRING_UTF_ENABLED  - Enable UTF8 conversion.
  
-// <0=> Disabled 
-// <1=> Pull down 
-// <3=> Pull up 
-
-#ifndef TWIS_DEFAULT_CONFIG_SDA_PULL
-#define TWIS_DEFAULT_CONFIG_SDA_PULL 0
-#endif
 
-// <o> TWIS_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
+// <i> Enable UTF8-encoded characters. In normal processing, only ASCII characters are available.
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+#ifndef APP_USBD_CONFIG_DESC_STRING_UTF_ENABLED
+#define APP_USBD_CONFIG_DESC_STRING_UTF_ENABLED 0
+#endif
 
-#ifndef TWIS_DEFAULT_CONFIG_IRQ_PRIORITY
-#define TWIS_DEFAULT_CONFIG_IRQ_PRIORITY 2
+// <s> APP_USBD_STRINGS_LANGIDS - Supported languages identifiers.
+
+// <i> Note: This value is not editable in Configuration Wizard.
+// <i> Comma-separated list of supported languages.
+#ifndef APP_USBD_STRINGS_LANGIDS
+#define APP_USBD_STRINGS_LANGIDS APP_USBD_LANG_AND_SUBLANG(APP_USBD_LANG_ENGLISH, APP_USBD_SUBLANG_ENGLISH_US)
 #endif
 
-// </e>
+// <e> APP_USBD_STRING_ID_MANUFACTURER - Define manufacturer string ID.
 
-// <e> TWI_ENABLED - nrf_drv_twi - TWI/TWIM peripheral driver - legacy layer
+// <i> Setting ID to 0 disables the string.
 //==========================================================
-#ifndef TWI_ENABLED
-#define TWI_ENABLED 0
+#ifndef APP_USBD_STRING_ID_MANUFACTURER
+#define APP_USBD_STRING_ID_MANUFACTURER 1
 #endif
-// <o> TWI_DEFAULT_CONFIG_FREQUENCY  - Frequency
+// <q> APP_USBD_STRINGS_MANUFACTURER_EXTERN  - Define whether @ref APP_USBD_STRINGS_MANUFACTURER is created by macro or declared as a global variable.
  
-// <26738688=> 100k 
-// <67108864=> 250k 
-// <104857600=> 400k 
 
-#ifndef TWI_DEFAULT_CONFIG_FREQUENCY
-#define TWI_DEFAULT_CONFIG_FREQUENCY 26738688
+#ifndef APP_USBD_STRINGS_MANUFACTURER_EXTERN
+#define APP_USBD_STRINGS_MANUFACTURER_EXTERN 0
 #endif
 
-// <q> TWI_DEFAULT_CONFIG_CLR_BUS_INIT  - Enables bus clearing procedure during init
- 
+// <s> APP_USBD_STRINGS_MANUFACTURER - String descriptor for the manufacturer name.
 
-#ifndef TWI_DEFAULT_CONFIG_CLR_BUS_INIT
-#define TWI_DEFAULT_CONFIG_CLR_BUS_INIT 0
+// <i> Note: This value is not editable in Configuration Wizard.
+// <i> Comma-separated list of manufacturer names for each defined language.
+// <i> Use @ref APP_USBD_STRING_DESC macro to create string descriptor from a NULL-terminated string.
+// <i> Use @ref APP_USBD_STRING_RAW8_DESC macro to create string descriptor from comma-separated uint8_t values.
+// <i> Use @ref APP_USBD_STRING_RAW16_DESC macro to create string descriptor from comma-separated uint16_t values.
+// <i> Alternatively, configure the macro to point to any internal variable pointer that already contains the descriptor.
+// <i> Setting string to NULL disables that string.
+// <i> The order of manufacturer names must be the same like in @ref APP_USBD_STRINGS_LANGIDS.
+#ifndef APP_USBD_STRINGS_MANUFACTURER
+#define APP_USBD_STRINGS_MANUFACTURER APP_USBD_STRING_DESC("Nordic Semiconductor")
 #endif
 
-// <q> TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT  - Enables bus holding after uninit
- 
+// </e>
 
-#ifndef TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT
-#define TWI_DEFAULT_CONFIG_HOLD_BUS_UNINIT 0
-#endif
+// <e> APP_USBD_STRING_ID_PRODUCT - Define product string ID.
 
-// <o> TWI_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <i> Setting ID to 0 disables the string.
+//==========================================================
+#ifndef APP_USBD_STRING_ID_PRODUCT
+#define APP_USBD_STRING_ID_PRODUCT 2
+#endif
+// <q> APP_USBD_STRINGS_PRODUCT_EXTERN  - Define whether @ref APP_USBD_STRINGS_PRODUCT is created by macro or declared as a global variable.
  
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
-
-#ifndef TWI_DEFAULT_CONFIG_IRQ_PRIORITY
-#define TWI_DEFAULT_CONFIG_IRQ_PRIORITY 2
+#ifndef APP_USBD_STRINGS_PRODUCT_EXTERN
+#define APP_USBD_STRINGS_PRODUCT_EXTERN 0
 #endif
 
-// <e> TWI0_ENABLED - Enable TWI0 instance
-//==========================================================
-#ifndef TWI0_ENABLED
-#define TWI0_ENABLED 0
-#endif
-// <q> TWI0_USE_EASY_DMA  - Use EasyDMA (if present)
- 
+// <s> APP_USBD_STRINGS_PRODUCT - String descriptor for the product name.
 
-#ifndef TWI0_USE_EASY_DMA
-#define TWI0_USE_EASY_DMA 0
+// <i> Note: This value is not editable in Configuration Wizard.
+// <i> List of product names that is defined the same way like in @ref APP_USBD_STRINGS_MANUFACTURER.
+#ifndef APP_USBD_STRINGS_PRODUCT
+#define APP_USBD_STRINGS_PRODUCT APP_USBD_STRING_DESC("nRF52 USB Product")
 #endif
 
 // </e>
 
-// <e> TWI1_ENABLED - Enable TWI1 instance
+// <e> APP_USBD_STRING_ID_SERIAL - Define serial number string ID.
+
+// <i> Setting ID to 0 disables the string.
 //==========================================================
-#ifndef TWI1_ENABLED
-#define TWI1_ENABLED 0
+#ifndef APP_USBD_STRING_ID_SERIAL
+#define APP_USBD_STRING_ID_SERIAL 3
 #endif
-// <q> TWI1_USE_EASY_DMA  - Use EasyDMA (if present)
+// <q> APP_USBD_STRING_SERIAL_EXTERN  - Define whether @ref APP_USBD_STRING_SERIAL is created by macro or declared as a global variable.
  
 
-#ifndef TWI1_USE_EASY_DMA
-#define TWI1_USE_EASY_DMA 0
+#ifndef APP_USBD_STRING_SERIAL_EXTERN
+#define APP_USBD_STRING_SERIAL_EXTERN 0
 #endif
 
-// </e>
+// <s> APP_USBD_STRING_SERIAL - String descriptor for the serial number.
+
+// <i> Note: This value is not editable in Configuration Wizard.
+// <i> Serial number that is defined the same way like in @ref APP_USBD_STRINGS_MANUFACTURER.
+#ifndef APP_USBD_STRING_SERIAL
+#define APP_USBD_STRING_SERIAL APP_USBD_STRING_DESC("000000000000")
+#endif
 
 // </e>
 
-// <e> UART_ENABLED - nrf_drv_uart - UART/UARTE peripheral driver - legacy layer
+// <e> APP_USBD_STRING_ID_CONFIGURATION - Define configuration string ID.
+
+// <i> Setting ID to 0 disables the string.
 //==========================================================
-#ifndef UART_ENABLED
-#define UART_ENABLED 1
+#ifndef APP_USBD_STRING_ID_CONFIGURATION
+#define APP_USBD_STRING_ID_CONFIGURATION 4
 #endif
-// <o> UART_DEFAULT_CONFIG_HWFC  - Hardware Flow Control
+// <q> APP_USBD_STRING_CONFIGURATION_EXTERN  - Define whether @ref APP_USBD_STRINGS_CONFIGURATION is created by macro or declared as global variable.
  
-// <0=> Disabled 
-// <1=> Enabled 
 
-#ifndef UART_DEFAULT_CONFIG_HWFC
-#define UART_DEFAULT_CONFIG_HWFC 0
+#ifndef APP_USBD_STRING_CONFIGURATION_EXTERN
+#define APP_USBD_STRING_CONFIGURATION_EXTERN 0
 #endif
 
-// <o> UART_DEFAULT_CONFIG_PARITY  - Parity
- 
-// <0=> Excluded 
-// <14=> Included 
+// <s> APP_USBD_STRINGS_CONFIGURATION - String descriptor for the device configuration.
 
-#ifndef UART_DEFAULT_CONFIG_PARITY
-#define UART_DEFAULT_CONFIG_PARITY 0
+// <i> Note: This value is not editable in Configuration Wizard.
+// <i> Configuration string that is defined the same way like in @ref APP_USBD_STRINGS_MANUFACTURER.
+#ifndef APP_USBD_STRINGS_CONFIGURATION
+#define APP_USBD_STRINGS_CONFIGURATION APP_USBD_STRING_DESC("Default configuration")
 #endif
 
-// <o> UART_DEFAULT_CONFIG_BAUDRATE  - Default Baudrate
- 
-// <323584=> 1200 baud 
-// <643072=> 2400 baud 
-// <1290240=> 4800 baud 
-// <2576384=> 9600 baud 
-// <3862528=> 14400 baud 
-// <5152768=> 19200 baud 
-// <7716864=> 28800 baud 
-// <10289152=> 38400 baud 
-// <15400960=> 57600 baud 
-// <20615168=> 76800 baud 
-// <30801920=> 115200 baud 
-// <61865984=> 230400 baud 
-// <67108864=> 250000 baud 
-// <121634816=> 460800 baud 
-// <251658240=> 921600 baud 
-// <268435456=> 1000000 baud 
+// </e>
 
-#ifndef UART_DEFAULT_CONFIG_BAUDRATE
-#define UART_DEFAULT_CONFIG_BAUDRATE 30801920
-#endif
+// <s> APP_USBD_STRINGS_USER - Default values for user strings.
 
-// <o> UART_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
- 
+// <i> Note: This value is not editable in Configuration Wizard.
+// <i> This value stores all application specific user strings with the default initialization.
+// <i> The setup is done by X-macros.
+// <i> Expected macro parameters:
+// <i> @code
+// <i> X(mnemonic, [=str_idx], ...)
+// <i> @endcode
+// <i> - @c mnemonic: Mnemonic of the string descriptor that would be added to
+// <i>                @ref app_usbd_string_desc_idx_t enumerator.
+// <i> - @c str_idx : String index value, can be set or left empty.
+// <i>                For example, WinUSB driver requires descriptor to be present on 0xEE index.
+// <i>                Then use X(USBD_STRING_WINUSB, =0xEE, (APP_USBD_STRING_DESC(...)))
+// <i> - @c ...     : List of string descriptors for each defined language.
+#ifndef APP_USBD_STRINGS_USER
+#define APP_USBD_STRINGS_USER X(APP_USER_1, , APP_USBD_STRING_DESC("User 1"))
+#endif
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+// </e>
 
-#ifndef UART_DEFAULT_CONFIG_IRQ_PRIORITY
-#define UART_DEFAULT_CONFIG_IRQ_PRIORITY 2
+// <e> APP_USBD_HID_ENABLED - app_usbd_hid - USB HID class
+//==========================================================
+#ifndef APP_USBD_HID_ENABLED
+#define APP_USBD_HID_ENABLED 0
 #endif
+// <o> APP_USBD_HID_DEFAULT_IDLE_RATE - Default idle rate for HID class.   <0-255> 
 
-// <q> UART_EASY_DMA_SUPPORT  - Driver supporting EasyDMA
- 
 
-#ifndef UART_EASY_DMA_SUPPORT
-#define UART_EASY_DMA_SUPPORT 1
+// <i> 0 means indefinite duration, any other value is multiplied by 4 milliseconds. Refer to Chapter 7.2.4 of HID 1.11 Specification.
+
+#ifndef APP_USBD_HID_DEFAULT_IDLE_RATE
+#define APP_USBD_HID_DEFAULT_IDLE_RATE 0
 #endif
 
-// <q> UART_LEGACY_SUPPORT  - Driver supporting Legacy mode
- 
+// <o> APP_USBD_HID_REPORT_IDLE_TABLE_SIZE - Size of idle rate table.   <1-255> 
 
-#ifndef UART_LEGACY_SUPPORT
-#define UART_LEGACY_SUPPORT 1
-#endif
 
-// <e> UART0_ENABLED - Enable UART0 instance
-//==========================================================
-#ifndef UART0_ENABLED
-#define UART0_ENABLED 1
-#endif
-// <q> UART0_CONFIG_USE_EASY_DMA  - Default setting for using EasyDMA
- 
+// <i> Must be higher than the highest report ID used.
 
-#ifndef UART0_CONFIG_USE_EASY_DMA
-#define UART0_CONFIG_USE_EASY_DMA 1
+#ifndef APP_USBD_HID_REPORT_IDLE_TABLE_SIZE
+#define APP_USBD_HID_REPORT_IDLE_TABLE_SIZE 4
 #endif
 
 // </e>
 
-// <e> UART1_ENABLED - Enable UART1 instance
-//==========================================================
-#ifndef UART1_ENABLED
-#define UART1_ENABLED 0
+// <q> APP_USBD_HID_GENERIC_ENABLED  - app_usbd_hid_generic - USB HID generic
+ 
+
+#ifndef APP_USBD_HID_GENERIC_ENABLED
+#define APP_USBD_HID_GENERIC_ENABLED 0
 #endif
-// </e>
 
-// </e>
+// <q> APP_USBD_HID_KBD_ENABLED  - app_usbd_hid_kbd - USB HID keyboard
+ 
 
-// <e> USBD_ENABLED - nrf_drv_usbd - Software Component
-//==========================================================
-#ifndef USBD_ENABLED
-#define USBD_ENABLED 0
+#ifndef APP_USBD_HID_KBD_ENABLED
+#define APP_USBD_HID_KBD_ENABLED 0
 #endif
-// <o> USBD_CONFIG_IRQ_PRIORITY  - Interrupt priority
+
+// <q> APP_USBD_HID_MOUSE_ENABLED  - app_usbd_hid_mouse - USB HID mouse
  
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+#ifndef APP_USBD_HID_MOUSE_ENABLED
+#define APP_USBD_HID_MOUSE_ENABLED 0
+#endif
 
-#ifndef USBD_CONFIG_IRQ_PRIORITY
-#define USBD_CONFIG_IRQ_PRIORITY 2
+// <q> APP_USBD_MSC_ENABLED  - app_usbd_msc - USB MSC class
+ 
+
+#ifndef APP_USBD_MSC_ENABLED
+#define APP_USBD_MSC_ENABLED 0
 #endif
 
-// <o> USBD_CONFIG_DMASCHEDULER_MODE  - USBD SMA scheduler working scheme
+// <q> CRC16_ENABLED  - crc16 - CRC16 calculation routines
  
-// <0=> Prioritized access 
-// <1=> Round Robin 
 
-#ifndef USBD_CONFIG_DMASCHEDULER_MODE
-#define USBD_CONFIG_DMASCHEDULER_MODE 0
+#ifndef CRC16_ENABLED
+#define CRC16_ENABLED 1
 #endif
 
-// <q> USBD_CONFIG_DMASCHEDULER_ISO_BOOST  - Give priority to isochronous transfers
+// <q> CRC32_ENABLED  - crc32 - CRC32 calculation routines
  
 
-// <i> This option gives priority to isochronous transfers.
-// <i> Enabling it assures that isochronous transfers are always processed,
-// <i> even if multiple other transfers are pending.
-// <i> Isochronous endpoints are prioritized before the usbd_dma_scheduler_algorithm
-// <i> function is called, so the option is independent of the algorithm chosen.
-
-#ifndef USBD_CONFIG_DMASCHEDULER_ISO_BOOST
-#define USBD_CONFIG_DMASCHEDULER_ISO_BOOST 1
+#ifndef CRC32_ENABLED
+#define CRC32_ENABLED 0
 #endif
 
-// <q> USBD_CONFIG_ISO_IN_ZLP  - Respond to an IN token on ISO IN endpoint with ZLP when no data is ready
+// <q> ECC_ENABLED  - ecc - Elliptic Curve Cryptography Library
  
 
-// <i> If set, ISO IN endpoint will respond to an IN token with ZLP when no data is ready to be sent.
-// <i> Else, there will be no response.
-// <i> NOTE: This option does not work on Engineering A chip.
-
-#ifndef USBD_CONFIG_ISO_IN_ZLP
-#define USBD_CONFIG_ISO_IN_ZLP 0
+#ifndef ECC_ENABLED
+#define ECC_ENABLED 0
 #endif
 
-// </e>
+// <e> FDS_ENABLED - fds - Flash data storage module
+//==========================================================
+#ifndef FDS_ENABLED
+#define FDS_ENABLED 1
+#endif
+// <h> Pages - Virtual page settings
 
-// <e> WDT_ENABLED - nrf_drv_wdt - WDT peripheral driver - legacy layer
+// <i> Configure the number of virtual pages to use and their size.
 //==========================================================
-#ifndef WDT_ENABLED
-#define WDT_ENABLED 0
+// <o> FDS_VIRTUAL_PAGES - Number of virtual flash pages to use. 
+// <i> One of the virtual pages is reserved by the system for garbage collection.
+// <i> Therefore, the minimum is two virtual pages: one page to store data and one page to be used by the system for garbage collection.
+// <i> The total amount of flash memory that is used by FDS amounts to @ref FDS_VIRTUAL_PAGES * @ref FDS_VIRTUAL_PAGE_SIZE * 4 bytes.
+
+#ifndef FDS_VIRTUAL_PAGES
+#define FDS_VIRTUAL_PAGES 3
 #endif
-// <o> WDT_CONFIG_BEHAVIOUR  - WDT behavior in CPU SLEEP or HALT mode
+
+// <o> FDS_VIRTUAL_PAGE_SIZE  - The size of a virtual flash page.
  
-// <1=> Run in SLEEP, Pause in HALT 
-// <8=> Pause in SLEEP, Run in HALT 
-// <9=> Run in SLEEP and HALT 
-// <0=> Pause in SLEEP and HALT 
 
-#ifndef WDT_CONFIG_BEHAVIOUR
-#define WDT_CONFIG_BEHAVIOUR 1
-#endif
+// <i> Expressed in number of 4-byte words.
+// <i> By default, a virtual page is the same size as a physical page.
+// <i> The size of a virtual page must be a multiple of the size of a physical page.
+// <1024=> 1024 
+// <2048=> 2048 
 
-// <o> WDT_CONFIG_RELOAD_VALUE - Reload value  <15-4294967295> 
+#ifndef FDS_VIRTUAL_PAGE_SIZE
+#define FDS_VIRTUAL_PAGE_SIZE 1024
+#endif
 
+// <o> FDS_VIRTUAL_PAGES_RESERVED - The number of virtual flash pages that are used by other modules. 
+// <i> FDS module stores its data in the last pages of the flash memory.
+// <i> By setting this value, you can move flash end address used by the FDS.
+// <i> As a result the reserved space can be used by other modules.
 
-#ifndef WDT_CONFIG_RELOAD_VALUE
-#define WDT_CONFIG_RELOAD_VALUE 2000
+#ifndef FDS_VIRTUAL_PAGES_RESERVED
+#define FDS_VIRTUAL_PAGES_RESERVED 0
 #endif
 
-// <o> WDT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// </h> 
+//==========================================================
+
+// <h> Backend - Backend configuration
+
+// <i> Configure which nrf_fstorage backend is used by FDS to write to flash.
+//==========================================================
+// <o> FDS_BACKEND  - FDS flash backend.
  
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
+// <i> NRF_FSTORAGE_SD uses the nrf_fstorage_sd backend implementation using the SoftDevice API. Use this if you have a SoftDevice present.
+// <i> NRF_FSTORAGE_NVMC uses the nrf_fstorage_nvmc implementation. Use this setting if you don't use the SoftDevice.
+// <1=> NRF_FSTORAGE_NVMC 
+// <2=> NRF_FSTORAGE_SD 
 
-#ifndef WDT_CONFIG_IRQ_PRIORITY
-#define WDT_CONFIG_IRQ_PRIORITY 2
+#ifndef FDS_BACKEND
+#define FDS_BACKEND 2
 #endif
 
-// </e>
-
 // </h> 
 //==========================================================
 
-// <h> nRF_Drivers_External 
+// <h> Queue - Queue settings
 
 //==========================================================
-// <q> NRF_TWI_SENSOR_ENABLED  - nrf_twi_sensor - nRF TWI Sensor module
- 
+// <o> FDS_OP_QUEUE_SIZE - Size of the internal queue. 
+// <i> Increase this value if you frequently get synchronous FDS_ERR_NO_SPACE_IN_QUEUES errors.
 
-#ifndef NRF_TWI_SENSOR_ENABLED
-#define NRF_TWI_SENSOR_ENABLED 0
+#ifndef FDS_OP_QUEUE_SIZE
+#define FDS_OP_QUEUE_SIZE 4
 #endif
 
 // </h> 
 //==========================================================
 
-// <h> nRF_Libraries 
+// <h> CRC - CRC functionality
 
 //==========================================================
-// <q> APP_GPIOTE_ENABLED  - app_gpiote - GPIOTE events dispatcher
+// <e> FDS_CRC_CHECK_ON_READ - Enable CRC checks.
+
+// <i> Save a record's CRC when it is written to flash and check it when the record is opened.
+// <i> Records with an incorrect CRC can still be 'seen' by the user using FDS functions, but they cannot be opened.
+// <i> Additionally, they will not be garbage collected until they are deleted.
+//==========================================================
+#ifndef FDS_CRC_CHECK_ON_READ
+#define FDS_CRC_CHECK_ON_READ 0
+#endif
+// <o> FDS_CRC_CHECK_ON_WRITE  - Perform a CRC check on newly written records.
  
 
-#ifndef APP_GPIOTE_ENABLED
-#define APP_GPIOTE_ENABLED 0
+// <i> Perform a CRC check on newly written records.
+// <i> This setting can be used to make sure that the record data was not altered while being written to flash.
+// <1=> Enabled 
+// <0=> Disabled 
+
+#ifndef FDS_CRC_CHECK_ON_WRITE
+#define FDS_CRC_CHECK_ON_WRITE 0
 #endif
 
-// <q> APP_PWM_ENABLED  - app_pwm - PWM functionality
- 
+// </e>
 
-#ifndef APP_PWM_ENABLED
-#define APP_PWM_ENABLED 0
+// </h> 
+//==========================================================
+
+// <h> Users - Number of users
+
+//==========================================================
+// <o> FDS_MAX_USERS - Maximum number of callbacks that can be registered. 
+#ifndef FDS_MAX_USERS
+#define FDS_MAX_USERS 4
 #endif
 
-// <e> APP_SCHEDULER_ENABLED - app_scheduler - Events scheduler
+// </h> 
 //==========================================================
-#ifndef APP_SCHEDULER_ENABLED
-#define APP_SCHEDULER_ENABLED 1
+
+// </e>
+
+// <e> FDS_GC_SCHED_ENABLED - fds_gc_sched - FDS garbage collection in idle periods
+// <i> Starts the garbage collection before writes fail, when no app_timer expires soon and the radio is off.
+//==========================================================
+#ifndef FDS_GC_SCHED_ENABLED
+#define FDS_GC_SCHED_ENABLED 0
 #endif
-// <q> APP_SCHEDULER_WITH_PAUSE  - Enabling pause feature
- 
+// <o> FDS_GC_SCHED_DIRTY_PERCENT - Freeable part of the data pages (in percent) that makes a collection pending.  <1-100> 
 
-#ifndef APP_SCHEDULER_WITH_PAUSE
-#define APP_SCHEDULER_WITH_PAUSE 0
+#ifndef FDS_GC_SCHED_DIRTY_PERCENT
+#define FDS_GC_SCHED_DIRTY_PERCENT 25
 #endif
 
-// <q> APP_SCHEDULER_WITH_PROFILER  - Enabling scheduler profiling
- 
+// <o> FDS_GC_SCHED_LOW_WATER_WORDS - Largest free space (in words) below which a collection is pending if any word is freeable. 
 
-#ifndef APP_SCHEDULER_WITH_PROFILER
-#define APP_SCHEDULER_WITH_PROFILER 0
+#ifndef FDS_GC_SCHED_LOW_WATER_WORDS
+#define FDS_GC_SCHED_LOW_WATER_WORDS 256
 #endif
 
-// </e>
+// <o> FDS_GC_SCHED_IDLE_MS - Shortest time (in ms) to the next app_timer expiry for a collection to start.  <1-60000> 
 
-// <e> APP_SDCARD_ENABLED - app_sdcard - SD/MMC card support using SPI
+#ifndef FDS_GC_SCHED_IDLE_MS
+#define FDS_GC_SCHED_IDLE_MS 100
+#endif
+
+// <o> FDS_GC_SCHED_FORCE_MS - Time (in ms) after which a pending collection starts without idle time.  <0-60000> 
+// <i> 0 waits for idle time forever.
+
+#ifndef FDS_GC_SCHED_FORCE_MS
+#define FDS_GC_SCHED_FORCE_MS 10000
+#endif
+
+// <e> FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED - Also wait for a radio-free period.
+// <i> Predicts the time the radio stays off from ble_radio_notification. Requires BLE_RADIO_NOTIFICATION_SCHED_ENABLED.
 //==========================================================
-#ifndef APP_SDCARD_ENABLED
-#define APP_SDCARD_ENABLED 0
+#ifndef FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED
+#define FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED 0
 #endif
-// <o> APP_SDCARD_SPI_INSTANCE  - SPI instance used
- 
-// <0=> 0 
-// <1=> 1 
-// <2=> 2 
+// <o> FDS_GC_SCHED_RADIO_GAP_MS - Shortest predicted radio-free time (in ms) for a collection to start.  <1-60000> 
 
-#ifndef APP_SDCARD_SPI_INSTANCE
-#define APP_SDCARD_SPI_INSTANCE 0
+#ifndef FDS_GC_SCHED_RADIO_GAP_MS
+#define FDS_GC_SCHED_RADIO_GAP_MS 50
 #endif
 
-// <o> APP_SDCARD_FREQ_INIT  - SPI frequency
+// </e>
+
+// </e>
+
+// <q> HARDFAULT_HANDLER_ENABLED  - hardfault_default - HardFault default handler for debugging and release
  
-// <33554432=> 125 kHz 
-// <67108864=> 250 kHz 
-// <134217728=> 500 kHz 
-// <268435456=> 1 MHz 
-// <536870912=> 2 MHz 
-// <1073741824=> 4 MHz 
-// <2147483648=> 8 MHz 
 
-#ifndef APP_SDCARD_FREQ_INIT
-#define APP_SDCARD_FREQ_INIT 67108864
+#ifndef HARDFAULT_HANDLER_ENABLED
+#define HARDFAULT_HANDLER_ENABLED 0
 #endif
 
-// <o> APP_SDCARD_FREQ_DATA  - SPI frequency
- 
-// <33554432=> 125 kHz 
-// <67108864=> 250 kHz 
-// <134217728=> 500 kHz 
-// <268435456=> 1 MHz 
-// <536870912=> 2 MHz 
-// <1073741824=> 4 MHz 
-// <2147483648=> 8 MHz 
+// <e> HCI_MEM_POOL_ENABLED - hci_mem_pool - memory pool implementation used by HCI
+//==========================================================
+#ifndef HCI_MEM_POOL_ENABLED
+#define HCI_MEM_POOL_ENABLED 0
+#endif
+// <o> HCI_TX_BUF_SIZE - TX buffer size in bytes. 
+#ifndef HCI_TX_BUF_SIZE
+#define HCI_TX_BUF_SIZE 600
+#endif
 
-#ifndef APP_SDCARD_FREQ_DATA
-#define APP_SDCARD_FREQ_DATA 1073741824
+// <o> HCI_RX_BUF_SIZE - RX buffer size in bytes. 
+#ifndef HCI_RX_BUF_SIZE
+#define HCI_RX_BUF_SIZE 600
+#endif
+
+// <o> HCI_RX_BUF_QUEUE_SIZE - RX buffer queue size. 
+#ifndef HCI_RX_BUF_QUEUE_SIZE
+#define HCI_RX_BUF_QUEUE_SIZE 4
 #endif
 
 // </e>
 
-// <e> APP_TIMER_ENABLED - app_timer - Application timer functionality
+// <e> HCI_SLIP_ENABLED - hci_slip - SLIP protocol implementation used by HCI
 //==========================================================
-#ifndef APP_TIMER_ENABLED
-#define APP_TIMER_ENABLED 1
+#ifndef HCI_SLIP_ENABLED
+#define HCI_SLIP_ENABLED 0
 #endif
-// <o> APP_TIMER_CONFIG_RTC_FREQUENCY  - Configure RTC prescaler.
+// <o> HCI_UART_BAUDRATE  - Default Baudrate
  
-// <0=> 32768 Hz 
-// <1=> 16384 Hz 
-// <3=> 8192 Hz 
-// <7=> 4096 Hz 
-// <15=> 2048 Hz 
-// <31=> 1024 Hz 
+// <323584=> 1200 baud 
+// <643072=> 2400 baud 
+// <1290240=> 4800 baud 
+// <2576384=> 9600 baud 
+// <3862528=> 14400 baud 
+// <5152768=> 19200 baud 
+// <7716864=> 28800 baud 
+// <10289152=> 38400 baud 
+// <15400960=> 57600 baud 
+// <20615168=> 76800 baud 
+// <30801920=> 115200 baud 
+// <61865984=> 230400 baud 
+// <67108864=> 250000 baud 
+// <121634816=> 460800 baud 
+// <251658240=> 921600 baud 
+// <268435456=> 1000000 baud 
 
-#ifndef APP_TIMER_CONFIG_RTC_FREQUENCY
-#define APP_TIMER_CONFIG_RTC_FREQUENCY 1
+#ifndef HCI_UART_BAUDRATE
+#define HCI_UART_BAUDRATE 30801920
 #endif
 
-// <o> APP_TIMER_CONFIG_IRQ_PRIORITY  - Interrupt priority
+// <o> HCI_UART_FLOW_CONTROL  - Hardware Flow Control
  
+// <0=> Disabled 
+// <1=> Enabled 
 
-// <i> Priorities 0,2 (nRF51) and 0,1,4,5 (nRF52) are reserved for SoftDevice
-// <0=> 0 (highest) 
-// <1=> 1 
-// <2=> 2 
-// <3=> 3 
-// <4=> 4 
-// <5=> 5 
-// <6=> 6 
-// <7=> 7 
-
-#ifndef APP_TIMER_CONFIG_IRQ_PRIORITY
-#define APP_TIMER_CONFIG_IRQ_PRIORITY 2
+#ifndef HCI_UART_FLOW_CONTROL
+#define HCI_UART_FLOW_CONTROL 0
 #endif
 
-// <o> APP_TIMER_CONFIG_OP_QUEUE_SIZE - Capacity of timer requests queue. 
-// <i> Size of the queue depends on how many timers are used
-// <i> in the system, how often timers are started and overall
-// <i> system latency. If queue size is too small app_timer calls
-// <i> will fail.
-
-#ifndef APP_TIMER_CONFIG_OP_QUEUE_SIZE
-#define APP_TIMER_CONFIG_OP_QUEUE_SIZE 10
+// <o> HCI_UART_RX_PIN - UART RX pin 
+#ifndef HCI_UART_RX_PIN
+#define HCI_UART_RX_PIN 8
 #endif
 
-// <q> APP_TIMER_CONFIG_USE_SCHEDULER  - Enable scheduling app_timer events to app_scheduler
- 
-
-#ifndef APP_TIMER_CONFIG_USE_SCHEDULER
-#define APP_TIMER_CONFIG_USE_SCHEDULER 0
+// <o> HCI_UART_TX_PIN - UART TX pin 
+#ifndef HCI_UART_TX_PIN
+#define HCI_UART_TX_PIN 6
 #endif
 
-// <q> APP_TIMER_KEEPS_RTC_ACTIVE  - Enable RTC always on
- 
-
-// <i> If option is enabled RTC is kept running even if there is no active timers.
-// <i> This option can be used when app_timer is used for timestamping.
+// <o> HCI_UART_RTS_PIN - UART RTS pin 
+#ifndef HCI_UART_RTS_PIN
+#define HCI_UART_RTS_PIN 5
+#endif
 
-#ifndef APP_TIMER_KEEPS_RTC_ACTIVE
-#define APP_TIMER_KEEPS_RTC_ACTIVE 0
+// <o> HCI_UART_CTS_PIN - UART CTS pin 
+#ifndef HCI_UART_CTS_PIN
+#define HCI_UART_CTS_PIN 7
 #endif
 
-// <o> APP_TIMER_SAFE_WINDOW_MS - Maximum possible latency (in milliseconds) of handling app_timer event. 
-// <i> Maximum possible timeout that can be set is reduced by safe window.
-// <i> Example: RTC frequency 16384 Hz, maximum possible timeout 1024 seconds - APP_TIMER_SAFE_WINDOW_MS.
-// <i> Since RTC is not stopped when processor is halted in debugging session, this value
-// <i> must cover it if debugging is needed. It is possible to halt processor for APP_TIMER_SAFE_WINDOW_MS
-// <i> without corrupting app_timer behavior.
+// </e>
 
-#ifndef APP_TIMER_SAFE_WINDOW_MS
-#define APP_TIMER_SAFE_WINDOW_MS 300000
+// <e> HCI_TRANSPORT_ENABLED - hci_transport - HCI transport
+//==========================================================
+#ifndef HCI_TRANSPORT_ENABLED
+#define HCI_TRANSPORT_ENABLED 0
+#endif
+// <o> HCI_MAX_PACKET_SIZE_IN_BITS - Maximum size of a single application packet in bits. 
+#ifndef HCI_MAX_PACKET_SIZE_IN_BITS
+#define HCI_MAX_PACKET_SIZE_IN_BITS 8000
 #endif
 
-// <h> App Timer Legacy configuration - Legacy configuration.
+// </e>
 
-//==========================================================
-// <q> APP_TIMER_WITH_PROFILER  - Enable app_timer profiling
+// <q> LED_SOFTBLINK_ENABLED  - led_softblink - led_softblink module
  
 
-#ifndef APP_TIMER_WITH_PROFILER
-#define APP_TIMER_WITH_PROFILER 0
+#ifndef LED_SOFTBLINK_ENABLED
+#define LED_SOFTBLINK_ENABLED 0
 #endif
 
-// <q> APP_TIMER_CONFIG_SWI_NUMBER  - Configure SWI instance used.
+// <q> LOW_POWER_PWM_ENABLED  - low_power_pwm - low_power_pwm module
  
 
-#ifndef APP_TIMER_CONFIG_SWI_NUMBER
-#define APP_TIMER_CONFIG_SWI_NUMBER 0
+#ifndef LOW_POWER_PWM_ENABLED
+#define LOW_POWER_PWM_ENABLED 0
 #endif
 
-// </h> 
+// <e> MEM_MANAGER_ENABLED - mem_manager - Dynamic memory allocator
 //==========================================================
+#ifndef MEM_MANAGER_ENABLED
+#define MEM_MANAGER_ENABLED 0
+#endif
+// <o> MEMORY_MANAGER_SMALL_BLOCK_COUNT - Size of each memory blocks identified as 'small' block.  <0-255> 
 
-// </e>
-
-// <q> APP_USBD_AUDIO_ENABLED  - app_usbd_audio - USB AUDIO class
- 
 
-#ifndef APP_USBD_AUDIO_ENABLED
-#define APP_USBD_AUDIO_ENABLED 0
+#ifndef MEMORY_MANAGER_SMALL_BLOCK_COUNT
+#define MEMORY_MANAGER_SMALL_BLOCK_COUNT 1
 #endif
 
-// <e> APP_USBD_ENABLED - app_usbd - USB Device library
-//==========================================================
-#ifndef APP_USBD_ENABLED
-#define APP_USBD_ENABLED 0
+// <o> MEMORY_MANAGER_SMALL_BLOCK_SIZE -  Size of each memory blocks identified as 'small' block. 
+// <i>  Size of each memory blocks identified as 'small' block. Memory block are recommended to be word-sized.
+
+#ifndef MEMORY_MANAGER_SMALL_BLOCK_SIZE
+#define MEMORY_MANAGER_SMALL_BLOCK_SIZE 32
 #endif
-// <o> APP_USBD_VID - Vendor ID.  <0x0000-0xFFFF> 
 
+// <o> MEMORY_MANAGER_MEDIUM_BLOCK_COUNT - Size of each memory blocks identified as 'medium' block.  <0-255> 
 
-// <i> Note: This value is not editable in Configuration Wizard.
-// <i> Vendor ID ordered from USB IF: http://www.usb.org/developers/vendor/
 
-#ifndef APP_USBD_VID
-#define APP_USBD_VID 0
+#ifndef MEMORY_MANAGER_MEDIUM_BLOCK_COUNT
+#define MEMORY_MANAGER_MEDIUM_BLOCK_COUNT 0
 #endif
 
-// <o> APP_USBD_PID - Product ID.  <0x0000-0xFFFF> 
+// <o> MEMORY_MANAGER_MEDIUM_BLOCK_SIZE -  Size of each memory blocks identified as 'medium' block. 
+// <i>  Size of each memory blocks identified as 'medium' block. Memory block are recommended to be word-sized.
 
+#ifndef MEMORY_MANAGER_MEDIUM_BLOCK_SIZE
+#define MEMORY_MANAGER_MEDIUM_BLOCK_SIZE 256
+#endif
 
-// <i> Note: This value is not editable in Configuration Wizard.
-// <i> Selected Product ID
+// <o> MEMORY_MANAGER_LARGE_BLOCK_COUNT - Size of each memory blocks identified as 'large' block.  <0-255> 
 
-#ifndef APP_USBD_PID
-#define APP_USBD_PID 0
+
+#ifndef MEMORY_MANAGER_LARGE_BLOCK_COUNT
+#define MEMORY_MANAGER_LARGE_BLOCK_COUNT 0
 #endif
 
-// <o> APP_USBD_DEVICE_VER_MAJOR - Major device version  <0-99> 
+// <o> MEMORY_MANAGER_LARGE_BLOCK_SIZE -  Size of each memory blocks identified as 'large' block. 
+// <i>  Size of each memory blocks identified as 'large' block. Memory block are recommended to be word-sized.
 
+#ifndef MEMORY_MANAGER_LARGE_BLOCK_SIZE
+#define MEMORY_MANAGER_LARGE_BLOCK_SIZE 256
+#endif
 
-// <i> Major device version, will be converted automatically to BCD notation. Use just decimal values.
+// <o> MEMORY_MANAGER_XLARGE_BLOCK_COUNT - Size of each memory blocks identified as 'extra large' block.  <0-255> 
 
-#ifndef APP_USBD_DEVICE_VER_MAJOR
-#define APP_USBD_DEVICE_VER_MAJOR 1
+
+#ifndef MEMORY_MANAGER_XLARGE_BLOCK_COUNT
+#define MEMORY_MANAGER_XLARGE_BLOCK_COUNT 0
 #endif
 
-// <o> APP_USBD_DEVICE_VER_MINOR - Minor device version  <0-9> 
+// <o> MEMORY_MANAGER_XLARGE_BLOCK_SIZE -  Size of each memory blocks identified as 'extra large' block. 
+// <i>  Size of each memory blocks identified as 'extra large' block. Memory block are recommended to be word-sized.
+
+#ifndef MEMORY_MANAGER_XLARGE_BLOCK_SIZE
+#define MEMORY_MANAGER_XLARGE_BLOCK_SIZE 1320
+#endif
 
+// <o> MEMORY_MANAGER_XXLARGE_BLOCK_COUNT - Size of each memory blocks identified as 'extra extra large' block.  <0-255> 
 
-// <i> Minor device version, will be converted automatically to BCD notation. Use just decimal values.
 
-#ifndef APP_USBD_DEVICE_VER_MINOR
-#define APP_USBD_DEVICE_VER_MINOR 0
+#ifndef MEMORY_MANAGER_XXLARGE_BLOCK_COUNT
+#define MEMORY_MANAGER_XXLARGE_BLOCK_COUNT 0
 #endif
 
-// <o> APP_USBD_DEVICE_VER_SUB - Sub-minor device version  <0-9> 
+// <o> MEMORY_MANAGER_XXLARGE_BLOCK_SIZE -  Size of each memory blocks identified as 'extra extra large' block. 
+// <i>  Size of each memory blocks identified as 'extra extra large' block. Memory block are recommended to be word-sized.
 
+#ifndef MEMORY_MANAGER_XXLARGE_BLOCK_SIZE
+#define MEMORY_MANAGER_XXLARGE_BLOCK_SIZE 3444
+#endif
 
-// <i> Sub-minor device version, will be converted automatically to BCD notation. Use just decimal values.
+// <o> MEMORY_MANAGER_XSMALL_BLOCK_COUNT - Size of each memory blocks identified as 'extra small' block.  <0-255> 
 
-#ifndef APP_USBD_DEVICE_VER_SUB
-#define APP_USBD_DEVICE_VER_SUB 0
+
+#ifndef MEMORY_MANAGER_XSMALL_BLOCK_COUNT
+#define MEMORY_MANAGER_XSMALL_BLOCK_COUNT 0
 #endif
 
-// <q> APP_USBD_CONFIG_SELF_POWERED  - Self-powered device, as opposed to bus-powered.
- 
+// <o> MEMORY_MANAGER_XSMALL_BLOCK_SIZE -  Size of each memory blocks identified as 'extra small' block. 
+// <i>  Size of each memory blocks identified as 'extra large' block. Memory block are recommended to be word-sized.
 
-#ifndef APP_USBD_CONFIG_SELF_POWERED
-#define APP_USBD_CONFIG_SELF_POWERED 1
+#ifndef MEMORY_MANAGER_XSMALL_BLOCK_SIZE
+#define MEMORY_MANAGER_XSMALL_BLOCK_SIZE 64
 #endif
 
-// <o> APP_USBD_CONFIG_MAX_POWER - MaxPower field in configuration descriptor in milliamps.  <0-500> 
+// <o> MEMORY_MANAGER_XXSMALL_BLOCK_COUNT - Size of each memory blocks identified as 'extra extra small' block.  <0-255> 
 
 
-#ifndef APP_USBD_CONFIG_MAX_POWER
-#define APP_USBD_CONFIG_MAX_POWER 100
+#ifndef MEMORY_MANAGER_XXSMALL_BLOCK_COUNT
+#define MEMORY_MANAGER_XXSMALL_BLOCK_COUNT 0
 #endif
 
-// <q> APP_USBD_CONFIG_POWER_EVENTS_PROCESS  - Process power events.
- 
-
-// <i> Enable processing power events in USB event handler.
+// <o> MEMORY_MANAGER_XXSMALL_BLOCK_SIZE -  Size of each memory blocks identified as 'extra extra small' block. 
+// <i>  Size of each memory blocks identified as 'extra extra small' block. Memory block are recommended to be word-sized.
 
-#ifndef APP_USBD_CONFIG_POWER_EVENTS_PROCESS
-#define APP_USBD_CONFIG_POWER_EVENTS_PROCESS 1
+#ifndef MEMORY_MANAGER_XXSMALL_BLOCK_SIZE
+#define MEMORY_MANAGER_XXSMALL_BLOCK_SIZE 32
 #endif
 
-// <e> APP_USBD_CONFIG_EVENT_QUEUE_ENABLE - Enable event queue.
-
-// <i> This is the default configuration when all the events are placed into internal queue.
-// <i> Disable it when an external queue is used like app_scheduler or if you wish to process all events inside interrupts.
-// <i> Processing all events from the interrupt level adds requirement not to call any functions that modifies the USBD library state from the context higher than USB interrupt context.
-// <i> Functions that modify USBD state are functions for sleep, wakeup, start, stop, enable, and disable.
+// <e> MEM_MANAGER_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef APP_USBD_CONFIG_EVENT_QUEUE_ENABLE
-#define APP_USBD_CONFIG_EVENT_QUEUE_ENABLE 1
+#ifndef MEM_MANAGER_CONFIG_LOG_ENABLED
+#define MEM_MANAGER_CONFIG_LOG_ENABLED 0
 #endif
-// <o> APP_USBD_CONFIG_EVENT_QUEUE_SIZE - The size of the event queue.  <16-64> 
+// <o> MEM_MANAGER_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
+#ifndef MEM_MANAGER_CONFIG_LOG_LEVEL
+#define MEM_MANAGER_CONFIG_LOG_LEVEL 3
+#endif
 
-// <i> The size of the queue for the events that would be processed in the main loop.
+// <o> MEM_MANAGER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef APP_USBD_CONFIG_EVENT_QUEUE_SIZE
-#define APP_USBD_CONFIG_EVENT_QUEUE_SIZE 32
+#ifndef MEM_MANAGER_CONFIG_INFO_COLOR
+#define MEM_MANAGER_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> APP_USBD_CONFIG_SOF_HANDLING_MODE  - Change SOF events handling mode.
+// <o> MEM_MANAGER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-// <i> Normal queue   - SOF events are pushed normally into the event queue.
-// <i> Compress queue - SOF events are counted and binded with other events or executed when the queue is empty.
-// <i>                  This prevents the queue from filling up with SOF events.
-// <i> Interrupt      - SOF events are processed in interrupt.
-// <0=> Normal queue 
-// <1=> Compress queue 
-// <2=> Interrupt 
-
-#ifndef APP_USBD_CONFIG_SOF_HANDLING_MODE
-#define APP_USBD_CONFIG_SOF_HANDLING_MODE 1
+#ifndef MEM_MANAGER_CONFIG_DEBUG_COLOR
+#define MEM_MANAGER_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <q> APP_USBD_CONFIG_SOF_TIMESTAMP_PROVIDE  - Provide a function that generates timestamps for logs based on the current SOF.
+// <q> MEM_MANAGER_DISABLE_API_PARAM_CHECK  - Disable API parameter checks in the module.
  
 
-// <i> The function app_usbd_sof_timestamp_get is implemented if the logger is enabled. 
-// <i> Use it when initializing the logger. 
-// <i> SOF processing is always enabled when this configuration parameter is active. 
-// <i> Note: This option is configured outside of APP_USBD_CONFIG_LOG_ENABLED. 
-// <i> This means that it works even if the logging in this very module is disabled. 
-
-#ifndef APP_USBD_CONFIG_SOF_TIMESTAMP_PROVIDE
-#define APP_USBD_CONFIG_SOF_TIMESTAMP_PROVIDE 0
+#ifndef MEM_MANAGER_DISABLE_API_PARAM_CHECK
+#define MEM_MANAGER_DISABLE_API_PARAM_CHECK 0
 #endif
 
-// <o> APP_USBD_CONFIG_DESC_STRING_SIZE - Maximum size of the NULL-terminated string of the string descriptor.  <31-254> 
+// </e>
 
+// <q> NRF_ASYNC_ENABLED  - nrf_async - Cooperative tasks run from the scheduler
+ 
 
-// <i> 31 characters can be stored in the internal USB buffer used for transfers.
-// <i> Any value higher than 31 creates an additional buffer just for descriptor strings.
+// <i> Requires app_scheduler with an event size of at least 4 bytes, and app_timer for NRF_ASYNC_SLEEP.
 
-#ifndef APP_USBD_CONFIG_DESC_STRING_SIZE
-#define APP_USBD_CONFIG_DESC_STRING_SIZE 31
+#ifndef NRF_ASYNC_ENABLED
+#define NRF_ASYNC_ENABLED 0
 #endif
 
-// <q> APP_USBD_CONFIG_DESC_STRING_UTF_ENABLED  - Enable UTF8 conversion.
+// <q> NRF_ATFIFO_CONFIG_SPSC_ENABLED  - nrf_atfifo - Single producer, single consumer instances
  
 
-// <i> Enable UTF8-encoded characters. In normal processing, only ASCII characters are available.
+// <i> FIFOs defined with NRF_ATFIFO_SPSC_DEF skip the exclusive access loops.
+// <i> The instances are placed in the atfifo_spsc RAM section, which must be present in the linker configuration.
 
-#ifndef APP_USBD_CONFIG_DESC_STRING_UTF_ENABLED
-#define APP_USBD_CONFIG_DESC_STRING_UTF_ENABLED 0
+#ifndef NRF_ATFIFO_CONFIG_SPSC_ENABLED
+#define NRF_ATFIFO_CONFIG_SPSC_ENABLED 0
 #endif
 
-// <s> APP_USBD_STRINGS_LANGIDS - Supported languages identifiers.
+// <q> NRF_ATFIFO_CONFIG_RAMFUNC_ENABLED  - nrf_atfifo - Run put and get from RAM
+ 
 
-// <i> Note: This value is not editable in Configuration Wizard.
-// <i> Comma-separated list of supported languages.
-#ifndef APP_USBD_STRINGS_LANGIDS
-#define APP_USBD_STRINGS_LANGIDS APP_USBD_LANG_AND_SUBLANG(APP_USBD_LANG_ENGLISH, APP_USBD_SUBLANG_ENGLISH_US)
-#endif
+// <i> The item and batch put and get functions and their space helpers run from RAM and do not pay flash
+// <i> wait states. memcpy, nrf_mem_telemetry, logging and the interrupt vector table stay in flash, so
+// <i> a caller still stalls on them while the NVMC erases or writes a page.
+// <i> The code is placed in the .ramfunc section, which must be present in the linker configuration.
 
-// <e> APP_USBD_STRING_ID_MANUFACTURER - Define manufacturer string ID.
+#ifndef NRF_ATFIFO_CONFIG_RAMFUNC_ENABLED
+#define NRF_ATFIFO_CONFIG_RAMFUNC_ENABLED 1
+#endif
 
-// <i> Setting ID to 0 disables the string.
+// <e> NRF_BALLOC_ENABLED - nrf_balloc - Block allocator module
 //==========================================================
-#ifndef APP_USBD_STRING_ID_MANUFACTURER
-#define APP_USBD_STRING_ID_MANUFACTURER 1
+#ifndef NRF_BALLOC_ENABLED
+#define NRF_BALLOC_ENABLED 1
 #endif
-// <q> APP_USBD_STRINGS_MANUFACTURER_EXTERN  - Define whether @ref APP_USBD_STRINGS_MANUFACTURER is created by macro or declared as a global variable.
- 
-
-#ifndef APP_USBD_STRINGS_MANUFACTURER_EXTERN
-#define APP_USBD_STRINGS_MANUFACTURER_EXTERN 0
+// <e> NRF_BALLOC_CONFIG_DEBUG_ENABLED - Enables debug mode in the module.
+//==========================================================
+#ifndef NRF_BALLOC_CONFIG_DEBUG_ENABLED
+#define NRF_BALLOC_CONFIG_DEBUG_ENABLED 0
 #endif
+// <o> NRF_BALLOC_CONFIG_HEAD_GUARD_WORDS - Number of words used as head guard.  <0-255> 
 
-// <s> APP_USBD_STRINGS_MANUFACTURER - String descriptor for the manufacturer name.
 
-// <i> Note: This value is not editable in Configuration Wizard.
-// <i> Comma-separated list of manufacturer names for each defined language.
-// <i> Use @ref APP_USBD_STRING_DESC macro to create string descriptor from a NULL-terminated string.
-// <i> Use @ref APP_USBD_STRING_RAW8_DESC macro to create string descriptor from comma-separated uint8_t values.
-// <i> Use @ref APP_USBD_STRING_RAW16_DESC macro to create string descriptor from comma-separated uint16_t values.
-// <i> Alternatively, configure the macro to point to any internal variable pointer that already contains the descriptor.
-// <i> Setting string to NULL disables that string.
-// <i> The order of manufacturer names must be the same like in @ref APP_USBD_STRINGS_LANGIDS.
-#ifndef APP_USBD_STRINGS_MANUFACTURER
-#define APP_USBD_STRINGS_MANUFACTURER APP_USBD_STRING_DESC("Nordic Semiconductor")
+#ifndef NRF_BALLOC_CONFIG_HEAD_GUARD_WORDS
+#define NRF_BALLOC_CONFIG_HEAD_GUARD_WORDS 1
 #endif
 
-// </e>
+// <o> NRF_BALLOC_CONFIG_TAIL_GUARD_WORDS - Number of words used as tail guard.  <0-255> 
 
-// <e> APP_USBD_STRING_ID_PRODUCT - Define product string ID.
 
-// <i> Setting ID to 0 disables the string.
-//==========================================================
-#ifndef APP_USBD_STRING_ID_PRODUCT
-#define APP_USBD_STRING_ID_PRODUCT 2
+#ifndef NRF_BALLOC_CONFIG_TAIL_GUARD_WORDS
+#define NRF_BALLOC_CONFIG_TAIL_GUARD_WORDS 1
 #endif
-// <q> APP_USBD_STRINGS_PRODUCT_EXTERN  - Define whether @ref APP_USBD_STRINGS_PRODUCT is created by macro or declared as a global variable.
+
+// <q> NRF_BALLOC_CONFIG_BASIC_CHECKS_ENABLED  - Enables basic checks in this module.
  
 
-#ifndef APP_USBD_STRINGS_PRODUCT_EXTERN
-#define APP_USBD_STRINGS_PRODUCT_EXTERN 0
+#ifndef NRF_BALLOC_CONFIG_BASIC_CHECKS_ENABLED
+#define NRF_BALLOC_CONFIG_BASIC_CHECKS_ENABLED 0
 #endif
 
-// <s> APP_USBD_STRINGS_PRODUCT - String descriptor for the product name.
+// <q> NRF_BALLOC_CONFIG_DOUBLE_FREE_CHECK_ENABLED  - Enables double memory free check in this module.
+ 
 
-// <i> Note: This value is not editable in Configuration Wizard.
-// <i> List of product names that is defined the same way like in @ref APP_USBD_STRINGS_MANUFACTURER.
-#ifndef APP_USBD_STRINGS_PRODUCT
-#define APP_USBD_STRINGS_PRODUCT APP_USBD_STRING_DESC("nRF52 USB Product")
+#ifndef NRF_BALLOC_CONFIG_DOUBLE_FREE_CHECK_ENABLED
+#define NRF_BALLOC_CONFIG_DOUBLE_FREE_CHECK_ENABLED 0
 #endif
 
-// </e>
-
-// <e> APP_USBD_STRING_ID_SERIAL - Define serial number string ID.
+// <q> NRF_BALLOC_CONFIG_DATA_TRASHING_CHECK_ENABLED  - Enables free memory corruption check in this module.
+ 
 
-// <i> Setting ID to 0 disables the string.
-//==========================================================
-#ifndef APP_USBD_STRING_ID_SERIAL
-#define APP_USBD_STRING_ID_SERIAL 3
+#ifndef NRF_BALLOC_CONFIG_DATA_TRASHING_CHECK_ENABLED
+#define NRF_BALLOC_CONFIG_DATA_TRASHING_CHECK_ENABLED 0
 #endif
-// <q> APP_USBD_STRING_SERIAL_EXTERN  - Define whether @ref APP_USBD_STRING_SERIAL is created by macro or declared as a global variable.
+
+// <q> NRF_BALLOC_CLI_CMDS  - Enable CLI commands specific to the module
  
 
-#ifndef APP_USBD_STRING_SERIAL_EXTERN
-#define APP_USBD_STRING_SERIAL_EXTERN 0
+#ifndef NRF_BALLOC_CLI_CMDS
+#define NRF_BALLOC_CLI_CMDS 0
 #endif
 
-// <s> APP_USBD_STRING_SERIAL - String descriptor for the serial number.
+// <q> NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED  - Use 16-bit free block indices.
+ 
 
-// <i> Note: This value is not editable in Configuration Wizard.
-// <i> Serial number that is defined the same way like in @ref APP_USBD_STRINGS_MANUFACTURER.
-#ifndef APP_USBD_STRING_SERIAL
-#define APP_USBD_STRING_SERIAL APP_USBD_STRING_DESC("000000000000")
+// <i> Pools can hold up to 65535 blocks instead of 255. Files defining pools must include nrf_balloc_idx.h.
+// <i> nrf_balloc_init() rejects pools defined without it, including the nrf_log message pool
+// <i> unless the SDK logger sources are built with nrf_balloc_idx.h as a forced include.
+
+#ifndef NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+#define NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED 0
 #endif
 
-// </e>
+// <q> NRF_BALLOC_CONFIG_LOCKFREE_ENABLED  - Enable lock-free pools.
+ 
 
-// <e> APP_USBD_STRING_ID_CONFIGURATION - Define configuration string ID.
+// <i> Pools defined with NRF_BALLOC_LOCKFREE_DEF are allocated with exclusive access
+// <i> instructions instead of critical regions. Releases are still serialized by the balloc region.
 
-// <i> Setting ID to 0 disables the string.
-//==========================================================
-#ifndef APP_USBD_STRING_ID_CONFIGURATION
-#define APP_USBD_STRING_ID_CONFIGURATION 4
+#ifndef NRF_BALLOC_CONFIG_LOCKFREE_ENABLED
+#define NRF_BALLOC_CONFIG_LOCKFREE_ENABLED 0
 #endif
-// <q> APP_USBD_STRING_CONFIGURATION_EXTERN  - Define whether @ref APP_USBD_STRINGS_CONFIGURATION is created by macro or declared as global variable.
+
+// <q> NRF_BALLOC_CONFIG_RAMFUNC_ENABLED  - Run allocation and release from RAM.
  
 
-#ifndef APP_USBD_STRING_CONFIGURATION_EXTERN
-#define APP_USBD_STRING_CONFIGURATION_EXTERN 0
+// <i> nrf_balloc_alloc, nrf_balloc_free and their index and lock-free stack helpers run from RAM and do not
+// <i> pay flash wait states. nrf_mem_telemetry, logging, app_error in the debug checks and the interrupt
+// <i> vector table stay in flash, so a caller still stalls on them while the NVMC erases or writes a page.
+// <i> The code is placed in the .ramfunc section, which must be present in the linker configuration.
+
+#ifndef NRF_BALLOC_CONFIG_RAMFUNC_ENABLED
+#define NRF_BALLOC_CONFIG_RAMFUNC_ENABLED 1
 #endif
 
-// <s> APP_USBD_STRINGS_CONFIGURATION - String descriptor for the device configuration.
+// <o> NRF_BALLOC_CONFIG_BASEPRI_CEILING  - Priority ceiling of the critical regions.
+ 
 
-// <i> Note: This value is not editable in Configuration Wizard.
-// <i> Configuration string that is defined the same way like in @ref APP_USBD_STRINGS_MANUFACTURER.
-#ifndef APP_USBD_STRINGS_CONFIGURATION
-#define APP_USBD_STRINGS_CONFIGURATION APP_USBD_STRING_DESC("Default configuration")
+// <i> Critical regions of the module mask only interrupts with this priority or lower, using BASEPRI.
+// <i> The module must not be used from interrupts with a higher priority. With the SoftDevice, the
+// <i> ceiling must be 6 or 7. Disabled selects CRITICAL_REGION_ENTER.
+// <0=> Disabled 
+// <1=> 1 
+// <2=> 2 
+// <3=> 3 
+// <4=> 4 
+// <5=> 5 
+// <6=> 6 
+// <7=> 7 
+
+#ifndef NRF_BALLOC_CONFIG_BASEPRI_CEILING
+#define NRF_BALLOC_CONFIG_BASEPRI_CEILING 0
 #endif
 
 // </e>
 
-// <s> APP_USBD_STRINGS_USER - Default values for user strings.
+// </e>
 
-// <i> Note: This value is not editable in Configuration Wizard.
-// <i> This value stores all application specific user strings with the default initialization.
-// <i> The setup is done by X-macros.
-// <i> Expected macro parameters:
-// <i> @code
-// <i> X(mnemonic, [=str_idx], ...)
-// <i> @endcode
-// <i> - @c mnemonic: Mnemonic of the string descriptor that would be added to
-// <i>                @ref app_usbd_string_desc_idx_t enumerator.
-// <i> - @c str_idx : String index value, can be set or left empty.
-// <i>                For example, WinUSB driver requires descriptor to be present on 0xEE index.
-// <i>                Then use X(USBD_STRING_WINUSB, =0xEE, (APP_USBD_STRING_DESC(...)))
-// <i> - @c ...     : List of string descriptors for each defined language.
-#ifndef APP_USBD_STRINGS_USER
-#define APP_USBD_STRINGS_USER X(APP_USER_1, , APP_USBD_STRING_DESC("User 1"))
+// <e> NRF_BENCH_ENABLED - nrf_bench - Core library microbenchmark
+//==========================================================
+#ifndef NRF_BENCH_ENABLED
+#define NRF_BENCH_ENABLED 0
+#endif
+// <o> NRF_BENCH_CONFIG_ITERATIONS - Default number of operations of each workload. 
+
+#ifndef NRF_BENCH_CONFIG_ITERATIONS
+#define NRF_BENCH_CONFIG_ITERATIONS 1000
+#endif
+
+// <q> NRF_BENCH_CONFIG_ADVDATA_ENABLED  - Build the advertising data workloads.
+ 
+
+// <i> Requires ble_advdata.c in the project.
+
+#ifndef NRF_BENCH_CONFIG_ADVDATA_ENABLED
+#define NRF_BENCH_CONFIG_ADVDATA_ENABLED 0
 #endif
 
 // </e>
 
-// <e> APP_USBD_HID_ENABLED - app_usbd_hid - USB HID class
+// <e> NRF_CSENSE_ENABLED - nrf_csense - Capacitive sensor module
 //==========================================================
-#ifndef APP_USBD_HID_ENABLED
-#define APP_USBD_HID_ENABLED 0
+#ifndef NRF_CSENSE_ENABLED
+#define NRF_CSENSE_ENABLED 0
+#endif
+// <o> NRF_CSENSE_PAD_HYSTERESIS - Minimum value of change required to determine that a pad was touched. 
+#ifndef NRF_CSENSE_PAD_HYSTERESIS
+#define NRF_CSENSE_PAD_HYSTERESIS 15
 #endif
-// <o> APP_USBD_HID_DEFAULT_IDLE_RATE - Default idle rate for HID class.   <0-255> 
-
 
-// <i> 0 means indefinite duration, any other value is multiplied by 4 milliseconds. Refer to Chapter 7.2.4 of HID 1.11 Specification.
+// <o> NRF_CSENSE_PAD_DEVIATION - Minimum value measured on a pad required to take it into account while calculating the step. 
+#ifndef NRF_CSENSE_PAD_DEVIATION
+#define NRF_CSENSE_PAD_DEVIATION 70
+#endif
 
-#ifndef APP_USBD_HID_DEFAULT_IDLE_RATE
-#define APP_USBD_HID_DEFAULT_IDLE_RATE 0
+// <o> NRF_CSENSE_MIN_PAD_VALUE - Minimum normalized value on a pad required to take its value into account. 
+#ifndef NRF_CSENSE_MIN_PAD_VALUE
+#define NRF_CSENSE_MIN_PAD_VALUE 20
 #endif
 
-// <o> APP_USBD_HID_REPORT_IDLE_TABLE_SIZE - Size of idle rate table.   <1-255> 
+// <o> NRF_CSENSE_MAX_PADS_NUMBER - Maximum number of pads used for one instance. 
+#ifndef NRF_CSENSE_MAX_PADS_NUMBER
+#define NRF_CSENSE_MAX_PADS_NUMBER 20
+#endif
 
+// <o> NRF_CSENSE_MAX_VALUE - Maximum normalized value obtained from measurement. 
+#ifndef NRF_CSENSE_MAX_VALUE
+#define NRF_CSENSE_MAX_VALUE 1000
+#endif
 
-// <i> Must be higher than the highest report ID used.
+// <o> NRF_CSENSE_OUTPUT_PIN - Output pin used by the low-level module. 
+// <i> This is used when capacitive sensor does not use COMP.
 
-#ifndef APP_USBD_HID_REPORT_IDLE_TABLE_SIZE
-#define APP_USBD_HID_REPORT_IDLE_TABLE_SIZE 4
+#ifndef NRF_CSENSE_OUTPUT_PIN
+#define NRF_CSENSE_OUTPUT_PIN 26
 #endif
 
 // </e>
 
-// <q> APP_USBD_HID_GENERIC_ENABLED  - app_usbd_hid_generic - USB HID generic
- 
-
-#ifndef APP_USBD_HID_GENERIC_ENABLED
-#define APP_USBD_HID_GENERIC_ENABLED 0
+// <e> NRF_DRV_CSENSE_ENABLED - nrf_drv_csense - Capacitive sensor low-level module
+//==========================================================
+#ifndef NRF_DRV_CSENSE_ENABLED
+#define NRF_DRV_CSENSE_ENABLED 0
 #endif
+// <e> USE_COMP - Use the comparator to implement the capacitive sensor driver.
 
-// <q> APP_USBD_HID_KBD_ENABLED  - app_usbd_hid_kbd - USB HID keyboard
- 
+// <i> Due to Anomaly 84, COMP I_SOURCE is not functional. It has too high a varation.
+//==========================================================
+#ifndef USE_COMP
+#define USE_COMP 0
+#endif
+// <o> TIMER0_FOR_CSENSE - First TIMER instance used by the driver (not used on nRF51). 
+#ifndef TIMER0_FOR_CSENSE
+#define TIMER0_FOR_CSENSE 1
+#endif
 
-#ifndef APP_USBD_HID_KBD_ENABLED
-#define APP_USBD_HID_KBD_ENABLED 0
+// <o> TIMER1_FOR_CSENSE - Second TIMER instance used by the driver (not used on nRF51). 
+#ifndef TIMER1_FOR_CSENSE
+#define TIMER1_FOR_CSENSE 2
 #endif
 
-// <q> APP_USBD_HID_MOUSE_ENABLED  - app_usbd_hid_mouse - USB HID mouse
- 
+// <o> MEASUREMENT_PERIOD - Single measurement period. 
+// <i> Time of a single measurement can be calculated as
+// <i> T = (1/2)*MEASUREMENT_PERIOD*(1/f_OSC) where f_OSC = I_SOURCE / (2C*(VUP-VDOWN) ).
+// <i> I_SOURCE, VUP, and VDOWN are values used to initialize COMP and C is the capacitance of the used pad.
 
-#ifndef APP_USBD_HID_MOUSE_ENABLED
-#define APP_USBD_HID_MOUSE_ENABLED 0
+#ifndef MEASUREMENT_PERIOD
+#define MEASUREMENT_PERIOD 20
 #endif
 
-// <q> APP_USBD_MSC_ENABLED  - app_usbd_msc - USB MSC class
- 
+// </e>
 
-#ifndef APP_USBD_MSC_ENABLED
-#define APP_USBD_MSC_ENABLED 0
-#endif
+// </e>
 
-// <q> CRC16_ENABLED  - crc16 - CRC16 calculation routines
- 
+// <e> NRF_ENERGY_ENABLED - nrf_energy - Energy attribution harness
 
-#ifndef CRC16_ENABLED
-#define CRC16_ENABLED 1
+// <i> Requires app_timer. Marks the CPU, radio and SAADC phases on GPIOs and estimates
+// <i> their charge from datasheet currents.
+//==========================================================
+#ifndef NRF_ENERGY_ENABLED
+#define NRF_ENERGY_ENABLED 0
 #endif
+// <o> NRF_ENERGY_CONFIG_SYNC_PIN - GPIO pulsed by nrf_energy_sync() to align an external current trace.  <0-255> 
+// <i> 255 leaves the pin unused.
 
-// <q> CRC32_ENABLED  - crc32 - CRC32 calculation routines
- 
+#ifndef NRF_ENERGY_CONFIG_SYNC_PIN
+#define NRF_ENERGY_CONFIG_SYNC_PIN 43
+#endif
 
-#ifndef CRC32_ENABLED
-#define CRC32_ENABLED 0
+// <o> NRF_ENERGY_CONFIG_SYNC_PULSE_US - Length of the sync pulse, in microseconds. 
+
+#ifndef NRF_ENERGY_CONFIG_SYNC_PULSE_US
+#define NRF_ENERGY_CONFIG_SYNC_PULSE_US 1000
 #endif
 
-// <q> ECC_ENABLED  - ecc - Elliptic Curve Cryptography Library
- 
+// <o> NRF_ENERGY_CONFIG_CPU_PIN - GPIO held high while the CPU runs.  <0-255> 
 
-#ifndef ECC_ENABLED
-#define ECC_ENABLED 0
+#ifndef NRF_ENERGY_CONFIG_CPU_PIN
+#define NRF_ENERGY_CONFIG_CPU_PIN 44
 #endif
 
-// <e> FDS_ENABLED - fds - Flash data storage module
-//==========================================================
-#ifndef FDS_ENABLED
-#define FDS_ENABLED 1
+// <o> NRF_ENERGY_CONFIG_RADIO_PIN - GPIO held high while the radio is active.  <0-255> 
+
+#ifndef NRF_ENERGY_CONFIG_RADIO_PIN
+#define NRF_ENERGY_CONFIG_RADIO_PIN 45
 #endif
-// <h> Pages - Virtual page settings
 
-// <i> Configure the number of virtual pages to use and their size.
-//==========================================================
-// <o> FDS_VIRTUAL_PAGES - Number of virtual flash pages to use. 
-// <i> One of the virtual pages is reserved by the system for garbage collection.
-// <i> Therefore, the minimum is two virtual pages: one page to store data and one page to be used by the system for garbage collection.
-// <i> The total amount of flash memory that is used by FDS amounts to @ref FDS_VIRTUAL_PAGES * @ref FDS_VIRTUAL_PAGE_SIZE * 4 bytes.
+// <o> NRF_ENERGY_CONFIG_SAADC_PIN - GPIO held high while the SAADC acquisition runs.  <0-255> 
 
-#ifndef FDS_VIRTUAL_PAGES
-#define FDS_VIRTUAL_PAGES 3
+#ifndef NRF_ENERGY_CONFIG_SAADC_PIN
+#define NRF_ENERGY_CONFIG_SAADC_PIN 46
 #endif
 
-// <o> FDS_VIRTUAL_PAGE_SIZE  - The size of a virtual flash page.
- 
-
-// <i> Expressed in number of 4-byte words.
-// <i> By default, a virtual page is the same size as a physical page.
-// <i> The size of a virtual page must be a multiple of the size of a physical page.
-// <1024=> 1024 
-// <2048=> 2048 
+// <o> NRF_ENERGY_CONFIG_SLEEP_CURRENT_NA - Current drawn in System ON sleep with the RTC running, in nA. 
 
-#ifndef FDS_VIRTUAL_PAGE_SIZE
-#define FDS_VIRTUAL_PAGE_SIZE 1024
+#ifndef NRF_ENERGY_CONFIG_SLEEP_CURRENT_NA
+#define NRF_ENERGY_CONFIG_SLEEP_CURRENT_NA 3160
 #endif
 
-// <o> FDS_VIRTUAL_PAGES_RESERVED - The number of virtual flash pages that are used by other modules. 
-// <i> FDS module stores its data in the last pages of the flash memory.
-// <i> By setting this value, you can move flash end address used by the FDS.
-// <i> As a result the reserved space can be used by other modules.
+// <o> NRF_ENERGY_CONFIG_CPU_CURRENT_NA - Current added while the CPU runs from flash with cache, in nA. 
 
-#ifndef FDS_VIRTUAL_PAGES_RESERVED
-#define FDS_VIRTUAL_PAGES_RESERVED 0
+#ifndef NRF_ENERGY_CONFIG_CPU_CURRENT_NA
+#define NRF_ENERGY_CONFIG_CPU_CURRENT_NA 3300000
 #endif
 
-// </h> 
-//==========================================================
+// <o> NRF_ENERGY_CONFIG_RADIO_CURRENT_NA - Current added while the radio is active, in nA. 
+// <i> Datasheet TX current at 0 dBm. RX draws slightly less.
 
-// <h> Backend - Backend configuration
+#ifndef NRF_ENERGY_CONFIG_RADIO_CURRENT_NA
+#define NRF_ENERGY_CONFIG_RADIO_CURRENT_NA 4800000
+#endif
 
-// <i> Configure which nrf_fstorage backend is used by FDS to write to flash.
-//==========================================================
-// <o> FDS_BACKEND  - FDS flash backend.
- 
+// <o> NRF_ENERGY_CONFIG_SAADC_CURRENT_NA - Current added while the SAADC acquisition runs, in nA. 
+// <i> Depends on the sample rate and acquisition time in use.
 
-// <i> NRF_FSTORAGE_SD uses the nrf_fstorage_sd backend implementation using the SoftDevice API. Use this if you have a SoftDevice present.
-// <i> NRF_FSTORAGE_NVMC uses the nrf_fstorage_nvmc implementation. Use this setting if you don't use the SoftDevice.
-// <1=> NRF_FSTORAGE_NVMC 
-// <2=> NRF_FSTORAGE_SD 
+#ifndef NRF_ENERGY_CONFIG_SAADC_CURRENT_NA
+#define NRF_ENERGY_CONFIG_SAADC_CURRENT_NA 700000
+#endif
 
-#ifndef FDS_BACKEND
-#define FDS_BACKEND 2
+// <o> NRF_ENERGY_CONFIG_SUPPLY_MV - Supply voltage used to convert charge to energy, in mV. 
+
+#ifndef NRF_ENERGY_CONFIG_SUPPLY_MV
+#define NRF_ENERGY_CONFIG_SUPPLY_MV 3000
 #endif
 
-// </h> 
-//==========================================================
+// </e>
 
-// <h> Queue - Queue settings
+// <e> NRF_FSTORAGE_ENABLED - nrf_fstorage - Flash abstraction library
+//==========================================================
+#ifndef NRF_FSTORAGE_ENABLED
+#define NRF_FSTORAGE_ENABLED 1
+#endif
+// <h> nrf_fstorage - Common settings
 
+// <i> Common settings to all fstorage implementations
 //==========================================================
-// <o> FDS_OP_QUEUE_SIZE - Size of the internal queue. 
-// <i> Increase this value if you frequently get synchronous FDS_ERR_NO_SPACE_IN_QUEUES errors.
+// <q> NRF_FSTORAGE_PARAM_CHECK_DISABLED  - Disable user input validation
+ 
 
-#ifndef FDS_OP_QUEUE_SIZE
-#define FDS_OP_QUEUE_SIZE 4
+// <i> If selected, use ASSERT to validate user input.
+// <i> This effectively removes user input validation in production code.
+// <i> Recommended setting: OFF, only enable this setting if size is a major concern.
+
+#ifndef NRF_FSTORAGE_PARAM_CHECK_DISABLED
+#define NRF_FSTORAGE_PARAM_CHECK_DISABLED 0
 #endif
 
 // </h> 
 //==========================================================
 
-// <h> CRC - CRC functionality
+// <h> nrf_fstorage_sd - Implementation using the SoftDevice
 
+// <i> Configuration options for the fstorage implementation using the SoftDevice
 //==========================================================
-// <e> FDS_CRC_CHECK_ON_READ - Enable CRC checks.
+// <o> NRF_FSTORAGE_SD_QUEUE_SIZE - Size of the internal queue of operations 
+// <i> Increase this value if API calls frequently return the error @ref NRF_ERROR_NO_MEM.
 
-// <i> Save a record's CRC when it is written to flash and check it when the record is opened.
-// <i> Records with an incorrect CRC can still be 'seen' by the user using FDS functions, but they cannot be opened.
-// <i> Additionally, they will not be garbage collected until they are deleted.
-//==========================================================
-#ifndef FDS_CRC_CHECK_ON_READ
-#define FDS_CRC_CHECK_ON_READ 0
+#ifndef NRF_FSTORAGE_SD_QUEUE_SIZE
+#define NRF_FSTORAGE_SD_QUEUE_SIZE 4
 #endif
-// <o> FDS_CRC_CHECK_ON_WRITE  - Perform a CRC check on newly written records.
- 
 
-// <i> Perform a CRC check on newly written records.
-// <i> This setting can be used to make sure that the record data was not altered while being written to flash.
-// <1=> Enabled 
-// <0=> Disabled 
+// <o> NRF_FSTORAGE_SD_MAX_RETRIES - Maximum number of attempts at executing an operation when the SoftDevice is busy 
+// <i> Increase this value if events frequently return the @ref NRF_ERROR_TIMEOUT error.
+// <i> The SoftDevice might fail to schedule flash access due to high BLE activity.
 
-#ifndef FDS_CRC_CHECK_ON_WRITE
-#define FDS_CRC_CHECK_ON_WRITE 0
+#ifndef NRF_FSTORAGE_SD_MAX_RETRIES
+#define NRF_FSTORAGE_SD_MAX_RETRIES 8
 #endif
 
-// </e>
-
-// </h> 
-//==========================================================
-
-// <h> Users - Number of users
+// <o> NRF_FSTORAGE_SD_MAX_WRITE_SIZE - Maximum number of bytes to be written to flash in a single operation 
+// <i> This value must be a multiple of four.
+// <i> Lowering this value can increase the chances of the SoftDevice being able to execute flash operations in between radio activity.
+// <i> This value is bound by the maximum number of bytes that can be written to flash in a single call to @ref sd_flash_write.
+// <i> That is 1024 bytes for nRF51 ICs and 4096 bytes for nRF52 ICs.
 
-//==========================================================
-// <o> FDS_MAX_USERS - Maximum number of callbacks that can be registered. 
-#ifndef FDS_MAX_USERS
-#define FDS_MAX_USERS 4
+#ifndef NRF_FSTORAGE_SD_MAX_WRITE_SIZE
+#define NRF_FSTORAGE_SD_MAX_WRITE_SIZE 4096
 #endif
 
 // </h> 
@@ -6870,1029 +9563,1126 @@
 
 // </e>
 
-// <q> HARDFAULT_HANDLER_ENABLED  - hardfault_default - HardFault default handler for debugging and release
+// <q> NRF_GFX_ENABLED  - nrf_gfx - GFX module
  
 
-#ifndef HARDFAULT_HANDLER_ENABLED
-#define HARDFAULT_HANDLER_ENABLED 0
+#ifndef NRF_GFX_ENABLED
+#define NRF_GFX_ENABLED 0
 #endif
 
-// <e> HCI_MEM_POOL_ENABLED - hci_mem_pool - memory pool implementation used by HCI
+// <e> NRF_LZ_ENABLED - nrf_lz - Streaming LZ compression
 //==========================================================
-#ifndef HCI_MEM_POOL_ENABLED
-#define HCI_MEM_POOL_ENABLED 0
-#endif
-// <o> HCI_TX_BUF_SIZE - TX buffer size in bytes. 
-#ifndef HCI_TX_BUF_SIZE
-#define HCI_TX_BUF_SIZE 600
+#ifndef NRF_LZ_ENABLED
+#define NRF_LZ_ENABLED 0
 #endif
+// <o> NRF_LZ_CONFIG_WINDOW_BITS - Largest window as a power of 2  <8-12> 
 
-// <o> HCI_RX_BUF_SIZE - RX buffer size in bytes. 
-#ifndef HCI_RX_BUF_SIZE
-#define HCI_RX_BUF_SIZE 600
+
+// <i> The encoder and the decoder each keep a window of (1 << bits) bytes. The peer may choose a smaller window.
+
+#ifndef NRF_LZ_CONFIG_WINDOW_BITS
+#define NRF_LZ_CONFIG_WINDOW_BITS 10
 #endif
 
-// <o> HCI_RX_BUF_QUEUE_SIZE - RX buffer queue size. 
-#ifndef HCI_RX_BUF_QUEUE_SIZE
-#define HCI_RX_BUF_QUEUE_SIZE 4
+// <o> NRF_LZ_CONFIG_HASH_BITS - Size of the hash table of the encoder as a power of 2  <6-12> 
+
+
+// <i> The table takes (2 << bits) bytes. A larger table finds more matches in a large window.
+
+#ifndef NRF_LZ_CONFIG_HASH_BITS
+#define NRF_LZ_CONFIG_HASH_BITS 8
 #endif
 
 // </e>
 
-// <e> HCI_SLIP_ENABLED - hci_slip - SLIP protocol implementation used by HCI
+// <q> NRF_MEMOBJ_ENABLED  - nrf_memobj - Linked memory allocator module
+ 
+
+#ifndef NRF_MEMOBJ_ENABLED
+#define NRF_MEMOBJ_ENABLED 1
+#endif
+
+// <e> NRF_MEM_TELEMETRY_ENABLED - nrf_mem_telemetry - Memory pool and stack telemetry
 //==========================================================
-#ifndef HCI_SLIP_ENABLED
-#define HCI_SLIP_ENABLED 0
+#ifndef NRF_MEM_TELEMETRY_ENABLED
+#define NRF_MEM_TELEMETRY_ENABLED 0
 #endif
-// <o> HCI_UART_BAUDRATE  - Default Baudrate
- 
-// <323584=> 1200 baud 
-// <643072=> 2400 baud 
-// <1290240=> 4800 baud 
-// <2576384=> 9600 baud 
-// <3862528=> 14400 baud 
-// <5152768=> 19200 baud 
-// <7716864=> 28800 baud 
-// <10289152=> 38400 baud 
-// <15400960=> 57600 baud 
-// <20615168=> 76800 baud 
-// <30801920=> 115200 baud 
-// <61865984=> 230400 baud 
-// <67108864=> 250000 baud 
-// <121634816=> 460800 baud 
-// <251658240=> 921600 baud 
-// <268435456=> 1000000 baud 
+// <o> NRF_MEM_TELEMETRY_CONFIG_BALLOC_MAX_POOLS - Number of balloc pools with failure counts  <1-64> 
 
-#ifndef HCI_UART_BAUDRATE
-#define HCI_UART_BAUDRATE 30801920
+
+// <i> Failures and sampled high-water marks are kept for this many pools of the nrf_balloc section. Later pools are reported without them.
+// <i> The sources are placed in the nrf_mem_telemetry section, which must be present in the linker configuration.
+
+#ifndef NRF_MEM_TELEMETRY_CONFIG_BALLOC_MAX_POOLS
+#define NRF_MEM_TELEMETRY_CONFIG_BALLOC_MAX_POOLS 16
 #endif
 
-// <o> HCI_UART_FLOW_CONTROL  - Hardware Flow Control
+// <q> NRF_MEM_TELEMETRY_CONFIG_STACK_ENABLED  - Report the main stack
  
-// <0=> Disabled 
-// <1=> Enabled 
 
-#ifndef HCI_UART_FLOW_CONTROL
-#define HCI_UART_FLOW_CONTROL 0
-#endif
+// <i> The unused stack is painted in nrf_mem_telemetry_init() to estimate the high-water mark.
+// <i> Needs the __StackLimit and __StackTop linker symbols.
 
-// <o> HCI_UART_RX_PIN - UART RX pin 
-#ifndef HCI_UART_RX_PIN
-#define HCI_UART_RX_PIN 8
+#ifndef NRF_MEM_TELEMETRY_CONFIG_STACK_ENABLED
+#define NRF_MEM_TELEMETRY_CONFIG_STACK_ENABLED 1
 #endif
 
-// <o> HCI_UART_TX_PIN - UART TX pin 
-#ifndef HCI_UART_TX_PIN
-#define HCI_UART_TX_PIN 6
+// <o> NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE - Queue size given to APP_SCHED_INIT  <0-65535> 
+
+
+// <i> Reports the app_scheduler queue when not 0. The high-water mark is exact with APP_SCHEDULER_WITH_PROFILER.
+
+#ifndef NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE
+#define NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE 0
 #endif
 
-// <o> HCI_UART_RTS_PIN - UART RTS pin 
-#ifndef HCI_UART_RTS_PIN
-#define HCI_UART_RTS_PIN 5
+// </e>
+
+// <q> NRF_PROFILER_ENABLED  - nrf_profiler - Code region profiler
+ 
+
+// <i> Times the code regions enclosed in NRF_PROFILER_BEGIN and NRF_PROFILER_END with the DWT cycle counter.
+// <i> The probes are placed in the nrf_profiler section, which must be present in the linker configuration.
+
+#ifndef NRF_PROFILER_ENABLED
+#define NRF_PROFILER_ENABLED 0
 #endif
 
-// <o> HCI_UART_CTS_PIN - UART CTS pin 
-#ifndef HCI_UART_CTS_PIN
-#define HCI_UART_CTS_PIN 7
+// <e> NRF_PWR_MGMT_ENABLED - nrf_pwr_mgmt - Power management module
+//==========================================================
+#ifndef NRF_PWR_MGMT_ENABLED
+#define NRF_PWR_MGMT_ENABLED 1
 #endif
+// <e> NRF_PWR_MGMT_CONFIG_DEBUG_PIN_ENABLED - Enables pin debug in the module.
 
-// </e>
+// <i> Selected pin will be set when CPU is in sleep mode.
+//==========================================================
+#ifndef NRF_PWR_MGMT_CONFIG_DEBUG_PIN_ENABLED
+#define NRF_PWR_MGMT_CONFIG_DEBUG_PIN_ENABLED 0
+#endif
+// <o> NRF_PWR_MGMT_SLEEP_DEBUG_PIN  - Pin number
+ 
+// <0=> 0 (P0.0) 
+// <1=> 1 (P0.1) 
+// <2=> 2 (P0.2) 
+// <3=> 3 (P0.3) 
+// <4=> 4 (P0.4) 
+// <5=> 5 (P0.5) 
+// <6=> 6 (P0.6) 
+// <7=> 7 (P0.7) 
+// <8=> 8 (P0.8) 
+// <9=> 9 (P0.9) 
+// <10=> 10 (P0.10) 
+// <11=> 11 (P0.11) 
+// <12=> 12 (P0.12) 
+// <13=> 13 (P0.13) 
+// <14=> 14 (P0.14) 
+// <15=> 15 (P0.15) 
+// <16=> 16 (P0.16) 
+// <17=> 17 (P0.17) 
+// <18=> 18 (P0.18) 
+// <19=> 19 (P0.19) 
+// <20=> 20 (P0.20) 
+// <21=> 21 (P0.21) 
+// <22=> 22 (P0.22) 
+// <23=> 23 (P0.23) 
+// <24=> 24 (P0.24) 
+// <25=> 25 (P0.25) 
+// <26=> 26 (P0.26) 
+// <27=> 27 (P0.27) 
+// <28=> 28 (P0.28) 
+// <29=> 29 (P0.29) 
+// <30=> 30 (P0.30) 
+// <31=> 31 (P0.31) 
+// <32=> 32 (P1.0) 
+// <33=> 33 (P1.1) 
+// <34=> 34 (P1.2) 
+// <35=> 35 (P1.3) 
+// <36=> 36 (P1.4) 
+// <37=> 37 (P1.5) 
+// <38=> 38 (P1.6) 
+// <39=> 39 (P1.7) 
+// <40=> 40 (P1.8) 
+// <41=> 41 (P1.9) 
+// <42=> 42 (P1.10) 
+// <43=> 43 (P1.11) 
+// <44=> 44 (P1.12) 
+// <45=> 45 (P1.13) 
+// <46=> 46 (P1.14) 
+// <47=> 47 (P1.15) 
+// <4294967295=> Not connected 
 
-// <e> HCI_TRANSPORT_ENABLED - hci_transport - HCI transport
-//==========================================================
-#ifndef HCI_TRANSPORT_ENABLED
-#define HCI_TRANSPORT_ENABLED 0
-#endif
-// <o> HCI_MAX_PACKET_SIZE_IN_BITS - Maximum size of a single application packet in bits. 
-#ifndef HCI_MAX_PACKET_SIZE_IN_BITS
-#define HCI_MAX_PACKET_SIZE_IN_BITS 8000
+#ifndef NRF_PWR_MGMT_SLEEP_DEBUG_PIN
+#define NRF_PWR_MGMT_SLEEP_DEBUG_PIN 31
 #endif
 
 // </e>
 
-// <q> LED_SOFTBLINK_ENABLED  - led_softblink - led_softblink module
+// <q> NRF_PWR_MGMT_CONFIG_CPU_USAGE_MONITOR_ENABLED  - Enables CPU usage monitor.
  
 
-#ifndef LED_SOFTBLINK_ENABLED
-#define LED_SOFTBLINK_ENABLED 0
+// <i> Module will trace percentage of CPU usage in one second intervals.
+
+#ifndef NRF_PWR_MGMT_CONFIG_CPU_USAGE_MONITOR_ENABLED
+#define NRF_PWR_MGMT_CONFIG_CPU_USAGE_MONITOR_ENABLED 0
 #endif
 
-// <q> LOW_POWER_PWM_ENABLED  - low_power_pwm - low_power_pwm module
+// <q> NRF_PWR_MGMT_CONFIG_STATS_ENABLED  - Enables sleep and wakeup statistics.
  
 
-#ifndef LOW_POWER_PWM_ENABLED
-#define LOW_POWER_PWM_ENABLED 0
+// <i> Module will count sleep durations, wakeups and their interrupt sources.
+// <i> Statistics are read with nrf_pwr_mgmt_stats_get().
+
+#ifndef NRF_PWR_MGMT_CONFIG_STATS_ENABLED
+#define NRF_PWR_MGMT_CONFIG_STATS_ENABLED 0
 #endif
 
-// <e> MEM_MANAGER_ENABLED - mem_manager - Dynamic memory allocator
+// <e> NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_ENABLED - Enable standby timeout.
 //==========================================================
-#ifndef MEM_MANAGER_ENABLED
-#define MEM_MANAGER_ENABLED 0
+#ifndef NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_ENABLED
+#define NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_ENABLED 0
 #endif
-// <o> MEMORY_MANAGER_SMALL_BLOCK_COUNT - Size of each memory blocks identified as 'small' block.  <0-255> 
-
+// <o> NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_S - Standby timeout (in seconds). 
+// <i> Shutdown procedure will begin no earlier than after this number of seconds.
 
-#ifndef MEMORY_MANAGER_SMALL_BLOCK_COUNT
-#define MEMORY_MANAGER_SMALL_BLOCK_COUNT 1
+#ifndef NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_S
+#define NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_S 3
 #endif
 
-// <o> MEMORY_MANAGER_SMALL_BLOCK_SIZE -  Size of each memory blocks identified as 'small' block. 
-// <i>  Size of each memory blocks identified as 'small' block. Memory block are recommended to be word-sized.
+// </e>
 
-#ifndef MEMORY_MANAGER_SMALL_BLOCK_SIZE
-#define MEMORY_MANAGER_SMALL_BLOCK_SIZE 32
+// <e> NRF_PWR_MGMT_CONFIG_TICKLESS_IDLE_ENABLED - Use next app_timer expiry for sleep decisions.
+// <i> HFCLK is kept requested over short idle periods and released before long ones.
+//==========================================================
+#ifndef NRF_PWR_MGMT_CONFIG_TICKLESS_IDLE_ENABLED
+#define NRF_PWR_MGMT_CONFIG_TICKLESS_IDLE_ENABLED 0
 #endif
+// <o> NRF_PWR_MGMT_CONFIG_TICKLESS_LONG_IDLE_MS - Shortest idle period (in milliseconds) treated as long. 
+// <i> Before a long idle period HFCLK request is released.
 
-// <o> MEMORY_MANAGER_MEDIUM_BLOCK_COUNT - Size of each memory blocks identified as 'medium' block.  <0-255> 
-
-
-#ifndef MEMORY_MANAGER_MEDIUM_BLOCK_COUNT
-#define MEMORY_MANAGER_MEDIUM_BLOCK_COUNT 0
+#ifndef NRF_PWR_MGMT_CONFIG_TICKLESS_LONG_IDLE_MS
+#define NRF_PWR_MGMT_CONFIG_TICKLESS_LONG_IDLE_MS 5
 #endif
 
-// <o> MEMORY_MANAGER_MEDIUM_BLOCK_SIZE -  Size of each memory blocks identified as 'medium' block. 
-// <i>  Size of each memory blocks identified as 'medium' block. Memory block are recommended to be word-sized.
+// <q> NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED  - Enables the sleep policy hook.
+ 
 
-#ifndef MEMORY_MANAGER_MEDIUM_BLOCK_SIZE
-#define MEMORY_MANAGER_MEDIUM_BLOCK_SIZE 256
+// <i> Before each sleep a policy decides from the idle time and the registered
+// <i> peripheral requirements which peripherals to suspend, whether to keep HFCLK
+// <i> and whether to use the constant latency or low power sub-mode.
+// <i> app_saadc and the UARTE log backend register the SAADC and UARTE handlers themselves.
+
+#ifndef NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED
+#define NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED 0
 #endif
 
-// <o> MEMORY_MANAGER_LARGE_BLOCK_COUNT - Size of each memory blocks identified as 'large' block.  <0-255> 
+// </e>
 
+// <q> NRF_PWR_MGMT_CONFIG_FPU_SUPPORT_ENABLED  - Enables FPU event cleaning.
+ 
 
-#ifndef MEMORY_MANAGER_LARGE_BLOCK_COUNT
-#define MEMORY_MANAGER_LARGE_BLOCK_COUNT 0
+#ifndef NRF_PWR_MGMT_CONFIG_FPU_SUPPORT_ENABLED
+#define NRF_PWR_MGMT_CONFIG_FPU_SUPPORT_ENABLED 1
 #endif
 
-// <o> MEMORY_MANAGER_LARGE_BLOCK_SIZE -  Size of each memory blocks identified as 'large' block. 
-// <i>  Size of each memory blocks identified as 'large' block. Memory block are recommended to be word-sized.
+// <q> NRF_PWR_MGMT_CONFIG_AUTO_SHUTDOWN_RETRY  - Blocked shutdown procedure will be retried every second.
+ 
 
-#ifndef MEMORY_MANAGER_LARGE_BLOCK_SIZE
-#define MEMORY_MANAGER_LARGE_BLOCK_SIZE 256
+#ifndef NRF_PWR_MGMT_CONFIG_AUTO_SHUTDOWN_RETRY
+#define NRF_PWR_MGMT_CONFIG_AUTO_SHUTDOWN_RETRY 0
 #endif
 
-// <o> MEMORY_MANAGER_XLARGE_BLOCK_COUNT - Size of each memory blocks identified as 'extra large' block.  <0-255> 
-
+// <q> NRF_PWR_MGMT_CONFIG_USE_SCHEDULER  - Module will use @ref app_scheduler.
+ 
 
-#ifndef MEMORY_MANAGER_XLARGE_BLOCK_COUNT
-#define MEMORY_MANAGER_XLARGE_BLOCK_COUNT 0
+#ifndef NRF_PWR_MGMT_CONFIG_USE_SCHEDULER
+#define NRF_PWR_MGMT_CONFIG_USE_SCHEDULER 0
 #endif
 
-// <o> MEMORY_MANAGER_XLARGE_BLOCK_SIZE -  Size of each memory blocks identified as 'extra large' block. 
-// <i>  Size of each memory blocks identified as 'extra large' block. Memory block are recommended to be word-sized.
+// <o> NRF_PWR_MGMT_CONFIG_HANDLER_PRIORITY_COUNT - The number of priorities for module handlers. 
+// <i> The number of stages of the shutdown process.
 
-#ifndef MEMORY_MANAGER_XLARGE_BLOCK_SIZE
-#define MEMORY_MANAGER_XLARGE_BLOCK_SIZE 1320
+#ifndef NRF_PWR_MGMT_CONFIG_HANDLER_PRIORITY_COUNT
+#define NRF_PWR_MGMT_CONFIG_HANDLER_PRIORITY_COUNT 3
 #endif
 
-// <o> MEMORY_MANAGER_XXLARGE_BLOCK_COUNT - Size of each memory blocks identified as 'extra extra large' block.  <0-255> 
-
+// </e>
 
-#ifndef MEMORY_MANAGER_XXLARGE_BLOCK_COUNT
-#define MEMORY_MANAGER_XXLARGE_BLOCK_COUNT 0
+// <e> NRF_QUEUE_ENABLED - nrf_queue - Queue module
+//==========================================================
+#ifndef NRF_QUEUE_ENABLED
+#define NRF_QUEUE_ENABLED 1
 #endif
+// <q> NRF_QUEUE_CLI_CMDS  - Enable CLI commands specific to the module
+ 
 
-// <o> MEMORY_MANAGER_XXLARGE_BLOCK_SIZE -  Size of each memory blocks identified as 'extra extra large' block. 
-// <i>  Size of each memory blocks identified as 'extra extra large' block. Memory block are recommended to be word-sized.
-
-#ifndef MEMORY_MANAGER_XXLARGE_BLOCK_SIZE
-#define MEMORY_MANAGER_XXLARGE_BLOCK_SIZE 3444
+#ifndef NRF_QUEUE_CLI_CMDS
+#define NRF_QUEUE_CLI_CMDS 0
 #endif
 
-// <o> MEMORY_MANAGER_XSMALL_BLOCK_COUNT - Size of each memory blocks identified as 'extra small' block.  <0-255> 
+// </e>
 
+// <q> NRF_SECTION_ITER_ENABLED  - nrf_section_iter - Section iterator
+ 
 
-#ifndef MEMORY_MANAGER_XSMALL_BLOCK_COUNT
-#define MEMORY_MANAGER_XSMALL_BLOCK_COUNT 0
+#ifndef NRF_SECTION_ITER_ENABLED
+#define NRF_SECTION_ITER_ENABLED 1
 #endif
 
-// <o> MEMORY_MANAGER_XSMALL_BLOCK_SIZE -  Size of each memory blocks identified as 'extra small' block. 
-// <i>  Size of each memory blocks identified as 'extra large' block. Memory block are recommended to be word-sized.
-
-#ifndef MEMORY_MANAGER_XSMALL_BLOCK_SIZE
-#define MEMORY_MANAGER_XSMALL_BLOCK_SIZE 64
+// <e> NRF_SKIPLIST_ENABLED - nrf_skiplist - Skip list ordered set
+//==========================================================
+#ifndef NRF_SKIPLIST_ENABLED
+#define NRF_SKIPLIST_ENABLED 0
 #endif
+// <o> NRF_SKIPLIST_CONFIG_MAX_LEVEL - Maximum number of levels of an item  <1-16> 
 
-// <o> MEMORY_MANAGER_XXSMALL_BLOCK_COUNT - Size of each memory blocks identified as 'extra extra small' block.  <0-255> 
 
+// <i> Each item holds one link per level. Sets of up to about 4^level items are handled in O(log n).
 
-#ifndef MEMORY_MANAGER_XXSMALL_BLOCK_COUNT
-#define MEMORY_MANAGER_XXSMALL_BLOCK_COUNT 0
+#ifndef NRF_SKIPLIST_CONFIG_MAX_LEVEL
+#define NRF_SKIPLIST_CONFIG_MAX_LEVEL 6
 #endif
 
-// <o> MEMORY_MANAGER_XXSMALL_BLOCK_SIZE -  Size of each memory blocks identified as 'extra extra small' block. 
-// <i>  Size of each memory blocks identified as 'extra extra small' block. Memory block are recommended to be word-sized.
-
-#ifndef MEMORY_MANAGER_XXSMALL_BLOCK_SIZE
-#define MEMORY_MANAGER_XXSMALL_BLOCK_SIZE 32
-#endif
+// </e>
 
-// <e> MEM_MANAGER_CONFIG_LOG_ENABLED - Enables logging in the module.
-//==========================================================
-#ifndef MEM_MANAGER_CONFIG_LOG_ENABLED
-#define MEM_MANAGER_CONFIG_LOG_ENABLED 0
-#endif
-// <o> MEM_MANAGER_CONFIG_LOG_LEVEL  - Default Severity level
+// <q> NRF_SLAB_ENABLED  - nrf_slab - Size class allocator built on nrf_balloc
  
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
 
-#ifndef MEM_MANAGER_CONFIG_LOG_LEVEL
-#define MEM_MANAGER_CONFIG_LOG_LEVEL 3
+#ifndef NRF_SLAB_ENABLED
+#define NRF_SLAB_ENABLED 0
 #endif
 
-// <o> MEM_MANAGER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <q> NRF_SORTLIST_ENABLED  - nrf_sortlist - Sorted list
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef MEM_MANAGER_CONFIG_INFO_COLOR
-#define MEM_MANAGER_CONFIG_INFO_COLOR 0
+#ifndef NRF_SORTLIST_ENABLED
+#define NRF_SORTLIST_ENABLED 1
 #endif
 
-// <o> MEM_MANAGER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <q> NRF_SPI_MNGR_ENABLED  - nrf_spi_mngr - SPI transaction manager
  
-// <0=> Default 
-// <1=> Black 
-// <2=> Red 
-// <3=> Green 
-// <4=> Yellow 
-// <5=> Blue 
-// <6=> Magenta 
-// <7=> Cyan 
-// <8=> White 
 
-#ifndef MEM_MANAGER_CONFIG_DEBUG_COLOR
-#define MEM_MANAGER_CONFIG_DEBUG_COLOR 0
+#ifndef NRF_SPI_MNGR_ENABLED
+#define NRF_SPI_MNGR_ENABLED 0
 #endif
 
-// </e>
-
-// <q> MEM_MANAGER_DISABLE_API_PARAM_CHECK  - Disable API parameter checks in the module.
+// <q> NRF_STRERROR_ENABLED  - nrf_strerror - Library for converting error code to string.
  
 
-#ifndef MEM_MANAGER_DISABLE_API_PARAM_CHECK
-#define MEM_MANAGER_DISABLE_API_PARAM_CHECK 0
+#ifndef NRF_STRERROR_ENABLED
+#define NRF_STRERROR_ENABLED 1
 #endif
 
-// </e>
-
-// <e> NRF_BALLOC_ENABLED - nrf_balloc - Block allocator module
-//==========================================================
-#ifndef NRF_BALLOC_ENABLED
-#define NRF_BALLOC_ENABLED 1
-#endif
-// <e> NRF_BALLOC_CONFIG_DEBUG_ENABLED - Enables debug mode in the module.
+// <e> NRF_TRACE_ENABLED - nrf_trace - Binary event trace for SEGGER SystemView
 //==========================================================
-#ifndef NRF_BALLOC_CONFIG_DEBUG_ENABLED
-#define NRF_BALLOC_CONFIG_DEBUG_ENABLED 0
+#ifndef NRF_TRACE_ENABLED
+#define NRF_TRACE_ENABLED 0
 #endif
-// <o> NRF_BALLOC_CONFIG_HEAD_GUARD_WORDS - Number of words used as head guard.  <0-255> 
+// <o> NRF_TRACE_CONFIG_RTT_CHANNEL - RTT channel used by the trace. 
+// <i> Must be below SEGGER_RTT_CONFIG_MAX_NUM_UP_BUFFERS and SEGGER_RTT_CONFIG_MAX_NUM_DOWN_BUFFERS.
 
-
-#ifndef NRF_BALLOC_CONFIG_HEAD_GUARD_WORDS
-#define NRF_BALLOC_CONFIG_HEAD_GUARD_WORDS 1
+#ifndef NRF_TRACE_CONFIG_RTT_CHANNEL
+#define NRF_TRACE_CONFIG_RTT_CHANNEL 1
 #endif
 
-// <o> NRF_BALLOC_CONFIG_TAIL_GUARD_WORDS - Number of words used as tail guard.  <0-255> 
-
+// <o> NRF_TRACE_CONFIG_RTT_BUFFER_SIZE - Size of the RTT buffer towards the host, in bytes. 
 
-#ifndef NRF_BALLOC_CONFIG_TAIL_GUARD_WORDS
-#define NRF_BALLOC_CONFIG_TAIL_GUARD_WORDS 1
+#ifndef NRF_TRACE_CONFIG_RTT_BUFFER_SIZE
+#define NRF_TRACE_CONFIG_RTT_BUFFER_SIZE 1024
 #endif
 
-// <q> NRF_BALLOC_CONFIG_BASIC_CHECKS_ENABLED  - Enables basic checks in this module.
- 
+// <o> NRF_TRACE_CONFIG_RECORDS - Number of records buffered until nrf_trace_process is called. 
+// <i> Must be a power of two. Each record takes 8 bytes.
 
-#ifndef NRF_BALLOC_CONFIG_BASIC_CHECKS_ENABLED
-#define NRF_BALLOC_CONFIG_BASIC_CHECKS_ENABLED 0
+#ifndef NRF_TRACE_CONFIG_RECORDS
+#define NRF_TRACE_CONFIG_RECORDS 128
 #endif
 
-// <q> NRF_BALLOC_CONFIG_DOUBLE_FREE_CHECK_ENABLED  - Enables double memory free check in this module.
- 
-
-#ifndef NRF_BALLOC_CONFIG_DOUBLE_FREE_CHECK_ENABLED
-#define NRF_BALLOC_CONFIG_DOUBLE_FREE_CHECK_ENABLED 0
-#endif
+// </e>
 
-// <q> NRF_BALLOC_CONFIG_DATA_TRASHING_CHECK_ENABLED  - Enables free memory corruption check in this module.
+// <q> NRF_TWI_MNGR_ENABLED  - nrf_twi_mngr - TWI transaction manager
  
 
-#ifndef NRF_BALLOC_CONFIG_DATA_TRASHING_CHECK_ENABLED
-#define NRF_BALLOC_CONFIG_DATA_TRASHING_CHECK_ENABLED 0
+#ifndef NRF_TWI_MNGR_ENABLED
+#define NRF_TWI_MNGR_ENABLED 0
 #endif
 
-// <q> NRF_BALLOC_CLI_CMDS  - Enable CLI commands specific to the module
+// <q> SLIP_ENABLED  - slip - SLIP encoding and decoding
  
 
-#ifndef NRF_BALLOC_CLI_CMDS
-#define NRF_BALLOC_CLI_CMDS 0
+#ifndef SLIP_ENABLED
+#define SLIP_ENABLED 0
 #endif
 
-// </e>
-
-// </e>
-
-// <e> NRF_CSENSE_ENABLED - nrf_csense - Capacitive sensor module
+// <e> TASK_MANAGER_ENABLED - task_manager - Task manager.
 //==========================================================
-#ifndef NRF_CSENSE_ENABLED
-#define NRF_CSENSE_ENABLED 0
-#endif
-// <o> NRF_CSENSE_PAD_HYSTERESIS - Minimum value of change required to determine that a pad was touched. 
-#ifndef NRF_CSENSE_PAD_HYSTERESIS
-#define NRF_CSENSE_PAD_HYSTERESIS 15
+#ifndef TASK_MANAGER_ENABLED
+#define TASK_MANAGER_ENABLED 0
 #endif
+// <q> TASK_MANAGER_CLI_CMDS  - Enable CLI commands specific to the module
+ 
 
-// <o> NRF_CSENSE_PAD_DEVIATION - Minimum value measured on a pad required to take it into account while calculating the step. 
-#ifndef NRF_CSENSE_PAD_DEVIATION
-#define NRF_CSENSE_PAD_DEVIATION 70
+#ifndef TASK_MANAGER_CLI_CMDS
+#define TASK_MANAGER_CLI_CMDS 0
 #endif
 
-// <o> NRF_CSENSE_MIN_PAD_VALUE - Minimum normalized value on a pad required to take its value into account. 
-#ifndef NRF_CSENSE_MIN_PAD_VALUE
-#define NRF_CSENSE_MIN_PAD_VALUE 20
+// <o> TASK_MANAGER_CONFIG_MAX_TASKS - Maximum number of tasks which can be created 
+#ifndef TASK_MANAGER_CONFIG_MAX_TASKS
+#define TASK_MANAGER_CONFIG_MAX_TASKS 2
 #endif
 
-// <o> NRF_CSENSE_MAX_PADS_NUMBER - Maximum number of pads used for one instance. 
-#ifndef NRF_CSENSE_MAX_PADS_NUMBER
-#define NRF_CSENSE_MAX_PADS_NUMBER 20
+// <o> TASK_MANAGER_CONFIG_STACK_SIZE - Stack size for every task (power of 2) 
+#ifndef TASK_MANAGER_CONFIG_STACK_SIZE
+#define TASK_MANAGER_CONFIG_STACK_SIZE 1024
 #endif
 
-// <o> NRF_CSENSE_MAX_VALUE - Maximum normalized value obtained from measurement. 
-#ifndef NRF_CSENSE_MAX_VALUE
-#define NRF_CSENSE_MAX_VALUE 1000
+// <q> TASK_MANAGER_CONFIG_STACK_PROFILER_ENABLED  - Enable stack profiling.
+ 
+
+#ifndef TASK_MANAGER_CONFIG_STACK_PROFILER_ENABLED
+#define TASK_MANAGER_CONFIG_STACK_PROFILER_ENABLED 1
 #endif
 
-// <o> NRF_CSENSE_OUTPUT_PIN - Output pin used by the low-level module. 
-// <i> This is used when capacitive sensor does not use COMP.
+// <o> TASK_MANAGER_CONFIG_STACK_GUARD  - Configures stack guard.
+ 
+// <0=> Disabled 
+// <4=> 32 bytes 
+// <5=> 64 bytes 
+// <6=> 128 bytes 
+// <7=> 256 bytes 
+// <8=> 512 bytes 
 
-#ifndef NRF_CSENSE_OUTPUT_PIN
-#define NRF_CSENSE_OUTPUT_PIN 26
+#ifndef TASK_MANAGER_CONFIG_STACK_GUARD
+#define TASK_MANAGER_CONFIG_STACK_GUARD 7
 #endif
 
 // </e>
 
-// <e> NRF_DRV_CSENSE_ENABLED - nrf_drv_csense - Capacitive sensor low-level module
-//==========================================================
-#ifndef NRF_DRV_CSENSE_ENABLED
-#define NRF_DRV_CSENSE_ENABLED 0
-#endif
-// <e> USE_COMP - Use the comparator to implement the capacitive sensor driver.
+// <h> app_button - buttons handling module
 
-// <i> Due to Anomaly 84, COMP I_SOURCE is not functional. It has too high a varation.
 //==========================================================
-#ifndef USE_COMP
-#define USE_COMP 0
-#endif
-// <o> TIMER0_FOR_CSENSE - First TIMER instance used by the driver (not used on nRF51). 
-#ifndef TIMER0_FOR_CSENSE
-#define TIMER0_FOR_CSENSE 1
-#endif
+// <q> BUTTON_ENABLED  - Enables Button module
+ 
 
-// <o> TIMER1_FOR_CSENSE - Second TIMER instance used by the driver (not used on nRF51). 
-#ifndef TIMER1_FOR_CSENSE
-#define TIMER1_FOR_CSENSE 2
+#ifndef BUTTON_ENABLED
+#define BUTTON_ENABLED 1
 #endif
 
-// <o> MEASUREMENT_PERIOD - Single measurement period. 
-// <i> Time of a single measurement can be calculated as
-// <i> T = (1/2)*MEASUREMENT_PERIOD*(1/f_OSC) where f_OSC = I_SOURCE / (2C*(VUP-VDOWN) ).
-// <i> I_SOURCE, VUP, and VDOWN are values used to initialize COMP and C is the capacitance of the used pad.
+// <q> BUTTON_HIGH_ACCURACY_ENABLED  - Enables GPIOTE high accuracy for buttons
+ 
 
-#ifndef MEASUREMENT_PERIOD
-#define MEASUREMENT_PERIOD 20
+#ifndef BUTTON_HIGH_ACCURACY_ENABLED
+#define BUTTON_HIGH_ACCURACY_ENABLED 0
 #endif
 
-// </e>
+// </h> 
+//==========================================================
 
-// </e>
+// <h> app_usbd_cdc_acm - USB CDC ACM class
 
-// <e> NRF_FSTORAGE_ENABLED - nrf_fstorage - Flash abstraction library
 //==========================================================
-#ifndef NRF_FSTORAGE_ENABLED
-#define NRF_FSTORAGE_ENABLED 1
+// <q> APP_USBD_CDC_ACM_ENABLED  - Enabling USBD CDC ACM Class library
+ 
+
+#ifndef APP_USBD_CDC_ACM_ENABLED
+#define APP_USBD_CDC_ACM_ENABLED 0
 #endif
-// <h> nrf_fstorage - Common settings
 
-// <i> Common settings to all fstorage implementations
-//==========================================================
-// <q> NRF_FSTORAGE_PARAM_CHECK_DISABLED  - Disable user input validation
+// <q> APP_USBD_CDC_ACM_ZLP_ON_EPSIZE_WRITE  - Send ZLP on write with same size as endpoint
  
 
-// <i> If selected, use ASSERT to validate user input.
-// <i> This effectively removes user input validation in production code.
-// <i> Recommended setting: OFF, only enable this setting if size is a major concern.
+// <i> If enabled, CDC ACM class will automatically send a zero length packet after transfer which has the same size as endpoint.
+// <i> This may limit throughput if a lot of binary data is sent, but in terminal mode operation it makes sure that the data is always displayed right after it is sent.
 
-#ifndef NRF_FSTORAGE_PARAM_CHECK_DISABLED
-#define NRF_FSTORAGE_PARAM_CHECK_DISABLED 0
+#ifndef APP_USBD_CDC_ACM_ZLP_ON_EPSIZE_WRITE
+#define APP_USBD_CDC_ACM_ZLP_ON_EPSIZE_WRITE 1
 #endif
 
 // </h> 
 //==========================================================
 
-// <h> nrf_fstorage_sd - Implementation using the SoftDevice
+// <h> nrf_cli - Command line interface
 
-// <i> Configuration options for the fstorage implementation using the SoftDevice
 //==========================================================
-// <o> NRF_FSTORAGE_SD_QUEUE_SIZE - Size of the internal queue of operations 
-// <i> Increase this value if API calls frequently return the error @ref NRF_ERROR_NO_MEM.
+// <q> NRF_CLI_ENABLED  - Enable/disable the CLI module.
+ 
 
-#ifndef NRF_FSTORAGE_SD_QUEUE_SIZE
-#define NRF_FSTORAGE_SD_QUEUE_SIZE 4
+#ifndef NRF_CLI_ENABLED
+#define NRF_CLI_ENABLED 0
 #endif
 
-// <o> NRF_FSTORAGE_SD_MAX_RETRIES - Maximum number of attempts at executing an operation when the SoftDevice is busy 
-// <i> Increase this value if events frequently return the @ref NRF_ERROR_TIMEOUT error.
-// <i> The SoftDevice might fail to schedule flash access due to high BLE activity.
-
-#ifndef NRF_FSTORAGE_SD_MAX_RETRIES
-#define NRF_FSTORAGE_SD_MAX_RETRIES 8
+// <o> NRF_CLI_ARGC_MAX - Maximum number of parameters passed to the command handler. 
+#ifndef NRF_CLI_ARGC_MAX
+#define NRF_CLI_ARGC_MAX 12
 #endif
 
-// <o> NRF_FSTORAGE_SD_MAX_WRITE_SIZE - Maximum number of bytes to be written to flash in a single operation 
-// <i> This value must be a multiple of four.
-// <i> Lowering this value can increase the chances of the SoftDevice being able to execute flash operations in between radio activity.
-// <i> This value is bound by the maximum number of bytes that can be written to flash in a single call to @ref sd_flash_write.
-// <i> That is 1024 bytes for nRF51 ICs and 4096 bytes for nRF52 ICs.
+// <q> NRF_CLI_BUILD_IN_CMDS_ENABLED  - CLI built-in commands.
+ 
 
-#ifndef NRF_FSTORAGE_SD_MAX_WRITE_SIZE
-#define NRF_FSTORAGE_SD_MAX_WRITE_SIZE 4096
+#ifndef NRF_CLI_BUILD_IN_CMDS_ENABLED
+#define NRF_CLI_BUILD_IN_CMDS_ENABLED 1
 #endif
 
-// </h> 
-//==========================================================
+// <o> NRF_CLI_CMD_BUFF_SIZE - Maximum buffer size for a single command. 
+#ifndef NRF_CLI_CMD_BUFF_SIZE
+#define NRF_CLI_CMD_BUFF_SIZE 128
+#endif
 
-// </e>
+// <q> NRF_CLI_ECHO_STATUS  - CLI echo status. If set, echo is ON.
+ 
 
-// <q> NRF_GFX_ENABLED  - nrf_gfx - GFX module
+#ifndef NRF_CLI_ECHO_STATUS
+#define NRF_CLI_ECHO_STATUS 1
+#endif
+
+// <q> NRF_CLI_WILDCARD_ENABLED  - Enable wildcard functionality for CLI commands.
  
 
-#ifndef NRF_GFX_ENABLED
-#define NRF_GFX_ENABLED 0
+#ifndef NRF_CLI_WILDCARD_ENABLED
+#define NRF_CLI_WILDCARD_ENABLED 0
 #endif
 
-// <q> NRF_MEMOBJ_ENABLED  - nrf_memobj - Linked memory allocator module
+// <q> NRF_CLI_METAKEYS_ENABLED  - Enable additional control keys for CLI commands like ctrl+a, ctrl+e, ctrl+w, ctrl+u
  
 
-#ifndef NRF_MEMOBJ_ENABLED
-#define NRF_MEMOBJ_ENABLED 1
+#ifndef NRF_CLI_METAKEYS_ENABLED
+#define NRF_CLI_METAKEYS_ENABLED 0
 #endif
 
-// <e> NRF_PWR_MGMT_ENABLED - nrf_pwr_mgmt - Power management module
-//==========================================================
-#ifndef NRF_PWR_MGMT_ENABLED
-#define NRF_PWR_MGMT_ENABLED 1
+// <o> NRF_CLI_PRINTF_BUFF_SIZE - Maximum print buffer size. 
+#ifndef NRF_CLI_PRINTF_BUFF_SIZE
+#define NRF_CLI_PRINTF_BUFF_SIZE 23
 #endif
-// <e> NRF_PWR_MGMT_CONFIG_DEBUG_PIN_ENABLED - Enables pin debug in the module.
 
-// <i> Selected pin will be set when CPU is in sleep mode.
+// <e> NRF_CLI_HISTORY_ENABLED - Enable CLI history mode.
 //==========================================================
-#ifndef NRF_PWR_MGMT_CONFIG_DEBUG_PIN_ENABLED
-#define NRF_PWR_MGMT_CONFIG_DEBUG_PIN_ENABLED 0
+#ifndef NRF_CLI_HISTORY_ENABLED
+#define NRF_CLI_HISTORY_ENABLED 1
+#endif
+// <o> NRF_CLI_HISTORY_ELEMENT_SIZE - Size of one memory object reserved for CLI history. 
+#ifndef NRF_CLI_HISTORY_ELEMENT_SIZE
+#define NRF_CLI_HISTORY_ELEMENT_SIZE 32
 #endif
-// <o> NRF_PWR_MGMT_SLEEP_DEBUG_PIN  - Pin number
- 
-// <0=> 0 (P0.0) 
-// <1=> 1 (P0.1) 
-// <2=> 2 (P0.2) 
-// <3=> 3 (P0.3) 
-// <4=> 4 (P0.4) 
-// <5=> 5 (P0.5) 
-// <6=> 6 (P0.6) 
-// <7=> 7 (P0.7) 
-// <8=> 8 (P0.8) 
-// <9=> 9 (P0.9) 
-// <10=> 10 (P0.10) 
-// <11=> 11 (P0.11) 
-// <12=> 12 (P0.12) 
-// <13=> 13 (P0.13) 
-// <14=> 14 (P0.14) 
-// <15=> 15 (P0.15) 
-// <16=> 16 (P0.16) 
-// <17=> 17 (P0.17) 
-// <18=> 18 (P0.18) 
-// <19=> 19 (P0.19) 
-// <20=> 20 (P0.20) 
-// <21=> 21 (P0.21) 
-// <22=> 22 (P0.22) 
-// <23=> 23 (P0.23) 
-// <24=> 24 (P0.24) 
-// <25=> 25 (P0.25) 
-// <26=> 26 (P0.26) 
-// <27=> 27 (P0.27) 
-// <28=> 28 (P0.28) 
-// <29=> 29 (P0.29) 
-// <30=> 30 (P0.30) 
-// <31=> 31 (P0.31) 
-// <32=> 32 (P1.0) 
-// <33=> 33 (P1.1) 
-// <34=> 34 (P1.2) 
-// <35=> 35 (P1.3) 
-// <36=> 36 (P1.4) 
-// <37=> 37 (P1.5) 
-// <38=> 38 (P1.6) 
-// <39=> 39 (P1.7) 
-// <40=> 40 (P1.8) 
-// <41=> 41 (P1.9) 
-// <42=> 42 (P1.10) 
-// <43=> 43 (P1.11) 
-// <44=> 44 (P1.12) 
-// <45=> 45 (P1.13) 
-// <46=> 46 (P1.14) 
-// <47=> 47 (P1.15) 
-// <4294967295=> Not connected 
 
-#ifndef NRF_PWR_MGMT_SLEEP_DEBUG_PIN
-#define NRF_PWR_MGMT_SLEEP_DEBUG_PIN 31
+// <o> NRF_CLI_HISTORY_ELEMENT_COUNT - Number of history memory objects. 
+#ifndef NRF_CLI_HISTORY_ELEMENT_COUNT
+#define NRF_CLI_HISTORY_ELEMENT_COUNT 8
 #endif
 
 // </e>
 
-// <q> NRF_PWR_MGMT_CONFIG_CPU_USAGE_MONITOR_ENABLED  - Enables CPU usage monitor.
+// <q> NRF_CLI_VT100_COLORS_ENABLED  - CLI VT100 colors.
  
 
-// <i> Module will trace percentage of CPU usage in one second intervals.
+#ifndef NRF_CLI_VT100_COLORS_ENABLED
+#define NRF_CLI_VT100_COLORS_ENABLED 1
+#endif
 
-#ifndef NRF_PWR_MGMT_CONFIG_CPU_USAGE_MONITOR_ENABLED
-#define NRF_PWR_MGMT_CONFIG_CPU_USAGE_MONITOR_ENABLED 0
+// <q> NRF_CLI_STATISTICS_ENABLED  - Enable CLI statistics.
+ 
+
+#ifndef NRF_CLI_STATISTICS_ENABLED
+#define NRF_CLI_STATISTICS_ENABLED 1
 #endif
 
-// <e> NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_ENABLED - Enable standby timeout.
-//==========================================================
-#ifndef NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_ENABLED
-#define NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_ENABLED 0
+// <q> NRF_CLI_LOG_BACKEND  - Enable logger backend interface.
+ 
+
+#ifndef NRF_CLI_LOG_BACKEND
+#define NRF_CLI_LOG_BACKEND 1
 #endif
-// <o> NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_S - Standby timeout (in seconds). 
-// <i> Shutdown procedure will begin no earlier than after this number of seconds.
 
-#ifndef NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_S
-#define NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_S 3
+// <q> NRF_CLI_USES_TASK_MANAGER_ENABLED  - Enable CLI to use task_manager
+ 
+
+#ifndef NRF_CLI_USES_TASK_MANAGER_ENABLED
+#define NRF_CLI_USES_TASK_MANAGER_ENABLED 0
+#endif
+
+// </h> 
+//==========================================================
+
+// <h> nrf_fprintf - fprintf function.
+
+//==========================================================
+// <q> NRF_FPRINTF_ENABLED  - Enable/disable fprintf module.
+ 
+
+#ifndef NRF_FPRINTF_ENABLED
+#define NRF_FPRINTF_ENABLED 1
 #endif
 
-// </e>
-
-// <q> NRF_PWR_MGMT_CONFIG_FPU_SUPPORT_ENABLED  - Enables FPU event cleaning.
+// <q> NRF_FPRINTF_FLAG_AUTOMATIC_CR_ON_LF_ENABLED  - For each printed LF, function will add CR.
  
 
-#ifndef NRF_PWR_MGMT_CONFIG_FPU_SUPPORT_ENABLED
-#define NRF_PWR_MGMT_CONFIG_FPU_SUPPORT_ENABLED 1
+#ifndef NRF_FPRINTF_FLAG_AUTOMATIC_CR_ON_LF_ENABLED
+#define NRF_FPRINTF_FLAG_AUTOMATIC_CR_ON_LF_ENABLED 1
 #endif
 
-// <q> NRF_PWR_MGMT_CONFIG_AUTO_SHUTDOWN_RETRY  - Blocked shutdown procedure will be retried every second.
+// <q> NRF_FPRINTF_DOUBLE_ENABLED  - Enable IEEE-754 double precision formatting.
  
 
-#ifndef NRF_PWR_MGMT_CONFIG_AUTO_SHUTDOWN_RETRY
-#define NRF_PWR_MGMT_CONFIG_AUTO_SHUTDOWN_RETRY 0
+#ifndef NRF_FPRINTF_DOUBLE_ENABLED
+#define NRF_FPRINTF_DOUBLE_ENABLED 0
 #endif
 
-// <q> NRF_PWR_MGMT_CONFIG_USE_SCHEDULER  - Module will use @ref app_scheduler.
+// <q> NRF_FPRINTF_SINK_ENABLED  - Enable the batching sink that hands whole blocks of output to a writer.
  
 
-#ifndef NRF_PWR_MGMT_CONFIG_USE_SCHEDULER
-#define NRF_PWR_MGMT_CONFIG_USE_SCHEDULER 0
+#ifndef NRF_FPRINTF_SINK_ENABLED
+#define NRF_FPRINTF_SINK_ENABLED 0
 #endif
 
-// <o> NRF_PWR_MGMT_CONFIG_HANDLER_PRIORITY_COUNT - The number of priorities for module handlers. 
-// <i> The number of stages of the shutdown process.
+// </h> 
+//==========================================================
 
-#ifndef NRF_PWR_MGMT_CONFIG_HANDLER_PRIORITY_COUNT
-#define NRF_PWR_MGMT_CONFIG_HANDLER_PRIORITY_COUNT 3
-#endif
+// </h> 
+//==========================================================
 
-// </e>
+// <h> nRF_Log 
 
-// <e> NRF_QUEUE_ENABLED - nrf_queue - Queue module
 //==========================================================
-#ifndef NRF_QUEUE_ENABLED
-#define NRF_QUEUE_ENABLED 1
+// <e> NRF_LOG_BACKEND_RTT_ENABLED - nrf_log_backend_rtt - Log RTT backend
+//==========================================================
+#ifndef NRF_LOG_BACKEND_RTT_ENABLED
+#define NRF_LOG_BACKEND_RTT_ENABLED 1
 #endif
-// <q> NRF_QUEUE_CLI_CMDS  - Enable CLI commands specific to the module
- 
+// <o> NRF_LOG_BACKEND_RTT_TEMP_BUFFER_SIZE - Size of buffer for partially processed strings. 
+// <i> Size of the buffer is a trade-off between RAM usage and processing.
+// <i> if buffer is smaller then strings will often be fragmented.
+// <i> It is recommended to use size which will fit typical log and only the
+// <i> longer one will be fragmented.
 
-#ifndef NRF_QUEUE_CLI_CMDS
-#define NRF_QUEUE_CLI_CMDS 0
+#ifndef NRF_LOG_BACKEND_RTT_TEMP_BUFFER_SIZE
+#define NRF_LOG_BACKEND_RTT_TEMP_BUFFER_SIZE 64
 #endif
 
-// </e>
-
-// <q> NRF_SECTION_ITER_ENABLED  - nrf_section_iter - Section iterator
- 
-
-#ifndef NRF_SECTION_ITER_ENABLED
-#define NRF_SECTION_ITER_ENABLED 1
+// <o> NRF_LOG_BACKEND_RTT_TX_RETRY_DELAY_MS - Period before retrying writing to RTT 
+#ifndef NRF_LOG_BACKEND_RTT_TX_RETRY_DELAY_MS
+#define NRF_LOG_BACKEND_RTT_TX_RETRY_DELAY_MS 1
 #endif
 
-// <q> NRF_SORTLIST_ENABLED  - nrf_sortlist - Sorted list
- 
+// <o> NRF_LOG_BACKEND_RTT_TX_RETRY_CNT - Writing to RTT retries. 
+// <i> If RTT fails to accept any new data after retries
+// <i> module assumes that host is not active and on next
+// <i> request it will perform only one write attempt.
+// <i> On successful writing, module assumes that host is active
+// <i> and scheme with retry is applied again.
 
-#ifndef NRF_SORTLIST_ENABLED
-#define NRF_SORTLIST_ENABLED 1
+#ifndef NRF_LOG_BACKEND_RTT_TX_RETRY_CNT
+#define NRF_LOG_BACKEND_RTT_TX_RETRY_CNT 3
 #endif
 
-// <q> NRF_SPI_MNGR_ENABLED  - nrf_spi_mngr - SPI transaction manager
- 
+// </e>
 
-#ifndef NRF_SPI_MNGR_ENABLED
-#define NRF_SPI_MNGR_ENABLED 0
+// <e> NRF_LOG_BACKEND_UART_ENABLED - nrf_log_backend_uart - Log UART backend
+//==========================================================
+#ifndef NRF_LOG_BACKEND_UART_ENABLED
+#define NRF_LOG_BACKEND_UART_ENABLED 1
 #endif
-
-// <q> NRF_STRERROR_ENABLED  - nrf_strerror - Library for converting error code to string.
- 
-
-#ifndef NRF_STRERROR_ENABLED
-#define NRF_STRERROR_ENABLED 1
+// <o> NRF_LOG_BACKEND_UART_TX_PIN - UART TX pin 
+#ifndef NRF_LOG_BACKEND_UART_TX_PIN
+#define NRF_LOG_BACKEND_UART_TX_PIN 6
 #endif
 
-// <q> NRF_TWI_MNGR_ENABLED  - nrf_twi_mngr - TWI transaction manager
+// <o> NRF_LOG_BACKEND_UART_BAUDRATE  - Default Baudrate
  
+// <323584=> 1200 baud 
+// <643072=> 2400 baud 
+// <1290240=> 4800 baud 
+// <2576384=> 9600 baud 
+// <3862528=> 14400 baud 
+// <5152768=> 19200 baud 
+// <7716864=> 28800 baud 
+// <10289152=> 38400 baud 
+// <15400960=> 57600 baud 
+// <20615168=> 76800 baud 
+// <30801920=> 115200 baud 
+// <61865984=> 230400 baud 
+// <67108864=> 250000 baud 
+// <121634816=> 460800 baud 
+// <251658240=> 921600 baud 
+// <268435456=> 1000000 baud 
 
-#ifndef NRF_TWI_MNGR_ENABLED
-#define NRF_TWI_MNGR_ENABLED 0
+#ifndef NRF_LOG_BACKEND_UART_BAUDRATE
+#define NRF_LOG_BACKEND_UART_BAUDRATE 30801920
 #endif
 
-// <q> SLIP_ENABLED  - slip - SLIP encoding and decoding
- 
+// <o> NRF_LOG_BACKEND_UART_TEMP_BUFFER_SIZE - Size of buffer for partially processed strings. 
+// <i> Size of the buffer is a trade-off between RAM usage and processing.
+// <i> if buffer is smaller then strings will often be fragmented.
+// <i> It is recommended to use size which will fit typical log and only the
+// <i> longer one will be fragmented.
 
-#ifndef SLIP_ENABLED
-#define SLIP_ENABLED 0
+#ifndef NRF_LOG_BACKEND_UART_TEMP_BUFFER_SIZE
+#define NRF_LOG_BACKEND_UART_TEMP_BUFFER_SIZE 64
 #endif
 
-// <e> TASK_MANAGER_ENABLED - task_manager - Task manager.
+// </e>
+
+// <e> NRF_LOG_BACKEND_UARTE_ENABLED - nrf_log_backend_uarte - Log UARTE backend with EasyDMA buffers
 //==========================================================
-#ifndef TASK_MANAGER_ENABLED
-#define TASK_MANAGER_ENABLED 0
+#ifndef NRF_LOG_BACKEND_UARTE_ENABLED
+#define NRF_LOG_BACKEND_UARTE_ENABLED 0
 #endif
-// <q> TASK_MANAGER_CLI_CMDS  - Enable CLI commands specific to the module
- 
+// <o> NRF_LOG_BACKEND_UARTE_INSTANCE - UARTE instance 
+// <i> The instance must be enabled in nrfx_uarte and not used by the UART backend.
 
-#ifndef TASK_MANAGER_CLI_CMDS
-#define TASK_MANAGER_CLI_CMDS 0
+#ifndef NRF_LOG_BACKEND_UARTE_INSTANCE
+#define NRF_LOG_BACKEND_UARTE_INSTANCE 0
 #endif
 
-// <o> TASK_MANAGER_CONFIG_MAX_TASKS - Maximum number of tasks which can be created 
-#ifndef TASK_MANAGER_CONFIG_MAX_TASKS
-#define TASK_MANAGER_CONFIG_MAX_TASKS 2
+// <o> NRF_LOG_BACKEND_UARTE_TX_PIN - UARTE TX pin 
+#ifndef NRF_LOG_BACKEND_UARTE_TX_PIN
+#define NRF_LOG_BACKEND_UARTE_TX_PIN 6
 #endif
 
-// <o> TASK_MANAGER_CONFIG_STACK_SIZE - Stack size for every task (power of 2) 
-#ifndef TASK_MANAGER_CONFIG_STACK_SIZE
-#define TASK_MANAGER_CONFIG_STACK_SIZE 1024
+// <o> NRF_LOG_BACKEND_UARTE_BAUDRATE  - Default Baudrate
+ 
+// <323584=> 1200 baud 
+// <643072=> 2400 baud 
+// <1290240=> 4800 baud 
+// <2576384=> 9600 baud 
+// <3862528=> 14400 baud 
+// <5152768=> 19200 baud 
+// <7716864=> 28800 baud 
+// <10289152=> 38400 baud 
+// <15400960=> 57600 baud 
+// <20615168=> 76800 baud 
+// <30801920=> 115200 baud 
+// <61865984=> 230400 baud 
+// <67108864=> 250000 baud 
+// <121634816=> 460800 baud 
+// <251658240=> 921600 baud 
+// <268435456=> 1000000 baud 
+
+#ifndef NRF_LOG_BACKEND_UARTE_BAUDRATE
+#define NRF_LOG_BACKEND_UARTE_BAUDRATE 30801920
 #endif
 
-// <q> TASK_MANAGER_CONFIG_STACK_PROFILER_ENABLED  - Enable stack profiling.
- 
+// <o> NRF_LOG_BACKEND_UARTE_BUFFER_SIZE - Size of one transfer buffer. 
+// <i> Must not exceed the EasyDMA transfer limit of the instance (255 bytes on nRF52832).
 
-#ifndef TASK_MANAGER_CONFIG_STACK_PROFILER_ENABLED
-#define TASK_MANAGER_CONFIG_STACK_PROFILER_ENABLED 1
+#ifndef NRF_LOG_BACKEND_UARTE_BUFFER_SIZE
+#define NRF_LOG_BACKEND_UARTE_BUFFER_SIZE 128
 #endif
 
-// <o> TASK_MANAGER_CONFIG_STACK_GUARD  - Configures stack guard.
- 
-// <0=> Disabled 
-// <4=> 32 bytes 
-// <5=> 64 bytes 
-// <6=> 128 bytes 
-// <7=> 256 bytes 
-// <8=> 512 bytes 
+// <o> NRF_LOG_BACKEND_UARTE_BUFFER_COUNT - Number of transfer buffers. <2-255> 
+// <i> Logging waits for a free buffer only if all of them are queued.
 
-#ifndef TASK_MANAGER_CONFIG_STACK_GUARD
-#define TASK_MANAGER_CONFIG_STACK_GUARD 7
+#ifndef NRF_LOG_BACKEND_UARTE_BUFFER_COUNT
+#define NRF_LOG_BACKEND_UARTE_BUFFER_COUNT 4
 #endif
 
 // </e>
 
-// <h> app_button - buttons handling module
-
+// <e> NRF_LOG_BIN_ENABLED - nrf_log_bin - Binary trace log
 //==========================================================
-// <q> BUTTON_ENABLED  - Enables Button module
+#ifndef NRF_LOG_BIN_ENABLED
+#define NRF_LOG_BIN_ENABLED 0
+#endif
+// <o> NRF_LOG_BIN_CONFIG_BUFSIZE  - Size of the frame buffer.
  
+// <i> Must be a power of 2.
 
-#ifndef BUTTON_ENABLED
-#define BUTTON_ENABLED 1
+// <128=> 128 
+// <256=> 256 
+// <512=> 512 
+// <1024=> 1024 
+// <2048=> 2048 
+// <4096=> 4096 
+
+#ifndef NRF_LOG_BIN_CONFIG_BUFSIZE
+#define NRF_LOG_BIN_CONFIG_BUFSIZE 1024
 #endif
 
-// <q> BUTTON_HIGH_ACCURACY_ENABLED  - Enables GPIOTE high accuracy for buttons
+// <o> NRF_LOG_BIN_CONFIG_LEVEL  - Highest severity level compiled in.
  
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-#ifndef BUTTON_HIGH_ACCURACY_ENABLED
-#define BUTTON_HIGH_ACCURACY_ENABLED 0
+#ifndef NRF_LOG_BIN_CONFIG_LEVEL
+#define NRF_LOG_BIN_CONFIG_LEVEL 3
 #endif
 
-// </h> 
-//==========================================================
+// </e>
 
-// <h> app_usbd_cdc_acm - USB CDC ACM class
+// <e> NRF_LOG_ENABLED - nrf_log - Logger
+//==========================================================
+#ifndef NRF_LOG_ENABLED
+#define NRF_LOG_ENABLED 1
+#endif
+// <h> Log message pool - Configuration of log message pool
 
 //==========================================================
-// <q> APP_USBD_CDC_ACM_ENABLED  - Enabling USBD CDC ACM Class library
- 
+// <o> NRF_LOG_MSGPOOL_ELEMENT_SIZE - Size of a single element in the pool of memory objects. 
+// <i> If a small value is set, then performance of logs processing
+// <i> is degraded because data is fragmented. Bigger value impacts
+// <i> RAM memory utilization. The size is set to fit a message with
+// <i> a timestamp and up to 2 arguments in a single memory object.
 
-#ifndef APP_USBD_CDC_ACM_ENABLED
-#define APP_USBD_CDC_ACM_ENABLED 0
+#ifndef NRF_LOG_MSGPOOL_ELEMENT_SIZE
+#define NRF_LOG_MSGPOOL_ELEMENT_SIZE 20
 #endif
 
-// <q> APP_USBD_CDC_ACM_ZLP_ON_EPSIZE_WRITE  - Send ZLP on write with same size as endpoint
- 
-
-// <i> If enabled, CDC ACM class will automatically send a zero length packet after transfer which has the same size as endpoint.
-// <i> This may limit throughput if a lot of binary data is sent, but in terminal mode operation it makes sure that the data is always displayed right after it is sent.
+// <o> NRF_LOG_MSGPOOL_ELEMENT_COUNT - Number of elements in the pool of memory objects 
+// <i> If a small value is set, then it may lead to a deadlock
+// <i> in certain cases if backend has high latency and holds
+// <i> multiple messages for long time. Bigger value impacts
+// <i> RAM memory usage.
 
-#ifndef APP_USBD_CDC_ACM_ZLP_ON_EPSIZE_WRITE
-#define APP_USBD_CDC_ACM_ZLP_ON_EPSIZE_WRITE 1
+#ifndef NRF_LOG_MSGPOOL_ELEMENT_COUNT
+#define NRF_LOG_MSGPOOL_ELEMENT_COUNT 8
 #endif
 
 // </h> 
 //==========================================================
 
-// <h> nrf_cli - Command line interface
-
-//==========================================================
-// <q> NRF_CLI_ENABLED  - Enable/disable the CLI module.
+// <q> NRF_LOG_ALLOW_OVERFLOW  - Configures behavior when circular buffer is full.
  
 
-#ifndef NRF_CLI_ENABLED
-#define NRF_CLI_ENABLED 0
-#endif
+// <i> If set then oldest logs are overwritten. Otherwise a 
+// <i> marker is injected informing about overflow.
 
-// <o> NRF_CLI_ARGC_MAX - Maximum number of parameters passed to the command handler. 
-#ifndef NRF_CLI_ARGC_MAX
-#define NRF_CLI_ARGC_MAX 12
+#ifndef NRF_LOG_ALLOW_OVERFLOW
+#define NRF_LOG_ALLOW_OVERFLOW 1
 #endif
 
-// <q> NRF_CLI_BUILD_IN_CMDS_ENABLED  - CLI built-in commands.
+// <o> NRF_LOG_BUFSIZE  - Size of the buffer for storing logs (in bytes).
  
 
-#ifndef NRF_CLI_BUILD_IN_CMDS_ENABLED
-#define NRF_CLI_BUILD_IN_CMDS_ENABLED 1
-#endif
-
-// <o> NRF_CLI_CMD_BUFF_SIZE - Maximum buffer size for a single command. 
-#ifndef NRF_CLI_CMD_BUFF_SIZE
-#define NRF_CLI_CMD_BUFF_SIZE 128
-#endif
-
-// <q> NRF_CLI_ECHO_STATUS  - CLI echo status. If set, echo is ON.
- 
+// <i> Must be power of 2 and multiple of 4.
+// <i> If NRF_LOG_DEFERRED = 0 then buffer size can be reduced to minimum.
+// <128=> 128 
+// <256=> 256 
+// <512=> 512 
+// <1024=> 1024 
+// <2048=> 2048 
+// <4096=> 4096 
+// <8192=> 8192 
+// <16384=> 16384 
 
-#ifndef NRF_CLI_ECHO_STATUS
-#define NRF_CLI_ECHO_STATUS 1
+#ifndef NRF_LOG_BUFSIZE
+#define NRF_LOG_BUFSIZE 1024
 #endif
 
-// <q> NRF_CLI_WILDCARD_ENABLED  - Enable wildcard functionality for CLI commands.
+// <q> NRF_LOG_CLI_CMDS  - Enable CLI commands for the module.
  
 
-#ifndef NRF_CLI_WILDCARD_ENABLED
-#define NRF_CLI_WILDCARD_ENABLED 0
+#ifndef NRF_LOG_CLI_CMDS
+#define NRF_LOG_CLI_CMDS 0
 #endif
 
-// <q> NRF_CLI_METAKEYS_ENABLED  - Enable additional control keys for CLI commands like ctrl+a, ctrl+e, ctrl+w, ctrl+u
+// <o> NRF_LOG_DEFAULT_LEVEL  - Default Severity level
  
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-#ifndef NRF_CLI_METAKEYS_ENABLED
-#define NRF_CLI_METAKEYS_ENABLED 0
+#ifndef NRF_LOG_DEFAULT_LEVEL
+#define NRF_LOG_DEFAULT_LEVEL 4
 #endif
 
-// <o> NRF_CLI_PRINTF_BUFF_SIZE - Maximum print buffer size. 
-#ifndef NRF_CLI_PRINTF_BUFF_SIZE
-#define NRF_CLI_PRINTF_BUFF_SIZE 23
-#endif
+// <q> NRF_LOG_DEFERRED  - Enable deffered logger.
+ 
 
-// <e> NRF_CLI_HISTORY_ENABLED - Enable CLI history mode.
-//==========================================================
-#ifndef NRF_CLI_HISTORY_ENABLED
-#define NRF_CLI_HISTORY_ENABLED 1
-#endif
-// <o> NRF_CLI_HISTORY_ELEMENT_SIZE - Size of one memory object reserved for CLI history. 
-#ifndef NRF_CLI_HISTORY_ELEMENT_SIZE
-#define NRF_CLI_HISTORY_ELEMENT_SIZE 32
-#endif
+// <i> Log data is buffered and can be processed in idle.
 
-// <o> NRF_CLI_HISTORY_ELEMENT_COUNT - Number of history memory objects. 
-#ifndef NRF_CLI_HISTORY_ELEMENT_COUNT
-#define NRF_CLI_HISTORY_ELEMENT_COUNT 8
+#ifndef NRF_LOG_DEFERRED
+#define NRF_LOG_DEFERRED 1
 #endif
 
-// </e>
-
-// <q> NRF_CLI_VT100_COLORS_ENABLED  - CLI VT100 colors.
+// <q> NRF_LOG_FILTERS_ENABLED  - Enable dynamic filtering of logs.
  
 
-#ifndef NRF_CLI_VT100_COLORS_ENABLED
-#define NRF_CLI_VT100_COLORS_ENABLED 1
+#ifndef NRF_LOG_FILTERS_ENABLED
+#define NRF_LOG_FILTERS_ENABLED 0
 #endif
 
-// <q> NRF_CLI_STATISTICS_ENABLED  - Enable CLI statistics.
+// <q> NRF_LOG_NON_DEFFERED_CRITICAL_REGION_ENABLED  - Enable use of critical region for non deffered mode when flushing logs.
  
 
-#ifndef NRF_CLI_STATISTICS_ENABLED
-#define NRF_CLI_STATISTICS_ENABLED 1
+// <i> When enabled NRF_LOG_FLUSH is called from critical section when non deffered mode is used.
+// <i> Log output will never be corrupted as access to the log backend is exclusive
+// <i> but system will spend significant amount of time in critical section
+
+#ifndef NRF_LOG_NON_DEFFERED_CRITICAL_REGION_ENABLED
+#define NRF_LOG_NON_DEFFERED_CRITICAL_REGION_ENABLED 0
 #endif
 
-// <q> NRF_CLI_LOG_BACKEND  - Enable logger backend interface.
+// <o> NRF_LOG_STR_PUSH_BUFFER_SIZE  - Size of the buffer dedicated for strings stored using @ref NRF_LOG_PUSH.
  
+// <16=> 16 
+// <32=> 32 
+// <64=> 64 
+// <128=> 128 
+// <256=> 256 
+// <512=> 512 
+// <1024=> 1024 
 
-#ifndef NRF_CLI_LOG_BACKEND
-#define NRF_CLI_LOG_BACKEND 1
+#ifndef NRF_LOG_STR_PUSH_BUFFER_SIZE
+#define NRF_LOG_STR_PUSH_BUFFER_SIZE 128
 #endif
 
-// <q> NRF_CLI_USES_TASK_MANAGER_ENABLED  - Enable CLI to use task_manager
+// <o> NRF_LOG_STR_PUSH_BUFFER_SIZE  - Size of the buffer dedicated for strings stored using @ref NRF_LOG_PUSH.
  
+// <16=> 16 
+// <32=> 32 
+// <64=> 64 
+// <128=> 128 
+// <256=> 256 
+// <512=> 512 
+// <1024=> 1024 
 
-#ifndef NRF_CLI_USES_TASK_MANAGER_ENABLED
-#define NRF_CLI_USES_TASK_MANAGER_ENABLED 0
+#ifndef NRF_LOG_STR_PUSH_BUFFER_SIZE
+#define NRF_LOG_STR_PUSH_BUFFER_SIZE 128
 #endif
 
-// </h> 
-//==========================================================
-
-// <h> nrf_fprintf - fprintf function.
-
+// <e> NRF_LOG_USES_COLORS - If enabled then ANSI escape code for colors is prefixed to every string
 //==========================================================
-// <q> NRF_FPRINTF_ENABLED  - Enable/disable fprintf module.
+#ifndef NRF_LOG_USES_COLORS
+#define NRF_LOG_USES_COLORS 0
+#endif
+// <o> NRF_LOG_COLOR_DEFAULT  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_FPRINTF_ENABLED
-#define NRF_FPRINTF_ENABLED 1
+#ifndef NRF_LOG_COLOR_DEFAULT
+#define NRF_LOG_COLOR_DEFAULT 0
 #endif
 
-// <q> NRF_FPRINTF_FLAG_AUTOMATIC_CR_ON_LF_ENABLED  - For each printed LF, function will add CR.
+// <o> NRF_LOG_ERROR_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_FPRINTF_FLAG_AUTOMATIC_CR_ON_LF_ENABLED
-#define NRF_FPRINTF_FLAG_AUTOMATIC_CR_ON_LF_ENABLED 1
+#ifndef NRF_LOG_ERROR_COLOR
+#define NRF_LOG_ERROR_COLOR 2
 #endif
 
-// <q> NRF_FPRINTF_DOUBLE_ENABLED  - Enable IEEE-754 double precision formatting.
+// <o> NRF_LOG_WARNING_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_FPRINTF_DOUBLE_ENABLED
-#define NRF_FPRINTF_DOUBLE_ENABLED 0
+#ifndef NRF_LOG_WARNING_COLOR
+#define NRF_LOG_WARNING_COLOR 4
 #endif
 
-// </h> 
-//==========================================================
-
-// </h> 
-//==========================================================
+// </e>
 
-// <h> nRF_Log 
+// <e> NRF_LOG_USES_TIMESTAMP - Enable timestamping
 
+// <i> Function for getting the timestamp is provided by the user
 //==========================================================
-// <e> NRF_LOG_BACKEND_RTT_ENABLED - nrf_log_backend_rtt - Log RTT backend
-//==========================================================
-#ifndef NRF_LOG_BACKEND_RTT_ENABLED
-#define NRF_LOG_BACKEND_RTT_ENABLED 1
-#endif
-// <o> NRF_LOG_BACKEND_RTT_TEMP_BUFFER_SIZE - Size of buffer for partially processed strings. 
-// <i> Size of the buffer is a trade-off between RAM usage and processing.
-// <i> if buffer is smaller then strings will often be fragmented.
-// <i> It is recommended to use size which will fit typical log and only the
-// <i> longer one will be fragmented.
-
-#ifndef NRF_LOG_BACKEND_RTT_TEMP_BUFFER_SIZE
-#define NRF_LOG_BACKEND_RTT_TEMP_BUFFER_SIZE 64
+#ifndef NRF_LOG_USES_TIMESTAMP
+#define NRF_LOG_USES_TIMESTAMP 0
 #endif
-
-// <o> NRF_LOG_BACKEND_RTT_TX_RETRY_DELAY_MS - Period before retrying writing to RTT 
-#ifndef NRF_LOG_BACKEND_RTT_TX_RETRY_DELAY_MS
-#define NRF_LOG_BACKEND_RTT_TX_RETRY_DELAY_MS 1
+// <o> NRF_LOG_TIMESTAMP_DEFAULT_FREQUENCY - Default frequency of the timestamp (in Hz) or 0 to use app_timer frequency. 
+#ifndef NRF_LOG_TIMESTAMP_DEFAULT_FREQUENCY
+#define NRF_LOG_TIMESTAMP_DEFAULT_FREQUENCY 0
 #endif
 
-// <o> NRF_LOG_BACKEND_RTT_TX_RETRY_CNT - Writing to RTT retries. 
-// <i> If RTT fails to accept any new data after retries
-// <i> module assumes that host is not active and on next
-// <i> request it will perform only one write attempt.
-// <i> On successful writing, module assumes that host is active
-// <i> and scheme with retry is applied again.
+// </e>
 
-#ifndef NRF_LOG_BACKEND_RTT_TX_RETRY_CNT
-#define NRF_LOG_BACKEND_RTT_TX_RETRY_CNT 3
-#endif
+// <h> nrf_log module configuration 
 
-// </e>
+//==========================================================
+// <h> nrf_log in nRF_Core 
 
-// <e> NRF_LOG_BACKEND_UART_ENABLED - nrf_log_backend_uart - Log UART backend
 //==========================================================
-#ifndef NRF_LOG_BACKEND_UART_ENABLED
-#define NRF_LOG_BACKEND_UART_ENABLED 1
+// <e> NRF_MPU_LIB_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRF_MPU_LIB_CONFIG_LOG_ENABLED
+#define NRF_MPU_LIB_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRF_LOG_BACKEND_UART_TX_PIN - UART TX pin 
-#ifndef NRF_LOG_BACKEND_UART_TX_PIN
-#define NRF_LOG_BACKEND_UART_TX_PIN 6
+// <o> NRF_MPU_LIB_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRF_MPU_LIB_CONFIG_LOG_LEVEL
+#define NRF_MPU_LIB_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRF_LOG_BACKEND_UART_BAUDRATE  - Default Baudrate
+// <o> NRF_MPU_LIB_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
-// <323584=> 1200 baud 
-// <643072=> 2400 baud 
-// <1290240=> 4800 baud 
-// <2576384=> 9600 baud 
-// <3862528=> 14400 baud 
-// <5152768=> 19200 baud 
-// <7716864=> 28800 baud 
-// <10289152=> 38400 baud 
-// <15400960=> 57600 baud 
-// <20615168=> 76800 baud 
-// <30801920=> 115200 baud 
-// <61865984=> 230400 baud 
-// <67108864=> 250000 baud 
-// <121634816=> 460800 baud 
-// <251658240=> 921600 baud 
-// <268435456=> 1000000 baud 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_LOG_BACKEND_UART_BAUDRATE
-#define NRF_LOG_BACKEND_UART_BAUDRATE 30801920
+#ifndef NRF_MPU_LIB_CONFIG_INFO_COLOR
+#define NRF_MPU_LIB_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRF_LOG_BACKEND_UART_TEMP_BUFFER_SIZE - Size of buffer for partially processed strings. 
-// <i> Size of the buffer is a trade-off between RAM usage and processing.
-// <i> if buffer is smaller then strings will often be fragmented.
-// <i> It is recommended to use size which will fit typical log and only the
-// <i> longer one will be fragmented.
+// <o> NRF_MPU_LIB_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_LOG_BACKEND_UART_TEMP_BUFFER_SIZE
-#define NRF_LOG_BACKEND_UART_TEMP_BUFFER_SIZE 64
+#ifndef NRF_MPU_LIB_CONFIG_DEBUG_COLOR
+#define NRF_MPU_LIB_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> NRF_LOG_ENABLED - nrf_log - Logger
+// <e> NRF_STACK_GUARD_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRF_LOG_ENABLED
-#define NRF_LOG_ENABLED 1
+#ifndef NRF_STACK_GUARD_CONFIG_LOG_ENABLED
+#define NRF_STACK_GUARD_CONFIG_LOG_ENABLED 0
 #endif
-// <h> Log message pool - Configuration of log message pool
+// <o> NRF_STACK_GUARD_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-//==========================================================
-// <o> NRF_LOG_MSGPOOL_ELEMENT_SIZE - Size of a single element in the pool of memory objects. 
-// <i> If a small value is set, then performance of logs processing
-// <i> is degraded because data is fragmented. Bigger value impacts
-// <i> RAM memory utilization. The size is set to fit a message with
-// <i> a timestamp and up to 2 arguments in a single memory object.
+#ifndef NRF_STACK_GUARD_CONFIG_LOG_LEVEL
+#define NRF_STACK_GUARD_CONFIG_LOG_LEVEL 3
+#endif
 
-#ifndef NRF_LOG_MSGPOOL_ELEMENT_SIZE
-#define NRF_LOG_MSGPOOL_ELEMENT_SIZE 20
+// <o> NRF_STACK_GUARD_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRF_STACK_GUARD_CONFIG_INFO_COLOR
+#define NRF_STACK_GUARD_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRF_LOG_MSGPOOL_ELEMENT_COUNT - Number of elements in the pool of memory objects 
-// <i> If a small value is set, then it may lead to a deadlock
-// <i> in certain cases if backend has high latency and holds
-// <i> multiple messages for long time. Bigger value impacts
-// <i> RAM memory usage.
+// <o> NRF_STACK_GUARD_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_LOG_MSGPOOL_ELEMENT_COUNT
-#define NRF_LOG_MSGPOOL_ELEMENT_COUNT 8
+#ifndef NRF_STACK_GUARD_CONFIG_DEBUG_COLOR
+#define NRF_STACK_GUARD_CONFIG_DEBUG_COLOR 0
 #endif
 
-// </h> 
-//==========================================================
+// </e>
 
-// <q> NRF_LOG_ALLOW_OVERFLOW  - Configures behavior when circular buffer is full.
+// <e> TASK_MANAGER_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef TASK_MANAGER_CONFIG_LOG_ENABLED
+#define TASK_MANAGER_CONFIG_LOG_ENABLED 0
+#endif
+// <o> TASK_MANAGER_CONFIG_LOG_LEVEL  - Default Severity level
  
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-// <i> If set then oldest logs are overwritten. Otherwise a 
-// <i> marker is injected informing about overflow.
-
-#ifndef NRF_LOG_ALLOW_OVERFLOW
-#define NRF_LOG_ALLOW_OVERFLOW 1
+#ifndef TASK_MANAGER_CONFIG_LOG_LEVEL
+#define TASK_MANAGER_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRF_LOG_BUFSIZE  - Size of the buffer for storing logs (in bytes).
+// <o> TASK_MANAGER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-// <i> Must be power of 2 and multiple of 4.
-// <i> If NRF_LOG_DEFERRED = 0 then buffer size can be reduced to minimum.
-// <128=> 128 
-// <256=> 256 
-// <512=> 512 
-// <1024=> 1024 
-// <2048=> 2048 
-// <4096=> 4096 
-// <8192=> 8192 
-// <16384=> 16384 
-
-#ifndef NRF_LOG_BUFSIZE
-#define NRF_LOG_BUFSIZE 1024
+#ifndef TASK_MANAGER_CONFIG_INFO_COLOR
+#define TASK_MANAGER_CONFIG_INFO_COLOR 0
 #endif
 
-// <q> NRF_LOG_CLI_CMDS  - Enable CLI commands for the module.
+// <o> TASK_MANAGER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_LOG_CLI_CMDS
-#define NRF_LOG_CLI_CMDS 0
+#ifndef TASK_MANAGER_CONFIG_DEBUG_COLOR
+#define TASK_MANAGER_CONFIG_DEBUG_COLOR 0
 #endif
 
-// <o> NRF_LOG_DEFAULT_LEVEL  - Default Severity level
+// </e>
+
+// </h> 
+//==========================================================
+
+// <h> nrf_log in nRF_Drivers 
+
+//==========================================================
+// <e> CLOCK_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef CLOCK_CONFIG_LOG_ENABLED
+#define CLOCK_CONFIG_LOG_ENABLED 0
+#endif
+// <o> CLOCK_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -7900,71 +10690,78 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRF_LOG_DEFAULT_LEVEL
-#define NRF_LOG_DEFAULT_LEVEL 4
+#ifndef CLOCK_CONFIG_LOG_LEVEL
+#define CLOCK_CONFIG_LOG_LEVEL 3
 #endif
 
-// <q> NRF_LOG_DEFERRED  - Enable deffered logger.
+// <o> CLOCK_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-// <i> Log data is buffered and can be processed in idle.
-
-#ifndef NRF_LOG_DEFERRED
-#define NRF_LOG_DEFERRED 1
+#ifndef CLOCK_CONFIG_INFO_COLOR
+#define CLOCK_CONFIG_INFO_COLOR 0
 #endif
 
-// <q> NRF_LOG_FILTERS_ENABLED  - Enable dynamic filtering of logs.
+// <o> CLOCK_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_LOG_FILTERS_ENABLED
-#define NRF_LOG_FILTERS_ENABLED 0
+#ifndef CLOCK_CONFIG_DEBUG_COLOR
+#define CLOCK_CONFIG_DEBUG_COLOR 0
 #endif
 
-// <q> NRF_LOG_NON_DEFFERED_CRITICAL_REGION_ENABLED  - Enable use of critical region for non deffered mode when flushing logs.
- 
-
-// <i> When enabled NRF_LOG_FLUSH is called from critical section when non deffered mode is used.
-// <i> Log output will never be corrupted as access to the log backend is exclusive
-// <i> but system will spend significant amount of time in critical section
+// </e>
 
-#ifndef NRF_LOG_NON_DEFFERED_CRITICAL_REGION_ENABLED
-#define NRF_LOG_NON_DEFFERED_CRITICAL_REGION_ENABLED 0
+// <e> COMP_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef COMP_CONFIG_LOG_ENABLED
+#define COMP_CONFIG_LOG_ENABLED 0
 #endif
-
-// <o> NRF_LOG_STR_PUSH_BUFFER_SIZE  - Size of the buffer dedicated for strings stored using @ref NRF_LOG_PUSH.
+// <o> COMP_CONFIG_LOG_LEVEL  - Default Severity level
  
-// <16=> 16 
-// <32=> 32 
-// <64=> 64 
-// <128=> 128 
-// <256=> 256 
-// <512=> 512 
-// <1024=> 1024 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
 
-#ifndef NRF_LOG_STR_PUSH_BUFFER_SIZE
-#define NRF_LOG_STR_PUSH_BUFFER_SIZE 128
+#ifndef COMP_CONFIG_LOG_LEVEL
+#define COMP_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRF_LOG_STR_PUSH_BUFFER_SIZE  - Size of the buffer dedicated for strings stored using @ref NRF_LOG_PUSH.
+// <o> COMP_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
-// <16=> 16 
-// <32=> 32 
-// <64=> 64 
-// <128=> 128 
-// <256=> 256 
-// <512=> 512 
-// <1024=> 1024 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
 
-#ifndef NRF_LOG_STR_PUSH_BUFFER_SIZE
-#define NRF_LOG_STR_PUSH_BUFFER_SIZE 128
+#ifndef COMP_CONFIG_INFO_COLOR
+#define COMP_CONFIG_INFO_COLOR 0
 #endif
 
-// <e> NRF_LOG_USES_COLORS - If enabled then ANSI escape code for colors is prefixed to every string
-//==========================================================
-#ifndef NRF_LOG_USES_COLORS
-#define NRF_LOG_USES_COLORS 0
-#endif
-// <o> NRF_LOG_COLOR_DEFAULT  - ANSI escape code prefix.
+// <o> COMP_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -7976,11 +10773,30 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRF_LOG_COLOR_DEFAULT
-#define NRF_LOG_COLOR_DEFAULT 0
+#ifndef COMP_CONFIG_DEBUG_COLOR
+#define COMP_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// <e> GPIOTE_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef GPIOTE_CONFIG_LOG_ENABLED
+#define GPIOTE_CONFIG_LOG_ENABLED 0
+#endif
+// <o> GPIOTE_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef GPIOTE_CONFIG_LOG_LEVEL
+#define GPIOTE_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRF_LOG_ERROR_COLOR  - ANSI escape code prefix.
+// <o> GPIOTE_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -7992,11 +10808,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRF_LOG_ERROR_COLOR
-#define NRF_LOG_ERROR_COLOR 2
+#ifndef GPIOTE_CONFIG_INFO_COLOR
+#define GPIOTE_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRF_LOG_WARNING_COLOR  - ANSI escape code prefix.
+// <o> GPIOTE_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8008,38 +10824,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRF_LOG_WARNING_COLOR
-#define NRF_LOG_WARNING_COLOR 4
-#endif
-
-// </e>
-
-// <e> NRF_LOG_USES_TIMESTAMP - Enable timestamping
-
-// <i> Function for getting the timestamp is provided by the user
-//==========================================================
-#ifndef NRF_LOG_USES_TIMESTAMP
-#define NRF_LOG_USES_TIMESTAMP 0
-#endif
-// <o> NRF_LOG_TIMESTAMP_DEFAULT_FREQUENCY - Default frequency of the timestamp (in Hz) or 0 to use app_timer frequency. 
-#ifndef NRF_LOG_TIMESTAMP_DEFAULT_FREQUENCY
-#define NRF_LOG_TIMESTAMP_DEFAULT_FREQUENCY 0
+#ifndef GPIOTE_CONFIG_DEBUG_COLOR
+#define GPIOTE_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <h> nrf_log module configuration 
-
-//==========================================================
-// <h> nrf_log in nRF_Core 
-
-//==========================================================
-// <e> NRF_MPU_LIB_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> LPCOMP_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRF_MPU_LIB_CONFIG_LOG_ENABLED
-#define NRF_MPU_LIB_CONFIG_LOG_ENABLED 0
+#ifndef LPCOMP_CONFIG_LOG_ENABLED
+#define LPCOMP_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRF_MPU_LIB_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> LPCOMP_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8047,11 +10843,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRF_MPU_LIB_CONFIG_LOG_LEVEL
-#define NRF_MPU_LIB_CONFIG_LOG_LEVEL 3
+#ifndef LPCOMP_CONFIG_LOG_LEVEL
+#define LPCOMP_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRF_MPU_LIB_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> LPCOMP_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8063,11 +10859,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRF_MPU_LIB_CONFIG_INFO_COLOR
-#define NRF_MPU_LIB_CONFIG_INFO_COLOR 0
+#ifndef LPCOMP_CONFIG_INFO_COLOR
+#define LPCOMP_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRF_MPU_LIB_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> LPCOMP_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8079,18 +10875,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRF_MPU_LIB_CONFIG_DEBUG_COLOR
-#define NRF_MPU_LIB_CONFIG_DEBUG_COLOR 0
+#ifndef LPCOMP_CONFIG_DEBUG_COLOR
+#define LPCOMP_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> NRF_STACK_GUARD_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> MAX3421E_HOST_CONFIG_LOG_ENABLED - Enable logging in the module
 //==========================================================
-#ifndef NRF_STACK_GUARD_CONFIG_LOG_ENABLED
-#define NRF_STACK_GUARD_CONFIG_LOG_ENABLED 0
+#ifndef MAX3421E_HOST_CONFIG_LOG_ENABLED
+#define MAX3421E_HOST_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRF_STACK_GUARD_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> MAX3421E_HOST_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8098,11 +10894,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRF_STACK_GUARD_CONFIG_LOG_LEVEL
-#define NRF_STACK_GUARD_CONFIG_LOG_LEVEL 3
+#ifndef MAX3421E_HOST_CONFIG_LOG_LEVEL
+#define MAX3421E_HOST_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRF_STACK_GUARD_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> MAX3421E_HOST_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8114,11 +10910,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRF_STACK_GUARD_CONFIG_INFO_COLOR
-#define NRF_STACK_GUARD_CONFIG_INFO_COLOR 0
+#ifndef MAX3421E_HOST_CONFIG_INFO_COLOR
+#define MAX3421E_HOST_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRF_STACK_GUARD_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> MAX3421E_HOST_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8130,18 +10926,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRF_STACK_GUARD_CONFIG_DEBUG_COLOR
-#define NRF_STACK_GUARD_CONFIG_DEBUG_COLOR 0
+#ifndef MAX3421E_HOST_CONFIG_DEBUG_COLOR
+#define MAX3421E_HOST_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> TASK_MANAGER_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> NRFX_USBD_CONFIG_LOG_ENABLED - Enable logging in the module
 //==========================================================
-#ifndef TASK_MANAGER_CONFIG_LOG_ENABLED
-#define TASK_MANAGER_CONFIG_LOG_ENABLED 0
+#ifndef NRFX_USBD_CONFIG_LOG_ENABLED
+#define NRFX_USBD_CONFIG_LOG_ENABLED 0
 #endif
-// <o> TASK_MANAGER_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> NRFX_USBD_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8149,11 +10945,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef TASK_MANAGER_CONFIG_LOG_LEVEL
-#define TASK_MANAGER_CONFIG_LOG_LEVEL 3
+#ifndef NRFX_USBD_CONFIG_LOG_LEVEL
+#define NRFX_USBD_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> TASK_MANAGER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> NRFX_USBD_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8165,11 +10961,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef TASK_MANAGER_CONFIG_INFO_COLOR
-#define TASK_MANAGER_CONFIG_INFO_COLOR 0
+#ifndef NRFX_USBD_CONFIG_INFO_COLOR
+#define NRFX_USBD_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> TASK_MANAGER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> NRFX_USBD_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8181,24 +10977,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef TASK_MANAGER_CONFIG_DEBUG_COLOR
-#define TASK_MANAGER_CONFIG_DEBUG_COLOR 0
+#ifndef NRFX_USBD_CONFIG_DEBUG_COLOR
+#define NRFX_USBD_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// </h> 
-//==========================================================
-
-// <h> nrf_log in nRF_Drivers 
-
-//==========================================================
-// <e> CLOCK_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> PDM_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef CLOCK_CONFIG_LOG_ENABLED
-#define CLOCK_CONFIG_LOG_ENABLED 0
+#ifndef PDM_CONFIG_LOG_ENABLED
+#define PDM_CONFIG_LOG_ENABLED 0
 #endif
-// <o> CLOCK_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> PDM_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8206,11 +10996,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef CLOCK_CONFIG_LOG_LEVEL
-#define CLOCK_CONFIG_LOG_LEVEL 3
+#ifndef PDM_CONFIG_LOG_LEVEL
+#define PDM_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> CLOCK_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> PDM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8222,11 +11012,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef CLOCK_CONFIG_INFO_COLOR
-#define CLOCK_CONFIG_INFO_COLOR 0
+#ifndef PDM_CONFIG_INFO_COLOR
+#define PDM_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> CLOCK_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> PDM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8238,18 +11028,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef CLOCK_CONFIG_DEBUG_COLOR
-#define CLOCK_CONFIG_DEBUG_COLOR 0
+#ifndef PDM_CONFIG_DEBUG_COLOR
+#define PDM_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> COMP_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> PPI_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef COMP_CONFIG_LOG_ENABLED
-#define COMP_CONFIG_LOG_ENABLED 0
+#ifndef PPI_CONFIG_LOG_ENABLED
+#define PPI_CONFIG_LOG_ENABLED 0
 #endif
-// <o> COMP_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> PPI_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8257,11 +11047,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef COMP_CONFIG_LOG_LEVEL
-#define COMP_CONFIG_LOG_LEVEL 3
+#ifndef PPI_CONFIG_LOG_LEVEL
+#define PPI_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> COMP_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> PPI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8273,11 +11063,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef COMP_CONFIG_INFO_COLOR
-#define COMP_CONFIG_INFO_COLOR 0
+#ifndef PPI_CONFIG_INFO_COLOR
+#define PPI_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> COMP_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> PPI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8289,18 +11079,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef COMP_CONFIG_DEBUG_COLOR
-#define COMP_CONFIG_DEBUG_COLOR 0
+#ifndef PPI_CONFIG_DEBUG_COLOR
+#define PPI_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> GPIOTE_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> PWM_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef GPIOTE_CONFIG_LOG_ENABLED
-#define GPIOTE_CONFIG_LOG_ENABLED 0
+#ifndef PWM_CONFIG_LOG_ENABLED
+#define PWM_CONFIG_LOG_ENABLED 0
 #endif
-// <o> GPIOTE_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> PWM_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8308,11 +11098,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef GPIOTE_CONFIG_LOG_LEVEL
-#define GPIOTE_CONFIG_LOG_LEVEL 3
+#ifndef PWM_CONFIG_LOG_LEVEL
+#define PWM_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> GPIOTE_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> PWM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8324,11 +11114,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef GPIOTE_CONFIG_INFO_COLOR
-#define GPIOTE_CONFIG_INFO_COLOR 0
+#ifndef PWM_CONFIG_INFO_COLOR
+#define PWM_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> GPIOTE_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> PWM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8340,18 +11130,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef GPIOTE_CONFIG_DEBUG_COLOR
-#define GPIOTE_CONFIG_DEBUG_COLOR 0
+#ifndef PWM_CONFIG_DEBUG_COLOR
+#define PWM_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> LPCOMP_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> QDEC_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef LPCOMP_CONFIG_LOG_ENABLED
-#define LPCOMP_CONFIG_LOG_ENABLED 0
+#ifndef QDEC_CONFIG_LOG_ENABLED
+#define QDEC_CONFIG_LOG_ENABLED 0
 #endif
-// <o> LPCOMP_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> QDEC_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8359,11 +11149,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef LPCOMP_CONFIG_LOG_LEVEL
-#define LPCOMP_CONFIG_LOG_LEVEL 3
+#ifndef QDEC_CONFIG_LOG_LEVEL
+#define QDEC_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> LPCOMP_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> QDEC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8375,11 +11165,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef LPCOMP_CONFIG_INFO_COLOR
-#define LPCOMP_CONFIG_INFO_COLOR 0
+#ifndef QDEC_CONFIG_INFO_COLOR
+#define QDEC_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> LPCOMP_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> QDEC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8391,18 +11181,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef LPCOMP_CONFIG_DEBUG_COLOR
-#define LPCOMP_CONFIG_DEBUG_COLOR 0
+#ifndef QDEC_CONFIG_DEBUG_COLOR
+#define QDEC_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> MAX3421E_HOST_CONFIG_LOG_ENABLED - Enable logging in the module
+// <e> RNG_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef MAX3421E_HOST_CONFIG_LOG_ENABLED
-#define MAX3421E_HOST_CONFIG_LOG_ENABLED 0
+#ifndef RNG_CONFIG_LOG_ENABLED
+#define RNG_CONFIG_LOG_ENABLED 0
 #endif
-// <o> MAX3421E_HOST_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> RNG_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8410,11 +11200,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef MAX3421E_HOST_CONFIG_LOG_LEVEL
-#define MAX3421E_HOST_CONFIG_LOG_LEVEL 3
+#ifndef RNG_CONFIG_LOG_LEVEL
+#define RNG_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> MAX3421E_HOST_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> RNG_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8426,11 +11216,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef MAX3421E_HOST_CONFIG_INFO_COLOR
-#define MAX3421E_HOST_CONFIG_INFO_COLOR 0
+#ifndef RNG_CONFIG_INFO_COLOR
+#define RNG_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> MAX3421E_HOST_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> RNG_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8442,18 +11232,25 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef MAX3421E_HOST_CONFIG_DEBUG_COLOR
-#define MAX3421E_HOST_CONFIG_DEBUG_COLOR 0
+#ifndef RNG_CONFIG_DEBUG_COLOR
+#define RNG_CONFIG_DEBUG_COLOR 0
+#endif
+
+// <q> RNG_CONFIG_RANDOM_NUMBER_LOG_ENABLED  - Enables logging of random numbers.
+ 
+
+#ifndef RNG_CONFIG_RANDOM_NUMBER_LOG_ENABLED
+#define RNG_CONFIG_RANDOM_NUMBER_LOG_ENABLED 0
 #endif
 
 // </e>
 
-// <e> NRFX_USBD_CONFIG_LOG_ENABLED - Enable logging in the module
+// <e> RTC_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef NRFX_USBD_CONFIG_LOG_ENABLED
-#define NRFX_USBD_CONFIG_LOG_ENABLED 0
+#ifndef RTC_CONFIG_LOG_ENABLED
+#define RTC_CONFIG_LOG_ENABLED 0
 #endif
-// <o> NRFX_USBD_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> RTC_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8461,11 +11258,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef NRFX_USBD_CONFIG_LOG_LEVEL
-#define NRFX_USBD_CONFIG_LOG_LEVEL 3
+#ifndef RTC_CONFIG_LOG_LEVEL
+#define RTC_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> NRFX_USBD_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> RTC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8477,11 +11274,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_USBD_CONFIG_INFO_COLOR
-#define NRFX_USBD_CONFIG_INFO_COLOR 0
+#ifndef RTC_CONFIG_INFO_COLOR
+#define RTC_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> NRFX_USBD_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> RTC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8493,18 +11290,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef NRFX_USBD_CONFIG_DEBUG_COLOR
-#define NRFX_USBD_CONFIG_DEBUG_COLOR 0
+#ifndef RTC_CONFIG_DEBUG_COLOR
+#define RTC_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> PDM_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> SAADC_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef PDM_CONFIG_LOG_ENABLED
-#define PDM_CONFIG_LOG_ENABLED 0
+#ifndef SAADC_CONFIG_LOG_ENABLED
+#define SAADC_CONFIG_LOG_ENABLED 0
 #endif
-// <o> PDM_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> SAADC_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8512,11 +11309,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef PDM_CONFIG_LOG_LEVEL
-#define PDM_CONFIG_LOG_LEVEL 3
+#ifndef SAADC_CONFIG_LOG_LEVEL
+#define SAADC_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> PDM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> SAADC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8528,11 +11325,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef PDM_CONFIG_INFO_COLOR
-#define PDM_CONFIG_INFO_COLOR 0
+#ifndef SAADC_CONFIG_INFO_COLOR
+#define SAADC_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> PDM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> SAADC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8544,18 +11341,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef PDM_CONFIG_DEBUG_COLOR
-#define PDM_CONFIG_DEBUG_COLOR 0
+#ifndef SAADC_CONFIG_DEBUG_COLOR
+#define SAADC_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> PPI_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> SPIS_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef PPI_CONFIG_LOG_ENABLED
-#define PPI_CONFIG_LOG_ENABLED 0
+#ifndef SPIS_CONFIG_LOG_ENABLED
+#define SPIS_CONFIG_LOG_ENABLED 0
 #endif
-// <o> PPI_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> SPIS_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8563,11 +11360,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef PPI_CONFIG_LOG_LEVEL
-#define PPI_CONFIG_LOG_LEVEL 3
+#ifndef SPIS_CONFIG_LOG_LEVEL
+#define SPIS_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> PPI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> SPIS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8579,11 +11376,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef PPI_CONFIG_INFO_COLOR
-#define PPI_CONFIG_INFO_COLOR 0
+#ifndef SPIS_CONFIG_INFO_COLOR
+#define SPIS_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> PPI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> SPIS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8595,18 +11392,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef PPI_CONFIG_DEBUG_COLOR
-#define PPI_CONFIG_DEBUG_COLOR 0
+#ifndef SPIS_CONFIG_DEBUG_COLOR
+#define SPIS_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> PWM_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> SPI_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef PWM_CONFIG_LOG_ENABLED
-#define PWM_CONFIG_LOG_ENABLED 0
+#ifndef SPI_CONFIG_LOG_ENABLED
+#define SPI_CONFIG_LOG_ENABLED 0
 #endif
-// <o> PWM_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> SPI_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8614,11 +11411,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef PWM_CONFIG_LOG_LEVEL
-#define PWM_CONFIG_LOG_LEVEL 3
+#ifndef SPI_CONFIG_LOG_LEVEL
+#define SPI_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> PWM_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> SPI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8630,11 +11427,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef PWM_CONFIG_INFO_COLOR
-#define PWM_CONFIG_INFO_COLOR 0
+#ifndef SPI_CONFIG_INFO_COLOR
+#define SPI_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> PWM_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> SPI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8646,18 +11443,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef PWM_CONFIG_DEBUG_COLOR
-#define PWM_CONFIG_DEBUG_COLOR 0
+#ifndef SPI_CONFIG_DEBUG_COLOR
+#define SPI_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> QDEC_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> TIMER_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef QDEC_CONFIG_LOG_ENABLED
-#define QDEC_CONFIG_LOG_ENABLED 0
+#ifndef TIMER_CONFIG_LOG_ENABLED
+#define TIMER_CONFIG_LOG_ENABLED 0
 #endif
-// <o> QDEC_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> TIMER_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8665,11 +11462,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef QDEC_CONFIG_LOG_LEVEL
-#define QDEC_CONFIG_LOG_LEVEL 3
+#ifndef TIMER_CONFIG_LOG_LEVEL
+#define TIMER_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> QDEC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> TIMER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8681,11 +11478,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef QDEC_CONFIG_INFO_COLOR
-#define QDEC_CONFIG_INFO_COLOR 0
+#ifndef TIMER_CONFIG_INFO_COLOR
+#define TIMER_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> QDEC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> TIMER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8697,18 +11494,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef QDEC_CONFIG_DEBUG_COLOR
-#define QDEC_CONFIG_DEBUG_COLOR 0
+#ifndef TIMER_CONFIG_DEBUG_COLOR
+#define TIMER_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> RNG_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> TWIS_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef RNG_CONFIG_LOG_ENABLED
-#define RNG_CONFIG_LOG_ENABLED 0
+#ifndef TWIS_CONFIG_LOG_ENABLED
+#define TWIS_CONFIG_LOG_ENABLED 0
 #endif
-// <o> RNG_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> TWIS_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8716,11 +11513,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef RNG_CONFIG_LOG_LEVEL
-#define RNG_CONFIG_LOG_LEVEL 3
+#ifndef TWIS_CONFIG_LOG_LEVEL
+#define TWIS_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> RNG_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> TWIS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8732,11 +11529,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef RNG_CONFIG_INFO_COLOR
-#define RNG_CONFIG_INFO_COLOR 0
+#ifndef TWIS_CONFIG_INFO_COLOR
+#define TWIS_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> RNG_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> TWIS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8748,25 +11545,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef RNG_CONFIG_DEBUG_COLOR
-#define RNG_CONFIG_DEBUG_COLOR 0
-#endif
-
-// <q> RNG_CONFIG_RANDOM_NUMBER_LOG_ENABLED  - Enables logging of random numbers.
- 
-
-#ifndef RNG_CONFIG_RANDOM_NUMBER_LOG_ENABLED
-#define RNG_CONFIG_RANDOM_NUMBER_LOG_ENABLED 0
+#ifndef TWIS_CONFIG_DEBUG_COLOR
+#define TWIS_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> RTC_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> TWI_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef RTC_CONFIG_LOG_ENABLED
-#define RTC_CONFIG_LOG_ENABLED 0
+#ifndef TWI_CONFIG_LOG_ENABLED
+#define TWI_CONFIG_LOG_ENABLED 0
 #endif
-// <o> RTC_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> TWI_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8774,11 +11564,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef RTC_CONFIG_LOG_LEVEL
-#define RTC_CONFIG_LOG_LEVEL 3
+#ifndef TWI_CONFIG_LOG_LEVEL
+#define TWI_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> RTC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> TWI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8790,11 +11580,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef RTC_CONFIG_INFO_COLOR
-#define RTC_CONFIG_INFO_COLOR 0
+#ifndef TWI_CONFIG_INFO_COLOR
+#define TWI_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> RTC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> TWI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8806,18 +11596,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef RTC_CONFIG_DEBUG_COLOR
-#define RTC_CONFIG_DEBUG_COLOR 0
+#ifndef TWI_CONFIG_DEBUG_COLOR
+#define TWI_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> SAADC_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> UART_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef SAADC_CONFIG_LOG_ENABLED
-#define SAADC_CONFIG_LOG_ENABLED 0
+#ifndef UART_CONFIG_LOG_ENABLED
+#define UART_CONFIG_LOG_ENABLED 0
 #endif
-// <o> SAADC_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> UART_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8825,11 +11615,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef SAADC_CONFIG_LOG_LEVEL
-#define SAADC_CONFIG_LOG_LEVEL 3
+#ifndef UART_CONFIG_LOG_LEVEL
+#define UART_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> SAADC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> UART_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8841,11 +11631,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef SAADC_CONFIG_INFO_COLOR
-#define SAADC_CONFIG_INFO_COLOR 0
+#ifndef UART_CONFIG_INFO_COLOR
+#define UART_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> SAADC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> UART_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8857,18 +11647,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef SAADC_CONFIG_DEBUG_COLOR
-#define SAADC_CONFIG_DEBUG_COLOR 0
+#ifndef UART_CONFIG_DEBUG_COLOR
+#define UART_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> SPIS_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> USBD_CONFIG_LOG_ENABLED - Enable logging in the module
 //==========================================================
-#ifndef SPIS_CONFIG_LOG_ENABLED
-#define SPIS_CONFIG_LOG_ENABLED 0
+#ifndef USBD_CONFIG_LOG_ENABLED
+#define USBD_CONFIG_LOG_ENABLED 0
 #endif
-// <o> SPIS_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> USBD_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8876,11 +11666,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef SPIS_CONFIG_LOG_LEVEL
-#define SPIS_CONFIG_LOG_LEVEL 3
+#ifndef USBD_CONFIG_LOG_LEVEL
+#define USBD_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> SPIS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> USBD_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8892,11 +11682,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef SPIS_CONFIG_INFO_COLOR
-#define SPIS_CONFIG_INFO_COLOR 0
+#ifndef USBD_CONFIG_INFO_COLOR
+#define USBD_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> SPIS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> USBD_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8908,18 +11698,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef SPIS_CONFIG_DEBUG_COLOR
-#define SPIS_CONFIG_DEBUG_COLOR 0
+#ifndef USBD_CONFIG_DEBUG_COLOR
+#define USBD_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> SPI_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> WDT_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef SPI_CONFIG_LOG_ENABLED
-#define SPI_CONFIG_LOG_ENABLED 0
+#ifndef WDT_CONFIG_LOG_ENABLED
+#define WDT_CONFIG_LOG_ENABLED 0
 #endif
-// <o> SPI_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> WDT_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -8927,11 +11717,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef SPI_CONFIG_LOG_LEVEL
-#define SPI_CONFIG_LOG_LEVEL 3
+#ifndef WDT_CONFIG_LOG_LEVEL
+#define WDT_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> SPI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> WDT_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8943,11 +11733,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef SPI_CONFIG_INFO_COLOR
-#define SPI_CONFIG_INFO_COLOR 0
+#ifndef WDT_CONFIG_INFO_COLOR
+#define WDT_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> SPI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> WDT_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8959,30 +11749,52 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef SPI_CONFIG_DEBUG_COLOR
-#define SPI_CONFIG_DEBUG_COLOR 0
+#ifndef WDT_CONFIG_DEBUG_COLOR
+#define WDT_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> TIMER_CONFIG_LOG_ENABLED - Enables logging in the module.
+// </h> 
 //==========================================================
-#ifndef TIMER_CONFIG_LOG_ENABLED
-#define TIMER_CONFIG_LOG_ENABLED 0
+
+// <h> nrf_log in nRF_Libraries 
+
+//==========================================================
+// <e> APP_BUTTON_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef APP_BUTTON_CONFIG_LOG_ENABLED
+#define APP_BUTTON_CONFIG_LOG_ENABLED 0
+#endif
+// <o> APP_BUTTON_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef APP_BUTTON_CONFIG_LOG_LEVEL
+#define APP_BUTTON_CONFIG_LOG_LEVEL 3
 #endif
-// <o> TIMER_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <o> APP_BUTTON_CONFIG_INITIAL_LOG_LEVEL  - Initial severity level if dynamic filtering is enabled.
  
+
+// <i> If module generates a lot of logs, initial log level can
+// <i> be decreased to prevent flooding. Severity level can be
+// <i> increased on instance basis.
 // <0=> Off 
 // <1=> Error 
 // <2=> Warning 
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef TIMER_CONFIG_LOG_LEVEL
-#define TIMER_CONFIG_LOG_LEVEL 3
+#ifndef APP_BUTTON_CONFIG_INITIAL_LOG_LEVEL
+#define APP_BUTTON_CONFIG_INITIAL_LOG_LEVEL 3
 #endif
 
-// <o> TIMER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> APP_BUTTON_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -8994,11 +11806,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef TIMER_CONFIG_INFO_COLOR
-#define TIMER_CONFIG_INFO_COLOR 0
+#ifndef APP_BUTTON_CONFIG_INFO_COLOR
+#define APP_BUTTON_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> TIMER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> APP_BUTTON_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9010,18 +11822,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef TIMER_CONFIG_DEBUG_COLOR
-#define TIMER_CONFIG_DEBUG_COLOR 0
+#ifndef APP_BUTTON_CONFIG_DEBUG_COLOR
+#define APP_BUTTON_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> TWIS_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> APP_SAADC_ACQTIME_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef TWIS_CONFIG_LOG_ENABLED
-#define TWIS_CONFIG_LOG_ENABLED 0
+#ifndef APP_SAADC_ACQTIME_CONFIG_LOG_ENABLED
+#define APP_SAADC_ACQTIME_CONFIG_LOG_ENABLED 0
 #endif
-// <o> TWIS_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> APP_SAADC_ACQTIME_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -9029,11 +11841,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef TWIS_CONFIG_LOG_LEVEL
-#define TWIS_CONFIG_LOG_LEVEL 3
+#ifndef APP_SAADC_ACQTIME_CONFIG_LOG_LEVEL
+#define APP_SAADC_ACQTIME_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> TWIS_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_ACQTIME_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9045,11 +11857,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef TWIS_CONFIG_INFO_COLOR
-#define TWIS_CONFIG_INFO_COLOR 0
+#ifndef APP_SAADC_ACQTIME_CONFIG_INFO_COLOR
+#define APP_SAADC_ACQTIME_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> TWIS_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_ACQTIME_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9061,18 +11873,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef TWIS_CONFIG_DEBUG_COLOR
-#define TWIS_CONFIG_DEBUG_COLOR 0
+#ifndef APP_SAADC_ACQTIME_CONFIG_DEBUG_COLOR
+#define APP_SAADC_ACQTIME_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> TWI_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> APP_SAADC_BENCH_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef TWI_CONFIG_LOG_ENABLED
-#define TWI_CONFIG_LOG_ENABLED 0
+#ifndef APP_SAADC_BENCH_CONFIG_LOG_ENABLED
+#define APP_SAADC_BENCH_CONFIG_LOG_ENABLED 0
 #endif
-// <o> TWI_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> APP_SAADC_BENCH_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -9080,11 +11892,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef TWI_CONFIG_LOG_LEVEL
-#define TWI_CONFIG_LOG_LEVEL 3
+#ifndef APP_SAADC_BENCH_CONFIG_LOG_LEVEL
+#define APP_SAADC_BENCH_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> TWI_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_BENCH_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9096,11 +11908,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef TWI_CONFIG_INFO_COLOR
-#define TWI_CONFIG_INFO_COLOR 0
+#ifndef APP_SAADC_BENCH_CONFIG_INFO_COLOR
+#define APP_SAADC_BENCH_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> TWI_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_BENCH_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9112,18 +11924,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef TWI_CONFIG_DEBUG_COLOR
-#define TWI_CONFIG_DEBUG_COLOR 0
+#ifndef APP_SAADC_BENCH_CONFIG_DEBUG_COLOR
+#define APP_SAADC_BENCH_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> UART_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> APP_SAADC_CALIB_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef UART_CONFIG_LOG_ENABLED
-#define UART_CONFIG_LOG_ENABLED 0
+#ifndef APP_SAADC_CALIB_CONFIG_LOG_ENABLED
+#define APP_SAADC_CALIB_CONFIG_LOG_ENABLED 0
 #endif
-// <o> UART_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> APP_SAADC_CALIB_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -9131,11 +11943,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef UART_CONFIG_LOG_LEVEL
-#define UART_CONFIG_LOG_LEVEL 3
+#ifndef APP_SAADC_CALIB_CONFIG_LOG_LEVEL
+#define APP_SAADC_CALIB_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> UART_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_CALIB_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9147,11 +11959,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef UART_CONFIG_INFO_COLOR
-#define UART_CONFIG_INFO_COLOR 0
+#ifndef APP_SAADC_CALIB_CONFIG_INFO_COLOR
+#define APP_SAADC_CALIB_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> UART_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_CALIB_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9163,18 +11975,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef UART_CONFIG_DEBUG_COLOR
-#define UART_CONFIG_DEBUG_COLOR 0
+#ifndef APP_SAADC_CALIB_CONFIG_DEBUG_COLOR
+#define APP_SAADC_CALIB_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> USBD_CONFIG_LOG_ENABLED - Enable logging in the module
+// <e> APP_SAADC_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef USBD_CONFIG_LOG_ENABLED
-#define USBD_CONFIG_LOG_ENABLED 0
+#ifndef APP_SAADC_CONFIG_LOG_ENABLED
+#define APP_SAADC_CONFIG_LOG_ENABLED 0
 #endif
-// <o> USBD_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> APP_SAADC_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -9182,11 +11994,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef USBD_CONFIG_LOG_LEVEL
-#define USBD_CONFIG_LOG_LEVEL 3
+#ifndef APP_SAADC_CONFIG_LOG_LEVEL
+#define APP_SAADC_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> USBD_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9198,11 +12010,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef USBD_CONFIG_INFO_COLOR
-#define USBD_CONFIG_INFO_COLOR 0
+#ifndef APP_SAADC_CONFIG_INFO_COLOR
+#define APP_SAADC_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> USBD_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9214,18 +12026,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef USBD_CONFIG_DEBUG_COLOR
-#define USBD_CONFIG_DEBUG_COLOR 0
+#ifndef APP_SAADC_CONFIG_DEBUG_COLOR
+#define APP_SAADC_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> WDT_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> APP_SAADC_LITE_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef WDT_CONFIG_LOG_ENABLED
-#define WDT_CONFIG_LOG_ENABLED 0
+#ifndef APP_SAADC_LITE_CONFIG_LOG_ENABLED
+#define APP_SAADC_LITE_CONFIG_LOG_ENABLED 0
 #endif
-// <o> WDT_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> APP_SAADC_LITE_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -9233,11 +12045,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef WDT_CONFIG_LOG_LEVEL
-#define WDT_CONFIG_LOG_LEVEL 3
+#ifndef APP_SAADC_LITE_CONFIG_LOG_LEVEL
+#define APP_SAADC_LITE_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> WDT_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_LITE_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9249,11 +12061,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef WDT_CONFIG_INFO_COLOR
-#define WDT_CONFIG_INFO_COLOR 0
+#ifndef APP_SAADC_LITE_CONFIG_INFO_COLOR
+#define APP_SAADC_LITE_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> WDT_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> APP_SAADC_LITE_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9265,24 +12077,18 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef WDT_CONFIG_DEBUG_COLOR
-#define WDT_CONFIG_DEBUG_COLOR 0
+#ifndef APP_SAADC_LITE_CONFIG_DEBUG_COLOR
+#define APP_SAADC_LITE_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// </h> 
-//==========================================================
-
-// <h> nrf_log in nRF_Libraries 
-
-//==========================================================
-// <e> APP_BUTTON_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> APP_TIMER_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef APP_BUTTON_CONFIG_LOG_ENABLED
-#define APP_BUTTON_CONFIG_LOG_ENABLED 0
+#ifndef APP_TIMER_CONFIG_LOG_ENABLED
+#define APP_TIMER_CONFIG_LOG_ENABLED 0
 #endif
-// <o> APP_BUTTON_CONFIG_LOG_LEVEL  - Default Severity level
+// <o> APP_TIMER_CONFIG_LOG_LEVEL  - Default Severity level
  
 // <0=> Off 
 // <1=> Error 
@@ -9290,11 +12096,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef APP_BUTTON_CONFIG_LOG_LEVEL
-#define APP_BUTTON_CONFIG_LOG_LEVEL 3
+#ifndef APP_TIMER_CONFIG_LOG_LEVEL
+#define APP_TIMER_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> APP_BUTTON_CONFIG_INITIAL_LOG_LEVEL  - Initial severity level if dynamic filtering is enabled.
+// <o> APP_TIMER_CONFIG_INITIAL_LOG_LEVEL  - Initial severity level if dynamic filtering is enabled.
  
 
 // <i> If module generates a lot of logs, initial log level can
@@ -9306,11 +12112,11 @@
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef APP_BUTTON_CONFIG_INITIAL_LOG_LEVEL
-#define APP_BUTTON_CONFIG_INITIAL_LOG_LEVEL 3
+#ifndef APP_TIMER_CONFIG_INITIAL_LOG_LEVEL
+#define APP_TIMER_CONFIG_INITIAL_LOG_LEVEL 3
 #endif
 
-// <o> APP_BUTTON_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> APP_TIMER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9322,11 +12128,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef APP_BUTTON_CONFIG_INFO_COLOR
-#define APP_BUTTON_CONFIG_INFO_COLOR 0
+#ifndef APP_TIMER_CONFIG_INFO_COLOR
+#define APP_TIMER_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> APP_BUTTON_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> APP_TIMER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9338,46 +12144,30 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef APP_BUTTON_CONFIG_DEBUG_COLOR
-#define APP_BUTTON_CONFIG_DEBUG_COLOR 0
+#ifndef APP_TIMER_CONFIG_DEBUG_COLOR
+#define APP_TIMER_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
 
-// <e> APP_TIMER_CONFIG_LOG_ENABLED - Enables logging in the module.
+// <e> APP_TIMESYNC_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
-#ifndef APP_TIMER_CONFIG_LOG_ENABLED
-#define APP_TIMER_CONFIG_LOG_ENABLED 0
-#endif
-// <o> APP_TIMER_CONFIG_LOG_LEVEL  - Default Severity level
- 
-// <0=> Off 
-// <1=> Error 
-// <2=> Warning 
-// <3=> Info 
-// <4=> Debug 
-
-#ifndef APP_TIMER_CONFIG_LOG_LEVEL
-#define APP_TIMER_CONFIG_LOG_LEVEL 3
+#ifndef APP_TIMESYNC_CONFIG_LOG_ENABLED
+#define APP_TIMESYNC_CONFIG_LOG_ENABLED 0
 #endif
-
-// <o> APP_TIMER_CONFIG_INITIAL_LOG_LEVEL  - Initial severity level if dynamic filtering is enabled.
+// <o> APP_TIMESYNC_CONFIG_LOG_LEVEL  - Default Severity level
  
-
-// <i> If module generates a lot of logs, initial log level can
-// <i> be decreased to prevent flooding. Severity level can be
-// <i> increased on instance basis.
 // <0=> Off 
 // <1=> Error 
 // <2=> Warning 
 // <3=> Info 
 // <4=> Debug 
 
-#ifndef APP_TIMER_CONFIG_INITIAL_LOG_LEVEL
-#define APP_TIMER_CONFIG_INITIAL_LOG_LEVEL 3
+#ifndef APP_TIMESYNC_CONFIG_LOG_LEVEL
+#define APP_TIMESYNC_CONFIG_LOG_LEVEL 3
 #endif
 
-// <o> APP_TIMER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+// <o> APP_TIMESYNC_CONFIG_INFO_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9389,11 +12179,11 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef APP_TIMER_CONFIG_INFO_COLOR
-#define APP_TIMER_CONFIG_INFO_COLOR 0
+#ifndef APP_TIMESYNC_CONFIG_INFO_COLOR
+#define APP_TIMESYNC_CONFIG_INFO_COLOR 0
 #endif
 
-// <o> APP_TIMER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+// <o> APP_TIMESYNC_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
  
 // <0=> Default 
 // <1=> Black 
@@ -9405,8 +12195,8 @@
 // <7=> Cyan 
 // <8=> White 
 
-#ifndef APP_TIMER_CONFIG_DEBUG_COLOR
-#define APP_TIMER_CONFIG_DEBUG_COLOR 0
+#ifndef APP_TIMESYNC_CONFIG_DEBUG_COLOR
+#define APP_TIMESYNC_CONFIG_DEBUG_COLOR 0
 #endif
 
 // </e>
@@ -10558,6 +13348,57 @@
 
 // </e>
 
+// <e> NRF_SKIPLIST_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRF_SKIPLIST_CONFIG_LOG_ENABLED
+#define NRF_SKIPLIST_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRF_SKIPLIST_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRF_SKIPLIST_CONFIG_LOG_LEVEL
+#define NRF_SKIPLIST_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRF_SKIPLIST_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRF_SKIPLIST_CONFIG_INFO_COLOR
+#define NRF_SKIPLIST_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRF_SKIPLIST_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRF_SKIPLIST_CONFIG_DEBUG_COLOR
+#define NRF_SKIPLIST_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
 // <e> NRF_SORTLIST_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
 #ifndef NRF_SORTLIST_CONFIG_LOG_ENABLED
@@ -11743,6 +14584,13 @@
 #define BLE_NUS_C_BLE_OBSERVER_PRIO 2
 #endif
 
+// <o> BLE_NUS_C_BRIDGE_BLE_OBSERVER_PRIO  
+// <i> Priority with which BLE events are dispatched to the NUS client bridge. Must be after the GATT Queue.
+
+#ifndef BLE_NUS_C_BRIDGE_BLE_OBSERVER_PRIO
+#define BLE_NUS_C_BRIDGE_BLE_OBSERVER_PRIO 2
+#endif
+
 // <o> BLE_OTS_BLE_OBSERVER_PRIO  
 // <i> Priority with which BLE events are dispatched to the Object transfer service.
 
@@ -11890,6 +14738,13 @@
 #define NFC_BLE_PAIR_LIB_BLE_OBSERVER_PRIO 1
 #endif
 
+// <o> NRF_BLE_ASYNC_BLE_OBSERVER_PRIO  
+// <i> Priority with which BLE events are dispatched to the GATT client operations of cooperative tasks.
+
+#ifndef NRF_BLE_ASYNC_BLE_OBSERVER_PRIO
+#define NRF_BLE_ASYNC_BLE_OBSERVER_PRIO 2
+#endif
+
 // <o> NRF_BLE_BMS_BLE_OBSERVER_PRIO  
 // <i> Priority with which BLE events are dispatched to the Bond Management Service.
 
@@ -11904,6 +14759,20 @@
 #define NRF_BLE_CGMS_BLE_OBSERVER_PRIO 2
 #endif
 
+// <o> NRF_BLE_CHMAP_BLE_OBSERVER_PRIO  
+// <i> Priority with which BLE events are dispatched to the adaptive channel map.
+
+#ifndef NRF_BLE_CHMAP_BLE_OBSERVER_PRIO
+#define NRF_BLE_CHMAP_BLE_OBSERVER_PRIO 1
+#endif
+
+// <o> NRF_BLE_CONN_PLAN_BLE_OBSERVER_PRIO  
+// <i> Priority with which BLE events are dispatched to the central connection planner.
+
+#ifndef NRF_BLE_CONN_PLAN_BLE_OBSERVER_PRIO
+#define NRF_BLE_CONN_PLAN_BLE_OBSERVER_PRIO 1
+#endif
+
 // <o> NRF_BLE_ES_BLE_OBSERVER_PRIO  
 // <i> Priority with which BLE events are dispatched to the Eddystone module.
 
@@ -11932,6 +14801,27 @@
 #define NRF_BLE_GQ_BLE_OBSERVER_PRIO 1
 #endif
 
+// <o> NRF_BLE_CCCD_BLE_OBSERVER_PRIO  
+// <i> Priority with which BLE events are dispatched to the CCCD configuration module.
+
+#ifndef NRF_BLE_CCCD_BLE_OBSERVER_PRIO
+#define NRF_BLE_CCCD_BLE_OBSERVER_PRIO 2
+#endif
+
+// <o> NRF_BLE_FANOUT_BLE_OBSERVER_PRIO  
+// <i> Priority with which BLE events are dispatched to the Measurement fan-out module.
+
+#ifndef NRF_BLE_FANOUT_BLE_OBSERVER_PRIO
+#define NRF_BLE_FANOUT_BLE_OBSERVER_PRIO 2
+#endif
+
+// <o> NRF_BLE_IND_BACKLOG_BLE_OBSERVER_PRIO  
+// <i> Priority with which BLE events are dispatched to the Stored measurement backlog module.
+
+#ifndef NRF_BLE_IND_BACKLOG_BLE_OBSERVER_PRIO
+#define NRF_BLE_IND_BACKLOG_BLE_OBSERVER_PRIO 2
+#endif
+
 // <o> NRF_BLE_QWR_BLE_OBSERVER_PRIO  
 // <i> Priority with which BLE events are dispatched to the Queued writes module.
 
@@ -11946,6 +14836,13 @@
 #define NRF_BLE_SCAN_OBSERVER_PRIO 1
 #endif
 
+// <o> NRF_BLE_TPUT_BLE_OBSERVER_PRIO  
+// <i> Priority with which BLE events are dispatched to the Throughput benchmark module.
+
+#ifndef NRF_BLE_TPUT_BLE_OBSERVER_PRIO
+#define NRF_BLE_TPUT_BLE_OBSERVER_PRIO 2
+#endif
+
 // <o> PM_BLE_OBSERVER_PRIO - Priority with which BLE events are dispatched to the Peer Manager module. 
 #ifndef PM_BLE_OBSERVER_PRIO
 #define PM_BLE_OBSERVER_PRIO 1
@@ -11986,6 +14883,88 @@
 // </h> 
 //==========================================================
 
+// <e> NRF_SDH_DISPATCH_ENABLED - nrf_sdh_dispatch - Filtered and batched BLE and SoC event dispatch
+
+// <i> Events are taken from the SoftDevice by nrf_sdh_evts_poll() and passed through a table
+// <i> only to the observers interested in each event ID.
+//==========================================================
+#ifndef NRF_SDH_DISPATCH_ENABLED
+#define NRF_SDH_DISPATCH_ENABLED 0
+#endif
+// <o> NRF_SDH_DISPATCH_EVT_BUDGET - Maximum number of events handled per call of nrf_sdh_evts_poll(). 
+// <i> 0 means no limit. Events left are handled in a repeated call.
+
+#ifndef NRF_SDH_DISPATCH_EVT_BUDGET
+#define NRF_SDH_DISPATCH_EVT_BUDGET 8
+#endif
+
+// <o> NRF_SDH_DISPATCH_OBSERVERS_MAX - Maximum number of BLE or SoC observers in the dispatch table. 
+// <i> With more observers, events are passed by walking all observers.
+
+#ifndef NRF_SDH_DISPATCH_OBSERVERS_MAX
+#define NRF_SDH_DISPATCH_OBSERVERS_MAX 32
+#endif
+
+// <o> NRF_SDH_DISPATCH_BLE_EVT_ID_COUNT - Number of BLE event IDs covered by the dispatch table. 
+// <i> The default covers the common, GAP, GATTC, GATTS and L2CAP events.
+
+#ifndef NRF_SDH_DISPATCH_BLE_EVT_ID_COUNT
+#define NRF_SDH_DISPATCH_BLE_EVT_ID_COUNT 144
+#endif
+
+// <o> NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE - Number of pooled BLE events. 
+// <i> 0 means BLE events are taken into a buffer on the stack. Otherwise each event is taken
+// <i> into an nrf_balloc block, which observers can keep with nrf_sdh_dispatch_ble_evt_get()
+// <i> instead of copying the event. Each block holds NRF_SDH_BLE_EVT_BUF_SIZE bytes.
+
+#ifndef NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE
+#define NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE 0
+#endif
+
+// <e> NRF_SDH_DISPATCH_PROFILER_ENABLED - Profile BLE observer run time and event age.
+
+// <i> Handler run time per observer and event ID, and event age per event ID, are measured with
+// <i> the DWT cycle counter and printed with nrf_sdh_dispatch_profile_log().
+//==========================================================
+#ifndef NRF_SDH_DISPATCH_PROFILER_ENABLED
+#define NRF_SDH_DISPATCH_PROFILER_ENABLED 0
+#endif
+// <o> NRF_SDH_DISPATCH_PROFILER_SLOTS - Number of profiler entries. 
+// <i> One entry is used per observer and event ID pair, and per event ID for event age.
+
+#ifndef NRF_SDH_DISPATCH_PROFILER_SLOTS
+#define NRF_SDH_DISPATCH_PROFILER_SLOTS 64
+#endif
+
+// </e>
+
+// </e>
+
+// <e> NRF_SDH_BLE_TRACE_ENABLED - nrf_sdh_ble_trace - BLE event trace recording and replay
+
+// <i> Every BLE event is copied into a frame buffer and passed to a transport, for example RTT,
+// <i> by nrf_sdh_ble_trace_process(). Captured streams are replayed with nrf_sdh_ble_trace_replay(),
+// <i> which requires NRF_SDH_DISPATCH_ENABLED.
+//==========================================================
+#ifndef NRF_SDH_BLE_TRACE_ENABLED
+#define NRF_SDH_BLE_TRACE_ENABLED 0
+#endif
+// <o> NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE  - Size of the frame buffer.
+ 
+// <i> Must be a power of 2.
+
+// <1024=> 1024 
+// <2048=> 2048 
+// <4096=> 4096 
+// <8192=> 8192 
+// <16384=> 16384 
+
+#ifndef NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE
+#define NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE 4096
+#endif
+
+// </e>
+
 // <h> Clock - SoftDevice clock configuration
 
 //==========================================================
@@ -12086,6 +15065,13 @@
 #define RNG_CONFIG_STATE_OBSERVER_PRIO 0
 #endif
 
+// <o> BLE_UUID_CACHE_STATE_OBSERVER_PRIO  
+// <i> Priority with which state events are dispatched to the encoded UUID cache.
+
+#ifndef BLE_UUID_CACHE_STATE_OBSERVER_PRIO
+#define BLE_UUID_CACHE_STATE_OBSERVER_PRIO 1
+#endif
+
 // </h> 
 //==========================================================
 
@@ -12147,6 +15133,13 @@
 // <h> SoC Observers priorities - Invididual priorities
 
 //==========================================================
+// <o> APP_TIMESYNC_CONFIG_SOC_OBSERVER_PRIO  
+// <i> Priority with which SoC events are dispatched to the time synchronization module.
+
+#ifndef APP_TIMESYNC_CONFIG_SOC_OBSERVER_PRIO
+#define APP_TIMESYNC_CONFIG_SOC_OBSERVER_PRIO 0
+#endif
+
 // <o> BLE_DFU_SOC_OBSERVER_PRIO  
 // <i> Priority with which BLE events are dispatched to the DFU Service.
 
@@ -0,0 +1,1987 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC)
+#include <string.h>
+#include "app_saadc.h"
+#include "app_util_platform.h"
+#include "app_timer.h"
+#include "app_saadc_bench.h"
+#include "app_saadc_acqtime.h"
+#include "nrf_energy.h"
+#include "nrfx_ppi.h"
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+#include "nrfx_rtc.h"
+#else
+#include "nrfx_timer.h"
+#endif
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+#include "nrfx_timer.h"
+#endif
+#if NRF_MODULE_ENABLED(NRF_PWR_MGMT) && NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED
+#include "nrf_pwr_mgmt_policy.h"
+#define APP_SAADC_PWR_MGMT 1
+#else
+#define APP_SAADC_PWR_MGMT 0
+#endif
+
+#define NRF_LOG_MODULE_NAME app_saadc
+#if APP_SAADC_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       APP_SAADC_CONFIG_LOG_LEVEL
+#define NRF_LOG_INFO_COLOR  APP_SAADC_CONFIG_INFO_COLOR
+#define NRF_LOG_DEBUG_COLOR APP_SAADC_CONFIG_DEBUG_COLOR
+#else //APP_SAADC_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       0
+#endif //APP_SAADC_CONFIG_LOG_ENABLED
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+#define APP_SAADC_RTC_FREQUENCY 32768 /**< RTC runs without prescaler to get the finest interval. */
+
+static nrfx_rtc_t const m_rtc = NRFX_RTC_INSTANCE(APP_SAADC_CONFIG_RTC_INSTANCE);
+#else
+static nrfx_timer_t const m_timer = NRFX_TIMER_INSTANCE(APP_SAADC_CONFIG_TIMER_INSTANCE);
+#endif
+
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+static nrfx_timer_t const m_counter = NRFX_TIMER_INSTANCE(APP_SAADC_MULTIRATE_CONFIG_TIMER_INSTANCE);
+
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+#define APP_SAADC_MULTIRATE_GUARD_TICKS 1 /**< More than this many ticks must be left before the next trigger, so one whole RTC tick. */
+#else
+#define APP_SAADC_MULTIRATE_GUARD_TICKS (APP_SAADC_MULTIRATE_CONFIG_GUARD_US * 16) /**< TIMER runs at 16 MHz. */
+#endif
+
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+#define APP_SAADC_MULTIRATE_GUARD_US 62 /**< Longest wait for the guard, two RTC ticks rounded up. */
+#else
+#define APP_SAADC_MULTIRATE_GUARD_US APP_SAADC_MULTIRATE_CONFIG_GUARD_US
+#endif
+#define APP_SAADC_MULTIRATE_TCONV_US 2 /**< Conversion time of one sample, rounded up. */
+#endif
+
+/**@brief Module states. */
+typedef enum
+{
+    APP_SAADC_STATE_UNINITIALIZED, ///< Module is not initialized.
+    APP_SAADC_STATE_IDLE,          ///< Module is initialized, acquisition is not running.
+    APP_SAADC_STATE_RUNNING,       ///< Acquisition is running.
+    APP_SAADC_STATE_MONITOR,       ///< Sampling at the monitor rate into the history ring, waiting for a limit.
+    APP_SAADC_STATE_TRIGGERED,     ///< Limit crossed, waiting for the monitor sampling to stop.
+    APP_SAADC_STATE_STOPPING,      ///< Stop was requested, waiting for the last buffer.
+} app_saadc_state_t;
+
+/**@brief Number of buffers the SAADC driver can hold at a time. */
+#define APP_SAADC_DRIVER_BUFFERS 2
+
+/**@brief Control block. */
+typedef struct
+{
+    app_saadc_evt_handler_t    evt_handler;     ///< User event handler.
+    app_saadc_filter_t *       p_filter;        ///< Filter stage, or NULL.
+    app_saadc_multirate_t *    p_multirate;     ///< Multi-rate schedule, or NULL.
+    uint32_t                   pselp[NRF_SAADC_CHANNEL_COUNT]; ///< Positive input of each channel, connected when the schedule enables it.
+    uint32_t                   frame_base;      ///< Frame counter value when the pacing was started.
+    uint32_t                   sample_interval_us; ///< Sample interval of the acquisition, in microseconds.
+    uint32_t                   period_ns;       ///< Actual interval between SAMPLE tasks, in nanoseconds.
+    uint32_t                   ref_ticks;       ///< app_timer counter value at the last END event, or when the pacing was started.
+    uint64_t                   frames_done;     ///< Number of sample frames delivered since the pacing was started.
+    uint8_t                    channel_count;   ///< Number of samples in a frame.
+    uint8_t                    channels[NRF_SAADC_CHANNEL_COUNT]; ///< SAADC channel index of each sample in a frame.
+    uint8_t                    resolution_bits; ///< Resolution of the conversions, in bits.
+    bool                       autorange;       ///< Gain auto-ranging is enabled.
+    nrf_saadc_gain_t           gains[NRF_SAADC_CHANNEL_COUNT];    ///< Gain in effect for each sample in a frame.
+    nrf_saadc_gain_t           gains_reported[NRF_SAADC_CHANNEL_COUNT]; ///< Gains reported with the current buffer.
+    uint8_t                    gain_transition; ///< Mask of frame positions whose gain was changed while the next buffer was being filled.
+    nrf_balloc_t const *       p_pool;          ///< Pool of result buffers, or NULL.
+    nrf_saadc_value_t *        p_queued[APP_SAADC_DRIVER_BUFFERS]; ///< Pool buffers handed to the driver, in order.
+    uint8_t                    queued_count;    ///< Number of pool buffers handed to the driver.
+    uint16_t                   buffer_size;     ///< Number of samples in each pool buffer.
+    nrf_ppi_channel_t          ppi_sample;      ///< PPI channel connecting the trigger to the SAMPLE task.
+    nrf_ppi_channel_t          ppi_restart;     ///< PPI channel connecting the END event to the START task.
+    nrf_ppi_channel_t          ppi_count;       ///< PPI channel connecting the trigger to the frame counter.
+    nrf_ppi_channel_t          ppi_start;       ///< PPI channel connecting the start event to the START task of the trigger.
+    nrf_ppi_channel_t          ppi_calib;       ///< PPI channel connecting the CALIBRATEDONE event to the START tasks of the SAADC and the trigger.
+    bool                       start_on_evt;    ///< Pacing is started by the event given in @ref app_saadc_start_at.
+    bool                       start_aligned;   ///< Sample times still follow from the start event.
+    volatile bool              buf_req_pending; ///< Driver requested a buffer while the pool was empty.
+    bool                       restart_held;    ///< END to START connection is cut because the pool was empty.
+    uint32_t                   overruns;        ///< Number of times the pool was empty on a buffer request.
+    app_saadc_monitor_config_t monitor;         ///< Monitor mode configuration.
+    bool                       monitor_enabled; ///< Monitor mode is used, burst captures return to it.
+    bool                       history_active;  ///< The driver is sampling into the history ring.
+    uint32_t                   monitor_rounds;  ///< Number of times the history ring was filled.
+    uint16_t                   history_pos;     ///< Write position in the history ring when sampling stopped.
+    nrfx_saadc_limit_evt_t     trigger_limit;   ///< Limit that triggered the burst capture.
+    uint16_t                   burst_left;      ///< Buffers left to hand over in a limited burst capture.
+    bool                       burst_limited;   ///< The running capture is a burst of limited length.
+    volatile bool              calib_pending;   ///< Offset calibration was requested while running.
+    bool                       calib_armed;     ///< Offset calibration runs when the buffer being filled ends.
+    bool                       calib_running;   ///< Offset calibration runs in the gap, sampling restarts in hardware when it is done.
+    nrf_saadc_value_t *        p_deferred;      ///< Buffer supplied while a calibration gap was open, handed to the driver when it closes.
+    uint16_t                   deferred_size;   ///< Number of samples in the deferred buffer.
+    volatile uint8_t           aux_count;       ///< Number of queued auxiliary conversion requests.
+    bool                       aux_armed;       ///< Auxiliary conversions run when the buffer being filled ends.
+    volatile bool              resync_pending;  ///< A multi-rate change landed on a trigger, the scan stream must be resynchronized.
+    bool                       resync_armed;    ///< Resynchronization runs when the buffer being filled ends.
+    volatile app_saadc_state_t state;           ///< Module state.
+} app_saadc_cb_t;
+
+static app_saadc_cb_t m_cb;
+
+static app_saadc_aux_request_t m_aux_queue[APP_SAADC_CONFIG_AUX_REQUESTS]; ///< Queued auxiliary conversion requests, oldest first.
+
+
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+static void rtc_evt_handler(nrfx_rtc_int_type_t int_type)
+{
+    // All RTC events used by the module are routed through PPI only.
+    UNUSED_PARAMETER(int_type);
+}
+#else
+static void timer_evt_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    // All TIMER events used by the module are routed through PPI only.
+    UNUSED_PARAMETER(event_type);
+    UNUSED_PARAMETER(p_context);
+}
+#endif
+
+
+/**@brief Function for initializing the trigger instance and getting its compare event address.
+ *
+ * @param[out] p_evt_addr   Address of the event to route to the SAMPLE task.
+ * @param[out] p_fork_addr  Address of the task to fork from the sampling PPI channel, or 0.
+ */
+static ret_code_t trigger_init(uint32_t * p_evt_addr, uint32_t * p_fork_addr)
+{
+    ret_code_t err_code;
+
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+    nrfx_rtc_config_t config = NRFX_RTC_DEFAULT_CONFIG;
+    config.prescaler = RTC_FREQ_TO_PRESCALER(APP_SAADC_RTC_FREQUENCY);
+
+    err_code = nrfx_rtc_init(&m_rtc, &config, rtc_evt_handler);
+    VERIFY_SUCCESS(err_code);
+
+    *p_evt_addr  = nrfx_rtc_event_address_get(&m_rtc, NRF_RTC_EVENT_COMPARE_0);
+    *p_fork_addr = nrfx_rtc_task_address_get(&m_rtc, NRF_RTC_TASK_CLEAR);
+#else
+    nrfx_timer_config_t config = NRFX_TIMER_DEFAULT_CONFIG;
+    config.frequency = NRF_TIMER_FREQ_16MHz;
+    config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+    err_code = nrfx_timer_init(&m_timer, &config, timer_evt_handler);
+    VERIFY_SUCCESS(err_code);
+
+    *p_evt_addr  = nrfx_timer_compare_event_address_get(&m_timer, NRF_TIMER_CC_CHANNEL0);
+    *p_fork_addr = 0;
+#endif
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for setting the interval of the trigger instance.
+ *
+ * @details Must be called while the trigger is stopped.
+ *
+ * @param[in]  interval_us  Sample interval in microseconds.
+ * @param[out] p_period_ns  Actual sample interval after rounding to trigger ticks, in nanoseconds.
+ *
+ * @retval NRF_SUCCESS             If the interval was set.
+ * @retval NRF_ERROR_INVALID_PARAM If the interval is out of range for the trigger source.
+ */
+static ret_code_t trigger_interval_set(uint32_t interval_us, uint32_t * p_period_ns)
+{
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+    uint32_t ticks = (uint32_t)ROUNDED_DIV((uint64_t)interval_us * APP_SAADC_RTC_FREQUENCY,
+                                           1000000ULL);
+    // The CLEAR task forked from the compare event takes effect one tick later.
+    if ((ticks < 2) || (ticks > nrfx_rtc_max_ticks_get(&m_rtc)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    ret_code_t err_code = nrfx_rtc_cc_set(&m_rtc, 0, ticks - 1, false);
+    VERIFY_SUCCESS(err_code);
+
+    *p_period_ns = (uint32_t)(((uint64_t)ticks * 1000000000ULL) / APP_SAADC_RTC_FREQUENCY);
+#else
+    uint32_t ticks = nrfx_timer_us_to_ticks(&m_timer, interval_us);
+    if (ticks == 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    nrfx_timer_extended_compare(&m_timer,
+                                NRF_TIMER_CC_CHANNEL0,
+                                ticks,
+                                NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK,
+                                false);
+
+    // TIMER runs at 16 MHz, 62.5 ns per tick.
+    *p_period_ns = (uint32_t)(((uint64_t)ticks * 125) / 2);
+#endif
+
+    return NRF_SUCCESS;
+}
+
+
+static void trigger_uninit(void)
+{
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+    nrfx_rtc_uninit(&m_rtc);
+#else
+    nrfx_timer_uninit(&m_timer);
+#endif
+}
+
+
+static void trigger_start(void)
+{
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+    nrfx_rtc_counter_clear(&m_rtc);
+    nrfx_rtc_enable(&m_rtc);
+#else
+    nrfx_timer_clear(&m_timer);
+    nrfx_timer_enable(&m_timer);
+#endif
+}
+
+
+/**@brief Function for getting the address of the task that starts the trigger instance. */
+static uint32_t trigger_start_task_address_get(void)
+{
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+    return nrfx_rtc_task_address_get(&m_rtc, NRF_RTC_TASK_START);
+#else
+    return nrfx_timer_task_address_get(&m_timer, NRF_TIMER_TASK_START);
+#endif
+}
+
+
+static void trigger_stop(void)
+{
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+    nrfx_rtc_disable(&m_rtc);
+#else
+    nrfx_timer_disable(&m_timer);
+#endif
+}
+
+
+/**@brief Function for clearing the stopped trigger, so that it is started through PPI with
+ *        a full period before the first SAMPLE task.
+ */
+static void trigger_clear(void)
+{
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+    nrfx_rtc_counter_clear(&m_rtc);
+#else
+    nrfx_timer_clear(&m_timer);
+#endif
+}
+
+
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+/**@brief Function for getting the number of trigger ticks left before the next SAMPLE task. */
+static uint32_t trigger_ticks_left(void)
+{
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+    return nrf_rtc_cc_get(m_rtc.p_reg, 0) - nrfx_rtc_counter_get(&m_rtc);
+#else
+    return nrfx_timer_capture_get(&m_timer, NRF_TIMER_CC_CHANNEL0) -
+           nrfx_timer_capture(&m_timer, NRF_TIMER_CC_CHANNEL1);
+#endif
+}
+
+
+/**@brief Function for getting the number of SAMPLE tasks triggered since the schedule started. */
+static uint32_t counter_get(void)
+{
+    return nrfx_timer_capture(&m_counter, NRF_TIMER_CC_CHANNEL0);
+}
+
+
+/**@brief Function for connecting the channels enabled in a mask and disconnecting the others. */
+static void mask_write(uint8_t mask)
+{
+    for (uint8_t i = 0; i < m_cb.channel_count; i++)
+    {
+        uint8_t channel = m_cb.channels[i];
+
+        NRF_SAADC->CH[channel].PSELP = (mask & (1U << channel)) ? m_cb.pselp[channel] :
+                                                                 SAADC_CH_PSELP_PSELP_NC;
+    }
+}
+
+
+/**@brief Function for getting the longest time one scan of the frame channels can take.
+ *
+ * @details Counts the acquisition and conversion time of every channel in the frame, also
+ *          of the ones the schedule disconnected, times the oversampling in burst mode.
+ *          The registers are read on every call, because the acquisition time follows
+ *          the gain.
+ */
+static uint32_t multirate_scan_us_get(void)
+{
+    static const uint8_t tacq_us[] = {3, 5, 10, 15, 20, 40};
+
+    uint32_t scan_us = 0;
+
+    for (uint8_t i = 0; i < m_cb.channel_count; i++)
+    {
+        uint32_t config = NRF_SAADC->CH[m_cb.channels[i]].CONFIG;
+        uint32_t tacq   = (config & SAADC_CH_CONFIG_TACQ_Msk) >> SAADC_CH_CONFIG_TACQ_Pos;
+        uint32_t sample = tacq_us[MIN(tacq, ARRAY_SIZE(tacq_us) - 1)] + APP_SAADC_MULTIRATE_TCONV_US;
+
+        if (config & SAADC_CH_CONFIG_BURST_Msk)
+        {
+            sample <<= NRF_SAADC->OVERSAMPLE;
+        }
+        scan_us += sample;
+    }
+    return scan_us;
+}
+
+
+/**@brief Function for applying the changes of the multi-rate schedule that are due.
+ *
+ * @details Runs from the frame counter interrupt, which preempts the SAADC interrupt, so a
+ *          change is always recorded before the buffer holding its frame is split. The
+ *          change is written once the scan in progress has ended and enough time is left
+ *          before the next trigger. The counter is read around the write, so that a change
+ *          delayed past its frame, or hit by a trigger, is recorded as such.
+ *
+ *          The wait is bounded by the guard time plus the longest scan
+ *          (@ref multirate_scan_us_get), which is also the worst-case latency this interrupt
+ *          adds to the lower priorities, for each change due. With 8 channels at 40 us this is
+ *          up to about 0.4 ms, or 0.4 ms times the oversampling in burst mode. If the SAADC is
+ *          still busy after that, the change is written anyway and the stream is resynchronized.
+ */
+static void multirate_steps_run(void)
+{
+    app_saadc_multirate_step_t step;
+    uint32_t                   wait_us = APP_SAADC_MULTIRATE_GUARD_US + multirate_scan_us_get();
+
+    while (app_saadc_multirate_step_get(m_cb.p_multirate, &step))
+    {
+        if ((int32_t)(counter_get() - step.frame) < 0)
+        {
+            // The compare fires when the frame before the change is triggered.
+            nrfx_timer_compare(&m_counter, NRF_TIMER_CC_CHANNEL1, step.frame, true);
+            if ((int32_t)(counter_get() - step.frame) < 0)
+            {
+                return;
+            }
+        }
+
+        bool ready;
+        NRFX_WAIT_FOR((trigger_ticks_left() > APP_SAADC_MULTIRATE_GUARD_TICKS) &&
+                      !nrf_saadc_busy_check(),
+                      wait_us, 1, ready);
+
+        uint32_t frame = counter_get();
+        mask_write(step.mask);
+        bool ambiguous = !ready || (counter_get() != frame);
+
+        if (!app_saadc_multirate_step_done(m_cb.p_multirate, frame, ambiguous))
+        {
+            NRF_LOG_DEBUG("Multi-rate change hit frame %d, resynchronizing.", frame);
+            m_cb.resync_pending = true;
+        }
+    }
+}
+
+
+static void counter_evt_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if (event_type == NRF_TIMER_EVENT_COMPARE1)
+    {
+        multirate_steps_run();
+    }
+}
+
+
+/**@brief Function for initializing the frame counter of the multi-rate schedule.
+ *
+ * @param[in] trigger_evt_addr Address of the trigger event, counted through PPI.
+ */
+static ret_code_t multirate_init(uint32_t trigger_evt_addr)
+{
+    ret_code_t err_code;
+
+    // Changes must be recorded before the SAADC interrupt splits the buffer holding their frame.
+    if (APP_SAADC_MULTIRATE_CONFIG_IRQ_PRIORITY >= NVIC_GetPriority(SAADC_IRQn))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+#if (APP_SAADC_CONFIG_TRIGGER == APP_SAADC_TRIGGER_RTC)
+    uint32_t period_ticks = nrf_rtc_cc_get(m_rtc.p_reg, 0) + 1;
+#else
+    uint32_t period_ticks = nrfx_timer_capture_get(&m_timer, NRF_TIMER_CC_CHANNEL0);
+#endif
+    if (period_ticks <= 2 * APP_SAADC_MULTIRATE_GUARD_TICKS)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    nrfx_timer_config_t config = NRFX_TIMER_DEFAULT_CONFIG;
+    config.mode               = NRF_TIMER_MODE_COUNTER;
+    config.bit_width          = NRF_TIMER_BIT_WIDTH_32;
+    config.interrupt_priority = APP_SAADC_MULTIRATE_CONFIG_IRQ_PRIORITY;
+
+    err_code = nrfx_timer_init(&m_counter, &config, counter_evt_handler);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = nrfx_ppi_channel_alloc(&m_cb.ppi_count);
+    if (err_code != NRF_SUCCESS)
+    {
+        nrfx_timer_uninit(&m_counter);
+        return NRF_ERROR_NO_MEM;
+    }
+
+    APP_ERROR_CHECK(nrfx_ppi_channel_assign(m_cb.ppi_count,
+                                            trigger_evt_addr,
+                                            nrfx_timer_task_address_get(&m_counter,
+                                                                        NRF_TIMER_TASK_COUNT)));
+
+    // The driver connected the inputs of the active channels when the mode was set.
+    for (uint8_t channel = 0; channel < NRF_SAADC_CHANNEL_COUNT; channel++)
+    {
+        m_cb.pselp[channel] = NRF_SAADC->CH[channel].PSELP;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+static void multirate_uninit(void)
+{
+    (void)nrfx_ppi_channel_free(m_cb.ppi_count);
+    nrfx_timer_uninit(&m_counter);
+    mask_write(m_cb.p_multirate->channel_mask);
+}
+
+
+/**@brief Function for starting the schedule on frame 0, before the pacing is started. */
+static void multirate_start(void)
+{
+    app_saadc_multirate_step_t step;
+
+    mask_write(app_saadc_multirate_start(m_cb.p_multirate));
+    m_cb.frame_base     = 0;
+    m_cb.resync_pending = false;
+    m_cb.resync_armed   = false;
+
+    nrfx_timer_clear(&m_counter);
+    if (app_saadc_multirate_step_get(m_cb.p_multirate, &step))
+    {
+        nrfx_timer_compare(&m_counter, NRF_TIMER_CC_CHANNEL1, step.frame, true);
+    }
+    nrfx_timer_enable(&m_counter);
+    APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_cb.ppi_count));
+}
+
+
+/**@brief Function for holding the schedule changes, which wait for the trigger,
+ *        before the trigger is stopped.
+ */
+static void multirate_pause(void)
+{
+    nrfx_timer_compare_int_disable(&m_counter, NRF_TIMER_CC_CHANNEL1);
+}
+
+
+/**@brief Function for resynchronizing the scan stream in the gap after a buffer.
+ *
+ * @details The next buffer starts on the next frame counted, whatever happened to the
+ *          conversions triggered between the end of the last buffer and the gap.
+ */
+static void multirate_resync(void)
+{
+    m_cb.resync_armed = false;
+    m_cb.frame_base   = counter_get();
+    app_saadc_multirate_resync(m_cb.p_multirate, m_cb.frame_base);
+}
+#endif // NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+
+
+#if APP_SAADC_PWR_MGMT
+static bool m_saadc_suspended; ///< SAADC was disabled by the sleep policy.
+
+/**@brief Power handler of the SAADC, called by the sleep policy around a long sleep.
+ *
+ * @details The SAADC is required while an acquisition runs, so the handler is only called
+ *          between acquisitions. A conversion requested through @ref app_saadc_aux_request
+ *          or @ref app_saadc_calibrate can still be in progress, in which case the SAADC is
+ *          left enabled.
+ */
+static void saadc_power_handler(bool on)
+{
+    if (on)
+    {
+        if (m_saadc_suspended)
+        {
+            m_saadc_suspended = false;
+            nrf_saadc_enable();
+        }
+    }
+    else if (nrf_saadc_enable_check() && !nrf_saadc_busy_check())
+    {
+        nrf_saadc_disable();
+        m_saadc_suspended = true;
+    }
+}
+#endif
+
+
+/**@brief Function for marking the SAADC as required during sleep while sampling. */
+static void saadc_power_require(bool required)
+{
+#if APP_SAADC_PWR_MGMT
+    nrf_pwr_mgmt_periph_require(NRF_PWR_MGMT_PERIPH_SAADC, required);
+#else
+    UNUSED_PARAMETER(required);
+#endif
+}
+
+
+/**@brief Function for stopping the hardware pacing of the acquisition. */
+static void pacing_stop(void)
+{
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+    if (m_cb.p_multirate != NULL)
+    {
+        multirate_pause();
+        (void)nrfx_ppi_channel_disable(m_cb.ppi_count);
+    }
+#endif
+    trigger_stop();
+    (void)nrfx_ppi_channel_disable(m_cb.ppi_sample);
+    (void)nrfx_ppi_channel_disable(m_cb.ppi_restart);
+    if (m_cb.calib_running)
+    {
+        // Let the calibration end before the driver is stopped, it must not see CALIBRATEDONE.
+        (void)nrfx_ppi_channel_disable(m_cb.ppi_calib);
+        while (!nrf_saadc_event_check(NRF_SAADC_EVENT_CALIBRATEDONE))
+        {}
+        nrf_saadc_event_clear(NRF_SAADC_EVENT_CALIBRATEDONE);
+        m_cb.calib_running = false;
+    }
+    if (m_cb.p_deferred != NULL)
+    {
+        if (m_cb.p_pool != NULL)
+        {
+            nrf_balloc_free(m_cb.p_pool, m_cb.p_deferred);
+        }
+        m_cb.p_deferred = NULL;
+    }
+    if (m_cb.start_on_evt)
+    {
+        (void)nrfx_ppi_channel_disable(m_cb.ppi_start);
+        (void)nrfx_ppi_channel_free(m_cb.ppi_start);
+        m_cb.start_on_evt = false;
+    }
+    nrf_energy_phase_set(NRF_ENERGY_PHASE_SAADC, false);
+}
+
+
+/**@brief Function for getting the CONFIG register value of the auxiliary channel.
+ *
+ * @param[in] p_config Channel configuration of the request.
+ * @param[in] burst    Force burst mode, so that one SAMPLE task gives an oversampled result.
+ */
+static uint32_t aux_channel_config_get(nrf_saadc_channel_config_t const * p_config, bool burst)
+{
+    uint32_t burst_mode = burst ? (uint32_t)NRF_SAADC_BURST_ENABLED : (uint32_t)p_config->burst;
+
+    return (((uint32_t)p_config->resistor_p << SAADC_CH_CONFIG_RESP_Pos)   & SAADC_CH_CONFIG_RESP_Msk)   |
+           (((uint32_t)p_config->resistor_n << SAADC_CH_CONFIG_RESN_Pos)   & SAADC_CH_CONFIG_RESN_Msk)   |
+           (((uint32_t)p_config->gain       << SAADC_CH_CONFIG_GAIN_Pos)   & SAADC_CH_CONFIG_GAIN_Msk)   |
+           (((uint32_t)p_config->reference  << SAADC_CH_CONFIG_REFSEL_Pos) & SAADC_CH_CONFIG_REFSEL_Msk) |
+           (((uint32_t)p_config->acq_time   << SAADC_CH_CONFIG_TACQ_Pos)   & SAADC_CH_CONFIG_TACQ_Msk)   |
+           (((uint32_t)p_config->mode       << SAADC_CH_CONFIG_MODE_Pos)   & SAADC_CH_CONFIG_MODE_Msk)   |
+           ((burst_mode                     << SAADC_CH_CONFIG_BURST_Pos)  & SAADC_CH_CONFIG_BURST_Msk);
+}
+
+
+/**@brief Function for converting the queued auxiliary requests.
+ *
+ * @details Must be called while the SAADC is enabled and not converting. The acquisition
+ *          channels are disconnected and the auxiliary channel converts each request into
+ *          @p p_results. The result buffer latched for the acquisition is restored afterwards,
+ *          and the events of these conversions are cleared so that the driver does not see them.
+ *
+ * @param[out] p_results Result of each request, in queue order.
+ *
+ * @return Number of requests converted.
+ */
+static uint8_t aux_convert(nrf_saadc_value_t * p_results)
+{
+    uint32_t pselp[NRF_SAADC_CHANNEL_COUNT];
+    uint32_t ptr    = NRF_SAADC->RESULT.PTR;
+    uint32_t maxcnt = NRF_SAADC->RESULT.MAXCNT;
+    bool     burst  = (NRF_SAADC->OVERSAMPLE != 0);
+    uint8_t  count  = m_cb.aux_count;
+
+    for (uint8_t channel = 0; channel < NRF_SAADC_CHANNEL_COUNT; channel++)
+    {
+        pselp[channel]                = NRF_SAADC->CH[channel].PSELP;
+        NRF_SAADC->CH[channel].PSELP = SAADC_CH_PSELP_PSELP_NC;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        app_saadc_aux_request_t const * p_request = &m_aux_queue[i];
+
+        NRF_SAADC->CH[APP_SAADC_CONFIG_AUX_CHANNEL].CONFIG =
+            aux_channel_config_get(&p_request->config, burst);
+        NRF_SAADC->CH[APP_SAADC_CONFIG_AUX_CHANNEL].PSELN = p_request->pin_n;
+        NRF_SAADC->CH[APP_SAADC_CONFIG_AUX_CHANNEL].PSELP = p_request->pin_p;
+        NRF_SAADC->RESULT.PTR    = (uint32_t)&p_results[i];
+        NRF_SAADC->RESULT.MAXCNT = 1;
+
+        nrf_saadc_event_clear(NRF_SAADC_EVENT_STARTED);
+        nrf_saadc_task_trigger(NRF_SAADC_TASK_START);
+        while (!nrf_saadc_event_check(NRF_SAADC_EVENT_STARTED))
+        {}
+
+        nrf_saadc_event_clear(NRF_SAADC_EVENT_END);
+        nrf_saadc_task_trigger(NRF_SAADC_TASK_SAMPLE);
+        while (!nrf_saadc_event_check(NRF_SAADC_EVENT_END))
+        {}
+    }
+
+    NRF_SAADC->CH[APP_SAADC_CONFIG_AUX_CHANNEL].PSELP = SAADC_CH_PSELP_PSELP_NC;
+    for (uint8_t channel = 0; channel < NRF_SAADC_CHANNEL_COUNT; channel++)
+    {
+        NRF_SAADC->CH[channel].PSELP = pselp[channel];
+    }
+    NRF_SAADC->RESULT.PTR    = ptr;
+    NRF_SAADC->RESULT.MAXCNT = maxcnt;
+
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_STARTED);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_END);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_DONE);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_RESULTDONE);
+
+    return count;
+}
+
+
+/**@brief Function for removing the converted requests from the queue and calling their handlers.
+ *
+ * @param[in] p_results Result of each request, as given by @ref aux_convert.
+ * @param[in] count     Number of converted requests.
+ */
+static void aux_complete(nrf_saadc_value_t const * p_results, uint8_t count)
+{
+    app_saadc_aux_request_t done[APP_SAADC_CONFIG_AUX_REQUESTS];
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Requests may be queued from a higher priority while the handlers run.
+    CRITICAL_REGION_ENTER();
+    memcpy(done, m_aux_queue, count * sizeof(done[0]));
+    memmove(m_aux_queue, &m_aux_queue[count], (m_cb.aux_count - count) * sizeof(m_aux_queue[0]));
+    m_cb.aux_count -= count;
+    CRITICAL_REGION_EXIT();
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        done[i].handler(p_results[i], m_cb.resolution_bits, done[i].p_context);
+    }
+}
+
+
+/**@brief Function for converting the queued auxiliary requests while no acquisition runs. */
+static void aux_idle_run(void)
+{
+    nrf_saadc_value_t results[APP_SAADC_CONFIG_AUX_REQUESTS];
+    uint8_t           count;
+
+    CRITICAL_REGION_ENTER();
+    bool enabled = nrf_saadc_enable_check();
+    if (!enabled)
+    {
+        nrf_saadc_enable();
+    }
+
+    // The result is reported at the resolution of the acquisition, which may not have been
+    // started yet.
+    NRF_SAADC->RESOLUTION = (uint32_t)(m_cb.resolution_bits - 8) / 2;
+
+    count = aux_convert(results);
+    if (count > 0)
+    {
+        nrf_saadc_task_trigger(NRF_SAADC_TASK_STOP);
+        while (!nrf_saadc_event_check(NRF_SAADC_EVENT_STOPPED))
+        {}
+        nrf_saadc_event_clear(NRF_SAADC_EVENT_STOPPED);
+    }
+
+    if (!enabled)
+    {
+        nrf_saadc_disable();
+    }
+    CRITICAL_REGION_EXIT();
+
+    aux_complete(results, count);
+}
+
+
+/**@brief Function for calibrating the offset while no acquisition runs.
+ *
+ * @details The calibration is run on the registers rather than through the driver. The
+ *          blocking calibration of the driver leaves it in a state in which no buffer can be
+ *          set, so the next acquisition could not start.
+ */
+static void calib_idle_run(void)
+{
+    CRITICAL_REGION_ENTER();
+    bool enabled = nrf_saadc_enable_check();
+    if (!enabled)
+    {
+        nrf_saadc_enable();
+    }
+
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_CALIBRATEDONE);
+    nrf_saadc_task_trigger(NRF_SAADC_TASK_CALIBRATEOFFSET);
+    while (!nrf_saadc_event_check(NRF_SAADC_EVENT_CALIBRATEDONE))
+    {}
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_CALIBRATEDONE);
+
+    if (!enabled)
+    {
+        nrf_saadc_disable();
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+
+/**@brief Function for taking the new time reference and releasing the multi-rate schedule
+ *        once sampling has resumed after a gap.
+ */
+static void gap_slot_resume(void)
+{
+    m_cb.ref_ticks = app_timer_cnt_get();
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+    if (m_cb.p_multirate != NULL)
+    {
+        // Changes that came due in the gap are applied now, on the running trigger.
+        nrfx_timer_compare_int_enable(&m_counter, NRF_TIMER_CC_CHANNEL1);
+    }
+#endif
+}
+
+
+/**@brief Function for converting auxiliary requests and calibrating the offset in the gap
+ *        between two buffers.
+ *
+ * @details Called on the END of the last buffer before the gap. The next buffer is already
+ *          latched, but the SAADC is not restarted and the pacing is halted, so no conversion
+ *          of the acquisition is requested in the gap. Sampling resumes with a new time
+ *          reference, so the timestamp of the next buffer accounts for the gap.
+ *
+ *          The calibration is not waited for. Its CALIBRATEDONE event starts the SAADC and
+ *          the trigger through PPI, and the gap is closed by @ref gap_calib_finish on the
+ *          buffer request that the driver makes on the STARTED event that follows. Buffers
+ *          supplied before that are held back, as setting one would latch it over the buffer
+ *          the SAADC is restarted on.
+ */
+static void gap_slot_run(void)
+{
+    nrf_saadc_value_t results[APP_SAADC_CONFIG_AUX_REQUESTS];
+    uint8_t           count = 0;
+
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+    if (m_cb.p_multirate != NULL)
+    {
+        multirate_pause();
+    }
+#endif
+    trigger_stop();
+    trigger_clear();
+
+    // Restarted below, so the sample times no longer follow from the start event.
+    if (m_cb.start_on_evt)
+    {
+        (void)nrfx_ppi_channel_disable(m_cb.ppi_start);
+    }
+    m_cb.start_aligned = false;
+
+    if (m_cb.aux_armed)
+    {
+        m_cb.aux_armed = false;
+        count          = aux_convert(results);
+    }
+
+    APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_cb.ppi_restart));
+    m_cb.frames_done = 0;
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+    if (m_cb.p_multirate != NULL)
+    {
+        multirate_resync();
+    }
+#endif
+
+    if (m_cb.calib_armed)
+    {
+        m_cb.calib_armed   = false;
+        m_cb.calib_running = true;
+
+        nrf_saadc_event_clear(NRF_SAADC_EVENT_CALIBRATEDONE);
+        APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_cb.ppi_calib));
+        nrf_saadc_task_trigger(NRF_SAADC_TASK_CALIBRATEOFFSET);
+    }
+    else
+    {
+        nrf_saadc_task_trigger(NRF_SAADC_TASK_START);
+        trigger_start();
+        gap_slot_resume();
+    }
+
+    aux_complete(results, count);
+}
+
+
+/**@brief Function for handing a pool buffer over to the driver. */
+static ret_code_t pool_buffer_queue(nrf_saadc_value_t * p_buffer)
+{
+    ret_code_t err_code = nrfx_saadc_buffer_set(p_buffer, m_cb.buffer_size);
+    if (err_code == NRF_SUCCESS)
+    {
+        app_saadc_bench_buffer_set();
+        m_cb.p_queued[m_cb.queued_count++] = p_buffer;
+        if (m_cb.burst_limited)
+        {
+            m_cb.burst_left--;
+        }
+    }
+    return err_code;
+}
+
+
+/**@brief Function for closing a calibration gap once the SAADC was restarted by CALIBRATEDONE.
+ *
+ * @details Called on the buffer request that the driver makes from the STARTED event. The
+ *          driver handles STARTED before it checks CALIBRATEDONE, so the event is cleared
+ *          before the driver can take it for the end of a calibration of its own.
+ *
+ * @retval true  If a buffer supplied during the gap was handed over to the driver.
+ * @retval false If the buffer request is still to be served.
+ */
+static bool gap_calib_finish(void)
+{
+    (void)nrfx_ppi_channel_disable(m_cb.ppi_calib);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_CALIBRATEDONE);
+    m_cb.calib_running = false;
+    gap_slot_resume();
+
+    nrf_saadc_value_t * p_buffer = m_cb.p_deferred;
+    if (p_buffer == NULL)
+    {
+        return false;
+    }
+    m_cb.p_deferred = NULL;
+
+    if (m_cb.p_pool != NULL)
+    {
+        if (pool_buffer_queue(p_buffer) != NRF_SUCCESS)
+        {
+            nrf_balloc_free(m_cb.p_pool, p_buffer);
+            return false;
+        }
+    }
+    else
+    {
+        if (nrfx_saadc_buffer_set(p_buffer, m_cb.deferred_size) != NRF_SUCCESS)
+        {
+            return false;
+        }
+        app_saadc_bench_buffer_set();
+    }
+    return true;
+}
+
+
+/**@brief Function for taking a buffer from the pool and handing it over to the driver.
+ *
+ * @retval NRF_SUCCESS      If the buffer was handed over.
+ * @retval NRF_ERROR_NO_MEM If the pool is empty.
+ */
+static ret_code_t pool_buffer_supply(void)
+{
+    nrf_saadc_value_t * p_buffer = nrf_balloc_alloc(m_cb.p_pool);
+    if (p_buffer == NULL)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    ret_code_t err_code = pool_buffer_queue(p_buffer);
+    if (err_code != NRF_SUCCESS)
+    {
+        nrf_balloc_free(m_cb.p_pool, p_buffer);
+    }
+    return err_code;
+}
+
+
+/**@brief Function for removing the oldest buffer from the list of buffers held by the driver. */
+static void pool_buffer_dequeue(void)
+{
+    if (m_cb.queued_count > 0)
+    {
+        m_cb.p_queued[0] = m_cb.p_queued[1];
+        m_cb.queued_count--;
+    }
+}
+
+
+/**@brief Function for returning buffers that the driver dropped on stop back to the pool. */
+static void pool_flush(void)
+{
+    while (m_cb.queued_count > 0)
+    {
+        nrf_balloc_free(m_cb.p_pool, m_cb.p_queued[0]);
+        pool_buffer_dequeue();
+    }
+    m_cb.buf_req_pending = false;
+    m_cb.restart_held    = false;
+}
+
+
+/**@brief Function for handing the first buffers of an acquisition over to the driver.
+ *
+ * @retval NRF_SUCCESS      If at least one buffer was handed over.
+ * @retval NRF_ERROR_NO_MEM If the pool is empty.
+ */
+static ret_code_t pool_prime(void)
+{
+    for (uint32_t i = 0; i < APP_SAADC_DRIVER_BUFFERS; i++)
+    {
+        if ((m_cb.burst_limited && (m_cb.burst_left == 0)) ||
+            (pool_buffer_supply() != NRF_SUCCESS))
+        {
+            break;
+        }
+    }
+
+    return (m_cb.queued_count > 0) ? NRF_SUCCESS : NRF_ERROR_NO_MEM;
+}
+
+
+/**@brief Gain multiplied by 60, indexed by @ref nrf_saadc_gain_t. */
+static const uint8_t m_gain_x60[] = {10, 12, 15, 20, 30, 60, 120, 240};
+
+
+/**@brief Function for reading the gain of a SAADC channel. */
+static nrf_saadc_gain_t channel_gain_get(uint8_t channel)
+{
+    return (nrf_saadc_gain_t)((NRF_SAADC->CH[channel].CONFIG & SAADC_CH_CONFIG_GAIN_Msk) >>
+                              SAADC_CH_CONFIG_GAIN_Pos);
+}
+
+
+/**@brief Function for changing the gain of a SAADC channel.
+ *
+ * @details The new gain applies from the next conversion, so sampling is not interrupted.
+ *          If an acquisition time was calibrated for the channel at the new gain, it is
+ *          set with it.
+ */
+static void channel_gain_set(uint8_t channel, nrf_saadc_gain_t gain)
+{
+    uint32_t config = NRF_SAADC->CH[channel].CONFIG;
+    config &= ~SAADC_CH_CONFIG_GAIN_Msk;
+    config |= ((uint32_t)gain << SAADC_CH_CONFIG_GAIN_Pos) & SAADC_CH_CONFIG_GAIN_Msk;
+#if NRF_MODULE_ENABLED(APP_SAADC_ACQTIME)
+    nrf_saadc_acqtime_t acq_time;
+    if (app_saadc_acqtime_get(channel, gain, &acq_time))
+    {
+        config &= ~SAADC_CH_CONFIG_TACQ_Msk;
+        config |= ((uint32_t)acq_time << SAADC_CH_CONFIG_TACQ_Pos) & SAADC_CH_CONFIG_TACQ_Msk;
+    }
+#endif
+    NRF_SAADC->CH[channel].CONFIG = config;
+}
+
+
+/**@brief Function for getting the largest magnitude a channel can report without clipping. */
+static int32_t channel_full_scale_get(uint8_t channel)
+{
+    bool differential = (NRF_SAADC->CH[channel].CONFIG & SAADC_CH_CONFIG_MODE_Msk) ==
+                        (SAADC_CH_CONFIG_MODE_Diff << SAADC_CH_CONFIG_MODE_Pos);
+
+    return differential ? (1L << (m_cb.resolution_bits - 1)) : (1L << m_cb.resolution_bits);
+}
+
+
+/**@brief Function for adjusting the channel gains to the signal level in a filled buffer.
+ *
+ * @details The gain is lowered one step when the peak exceeds 7/8 of full scale, and raised
+ *          one step when the peak at the higher gain would stay below 3/4 of full scale.
+ *          Buffers that were partly converted with a previous gain are not evaluated.
+ *          The gains reported with the buffer are latched before any change.
+ */
+static void autorange_update(nrf_saadc_value_t const * p_buffer, uint16_t size)
+{
+    uint8_t transition = m_cb.gain_transition;
+
+    memcpy(m_cb.gains_reported, m_cb.gains, sizeof(m_cb.gains_reported));
+    m_cb.gain_transition = 0;
+
+    for (uint8_t i = 0; i < m_cb.channel_count; i++)
+    {
+        if (transition & (1U << i))
+        {
+            continue;
+        }
+
+        int32_t peak = 0;
+        for (uint16_t idx = i; idx < size; idx += m_cb.channel_count)
+        {
+            int32_t value = (p_buffer[idx] < 0) ? -p_buffer[idx] : p_buffer[idx];
+            if (value > peak)
+            {
+                peak = value;
+            }
+        }
+
+        int32_t          full_scale = channel_full_scale_get(m_cb.channels[i]);
+        nrf_saadc_gain_t gain       = m_cb.gains[i];
+
+        if ((peak * 8 > full_scale * 7) && (gain > NRF_SAADC_GAIN1_6))
+        {
+            gain = (nrf_saadc_gain_t)(gain - 1);
+        }
+        else if ((gain < NRF_SAADC_GAIN4) &&
+                 (peak * m_gain_x60[gain + 1] * 4 < full_scale * m_gain_x60[gain] * 3))
+        {
+            gain = (nrf_saadc_gain_t)(gain + 1);
+        }
+
+        if (gain != m_cb.gains[i])
+        {
+            channel_gain_set(m_cb.channels[i], gain);
+            m_cb.gains[i]         = gain;
+            m_cb.gain_transition |= (1U << i);
+        }
+    }
+}
+
+
+/**@brief Function for getting the time of the first sample in a filled buffer.
+ *
+ * @details The first SAMPLE task of a buffer is triggered one period after the END event of
+ *          the previous buffer, or after the pacing was started. The reference is taken again
+ *          on every END event, so the trigger and app_timer clocks only have to agree over one
+ *          period and the error does not build up over the acquisition.
+ *
+ * @param[in] end_ticks app_timer counter value at the END event of the buffer, which becomes
+ *                      the reference of the next one.
+ *
+ * @return Time of the first sample in app_timer ticks.
+ */
+static uint32_t buffer_timestamp_get(uint32_t end_ticks)
+{
+    uint32_t const freq  = APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1);
+    uint32_t const ticks = (uint32_t)(((uint64_t)m_cb.period_ns * freq) / 1000000000ULL);
+    uint32_t const first = (m_cb.ref_ticks + ticks) & APP_TIMER_MAX_CNT_VAL;
+
+    m_cb.ref_ticks = end_ticks;
+    return first;
+}
+
+
+/**@brief Function for getting the time of a sample frame after the start event.
+ *
+ * @param[in] frame Index of the frame since the pacing was started.
+ *
+ * @return Time of the frame in nanoseconds, or UINT64_MAX if it does not follow from the
+ *         start event given in @ref app_saadc_start_at.
+ */
+static uint64_t frame_start_offset_get(uint64_t frame)
+{
+    return m_cb.start_aligned ? (frame + 1) * m_cb.period_ns : UINT64_MAX;
+}
+
+
+/**@brief Function for programming or clearing the monitor limits on all configured channels. */
+static void monitor_limits_apply(bool enable)
+{
+    for (uint8_t channel = 0; channel < NRF_SAADC_CHANNEL_COUNT; channel++)
+    {
+        if (m_cb.monitor.limit_mask & (1UL << channel))
+        {
+            int16_t low  = enable ? m_cb.monitor.limit_low[channel]  : INT16_MIN;
+            int16_t high = enable ? m_cb.monitor.limit_high[channel] : INT16_MAX;
+            APP_ERROR_CHECK(nrfx_saadc_limits_set(channel, low, high));
+        }
+    }
+}
+
+
+/**@brief Function for starting the conversions on the buffers already handed to the driver.
+ *
+ * @details The driver latches the first buffer and reports NRFX_SAADC_EVT_READY,
+ *          on which the pacing is started.
+ */
+static ret_code_t conversions_start(app_saadc_state_t state)
+{
+    m_cb.state = state;
+    saadc_power_require(true);
+
+    ret_code_t err_code = nrfx_saadc_mode_trigger();
+    if (err_code != NRF_SUCCESS)
+    {
+        if (m_cb.p_pool != NULL)
+        {
+            pool_flush();
+        }
+        m_cb.history_active = false;
+        m_cb.state          = APP_SAADC_STATE_IDLE;
+        saadc_power_require(false);
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for sampling at the monitor rate into the history ring.
+ *
+ * @details The history buffer is given to the driver as both the current and the next
+ *          buffer, so the END to START connection makes it wrap around in hardware.
+ *          The CPU wakes up once per ring round, or on a limit crossing.
+ */
+static ret_code_t monitor_enter(void)
+{
+    ret_code_t err_code = trigger_interval_set(m_cb.monitor.monitor_interval_us, &m_cb.period_ns);
+    VERIFY_SUCCESS(err_code);
+
+    for (uint32_t i = 0; i < APP_SAADC_DRIVER_BUFFERS; i++)
+    {
+        err_code = nrfx_saadc_buffer_set(m_cb.monitor.p_history, m_cb.monitor.history_size);
+        VERIFY_SUCCESS(err_code);
+    }
+
+    m_cb.monitor_rounds = 0;
+    m_cb.history_active = true;
+    m_cb.burst_limited  = false;
+    monitor_limits_apply(true);
+
+    return conversions_start(APP_SAADC_STATE_MONITOR);
+}
+
+
+/**@brief Function for reporting the pre-trigger history and starting the burst capture. */
+static void burst_enter(void)
+{
+    app_saadc_evt_t evt;
+    uint16_t        size = m_cb.monitor.history_size;
+
+    evt.type                       = APP_SAADC_EVT_TRIGGERED;
+    evt.data.triggered.p_history   = m_cb.monitor.p_history;
+    evt.data.triggered.limit       = m_cb.trigger_limit;
+    if (m_cb.monitor_rounds > 0)
+    {
+        evt.data.triggered.size   = size;
+        evt.data.triggered.oldest = (m_cb.history_pos < size) ? m_cb.history_pos : 0;
+    }
+    else
+    {
+        evt.data.triggered.size   = m_cb.history_pos;
+        evt.data.triggered.oldest = 0;
+    }
+
+    m_cb.history_active = false;
+    m_cb.burst_limited  = (m_cb.monitor.burst_buffers != 0);
+    m_cb.burst_left     = m_cb.monitor.burst_buffers;
+    m_cb.state         = APP_SAADC_STATE_RUNNING;
+    APP_ERROR_CHECK(trigger_interval_set(m_cb.monitor.burst_interval_us, &m_cb.period_ns));
+
+    // Without a pool, the handler provides the first burst buffers.
+    m_cb.evt_handler(&evt);
+
+    ret_code_t err_code = NRF_SUCCESS;
+    if (m_cb.p_pool != NULL)
+    {
+        err_code = pool_prime();
+    }
+    if (err_code == NRF_SUCCESS)
+    {
+        err_code = conversions_start(APP_SAADC_STATE_RUNNING);
+    }
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_WARNING("Burst capture not started, no buffer available.");
+        m_cb.state = APP_SAADC_STATE_IDLE;
+        saadc_power_require(false);
+        evt.type   = APP_SAADC_EVT_STOPPED;
+        m_cb.evt_handler(&evt);
+    }
+}
+
+
+/**@brief Function for handling the end of the conversions reported by the driver. */
+static void finished_handle(void)
+{
+    app_saadc_evt_t evt;
+
+    // The SAADC is stopped, serve requests that did not get a gap.
+    m_cb.aux_armed = false;
+    if (m_cb.aux_count > 0)
+    {
+        aux_idle_run();
+    }
+
+    switch (m_cb.state)
+    {
+        case APP_SAADC_STATE_TRIGGERED:
+            // Monitor sampling is stopped and the history position is known.
+            burst_enter();
+            return;
+
+        case APP_SAADC_STATE_RUNNING:
+            pacing_stop();
+            if (m_cb.p_pool != NULL)
+            {
+                pool_flush();
+            }
+            if (m_cb.burst_limited && (m_cb.burst_left == 0))
+            {
+                // Burst capture completed, watch the limits again.
+                if (monitor_enter() == NRF_SUCCESS)
+                {
+                    evt.type = APP_SAADC_EVT_REARMED;
+                    m_cb.evt_handler(&evt);
+                    return;
+                }
+            }
+            else
+            {
+                // The driver ran out of buffers before stop was requested.
+                NRF_LOG_WARNING("Acquisition stopped, no buffer available.");
+                if (m_cb.p_pool == NULL)
+                {
+                    // Counted on the buffer request when a pool is used.
+                    app_saadc_bench_buffer_dropped();
+                }
+            }
+            break;
+
+        default:
+            pacing_stop();
+            if (m_cb.p_pool != NULL)
+            {
+                pool_flush();
+            }
+            break;
+    }
+
+    m_cb.history_active = false;
+    m_cb.calib_pending  = false;
+    m_cb.calib_armed    = false;
+    m_cb.state          = APP_SAADC_STATE_IDLE;
+    saadc_power_require(false);
+    evt.type            = APP_SAADC_EVT_STOPPED;
+    m_cb.evt_handler(&evt);
+}
+
+
+static void saadc_evt_handler(nrfx_saadc_evt_t const * p_event)
+{
+    app_saadc_evt_t evt;
+
+    app_saadc_bench_evt_enter(p_event->type);
+
+    switch (p_event->type)
+    {
+        case NRFX_SAADC_EVT_READY:
+            // First buffer is latched, start pacing the conversions.
+            APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_cb.ppi_restart));
+            APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_cb.ppi_sample));
+            m_cb.frames_done = 0;
+            m_cb.ref_ticks   = app_timer_cnt_get();
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+            if (m_cb.p_multirate != NULL)
+            {
+                multirate_start();
+            }
+#endif
+            nrf_energy_phase_set(NRF_ENERGY_PHASE_SAADC, true);
+            if (m_cb.start_on_evt)
+            {
+                // The start event starts the trigger in hardware.
+                trigger_stop();
+                trigger_clear();
+                APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_cb.ppi_start));
+            }
+            else
+            {
+                trigger_start();
+            }
+            break;
+
+        case NRFX_SAADC_EVT_BUF_REQ:
+            if (m_cb.calib_running && gap_calib_finish())
+            {
+                break;
+            }
+            if (m_cb.state == APP_SAADC_STATE_MONITOR)
+            {
+                // Keep the history ring wrapping around.
+                APP_ERROR_CHECK(nrfx_saadc_buffer_set(m_cb.monitor.p_history,
+                                                      m_cb.monitor.history_size));
+                break;
+            }
+            if (m_cb.state != APP_SAADC_STATE_RUNNING)
+            {
+                break;
+            }
+            if (m_cb.burst_limited && (m_cb.burst_left == 0))
+            {
+                // The last buffer of the burst is being filled, do not restart after it.
+                (void)nrfx_ppi_channel_disable(m_cb.ppi_restart);
+                break;
+            }
+            if (m_cb.calib_pending || (m_cb.aux_count > 0) || m_cb.resync_pending)
+            {
+                // Calibrate, convert the auxiliary requests or resynchronize the multi-rate
+                // scan stream in the gap after the buffer being filled.
+                m_cb.calib_armed    = m_cb.calib_pending;
+                m_cb.calib_pending  = false;
+                m_cb.aux_armed      = (m_cb.aux_count > 0);
+                m_cb.resync_armed   = m_cb.resync_pending;
+                m_cb.resync_pending = false;
+                (void)nrfx_ppi_channel_disable(m_cb.ppi_restart);
+            }
+            if (m_cb.p_pool == NULL)
+            {
+                evt.type = APP_SAADC_EVT_BUF_REQ;
+                m_cb.evt_handler(&evt);
+            }
+            else if (pool_buffer_supply() != NRF_SUCCESS)
+            {
+                // Restarting on the END would overwrite the buffer handed to the application.
+                // If a buffer is returned through app_saadc_buffer_release() before the END,
+                // sampling resumes in a gap after it. Otherwise the acquisition stops.
+                (void)nrfx_ppi_channel_disable(m_cb.ppi_restart);
+                m_cb.restart_held    = true;
+                m_cb.buf_req_pending = true;
+                m_cb.overruns++;
+                app_saadc_bench_buffer_dropped();
+            }
+            break;
+
+        case NRFX_SAADC_EVT_DONE:
+        {
+            // Read first, the driver reports the buffer from the END interrupt.
+            uint32_t end_ticks = app_timer_cnt_get();
+            bool     gap;
+
+            if (m_cb.history_active)
+            {
+                // History ring is not delivered as data.
+                if (m_cb.state == APP_SAADC_STATE_TRIGGERED)
+                {
+                    m_cb.history_pos = p_event->data.done.size;
+                }
+                else
+                {
+                    m_cb.monitor_rounds++;
+                }
+                break;
+            }
+            if (m_cb.p_pool != NULL)
+            {
+                pool_buffer_dequeue();
+            }
+            nrf_energy_samples_add(p_event->data.done.size);
+            evt.type                       = APP_SAADC_EVT_DONE;
+            evt.data.done.p_buffer         = p_event->data.done.p_buffer;
+            evt.data.done.size             = p_event->data.done.size;
+            evt.data.done.timestamp        = buffer_timestamp_get(end_ticks);
+            evt.data.done.start_offset_ns  = frame_start_offset_get(m_cb.frames_done);
+            evt.data.done.sample_period_ns = m_cb.period_ns;
+            evt.data.done.p_gains          = NULL;
+            evt.data.done.gain_transition  = 0;
+            m_cb.frames_done              += p_event->data.done.size / m_cb.channel_count;
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+            if (m_cb.p_multirate != NULL)
+            {
+                // Frames of the scan stream differ in size, count the buffer on the frame counter.
+                uint64_t frame = app_saadc_multirate_frame_get(m_cb.p_multirate) - m_cb.frame_base;
+
+                evt.data.done.start_offset_ns = frame_start_offset_get(frame);
+                app_saadc_multirate_process(m_cb.p_multirate,
+                                            evt.data.done.p_buffer,
+                                            evt.data.done.size);
+            }
+#endif
+            gap = m_cb.calib_armed || m_cb.aux_armed || m_cb.resync_armed || m_cb.restart_held;
+            if (m_cb.restart_held)
+            {
+                // Without a buffer returned in time, the driver finishes after this one.
+                m_cb.restart_held = false;
+                gap               = (m_cb.queued_count > 0);
+            }
+            if (gap && (m_cb.state == APP_SAADC_STATE_RUNNING))
+            {
+                gap_slot_run();
+            }
+            if (m_cb.autorange)
+            {
+                evt.data.done.gain_transition = m_cb.gain_transition;
+                autorange_update(evt.data.done.p_buffer, evt.data.done.size);
+                evt.data.done.p_gains = m_cb.gains_reported;
+            }
+#if NRF_MODULE_ENABLED(APP_SAADC_FILTER)
+            if (m_cb.p_filter != NULL)
+            {
+                evt.data.done.sample_period_ns *= m_cb.p_filter->decimation;
+                evt.data.done.size = app_saadc_filter_process(m_cb.p_filter,
+                                                              evt.data.done.p_buffer,
+                                                              evt.data.done.size);
+            }
+#endif
+            m_cb.evt_handler(&evt);
+            break;
+        }
+
+        case NRFX_SAADC_EVT_LIMIT:
+            if (m_cb.state == APP_SAADC_STATE_MONITOR)
+            {
+                // Stop the monitor sampling, the burst capture starts when the driver finishes.
+                m_cb.state         = APP_SAADC_STATE_TRIGGERED;
+                m_cb.trigger_limit = p_event->data.limit;
+                monitor_limits_apply(false);
+                pacing_stop();
+                app_saadc_bench_abort();
+                nrfx_saadc_abort();
+                break;
+            }
+            if (m_cb.state == APP_SAADC_STATE_RUNNING)
+            {
+                evt.type       = APP_SAADC_EVT_LIMIT;
+                evt.data.limit = p_event->data.limit;
+                m_cb.evt_handler(&evt);
+            }
+            break;
+
+        case NRFX_SAADC_EVT_FINISHED:
+            finished_handle();
+            break;
+
+        default:
+            break;
+    }
+
+    app_saadc_bench_evt_exit();
+}
+
+
+ret_code_t app_saadc_init(app_saadc_config_t const * p_config, app_saadc_evt_handler_t evt_handler)
+{
+    ASSERT(p_config);
+    ASSERT(evt_handler);
+
+    ret_code_t err_code;
+    uint32_t   trigger_evt_addr;
+    uint32_t   trigger_fork_addr;
+
+    if (m_cb.state != APP_SAADC_STATE_UNINITIALIZED)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if ((p_config->p_buffer_pool != NULL) &&
+        ((p_config->buffer_size == 0) ||
+         (p_config->buffer_size * sizeof(nrf_saadc_value_t) >
+          NRF_BALLOC_ELEMENT_SIZE(p_config->p_buffer_pool))))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+#if !NRF_MODULE_ENABLED(APP_SAADC_FILTER)
+    ASSERT(p_config->p_filter == NULL);
+#endif
+
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+    // Filter and auto-ranging work on frames of all channels.
+    if ((p_config->p_multirate != NULL) &&
+        ((p_config->p_multirate->channel_mask != p_config->channel_mask) ||
+         (p_config->p_filter != NULL) ||
+         p_config->autorange))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+#else
+    ASSERT(p_config->p_multirate == NULL);
+#endif
+
+    if (p_config->channel_mask & (1UL << APP_SAADC_CONFIG_AUX_CHANNEL))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    nrfx_saadc_adv_config_t adv_config = NRFX_SAADC_DEFAULT_ADV_CONFIG;
+    adv_config.oversampling = p_config->oversampling;
+    adv_config.burst        = p_config->burst;
+    // Restarting on END is done in hardware, through PPI.
+    adv_config.start_on_end = false;
+
+    err_code = nrfx_saadc_advanced_mode_set(p_config->channel_mask,
+                                            p_config->resolution,
+                                            &adv_config,
+                                            saadc_evt_handler);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = trigger_init(&trigger_evt_addr, &trigger_fork_addr);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = trigger_interval_set(p_config->sample_interval_us, &m_cb.period_ns);
+    if (err_code != NRF_SUCCESS)
+    {
+        trigger_uninit();
+        return err_code;
+    }
+    m_cb.sample_interval_us = p_config->sample_interval_us;
+
+    err_code = nrfx_ppi_channel_alloc(&m_cb.ppi_sample);
+    if (err_code != NRF_SUCCESS)
+    {
+        trigger_uninit();
+        return NRF_ERROR_NO_MEM;
+    }
+
+    err_code = nrfx_ppi_channel_alloc(&m_cb.ppi_restart);
+    if (err_code != NRF_SUCCESS)
+    {
+        (void)nrfx_ppi_channel_free(m_cb.ppi_sample);
+        trigger_uninit();
+        return NRF_ERROR_NO_MEM;
+    }
+
+    err_code = nrfx_ppi_channel_alloc(&m_cb.ppi_calib);
+    if (err_code != NRF_SUCCESS)
+    {
+        (void)nrfx_ppi_channel_free(m_cb.ppi_restart);
+        (void)nrfx_ppi_channel_free(m_cb.ppi_sample);
+        trigger_uninit();
+        return NRF_ERROR_NO_MEM;
+    }
+
+    APP_ERROR_CHECK(nrfx_ppi_channel_assign(m_cb.ppi_sample,
+                                            trigger_evt_addr,
+                                            nrf_saadc_task_address_get(NRF_SAADC_TASK_SAMPLE)));
+    if (trigger_fork_addr != 0)
+    {
+        APP_ERROR_CHECK(nrfx_ppi_channel_fork_assign(m_cb.ppi_sample, trigger_fork_addr));
+    }
+
+    APP_ERROR_CHECK(nrfx_ppi_channel_assign(m_cb.ppi_restart,
+                                            nrf_saadc_event_address_get(NRF_SAADC_EVENT_END),
+                                            nrf_saadc_task_address_get(NRF_SAADC_TASK_START)));
+
+    APP_ERROR_CHECK(nrfx_ppi_channel_assign(m_cb.ppi_calib,
+                                            nrf_saadc_event_address_get(NRF_SAADC_EVENT_CALIBRATEDONE),
+                                            nrf_saadc_task_address_get(NRF_SAADC_TASK_START)));
+    APP_ERROR_CHECK(nrfx_ppi_channel_fork_assign(m_cb.ppi_calib, trigger_start_task_address_get()));
+
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+    if (p_config->p_multirate != NULL)
+    {
+        err_code = multirate_init(trigger_evt_addr);
+        if (err_code != NRF_SUCCESS)
+        {
+            (void)nrfx_ppi_channel_free(m_cb.ppi_calib);
+            (void)nrfx_ppi_channel_free(m_cb.ppi_restart);
+            (void)nrfx_ppi_channel_free(m_cb.ppi_sample);
+            trigger_uninit();
+            return err_code;
+        }
+    }
+#endif
+
+    m_cb.evt_handler     = evt_handler;
+    m_cb.p_pool          = p_config->p_buffer_pool;
+    m_cb.p_filter        = p_config->p_filter;
+    m_cb.p_multirate     = p_config->p_multirate;
+    m_cb.channel_count   = 0;
+    for (uint8_t channel = 0; channel < NRF_SAADC_CHANNEL_COUNT; channel++)
+    {
+        if (p_config->channel_mask & (1UL << channel))
+        {
+            m_cb.gains[m_cb.channel_count]    = channel_gain_get(channel);
+            m_cb.channels[m_cb.channel_count] = channel;
+            m_cb.channel_count++;
+        }
+    }
+    m_cb.resolution_bits = 8 + 2 * (uint8_t)p_config->resolution;
+    m_cb.autorange       = p_config->autorange;
+    m_cb.gain_transition = 0;
+    m_cb.buffer_size     = p_config->buffer_size;
+    m_cb.queued_count    = 0;
+    m_cb.buf_req_pending = false;
+    m_cb.restart_held    = false;
+    m_cb.overruns        = 0;
+    m_cb.aux_count       = 0;
+    m_cb.aux_armed       = false;
+    m_cb.resync_pending  = false;
+    m_cb.resync_armed    = false;
+    m_cb.calib_running   = false;
+    m_cb.p_deferred      = NULL;
+    m_cb.state           = APP_SAADC_STATE_IDLE;
+
+#if APP_SAADC_PWR_MGMT
+    m_saadc_suspended = false;
+    nrf_pwr_mgmt_periph_power_handler_set(NRF_PWR_MGMT_PERIPH_SAADC, saadc_power_handler);
+#endif
+
+    NRF_LOG_INFO("Initialized, sample interval: %d us.", p_config->sample_interval_us);
+
+    return NRF_SUCCESS;
+}
+
+
+void app_saadc_uninit(void)
+{
+    ASSERT(m_cb.state != APP_SAADC_STATE_UNINITIALIZED);
+
+    if (m_cb.state != APP_SAADC_STATE_IDLE)
+    {
+        pacing_stop();
+        app_saadc_bench_abort();
+        nrfx_saadc_abort();
+    }
+
+    (void)nrfx_ppi_channel_free(m_cb.ppi_sample);
+    (void)nrfx_ppi_channel_free(m_cb.ppi_restart);
+    (void)nrfx_ppi_channel_free(m_cb.ppi_calib);
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+    if (m_cb.p_multirate != NULL)
+    {
+        multirate_uninit();
+    }
+#endif
+    trigger_uninit();
+
+#if APP_SAADC_PWR_MGMT
+    nrf_pwr_mgmt_periph_power_handler_set(NRF_PWR_MGMT_PERIPH_SAADC, NULL);
+#endif
+    saadc_power_require(false);
+
+    m_cb.aux_count = 0;
+    m_cb.state     = APP_SAADC_STATE_UNINITIALIZED;
+}
+
+
+ret_code_t app_saadc_buffer_set(nrf_saadc_value_t * p_buffer, uint16_t size)
+{
+    ASSERT(m_cb.state != APP_SAADC_STATE_UNINITIALIZED);
+    ASSERT(m_cb.p_pool == NULL);
+
+    ret_code_t err_code = NRF_SUCCESS;
+
+    CRITICAL_REGION_ENTER();
+    if (m_cb.calib_running)
+    {
+        // Latching it now would redirect the restart after the calibration.
+        if (m_cb.p_deferred != NULL)
+        {
+            err_code = NRF_ERROR_INVALID_STATE;
+        }
+        else
+        {
+            m_cb.p_deferred    = p_buffer;
+            m_cb.deferred_size = size;
+        }
+    }
+    else
+    {
+        err_code = nrfx_saadc_buffer_set(p_buffer, size);
+        if (err_code == NRF_SUCCESS)
+        {
+            app_saadc_bench_buffer_set();
+        }
+    }
+    if ((err_code == NRF_SUCCESS) && m_cb.burst_limited && (m_cb.burst_left > 0))
+    {
+        m_cb.burst_left--;
+    }
+    CRITICAL_REGION_EXIT();
+    return err_code;
+}
+
+
+void app_saadc_buffer_release(nrf_saadc_value_t * p_buffer)
+{
+    ASSERT(m_cb.p_pool != NULL);
+    ASSERT(p_buffer != NULL);
+
+    CRITICAL_REGION_ENTER();
+    if (m_cb.buf_req_pending && (m_cb.state == APP_SAADC_STATE_RUNNING))
+    {
+        // The driver is waiting for a buffer, chain this one directly, or when the calibration
+        // gap closes.
+        m_cb.buf_req_pending = false;
+        if (m_cb.calib_running)
+        {
+            m_cb.p_deferred = p_buffer;
+        }
+        else if (pool_buffer_queue(p_buffer) != NRF_SUCCESS)
+        {
+            nrf_balloc_free(m_cb.p_pool, p_buffer);
+        }
+    }
+    else
+    {
+        nrf_balloc_free(m_cb.p_pool, p_buffer);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+
+/**@brief Function for starting a hardware-paced acquisition.
+ *
+ * @param[in] start_evt_addr Address of the event that starts the pacing, or 0 to start it as
+ *                           soon as the first buffer is latched.
+ */
+static ret_code_t acquisition_start(uint32_t start_evt_addr)
+{
+    ret_code_t err_code = NRF_SUCCESS;
+
+    if (m_cb.state != APP_SAADC_STATE_IDLE)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    // Monitor mode and burst captures pace the trigger at their own intervals.
+    err_code = trigger_interval_set(m_cb.sample_interval_us, &m_cb.period_ns);
+    VERIFY_SUCCESS(err_code);
+
+    if (start_evt_addr != 0)
+    {
+        err_code = nrfx_ppi_channel_alloc(&m_cb.ppi_start);
+        VERIFY_SUCCESS(err_code);
+        APP_ERROR_CHECK(nrfx_ppi_channel_assign(m_cb.ppi_start,
+                                                start_evt_addr,
+                                                trigger_start_task_address_get()));
+    }
+    m_cb.start_on_evt  = (start_evt_addr != 0);
+    m_cb.start_aligned = m_cb.start_on_evt;
+
+    m_cb.monitor_enabled = false;
+    m_cb.history_active  = false;
+    m_cb.burst_limited   = false;
+    m_cb.calib_pending   = false;
+    m_cb.calib_armed     = false;
+
+    if (m_cb.p_pool != NULL)
+    {
+        err_code = pool_prime();
+    }
+    if (err_code == NRF_SUCCESS)
+    {
+        err_code = conversions_start(APP_SAADC_STATE_RUNNING);
+    }
+    if ((err_code != NRF_SUCCESS) && m_cb.start_on_evt)
+    {
+        (void)nrfx_ppi_channel_free(m_cb.ppi_start);
+        m_cb.start_on_evt  = false;
+        m_cb.start_aligned = false;
+    }
+
+    return err_code;
+}
+
+
+ret_code_t app_saadc_start(void)
+{
+    return acquisition_start(0);
+}
+
+
+ret_code_t app_saadc_start_at(uint32_t start_evt_addr)
+{
+    if (start_evt_addr == 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    return acquisition_start(start_evt_addr);
+}
+
+
+ret_code_t app_saadc_monitor_start(app_saadc_monitor_config_t const * p_config)
+{
+    ASSERT(p_config);
+    ASSERT(p_config->p_history);
+
+    if (m_cb.state != APP_SAADC_STATE_IDLE)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (m_cb.p_multirate != NULL)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    if ((p_config->history_size == 0) || ((p_config->history_size % m_cb.channel_count) != 0))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    // Validate the burst interval now rather than on the trigger.
+    uint32_t   period_ns;
+    ret_code_t err_code = trigger_interval_set(p_config->burst_interval_us, &period_ns);
+    VERIFY_SUCCESS(err_code);
+
+    m_cb.monitor         = *p_config;
+    m_cb.monitor_enabled = true;
+    m_cb.start_aligned   = false;
+
+    return monitor_enter();
+}
+
+
+void app_saadc_stop(void)
+{
+    switch (m_cb.state)
+    {
+        case APP_SAADC_STATE_RUNNING:
+            /* fall-through */
+        case APP_SAADC_STATE_MONITOR:
+            m_cb.state = APP_SAADC_STATE_STOPPING;
+            pacing_stop();
+            app_saadc_bench_abort();
+            nrfx_saadc_abort();
+            break;
+
+        case APP_SAADC_STATE_TRIGGERED:
+            // Sampling is already being stopped, do not start the burst capture.
+            m_cb.state = APP_SAADC_STATE_STOPPING;
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+ret_code_t app_saadc_calibrate(void)
+{
+    switch (m_cb.state)
+    {
+        case APP_SAADC_STATE_IDLE:
+            calib_idle_run();
+            return NRF_SUCCESS;
+
+        case APP_SAADC_STATE_RUNNING:
+            m_cb.calib_pending = true;
+            return NRF_SUCCESS;
+
+        default:
+            return NRF_ERROR_INVALID_STATE;
+    }
+}
+
+
+ret_code_t app_saadc_aux_request(app_saadc_aux_request_t const * p_request)
+{
+    ASSERT(p_request);
+    ASSERT(p_request->handler);
+
+    ret_code_t        err_code = NRF_SUCCESS;
+    app_saadc_state_t state;
+
+    CRITICAL_REGION_ENTER();
+    state = m_cb.state;
+    if ((state == APP_SAADC_STATE_UNINITIALIZED) ||
+        (state == APP_SAADC_STATE_MONITOR) ||
+        (state == APP_SAADC_STATE_TRIGGERED))
+    {
+        err_code = NRF_ERROR_INVALID_STATE;
+    }
+    else if (m_cb.aux_count == APP_SAADC_CONFIG_AUX_REQUESTS)
+    {
+        err_code = NRF_ERROR_BUSY;
+    }
+    else
+    {
+        m_aux_queue[m_cb.aux_count++] = *p_request;
+    }
+    CRITICAL_REGION_EXIT();
+
+    // While running, the request is served in the next gap, and while stopping, when the
+    // driver finishes.
+    if ((err_code == NRF_SUCCESS) && (state == APP_SAADC_STATE_IDLE))
+    {
+        aux_idle_run();
+    }
+
+    return err_code;
+}
+
+
+uint32_t app_saadc_overruns_get(void)
+{
+    return m_cb.overruns;
+}
+
+
+bool app_saadc_is_running(void)
+{
+    return (m_cb.state == APP_SAADC_STATE_RUNNING) ||
+           (m_cb.state == APP_SAADC_STATE_MONITOR) ||
+           (m_cb.state == APP_SAADC_STATE_TRIGGERED);
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SAADC)
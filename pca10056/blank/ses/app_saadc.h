@@ -0,0 +1,378 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc Hardware-paced SAADC acquisition
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Module for continuous SAADC sampling paced by a TIMER or RTC through PPI.
+ *
+ * @details The module puts the SAADC driver in advanced non-blocking mode and connects
+ *          the compare event of a TIMER (or RTC) instance to the SAMPLE task of the SAADC
+ *          through PPI. The END event of the SAADC is connected to its START task, so the
+ *          next result buffer is latched in hardware. The CPU is woken up only once per
+ *          filled buffer, and sampling jitter does not depend on interrupt latency.
+ *
+ *          The module owns the PPI channels and the TIMER (or RTC) instance selected in
+ *          the configuration. SAADC channels must be configured with
+ *          @ref nrfx_saadc_channels_config before calling @ref app_saadc_init.
+ *
+ *          Result buffers can be supplied by the application on each
+ *          @ref APP_SAADC_EVT_BUF_REQ event, or taken by the module from a block allocator
+ *          pool. In the latter case, the pool acts as an N-deep buffer queue: the module
+ *          chains free buffers to the SAADC automatically and hands each filled buffer over
+ *          to the application in @ref APP_SAADC_EVT_DONE. The application owns the buffer
+ *          until it calls @ref app_saadc_buffer_release, so processing can lag behind
+ *          acquisition by as many buffers as the pool holds.
+ *
+ *          Because conversions are paced in hardware, the time of each sample follows from
+ *          the END event of the previous buffer, which is timed on every buffer. Each
+ *          @ref APP_SAADC_EVT_DONE event carries the timestamp of the first sample in the
+ *          buffer, on the same time base as @ref app_timer_cnt_get, and the effective sample
+ *          period.
+ *
+ *          In monitor mode (@ref app_saadc_monitor_start), the SAADC samples at a low rate
+ *          into a history ring that wraps around in hardware, and the CPU is only woken up
+ *          once per ring round or when a channel limit is crossed. On a limit crossing, the
+ *          pre-trigger history is reported in @ref APP_SAADC_EVT_TRIGGERED and a burst capture
+ *          at a high rate follows, after which the module returns to monitoring.
+ *
+ *          With auto-ranging enabled, the peak of each channel in a filled buffer is used
+ *          to step its gain up or down. The channel register is rewritten while sampling
+ *          continues, so the change lands in the buffer being filled at that moment. That
+ *          buffer is flagged in @ref app_saadc_done_evt_t::gain_transition and the gains
+ *          in effect are reported with each buffer.
+ *
+ *          Other modules that need a single conversion, such as a battery voltage reading,
+ *          share the SAADC through @ref app_saadc_aux_request instead of initializing the
+ *          driver themselves. The requests are converted on a spare channel in the gap after
+ *          the buffer being filled, in the same way as the offset calibration, so the
+ *          acquisition keeps its buffers and only pauses for the conversion time.
+ *
+ *          With @ref app_saadc_start_at, the pacing is started by a hardware event instead, so
+ *          that acquisitions on several devices can be started at the same time, for example
+ *          by @ref app_timesync.
+ *
+ *          With a multi-rate schedule (@ref app_saadc_multirate), channels are converted at
+ *          integer fractions of the pacing rate within the same scan sequence, and each
+ *          filled buffer is split into per-channel output rings. A change of the enabled
+ *          channels waits in its interrupt for the scan in progress to end, so code at lower
+ *          priorities can be delayed by up to one scan and the guard time for each change.
+ */
+
+#ifndef APP_SAADC_H__
+#define APP_SAADC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "nrfx_saadc.h"
+#include "nrf_balloc.h"
+#include "app_saadc_filter.h"
+#include "app_saadc_multirate.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Sample trigger source: TIMER instance. */
+#define APP_SAADC_TRIGGER_TIMER 0
+
+/**@brief Sample trigger source: RTC instance. */
+#define APP_SAADC_TRIGGER_RTC   1
+
+/**@brief Event types. */
+typedef enum
+{
+    APP_SAADC_EVT_DONE,      ///< Buffer is filled with samples. When a buffer pool is used, release the buffer with @ref app_saadc_buffer_release.
+    APP_SAADC_EVT_BUF_REQ,   ///< Next buffer is required. Call @ref app_saadc_buffer_set. Not generated when a buffer pool is used.
+    APP_SAADC_EVT_LIMIT,     ///< Limit on a channel was crossed.
+    APP_SAADC_EVT_STOPPED,   ///< Acquisition stopped, either on request or because no buffer was provided.
+    APP_SAADC_EVT_TRIGGERED, ///< Limit crossed in monitor mode, burst capture follows. Without a buffer pool, provide the first burst buffers from the handler.
+    APP_SAADC_EVT_REARMED,   ///< Burst capture completed, monitor mode resumed.
+} app_saadc_evt_type_t;
+
+/**@brief Data for @ref APP_SAADC_EVT_DONE. */
+typedef struct
+{
+    nrf_saadc_value_t *      p_buffer;         ///< Pointer to the buffer with samples.
+    uint16_t                 size;             ///< Number of samples in the buffer.
+    uint32_t                 timestamp;        ///< Time of the first sample in the buffer, in app_timer ticks.
+    uint64_t                 start_offset_ns;  ///< Time of the first sample in the buffer after the start event given to @ref app_saadc_start_at, in nanoseconds. UINT64_MAX if the acquisition was not started on an event, or was restarted after a calibration or auxiliary conversion gap.
+    uint32_t                 sample_period_ns; ///< Time between consecutive samples of a channel, in nanoseconds.
+    nrf_saadc_gain_t const * p_gains;          ///< Gain of each channel, in buffer order, or NULL if auto-ranging is disabled. Valid in the handler only.
+    uint8_t                  gain_transition;  ///< Mask of buffer positions whose gain changed while this buffer was filled. Samples of these channels are mixed.
+} app_saadc_done_evt_t;
+
+/**@brief Data for @ref APP_SAADC_EVT_TRIGGERED. */
+typedef struct
+{
+    nrf_saadc_value_t const * p_history; ///< History ring with samples preceding the trigger. Valid until @ref APP_SAADC_EVT_REARMED.
+    uint16_t                  size;      ///< Number of valid samples in the ring.
+    uint16_t                  oldest;    ///< Index of the oldest sample in the ring.
+    nrfx_saadc_limit_evt_t    limit;     ///< Limit that triggered the capture.
+} app_saadc_triggered_evt_t;
+
+/**@brief Event structure. */
+typedef struct
+{
+    app_saadc_evt_type_t type; ///< Event type.
+    union
+    {
+        app_saadc_done_evt_t      done;      ///< Data for @ref APP_SAADC_EVT_DONE.
+        nrfx_saadc_limit_evt_t    limit;     ///< Data for @ref APP_SAADC_EVT_LIMIT.
+        app_saadc_triggered_evt_t triggered; ///< Data for @ref APP_SAADC_EVT_TRIGGERED.
+    } data;
+} app_saadc_evt_t;
+
+/**@brief Event handler type. */
+typedef void (* app_saadc_evt_handler_t)(app_saadc_evt_t const * p_evt);
+
+/**@brief Handler type for the result of an auxiliary conversion.
+ *
+ * @param[in] value           Conversion result.
+ * @param[in] resolution_bits Resolution of the conversion, which is the one of the acquisition.
+ * @param[in] p_context       Context given in the request.
+ */
+typedef void (* app_saadc_aux_handler_t)(nrf_saadc_value_t value,
+                                         uint8_t           resolution_bits,
+                                         void *            p_context);
+
+/**@brief Auxiliary conversion request. */
+typedef struct
+{
+    nrf_saadc_input_t          pin_p;     ///< Positive input.
+    nrf_saadc_input_t          pin_n;     ///< Negative input, NRF_SAADC_INPUT_DISABLED for single-ended.
+    nrf_saadc_channel_config_t config;    ///< Channel configuration.
+    app_saadc_aux_handler_t    handler;   ///< Handler called with the result.
+    void *                     p_context; ///< Context passed to the handler.
+} app_saadc_aux_request_t;
+
+/**@brief Acquisition configuration. */
+typedef struct
+{
+    uint32_t                channel_mask;       ///< Mask of SAADC channels to sample.
+    nrf_saadc_resolution_t  resolution;         ///< Resolution.
+    nrf_saadc_oversample_t  oversampling;       ///< Oversampling. Requires burst if more than one channel is used.
+    nrf_saadc_burst_t       burst;              ///< Burst mode.
+    uint32_t                sample_interval_us; ///< Interval between consecutive SAMPLE tasks, in microseconds.
+    nrf_balloc_t const *    p_buffer_pool;      ///< Pool of result buffers, or NULL if buffers are provided on @ref APP_SAADC_EVT_BUF_REQ.
+    uint16_t                buffer_size;        ///< Number of samples in each buffer taken from @p p_buffer_pool.
+    app_saadc_filter_t *    p_filter;           ///< Filter stage applied in place to each filled buffer before @ref APP_SAADC_EVT_DONE, or NULL.
+    bool                    autorange;          ///< Adjust the gain of each channel to the signal level of the previous buffer.
+    app_saadc_multirate_t * p_multirate;        ///< Multi-rate schedule of the channels, or NULL to convert all channels on every SAMPLE task. Buffers in @ref APP_SAADC_EVT_DONE then hold the scan stream, already split into the output rings.
+} app_saadc_config_t;
+
+/**@brief Monitor mode configuration. */
+typedef struct
+{
+    uint32_t            monitor_interval_us;                   ///< Sample interval while waiting for a limit crossing, in microseconds.
+    uint32_t            burst_interval_us;                     ///< Sample interval of the burst capture, in microseconds.
+    nrf_saadc_value_t * p_history;                             ///< History ring buffer.
+    uint16_t            history_size;                          ///< Number of samples in the history ring. Must be a multiple of the active channel count.
+    uint16_t            burst_buffers;                         ///< Number of buffers captured after the trigger. 0 captures until @ref app_saadc_stop.
+    uint32_t            limit_mask;                            ///< Mask of channels with limits.
+    int16_t             limit_low[NRF_SAADC_CHANNEL_COUNT];    ///< Low limit of each channel in @p limit_mask, INT16_MIN to disable.
+    int16_t             limit_high[NRF_SAADC_CHANNEL_COUNT];   ///< High limit of each channel in @p limit_mask, INT16_MAX to disable.
+} app_saadc_monitor_config_t;
+
+/**@brief Function for initializing the module.
+ *
+ * @details Allocates PPI channels, initializes the trigger TIMER (or RTC) and sets the SAADC
+ *          driver in advanced mode. The SAADC driver must be initialized and its channels
+ *          configured beforehand.
+ *
+ * @param[in] p_config    Acquisition configuration.
+ * @param[in] evt_handler Event handler.
+ *
+ * @retval NRF_SUCCESS              If the module was initialized.
+ * @retval NRF_ERROR_INVALID_STATE  If the module is already initialized.
+ * @retval NRF_ERROR_INVALID_PARAM  If the sample interval is out of range for the trigger source,
+ *                                  or the channel mask includes APP_SAADC_CONFIG_AUX_CHANNEL.
+ *                                  With a multi-rate schedule, also if the channel mask does not
+ *                                  match the schedule, a filter or auto-ranging is configured, the
+ *                                  sample interval is too short to write the changes, or the
+ *                                  frame counter interrupt priority is not above that of the SAADC.
+ * @retval NRF_ERROR_INVALID_LENGTH If the buffer size does not fit in the pool elements.
+ * @retval NRF_ERROR_NO_MEM         If there are no free PPI channels.
+ * @return Other error codes returned by the SAADC driver.
+ */
+ret_code_t app_saadc_init(app_saadc_config_t const * p_config, app_saadc_evt_handler_t evt_handler);
+
+/**@brief Function for uninitializing the module.
+ *
+ * @details Stops the acquisition if it is running and releases the PPI channels
+ *          and the trigger instance.
+ */
+void app_saadc_uninit(void);
+
+/**@brief Function for providing a result buffer.
+ *
+ * @details Two buffers should be provided before @ref app_saadc_start. After that, one buffer
+ *          should be provided on each @ref APP_SAADC_EVT_BUF_REQ event. Must not be used
+ *          when a buffer pool is configured. A buffer provided while an offset calibration
+ *          runs between two buffers is handed to the driver when the calibration is done.
+ *
+ * @param[in] p_buffer Buffer in RAM.
+ * @param[in] size     Number of samples in the buffer. Must be a multiple of the active channel count.
+ *
+ * @return Error codes returned by @ref nrfx_saadc_buffer_set.
+ */
+ret_code_t app_saadc_buffer_set(nrf_saadc_value_t * p_buffer, uint16_t size);
+
+/**@brief Function for returning a buffer to the pool.
+ *
+ * @details The buffer is reused by the module. If the SAADC is waiting for a buffer because
+ *          the pool was exhausted, the buffer is chained to it immediately. Sampling then
+ *          stops at the end of the buffer being filled and resumes in a gap, as after a
+ *          calibration. Can be called from any context.
+ *
+ * @param[in] p_buffer Buffer received in @ref APP_SAADC_EVT_DONE.
+ */
+void app_saadc_buffer_release(nrf_saadc_value_t * p_buffer);
+
+/**@brief Function for starting a hardware-paced acquisition.
+ *
+ * @details When a buffer pool is configured, the first two buffers are taken from it.
+ *
+ * @retval NRF_SUCCESS             If the acquisition was started.
+ * @retval NRF_ERROR_INVALID_STATE If the module is not initialized or the acquisition is running.
+ * @retval NRF_ERROR_NO_MEM        If no buffer was provided or the pool is empty.
+ */
+ret_code_t app_saadc_start(void);
+
+/**@brief Function for starting a hardware-paced acquisition on a hardware event.
+ *
+ * @details Works as @ref app_saadc_start, but the pacing is started by the event through PPI
+ *          instead of when the first buffer is latched. The event must come after the first
+ *          buffer is latched, which takes some tens of microseconds, and only its first
+ *          occurrence counts. The first sample is taken one sample period after the event,
+ *          and each @ref APP_SAADC_EVT_DONE event carries the time of its first sample after
+ *          the event in @ref app_saadc_done_evt_t::start_offset_ns. The app_timer timestamp
+ *          of the first buffer is taken when it is latched and does not account for the wait.
+ *
+ * @param[in] start_evt_addr Address of the event, for example a TIMER compare event.
+ *
+ * @retval NRF_SUCCESS             If the acquisition was armed.
+ * @retval NRF_ERROR_INVALID_PARAM If @p start_evt_addr is 0.
+ * @retval NRF_ERROR_INVALID_STATE If the module is not initialized or the acquisition is running.
+ * @retval NRF_ERROR_NO_MEM        If no buffer was provided, the pool is empty, or there are
+ *                                 no free PPI channels.
+ */
+ret_code_t app_saadc_start_at(uint32_t start_evt_addr);
+
+/**@brief Function for starting the monitor mode.
+ *
+ * @details Limits are only active while monitoring, and are cleared during the burst capture.
+ *          The sample interval given in @ref app_saadc_init is not used in this mode.
+ *
+ * @param[in] p_config Monitor mode configuration. The history buffer must stay valid until
+ *                     the module is stopped.
+ *
+ * @retval NRF_SUCCESS              If the monitor mode was started.
+ * @retval NRF_ERROR_INVALID_STATE  If the module is not initialized or the acquisition is running.
+ * @retval NRF_ERROR_INVALID_LENGTH If the history size is not a multiple of the channel count.
+ * @retval NRF_ERROR_INVALID_PARAM  If an interval is out of range for the trigger source.
+ * @retval NRF_ERROR_NOT_SUPPORTED  If a multi-rate schedule is configured.
+ */
+ret_code_t app_saadc_monitor_start(app_saadc_monitor_config_t const * p_config);
+
+/**@brief Function for stopping the acquisition.
+ *
+ * @details The partially filled buffer is delivered in @ref APP_SAADC_EVT_DONE, followed
+ *          by @ref APP_SAADC_EVT_STOPPED.
+ */
+void app_saadc_stop(void);
+
+/**@brief Function for calibrating the SAADC offset.
+ *
+ * @details When the module is idle, the calibration runs immediately and blocks until it is
+ *          done. During a continuous acquisition, it runs in the gap after the buffer being
+ *          filled: the pacing is halted while the SAADC calibrates and restarted in hardware
+ *          when it is done, so no conversion is requested during the calibration and the CPU
+ *          does not wait for it. The timestamps of the following buffers account for the gap.
+ *
+ * @retval NRF_SUCCESS             If the calibration was done or scheduled.
+ * @retval NRF_ERROR_INVALID_STATE If the module is not initialized, or in monitor mode.
+ */
+ret_code_t app_saadc_calibrate(void);
+
+/**@brief Function for requesting a single conversion on the auxiliary channel.
+ *
+ * @details When the module is idle, the conversion runs immediately and the handler is called
+ *          before this function returns. During a continuous acquisition, it runs in the gap
+ *          after the buffer being filled, and the handler is called from the SAADC interrupt.
+ *          The acquisition channels are disconnected while the auxiliary channel converts,
+ *          and the timestamps of the following buffers account for the gap. With
+ *          oversampling, the auxiliary channel is converted in burst mode.
+ *
+ * @param[in] p_request Request. Copied, so it does not need to stay valid.
+ *
+ * @retval NRF_SUCCESS             If the conversion was done or queued.
+ * @retval NRF_ERROR_INVALID_STATE If the module is not initialized, or in monitor mode.
+ * @retval NRF_ERROR_BUSY          If APP_SAADC_CONFIG_AUX_REQUESTS requests are already queued.
+ */
+ret_code_t app_saadc_aux_request(app_saadc_aux_request_t const * p_request);
+
+/**@brief Function for getting the number of overruns.
+ *
+ * @details An overrun is counted each time the pool is empty when the driver requests the
+ *          next buffer. Samples are lost until a buffer is returned, or the acquisition stops
+ *          if none is returned before the buffer being filled ends.
+ *
+ * @return Number of overruns since @ref app_saadc_init.
+ */
+uint32_t app_saadc_overruns_get(void);
+
+/**@brief Function for checking if the acquisition is running.
+ *
+ * @retval true  If the acquisition is running.
+ * @retval false Otherwise.
+ */
+bool app_saadc_is_running(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_H__
+
+/** @} */
@@ -0,0 +1,350 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC_ACQTIME)
+#include <string.h>
+#include "app_saadc_acqtime.h"
+#include "app_saadc.h"
+#include "fds.h"
+#include "nrf.h"
+
+#define NRF_LOG_MODULE_NAME app_saadc_acqtime
+#if APP_SAADC_ACQTIME_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       APP_SAADC_ACQTIME_CONFIG_LOG_LEVEL
+#define NRF_LOG_INFO_COLOR  APP_SAADC_ACQTIME_CONFIG_INFO_COLOR
+#define NRF_LOG_DEBUG_COLOR APP_SAADC_ACQTIME_CONFIG_DEBUG_COLOR
+#else //APP_SAADC_ACQTIME_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       0
+#endif //APP_SAADC_ACQTIME_CONFIG_LOG_ENABLED
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define ACQTIME_GAIN_COUNT      (NRF_SAADC_GAIN4 + 1) ///< Number of gain settings.
+#define ACQTIME_NONE            0xFF                  ///< Marks a channel and gain that was not calibrated.
+#define ACQTIME_RECORD_VERSION  1                     ///< Version of the flash record layout.
+
+/**@brief Calibration results, as stored in flash. */
+typedef struct
+{
+    uint16_t version;                                               ///< @ref ACQTIME_RECORD_VERSION.
+    uint16_t error_budget;                                          ///< Error budget of the calibration, in LSBs.
+    uint8_t  acq_time[NRF_SAADC_CHANNEL_COUNT][ACQTIME_GAIN_COUNT]; ///< @ref nrf_saadc_acqtime_t per channel and gain, or @ref ACQTIME_NONE.
+} app_saadc_acqtime_record_t;
+
+static app_saadc_acqtime_record_t m_record =
+{
+    .version = ACQTIME_RECORD_VERSION,
+};
+
+/**@brief Time in microseconds, indexed by @ref nrf_saadc_acqtime_t. */
+static const uint8_t m_acq_time_us[] = {3, 5, 10, 15, 20, 40};
+
+
+/**@brief Function for setting the gain and acquisition time of a channel. */
+static void channel_set(uint8_t channel, uint32_t gain, uint32_t acq_time)
+{
+    uint32_t config = NRF_SAADC->CH[channel].CONFIG;
+
+    config &= ~(SAADC_CH_CONFIG_GAIN_Msk | SAADC_CH_CONFIG_TACQ_Msk);
+    config |= (gain     << SAADC_CH_CONFIG_GAIN_Pos) & SAADC_CH_CONFIG_GAIN_Msk;
+    config |= (acq_time << SAADC_CH_CONFIG_TACQ_Pos) & SAADC_CH_CONFIG_TACQ_Msk;
+    NRF_SAADC->CH[channel].CONFIG = config;
+}
+
+
+/**@brief Function for converting the scan repeatedly and summing the results of one channel.
+ *
+ * @param[in] position      Position of the channel in the scan.
+ * @param[in] channel_count Number of channels in the scan.
+ * @param[in] samples       Number of scans.
+ *
+ * @return Sum of the results of the channel.
+ */
+static int32_t scan_sum(uint8_t position, uint8_t channel_count, uint16_t samples)
+{
+    nrf_saadc_value_t results[NRF_SAADC_CHANNEL_COUNT];
+    int32_t           sum = 0;
+
+    for (uint16_t i = 0; i < samples; i++)
+    {
+        NRF_SAADC->RESULT.PTR    = (uint32_t)results;
+        NRF_SAADC->RESULT.MAXCNT = channel_count;
+
+        nrf_saadc_event_clear(NRF_SAADC_EVENT_STARTED);
+        nrf_saadc_task_trigger(NRF_SAADC_TASK_START);
+        while (!nrf_saadc_event_check(NRF_SAADC_EVENT_STARTED))
+        {}
+
+        nrf_saadc_event_clear(NRF_SAADC_EVENT_END);
+        nrf_saadc_task_trigger(NRF_SAADC_TASK_SAMPLE);
+        while (!nrf_saadc_event_check(NRF_SAADC_EVENT_END))
+        {}
+
+        sum += results[position];
+    }
+
+    return sum;
+}
+
+
+/**@brief Function for finding the shortest acquisition time of a channel at a gain.
+ *
+ * @details Settling only improves with time, so the search stops at the first acquisition
+ *          time that exceeds the budget.
+ */
+static nrf_saadc_acqtime_t channel_calibrate(uint8_t                            channel,
+                                             uint8_t                            position,
+                                             uint8_t                            channel_count,
+                                             uint32_t                           gain,
+                                             app_saadc_acqtime_config_t const * p_config)
+{
+    int32_t const       budget = (int32_t)p_config->error_budget * p_config->samples;
+    nrf_saadc_acqtime_t best   = NRF_SAADC_ACQTIME_40US;
+    int32_t             reference;
+
+    channel_set(channel, gain, NRF_SAADC_ACQTIME_40US);
+    reference = scan_sum(position, channel_count, p_config->samples);
+
+    for (int32_t acq_time = NRF_SAADC_ACQTIME_20US; acq_time >= NRF_SAADC_ACQTIME_3US; acq_time--)
+    {
+        channel_set(channel, gain, (uint32_t)acq_time);
+
+        int32_t error = scan_sum(position, channel_count, p_config->samples) - reference;
+        if ((error > budget) || (error < -budget))
+        {
+            break;
+        }
+        best = (nrf_saadc_acqtime_t)acq_time;
+    }
+
+    return best;
+}
+
+
+ret_code_t app_saadc_acqtime_calibrate(app_saadc_acqtime_config_t const * p_config)
+{
+    ASSERT(p_config);
+
+    uint32_t config[NRF_SAADC_CHANNEL_COUNT];
+    uint8_t  channel_count = 0;
+
+    if (p_config->samples == 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+#if NRF_MODULE_ENABLED(APP_SAADC)
+    if (app_saadc_is_running())
+    {
+        return NRF_ERROR_BUSY;
+    }
+#endif
+
+    for (uint8_t channel = 0; channel < NRF_SAADC_CHANNEL_COUNT; channel++)
+    {
+        config[channel] = NRF_SAADC->CH[channel].CONFIG;
+        if (NRF_SAADC->CH[channel].PSELP != SAADC_CH_PSELP_PSELP_NC)
+        {
+            channel_count++;
+        }
+    }
+    if (channel_count == 0)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    bool     enabled    = nrf_saadc_enable_check();
+    uint32_t inten      = NRF_SAADC->INTEN;
+    uint32_t resolution = NRF_SAADC->RESOLUTION;
+    uint32_t oversample = NRF_SAADC->OVERSAMPLE;
+    uint32_t ptr        = NRF_SAADC->RESULT.PTR;
+    uint32_t maxcnt     = NRF_SAADC->RESULT.MAXCNT;
+
+    // Polled, so that the driver does not see these conversions.
+    nrf_saadc_int_disable(NRF_SAADC_INT_ALL);
+    if (!enabled)
+    {
+        nrf_saadc_enable();
+    }
+    NRF_SAADC->RESOLUTION = p_config->resolution;
+    NRF_SAADC->OVERSAMPLE = 0;
+
+    memset(m_record.acq_time, ACQTIME_NONE, sizeof(m_record.acq_time));
+    m_record.error_budget = p_config->error_budget;
+
+    uint8_t position = 0;
+    for (uint8_t channel = 0; channel < NRF_SAADC_CHANNEL_COUNT; channel++)
+    {
+        if (NRF_SAADC->CH[channel].PSELP == SAADC_CH_PSELP_PSELP_NC)
+        {
+            continue;
+        }
+
+        uint32_t gain_mask = p_config->gain_mask;
+        if (gain_mask == 0)
+        {
+            gain_mask = 1UL << ((config[channel] & SAADC_CH_CONFIG_GAIN_Msk) >> SAADC_CH_CONFIG_GAIN_Pos);
+        }
+
+        for (uint32_t gain = 0; gain < ACQTIME_GAIN_COUNT; gain++)
+        {
+            if (gain_mask & (1UL << gain))
+            {
+                nrf_saadc_acqtime_t acq_time = channel_calibrate(channel, position, channel_count,
+                                                                 gain, p_config);
+
+                m_record.acq_time[channel][gain] = (uint8_t)acq_time;
+                NRF_LOG_INFO("Channel %d, gain %d: %d us.", channel, gain, m_acq_time_us[acq_time]);
+            }
+        }
+
+        // The other channels keep their configuration while this one is calibrated.
+        NRF_SAADC->CH[channel].CONFIG = config[channel];
+        position++;
+    }
+
+    nrf_saadc_task_trigger(NRF_SAADC_TASK_STOP);
+    while (!nrf_saadc_event_check(NRF_SAADC_EVENT_STOPPED))
+    {}
+
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_STOPPED);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_STARTED);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_END);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_DONE);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_RESULTDONE);
+
+    NRF_SAADC->RESULT.PTR    = ptr;
+    NRF_SAADC->RESULT.MAXCNT = maxcnt;
+    NRF_SAADC->RESOLUTION    = resolution;
+    NRF_SAADC->OVERSAMPLE    = oversample;
+    if (!enabled)
+    {
+        nrf_saadc_disable();
+    }
+    NRF_SAADC->INTENSET = inten;
+
+    return NRF_SUCCESS;
+}
+
+
+bool app_saadc_acqtime_get(uint8_t channel, nrf_saadc_gain_t gain, nrf_saadc_acqtime_t * p_acq_time)
+{
+    if ((channel >= NRF_SAADC_CHANNEL_COUNT) || ((uint32_t)gain >= ACQTIME_GAIN_COUNT) ||
+        (m_record.acq_time[channel][gain] == ACQTIME_NONE))
+    {
+        return false;
+    }
+
+    *p_acq_time = (nrf_saadc_acqtime_t)m_record.acq_time[channel][gain];
+    return true;
+}
+
+
+void app_saadc_acqtime_apply(nrfx_saadc_channel_t * p_channels, uint8_t channel_count)
+{
+    ASSERT(p_channels);
+
+    for (uint8_t i = 0; i < channel_count; i++)
+    {
+        nrf_saadc_channel_config_t * p_config = &p_channels[i].channel_config;
+
+        UNUSED_RETURN_VALUE(app_saadc_acqtime_get(p_channels[i].channel_index,
+                                                  p_config->gain,
+                                                  &p_config->acq_time));
+    }
+}
+
+
+ret_code_t app_saadc_acqtime_store(void)
+{
+    fds_record_desc_t desc  = {0};
+    fds_find_token_t  token = {0};
+    fds_record_t      record =
+    {
+        .file_id           = APP_SAADC_ACQTIME_FILE_ID,
+        .key               = APP_SAADC_ACQTIME_RECORD_KEY,
+        .data.p_data       = &m_record,
+        .data.length_words = BYTES_TO_WORDS(sizeof(m_record)),
+    };
+
+    if (fds_record_find(APP_SAADC_ACQTIME_FILE_ID, APP_SAADC_ACQTIME_RECORD_KEY,
+                        &desc, &token) == NRF_SUCCESS)
+    {
+        return fds_record_update(&desc, &record);
+    }
+
+    return fds_record_write(NULL, &record);
+}
+
+
+ret_code_t app_saadc_acqtime_load(void)
+{
+    ret_code_t         err_code;
+    fds_record_desc_t  desc   = {0};
+    fds_find_token_t   token  = {0};
+    fds_flash_record_t record = {0};
+
+    err_code = fds_record_find(APP_SAADC_ACQTIME_FILE_ID, APP_SAADC_ACQTIME_RECORD_KEY,
+                               &desc, &token);
+    if (err_code != NRF_SUCCESS)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    err_code = fds_record_open(&desc, &record);
+    VERIFY_SUCCESS(err_code);
+
+    app_saadc_acqtime_record_t const * p_stored = record.p_data;
+
+    if ((record.p_header->length_words == BYTES_TO_WORDS(sizeof(m_record))) &&
+        (p_stored->version == ACQTIME_RECORD_VERSION))
+    {
+        memcpy(&m_record, p_stored, sizeof(m_record));
+    }
+    else
+    {
+        err_code = NRF_ERROR_NOT_FOUND;
+    }
+
+    UNUSED_RETURN_VALUE(fds_record_close(&desc));
+
+    return err_code;
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SAADC_ACQTIME)
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc_acqtime SAADC acquisition time optimizer
+ * @{
+ * @ingroup app_saadc
+ *
+ * @brief Finds the shortest acquisition time of each SAADC channel and gain that settles within
+ *        an error budget, and keeps the results in flash.
+ *
+ * @details The scan time of the SAADC is the sum of the acquisition and conversion times of
+ *          the channels, so conservative acquisition times limit the sample rate. At the end
+ *          of a conversion, the sampling capacitor holds the voltage of the channel converted
+ *          before. With a short acquisition time, it does not fully charge to the new input,
+ *          and the error depends on the source impedance and the gain.
+ *
+ *          @ref app_saadc_acqtime_calibrate converts the configured scan repeatedly. For each
+ *          channel and gain, it converts with each acquisition time from the longest to the
+ *          shortest, and compares the mean result with the one at 40 us. The channel before it
+ *          in the scan precharges the capacitor, as in the acquisition. The shortest
+ *          acquisition time that stays within the error budget is kept. For the results to
+ *          cover the worst case, the inputs should be at levels far apart during the
+ *          calibration, for example at opposite ends of their ranges.
+ *
+ *          The results are stored in a Flash Data Storage record with
+ *          @ref app_saadc_acqtime_store and read back after a reset with
+ *          @ref app_saadc_acqtime_load. @ref app_saadc_acqtime_apply sets them in the channel
+ *          configurations before @ref nrfx_saadc_channels_config is called. When auto-ranging
+ *          of @ref app_saadc changes the gain of a channel, the acquisition time found for the
+ *          new gain is set with it. The sample interval of the acquisition must then leave room
+ *          for the longest of them.
+ */
+
+#ifndef APP_SAADC_ACQTIME_H__
+#define APP_SAADC_ACQTIME_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "nrfx_saadc.h"
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Calibration configuration. */
+typedef struct
+{
+    nrf_saadc_resolution_t resolution;   ///< Resolution of the conversions. The error budget is in its LSBs.
+    uint16_t               error_budget; ///< Largest allowed difference from the result at 40 us, in LSBs.
+    uint16_t               samples;      ///< Number of scans averaged for each acquisition time.
+    uint8_t                gain_mask;    ///< Gains to calibrate, as a mask of @ref nrf_saadc_gain_t bits. 0 calibrates the configured gain of each channel only.
+} app_saadc_acqtime_config_t;
+
+/**@brief Function for calibrating the acquisition times of the configured channels.
+ *
+ * @details Blocks until all channels and gains are calibrated. SAADC interrupts are disabled
+ *          for the duration, and the channel configuration, resolution and oversampling are
+ *          restored afterwards. The SAADC driver must be initialized, the channels configured
+ *          with @ref nrfx_saadc_channels_config, and no acquisition running.
+ *
+ * @param[in] p_config Calibration configuration.
+ *
+ * @retval NRF_SUCCESS             If the channels were calibrated.
+ * @retval NRF_ERROR_INVALID_PARAM If @p samples is 0.
+ * @retval NRF_ERROR_INVALID_STATE If no channel is configured.
+ * @retval NRF_ERROR_BUSY          If an acquisition of @ref app_saadc is running.
+ */
+ret_code_t app_saadc_acqtime_calibrate(app_saadc_acqtime_config_t const * p_config);
+
+/**@brief Function for getting the calibrated acquisition time of a channel and gain.
+ *
+ * @param[in]  channel    SAADC channel.
+ * @param[in]  gain       Gain.
+ * @param[out] p_acq_time Shortest acquisition time within the error budget.
+ *
+ * @retval true  If the channel was calibrated at this gain.
+ * @retval false Otherwise.
+ */
+bool app_saadc_acqtime_get(uint8_t channel, nrf_saadc_gain_t gain, nrf_saadc_acqtime_t * p_acq_time);
+
+/**@brief Function for setting the calibrated acquisition times in channel configurations.
+ *
+ * @details Channels that were not calibrated at their gain keep their acquisition time.
+ *
+ * @param[in,out] p_channels    Channel configurations, as given to @ref nrfx_saadc_channels_config.
+ * @param[in]     channel_count Number of channel configurations.
+ */
+void app_saadc_acqtime_apply(nrfx_saadc_channel_t * p_channels, uint8_t channel_count);
+
+/**@brief Function for writing the calibration results to flash.
+ *
+ * @details The results are written asynchronously by Flash Data Storage, which must be
+ *          initialized.
+ *
+ * @return Error codes returned by @ref fds_record_write or @ref fds_record_update.
+ */
+ret_code_t app_saadc_acqtime_store(void);
+
+/**@brief Function for reading the calibration results from flash.
+ *
+ * @retval NRF_SUCCESS         If the results were read.
+ * @retval NRF_ERROR_NOT_FOUND If no valid results are stored.
+ * @return Other error codes returned by Flash Data Storage.
+ */
+ret_code_t app_saadc_acqtime_load(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_ACQTIME_H__
+
+/** @} */
@@ -0,0 +1,418 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC_BENCH)
+#include "app_saadc_bench.h"
+#include "app_saadc.h"
+#include "app_timer.h"
+#include "nrf.h"
+#include "nrf_balloc.h"
+#include "nrf_balloc_idx.h"
+#include "nrf_gpio.h"
+#include "nrfx_ppi.h"
+#include "nrfx_timer.h"
+
+#define NRF_LOG_MODULE_NAME app_saadc_bench
+#if APP_SAADC_BENCH_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       APP_SAADC_BENCH_CONFIG_LOG_LEVEL
+#define NRF_LOG_INFO_COLOR  APP_SAADC_BENCH_CONFIG_INFO_COLOR
+#define NRF_LOG_DEBUG_COLOR APP_SAADC_BENCH_CONFIG_DEBUG_COLOR
+#else //APP_SAADC_BENCH_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       0
+#endif //APP_SAADC_BENCH_CONFIG_LOG_ENABLED
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define CC_END     NRF_TIMER_CC_CHANNEL0 /**< Captures the SAADC END event through PPI. */
+#define CC_ENTER   NRF_TIMER_CC_CHANNEL1 /**< Captured on handler entry. */
+#define CC_STARTED NRF_TIMER_CC_CHANNEL2 /**< Captures the SAADC STARTED event through PPI. */
+#define CC_SET     NRF_TIMER_CC_CHANNEL3 /**< Captured when a buffer is handed over to the driver. */
+
+#define TICKS_PER_US 16 /**< The TIMER runs at 16 MHz. */
+
+/**@brief Converts TIMER ticks to nanoseconds. */
+#define TICKS_TO_NS(ticks) ((uint32_t)(((uint64_t)(ticks) * 1000) / TICKS_PER_US))
+
+static nrfx_timer_t const m_timer = NRFX_TIMER_INSTANCE(APP_SAADC_BENCH_CONFIG_TIMER_INSTANCE);
+
+NRF_BALLOC_DEF(m_buffer_pool,
+               APP_SAADC_BENCH_CONFIG_BUFFER_SIZE * sizeof(nrf_saadc_value_t),
+               APP_SAADC_BENCH_CONFIG_BUFFER_COUNT);
+
+/**@brief Benchmark control block. */
+typedef struct
+{
+    nrf_ppi_channel_t ppi_end;           ///< PPI channel capturing the END event.
+    nrf_ppi_channel_t ppi_started;       ///< PPI channel capturing the STARTED event.
+    bool              active;            ///< A scenario is running, the hooks record measurements.
+    volatile bool     stopped;           ///< The acquisition stopped.
+    bool              req_open;          ///< A buffer request has not been served yet.
+    volatile bool     aborted;           ///< Conversions were aborted, the next buffer is cut short.
+    bool              skip;              ///< The handler being run is not measured.
+    uint32_t          fill_ticks;        ///< Time to fill one buffer, in TIMER ticks.
+    uint32_t          enter_cycles;      ///< Cycle counter on handler entry.
+    uint32_t          buffers;           ///< Number of buffers delivered.
+    uint32_t          dropped;           ///< Number of times the acquisition ran out of buffers.
+    uint64_t          latency_sum;       ///< Sum of the handler entry latencies, in TIMER ticks.
+    uint32_t          latency_max;       ///< Largest handler entry latency, in TIMER ticks.
+    uint32_t          latency_count;     ///< Number of handler entry latencies.
+    uint64_t          duration_sum;      ///< Sum of the handler durations, in CPU cycles.
+    uint32_t          duration_max;      ///< Largest handler duration, in CPU cycles.
+    uint32_t          duration_count;    ///< Number of handler durations.
+    int32_t           slack_min;         ///< Smallest buffer request slack, in TIMER ticks.
+} app_saadc_bench_cb_t;
+
+static app_saadc_bench_cb_t m_cb;
+
+
+static void timer_evt_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    // No compare events are used, the TIMER only captures.
+    UNUSED_PARAMETER(event_type);
+    UNUSED_PARAMETER(p_context);
+}
+
+
+void app_saadc_bench_evt_enter(nrfx_saadc_evt_type_t type)
+{
+    if (!m_cb.active)
+    {
+        return;
+    }
+
+    nrf_gpio_pin_set(APP_SAADC_BENCH_CONFIG_PIN);
+    m_cb.enter_cycles = DWT->CYCCNT;
+    m_cb.skip         = false;
+
+    if ((type == NRFX_SAADC_EVT_DONE) && m_cb.aborted)
+    {
+        // The buffer was ended by the abort, not by its last conversion, so the END capture
+        // does not time it.
+        m_cb.aborted = false;
+        m_cb.skip    = true;
+    }
+    else if (type == NRFX_SAADC_EVT_DONE)
+    {
+        uint32_t latency = nrfx_timer_capture(&m_timer, CC_ENTER) -
+                           nrfx_timer_capture_get(&m_timer, CC_END);
+        m_cb.latency_sum += latency;
+        m_cb.latency_max  = MAX(m_cb.latency_max, latency);
+        m_cb.latency_count++;
+    }
+    else if (type == NRFX_SAADC_EVT_BUF_REQ)
+    {
+        m_cb.req_open = true;
+    }
+}
+
+
+void app_saadc_bench_evt_exit(void)
+{
+    if (!m_cb.active)
+    {
+        return;
+    }
+
+    if (!m_cb.skip)
+    {
+        uint32_t duration = DWT->CYCCNT - m_cb.enter_cycles;
+        m_cb.duration_sum += duration;
+        m_cb.duration_max  = MAX(m_cb.duration_max, duration);
+        m_cb.duration_count++;
+    }
+
+    nrf_gpio_pin_clear(APP_SAADC_BENCH_CONFIG_PIN);
+}
+
+
+void app_saadc_bench_buffer_set(void)
+{
+    if (!m_cb.active || !m_cb.req_open)
+    {
+        // Buffers set before the acquisition starts are not requested.
+        return;
+    }
+
+    uint32_t elapsed = nrfx_timer_capture(&m_timer, CC_SET) -
+                       nrfx_timer_capture_get(&m_timer, CC_STARTED);
+    int32_t  slack   = (int32_t)(m_cb.fill_ticks - elapsed);
+
+    m_cb.slack_min = MIN(m_cb.slack_min, slack);
+    m_cb.req_open  = false;
+}
+
+
+void app_saadc_bench_buffer_dropped(void)
+{
+    if (m_cb.active)
+    {
+        m_cb.dropped++;
+    }
+}
+
+
+void app_saadc_bench_abort(void)
+{
+    m_cb.aborted = m_cb.active;
+}
+
+
+static void saadc_evt_handler(app_saadc_evt_t const * p_event)
+{
+    switch (p_event->type)
+    {
+        case APP_SAADC_EVT_DONE:
+            m_cb.buffers++;
+            app_saadc_buffer_release(p_event->data.done.p_buffer);
+            break;
+
+        case APP_SAADC_EVT_STOPPED:
+            m_cb.stopped = true;
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+/**@brief Function for configuring the SAADC channels of a scenario. */
+static ret_code_t channels_config(uint8_t channel_count)
+{
+    nrfx_saadc_channel_t channels[NRF_SAADC_CHANNEL_COUNT];
+
+    for (uint8_t i = 0; i < channel_count; i++)
+    {
+        nrfx_saadc_channel_t channel =
+            NRFX_SAADC_DEFAULT_CHANNEL_SE((nrf_saadc_input_t)(NRF_SAADC_INPUT_AIN0 + i), i);
+        channels[i] = channel;
+    }
+
+    return nrfx_saadc_channels_config(channels, channel_count);
+}
+
+
+/**@brief Function for running one scenario. */
+static ret_code_t scenario_run(app_saadc_bench_scenario_t const * p_scenario,
+                               app_saadc_bench_result_t         * p_result)
+{
+    ret_code_t         err_code;
+    app_saadc_config_t config =
+    {
+        .channel_mask       = (1UL << p_scenario->channel_count) - 1,
+        .resolution         = NRF_SAADC_RESOLUTION_12BIT,
+        .oversampling       = NRF_SAADC_OVERSAMPLE_DISABLED,
+        .burst              = NRF_SAADC_BURST_DISABLED,
+        .sample_interval_us = p_scenario->sample_interval_us,
+        .p_buffer_pool      = &m_buffer_pool,
+        .buffer_size        = p_scenario->buffer_size,
+        .p_filter           = NULL,
+        .autorange          = false,
+    };
+
+    err_code = channels_config(p_scenario->channel_count);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = app_saadc_init(&config, saadc_evt_handler);
+    VERIFY_SUCCESS(err_code);
+
+    m_cb.fill_ticks     = (p_scenario->buffer_size / p_scenario->channel_count) *
+                          p_scenario->sample_interval_us * TICKS_PER_US;
+    m_cb.stopped        = false;
+    m_cb.req_open       = false;
+    m_cb.aborted        = false;
+    m_cb.buffers        = 0;
+    m_cb.dropped        = 0;
+    m_cb.latency_sum    = 0;
+    m_cb.latency_max    = 0;
+    m_cb.latency_count  = 0;
+    m_cb.duration_sum   = 0;
+    m_cb.duration_max   = 0;
+    m_cb.duration_count = 0;
+    m_cb.slack_min      = INT32_MAX;
+    m_cb.active         = true;
+
+    err_code = app_saadc_start();
+    if (err_code != NRF_SUCCESS)
+    {
+        m_cb.active = false;
+        app_saadc_uninit();
+        return err_code;
+    }
+
+    uint32_t const start    = app_timer_cnt_get();
+    uint32_t const duration = APP_TIMER_TICKS(p_scenario->duration_ms);
+
+    while (app_timer_cnt_diff_compute(app_timer_cnt_get(), start) < duration)
+    {
+        if (m_cb.stopped)
+        {
+            // Ran out of buffers, already counted as dropped. Keep measuring.
+            m_cb.stopped = false;
+            (void)app_saadc_start();
+        }
+        __WFE();
+    }
+
+    app_saadc_stop();
+    while (app_saadc_is_running() && !m_cb.stopped)
+    {
+        __WFE();
+    }
+    m_cb.active = false;
+    app_saadc_uninit();
+
+    p_result->buffers             = m_cb.buffers;
+    p_result->dropped             = m_cb.dropped;
+    p_result->latency_max_ns      = TICKS_TO_NS(m_cb.latency_max);
+    p_result->latency_avg_ns      = (m_cb.latency_count == 0) ? 0 :
+                                    TICKS_TO_NS(m_cb.latency_sum / m_cb.latency_count);
+    p_result->duration_max_cycles = m_cb.duration_max;
+    p_result->duration_avg_cycles = (m_cb.duration_count == 0) ? 0 :
+                                    (uint32_t)(m_cb.duration_sum / m_cb.duration_count);
+    p_result->slack_min_us        = (m_cb.slack_min == INT32_MAX) ? 0 :
+                                    m_cb.slack_min / TICKS_PER_US;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t app_saadc_bench_init(void)
+{
+    ret_code_t err_code;
+
+    // Enable the DWT cycle counter.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT       = 0;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    nrf_gpio_cfg_output(APP_SAADC_BENCH_CONFIG_PIN);
+    nrf_gpio_pin_clear(APP_SAADC_BENCH_CONFIG_PIN);
+
+    err_code = nrf_balloc_init(&m_buffer_pool);
+    VERIFY_SUCCESS(err_code);
+
+    nrfx_timer_config_t config = NRFX_TIMER_DEFAULT_CONFIG;
+    config.frequency = NRF_TIMER_FREQ_16MHz;
+    config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+    err_code = nrfx_timer_init(&m_timer, &config, timer_evt_handler);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = nrfx_ppi_channel_alloc(&m_cb.ppi_end);
+    if (err_code != NRF_SUCCESS)
+    {
+        nrfx_timer_uninit(&m_timer);
+        return NRF_ERROR_NO_MEM;
+    }
+
+    err_code = nrfx_ppi_channel_alloc(&m_cb.ppi_started);
+    if (err_code != NRF_SUCCESS)
+    {
+        (void)nrfx_ppi_channel_free(m_cb.ppi_end);
+        nrfx_timer_uninit(&m_timer);
+        return NRF_ERROR_NO_MEM;
+    }
+
+    APP_ERROR_CHECK(nrfx_ppi_channel_assign(m_cb.ppi_end,
+                                            nrf_saadc_event_address_get(NRF_SAADC_EVENT_END),
+                                            nrfx_timer_capture_task_address_get(&m_timer,
+                                                                                CC_END)));
+    APP_ERROR_CHECK(nrfx_ppi_channel_assign(m_cb.ppi_started,
+                                            nrf_saadc_event_address_get(NRF_SAADC_EVENT_STARTED),
+                                            nrfx_timer_capture_task_address_get(&m_timer,
+                                                                                CC_STARTED)));
+    APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_cb.ppi_end));
+    APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_cb.ppi_started));
+
+    // Free-running time base for the captures.
+    nrfx_timer_enable(&m_timer);
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t app_saadc_bench_run(app_saadc_bench_scenario_t const * p_scenarios,
+                               size_t                             count,
+                               bool                               ble_connected,
+                               app_saadc_bench_result_t         * p_results)
+{
+    ASSERT(p_scenarios);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        app_saadc_bench_scenario_t const * p_scenario = &p_scenarios[i];
+        app_saadc_bench_result_t           result;
+
+        if ((p_scenario->channel_count == 0) ||
+            (p_scenario->channel_count > NRF_SAADC_CHANNEL_COUNT) ||
+            (p_scenario->buffer_size == 0) ||
+            (p_scenario->buffer_size > APP_SAADC_BENCH_CONFIG_BUFFER_SIZE) ||
+            ((p_scenario->buffer_size % p_scenario->channel_count) != 0) ||
+            (APP_TIMER_TICKS(p_scenario->duration_ms) > APP_TIMER_MAX_CNT_VAL))
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+
+        ret_code_t err_code = scenario_run(p_scenario, &result);
+        VERIFY_SUCCESS(err_code);
+
+        NRF_LOG_INFO("%s: %u us, %u channels, %u samples per buffer",
+                     ble_connected ? "BLE connected" : "BLE idle",
+                     p_scenario->sample_interval_us,
+                     p_scenario->channel_count,
+                     p_scenario->buffer_size);
+        NRF_LOG_INFO("  buffers: %u, dropped: %u, slack min: %d us",
+                     result.buffers, result.dropped, result.slack_min_us);
+        NRF_LOG_INFO("  entry latency avg: %u ns, max: %u ns",
+                     result.latency_avg_ns, result.latency_max_ns);
+        NRF_LOG_INFO("  handler avg: %u cycles, max: %u cycles",
+                     result.duration_avg_cycles, result.duration_max_cycles);
+
+        if (p_results != NULL)
+        {
+            p_results[i] = result;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SAADC_BENCH)
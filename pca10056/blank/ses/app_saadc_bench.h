@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc_bench SAADC latency and throughput benchmark
+ * @{
+ * @ingroup app_saadc
+ *
+ * @brief Measurement of the SAADC event handling cost under a configurable acquisition load.
+ *
+ * @details The benchmark runs @ref app_saadc through a list of scenarios (sample interval,
+ *          channel count, buffer size) and, for each of them, measures:
+ *          - Handler entry latency: time from the SAADC END event to the entry of the
+ *            app_saadc event handler. The END event is captured in hardware by a TIMER
+ *            through PPI, so the measurement includes the driver IRQ processing. The buffer
+ *            delivered after an abort is not measured.
+ *          - Handler duration, in CPU cycles from the DWT cycle counter. This includes the
+ *            time spent in the application handler.
+ *          - Buffer request slack: time left to fill the buffer being converted when the
+ *            next buffer is handed over to the driver, counted from the SAADC STARTED event.
+ *          - Number of buffers dropped because no buffer was available on time.
+ *
+ *          A GPIO is held high while the handler runs, for measurements with a scope or a
+ *          logic analyzer. Results are reported through nrf_log.
+ *
+ *          The module uses the TIMER instance and the GPIO selected in the configuration, and
+ *          two PPI channels.
+ */
+
+#ifndef APP_SAADC_BENCH_H__
+#define APP_SAADC_BENCH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sdk_errors.h"
+#include "nordic_common.h"
+#include "sdk_config.h"
+#include "nrfx_saadc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Benchmark scenario. */
+typedef struct
+{
+    uint32_t sample_interval_us; ///< Interval between sample frames, in microseconds.
+    uint8_t  channel_count;      ///< Number of channels, configured single-ended on AIN0 upwards.
+    uint16_t buffer_size;        ///< Number of samples in each buffer. At most @ref APP_SAADC_BENCH_CONFIG_BUFFER_SIZE.
+    uint32_t duration_ms;        ///< Duration of the acquisition, in milliseconds.
+} app_saadc_bench_scenario_t;
+
+/**@brief Results of a scenario. */
+typedef struct
+{
+    uint32_t buffers;             ///< Number of buffers delivered.
+    uint32_t dropped;             ///< Number of times the acquisition ran out of buffers.
+    uint32_t latency_max_ns;      ///< Largest handler entry latency, in nanoseconds.
+    uint32_t latency_avg_ns;      ///< Average handler entry latency, in nanoseconds.
+    uint32_t duration_max_cycles; ///< Largest handler duration, in CPU cycles.
+    uint32_t duration_avg_cycles; ///< Average handler duration, in CPU cycles.
+    int32_t  slack_min_us;        ///< Smallest buffer request slack, in microseconds. Negative if a buffer was late.
+} app_saadc_bench_result_t;
+
+/**@brief Function for initializing the benchmark.
+ *
+ * @details The SAADC driver must be initialized with @ref nrfx_saadc_init before, and
+ *          @ref app_saadc must not be initialized.
+ *
+ * @retval NRF_SUCCESS      If the benchmark was initialized.
+ * @retval NRF_ERROR_NO_MEM If no PPI channel is available.
+ * @retval Other            Error from the TIMER driver.
+ */
+ret_code_t app_saadc_bench_init(void);
+
+/**@brief Function for running scenarios.
+ *
+ * @details Blocks until all scenarios are done, and logs the results of each of them.
+ *          BLE activity continues in interrupt context during the run.
+ *
+ * @param[in]  p_scenarios   Array of scenarios.
+ * @param[in]  count         Number of scenarios.
+ * @param[in]  ble_connected Whether a BLE connection is active, only used to label the results.
+ * @param[out] p_results     Array of @p count results, or NULL.
+ *
+ * @retval NRF_SUCCESS             If all scenarios were run.
+ * @retval NRF_ERROR_INVALID_PARAM If a scenario is out of range.
+ * @retval Other                   Error from @ref app_saadc.
+ */
+ret_code_t app_saadc_bench_run(app_saadc_bench_scenario_t const * p_scenarios,
+                               size_t                             count,
+                               bool                               ble_connected,
+                               app_saadc_bench_result_t         * p_results);
+
+#if NRF_MODULE_ENABLED(APP_SAADC_BENCH) || defined(__SDK_DOXYGEN__)
+/**@brief Hook called by @ref app_saadc when a driver event handler is entered. */
+void app_saadc_bench_evt_enter(nrfx_saadc_evt_type_t type);
+
+/**@brief Hook called by @ref app_saadc when a driver event handler returns. */
+void app_saadc_bench_evt_exit(void);
+
+/**@brief Hook called by @ref app_saadc when a buffer is handed over to the driver. */
+void app_saadc_bench_buffer_set(void);
+
+/**@brief Hook called by @ref app_saadc when the acquisition ran out of buffers. */
+void app_saadc_bench_buffer_dropped(void);
+
+/**@brief Hook called by @ref app_saadc before the conversions are aborted. */
+void app_saadc_bench_abort(void);
+#else
+#define app_saadc_bench_evt_enter(type)
+#define app_saadc_bench_evt_exit()
+#define app_saadc_bench_buffer_set()
+#define app_saadc_bench_buffer_dropped()
+#define app_saadc_bench_abort()
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_BENCH_H__
+
+/** @} */
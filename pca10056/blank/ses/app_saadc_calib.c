@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC_CALIB)
+#include "app_saadc_calib.h"
+#include "app_saadc.h"
+#include "app_timer.h"
+#include "nrf.h"
+#ifdef SOFTDEVICE_PRESENT
+#include "nrf_soc.h"
+#endif
+
+#define NRF_LOG_MODULE_NAME app_saadc_calib
+#if APP_SAADC_CALIB_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       APP_SAADC_CALIB_CONFIG_LOG_LEVEL
+#define NRF_LOG_INFO_COLOR  APP_SAADC_CALIB_CONFIG_INFO_COLOR
+#define NRF_LOG_DEBUG_COLOR APP_SAADC_CALIB_CONFIG_DEBUG_COLOR
+#else //APP_SAADC_CALIB_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       0
+#endif //APP_SAADC_CALIB_CONFIG_LOG_ENABLED
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+/**@brief Scheduler control block. */
+typedef struct
+{
+    uint16_t temp_step;     ///< Temperature change that requires a calibration, in 0.25 degree units.
+    uint32_t min_ticks;     ///< Shortest time between two calibrations, in app_timer ticks.
+    uint32_t max_ticks;     ///< Longest time between two calibrations, in app_timer ticks, or 0.
+    uint32_t last_ticks;    ///< app_timer counter value at the previous check.
+    uint64_t elapsed_ticks; ///< Time since the last calibration, in app_timer ticks.
+    int32_t  calib_temp;    ///< Die temperature at the last calibration, in 0.25 degree units.
+    bool     forced;        ///< Calibration requested regardless of temperature and time.
+} app_saadc_calib_cb_t;
+
+static app_saadc_calib_cb_t m_cb;
+
+
+/**@brief Function for reading the die temperature, in 0.25 degree Celsius units. */
+static int32_t temp_read(void)
+{
+    int32_t temp;
+
+#ifdef SOFTDEVICE_PRESENT
+    // The TEMP peripheral is restricted while the SoftDevice is enabled.
+    APP_ERROR_CHECK(sd_temp_get(&temp));
+#else
+    NRF_TEMP->EVENTS_DATARDY = 0;
+    NRF_TEMP->TASKS_START    = 1;
+    while (NRF_TEMP->EVENTS_DATARDY == 0)
+    {}
+    NRF_TEMP->EVENTS_DATARDY = 0;
+    temp = (int32_t)NRF_TEMP->TEMP;
+    NRF_TEMP->TASKS_STOP     = 1;
+#endif
+
+    return temp;
+}
+
+
+ret_code_t app_saadc_calib_init(app_saadc_calib_config_t const * p_config)
+{
+    ASSERT(p_config);
+
+    if ((p_config->max_interval_ms != 0) &&
+        (p_config->min_interval_ms > p_config->max_interval_ms))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    m_cb.temp_step     = p_config->temp_step;
+    m_cb.min_ticks     = APP_TIMER_TICKS(p_config->min_interval_ms);
+    m_cb.max_ticks     = APP_TIMER_TICKS(p_config->max_interval_ms);
+    m_cb.last_ticks    = app_timer_cnt_get();
+    m_cb.elapsed_ticks = 0;
+    m_cb.calib_temp    = 0;
+    m_cb.forced        = true;
+
+    return NRF_SUCCESS;
+}
+
+
+bool app_saadc_calib_process(void)
+{
+    uint32_t ticks = app_timer_cnt_get();
+
+    m_cb.elapsed_ticks += app_timer_cnt_diff_compute(ticks, m_cb.last_ticks);
+    m_cb.last_ticks     = ticks;
+
+    if (!m_cb.forced && (m_cb.elapsed_ticks < m_cb.min_ticks))
+    {
+        // Skip the temperature measurement until a calibration is allowed.
+        return false;
+    }
+
+    int32_t temp  = temp_read();
+    int32_t drift = temp - m_cb.calib_temp;
+    bool    due   = m_cb.forced;
+
+    if ((drift >= (int32_t)m_cb.temp_step) || (-drift >= (int32_t)m_cb.temp_step))
+    {
+        due = true;
+    }
+    if ((m_cb.max_ticks != 0) && (m_cb.elapsed_ticks >= m_cb.max_ticks))
+    {
+        due = true;
+    }
+    if (!due)
+    {
+        return false;
+    }
+
+    ret_code_t err_code = app_saadc_calibrate();
+    if (err_code != NRF_SUCCESS)
+    {
+        // Monitor mode or driver busy, retry on the next check.
+        NRF_LOG_DEBUG("Calibration postponed, error: %d.", err_code);
+        return false;
+    }
+
+    NRF_LOG_INFO("Calibration requested, temperature %d, drift %d (0.25 C units).", temp, drift);
+    m_cb.calib_temp    = temp;
+    m_cb.elapsed_ticks = 0;
+    m_cb.forced        = false;
+
+    return true;
+}
+
+
+void app_saadc_calib_force(void)
+{
+    m_cb.forced = true;
+}
+
+
+int32_t app_saadc_calib_temp_get(void)
+{
+    return m_cb.calib_temp;
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SAADC_CALIB)
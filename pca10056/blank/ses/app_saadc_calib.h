@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc_calib SAADC offset calibration scheduler
+ * @{
+ * @ingroup app_saadc
+ *
+ * @brief Decides when the SAADC offset calibration is needed, from die temperature and time.
+ *
+ * @details The SAADC offset drifts mainly with temperature. Instead of calibrating on a fixed
+ *          period, the scheduler reads the on-die temperature sensor and requests a
+ *          calibration from @ref app_saadc_calibrate when the temperature has moved by more
+ *          than a configured step since the last calibration, or when the longest allowed
+ *          interval has elapsed. A running acquisition is calibrated in the gap between two
+ *          buffers.
+ *
+ *          @ref app_saadc_calib_process is expected to be called periodically from the main
+ *          loop, at least once per app_timer counter period.
+ */
+
+#ifndef APP_SAADC_CALIB_H__
+#define APP_SAADC_CALIB_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Scheduler configuration. */
+typedef struct
+{
+    uint16_t temp_step;       ///< Temperature change that requires a calibration, in 0.25 degree Celsius units.
+    uint32_t min_interval_ms; ///< Shortest time between two calibrations, in milliseconds.
+    uint32_t max_interval_ms; ///< Longest time between two calibrations, in milliseconds. 0 disables the time limit.
+} app_saadc_calib_config_t;
+
+/**@brief Function for initializing the scheduler.
+ *
+ * @details The first call to @ref app_saadc_calib_process requests a calibration.
+ *
+ * @param[in] p_config Scheduler configuration.
+ *
+ * @retval NRF_SUCCESS             If the scheduler was initialized.
+ * @retval NRF_ERROR_INVALID_PARAM If the minimum interval is longer than the maximum interval.
+ */
+ret_code_t app_saadc_calib_init(app_saadc_calib_config_t const * p_config);
+
+/**@brief Function for checking whether a calibration is needed, and requesting it.
+ *
+ * @retval true  If a calibration was requested.
+ * @retval false Otherwise.
+ */
+bool app_saadc_calib_process(void);
+
+/**@brief Function for requesting a calibration on the next call to @ref app_saadc_calib_process,
+ *        regardless of temperature and time.
+ */
+void app_saadc_calib_force(void);
+
+/**@brief Function for getting the die temperature at the last calibration.
+ *
+ * @return Temperature in 0.25 degree Celsius units.
+ */
+int32_t app_saadc_calib_temp_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_CALIB_H__
+
+/** @} */
@@ -0,0 +1,580 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC_FEATURES)
+#include <stdlib.h>
+#include <string.h>
+#include "app_saadc_features.h"
+#include "app_util.h"
+#include "nrf.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define APP_SAADC_FEATURES_DSP 1
+#else
+#define APP_SAADC_FEATURES_DSP 0
+#endif
+
+STATIC_ASSERT((APP_SAADC_FEATURES_FFT_LOG2 >= 6) && (APP_SAADC_FEATURES_FFT_LOG2 <= 10));
+STATIC_ASSERT(APP_SAADC_FEATURES_BANDS_MAX < APP_SAADC_FEATURES_FFT_SIZE / 2);
+
+#define FFT_SIZE        APP_SAADC_FEATURES_FFT_SIZE        /**< Number of real samples transformed. */
+#define FFT_HALF        (FFT_SIZE / 2)                     /**< Length of the complex FFT, and number of bins below Nyquist. */
+#define ANGLE_SHIFT     (10 - APP_SAADC_FEATURES_FFT_LOG2) /**< Converts an angle in 2*pi/FFT_SIZE units to the sine table resolution. */
+#define INPUT_LOG2      14                                 /**< Windowed samples are normalized to below 2^14, so complex values stay below 2^15 in magnitude. */
+#define AMPLITUDE_SHIFT 5                                  /**< 2 bits of Hann and one-sided spectrum gain, less 1 bit of FFT output scaling, and 4 bits for the 1/16 count unit. */
+#define DB2_PER_LOG2_Q8 3083                               /**< 2 * 20 * log10(2) / 256, in Q16 format. */
+
+/**@brief Quarter wave of sin(2 * pi * i / 1024), in Q15 format. */
+static int16_t const m_sin_q15[257] =
+{
+        0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,
+     2410,  2611,  2811,  3012,  3212,  3412,  3612,  3811,  4011,  4210,  4410,  4609,
+     4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,  6393,  6590,  6786,  6983,
+     7179,  7375,  7571,  7767,  7962,  8157,  8351,  8545,  8739,  8933,  9126,  9319,
+     9512,  9704,  9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605,
+    11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+    14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269, 15446, 15623, 15800, 15976,
+    16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+    18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000,
+    20159, 20317, 20475, 20631, 20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+    22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311, 23452, 23592,
+    23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+    25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198, 26319, 26438, 26556, 26674,
+    26790, 26905, 27019, 27133, 27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+    28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177,
+    29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+    30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783, 30852, 30919, 30985, 31050,
+    31113, 31176, 31237, 31297, 31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736,
+    31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098, 32137, 32176, 32213, 32250,
+    32285, 32318, 32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+    32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752,
+    32757, 32761, 32765, 32766, 32767,
+};
+
+/**@brief log2(1 + i / 16), in Q8 format. */
+static uint8_t const m_log2_frac_q8[16] =
+{
+    0, 22, 44, 63, 82, 100, 118, 134, 150, 165, 179, 193, 207, 220, 232, 244
+};
+
+
+/**@brief Function for computing the sine of an angle in 2*pi/1024 units, in Q15 format. */
+static int32_t sin_q15(uint32_t angle)
+{
+    uint32_t idx = angle & 0xFF;
+
+    switch ((angle >> 8) & 3)
+    {
+        case 0:
+            return m_sin_q15[idx];
+        case 1:
+            return m_sin_q15[256 - idx];
+        case 2:
+            return -m_sin_q15[idx];
+        default:
+            return -m_sin_q15[256 - idx];
+    }
+}
+
+
+/**@brief Function for computing the cosine of an angle in 2*pi/1024 units, in Q15 format. */
+__STATIC_INLINE int32_t cos_q15(uint32_t angle)
+{
+    return sin_q15(angle + 256);
+}
+
+
+/**@brief Function for computing the Hann window coefficient of a sample, in Q15 format. */
+__STATIC_INLINE int32_t hann_q15(uint32_t n)
+{
+    return (32767 - cos_q15(n << ANGLE_SHIFT)) >> 1;
+}
+
+
+/**@brief Function for computing the integer square root of a 32-bit value. */
+static uint32_t isqrt32(uint32_t x)
+{
+    uint32_t root = 0;
+    uint32_t bit  = 1UL << 30;
+
+    while (bit > x)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (x >= root + bit)
+        {
+            x   -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+
+/**@brief Function for computing the integer square root of a 64-bit value. */
+static uint32_t isqrt64(uint64_t x)
+{
+    uint64_t root = 0;
+    uint64_t bit  = 1ULL << 62;
+
+    while (bit > x)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (x >= root + bit)
+        {
+            x   -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+
+/**@brief Function for computing the base 2 logarithm of a nonzero value, in Q8 format. */
+static int32_t log2_q8(uint32_t x)
+{
+    int32_t  exp = 31 - (int32_t)__CLZ(x);
+    uint32_t frac;
+
+    frac = (exp >= 4) ? (x >> (exp - 4)) : (x << (4 - exp));
+    return (exp << 8) + m_log2_frac_q8[frac & 0x0F];
+}
+
+
+/**@brief Function for performing one radix-2 butterfly on packed complex values.
+ *
+ * @details Computes a = (a + b) / 2 and b = ((a - b) / 2) * (cos - j * sin).
+ */
+__STATIC_INLINE void butterfly(int16_t * p_a, int16_t * p_b, int32_t cos, int32_t sin)
+{
+#if APP_SAADC_FEATURES_DSP
+    uint32_t a  = __UNALIGNED_UINT32_READ(p_a);
+    uint32_t b  = __UNALIGNED_UINT32_READ(p_b);
+    uint32_t t  = __SHSUB16(a, b);
+    uint32_t cs = (uint32_t)(cos & 0xFFFF) | ((uint32_t)sin << 16);
+    int32_t  re = (int32_t)__SMUAD(t, cs);
+    int32_t  im = (int32_t)__SMUSDX(cs, t);
+
+    __UNALIGNED_UINT32_WRITE(p_a, __SHADD16(a, b));
+    __UNALIGNED_UINT32_WRITE(p_b, __PKHBT(re >> 15, im >> 15, 16));
+#else
+    int32_t tr = (p_a[0] - p_b[0]) >> 1;
+    int32_t ti = (p_a[1] - p_b[1]) >> 1;
+
+    p_a[0] = (int16_t)((p_a[0] + p_b[0]) >> 1);
+    p_a[1] = (int16_t)((p_a[1] + p_b[1]) >> 1);
+    p_b[0] = (int16_t)((tr * cos + ti * sin) >> 15);
+    p_b[1] = (int16_t)((ti * cos - tr * sin) >> 15);
+#endif
+}
+
+
+/**@brief Function for computing the complex FFT of @ref FFT_HALF values in place.
+ *
+ * @details Radix-2 decimation in frequency, followed by a bit reversal of the output. Each
+ *          stage scales by one half, so the output is the transform divided by @ref FFT_HALF.
+ *          The split step in @ref bin_magnitude keeps that scaling, so the real spectrum is
+ *          divided by @ref FFT_HALF as well.
+ *
+ * @param[inout] p_data Interleaved real and imaginary parts.
+ */
+static void fft_q15(int16_t * p_data)
+{
+    for (uint32_t len = FFT_HALF; len >= 2; len >>= 1)
+    {
+        uint32_t half = len >> 1;
+        uint32_t step = FFT_HALF / len;
+
+        for (uint32_t j = 0; j < half; j++)
+        {
+            // The twiddle angle is 2 * pi * j * step / FFT_HALF.
+            uint32_t angle = (2 * j * step) << ANGLE_SHIFT;
+            int32_t  cos   = cos_q15(angle);
+            int32_t  sin   = sin_q15(angle);
+
+            for (uint32_t i = j; i < FFT_HALF; i += len)
+            {
+                butterfly(&p_data[2 * i], &p_data[2 * (i + half)], cos, sin);
+            }
+        }
+    }
+
+    for (uint32_t i = 1, j = 0; i < FFT_HALF; i++)
+    {
+        uint32_t bit = FFT_HALF >> 1;
+
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+
+        if (i < j)
+        {
+            uint32_t tmp = __UNALIGNED_UINT32_READ(&p_data[2 * i]);
+            __UNALIGNED_UINT32_WRITE(&p_data[2 * i], __UNALIGNED_UINT32_READ(&p_data[2 * j]));
+            __UNALIGNED_UINT32_WRITE(&p_data[2 * j], tmp);
+        }
+    }
+}
+
+
+/**@brief Function for computing the magnitude of a bin with the real FFT split step.
+ *
+ * @details With Z the complex FFT of the even and odd samples packed as real and imaginary
+ *          parts, X[k] = (Z[k] + Z*[N/2 - k]) / 2 - j * W^k * (Z[k] - Z*[N/2 - k]) / 2.
+ *
+ * @param[in] p_data Output of @ref fft_q15.
+ * @param[in] k      Bin, from 1 to @ref FFT_HALF - 1.
+ *
+ * @return Magnitude of the bin, scaled like the normalized input.
+ */
+static uint32_t bin_magnitude(int16_t const * p_data, uint32_t k)
+{
+    int32_t ar = p_data[2 * k];
+    int32_t ai = p_data[2 * k + 1];
+    int32_t br = p_data[2 * (FFT_HALF - k)];
+    int32_t bi = p_data[2 * (FFT_HALF - k) + 1];
+    int32_t dr = ar - br;
+    int32_t di = ai + bi;
+    int32_t c  = cos_q15(k << ANGLE_SHIFT);
+    int32_t s  = sin_q15(k << ANGLE_SHIFT);
+    int32_t re = ((ar + br) + ((c * di - s * dr) >> 15)) >> 1;
+    int32_t im = ((ai - bi) - ((c * dr + s * di) >> 15)) >> 1;
+
+    return isqrt32((uint32_t)(re * re) + (uint32_t)(im * im));
+}
+
+
+/**@brief Function for converting a bin magnitude to a band value.
+ *
+ * @param[in] mag   Magnitude from @ref bin_magnitude.
+ * @param[in] shift Normalization shift applied to the input.
+ *
+ * @return Sine amplitude in steps of 0.5 dB above 1/16 count, saturated to 0 and 255.
+ */
+static uint8_t band_value(uint32_t mag, int32_t shift)
+{
+    if (mag == 0)
+    {
+        return 0;
+    }
+
+    int32_t db2 = ((log2_q8(mag) + ((AMPLITUDE_SHIFT - shift) * 256)) * DB2_PER_LOG2_Q8) >> 16;
+
+    return (uint8_t)MIN(MAX(db2, 0), UINT8_MAX);
+}
+
+
+/**@brief Function for computing the spectral features of the normalized window.
+ *
+ * @param[in]    p_inst  Feature extraction instance, with the window transformed by @ref fft_q15.
+ * @param[in]    shift   Normalization shift applied to the input.
+ * @param[inout] p_frame Frame, completed with the bands and the peak frequency.
+ */
+static void spectrum_features(app_saadc_features_t const * p_inst,
+                              int32_t                      shift,
+                              app_saadc_features_frame_t * p_frame)
+{
+    int16_t const * p_data    = p_inst->window;
+    uint8_t         bands     = p_inst->config.band_count;
+    uint8_t         band      = 0;
+    uint32_t        band_end  = 1 + (FFT_HALF - 1) / bands;
+    uint32_t        band_max  = 0;
+    uint32_t        prev      = (uint32_t)abs(p_data[0] + p_data[1]) >> 1;
+    uint32_t        peak_bin  = 0;
+    uint32_t        peak_mag  = 0;
+    uint32_t        peak_prev = 0;
+    uint32_t        peak_next = 0;
+
+    for (uint32_t k = 1; k < FFT_HALF; k++)
+    {
+        uint32_t mag = bin_magnitude(p_data, k);
+
+        if (k == peak_bin + 1)
+        {
+            peak_next = mag;
+        }
+        if (mag > peak_mag)
+        {
+            peak_bin  = k;
+            peak_mag  = mag;
+            peak_prev = prev;
+        }
+        prev = mag;
+
+        band_max = MAX(band_max, mag);
+        if (k + 1 == band_end)
+        {
+            p_frame->bands[band++] = band_value(band_max, shift);
+            band_end               = 1 + ((band + 1) * (FFT_HALF - 1)) / bands;
+            band_max               = 0;
+        }
+    }
+
+    if (peak_mag == 0)
+    {
+        p_frame->peak_freq = 0;
+        return;
+    }
+
+    if (peak_bin == FFT_HALF - 1)
+    {
+        // The neighbour above is the Nyquist bin, which is real.
+        peak_next = (uint32_t)abs(p_data[0] - p_data[1]) >> 1;
+    }
+
+    // Parabolic interpolation: offset = (prev - next) / (2 * (prev - 2 * peak + next)), in 1/16 bins.
+    int32_t denom  = (int32_t)peak_prev - 2 * (int32_t)peak_mag + (int32_t)peak_next;
+    int32_t offset = 0;
+
+    if (denom != 0)
+    {
+        offset = (8 * ((int32_t)peak_prev - (int32_t)peak_next)) / denom;
+        offset = MIN(MAX(offset, -8), 8);
+    }
+
+    p_frame->peak_freq = (uint32_t)(((uint64_t)((int32_t)(peak_bin << 4) + offset) *
+                                     p_inst->config.sample_rate) / FFT_SIZE);
+}
+
+
+/**@brief Function for computing the features of a full window.
+ *
+ * @details The window is overwritten with its transform.
+ */
+static void features_compute(app_saadc_features_t * p_inst, app_saadc_features_frame_t * p_frame)
+{
+    int16_t * p_x    = p_inst->window;
+    int32_t   sum    = 0;
+    uint64_t  sumsq  = 0;
+    uint32_t  peak   = 0;
+    uint32_t  wmax   = 0;
+    int32_t   shift;
+
+    memset(p_frame, 0, sizeof(*p_frame));
+    p_frame->seq        = p_inst->seq++;
+    p_frame->band_count = p_inst->config.band_count;
+
+    for (uint32_t n = 0; n < FFT_SIZE; n++)
+    {
+        sum += p_x[n];
+    }
+    int32_t mean = sum / (int32_t)FFT_SIZE;
+
+    for (uint32_t n = 0; n < FFT_SIZE; n++)
+    {
+        int32_t  d   = p_x[n] - mean;
+        uint32_t dev = (uint32_t)abs(d);
+        int32_t  w   = (int32_t)(((int64_t)d * hann_q15(n)) >> 15);
+
+        sumsq += dev * dev;
+        peak   = MAX(peak, dev);
+        wmax   = MAX(wmax, (uint32_t)abs(w));
+    }
+
+    // Correct for the truncation of the mean: sum((x - m)^2) = sumsq - r^2 / N, r = sum(x - m).
+    int64_t residual = sum - mean * (int32_t)FFT_SIZE;
+
+    sumsq = (sumsq << 8) - (uint64_t)((residual * residual << 8) / FFT_SIZE);
+
+    p_frame->mean = (int16_t)mean;
+    p_frame->rms  = isqrt64(sumsq / FFT_SIZE);
+    p_frame->peak = (uint16_t)peak;
+    if (p_frame->rms != 0)
+    {
+        p_frame->crest = (uint16_t)MIN(((uint64_t)peak << 12) / p_frame->rms, UINT16_MAX);
+    }
+
+    if (wmax == 0)
+    {
+        return;
+    }
+
+    // Block floating point: scale the windowed samples so the largest one is just below 2^14.
+    shift = (INPUT_LOG2 - 1) - (31 - (int32_t)__CLZ(wmax));
+    for (uint32_t n = 0; n < FFT_SIZE; n++)
+    {
+        int32_t w = (int32_t)(((int64_t)(p_x[n] - mean) * hann_q15(n)) >> 15);
+
+        p_x[n] = (int16_t)((shift >= 0) ? (w * (1L << shift)) : (w >> -shift));
+    }
+
+    // The even and odd samples are the real and imaginary parts of a complex FFT of half length.
+    fft_q15(p_x);
+    spectrum_features(p_inst, shift, p_frame);
+}
+
+
+ret_code_t app_saadc_features_init(app_saadc_features_t              * p_inst,
+                                   app_saadc_features_config_t const * p_config)
+{
+    ASSERT(p_inst);
+    ASSERT(p_config);
+    VERIFY_PARAM_NOT_NULL(p_config->handler);
+
+    if ((p_config->channel_count == 0)                        ||
+        (p_config->channel_count > NRF_SAADC_CHANNEL_COUNT)   ||
+        (p_config->channel_idx >= p_config->channel_count)    ||
+        (p_config->band_count == 0)                           ||
+        (p_config->band_count > APP_SAADC_FEATURES_BANDS_MAX) ||
+        (p_config->sample_rate == 0))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    memset(p_inst, 0, sizeof(*p_inst));
+    p_inst->config = *p_config;
+
+    return NRF_SUCCESS;
+}
+
+
+void app_saadc_features_reset(app_saadc_features_t * p_inst)
+{
+    ASSERT(p_inst);
+
+    p_inst->fill = 0;
+}
+
+
+uint16_t app_saadc_features_process(app_saadc_features_t    * p_inst,
+                                    nrf_saadc_value_t const * p_buffer,
+                                    uint16_t                  size)
+{
+    ASSERT(p_inst);
+    ASSERT(p_buffer);
+    ASSERT((size % p_inst->config.channel_count) == 0);
+
+    uint16_t frames = 0;
+
+    for (uint16_t i = p_inst->config.channel_idx; i < size; i += p_inst->config.channel_count)
+    {
+        p_inst->window[p_inst->fill++] = p_buffer[i];
+        if (p_inst->fill == FFT_SIZE)
+        {
+            app_saadc_features_frame_t frame;
+
+            features_compute(p_inst, &frame);
+            p_inst->fill = 0;
+            p_inst->config.handler(&frame, p_inst->config.p_context);
+            frames++;
+        }
+    }
+
+    return frames;
+}
+
+
+ret_code_t app_saadc_features_frame_encode(app_saadc_features_frame_t const * p_frame,
+                                           uint8_t                          * p_data,
+                                           size_t                             size,
+                                           size_t                           * p_length)
+{
+    ASSERT(p_frame);
+    ASSERT(p_data);
+    ASSERT(p_length);
+    ASSERT(p_frame->band_count <= APP_SAADC_FEATURES_BANDS_MAX);
+
+    size_t len = 0;
+
+    if (size < APP_SAADC_FEATURES_FRAME_HEADER_SIZE + (size_t)p_frame->band_count)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    p_data[len++] = p_frame->seq;
+    p_data[len++] = p_frame->band_count;
+    len += uint16_encode((uint16_t)p_frame->mean, &p_data[len]);
+    len += uint24_encode(MIN(p_frame->rms, 0xFFFFFF), &p_data[len]);
+    len += uint16_encode(p_frame->peak, &p_data[len]);
+    len += uint16_encode(p_frame->crest, &p_data[len]);
+    len += uint24_encode(MIN(p_frame->peak_freq, 0xFFFFFF), &p_data[len]);
+    memcpy(&p_data[len], p_frame->bands, p_frame->band_count);
+    len += p_frame->band_count;
+
+    *p_length = len;
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t app_saadc_features_frame_decode(uint8_t const              * p_data,
+                                           size_t                       length,
+                                           app_saadc_features_frame_t * p_frame)
+{
+    ASSERT(p_data);
+    ASSERT(p_frame);
+
+    if ((length < APP_SAADC_FEATURES_FRAME_HEADER_SIZE) ||
+        (p_data[1] > APP_SAADC_FEATURES_BANDS_MAX)      ||
+        (length != APP_SAADC_FEATURES_FRAME_HEADER_SIZE + (size_t)p_data[1]))
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+
+    memset(p_frame, 0, sizeof(*p_frame));
+    p_frame->seq        = p_data[0];
+    p_frame->band_count = p_data[1];
+    p_frame->mean       = (int16_t)uint16_decode(&p_data[2]);
+    p_frame->rms        = uint24_decode(&p_data[4]);
+    p_frame->peak       = uint16_decode(&p_data[7]);
+    p_frame->crest      = uint16_decode(&p_data[9]);
+    p_frame->peak_freq  = uint24_decode(&p_data[11]);
+    memcpy(p_frame->bands, &p_data[APP_SAADC_FEATURES_FRAME_HEADER_SIZE], p_frame->band_count);
+
+    return NRF_SUCCESS;
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SAADC_FEATURES)
@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc_features SAADC spectral feature extraction stage
+ * @{
+ * @ingroup app_saadc
+ *
+ * @brief Windowed FFT, RMS, crest factor and peak frequency of one SAADC channel.
+ *
+ * @details The stage collects the samples of one channel from the interleaved buffers
+ *          delivered in @ref APP_SAADC_EVT_DONE, or in @c NRFX_SAADC_EVT_DONE when the
+ *          driver is used directly. Buffers are only read, so they can still be passed to
+ *          the next stage, for example @ref app_saadc_pack. Each time
+ *          @ref APP_SAADC_FEATURES_FFT_SIZE samples have been collected, a feature frame is
+ *          computed and passed to the handler, in the context of
+ *          @ref app_saadc_features_process:
+ *
+ *          - The mean of the window is removed, then RMS, peak deviation and crest factor
+ *            are computed on the samples.
+ *          - The samples are weighted with a Hann window and normalized to a common block
+ *            exponent, then transformed with a Q15 real FFT. The real FFT is computed as a
+ *            complex FFT of half the length followed by a split step, with a scaling by
+ *            one half in each stage so the fixed-point values cannot overflow.
+ *          - The bins above DC are split into bands of equal width, and the largest
+ *            amplitude in each band is stored in steps of 0.5 dB. The peak frequency is
+ *            the largest bin, refined by parabolic interpolation of its neighbours.
+ *
+ *          A frame encoded with @ref app_saadc_features_frame_encode takes
+ *          @ref APP_SAADC_FEATURES_FRAME_HEADER_SIZE bytes plus one byte per band, which fits
+ *          a single @ref ble_nus notification with up to 6 bands at the default ATT MTU.
+ *
+ *          On cores with the DSP extension, the butterflies use halving SIMD additions
+ *          and dual multiplications on packed complex values.
+ */
+
+#ifndef APP_SAADC_FEATURES_H__
+#define APP_SAADC_FEATURES_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sdk_errors.h"
+#include "sdk_config.h"
+#include "nrf_saadc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef APP_SAADC_FEATURES_FFT_LOG2
+#define APP_SAADC_FEATURES_FFT_LOG2 8
+#endif
+
+#ifndef APP_SAADC_FEATURES_BANDS_MAX
+#define APP_SAADC_FEATURES_BANDS_MAX 8
+#endif
+
+#define APP_SAADC_FEATURES_FFT_SIZE         (1UL << APP_SAADC_FEATURES_FFT_LOG2) /**< Number of samples in each window. */
+#define APP_SAADC_FEATURES_FRAME_HEADER_SIZE 14                                  /**< Number of bytes in an encoded frame before the bands. */
+
+/**@brief Maximum number of bytes in an encoded frame. */
+#define APP_SAADC_FEATURES_FRAME_MAX_SIZE (APP_SAADC_FEATURES_FRAME_HEADER_SIZE + APP_SAADC_FEATURES_BANDS_MAX)
+
+/**@brief Features of one window. */
+typedef struct
+{
+    uint8_t  seq;                                ///< Sequence number of the window, incremented for each frame.
+    int16_t  mean;                               ///< Mean of the window, in counts.
+    uint32_t rms;                                ///< RMS deviation from the mean, in 1/16 counts.
+    uint16_t peak;                               ///< Largest deviation from the mean, in counts.
+    uint16_t crest;                              ///< Crest factor, peak / RMS, in Q8.8 format. 0 if the window is constant.
+    uint32_t peak_freq;                          ///< Frequency of the largest spectral component, in 1/16 Hz. 0 if the window is constant.
+    uint8_t  band_count;                         ///< Number of bands.
+    uint8_t  bands[APP_SAADC_FEATURES_BANDS_MAX]; ///< Largest sine amplitude in each band, in steps of 0.5 dB above 1/16 count.
+} app_saadc_features_frame_t;
+
+/**@brief Feature frame handler.
+ *
+ * @param[in] p_frame   Features of the window just completed.
+ * @param[in] p_context Context from the configuration.
+ */
+typedef void (* app_saadc_features_handler_t)(app_saadc_features_frame_t const * p_frame,
+                                              void                             * p_context);
+
+/**@brief Feature extraction configuration. */
+typedef struct
+{
+    uint32_t                     sample_rate;   ///< Rate of the samples of the channel, in Hz, after any decimation.
+    uint8_t                      channel_idx;   ///< Position of the channel in the buffer.
+    uint8_t                      channel_count; ///< Number of interleaved channels in the buffers.
+    uint8_t                      band_count;    ///< Number of bands. At most @ref APP_SAADC_FEATURES_BANDS_MAX.
+    app_saadc_features_handler_t handler;       ///< Frame handler.
+    void                       * p_context;     ///< Context passed to the handler.
+} app_saadc_features_config_t;
+
+/**@brief Feature extraction instance. Fields are internal. */
+typedef struct
+{
+    app_saadc_features_config_t config;                              ///< Configuration.
+    int16_t                     window[APP_SAADC_FEATURES_FFT_SIZE]; ///< Samples of the current window, transformed in place.
+    uint16_t                    fill;                                ///< Number of samples in the window.
+    uint8_t                     seq;                                 ///< Sequence number of the next frame.
+} app_saadc_features_t;
+
+/**@brief Function for initializing a feature extraction instance.
+ *
+ * @param[out] p_inst   Feature extraction instance.
+ * @param[in]  p_config Configuration.
+ *
+ * @retval NRF_SUCCESS             If the instance was initialized.
+ * @retval NRF_ERROR_NULL          If the handler is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If any of the parameters is out of range.
+ */
+ret_code_t app_saadc_features_init(app_saadc_features_t              * p_inst,
+                                   app_saadc_features_config_t const * p_config);
+
+/**@brief Function for discarding the samples of the current window.
+ *
+ * @details Use after a gap in the sample stream, for example when sampling is restarted.
+ *
+ * @param[in] p_inst Feature extraction instance.
+ */
+void app_saadc_features_reset(app_saadc_features_t * p_inst);
+
+/**@brief Function for processing a buffer.
+ *
+ * @details The handler is called once for each window completed by the buffer.
+ *
+ * @param[in] p_inst   Feature extraction instance.
+ * @param[in] p_buffer Interleaved samples. Not modified.
+ * @param[in] size     Number of samples in the buffer. Must be a multiple of the channel count.
+ *
+ * @return Number of frames passed to the handler.
+ */
+uint16_t app_saadc_features_process(app_saadc_features_t    * p_inst,
+                                    nrf_saadc_value_t const * p_buffer,
+                                    uint16_t                  size);
+
+/**@brief Function for encoding a frame.
+ *
+ * @details Multi-byte fields are little endian. RMS and peak frequency take 3 bytes each.
+ *
+ * @param[in]  p_frame  Frame to encode.
+ * @param[out] p_data   Encoded frame.
+ * @param[in]  size     Size of @p p_data in bytes.
+ * @param[out] p_length Length of the encoded frame in bytes.
+ *
+ * @retval NRF_SUCCESS      If the frame was encoded.
+ * @retval NRF_ERROR_NO_MEM If @p p_data is too small.
+ */
+ret_code_t app_saadc_features_frame_encode(app_saadc_features_frame_t const * p_frame,
+                                           uint8_t                          * p_data,
+                                           size_t                             size,
+                                           size_t                           * p_length);
+
+/**@brief Function for decoding a frame encoded with @ref app_saadc_features_frame_encode.
+ *
+ * @param[in]  p_data  Encoded frame.
+ * @param[in]  length  Length of the encoded frame in bytes.
+ * @param[out] p_frame Decoded frame.
+ *
+ * @retval NRF_SUCCESS            If the frame was decoded.
+ * @retval NRF_ERROR_INVALID_DATA If the length does not match the band count.
+ */
+ret_code_t app_saadc_features_frame_decode(uint8_t const              * p_data,
+                                           size_t                       length,
+                                           app_saadc_features_frame_t * p_frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_FEATURES_H__
+
+/** @} */
@@ -0,0 +1,282 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC_FILTER)
+#include <string.h>
+#include "app_saadc_filter.h"
+#include "app_util_platform.h"
+#include "nrf.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define APP_SAADC_FILTER_DSP 1
+#else
+#define APP_SAADC_FILTER_DSP 0
+#endif
+
+#define Q15_SHIFT 15 /**< Fractional bits of the FIR coefficients. */
+
+/**@brief Function for saturating a value to the range of a sample. */
+__STATIC_INLINE int16_t sample_saturate(int32_t value)
+{
+#if APP_SAADC_FILTER_DSP
+    return (int16_t)__SSAT(value, 16);
+#else
+    if (value > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)value;
+#endif
+}
+
+
+/**@brief Function for computing the dot product of the FIR window and the coefficients.
+ *
+ * @details With the DSP extension, two 16-bit products are accumulated per SMLAD.
+ *          The window may start at an odd halfword, which is fine for LDR on Cortex-M4.
+ */
+static int32_t fir_dot(int16_t const * p_x, int16_t const * p_h, uint32_t taps)
+{
+    int32_t acc = 0;
+
+#if APP_SAADC_FILTER_DSP
+    for (uint32_t pairs = taps >> 1; pairs > 0; pairs--)
+    {
+        acc = (int32_t)__SMLAD(__UNALIGNED_UINT32_READ(p_x), __UNALIGNED_UINT32_READ(p_h), acc);
+        p_x += 2;
+        p_h += 2;
+    }
+    if (taps & 1)
+    {
+        acc += (int32_t)(*p_x) * (*p_h);
+    }
+#else
+    while (taps--)
+    {
+        acc += (int32_t)(*p_x++) * (*p_h++);
+    }
+#endif
+
+    return acc;
+}
+
+
+/**@brief Function for removing the DC component from a sample. */
+__STATIC_INLINE int32_t dc_remove(app_saadc_filter_channel_t * p_ch, int32_t x)
+{
+    int32_t y = x - (p_ch->dc_acc >> p_ch->config.dc_shift);
+    p_ch->dc_acc += y;
+    return y;
+}
+
+
+/**@brief Function for pushing a sample to the delay line of a channel. */
+__STATIC_INLINE void delay_push(app_saadc_filter_channel_t * p_ch, int16_t x)
+{
+    uint8_t taps = p_ch->config.tap_count;
+
+    // Each sample is written twice, so the window [delay_idx, delay_idx + taps) is contiguous.
+    p_ch->delay[p_ch->delay_idx]        = x;
+    p_ch->delay[p_ch->delay_idx + taps] = x;
+    if (++p_ch->delay_idx == taps)
+    {
+        p_ch->delay_idx = 0;
+    }
+}
+
+
+__STATIC_INLINE void stats_update(app_saadc_filter_stats_t * p_stats, int16_t y)
+{
+    if (y < p_stats->min)
+    {
+        p_stats->min = y;
+    }
+    if (y > p_stats->max)
+    {
+        p_stats->max = y;
+    }
+    p_stats->sum += y;
+    p_stats->count++;
+}
+
+
+static void stats_reset(app_saadc_filter_stats_t * p_stats)
+{
+    p_stats->min   = INT16_MAX;
+    p_stats->max   = INT16_MIN;
+    p_stats->sum   = 0;
+    p_stats->count = 0;
+}
+
+
+ret_code_t app_saadc_filter_init(app_saadc_filter_t                      * p_filter,
+                                 app_saadc_filter_channel_config_t const * p_config,
+                                 uint8_t                                   channel_count,
+                                 uint8_t                                   decimation)
+{
+    ASSERT(p_filter);
+    ASSERT(p_config);
+
+    if ((channel_count == 0) || (channel_count > NRF_SAADC_CHANNEL_COUNT) || (decimation == 0))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    memset(p_filter, 0, sizeof(*p_filter));
+    p_filter->channel_count = channel_count;
+    p_filter->decimation    = decimation;
+
+    for (uint32_t i = 0; i < channel_count; i++)
+    {
+        app_saadc_filter_channel_t * p_ch = &p_filter->channels[i];
+
+        if ((p_config[i].p_taps != NULL) &&
+            ((p_config[i].tap_count == 0) || (p_config[i].tap_count > APP_SAADC_FILTER_MAX_TAPS)))
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+        if (p_config[i].dc_removal && (p_config[i].dc_shift > 16))
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+
+        p_ch->config = p_config[i];
+        stats_reset(&p_ch->stats);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+uint16_t app_saadc_filter_process(app_saadc_filter_t * p_filter,
+                                  nrf_saadc_value_t  * p_buffer,
+                                  uint16_t             size)
+{
+    ASSERT(p_filter);
+    ASSERT(p_buffer);
+    ASSERT((size % p_filter->channel_count) == 0);
+
+    uint8_t             channel_count = p_filter->channel_count;
+    nrf_saadc_value_t * p_out         = p_buffer;
+
+    // Output never overtakes input, so the buffer can be processed in place.
+    for (uint16_t frame = 0; frame < size; frame += channel_count)
+    {
+        bool output = (++p_filter->phase == p_filter->decimation);
+        if (output)
+        {
+            p_filter->phase = 0;
+        }
+
+        for (uint8_t i = 0; i < channel_count; i++)
+        {
+            app_saadc_filter_channel_t * p_ch = &p_filter->channels[i];
+            int32_t                      x    = p_buffer[frame + i];
+            int32_t                      y;
+
+            if (p_ch->config.dc_removal)
+            {
+                x = dc_remove(p_ch, x);
+            }
+
+            if (p_ch->config.p_taps != NULL)
+            {
+                delay_push(p_ch, sample_saturate(x));
+                if (!output)
+                {
+                    // Polyphase decimation: skip the outputs that would be discarded.
+                    continue;
+                }
+                y = fir_dot(&p_ch->delay[p_ch->delay_idx],
+                            p_ch->config.p_taps,
+                            p_ch->config.tap_count);
+                y = (y + (1L << (Q15_SHIFT - 1))) >> Q15_SHIFT;
+            }
+            else
+            {
+                p_ch->boxcar_acc += x;
+                if (!output)
+                {
+                    continue;
+                }
+                y = p_ch->boxcar_acc / p_filter->decimation;
+                p_ch->boxcar_acc = 0;
+            }
+
+            int16_t sample = sample_saturate(y);
+            stats_update(&p_ch->stats, sample);
+            p_out[i] = sample;
+        }
+
+        if (output)
+        {
+            p_out += channel_count;
+        }
+    }
+
+    return (uint16_t)(p_out - p_buffer);
+}
+
+
+void app_saadc_filter_stats_get(app_saadc_filter_t       * p_filter,
+                                uint8_t                    idx,
+                                app_saadc_filter_stats_t * p_stats,
+                                bool                       reset)
+{
+    ASSERT(p_filter);
+    ASSERT(p_stats);
+    ASSERT(idx < p_filter->channel_count);
+
+    // The statistics are updated in the SAADC interrupt and the 64-bit sum cannot be read in
+    // one access, so take the copy and the reset together.
+    CRITICAL_REGION_ENTER();
+    *p_stats = p_filter->channels[idx].stats;
+    if (reset)
+    {
+        stats_reset(&p_filter->channels[idx].stats);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SAADC_FILTER)
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc_filter SAADC decimation and filter stage
+ * @{
+ * @ingroup app_saadc
+ *
+ * @brief Streaming FIR/boxcar decimation, DC removal and window statistics for SAADC buffers.
+ *
+ * @details The filter processes interleaved SAADC buffers as delivered in
+ *          @ref APP_SAADC_EVT_DONE. Each active channel has its own filter state, so a
+ *          buffer stream can be processed in chunks of any size that is a multiple of
+ *          the channel count. Processing is done in place and the output is interleaved
+ *          in the same order as the input.
+ *
+ *          On cores with the DSP extension, FIR taps are processed in pairs with SMLAD and
+ *          the results are saturated with SSAT.
+ */
+
+#ifndef APP_SAADC_FILTER_H__
+#define APP_SAADC_FILTER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "sdk_config.h"
+#include "nrf_saadc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef APP_SAADC_FILTER_MAX_TAPS
+#define APP_SAADC_FILTER_MAX_TAPS 16
+#endif
+
+/**@brief Per-channel filter configuration. */
+typedef struct
+{
+    int16_t const * p_taps;     ///< FIR coefficients in Q15 format, applied to the oldest sample first. NULL selects a boxcar (first-order CIC) over the decimation factor.
+    uint8_t         tap_count;  ///< Number of FIR coefficients. At most @ref APP_SAADC_FILTER_MAX_TAPS.
+    bool            dc_removal; ///< Remove the DC component before filtering.
+    uint8_t         dc_shift;   ///< DC tracking time constant, as a power of two of samples.
+} app_saadc_filter_channel_config_t;
+
+/**@brief Statistics of the filter output over a window. */
+typedef struct
+{
+    int16_t  min;   ///< Minimum output value.
+    int16_t  max;   ///< Maximum output value.
+    int64_t  sum;   ///< Sum of output values. Cannot overflow within @c count values.
+    uint32_t count; ///< Number of output values.
+} app_saadc_filter_stats_t;
+
+/**@brief Per-channel filter state. Fields are internal. */
+typedef struct
+{
+    app_saadc_filter_channel_config_t config;                              ///< Channel configuration.
+    int16_t                           delay[2 * APP_SAADC_FILTER_MAX_TAPS]; ///< Mirrored delay line, so the FIR window is always contiguous.
+    uint8_t                           delay_idx;                          ///< Position of the oldest sample in the delay line.
+    int32_t                           boxcar_acc;                         ///< Boxcar accumulator.
+    int32_t                           dc_acc;                             ///< DC estimate scaled by 2^dc_shift.
+    app_saadc_filter_stats_t          stats;                              ///< Output statistics.
+} app_saadc_filter_channel_t;
+
+/**@brief Filter instance. Fields are internal. */
+typedef struct
+{
+    app_saadc_filter_channel_t channels[NRF_SAADC_CHANNEL_COUNT]; ///< Channel states, in the order of the buffer.
+    uint8_t                    channel_count;                    ///< Number of interleaved channels.
+    uint8_t                    decimation;                       ///< Decimation factor.
+    uint8_t                    phase;                            ///< Input frames since the last output frame.
+} app_saadc_filter_t;
+
+/**@brief Function for initializing a filter instance.
+ *
+ * @param[out] p_filter      Filter instance.
+ * @param[in]  p_config      Array of @p channel_count channel configurations, in buffer order.
+ * @param[in]  channel_count Number of interleaved channels in the buffers.
+ * @param[in]  decimation    Decimation factor, common to all channels. 1 disables decimation.
+ *
+ * @retval NRF_SUCCESS             If the filter was initialized.
+ * @retval NRF_ERROR_INVALID_PARAM If any of the parameters is out of range.
+ */
+ret_code_t app_saadc_filter_init(app_saadc_filter_t                      * p_filter,
+                                 app_saadc_filter_channel_config_t const * p_config,
+                                 uint8_t                                   channel_count,
+                                 uint8_t                                   decimation);
+
+/**@brief Function for processing a buffer in place.
+ *
+ * @param[in]    p_filter Filter instance.
+ * @param[inout] p_buffer Interleaved samples. The filter output is written from the start.
+ * @param[in]    size     Number of samples in the buffer. Must be a multiple of the channel count.
+ *
+ * @return Number of output samples written to @p p_buffer.
+ */
+uint16_t app_saadc_filter_process(app_saadc_filter_t * p_filter,
+                                  nrf_saadc_value_t  * p_buffer,
+                                  uint16_t             size);
+
+/**@brief Function for reading the output statistics of a channel.
+ *
+ * The statistics are copied in a critical region, so the function can be called from a lower
+ * priority than @ref app_saadc_filter_process.
+ *
+ * @param[in]  p_filter Filter instance.
+ * @param[in]  idx      Channel position in the buffer.
+ * @param[out] p_stats  Statistics since the last reset. Mean is @c sum / @c count.
+ * @param[in]  reset    Start a new window after reading.
+ */
+void app_saadc_filter_stats_get(app_saadc_filter_t       * p_filter,
+                                uint8_t                    idx,
+                                app_saadc_filter_stats_t * p_stats,
+                                bool                       reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_FILTER_H__
+
+/** @} */
@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC_LITE)
+#include "app_saadc_lite.h"
+#include "nrfx_ppi.h"
+
+#if (defined(NRFX_SAADC_ENABLED) && NRFX_SAADC_ENABLED) || (defined(SAADC_ENABLED) && SAADC_ENABLED)
+#error "app_saadc_lite owns the SAADC interrupt, disable the nrfx_saadc driver."
+#endif
+
+#define NRF_LOG_MODULE_NAME app_saadc_lite
+#if APP_SAADC_LITE_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       APP_SAADC_LITE_CONFIG_LOG_LEVEL
+#define NRF_LOG_INFO_COLOR  APP_SAADC_LITE_CONFIG_INFO_COLOR
+#define NRF_LOG_DEBUG_COLOR APP_SAADC_LITE_CONFIG_DEBUG_COLOR
+#else //APP_SAADC_LITE_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       0
+#endif //APP_SAADC_LITE_CONFIG_LOG_ENABLED
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+STATIC_ASSERT((APP_SAADC_LITE_CONFIG_CHANNEL_MASK != 0) &&
+              (APP_SAADC_LITE_CONFIG_CHANNEL_MASK <= 0xFF));
+STATIC_ASSERT(APP_SAADC_LITE_CONFIG_FRAMES > 0);
+STATIC_ASSERT(APP_SAADC_LITE_BUFFER_SIZE <= (SAADC_RESULT_MAXCNT_MAXCNT_Msk >> SAADC_RESULT_MAXCNT_MAXCNT_Pos));
+// The internal sample rate timer can only be used with a single channel.
+STATIC_ASSERT((APP_SAADC_LITE_CONFIG_SAMPLERATE_CC == 0) ||
+              ((APP_SAADC_LITE_CHANNEL_COUNT == 1) &&
+               (APP_SAADC_LITE_CONFIG_SAMPLERATE_CC >= 80) &&
+               (APP_SAADC_LITE_CONFIG_SAMPLERATE_CC <= 2047)));
+
+/**@brief Oversampling with several channels requires burst mode on each channel. */
+#define BURST_REQUIRED ((APP_SAADC_LITE_CONFIG_OVERSAMPLE != 0) && (APP_SAADC_LITE_CHANNEL_COUNT > 1))
+
+static nrf_saadc_value_t m_buffers[2][APP_SAADC_LITE_BUFFER_SIZE];
+
+/**@brief Control block. */
+typedef struct
+{
+    app_saadc_lite_handler_t handler;     ///< Buffer handler.
+    nrf_ppi_channel_t        ppi_restart; ///< PPI channel connecting the END event to the START task.
+    uint8_t                  filling;     ///< Index of the buffer being filled.
+    bool                     initialized; ///< Driver is initialized.
+} app_saadc_lite_cb_t;
+
+static app_saadc_lite_cb_t m_cb;
+
+
+void SAADC_IRQHandler(void)
+{
+    // Only the END interrupt is enabled. The SAADC was restarted through PPI on the other
+    // buffer, queue this one to be written once that is filled.
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_END);
+
+    nrf_saadc_value_t * p_buffer = m_buffers[m_cb.filling];
+    m_cb.filling         ^= 1;
+    NRF_SAADC->RESULT.PTR = (uint32_t)p_buffer;
+
+    m_cb.handler(p_buffer);
+}
+
+
+ret_code_t app_saadc_lite_init(app_saadc_lite_channel_t const * p_channels,
+                               app_saadc_lite_handler_t         handler)
+{
+    ASSERT(p_channels);
+    ASSERT(handler);
+
+    if (m_cb.initialized)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (nrfx_ppi_channel_alloc(&m_cb.ppi_restart) != NRF_SUCCESS)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+    APP_ERROR_CHECK(nrfx_ppi_channel_assign(m_cb.ppi_restart,
+                                            nrf_saadc_event_address_get(NRF_SAADC_EVENT_END),
+                                            nrf_saadc_task_address_get(NRF_SAADC_TASK_START)));
+
+    nrf_saadc_resolution_set((nrf_saadc_resolution_t)APP_SAADC_LITE_CONFIG_RESOLUTION);
+    nrf_saadc_oversample_set((nrf_saadc_oversample_t)APP_SAADC_LITE_CONFIG_OVERSAMPLE);
+
+    for (uint8_t channel = 0; channel < NRF_SAADC_CHANNEL_COUNT; channel++)
+    {
+        if (APP_SAADC_LITE_CONFIG_CHANNEL_MASK & (1UL << channel))
+        {
+            nrf_saadc_channel_config_t config = p_channels->config;
+            if (BURST_REQUIRED)
+            {
+                config.burst = NRF_SAADC_BURST_ENABLED;
+            }
+            nrf_saadc_channel_init(channel, &config);
+            nrf_saadc_channel_input_set(channel, p_channels->pin_p, p_channels->pin_n);
+            p_channels++;
+        }
+        else
+        {
+            nrf_saadc_channel_input_set(channel, NRF_SAADC_INPUT_DISABLED, NRF_SAADC_INPUT_DISABLED);
+        }
+    }
+
+#if APP_SAADC_LITE_CONFIG_SAMPLERATE_CC
+    nrf_saadc_continuous_mode_enable(APP_SAADC_LITE_CONFIG_SAMPLERATE_CC);
+#else
+    nrf_saadc_continuous_mode_disable();
+#endif
+
+    nrf_saadc_int_disable(NRF_SAADC_INT_ALL);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_END);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_STARTED);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_STOPPED);
+    NRFX_IRQ_PRIORITY_SET(SAADC_IRQn, APP_SAADC_LITE_CONFIG_IRQ_PRIORITY);
+    NRFX_IRQ_ENABLE(SAADC_IRQn);
+    nrf_saadc_enable();
+
+    m_cb.handler     = handler;
+    m_cb.initialized = true;
+
+    NRF_LOG_INFO("Initialized, %d channels, %d samples per buffer.",
+                 APP_SAADC_LITE_CHANNEL_COUNT, APP_SAADC_LITE_BUFFER_SIZE);
+
+    return NRF_SUCCESS;
+}
+
+
+void app_saadc_lite_uninit(void)
+{
+    ASSERT(m_cb.initialized);
+
+    app_saadc_lite_stop();
+    NRFX_IRQ_DISABLE(SAADC_IRQn);
+    nrf_saadc_disable();
+    (void)nrfx_ppi_channel_free(m_cb.ppi_restart);
+
+    m_cb.initialized = false;
+}
+
+
+void app_saadc_lite_start(void)
+{
+    ASSERT(m_cb.initialized);
+
+    m_cb.filling = 0;
+    nrf_saadc_buffer_init(m_buffers[0], APP_SAADC_LITE_BUFFER_SIZE);
+
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_STARTED);
+    nrf_saadc_task_trigger(NRF_SAADC_TASK_START);
+    while (!nrf_saadc_event_check(NRF_SAADC_EVENT_STARTED))
+    {}
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_STARTED);
+
+    // The first buffer is latched, the second one is used on the next START.
+    NRF_SAADC->RESULT.PTR = (uint32_t)m_buffers[1];
+
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_END);
+    nrf_saadc_int_enable(NRF_SAADC_INT_END);
+    APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_cb.ppi_restart));
+
+#if APP_SAADC_LITE_CONFIG_SAMPLERATE_CC
+    // The internal timer runs from the first SAMPLE task until the SAADC is stopped.
+    nrf_saadc_task_trigger(NRF_SAADC_TASK_SAMPLE);
+#endif
+}
+
+
+void app_saadc_lite_stop(void)
+{
+    ASSERT(m_cb.initialized);
+
+    (void)nrfx_ppi_channel_disable(m_cb.ppi_restart);
+    nrf_saadc_int_disable(NRF_SAADC_INT_END);
+
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_STOPPED);
+    nrf_saadc_task_trigger(NRF_SAADC_TASK_STOP);
+    while (!nrf_saadc_event_check(NRF_SAADC_EVENT_STOPPED))
+    {}
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_STOPPED);
+    nrf_saadc_event_clear(NRF_SAADC_EVENT_END);
+    NRFX_IRQ_PENDING_CLEAR(SAADC_IRQn);
+}
+
+
+uint32_t app_saadc_lite_sample_task_address_get(void)
+{
+    return nrf_saadc_task_address_get(NRF_SAADC_TASK_SAMPLE);
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SAADC_LITE)
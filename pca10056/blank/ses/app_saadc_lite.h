@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc_lite Compile-time configured SAADC driver
+ * @{
+ * @ingroup app_saadc
+ *
+ * @brief Minimal continuous SAADC driver for high sample rates, specialized at compile time.
+ *
+ * @details The generic driver decides at run time between the legacy, simple and advanced
+ *          modes and adapts to the number of active channels on every END interrupt. For a
+ *          fixed acquisition, this module takes the channel mask, resolution, oversampling
+ *          and buffer length from the configuration instead, so the buffers are static and
+ *          the interrupt handler reduces to clearing the END event, pointing the SAADC at
+ *          the buffer that was just filled and calling the handler.
+ *
+ *          The two buffers are used alternately. The END event restarts the SAADC through
+ *          PPI on the buffer latched before, so the handler has one buffer duration to
+ *          process the filled buffer before it is written again.
+ *
+ *          The module owns the SAADC interrupt, so it cannot be used together with the
+ *          nrfx_saadc driver. Conversions are triggered by connecting a TIMER or RTC event
+ *          to the task returned by @ref app_saadc_lite_sample_task_address_get, or, for a
+ *          single channel, by the internal sample rate timer of the SAADC.
+ */
+
+#ifndef APP_SAADC_LITE_H__
+#define APP_SAADC_LITE_H__
+
+#include <stdint.h>
+#include "sdk_errors.h"
+#include "sdk_config.h"
+#include "nrf_saadc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef APP_SAADC_LITE_CONFIG_CHANNEL_MASK
+#define APP_SAADC_LITE_CONFIG_CHANNEL_MASK 0x01
+#endif
+
+#ifndef APP_SAADC_LITE_CONFIG_FRAMES
+#define APP_SAADC_LITE_CONFIG_FRAMES 64
+#endif
+
+/**@brief Number of channels set in @ref APP_SAADC_LITE_CONFIG_CHANNEL_MASK. */
+#define APP_SAADC_LITE_CHANNEL_COUNT                        \
+    ((((APP_SAADC_LITE_CONFIG_CHANNEL_MASK) >> 0) & 1) +    \
+     (((APP_SAADC_LITE_CONFIG_CHANNEL_MASK) >> 1) & 1) +    \
+     (((APP_SAADC_LITE_CONFIG_CHANNEL_MASK) >> 2) & 1) +    \
+     (((APP_SAADC_LITE_CONFIG_CHANNEL_MASK) >> 3) & 1) +    \
+     (((APP_SAADC_LITE_CONFIG_CHANNEL_MASK) >> 4) & 1) +    \
+     (((APP_SAADC_LITE_CONFIG_CHANNEL_MASK) >> 5) & 1) +    \
+     (((APP_SAADC_LITE_CONFIG_CHANNEL_MASK) >> 6) & 1) +    \
+     (((APP_SAADC_LITE_CONFIG_CHANNEL_MASK) >> 7) & 1))
+
+/**@brief Number of samples in each buffer. */
+#define APP_SAADC_LITE_BUFFER_SIZE (APP_SAADC_LITE_CHANNEL_COUNT * APP_SAADC_LITE_CONFIG_FRAMES)
+
+/**@brief Configuration of one channel. */
+typedef struct
+{
+    nrf_saadc_input_t          pin_p;  ///< Positive input.
+    nrf_saadc_input_t          pin_n;  ///< Negative input, NRF_SAADC_INPUT_DISABLED for single-ended.
+    nrf_saadc_channel_config_t config; ///< Channel configuration.
+} app_saadc_lite_channel_t;
+
+/**@brief Handler called from the SAADC interrupt with each filled buffer.
+ *
+ * @param[in] p_buffer @ref APP_SAADC_LITE_BUFFER_SIZE interleaved samples, in ascending
+ *                     channel order. Valid until the next call.
+ */
+typedef void (*app_saadc_lite_handler_t)(nrf_saadc_value_t const * p_buffer);
+
+/**@brief Function for initializing the driver.
+ *
+ * @param[in] p_channels Array of channel configurations, one for each channel in
+ *                       @ref APP_SAADC_LITE_CONFIG_CHANNEL_MASK, in ascending order.
+ * @param[in] handler    Buffer handler.
+ *
+ * @retval NRF_SUCCESS             If the driver was initialized.
+ * @retval NRF_ERROR_INVALID_STATE If the driver is already initialized.
+ * @retval NRF_ERROR_NO_MEM        If no PPI channel is available.
+ */
+ret_code_t app_saadc_lite_init(app_saadc_lite_channel_t const * p_channels,
+                               app_saadc_lite_handler_t         handler);
+
+/**@brief Function for uninitializing the driver. Conversions are stopped. */
+void app_saadc_lite_uninit(void);
+
+/**@brief Function for starting the conversions.
+ *
+ * @details With @ref APP_SAADC_LITE_CONFIG_SAMPLERATE_CC set, the internal timer starts
+ *          sampling immediately. Otherwise, conversions are done on each trigger of the
+ *          SAMPLE task.
+ */
+void app_saadc_lite_start(void);
+
+/**@brief Function for stopping the conversions. The partially filled buffer is discarded. */
+void app_saadc_lite_stop(void);
+
+/**@brief Function for getting the address of the SAMPLE task, for connecting a trigger. */
+uint32_t app_saadc_lite_sample_task_address_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_LITE_H__
+
+/** @} */
@@ -0,0 +1,924 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC_LOG)
+#include <string.h>
+#include "app_saadc_log.h"
+#include "app_util_platform.h"
+#include "crc16.h"
+#include "nrf_fstorage.h"
+#ifdef SOFTDEVICE_PRESENT
+#include "nrf_fstorage_sd.h"
+#else
+#include "nrf_fstorage_nvmc.h"
+#endif
+
+#define HEADER_SIZE     sizeof(app_saadc_log_header_t)
+#define HEADER_CRC_SIZE offsetof(app_saadc_log_header_t, crc)              /**< Bytes of the header covered by the CRC. */
+#define WORD_ALIGN(len) (((len) + 3UL) & ~3UL)
+#define CHUNK_SIZE(len) (HEADER_SIZE + WORD_ALIGN(len))                    /**< Flash bytes taken by a chunk. */
+#define DATA_MAX        (APP_SAADC_LOG_PAGE_SIZE - HEADER_SIZE)            /**< Largest chunk data. */
+#define PAGE_ADDR(page) (APP_SAADC_LOG_START_ADDR + (uint32_t)(page) * APP_SAADC_LOG_PAGE_SIZE)
+
+STATIC_ASSERT((APP_SAADC_LOG_START_ADDR % APP_SAADC_LOG_PAGE_SIZE) == 0);
+STATIC_ASSERT(APP_SAADC_LOG_PAGES >= 2);
+STATIC_ASSERT((sizeof(app_saadc_log_header_t) % sizeof(uint32_t)) == 0);
+
+typedef enum
+{
+    OP_IDLE,            // No flash operation and nothing to do.
+    OP_RUNNING,         // Processing the queue, between flash operations.
+    OP_ERASE,           // Erasing the page after the write page.
+    OP_WRITE,           // Writing a part of the chunk at the front of the queue.
+} op_t;
+
+typedef enum
+{
+    STEP_DATA,          // Write the whole words of the data.
+    STEP_TAIL,          // Write the last partial word of the data.
+    STEP_HEADER,        // Write the header, which completes the chunk.
+    STEP_DONE,          // The header is being written.
+} step_t;
+
+/**@brief Chunk waiting to be written. */
+typedef struct
+{
+    app_saadc_log_header_t header;      // Header, with the CRC.
+    void const           * p_data;      // Data, or NULL for a marker.
+    uint32_t               tail;        // Last partial word of the data, padded with erased bytes.
+    uint32_t               addr;        // Flash address of the chunk, 0 until placed.
+    step_t                 step;        // Next part to write.
+} chunk_t;
+
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt);
+
+NRF_FSTORAGE_DEF(nrf_fstorage_t m_fs) =
+{
+    .evt_handler = fs_evt_handler,
+    .start_addr  = APP_SAADC_LOG_START_ADDR,
+    .end_addr    = APP_SAADC_LOG_START_ADDR + APP_SAADC_LOG_SIZE,
+};
+
+static chunk_t  m_queue[APP_SAADC_LOG_QUEUE_SIZE];      // Chunks waiting to be written, oldest at m_queue_front.
+static uint8_t  m_queue_front;
+static uint8_t  m_queue_count;
+static uint16_t m_page_used[APP_SAADC_LOG_PAGES];       // Bytes of complete chunks from the start of each page.
+static uint16_t m_write_page;                           // Page the next chunk is placed in, if it fits.
+static uint16_t m_write_off;                            // Offset the next chunk is placed at.
+static bool     m_ahead_ready;                          // The page after the write page is erased.
+static uint16_t m_head_page;                            // Page holding the newest chunk.
+static uint16_t m_tail_page;                            // Page holding the start of the view.
+static uint16_t m_tail_off;                             // Offset of the start of the view in that page.
+static uint32_t m_seq;                                  // Sequence number of the next chunk.
+static op_t     m_op;
+
+static app_saadc_log_stats_t       m_stats;
+static app_saadc_log_evt_handler_t m_evt_handler;
+
+
+__STATIC_INLINE uint16_t page_next(uint16_t page)
+{
+    return (page + 1 == APP_SAADC_LOG_PAGES) ? 0 : (page + 1);
+}
+
+
+/**@brief Function for checking a chunk in flash.
+ *
+ * @param[in] p_header Header of the chunk.
+ * @param[in] space    Bytes from the header to the end of the page.
+ *
+ * @retval true If the chunk is complete and its CRC matches.
+ */
+static bool chunk_is_valid(app_saadc_log_header_t const * p_header, uint32_t space)
+{
+    uint16_t crc;
+
+    if ((p_header->magic != APP_SAADC_LOG_MAGIC) || (CHUNK_SIZE(p_header->length) > space))
+    {
+        return false;
+    }
+
+    crc = crc16_compute((uint8_t const *)p_header, HEADER_CRC_SIZE, NULL);
+    crc = crc16_compute((uint8_t const *)(p_header + 1), p_header->length, &crc);
+
+    return (crc == p_header->crc);
+}
+
+
+static bool page_is_blank(uint16_t page)
+{
+    uint32_t const * p_word = (uint32_t const *)PAGE_ADDR(page);
+
+    for (uint32_t i = 0; i < APP_SAADC_LOG_PAGE_SIZE / sizeof(uint32_t); i++)
+    {
+        if (p_word[i] != 0xFFFFFFFF)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**@brief Function for finding the chunks written before the last reset.
+ */
+static void log_scan(void)
+{
+    bool     found   = false;
+    bool     cleared = false;
+    uint32_t newest_seq = 0;
+    uint32_t clear_seq  = 0;
+    uint16_t clear_page = 0;
+    uint16_t clear_off  = 0;
+
+    m_head_page = 0;
+
+    for (uint16_t page = 0; page < APP_SAADC_LOG_PAGES; page++)
+    {
+        uint32_t off = 0;
+
+        while (off + HEADER_SIZE <= APP_SAADC_LOG_PAGE_SIZE)
+        {
+            app_saadc_log_header_t const * p_header =
+                (app_saadc_log_header_t const *)(PAGE_ADDR(page) + off);
+
+            if (!chunk_is_valid(p_header, APP_SAADC_LOG_PAGE_SIZE - off))
+            {
+                break;
+            }
+            off += CHUNK_SIZE(p_header->length);
+
+            if (!found || ((int32_t)(p_header->seq - newest_seq) > 0))
+            {
+                found       = true;
+                newest_seq  = p_header->seq;
+                m_head_page = page;
+            }
+            if ((p_header->encoding == APP_SAADC_LOG_ENCODING_CLEAR) &&
+                (!cleared || ((int32_t)(p_header->seq - clear_seq) > 0)))
+            {
+                cleared    = true;
+                clear_seq  = p_header->seq;
+                clear_page = page;
+                clear_off  = (uint16_t)off;
+            }
+        }
+
+        m_page_used[page] = (uint16_t)off;
+    }
+
+    // The next chunk goes to the page after the newest one, whatever room is left in it.
+    m_seq         = found ? (newest_seq + 1) : 0;
+    m_write_page  = found ? m_head_page : (APP_SAADC_LOG_PAGES - 1);
+    m_write_off   = APP_SAADC_LOG_PAGE_SIZE;
+    m_ahead_ready = false;
+
+    // The pages after the newest one hold the oldest chunks.
+    m_tail_page = page_next(m_head_page);
+    while ((m_tail_page != m_head_page) && (m_page_used[m_tail_page] == 0))
+    {
+        m_tail_page = page_next(m_tail_page);
+    }
+    m_tail_off = 0;
+
+    if (cleared)
+    {
+        m_tail_page = clear_page;
+        m_tail_off  = clear_off;
+    }
+}
+
+
+/**@brief Function for removing a page that is about to be reused from the view.
+ */
+static void view_page_drop(uint16_t page)
+{
+    if ((page != m_tail_page) || (page == m_head_page))
+    {
+        return;
+    }
+
+    do
+    {
+        m_tail_page = page_next(m_tail_page);
+    } while ((m_tail_page != m_head_page) && (m_page_used[m_tail_page] == 0));
+    m_tail_off = 0;
+}
+
+
+static void evt_send(app_saadc_log_evt_t const * p_evt)
+{
+    m_evt_handler(p_evt);
+}
+
+
+/**@brief Function for handing the data of the chunk at the front of the queue back.
+ */
+static void chunk_release(chunk_t * p_chunk)
+{
+    if (p_chunk->p_data != NULL)
+    {
+        app_saadc_log_evt_t evt =
+        {
+            .type        = APP_SAADC_LOG_EVT_RELEASE,
+            .data.p_data = p_chunk->p_data,
+        };
+
+        p_chunk->p_data = NULL;
+        evt_send(&evt);
+    }
+}
+
+
+static void queue_pop(void)
+{
+    CRITICAL_REGION_ENTER();
+    m_queue_front = (m_queue_front + 1) % APP_SAADC_LOG_QUEUE_SIZE;
+    m_queue_count--;
+    CRITICAL_REGION_EXIT();
+}
+
+
+/**@brief Function for dropping the chunk at the front of the queue after an error.
+ *
+ * @details The rest of the page is left unused, so the chunks found after a reset are the
+ *          ones written in sequence.
+ */
+static void chunk_fail(chunk_t * p_chunk, ret_code_t err_code)
+{
+    app_saadc_log_evt_t evt =
+    {
+        .type                = APP_SAADC_LOG_EVT_ERROR,
+        .data.error.err_code = err_code,
+        .data.error.seq      = p_chunk->header.seq,
+    };
+
+    if (p_chunk->addr != 0)
+    {
+        m_write_off = APP_SAADC_LOG_PAGE_SIZE;
+    }
+    m_stats.errors++;
+
+    chunk_release(p_chunk);
+    queue_pop();
+    evt_send(&evt);
+}
+
+
+/**@brief Function for completing the chunk at the front of the queue.
+ */
+static void chunk_complete(chunk_t * p_chunk)
+{
+    uint16_t page = (uint16_t)((p_chunk->addr - APP_SAADC_LOG_START_ADDR) / APP_SAADC_LOG_PAGE_SIZE);
+    uint16_t end  = (uint16_t)((p_chunk->addr % APP_SAADC_LOG_PAGE_SIZE) + CHUNK_SIZE(p_chunk->header.length));
+
+    CRITICAL_REGION_ENTER();
+    m_page_used[page] = end;
+    m_head_page       = page;
+    if (p_chunk->header.encoding == APP_SAADC_LOG_ENCODING_CLEAR)
+    {
+        m_tail_page = page;
+        m_tail_off  = end;
+    }
+    CRITICAL_REGION_EXIT();
+
+    m_stats.chunks++;
+    queue_pop();
+}
+
+
+/**@brief Function for making the page after the write page ready.
+ *
+ * @retval true  If the page is erased.
+ * @retval false If an erase was started, or failed to start.
+ */
+static bool ahead_prepare(ret_code_t * p_err_code)
+{
+    uint16_t page = page_next(m_write_page);
+
+    CRITICAL_REGION_ENTER();
+    view_page_drop(page);
+    CRITICAL_REGION_EXIT();
+
+    *p_err_code = NRF_SUCCESS;
+
+    if (page_is_blank(page))
+    {
+        m_page_used[page] = 0;
+        m_ahead_ready     = true;
+        return true;
+    }
+
+    m_op        = OP_ERASE;
+    *p_err_code = nrf_fstorage_erase(&m_fs, PAGE_ADDR(page), 1, NULL);
+    if (*p_err_code != NRF_SUCCESS)
+    {
+        m_op = OP_RUNNING;
+    }
+    return false;
+}
+
+
+/**@brief Function for placing a chunk in the write page, or else in the next page.
+ *
+ * @retval true  If the chunk was placed.
+ * @retval false If the next page is not erased yet.
+ */
+static bool chunk_place(chunk_t * p_chunk)
+{
+    uint32_t size = CHUNK_SIZE(p_chunk->header.length);
+
+    if (m_write_off + size > APP_SAADC_LOG_PAGE_SIZE)
+    {
+        if (!m_ahead_ready)
+        {
+            return false;
+        }
+        m_write_page  = page_next(m_write_page);
+        m_write_off   = 0;
+        m_ahead_ready = false;
+    }
+
+    p_chunk->addr = PAGE_ADDR(m_write_page) + m_write_off;
+    m_write_off  += size;
+
+    return true;
+}
+
+
+/**@brief Function for starting the write of the next part of a placed chunk.
+ *
+ * @retval true  If a write was started, or failed to start.
+ * @retval false If there was nothing to write in this step.
+ */
+static bool chunk_write(chunk_t * p_chunk, ret_code_t * p_err_code)
+{
+    uint32_t aligned = p_chunk->header.length & ~(sizeof(uint32_t) - 1);
+
+    m_op = OP_WRITE;
+
+    switch (p_chunk->step)
+    {
+        case STEP_DATA:
+            p_chunk->step = STEP_TAIL;
+            if (aligned == 0)
+            {
+                return false;
+            }
+            *p_err_code = nrf_fstorage_write(&m_fs, p_chunk->addr + HEADER_SIZE,
+                                             p_chunk->p_data, aligned, NULL);
+            break;
+
+        case STEP_TAIL:
+            // The whole words are in flash, and the tail was copied on append.
+            chunk_release(p_chunk);
+            p_chunk->step = STEP_HEADER;
+            if (aligned == p_chunk->header.length)
+            {
+                return false;
+            }
+            *p_err_code = nrf_fstorage_write(&m_fs, p_chunk->addr + HEADER_SIZE + aligned,
+                                             &p_chunk->tail, sizeof(uint32_t), NULL);
+            break;
+
+        default:
+            p_chunk->step = STEP_DONE;
+            *p_err_code   = nrf_fstorage_write(&m_fs, p_chunk->addr,
+                                             &p_chunk->header, HEADER_SIZE, NULL);
+            break;
+    }
+
+    return true;
+}
+
+
+/**@brief Function for ending the queue processing if the queue is empty.
+ *
+ * @retval true  If the logger is idle.
+ * @retval false If a chunk was queued meanwhile.
+ */
+static bool idle_enter(void)
+{
+    bool idle;
+
+    CRITICAL_REGION_ENTER();
+    idle = (m_queue_count == 0);
+    if (idle)
+    {
+        m_op = OP_IDLE;
+    }
+    CRITICAL_REGION_EXIT();
+
+    return idle;
+}
+
+
+/**@brief Function for starting the next flash operation, while the logger owns the operation state.
+ *
+ * @details With the NVMC backend, operations complete before they return and the event handler
+ *          runs this function again. The loop ends as soon as an operation is started.
+ */
+static void process(void)
+{
+    for (;;)
+    {
+        ret_code_t err_code = NRF_SUCCESS;
+        chunk_t  * p_chunk;
+        bool       empty;
+
+        m_op = OP_RUNNING;
+
+        CRITICAL_REGION_ENTER();
+        empty = (m_queue_count == 0);
+        if (empty && m_ahead_ready)
+        {
+            m_op = OP_IDLE;
+        }
+        CRITICAL_REGION_EXIT();
+
+        if (empty)
+        {
+            if (m_ahead_ready)
+            {
+                return;
+            }
+
+            // Erase ahead while idle, so the next page change does not wait for an erase.
+            if (ahead_prepare(&err_code))
+            {
+                continue;
+            }
+            if (err_code == NRF_SUCCESS)
+            {
+                return;
+            }
+            if (idle_enter())
+            {
+                // Retried on the next append.
+                m_stats.errors++;
+                return;
+            }
+            continue;
+        }
+
+        p_chunk = &m_queue[m_queue_front];
+
+        if ((p_chunk->addr == 0) && !chunk_place(p_chunk))
+        {
+            if (!ahead_prepare(&err_code))
+            {
+                if (err_code == NRF_SUCCESS)
+                {
+                    return;
+                }
+                chunk_fail(p_chunk, err_code);
+            }
+            continue;
+        }
+
+        if (chunk_write(p_chunk, &err_code))
+        {
+            if (err_code == NRF_SUCCESS)
+            {
+                return;
+            }
+            chunk_fail(p_chunk, err_code);
+        }
+    }
+}
+
+
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt)
+{
+    chunk_t * p_chunk = &m_queue[m_queue_front];
+
+    if (m_op == OP_ERASE)
+    {
+        if (p_evt->result == NRF_SUCCESS)
+        {
+            m_page_used[page_next(m_write_page)] = 0;
+            m_ahead_ready = true;
+            m_stats.erases++;
+        }
+        else if (!idle_enter())
+        {
+            // Fail the chunk that would have gone to the page.
+            chunk_fail(p_chunk, p_evt->result);
+        }
+        else
+        {
+            m_stats.errors++;
+            return;
+        }
+    }
+    else if (p_evt->result != NRF_SUCCESS)
+    {
+        chunk_fail(p_chunk, p_evt->result);
+    }
+    else if (p_chunk->step == STEP_DONE)
+    {
+        chunk_complete(p_chunk);
+    }
+
+    process();
+}
+
+
+/**@brief Function for queueing a chunk.
+ */
+static ret_code_t chunk_queue(app_saadc_log_chunk_info_t const * p_info,
+                              void const                       * p_data,
+                              uint16_t                           length)
+{
+    chunk_t * p_chunk;
+    bool      start;
+    uint32_t  aligned = length & ~(sizeof(uint32_t) - 1);
+
+    CRITICAL_REGION_ENTER();
+    if (m_queue_count == APP_SAADC_LOG_QUEUE_SIZE)
+    {
+        p_chunk = NULL;
+    }
+    else
+    {
+        p_chunk = &m_queue[(m_queue_front + m_queue_count) % APP_SAADC_LOG_QUEUE_SIZE];
+        p_chunk->header.seq = m_seq++;
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (p_chunk == NULL)
+    {
+        m_stats.dropped++;
+        return NRF_ERROR_NO_MEM;
+    }
+
+    p_chunk->header.magic         = APP_SAADC_LOG_MAGIC;
+    p_chunk->header.length        = length;
+    p_chunk->header.timestamp     = p_info->timestamp;
+    p_chunk->header.gains         = p_info->gains;
+    p_chunk->header.encoding      = p_info->encoding;
+    p_chunk->header.channel_count = p_info->channel_count;
+    p_chunk->header.crc           = crc16_compute((uint8_t const *)&p_chunk->header, HEADER_CRC_SIZE, NULL);
+    p_chunk->header.crc           = crc16_compute(p_data, length, &p_chunk->header.crc);
+    p_chunk->p_data               = p_data;
+    p_chunk->tail                 = 0xFFFFFFFF;
+    p_chunk->addr                 = 0;
+    p_chunk->step                 = STEP_DATA;
+    if (length != aligned)
+    {
+        memcpy(&p_chunk->tail, (uint8_t const *)p_data + aligned, length - aligned);
+    }
+
+    // The chunk is only visible to the queue processing once it is complete.
+    CRITICAL_REGION_ENTER();
+    m_queue_count++;
+    start = (m_op == OP_IDLE);
+    if (start)
+    {
+        m_op = OP_RUNNING;
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (start)
+    {
+        process();
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t app_saadc_log_init(app_saadc_log_evt_handler_t evt_handler)
+{
+    ret_code_t err_code;
+
+    VERIFY_PARAM_NOT_NULL(evt_handler);
+
+#ifdef SOFTDEVICE_PRESENT
+    err_code = nrf_fstorage_init(&m_fs, &nrf_fstorage_sd, NULL);
+#else
+    err_code = nrf_fstorage_init(&m_fs, &nrf_fstorage_nvmc, NULL);
+#endif
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+    if (m_fs.p_flash_info->erase_unit != APP_SAADC_LOG_PAGE_SIZE)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    memset(&m_stats, 0, sizeof(m_stats));
+    m_queue_front = 0;
+    m_queue_count = 0;
+    m_evt_handler = evt_handler;
+
+    log_scan();
+
+    // Start erasing ahead.
+    m_op = OP_RUNNING;
+    process();
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t app_saadc_log_gains_pack(nrf_saadc_gain_t const * p_gains, uint8_t channel_count)
+{
+    uint32_t gains = APP_SAADC_LOG_GAINS_NONE;
+
+    if (p_gains == NULL)
+    {
+        return gains;
+    }
+
+    for (uint32_t i = 0; i < MIN(channel_count, NRF_SAADC_CHANNEL_COUNT); i++)
+    {
+        gains &= ~(0x0FUL << (4 * i));
+        gains |= ((uint32_t)p_gains[i] & 0x0F) << (4 * i);
+    }
+    return gains;
+}
+
+
+ret_code_t app_saadc_log_append(app_saadc_log_chunk_info_t const * p_info,
+                                void const                       * p_data,
+                                uint16_t                           length)
+{
+    ASSERT(p_info);
+    ASSERT(p_data);
+
+    if (m_evt_handler == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (!is_word_aligned(p_data))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+    if ((length == 0) || (length > DATA_MAX))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    return chunk_queue(p_info, p_data, length);
+}
+
+
+ret_code_t app_saadc_log_clear(void)
+{
+    app_saadc_log_chunk_info_t const info =
+    {
+        .gains    = APP_SAADC_LOG_GAINS_NONE,
+        .encoding = APP_SAADC_LOG_ENCODING_CLEAR,
+    };
+
+    if (m_evt_handler == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    return chunk_queue(&info, NULL, 0);
+}
+
+
+/**@brief Function for finding the flash address of a view offset.
+ *
+ * @param[in]  offset  Offset in the view.
+ * @param[out] p_space Bytes of the view from that address to the end of its page.
+ *
+ * @return Flash address, or 0 if @p offset is at or past the end of the view.
+ */
+static uint32_t view_addr(uint32_t offset, uint32_t * p_space)
+{
+    uint16_t page;
+    uint16_t head;
+    uint16_t start;
+
+    CRITICAL_REGION_ENTER();
+    page  = m_tail_page;
+    head  = m_head_page;
+    start = m_tail_off;
+    CRITICAL_REGION_EXIT();
+
+    for (;;)
+    {
+        uint32_t len = m_page_used[page] - start;
+
+        if (offset < len)
+        {
+            *p_space = len - offset;
+            return PAGE_ADDR(page) + start + offset;
+        }
+        if (page == head)
+        {
+            return 0;
+        }
+        offset -= len;
+        page    = page_next(page);
+        start   = 0;
+    }
+}
+
+
+uint32_t app_saadc_log_size(void)
+{
+    uint32_t size = 0;
+    uint16_t page;
+    uint16_t head;
+    uint16_t start;
+
+    CRITICAL_REGION_ENTER();
+    page  = m_tail_page;
+    head  = m_head_page;
+    start = m_tail_off;
+    CRITICAL_REGION_EXIT();
+
+    for (;;)
+    {
+        size += m_page_used[page] - start;
+        if (page == head)
+        {
+            return size;
+        }
+        page  = page_next(page);
+        start = 0;
+    }
+}
+
+
+ret_code_t app_saadc_log_read(uint32_t offset, void * p_data, uint32_t len)
+{
+    uint8_t * p_dst = p_data;
+
+    ASSERT(p_data || (len == 0));
+
+    while (len > 0)
+    {
+        uint32_t space;
+        uint32_t addr = view_addr(offset, &space);
+        uint32_t n;
+
+        if (addr == 0)
+        {
+            return NRF_ERROR_INVALID_LENGTH;
+        }
+
+        n = MIN(len, space);
+        memcpy(p_dst, (void const *)addr, n);
+        p_dst  += n;
+        offset += n;
+        len    -= n;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t app_saadc_log_chunk_get(uint32_t                 offset,
+                                   app_saadc_log_header_t * p_header,
+                                   void const            ** pp_payload)
+{
+    uint32_t                       space;
+    uint32_t                       addr = view_addr(offset, &space);
+    app_saadc_log_header_t const * p_flash;
+
+    ASSERT(p_header);
+    ASSERT(pp_payload);
+
+    if (addr == 0)
+    {
+        return (offset == app_saadc_log_size()) ? NRF_ERROR_NOT_FOUND : NRF_ERROR_INVALID_ADDR;
+    }
+
+    p_flash = (app_saadc_log_header_t const *)addr;
+    if (!is_word_aligned(p_flash)                ||
+        (p_flash->magic != APP_SAADC_LOG_MAGIC) ||
+        (CHUNK_SIZE(p_flash->length) > space))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    *p_header   = *p_flash;
+    *pp_payload = p_flash + 1;
+
+    return NRF_SUCCESS;
+}
+
+
+bool app_saadc_log_is_busy(void)
+{
+    return (m_queue_count != 0);
+}
+
+
+void app_saadc_log_stats_get(app_saadc_log_stats_t * p_stats)
+{
+    ASSERT(p_stats);
+
+    *p_stats = m_stats;
+}
+
+
+#if APP_SAADC_LOG_CONFIG_OTS_BACKEND
+
+static uint32_t ots_open(void                              * p_context,
+                         uint32_t                            offset,
+                         uint32_t                            len,
+                         bool                                write,
+                         ble_ots_obj_backend_ready_handler_t ready_handler,
+                         void                              * p_ready_context)
+{
+    uint32_t size = app_saadc_log_size();
+
+    UNUSED_PARAMETER(p_context);
+    UNUSED_PARAMETER(ready_handler);
+    UNUSED_PARAMETER(p_ready_context);
+
+    if (write)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+    if ((len > size) || (offset > size - len))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+static uint32_t ots_read(void * p_context, uint32_t offset, uint8_t * p_data, uint16_t len)
+{
+    UNUSED_PARAMETER(p_context);
+
+    return app_saadc_log_read(offset, p_data, len);
+}
+
+
+static uint32_t ots_write(void * p_context, uint32_t offset, uint8_t const * p_data, uint16_t len)
+{
+    UNUSED_PARAMETER(p_context);
+    UNUSED_PARAMETER(offset);
+    UNUSED_PARAMETER(p_data);
+    UNUSED_PARAMETER(len);
+
+    return NRF_ERROR_NOT_SUPPORTED;
+}
+
+
+static uint32_t ots_close(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    return NRF_SUCCESS;
+}
+
+
+ble_ots_obj_backend_t const app_saadc_log_ots_backend =
+{
+    .open  = ots_open,
+    .read  = ots_read,
+    .write = ots_write,
+    .close = ots_close,
+};
+
+#endif // APP_SAADC_LOG_CONFIG_OTS_BACKEND
+#endif // NRF_MODULE_ENABLED(APP_SAADC_LOG)
@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc_log SAADC flash streaming logger
+ * @{
+ * @ingroup app_saadc
+ *
+ * @brief Sequential logging of SAADC buffers to a reserved flash region.
+ *
+ * @details The logger appends buffers to a ring of flash pages given by
+ *          @ref APP_SAADC_LOG_START_ADDR and @ref APP_SAADC_LOG_PAGES, with @ref nrf_fstorage.
+ *          Buffers are written directly from RAM, without copying, so a buffer received in
+ *          @ref APP_SAADC_EVT_DONE can be appended from the event handler and is handed back
+ *          in @ref APP_SAADC_LOG_EVT_RELEASE once it is in flash. With a buffer pool, the
+ *          acquisition continues in the other pool buffers while earlier ones are written.
+ *
+ *          Each buffer is stored as a chunk: a @ref app_saadc_log_header_t followed by the data,
+ *          padded to a whole word. A chunk never crosses a page boundary. The header is written
+ *          after the data, so a chunk interrupted by a reset has no header and is not found
+ *          again. When the ring is full, the oldest page is erased. The page after the one
+ *          being written is erased in advance while the logger is idle, so appending only waits
+ *          for an erase if the logger has no idle time.
+ *
+ *          On initialization, the flash region is scanned and logging resumes at the page after
+ *          the newest chunk. The chunks are then read back as one contiguous stream, the log
+ *          view, with @ref app_saadc_log_read, for example to send them with @ref ble_nus, or
+ *          through @ref app_saadc_log_ots_backend as an Object Transfer Service object. Pages
+ *          erased while the view is read shift the view, so replay should be done while no
+ *          buffers are appended.
+ */
+
+#ifndef APP_SAADC_LOG_H__
+#define APP_SAADC_LOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "sdk_config.h"
+#include "nrf_saadc.h"
+
+#ifndef APP_SAADC_LOG_START_ADDR
+#define APP_SAADC_LOG_START_ADDR 0xC0000
+#endif
+
+#ifndef APP_SAADC_LOG_PAGES
+#define APP_SAADC_LOG_PAGES 32
+#endif
+
+#ifndef APP_SAADC_LOG_QUEUE_SIZE
+#define APP_SAADC_LOG_QUEUE_SIZE 4
+#endif
+
+#ifndef APP_SAADC_LOG_CONFIG_OTS_BACKEND
+#define APP_SAADC_LOG_CONFIG_OTS_BACKEND 0
+#endif
+
+#if APP_SAADC_LOG_CONFIG_OTS_BACKEND
+#include "ble_ots.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define APP_SAADC_LOG_MAGIC      0x5A4C                                    /**< Value of @ref app_saadc_log_header_t::magic. */
+#define APP_SAADC_LOG_PAGE_SIZE  0x1000                                    /**< Size of a flash page. */
+#define APP_SAADC_LOG_SIZE       (APP_SAADC_LOG_PAGES * APP_SAADC_LOG_PAGE_SIZE) /**< Size of the flash region. */
+#define APP_SAADC_LOG_GAINS_NONE 0xFFFFFFFF                                /**< Value of @ref app_saadc_log_chunk_info_t::gains when the gains are not known. */
+
+/**@brief Encodings of the chunk data. */
+typedef enum
+{
+    APP_SAADC_LOG_ENCODING_RAW      = 0x00, ///< Interleaved samples, as in @ref APP_SAADC_EVT_DONE.
+    APP_SAADC_LOG_ENCODING_PACK     = 0x01, ///< Buffer encoded with @ref app_saadc_pack_encode.
+    APP_SAADC_LOG_ENCODING_FEATURES = 0x02, ///< Frames encoded with @ref app_saadc_features_frame_encode.
+    APP_SAADC_LOG_ENCODING_CLEAR    = 0x7F, ///< Marker written by @ref app_saadc_log_clear. Not part of the log view.
+    APP_SAADC_LOG_ENCODING_USER     = 0x80, ///< First encoding available to the application.
+} app_saadc_log_encoding_t;
+
+/**@brief Chunk header, as stored in flash. Multi-byte fields are little endian. */
+typedef struct
+{
+    uint16_t magic;         ///< @ref APP_SAADC_LOG_MAGIC.
+    uint16_t length;        ///< Number of data bytes, padding excluded.
+    uint32_t seq;           ///< Sequence number of the chunk, incremented for each appended buffer.
+    uint32_t timestamp;     ///< Time of the first sample, in app_timer ticks.
+    uint32_t gains;         ///< Gain of each channel in buffer order, 4 bits per channel starting at the LSB, or @ref APP_SAADC_LOG_GAINS_NONE.
+    uint8_t  encoding;      ///< Encoding of the data, see @ref app_saadc_log_encoding_t.
+    uint8_t  channel_count; ///< Number of interleaved channels.
+    uint16_t crc;           ///< CRC-16 of the header up to this field, followed by the data.
+} app_saadc_log_header_t;
+
+/**@brief Description of a buffer to append. */
+typedef struct
+{
+    uint32_t timestamp;     ///< Time of the first sample, in app_timer ticks.
+    uint32_t gains;         ///< Gains, see @ref app_saadc_log_gains_pack.
+    uint8_t  encoding;      ///< Encoding of the data, see @ref app_saadc_log_encoding_t.
+    uint8_t  channel_count; ///< Number of interleaved channels.
+} app_saadc_log_chunk_info_t;
+
+/**@brief Event types. */
+typedef enum
+{
+    APP_SAADC_LOG_EVT_RELEASE, ///< The data of an appended buffer is no longer used.
+    APP_SAADC_LOG_EVT_ERROR,   ///< A chunk could not be written, and is lost.
+} app_saadc_log_evt_type_t;
+
+/**@brief Event structure. */
+typedef struct
+{
+    app_saadc_log_evt_type_t type;  ///< Event type.
+    union
+    {
+        void const * p_data;        ///< Buffer given to @ref app_saadc_log_append, for @ref APP_SAADC_LOG_EVT_RELEASE.
+        struct
+        {
+            ret_code_t err_code;    ///< Error returned by @ref nrf_fstorage.
+            uint32_t   seq;         ///< Sequence number of the lost chunk.
+        } error;                    ///< Data for @ref APP_SAADC_LOG_EVT_ERROR.
+    } data;
+} app_saadc_log_evt_t;
+
+/**@brief Event handler type. Called from the @ref nrf_fstorage event context. */
+typedef void (* app_saadc_log_evt_handler_t)(app_saadc_log_evt_t const * p_evt);
+
+/**@brief Logger statistics. */
+typedef struct
+{
+    uint32_t chunks;        ///< Number of chunks written since initialization.
+    uint32_t dropped;       ///< Number of buffers not appended because the queue was full.
+    uint32_t errors;        ///< Number of chunks lost to flash errors.
+    uint32_t erases;        ///< Number of pages erased.
+} app_saadc_log_stats_t;
+
+/**@brief Function for initializing the logger.
+ *
+ * @details Scans the flash region for chunks written before the last reset. Logging resumes
+ *          at the page after the newest chunk.
+ *
+ * @param[in] evt_handler Event handler.
+ *
+ * @retval NRF_SUCCESS             If the logger was initialized.
+ * @retval NRF_ERROR_NULL          If the event handler is NULL.
+ * @retval NRF_ERROR_NOT_SUPPORTED If the flash page size is not @ref APP_SAADC_LOG_PAGE_SIZE.
+ * @return                         Otherwise an error code from nrf_fstorage_init().
+ */
+ret_code_t app_saadc_log_init(app_saadc_log_evt_handler_t evt_handler);
+
+/**@brief Function for packing channel gains for @ref app_saadc_log_chunk_info_t::gains.
+ *
+ * @param[in] p_gains       Gain of each channel, in buffer order, as in @ref app_saadc_done_evt_t::p_gains,
+ *                          or NULL if not known.
+ * @param[in] channel_count Number of channels.
+ *
+ * @return Packed gains.
+ */
+uint32_t app_saadc_log_gains_pack(nrf_saadc_gain_t const * p_gains, uint8_t channel_count);
+
+/**@brief Function for appending a buffer to the log.
+ *
+ * @details The buffer is written from @p p_data, so it must not be modified until
+ *          @ref APP_SAADC_LOG_EVT_RELEASE is received for it. The event is also sent if the
+ *          write fails afterwards. If this function returns an error, no event is sent and
+ *          the buffer can be reused at once.
+ *
+ * @param[in] p_info Description of the buffer. Copied.
+ * @param[in] p_data Data, word aligned.
+ * @param[in] length Number of bytes of data. At most one page less the chunk header.
+ *
+ * @retval NRF_SUCCESS              If the buffer was queued for writing.
+ * @retval NRF_ERROR_INVALID_STATE  If the logger is not initialized.
+ * @retval NRF_ERROR_INVALID_ADDR   If @p p_data is not word aligned.
+ * @retval NRF_ERROR_INVALID_LENGTH If the length is 0 or too large.
+ * @retval NRF_ERROR_NO_MEM         If @ref APP_SAADC_LOG_QUEUE_SIZE buffers are already queued.
+ */
+ret_code_t app_saadc_log_append(app_saadc_log_chunk_info_t const * p_info,
+                                void const                       * p_data,
+                                uint16_t                           length);
+
+/**@brief Function for discarding the log view.
+ *
+ * @details A marker chunk is queued, and the view is emptied once it is written. The marker is
+ *          found again after a reset, so the discarded chunks are not read back. Their pages
+ *          are erased when the ring reaches them.
+ *
+ * @retval NRF_SUCCESS             If the marker was queued.
+ * @retval NRF_ERROR_INVALID_STATE If the logger is not initialized.
+ * @retval NRF_ERROR_NO_MEM        If the queue is full.
+ */
+ret_code_t app_saadc_log_clear(void);
+
+/**@brief Function for getting the size of the log view.
+ *
+ * @return Number of bytes in the view, chunk headers and padding included.
+ */
+uint32_t app_saadc_log_size(void);
+
+/**@brief Function for reading from the log view.
+ *
+ * @details The view holds the chunks from the oldest to the newest. Chunks are word aligned
+ *          and follow each other without gaps, so the next chunk starts at
+ *          @c sizeof(app_saadc_log_header_t) plus the length rounded up to a word.
+ *
+ * @param[in]  offset Offset in the view.
+ * @param[out] p_data Data read.
+ * @param[in]  len    Number of bytes to read.
+ *
+ * @retval NRF_SUCCESS              If the data was read.
+ * @retval NRF_ERROR_INVALID_LENGTH If the range is outside the view.
+ */
+ret_code_t app_saadc_log_read(uint32_t offset, void * p_data, uint32_t len);
+
+/**@brief Function for getting a chunk of the log view without copying.
+ *
+ * @param[in]  offset     Offset of the chunk in the view. 0 for the oldest chunk.
+ * @param[out] p_header   Chunk header.
+ * @param[out] pp_payload Data of the chunk, in flash. Valid until its page is erased.
+ *
+ * @retval NRF_SUCCESS            If the chunk was found.
+ * @retval NRF_ERROR_NOT_FOUND    If @p offset is the end of the view.
+ * @retval NRF_ERROR_INVALID_ADDR If @p offset is not the start of a chunk in the view.
+ */
+ret_code_t app_saadc_log_chunk_get(uint32_t                 offset,
+                                   app_saadc_log_header_t * p_header,
+                                   void const            ** pp_payload);
+
+/**@brief Function for checking if buffers are queued or being written.
+ *
+ * @retval true  If the logger is writing.
+ * @retval false Otherwise.
+ */
+bool app_saadc_log_is_busy(void);
+
+/**@brief Function for reading the logger statistics.
+ *
+ * @param[out] p_stats Statistics since initialization.
+ */
+void app_saadc_log_stats_get(app_saadc_log_stats_t * p_stats);
+
+#if APP_SAADC_LOG_CONFIG_OTS_BACKEND
+/**@brief Read-only Object Transfer Service backend for the log view.
+ *
+ * @details Set @ref ble_ots_object_t::current_size to @ref app_saadc_log_size before the
+ *          object is read. The context of the backend functions is not used.
+ */
+extern ble_ots_obj_backend_t const app_saadc_log_ots_backend;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_LOG_H__
+
+/** @} */
@@ -0,0 +1,445 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
+#include <string.h>
+#include "app_saadc_multirate.h"
+#include "nrf.h"
+
+STATIC_ASSERT(IS_POWER_OF_TWO(APP_SAADC_MULTIRATE_LATE_LOG_SIZE));
+STATIC_ASSERT(APP_SAADC_MULTIRATE_LATE_LOG_SIZE <= 128);
+
+#define RING_SIZE_MAX 0x8000 /**< Largest output ring that free-running 16-bit indices can track. */
+
+
+/**@brief Function for getting the SAADC channel converted first in a mask. */
+__STATIC_INLINE uint8_t mask_first_channel(uint8_t mask)
+{
+    return (uint8_t)__CLZ(__RBIT((uint32_t)mask));
+}
+
+
+/**@brief Function for getting the mask of the channels converted on a frame of the period. */
+static uint8_t mask_at(app_saadc_multirate_t const * p_mr, uint32_t frame)
+{
+    uint8_t mask = 0;
+
+    for (uint32_t i = 0; i < p_mr->channel_count; i++)
+    {
+        app_saadc_multirate_channel_config_t const * p_config = &p_mr->channels[i].config;
+
+        if ((frame % p_config->divisor) == 0)
+        {
+            mask |= (uint8_t)(1U << p_config->channel);
+        }
+    }
+
+    return mask;
+}
+
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0)
+    {
+        uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+
+/**@brief Function for moving a position in the schedule to the next change. */
+static void step_advance(app_saadc_multirate_t const * p_mr, uint8_t * p_idx, uint32_t * p_base)
+{
+    (*p_idx)++;
+    if (*p_idx == p_mr->step_count)
+    {
+        *p_idx   = 0;
+        *p_base += p_mr->period;
+    }
+}
+
+
+/**@brief Function for getting the mask set by the change before a position in the schedule. */
+static uint8_t mask_before(app_saadc_multirate_t const * p_mr, uint8_t idx)
+{
+    if (p_mr->step_count == 0)
+    {
+        return p_mr->first_mask;
+    }
+    return p_mr->steps[(idx == 0) ? (p_mr->step_count - 1) : (idx - 1)].mask;
+}
+
+
+/**@brief Function for adding a sample of a channel to its output ring.
+ *
+ * @details The sample is attributed to the latest scheduled frame it was not taken before.
+ *          Scheduled frames skipped on the way are counted as missed, and a sample taken
+ *          before the next scheduled frame, when a change was applied late, is dropped.
+ */
+static void sample_put(app_saadc_multirate_channel_t * p_ch, nrf_saadc_value_t value, uint32_t frame)
+{
+    int32_t ahead = (int32_t)(frame - p_ch->next_frame);
+    if (ahead < 0)
+    {
+        return;
+    }
+
+    uint32_t skipped   = (uint32_t)ahead / p_ch->config.divisor;
+    uint32_t scheduled = p_ch->next_frame + skipped * p_ch->config.divisor;
+
+    p_ch->stats.missed += skipped;
+    if (frame != scheduled)
+    {
+        p_ch->stats.late++;
+    }
+    p_ch->next_frame = scheduled + p_ch->config.divisor;
+
+    uint16_t wr_idx = p_ch->wr_idx;
+    if ((uint16_t)(wr_idx - p_ch->rd_idx) >= p_ch->config.ring_size)
+    {
+        p_ch->stats.overflows++;
+        return;
+    }
+    p_ch->config.p_ring[wr_idx & (p_ch->config.ring_size - 1)] = value;
+    p_ch->wr_idx = wr_idx + 1;
+}
+
+
+/**@brief Function for starting a frame of the scan stream.
+ *
+ * @details Applies the changes that took effect up to the frame, on their scheduled frame
+ *          or, if they were applied late, on the frame recorded in the late log.
+ */
+static void demux_frame_begin(app_saadc_multirate_t * p_mr)
+{
+    if (p_mr->desync)
+    {
+        p_mr->synced = false;
+        return;
+    }
+
+    while (p_mr->step_count > 0)
+    {
+        uint32_t scheduled = p_mr->demux_base + p_mr->steps[p_mr->demux_idx].frame;
+        uint32_t effective = scheduled;
+        bool     late      = false;
+        bool     ambiguous = false;
+
+        if (p_mr->late_rd != p_mr->late_wr)
+        {
+            app_saadc_multirate_late_t const * p_late =
+                &p_mr->late_log[p_mr->late_rd & (APP_SAADC_MULTIRATE_LATE_LOG_SIZE - 1)];
+
+            if (p_late->scheduled == scheduled)
+            {
+                late      = true;
+                effective = p_late->applied;
+                ambiguous = p_late->ambiguous;
+            }
+        }
+
+        if ((int32_t)(p_mr->demux_frame - effective) < 0)
+        {
+            break;
+        }
+        if (ambiguous)
+        {
+            // Frame size is unknown from here on.
+            p_mr->synced = false;
+            return;
+        }
+        if (late)
+        {
+            p_mr->late_rd++;
+        }
+
+        p_mr->demux_mask = p_mr->steps[p_mr->demux_idx].mask;
+        step_advance(p_mr, &p_mr->demux_idx, &p_mr->demux_base);
+    }
+
+    p_mr->demux_left = p_mr->demux_mask;
+}
+
+
+ret_code_t app_saadc_multirate_init(app_saadc_multirate_t                      * p_mr,
+                                    app_saadc_multirate_channel_config_t const * p_config,
+                                    uint8_t                                      channel_count)
+{
+    ASSERT(p_mr);
+    ASSERT(p_config);
+
+    if ((channel_count == 0) || (channel_count > NRF_SAADC_CHANNEL_COUNT))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    memset(p_mr, 0, sizeof(*p_mr));
+
+    uint32_t period = 1;
+    bool     base   = false;
+
+    for (uint8_t i = 0; i < channel_count; i++)
+    {
+        app_saadc_multirate_channel_config_t const * p_ch = &p_config[i];
+
+        if ((p_ch->channel >= NRF_SAADC_CHANNEL_COUNT) ||
+            (p_mr->channel_mask & (1U << p_ch->channel)) ||
+            (p_ch->divisor == 0) ||
+            (p_ch->p_ring == NULL) ||
+            (p_ch->ring_size == 0) ||
+            (p_ch->ring_size > RING_SIZE_MAX) ||
+            !IS_POWER_OF_TWO(p_ch->ring_size))
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+
+        period = (period / gcd(period, p_ch->divisor)) * p_ch->divisor;
+        if (period > APP_SAADC_MULTIRATE_MAX_PERIOD)
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+
+        base                      |= (p_ch->divisor == 1);
+        p_mr->channels[i].config   = *p_ch;
+        p_mr->slot[p_ch->channel]  = i;
+        p_mr->channel_mask        |= (uint8_t)(1U << p_ch->channel);
+    }
+
+    if (!base)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_mr->channel_count = channel_count;
+    p_mr->period        = period;
+    p_mr->first_mask    = mask_at(p_mr, 0);
+
+    uint8_t prev = mask_at(p_mr, period - 1);
+    for (uint32_t frame = 0; frame < period; frame++)
+    {
+        uint8_t mask = mask_at(p_mr, frame);
+        if (mask == prev)
+        {
+            continue;
+        }
+        if (p_mr->step_count == APP_SAADC_MULTIRATE_MAX_STEPS)
+        {
+            return NRF_ERROR_NO_MEM;
+        }
+        p_mr->steps[p_mr->step_count].frame = frame;
+        p_mr->steps[p_mr->step_count].mask  = mask;
+        p_mr->step_count++;
+        prev = mask;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+uint16_t app_saadc_multirate_read(app_saadc_multirate_t * p_mr,
+                                  uint8_t                 idx,
+                                  nrf_saadc_value_t     * p_samples,
+                                  uint16_t                max_count)
+{
+    ASSERT(p_mr);
+    ASSERT(idx < p_mr->channel_count);
+
+    app_saadc_multirate_channel_t * p_ch   = &p_mr->channels[idx];
+    uint16_t                        rd_idx = p_ch->rd_idx;
+    uint16_t                        count  = (uint16_t)(p_ch->wr_idx - rd_idx);
+
+    if (count > max_count)
+    {
+        count = max_count;
+    }
+    for (uint16_t i = 0; i < count; i++)
+    {
+        p_samples[i] = p_ch->config.p_ring[(uint16_t)(rd_idx + i) & (p_ch->config.ring_size - 1)];
+    }
+    p_ch->rd_idx = rd_idx + count;
+
+    return count;
+}
+
+
+void app_saadc_multirate_stats_get(app_saadc_multirate_t const * p_mr,
+                                   uint8_t                       idx,
+                                   app_saadc_multirate_stats_t * p_stats)
+{
+    ASSERT(p_mr);
+    ASSERT(p_stats);
+    ASSERT(idx < p_mr->channel_count);
+
+    *p_stats = p_mr->channels[idx].stats;
+}
+
+
+uint8_t app_saadc_multirate_start(app_saadc_multirate_t * p_mr)
+{
+    for (uint32_t i = 0; i < p_mr->channel_count; i++)
+    {
+        app_saadc_multirate_channel_t * p_ch = &p_mr->channels[i];
+
+        p_ch->wr_idx     = 0;
+        p_ch->rd_idx     = 0;
+        p_ch->next_frame = 0;
+        memset(&p_ch->stats, 0, sizeof(p_ch->stats));
+    }
+
+    p_mr->step_idx  = 0;
+    p_mr->step_base = 0;
+    if ((p_mr->step_count > 0) && (p_mr->steps[0].frame == 0))
+    {
+        // The change on frame 0 is the initial mask.
+        step_advance(p_mr, &p_mr->step_idx, &p_mr->step_base);
+    }
+
+    p_mr->late_rd     = 0;
+    p_mr->late_wr     = 0;
+    p_mr->desync      = false;
+    p_mr->dropped     = 0;
+    p_mr->demux_idx   = p_mr->step_idx;
+    p_mr->demux_base  = p_mr->step_base;
+    p_mr->demux_mask  = p_mr->first_mask;
+    p_mr->demux_left  = 0;
+    p_mr->demux_frame = 0;
+    p_mr->synced      = true;
+
+    return p_mr->first_mask;
+}
+
+
+bool app_saadc_multirate_step_get(app_saadc_multirate_t const * p_mr,
+                                  app_saadc_multirate_step_t  * p_step)
+{
+    if (p_mr->step_count == 0)
+    {
+        return false;
+    }
+
+    p_step->frame = p_mr->step_base + p_mr->steps[p_mr->step_idx].frame;
+    p_step->mask  = p_mr->steps[p_mr->step_idx].mask;
+
+    return true;
+}
+
+
+bool app_saadc_multirate_step_done(app_saadc_multirate_t * p_mr, uint32_t frame, bool ambiguous)
+{
+    uint32_t scheduled = p_mr->step_base + p_mr->steps[p_mr->step_idx].frame;
+
+    step_advance(p_mr, &p_mr->step_idx, &p_mr->step_base);
+
+    if ((frame == scheduled) && !ambiguous)
+    {
+        return true;
+    }
+
+    uint8_t late_wr = p_mr->late_wr;
+    if ((uint8_t)(late_wr - p_mr->late_rd) >= APP_SAADC_MULTIRATE_LATE_LOG_SIZE)
+    {
+        p_mr->desync = true;
+        return false;
+    }
+
+    app_saadc_multirate_late_t * p_late =
+        &p_mr->late_log[late_wr & (APP_SAADC_MULTIRATE_LATE_LOG_SIZE - 1)];
+    p_late->scheduled = scheduled;
+    p_late->applied   = frame;
+    p_late->ambiguous = ambiguous;
+    __DMB();
+    p_mr->late_wr = late_wr + 1;
+
+    return !ambiguous;
+}
+
+
+void app_saadc_multirate_resync(app_saadc_multirate_t * p_mr, uint32_t frame)
+{
+    // Continue splitting from the change the scheduler applies next.
+    p_mr->demux_idx   = p_mr->step_idx;
+    p_mr->demux_base  = p_mr->step_base;
+    p_mr->demux_mask  = mask_before(p_mr, p_mr->step_idx);
+    p_mr->demux_left  = 0;
+    p_mr->demux_frame = frame;
+    p_mr->late_rd     = p_mr->late_wr;
+    p_mr->desync      = false;
+    p_mr->synced      = true;
+}
+
+
+void app_saadc_multirate_process(app_saadc_multirate_t   * p_mr,
+                                 nrf_saadc_value_t const * p_buffer,
+                                 uint16_t                  size)
+{
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (p_mr->demux_left == 0)
+        {
+            demux_frame_begin(p_mr);
+        }
+        if (!p_mr->synced)
+        {
+            p_mr->dropped += size - i;
+            return;
+        }
+
+        uint8_t channel = mask_first_channel(p_mr->demux_left);
+        p_mr->demux_left &= (uint8_t)(p_mr->demux_left - 1);
+
+        sample_put(&p_mr->channels[p_mr->slot[channel]], p_buffer[i], p_mr->demux_frame);
+
+        if (p_mr->demux_left == 0)
+        {
+            p_mr->demux_frame++;
+        }
+    }
+}
+
+
+uint32_t app_saadc_multirate_frame_get(app_saadc_multirate_t const * p_mr)
+{
+    return p_mr->demux_frame;
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SAADC_MULTIRATE)
@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc_multirate SAADC multi-rate channel scheduling
+ * @{
+ * @ingroup app_saadc
+ *
+ * @brief Per-channel sample rates within a single hardware-paced SAADC scan sequence.
+ *
+ * @details The SAADC scans all enabled channels on each SAMPLE task, so every channel is
+ *          converted at the pacing rate. With a multi-rate schedule, each channel is given a
+ *          rate divisor and is converted only on every divisor-th frame of the base rate. The
+ *          set of enabled channels is changed between two triggered scans by connecting and
+ *          disconnecting the positive input of the channels, which the SAADC skips when
+ *          unconnected. The schedule repeats over the least common multiple of the divisors
+ *          and is stored as the list of frames on which the set changes.
+ *
+ *          @ref app_saadc counts the SAMPLE tasks with a TIMER in counter mode, and its compare
+ *          interrupt applies each change after the scan before it has ended and before the
+ *          next trigger. A change that is applied late (for example while the SoftDevice holds
+ *          the CPU) is recorded with the frame it actually took effect on, so the scan stream
+ *          is still split exactly: a slow channel then gets a late or a missed sample, never a
+ *          sample of another channel. If a trigger lands while a change is being written, the
+ *          stream is resynchronized on the next buffer boundary and the samples in between
+ *          are dropped.
+ *
+ *          Each filled buffer is split into one output ring per channel before
+ *          @ref APP_SAADC_EVT_DONE. The rings are single producer, single consumer, and are
+ *          read with @ref app_saadc_multirate_read from a lower priority.
+ */
+
+#ifndef APP_SAADC_MULTIRATE_H__
+#define APP_SAADC_MULTIRATE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "sdk_config.h"
+#include "nrf_saadc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef APP_SAADC_MULTIRATE_MAX_STEPS
+#define APP_SAADC_MULTIRATE_MAX_STEPS 16
+#endif
+
+#ifndef APP_SAADC_MULTIRATE_LATE_LOG_SIZE
+#define APP_SAADC_MULTIRATE_LATE_LOG_SIZE 16
+#endif
+
+/**@brief Longest schedule period, in frames of the base rate. */
+#define APP_SAADC_MULTIRATE_MAX_PERIOD 0xFFFF
+
+/**@brief Per-channel configuration. */
+typedef struct
+{
+    uint8_t             channel;   ///< SAADC channel index.
+    uint16_t            divisor;   ///< Channel is converted on every divisor-th frame of the base rate. At least one channel must use 1.
+    nrf_saadc_value_t * p_ring;    ///< Output ring.
+    uint16_t            ring_size; ///< Number of samples in the ring. Must be a power of two.
+} app_saadc_multirate_channel_config_t;
+
+/**@brief Sample counters of a channel. */
+typedef struct
+{
+    uint32_t late;      ///< Samples taken after their scheduled frame because a change was applied late.
+    uint32_t missed;    ///< Scheduled samples that were not taken.
+    uint32_t overflows; ///< Samples dropped because the output ring was full.
+} app_saadc_multirate_stats_t;
+
+/**@brief Change of the set of enabled channels. */
+typedef struct
+{
+    uint32_t frame; ///< First frame converted with the new set.
+    uint8_t  mask;  ///< Mask of enabled SAADC channels.
+} app_saadc_multirate_step_t;
+
+/**@brief Change applied later than scheduled. */
+typedef struct
+{
+    uint32_t scheduled; ///< Frame the change was scheduled for.
+    uint32_t applied;   ///< First frame converted with the change.
+    bool     ambiguous; ///< A trigger landed while the change was written.
+} app_saadc_multirate_late_t;
+
+/**@brief Per-channel state. Fields are internal. */
+typedef struct
+{
+    app_saadc_multirate_channel_config_t config;     ///< Channel configuration.
+    volatile uint16_t                    wr_idx;     ///< Write index in the output ring.
+    volatile uint16_t                    rd_idx;     ///< Read index in the output ring.
+    uint32_t                             next_frame; ///< Scheduled frame of the next sample.
+    app_saadc_multirate_stats_t          stats;      ///< Sample counters.
+} app_saadc_multirate_channel_t;
+
+/**@brief Multi-rate schedule instance. Fields are internal. */
+typedef struct
+{
+    app_saadc_multirate_channel_t channels[NRF_SAADC_CHANNEL_COUNT];  ///< Channel states, in configuration order.
+    uint8_t                       slot[NRF_SAADC_CHANNEL_COUNT];      ///< Configuration index of each SAADC channel.
+    uint8_t                       channel_count;                      ///< Number of scheduled channels.
+    uint8_t                       channel_mask;                       ///< Mask of scheduled SAADC channels.
+    uint8_t                       first_mask;                         ///< Mask of the first frame of the period.
+    uint8_t                       step_count;                         ///< Number of changes in a period.
+    uint32_t                      period;                             ///< Schedule period, in frames.
+    app_saadc_multirate_step_t    steps[APP_SAADC_MULTIRATE_MAX_STEPS]; ///< Changes in a period, by frame.
+    uint8_t                       step_idx;                           ///< Next change to apply.
+    uint32_t                      step_base;                          ///< First frame of the period of the next change.
+    app_saadc_multirate_late_t    late_log[APP_SAADC_MULTIRATE_LATE_LOG_SIZE]; ///< Changes applied late, oldest first.
+    volatile uint8_t              late_wr;                            ///< Write index in the late log.
+    volatile uint8_t              late_rd;                            ///< Read index in the late log.
+    volatile bool                 desync;                             ///< The stream cannot be split until the next resynchronization.
+    uint8_t                       demux_idx;                          ///< Next change expected in the scan stream.
+    uint32_t                      demux_base;                         ///< First frame of the period of the next expected change.
+    uint32_t                      demux_frame;                        ///< Frame of the next sample in the scan stream.
+    uint8_t                       demux_mask;                         ///< Channels in the frame being split.
+    uint8_t                       demux_left;                         ///< Channels of the frame being split not received yet.
+    bool                          synced;                             ///< The position in the scan stream is known.
+    uint32_t                      dropped;                            ///< Samples dropped while not synchronized.
+} app_saadc_multirate_t;
+
+/**@brief Function for initializing a schedule.
+ *
+ * @details The schedule is given to @ref app_saadc_init in @ref app_saadc_config_t::p_multirate.
+ *          The channel mask of the acquisition must match the scheduled channels, and the
+ *          sample interval gives the rate of the channels with divisor 1.
+ *
+ * @param[out] p_mr          Schedule instance.
+ * @param[in]  p_config      Array of @p channel_count channel configurations.
+ * @param[in]  channel_count Number of scheduled channels.
+ *
+ * @retval NRF_SUCCESS             If the schedule was initialized.
+ * @retval NRF_ERROR_INVALID_PARAM If a channel is repeated, a divisor or ring size is invalid,
+ *                                 no channel has divisor 1 or the period is longer than
+ *                                 @ref APP_SAADC_MULTIRATE_MAX_PERIOD.
+ * @retval NRF_ERROR_NO_MEM        If the period has more than APP_SAADC_MULTIRATE_MAX_STEPS changes.
+ */
+ret_code_t app_saadc_multirate_init(app_saadc_multirate_t                      * p_mr,
+                                    app_saadc_multirate_channel_config_t const * p_config,
+                                    uint8_t                                      channel_count);
+
+/**@brief Function for reading samples of a channel from its output ring.
+ *
+ * @param[in]  p_mr      Schedule instance.
+ * @param[in]  idx       Channel position in the configuration.
+ * @param[out] p_samples Destination.
+ * @param[in]  max_count Maximum number of samples to read.
+ *
+ * @return Number of samples read.
+ */
+uint16_t app_saadc_multirate_read(app_saadc_multirate_t * p_mr,
+                                  uint8_t                 idx,
+                                  nrf_saadc_value_t     * p_samples,
+                                  uint16_t                max_count);
+
+/**@brief Function for getting the sample counters of a channel.
+ *
+ * @param[in]  p_mr    Schedule instance.
+ * @param[in]  idx     Channel position in the configuration.
+ * @param[out] p_stats Sample counters since the acquisition was started.
+ */
+void app_saadc_multirate_stats_get(app_saadc_multirate_t const * p_mr,
+                                   uint8_t                       idx,
+                                   app_saadc_multirate_stats_t * p_stats);
+
+/**@brief Function for restarting the schedule on frame 0. Used by @ref app_saadc.
+ *
+ * @return Mask of the channels to enable for the first frame.
+ */
+uint8_t app_saadc_multirate_start(app_saadc_multirate_t * p_mr);
+
+/**@brief Function for getting the next change to apply. Used by @ref app_saadc.
+ *
+ * @param[in]  p_mr   Schedule instance.
+ * @param[out] p_step Scheduled frame and mask of the change.
+ *
+ * @retval true  If the schedule has changes.
+ * @retval false If all channels are converted on every frame.
+ */
+bool app_saadc_multirate_step_get(app_saadc_multirate_t const * p_mr,
+                                  app_saadc_multirate_step_t  * p_step);
+
+/**@brief Function for recording that the next change was applied. Used by @ref app_saadc.
+ *
+ * @param[in] p_mr      Schedule instance.
+ * @param[in] frame     First frame converted with the change.
+ * @param[in] ambiguous A trigger landed while the change was written.
+ *
+ * @retval true  If the scan stream can still be split.
+ * @retval false If the stream must be resynchronized with @ref app_saadc_multirate_resync.
+ */
+bool app_saadc_multirate_step_done(app_saadc_multirate_t * p_mr, uint32_t frame, bool ambiguous);
+
+/**@brief Function for resynchronizing the scan stream after sampling was paused.
+ *        Used by @ref app_saadc.
+ *
+ * @details Must be called with the trigger and the change interrupt stopped. A partial
+ *          frame at the end of the last buffer is discarded, and the next buffer starts
+ *          on @p frame.
+ *
+ * @param[in] p_mr  Schedule instance.
+ * @param[in] frame Number of frames triggered so far.
+ */
+void app_saadc_multirate_resync(app_saadc_multirate_t * p_mr, uint32_t frame);
+
+/**@brief Function for splitting a filled buffer into the output rings. Used by @ref app_saadc.
+ *
+ * @param[in] p_mr     Schedule instance.
+ * @param[in] p_buffer Scan stream samples, following those of the previous buffer.
+ * @param[in] size     Number of samples in the buffer.
+ */
+void app_saadc_multirate_process(app_saadc_multirate_t   * p_mr,
+                                 nrf_saadc_value_t const * p_buffer,
+                                 uint16_t                  size);
+
+/**@brief Function for getting the frame of the next sample in the scan stream.
+ *        Used by @ref app_saadc to timestamp the buffers.
+ */
+uint32_t app_saadc_multirate_frame_get(app_saadc_multirate_t const * p_mr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_MULTIRATE_H__
+
+/** @} */
@@ -0,0 +1,376 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SAADC_PACK)
+#include <string.h>
+#include "app_saadc_pack.h"
+#include "nrf.h"
+
+#define SAMPLE_BITS         16 /**< Bits occupied by a raw sample. */
+#define RICE_ESCAPE         8  /**< Rice quotient from which the value is stored raw after the escape prefix. */
+#define RICE_K_MAX          15 /**< Largest Rice parameter. */
+#define FORMAT_MODE_Pos     5  /**< Position of the mode in the trailer format byte. */
+#define FORMAT_PARAM_Msk    0x1F /**< Mask of the mode parameter in the trailer format byte. */
+
+/**@brief Bit writer, filling bytes from the least significant bit. */
+typedef struct
+{
+    uint8_t * p_data; ///< Output.
+    size_t    pos;    ///< Number of bytes written.
+    uint32_t  acc;    ///< Bits not yet written.
+    uint8_t   bits;   ///< Number of bits in the accumulator.
+} bit_writer_t;
+
+/**@brief Bit reader, matching @ref bit_writer_t. */
+typedef struct
+{
+    uint8_t const * p_data; ///< Input.
+    size_t          length; ///< Number of bytes in the input.
+    size_t          pos;    ///< Number of bytes read.
+    uint32_t        acc;    ///< Bits not yet consumed.
+    uint8_t         bits;   ///< Number of bits in the accumulator.
+} bit_reader_t;
+
+
+/**@brief Function for writing up to 16 bits. Only complete bytes are stored. */
+static void bits_put(bit_writer_t * p_writer, uint32_t value, uint8_t count)
+{
+    p_writer->acc  |= (value & ((1UL << count) - 1)) << p_writer->bits;
+    p_writer->bits += count;
+    while (p_writer->bits >= 8)
+    {
+        p_writer->p_data[p_writer->pos++] = (uint8_t)p_writer->acc;
+        p_writer->acc  >>= 8;
+        p_writer->bits  -= 8;
+    }
+}
+
+
+/**@brief Function for storing the last incomplete byte. */
+static void bits_flush(bit_writer_t * p_writer)
+{
+    if (p_writer->bits > 0)
+    {
+        p_writer->p_data[p_writer->pos++] = (uint8_t)p_writer->acc;
+        p_writer->acc  = 0;
+        p_writer->bits = 0;
+    }
+}
+
+
+/**@brief Function for reading up to 16 bits.
+ *
+ * @retval false If the input ended.
+ */
+static bool bits_get(bit_reader_t * p_reader, uint8_t count, uint32_t * p_value)
+{
+    while (p_reader->bits < count)
+    {
+        if (p_reader->pos >= p_reader->length)
+        {
+            return false;
+        }
+        p_reader->acc  |= (uint32_t)p_reader->p_data[p_reader->pos++] << p_reader->bits;
+        p_reader->bits += 8;
+    }
+    *p_value         = p_reader->acc & ((1UL << count) - 1);
+    p_reader->acc  >>= count;
+    p_reader->bits  -= count;
+    return true;
+}
+
+
+/**@brief Function for mapping a signed delta to an unsigned value, small magnitudes first. */
+__STATIC_INLINE uint16_t zigzag_encode(int16_t delta)
+{
+    return (uint16_t)(((uint16_t)delta << 1) ^ (uint16_t)(delta >> 15));
+}
+
+
+/**@brief Function for reversing @ref zigzag_encode. */
+__STATIC_INLINE int16_t zigzag_decode(uint16_t value)
+{
+    return (int16_t)((value >> 1) ^ (uint16_t)(0U - (value & 1U)));
+}
+
+
+/**@brief Function for getting the number of bits of the Rice code of a value. */
+__STATIC_INLINE uint8_t rice_length(uint16_t value, uint8_t k)
+{
+    uint16_t q = value >> k;
+    return (q < RICE_ESCAPE) ? (uint8_t)(q + 1 + k) : (RICE_ESCAPE + SAMPLE_BITS);
+}
+
+
+/**@brief Function for getting the two's complement width that holds a value. */
+static uint8_t signed_width(int32_t value)
+{
+    uint32_t magnitude = (value < 0) ? ~(uint32_t)value : (uint32_t)value;
+    return (magnitude == 0) ? 1 : (uint8_t)(33 - __CLZ(magnitude));
+}
+
+
+ret_code_t app_saadc_pack_encode(nrf_saadc_value_t *   p_buffer,
+                                 uint16_t              size,
+                                 uint8_t               channel_count,
+                                 app_saadc_pack_mode_t mode,
+                                 size_t *              p_length)
+{
+    ASSERT(p_buffer);
+    ASSERT(p_length);
+
+    if ((size == 0) || (channel_count == 0) || (channel_count > NRF_SAADC_CHANNEL_COUNT) ||
+        ((size % channel_count) != 0))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    nrf_saadc_value_t prev[NRF_SAADC_CHANNEL_COUNT] = {0};
+    int16_t           min = INT16_MAX;
+    int16_t           max = INT16_MIN;
+    uint32_t          zigzag_sum = 0;
+    uint8_t           ch = 0;
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        int16_t value = p_buffer[i];
+        min         = MIN(min, value);
+        max         = MAX(max, value);
+        if (i >= channel_count)
+        {
+            zigzag_sum += zigzag_encode((int16_t)(uint16_t)(value - prev[ch]));
+        }
+        prev[ch]    = value;
+        ch          = (ch + 1 == channel_count) ? 0 : ch + 1;
+    }
+
+    // Rice parameter close to log2 of the mean coded value.
+    uint32_t mean = (size > channel_count) ? zigzag_sum / (size - channel_count) : 0;
+    uint8_t  k    = (mean == 0) ? 0 : (uint8_t)(31 - __CLZ(mean));
+    k = MIN(k, RICE_K_MAX);
+
+    uint8_t  width      = MAX(signed_width(min), signed_width(max));
+    uint32_t bits_total = (uint32_t)width * size;
+    uint32_t rice_total = (uint32_t)SAMPLE_BITS * channel_count;
+    bool     rice_fits  = true;
+
+    // The first frame is stored raw and seeds the deltas.
+    memcpy(prev, p_buffer, channel_count * sizeof(nrf_saadc_value_t));
+    ch = 0;
+    for (uint16_t i = channel_count; (i < size) && rice_fits; i++)
+    {
+        int16_t value = p_buffer[i];
+        rice_total += rice_length(zigzag_encode((int16_t)(uint16_t)(value - prev[ch])), k);
+        prev[ch]    = value;
+        ch          = (ch + 1 == channel_count) ? 0 : ch + 1;
+
+        // Encoding in place must never overwrite samples that were not read yet.
+        rice_fits = (rice_total <= (uint32_t)SAMPLE_BITS * (i + 1));
+    }
+
+    if ((mode == APP_SAADC_PACK_MODE_DELTA_RICE) ||
+        ((mode == APP_SAADC_PACK_MODE_AUTO) && rice_fits && (rice_total < bits_total)))
+    {
+        if (!rice_fits)
+        {
+            return NRF_ERROR_NO_MEM;
+        }
+        mode       = APP_SAADC_PACK_MODE_DELTA_RICE;
+        bits_total = rice_total;
+    }
+    else
+    {
+        mode = APP_SAADC_PACK_MODE_BITS;
+    }
+
+    size_t length = ((bits_total + 7) / 8) + APP_SAADC_PACK_TRAILER_SIZE;
+    if (length >= (size_t)size * sizeof(nrf_saadc_value_t))
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    bit_writer_t writer = {.p_data = (uint8_t *)p_buffer};
+    uint8_t      param;
+
+    memset(prev, 0, sizeof(prev));
+    ch = 0;
+    for (uint16_t i = 0; i < size; i++)
+    {
+        int16_t value = p_buffer[i];
+
+        if (mode == APP_SAADC_PACK_MODE_BITS)
+        {
+            bits_put(&writer, (uint16_t)value, width);
+            continue;
+        }
+
+        uint16_t coded = zigzag_encode((int16_t)(uint16_t)(value - prev[ch]));
+        uint16_t q     = coded >> k;
+        prev[ch]       = value;
+        ch             = (ch + 1 == channel_count) ? 0 : ch + 1;
+
+        if (i < channel_count)
+        {
+            bits_put(&writer, (uint16_t)value, SAMPLE_BITS);
+        }
+        else if (q < RICE_ESCAPE)
+        {
+            // Unary quotient terminated by a zero, then the remainder.
+            bits_put(&writer, (1UL << q) - 1, (uint8_t)(q + 1));
+            bits_put(&writer, coded, k);
+        }
+        else
+        {
+            bits_put(&writer, (1UL << RICE_ESCAPE) - 1, RICE_ESCAPE);
+            bits_put(&writer, coded, SAMPLE_BITS);
+        }
+    }
+    bits_flush(&writer);
+
+    param = (mode == APP_SAADC_PACK_MODE_BITS) ? (uint8_t)(width - 1) : k;
+    writer.p_data[writer.pos++] = (uint8_t)size;
+    writer.p_data[writer.pos++] = (uint8_t)(size >> 8);
+    writer.p_data[writer.pos++] = (uint8_t)((mode << FORMAT_MODE_Pos) | param);
+
+    *p_length = writer.pos;
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t app_saadc_pack_decode(uint8_t const *     p_data,
+                                 size_t              length,
+                                 uint8_t             channel_count,
+                                 nrf_saadc_value_t * p_buffer,
+                                 uint16_t *          p_size)
+{
+    ASSERT(p_data);
+    ASSERT(p_buffer);
+    ASSERT(p_size);
+
+    if ((length < APP_SAADC_PACK_TRAILER_SIZE) || (channel_count == 0) ||
+        (channel_count > NRF_SAADC_CHANNEL_COUNT))
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+
+    uint8_t const * p_trailer = &p_data[length - APP_SAADC_PACK_TRAILER_SIZE];
+    uint16_t        size      = (uint16_t)(p_trailer[0] | (p_trailer[1] << 8));
+    uint8_t         mode      = p_trailer[2] >> FORMAT_MODE_Pos;
+    uint8_t         param     = p_trailer[2] & FORMAT_PARAM_Msk;
+
+    if (((size % channel_count) != 0) ||
+        ((mode != APP_SAADC_PACK_MODE_BITS) && (mode != APP_SAADC_PACK_MODE_DELTA_RICE)) ||
+        ((mode == APP_SAADC_PACK_MODE_DELTA_RICE) && (param > RICE_K_MAX)))
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+    if (size > *p_size)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    bit_reader_t      reader = {.p_data = p_data, .length = length - APP_SAADC_PACK_TRAILER_SIZE};
+    nrf_saadc_value_t prev[NRF_SAADC_CHANNEL_COUNT] = {0};
+    uint8_t           ch = 0;
+    uint32_t          value;
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (mode == APP_SAADC_PACK_MODE_BITS)
+        {
+            uint8_t width = param + 1;
+            if (!bits_get(&reader, width, &value))
+            {
+                return NRF_ERROR_INVALID_DATA;
+            }
+            if (value & (1UL << (width - 1)))
+            {
+                // Sign extension.
+                value |= ~((1UL << width) - 1);
+            }
+            p_buffer[i] = (nrf_saadc_value_t)(int32_t)value;
+            continue;
+        }
+
+        if (i < channel_count)
+        {
+            if (!bits_get(&reader, SAMPLE_BITS, &value))
+            {
+                return NRF_ERROR_INVALID_DATA;
+            }
+            prev[ch]    = (nrf_saadc_value_t)(uint16_t)value;
+            p_buffer[i] = prev[ch];
+            ch          = (ch + 1 == channel_count) ? 0 : ch + 1;
+            continue;
+        }
+
+        uint16_t q = 0;
+        uint32_t bit;
+        do
+        {
+            if (!bits_get(&reader, 1, &bit))
+            {
+                return NRF_ERROR_INVALID_DATA;
+            }
+        } while ((bit != 0) && (++q < RICE_ESCAPE));
+
+        if (q < RICE_ESCAPE)
+        {
+            if (!bits_get(&reader, param, &value))
+            {
+                return NRF_ERROR_INVALID_DATA;
+            }
+            value |= (uint32_t)q << param;
+        }
+        else if (!bits_get(&reader, SAMPLE_BITS, &value))
+        {
+            return NRF_ERROR_INVALID_DATA;
+        }
+
+        prev[ch]    = (nrf_saadc_value_t)(uint16_t)(prev[ch] + zigzag_decode((uint16_t)value));
+        p_buffer[i] = prev[ch];
+        ch          = (ch + 1 == channel_count) ? 0 : ch + 1;
+    }
+
+    *p_size = size;
+    return NRF_SUCCESS;
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SAADC_PACK)
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_saadc_pack SAADC sample buffer encoder
+ * @{
+ * @ingroup app_saadc
+ *
+ * @brief Compact encoding of SAADC buffers for storage or transmission.
+ *
+ * @details Samples are stored as 16-bit values, even though the conversions are only
+ *          8 to 14 bits wide. The encoder packs a buffer in place, either to the number
+ *          of bits that the samples actually span, or as per-channel deltas coded with
+ *          zig-zag mapping and a Rice code whose parameter is chosen per buffer. In the
+ *          delta mode, the first frame is stored raw, and deltas whose Rice quotient is too
+ *          large are stored raw after an escape prefix, which bounds the worst case.
+ *
+ *          Each encoded buffer is self-contained and ends with a trailer holding the
+ *          sample count and the format, so it can be decoded without the previous
+ *          buffers, for example when a notification is lost on the radio link.
+ */
+
+#ifndef APP_SAADC_PACK_H__
+#define APP_SAADC_PACK_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sdk_errors.h"
+#include "nrf_saadc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define APP_SAADC_PACK_TRAILER_SIZE 3 /**< Number of bytes appended to the encoded samples. */
+
+/**@brief Encoding modes. */
+typedef enum
+{
+    APP_SAADC_PACK_MODE_BITS,       ///< Pack the samples to the bit width they span.
+    APP_SAADC_PACK_MODE_DELTA_RICE, ///< Code per-channel deltas with zig-zag mapping and a Rice code.
+    APP_SAADC_PACK_MODE_AUTO,       ///< Use the mode that gives the shorter output.
+} app_saadc_pack_mode_t;
+
+/**@brief Function for encoding a buffer in place.
+ *
+ * @details On error, the buffer is left unmodified and can be sent as raw samples.
+ *
+ * @param[inout] p_buffer      Interleaved samples, overwritten with the encoded data.
+ * @param[in]    size          Number of samples in the buffer.
+ * @param[in]    channel_count Number of interleaved channels. Deltas are taken per channel.
+ * @param[in]    mode          Encoding mode.
+ * @param[out]   p_length      Length of the encoded data in bytes, trailer included.
+ *
+ * @retval NRF_SUCCESS             If the buffer was encoded.
+ * @retval NRF_ERROR_INVALID_PARAM If the size is 0 or not a multiple of the channel count.
+ * @retval NRF_ERROR_NO_MEM        If the encoded data would not be shorter than the raw samples.
+ */
+ret_code_t app_saadc_pack_encode(nrf_saadc_value_t *   p_buffer,
+                                 uint16_t              size,
+                                 uint8_t               channel_count,
+                                 app_saadc_pack_mode_t mode,
+                                 size_t *              p_length);
+
+/**@brief Function for decoding a buffer.
+ *
+ * @param[in]    p_data        Encoded data, trailer included.
+ * @param[in]    length        Length of the encoded data in bytes.
+ * @param[in]    channel_count Number of interleaved channels used when encoding.
+ * @param[out]   p_buffer      Decoded samples.
+ * @param[inout] p_size        In: capacity of @p p_buffer in samples. Out: number of decoded samples.
+ *
+ * @retval NRF_SUCCESS            If the data was decoded.
+ * @retval NRF_ERROR_INVALID_DATA If the data is malformed.
+ * @retval NRF_ERROR_NO_MEM       If @p p_buffer is too small.
+ */
+ret_code_t app_saadc_pack_decode(uint8_t const *     p_data,
+                                 size_t              length,
+                                 uint8_t             channel_count,
+                                 nrf_saadc_value_t * p_buffer,
+                                 uint16_t *          p_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SAADC_PACK_H__
+
+/** @} */
@@ -0,0 +1,332 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_SCHED_PRIO)
+#include "app_sched_prio.h"
+#include <string.h>
+#include "app_timer.h"
+#include "app_util_platform.h"
+#include "nrf_assert.h"
+#include "nrf_trace.h"
+#include "nrf_mem_telemetry.h"
+
+/**@brief Event in a queue. */
+typedef struct
+{
+    app_sched_event_handler_t handler;
+    uint32_t                  timestamp;  /**< Value of app_timer_cnt_get() when the event was put. */
+    uint16_t                  size;
+    uint32_t                  data[CEIL_DIV(APP_SCHED_PRIO_EVENT_SIZE, sizeof(uint32_t))];
+} sched_evt_t;
+
+/**@brief Queue of a priority level. */
+typedef struct
+{
+    sched_evt_t          * p_evts;
+    uint16_t               size;
+    uint16_t               budget;    /**< Events run in a pass, or 0 for no limit. */
+    uint16_t               head;      /**< Index of the oldest event. Changed by the main loop only. */
+    uint16_t               tail;      /**< Index of the next event put. */
+    uint16_t volatile      count;
+    app_sched_prio_stats_t stats;
+} sched_queue_t;
+
+static sched_evt_t m_high_evts[APP_SCHED_PRIO_HIGH_QUEUE_SIZE];
+static sched_evt_t m_normal_evts[APP_SCHED_PRIO_NORMAL_QUEUE_SIZE];
+static sched_evt_t m_low_evts[APP_SCHED_PRIO_LOW_QUEUE_SIZE];
+
+static sched_queue_t m_queues[APP_SCHED_PRIO_COUNT] =
+{
+    [APP_SCHED_PRIO_HIGH]   = { m_high_evts,   ARRAY_SIZE(m_high_evts),   APP_SCHED_PRIO_HIGH_BUDGET   },
+    [APP_SCHED_PRIO_NORMAL] = { m_normal_evts, ARRAY_SIZE(m_normal_evts), APP_SCHED_PRIO_NORMAL_BUDGET },
+    [APP_SCHED_PRIO_LOW]    = { m_low_evts,    ARRAY_SIZE(m_low_evts),    APP_SCHED_PRIO_LOW_BUDGET    },
+};
+
+#if APP_SCHED_PRIO_AGING_MS
+#define AGING_TICKS APP_TIMER_TICKS(APP_SCHED_PRIO_AGING_MS)
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+static void mem_telemetry_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats)
+{
+    sched_queue_t const * p_queue = p_object;
+
+    p_stats->capacity   = p_queue->size;
+    p_stats->used       = p_queue->count;
+    p_stats->high_water = p_queue->stats.depth_max;
+    p_stats->failures   = p_queue->stats.dropped;
+}
+
+static void mem_telemetry_reset(void const * p_object)
+{
+    sched_queue_t * p_queue = (sched_queue_t *)p_object;
+
+    CRITICAL_REGION_ENTER();
+    p_queue->stats.depth_max = p_queue->count;
+    p_queue->stats.dropped   = 0;
+    CRITICAL_REGION_EXIT();
+}
+
+NRF_MEM_TELEMETRY_SOURCE_DEF(m_high, "sched_prio_high", &m_queues[APP_SCHED_PRIO_HIGH],
+                             NRF_MEM_TELEMETRY_UNIT_ELEMENTS,
+                             mem_telemetry_usage_get, mem_telemetry_reset);
+NRF_MEM_TELEMETRY_SOURCE_DEF(m_normal, "sched_prio_normal", &m_queues[APP_SCHED_PRIO_NORMAL],
+                             NRF_MEM_TELEMETRY_UNIT_ELEMENTS,
+                             mem_telemetry_usage_get, mem_telemetry_reset);
+NRF_MEM_TELEMETRY_SOURCE_DEF(m_low, "sched_prio_low", &m_queues[APP_SCHED_PRIO_LOW],
+                             NRF_MEM_TELEMETRY_UNIT_ELEMENTS,
+                             mem_telemetry_usage_get, mem_telemetry_reset);
+#endif // NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+
+ret_code_t app_sched_prio_event_put(void const              * p_event_data,
+                                    uint16_t                  event_size,
+                                    app_sched_event_handler_t handler,
+                                    app_sched_prio_level_t    level)
+{
+    ret_code_t err_code = NRF_SUCCESS;
+
+    ASSERT(handler != NULL);
+    if ((uint32_t)level >= APP_SCHED_PRIO_COUNT)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    if (event_size > APP_SCHED_PRIO_EVENT_SIZE)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    sched_queue_t * p_queue = &m_queues[level];
+
+    CRITICAL_REGION_ENTER();
+    if (p_queue->count == p_queue->size)
+    {
+        p_queue->stats.dropped++;
+        err_code = NRF_ERROR_NO_MEM;
+    }
+    else
+    {
+        sched_evt_t * p_evt = &p_queue->p_evts[p_queue->tail];
+
+        p_evt->handler   = handler;
+        p_evt->timestamp = app_timer_cnt_get();
+        p_evt->size      = event_size;
+        if (p_event_data != NULL)
+        {
+            memcpy(p_evt->data, p_event_data, event_size);
+        }
+        p_queue->tail = (p_queue->tail + 1 == p_queue->size) ? 0 : (p_queue->tail + 1);
+        p_queue->count++;
+        if (p_queue->count > p_queue->stats.depth_max)
+        {
+            p_queue->stats.depth_max = p_queue->count;
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    return err_code;
+}
+
+/**@brief Function for choosing the level of the next event.
+ *
+ * @param[in] p_budget Events each level may still run in the current pass.
+ * @param[in] now      Current value of app_timer_cnt_get().
+ * @param[out] p_aged  Set to true if the event is run because of its waiting time.
+ *
+ * @return Level of the next event, or APP_SCHED_PRIO_COUNT if no level may run an event.
+ */
+static uint32_t level_select(uint16_t const * p_budget, uint32_t now, bool * p_aged)
+{
+    uint32_t level;
+
+#if APP_SCHED_PRIO_AGING_MS
+    uint32_t oldest     = APP_SCHED_PRIO_COUNT;
+    uint32_t oldest_age = AGING_TICKS;
+
+    // The highest level is never aged, as it is served before the others anyway. On equal
+    // waiting times the higher level is chosen.
+    for (level = APP_SCHED_PRIO_COUNT - 1; level > 0; level--)
+    {
+        sched_queue_t const * p_queue = &m_queues[level];
+
+        if (p_queue->count != 0)
+        {
+            uint32_t age = app_timer_cnt_diff_compute(now, p_queue->p_evts[p_queue->head].timestamp);
+            if (age >= oldest_age)
+            {
+                oldest     = level;
+                oldest_age = age;
+            }
+        }
+    }
+    if (oldest != APP_SCHED_PRIO_COUNT)
+    {
+        // Skipped if the higher levels are empty anyway.
+        for (level = 0; level < oldest; level++)
+        {
+            if (m_queues[level].count != 0)
+            {
+                *p_aged = true;
+                return oldest;
+            }
+        }
+    }
+#else
+    UNUSED_PARAMETER(now);
+#endif
+
+    *p_aged = false;
+    for (level = 0; level < APP_SCHED_PRIO_COUNT; level++)
+    {
+        if ((m_queues[level].count != 0) && (p_budget[level] != 0))
+        {
+            return level;
+        }
+    }
+    return APP_SCHED_PRIO_COUNT;
+}
+
+/**@brief Function for starting a pass.
+ *
+ * @param[out] p_budget Events each level may run in the pass.
+ *
+ * @retval true  If an event is waiting.
+ * @retval false If all queues are empty.
+ */
+static bool pass_start(uint16_t * p_budget)
+{
+    bool pending = false;
+
+    for (uint32_t level = 0; level < APP_SCHED_PRIO_COUNT; level++)
+    {
+        p_budget[level] = (m_queues[level].budget != 0) ? m_queues[level].budget : UINT16_MAX;
+        pending |= (m_queues[level].count != 0);
+    }
+    return pending;
+}
+
+void app_sched_prio_execute(void)
+{
+    uint16_t budget[APP_SCHED_PRIO_COUNT];
+
+    if (!pass_start(budget))
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        uint32_t now = app_timer_cnt_get();
+        bool     aged;
+        uint32_t level = level_select(budget, now, &aged);
+
+        if (level == APP_SCHED_PRIO_COUNT)
+        {
+            if (!pass_start(budget))
+            {
+                return;
+            }
+            continue;
+        }
+
+        sched_queue_t * p_queue = &m_queues[level];
+        sched_evt_t   * p_evt   = &p_queue->p_evts[p_queue->head];
+        uint32_t        wait    = app_timer_cnt_diff_compute(now, p_evt->timestamp);
+
+        // A level without a budget keeps UINT16_MAX, as it is reloaded on every pass.
+        if ((p_queue->budget != 0) && (budget[level] != 0))
+        {
+            budget[level]--;
+        }
+
+        p_queue->stats.executed++;
+        p_queue->stats.aged       += aged ? 1 : 0;
+        p_queue->stats.wait_total += wait;
+        if (wait > p_queue->stats.wait_max)
+        {
+            p_queue->stats.wait_max = wait;
+        }
+
+        NRF_TRACE_SCHED_START(p_evt->handler);
+        p_evt->handler((p_evt->size != 0) ? p_evt->data : NULL, p_evt->size);
+        NRF_TRACE_SCHED_STOP(p_evt->handler);
+
+        // The slot is released after the handler, which reads the event data in place.
+        CRITICAL_REGION_ENTER();
+        p_queue->head = (p_queue->head + 1 == p_queue->size) ? 0 : (p_queue->head + 1);
+        p_queue->count--;
+        CRITICAL_REGION_EXIT();
+    }
+}
+
+bool app_sched_prio_is_pending(void)
+{
+    for (uint32_t level = 0; level < APP_SCHED_PRIO_COUNT; level++)
+    {
+        if (m_queues[level].count != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void app_sched_prio_stats_get(app_sched_prio_level_t level, app_sched_prio_stats_t * p_stats)
+{
+    ASSERT((uint32_t)level < APP_SCHED_PRIO_COUNT);
+    ASSERT(p_stats != NULL);
+
+    CRITICAL_REGION_ENTER();
+    *p_stats       = m_queues[level].stats;
+    p_stats->depth = m_queues[level].count;
+    CRITICAL_REGION_EXIT();
+}
+
+void app_sched_prio_stats_reset(void)
+{
+    CRITICAL_REGION_ENTER();
+    for (uint32_t level = 0; level < APP_SCHED_PRIO_COUNT; level++)
+    {
+        memset(&m_queues[level].stats, 0, sizeof(m_queues[level].stats));
+        m_queues[level].stats.depth_max = m_queues[level].count;
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+#endif // NRF_MODULE_ENABLED(APP_SCHED_PRIO)
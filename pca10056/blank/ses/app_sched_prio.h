@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_sched_prio Priority scheduler
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Scheduler with one event queue per priority level.
+ *
+ * @details Same use as @ref app_scheduler: events are put from interrupt handlers, and the main
+ *          loop calls @ref app_sched_prio_execute to run their handlers. Each event is put in the
+ *          queue of one of the @ref app_sched_prio_level_t levels, so a burst of events on one
+ *          level does not delay the events of a higher level.
+ *
+ *          Events are run in passes. In a pass, a level runs events only when every higher
+ *          level is empty or has used up its budget, and a level runs at most its budget of
+ *          events (APP_SCHED_PRIO_<LEVEL>_BUDGET, 0 for no limit). A new pass starts when no
+ *          level with events has budget left. An event that has waited for
+ *          APP_SCHED_PRIO_AGING_MS or longer is run before the events of the higher levels, so a
+ *          lower level is not starved by a higher level without a budget.
+ *
+ *          The app_timer, nrf_sdh and nrf_pwr_mgmt modules put their events in the levels
+ *          selected by APP_SCHED_PRIO_APP_TIMER_LEVEL, APP_SCHED_PRIO_SDH_LEVEL and
+ *          APP_SCHED_PRIO_PWR_MGMT_LEVEL instead of using @ref app_scheduler.
+ *
+ * @note    Waiting times are measured with @ref app_timer_cnt_get, so the app_timer module must
+ *          be initialized before the first event is put.
+ */
+
+#ifndef APP_SCHED_PRIO_H__
+#define APP_SCHED_PRIO_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "app_scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Priority levels, from the highest. */
+typedef enum
+{
+    APP_SCHED_PRIO_HIGH,    /**< Latency sensitive events, for example acquisition buffers. */
+    APP_SCHED_PRIO_NORMAL,  /**< Application events. */
+    APP_SCHED_PRIO_LOW,     /**< Housekeeping, for example SoftDevice events. */
+    APP_SCHED_PRIO_COUNT    /**< Number of priority levels. */
+} app_sched_prio_level_t;
+
+/**@brief Statistics of a priority level. Times are in app_timer ticks. */
+typedef struct
+{
+    uint16_t depth;         /**< Events in the queue. */
+    uint16_t depth_max;     /**< Highest number of events in the queue. */
+    uint32_t executed;      /**< Events run. */
+    uint32_t aged;          /**< Events run ahead of higher levels because of their waiting time. */
+    uint32_t dropped;       /**< Events not put because the queue was full. */
+    uint32_t wait_max;      /**< Longest time between putting an event and running it. */
+    uint64_t wait_total;    /**< Sum of the waiting times of the events run. */
+} app_sched_prio_stats_t;
+
+/**@brief Function for putting an event in the queue of a priority level.
+ *
+ * @param[in] p_event_data Data passed to the handler, or NULL.
+ * @param[in] event_size   Size of the data, at most APP_SCHED_PRIO_EVENT_SIZE.
+ * @param[in] handler      Event handler.
+ * @param[in] level        Priority level.
+ *
+ * @retval NRF_SUCCESS              If the event was put.
+ * @retval NRF_ERROR_INVALID_PARAM  If @p level does not exist.
+ * @retval NRF_ERROR_INVALID_LENGTH If @p event_size is too large.
+ * @retval NRF_ERROR_NO_MEM         If the queue of the level is full.
+ */
+ret_code_t app_sched_prio_event_put(void const              * p_event_data,
+                                    uint16_t                  event_size,
+                                    app_sched_event_handler_t handler,
+                                    app_sched_prio_level_t    level);
+
+/**@brief Function for running the handlers of all events, including the events put meanwhile.
+ *
+ * @details Must be called from the main loop, as @ref app_sched_execute.
+ */
+void app_sched_prio_execute(void);
+
+/**@brief Function for checking if any priority level has events.
+ *
+ * @retval true  If an event is waiting.
+ * @retval false If all queues are empty.
+ */
+bool app_sched_prio_is_pending(void);
+
+/**@brief Function for getting the statistics of a priority level.
+ *
+ * @param[in]  level   Priority level.
+ * @param[out] p_stats Statistics.
+ */
+void app_sched_prio_stats_get(app_sched_prio_level_t level, app_sched_prio_stats_t * p_stats);
+
+/**@brief Function for clearing the statistics of all priority levels, except the queue depths. */
+void app_sched_prio_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_SCHED_PRIO_H__
+
+/** @} */
@@ -38,6 +38,8 @@
  *
  */
 #include "app_timer.h"
+#include "app_timer_deadline.h"
+#include "app_timer_timestamp.h"
 #include "nrf_atfifo.h"
 #include "nrf_sortlist.h"
 #include "nrf_delay.h"
@@ -46,8 +48,32 @@
 #endif
 #if APP_TIMER_CONFIG_USE_SCHEDULER
 #include "app_scheduler.h"
+#if NRF_MODULE_ENABLED(APP_SCHED_PRIO)
+#include "app_sched_prio.h"
+#define TIMER_SCHED_EVENT_PUT(_p_data, _size, _handler)                 \
+    app_sched_prio_event_put((_p_data), (_size), (_handler),            \
+                             (app_sched_prio_level_t)APP_SCHED_PRIO_APP_TIMER_LEVEL)
+#else
+#define TIMER_SCHED_EVENT_PUT(_p_data, _size, _handler) app_sched_event_put((_p_data), (_size), (_handler))
 #endif
+#endif
+#if APP_TIMER_CONFIG_COALESCE
+#include "app_timer_coalesce.h"
+#endif
+#if APP_TIMER_CONFIG_HIRES
+#include "app_timer_hires.h"
+#include "nrfx_timer.h"
+#endif
+#if APP_TIMER_CONFIG_STATS
+#include "app_timer_stats.h"
+#endif
+#if APP_TIMER_CONFIG_PHASE_LOCK
+#include "app_timer_phase.h"
+#endif
+#include "nrf_profiler.h"
+#include "nrf_trace.h"
 #include <stddef.h>
+#include <string.h>
 #define NRF_LOG_MODULE_NAME APP_TIMER_LOG_NAME
 #if APP_TIMER_CONFIG_LOG_ENABLED
 #define NRF_LOG_LEVEL       APP_TIMER_CONFIG_LOG_LEVEL
@@ -60,6 +86,27 @@
 NRF_LOG_MODULE_REGISTER();
 
 #include "drv_rtc.h"
+#include "nrf_ramfunc.h"
+
+#if APP_TIMER_CONFIG_RAMFUNC_ENABLED
+#define APP_TIMER_RAMFUNC NRF_RAMFUNC
+#else
+#define APP_TIMER_RAMFUNC
+#endif
+
+#include "app_util_basepri.h"
+
+#ifndef APP_TIMER_CONFIG_BASEPRI_CEILING
+#define APP_TIMER_CONFIG_BASEPRI_CEILING 0
+#endif
+APP_UTIL_BASEPRI_CEILING_CHECK(APP_TIMER_CONFIG_BASEPRI_CEILING);
+STATIC_ASSERT((APP_TIMER_CONFIG_BASEPRI_CEILING == 0) ||
+              (APP_TIMER_CONFIG_BASEPRI_CEILING <= APP_TIMER_CONFIG_IRQ_PRIORITY));
+
+#define TIMER_REGION_ENTER() APP_UTIL_BASEPRI_REGION_ENTER(APP_TIMER_CONFIG_BASEPRI_CEILING)
+#define TIMER_REGION_EXIT()  APP_UTIL_BASEPRI_REGION_EXIT(APP_TIMER_CONFIG_BASEPRI_CEILING)
+
+NRF_PROFILER_PROBE_DEF(app_timer_rtc_irq);
 
 /**
  * Maximum possible relative value is limited by safe window to detect cases when requested
@@ -98,39 +145,159 @@ typedef struct
     app_timer_t *        p_timer; /**< Timer instance. */
 } timer_req_t;
 
-static app_timer_t * volatile mp_active_timer; /**< Timer currently handled by RTC driver. */
+STATIC_ASSERT((APP_TIMER_CONFIG_RTC_CHANNELS >= 1) && (APP_TIMER_CONFIG_RTC_CHANNELS <= 3));
+
+/* RTC compare channels used for active timers. Channel 1 is used for the timestamp update. */
+static uint8_t const m_active_cc[] = {0, 2, 3};
+
+static app_timer_t * volatile m_active_timers[APP_TIMER_CONFIG_RTC_CHANNELS]; /**< Timers currently handled by RTC driver, one per compare channel. */
 static bool                   m_global_active; /**< Flag used to globally disable all timers. */
-static uint64_t m_base_counter;
-static uint64_t m_stamp64;
+static uint64_t volatile m_stamp64[2]; /**< Timestamp references, the one in use is selected by @ref m_stamp_seq. */
+static uint32_t volatile m_stamp_seq;  /**< Incremented every time a new reference is published. */
 
 /* Request FIFO instance. */
 NRF_ATFIFO_DEF(m_req_fifo, timer_req_t, APP_TIMER_CONFIG_OP_QUEUE_SIZE);
 
+#if APP_TIMER_CONFIG_STATS
+/**
+ * @brief Statistics slot.
+ */
+typedef struct
+{
+    app_timer_t const * p_timer; /**< Timer instance, NULL if slot is free. */
+    app_timer_stats_t   stats;   /**< Timer statistics. */
+} timer_stats_slot_t;
+
+static timer_stats_slot_t m_timer_stats[APP_TIMER_CONFIG_STATS_TIMERS];
+static uint32_t           m_timer_stats_gen; /**< Incremented on reset, statistics pointers taken before are stale. */
+#endif
+
+#if APP_TIMER_CONFIG_BATCH_DISPATCH
+/**
+ * @brief Expired timer waiting in the batch.
+ */
+typedef struct
+{
+    app_timer_event_t   event;   /**< Timeout handler and its context. */
+#if APP_TIMER_CONFIG_STATS
+    app_timer_stats_t * p_stats; /**< Statistics of the timer, NULL if not recorded. */
+    uint32_t            stats_gen; /**< Value of m_timer_stats_gen when p_stats was taken. */
+#endif
+} timer_expired_t;
+
+/* Expired timers waiting for their handlers to be called. */
+NRF_ATFIFO_DEF(m_expired_fifo, timer_expired_t, APP_TIMER_CONFIG_BATCH_SIZE);
+#if APP_TIMER_CONFIG_USE_SCHEDULER
+static volatile bool     m_batch_scheduled; /**< Scheduler event draining the batch is pending. */
+static volatile uint32_t m_batch_gen;       /**< Incremented when the batch overflows, older scheduler events no longer drain it. */
+#endif
+#endif
+
+#if APP_TIMER_CONFIG_QUEUE_HEAP
+/**
+ * @brief Binary min-heap entry.
+ *
+ * End value is copied on insertion because it may be changed by a higher priority context
+ * while the timer is queued. Heap order must not depend on it until the pending requests
+ * are processed.
+ */
+typedef struct
+{
+    uint64_t      end_val; /**< Timer end value when it was queued. */
+    uint32_t      seq;     /**< Insertion number, keeps timers with equal end value in FIFO order. */
+    app_timer_t * p_timer; /**< Timer instance. */
+} timer_heap_entry_t;
+
+static timer_heap_entry_t m_timer_heap[APP_TIMER_CONFIG_HEAP_SIZE]; /**< Heap used for storing queued timers. */
+static uint32_t           m_timer_heap_count;                       /**< Number of queued timers. */
+static uint32_t           m_timer_heap_seq;                         /**< Next insertion number. */
+static uint32_t           m_timer_heap_pending;                     /**< Start requests holding a heap entry, not processed yet. */
+#else
 /* Sortlist instance. */
 static bool compare_func(nrf_sortlist_item_t * p_item0, nrf_sortlist_item_t *p_item1);
 NRF_SORTLIST_DEF(m_app_timer_sortlist, compare_func); /**< Sortlist used for storing queued timers. */
+#endif
+
+#if APP_TIMER_CONFIG_COALESCE
+/**
+ * @brief Slack of a timer started with @ref app_timer_start_lazy.
+ */
+typedef struct
+{
+    app_timer_t * p_timer; /**< Timer instance, NULL if slot is free. */
+    uint32_t      slack;   /**< Number of ticks the timer may expire before its end value. */
+} timer_slack_t;
+
+static timer_slack_t m_timer_slack[APP_TIMER_CONFIG_COALESCE_TIMERS]; /**< Timers running with slack. */
+#endif
+
+#if APP_TIMER_CONFIG_PHASE_LOCK
+/**
+ * @brief Grid of a timer started with @ref app_timer_start_phase_locked or
+ *        @ref app_timer_start_aligned.
+ */
+typedef struct
+{
+    app_timer_t * p_timer; /**< Timer instance, NULL if slot is free. */
+    uint64_t      grid;    /**< Grid point of the last scheduled expiry, or the new anchor after realignment. */
+    uint32_t      offset;  /**< Offset of the grid from the anchor. */
+} timer_phase_t;
+
+static timer_phase_t m_timer_phase[APP_TIMER_CONFIG_PHASE_LOCK_TIMERS]; /**< Phase-locked timers. */
+#endif
+
+#if APP_TIMER_CONFIG_HIRES
+/* Last compare channel is used for capturing the counter, others are assigned to timers. */
+#define HIRES_CAPTURE_CHANNEL (NRF_TIMER_CC_CHANNEL_COUNT(APP_TIMER_CONFIG_HIRES_TIMER_INSTANCE) - 1)
+#define HIRES_TIMERS_MAX      HIRES_CAPTURE_CHANNEL
+
+static nrfx_timer_t const m_hires_inst = NRFX_TIMER_INSTANCE(APP_TIMER_CONFIG_HIRES_TIMER_INSTANCE);
+static app_timer_t *      m_hires_timers[HIRES_TIMERS_MAX]; /**< Timers assigned to compare channels. */
+static uint32_t           m_hires_active;                   /**< Mask of channels with running timer. */
+#endif
 
 /**
  * @brief Return current 64 bit timestamp
+ *
+ * The counter is less than one period after the reference, which is published twice per period,
+ * so the ticks elapsed since the reference are the counter difference modulo the period. The
+ * reference is read again if a new one was published while it was being read.
  */
-static uint64_t get_now(void)
+APP_TIMER_RAMFUNC static uint64_t get_now(void)
 {
-    uint64_t now = m_base_counter + drv_rtc_counter_get(&m_rtc_inst);
+    uint32_t seq;
+    uint64_t stamp;
+    uint32_t counter;
 
-    /* it is possible that base was not updated and overflow occured, in that case 'now' will be
-     * 24bit value behind. Additional timestamp updated on every 24 bit period is used to detect
-     * that case. Apart from that 'now' should never be behind previously read timestamp.
-     */
-    if (now < m_stamp64) {
-        now += (DRV_RTC_MAX_CNT + 1);
-    }
+    do
+    {
+        seq     = m_stamp_seq;
+        stamp   = m_stamp64[seq & 1];
+        counter = drv_rtc_counter_get(&m_rtc_inst);
+    } while (seq != m_stamp_seq);
+
+    return stamp + ((counter - (uint32_t)stamp) & DRV_RTC_MAX_CNT);
+}
+
+/**
+ * @brief Publish the current timestamp as the new reference.
+ *
+ * Only called from the RTC interrupt. The reference not in use is written, then selected.
+ */
+APP_TIMER_RAMFUNC static void stamp_publish(void)
+{
+    uint64_t now = get_now();
+    uint32_t seq = m_stamp_seq + 1;
 
-    return now;
+    m_stamp64[seq & 1] = now;
+    m_stamp_seq        = seq;
 }
+
+#if !APP_TIMER_CONFIG_QUEUE_HEAP
 /**
  * @brief Function used for comparing items in sorted list.
  */
-static inline bool compare_func(nrf_sortlist_item_t * p_item0, nrf_sortlist_item_t *p_item1)
+APP_TIMER_RAMFUNC static inline bool compare_func(nrf_sortlist_item_t * p_item0, nrf_sortlist_item_t *p_item1)
 {
     app_timer_t * p0 = CONTAINER_OF(p_item0, app_timer_t, list_item);
     app_timer_t * p1 = CONTAINER_OF(p_item1, app_timer_t, list_item);
@@ -139,6 +306,396 @@ static inline bool compare_func(nrf_sortlist_item_t * p_item0, nrf_sortlist_item
     uint64_t p1_end = p1->end_val;
     return (p0_end <= p1_end) ? true : false;
 }
+#endif
+
+#if APP_TIMER_CONFIG_QUEUE_HEAP
+/*
+ * Position of the timer in the heap (index + 1, 0 when not queued) is kept in the sortlist
+ * item which is not used by this backend.
+ */
+APP_TIMER_RAMFUNC static inline uint32_t heap_pos_get(app_timer_t const * p_timer)
+{
+    return (uint32_t)(uintptr_t)p_timer->list_item.p_next;
+}
+
+APP_TIMER_RAMFUNC static inline void heap_pos_set(app_timer_t * p_timer, uint32_t pos)
+{
+    p_timer->list_item.p_next = (nrf_sortlist_item_t *)(uintptr_t)pos;
+}
+
+/**
+ * @brief Function used for comparing heap entries. Order is the same as in the sorted list:
+ *        by end value and then by insertion.
+ */
+APP_TIMER_RAMFUNC static inline bool heap_entry_before(timer_heap_entry_t const * p_entry0,
+                                                       timer_heap_entry_t const * p_entry1)
+{
+    if (p_entry0->end_val != p_entry1->end_val)
+    {
+        return (p_entry0->end_val < p_entry1->end_val);
+    }
+    return ((int32_t)(p_entry0->seq - p_entry1->seq) < 0);
+}
+
+APP_TIMER_RAMFUNC static inline void heap_entry_place(timer_heap_entry_t const * p_entry, uint32_t idx)
+{
+    m_timer_heap[idx] = *p_entry;
+    heap_pos_set(p_entry->p_timer, idx + 1);
+}
+
+APP_TIMER_RAMFUNC static void heap_sift_up(uint32_t idx)
+{
+    timer_heap_entry_t entry = m_timer_heap[idx];
+
+    while (idx > 0)
+    {
+        uint32_t parent = (idx - 1) / 2;
+        if (!heap_entry_before(&entry, &m_timer_heap[parent]))
+        {
+            break;
+        }
+        heap_entry_place(&m_timer_heap[parent], idx);
+        idx = parent;
+    }
+    heap_entry_place(&entry, idx);
+}
+
+APP_TIMER_RAMFUNC static void heap_sift_down(uint32_t idx)
+{
+    timer_heap_entry_t entry = m_timer_heap[idx];
+
+    while (true)
+    {
+        uint32_t child = 2 * idx + 1;
+        if (child >= m_timer_heap_count)
+        {
+            break;
+        }
+        if (((child + 1) < m_timer_heap_count) &&
+            heap_entry_before(&m_timer_heap[child + 1], &m_timer_heap[child]))
+        {
+            child++;
+        }
+        if (!heap_entry_before(&m_timer_heap[child], &entry))
+        {
+            break;
+        }
+        heap_entry_place(&m_timer_heap[child], idx);
+        idx = child;
+    }
+    heap_entry_place(&entry, idx);
+}
+
+APP_TIMER_RAMFUNC static void heap_remove_at(uint32_t idx)
+{
+    heap_pos_set(m_timer_heap[idx].p_timer, 0);
+    m_timer_heap_count--;
+    if (idx != m_timer_heap_count)
+    {
+        m_timer_heap[idx] = m_timer_heap[m_timer_heap_count];
+        heap_sift_down(idx);
+        heap_sift_up(idx);
+    }
+}
+
+APP_TIMER_RAMFUNC static inline bool heap_contains(app_timer_t const * p_timer)
+{
+    uint32_t pos = heap_pos_get(p_timer);
+    return (pos != 0) && (pos <= m_timer_heap_count) && (m_timer_heap[pos - 1].p_timer == p_timer);
+}
+#endif
+
+/**
+ * @brief Function for adding timer to the queue of active timers.
+ */
+APP_TIMER_RAMFUNC static void timer_queue_add(app_timer_t * p_timer)
+{
+#if APP_TIMER_CONFIG_QUEUE_HEAP
+    if (heap_contains(p_timer))
+    {
+        heap_remove_at(heap_pos_get(p_timer) - 1);
+    }
+    if (m_timer_heap_count >= APP_TIMER_CONFIG_HEAP_SIZE)
+    {
+        NRF_LOG_ERROR("Timer heap full.");
+        ASSERT(0);
+        return;
+    }
+
+    m_timer_heap[m_timer_heap_count].end_val = p_timer->end_val;
+    m_timer_heap[m_timer_heap_count].seq     = m_timer_heap_seq++;
+    m_timer_heap[m_timer_heap_count].p_timer = p_timer;
+    heap_sift_up(m_timer_heap_count++);
+#else
+    nrf_sortlist_add(&m_app_timer_sortlist, &p_timer->list_item);
+#endif
+}
+
+/**
+ * @brief Function for removing timer from the queue of active timers.
+ *
+ * @return True if timer was found in the queue.
+ */
+APP_TIMER_RAMFUNC static bool timer_queue_remove(app_timer_t * p_timer)
+{
+#if APP_TIMER_CONFIG_QUEUE_HEAP
+    if (!heap_contains(p_timer))
+    {
+        return false;
+    }
+    heap_remove_at(heap_pos_get(p_timer) - 1);
+    return true;
+#else
+    return nrf_sortlist_remove(&m_app_timer_sortlist, &p_timer->list_item);
+#endif
+}
+
+/**
+ * @brief Function for reserving room in the queue for a timer being started.
+ *
+ * Queued timers, timers held by RTC compare channels and unprocessed start requests are counted,
+ * so a start request accepted here always finds room when it is processed. Must be called from
+ * the timer region.
+ *
+ * @return True if there is room, false if the heap is full.
+ */
+static bool timer_queue_reserve(void)
+{
+#if APP_TIMER_CONFIG_QUEUE_HEAP
+    uint32_t used = m_timer_heap_count + m_timer_heap_pending;
+
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_RTC_CHANNELS; i++)
+    {
+        if (m_active_timers[i] != NULL)
+        {
+            used++;
+        }
+    }
+    if (used >= APP_TIMER_CONFIG_HEAP_SIZE)
+    {
+        return false;
+    }
+    m_timer_heap_pending++;
+#endif
+    return true;
+}
+
+/**
+ * @brief Function for releasing the room reserved by @ref timer_queue_reserve, once the start
+ *        request is processed or could not be scheduled.
+ */
+APP_TIMER_RAMFUNC static void timer_queue_reserve_release(void)
+{
+#if APP_TIMER_CONFIG_QUEUE_HEAP
+    TIMER_REGION_ENTER();
+    m_timer_heap_pending--;
+    TIMER_REGION_EXIT();
+#endif
+}
+
+APP_TIMER_RAMFUNC static inline app_timer_t * timer_queue_pop(void)
+{
+#if APP_TIMER_CONFIG_QUEUE_HEAP
+    if (m_timer_heap_count == 0)
+    {
+        return NULL;
+    }
+    app_timer_t * p_timer = m_timer_heap[0].p_timer;
+    heap_remove_at(0);
+    return p_timer;
+#else
+    nrf_sortlist_item_t * p_next_item = nrf_sortlist_pop(&m_app_timer_sortlist);
+    return p_next_item ? CONTAINER_OF(p_next_item, app_timer_t, list_item) : NULL;
+#endif
+}
+
+APP_TIMER_RAMFUNC static inline app_timer_t * timer_queue_peek(void)
+{
+#if APP_TIMER_CONFIG_QUEUE_HEAP
+    return (m_timer_heap_count != 0) ? m_timer_heap[0].p_timer : NULL;
+#else
+    nrf_sortlist_item_t const * p_next_item = nrf_sortlist_peek(&m_app_timer_sortlist);
+    return p_next_item ? CONTAINER_OF(p_next_item, app_timer_t, list_item) : NULL;
+#endif
+}
+
+#if APP_TIMER_CONFIG_COALESCE
+APP_TIMER_RAMFUNC static timer_slack_t * timer_slack_find(app_timer_t const * p_timer)
+{
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_COALESCE_TIMERS; i++)
+    {
+        if (m_timer_slack[i].p_timer == p_timer)
+        {
+            return &m_timer_slack[i];
+        }
+    }
+    return NULL;
+}
+
+APP_TIMER_RAMFUNC static inline uint32_t timer_slack_get(app_timer_t const * p_timer)
+{
+    timer_slack_t const * p_slack = timer_slack_find(p_timer);
+    return p_slack ? p_slack->slack : 0;
+}
+
+/**
+ * @brief Function for getting a slack slot for the timer. Slot of an idle timer can be reused.
+ */
+static timer_slack_t * timer_slack_alloc(app_timer_t * p_timer)
+{
+    timer_slack_t * p_slack = timer_slack_find(p_timer);
+    if (p_slack)
+    {
+        return p_slack;
+    }
+
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_COALESCE_TIMERS; i++)
+    {
+        if ((m_timer_slack[i].p_timer == NULL) || APP_TIMER_IS_IDLE(m_timer_slack[i].p_timer))
+        {
+            m_timer_slack[i].p_timer = p_timer;
+            return &m_timer_slack[i];
+        }
+    }
+    return NULL;
+}
+#endif
+
+#if APP_TIMER_CONFIG_PHASE_LOCK
+APP_TIMER_RAMFUNC static timer_phase_t * timer_phase_find(app_timer_t const * p_timer)
+{
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_PHASE_LOCK_TIMERS; i++)
+    {
+        if (m_timer_phase[i].p_timer == p_timer)
+        {
+            return &m_timer_phase[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Function for getting a phase slot for the timer. Slot of an idle timer can be reused.
+ */
+static timer_phase_t * timer_phase_alloc(app_timer_t * p_timer)
+{
+    timer_phase_t * p_phase = timer_phase_find(p_timer);
+    if (p_phase)
+    {
+        return p_phase;
+    }
+
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_PHASE_LOCK_TIMERS; i++)
+    {
+        if ((m_timer_phase[i].p_timer == NULL) || APP_TIMER_IS_IDLE(m_timer_phase[i].p_timer))
+        {
+            m_timer_phase[i].p_timer = p_timer;
+            return &m_timer_phase[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Function for converting RTC counter value in the past to 64 bit timestamp.
+ */
+static inline uint64_t timer_anchor_get(uint32_t anchor_ticks, uint64_t now)
+{
+    return now - app_timer_cnt_diff_compute((uint32_t)now, anchor_ticks);
+}
+
+/**
+ * @brief Function for getting the first grid point after @p now. Must be called from critical region.
+ *
+ * In the common case the timer has just expired on the last grid point and the next one follows
+ * it. Division is needed only when expiries were missed.
+ */
+APP_TIMER_RAMFUNC static uint64_t timer_phase_next(timer_phase_t * p_phase,
+                                                                     uint32_t        period,
+                                                                     uint64_t        now)
+{
+    if (p_phase->grid <= now)
+    {
+        p_phase->grid += period;
+        if (p_phase->grid <= now)
+        {
+            p_phase->grid += ((now - p_phase->grid) / period + 1) * period;
+        }
+    }
+    return p_phase->grid;
+}
+#endif
+
+#if APP_TIMER_CONFIG_STATS
+/**
+ * @brief Function for getting statistics slot of the timer. Free slot is taken if timer has none.
+ */
+APP_TIMER_RAMFUNC static app_timer_stats_t * timer_stats_get(app_timer_t const * p_timer)
+{
+    timer_stats_slot_t * p_free = NULL;
+
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_STATS_TIMERS; i++)
+    {
+        if (m_timer_stats[i].p_timer == p_timer)
+        {
+            return &m_timer_stats[i].stats;
+        }
+        if ((p_free == NULL) && (m_timer_stats[i].p_timer == NULL))
+        {
+            p_free = &m_timer_stats[i];
+        }
+    }
+
+    if (p_free)
+    {
+        p_free->p_timer = p_timer;
+        return &p_free->stats;
+    }
+    return NULL;
+}
+
+APP_TIMER_RAMFUNC static void timer_stats_expiry_record(app_timer_stats_t * p_stats, uint64_t end_val)
+{
+    uint64_t now      = get_now();
+    uint32_t lateness = (now > end_val) ? (uint32_t)MIN(now - end_val, UINT32_MAX) : 0;
+
+    p_stats->fire_count++;
+    p_stats->lateness_last = lateness;
+    p_stats->lateness_max  = MAX(p_stats->lateness_max, lateness);
+    p_stats->lateness_sum += lateness;
+}
+
+/**
+ * @brief Function for calling timeout handler and recording its run time.
+ *
+ * The run time is dropped if the statistics were reset since @p p_stats was taken, as its slot
+ * may belong to another timer by now.
+ */
+APP_TIMER_RAMFUNC static void timeout_handler_call(app_timer_timeout_handler_t handler,
+                                                   void *                      p_context,
+                                                   app_timer_stats_t *         p_stats,
+                                                   uint32_t                    stats_gen)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    handler(p_context);
+
+    if (p_stats)
+    {
+        uint32_t cycles = DWT->CYCCNT - start;
+
+        TIMER_REGION_ENTER();
+        if (stats_gen == m_timer_stats_gen)
+        {
+            p_stats->handler_count++;
+            p_stats->handler_cycles_last = cycles;
+            p_stats->handler_cycles_max  = MAX(p_stats->handler_cycles_max, cycles);
+            p_stats->handler_cycles_sum += cycles;
+        }
+        TIMER_REGION_EXIT();
+    }
+}
+#endif
 
 #if APP_TIMER_CONFIG_USE_SCHEDULER
 static void scheduled_timeout_handler(void * p_event_data, uint16_t event_size)
@@ -146,7 +703,136 @@ static void scheduled_timeout_handler(void * p_event_data, uint16_t event_size)
     ASSERT(event_size == sizeof(app_timer_event_t));
     app_timer_event_t const * p_timer_event = (app_timer_event_t *)p_event_data;
 
+    NRF_TRACE_SCHED_START(scheduled_timeout_handler);
     p_timer_event->timeout_handler(p_timer_event->p_context);
+    NRF_TRACE_SCHED_STOP(scheduled_timeout_handler);
+}
+#endif
+
+#if APP_TIMER_CONFIG_BATCH_DISPATCH
+#if !APP_TIMER_CONFIG_USE_SCHEDULER
+/**
+ * @brief Function for calling handlers of all expired timers, in order of expiration.
+ */
+APP_TIMER_RAMFUNC static void expired_batch_dispatch(void)
+{
+    timer_expired_t expired;
+
+    while (nrf_atfifo_get_free(m_expired_fifo, &expired, sizeof(expired), NULL) == NRF_SUCCESS)
+    {
+#if APP_TIMER_CONFIG_STATS
+        timeout_handler_call(expired.event.timeout_handler, expired.event.p_context,
+                             expired.p_stats, expired.stats_gen);
+#else
+        expired.event.timeout_handler(expired.event.p_context);
+#endif
+    }
+}
+#else
+static void scheduled_batch_handler(void * p_event_data, uint16_t event_size)
+{
+    ASSERT(event_size == sizeof(uint32_t));
+    uint32_t        gen = *(uint32_t const *)p_event_data;
+    timer_expired_t expired;
+    bool            got;
+
+    if (gen != m_batch_gen)
+    {
+        /* Batch overflowed after this event was put. Its handlers were scheduled on their own. */
+        return;
+    }
+
+    /* Cleared before draining. Timer expiring meanwhile schedules another event at worst. */
+    m_batch_scheduled = false;
+    NRF_TRACE_SCHED_START(scheduled_batch_handler);
+    do
+    {
+        /* Stop as soon as an overflow has moved the rest of the batch to its own events. */
+        TIMER_REGION_ENTER();
+        got = (gen == m_batch_gen) &&
+              (nrf_atfifo_get_free(m_expired_fifo, &expired, sizeof(expired), NULL) == NRF_SUCCESS);
+        TIMER_REGION_EXIT();
+        if (got)
+        {
+#if APP_TIMER_CONFIG_STATS
+            timeout_handler_call(expired.event.timeout_handler, expired.event.p_context,
+                                 expired.p_stats, expired.stats_gen);
+#else
+            expired.event.timeout_handler(expired.event.p_context);
+#endif
+        }
+    } while (got);
+    NRF_TRACE_SCHED_STOP(scheduled_batch_handler);
+}
+
+/**
+ * @brief Function for moving the batch to scheduler events of its own, one per expired timer.
+ *
+ * Called when the batch is full, before the timer that did not fit is scheduled, so handlers are
+ * still called in order of expiration. Scheduler events put for the batch before are invalidated,
+ * as they would run ahead of the moved handlers.
+ */
+APP_TIMER_RAMFUNC static void expired_batch_flush(void)
+{
+    timer_expired_t expired;
+
+    TIMER_REGION_ENTER();
+    m_batch_gen++;
+    m_batch_scheduled = false;
+    while (nrf_atfifo_get_free(m_expired_fifo, &expired, sizeof(expired), NULL) == NRF_SUCCESS)
+    {
+        APP_ERROR_CHECK(TIMER_SCHED_EVENT_PUT(&expired.event, sizeof(expired.event),
+                                              scheduled_timeout_handler));
+    }
+    TIMER_REGION_EXIT();
+}
+#endif
+
+/**
+ * @brief Function for adding expired timer to the batch of handlers to be called.
+ *
+ * In scheduler mode, single scheduler event is put for the whole batch. Otherwise the batch is
+ * dispatched at the end of RTC interrupt.
+ */
+APP_TIMER_RAMFUNC static void expired_batch_add(app_timer_t const * p_timer, void * p_stats)
+{
+    timer_expired_t expired;
+
+    expired.event.timeout_handler = p_timer->handler;
+    expired.event.p_context       = p_timer->p_context;
+#if APP_TIMER_CONFIG_STATS
+    expired.p_stats               = p_stats;
+    expired.stats_gen             = m_timer_stats_gen;
+#else
+    UNUSED_PARAMETER(p_stats);
+#endif
+
+    NRF_LOG_DEBUG("Timer expired (context: %d)", (uint32_t)p_timer->p_context);
+#if APP_TIMER_CONFIG_USE_SCHEDULER
+    uint32_t err_code;
+    if (nrf_atfifo_alloc_put(m_expired_fifo, &expired, sizeof(expired), NULL) != NRF_SUCCESS)
+    {
+        /* Batch is full, it is scheduled handler by handler and this timeout after it. */
+        expired_batch_flush();
+        err_code = TIMER_SCHED_EVENT_PUT(&expired.event, sizeof(expired.event), scheduled_timeout_handler);
+        APP_ERROR_CHECK(err_code);
+    }
+    else if (!m_batch_scheduled)
+    {
+        uint32_t gen = m_batch_gen;
+
+        m_batch_scheduled = true;
+        err_code = TIMER_SCHED_EVENT_PUT(&gen, sizeof(gen), scheduled_batch_handler);
+        APP_ERROR_CHECK(err_code);
+    }
+#else
+    if (nrf_atfifo_alloc_put(m_expired_fifo, &expired, sizeof(expired), NULL) != NRF_SUCCESS)
+    {
+        /* Batch is full, handlers collected so far are called now. */
+        expired_batch_dispatch();
+        UNUSED_RETURN_VALUE(nrf_atfifo_alloc_put(m_expired_fifo, &expired, sizeof(expired), NULL));
+    }
+#endif
 }
 #endif
 
@@ -160,59 +846,93 @@ static void scheduled_timeout_handler(void * p_event_data, uint16_t event_size)
  *
  * @return True if reevaluation of sortlist needed (becasue it was updated).
  */
-static bool timer_expire(app_timer_t * p_timer)
+APP_TIMER_RAMFUNC static bool timer_expire(app_timer_t * p_timer)
 {
     ASSERT(p_timer->handler);
     bool ret = false;
 
     if ((m_global_active == true) && (p_timer != NULL))
     {
-        if (get_now() >= p_timer->end_val) {
+#if APP_TIMER_CONFIG_COALESCE
+        /* Timer started with slack expires as soon as its window is open. */
+        uint64_t now = get_now() + timer_slack_get(p_timer);
+#else
+        uint64_t now = get_now();
+#endif
+        if (now >= p_timer->end_val) {
             bool cont;
+    #if APP_TIMER_CONFIG_STATS
+            app_timer_stats_t * p_stats = timer_stats_get(p_timer);
+            if (p_stats)
+            {
+                timer_stats_expiry_record(p_stats, p_timer->end_val);
+            }
+    #elif APP_TIMER_CONFIG_BATCH_DISPATCH
+            void * p_stats = NULL;
+    #endif
 
             /* timer expired */
-            CRITICAL_REGION_ENTER();
+            NRF_TRACE_TIMER_ENTER(p_timer);
+            TIMER_REGION_ENTER();
             /* In case of single shot, set timer to idle. */
             if (p_timer->repeat_period == 0)
             {
                 p_timer->end_val = APP_TIMER_IDLE_VAL;
             }
-            CRITICAL_REGION_EXIT();
-    #if APP_TIMER_CONFIG_USE_SCHEDULER
+            TIMER_REGION_EXIT();
+    #if APP_TIMER_CONFIG_BATCH_DISPATCH
+            expired_batch_add(p_timer, p_stats);
+    #elif APP_TIMER_CONFIG_USE_SCHEDULER
             app_timer_event_t timer_event;
 
             timer_event.timeout_handler = p_timer->handler;
             timer_event.p_context       = p_timer->p_context;
-            uint32_t err_code = app_sched_event_put(&timer_event,
+            uint32_t err_code = TIMER_SCHED_EVENT_PUT(&timer_event,
                                                     sizeof(timer_event),
                                                     scheduled_timeout_handler);
             APP_ERROR_CHECK(err_code);
     #else
             NRF_LOG_DEBUG("Timer expired (context: %d)", (uint32_t)p_timer->p_context)
+        #if APP_TIMER_CONFIG_STATS
+            timeout_handler_call(p_timer->handler, p_timer->p_context, p_stats, m_timer_stats_gen);
+        #else
             p_timer->handler(p_timer->p_context);
+        #endif
     #endif
-            CRITICAL_REGION_ENTER();
+            NRF_TRACE_TIMER_EXIT();
+            TIMER_REGION_ENTER();
             /* check active flag as it may have been stopped in the user handler */
             if (p_timer->repeat_period && !APP_TIMER_IS_IDLE(p_timer))
             {
-                p_timer->end_val += p_timer->repeat_period;
+    #if APP_TIMER_CONFIG_PHASE_LOCK
+                /* Phase-locked timer continues on its grid, missed expiries are skipped. */
+                timer_phase_t * p_phase = timer_phase_find(p_timer);
+                if (p_phase)
+                {
+                    p_timer->end_val = timer_phase_next(p_phase, p_timer->repeat_period, get_now());
+                }
+                else
+    #endif
+                {
+                    p_timer->end_val += p_timer->repeat_period;
+                }
                 cont = true;
             }
             else
             {
                 cont = false;
             }
-            CRITICAL_REGION_EXIT();
+            TIMER_REGION_EXIT();
 
             if (cont)
             {
-                nrf_sortlist_add(&m_app_timer_sortlist, &p_timer->list_item);
+                timer_queue_add(p_timer);
                 ret = true;
             }
         }
         else if (!APP_TIMER_IS_IDLE(p_timer))
         {
-            nrf_sortlist_add(&m_app_timer_sortlist, &p_timer->list_item);
+            timer_queue_add(p_timer);
             ret = true;
         }
     }
@@ -226,13 +946,14 @@ static bool timer_expire(app_timer_t * p_timer)
  * expires and function indicates that RTC was not configured.
  *
  * @param          p_timer Timer instance.
+ * @param          cc      RTC compare channel.
  * @param [in,out] p_rerun Flag indicating that sortlist reevaluation is required.
  *
  * @return True if RTC was successfully configured, false if timer already expired and RTC was not
  *         configured.
  *
  */
-static bool rtc_schedule(app_timer_t * p_timer, bool * p_rerun)
+APP_TIMER_RAMFUNC static bool rtc_schedule(app_timer_t * p_timer, uint32_t cc, bool * p_rerun)
 {
     ret_code_t ret = NRF_ERROR_TIMEOUT;
     *p_rerun = false;
@@ -246,7 +967,7 @@ static bool rtc_schedule(app_timer_t * p_timer, bool * p_rerun)
         uint32_t cc_val = ((uint32_t)remaining > APP_TIMER_RTC_MAX_VALUE) ?
                 (app_timer_cnt_get() + APP_TIMER_RTC_MAX_VALUE) : end_val;
 
-        ret = drv_rtc_windowed_compare_set(&m_rtc_inst, 0, cc_val, APP_TIMER_SAFE_WINDOW);
+        ret = drv_rtc_windowed_compare_set(&m_rtc_inst, cc, cc_val, APP_TIMER_SAFE_WINDOW);
         NRF_LOG_DEBUG("Setting CC to 0x%08x (err: %d)", cc_val & DRV_RTC_MAX_CNT, ret);
         if (ret == NRF_SUCCESS)
         {
@@ -255,7 +976,7 @@ static bool rtc_schedule(app_timer_t * p_timer, bool * p_rerun)
     }
     else
     {
-        drv_rtc_compare_disable(&m_rtc_inst, 0);
+        drv_rtc_compare_disable(&m_rtc_inst, cc);
     }
 
     if (ret == NRF_ERROR_TIMEOUT)
@@ -271,27 +992,15 @@ static bool rtc_schedule(app_timer_t * p_timer, bool * p_rerun)
     return false;
 }
 
-static inline app_timer_t * sortlist_pop(void)
-{
-    nrf_sortlist_item_t * p_next_item = nrf_sortlist_pop(&m_app_timer_sortlist);
-    return p_next_item ? CONTAINER_OF(p_next_item, app_timer_t, list_item) : NULL;
-}
-
-static inline app_timer_t * sortlist_peek(void)
-{
-    nrf_sortlist_item_t const * p_next_item = nrf_sortlist_peek(&m_app_timer_sortlist);
-    return p_next_item ? CONTAINER_OF(p_next_item, app_timer_t, list_item) : NULL;
-}
-
 /**
  * @brief Function for deactivating all timers which are in the sorted list (active timers).
  */
-static void sorted_list_stop_all(void)
+APP_TIMER_RAMFUNC static void sorted_list_stop_all(void)
 {
     app_timer_t * p_next;
     do
     {
-        p_next = sortlist_pop();
+        p_next = timer_queue_pop();
         if (p_next)
         {
             p_next->end_val = APP_TIMER_IDLE_VAL;
@@ -302,28 +1011,116 @@ static void sorted_list_stop_all(void)
 /**
  * @brief Function for handling RTC counter overflow.
  *
- * Increment base counter used to calculate 64 bit timestamp.
+ * Publish the reference used to calculate 64 bit timestamp.
  */
-static void on_overflow_evt(void)
+APP_TIMER_RAMFUNC static void on_overflow_evt(void)
 {
     NRF_LOG_DEBUG("Overflow EVT");
-    m_base_counter += (DRV_RTC_MAX_CNT + 1);
+    stamp_publish();
+}
+
+/**
+ * @brief Function for getting index of the active timer slot used by the timer.
+ *
+ * @param p_timer Timer instance, NULL to find a free slot.
+ *
+ * @return Slot index or -1 if not found.
+ */
+APP_TIMER_RAMFUNC static int32_t active_slot_find(app_timer_t const * p_timer)
+{
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_RTC_CHANNELS; i++)
+    {
+        if (m_active_timers[i] == p_timer)
+        {
+            return (int32_t)i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Function for getting index of the active timer which expires last. All slots must be used.
+ */
+APP_TIMER_RAMFUNC static uint32_t active_slot_last(void)
+{
+    uint32_t last = 0;
+
+    for (uint32_t i = 1; i < APP_TIMER_CONFIG_RTC_CHANNELS; i++)
+    {
+        if (m_active_timers[i]->end_val > m_active_timers[last]->end_val)
+        {
+            last = i;
+        }
+    }
+    return last;
+}
+
+/**
+ * @brief Function for getting index of the slot, among the given ones, whose timer expires first.
+ *        Slots without a timer are taken first.
+ *
+ * @param mask Mask of slots, not empty.
+ */
+APP_TIMER_RAMFUNC static uint32_t active_slot_first(uint32_t mask)
+{
+    int32_t first = -1;
+
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_RTC_CHANNELS; i++)
+    {
+        if ((mask & (1UL << i)) == 0)
+        {
+            continue;
+        }
+        if (m_active_timers[i] == NULL)
+        {
+            return i;
+        }
+        if ((first < 0) || (m_active_timers[i]->end_val < m_active_timers[first]->end_val))
+        {
+            first = (int32_t)i;
+        }
+    }
+    return (uint32_t)first;
+}
+
+/**
+ * @brief Function for releasing an active timer slot. Its compare channel is disabled, so no
+ *        event comes for the timer once it left the slot.
+ */
+APP_TIMER_RAMFUNC static void active_slot_release(uint32_t slot)
+{
+    drv_rtc_compare_disable(&m_rtc_inst, m_active_cc[slot]);
+    m_active_timers[slot] = NULL;
+}
+
+APP_TIMER_RAMFUNC static inline bool active_none(void)
+{
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_RTC_CHANNELS; i++)
+    {
+        if (m_active_timers[i] != NULL)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 /**
  * #brief Function for handling RTC compare event - active timer expiration.
  */
-static void on_compare_evt(drv_rtc_t const * const  p_instance)
+APP_TIMER_RAMFUNC static void on_compare_evt(drv_rtc_t const * const  p_instance, uint32_t slot)
 {
-    if (mp_active_timer)
+    app_timer_t * p_timer = m_active_timers[slot];
+
+    if (p_timer)
     {
         /* If assert fails it suggests that safe window should be increased. */
         ASSERT(app_timer_cnt_diff_compute(drv_rtc_counter_get(p_instance),
-                                          drv_rtc_compare_get(p_instance, 0)) < APP_TIMER_SAFE_WINDOW);
+                                          drv_rtc_compare_get(p_instance, m_active_cc[slot])) < APP_TIMER_SAFE_WINDOW);
 
-        NRF_LOG_INST_DEBUG(mp_active_timer->p_log, "Compare EVT");
-        UNUSED_RETURN_VALUE(timer_expire(mp_active_timer));
-        mp_active_timer = NULL;
+        NRF_LOG_INST_DEBUG(p_timer->p_log, "Compare EVT");
+        UNUSED_RETURN_VALUE(timer_expire(p_timer));
+        active_slot_release(slot);
     }
     else
     {
@@ -331,13 +1128,40 @@ static void on_compare_evt(drv_rtc_t const * const  p_instance)
     }
 }
 
+#if APP_TIMER_CONFIG_COALESCE
 /**
- * @brief Channel 1 is triggered in the middle of 24 bit period to updated control timestamp in
- * place where there is no risk of overflow.
+ * @brief Function for expiring, on the current wakeup, all queued timers with an open slack window.
  */
-static void on_compare1_evt(drv_rtc_t const * const  p_instance)
+APP_TIMER_RAMFUNC static void coalesced_timers_expire(void)
 {
-    m_stamp64 = get_now();
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_COALESCE_TIMERS; i++)
+    {
+        app_timer_t * p_timer = m_timer_slack[i].p_timer;
+
+        if ((p_timer == NULL) || (active_slot_find(p_timer) >= 0) || APP_TIMER_IS_IDLE(p_timer))
+        {
+            continue;
+        }
+        if ((get_now() + m_timer_slack[i].slack) < p_timer->end_val)
+        {
+            continue;
+        }
+        if (timer_queue_remove(p_timer))
+        {
+            NRF_LOG_INST_DEBUG(p_timer->p_log, "Coalesced expiry.");
+            UNUSED_RETURN_VALUE(timer_expire(p_timer));
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Channel 1 is triggered in the middle of 24 bit period to publish the timestamp reference
+ * half way between overflows.
+ */
+APP_TIMER_RAMFUNC static void on_compare1_evt(drv_rtc_t const * const  p_instance)
+{
+    stamp_publish();
 }
 
 /**
@@ -346,13 +1170,17 @@ static void on_compare1_evt(drv_rtc_t const * const  p_instance)
  * Function is called at the end of RTC interrupt when all new user request and/or timer expiration
  * occured. It configures RTC if there is any pending timer, reconfigures if the are timers with
  * shorted timeout than active one or stops RTC if there is no active timers.
+ *
+ * Up to APP_TIMER_CONFIG_RTC_CHANNELS timers with the shortest timeouts are active at the same
+ * time, each one on its own compare channel, so timers expiring close to each other are not
+ * waiting for the RTC to be reconfigured.
  */
-static void rtc_update(drv_rtc_t const * const  p_instance)
+APP_TIMER_RAMFUNC static void rtc_update(drv_rtc_t const * const  p_instance)
 {
     while(1)
     {
-        app_timer_t * p_next = sortlist_peek();
-        bool rtc_reconf = false;
+        app_timer_t * p_next = timer_queue_peek();
+        int32_t slot = -1;
         if (p_next) //Candidate for active timer
         {
             /* If timer was stopped just remove it from the sortlist and continue.
@@ -364,40 +1192,41 @@ static void rtc_update(drv_rtc_t const * const  p_instance)
              * requests are handled.
              */
             if (APP_TIMER_IS_IDLE(p_next)) {
-                (void)sortlist_pop();
+                (void)timer_queue_pop();
                 continue;
             }
-            else if (mp_active_timer == NULL)
+            slot = active_slot_find(NULL);
+            if (slot < 0)
             {
-                //There is no active timer so candidate will become active timer.
-                rtc_reconf = true;
-            }
-            else if (p_next->end_val < mp_active_timer->end_val)
-            {
-                //Candidate has shorter timeout than current active timer. Candidate will replace active timer.
-                //Active timer is put back into sorted list.
-                rtc_reconf = true;
-                if (!APP_TIMER_IS_IDLE(mp_active_timer))
+                uint32_t last = active_slot_last();
+                if (p_next->end_val < m_active_timers[last]->end_val)
                 {
-                    NRF_LOG_INST_DEBUG(mp_active_timer->p_log, "Timer preempted.");
-                    nrf_sortlist_add(&m_app_timer_sortlist, &mp_active_timer->list_item);
+                    //Candidate has shorter timeout than active timer which expires last. Candidate will replace it.
+                    //Active timer is put back into sorted list.
+                    slot = (int32_t)last;
+                    if (!APP_TIMER_IS_IDLE(m_active_timers[last]))
+                    {
+                        NRF_LOG_INST_DEBUG(m_active_timers[last]->p_log, "Timer preempted.");
+                        timer_queue_add(m_active_timers[last]);
+                    }
                 }
             }
+            //Otherwise there is a free slot and candidate will become active timer.
 
-            if (rtc_reconf)
+            if (slot >= 0)
             {
                 bool rerun;
-                p_next = sortlist_pop();
+                p_next = timer_queue_pop();
                 NRF_LOG_INST_DEBUG(p_next->p_log, "Activating timer (CC:%d/%08x).", p_next->end_val, p_next->end_val);
-                if (rtc_schedule(p_next, &rerun))
+                if (rtc_schedule(p_next, m_active_cc[slot], &rerun))
                 {
-                    if (!APP_TIMER_KEEPS_RTC_ACTIVE && (mp_active_timer == NULL))
+                    if (!APP_TIMER_KEEPS_RTC_ACTIVE && active_none())
                     {
                         drv_rtc_start(p_instance);
                     }
-                    mp_active_timer = p_next;
+                    m_active_timers[slot] = p_next;
 
-                    if (rerun == false)
+                    if ((rerun == false) && (APP_TIMER_CONFIG_RTC_CHANNELS == 1))
                     {
                         //RTC was successfully updated and sortlist was not updated. Function can be terminated.
                         break;
@@ -407,7 +1236,7 @@ static void rtc_update(drv_rtc_t const * const  p_instance)
                 {
                     //If RTC driver indicated that timeout already occured a new candidate will be taken from sorted list.
                     NRF_LOG_INST_DEBUG(p_next->p_log,"Timer expired before scheduled to RTC.");
-                    mp_active_timer = NULL;
+                    active_slot_release((uint32_t)slot);
                 }
             }
             else
@@ -418,7 +1247,7 @@ static void rtc_update(drv_rtc_t const * const  p_instance)
         }
         else //No candidate for active timer.
         {
-            if (!APP_TIMER_KEEPS_RTC_ACTIVE && (mp_active_timer == NULL))
+            if (!APP_TIMER_KEEPS_RTC_ACTIVE && active_none())
             {
                 drv_rtc_stop(p_instance);
             }
@@ -432,7 +1261,7 @@ static void rtc_update(drv_rtc_t const * const  p_instance)
  *
  * Function is called only in the context of RTC interrupt.
  */
-static void timer_req_process(drv_rtc_t const * const  p_instance)
+APP_TIMER_RAMFUNC static void timer_req_process(drv_rtc_t const * const  p_instance)
 {
     nrf_atfifo_item_get_t fifo_ctx;
     timer_req_t *         p_req = nrf_atfifo_item_get(m_req_fifo, &fifo_ctx);
@@ -452,21 +1281,24 @@ static void timer_req_process(drv_rtc_t const * const  p_instance)
                  * - When start request is handled, timer is idle and should not be
                  *   added to the queue but just dropped.
                  */
+                timer_queue_reserve_release();
                 if (!APP_TIMER_IS_IDLE(p_req->p_timer))
                 {
-                    nrf_sortlist_add(&m_app_timer_sortlist, &(p_req->p_timer->list_item));
+                    timer_queue_add(p_req->p_timer);
                     NRF_LOG_INST_DEBUG(p_req->p_timer->p_log,"Start request (expiring at %d/0x%08x).",
                                                   p_req->p_timer->end_val, p_req->p_timer->end_val);
                 }
                 break;
             case TIMER_REQ_STOP:
-                if (p_req->p_timer == mp_active_timer)
+            {
+                int32_t slot = active_slot_find(p_req->p_timer);
+                if (slot >= 0)
                 {
-                    mp_active_timer = NULL;
+                    active_slot_release((uint32_t)slot);
                 }
                 else
                 {
-                    bool found = nrf_sortlist_remove(&m_app_timer_sortlist, &(p_req->p_timer->list_item));
+                    bool found = timer_queue_remove(p_req->p_timer);
                     if (!found)
                     {
                          NRF_LOG_INFO("Timer not found on sortlist (stopping expired timer).");
@@ -474,6 +1306,7 @@ static void timer_req_process(drv_rtc_t const * const  p_instance)
                 }
                 NRF_LOG_INST_DEBUG(p_req->p_timer->p_log,"Stop request.");
                 break;
+            }
             case TIMER_REQ_STOP_ALL:
                 sorted_list_stop_all();
                 m_global_active = true;
@@ -483,39 +1316,201 @@ static void timer_req_process(drv_rtc_t const * const  p_instance)
                 break;
         }
 #if APP_TIMER_WITH_PROFILER
-        CRITICAL_REGION_ENTER();
+        TIMER_REGION_ENTER();
 #endif
         UNUSED_RETURN_VALUE(nrf_atfifo_item_free(m_req_fifo, &fifo_ctx));
 #if APP_TIMER_WITH_PROFILER
         if (m_max_user_op_queue_utilization < m_current_user_op_queue_utilization)
         {
-            m_max_user_op_queue_utilization = m_current_user_op_queue_utilization;
+            m_max_user_op_queue_utilization = m_current_user_op_queue_utilization;
+        }
+        --m_current_user_op_queue_utilization;
+        TIMER_REGION_EXIT();
+#endif /* APP_TIMER_WITH_PROFILER */
+        p_req = nrf_atfifo_item_get(m_req_fifo, &fifo_ctx);
+    }
+}
+
+APP_TIMER_RAMFUNC static void rtc_irq(drv_rtc_t const * const  p_instance)
+{
+    NRF_TRACE_ISR_ENTER();
+    NRF_PROFILER_BEGIN(app_timer_rtc_irq);
+    bool compare_evt = false;
+    uint32_t pending = 0;
+
+    if (drv_rtc_overflow_pending(p_instance))
+    {
+        on_overflow_evt();
+    }
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_RTC_CHANNELS; i++)
+    {
+        if (drv_rtc_compare_pending(p_instance, m_active_cc[i]))
+        {
+            pending |= (1UL << i);
+        }
+    }
+    /* Timers which came due together expire in order of their end values, not of their slots. */
+    while (pending)
+    {
+        uint32_t slot = active_slot_first(pending);
+
+        pending &= ~(1UL << slot);
+        on_compare_evt(p_instance, slot);
+        compare_evt = true;
+    }
+    if (drv_rtc_compare_pending(p_instance, 1))
+    {
+        on_compare1_evt(p_instance);
+    }
+
+    timer_req_process(p_instance);
+#if APP_TIMER_CONFIG_COALESCE
+    /* Requests are processed first so that queue is consistent with timers end values. */
+    if (compare_evt)
+    {
+        coalesced_timers_expire();
+    }
+#else
+    UNUSED_VARIABLE(compare_evt);
+#endif
+    rtc_update(p_instance);
+#if APP_TIMER_CONFIG_BATCH_DISPATCH && !APP_TIMER_CONFIG_USE_SCHEDULER
+    expired_batch_dispatch();
+#endif
+    NRF_PROFILER_END(app_timer_rtc_irq);
+    NRF_TRACE_ISR_EXIT();
+}
+
+#if APP_TIMER_CONFIG_HIRES
+/**
+ * @brief Function for getting compare channel of a high resolution timer.
+ *
+ * @return Channel index or -1 if timer is not a high resolution timer.
+ */
+static int32_t hires_channel_find(app_timer_t const * p_timer)
+{
+    for (uint32_t i = 0; i < HIRES_TIMERS_MAX; i++)
+    {
+        if (m_hires_timers[i] == p_timer)
+        {
+            return (int32_t)i;
         }
-        --m_current_user_op_queue_utilization;
-        CRITICAL_REGION_EXIT();
-#endif /* APP_TIMER_WITH_PROFILER */
-        p_req = nrf_atfifo_item_get(m_req_fifo, &fifo_ctx);
     }
+    return -1;
 }
 
-static void rtc_irq(drv_rtc_t const * const  p_instance)
+/**
+ * @brief Function for releasing channel of a timer which stopped. TIMER is stopped when last
+ *        timer stops. Must be called from critical region.
+ */
+static void hires_channel_release(uint32_t channel)
 {
-    if (drv_rtc_overflow_pending(p_instance))
+    nrfx_timer_compare_int_disable(&m_hires_inst, (nrf_timer_cc_channel_t)channel);
+    m_hires_active &= ~(1UL << channel);
+    if (m_hires_active == 0)
     {
-        on_overflow_evt();
+        nrfx_timer_disable(&m_hires_inst);
     }
-    if (drv_rtc_compare_pending(p_instance, 0))
+}
+
+static void hires_evt_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    for (uint32_t i = 0; i < HIRES_TIMERS_MAX; i++)
     {
-        on_compare_evt(p_instance);
+        if (event_type != nrf_timer_compare_event_get(i))
+        {
+            continue;
+        }
+
+        app_timer_t * p_timer = m_hires_timers[i];
+        bool expired = false;
+
+        TIMER_REGION_ENTER();
+        if ((p_timer != NULL) && !APP_TIMER_IS_IDLE(p_timer))
+        {
+            expired = true;
+            if (p_timer->repeat_period)
+            {
+                uint32_t now = nrfx_timer_capture(&m_hires_inst,
+                                                  (nrf_timer_cc_channel_t)HIRES_CAPTURE_CHANNEL);
+
+                p_timer->end_val = (uint32_t)(p_timer->end_val + p_timer->repeat_period);
+                if ((int32_t)((uint32_t)p_timer->end_val - now) <
+                    (int32_t)APP_TIMER_HIRES_MIN_TIMEOUT_US)
+                {
+                    // Handled too late, the compare would only match after the counter wraps.
+                    p_timer->end_val = (uint32_t)(now + p_timer->repeat_period);
+                }
+                nrfx_timer_compare(&m_hires_inst, (nrf_timer_cc_channel_t)i,
+                                   (uint32_t)p_timer->end_val, true);
+            }
+            else
+            {
+                p_timer->end_val = APP_TIMER_IDLE_VAL;
+                hires_channel_release(i);
+            }
+        }
+        TIMER_REGION_EXIT();
+
+        if (expired)
+        {
+            NRF_LOG_INST_DEBUG(p_timer->p_log, "High resolution timer expired.");
+            NRF_TRACE_TIMER_ENTER(p_timer);
+            p_timer->handler(p_timer->p_context);
+            NRF_TRACE_TIMER_EXIT();
+        }
+        break;
     }
-    if (drv_rtc_compare_pending(p_instance, 1))
+}
+
+static ret_code_t hires_timer_start(app_timer_t * p_t,
+                                    uint32_t      channel,
+                                    uint32_t      timeout_us,
+                                    void *        p_context)
+{
+    timeout_us = MAX(timeout_us, APP_TIMER_HIRES_MIN_TIMEOUT_US);
+
+    TIMER_REGION_ENTER();
+    if (APP_TIMER_IS_IDLE(p_t))
     {
-        on_compare1_evt(p_instance);
+        if (m_hires_active == 0)
+        {
+            nrfx_timer_enable(&m_hires_inst);
+        }
+        m_hires_active |= (1UL << channel);
+
+        p_t->p_context = p_context;
+        if (p_t->repeat_period)
+        {
+            p_t->repeat_period = timeout_us;
+        }
+
+        /* Counter is read and compare is set with interrupts disabled, so the minimum timeout
+         * is enough to not miss the compare. */
+        uint32_t now = nrfx_timer_capture(&m_hires_inst,
+                                          (nrf_timer_cc_channel_t)HIRES_CAPTURE_CHANNEL);
+        p_t->end_val = (uint32_t)(now + timeout_us);
+        nrfx_timer_compare(&m_hires_inst, (nrf_timer_cc_channel_t)channel,
+                           (uint32_t)p_t->end_val, true);
     }
+    TIMER_REGION_EXIT();
 
-    timer_req_process(p_instance);
-    rtc_update(p_instance);
+    return NRF_SUCCESS;
+}
+
+static void hires_timer_stop(app_timer_t * p_t, uint32_t channel)
+{
+    TIMER_REGION_ENTER();
+    if (!APP_TIMER_IS_IDLE(p_t))
+    {
+        p_t->end_val = APP_TIMER_IDLE_VAL;
+        hires_channel_release(channel);
+    }
+    TIMER_REGION_EXIT();
 }
+#endif
 
 /**
  * @brief Function for triggering processing user requests.
@@ -535,7 +1530,7 @@ static ret_code_t timer_req_schedule(app_timer_req_type_t type, app_timer_t * p_
     nrf_atfifo_item_put_t fifo_ctx;
     timer_req_t * p_req;
 #if APP_TIMER_WITH_PROFILER
-    CRITICAL_REGION_ENTER();
+    TIMER_REGION_ENTER();
 #endif
     p_req = nrf_atfifo_item_alloc(m_req_fifo, &fifo_ctx);
 #if APP_TIMER_WITH_PROFILER
@@ -543,7 +1538,7 @@ static ret_code_t timer_req_schedule(app_timer_req_type_t type, app_timer_t * p_
     {
         ++m_current_user_op_queue_utilization;
     }
-    CRITICAL_REGION_EXIT();
+    TIMER_REGION_EXIT();
 #endif /* APP_TIMER_WITH_PROFILER */
     if (p_req)
     {
@@ -565,6 +1560,19 @@ static ret_code_t timer_req_schedule(app_timer_req_type_t type, app_timer_t * p_
     }
 }
 
+/**
+ * @brief Function for scheduling a start request that holds a reservation.
+ */
+static ret_code_t timer_start_req_schedule(app_timer_t * p_timer)
+{
+    ret_code_t err_code = timer_req_schedule(TIMER_REQ_START, p_timer);
+    if (err_code != NRF_SUCCESS)
+    {
+        timer_queue_reserve_release();
+    }
+    return err_code;
+}
+
 ret_code_t app_timer_init(void)
 {
     ret_code_t err_code;
@@ -579,11 +1587,32 @@ ret_code_t app_timer_init(void)
         return err_code;
     }
 
+#if APP_TIMER_CONFIG_BATCH_DISPATCH
+    err_code = NRF_ATFIFO_INIT(m_expired_fifo);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+#endif
+
     err_code = drv_rtc_init(&m_rtc_inst, &config, rtc_irq);
     if (err_code != NRFX_SUCCESS)
     {
         return err_code;
     }
+#if APP_TIMER_CONFIG_HIRES
+    nrfx_timer_config_t hires_config = NRFX_TIMER_DEFAULT_CONFIG;
+    hires_config.frequency          = NRF_TIMER_FREQ_1MHz;
+    hires_config.bit_width          = NRF_TIMER_BIT_WIDTH_32;
+    hires_config.interrupt_priority = APP_TIMER_CONFIG_IRQ_PRIORITY;
+
+    err_code = nrfx_timer_init(&m_hires_inst, &hires_config, hires_evt_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+#endif
+
     drv_rtc_overflow_enable(&m_rtc_inst, true);
     drv_rtc_compare_set(&m_rtc_inst, 1, DRV_RTC_MAX_CNT >> 1, true);
     if (APP_TIMER_KEEPS_RTC_ACTIVE)
@@ -591,6 +1620,12 @@ ret_code_t app_timer_init(void)
         drv_rtc_start(&m_rtc_inst);
     }
 
+#if APP_TIMER_CONFIG_STATS
+    // Enable the DWT cycle counter used for handler run time.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
     m_global_active = true;
     return err_code;
 }
@@ -610,18 +1645,73 @@ ret_code_t app_timer_create(app_timer_id_t const *      p_timer_id,
     app_timer_t * p_t = (app_timer_t *) *p_timer_id;
     p_t->end_val = APP_TIMER_IDLE_VAL;
     p_t->handler = timeout_handler;
+#if APP_TIMER_CONFIG_QUEUE_HEAP
+    heap_pos_set(p_t, 0);
+#endif
+#if APP_TIMER_CONFIG_HIRES
+    TIMER_REGION_ENTER();
+    int32_t channel = hires_channel_find(p_t);
+    if (channel >= 0)
+    {
+        if (m_hires_active & (1UL << channel))
+        {
+            hires_channel_release((uint32_t)channel);
+        }
+        m_hires_timers[channel] = NULL;
+    }
+    TIMER_REGION_EXIT();
+#endif
     p_t->repeat_period = (mode == APP_TIMER_MODE_REPEATED) ? 1 : 0;
     return NRF_SUCCESS;
 }
 
+#if APP_TIMER_CONFIG_HIRES
+ret_code_t app_timer_hires_create(app_timer_id_t const *      p_timer_id,
+                                  app_timer_mode_t            mode,
+                                  app_timer_timeout_handler_t timeout_handler)
+{
+    ret_code_t err_code = app_timer_create(p_timer_id, mode, timeout_handler);
+    VERIFY_SUCCESS(err_code);
+
+    app_timer_t * p_t = (app_timer_t *) *p_timer_id;
+    ret_code_t ret = NRF_ERROR_NO_MEM;
+
+    TIMER_REGION_ENTER();
+    int32_t channel = hires_channel_find(NULL);
+    if (channel >= 0)
+    {
+        m_hires_timers[channel] = p_t;
+        ret = NRF_SUCCESS;
+    }
+    TIMER_REGION_EXIT();
+
+    return ret;
+}
+#endif
+
 ret_code_t app_timer_start(app_timer_t * p_timer, uint32_t timeout_ticks, void * p_context)
 {
     ASSERT(p_timer);
     app_timer_t * p_t = (app_timer_t *) p_timer;
     bool cont;
 
-    CRITICAL_REGION_ENTER();
-    if (APP_TIMER_IS_IDLE(p_t))
+#if APP_TIMER_CONFIG_HIRES
+    int32_t channel = hires_channel_find(p_t);
+    if (channel >= 0)
+    {
+        return hires_timer_start(p_t, (uint32_t)channel, timeout_ticks, p_context);
+    }
+#endif
+
+    ret_code_t ret = NRF_SUCCESS;
+
+    TIMER_REGION_ENTER();
+    if (APP_TIMER_IS_IDLE(p_t) && !timer_queue_reserve())
+    {
+        ret  = NRF_ERROR_NO_MEM;
+        cont = false;
+    }
+    else if (APP_TIMER_IS_IDLE(p_t))
     {
         /* TImer is idle and can be started. Note that timer can still be
          * in use by the engine since stop request may be still pending if
@@ -629,18 +1719,97 @@ ret_code_t app_timer_start(app_timer_t * p_timer, uint32_t timeout_ticks, void *
          * In that case, end value is shifted to the future which will prevent
          * previous timeout value to expire.*/
         p_t->end_val = get_now() + timeout_ticks;
+#if APP_TIMER_CONFIG_COALESCE
+        timer_slack_t * p_slack = timer_slack_find(p_t);
+        if (p_slack)
+        {
+            p_slack->p_timer = NULL;
+        }
+#endif
+#if APP_TIMER_CONFIG_PHASE_LOCK
+        timer_phase_t * p_phase = timer_phase_find(p_t);
+        if (p_phase)
+        {
+            p_phase->p_timer = NULL;
+        }
+#endif
         cont = true;
     }
     else
     {
         cont = false;
     }
-    CRITICAL_REGION_EXIT();
+    TIMER_REGION_EXIT();
 
-    /* Timer in use */
+    /* Timer in use, or no room for it */
     if (!cont)
     {
-        return NRF_SUCCESS;
+        return ret;
+    }
+
+    p_t->p_context = p_context;
+
+    if (p_t->repeat_period)
+    {
+        p_t->repeat_period = timeout_ticks;
+    }
+
+    return timer_start_req_schedule(p_t);
+}
+
+#if APP_TIMER_CONFIG_COALESCE
+ret_code_t app_timer_start_lazy(app_timer_t * p_timer,
+                                uint32_t      timeout_ticks,
+                                uint32_t      slack_ticks,
+                                void *        p_context)
+{
+    ASSERT(p_timer);
+    app_timer_t * p_t = (app_timer_t *) p_timer;
+    ret_code_t ret = NRF_SUCCESS;
+    bool cont = false;
+
+#if APP_TIMER_CONFIG_HIRES
+    /* High resolution timers are precise, slack is ignored. */
+    int32_t channel = hires_channel_find(p_t);
+    if (channel >= 0)
+    {
+        return hires_timer_start(p_t, (uint32_t)channel, timeout_ticks, p_context);
+    }
+#endif
+
+    TIMER_REGION_ENTER();
+    if (APP_TIMER_IS_IDLE(p_t))
+    {
+        timer_slack_t * p_slack = timer_slack_alloc(p_t);
+        if (p_slack && !timer_queue_reserve())
+        {
+            p_slack->p_timer = NULL;
+            ret = NRF_ERROR_NO_MEM;
+        }
+        else if (p_slack)
+        {
+            /* Timer end value is the end of the window, RTC is configured for it. */
+            p_slack->slack = slack_ticks;
+            p_t->end_val = get_now() + timeout_ticks + slack_ticks;
+#if APP_TIMER_CONFIG_PHASE_LOCK
+            timer_phase_t * p_phase = timer_phase_find(p_t);
+            if (p_phase)
+            {
+                p_phase->p_timer = NULL;
+            }
+#endif
+            cont = true;
+        }
+        else
+        {
+            ret = NRF_ERROR_NO_MEM;
+        }
+    }
+    TIMER_REGION_EXIT();
+
+    if (!cont)
+    {
+        return ret;
     }
 
     p_t->p_context = p_context;
@@ -650,9 +1819,101 @@ ret_code_t app_timer_start(app_timer_t * p_timer, uint32_t timeout_ticks, void *
         p_t->repeat_period = timeout_ticks;
     }
 
-    return timer_req_schedule(TIMER_REQ_START, p_t);
+    return timer_start_req_schedule(p_t);
+}
+#endif
+
+#if APP_TIMER_CONFIG_PHASE_LOCK
+ret_code_t app_timer_start_aligned(app_timer_t * p_timer,
+                                   uint32_t      anchor_ticks,
+                                   uint32_t      offset_ticks,
+                                   uint32_t      period_ticks,
+                                   void *        p_context)
+{
+    ASSERT(p_timer);
+    app_timer_t * p_t = (app_timer_t *) p_timer;
+    ret_code_t ret = NRF_SUCCESS;
+    bool cont = false;
+
+    if ((period_ticks == 0) || (p_t->repeat_period == 0))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+#if APP_TIMER_CONFIG_HIRES
+    if (hires_channel_find(p_t) >= 0)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+#endif
+
+    TIMER_REGION_ENTER();
+    if (APP_TIMER_IS_IDLE(p_t))
+    {
+        timer_phase_t * p_phase = timer_phase_alloc(p_t);
+        if (p_phase && !timer_queue_reserve())
+        {
+            p_phase->p_timer = NULL;
+            ret = NRF_ERROR_NO_MEM;
+        }
+        else if (p_phase)
+        {
+            uint64_t now = get_now();
+
+            p_phase->offset = offset_ticks;
+            p_phase->grid   = timer_anchor_get(anchor_ticks, now) + offset_ticks;
+            p_t->end_val    = timer_phase_next(p_phase, period_ticks, now);
+#if APP_TIMER_CONFIG_COALESCE
+            timer_slack_t * p_slack = timer_slack_find(p_t);
+            if (p_slack)
+            {
+                p_slack->p_timer = NULL;
+            }
+#endif
+            cont = true;
+        }
+        else
+        {
+            ret = NRF_ERROR_NO_MEM;
+        }
+    }
+    TIMER_REGION_EXIT();
+
+    if (!cont)
+    {
+        return ret;
+    }
+
+    p_t->p_context     = p_context;
+    p_t->repeat_period = period_ticks;
+
+    return timer_start_req_schedule(p_t);
 }
 
+ret_code_t app_timer_start_phase_locked(app_timer_t * p_timer,
+                                        uint32_t      period_ticks,
+                                        void *        p_context)
+{
+    return app_timer_start_aligned(p_timer, app_timer_cnt_get(), 0, period_ticks, p_context);
+}
+
+ret_code_t app_timer_phase_align(app_timer_t * p_timer, uint32_t anchor_ticks)
+{
+    ASSERT(p_timer);
+    ret_code_t ret = NRF_ERROR_INVALID_STATE;
+
+    TIMER_REGION_ENTER();
+    timer_phase_t * p_phase = timer_phase_find(p_timer);
+    if ((p_phase != NULL) && !APP_TIMER_IS_IDLE(p_timer))
+    {
+        /* Pending expiry is kept, next one is taken from the new grid. */
+        p_phase->grid = timer_anchor_get(anchor_ticks, get_now()) + p_phase->offset;
+        ret = NRF_SUCCESS;
+    }
+    TIMER_REGION_EXIT();
+
+    return ret;
+}
+#endif
 
 ret_code_t app_timer_stop(app_timer_t * p_timer)
 {
@@ -661,7 +1922,16 @@ ret_code_t app_timer_stop(app_timer_t * p_timer)
 
     bool cont;
 
-    CRITICAL_REGION_ENTER();
+#if APP_TIMER_CONFIG_HIRES
+    int32_t channel = hires_channel_find(p_t);
+    if (channel >= 0)
+    {
+        hires_timer_stop(p_t, (uint32_t)channel);
+        return NRF_SUCCESS;
+    }
+#endif
+
+    TIMER_REGION_ENTER();
     if (APP_TIMER_IS_IDLE(p_t))
     {
         /* TImer is idle and can not be stopped. */
@@ -673,7 +1943,7 @@ ret_code_t app_timer_stop(app_timer_t * p_timer)
         p_t->end_val = APP_TIMER_IDLE_VAL;
         cont = true;
     }
-    CRITICAL_REGION_EXIT();
+    TIMER_REGION_EXIT();
 
     if (!cont)
     {
@@ -688,9 +1958,117 @@ ret_code_t app_timer_stop_all(void)
     //block timer globally
     m_global_active = false;
 
+#if APP_TIMER_CONFIG_HIRES
+    for (uint32_t i = 0; i < HIRES_TIMERS_MAX; i++)
+    {
+        if (m_hires_timers[i] != NULL)
+        {
+            hires_timer_stop(m_hires_timers[i], i);
+        }
+    }
+#endif
+
     return timer_req_schedule(TIMER_REQ_STOP_ALL, NULL);
 }
 
+#if APP_TIMER_CONFIG_STATS
+ret_code_t app_timer_stats_get(app_timer_t * p_timer, app_timer_stats_t * p_stats)
+{
+    ASSERT(p_stats);
+    ret_code_t ret = NRF_ERROR_NOT_FOUND;
+
+    TIMER_REGION_ENTER();
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_STATS_TIMERS; i++)
+    {
+        if (m_timer_stats[i].p_timer == p_timer)
+        {
+            *p_stats = m_timer_stats[i].stats;
+            ret = NRF_SUCCESS;
+            break;
+        }
+    }
+    TIMER_REGION_EXIT();
+
+    return ret;
+}
+
+void app_timer_stats_reset(void)
+{
+    TIMER_REGION_ENTER();
+    memset(m_timer_stats, 0, sizeof(m_timer_stats));
+    m_timer_stats_gen++;
+    TIMER_REGION_EXIT();
+}
+
+void app_timer_stats_log(void)
+{
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_STATS_TIMERS; i++)
+    {
+        timer_stats_slot_t slot;
+
+        TIMER_REGION_ENTER();
+        slot = m_timer_stats[i];
+        TIMER_REGION_EXIT();
+
+        if (slot.p_timer == NULL)
+        {
+            continue;
+        }
+
+        NRF_LOG_INST_INFO(slot.p_timer->p_log, "Fired %u, late max %u avg %u ticks.",
+                          slot.stats.fire_count,
+                          slot.stats.lateness_max,
+                          (uint32_t)(slot.stats.lateness_sum / MAX(slot.stats.fire_count, 1)));
+        NRF_LOG_INST_INFO(slot.p_timer->p_log, "Handler max %u avg %u cycles.",
+                          slot.stats.handler_cycles_max,
+                          (uint32_t)(slot.stats.handler_cycles_sum / MAX(slot.stats.handler_count, 1)));
+    }
+}
+#endif
+
+uint32_t app_timer_next_deadline_get(void)
+{
+    uint64_t end_val = APP_TIMER_IDLE_VAL;
+    uint64_t now;
+
+    TIMER_REGION_ENTER();
+    app_timer_t const * p_next = timer_queue_peek();
+
+    for (uint32_t i = 0; i < APP_TIMER_CONFIG_RTC_CHANNELS; i++)
+    {
+        if ((m_active_timers[i] != NULL) && (m_active_timers[i]->end_val < end_val))
+        {
+            end_val = m_active_timers[i]->end_val;
+        }
+    }
+    if ((p_next != NULL) && (p_next->end_val < end_val))
+    {
+        end_val = p_next->end_val;
+    }
+    now = get_now();
+#if APP_TIMER_CONFIG_HIRES
+    if (m_hires_active != 0)
+    {
+        end_val = now;
+    }
+#endif
+    TIMER_REGION_EXIT();
+
+    if (end_val == APP_TIMER_IDLE_VAL)
+    {
+        return APP_TIMER_NO_DEADLINE;
+    }
+    else if (end_val <= now)
+    {
+        return 0;
+    }
+    else if ((end_val - now) >= APP_TIMER_NO_DEADLINE)
+    {
+        return APP_TIMER_NO_DEADLINE - 1;
+    }
+    return (uint32_t)(end_val - now);
+}
+
 #if APP_TIMER_WITH_PROFILER
 uint8_t app_timer_op_queue_utilization_get(void)
 {
@@ -709,6 +2087,11 @@ uint32_t app_timer_cnt_get(void)
     return drv_rtc_counter_get(&m_rtc_inst);
 }
 
+uint64_t app_timer_timestamp_get(void)
+{
+    return get_now();
+}
+
 void app_timer_pause(void)
 {
     drv_rtc_stop(&m_rtc_inst);
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_timer_coalesce Timers with expiry tolerance
+ * @{
+ * @ingroup app_timer
+ *
+ * @brief Starting app_timer timers with a slack window, so expiries can share a wakeup.
+ *
+ * @details A timer started with @ref app_timer_start_lazy may expire at any point between its
+ *          timeout and its timeout extended by the slack. RTC is programmed for the end of the
+ *          window. When a compare event wakes up the CPU, every lazy timer whose window has
+ *          already opened is expired in the same interrupt instead of waking up on its own.
+ *
+ *          Repeated timers keep their period between window ends, so expiries are not
+ *          drifting when they are served early.
+ *
+ *          Enabled with APP_TIMER_CONFIG_COALESCE. APP_TIMER_CONFIG_COALESCE_TIMERS limits
+ *          the number of timers which are running with slack at the same time.
+ */
+
+#ifndef APP_TIMER_COALESCE_H__
+#define APP_TIMER_COALESCE_H__
+
+#include <stdint.h>
+#include "app_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for starting a timer which tolerates late expiry.
+ *
+ * @details Same as @ref app_timer_start except that the timeout handler is called between
+ *          @p timeout_ticks and @p timeout_ticks + @p slack_ticks. Starting the timer with
+ *          @ref app_timer_start removes the slack.
+ *
+ * @param[in] timer_id      Timer identifier.
+ * @param[in] timeout_ticks Earliest expiry, in RTC ticks. In repeated mode it is also the period.
+ * @param[in] slack_ticks   Tolerated delay after @p timeout_ticks, in RTC ticks.
+ * @param[in] p_context     General purpose pointer, passed to the timeout handler.
+ *
+ * @retval NRF_SUCCESS      If the timer was successfully started.
+ * @retval NRF_ERROR_NO_MEM If the timer operations queue was full, or all slack slots were
+ *                          taken by running timers.
+ */
+ret_code_t app_timer_start_lazy(app_timer_id_t timer_id,
+                                uint32_t       timeout_ticks,
+                                uint32_t       slack_ticks,
+                                void *         p_context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_TIMER_COALESCE_H__
+
+/** @} */
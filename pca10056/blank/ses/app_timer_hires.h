@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_timer_hires High resolution timers
+ * @{
+ * @ingroup app_timer
+ *
+ * @brief app_timer timers driven by a TIMER peripheral with 1 microsecond resolution.
+ *
+ * @details RTC based timers resolve 30.5 microseconds and need a guard of two ticks when the
+ *          compare is set, which makes short deadlines late. A timer created with
+ *          @ref app_timer_hires_create is served by the TIMER instance selected with
+ *          APP_TIMER_CONFIG_HIRES_TIMER_INSTANCE instead. Each high resolution timer owns one
+ *          compare channel of the instance, one channel is kept for reading the counter.
+ *
+ *          The timer is started and stopped with @ref app_timer_start and @ref app_timer_stop,
+ *          timeout is given in microseconds (see @ref APP_TIMER_HIRES_TICKS). The TIMER runs, and
+ *          keeps HFCLK requested, only while at least one high resolution timer is running.
+ *          Timeout handlers are called from the TIMER interrupt, also when
+ *          APP_TIMER_CONFIG_USE_SCHEDULER is enabled.
+ */
+
+#ifndef APP_TIMER_HIRES_H__
+#define APP_TIMER_HIRES_H__
+
+#include <stdint.h>
+#include "app_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Minimum timeout of a high resolution timer, in microseconds. Shorter timeouts are
+ *        extended to it so that the compare is never set in the past.
+ */
+#define APP_TIMER_HIRES_MIN_TIMEOUT_US 2
+
+/**@brief Convert microseconds to high resolution timer ticks.
+ *
+ * @param[in] US Time in microseconds.
+ */
+#define APP_TIMER_HIRES_TICKS(US) ((uint32_t)(US))
+
+/**@brief Function for creating a high resolution timer.
+ *
+ * @details Same as @ref app_timer_create, except that the timer is served by the TIMER
+ *          peripheral. A compare channel is allocated for the timer.
+ *
+ * @param[in] p_timer_id      Pointer to timer identifier.
+ * @param[in] mode            Timer mode.
+ * @param[in] timeout_handler Function to be executed when the timer expires.
+ *
+ * @retval NRF_SUCCESS             If the timer was successfully created.
+ * @retval NRF_ERROR_INVALID_PARAM If a parameter was invalid.
+ * @retval NRF_ERROR_NO_MEM        If all compare channels are taken by other timers.
+ */
+ret_code_t app_timer_hires_create(app_timer_id_t const *      p_timer_id,
+                                  app_timer_mode_t            mode,
+                                  app_timer_timeout_handler_t timeout_handler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_TIMER_HIRES_H__
+
+/** @} */
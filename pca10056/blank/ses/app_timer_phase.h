@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_timer_phase Phase-locked repeated timers
+ * @{
+ * @ingroup app_timer
+ *
+ * @brief Repeated app_timer timers whose expiries stay on a fixed grid.
+ *
+ * @details A phase-locked timer computes each expiry as the anchor plus a whole number of
+ *          periods, using the 64 bit timestamp of the module. Late service of one expiry does
+ *          not move the following ones. When expiries are missed, for example because the RTC
+ *          interrupt was blocked for longer than a period, the timer expires once and continues
+ *          on the next grid point instead of expiring back to back.
+ *
+ *          @ref app_timer_start_aligned takes the anchor from the caller. Capturing
+ *          @ref app_timer_cnt_get in a radio notification or connection event handler and
+ *          using the connection interval as period keeps the timer in a fixed position relative
+ *          to the connection events. @ref app_timer_phase_align moves the grid when the
+ *          connection drifts against the RTC or its parameters are updated.
+ *
+ *          Enabled with APP_TIMER_CONFIG_PHASE_LOCK. APP_TIMER_CONFIG_PHASE_LOCK_TIMERS limits
+ *          the number of phase-locked timers which are running at the same time. Timers must be
+ *          created in repeated mode. High resolution timers are not supported.
+ */
+
+#ifndef APP_TIMER_PHASE_H__
+#define APP_TIMER_PHASE_H__
+
+#include <stdint.h>
+#include "app_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for starting a phase-locked repeated timer.
+ *
+ * @details The anchor is the current time, first expiry is one period later. Starting the timer
+ *          with @ref app_timer_start removes the phase lock.
+ *
+ * @param[in] timer_id     Timer identifier.
+ * @param[in] period_ticks Period, in RTC ticks.
+ * @param[in] p_context    General purpose pointer, passed to the timeout handler.
+ *
+ * @retval NRF_SUCCESS             If the timer was successfully started.
+ * @retval NRF_ERROR_INVALID_PARAM If the period is 0 or the timer was not created in repeated mode.
+ * @retval NRF_ERROR_NOT_SUPPORTED If the timer is a high resolution timer.
+ * @retval NRF_ERROR_NO_MEM        If the timer operations queue was full, or all phase slots
+ *                                 were taken by running timers.
+ */
+ret_code_t app_timer_start_phase_locked(app_timer_id_t timer_id,
+                                        uint32_t       period_ticks,
+                                        void *         p_context);
+
+/**@brief Function for starting a phase-locked repeated timer aligned to an external event.
+ *
+ * @details Timer expires at @p anchor_ticks + @p offset_ticks + N * @p period_ticks, starting
+ *          with the first such point in the future.
+ *
+ * @param[in] timer_id     Timer identifier.
+ * @param[in] anchor_ticks RTC counter value of the event, as returned by @ref app_timer_cnt_get.
+ *                         It must not be in the future and must be less than a counter
+ *                         period (24 bits) in the past.
+ * @param[in] offset_ticks Offset of the expiries from the event, in RTC ticks.
+ * @param[in] period_ticks Period, in RTC ticks.
+ * @param[in] p_context    General purpose pointer, passed to the timeout handler.
+ *
+ * @retval NRF_SUCCESS             If the timer was successfully started.
+ * @retval NRF_ERROR_INVALID_PARAM If the period is 0 or the timer was not created in repeated mode.
+ * @retval NRF_ERROR_NOT_SUPPORTED If the timer is a high resolution timer.
+ * @retval NRF_ERROR_NO_MEM        If the timer operations queue was full, or all phase slots
+ *                                 were taken by running timers.
+ */
+ret_code_t app_timer_start_aligned(app_timer_id_t timer_id,
+                                   uint32_t       anchor_ticks,
+                                   uint32_t       offset_ticks,
+                                   uint32_t       period_ticks,
+                                   void *         p_context);
+
+/**@brief Function for moving the grid of a running phase-locked timer.
+ *
+ * @details Offset and period are kept. Expiry which is already scheduled is not moved, the new
+ *          anchor is used from the following one.
+ *
+ * @param[in] timer_id     Timer identifier.
+ * @param[in] anchor_ticks RTC counter value of the event, with the same constraints as in
+ *                         @ref app_timer_start_aligned.
+ *
+ * @retval NRF_SUCCESS             If the anchor was updated.
+ * @retval NRF_ERROR_INVALID_STATE If the timer is not a running phase-locked timer.
+ */
+ret_code_t app_timer_phase_align(app_timer_id_t timer_id, uint32_t anchor_ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_TIMER_PHASE_H__
+
+/** @} */
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_timer_stats Timer statistics
+ * @{
+ * @ingroup app_timer
+ *
+ * @brief Per timer expiry lateness, handler run time and fire count.
+ *
+ * @details Enabled with APP_TIMER_CONFIG_STATS. Statistics are kept for up to
+ *          APP_TIMER_CONFIG_STATS_TIMERS timers, a slot is taken by a timer on its first expiry.
+ *          Lateness is the time between the timer end value and the moment the expiry is
+ *          handled in the RTC interrupt. Handler run time is measured with the DWT cycle counter
+ *          when the handler is called from the RTC interrupt or from a batch
+ *          (APP_TIMER_CONFIG_BATCH_DISPATCH). Handlers put to app_scheduler one by one are not
+ *          timed.
+ */
+
+#ifndef APP_TIMER_STATS_H__
+#define APP_TIMER_STATS_H__
+
+#include <stdint.h>
+#include "app_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Statistics of a timer. */
+typedef struct
+{
+    uint32_t fire_count;          ///< Number of expiries.
+    uint32_t lateness_last;       ///< Lateness of the last expiry, in RTC ticks.
+    uint32_t lateness_max;        ///< Largest lateness, in RTC ticks.
+    uint64_t lateness_sum;        ///< Sum of lateness of all expiries, in RTC ticks.
+    uint32_t handler_cycles_last; ///< Run time of the last handler call, in CPU cycles.
+    uint32_t handler_cycles_max;  ///< Longest handler call, in CPU cycles.
+    uint64_t handler_cycles_sum;  ///< Sum of run time of timed handler calls, in CPU cycles.
+    uint32_t handler_count;       ///< Number of timed handler calls.
+} app_timer_stats_t;
+
+/**@brief Function for getting statistics of a timer.
+ *
+ * @param[in]  timer_id Timer identifier.
+ * @param[out] p_stats  Copy of the statistics.
+ *
+ * @retval NRF_SUCCESS         If statistics were copied.
+ * @retval NRF_ERROR_NOT_FOUND If the timer has not expired yet or had no free slot.
+ */
+ret_code_t app_timer_stats_get(app_timer_id_t timer_id, app_timer_stats_t * p_stats);
+
+/**@brief Function for clearing statistics of all timers and releasing their slots. */
+void app_timer_stats_reset(void);
+
+/**@brief Function for printing statistics of all timers with nrf_log. */
+void app_timer_stats_log(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_TIMER_STATS_H__
+
+/** @} */
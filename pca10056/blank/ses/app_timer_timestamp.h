@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_timer_timestamp 64 bit timestamp
+ * @{
+ * @ingroup app_timer
+ *
+ * @brief Monotonic 64 bit RTC tick timestamp, readable from any context without a critical
+ *        region.
+ *
+ * @details The 24 bit RTC counter is extended with a 64 bit reference published by the RTC
+ *          interrupt twice per counter period, on overflow and in the middle of the period.
+ *          The reference is double buffered and selected by a sequence number, so a reader
+ *          never waits for the writer and only reads again if a new reference was published
+ *          meanwhile. The timestamp is correct as long as the RTC interrupt is not held off for
+ *          half a counter period.
+ */
+
+#ifndef APP_TIMER_TIMESTAMP_H__
+#define APP_TIMER_TIMESTAMP_H__
+
+#include <stdint.h>
+#include "sdk_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for getting the current 64 bit timestamp.
+ *
+ * @details Can be called from any interrupt priority, including above the app_timer interrupt.
+ *
+ * @return Number of RTC ticks since @ref app_timer_init.
+ */
+uint64_t app_timer_timestamp_get(void);
+
+/**@brief Function for converting RTC ticks to microseconds, rounded down.
+ *
+ * @param[in] ticks Number of RTC ticks.
+ *
+ * @return Number of microseconds.
+ */
+__STATIC_INLINE uint64_t app_timer_ticks_to_us(uint64_t ticks)
+{
+    // 1000000 / 32768 = 15625 / 512.
+    return (ticks * 15625u * (APP_TIMER_CONFIG_RTC_FREQUENCY + 1)) >> 9;
+}
+
+/**@brief Function for converting microseconds to RTC ticks, rounded down.
+ *
+ * @param[in] us Number of microseconds.
+ *
+ * @return Number of RTC ticks.
+ */
+__STATIC_INLINE uint64_t app_timer_us_to_ticks(uint64_t us)
+{
+    return (us << 9) / (15625u * (APP_TIMER_CONFIG_RTC_FREQUENCY + 1));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_TIMER_TIMESTAMP_H__
+
+/** @} */
@@ -0,0 +1,857 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(APP_TIMESYNC)
+#include <string.h>
+#include "app_timesync.h"
+#include "app_util.h"
+#include "app_util_platform.h"
+#include "nrf_atomic.h"
+#include "nrf_nvic.h"
+#include "nrf_soc.h"
+#include "nrf_sdh_soc.h"
+#include "nrfx_ppi.h"
+#include "nrfx_timer.h"
+
+#define NRF_LOG_MODULE_NAME app_timesync
+#if APP_TIMESYNC_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       APP_TIMESYNC_CONFIG_LOG_LEVEL
+#define NRF_LOG_INFO_COLOR  APP_TIMESYNC_CONFIG_INFO_COLOR
+#define NRF_LOG_DEBUG_COLOR APP_TIMESYNC_CONFIG_DEBUG_COLOR
+#else //APP_TIMESYNC_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       0
+#endif //APP_TIMESYNC_CONFIG_LOG_ENABLED
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define APP_TIMESYNC_TX_LEAD_US        150   /**< Time from the start of a master timeslot to the TXEN task. */
+#define APP_TIMESYNC_TX_ADDRESS_US     80    /**< Time from the TXEN task to the end of the access address: 40 us fast ramp-up, 8 us preamble and 32 us address at 1 Mbps. */
+#define APP_TIMESYNC_RX_RAMP_US        40    /**< Fast ramp-up time of the receiver. */
+#define APP_TIMESYNC_SLOT_GUARD_US     200   /**< Time left at the end of a timeslot to shut the radio down. */
+#define APP_TIMESYNC_MASTER_SLOT_US    1000  /**< Length of a master timeslot. */
+#define APP_TIMESYNC_SLAVE_SLOT_US     (APP_TIMESYNC_CONFIG_RX_WINDOW_US + 500) /**< Length of a slave timeslot once locked: the window, the ramp-up and the packet. */
+#define APP_TIMESYNC_EARLIEST_TIMEOUT  1000000 /**< Timeout of a request for the earliest possible timeslot, in microseconds. */
+#define APP_TIMESYNC_START_MIN_US      1000  /**< Least time ahead an acquisition can be started. */
+#define APP_TIMESYNC_START_MAX_US      (30ULL * 60 * 1000000) /**< Most time ahead an acquisition can be started, well within a wrap of the local time base. */
+#define APP_TIMESYNC_DRIFT_MAX_PPB     500000 /**< Drift estimates are limited to 500 ppm. */
+
+#define APP_TIMESYNC_PAYLOAD_LEN       11    /**< Network identifier, sequence number and 64-bit time. */
+
+#define APP_TIMESYNC_FLAG_LOCKED       (1UL << 0) /**< @ref APP_TIMESYNC_EVT_LOCKED is pending. */
+#define APP_TIMESYNC_FLAG_LOST         (1UL << 1) /**< @ref APP_TIMESYNC_EVT_LOST is pending. */
+#define APP_TIMESYNC_FLAG_SYNC         (1UL << 2) /**< @ref APP_TIMESYNC_EVT_SYNC is pending. */
+
+/**@brief Module states. */
+typedef enum
+{
+    APP_TIMESYNC_STATE_UNINITIALIZED, ///< Module is not initialized.
+    APP_TIMESYNC_STATE_IDLE,          ///< Module is initialized, synchronization is not running.
+    APP_TIMESYNC_STATE_RUNNING,       ///< Synchronization is running.
+    APP_TIMESYNC_STATE_STOPPING,      ///< Stop was requested, waiting for the session to close.
+} app_timesync_state_t;
+
+/**@brief Relation of the local time base to the network time.
+ *
+ * @details Written from the radio callback, and from the SoC event handler while no timeslot is
+ *          running, so a writer is never preempted by another writer. Readers copy it under
+ *          the sequence counter and retry if it changed.
+ */
+typedef struct
+{
+    volatile uint32_t seq;           ///< Odd while the structure is being written.
+    uint32_t          ext_cnt;       ///< Counter value of the local time base at @ref ext_local.
+    uint64_t          ext_local;     ///< Local time at @ref ext_cnt, extended to 64 bits.
+    uint64_t          anchor_local;  ///< Local time of the last sync point, in microseconds.
+    uint64_t          anchor_net;    ///< Network time of the last sync point, in microseconds.
+    int32_t           drift_ppb;     ///< Rate of the network time relative to the local time base.
+    int32_t           correction_us; ///< Correction made at the last sync point.
+    bool              locked;        ///< Network time is available.
+} app_timesync_timebase_t;
+
+static nrfx_timer_t const m_timer = NRFX_TIMER_INSTANCE(APP_TIMESYNC_CONFIG_TIMER_INSTANCE);
+
+static app_timesync_config_t                    m_config;
+static app_timesync_evt_handler_t               m_evt_handler;
+static volatile app_timesync_state_t            m_state;
+static app_timesync_timebase_t                  m_tb;
+static nrf_ppi_channel_t                        m_ppi;           ///< PPI channel of the TXEN task or the ADDRESS capture.
+static nrf_atomic_u32_t                         m_evt_flags;     ///< Events pending for the SWI3 interrupt.
+static nrf_radio_request_t                      m_request;       ///< Next timeslot request.
+static nrf_radio_signal_callback_return_param_t m_signal_ret;    ///< Return value of the radio callback.
+static uint8_t                                  m_pdu[1 + APP_TIMESYNC_PAYLOAD_LEN]; ///< Packet being sent or received.
+static uint64_t                                 m_slot_start;    ///< Local time of the start of the last timeslot granted.
+static uint32_t                                 m_slot_len;      ///< Length of the timeslot requested.
+static uint32_t                                 m_distance_us;   ///< Distance of the next master timeslot from the last one granted.
+static bool                                     m_earliest;      ///< Next request is for the earliest possible timeslot.
+static uint64_t                                 m_next_net;      ///< Network time of the next expected sync packet, on a locked slave.
+static uint8_t                                  m_samples;       ///< Sync packets received since the search started.
+static uint8_t                                  m_misses;        ///< Sync packets missed in a row.
+static uint8_t                                  m_seq;           ///< Sequence number of the sync packets.
+#if NRF_MODULE_ENABLED(APP_SAADC)
+static uint64_t                                 m_saadc_start_us; ///< Network time at which the acquisition was started.
+static bool                                     m_saadc_armed;    ///< Acquisition was started by @ref app_timesync_saadc_start.
+#endif
+
+
+static void timer_evt_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    // All TIMER events used by the module are routed through PPI only.
+    UNUSED_PARAMETER(event_type);
+    UNUSED_PARAMETER(p_context);
+}
+
+
+static void tb_write_begin(void)
+{
+    m_tb.seq++;
+    __DMB();
+}
+
+
+static void tb_write_end(void)
+{
+    __DMB();
+    m_tb.seq++;
+}
+
+
+/**@brief Function for copying the time base and reading the local time with it.
+ *
+ * @param[out] p_tb    Copy of the time base.
+ * @param[out] p_local Current local time, or NULL.
+ */
+static void tb_read(app_timesync_timebase_t * p_tb, uint64_t * p_local)
+{
+    uint32_t seq;
+    uint32_t cnt;
+
+    do
+    {
+        seq = m_tb.seq;
+        __DMB();
+        cnt = nrfx_timer_capture(&m_timer, NRF_TIMER_CC_CHANNEL2);
+        memcpy(p_tb, &m_tb, sizeof(*p_tb));
+        __DMB();
+    } while ((seq & 1) || (seq != m_tb.seq));
+
+    if (p_local != NULL)
+    {
+        *p_local = p_tb->ext_local + (uint32_t)(cnt - p_tb->ext_cnt);
+    }
+}
+
+
+/**@brief Function for extending a counter value of the local time base to 64 bits.
+ *
+ * @details The counter wraps every 71 minutes. The extension is renewed at each timeslot and
+ *          each blocked request, which come at least once per sync interval.
+ */
+static uint64_t local_extend(uint32_t cnt)
+{
+    return m_tb.ext_local + (uint32_t)(cnt - m_tb.ext_cnt);
+}
+
+
+/**@brief Function for renewing the extension of the local time base. Must be called by a writer. */
+static uint64_t local_now_update(void)
+{
+    uint32_t cnt   = nrfx_timer_capture(&m_timer, NRF_TIMER_CC_CHANNEL0);
+    uint64_t local = local_extend(cnt);
+
+    m_tb.ext_cnt   = cnt;
+    m_tb.ext_local = local;
+
+    return local;
+}
+
+
+static uint64_t net_from_local(app_timesync_timebase_t const * p_tb, uint64_t local)
+{
+    int64_t d = (int64_t)(local - p_tb->anchor_local);
+
+    return p_tb->anchor_net + d + (d * p_tb->drift_ppb) / 1000000000LL;
+}
+
+
+static uint64_t local_from_net(app_timesync_timebase_t const * p_tb, uint64_t net)
+{
+    int64_t e = (int64_t)(net - p_tb->anchor_net);
+
+    return p_tb->anchor_local + e - (e * p_tb->drift_ppb) / 1000000000LL;
+}
+
+
+static uint32_t interval_us(void)
+{
+    return m_config.interval_ms * 1000;
+}
+
+
+/**@brief Function for reporting events from the SWI3 interrupt. */
+static void evt_raise(uint32_t flag)
+{
+    (void)nrf_atomic_u32_or(&m_evt_flags, flag);
+    NVIC_SetPendingIRQ(SWI3_EGU3_IRQn);
+}
+
+
+/**@brief Function for counting a missed sync packet on a slave. Must be called by a writer. */
+static void sync_miss(void)
+{
+    if (!m_tb.locked)
+    {
+        return;
+    }
+
+    m_next_net += interval_us();
+
+    if (++m_misses >= APP_TIMESYNC_CONFIG_MISS_LIMIT)
+    {
+        tb_write_begin();
+        m_tb.locked = false;
+        tb_write_end();
+
+        m_samples = 0;
+        evt_raise(APP_TIMESYNC_FLAG_LOST);
+    }
+}
+
+
+/**@brief Function for taking a received sync packet into account on a slave.
+ *
+ * @param[in] rx_cnt Counter value of the local time base at the ADDRESS event.
+ * @param[in] tx_net Network time of the TXEN task of the master.
+ */
+static void sync_process(uint32_t rx_cnt, uint64_t tx_net)
+{
+    uint64_t local = local_extend(rx_cnt);
+    uint64_t net   = tx_net + APP_TIMESYNC_TX_ADDRESS_US + APP_TIMESYNC_CONFIG_RX_DELAY_US;
+    bool     was_locked = m_tb.locked;
+
+    tb_write_begin();
+
+    if (m_samples > 0)
+    {
+        int64_t dl       = (int64_t)(local - m_tb.anchor_local);
+        int64_t dn       = (int64_t)(net - m_tb.anchor_net);
+        int64_t measured = (dl > 0) ? ((dn - dl) * 1000000000LL) / dl : 0;
+
+        measured = MIN(MAX(measured, -APP_TIMESYNC_DRIFT_MAX_PPB), APP_TIMESYNC_DRIFT_MAX_PPB);
+
+        m_tb.correction_us = was_locked ? (int32_t)(net - net_from_local(&m_tb, local)) : 0;
+        m_tb.drift_ppb     = (m_samples == 1) ?
+                             (int32_t)measured :
+                             m_tb.drift_ppb + (int32_t)((measured - m_tb.drift_ppb) / 4);
+    }
+
+    m_tb.anchor_local = local;
+    m_tb.anchor_net   = net;
+    m_tb.locked       = (m_samples >= 1);
+
+    tb_write_end();
+
+    if (m_samples < UINT8_MAX)
+    {
+        m_samples++;
+    }
+    m_misses   = 0;
+    m_next_net = net + interval_us();
+
+    if (m_tb.locked)
+    {
+        evt_raise(was_locked ? APP_TIMESYNC_FLAG_SYNC : APP_TIMESYNC_FLAG_LOCKED);
+    }
+}
+
+
+/**@brief Function for preparing the next timeslot request.
+ *
+ * @details A master requests its timeslots one sync interval apart. A locked slave requests
+ *          its timeslot so that the receive window is centered on the expected packet, and
+ *          a slave that is not locked searches in timeslots as long as the SoftDevice allows.
+ */
+static void request_prepare(void)
+{
+    if (m_config.role == APP_TIMESYNC_ROLE_MASTER)
+    {
+        m_slot_len = APP_TIMESYNC_MASTER_SLOT_US;
+        m_earliest = m_earliest || (m_distance_us > NRF_RADIO_DISTANCE_MAX_US);
+    }
+    else if (!m_tb.locked)
+    {
+        m_slot_len = MIN(interval_us() + APP_TIMESYNC_CONFIG_RX_WINDOW_US, NRF_RADIO_LENGTH_MAX_US);
+        m_earliest = true;
+    }
+    else
+    {
+        int64_t distance;
+
+        // Skip the packets that are too close to the running timeslot.
+        do
+        {
+            uint64_t start = local_from_net(&m_tb, m_next_net) -
+                             (APP_TIMESYNC_CONFIG_RX_WINDOW_US / 2) - APP_TIMESYNC_RX_RAMP_US;
+
+            distance = (int64_t)(start - m_slot_start);
+            if (distance < (int64_t)(m_slot_len + APP_TIMESYNC_SLOT_GUARD_US))
+            {
+                m_next_net += interval_us();
+            }
+        } while (distance < (int64_t)(m_slot_len + APP_TIMESYNC_SLOT_GUARD_US));
+
+        m_slot_len    = APP_TIMESYNC_SLAVE_SLOT_US;
+        m_distance_us = (uint32_t)MIN(distance, (int64_t)UINT32_MAX);
+        m_earliest    = (m_distance_us > NRF_RADIO_DISTANCE_MAX_US);
+    }
+
+    if (m_earliest)
+    {
+        m_request.request_type               = NRF_RADIO_REQ_TYPE_EARLIEST;
+        m_request.params.earliest.hfclk      = NRF_RADIO_HFCLK_CFG_XTAL_GUARANTEED;
+        m_request.params.earliest.priority   = NRF_RADIO_PRIORITY_NORMAL;
+        m_request.params.earliest.length_us  = m_slot_len;
+        m_request.params.earliest.timeout_us = APP_TIMESYNC_EARLIEST_TIMEOUT;
+    }
+    else
+    {
+        m_request.request_type                = NRF_RADIO_REQ_TYPE_NORMAL;
+        m_request.params.normal.hfclk         = NRF_RADIO_HFCLK_CFG_XTAL_GUARANTEED;
+        m_request.params.normal.priority      = NRF_RADIO_PRIORITY_NORMAL;
+        m_request.params.normal.distance_us   = m_distance_us;
+        m_request.params.normal.length_us     = m_slot_len;
+    }
+}
+
+
+/**@brief Function for configuring the radio for the sync packets. */
+static void radio_configure(void)
+{
+    uint32_t aa = m_config.access_address;
+
+    NRF_RADIO->MODE        = (RADIO_MODE_MODE_Ble_1Mbit << RADIO_MODE_MODE_Pos);
+    NRF_RADIO->MODECNF0    = (RADIO_MODECNF0_RU_Fast << RADIO_MODECNF0_RU_Pos);
+    NRF_RADIO->TXPOWER     = (RADIO_TXPOWER_TXPOWER_0dBm << RADIO_TXPOWER_TXPOWER_Pos);
+    NRF_RADIO->FREQUENCY   = m_config.frequency;
+    NRF_RADIO->DATAWHITEIV = (m_config.frequency & 0x3F) | 0x40;
+    NRF_RADIO->PCNF0       = (8UL << RADIO_PCNF0_LFLEN_Pos);
+    NRF_RADIO->PCNF1       = (RADIO_PCNF1_WHITEEN_Enabled << RADIO_PCNF1_WHITEEN_Pos) |
+                             (RADIO_PCNF1_ENDIAN_Little   << RADIO_PCNF1_ENDIAN_Pos)  |
+                             (3UL                         << RADIO_PCNF1_BALEN_Pos)   |
+                             (APP_TIMESYNC_PAYLOAD_LEN    << RADIO_PCNF1_MAXLEN_Pos);
+    NRF_RADIO->BASE0       = aa << 8;
+    NRF_RADIO->PREFIX0     = (aa >> 24) & RADIO_PREFIX0_AP0_Msk;
+    NRF_RADIO->TXADDRESS   = 0;
+    NRF_RADIO->RXADDRESSES = (RADIO_RXADDRESSES_ADDR0_Enabled << RADIO_RXADDRESSES_ADDR0_Pos);
+    NRF_RADIO->CRCCNF      = (RADIO_CRCCNF_LEN_Three << RADIO_CRCCNF_LEN_Pos) |
+                             (RADIO_CRCCNF_SKIPADDR_Skip << RADIO_CRCCNF_SKIPADDR_Pos);
+    NRF_RADIO->CRCPOLY     = 0x00065B;
+    NRF_RADIO->CRCINIT     = 0x555555;
+    NRF_RADIO->PACKETPTR   = (uint32_t)m_pdu;
+    NRF_RADIO->SHORTS      = RADIO_SHORTS_READY_START_Msk | RADIO_SHORTS_END_DISABLE_Msk;
+
+    NRF_RADIO->EVENTS_DISABLED = 0;
+    NRF_RADIO->INTENSET        = RADIO_INTENSET_DISABLED_Msk;
+    NVIC_EnableIRQ(RADIO_IRQn);
+}
+
+
+static void slot_start(void)
+{
+    tb_write_begin();
+    m_slot_start  = local_now_update();
+    tb_write_end();
+    m_distance_us = interval_us();
+    m_earliest    = false;
+
+    // TIMER0 is started by the SoftDevice at the start of the timeslot.
+    NRF_TIMER0->EVENTS_COMPARE[0] = 0;
+    NRF_TIMER0->CC[0]             = m_slot_len - APP_TIMESYNC_SLOT_GUARD_US;
+    NRF_TIMER0->INTENSET          = TIMER_INTENSET_COMPARE0_Msk;
+
+    radio_configure();
+
+    if (m_config.role == APP_TIMESYNC_ROLE_MASTER)
+    {
+        // The TXEN task is triggered on a compare event, so the time in the packet is exact.
+        uint32_t tx_cnt = m_tb.ext_cnt + APP_TIMESYNC_TX_LEAD_US;
+        uint64_t tx_net = m_slot_start + APP_TIMESYNC_TX_LEAD_US;
+
+        m_pdu[0] = APP_TIMESYNC_PAYLOAD_LEN;
+        (void)uint16_encode(m_config.network_id, &m_pdu[1]);
+        m_pdu[3] = m_seq++;
+        (void)uint32_encode((uint32_t)tx_net, &m_pdu[4]);
+        (void)uint32_encode((uint32_t)(tx_net >> 32), &m_pdu[8]);
+
+        nrfx_timer_compare(&m_timer, NRF_TIMER_CC_CHANNEL0, tx_cnt, false);
+        nrf_ppi_channel_endpoint_setup(m_ppi,
+                                       nrfx_timer_compare_event_address_get(&m_timer,
+                                                                            NRF_TIMER_CC_CHANNEL0),
+                                       (uint32_t)&NRF_RADIO->TASKS_TXEN);
+    }
+    else
+    {
+        nrf_ppi_channel_endpoint_setup(m_ppi,
+                                       (uint32_t)&NRF_RADIO->EVENTS_ADDRESS,
+                                       nrfx_timer_capture_task_address_get(&m_timer,
+                                                                           NRF_TIMER_CC_CHANNEL0));
+        NRF_RADIO->TASKS_RXEN = 1;
+    }
+    nrf_ppi_channel_enable(m_ppi);
+}
+
+
+/**@brief Function for shutting the radio down and ending the timeslot. */
+static void slot_end(void)
+{
+    nrf_ppi_channel_disable(m_ppi);
+
+    NRF_TIMER0->INTENCLR = TIMER_INTENCLR_COMPARE0_Msk;
+    NRF_RADIO->INTENCLR  = RADIO_INTENCLR_DISABLED_Msk;
+    NRF_RADIO->SHORTS    = 0;
+    NRF_RADIO->TASKS_DISABLE = 1;
+
+    if (m_state == APP_TIMESYNC_STATE_RUNNING)
+    {
+        request_prepare();
+        m_signal_ret.callback_action         = NRF_RADIO_SIGNAL_CALLBACK_ACTION_REQUEST_AND_END;
+        m_signal_ret.params.request.p_next = &m_request;
+    }
+    else
+    {
+        m_signal_ret.callback_action = NRF_RADIO_SIGNAL_CALLBACK_ACTION_END;
+    }
+}
+
+
+/**@brief Function for checking a received packet and getting the network time in it. */
+static bool pdu_decode(uint64_t * p_tx_net)
+{
+    if ((NRF_RADIO->CRCSTATUS != RADIO_CRCSTATUS_CRCSTATUS_CRCOk) ||
+        (m_pdu[0] != APP_TIMESYNC_PAYLOAD_LEN) ||
+        (uint16_decode(&m_pdu[1]) != m_config.network_id))
+    {
+        return false;
+    }
+
+    *p_tx_net = ((uint64_t)uint32_decode(&m_pdu[8]) << 32) | uint32_decode(&m_pdu[4]);
+
+    return true;
+}
+
+
+static void radio_evt_handle(void)
+{
+    uint64_t tx_net;
+
+    if (!NRF_RADIO->EVENTS_DISABLED)
+    {
+        return;
+    }
+    NRF_RADIO->EVENTS_DISABLED = 0;
+
+    if (m_config.role == APP_TIMESYNC_ROLE_MASTER)
+    {
+        slot_end();
+    }
+    else if (pdu_decode(&tx_net))
+    {
+        sync_process(nrfx_timer_capture_get(&m_timer, NRF_TIMER_CC_CHANNEL0), tx_net);
+        slot_end();
+    }
+    else
+    {
+        // Not a sync packet of this network, keep listening.
+        NRF_RADIO->TASKS_RXEN = 1;
+    }
+}
+
+
+static nrf_radio_signal_callback_return_param_t * radio_callback(uint8_t signal_type)
+{
+    m_signal_ret.callback_action = NRF_RADIO_SIGNAL_CALLBACK_ACTION_NONE;
+
+    switch (signal_type)
+    {
+        case NRF_RADIO_CALLBACK_SIGNAL_TYPE_START:
+            slot_start();
+            break;
+
+        case NRF_RADIO_CALLBACK_SIGNAL_TYPE_RADIO:
+            radio_evt_handle();
+            break;
+
+        case NRF_RADIO_CALLBACK_SIGNAL_TYPE_TIMER0:
+            // End of the timeslot, the expected packet did not come.
+            NRF_TIMER0->EVENTS_COMPARE[0] = 0;
+            if (m_config.role == APP_TIMESYNC_ROLE_SLAVE)
+            {
+                sync_miss();
+            }
+            slot_end();
+            break;
+
+        default:
+            break;
+    }
+
+    return &m_signal_ret;
+}
+
+
+/**@brief Function for requesting a timeslot again after a request was not granted. */
+static void request_retry(void)
+{
+    ret_code_t err_code;
+
+    // No timeslot runs until the request is made, so the time base can be written here.
+    CRITICAL_REGION_ENTER();
+    tb_write_begin();
+    (void)local_now_update();
+    tb_write_end();
+
+    if (m_config.role == APP_TIMESYNC_ROLE_MASTER)
+    {
+        // Keep the phase of the sync packets.
+        m_distance_us += interval_us();
+    }
+    else
+    {
+        sync_miss();
+    }
+    request_prepare();
+    CRITICAL_REGION_EXIT();
+
+    err_code = sd_radio_request(&m_request);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("sd_radio_request() returned error 0x%x.", err_code);
+    }
+}
+
+
+static void soc_evt_handler(uint32_t evt_id, void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if (m_state == APP_TIMESYNC_STATE_UNINITIALIZED)
+    {
+        return;
+    }
+
+    switch (evt_id)
+    {
+        case NRF_EVT_RADIO_BLOCKED:
+        case NRF_EVT_RADIO_CANCELED:
+            if (m_state == APP_TIMESYNC_STATE_RUNNING)
+            {
+                request_retry();
+            }
+            break;
+
+        case NRF_EVT_RADIO_SIGNAL_CALLBACK_INVALID_RETURN:
+            NRF_LOG_ERROR("Invalid return from the radio callback.");
+            break;
+
+        case NRF_EVT_RADIO_SESSION_CLOSED:
+            if (m_state == APP_TIMESYNC_STATE_STOPPING)
+            {
+                nrfx_timer_disable(&m_timer);
+                (void)sd_clock_hfclk_release();
+                m_state = APP_TIMESYNC_STATE_IDLE;
+                NRF_LOG_INFO("Stopped.");
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+NRF_SDH_SOC_OBSERVER(m_soc_observer, APP_TIMESYNC_CONFIG_SOC_OBSERVER_PRIO, soc_evt_handler, NULL);
+
+
+void SWI3_EGU3_IRQHandler(void)
+{
+    app_timesync_timebase_t tb;
+    app_timesync_evt_t      evt;
+    uint32_t                flags = nrf_atomic_u32_fetch_store(&m_evt_flags, 0);
+
+    if (m_evt_handler == NULL)
+    {
+        return;
+    }
+
+    tb_read(&tb, NULL);
+    evt.correction_us = tb.correction_us;
+    evt.drift_ppb     = tb.drift_ppb;
+
+    // When the lock was both lost and regained, the current state gives the order.
+    if ((flags & APP_TIMESYNC_FLAG_LOST) && (tb.locked || !(flags & APP_TIMESYNC_FLAG_LOCKED)))
+    {
+        evt.type = APP_TIMESYNC_EVT_LOST;
+        m_evt_handler(&evt);
+        flags &= ~APP_TIMESYNC_FLAG_LOST;
+    }
+    if (flags & APP_TIMESYNC_FLAG_LOCKED)
+    {
+        evt.type = APP_TIMESYNC_EVT_LOCKED;
+        m_evt_handler(&evt);
+    }
+    if (flags & APP_TIMESYNC_FLAG_SYNC)
+    {
+        evt.type = APP_TIMESYNC_EVT_SYNC;
+        m_evt_handler(&evt);
+    }
+    if (flags & APP_TIMESYNC_FLAG_LOST)
+    {
+        evt.type = APP_TIMESYNC_EVT_LOST;
+        m_evt_handler(&evt);
+    }
+}
+
+
+ret_code_t app_timesync_init(app_timesync_config_t const * p_config,
+                             app_timesync_evt_handler_t    evt_handler)
+{
+    ret_code_t err_code;
+
+    ASSERT(p_config);
+
+    if (m_state != APP_TIMESYNC_STATE_UNINITIALIZED)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if ((p_config->frequency > 100) ||
+        (p_config->interval_ms < 10) || (p_config->interval_ms > 60000) ||
+        ((p_config->role != APP_TIMESYNC_ROLE_MASTER) && (p_config->role != APP_TIMESYNC_ROLE_SLAVE)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    nrfx_timer_config_t timer_config = NRFX_TIMER_DEFAULT_CONFIG;
+    timer_config.frequency = NRF_TIMER_FREQ_1MHz;
+    timer_config.mode      = NRF_TIMER_MODE_TIMER;
+    timer_config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+    err_code = nrfx_timer_init(&m_timer, &timer_config, timer_evt_handler);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = nrfx_ppi_channel_alloc(&m_ppi);
+    if (err_code != NRF_SUCCESS)
+    {
+        nrfx_timer_uninit(&m_timer);
+        return NRF_ERROR_NO_MEM;
+    }
+
+    APP_ERROR_CHECK(sd_nvic_ClearPendingIRQ(SWI3_EGU3_IRQn));
+    APP_ERROR_CHECK(sd_nvic_SetPriority(SWI3_EGU3_IRQn, APP_TIMESYNC_CONFIG_IRQ_PRIORITY));
+    APP_ERROR_CHECK(sd_nvic_EnableIRQ(SWI3_EGU3_IRQn));
+
+    m_config      = *p_config;
+    m_evt_handler = evt_handler;
+    m_evt_flags   = 0;
+    m_state       = APP_TIMESYNC_STATE_IDLE;
+
+    NRF_LOG_INFO("Initialized as %s, interval: %d ms.",
+                 (p_config->role == APP_TIMESYNC_ROLE_MASTER) ? "master" : "slave",
+                 p_config->interval_ms);
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t app_timesync_start(void)
+{
+    ret_code_t err_code;
+
+    if (m_state != APP_TIMESYNC_STATE_IDLE)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    err_code = sd_clock_hfclk_request();
+    VERIFY_SUCCESS(err_code);
+
+    nrfx_timer_clear(&m_timer);
+    nrfx_timer_enable(&m_timer);
+
+    // A master is the network time right away.
+    memset(&m_tb, 0, sizeof(m_tb));
+    m_tb.locked   = (m_config.role == APP_TIMESYNC_ROLE_MASTER);
+    m_samples     = 0;
+    m_misses      = 0;
+    m_distance_us = interval_us();
+    m_earliest    = true;
+    request_prepare();
+
+    err_code = sd_radio_session_open(radio_callback);
+    if (err_code == NRF_SUCCESS)
+    {
+        err_code = sd_radio_request(&m_request);
+        if (err_code != NRF_SUCCESS)
+        {
+            (void)sd_radio_session_close();
+        }
+    }
+    if (err_code != NRF_SUCCESS)
+    {
+        nrfx_timer_disable(&m_timer);
+        (void)sd_clock_hfclk_release();
+        return err_code;
+    }
+
+    m_state = APP_TIMESYNC_STATE_RUNNING;
+
+    return NRF_SUCCESS;
+}
+
+
+void app_timesync_stop(void)
+{
+    if (m_state != APP_TIMESYNC_STATE_RUNNING)
+    {
+        return;
+    }
+
+    // The running timeslot ends as usual, but without a request for the next one.
+    m_state = APP_TIMESYNC_STATE_STOPPING;
+    APP_ERROR_CHECK(sd_radio_session_close());
+}
+
+
+bool app_timesync_is_locked(void)
+{
+    return (m_state == APP_TIMESYNC_STATE_RUNNING) && m_tb.locked;
+}
+
+
+ret_code_t app_timesync_time_get(uint64_t * p_time_us)
+{
+    app_timesync_timebase_t tb;
+    uint64_t                local;
+
+    ASSERT(p_time_us);
+
+    if (m_state != APP_TIMESYNC_STATE_RUNNING)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    tb_read(&tb, &local);
+    if (!tb.locked)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    *p_time_us = net_from_local(&tb, local);
+
+    return NRF_SUCCESS;
+}
+
+
+#if NRF_MODULE_ENABLED(APP_SAADC)
+ret_code_t app_timesync_saadc_start(uint64_t time_us)
+{
+    ret_code_t              err_code;
+    app_timesync_timebase_t tb;
+    uint64_t                local;
+    uint64_t                now;
+
+    if (m_state != APP_TIMESYNC_STATE_RUNNING)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    tb_read(&tb, &local);
+    if (!tb.locked)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    now = net_from_local(&tb, local);
+    if ((time_us < now + APP_TIMESYNC_START_MIN_US) || (time_us > now + APP_TIMESYNC_START_MAX_US))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    // The compare matches once per wrap of the counter, 71 minutes. Later matches hit a running
+    // trigger, on which the START task has no effect.
+    nrfx_timer_compare(&m_timer,
+                       NRF_TIMER_CC_CHANNEL1,
+                       (uint32_t)local_from_net(&tb, time_us),
+                       false);
+
+    err_code = app_saadc_start_at(nrfx_timer_compare_event_address_get(&m_timer,
+                                                                       NRF_TIMER_CC_CHANNEL1));
+    VERIFY_SUCCESS(err_code);
+
+    m_saadc_start_us = time_us;
+    m_saadc_armed    = true;
+
+    NRF_LOG_DEBUG("Acquisition armed for %d us from now.", (uint32_t)(time_us - now));
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t app_timesync_saadc_timestamp_get(app_saadc_done_evt_t const * p_done,
+                                            uint64_t *                   p_time_us)
+{
+    app_timesync_timebase_t tb;
+    int64_t                 offset_us;
+
+    ASSERT(p_done);
+    ASSERT(p_time_us);
+
+    if (!m_saadc_armed || (p_done->start_offset_ns == UINT64_MAX))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    // The pacing TIMER runs from the same crystal as the local time base.
+    tb_read(&tb, NULL);
+    offset_us  = (int64_t)(p_done->start_offset_ns / 1000);
+    *p_time_us = m_saadc_start_us + offset_us + (offset_us * tb.drift_ppb) / 1000000000LL;
+
+    return NRF_SUCCESS;
+}
+#endif // NRF_MODULE_ENABLED(APP_SAADC)
+
+#endif // NRF_MODULE_ENABLED(APP_TIMESYNC)
@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_timesync Network time synchronization
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Module for keeping a common time base on several devices over radio timeslots.
+ *
+ * @details One device is the time master. At each sync interval, it requests a radio timeslot
+ *          from the SoftDevice and transmits a sync packet with its local time. The transmission
+ *          is started by a TIMER compare event through PPI, so the time in the packet is the
+ *          exact time of the transmission and does not depend on interrupt latency.
+ *
+ *          The other devices are slaves. They receive the sync packets in timeslots of their
+ *          own and capture their local time on the ADDRESS event of the radio through PPI.
+ *          Each packet gives the offset of the local time base to the network time, and two
+ *          consecutive packets give the drift of the local crystal. Between the packets, the
+ *          network time is predicted from the last offset and the drift. Once locked, a slave
+ *          only listens in a short window around the expected packet. While searching,
+ *          it listens in timeslots of up to 100 ms, which take radio time from BLE links.
+ *
+ *          The local time base is a TIMER instance running at 1 MHz from the HFXO, so the
+ *          HFXO is kept running while the synchronization is active.
+ *
+ *          With @ref app_timesync_saadc_start, all devices start a hardware-paced SAADC
+ *          acquisition (@ref app_saadc) at the same network time. The start is triggered by a
+ *          compare event of the local time base through PPI. The network time of each
+ *          buffer follows from @ref app_timesync_saadc_timestamp_get. Timestamps have
+ *          a resolution of 1 us, and their accuracy is that of the synchronization.
+ *
+ *          Events are reported from the SWI3 interrupt, which must not be used by other
+ *          modules.
+ *
+ * @note    The pacing TIMER of the SAADC runs from the local crystal and is not disciplined.
+ *          Over a long acquisition, the sample times of two devices diverge by the difference
+ *          of their crystal frequencies. The timestamps account for this, so the divergence
+ *          is visible in them. To keep the samples themselves aligned, start a new
+ *          acquisition from time to time.
+ */
+
+#ifndef APP_TIMESYNC_H__
+#define APP_TIMESYNC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "nordic_common.h"
+#include "sdk_config.h"
+#if NRF_MODULE_ENABLED(APP_SAADC) || defined(__SDK_DOXYGEN__)
+#include "app_saadc.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Roles of a device. */
+typedef enum
+{
+    APP_TIMESYNC_ROLE_MASTER, ///< Transmits its local time as the network time.
+    APP_TIMESYNC_ROLE_SLAVE,  ///< Follows the network time of the master.
+} app_timesync_role_t;
+
+/**@brief Event types. */
+typedef enum
+{
+    APP_TIMESYNC_EVT_LOCKED, ///< Slave locked to the network time. Network time is available.
+    APP_TIMESYNC_EVT_LOST,   ///< Slave missed @ref APP_TIMESYNC_CONFIG_MISS_LIMIT sync packets in a row and searches again.
+    APP_TIMESYNC_EVT_SYNC,   ///< Slave received a sync packet while locked.
+} app_timesync_evt_type_t;
+
+/**@brief Event structure. */
+typedef struct
+{
+    app_timesync_evt_type_t type;          ///< Event type.
+    int32_t                 correction_us; ///< Network time in the last sync packet minus the predicted one, in microseconds.
+    int32_t                 drift_ppb;     ///< Rate of the network time relative to the local time base, in parts per billion.
+} app_timesync_evt_t;
+
+/**@brief Event handler type. */
+typedef void (* app_timesync_evt_handler_t)(app_timesync_evt_t const * p_evt);
+
+/**@brief Configuration. */
+typedef struct
+{
+    app_timesync_role_t role;           ///< Role of the device.
+    uint8_t             frequency;      ///< Radio frequency, as an offset to 2400 MHz. 0 to 100.
+    uint32_t            access_address; ///< Access address of the sync packets.
+    uint16_t            network_id;     ///< Identifier of the network, sync packets of other networks are ignored.
+    uint32_t            interval_ms;    ///< Interval of the sync packets, in milliseconds. 10 to 60000.
+} app_timesync_config_t;
+
+/**@brief Function for initializing the module.
+ *
+ * @param[in] p_config    Configuration. Copied, so it does not need to stay valid.
+ * @param[in] evt_handler Event handler, or NULL.
+ *
+ * @retval NRF_SUCCESS             If the module was initialized.
+ * @retval NRF_ERROR_INVALID_STATE If the module is already initialized.
+ * @retval NRF_ERROR_INVALID_PARAM If a configuration value is out of range.
+ * @retval NRF_ERROR_NO_MEM        If there are no free PPI channels.
+ */
+ret_code_t app_timesync_init(app_timesync_config_t const * p_config,
+                             app_timesync_evt_handler_t    evt_handler);
+
+/**@brief Function for starting the synchronization.
+ *
+ * @details Requests the HFXO, starts the local time base and opens the radio timeslot session.
+ *          A master has the network time right away. A slave listens until it receives two
+ *          sync packets, and then reports @ref APP_TIMESYNC_EVT_LOCKED.
+ *
+ * @retval NRF_SUCCESS             If the synchronization was started.
+ * @retval NRF_ERROR_INVALID_STATE If the module is not initialized or already started.
+ * @retval Other                   Error codes returned by sd_radio_session_open and sd_radio_request.
+ */
+ret_code_t app_timesync_start(void);
+
+/**@brief Function for stopping the synchronization.
+ *
+ * @details Closes the radio timeslot session when the running timeslot is over, and releases
+ *          the HFXO. The network time is not available afterwards.
+ */
+void app_timesync_stop(void);
+
+/**@brief Function for checking if the network time is available.
+ *
+ * @retval true  If the device is the master and started, or a locked slave.
+ * @retval false Otherwise.
+ */
+bool app_timesync_is_locked(void);
+
+/**@brief Function for getting the current network time.
+ *
+ * @param[out] p_time_us Network time, in microseconds.
+ *
+ * @retval NRF_SUCCESS             If the time was read.
+ * @retval NRF_ERROR_INVALID_STATE If the network time is not available.
+ */
+ret_code_t app_timesync_time_get(uint64_t * p_time_us);
+
+#if NRF_MODULE_ENABLED(APP_SAADC) || defined(__SDK_DOXYGEN__)
+/**@brief Function for starting a hardware-paced SAADC acquisition at a network time.
+ *
+ * @details The acquisition is armed with @ref app_saadc_start_at on a compare event of the
+ *          local time base at the local time that corresponds to @p time_us. The first sample
+ *          is taken one sample period later. Give all devices the same time, some sync
+ *          intervals ahead, so that each has received a sync packet in between.
+ *
+ * @param[in] time_us Network time at which the pacing is started, in microseconds. At least
+ *                    1 ms and at most 30 minutes ahead.
+ *
+ * @retval NRF_SUCCESS             If the acquisition was armed.
+ * @retval NRF_ERROR_INVALID_STATE If the network time is not available.
+ * @retval NRF_ERROR_INVALID_PARAM If @p time_us is too close or too far.
+ * @retval Other                   Error codes returned by @ref app_saadc_start_at.
+ */
+ret_code_t app_timesync_saadc_start(uint64_t time_us);
+
+/**@brief Function for getting the network time of the first sample of a buffer.
+ *
+ * @param[in]  p_done    Data of the @ref APP_SAADC_EVT_DONE event.
+ * @param[out] p_time_us Network time of the first sample, in microseconds.
+ *
+ * @retval NRF_SUCCESS             If the time was computed.
+ * @retval NRF_ERROR_INVALID_STATE If the acquisition was not started by
+ *                                 @ref app_timesync_saadc_start, or was restarted in a
+ *                                 calibration or auxiliary conversion gap.
+ */
+ret_code_t app_timesync_saadc_timestamp_get(app_saadc_done_evt_t const * p_done,
+                                            uint64_t *                   p_time_us);
+#endif // NRF_MODULE_ENABLED(APP_SAADC)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_TIMESYNC_H__
+
+/** @} */
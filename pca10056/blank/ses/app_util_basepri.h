@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup app_util_basepri Priority ceiling critical regions
+ * @{
+ * @ingroup app_util_platform
+ *
+ * @brief Critical regions that mask only interrupts up to a priority ceiling.
+ *
+ * @details CRITICAL_REGION_ENTER calls sd_nvic_critical_region_enter when the SoftDevice is
+ *          present, or disables all interrupts otherwise. A region entered with
+ *          @ref APP_UTIL_BASEPRI_REGION_ENTER instead raises BASEPRI, which masks the interrupts
+ *          with a priority value equal to or greater than the ceiling and leaves the higher
+ *          priorities running. The code is inlined and takes a few cycles, without an SVC.
+ *
+ *          A region only protects data against contexts it masks, so every context that enters
+ *          a region on the same data must run at the ceiling priority or lower (a numerically
+ *          equal or greater value). This is checked with an assertion in debug builds. When the
+ *          SoftDevice is present, the ceiling must not mask any of its priorities, which is
+ *          checked with @ref APP_UTIL_BASEPRI_CEILING_CHECK.
+ *
+ *          A ceiling of 0 selects the regular critical region. On Cortex-M0, which has no
+ *          BASEPRI, the regular critical region is always used.
+ *
+ * @note No SoftDevice function may be called inside a region with a ceiling: the SVC would be
+ *       masked and escalate to a HardFault.
+ */
+
+#ifndef APP_UTIL_BASEPRI_H__
+#define APP_UTIL_BASEPRI_H__
+
+#include <stdint.h>
+#include "nrf.h"
+#include "app_util_platform.h"
+#include "nrf_assert.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Macro for checking at compile time that a ceiling can be used.
+ *
+ * @details When the SoftDevice is present, the ceiling must be below its lowest priority.
+ *
+ * @param _ceiling  Priority ceiling, or 0 for the regular critical region.
+ */
+#if defined(SOFTDEVICE_PRESENT)
+#define APP_UTIL_BASEPRI_CEILING_CHECK(_ceiling) \
+    STATIC_ASSERT(((_ceiling) == 0) || ((_ceiling) >= APP_IRQ_PRIORITY_LOW_MID))
+#else
+#define APP_UTIL_BASEPRI_CEILING_CHECK(_ceiling) \
+    STATIC_ASSERT((_ceiling) < (1 << __NVIC_PRIO_BITS))
+#endif
+
+/**@brief Function for entering a priority ceiling critical region.
+ *
+ * @note Use @ref APP_UTIL_BASEPRI_REGION_ENTER instead of calling this function directly.
+ *
+ * @param[in] ceiling   Priority ceiling, or 0 for the regular critical region.
+ *
+ * @return State to be passed to @ref app_util_basepri_region_exit.
+ */
+__STATIC_INLINE uint32_t app_util_basepri_region_enter(uint32_t ceiling)
+{
+#if __CORTEX_M >= (0x03U)
+    if (ceiling != 0)
+    {
+        ASSERT(current_int_priority_get() >= ceiling);
+
+        uint32_t basepri = __get_BASEPRI();
+        // Only raises the mask, so a nested region does not unmask the outer one.
+        __set_BASEPRI_MAX(ceiling << (8U - __NVIC_PRIO_BITS));
+        __ISB();
+        return basepri;
+    }
+#endif
+    uint8_t nested = 0;
+    app_util_critical_region_enter(&nested);
+    return nested;
+}
+
+/**@brief Function for exiting a priority ceiling critical region.
+ *
+ * @note Use @ref APP_UTIL_BASEPRI_REGION_EXIT instead of calling this function directly.
+ *
+ * @param[in] ceiling   Priority ceiling used to enter the region.
+ * @param[in] state     State returned by @ref app_util_basepri_region_enter.
+ */
+__STATIC_INLINE void app_util_basepri_region_exit(uint32_t ceiling, uint32_t state)
+{
+#if __CORTEX_M >= (0x03U)
+    if (ceiling != 0)
+    {
+        __set_BASEPRI(state);
+        return;
+    }
+#endif
+    app_util_critical_region_exit((uint8_t)state);
+}
+
+/**@brief Macro for entering a priority ceiling critical region.
+ *
+ * @note Due to implementation details, there must exist one and only one call to
+ *       APP_UTIL_BASEPRI_REGION_EXIT() for each call to APP_UTIL_BASEPRI_REGION_ENTER(), and
+ *       they must be located in the same scope.
+ *
+ * @param _ceiling  Priority ceiling, or 0 for the regular critical region.
+ */
+#define APP_UTIL_BASEPRI_REGION_ENTER(_ceiling)                                 \
+    {                                                                           \
+        uint32_t __BASEPRI_STATE = app_util_basepri_region_enter(_ceiling);
+
+/**@brief Macro for exiting a priority ceiling critical region.
+ *
+ * @param _ceiling  Priority ceiling used to enter the region.
+ */
+#define APP_UTIL_BASEPRI_REGION_EXIT(_ceiling)                                  \
+        app_util_basepri_region_exit((_ceiling), __BASEPRI_STATE);              \
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // APP_UTIL_BASEPRI_H__
+
+/** @} */
@@ -23,6 +23,7 @@
 #include "app_timer.h"
 #include "nrf_ble_gatt.h"
 #include "ble_conn_params.h"
+#include "app_saadc_bench.h"
 
 // GPIO / SAADC definitions
 #define LED_PIN             24                // P0.24
@@ -50,6 +51,18 @@ BLE_ADVERTISING_DEF(m_advertising);
 
 static uint16_t m_conn_handle = BLE_CONN_HANDLE_INVALID;
 
+#if NRF_MODULE_ENABLED(APP_SAADC_BENCH)
+// Benchmark scenarios, run without and with a BLE connection
+static const app_saadc_bench_scenario_t m_bench_scenarios[] =
+{
+    {.sample_interval_us = 1000, .channel_count = 2, .buffer_size = 2,   .duration_ms = 2000},
+    {.sample_interval_us = 100,  .channel_count = 2, .buffer_size = 64,  .duration_ms = 2000},
+    {.sample_interval_us = 20,   .channel_count = 1, .buffer_size = 128, .duration_ms = 2000},
+    {.sample_interval_us = 50,   .channel_count = 4, .buffer_size = 128, .duration_ms = 2000},
+    {.sample_interval_us = 200,  .channel_count = 8, .buffer_size = 128, .duration_ms = 2000},
+};
+#endif
+
 // SAADC buffers
 static nrf_saadc_value_t saadc_buf1[SAADC_BUFFER_SIZE];
 static nrf_saadc_value_t saadc_buf2[SAADC_BUFFER_SIZE];
@@ -262,6 +275,13 @@ static void saadc_init(void)
     err = nrfx_saadc_init(NRFX_SAADC_CONFIG_IRQ_PRIORITY);
     APP_ERROR_CHECK(err);
 
+#if NRF_MODULE_ENABLED(APP_SAADC_BENCH)
+    // Benchmark build: channels and acquisition are set up per scenario
+    err = app_saadc_bench_init();
+    APP_ERROR_CHECK(err);
+    return;
+#endif
+
     // Channel 0: NTC1, Channel 1: NTC2
     nrfx_saadc_channel_config_t ch0 = NRFX_SAADC_DEFAULT_CHANNEL_SE(NTC1_AIN, 0);
     nrfx_saadc_channel_config_t ch1 = NRFX_SAADC_DEFAULT_CHANNEL_SE(NTC2_AIN, 1);
@@ -314,6 +334,12 @@ int main(void)
     nrf_gpio_pin_clear(SR_RESET_PIN);
     nrf_gpio_pin_set(NTC_EN_PIN);
 
+#if NRF_MODULE_ENABLED(APP_SAADC_BENCH)
+    APP_ERROR_CHECK(app_saadc_bench_run(m_bench_scenarios, ARRAY_SIZE(m_bench_scenarios),
+                                        false, NULL));
+    bool bench_connected_done = false;
+#endif
+
     // Start advertising
     advertising_start();
 
@@ -323,12 +349,23 @@ int main(void)
     // Main loop
     while (true)
     {
+#if NRF_MODULE_ENABLED(APP_SAADC_BENCH)
+        // Repeat the benchmark once a central is connected
+        if (!bench_connected_done && (m_conn_handle != BLE_CONN_HANDLE_INVALID))
+        {
+            bench_connected_done = true;
+            APP_ERROR_CHECK(app_saadc_bench_run(m_bench_scenarios, ARRAY_SIZE(m_bench_scenarios),
+                                                true, NULL));
+        }
+        UNUSED_VARIABLE(sample_timer);
+#else
         // Trigger SAADC every SAADC_SAMPLE_INTERVAL_MS
         if (++sample_timer >= (SAADC_SAMPLE_INTERVAL_MS / 100))
         {
             sample_timer = 0;
             nrfx_saadc_mode_trigger();
         }
+#endif
 
         // Blink LED at 5 Hz (toggle every 100ms)
         if (++blink_timer >= 1)
@@ -0,0 +1,377 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_ADV_SCHED)
+#include "ble_adv_sched.h"
+#include <string.h>
+#include "sdk_macros.h"
+
+#define NRF_LOG_MODULE_NAME ble_adv_sched
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+
+/**@brief Function for counting the enabled sets.
+ *
+ * @param[in] p_sched Scheduler instance.
+ */
+static uint32_t enabled_set_cnt(ble_adv_sched_t const * const p_sched)
+{
+    uint32_t cnt = 0;
+
+    for (uint32_t i = 0; i < BLE_ADV_SCHED_SET_CNT; i++)
+    {
+        if (p_sched->set[i].in_use && p_sched->set[i].enabled)
+        {
+            cnt++;
+        }
+    }
+
+    return cnt;
+}
+
+
+/**@brief Function for starting the turn of the next enabled set.
+ *
+ * @details Connectable sets that cannot advertise since no further connection can be accepted
+ *          are skipped. If no set can advertise, the scheduler waits for an event that changes
+ *          this.
+ *
+ * @param[in,out] p_sched Scheduler instance.
+ *
+ * @return NRF_SUCCESS or an error from the SoftDevice.
+ */
+static ret_code_t turn_start(ble_adv_sched_t * const p_sched)
+{
+    uint32_t cnt = enabled_set_cnt(p_sched);
+
+    for (uint32_t i = 1; i <= BLE_ADV_SCHED_SET_CNT; i++)
+    {
+        uint8_t               set_id = (p_sched->current + i) % BLE_ADV_SCHED_SET_CNT;
+        ble_adv_sched_set_t * p_set  = &p_sched->set[set_id];
+        ret_code_t            err_code;
+
+        if (!p_set->in_use || !p_set->enabled)
+        {
+            continue;
+        }
+
+        // A set advertising alone is not interrupted.
+        p_set->adv_params.duration     = BLE_GAP_ADV_TIMEOUT_GENERAL_UNLIMITED;
+        p_set->adv_params.max_adv_evts = (cnt > 1) ? p_set->adv_evts : 0;
+
+        err_code = sd_ble_gap_adv_set_configure(&p_sched->adv_handle,
+                                                &p_set->adv_data,
+                                                &p_set->adv_params);
+        if (err_code == NRF_SUCCESS)
+        {
+            err_code = sd_ble_gap_adv_start(p_sched->adv_handle, p_sched->conn_cfg_tag);
+        }
+
+        if (err_code == NRF_SUCCESS)
+        {
+            NRF_LOG_DEBUG("Set %d advertising.", set_id);
+            p_sched->current = set_id;
+            p_sched->on_air  = true;
+            return NRF_SUCCESS;
+        }
+
+        if (err_code != NRF_ERROR_CONN_COUNT)
+        {
+            return err_code;
+        }
+    }
+
+    NRF_LOG_DEBUG("No set can advertise.");
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for ending the current turn and starting the next one.
+ *
+ * @param[in,out] p_sched Scheduler instance.
+ *
+ * @return NRF_SUCCESS or an error from the SoftDevice.
+ */
+static ret_code_t turn_restart(ble_adv_sched_t * const p_sched)
+{
+    if (p_sched->on_air)
+    {
+        ret_code_t err_code = sd_ble_gap_adv_stop(p_sched->adv_handle);
+
+        p_sched->on_air = false;
+
+        if (err_code == NRF_ERROR_INVALID_STATE)
+        {
+            // The turn has just ended and its event starts the next one.
+            return NRF_SUCCESS;
+        }
+    }
+
+    return turn_start(p_sched);
+}
+
+
+/**@brief Function for starting the next turn from an event.
+ *
+ * @param[in,out] p_sched Scheduler instance.
+ */
+static void turn_start_from_evt(ble_adv_sched_t * const p_sched)
+{
+    ret_code_t err_code = turn_start(p_sched);
+
+    if ((err_code != NRF_SUCCESS) && (p_sched->error_handler != NULL))
+    {
+        p_sched->error_handler(err_code);
+    }
+}
+
+
+void ble_adv_sched_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    ble_adv_sched_t     * p_sched   = (ble_adv_sched_t *)p_context;
+    ble_gap_evt_t const * p_gap_evt = &p_ble_evt->evt.gap_evt;
+
+    if (!p_sched->running)
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        // The set has used its advertising events.
+        case BLE_GAP_EVT_ADV_SET_TERMINATED:
+            if (p_gap_evt->params.adv_set_terminated.adv_handle == p_sched->adv_handle)
+            {
+                p_sched->on_air = false;
+                turn_start_from_evt(p_sched);
+            }
+            break;
+
+        // A connectable set was connected to, which stops the advertising.
+        case BLE_GAP_EVT_CONNECTED:
+            if ((p_gap_evt->params.connected.role == BLE_GAP_ROLE_PERIPH) &&
+                (p_gap_evt->params.connected.adv_handle == p_sched->adv_handle) &&
+                p_sched->on_air)
+            {
+                p_sched->on_air = false;
+                turn_start_from_evt(p_sched);
+            }
+            break;
+
+        // Connectable sets that were skipped can advertise again.
+        case BLE_GAP_EVT_DISCONNECTED:
+            if (!p_sched->on_air)
+            {
+                turn_start_from_evt(p_sched);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+ret_code_t ble_adv_sched_init(ble_adv_sched_t             * p_sched,
+                              uint8_t                       conn_cfg_tag,
+                              ble_adv_sched_error_handler_t error_handler)
+{
+    VERIFY_PARAM_NOT_NULL(p_sched);
+
+    memset(p_sched, 0, sizeof(*p_sched));
+
+    p_sched->adv_handle    = BLE_GAP_ADV_SET_HANDLE_NOT_SET;
+    p_sched->conn_cfg_tag  = conn_cfg_tag;
+    p_sched->error_handler = error_handler;
+    p_sched->current       = BLE_ADV_SCHED_SET_CNT - 1;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t ble_adv_sched_set_add(ble_adv_sched_t            * p_sched,
+                                 ble_gap_adv_params_t const * p_params,
+                                 ble_gap_adv_data_t   const * p_adv_data,
+                                 uint8_t                      adv_evts,
+                                 uint8_t                    * p_set_id)
+{
+    VERIFY_PARAM_NOT_NULL(p_sched);
+    VERIFY_PARAM_NOT_NULL(p_params);
+    VERIFY_PARAM_NOT_NULL(p_adv_data);
+    VERIFY_PARAM_NOT_NULL(p_set_id);
+
+    if (adv_evts == 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < BLE_ADV_SCHED_SET_CNT; i++)
+    {
+        ble_adv_sched_set_t * p_set = &p_sched->set[i];
+
+        if (!p_set->in_use)
+        {
+            uint32_t cnt = enabled_set_cnt(p_sched);
+
+            p_set->adv_params = *p_params;
+            p_set->adv_data   = *p_adv_data;
+            p_set->adv_evts   = adv_evts;
+            p_set->in_use     = true;
+            p_set->enabled    = true;
+
+            *p_set_id = i;
+
+            // A set advertising alone must now take turns.
+            if (p_sched->running && (!p_sched->on_air || (cnt == 1)))
+            {
+                return turn_restart(p_sched);
+            }
+
+            return NRF_SUCCESS;
+        }
+    }
+
+    return NRF_ERROR_NO_MEM;
+}
+
+
+ret_code_t ble_adv_sched_set_enable(ble_adv_sched_t * p_sched,
+                                    uint8_t           set_id,
+                                    bool              enable)
+{
+    VERIFY_PARAM_NOT_NULL(p_sched);
+
+    if ((set_id >= BLE_ADV_SCHED_SET_CNT) || !p_sched->set[set_id].in_use)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    ble_adv_sched_set_t * p_set = &p_sched->set[set_id];
+    uint32_t              cnt   = enabled_set_cnt(p_sched);
+
+    if (p_set->enabled == enable)
+    {
+        return NRF_SUCCESS;
+    }
+
+    p_set->enabled = enable;
+
+    if (!p_sched->running)
+    {
+        return NRF_SUCCESS;
+    }
+
+    if (enable)
+    {
+        // A set advertising alone must now take turns.
+        if (!p_sched->on_air || (cnt == 1))
+        {
+            return turn_restart(p_sched);
+        }
+    }
+    else if (p_sched->on_air && (p_sched->current == set_id))
+    {
+        return turn_restart(p_sched);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t ble_adv_sched_data_update(ble_adv_sched_t          * p_sched,
+                                     uint8_t                    set_id,
+                                     ble_gap_adv_data_t const * p_adv_data)
+{
+    VERIFY_PARAM_NOT_NULL(p_sched);
+    VERIFY_PARAM_NOT_NULL(p_adv_data);
+
+    if ((set_id >= BLE_ADV_SCHED_SET_CNT) || !p_sched->set[set_id].in_use)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if (p_sched->on_air && (p_sched->current == set_id))
+    {
+        ret_code_t err_code = sd_ble_gap_adv_set_configure(&p_sched->adv_handle, p_adv_data, NULL);
+        VERIFY_SUCCESS(err_code);
+    }
+
+    p_sched->set[set_id].adv_data = *p_adv_data;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t ble_adv_sched_start(ble_adv_sched_t * p_sched)
+{
+    VERIFY_PARAM_NOT_NULL(p_sched);
+
+    if (p_sched->running)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    ret_code_t err_code = turn_start(p_sched);
+    VERIFY_SUCCESS(err_code);
+
+    p_sched->running = true;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t ble_adv_sched_stop(ble_adv_sched_t * p_sched)
+{
+    VERIFY_PARAM_NOT_NULL(p_sched);
+
+    p_sched->running = false;
+
+    if (p_sched->on_air)
+    {
+        (void) sd_ble_gap_adv_stop(p_sched->adv_handle);
+        p_sched->on_air = false;
+    }
+
+    return NRF_SUCCESS;
+}
+
+#endif // NRF_MODULE_ENABLED(BLE_ADV_SCHED)
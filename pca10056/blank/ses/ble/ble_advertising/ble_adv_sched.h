@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup ble_adv_sched Advertising Set Scheduler
+ * @{
+ * @ingroup  ble_sdk_lib
+ * @brief    Module for advertising several payloads with their own parameters.
+ *
+ * @details  The SoftDevice provides a single advertising set. This module shares it between
+ *           several logical sets, each with its own advertising parameters (type, including
+ *           extended advertising types, primary and secondary PHY, interval) and data.
+ *
+ *           The sets take turns in round-robin order. A set advertises for its number of
+ *           advertising events, after which the SoftDevice ends the turn with
+ *           @ref BLE_GAP_EVT_ADV_SET_TERMINATED and the next enabled set is configured and
+ *           started. No timer is used. A single enabled set advertises without a limit.
+ *
+ *           A connectable set that results in a connection ends its turn. A connectable set is
+ *           skipped while no further connection can be accepted.
+ *
+ * @note     This module owns the advertising set of the SoftDevice and cannot be used together
+ *           with the @ref ble_advertising module. High duty cycle directed advertising is not
+ *           supported, because it does not take a limit of advertising events.
+ */
+
+#ifndef BLE_ADV_SCHED_H__
+#define BLE_ADV_SCHED_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_config.h"
+#include "sdk_errors.h"
+#include "ble.h"
+#include "ble_gap.h"
+#include "nrf_sdh_ble.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief   Macro for defining a ble_adv_sched instance.
+ *
+ * @param   _name   Name of the instance.
+ * @hideinitializer
+ */
+#define BLE_ADV_SCHED_DEF(_name)                                                                    \
+static ble_adv_sched_t _name;                                                                       \
+NRF_SDH_BLE_OBSERVER(_name ## _ble_obs,                                                             \
+                     BLE_ADV_BLE_OBSERVER_PRIO,                                                     \
+                     ble_adv_sched_on_ble_evt, &_name)
+
+/**@brief   Scheduler error handler type. Called with errors of the SoftDevice when a turn is started from an event. */
+typedef void (*ble_adv_sched_error_handler_t) (ret_code_t nrf_error);
+
+/**@brief   Logical advertising set. */
+typedef struct
+{
+    ble_gap_adv_params_t adv_params; /**< Advertising parameters. The duration and the limit of advertising events are set by the module. */
+    ble_gap_adv_data_t   adv_data;   /**< Encoded advertising and scan response data, owned by the application. */
+    uint8_t              adv_evts;   /**< Number of advertising events per turn. */
+    bool                 in_use;     /**< True if the set was added. */
+    bool                 enabled;    /**< True if the set takes turns. */
+} ble_adv_sched_set_t;
+
+/**@brief   Scheduler instance. */
+typedef struct
+{
+    ble_adv_sched_set_t           set[BLE_ADV_SCHED_SET_CNT]; /**< Logical sets. */
+    ble_adv_sched_error_handler_t error_handler;              /**< Handler for errors that occur when starting a turn from an event. Can be NULL. */
+    uint8_t                       adv_handle;                 /**< Handle of the SoftDevice advertising set. */
+    uint8_t                       conn_cfg_tag;               /**< Connection configuration used by connectable sets. */
+    uint8_t                       current;                    /**< Set having or last having a turn. */
+    bool                          running;                    /**< True between @ref ble_adv_sched_start and @ref ble_adv_sched_stop. */
+    bool                          on_air;                     /**< True if a set is advertising. */
+} ble_adv_sched_t;
+
+
+/**@brief   Function for handling BLE events.
+ *
+ * @param[in] p_ble_evt BLE stack event.
+ * @param[in] p_context Scheduler instance.
+ */
+void ble_adv_sched_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+/**@brief   Function for initializing the scheduler.
+ *
+ * @param[out] p_sched       Scheduler instance.
+ * @param[in]  conn_cfg_tag  Connection configuration used by connectable sets, see @ref sd_ble_cfg_set.
+ * @param[in]  error_handler Handler for errors that occur when starting a turn from an event. Can be NULL.
+ *
+ * @retval NRF_SUCCESS    If the scheduler was initialized.
+ * @retval NRF_ERROR_NULL If @p p_sched is NULL.
+ */
+ret_code_t ble_adv_sched_init(ble_adv_sched_t             * p_sched,
+                              uint8_t                       conn_cfg_tag,
+                              ble_adv_sched_error_handler_t error_handler);
+
+
+/**@brief   Function for adding a logical advertising set.
+ *
+ * @details The set is enabled. If the scheduler is running, it takes its turn in order.
+ *
+ * @param[in,out] p_sched    Scheduler instance.
+ * @param[in]     p_params   Advertising parameters of the set.
+ * @param[in]     p_adv_data Encoded data of the set. The buffers must stay valid while the set is used.
+ * @param[in]     adv_evts   Number of advertising events per turn, at least 1.
+ * @param[out]    p_set_id   Identifier of the added set.
+ *
+ * @retval NRF_SUCCESS             If the set was added.
+ * @retval NRF_ERROR_NULL          If a NULL pointer was provided.
+ * @retval NRF_ERROR_INVALID_PARAM If @p adv_evts is 0.
+ * @retval NRF_ERROR_NO_MEM        If @ref BLE_ADV_SCHED_SET_CNT sets were already added.
+ */
+ret_code_t ble_adv_sched_set_add(ble_adv_sched_t            * p_sched,
+                                 ble_gap_adv_params_t const * p_params,
+                                 ble_gap_adv_data_t   const * p_adv_data,
+                                 uint8_t                      adv_evts,
+                                 uint8_t                    * p_set_id);
+
+
+/**@brief   Function for enabling or disabling a logical advertising set.
+ *
+ * @details A disabled set keeps its parameters and data but takes no turns. Disabling the set
+ *          that is advertising ends its turn.
+ *
+ * @param[in,out] p_sched Scheduler instance.
+ * @param[in]     set_id  Identifier of the set.
+ * @param[in]     enable  True to enable the set.
+ *
+ * @retval NRF_SUCCESS             If the set was enabled or disabled.
+ * @retval NRF_ERROR_NULL          If @p p_sched is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If @p set_id does not refer to an added set.
+ * @return Other errors from the SoftDevice if the next turn could not be started.
+ */
+ret_code_t ble_adv_sched_set_enable(ble_adv_sched_t * p_sched,
+                                    uint8_t           set_id,
+                                    bool              enable);
+
+
+/**@brief   Function for updating the data of a logical advertising set.
+ *
+ * @details If the set is advertising, the new data is passed to the SoftDevice without stopping
+ *          the advertising, so the buffers must differ from the ones in use. Otherwise the data is
+ *          stored, and several updates between two turns are passed to the SoftDevice once.
+ *
+ * @param[in,out] p_sched    Scheduler instance.
+ * @param[in]     set_id     Identifier of the set.
+ * @param[in]     p_adv_data New encoded data. The buffers must stay valid while the set is used.
+ *
+ * @retval NRF_SUCCESS             If the data was updated.
+ * @retval NRF_ERROR_NULL          If a NULL pointer was provided.
+ * @retval NRF_ERROR_INVALID_PARAM If @p set_id does not refer to an added set.
+ * @return Other errors from @ref sd_ble_gap_adv_set_configure.
+ */
+ret_code_t ble_adv_sched_data_update(ble_adv_sched_t          * p_sched,
+                                     uint8_t                    set_id,
+                                     ble_gap_adv_data_t const * p_adv_data);
+
+
+/**@brief   Function for starting the scheduler.
+ *
+ * @param[in,out] p_sched Scheduler instance.
+ *
+ * @retval NRF_SUCCESS             If the first turn was started, or if no set can advertise yet.
+ * @retval NRF_ERROR_NULL          If @p p_sched is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If the scheduler is already running.
+ * @return Other errors from the SoftDevice if the first turn could not be started.
+ */
+ret_code_t ble_adv_sched_start(ble_adv_sched_t * p_sched);
+
+
+/**@brief   Function for stopping the scheduler.
+ *
+ * @param[in,out] p_sched Scheduler instance.
+ *
+ * @retval NRF_SUCCESS    If the scheduler was stopped.
+ * @retval NRF_ERROR_NULL If @p p_sched is NULL.
+ */
+ret_code_t ble_adv_sched_stop(ble_adv_sched_t * p_sched);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_ADV_SCHED_H__
+
+/** @} */
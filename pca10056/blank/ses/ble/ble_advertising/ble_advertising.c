@@ -45,6 +45,9 @@
 #include "nrf_log.h"
 #include "sdk_errors.h"
 #include "nrf_sdh_ble.h"
+#if BLE_ADVERTISING_RECONNECT_ENABLED
+#include "peer_manager.h"
+#endif
 
 #define BLE_ADV_MODES (5) /**< Total number of possible advertising modes. */
 
@@ -86,6 +89,99 @@ static ble_adv_mode_t adv_mode_next_get(ble_adv_mode_t adv_mode)
 }
 
 
+#if BLE_ADVERTISING_RECONNECT_ENABLED
+/**@brief Function for getting the address to direct advertising to when reconnecting a peer.
+ *
+ * @param[in]  peer_id  Peer to reconnect.
+ * @param[out] p_addr   Identity address of the peer.
+ *
+ * @retval true  If the peer can be reconnected with directed advertising.
+ * @retval false If the peer has no identity address, or it has an IRK but cannot resolve
+ *               a private target address.
+ */
+static bool reconnect_addr_get(pm_peer_id_t peer_id, ble_gap_addr_t * p_addr)
+{
+    pm_peer_data_bonding_t bonding_data;
+    uint32_t               car     = 1;
+    uint32_t               car_len = sizeof(car);
+
+    if (pm_peer_data_bonding_load(peer_id, &bonding_data) != NRF_SUCCESS)
+    {
+        return false;
+    }
+
+    *p_addr = bonding_data.peer_ble_id.id_addr_info;
+
+    if ((p_addr->addr_type != BLE_GAP_ADDR_TYPE_PUBLIC) &&
+        (p_addr->addr_type != BLE_GAP_ADDR_TYPE_RANDOM_STATIC))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < BLE_GAP_SEC_KEY_LEN; i++)
+    {
+        if (bonding_data.peer_ble_id.id_info.irk[i] != 0)
+        {
+            // The SoftDevice targets a private address. A peer which has not reported its
+            // Central Address Resolution support is tried anyway.
+            UNUSED_RETURN_VALUE(pm_peer_data_load(peer_id,
+                                                  PM_PEER_DATA_ID_CENTRAL_ADDR_RES,
+                                                  &car,
+                                                  &car_len));
+            return (car != 0);
+        }
+    }
+
+    return true;
+}
+
+
+/**@brief Function for setting up the reconnection sequence after a disconnection.
+ *
+ * @details Nothing is set up if the disconnected peer is not bonded.
+ *
+ * @param[in] p_advertising Advertising module instance.
+ * @param[in] conn_handle   Handle of the disconnected link.
+ */
+static void reconnect_list_load(ble_advertising_t * const p_advertising, uint16_t conn_handle)
+{
+    pm_peer_id_t peer_id;
+    pm_peer_id_t peers[BLE_ADVERTISING_RECONNECT_PEERS + 1]; // The disconnected peer is usually listed too.
+    uint32_t     peer_cnt = ARRAY_SIZE(peers);
+
+    p_advertising->reconnect_cnt = 0;
+    p_advertising->reconnect_idx = 0;
+
+    if (   !p_advertising->adv_modes_config.ble_adv_directed_high_duty_enabled
+        || p_advertising->adv_modes_config.ble_adv_extended_enabled
+        || (pm_peer_id_get(conn_handle, &peer_id) != NRF_SUCCESS)
+        || (peer_id == PM_PEER_ID_INVALID))
+    {
+        return;
+    }
+
+    if (reconnect_addr_get(peer_id, &p_advertising->reconnect_addrs[0]))
+    {
+        p_advertising->reconnect_cnt = 1;
+    }
+
+    if (pm_peer_ranked_list_get(peers, &peer_cnt, PM_PEER_ID_LIST_SKIP_NO_ID_ADDR) != NRF_SUCCESS)
+    {
+        peer_cnt = 0;
+    }
+
+    for (uint32_t i = 0; (i < peer_cnt) && (p_advertising->reconnect_cnt < BLE_ADVERTISING_RECONNECT_PEERS); i++)
+    {
+        if (   (peers[i] != peer_id)
+            && reconnect_addr_get(peers[i], &p_advertising->reconnect_addrs[p_advertising->reconnect_cnt]))
+        {
+            p_advertising->reconnect_cnt++;
+        }
+    }
+}
+#endif // BLE_ADVERTISING_RECONNECT_ENABLED
+
+
 /**@brief Function for handling the Connected event.
  *
  * @param[in] p_ble_evt Event received from the BLE stack.
@@ -95,6 +191,9 @@ static void on_connected(ble_advertising_t * const p_advertising, ble_evt_t cons
     if (p_ble_evt->evt.gap_evt.params.connected.role == BLE_GAP_ROLE_PERIPH)
     {
         p_advertising->current_slave_link_conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+#if BLE_ADVERTISING_RECONNECT_ENABLED
+        p_advertising->reconnect_cnt = 0;
+#endif
     }
 }
 
@@ -113,6 +212,9 @@ static void on_disconnected(ble_advertising_t * const p_advertising, ble_evt_t c
     if (p_ble_evt->evt.gap_evt.conn_handle == p_advertising->current_slave_link_conn_handle &&
         p_advertising->adv_modes_config.ble_adv_on_disconnect_disabled == false)
     {
+#if BLE_ADVERTISING_RECONNECT_ENABLED
+       reconnect_list_load(p_advertising, p_ble_evt->evt.gap_evt.conn_handle);
+#endif
        ret = ble_advertising_start(p_advertising, BLE_ADV_MODE_DIRECTED_HIGH_DUTY);
        if ((ret != NRF_SUCCESS) && (p_advertising->error_handler != NULL))
        {
@@ -140,8 +242,19 @@ static void on_terminated(ble_advertising_t * const p_advertising, ble_evt_t con
     if (  p_ble_evt->evt.gap_evt.params.adv_set_terminated.reason == BLE_GAP_EVT_ADV_SET_TERMINATED_REASON_TIMEOUT
         ||p_ble_evt->evt.gap_evt.params.adv_set_terminated.reason == BLE_GAP_EVT_ADV_SET_TERMINATED_REASON_LIMIT_REACHED)
     {
+        ble_adv_mode_t adv_mode = adv_mode_next_get(p_advertising->adv_mode_current);
+
+#if BLE_ADVERTISING_RECONNECT_ENABLED
+        // Try the next peer of the reconnection sequence before moving on.
+        if (   (p_advertising->adv_mode_current == BLE_ADV_MODE_DIRECTED_HIGH_DUTY)
+            && (p_advertising->reconnect_idx + 1 < p_advertising->reconnect_cnt))
+        {
+            p_advertising->reconnect_idx++;
+            adv_mode = BLE_ADV_MODE_DIRECTED_HIGH_DUTY;
+        }
+#endif
         // Start advertising in the next mode.
-        ret = ble_advertising_start(p_advertising, adv_mode_next_get(p_advertising->adv_mode_current));
+        ret = ble_advertising_start(p_advertising, adv_mode);
 
         if ((ret != NRF_SUCCESS) && (p_advertising->error_handler != NULL))
         {
@@ -454,6 +567,13 @@ void ble_advertising_conn_cfg_tag_set(ble_advertising_t * const p_advertising,
 }
 
 
+void ble_advertising_conn_cfg_tag_handler_set(ble_advertising_t            * const p_advertising,
+                                              ble_adv_conn_cfg_tag_handler_t       handler)
+{
+    p_advertising->conn_cfg_tag_handler = handler;
+}
+
+
 uint32_t ble_advertising_init(ble_advertising_t            * const p_advertising,
                               ble_advertising_init_t const * const p_init)
 {
@@ -470,6 +590,7 @@ uint32_t ble_advertising_init(ble_advertising_t            * const p_advertising
     p_advertising->adv_mode_current               = BLE_ADV_MODE_IDLE;
     p_advertising->adv_modes_config               = p_init->config;
     p_advertising->conn_cfg_tag                   = BLE_CONN_CFG_TAG_DEFAULT;
+    p_advertising->conn_cfg_tag_handler           = NULL;
     p_advertising->evt_handler                    = p_init->evt_handler;
     p_advertising->error_handler                  = p_init->error_handler;
     p_advertising->current_slave_link_conn_handle = BLE_CONN_HANDLE_INVALID;
@@ -543,6 +664,7 @@ uint32_t ble_advertising_start(ble_advertising_t * const p_advertising,
                                ble_adv_mode_t            advertising_mode)
 {
     uint32_t ret;
+    bool     peer_addr_set = false;
 
     if (p_advertising->initialized == false)
     {
@@ -553,10 +675,27 @@ uint32_t ble_advertising_start(ble_advertising_t * const p_advertising,
 
     memset(&p_advertising->peer_address, 0, sizeof(p_advertising->peer_address));
 
-    if (  ((p_advertising->adv_modes_config.ble_adv_directed_high_duty_enabled) && (p_advertising->adv_mode_current == BLE_ADV_MODE_DIRECTED_HIGH_DUTY))
-        ||((p_advertising->adv_modes_config.ble_adv_directed_enabled)           && (p_advertising->adv_mode_current == BLE_ADV_MODE_DIRECTED_HIGH_DUTY))
-        ||((p_advertising->adv_modes_config.ble_adv_directed_enabled)           && (p_advertising->adv_mode_current == BLE_ADV_MODE_DIRECTED))
-       )
+#if BLE_ADVERTISING_RECONNECT_ENABLED
+    // Reconnection sequence supplies the peer address, any other mode ends the sequence.
+    if (   (advertising_mode == BLE_ADV_MODE_DIRECTED_HIGH_DUTY)
+        && (p_advertising->reconnect_idx < p_advertising->reconnect_cnt))
+    {
+        p_advertising->peer_address             = p_advertising->reconnect_addrs[p_advertising->reconnect_idx];
+        p_advertising->peer_addr_reply_expected = false;
+        peer_addr_set                           = true;
+    }
+    else
+    {
+        p_advertising->reconnect_cnt = 0;
+        p_advertising->reconnect_idx = 0;
+    }
+#endif
+
+    if (!peer_addr_set &&
+        (  ((p_advertising->adv_modes_config.ble_adv_directed_high_duty_enabled) && (p_advertising->adv_mode_current == BLE_ADV_MODE_DIRECTED_HIGH_DUTY))
+         ||((p_advertising->adv_modes_config.ble_adv_directed_enabled)           && (p_advertising->adv_mode_current == BLE_ADV_MODE_DIRECTED_HIGH_DUTY))
+         ||((p_advertising->adv_modes_config.ble_adv_directed_enabled)           && (p_advertising->adv_mode_current == BLE_ADV_MODE_DIRECTED))
+        ))
     {
         if (p_advertising->evt_handler != NULL)
         {
@@ -644,13 +783,24 @@ uint32_t ble_advertising_start(ble_advertising_t * const p_advertising,
 
     if (p_advertising->adv_mode_current != BLE_ADV_MODE_IDLE)
     {
+        uint8_t conn_cfg_tag = p_advertising->conn_cfg_tag;
 
         ret = sd_ble_gap_adv_set_configure(&p_advertising->adv_handle, p_advertising->p_adv_data, &p_advertising->adv_params);
         if (ret != NRF_SUCCESS)
         {
             return ret;
         }
-        ret = sd_ble_gap_adv_start(p_advertising->adv_handle, p_advertising->conn_cfg_tag);
+
+        if (p_advertising->conn_cfg_tag_handler != NULL)
+        {
+            bool directed = (p_advertising->adv_mode_current == BLE_ADV_MODE_DIRECTED_HIGH_DUTY) ||
+                            (p_advertising->adv_mode_current == BLE_ADV_MODE_DIRECTED);
+
+            conn_cfg_tag = p_advertising->conn_cfg_tag_handler(p_advertising->adv_mode_current,
+                                                               directed ? &p_advertising->peer_address : NULL);
+        }
+
+        ret = sd_ble_gap_adv_start(p_advertising->adv_handle, conn_cfg_tag);
 
         if (ret != NRF_SUCCESS)
         {
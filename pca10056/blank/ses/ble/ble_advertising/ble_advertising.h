@@ -51,12 +51,24 @@
  *
  * @note     The Advertising Module supports only applications with a single peripheral link.
  *
+ * @details  With BLE_ADVERTISING_RECONNECT_ENABLED, a disconnection from a bonded peer starts a
+ *           fast reconnection sequence instead of asking the application for a peer address.
+ *           Directed high duty cycle advertising is run to the disconnected peer and then to the
+ *           other peers in order of rank (see @ref pm_peer_ranked_list_get), up to
+ *           BLE_ADVERTISING_RECONNECT_PEERS peers, each for @ref BLE_GAP_ADV_TIMEOUT_HIGH_DUTY_MAX.
+ *           The module then continues with the next advertising mode as usual. Peers are targeted
+ *           by their identity address, so peers without one are skipped. Peers with an IRK must be
+ *           in the device identities list (see @ref pm_device_identities_list_set) for the
+ *           SoftDevice to target their private address, and they are skipped if their stored
+ *           Central Address Resolution value shows that they cannot resolve it. The sequence
+ *           requires the Peer Manager and high duty cycle directed advertising to be enabled.
  */
 
 #ifndef BLE_ADVERTISING_H__
 #define BLE_ADVERTISING_H__
 
 #include <stdint.h>
+#include "sdk_config.h"
 #include "nrf_error.h"
 #include "ble.h"
 #include "ble_gap.h"
@@ -139,6 +151,15 @@ typedef void (*ble_adv_evt_handler_t) (ble_adv_evt_t const adv_evt);
 /**@brief   BLE advertising error handler type. */
 typedef void (*ble_adv_error_handler_t) (uint32_t nrf_error);
 
+/**@brief   Handler type for choosing the connection settings of the next connection.
+ *
+ * @param[in] adv_mode    Advertising mode about to be started.
+ * @param[in] p_peer_addr Address of the peer for the directed modes, NULL for the undirected modes.
+ *
+ * @return Tag of the connection settings used if the advertising results in a connection (see @ref sd_ble_cfg_set).
+ */
+typedef uint8_t (*ble_adv_conn_cfg_tag_handler_t) (ble_adv_mode_t adv_mode, ble_gap_addr_t const * p_peer_addr);
+
 typedef struct
 {
     bool                    initialized;
@@ -146,6 +167,7 @@ typedef struct
     ble_adv_mode_t          adv_mode_current;                                 /**< Variable to keep track of the current advertising mode. */
     ble_adv_modes_config_t  adv_modes_config;                                 /**< Struct to keep track of disabled and enabled advertising modes, as well as time-outs and intervals.*/
     uint8_t                 conn_cfg_tag;                                     /**< Variable to keep track of what connection settings will be used if the advertising results in a connection. */
+    ble_adv_conn_cfg_tag_handler_t conn_cfg_tag_handler;                      /**< Handler choosing the connection settings each time advertising is started, or NULL to use conn_cfg_tag. */
 
     ble_adv_evt_t           adv_evt;                                          /**< Advertising event propogated to the main application. The event is either a transaction to a new advertising mode, or a request for whitelist or peer address. */
     ble_adv_evt_handler_t   evt_handler;                                      /**< Handler for the advertising events. Can be initialized as NULL if no handling is implemented on in the main application. */
@@ -171,6 +193,11 @@ typedef struct
     bool                    whitelist_temporarily_disabled;                   /**< Flag to keep track of temporary disabling of the whitelist. */
     bool                    whitelist_reply_expected;                         /**< Flag to verify that the whitelist is only set when requested. */
     bool                    whitelist_in_use;                                 /**< This module needs to be aware of whether or not a whitelist has been set (e.g. using the Peer Manager) in order to start advertising with the proper advertising params (filter policy). */
+#if BLE_ADVERTISING_RECONNECT_ENABLED
+    ble_gap_addr_t          reconnect_addrs[BLE_ADVERTISING_RECONNECT_PEERS]; /**< Addresses of the peers in the reconnection sequence, disconnected peer first. */
+    uint8_t                 reconnect_cnt;                                    /**< Number of peers in the reconnection sequence, 0 if no sequence is ongoing. */
+    uint8_t                 reconnect_idx;                                    /**< Index of the peer currently advertised to. */
+#endif
 } ble_advertising_t;
 
 typedef struct
@@ -238,6 +265,21 @@ uint32_t ble_advertising_init(ble_advertising_t            * const p_advertising
  */
 void ble_advertising_conn_cfg_tag_set(ble_advertising_t * const p_advertising, uint8_t ble_cfg_tag);
 
+
+/**@brief  Function for choosing the connection settings tag each time advertising is started.
+ *
+ * @details The handler is called whenever an advertising mode is started, and the tag it returns
+ *          is used instead of the one set by @ref ble_advertising_conn_cfg_tag_set. This allows
+ *          the directed modes, which reconnect a known peer, to use other connection settings than
+ *          the undirected modes.
+ *
+ * @param[in] p_advertising Advertising Module instance.
+ * @param[in] handler       Handler choosing the tag, or NULL to use the tag set by
+ *                          @ref ble_advertising_conn_cfg_tag_set.
+ */
+void ble_advertising_conn_cfg_tag_handler_set(ble_advertising_t            * const p_advertising,
+                                              ble_adv_conn_cfg_tag_handler_t       handler);
+
 /**@brief   Function for starting advertising.
  *
  * @details You can start advertising in any of the advertising modes that you enabled
@@ -44,6 +44,9 @@
 #include "ble_db_discovery.h"
 #include <stdlib.h>
 #include "ble_srv_common.h"
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+#include "peer_manager.h"
+#endif
 #define NRF_LOG_MODULE_NAME ble_db_disc
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
@@ -52,15 +55,63 @@ NRF_LOG_MODULE_REGISTER();
 #define DB_DISCOVERY_MAX_USERS BLE_DB_DISCOVERY_MAX_SRV  /**< The maximum number of users/registrations allowed by this module. */
 #define MODULE_INITIALIZED (m_initialized == true)       /**< Macro designating whether the module has been initialized properly. */
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+#define DB_HASH_CHAR_UUID      0x2B2A                    /**< The UUID of the Database Hash characteristic. */
+#define CACHE_LEN              (offsetof(ble_db_discovery_t, cache_info) + sizeof(ble_db_discovery_cache_info_t)) /**< Length of the cached database, the services followed by the cache information. */
+
+STATIC_ASSERT(BLE_DB_DISCOVERY_MAX_SRV <= 32);
+STATIC_ASSERT((CACHE_LEN % sizeof(uint32_t)) == 0);
+#endif
+
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+#error "BLE_DB_DISCOVERY_COMPACT_ENABLED cannot be used with BLE_DB_DISCOVERY_CACHE_ENABLED."
+#endif
+#if (BLE_DB_DISCOVERY_MAX_CONCURRENT == 0)
+#error "BLE_DB_DISCOVERY_COMPACT_ENABLED requires BLE_DB_DISCOVERY_MAX_CONCURRENT to be set."
+#endif
+
+/**@brief Storage used by a discovery while it is in progress. */
+typedef struct ble_db_discovery_work_s
+{
+    ble_gatt_db_srv_t           services[BLE_DB_DISCOVERY_MAX_SRV];         /**< Services, in the order of registration. */
+    ble_db_discovery_user_evt_t pending_usr_evts[BLE_DB_DISCOVERY_MAX_SRV]; /**< Events sent when all services have been discovered. */
+    ble_gatt_db_srv_t           range_prev_srv;                             /**< Service being rediscovered, as it was before. */
+    bool                        in_use;                                     /**< Variable to indicate whether a discovery uses this storage. */
+} ble_db_discovery_work_t;
+
+static ble_db_discovery_work_t m_work[BLE_DB_DISCOVERY_MAX_CONCURRENT]; /**< One storage for each discovery that may be in progress. */
+BLE_GATT_DB_ARENA_DEF(m_db_arena, BLE_DB_DISCOVERY_COMPACT_ARENA_SIZE);    /**< Services of the complete discoveries of all instances. */
+
+#define DB_SERVICES(_p)        ((_p)->p_work->services)
+#define DB_PENDING_EVTS(_p)    ((_p)->p_work->pending_usr_evts)
+#define DB_RANGE_PREV_SRV(_p)  ((_p)->p_work->range_prev_srv)
+#else
+#define DB_SERVICES(_p)        ((_p)->services)
+#define DB_PENDING_EVTS(_p)    ((_p)->pending_usr_evts)
+#define DB_RANGE_PREV_SRV(_p)  ((_p)->range_prev_srv)
+#endif // BLE_DB_DISCOVERY_COMPACT_ENABLED
+
 
 /**@brief Array of structures containing information about the registered application modules. */
 static ble_uuid_t                       m_registered_handlers[DB_DISCOVERY_MAX_USERS];
 static ble_db_discovery_evt_handler_t   m_evt_handler;
+#if BLE_DB_DISCOVERY_FILTER_ENABLED
+static ble_db_discovery_filter_t const * m_registered_filters[DB_DISCOVERY_MAX_USERS]; /**< Filters of the registered services, NULL for a whole service. */
+#endif
 static nrf_ble_gq_t                   * mp_gatt_queue; /**< Pointer to BLE GATT Queue instance. */
 
 static uint32_t m_num_of_handlers_reg;      /**< The number of handlers registered with the DB Discovery module. */
 static bool     m_initialized = false;      /**< This variable Indicates if the module is initialized or not. */
 
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+static uint32_t             m_discoveries_running; /**< The number of discoveries in progress, not counting the waiting ones. */
+static ble_db_discovery_t * mp_waiting_head;       /**< First discovery waiting for one in progress to finish. */
+
+static uint32_t discovery_start(ble_db_discovery_t * const p_db_discovery, uint16_t conn_handle);
+static uint32_t range_discovery_start(ble_db_discovery_t * const p_db_discovery);
+#endif
+
 /**@brief     Function for fetching the event handler provided by a registered application module.
  *
  * @param[in] srv_uuid UUID of the service.
@@ -116,10 +167,10 @@ static uint32_t registered_handler_set(ble_uuid_t                     const * p_
  */
 static void pending_user_evts_send(ble_db_discovery_t * p_db_discovery)
 {
-    for (uint32_t i = 0; i < m_num_of_handlers_reg; i++)
+    for (uint32_t i = 0; i < p_db_discovery->pending_usr_evt_index; i++)
     {
         // Pass the event to the corresponding event handler.
-        p_db_discovery->pending_usr_evts[i].evt_handler(&(p_db_discovery->pending_usr_evts[i].evt));
+        DB_PENDING_EVTS(p_db_discovery)[i].evt_handler(&(DB_PENDING_EVTS(p_db_discovery)[i].evt));
     }
 
     p_db_discovery->pending_usr_evt_index = 0;
@@ -168,12 +219,10 @@ static void discovery_error_evt_trigger(ble_db_discovery_t * p_db_discovery,
                                         uint32_t             err_code,
                                         uint16_t             conn_handle)
 {
-    ble_db_discovery_evt_handler_t   p_evt_handler;
-    ble_gatt_db_srv_t              * p_srv_being_discovered;
+    ble_db_discovery_evt_handler_t p_evt_handler;
 
-    p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
-
-    p_evt_handler = registered_handler_get(&(p_srv_being_discovered->srv_uuid));
+    // The service being discovered has the UUID of the registration at the same index.
+    p_evt_handler = registered_handler_get(&(m_registered_handlers[p_db_discovery->curr_srv_ind]));
 
     if (p_evt_handler != NULL)
     {
@@ -189,6 +238,137 @@ static void discovery_error_evt_trigger(ble_db_discovery_t * p_db_discovery,
 }
 
 
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+/**@brief     Function for starting the waiting discoveries, as long as the limit allows.
+ *
+ * @details   A discovery that cannot be started is reported to the application with an error
+ *            event followed by an available event, same as an error during the discovery.
+ */
+static void waiting_discoveries_start(void)
+{
+    while ((m_discoveries_running < BLE_DB_DISCOVERY_MAX_CONCURRENT) && (mp_waiting_head != NULL))
+    {
+        ret_code_t           err_code;
+        ble_db_discovery_t * p_db_discovery = mp_waiting_head;
+        uint16_t             conn_handle    = p_db_discovery->conn_handle;
+
+        mp_waiting_head = p_db_discovery->p_next_waiting;
+
+        if (p_db_discovery->range_discovery)
+        {
+            err_code = range_discovery_start(p_db_discovery);
+        }
+        else
+        {
+            err_code = discovery_start(p_db_discovery, conn_handle);
+        }
+        if (err_code != NRF_SUCCESS)
+        {
+            // The error event is sent to the user of the first service.
+            p_db_discovery->conn_handle  = conn_handle;
+            p_db_discovery->curr_srv_ind = 0;
+
+            discovery_error_evt_trigger(p_db_discovery, err_code, conn_handle);
+            discovery_available_evt_trigger(p_db_discovery, conn_handle);
+        }
+    }
+}
+#endif // BLE_DB_DISCOVERY_MAX_CONCURRENT
+
+
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+/**@brief     Function for taking a free storage for a discovery that is started.
+ *
+ * @details   As many storages as discoveries may be in progress are defined, so one is free.
+ *            When rediscovering, the services of the last complete discovery are unpacked into it.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ */
+static void work_acquire(ble_db_discovery_t * p_db_discovery)
+{
+    ble_db_discovery_work_t * p_work = NULL;
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(m_work); i++)
+    {
+        if (!m_work[i].in_use)
+        {
+            p_work = &m_work[i];
+            break;
+        }
+    }
+    ASSERT(p_work != NULL);
+
+    memset(p_work, 0x00, sizeof(ble_db_discovery_work_t));
+    p_work->in_use         = true;
+    p_db_discovery->p_work = p_work;
+
+    for (uint32_t i = 0; i < p_db_discovery->compact_db.srv_count; i++)
+    {
+        UNUSED_RETURN_VALUE(ble_gatt_db_compact_srv_get(&p_db_discovery->compact_db,
+                                                        i,
+                                                        &p_work->services[i]));
+    }
+}
+
+
+/**@brief     Function for giving back the storage of a discovery.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ */
+static void work_release(ble_db_discovery_t * p_db_discovery)
+{
+    if (p_db_discovery->p_work != NULL)
+    {
+        p_db_discovery->p_work->in_use = false;
+        p_db_discovery->p_work         = NULL;
+    }
+}
+#endif // BLE_DB_DISCOVERY_COMPACT_ENABLED
+
+
+/**@brief     Function for ending a discovery, whether it finished, failed or was dropped.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ */
+static void discovery_end(ble_db_discovery_t * p_db_discovery)
+{
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+    if (!p_db_discovery->discovery_in_progress)
+    {
+        return;
+    }
+
+    if (p_db_discovery->discovery_waiting)
+    {
+        ble_db_discovery_t ** pp_waiting = &mp_waiting_head;
+
+        while (*pp_waiting != p_db_discovery)
+        {
+            pp_waiting = &(*pp_waiting)->p_next_waiting;
+        }
+
+        *pp_waiting                       = p_db_discovery->p_next_waiting;
+        p_db_discovery->discovery_waiting = false;
+    }
+    else
+    {
+        m_discoveries_running--;
+    }
+
+    p_db_discovery->discovery_in_progress = false;
+
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    // The storage is free for a waiting discovery.
+    work_release(p_db_discovery);
+#endif
+
+    waiting_discoveries_start();
+#else
+    p_db_discovery->discovery_in_progress = false;
+#endif // BLE_DB_DISCOVERY_MAX_CONCURRENT
+}
+
+
 /**@brief Function for interception of GATTC and @ref nrf_ble_gq errors.
  *
  * @param[in] nrf_error   Error code.
@@ -200,7 +380,7 @@ static void discovery_error_handler(uint32_t   nrf_error,
                                     uint16_t   conn_handle)
 {
     ble_db_discovery_t * p_db_discovery = (ble_db_discovery_t *)p_ctx;
-    p_db_discovery->discovery_in_progress = false;
+    discovery_end(p_db_discovery);
 
     discovery_error_evt_trigger(p_db_discovery, nrf_error, conn_handle);
     discovery_available_evt_trigger(p_db_discovery, conn_handle);
@@ -208,6 +388,31 @@ static void discovery_error_handler(uint32_t   nrf_error,
 
 
 
+/**@brief     Function for checking whether the service being rediscovered has changed.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ *
+ * @retval    true  If the service was found or lost, or any of its handles changed.
+ * @retval    false If the users of the service can keep their handles.
+ */
+static bool range_srv_changed(ble_db_discovery_t const * p_db_discovery)
+{
+    ble_gatt_db_srv_t const * p_prev = &(DB_RANGE_PREV_SRV(p_db_discovery));
+    ble_gatt_db_srv_t const * p_srv  = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
+
+    if (   (p_prev->handle_range.start_handle != p_srv->handle_range.start_handle)
+        || (p_prev->handle_range.end_handle   != p_srv->handle_range.end_handle)
+        || (p_prev->char_count                != p_srv->char_count))
+    {
+        return true;
+    }
+
+    return (memcmp(p_prev->charateristics,
+                   p_srv->charateristics,
+                   p_srv->char_count * sizeof(ble_gatt_db_char_t)) != 0);
+}
+
+
 /**@brief     Function for triggering a Discovery Complete or Service Not Found event to the
  *            application.
  *
@@ -227,7 +432,13 @@ static void discovery_complete_evt_trigger(ble_db_discovery_t * p_db_discovery,
     ble_db_discovery_evt_handler_t   p_evt_handler;
     ble_gatt_db_srv_t              * p_srv_being_discovered;
 
-    p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
+    if (p_db_discovery->range_discovery && !range_srv_changed(p_db_discovery))
+    {
+        // The users of an unchanged service keep their handles.
+        return;
+    }
+
+    p_srv_being_discovered = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
 
     p_evt_handler = registered_handler_get(&(p_srv_being_discovered->srv_uuid));
 
@@ -236,22 +447,28 @@ static void discovery_complete_evt_trigger(ble_db_discovery_t * p_db_discovery,
         if (p_db_discovery->pending_usr_evt_index < DB_DISCOVERY_MAX_USERS)
         {
             // Insert an event into the pending event list.
-            p_db_discovery->pending_usr_evts[p_db_discovery->pending_usr_evt_index].evt.conn_handle = conn_handle;
-            p_db_discovery->pending_usr_evts[p_db_discovery->pending_usr_evt_index].evt.params.discovered_db =
+            DB_PENDING_EVTS(p_db_discovery)[p_db_discovery->pending_usr_evt_index].evt.conn_handle = conn_handle;
+            DB_PENDING_EVTS(p_db_discovery)[p_db_discovery->pending_usr_evt_index].evt.params.discovered_db =
                 *p_srv_being_discovered;
 
             if (is_srv_found)
             {
-                p_db_discovery->pending_usr_evts[p_db_discovery->pending_usr_evt_index].evt.evt_type =
+                DB_PENDING_EVTS(p_db_discovery)[p_db_discovery->pending_usr_evt_index].evt.evt_type =
                     BLE_DB_DISCOVERY_COMPLETE;
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+                p_db_discovery->cache_info.found_mask |= (1UL << p_db_discovery->curr_srv_ind);
+#endif
             }
             else
             {
-                p_db_discovery->pending_usr_evts[p_db_discovery->pending_usr_evt_index].evt.evt_type =
+                DB_PENDING_EVTS(p_db_discovery)[p_db_discovery->pending_usr_evt_index].evt.evt_type =
                     BLE_DB_DISCOVERY_SRV_NOT_FOUND;
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+                p_db_discovery->cache_info.found_mask &= ~(1UL << p_db_discovery->curr_srv_ind);
+#endif
             }
 
-            p_db_discovery->pending_usr_evts[p_db_discovery->pending_usr_evt_index].evt_handler = p_evt_handler;
+            DB_PENDING_EVTS(p_db_discovery)[p_db_discovery->pending_usr_evt_index].evt_handler = p_evt_handler;
             p_db_discovery->pending_usr_evt_index++;
 
             if (p_db_discovery->pending_usr_evt_index == m_num_of_handlers_reg)
@@ -269,54 +486,260 @@ static void discovery_complete_evt_trigger(ble_db_discovery_t * p_db_discovery,
 }
 
 
-/**@brief     Function for handling service discovery completion.
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+/**@brief     Function for storing the discovered database of a bonded peer.
  *
- * @details   This function will be used to determine if there are more services to be discovered,
- *            and if so, initiate the discovery of the next service.
+ * @details   The services and the cache information are stored as one record, straight from the
+ *            DB discovery structure, which must not be reused until the Peer Manager has written it.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ */
+static void cache_store(ble_db_discovery_t * p_db_discovery)
+{
+    ret_code_t                      err_code;
+    ble_db_discovery_cache_info_t * p_info = &p_db_discovery->cache_info;
+
+    if (p_db_discovery->cache_peer_id == PM_PEER_ID_INVALID)
+    {
+        return;
+    }
+
+    p_info->srv_count     = (uint8_t)m_num_of_handlers_reg;
+    p_info->db_hash_valid = p_db_discovery->peer_db_hash_valid;
+    memcpy(p_info->db_hash, p_db_discovery->peer_db_hash, BLE_DB_DISCOVERY_DB_HASH_LEN);
+
+    err_code = pm_peer_data_store(p_db_discovery->cache_peer_id,
+                                  PM_PEER_DATA_ID_GATT_REMOTE,
+                                  DB_SERVICES(p_db_discovery),
+                                  CACHE_LEN,
+                                  NULL);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_WARNING("Database of peer %d not cached, error 0x%x.",
+                        p_db_discovery->cache_peer_id, err_code);
+    }
+}
+
+
+/**@brief     Function for loading the cached database of the peer.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ *
+ * @retval    true  If the cached database matches the registrations and the Database Hash read
+ *                  from the peer.
+ * @retval    false If the database must be discovered.
+ */
+static bool cache_load(ble_db_discovery_t * p_db_discovery)
+{
+    ret_code_t                            err_code;
+    uint32_t                              len    = CACHE_LEN;
+    ble_db_discovery_cache_info_t const * p_info = &p_db_discovery->cache_info;
+
+    err_code = pm_peer_data_load(p_db_discovery->cache_peer_id,
+                                 PM_PEER_DATA_ID_GATT_REMOTE,
+                                 DB_SERVICES(p_db_discovery),
+                                 &len);
+    if ((err_code != NRF_SUCCESS) || (len != CACHE_LEN))
+    {
+        return false;
+    }
+
+    if (p_info->srv_count != m_num_of_handlers_reg)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < m_num_of_handlers_reg; i++)
+    {
+        if (!BLE_UUID_EQ(&(DB_SERVICES(p_db_discovery)[i].srv_uuid), &(m_registered_handlers[i])))
+        {
+            return false;
+        }
+    }
+
+    if (p_info->db_hash_valid != p_db_discovery->peer_db_hash_valid)
+    {
+        return false;
+    }
+
+    return (!p_info->db_hash_valid ||
+            (memcmp(p_info->db_hash, p_db_discovery->peer_db_hash, BLE_DB_DISCOVERY_DB_HASH_LEN) == 0));
+}
+
+
+/**@brief     Function for sending the discovery events of the cached database.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ */
+static void cache_replay(ble_db_discovery_t * p_db_discovery, uint16_t conn_handle)
+{
+    NRF_LOG_DEBUG("Using the cached database of peer %d on connection handle 0x%x.",
+                  p_db_discovery->cache_peer_id, conn_handle);
+
+    for (uint32_t i = 0; i < m_num_of_handlers_reg; i++)
+    {
+        p_db_discovery->curr_srv_ind = i;
+        discovery_complete_evt_trigger(p_db_discovery,
+                                       (p_db_discovery->cache_info.found_mask & (1UL << i)) != 0,
+                                       conn_handle);
+    }
+
+    p_db_discovery->db_complete = true;
+
+    discovery_end(p_db_discovery);
+
+    discovery_available_evt_trigger(p_db_discovery, conn_handle);
+}
+#endif // BLE_DB_DISCOVERY_CACHE_ENABLED
+
+
+/**@brief     Function for getting the next service to be discovered.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery Structure.
+ * @param[in] srv_ind        Index of the first service that may be discovered.
+ *
+ * @return    Index of the next service to be discovered, or the number of registered services
+ *            if there is none.
+ */
+static uint32_t srv_ind_next(ble_db_discovery_t const * p_db_discovery, uint32_t srv_ind)
+{
+    if (p_db_discovery->range_discovery)
+    {
+        while ((srv_ind < m_num_of_handlers_reg) &&
+               ((p_db_discovery->range_srv_mask & (1UL << srv_ind)) == 0))
+        {
+            srv_ind++;
+        }
+    }
+
+    return srv_ind;
+}
+
+
+/**@brief     Function for starting the discovery of the service at the current index.
+ *
+ * @details   When rediscovering, the service is kept in @ref ble_db_discovery_t::range_prev_srv
+ *            and discovered in a cleared entry, as done by a full discovery.
  *
  * @param[in] p_db_discovery Pointer to the DB Discovery Structure.
  * @param[in] conn_handle    Connection Handle.
+ *
+ * @return    This function propagates the error code returned by @ref nrf_ble_gq_item_add.
  */
-static void on_srv_disc_completion(ble_db_discovery_t * p_db_discovery,
-                                   uint16_t             conn_handle)
+static uint32_t curr_srv_discovery_start(ble_db_discovery_t * const p_db_discovery,
+                                         uint16_t                   conn_handle)
 {
-    nrf_ble_gq_req_t db_srv_disc_req;
+    ble_gatt_db_srv_t * p_srv_being_discovered;
+    nrf_ble_gq_req_t    db_srv_disc_req;
 
-    memset(&db_srv_disc_req, 0, sizeof(nrf_ble_gq_req_t));
+    memset(&db_srv_disc_req, 0x00, sizeof(nrf_ble_gq_req_t));
 
-    p_db_discovery->discoveries_count++;
+    p_srv_being_discovered = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
 
-    // Check if more services need to be discovered.
-    if (p_db_discovery->discoveries_count < m_num_of_handlers_reg)
+    if (p_db_discovery->range_discovery)
     {
-        // Reset the current characteristic index since a new service discovery is about to start.
-        p_db_discovery->curr_char_ind = 0;
+        DB_RANGE_PREV_SRV(p_db_discovery) = *p_srv_being_discovered;
 
-        // Initiate discovery of the next service.
-        p_db_discovery->curr_srv_ind++;
+        if ((p_srv_being_discovered->handle_range.start_handle != BLE_GATT_HANDLE_INVALID) &&
+            (p_db_discovery->srv_count > 0))
+        {
+            p_db_discovery->srv_count--;
+        }
 
-        ble_gatt_db_srv_t * p_srv_being_discovered;
+        memset(p_srv_being_discovered, 0x00, sizeof(ble_gatt_db_srv_t));
+    }
 
-        p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
+    // Reset the current characteristic index since a new service discovery is about to start.
+    p_db_discovery->curr_char_ind = 0;
 
-        p_srv_being_discovered->srv_uuid = m_registered_handlers[p_db_discovery->curr_srv_ind];
+    p_srv_being_discovered->srv_uuid = m_registered_handlers[p_db_discovery->curr_srv_ind];
+
+    // Reset the characteristic count in the current service to zero since a new service
+    // discovery is about to start.
+    p_srv_being_discovered->char_count = 0;
 
-        // Reset the characteristic count in the current service to zero since a new service
-        // discovery is about to start.
-        p_srv_being_discovered->char_count = 0;
+    NRF_LOG_DEBUG("Starting discovery of service with UUID 0x%x on connection handle 0x%x.",
+                  p_srv_being_discovered->srv_uuid.uuid, conn_handle);
+
+    db_srv_disc_req.type                               = NRF_BLE_GQ_REQ_SRV_DISCOVERY;
+    db_srv_disc_req.params.gattc_srv_disc.start_handle = SRV_DISC_START_HANDLE;
+    db_srv_disc_req.params.gattc_srv_disc.srvc_uuid    = p_srv_being_discovered->srv_uuid;
+    db_srv_disc_req.error_handler.p_ctx                = p_db_discovery;
+    db_srv_disc_req.error_handler.cb                   = discovery_error_handler;
+
+    return nrf_ble_gq_item_add(mp_gatt_queue, &db_srv_disc_req, conn_handle);
+}
+
+
+/**@brief     Function for handling the end of a discovery in which all services were discovered.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery Structure.
+ * @param[in] conn_handle    Connection Handle.
+ */
+static void all_srv_disc_completion(ble_db_discovery_t * p_db_discovery,
+                                    uint16_t             conn_handle)
+{
+    if (p_db_discovery->range_discovery)
+    {
+        // Only the changed services have pending events, so they are sent now.
+        pending_user_evts_send(p_db_discovery);
+    }
 
-        NRF_LOG_DEBUG("Starting discovery of service with UUID 0x%x on connection handle 0x%x.",
-                      p_srv_being_discovered->srv_uuid.uuid, conn_handle);
+    p_db_discovery->db_complete = true;
 
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    ret_code_t err_code = ble_gatt_db_compact_store(&m_db_arena,
+                                                    &p_db_discovery->compact_db,
+                                                    DB_SERVICES(p_db_discovery),
+                                                    m_num_of_handlers_reg);
+    if (err_code != NRF_SUCCESS)
+    {
+        // The events were sent, but the next rediscovery on the connection is a full one.
+        NRF_LOG_WARNING("Services of connection handle 0x%x not kept, error 0x%x.",
+                        conn_handle, err_code);
+        NRF_LOG_WARNING("Increase BLE_DB_DISCOVERY_COMPACT_ARENA_SIZE to keep them.");
+        ble_gatt_db_compact_free(&p_db_discovery->compact_db);
+        p_db_discovery->db_complete = false;
+    }
+#endif
+
+    discovery_end(p_db_discovery);
+
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+    cache_store(p_db_discovery);
+#endif
+
+    discovery_available_evt_trigger(p_db_discovery, conn_handle);
+}
+
+
+/**@brief     Function for handling service discovery completion.
+ *
+ * @details   This function will be used to determine if there are more services to be discovered,
+ *            and if so, initiate the discovery of the next service.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery Structure.
+ * @param[in] conn_handle    Connection Handle.
+ */
+static void on_srv_disc_completion(ble_db_discovery_t * p_db_discovery,
+                                   uint16_t             conn_handle)
+{
+    uint32_t next_srv_ind;
+
+    p_db_discovery->discoveries_count++;
+
+    next_srv_ind = srv_ind_next(p_db_discovery, p_db_discovery->curr_srv_ind + 1);
+
+    // Check if more services need to be discovered.
+    if (next_srv_ind < m_num_of_handlers_reg)
+    {
         uint32_t err_code;
 
-        db_srv_disc_req.type                               = NRF_BLE_GQ_REQ_SRV_DISCOVERY;
-        db_srv_disc_req.params.gattc_srv_disc.start_handle = SRV_DISC_START_HANDLE;
-        db_srv_disc_req.params.gattc_srv_disc.srvc_uuid    = p_srv_being_discovered->srv_uuid;
-        db_srv_disc_req.error_handler.p_ctx                = p_db_discovery;
-        db_srv_disc_req.error_handler.cb                   = discovery_error_handler;
+        // Initiate discovery of the next service.
+        p_db_discovery->curr_srv_ind = (uint8_t)next_srv_ind;
 
-        err_code = nrf_ble_gq_item_add(mp_gatt_queue, &db_srv_disc_req, conn_handle);
+        err_code = curr_srv_discovery_start(p_db_discovery, conn_handle);
 
         if (err_code != NRF_SUCCESS)
         {
@@ -328,11 +751,84 @@ static void on_srv_disc_completion(ble_db_discovery_t * p_db_discovery,
     else
     {
         // No more service discovery is needed.
-        p_db_discovery->discovery_in_progress  = false;
+        all_srv_disc_completion(p_db_discovery, conn_handle);
+    }
+}
+
+
+#if BLE_DB_DISCOVERY_FILTER_ENABLED
+/**@brief     Function for finding a characteristic in the filter of the service being discovered.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in] p_char_uuid    UUID of the characteristic.
+ *
+ * @return    Pointer to the filter entry of the characteristic, or NULL if it is not listed.
+ */
+static ble_db_discovery_char_filter_t const * char_filter_get(ble_db_discovery_t const * p_db_discovery,
+                                                              ble_uuid_t         const * p_char_uuid)
+{
+    ble_db_discovery_filter_t const * p_filter = m_registered_filters[p_db_discovery->curr_srv_ind];
+
+    for (uint32_t i = 0; i < p_filter->char_cnt; i++)
+    {
+        if (BLE_UUID_EQ(&(p_filter->p_chars[i].uuid), p_char_uuid))
+        {
+            return &(p_filter->p_chars[i]);
+        }
+    }
+
+    return NULL;
+}
+
+
+/**@brief     Function for finding out if the filter of the service being discovered still needs
+ *            characteristics to be discovered.
+ *
+ * @details   All the listed characteristics must be found. If the last known characteristic is one
+ *            of them and its descriptors are needed, the next one must be found too, as it bounds
+ *            the descriptors.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ *
+ * @retval    True if characteristics are still needed, or if the service is not filtered.
+ * @retval    False if the characteristics found so far are enough.
+ */
+static bool filter_chars_needed(ble_db_discovery_t const * p_db_discovery)
+{
+    ble_db_discovery_filter_t      const * p_filter = m_registered_filters[p_db_discovery->curr_srv_ind];
+    ble_gatt_db_srv_t              const * p_srv    = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
+    ble_db_discovery_char_filter_t const * p_last;
+
+    if (p_filter == NULL)
+    {
+        return true;
+    }
+
+    for (uint32_t i = 0; i < p_filter->char_cnt; i++)
+    {
+        uint32_t j;
+
+        for (j = 0; j < p_srv->char_count; j++)
+        {
+            if (BLE_UUID_EQ(&(p_srv->charateristics[j].characteristic.uuid),
+                            &(p_filter->p_chars[i].uuid)))
+            {
+                break;
+            }
+        }
+
+        if (j == p_srv->char_count)
+        {
+            return true;
+        }
+    }
+
+    p_last = char_filter_get(p_db_discovery,
+                             &(p_srv->charateristics[p_srv->char_count - 1].characteristic.uuid));
 
-        discovery_available_evt_trigger(p_db_discovery, conn_handle);
-    }
+    return ((p_last != NULL) && (p_last->desc_mask != 0));
 }
+#endif // BLE_DB_DISCOVERY_FILTER_ENABLED
 
 
 /**@brief     Function for finding out if a characteristic discovery should be performed after the
@@ -353,8 +849,16 @@ static void on_srv_disc_completion(ble_db_discovery_t * p_db_discovery,
 static bool is_char_discovery_reqd(ble_db_discovery_t * p_db_discovery,
                                    ble_gattc_char_t   * p_after_char)
 {
+#if BLE_DB_DISCOVERY_FILTER_ENABLED
+    if (!filter_chars_needed(p_db_discovery))
+    {
+        // All the characteristics needed by the user are found.
+        return false;
+    }
+#endif
+
     if (p_after_char->handle_value <
-        p_db_discovery->services[p_db_discovery->curr_srv_ind].handle_range.end_handle)
+        DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind].handle_range.end_handle)
     {
         // Handle value of the characteristic being discovered is less than the end handle of
         // the service being discovered. There is a possibility of more characteristics being
@@ -391,13 +895,27 @@ static bool is_desc_discovery_reqd(ble_db_discovery_t       * p_db_discovery,
                                    ble_gatt_db_char_t       * p_next_char,
                                    ble_gattc_handle_range_t * p_handle_range)
 {
+#if BLE_DB_DISCOVERY_FILTER_ENABLED
+    if (m_registered_filters[p_db_discovery->curr_srv_ind] != NULL)
+    {
+        ble_db_discovery_char_filter_t const * p_char_filter =
+            char_filter_get(p_db_discovery, &(p_curr_char->characteristic.uuid));
+
+        if ((p_char_filter == NULL) || (p_char_filter->desc_mask == 0))
+        {
+            // The user does not need the descriptors of this characteristic.
+            return false;
+        }
+    }
+#endif
+
     if (p_next_char == NULL)
     {
         // Current characteristic is the last characteristic in the service. Check if the value
         // handle of the current characteristic is equal to the service end handle.
         if (
             p_curr_char->characteristic.handle_value ==
-            p_db_discovery->services[p_db_discovery->curr_srv_ind].handle_range.end_handle
+            DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind].handle_range.end_handle
            )
         {
             // No descriptors can be present for the current characteristic. p_curr_char is the last
@@ -410,7 +928,7 @@ static bool is_desc_discovery_reqd(ble_db_discovery_t       * p_db_discovery,
         // Since the current characteristic is the last characteristic in the service, the end
         // handle should be the end handle of the service.
         p_handle_range->end_handle =
-            p_db_discovery->services[p_db_discovery->curr_srv_ind].handle_range.end_handle;
+            DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind].handle_range.end_handle;
 
         return true;
     }
@@ -449,7 +967,7 @@ static uint32_t characteristics_discover(ble_db_discovery_t * p_db_discovery,
     memset(&db_char_disc_req, 0, sizeof(nrf_ble_gq_req_t));
     memset(&handle_range, 0, sizeof(ble_gattc_handle_range_t));
 
-    p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
+    p_srv_being_discovered = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
 
     if (p_db_discovery->curr_char_ind != 0)
     {
@@ -458,7 +976,7 @@ static uint32_t characteristics_discover(ble_db_discovery_t * p_db_discovery,
         ble_gattc_char_t * p_prev_char;
         uint8_t            prev_char_ind = p_db_discovery->curr_char_ind - 1;
 
-        p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
+        p_srv_being_discovered = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
 
         p_prev_char = &(p_srv_being_discovered->charateristics[prev_char_ind].characteristic);
 
@@ -511,7 +1029,7 @@ static uint32_t descriptors_discover(ble_db_discovery_t * p_db_discovery,
 
     memset(&db_desc_disc_req, 0, sizeof(nrf_ble_gq_req_t));
 
-    p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
+    p_srv_being_discovered = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
 
     p_curr_char_being_discovered =
         &(p_srv_being_discovered->charateristics[p_db_discovery->curr_char_ind]);
@@ -592,7 +1110,7 @@ static void on_primary_srv_discovery_rsp(ble_db_discovery_t       * p_db_discove
 {
     ble_gatt_db_srv_t * p_srv_being_discovered;
 
-    p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
+    p_srv_being_discovered = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
 
     if (p_ble_gattc_evt->conn_handle != p_db_discovery->conn_handle)
     {
@@ -663,7 +1181,7 @@ static void on_characteristic_discovery_rsp(ble_db_discovery_t       * p_db_disc
         return;
     }
 
-    p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
+    p_srv_being_discovered = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
 
     if (p_ble_gattc_evt->gatt_status == BLE_GATT_STATUS_SUCCESS)
     {
@@ -792,7 +1310,7 @@ static void on_descriptor_discovery_rsp(ble_db_discovery_t * const    p_db_disco
         return;
     }
 
-    p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
+    p_srv_being_discovered = &(DB_SERVICES(p_db_discovery)[p_db_discovery->curr_srv_ind]);
 
     p_desc_disc_rsp_evt = &(p_ble_gattc_evt->params.desc_disc_rsp);
 
@@ -893,6 +1411,10 @@ uint32_t ble_db_discovery_init(ble_db_discovery_init_t * p_db_init)
     m_evt_handler           = p_db_init->evt_handler;
     mp_gatt_queue           = p_db_init->p_gatt_queue;
 
+#if BLE_DB_DISCOVERY_FILTER_ENABLED
+    memset(m_registered_filters, 0x00, sizeof(m_registered_filters));
+#endif
+
 
     return err_code;
 }
@@ -904,6 +1426,16 @@ uint32_t ble_db_discovery_close(ble_db_discovery_t * const p_db_discovery)
     m_initialized                         = false;
     p_db_discovery->pending_usr_evt_index = 0;
 
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+    m_discoveries_running = 0;
+    mp_waiting_head       = NULL;
+#endif
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    p_db_discovery->p_work = NULL;
+    memset(m_work, 0x00, sizeof(m_work));
+    ble_gatt_db_compact_free(&p_db_discovery->compact_db);
+#endif
+
     return NRF_SUCCESS;
 }
 
@@ -917,49 +1449,317 @@ uint32_t ble_db_discovery_evt_register(ble_uuid_t const * p_uuid)
 }
 
 
-static uint32_t discovery_start(ble_db_discovery_t * const p_db_discovery, uint16_t conn_handle)
+#if BLE_DB_DISCOVERY_FILTER_ENABLED
+uint32_t ble_db_discovery_evt_register_filtered(ble_uuid_t                const * p_uuid,
+                                                ble_db_discovery_filter_t const * p_filter)
 {
-    ret_code_t          err_code;
-    ble_gatt_db_srv_t * p_srv_being_discovered;
-    nrf_ble_gq_req_t    db_srv_disc_req;
+    uint32_t err_code;
 
-    memset(p_db_discovery, 0x00, sizeof(ble_db_discovery_t));
-    memset(&db_srv_disc_req, 0x00, sizeof(nrf_ble_gq_req_t));
+    VERIFY_PARAM_NOT_NULL(p_uuid);
+    VERIFY_MODULE_INITIALIZED();
 
-    err_code = nrf_ble_gq_conn_handle_register(mp_gatt_queue, conn_handle);
+    err_code = registered_handler_set(p_uuid, m_evt_handler);
     VERIFY_SUCCESS(err_code);
 
-    p_db_discovery->conn_handle = conn_handle;
+    for (uint32_t i = 0; i < m_num_of_handlers_reg; i++)
+    {
+        if (BLE_UUID_EQ(&(m_registered_handlers[i]), p_uuid))
+        {
+            m_registered_filters[i] = p_filter;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
+#endif // BLE_DB_DISCOVERY_FILTER_ENABLED
+
+
+/**@brief     Function for starting the discovery of the first registered service.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ *
+ * @return    This function propagates the error code returned by @ref nrf_ble_gq_item_add.
+ */
+static uint32_t srv_discovery_start(ble_db_discovery_t * const p_db_discovery, uint16_t conn_handle)
+{
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+    // A cached database that did not match may have been loaded.
+    memset(DB_SERVICES(p_db_discovery), 0x00, sizeof(DB_SERVICES(p_db_discovery)));
+    memset(&p_db_discovery->cache_info, 0x00, sizeof(p_db_discovery->cache_info));
+#endif
 
     p_db_discovery->pending_usr_evt_index = 0;
 
     p_db_discovery->discoveries_count = 0;
     p_db_discovery->curr_srv_ind      = 0;
-    p_db_discovery->curr_char_ind     = 0;
 
-    p_srv_being_discovered = &(p_db_discovery->services[p_db_discovery->curr_srv_ind]);
-    p_srv_being_discovered->srv_uuid = m_registered_handlers[p_db_discovery->curr_srv_ind];
+    return curr_srv_discovery_start(p_db_discovery, conn_handle);
+}
 
-    NRF_LOG_DEBUG("Starting discovery of service with UUID 0x%x on connection handle 0x%x.",
-                  p_srv_being_discovered->srv_uuid.uuid, conn_handle);
 
-    db_srv_disc_req.type                               = NRF_BLE_GQ_REQ_SRV_DISCOVERY;
-    db_srv_disc_req.params.gattc_srv_disc.start_handle = SRV_DISC_START_HANDLE;
-    db_srv_disc_req.params.gattc_srv_disc.srvc_uuid    = p_srv_being_discovered->srv_uuid;
-    db_srv_disc_req.error_handler.p_ctx                = p_db_discovery;
-    db_srv_disc_req.error_handler.cb                   = discovery_error_handler;
+/**@brief     Function for starting the discovery of the first service affected by a change.
+ *
+ * @details   If no registered service is affected, the discovery ends right away.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ *
+ * @return    This function propagates the error code returned by @ref nrf_ble_gq_item_add.
+ */
+static uint32_t range_srv_discovery_start(ble_db_discovery_t * const p_db_discovery,
+                                          uint16_t                   conn_handle)
+{
+    uint32_t srv_ind = srv_ind_next(p_db_discovery, 0);
+
+    if (srv_ind >= m_num_of_handlers_reg)
+    {
+        all_srv_disc_completion(p_db_discovery, conn_handle);
+        return NRF_SUCCESS;
+    }
+
+    p_db_discovery->curr_srv_ind = (uint8_t)srv_ind;
+
+    return curr_srv_discovery_start(p_db_discovery, conn_handle);
+}
+
+
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+/**@brief     Function for starting to read the Database Hash of the peer.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ *
+ * @retval    true  If the read was started.
+ * @retval    false If the read could not be started.
+ */
+static bool db_hash_read_start(ble_db_discovery_t * const p_db_discovery, uint16_t conn_handle)
+{
+    ret_code_t                     err_code;
+    ble_uuid_t                     db_hash_uuid = {.uuid = DB_HASH_CHAR_UUID, .type = BLE_UUID_TYPE_BLE};
+    ble_gattc_handle_range_t const handle_range = {SRV_DISC_START_HANDLE, 0xFFFF};
+
+    err_code = sd_ble_gattc_char_value_by_uuid_read(conn_handle, &db_hash_uuid, &handle_range);
+    if (err_code != NRF_SUCCESS)
+    {
+        // The database is discovered and cached without a Database Hash, so the cache is not
+        // used next time if the peer has one.
+        NRF_LOG_DEBUG("Database Hash not read, error 0x%x.", err_code);
+        return false;
+    }
+
+    p_db_discovery->cache_hash_read = true;
+
+    return true;
+}
+
+
+/**@brief     Function for starting to read the Database Hash of a bonded peer.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ *
+ * @retval    true  If the read was started. The discovery continues when the response arrives.
+ * @retval    false If the peer is not bonded or the read could not be started.
+ */
+static bool cache_hash_read_start(ble_db_discovery_t * const p_db_discovery, uint16_t conn_handle)
+{
+    ret_code_t err_code;
+
+    p_db_discovery->cache_peer_id = PM_PEER_ID_INVALID;
+
+    err_code = pm_peer_id_get(conn_handle, &p_db_discovery->cache_peer_id);
+    if ((err_code != NRF_SUCCESS) || (p_db_discovery->cache_peer_id == PM_PEER_ID_INVALID))
+    {
+        p_db_discovery->cache_peer_id = PM_PEER_ID_INVALID;
+        return false;
+    }
+
+    return db_hash_read_start(p_db_discovery, conn_handle);
+}
+
+
+/**@brief     Function for handling the response to the Database Hash read.
+ *
+ * @param[in] p_db_discovery  Pointer to the DB Discovery structure.
+ * @param[in] p_ble_gattc_evt Pointer to the GATT Client event.
+ */
+static void on_db_hash_read_rsp(ble_db_discovery_t * const    p_db_discovery,
+                                ble_gattc_evt_t const * const p_ble_gattc_evt)
+{
+    ret_code_t                                        err_code;
+    uint16_t                                          conn_handle = p_ble_gattc_evt->conn_handle;
+    ble_gattc_evt_char_val_by_uuid_read_rsp_t const * p_rsp       =
+        &p_ble_gattc_evt->params.char_val_by_uuid_read_rsp;
+
+    if (!p_db_discovery->cache_hash_read || (conn_handle != p_db_discovery->conn_handle))
+    {
+        return;
+    }
+
+    p_db_discovery->cache_hash_read = false;
+
+    if ((p_ble_gattc_evt->gatt_status == BLE_GATT_STATUS_SUCCESS) &&
+        (p_rsp->count != 0)                                      &&
+        (p_rsp->value_len == BLE_DB_DISCOVERY_DB_HASH_LEN))
+    {
+        // Each entry holds the handle followed by the value.
+        memcpy(p_db_discovery->peer_db_hash,
+               &p_rsp->handle_value[sizeof(uint16_t)],
+               BLE_DB_DISCOVERY_DB_HASH_LEN);
+        p_db_discovery->peer_db_hash_valid = true;
+    }
+
+    if (p_db_discovery->range_discovery)
+    {
+        err_code = range_srv_discovery_start(p_db_discovery, conn_handle);
+    }
+    else if (cache_load(p_db_discovery))
+    {
+        cache_replay(p_db_discovery, conn_handle);
+        return;
+    }
+    else
+    {
+        err_code = srv_discovery_start(p_db_discovery, conn_handle);
+    }
+
+    if (err_code != NRF_SUCCESS)
+    {
+        discovery_error_handler(err_code, p_db_discovery, conn_handle);
+    }
+}
+#endif // BLE_DB_DISCOVERY_CACHE_ENABLED
+
+
+static uint32_t discovery_start(ble_db_discovery_t * const p_db_discovery, uint16_t conn_handle)
+{
+    ret_code_t err_code;
+
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    // The block of the previous discovery is referenced by the structure cleared below.
+    ble_gatt_db_compact_free(&p_db_discovery->compact_db);
+#endif
+
+    memset(p_db_discovery, 0x00, sizeof(ble_db_discovery_t));
+
+    err_code = nrf_ble_gq_conn_handle_register(mp_gatt_queue, conn_handle);
+    VERIFY_SUCCESS(err_code);
+
+    p_db_discovery->conn_handle = conn_handle;
+
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    work_acquire(p_db_discovery);
+#endif
 
-    err_code = nrf_ble_gq_item_add(mp_gatt_queue, &db_srv_disc_req, conn_handle);
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+    if (cache_hash_read_start(p_db_discovery, conn_handle))
+    {
+        err_code = NRF_SUCCESS;
+    }
+    else
+#endif
+    {
+        err_code = srv_discovery_start(p_db_discovery, conn_handle);
+    }
 
     if (err_code == NRF_SUCCESS)
     {
         p_db_discovery->discovery_in_progress = true;
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+        m_discoveries_running++;
+#endif
+    }
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    else
+    {
+        work_release(p_db_discovery);
+    }
+#endif
+
+    return err_code;
+}
+
+
+/**@brief     Function for starting the rediscovery of the services in
+ *            @ref ble_db_discovery_t::range_srv_mask.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ *
+ * @return    This function propagates the error code returned by @ref nrf_ble_gq_item_add.
+ */
+static uint32_t range_discovery_start(ble_db_discovery_t * const p_db_discovery)
+{
+    ret_code_t err_code;
+    uint16_t   conn_handle = p_db_discovery->conn_handle;
+
+    p_db_discovery->pending_usr_evt_index = 0;
+    p_db_discovery->discoveries_count     = 0;
+    p_db_discovery->discovery_in_progress = true;
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+    p_db_discovery->discovery_waiting     = false;
+    m_discoveries_running++;
+#endif
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    work_acquire(p_db_discovery);
+#endif
+
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+    if (p_db_discovery->cache_peer_id != PM_PEER_ID_INVALID)
+    {
+        // The Database Hash changed with the database. It is stored as not valid, so the stored
+        // database is not used, unless it is read again.
+        p_db_discovery->peer_db_hash_valid = false;
+
+        if (db_hash_read_start(p_db_discovery, conn_handle))
+        {
+            return NRF_SUCCESS;
+        }
+    }
+#endif
+
+    err_code = range_srv_discovery_start(p_db_discovery, conn_handle);
+    if (err_code != NRF_SUCCESS)
+    {
+        p_db_discovery->discovery_in_progress = false;
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+        m_discoveries_running--;
+#endif
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+        work_release(p_db_discovery);
+#endif
     }
 
     return err_code;
 }
 
 
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+/**@brief     Function for adding a discovery to the end of the waiting list.
+ *
+ * @param[in] p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ */
+static void discovery_wait(ble_db_discovery_t * const p_db_discovery, uint16_t conn_handle)
+{
+    ble_db_discovery_t ** pp_waiting = &mp_waiting_head;
+
+    while (*pp_waiting != NULL)
+    {
+        pp_waiting = &(*pp_waiting)->p_next_waiting;
+    }
+
+    NRF_LOG_DEBUG("Discovery on connection handle 0x%x waits.", conn_handle);
+
+    p_db_discovery->conn_handle           = conn_handle;
+    p_db_discovery->discovery_in_progress = true;
+    p_db_discovery->discovery_waiting     = true;
+    p_db_discovery->p_next_waiting        = NULL;
+    *pp_waiting                           = p_db_discovery;
+}
+#endif // BLE_DB_DISCOVERY_MAX_CONCURRENT
+
+
 uint32_t ble_db_discovery_start(ble_db_discovery_t * const p_db_discovery, uint16_t conn_handle)
 {
     VERIFY_PARAM_NOT_NULL(p_db_discovery);
@@ -976,10 +1776,97 @@ uint32_t ble_db_discovery_start(ble_db_discovery_t * const p_db_discovery, uint1
         return NRF_ERROR_BUSY;
     }
 
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+    if (m_discoveries_running >= BLE_DB_DISCOVERY_MAX_CONCURRENT)
+    {
+        p_db_discovery->range_discovery = false;
+        discovery_wait(p_db_discovery, conn_handle);
+
+        return NRF_SUCCESS;
+    }
+#endif
+
     return discovery_start(p_db_discovery, conn_handle);
 }
 
 
+uint32_t ble_db_discovery_range_start(ble_db_discovery_t             * const p_db_discovery,
+                                      uint16_t                               conn_handle,
+                                      ble_gattc_handle_range_t const * const p_handle_range)
+{
+    uint32_t srv_mask = 0;
+
+    VERIFY_PARAM_NOT_NULL(p_db_discovery);
+    VERIFY_PARAM_NOT_NULL(p_handle_range);
+    VERIFY_MODULE_INITIALIZED();
+
+    if (   (p_handle_range->start_handle == BLE_GATT_HANDLE_INVALID)
+        || (p_handle_range->start_handle > p_handle_range->end_handle))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if (p_db_discovery->discovery_in_progress)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    if (!p_db_discovery->db_complete || (p_db_discovery->conn_handle != conn_handle))
+    {
+        // There is no database of the connection to patch.
+        return ble_db_discovery_start(p_db_discovery, conn_handle);
+    }
+
+    for (uint32_t i = 0; i < m_num_of_handlers_reg; i++)
+    {
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+        ble_gatt_db_srv_t srv;
+
+        UNUSED_RETURN_VALUE(ble_gatt_db_compact_srv_get(&p_db_discovery->compact_db, i, &srv));
+        ble_gattc_handle_range_t const * p_srv_range = &srv.handle_range;
+#else
+        ble_gattc_handle_range_t const * p_srv_range = &(p_db_discovery->services[i].handle_range);
+#endif
+
+        // A service that was not found may have been added in the range.
+        if (   (p_srv_range->start_handle == BLE_GATT_HANDLE_INVALID)
+            || (   (p_srv_range->start_handle <= p_handle_range->end_handle)
+                && (p_srv_range->end_handle   >= p_handle_range->start_handle)))
+        {
+            srv_mask |= (1UL << i);
+        }
+    }
+
+    NRF_LOG_DEBUG("Handles 0x%x-0x%x changed on connection handle 0x%x, rediscovering services 0x%x.",
+                  p_handle_range->start_handle, p_handle_range->end_handle, conn_handle, srv_mask);
+
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+    if ((srv_mask == 0) && (p_db_discovery->cache_peer_id == PM_PEER_ID_INVALID))
+#else
+    if (srv_mask == 0)
+#endif
+    {
+        return NRF_SUCCESS;
+    }
+
+    // The services are only valid again once the rediscovery is complete.
+    p_db_discovery->db_complete     = false;
+    p_db_discovery->range_discovery = true;
+    p_db_discovery->range_srv_mask  = srv_mask;
+
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+    if (m_discoveries_running >= BLE_DB_DISCOVERY_MAX_CONCURRENT)
+    {
+        discovery_wait(p_db_discovery, conn_handle);
+
+        return NRF_SUCCESS;
+    }
+#endif
+
+    return range_discovery_start(p_db_discovery);
+}
+
+
 /**@brief     Function for handling disconnected event.
  *
  * @param[in] p_db_discovery    Pointer to the DB Discovery structure.
@@ -990,8 +1877,16 @@ static void on_disconnected(ble_db_discovery_t       * p_db_discovery,
 {
     if (p_evt->conn_handle == p_db_discovery->conn_handle)
     {
-        p_db_discovery->discovery_in_progress = false;
+        discovery_end(p_db_discovery);
         p_db_discovery->conn_handle           = BLE_CONN_HANDLE_INVALID;
+        p_db_discovery->db_complete           = false;
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+        // The services are not needed once the connection is lost, so the arena is given back.
+        ble_gatt_db_compact_free(&p_db_discovery->compact_db);
+#endif
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+        p_db_discovery->cache_hash_read       = false;
+#endif
     }
 }
 
@@ -1005,6 +1900,14 @@ void ble_db_discovery_on_ble_evt(ble_evt_t const * p_ble_evt,
 
     ble_db_discovery_t * p_db_discovery = (ble_db_discovery_t *)p_context;
 
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    if ((p_db_discovery->p_work == NULL) && (p_ble_evt->header.evt_id != BLE_GAP_EVT_DISCONNECTED))
+    {
+        // Responses meant for a discovery that has ended.
+        return;
+    }
+#endif
+
     switch (p_ble_evt->header.evt_id)
     {
         case BLE_GATTC_EVT_PRIM_SRVC_DISC_RSP:
@@ -1019,6 +1922,12 @@ void ble_db_discovery_on_ble_evt(ble_evt_t const * p_ble_evt,
             on_descriptor_discovery_rsp(p_db_discovery, &(p_ble_evt->evt.gattc_evt));
             break;
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+        case BLE_GATTC_EVT_CHAR_VAL_BY_UUID_READ_RSP:
+            on_db_hash_read_rsp(p_db_discovery, &(p_ble_evt->evt.gattc_evt));
+            break;
+#endif
+
         case BLE_GAP_EVT_DISCONNECTED:
             on_disconnected(p_db_discovery, &(p_ble_evt->evt.gap_evt));
             break;
@@ -1027,4 +1936,68 @@ void ble_db_discovery_on_ble_evt(ble_evt_t const * p_ble_evt,
             break;
     }
 }
+
+
+uint32_t ble_db_discovery_srv_get(ble_db_discovery_t const * p_db_discovery,
+                                  uint32_t                   srv_ind,
+                                  ble_gatt_db_srv_t        * p_srv)
+{
+    VERIFY_PARAM_NOT_NULL(p_db_discovery);
+    VERIFY_PARAM_NOT_NULL(p_srv);
+
+    if (!p_db_discovery->db_complete)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    return ble_gatt_db_compact_srv_get(&p_db_discovery->compact_db, srv_ind, p_srv);
+#else
+    if (srv_ind >= m_num_of_handlers_reg)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    *p_srv = p_db_discovery->services[srv_ind];
+
+    return NRF_SUCCESS;
+#endif
+}
+
+
+uint32_t ble_db_discovery_char_get(ble_db_discovery_t const * p_db_discovery,
+                                   uint32_t                   srv_ind,
+                                   uint32_t                   char_ind,
+                                   ble_gatt_db_char_t       * p_char)
+{
+    VERIFY_PARAM_NOT_NULL(p_db_discovery);
+    VERIFY_PARAM_NOT_NULL(p_char);
+
+    if (!p_db_discovery->db_complete)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    return ble_gatt_db_compact_char_get(&p_db_discovery->compact_db, srv_ind, char_ind, p_char);
+#else
+    if ((srv_ind >= m_num_of_handlers_reg) ||
+        (char_ind >= p_db_discovery->services[srv_ind].char_count))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    *p_char = p_db_discovery->services[srv_ind].charateristics[char_ind];
+
+    return NRF_SUCCESS;
+#endif
+}
+
+
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+uint32_t ble_db_discovery_cache_clear(pm_peer_id_t peer_id)
+{
+    return pm_peer_data_delete(peer_id, PM_PEER_DATA_ID_GATT_REMOTE);
+}
+#endif // BLE_DB_DISCOVERY_CACHE_ENABLED
 #endif // NRF_MODULE_ENABLED(BLE_DB_DISCOVERY)
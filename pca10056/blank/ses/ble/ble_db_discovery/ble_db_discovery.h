@@ -64,6 +64,37 @@
  * @note The application must propagate BLE stack events to this module by calling
  *       ble_db_discovery_on_ble_evt().
  *
+ * @note If BLE_DB_DISCOVERY_CACHE_ENABLED is set, the services discovered on a bonded peer are
+ *       stored as its @ref PM_PEER_DATA_ID_GATT_REMOTE data, together with the Database Hash of
+ *       the peer. When a discovery is started on a bonded peer, the Database Hash is read first.
+ *       If it is unchanged, or the peer has none and the stored database has none either, the
+ *       stored services are sent as discovery events without any further GATT procedure. The
+ *       database is discovered again otherwise, and whenever the set of registered services
+ *       changes. When the peer indicates Service Changed, call
+ *       @ref ble_db_discovery_range_start to patch the stored database, or
+ *       @ref ble_db_discovery_cache_clear to discover it again at the next connection.
+ *       The Peer Manager must be initialized before a discovery is started.
+ *
+ * @note Discoveries on separate connections, each with its own instance, run at the same time.
+ *       If BLE_DB_DISCOVERY_MAX_CONCURRENT is not 0, a discovery started while that many are in
+ *       progress waits, and is started when one of them finishes. A waiting discovery is dropped
+ *       without any event if its connection is lost.
+ *
+ * @note If BLE_DB_DISCOVERY_FILTER_ENABLED is set, a service can be registered with
+ *       @ref ble_db_discovery_evt_register_filtered to discover only the characteristics and
+ *       descriptors the user needs. Characteristic discovery stops once they are all found, and
+ *       descriptors are discovered only for them. The event of such a service may list other
+ *       characteristics found on the way, without their descriptors.
+ *
+ * @note If BLE_DB_DISCOVERY_COMPACT_ENABLED is set, an instance holds no service records of its
+ *       own. A discovery in progress uses one of BLE_DB_DISCOVERY_MAX_CONCURRENT shared storages.
+ *       Once it completes, the services are packed with @ref ble_gatt_db_compact into an arena
+ *       of BLE_DB_DISCOVERY_COMPACT_ARENA_SIZE bytes shared by all instances, taking only the
+ *       room of the characteristics and descriptors found. The block is freed when the
+ *       connection is lost. Read the services with @ref ble_db_discovery_srv_get and
+ *       @ref ble_db_discovery_char_get. This option cannot be used with
+ *       BLE_DB_DISCOVERY_CACHE_ENABLED.
+ *
  */
 
 #ifndef BLE_DB_DISCOVERY_H__
@@ -76,6 +107,12 @@
 #include "ble_gattc.h"
 #include "ble_gatt_db.h"
 #include "nrf_ble_gq.h"
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+#include "ble_gatt_db_compact.h"
+#endif
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+#include "peer_manager_types.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -158,6 +195,47 @@ typedef struct
     ble_db_discovery_evt_handler_t evt_handler;  /**< Event handler which should be called to raise this event. */
 } ble_db_discovery_user_evt_t;
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED || defined(__SDK_DOXYGEN__)
+#define BLE_DB_DISCOVERY_DB_HASH_LEN    16  /**< Length of the Database Hash characteristic value. */
+
+/**@brief Information stored after the services of a cached database.
+ *
+ * @details The structure is word-aligned, so the stored length is a multiple of 4 bytes.
+ */
+typedef struct
+{
+    uint32_t found_mask;                            /**< Bit n is set if service n was found at the peer. */
+    uint8_t  db_hash[BLE_DB_DISCOVERY_DB_HASH_LEN]; /**< Database Hash of the peer when the database was discovered. */
+    uint8_t  db_hash_valid;                         /**< 1 if the peer had a Database Hash characteristic. */
+    uint8_t  srv_count;                             /**< Number of services in the database, the number of registrations at that time. */
+    uint8_t  reserved[2];                           /**< Reserved. */
+} ble_db_discovery_cache_info_t;
+#endif // BLE_DB_DISCOVERY_CACHE_ENABLED
+
+#if BLE_DB_DISCOVERY_FILTER_ENABLED || defined(__SDK_DOXYGEN__)
+/**@defgroup BLE_DB_DISCOVERY_DESC Descriptors of a filtered characteristic.
+ * @{ */
+#define BLE_DB_DISCOVERY_DESC_CCCD       (1UL << 0) /**< Client Characteristic Configuration descriptor. */
+#define BLE_DB_DISCOVERY_DESC_EXT_PROP   (1UL << 1) /**< Characteristic Extended Properties descriptor. */
+#define BLE_DB_DISCOVERY_DESC_USER_DESC  (1UL << 2) /**< Characteristic User Description descriptor. */
+#define BLE_DB_DISCOVERY_DESC_REPORT_REF (1UL << 3) /**< Report Reference descriptor. */
+/** @} */
+
+/**@brief Characteristic needed by the user of a filtered service. */
+typedef struct
+{
+    ble_uuid_t uuid;      /**< UUID of the characteristic. */
+    uint8_t    desc_mask; /**< Descriptors needed, a combination of @ref BLE_DB_DISCOVERY_DESC. 0 to skip the descriptor discovery. */
+} ble_db_discovery_char_filter_t;
+
+/**@brief Characteristics needed by the user of a filtered service. */
+typedef struct
+{
+    ble_db_discovery_char_filter_t const * p_chars;  /**< Characteristics needed. The array must stay valid while the service is registered. */
+    uint8_t                                char_cnt; /**< Number of characteristics in @p p_chars. */
+} ble_db_discovery_filter_t;
+#endif // BLE_DB_DISCOVERY_FILTER_ENABLED
+
 /**@brief Structure for holding the information related to the GATT database at the server.
  *
  * @details This module identifies a remote database. Use one instance of this structure per
@@ -165,9 +243,21 @@ typedef struct
  *
  * @warning This structure must be zero-initialized.
  */
-typedef struct
+typedef struct ble_db_discovery_s
 {
+#if BLE_DB_DISCOVERY_COMPACT_ENABLED
+    struct ble_db_discovery_work_s * p_work;                                /**< Storage of the discovery in progress, NULL if none. This is intended for internal use.*/
+    ble_gatt_db_compact_t       compact_db;                                 /**< Services of the last complete discovery, packed in the shared arena. This is intended for internal use.*/
+#else
     ble_gatt_db_srv_t           services[BLE_DB_DISCOVERY_MAX_SRV];         /**< Information related to the current service being discovered. This is intended for internal use during service discovery.*/
+#endif
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+    ble_db_discovery_cache_info_t cache_info;                               /**< Stored right after @p services, the two form the cached database. This is intended for internal use.*/
+    uint8_t                     peer_db_hash[BLE_DB_DISCOVERY_DB_HASH_LEN]; /**< Database Hash read from the peer when the discovery started. This is intended for internal use.*/
+    bool                        peer_db_hash_valid;                         /**< Variable to indicate whether the Database Hash was read from the peer. */
+    pm_peer_id_t                cache_peer_id;                              /**< Peer the discovery is cached for, PM_PEER_ID_INVALID if it is not cached. */
+    bool                        cache_hash_read;                            /**< Variable to indicate whether the Database Hash of the peer is being read. */
+#endif
     uint8_t                     srv_count;                                  /**< Number of services at the peer's GATT database.*/
     uint8_t                     curr_char_ind;                              /**< Index of the current characteristic being discovered. This is intended for internal use during service discovery.*/
     uint8_t                     curr_srv_ind;                               /**< Index of the current service being discovered. This is intended for internal use during service discovery.*/
@@ -175,7 +265,19 @@ typedef struct
     bool                        discovery_in_progress;                      /**< Variable to indicate whether there is a service discovery in progress. */
     uint16_t                    conn_handle;                                /**< Connection handle on which the discovery is started. */
     uint32_t                    pending_usr_evt_index;                      /**< The index to the pending user event array, pointing to the last added pending user event. */
+#if !BLE_DB_DISCOVERY_COMPACT_ENABLED
     ble_db_discovery_user_evt_t pending_usr_evts[BLE_DB_DISCOVERY_MAX_SRV]; /**< Whenever a discovery related event is to be raised to a user module, it is stored in this array first. When all expected services have been discovered, all pending events are sent to the corresponding user modules. */
+#endif
+    bool                        db_complete;                                /**< Variable to indicate whether @p services hold the complete database of the connection. */
+    bool                        range_discovery;                            /**< Variable to indicate whether only the services in @p range_srv_mask are discovered. */
+    uint32_t                    range_srv_mask;                             /**< Bit n is set if service n is rediscovered. This is intended for internal use.*/
+#if !BLE_DB_DISCOVERY_COMPACT_ENABLED
+    ble_gatt_db_srv_t           range_prev_srv;                             /**< Service being rediscovered, as it was before. This is intended for internal use.*/
+#endif
+#if BLE_DB_DISCOVERY_MAX_CONCURRENT
+    bool                        discovery_waiting;                          /**< Variable to indicate whether the discovery waits for one in progress to finish. */
+    struct ble_db_discovery_s * p_next_waiting;                             /**< Next waiting discovery. This is intended for internal use.*/
+#endif
 } ble_db_discovery_t;
 
 /**@brief DB discovery module initialization struct. */
@@ -232,13 +334,39 @@ uint32_t ble_db_discovery_close(ble_db_discovery_t * const p_db_discovery);
 uint32_t ble_db_discovery_evt_register(const ble_uuid_t * const p_uuid);
 
 
+#if BLE_DB_DISCOVERY_FILTER_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief Function for registering with the DB Discovery module for a part of a service.
+ *
+ * @details Same as @ref ble_db_discovery_evt_register, but only the characteristics listed in
+ *          @p p_filter and their listed descriptors are discovered. Registering a service again
+ *          replaces its filter.
+ *
+ * @param[in] p_uuid   Pointer to the UUID of the service to be discovered at the server.
+ * @param[in] p_filter Pointer to the characteristics needed. NULL to discover the whole service.
+ *                     The structure must stay valid while the service is registered.
+ *
+ * @retval NRF_SUCCESS             Operation success.
+ * @retval NRF_ERROR_NULL          When a NULL pointer is passed as @p p_uuid.
+ * @retval NRF_ERROR_INVALID_STATE If this function is called without calling the
+ *                                 @ref ble_db_discovery_init.
+ * @retval NRF_ERROR_NO_MEM        The maximum number of registrations allowed by this module
+ *                                 has been reached.
+ */
+uint32_t ble_db_discovery_evt_register_filtered(ble_uuid_t                const * p_uuid,
+                                                ble_db_discovery_filter_t const * p_filter);
+#endif // BLE_DB_DISCOVERY_FILTER_ENABLED
+
+
 /**@brief Function for starting the discovery of the GATT database at the server.
  *
  * @param[out] p_db_discovery Pointer to the DB Discovery structure.
  * @param[in]  conn_handle    The handle of the connection for which the discovery should be
  *                            started.
  *
- * @retval NRF_SUCCESS             Operation success.
+ * @retval NRF_SUCCESS             Operation success. The discovery may wait for others to finish
+ *                                 if BLE_DB_DISCOVERY_MAX_CONCURRENT is not 0. Errors met when
+ *                                 it is started later are reported with a
+ *                                 @ref BLE_DB_DISCOVERY_ERROR event.
  * @retval NRF_ERROR_NULL          When a NULL pointer is passed as input.
  * @retval NRF_ERROR_INVALID_STATE If this function is called without calling the
  *                                 @ref ble_db_discovery_init, or without calling
@@ -253,6 +381,42 @@ uint32_t ble_db_discovery_start(ble_db_discovery_t * p_db_discovery,
                                 uint16_t             conn_handle);
 
 
+/**@brief Function for rediscovering the services affected by a change of the GATT database.
+ *
+ * @details Call this function when the peer indicates Service Changed, with the affected handle
+ *          range. Only the registered services that overlap the range, or were not found at the
+ *          peer, are discovered again. A @ref BLE_DB_DISCOVERY_COMPLETE or
+ *          @ref BLE_DB_DISCOVERY_SRV_NOT_FOUND event is sent only for the services that changed,
+ *          so the users of the other services keep their handles. The events are sent once all
+ *          affected services have been discovered, followed by a @ref BLE_DB_DISCOVERY_AVAILABLE
+ *          event. If BLE_DB_DISCOVERY_CACHE_ENABLED is set, the Database Hash is read again and
+ *          the stored database of the peer is updated.
+ *
+ *          If the last discovery on @p p_db_discovery was not a complete one on @p conn_handle,
+ *          the whole database is discovered as done by @ref ble_db_discovery_start.
+ *
+ * @param[in,out] p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in]     conn_handle    The handle of the connection the Service Changed indication was
+ *                               received on.
+ * @param[in]     p_handle_range Affected handle range, as indicated by the peer.
+ *
+ * @retval NRF_SUCCESS             Operation success. If no registered service is affected and the
+ *                                 database is not cached, nothing is done and no event is sent.
+ * @retval NRF_ERROR_NULL          When a NULL pointer is passed as input.
+ * @retval NRF_ERROR_INVALID_PARAM If the handle range is not valid.
+ * @retval NRF_ERROR_INVALID_STATE If this function is called without calling the
+ *                                 @ref ble_db_discovery_init, or without calling
+ *                                 @ref ble_db_discovery_evt_register.
+ * @retval NRF_ERROR_BUSY          If a discovery is already in progress using
+ *                                 @p p_db_discovery.
+ * @return                         This API propagates the error code returned by functions:
+ *                                 @ref nrf_ble_gq_conn_handle_register and @ref nrf_ble_gq_item_add.
+ */
+uint32_t ble_db_discovery_range_start(ble_db_discovery_t             * p_db_discovery,
+                                      uint16_t                         conn_handle,
+                                      ble_gattc_handle_range_t const * p_handle_range);
+
+
 /**@brief Function for handling the Application's BLE Stack events.
  *
  * @param[in]     p_ble_evt Pointer to the BLE event received.
@@ -262,6 +426,61 @@ void ble_db_discovery_on_ble_evt(ble_evt_t const * p_ble_evt,
                                  void            * p_context);
 
 
+/**@brief Function for reading a service of the database of the connection.
+ *
+ * @param[in]  p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in]  srv_ind        Index of the service, in the order of registration. A service that
+ *                            was not found at the peer has a handle range starting at
+ *                            BLE_GATT_HANDLE_INVALID.
+ * @param[out] p_srv          Service, as sent in its @ref BLE_DB_DISCOVERY_COMPLETE event.
+ *
+ * @retval NRF_SUCCESS             If the service was read.
+ * @retval NRF_ERROR_NULL          When a NULL pointer is passed as input.
+ * @retval NRF_ERROR_INVALID_STATE If no discovery has completed on the connection, or a
+ *                                 rediscovery is in progress.
+ * @retval NRF_ERROR_INVALID_PARAM If @p srv_ind is not the index of a registered service.
+ */
+uint32_t ble_db_discovery_srv_get(ble_db_discovery_t const * p_db_discovery,
+                                  uint32_t                   srv_ind,
+                                  ble_gatt_db_srv_t        * p_srv);
+
+
+/**@brief Function for reading a characteristic of the database of the connection.
+ *
+ * @details Reads one characteristic without reading its whole service.
+ *
+ * @param[in]  p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in]  srv_ind        Index of the service, in the order of registration.
+ * @param[in]  char_ind       Index of the characteristic in the service.
+ * @param[out] p_char         Characteristic.
+ *
+ * @retval NRF_SUCCESS             If the characteristic was read.
+ * @retval NRF_ERROR_NULL          When a NULL pointer is passed as input.
+ * @retval NRF_ERROR_INVALID_STATE If no discovery has completed on the connection, or a
+ *                                 rediscovery is in progress.
+ * @retval NRF_ERROR_INVALID_PARAM If the service has no characteristic at @p char_ind.
+ */
+uint32_t ble_db_discovery_char_get(ble_db_discovery_t const * p_db_discovery,
+                                   uint32_t                   srv_ind,
+                                   uint32_t                   char_ind,
+                                   ble_gatt_db_char_t       * p_char);
+
+
+#if BLE_DB_DISCOVERY_CACHE_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief Function for clearing the cached database of a peer.
+ *
+ * @details Call this function when the peer indicates Service Changed, and the database is not
+ *          discovered again with @ref ble_db_discovery_range_start, so that the next discovery on
+ *          the peer is a full one.
+ *
+ * @param[in] peer_id Peer to clear the cached database for.
+ *
+ * @return This API propagates the error code returned by @ref pm_peer_data_delete.
+ */
+uint32_t ble_db_discovery_cache_clear(pm_peer_id_t peer_id);
+#endif // BLE_DB_DISCOVERY_CACHE_ENABLED
+
+
 #ifdef __cplusplus
 }
 #endif
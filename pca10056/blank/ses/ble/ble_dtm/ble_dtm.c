@@ -67,6 +67,10 @@
     #define DIRECTION_FINDING_SUPPORTED 0
 #endif // defined(NRF52833_XXAA) || defined(NRF52811_XXAA) || defined(NRF52820_XXAA)
 
+#ifndef DTM_SWEEP_ENABLED
+#define DTM_SWEEP_ENABLED 0
+#endif
+
 #define DTM_HEADER_OFFSET         0                                                  /**< Index where the header of the pdu is located. */
 #define DTM_HEADER_SIZE           2                                                  /**< Size of PDU header. */
 #define DTM_HEADER_WITH_CTE_SIZE  3                                                  /**< Size of PDU header with CTEInfo field. */
@@ -148,10 +152,12 @@
 
 
 /**@brief Structure holding the PDU used for transmitting/receiving a PDU.
+ *
+ * @details Word aligned so that both buffers of m_pdu start on a word boundary for EasyDMA.
  */
 typedef struct
 {
-    uint8_t content[DTM_HEADER_WITH_CTE_SIZE + DTM_PAYLOAD_MAX_SIZE];                 /**< PDU packet content. */
+    __ALIGN(4) uint8_t content[DTM_HEADER_WITH_CTE_SIZE + DTM_PAYLOAD_MAX_SIZE];      /**< PDU packet content. */
 } pdu_type_t;
 
 /**@brief States used for the DTM test implementation.
@@ -273,6 +279,34 @@ const uint32_t nrf_power_value[] = {
 #endif // defined(RADIO_TXPOWER_TXPOWER_Pos8dBm) 
 };
 
+#if DTM_SWEEP_ENABLED
+#define DTM_SWEEP_REPORT_VERSION     0x01                                        /**< Version of the sweep report format. */
+#define DTM_SWEEP_REPORT_HEADER_SIZE 6                                           /**< Size of the sweep report header. */
+#define DTM_SWEEP_RECORD_SIZE        11                                          /**< Size of the report record of one sweep step. */
+
+/**@brief State of the on-target sweep.
+ */
+typedef struct
+{
+    dtm_sweep_config_t const * p_config;                                         /**< Configured sweep. */
+    uint16_t                   step_cnt;                                         /**< Number of steps in the configured sweep. */
+    uint16_t                   step;                                             /**< Index of the current step. */
+    bool                       rx;                                               /**< The sweep receives. */
+    bool                       running;                                          /**< A sweep is running. */
+    bool                       report_ready;                                     /**< A report has been completed and not yet read. */
+    uint32_t                   packet_length;                                    /**< Packet length to restore after the sweep. */
+    uint32_t                   tx_power;                                         /**< TX power to restore after the sweep. */
+    volatile uint16_t          intervals;                                        /**< Packet intervals elapsed in the current step. */
+    volatile uint32_t          rssi_sum;                                         /**< Sum of the RSSI samples of the current step. */
+    volatile uint8_t           rssi_min;                                         /**< Lowest RSSI sample of the current step. */
+    volatile uint8_t           rssi_max;                                         /**< Highest RSSI sample of the current step. */
+} dtm_sweep_t;
+
+static dtm_sweep_t m_sweep;                                                      /**< Sweep state. */
+static uint8_t     m_sweep_report[DTM_SWEEP_REPORT_HEADER_SIZE +
+                                  DTM_SWEEP_MAX_STEPS * DTM_SWEEP_RECORD_SIZE];  /**< Sweep report. */
+#endif // DTM_SWEEP_ENABLED
+
 #if DIRECTION_FINDING_SUPPORTED
 
 /**@brief Antenna pin array.
@@ -667,9 +701,15 @@ static void radio_prepare(bool rx)
     NVIC_ClearPendingIRQ(RADIO_IRQn);
     NVIC_EnableIRQ(RADIO_IRQn);
 
-    nrf_radio_int_enable(NRF_RADIO_INT_READY_MASK |
-                         NRF_RADIO_INT_ADDRESS_MASK |
-                         NRF_RADIO_INT_END_MASK);
+#if !defined(NRF21540_DRIVER_ENABLE) || (NRF21540_DRIVER_ENABLE == 0)
+    // The transmit loop runs on PPI and shortcuts alone, so only the receiver needs interrupts.
+    if (rx)
+#endif
+    {
+        nrf_radio_int_enable(NRF_RADIO_INT_READY_MASK |
+                             NRF_RADIO_INT_ADDRESS_MASK |
+                             NRF_RADIO_INT_END_MASK);
+    }
 
     if (rx)
     {
@@ -684,6 +724,7 @@ static void radio_prepare(bool rx)
 #if defined(NRF21540_DRIVER_ENABLE) && (NRF21540_DRIVER_ENABLE == 1)
         (void)nrf21540_rx_set(NRF21540_EXECUTE_NOW, NRF21540_EXEC_MODE_NON_BLOCKING);
 #else
+        NRF_RADIO->SHORTS    |= (1 << RADIO_SHORTS_DISABLED_RXEN_Pos);  // Shortcut between DISABLED event and RXEN task, re-arms the receiver after each packet
         NRF_RADIO->TASKS_RXEN = 1;  // shorts will start radio in RX mode when it is ready
 #endif
     }
@@ -754,7 +795,10 @@ static uint32_t timer_init(void)
     nrf_timer_frequency_set(mp_timer, NRF_TIMER_FREQ_1MHz);                 // Input clock is 16MHz, timer clock = 2 ^ prescale -> interval 1us
 
     nrf_timer_shorts_enable(mp_timer, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK); // Clear the count every time timer reaches the CCREG0 count
+#if (defined(NRF21540_DRIVER_ENABLE) && (NRF21540_DRIVER_ENABLE == 1)) || DTM_SWEEP_ENABLED
+    // Only needed to re-arm the nRF21540 or to pace a sweep. The transmit loop itself runs on PPI.
     nrf_timer_int_enable(mp_timer, NRF_TIMER_INT_COMPARE0_MASK);
+#endif
 
     nrf_timer_cc_write(mp_timer, NRF_TIMER_CC_CHANNEL0, m_txIntervaluS);    // 625uS with 1MHz clock to the timer
     nrf_timer_cc_write(mp_timer, NRF_TIMER_CC_CHANNEL1, UART_POLL_CYCLE);   // Depends on the baud rate of the UART. Default baud rate of 19200 will result in a 260uS time with 1MHz clock to the timer
@@ -853,6 +897,19 @@ static uint32_t dtm_vendor_specific_pkt(uint32_t vendor_cmd, dtm_freq_t vendor_o
             }
             break;
 #endif // defined(NRF21540_DRIVER_ENABLE) && (NRF21540_DRIVER_ENABLE == 1)
+
+#if DTM_SWEEP_ENABLED
+        case START_SWEEP:
+        {
+            uint32_t err_code = dtm_sweep_start(vendor_option != 0);
+
+            if (err_code != DTM_SUCCESS)
+            {
+                m_event = LE_TEST_STATUS_EVENT_ERROR;
+                return err_code;
+            }
+        } break;
+#endif // DTM_SWEEP_ENABLED
     }
 
     // Event code is unchanged, successful
@@ -1523,6 +1580,306 @@ static uint32_t on_test_receive_cmd(void)
 } 
 
 
+#if DTM_SWEEP_ENABLED
+/**@brief Function for adding the RSSI of a valid received packet to the current sweep step.
+ *
+ * @details The ADDRESS_RSSISTART shortcut starts one RSSI sample per packet, so it has ended by
+ *          the END event like in @ref anomaly_172_rssi_check.
+ */
+static void sweep_rssi_add(void)
+{
+    uint8_t rssi;
+
+    if (NRF_RADIO->EVENTS_RSSIEND == 0)
+    {
+        return;
+    }
+
+    NRF_RADIO->EVENTS_RSSIEND = 0;
+    rssi = NRF_RADIO->RSSISAMPLE;
+
+    m_sweep.rssi_sum += rssi;
+    m_sweep.rssi_min  = MIN(m_sweep.rssi_min, rssi);
+    m_sweep.rssi_max  = MAX(m_sweep.rssi_max, rssi);
+}
+
+
+/**@brief Function for starting the current sweep step.
+ *
+ * @details The channel index changes fastest, then the length, the TX power and the PHY.
+ */
+static uint32_t sweep_step_start(void)
+{
+    dtm_sweep_config_t const * p_config = m_sweep.p_config;
+    uint8_t                  * p_record = &m_sweep_report[DTM_SWEEP_REPORT_HEADER_SIZE +
+                                                          m_sweep.step * DTM_SWEEP_RECORD_SIZE];
+    uint32_t                   index    = m_sweep.step;
+    uint8_t                    channel;
+    uint8_t                    length;
+    int8_t                     tx_power;
+    uint8_t                    phy;
+    uint32_t                   err_code;
+
+    channel  = p_config->p_channels[index % p_config->channel_cnt];
+    index   /= p_config->channel_cnt;
+    length   = p_config->p_lengths[index % p_config->length_cnt];
+    index   /= p_config->length_cnt;
+    tx_power = p_config->p_tx_powers[index % p_config->tx_power_cnt];
+    index   /= p_config->tx_power_cnt;
+    phy      = p_config->p_phys[index];
+
+    // The TX power is validated against the radio mode by radio_init().
+    m_tx_power = (uint8_t)tx_power;
+    err_code   = phy_set(phy);
+    if (err_code != DTM_SUCCESS)
+    {
+        return err_code;
+    }
+
+    p_record[0] = channel;
+    p_record[1] = phy;
+    p_record[2] = length;
+    p_record[3] = (uint8_t)tx_power;
+
+    m_phys_ch        = channel;
+    m_packet_length  = length;
+    m_packet_type    = p_config->pkt_type;
+    m_rx_pkt_count   = 0;
+    m_sweep.rssi_sum = 0;
+    m_sweep.rssi_min = UINT8_MAX;
+    m_sweep.rssi_max = 0;
+
+    if (m_sweep.rx)
+    {
+        err_code = on_test_receive_cmd();
+
+        // Pace the step like the reference transmitter and sample the RSSI of each packet.
+        nrf_timer_cc_write(mp_timer,
+                           NRF_TIMER_CC_CHANNEL0,
+                           dtm_packet_interval_calculate(m_packet_length, m_radio_mode));
+        NRF_RADIO->EVENTS_RSSIEND = 0;
+        NRF_RADIO->SHORTS        |= RADIO_SHORTS_ADDRESS_RSSISTART_Msk;
+    }
+    else
+    {
+        err_code = on_test_transmit_cmd(m_packet_length, m_phys_ch);
+    }
+
+    nrf_timer_task_trigger(mp_timer, NRF_TIMER_TASK_CLEAR);
+    m_sweep.intervals = 0;
+
+    return err_code;
+}
+
+
+/**@brief Function for storing the results of the current sweep step in the report.
+ */
+static void sweep_step_record(void)
+{
+    uint8_t  * p_record = &m_sweep_report[DTM_SWEEP_REPORT_HEADER_SIZE +
+                                          m_sweep.step * DTM_SWEEP_RECORD_SIZE];
+    uint32_t   expected = m_sweep.p_config->packets;
+    uint32_t   count;
+    uint32_t   per      = 0;
+
+    if (m_sweep.rx)
+    {
+        count = m_rx_pkt_count;
+        if (count < expected)
+        {
+            per = ((expected - count) * 1000 + expected / 2) / expected;
+        }
+    }
+    else
+    {
+        // Every interval has triggered TXEN through PPI.
+        count = m_sweep.intervals;
+    }
+
+    (void)uint16_encode((uint16_t)count, &p_record[4]);
+    (void)uint16_encode((uint16_t)per, &p_record[6]);
+
+    if (m_sweep.rx && (count != 0))
+    {
+        p_record[8]  = (uint8_t)((m_sweep.rssi_sum + count / 2) / count);
+        p_record[9]  = m_sweep.rssi_min;
+        p_record[10] = m_sweep.rssi_max;
+    }
+    else
+    {
+        memset(&p_record[8], 0, 3);
+    }
+}
+
+
+/**@brief Function for ending the sweep and completing its report.
+ *
+ * @details The radio must already be stopped.
+ */
+static void sweep_stop(void)
+{
+    m_sweep.running      = false;
+    m_sweep.report_ready = true;
+
+    (void)uint16_encode(m_sweep.step, &m_sweep_report[2]);
+
+    m_packet_length = m_sweep.packet_length;
+    m_tx_power      = m_sweep.tx_power;
+    nrf_timer_cc_write(mp_timer, NRF_TIMER_CC_CHANNEL0, m_txIntervaluS);
+}
+
+
+/**@brief Function for moving the sweep to its next step once the current one has elapsed.
+ */
+static void sweep_process(void)
+{
+    uint32_t err_code = DTM_SUCCESS;
+
+    if (!m_sweep.running || (m_sweep.intervals < m_sweep.p_config->packets))
+    {
+        return;
+    }
+
+    sweep_step_record();
+    dtm_test_done();
+
+    if (++m_sweep.step < m_sweep.step_cnt)
+    {
+        err_code = sweep_step_start();
+        if (err_code == DTM_SUCCESS)
+        {
+            return;
+        }
+
+        dtm_test_done();
+    }
+
+    sweep_stop();
+
+    m_event     = (err_code == DTM_SUCCESS) ? (LE_PACKET_REPORTING_EVENT | m_sweep.step) :
+                                              LE_TEST_STATUS_EVENT_ERROR;
+    m_new_event = true;
+}
+
+
+uint32_t dtm_sweep_config_set(dtm_sweep_config_t const * p_config)
+{
+    uint32_t step_cnt;
+    uint32_t i;
+
+    if (m_sweep.running)
+    {
+        return DTM_ERROR_INVALID_STATE;
+    }
+
+    if ((p_config == NULL)                                           ||
+        (p_config->p_channels == NULL) || (p_config->channel_cnt == 0)   ||
+        (p_config->p_phys == NULL) || (p_config->phy_cnt == 0)           ||
+        (p_config->p_lengths == NULL) || (p_config->length_cnt == 0)     ||
+        (p_config->p_tx_powers == NULL) || (p_config->tx_power_cnt == 0) ||
+        (p_config->pkt_type > DTM_PKT_0X55) || (p_config->packets == 0))
+    {
+        return DTM_ERROR_ILLEGAL_CONFIGURATION;
+    }
+
+    step_cnt = (uint32_t)p_config->channel_cnt * p_config->phy_cnt *
+               p_config->length_cnt * p_config->tx_power_cnt;
+    if (step_cnt > DTM_SWEEP_MAX_STEPS)
+    {
+        return DTM_ERROR_ILLEGAL_CONFIGURATION;
+    }
+
+    for (i = 0; i < p_config->channel_cnt; i++)
+    {
+        if (p_config->p_channels[i] > PHYS_CH_MAX)
+        {
+            return DTM_ERROR_ILLEGAL_CHANNEL;
+        }
+    }
+
+    for (i = 0; i < p_config->phy_cnt; i++)
+    {
+        if ((p_config->p_phys[i] < LE_PHY_1M_MIN_RANGE) ||
+            (p_config->p_phys[i] > LE_PHY_LE_CODED_S2_MAX_RANGE))
+        {
+            return DTM_ERROR_ILLEGAL_CONFIGURATION;
+        }
+    }
+
+    for (i = 0; i < p_config->tx_power_cnt; i++)
+    {
+        if (dtm_radio_validate((uint8_t)p_config->p_tx_powers[i],
+                               RADIO_MODE_MODE_Ble_1Mbit) != DTM_SUCCESS)
+        {
+            return DTM_ERROR_ILLEGAL_CONFIGURATION;
+        }
+    }
+
+    m_sweep.p_config = p_config;
+    m_sweep.step_cnt = (uint16_t)step_cnt;
+
+    return DTM_SUCCESS;
+}
+
+
+uint32_t dtm_sweep_start(bool rx)
+{
+    uint32_t err_code;
+
+    if (m_state == STATE_UNINITIALIZED)
+    {
+        return DTM_ERROR_UNINITIALIZED;
+    }
+
+    if ((m_state != STATE_IDLE) || m_sweep.running)
+    {
+        return DTM_ERROR_INVALID_STATE;
+    }
+
+    if (m_sweep.p_config == NULL)
+    {
+        return DTM_ERROR_ILLEGAL_CONFIGURATION;
+    }
+
+    m_sweep.rx            = rx;
+    m_sweep.step          = 0;
+    m_sweep.report_ready  = false;
+    m_sweep.packet_length = m_packet_length;
+    m_sweep.tx_power      = m_tx_power;
+
+    m_sweep_report[0] = DTM_SWEEP_REPORT_VERSION;
+    m_sweep_report[1] = rx;
+    (void)uint16_encode(0, &m_sweep_report[2]);
+    (void)uint16_encode(m_sweep.p_config->packets, &m_sweep_report[4]);
+
+    m_sweep.running = true;
+
+    err_code = sweep_step_start();
+    if (err_code != DTM_SUCCESS)
+    {
+        dtm_test_done();
+        sweep_stop();
+        m_sweep.report_ready = false;
+    }
+
+    return err_code;
+}
+
+
+bool dtm_sweep_report_get(uint8_t const ** pp_report, uint32_t * p_len)
+{
+    bool was_new = m_sweep.report_ready;
+
+    m_sweep.report_ready = false;
+    *pp_report = m_sweep_report;
+    *p_len     = DTM_SWEEP_REPORT_HEADER_SIZE +
+                 uint16_decode(&m_sweep_report[2]) * DTM_SWEEP_RECORD_SIZE;
+
+    return was_new;
+}
+#endif // DTM_SWEEP_ENABLED
+
+
 uint32_t dtm_init(void)
 {
     if ((timer_init() != DTM_SUCCESS) || (radio_init() != DTM_SUCCESS))
@@ -1556,6 +1913,9 @@ uint32_t dtm_wait(void)
             // Reset timeout event flag for next iteration.
             nrf_timer_event_clear(mp_timer,
                               nrf_timer_compare_event_get(NRF_TIMER_CC_CHANNEL1));
+#if DTM_SWEEP_ENABLED
+            sweep_process();
+#endif
             return ++m_current_time;
         }
 
@@ -1580,6 +1940,14 @@ uint32_t dtm_cmd(uint16_t cmd)
         return DTM_ERROR_UNINITIALIZED;
     }
 
+#if DTM_SWEEP_ENABLED
+    if (m_sweep.running && ((command == LE_TEST_SETUP) || (command == LE_TEST_END)))
+    {
+        // The steps completed so far are kept in the report.
+        sweep_stop();
+    }
+#endif // DTM_SWEEP_ENABLED
+
     if (command == LE_TEST_SETUP)
     {
         uint8_t control = (cmd >> 8) & 0x3F;
@@ -1741,9 +2109,9 @@ static void radio_end_event_process(void)
 
 #if defined(NRF21540_DRIVER_ENABLE) && (NRF21540_DRIVER_ENABLE == 1)
         (void) nrf21540_rx_set(NRF21540_EXECUTE_NOW, NRF21540_EXEC_MODE_NON_BLOCKING);
-#else
-        nrf_radio_task_trigger(NRF_RADIO_TASK_RXEN);
 #endif
+        // Otherwise the DISABLED_RXEN shortcut has already re-armed the receiver. The buffer was
+        // swapped above, well before the ramp-up ends and the next packet can start.
         if (anomaly_172_wa_enabled)
         {
             nrf_timer_cc_write(ANOMALY_172_TIMER, NRF_TIMER_CC_CHANNEL0, BLOCKER_FIX_WAIT_DEFAULT);
@@ -1765,6 +2133,12 @@ static void radio_end_event_process(void)
         {
             // Count the number of successfully received packets
             m_rx_pkt_count++;
+#if DTM_SWEEP_ENABLED
+            if (m_sweep.running)
+            {
+                sweep_rssi_add();
+            }
+#endif // DTM_SWEEP_ENABLED
         }
 
         // Zero fill all pdu fields to avoid stray data
@@ -1814,6 +2188,13 @@ void DTM_TIMER_IRQHandler(void)
     {
         nrf_timer_event_clear(mp_timer,
                               nrf_timer_compare_event_get(NRF_TIMER_CC_CHANNEL0));
+
+#if DTM_SWEEP_ENABLED
+        if (m_sweep.running)
+        {
+            m_sweep.intervals++;
+        }
+#endif // DTM_SWEEP_ENABLED
         
 #if defined(NRF21540_DRIVER_ENABLE) && (NRF21540_DRIVER_ENABLE == 1)
         if (m_state == STATE_TRANSMITTER_TEST)
@@ -161,6 +161,7 @@ typedef uint32_t dtm_cmd_t;                                                 /**<
 #define CARRIER_TEST_STUDIO             1                                   /**< nRFgo Studio uses value 1 in length field, to indicate a constant, unmodulated carrier until LE_TEST_END or LE_RESET */
 #define SET_TX_POWER                    2                                   /**< Set transmission power, value -40..+4 dBm in steps of 4 */
 #define SET_NRF21540_TX_POWER           4                                   /**< Set nRF21540 transmission power level. Choose between two predefinied option +20 dBm or +10 dBm. */
+#define START_SWEEP                     5                                   /**< Start the sweep set with dtm_sweep_config_set(). Option 0 transmits, 1 receives. */
 
 #define LE_PACKET_REPORTING_EVENT       0x8000                              /**< DTM Packet reporting event, returned by the device to the tester. */
 #define LE_TEST_STATUS_EVENT_SUCCESS    0x0000                              /**< DTM Status event, indicating success. */
@@ -257,6 +258,31 @@ typedef enum
 } dtm_nrf21540_power_mode_t;
 
 
+/**@brief BLE DTM sweep configuration.
+ *
+ * @details A sweep runs one test step for every combination of the lists. The channel changes
+ *          fastest, followed by the length, the TX power and the PHY. Each step lasts @p packets
+ *          packet intervals of its length and PHY.
+ *
+ *          A receiving sweep counts the packets of a reference transmitter running the same
+ *          sweep and samples the RSSI of each valid packet. Both sides must be started at the
+ *          same time, and a packet may be lost on each step boundary.
+ */
+typedef struct
+{
+    uint8_t const * p_channels;                                        /**< Physical channels, 0..39. */
+    uint8_t         channel_cnt;                                       /**< Number of channels. */
+    uint8_t const * p_phys;                                            /**< PHYs, coded as the parameter of LE_TEST_SETUP_SET_PHY. */
+    uint8_t         phy_cnt;                                           /**< Number of PHYs. */
+    uint8_t const * p_lengths;                                         /**< Payload lengths, 0..255. */
+    uint8_t         length_cnt;                                        /**< Number of lengths. */
+    int8_t const  * p_tx_powers;                                       /**< TX powers in dBm. */
+    uint8_t         tx_power_cnt;                                      /**< Number of TX powers. */
+    dtm_pkt_type_t  pkt_type;                                          /**< Payload bit pattern, one of DTM_PKT_PRBS9, DTM_PKT_0X0F or DTM_PKT_0X55. */
+    uint16_t        packets;                                           /**< Packet intervals per step. */
+} dtm_sweep_config_t;
+
+
 /**@brief Function for initializing or re-initializing DTM module
  *
  * @return DTM_SUCCESS on successful initialization of the DTM module.
@@ -322,6 +348,49 @@ bool dtm_set_txpower(uint32_t new_tx_power);
 bool dtm_set_nrf21450_power_mode(dtm_nrf21540_power_mode_t power_mode);
 
 
+/**@brief Function for setting the sweep to run on START_SWEEP.
+ *
+ * @note        The configuration and its lists must stay valid while the sweep runs.
+ *
+ * @param[in]   p_config   Sweep configuration.
+ *
+ * @return      DTM_SUCCESS or one of the DTM_ERROR_ values
+ */
+uint32_t dtm_sweep_config_set(dtm_sweep_config_t const * p_config);
+
+
+/**@brief Function for starting the configured sweep.
+ *
+ * @details The sweep is stepped forward by dtm_wait(). When it completes, a new
+ *          LE_PACKET_REPORTING_EVENT carries the number of steps run. LE_TEST_END or
+ *          any LE_TEST_SETUP command aborts the sweep. The PHY of the last step stays set.
+ *
+ * @note        Must be called when no DTM test is running.
+ *
+ * @param[in]   rx   true to receive, false to transmit.
+ *
+ * @return      DTM_SUCCESS or one of the DTM_ERROR_ values
+ */
+uint32_t dtm_sweep_start(bool rx);
+
+
+/**@brief Function for reading the report of the last sweep.
+ *
+ * @details The report starts with a 6 byte header: report version, 1 for a receiving sweep,
+ *          the number of completed steps (uint16) and the packet intervals per step (uint16).
+ *          Each step then has an 11 byte record: channel, PHY, length, TX power (int8),
+ *          packet count (uint16), packet error rate in 1/1000 (uint16), and the mean, minimum
+ *          and maximum RSSI in -dBm. The PER and RSSI are 0 for a transmitting sweep.
+ *          Multi-byte fields are little endian.
+ *
+ * @param[out]  pp_report  Pointer to the report.
+ * @param[out]  p_len      Length of the report in bytes.
+ *
+ * @return      true: a new report has been completed since the last call, false otherwise
+ */
+bool dtm_sweep_report_get(uint8_t const ** pp_report, uint32_t * p_len);
+
+
 #ifdef __cplusplus
 }
 #endif
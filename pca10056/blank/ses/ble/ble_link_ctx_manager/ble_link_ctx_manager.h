@@ -57,11 +57,18 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include "ble.h"
 #include "ble_conn_state.h"
+#include "app_util.h"
 #include "sdk_errors.h"
 
 
 /**@brief Macro for defining a blcm_link_ctx_storage instance.
+ *
+ * @details The contexts are laid out back to back in a word-aligned pool, with a stride fixed at
+ *          compile time to @p _link_ctx_size rounded up to whole words. The context of a
+ *          connection index is then found with a single multiply-add, see
+ *          @ref blcm_link_ctx_idx_get.
  *
  * @param[in]   _name            Name of the instance.
  * @param[in]   _max_clients     Maximum number of clients connected at a time.
@@ -118,6 +125,53 @@ ret_code_t blcm_link_ctx_get(blcm_link_ctx_storage_t const * const p_link_ctx_st
                              void                         ** const pp_ctx_data);
 
 
+/**
+ * @brief Function for getting the link context of a connection index.
+ *
+ * Unlike @ref blcm_link_ctx_get, this function does not translate a connection handle. Use it with
+ * an index obtained once from @ref ble_conn_state_conn_idx and kept for the connection. The storage
+ * must be defined with @ref BLE_LINK_CTX_MANAGER_DEF, which makes its layout valid by construction,
+ * so only the index is checked.
+ *
+ * @param[in]  p_link_ctx_storage  Pointer to the link storage descriptor.
+ * @param[in]  conn_idx            Index of the connection whose context to find.
+ *
+ * @return  Pointer to the context of the connection, or NULL if \p conn_idx is not smaller than
+ *          \p p_link_ctx_storage::max_links_cnt.
+ */
+__STATIC_INLINE void * blcm_link_ctx_idx_get(blcm_link_ctx_storage_t const * const p_link_ctx_storage,
+                                             uint16_t                        const conn_idx)
+{
+    if (conn_idx >= p_link_ctx_storage->max_links_cnt)
+    {
+        return NULL;
+    }
+
+    return (uint8_t *)p_link_ctx_storage->p_ctx_data_pool + conn_idx * p_link_ctx_storage->link_ctx_size;
+}
+
+
+/**
+ * @brief Function for getting the link context of the connection a BLE event refers to.
+ *
+ * Intended for the event handlers of services. Every GAP, GATT and L2CAP event carries the
+ * connection handle of its link first, and the link of an event being dispatched is always
+ * recorded by the Connection State module, whose observer runs first. The handle is then its own
+ * connection index (see @ref ble_conn_state_conn_idx), so the lookup skips the translation.
+ *
+ * @param[in]  p_link_ctx_storage  Pointer to the link storage descriptor.
+ * @param[in]  p_ble_evt           Event received from the BLE stack, referring to a connection.
+ *
+ * @return  Pointer to the context of the connection, or NULL if the event does not refer to a
+ *          connection that fits in the storage.
+ */
+__STATIC_INLINE void * blcm_link_ctx_evt_get(blcm_link_ctx_storage_t const * const p_link_ctx_storage,
+                                             ble_evt_t               const * const p_ble_evt)
+{
+    return blcm_link_ctx_idx_get(p_link_ctx_storage, p_ble_evt->evt.gap_evt.conn_handle);
+}
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -84,4 +84,86 @@ uint8_t ble_racp_encode(const ble_racp_value_t * p_racp_val, uint8_t * p_data)
 
     return len;
 }
+
+
+bool ble_racp_filter_type_get(ble_racp_value_t const * p_racp_val, uint8_t * p_filter_type)
+{
+    if (p_racp_val->operand_len == 0)
+    {
+        return false;
+    }
+
+    *p_filter_type = p_racp_val->p_operand[0];
+
+    return true;
+}
+
+
+bool ble_racp_filter_params_get(ble_racp_value_t const * p_racp_val,
+                                uint8_t                  param_size,
+                                uint8_t const         ** pp_min,
+                                uint8_t const         ** pp_max)
+{
+    bool has_min = (p_racp_val->operator == RACP_OPERATOR_GREATER_OR_EQUAL) ||
+                   (p_racp_val->operator == RACP_OPERATOR_RANGE);
+    bool has_max = (p_racp_val->operator == RACP_OPERATOR_LESS_OR_EQUAL) ||
+                   (p_racp_val->operator == RACP_OPERATOR_RANGE);
+
+    if ((!has_min && !has_max) ||
+        (p_racp_val->operand_len != 1 + (has_min + has_max) * param_size))
+    {
+        return false;
+    }
+
+    // The minimum comes first if there are both.
+    if (pp_min != NULL)
+    {
+        *pp_min = has_min ? &p_racp_val->p_operand[1] : NULL;
+    }
+    if (pp_max != NULL)
+    {
+        *pp_max = has_max ? &p_racp_val->p_operand[1 + (has_min ? param_size : 0)] : NULL;
+    }
+
+    return true;
+}
+
+
+bool ble_racp_filter_uint16_range_get(ble_racp_value_t const * p_racp_val,
+                                      uint16_t               * p_min,
+                                      uint16_t               * p_max)
+{
+    uint8_t const * p_min_field;
+    uint8_t const * p_max_field;
+
+    if (!ble_racp_filter_params_get(p_racp_val, sizeof(uint16_t), &p_min_field, &p_max_field))
+    {
+        return false;
+    }
+
+    *p_min = (p_min_field != NULL) ? uint16_decode(p_min_field) : 0;
+    *p_max = (p_max_field != NULL) ? uint16_decode(p_max_field) : UINT16_MAX;
+
+    return true;
+}
+
+
+uint8_t ble_racp_response_code_encode(uint8_t request_opcode, uint8_t response_code, uint8_t * p_data)
+{
+    p_data[0] = RACP_OPCODE_RESPONSE_CODE;
+    p_data[1] = RACP_OPERATOR_NULL;
+    p_data[2] = request_opcode;
+    p_data[3] = response_code;
+
+    return BLE_RACP_RESPONSE_LEN;
+}
+
+
+uint8_t ble_racp_num_recs_response_encode(uint16_t num_records, uint8_t * p_data)
+{
+    p_data[0] = RACP_OPCODE_NUM_RECS_RESPONSE;
+    p_data[1] = RACP_OPERATOR_NULL;
+
+    return 2 + uint16_encode(num_records, &p_data[2]);
+}
 #endif // NRF_MODULE_ENABLED(BLE_RACP)
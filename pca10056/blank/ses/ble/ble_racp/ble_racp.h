@@ -92,6 +92,8 @@ extern "C" {
 #define RACP_RESPONSE_PROCEDURE_NOT_DONE     8       /**< Record Access Control Point response code - Procedure could not be completed. */
 #define RACP_RESPONSE_OPERAND_UNSUPPORTED    9       /**< Record Access Control Point response code - Unsupported operand. */
 
+#define BLE_RACP_RESPONSE_LEN                4       /**< Length of an encoded Response Code or Number of Stored Records response. */
+
 /**@brief Record Access Control Point value structure. */
 typedef struct
 {
@@ -125,6 +127,69 @@ void ble_racp_decode(uint8_t data_len, uint8_t const * p_data, ble_racp_value_t
  */
 uint8_t ble_racp_encode(const ble_racp_value_t * p_racp_val, uint8_t * p_data);
 
+/**@brief Function for getting the filter type of a decoded Record Access Control Point write.
+ *
+ * @param[in]   p_racp_val      Decoded Record Access Control Point write.
+ * @param[out]  p_filter_type   Filter type, the first byte of the operand.
+ *
+ * @return      true if the operand has a filter type, false if it is empty.
+ */
+bool ble_racp_filter_type_get(ble_racp_value_t const * p_racp_val, uint8_t * p_filter_type);
+
+/**@brief Function for getting the filter parameters of a decoded Record Access Control Point write.
+ *
+ * @details The parameters are returned as pointers into the operand, which follow the filter
+ *          type. RACP_OPERATOR_LESS_OR_EQUAL has a maximum only, RACP_OPERATOR_GREATER_OR_EQUAL
+ *          a minimum only and RACP_OPERATOR_RANGE both. A parameter that the operator does not
+ *          have is set to NULL.
+ *
+ * @param[in]   p_racp_val   Decoded Record Access Control Point write.
+ * @param[in]   param_size   Size of one filter parameter, which depends on the filter type.
+ * @param[out]  pp_min       Minimum, or NULL if not needed.
+ * @param[out]  pp_max       Maximum, or NULL if not needed.
+ *
+ * @return      true if the operator takes filter parameters and the operand has exactly the
+ *              filter type and the parameters it needs, false otherwise.
+ */
+bool ble_racp_filter_params_get(ble_racp_value_t const * p_racp_val,
+                                uint8_t                  param_size,
+                                uint8_t const         ** pp_min,
+                                uint8_t const         ** pp_max);
+
+/**@brief Function for getting a 16-bit filter range, such as a sequence number or time offset range.
+ *
+ * @details A bound that the operator does not have is set to 0 for the minimum and to
+ *          UINT16_MAX for the maximum.
+ *
+ * @param[in]   p_racp_val   Decoded Record Access Control Point write.
+ * @param[out]  p_min        Lowest value in the range.
+ * @param[out]  p_max        Highest value in the range.
+ *
+ * @return      true if the operand holds a valid 16-bit filter for the operator, false otherwise.
+ */
+bool ble_racp_filter_uint16_range_get(ble_racp_value_t const * p_racp_val,
+                                      uint16_t               * p_min,
+                                      uint16_t               * p_max);
+
+/**@brief Function for encoding a Response Code response directly into an indication buffer.
+ *
+ * @param[in]   request_opcode   Op code of the request that is responded to.
+ * @param[in]   response_code    Response code.
+ * @param[out]  p_data           Buffer of at least @ref BLE_RACP_RESPONSE_LEN bytes.
+ *
+ * @return      Length of encoded data.
+ */
+uint8_t ble_racp_response_code_encode(uint8_t request_opcode, uint8_t response_code, uint8_t * p_data);
+
+/**@brief Function for encoding a Number of Stored Records response directly into an indication buffer.
+ *
+ * @param[in]   num_records   Number of records.
+ * @param[out]  p_data        Buffer of at least @ref BLE_RACP_RESPONSE_LEN bytes.
+ *
+ * @return      Length of encoded data.
+ */
+uint8_t ble_racp_num_recs_response_encode(uint16_t num_records, uint8_t * p_data);
+
 
 #ifdef __cplusplus
 }
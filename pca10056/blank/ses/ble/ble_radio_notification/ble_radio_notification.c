@@ -37,6 +37,7 @@
  * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  */
+#include "sdk_common.h"
 #include "ble_radio_notification.h"
 #include "nrf_nvic.h"
 #include <stdlib.h>
@@ -45,6 +46,43 @@
 static bool                                 m_radio_active = false;  /**< Current radio state. */
 static ble_radio_notification_evt_handler_t m_evt_handler  = NULL;   /**< Application event handler for handling Radio Notification events. */
 
+#if NRF_MODULE_ENABLED(BLE_RADIO_NOTIFICATION_SCHED)
+/**@brief Time (in us) from the Active event to the radio start, for each NRF_RADIO_NOTIFICATION_DISTANCE_ value. */
+static uint16_t const m_distance_us[] =
+{
+    0, 800, 1740, 2680, 3620, 4560, 5500
+};
+
+static ble_radio_notification_task_t * mp_tasks           = NULL; /**< Registered tasks. */
+static uint16_t                        m_before_budget_us = 0;    /**< Time given to the tasks before each radio event. */
+
+
+/**@brief Function for running the pending tasks of a slot that fit in its time budget.
+ *
+ * @param[in]  slot       Slot that has started.
+ * @param[in]  budget_us  Time available in the slot.
+ */
+static void slot_run(ble_radio_notification_slot_t slot, uint32_t budget_us)
+{
+    for (ble_radio_notification_task_t * p_task = mp_tasks; p_task != NULL; p_task = p_task->p_next)
+    {
+        if ((p_task->slot != slot) || !p_task->pending || (p_task->budget_us > budget_us))
+        {
+            continue;
+        }
+
+        budget_us -= p_task->budget_us;
+
+        // Cleared first so that a request made while the handler runs is not lost.
+        p_task->pending = false;
+        if (p_task->handler(p_task->p_context))
+        {
+            p_task->pending = true;
+        }
+    }
+}
+#endif // NRF_MODULE_ENABLED(BLE_RADIO_NOTIFICATION_SCHED)
+
 
 void SWI1_IRQHandler(void)
 {
@@ -53,6 +91,18 @@ void SWI1_IRQHandler(void)
     {
         m_evt_handler(m_radio_active);
     }
+
+#if NRF_MODULE_ENABLED(BLE_RADIO_NOTIFICATION_SCHED)
+    if (m_radio_active)
+    {
+        slot_run(BLE_RADIO_NOTIFICATION_SLOT_BEFORE_RADIO, m_before_budget_us);
+    }
+    else
+    {
+        slot_run(BLE_RADIO_NOTIFICATION_SLOT_AFTER_RADIO,
+                 BLE_RADIO_NOTIFICATION_SCHED_IDLE_BUDGET_US);
+    }
+#endif // NRF_MODULE_ENABLED(BLE_RADIO_NOTIFICATION_SCHED)
 }
 
 
@@ -64,6 +114,10 @@ uint32_t ble_radio_notification_init(uint32_t                             irq_pr
 
     m_evt_handler = evt_handler;
 
+#if NRF_MODULE_ENABLED(BLE_RADIO_NOTIFICATION_SCHED)
+    m_before_budget_us = (distance < ARRAY_SIZE(m_distance_us)) ? m_distance_us[distance] : 0;
+#endif
+
     // Initialize Radio Notification software interrupt
     err_code = sd_nvic_ClearPendingIRQ(SWI1_IRQn);
     if (err_code != NRF_SUCCESS)
@@ -86,3 +140,39 @@ uint32_t ble_radio_notification_init(uint32_t                             irq_pr
     // Configure the event
     return sd_radio_notification_cfg_set(NRF_RADIO_NOTIFICATION_TYPE_INT_ON_BOTH, distance);
 }
+
+
+#if NRF_MODULE_ENABLED(BLE_RADIO_NOTIFICATION_SCHED)
+uint32_t ble_radio_notification_task_register(ble_radio_notification_task_t * p_task)
+{
+    ble_radio_notification_task_t ** pp_last = &mp_tasks;
+
+    VERIFY_PARAM_NOT_NULL(p_task);
+    VERIFY_PARAM_NOT_NULL(p_task->handler);
+
+    if ((p_task->slot != BLE_RADIO_NOTIFICATION_SLOT_BEFORE_RADIO) &&
+        (p_task->slot != BLE_RADIO_NOTIFICATION_SLOT_AFTER_RADIO))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_task->pending = false;
+    p_task->p_next  = NULL;
+
+    while (*pp_last != NULL)
+    {
+        pp_last = &(*pp_last)->p_next;
+    }
+
+    // Appending is a single store, so the list stays valid for a concurrent SWI1 interrupt.
+    *pp_last = p_task;
+
+    return NRF_SUCCESS;
+}
+
+
+void ble_radio_notification_task_request(ble_radio_notification_task_t * p_task)
+{
+    p_task->pending = true;
+}
+#endif // NRF_MODULE_ENABLED(BLE_RADIO_NOTIFICATION_SCHED)
@@ -43,6 +43,12 @@
  * @{
  * @ingroup ble_sdk_lib
  * @brief Module for propagating Radio Notification events to the application.
+ *
+ * @details With BLE_RADIO_NOTIFICATION_SCHED_ENABLED, tasks can also be registered to run in the
+ *          Radio Notification interrupt, either just before the radio becomes active (for example
+ *          to fill the notification queue for the next connection event) or between radio events
+ *          (CPU-heavy work such as buffer processing). Each task declares the longest time it
+ *          runs, and a slot only runs the pending tasks that fit in its remaining time.
  */
 
 #ifndef BLE_RADIO_NOTIFICATION_H__
@@ -59,6 +65,32 @@ extern "C" {
 /**@brief Application radio notification event handler type. */
 typedef void (*ble_radio_notification_evt_handler_t) (bool radio_active);
 
+/**@brief Slots in which a task can run. */
+typedef enum
+{
+    BLE_RADIO_NOTIFICATION_SLOT_BEFORE_RADIO, /**< Run on the Active event, in the distance before the radio is used. */
+    BLE_RADIO_NOTIFICATION_SLOT_AFTER_RADIO,  /**< Run on the nACTIVE event, between radio events. */
+} ble_radio_notification_slot_t;
+
+/**@brief Task handler type.
+ *
+ * @param[in] p_context  Context of the task.
+ *
+ * @return true if the task has more work and should run again in the next slot.
+ */
+typedef bool (*ble_radio_notification_task_handler_t) (void * p_context);
+
+/**@brief Task run between radio events. Must stay allocated once registered. */
+typedef struct ble_radio_notification_task_s
+{
+    ble_radio_notification_task_handler_t  handler;   /**< Task handler. */
+    void                                 * p_context; /**< Context passed to the handler. */
+    ble_radio_notification_slot_t          slot;      /**< Slot in which the task runs. */
+    uint16_t                               budget_us; /**< Longest time the handler runs, in microseconds. */
+    volatile bool                          pending;   /**< Internal. The task is waiting for a slot. */
+    struct ble_radio_notification_task_s * p_next;    /**< Internal. Next task in the list. */
+} ble_radio_notification_task_t;
+
 /**@brief Function for initializing the Radio Notification module.
  *
  * @param[in]  irq_priority   Interrupt priority for the Radio Notification interrupt handler.
@@ -73,6 +105,33 @@ uint32_t ble_radio_notification_init(uint32_t                             irq_pr
                                      ble_radio_notification_evt_handler_t evt_handler);
 
 
+/**@brief Function for registering a task.
+ *
+ * @details Tasks of a slot run in the order they were registered. A task that does not fit in
+ *          what is left of a slot waits for the next one, while later, shorter tasks may still run.
+ *          Tasks in the BLE_RADIO_NOTIFICATION_SLOT_BEFORE_RADIO slot only run if the distance
+ *          given to @ref ble_radio_notification_init is not NRF_RADIO_NOTIFICATION_DISTANCE_NONE.
+ *
+ * @note       A task must only be registered once.
+ *
+ * @param[in]  p_task   Task to register, with handler, p_context, slot and budget_us set.
+ *
+ * @retval NRF_SUCCESS             If the task was registered.
+ * @retval NRF_ERROR_NULL          If p_task or its handler is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If the slot is invalid.
+ */
+uint32_t ble_radio_notification_task_register(ble_radio_notification_task_t * p_task);
+
+
+/**@brief Function for requesting that a registered task runs in its next slot.
+ *
+ * @details May be called from any context.
+ *
+ * @param[in]  p_task   Registered task.
+ */
+void ble_radio_notification_task_request(ble_radio_notification_task_t * p_task);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,7 @@
 
 #include "ancs_app_attr_get.h"
 #include "nrf_ble_ancs_c.h"
+#include "ancs_attr_cache.h"
 #include "sdk_macros.h"
 #include "nrf_log.h"
 #include "string.h"
@@ -383,6 +384,11 @@ uint32_t ancs_c_app_attr_request(ble_ancs_c_t          * p_ancs,
         return NRF_ERROR_INVALID_PARAM;
     }
 
+    if (ancs_attr_cache_app_attr_serve(p_ancs, p_app_id))
+    {
+        return NRF_SUCCESS;
+    }
+
     p_ancs->parse_info.parse_state = COMMAND_ID;
     err_code                       = app_attr_get(p_ancs, p_app_id, len);
     VERIFY_SUCCESS(err_code);
@@ -0,0 +1,479 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <string.h>
+#include "sdk_common.h"
+#include "ancs_attr_cache.h"
+#include "nrf_log.h"
+
+#define CACHE_DATA_MAX (BLE_ANCS_ATTR_DATA_MAX - 1) /**< Number of bytes of an attribute held in the cache. One byte of the buffer is left for the NUL terminator. */
+
+
+/**@brief Function for getting a new use stamp. Zero is reserved for free entries. */
+static uint32_t stamp_get(ble_ancs_c_t * p_ancs)
+{
+    if (++p_ancs->cache_stamp == 0)
+    {
+        p_ancs->cache_stamp = 1;
+    }
+    return p_ancs->cache_stamp;
+}
+
+
+/**@brief Function for checking whether a cached attribute can stand in for a response from
+ *        the Notification Provider.
+ *
+ * @param[in] p_ancs   Pointer to an ANCS instance.
+ * @param[in] p_attr   Attribute as registered by the application.
+ * @param[in] attr_len Length of the attribute as reported by the Notification Provider.
+ * @param[in] len      Number of bytes of the attribute held in the cache.
+ */
+static bool attr_is_complete(ble_ancs_c_t           const * p_ancs,
+                             ble_ancs_c_attr_list_t const * p_attr,
+                             uint16_t                       attr_len,
+                             uint8_t                        len)
+{
+    if (p_ancs->attr_streaming)
+    {
+        return (len == attr_len);
+    }
+    // The parser hands over no more than the buffer minus the NUL terminator.
+    return (len >= MIN(attr_len, p_attr->attr_len - 1));
+}
+
+
+/**@brief Function for copying attribute data into a cache entry.
+ *
+ * @param[in]    p_evt    Event carrying the attribute data.
+ * @param[in]    p_attr   Attribute as registered by the application.
+ * @param[out]   p_data   Cached attribute data.
+ * @param[inout] p_len    Number of bytes held in @p p_data.
+ */
+static void attr_copy(ble_ancs_c_evt_t       const * p_evt,
+                      ble_ancs_c_attr_list_t const * p_attr,
+                      uint8_t                      * p_data,
+                      uint8_t                      * p_len)
+{
+    uint32_t len;
+
+    if (p_evt->evt_type == BLE_ANCS_C_EVT_ATTR_SLICE)
+    {
+        if (p_evt->slice.offset == 0)
+        {
+            *p_len = 0;
+        }
+        if (   (p_evt->slice.len != 0)
+            && (p_evt->slice.offset == *p_len)
+            && (p_evt->slice.offset < CACHE_DATA_MAX))
+        {
+            len = MIN(p_evt->slice.len, CACHE_DATA_MAX - p_evt->slice.offset);
+            memcpy(&p_data[p_evt->slice.offset], p_evt->slice.p_data, len);
+            *p_len = (uint8_t)(p_evt->slice.offset + len);
+        }
+        return;
+    }
+
+    len = 0;
+    if ((p_evt->attr.p_attr_data != NULL) && (p_attr->attr_len != 0))
+    {
+        len = MIN(MIN(p_evt->attr.attr_len, p_attr->attr_len - 1), CACHE_DATA_MAX);
+        memcpy(p_data, p_evt->attr.p_attr_data, len);
+    }
+    *p_len = (uint8_t)len;
+}
+
+
+/**@brief Function for passing a cached attribute to the application.
+ *
+ * @details The event looks the same as the one the attribute parser would produce on receiving
+ *          the attribute from the Notification Provider.
+ *
+ * @param[in] p_ancs     Pointer to an ANCS instance.
+ * @param[in] p_evt      Event to fill. The notification UID or app identifier must be set.
+ * @param[in] command_id Command that the attribute belongs to.
+ * @param[in] p_attr     Attribute as registered by the application.
+ * @param[in] attr_id    ID of the attribute.
+ * @param[in] attr_len   Length of the attribute as reported by the Notification Provider.
+ * @param[in] p_data     Cached attribute data.
+ */
+static void attr_send(ble_ancs_c_t                 * p_ancs,
+                      ble_ancs_c_evt_t             * p_evt,
+                      ble_ancs_c_cmd_id_val_t        command_id,
+                      ble_ancs_c_attr_list_t const * p_attr,
+                      uint32_t                       attr_id,
+                      uint16_t                       attr_len,
+                      uint8_t const                * p_data)
+{
+    p_evt->attr.attr_id     = attr_id;
+    p_evt->attr.attr_len    = attr_len;
+    p_evt->attr.p_attr_data = p_attr->p_attr_data;
+
+    if (p_ancs->attr_streaming)
+    {
+        p_evt->evt_type         = BLE_ANCS_C_EVT_ATTR_SLICE;
+        p_evt->slice.command_id = command_id;
+        p_evt->slice.offset     = 0;
+        p_evt->slice.len        = attr_len;
+        p_evt->slice.p_data     = p_data;
+        p_evt->slice.last       = true;
+    }
+    else
+    {
+        uint16_t len = MIN(attr_len, p_attr->attr_len - 1);
+
+        p_evt->evt_type = (command_id == BLE_ANCS_COMMAND_ID_GET_APP_ATTRIBUTES)
+                          ? BLE_ANCS_C_EVT_APP_ATTRIBUTE
+                          : BLE_ANCS_C_EVT_NOTIF_ATTRIBUTE;
+
+        memcpy(p_attr->p_attr_data, p_data, len);
+        p_attr->p_attr_data[len] = '\0';
+    }
+
+    p_ancs->evt_handler(p_evt);
+}
+
+
+#if BLE_ANCS_C_APP_ATTR_CACHE_SIZE > 0
+
+/**@brief Function for finding the cache entry of an app.
+ *
+ * @param[in] p_ancs   Pointer to an ANCS instance.
+ * @param[in] p_app_id NUL-terminated app identifier.
+ * @param[in] alloc    If true and the app is not cached, the least recently used entry is
+ *                     taken over for it.
+ *
+ * @return Pointer to the entry, or NULL if there is none.
+ */
+static ble_ancs_c_app_cache_entry_t * app_entry_get(ble_ancs_c_t  * p_ancs,
+                                                    uint8_t const * p_app_id,
+                                                    bool            alloc)
+{
+    ble_ancs_c_app_cache_entry_t * p_lru = &p_ancs->app_cache[0];
+    size_t                         len   = strnlen((char const *)p_app_id, BLE_ANCS_ATTR_DATA_MAX);
+
+    if (len == BLE_ANCS_ATTR_DATA_MAX)
+    {
+        // Too long to be cached.
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < BLE_ANCS_C_APP_ATTR_CACHE_SIZE; i++)
+    {
+        ble_ancs_c_app_cache_entry_t * p_entry = &p_ancs->app_cache[i];
+
+        if ((p_entry->stamp != 0) && (memcmp(p_entry->app_id, p_app_id, len + 1) == 0))
+        {
+            return p_entry;
+        }
+        if (p_entry->stamp < p_lru->stamp)
+        {
+            p_lru = p_entry;
+        }
+    }
+
+    if (!alloc)
+    {
+        return NULL;
+    }
+
+    memset(p_lru, 0, sizeof(ble_ancs_c_app_cache_entry_t));
+    memcpy(p_lru->app_id, p_app_id, len + 1);
+    p_lru->stamp = stamp_get(p_ancs);
+
+    return p_lru;
+}
+
+#endif // BLE_ANCS_C_APP_ATTR_CACHE_SIZE > 0
+
+
+#if BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE > 0
+
+/**@brief Function for finding the cache entry of an iOS notification.
+ *
+ * @param[in] p_ancs    Pointer to an ANCS instance.
+ * @param[in] notif_uid UID of the iOS notification.
+ * @param[in] alloc     If true and the notification is not cached, the least recently used
+ *                      entry is taken over for it.
+ *
+ * @return Pointer to the entry, or NULL if there is none.
+ */
+static ble_ancs_c_notif_cache_entry_t * notif_entry_get(ble_ancs_c_t * p_ancs,
+                                                        uint32_t       notif_uid,
+                                                        bool           alloc)
+{
+    ble_ancs_c_notif_cache_entry_t * p_lru = &p_ancs->notif_cache[0];
+
+    for (uint32_t i = 0; i < BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE; i++)
+    {
+        ble_ancs_c_notif_cache_entry_t * p_entry = &p_ancs->notif_cache[i];
+
+        if ((p_entry->stamp != 0) && (p_entry->notif_uid == notif_uid))
+        {
+            return p_entry;
+        }
+        if (p_entry->stamp < p_lru->stamp)
+        {
+            p_lru = p_entry;
+        }
+    }
+
+    if (!alloc)
+    {
+        return NULL;
+    }
+
+    memset(p_lru, 0, sizeof(ble_ancs_c_notif_cache_entry_t));
+    p_lru->notif_uid = notif_uid;
+    p_lru->stamp     = stamp_get(p_ancs);
+
+    return p_lru;
+}
+
+#endif // BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE > 0
+
+
+void ancs_attr_cache_store(ble_ancs_c_t * p_ancs, ble_ancs_c_evt_t const * p_evt)
+{
+    ble_ancs_c_cmd_id_val_t command_id;
+    uint32_t                attr_id = p_evt->attr.attr_id;
+
+    switch (p_evt->evt_type)
+    {
+        case BLE_ANCS_C_EVT_NOTIF_ATTRIBUTE:
+            command_id = BLE_ANCS_COMMAND_ID_GET_NOTIF_ATTRIBUTES;
+            break;
+
+        case BLE_ANCS_C_EVT_APP_ATTRIBUTE:
+            command_id = BLE_ANCS_COMMAND_ID_GET_APP_ATTRIBUTES;
+            break;
+
+        case BLE_ANCS_C_EVT_ATTR_SLICE:
+            command_id = p_evt->slice.command_id;
+            break;
+
+        default:
+            return;
+    }
+
+#if BLE_ANCS_C_APP_ATTR_CACHE_SIZE > 0
+    if (   (command_id == BLE_ANCS_COMMAND_ID_GET_APP_ATTRIBUTES)
+        && (attr_id == BLE_ANCS_APP_ATTR_ID_DISPLAY_NAME))
+    {
+        ble_ancs_c_app_cache_entry_t * p_entry = app_entry_get(p_ancs, p_evt->app_id, true);
+
+        if (p_entry != NULL)
+        {
+            p_entry->attr_len = p_evt->attr.attr_len;
+            attr_copy(p_evt, &p_ancs->ancs_app_attr_list[attr_id], p_entry->data, &p_entry->len);
+        }
+    }
+#endif
+
+#if BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE > 0
+    if (   (command_id == BLE_ANCS_COMMAND_ID_GET_NOTIF_ATTRIBUTES)
+        && (attr_id < BLE_ANCS_NB_OF_NOTIF_ATTR))
+    {
+        ble_ancs_c_notif_cache_entry_t * p_entry = notif_entry_get(p_ancs, p_evt->notif_uid, true);
+
+        p_entry->attr_len[attr_id] = p_evt->attr.attr_len;
+        attr_copy(p_evt, &p_ancs->ancs_notif_attr_list[attr_id], p_entry->data[attr_id], &p_entry->len[attr_id]);
+
+        if ((p_evt->evt_type != BLE_ANCS_C_EVT_ATTR_SLICE) || p_evt->slice.last)
+        {
+            p_entry->valid_mask |= (1UL << attr_id);
+        }
+        else
+        {
+            p_entry->valid_mask &= ~(1UL << attr_id);
+        }
+    }
+#endif
+
+    UNUSED_PARAMETER(p_ancs);
+    UNUSED_VARIABLE(command_id);
+    UNUSED_VARIABLE(attr_id);
+}
+
+
+bool ancs_attr_cache_app_attr_serve(ble_ancs_c_t * p_ancs, uint8_t const * p_app_id)
+{
+#if BLE_ANCS_C_APP_ATTR_CACHE_SIZE > 0
+    ble_ancs_c_attr_list_t const * p_attr = &p_ancs->ancs_app_attr_list[BLE_ANCS_APP_ATTR_ID_DISPLAY_NAME];
+    ble_ancs_c_app_cache_entry_t * p_entry;
+    ble_ancs_c_evt_t               evt;
+
+    for (uint32_t i = 0; i < BLE_ANCS_NB_OF_APP_ATTR; i++)
+    {
+        // Only the display name is cached.
+        if (p_ancs->ancs_app_attr_list[i].get && (i != BLE_ANCS_APP_ATTR_ID_DISPLAY_NAME))
+        {
+            return false;
+        }
+    }
+
+    p_entry = app_entry_get(p_ancs, p_app_id, false);
+
+    if (   (p_entry == NULL)
+        || !p_attr->get
+        || !attr_is_complete(p_ancs, p_attr, p_entry->attr_len, p_entry->len))
+    {
+        return false;
+    }
+
+    NRF_LOG_DEBUG("App attributes served from cache.");
+
+    p_entry->stamp = stamp_get(p_ancs);
+
+    memset(&evt, 0, sizeof(evt));
+    evt.conn_handle = p_ancs->conn_handle;
+    memcpy(evt.app_id, p_entry->app_id, sizeof(evt.app_id));
+
+    attr_send(p_ancs,
+              &evt,
+              BLE_ANCS_COMMAND_ID_GET_APP_ATTRIBUTES,
+              p_attr,
+              BLE_ANCS_APP_ATTR_ID_DISPLAY_NAME,
+              p_entry->attr_len,
+              p_entry->data);
+    return true;
+#else
+    UNUSED_PARAMETER(p_ancs);
+    UNUSED_PARAMETER(p_app_id);
+    return false;
+#endif
+}
+
+
+bool ancs_attr_cache_notif_attr_serve(ble_ancs_c_t * p_ancs, uint32_t notif_uid)
+{
+#if BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE > 0
+    ble_ancs_c_notif_cache_entry_t * p_entry = notif_entry_get(p_ancs, notif_uid, false);
+    ble_ancs_c_evt_t                 evt;
+    uint32_t                         requested = 0;
+
+    if (p_entry == NULL)
+    {
+        return false;
+    }
+
+    for (uint32_t attr = 0; attr < BLE_ANCS_NB_OF_NOTIF_ATTR; attr++)
+    {
+        ble_ancs_c_attr_list_t const * p_attr = &p_ancs->ancs_notif_attr_list[attr];
+
+        if (!p_attr->get)
+        {
+            continue;
+        }
+        if (   ((p_entry->valid_mask & (1UL << attr)) == 0)
+            || !attr_is_complete(p_ancs, p_attr, p_entry->attr_len[attr], p_entry->len[attr]))
+        {
+            return false;
+        }
+        requested++;
+    }
+
+    if (requested == 0)
+    {
+        return false;
+    }
+
+    NRF_LOG_DEBUG("Notification attributes served from cache.");
+
+    p_entry->stamp = stamp_get(p_ancs);
+
+    memset(&evt, 0, sizeof(evt));
+    evt.conn_handle = p_ancs->conn_handle;
+    evt.notif_uid   = notif_uid;
+
+    for (uint32_t attr = 0; attr < BLE_ANCS_NB_OF_NOTIF_ATTR; attr++)
+    {
+        if (p_ancs->ancs_notif_attr_list[attr].get)
+        {
+            attr_send(p_ancs,
+                      &evt,
+                      BLE_ANCS_COMMAND_ID_GET_NOTIF_ATTRIBUTES,
+                      &p_ancs->ancs_notif_attr_list[attr],
+                      attr,
+                      p_entry->attr_len[attr],
+                      p_entry->data[attr]);
+        }
+    }
+    return true;
+#else
+    UNUSED_PARAMETER(p_ancs);
+    UNUSED_PARAMETER(notif_uid);
+    return false;
+#endif
+}
+
+
+void ancs_attr_cache_notif_remove(ble_ancs_c_t * p_ancs, uint32_t notif_uid)
+{
+#if BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE > 0
+    ble_ancs_c_notif_cache_entry_t * p_entry = notif_entry_get(p_ancs, notif_uid, false);
+
+    if (p_entry != NULL)
+    {
+        p_entry->stamp = 0;
+    }
+#else
+    UNUSED_PARAMETER(p_ancs);
+    UNUSED_PARAMETER(notif_uid);
+#endif
+}
+
+
+void ancs_attr_cache_notif_clear(ble_ancs_c_t * p_ancs)
+{
+#if BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE > 0
+    memset(p_ancs->notif_cache, 0, sizeof(p_ancs->notif_cache));
+#else
+    UNUSED_PARAMETER(p_ancs);
+#endif
+}
+
+
+void ancs_attr_cache_app_clear(ble_ancs_c_t * p_ancs)
+{
+#if BLE_ANCS_C_APP_ATTR_CACHE_SIZE > 0
+    memset(p_ancs->app_cache, 0, sizeof(p_ancs->app_cache));
+#else
+    UNUSED_PARAMETER(p_ancs);
+#endif
+}
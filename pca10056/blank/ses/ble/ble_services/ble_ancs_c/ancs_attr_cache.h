@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef ANCS_ATTR_CACHE_H__
+#define ANCS_ATTR_CACHE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "nrf_ble_ancs_c.h"
+
+/** @file
+ *
+ * @addtogroup ble_ancs_c
+ * @{
+ */
+
+/**@brief Function for storing attribute data passed to the application.
+ *
+ * @details Called by the attribute parser for every @ref BLE_ANCS_C_EVT_NOTIF_ATTRIBUTE,
+ *          @ref BLE_ANCS_C_EVT_APP_ATTRIBUTE, and @ref BLE_ANCS_C_EVT_ATTR_SLICE event, before
+ *          the event is passed to the application.
+ *
+ * @param[in] p_ancs Pointer to an ANCS instance to which the event belongs.
+ * @param[in] p_evt  Event that is about to be passed to the application.
+ */
+void ancs_attr_cache_store(ble_ancs_c_t * p_ancs, ble_ancs_c_evt_t const * p_evt);
+
+/**@brief Function for answering an app attribute request from the cache.
+ *
+ * @param[in] p_ancs   Pointer to an ANCS instance.
+ * @param[in] p_app_id NUL-terminated app identifier.
+ *
+ * @retval true  If the requested attributes were passed to the event handler.
+ * @retval false If the attributes must be requested from the Notification Provider.
+ */
+bool ancs_attr_cache_app_attr_serve(ble_ancs_c_t * p_ancs, uint8_t const * p_app_id);
+
+/**@brief Function for answering a notification attribute request from the cache.
+ *
+ * @param[in] p_ancs    Pointer to an ANCS instance.
+ * @param[in] notif_uid UID of the iOS notification.
+ *
+ * @retval true  If the requested attributes were passed to the event handler.
+ * @retval false If the attributes must be requested from the Notification Provider.
+ */
+bool ancs_attr_cache_notif_attr_serve(ble_ancs_c_t * p_ancs, uint32_t notif_uid);
+
+/**@brief Function for dropping the cached attributes of an iOS notification.
+ *
+ * @param[in] p_ancs    Pointer to an ANCS instance.
+ * @param[in] notif_uid UID of the iOS notification.
+ */
+void ancs_attr_cache_notif_remove(ble_ancs_c_t * p_ancs, uint32_t notif_uid);
+
+/**@brief Function for dropping all cached notification attributes.
+ *
+ * @param[in] p_ancs Pointer to an ANCS instance.
+ */
+void ancs_attr_cache_notif_clear(ble_ancs_c_t * p_ancs);
+
+/**@brief Function for dropping all cached app attributes.
+ *
+ * @param[in] p_ancs Pointer to an ANCS instance.
+ */
+void ancs_attr_cache_app_clear(ble_ancs_c_t * p_ancs);
+
+/** @} */
+
+#endif // ANCS_ATTR_CACHE_H__
@@ -41,8 +41,11 @@
  * Server implementations such as the ones found in iOS can be changed at any time by Apple and may cause this client implementation to stop working.
  */
 
+ #include <string.h>
+ #include "sdk_common.h"
  #include "nrf_ble_ancs_c.h"
  #include "ancs_attr_parser.h"
+ #include "ancs_attr_cache.h"
  #include "nrf_log.h"
 
 
@@ -65,6 +68,51 @@ static bool attr_is_requested(ble_ancs_c_t * p_ancs, ble_ancs_c_attr_t attr)
 }
 
 
+/**@brief Function for passing a parsed attribute to the application.
+ *
+ * @param[in] p_ancs  Pointer to an ANCS instance to which the event belongs.
+ */
+static void attr_evt_send(ble_ancs_c_t * p_ancs)
+{
+    ancs_attr_cache_store(p_ancs, &p_ancs->evt);
+    p_ancs->evt_handler(&p_ancs->evt);
+}
+
+
+/**@brief Function for passing one slice of the current attribute to the application.
+ *
+ * @param[in] p_ancs  Pointer to an ANCS instance to which the event belongs.
+ * @param[in] p_data  Pointer to the slice data inside the received GATTC notification.
+ * @param[in] len     Length of the slice.
+ */
+static void attr_slice_send(ble_ancs_c_t * p_ancs, const uint8_t * p_data, uint16_t len)
+{
+    ble_ancs_c_evt_type_t evt_type = p_ancs->evt.evt_type;
+
+    p_ancs->evt.slice.command_id = p_ancs->parse_info.command_id;
+    p_ancs->evt.slice.offset     = p_ancs->parse_info.current_attr_index;
+    p_ancs->evt.slice.len        = len;
+    p_ancs->evt.slice.p_data     = p_data;
+    p_ancs->evt.slice.last       = (p_ancs->parse_info.current_attr_index + len == p_ancs->evt.attr.attr_len);
+
+    p_ancs->evt.evt_type = BLE_ANCS_C_EVT_ATTR_SLICE;
+    ancs_attr_cache_store(p_ancs, &p_ancs->evt);
+    p_ancs->evt_handler(&p_ancs->evt);
+    p_ancs->evt.evt_type = evt_type;
+}
+
+
+/**@brief Function for finishing the current attribute and selecting the next parse state. */
+static ble_ancs_c_parse_state_t attr_done(ble_ancs_c_t * p_ancs)
+{
+    if (all_req_attrs_parsed(p_ancs))
+    {
+        return DONE;
+    }
+    return ATTR_ID;
+}
+
+
 /**@brief Function for parsing command id and notification id.
  *        Used in the @ref parse_get_notif_attrs_response state machine.
  *
@@ -217,6 +265,11 @@ static ble_ancs_c_parse_state_t attr_len2_parse(ble_ancs_c_t * p_ancs, const uin
 
     if (p_ancs->evt.attr.attr_len != 0)
     {
+        // In streaming mode, requested attributes are passed on as they arrive and need no buffer.
+        if (p_ancs->attr_streaming && attr_is_requested(p_ancs, p_ancs->evt.attr))
+        {
+            return ATTR_DATA;
+        }
         //If the attribute has a length but there is no allocated space for this attribute
         if ((p_ancs->parse_info.p_attr_list[p_ancs->evt.attr.attr_id].attr_len == 0) ||
            (p_ancs->parse_info.p_attr_list[p_ancs->evt.attr.attr_id].p_attr_data == NULL))
@@ -234,16 +287,16 @@ static ble_ancs_c_parse_state_t attr_len2_parse(ble_ancs_c_t * p_ancs, const uin
         NRF_LOG_DEBUG("Attribute LEN %i ", p_ancs->evt.attr.attr_len);
         if (attr_is_requested(p_ancs, p_ancs->evt.attr))
         {
-            p_ancs->evt_handler(&p_ancs->evt);
-        }
-        if (all_req_attrs_parsed(p_ancs))
-        {
-            return DONE;
-        }
-        else
-        {
-            return ATTR_ID;
+            if (p_ancs->attr_streaming)
+            {
+                attr_slice_send(p_ancs, NULL, 0);
+            }
+            else
+            {
+                attr_evt_send(p_ancs);
+            }
         }
+        return attr_done(p_ancs);
     }
 }
 
@@ -251,88 +304,113 @@ static ble_ancs_c_parse_state_t attr_len2_parse(ble_ancs_c_t * p_ancs, const uin
 /**@brief Function for parsing the data of an iOS attribute.
  *        Used in the @ref parse_get_notif_attrs_response state machine.
  *
- * @details Read the data of the attribute into our local buffer.
+ * @details Consume as much of the attribute as the current GATTC notification holds. In streaming
+ *          mode, the data is passed to the application as a slice of the notification. Otherwise,
+ *          it is copied into the attribute buffer, which is NUL-terminated once the attribute or
+ *          the buffer ends.
  *
  * @param[in] p_ancs     Pointer to an ANCS instance to which the event belongs.
  * @param[in] p_data_src Pointer to data that was received from the Notification Provider.
+ * @param[in] data_len   Length of the data that was received from the Notification Provider.
  * @param[in] index      Pointer to an index that helps us keep track of the current data to be parsed.
  *
  * @return The next parse state.
  */
 static ble_ancs_c_parse_state_t attr_data_parse(ble_ancs_c_t  * p_ancs,
                                                 const uint8_t * p_data_src,
+                                                uint32_t        data_len,
                                                 uint32_t      * index)
 {
-    // We have not reached the end of the attribute, nor our max allocated internal size.
-    // Proceed with copying data over to our buffer.
-    if (   (p_ancs->parse_info.current_attr_index < p_ancs->parse_info.p_attr_list[p_ancs->evt.attr.attr_id].attr_len)
-        && (p_ancs->parse_info.current_attr_index < p_ancs->evt.attr.attr_len))
+    uint16_t const attr_len = p_ancs->evt.attr.attr_len;
+    uint16_t       limit;
+    uint16_t       len;
+
+    if (p_ancs->attr_streaming)
+    {
+        len = MIN((uint32_t)(attr_len - p_ancs->parse_info.current_attr_index), data_len - *index);
+
+        attr_slice_send(p_ancs, &p_data_src[*index], len);
+
+        p_ancs->parse_info.current_attr_index += len;
+        *index                                += len;
+
+        if (p_ancs->parse_info.current_attr_index < attr_len)
+        {
+            return ATTR_DATA;
+        }
+        NRF_LOG_DEBUG("Attribute finished!");
+        return attr_done(p_ancs);
+    }
+
+    // Copy no further than the end of the attribute, leaving room for the NUL terminator.
+    limit = MIN(attr_len, (uint16_t)(p_ancs->parse_info.p_attr_list[p_ancs->evt.attr.attr_id].attr_len - 1));
+    len   = MIN((uint32_t)(limit - p_ancs->parse_info.current_attr_index), data_len - *index);
+
+    memcpy(&p_ancs->evt.attr.p_attr_data[p_ancs->parse_info.current_attr_index],
+           &p_data_src[*index],
+           len);
+
+    p_ancs->parse_info.current_attr_index += len;
+    *index                                += len;
+
+    if (p_ancs->parse_info.current_attr_index < limit)
     {
-        //NRF_LOG_DEBUG("Byte copied to buffer: %c", p_data_src[(*index)]); // Un-comment this line to see every byte of an attribute as it is parsed. Commented out by default since it can overflow the uart buffer.
-        p_ancs->evt.attr.p_attr_data[p_ancs->parse_info.current_attr_index++] = p_data_src[(*index)++];
+        return ATTR_DATA;
     }
 
     // We have reached the end of the attribute, or our max allocated internal size.
     // Stop copying data over to our buffer. NUL-terminate at the current index.
-    if ( (p_ancs->parse_info.current_attr_index == p_ancs->evt.attr.attr_len) ||
-         (p_ancs->parse_info.current_attr_index == p_ancs->parse_info.p_attr_list[p_ancs->evt.attr.attr_id].attr_len - 1))
+    if (attr_is_requested(p_ancs, p_ancs->evt.attr))
     {
-        if (attr_is_requested(p_ancs, p_ancs->evt.attr))
-        {
-            p_ancs->evt.attr.p_attr_data[p_ancs->parse_info.current_attr_index] = '\0';
-        }
+        p_ancs->evt.attr.p_attr_data[p_ancs->parse_info.current_attr_index] = '\0';
+    }
 
-        // If our max buffer size is smaller than the remaining attribute data, we must
-        // increase index to skip the data until the start of the next attribute.
-        if (p_ancs->parse_info.current_attr_index < p_ancs->evt.attr.attr_len)
-        {
-            return ATTR_SKIP;
-        }
-        NRF_LOG_DEBUG("Attribute finished!");
-        if (attr_is_requested(p_ancs, p_ancs->evt.attr))
-        {
-            p_ancs->evt_handler(&p_ancs->evt);
-        }
-        if (all_req_attrs_parsed(p_ancs))
-        {
-            return DONE;
-        }
-        else
-        {
-            return ATTR_ID;
-        }
+    // If our max buffer size is smaller than the remaining attribute data, we must
+    // skip the data until the start of the next attribute.
+    if (p_ancs->parse_info.current_attr_index < attr_len)
+    {
+        return ATTR_SKIP;
+    }
+    NRF_LOG_DEBUG("Attribute finished!");
+    if (attr_is_requested(p_ancs, p_ancs->evt.attr))
+    {
+        attr_evt_send(p_ancs);
     }
-    return ATTR_DATA;
+    return attr_done(p_ancs);
 }
 
 
-static ble_ancs_c_parse_state_t attr_skip(ble_ancs_c_t * p_ancs, const uint8_t * p_data_src, uint32_t * index)
+/**@brief Function for skipping the rest of an iOS attribute (or the entire attribute).
+ *        Used in the @ref parse_get_notif_attrs_response state machine.
+ *
+ * @details Jump over as much of the attribute as the current GATTC notification holds.
+ *
+ * @param[in] p_ancs     Pointer to an ANCS instance to which the event belongs.
+ * @param[in] data_len   Length of the data that was received from the Notification Provider.
+ * @param[in] index      Pointer to an index that helps us keep track of the current data to be parsed.
+ *
+ * @return The next parse state.
+ */
+static ble_ancs_c_parse_state_t attr_skip(ble_ancs_c_t * p_ancs, uint32_t data_len, uint32_t * index)
 {
-    // We have not reached the end of the attribute, nor our max allocated internal size.
-    // Proceed with copying data over to our buffer.
+    uint16_t len = MIN((uint32_t)(p_ancs->evt.attr.attr_len - p_ancs->parse_info.current_attr_index),
+                       data_len - *index);
+
+    p_ancs->parse_info.current_attr_index += len;
+    *index                                += len;
+
     if (p_ancs->parse_info.current_attr_index < p_ancs->evt.attr.attr_len)
     {
-        p_ancs->parse_info.current_attr_index++;
-        (*index)++;
+        return ATTR_SKIP;
     }
+
     // At the end of the attribute, determine if it should be passed to event handler and
     // continue parsing the next attribute ID if we are not done with all the attributes.
-    if (p_ancs->parse_info.current_attr_index == p_ancs->evt.attr.attr_len)
+    if (attr_is_requested(p_ancs, p_ancs->evt.attr))
     {
-        if (attr_is_requested(p_ancs, p_ancs->evt.attr))
-        {
-            p_ancs->evt_handler(&p_ancs->evt);
-        }
-        if (all_req_attrs_parsed(p_ancs))
-        {
-            return DONE;
-        }
-        else
-        {
-            return ATTR_ID;
-        }
+        attr_evt_send(p_ancs);
     }
-    return ATTR_SKIP;
+    return attr_done(p_ancs);
 }
 
 
@@ -371,11 +449,11 @@ void ancs_parse_get_attrs_response(ble_ancs_c_t  * p_ancs,
                 break;
 
             case ATTR_DATA:
-                p_ancs->parse_info.parse_state = attr_data_parse(p_ancs, p_data_src, &index);
+                p_ancs->parse_info.parse_state = attr_data_parse(p_ancs, p_data_src, hvx_data_len, &index);
                 break;
 
             case ATTR_SKIP:
-                p_ancs->parse_info.parse_state = attr_skip(p_ancs, p_data_src, &index);
+                p_ancs->parse_info.parse_state = attr_skip(p_ancs, hvx_data_len, &index);
                 break;
 
             case DONE:
@@ -45,6 +45,7 @@
 #include "nrf_ble_ancs_c.h"
 #include "ancs_attr_parser.h"
 #include "ancs_app_attr_get.h"
+#include "ancs_attr_cache.h"
 #include "ble_err.h"
 #include "ble_srv_common.h"
 #include "ble_db_discovery.h"
@@ -142,6 +143,8 @@ static void on_disconnected(ble_ancs_c_t * p_ancs, ble_evt_t const * p_ble_evt)
     if (p_ancs->conn_handle == p_ble_evt->evt.gap_evt.conn_handle)
     {
         p_ancs->conn_handle = BLE_CONN_HANDLE_INVALID;
+        // Notification UIDs are only valid for the duration of a connection.
+        ancs_attr_cache_notif_clear(p_ancs);
     }
 }
 
@@ -232,7 +235,7 @@ static uint32_t ble_ancs_verify_notification_format(ble_ancs_c_evt_notif_t const
  * @param[in] p_data_src Pointer to the data that was received from the Notification Provider.
  * @param[in] hvx_len    Length of the data that was received from the Notification Provider.
  */
-static void parse_notif(ble_ancs_c_t const * p_ancs,
+static void parse_notif(ble_ancs_c_t       * p_ancs,
                         uint8_t      const * p_data_src,
                         uint16_t     const   hvx_data_len)
 {
@@ -274,6 +277,12 @@ static void parse_notif(ble_ancs_c_t const * p_ancs,
     if (err_code == NRF_SUCCESS)
     {
         ancs_evt.evt_type = BLE_ANCS_C_EVT_NOTIF;
+
+        // Cached attributes of a modified or removed notification are out of date.
+        if (ancs_evt.notif.evt_id != BLE_ANCS_EVENT_ID_NOTIFICATION_ADDED)
+        {
+            ancs_attr_cache_notif_remove(p_ancs, ancs_evt.notif.notif_uid);
+        }
     }
     else
     {
@@ -400,6 +409,11 @@ ret_code_t ble_ancs_c_init(ble_ancs_c_t * p_ancs, ble_ancs_c_init_t const * p_an
     p_ancs->conn_handle      = BLE_CONN_HANDLE_INVALID;
     p_ancs->p_gatt_queue     = p_ancs_init->p_gatt_queue;
     p_ancs->gatt_err_handler = gatt_error_handler;
+    p_ancs->attr_streaming   = p_ancs_init->attr_streaming;
+    p_ancs->cache_stamp      = 0;
+
+    ancs_attr_cache_app_clear(p_ancs);
+    ancs_attr_cache_notif_clear(p_ancs);
 
     p_ancs->service.data_source_cccd.uuid.uuid  = BLE_UUID_DESCRIPTOR_CLIENT_CHAR_CONFIG;
     p_ancs->service.notif_source_cccd.uuid.uuid = BLE_UUID_DESCRIPTOR_CLIENT_CHAR_CONFIG;
@@ -612,6 +626,17 @@ ret_code_t nrf_ble_ancs_c_attr_req_clear_all(ble_ancs_c_t * p_ancs)
 }
 
 
+ret_code_t nrf_ble_ancs_c_attr_cache_clear(ble_ancs_c_t * p_ancs)
+{
+    VERIFY_PARAM_NOT_NULL(p_ancs);
+
+    ancs_attr_cache_app_clear(p_ancs);
+    ancs_attr_cache_notif_clear(p_ancs);
+
+    return NRF_SUCCESS;
+}
+
+
 ret_code_t nrf_ble_ancs_c_request_attrs(ble_ancs_c_t * p_ancs,
                                         ble_ancs_c_evt_notif_t const * p_notif)
 {
@@ -619,6 +644,11 @@ ret_code_t nrf_ble_ancs_c_request_attrs(ble_ancs_c_t * p_ancs,
     err_code = ble_ancs_verify_notification_format(p_notif);
     VERIFY_SUCCESS(err_code);
 
+    if (ancs_attr_cache_notif_attr_serve(p_ancs, p_notif->notif_uid))
+    {
+        return NRF_SUCCESS;
+    }
+
     err_code                       = ble_ancs_get_notif_attrs(p_ancs, p_notif->notif_uid);
     p_ancs->parse_info.parse_state = COMMAND_ID;
     VERIFY_SUCCESS(err_code);
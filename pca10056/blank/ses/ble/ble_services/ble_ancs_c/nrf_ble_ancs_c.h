@@ -114,6 +114,7 @@
 #ifndef BLE_ANCS_C_H__
 #define BLE_ANCS_C_H__
 
+#include "sdk_config.h"
 #include "ble_types.h"
 #include "ble_srv_common.h"
 #include "sdk_errors.h"
@@ -193,6 +194,7 @@ typedef enum
     BLE_ANCS_C_EVT_NOTIF_ATTRIBUTE,            /**< A received iOS notification attribute has been parsed. */
     BLE_ANCS_C_EVT_APP_ATTRIBUTE,              /**< An iOS app attribute has been parsed. */
     BLE_ANCS_C_EVT_NP_ERROR,                   /**< An error has been sent on the ANCS Control Point from the iOS Notification Provider. */
+    BLE_ANCS_C_EVT_ATTR_SLICE,                 /**< A slice of a requested notification or app attribute has been received. Only sent when @ref ble_ancs_c_init_t::attr_streaming is set. */
 } ble_ancs_c_evt_type_t;
 
 /**@brief Category IDs for iOS notifications. */
@@ -313,6 +315,21 @@ typedef struct
     uint8_t                         * p_attr_data;  //!< Pointer to where the memory is allocated for storing incoming attributes.
 } ble_ancs_c_evt_app_attr_t;
 
+/**@brief Slice of an iOS attribute, handed to the application in streaming mode.
+ *
+ * @details The attribute ID and total length are found in @ref ble_ancs_c_evt_t::attr and the
+ *          notification UID in @ref ble_ancs_c_evt_t::notif_uid. @p p_data points directly into the
+ *          received GATTC notification and is only valid for the duration of the event handler.
+ */
+typedef struct
+{
+    ble_ancs_c_cmd_id_val_t           command_id;   //!< Whether the slice belongs to a notification attribute or an app attribute.
+    uint16_t                          offset;       //!< Offset of this slice within the attribute data.
+    uint16_t                          len;          //!< Length of this slice. Zero for an empty attribute.
+    uint8_t const                   * p_data;       //!< Pointer to the slice data.
+    bool                              last;         //!< True if this is the final slice of the attribute.
+} ble_ancs_c_attr_slice_t;
+
 /**@brief iOS notification attribute content requested by the application. */
 typedef struct
 {
@@ -346,6 +363,7 @@ typedef struct
     ble_ancs_c_evt_notif_t notif;                          //!< iOS notification. This is filled if @p evt_type is @ref BLE_ANCS_C_EVT_NOTIF.
     uint16_t               err_code_np;                    //!< An error coming from the Notification Provider. This is filled with @ref BLE_ANCS_NP_ERROR_CODES if @p evt_type is @ref BLE_ANCS_C_EVT_NP_ERROR.
     ble_ancs_c_attr_t      attr;                           //!< iOS notification attribute or app attribute, depending on the event type.
+    ble_ancs_c_attr_slice_t slice;                         //!< Attribute data slice. This is filled if @p evt_type is @ref BLE_ANCS_C_EVT_ATTR_SLICE.
     uint32_t               notif_uid;                      //!< Notification UID.
     uint8_t                app_id[BLE_ANCS_ATTR_DATA_MAX]; //!< App identifier.
     ble_ancs_c_service_t   service;                        //!< Information on the discovered Alert Notification Service. This is filled if the @p evt_type is @ref BLE_ANCS_C_EVT_DISCOVERY_COMPLETE.
@@ -366,6 +384,27 @@ typedef struct
     uint32_t                 current_app_id_index;     //!< Variable to keep track of the parsing progress, for the given app identifier.
 } ble_ancs_parse_sm_t;
 
+/**@brief Cached display name of an iOS app. */
+typedef struct
+{
+    uint32_t                         stamp;                                        //!< Time of last use, for least-recently-used replacement. Zero if the entry is free.
+    uint16_t                         attr_len;                                     //!< Length of the attribute as reported by the Notification Provider.
+    uint8_t                          len;                                          //!< Number of bytes of the attribute held in @p data.
+    uint8_t                          app_id[BLE_ANCS_ATTR_DATA_MAX];               //!< NUL-terminated app identifier.
+    uint8_t                          data[BLE_ANCS_ATTR_DATA_MAX];                 //!< Display name.
+} ble_ancs_c_app_cache_entry_t;
+
+/**@brief Cached attributes of an iOS notification. */
+typedef struct
+{
+    uint32_t                         stamp;                                        //!< Time of last use, for least-recently-used replacement. Zero if the entry is free.
+    uint32_t                         notif_uid;                                    //!< UID of the notification.
+    uint32_t                         valid_mask;                                   //!< Bit n is set if attribute n is held.
+    uint16_t                         attr_len[BLE_ANCS_NB_OF_NOTIF_ATTR];          //!< Length of each attribute as reported by the Notification Provider.
+    uint8_t                          len[BLE_ANCS_NB_OF_NOTIF_ATTR];               //!< Number of bytes of each attribute held in @p data.
+    uint8_t                          data[BLE_ANCS_NB_OF_NOTIF_ATTR][BLE_ANCS_ATTR_DATA_MAX]; //!< Attribute data.
+} ble_ancs_c_notif_cache_entry_t;
+
 /**@brief iOS notification structure, which contains various status information for the client. */
 typedef struct
 {
@@ -380,6 +419,14 @@ typedef struct
     ble_ancs_parse_sm_t              parse_info;                                      //!< Structure containing different information used to parse incoming attributes correctly (from data_source characteristic).
     ble_ancs_c_evt_t                 evt;                                             //!< Allocate memory for the event here. The event is filled with several iterations of the @ref ancs_parse_get_attrs_response function when requesting iOS notification attributes. 
     nrf_ble_gq_t                   * p_gatt_queue;                                    //!< Pointer to the BLE GATT Queue instance.
+    bool                             attr_streaming;                                  //!< Deliver requested attributes as @ref BLE_ANCS_C_EVT_ATTR_SLICE events instead of copying them into the attribute buffers.
+    uint32_t                         cache_stamp;                                     //!< Use counter for the attribute caches.
+#if BLE_ANCS_C_APP_ATTR_CACHE_SIZE > 0
+    ble_ancs_c_app_cache_entry_t     app_cache[BLE_ANCS_C_APP_ATTR_CACHE_SIZE];       //!< Display names of apps seen so far.
+#endif
+#if BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE > 0
+    ble_ancs_c_notif_cache_entry_t   notif_cache[BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE];   //!< Attributes of recently requested iOS notifications.
+#endif
 
 } ble_ancs_c_t;
 
@@ -390,6 +437,7 @@ typedef struct
     ble_ancs_c_evt_handler_t   evt_handler;    //!< Event handler to be called for handling events in the Battery Service.
     ble_srv_error_handler_t    error_handler;  //!< Function to be called in case of an error.
     nrf_ble_gq_t             * p_gatt_queue;   //!< Pointer to the BLE GATT Queue instance.
+    bool                       attr_streaming; //!< If true, requested attributes are handed to @p evt_handler slice by slice as they arrive (@ref BLE_ANCS_C_EVT_ATTR_SLICE), without being copied into the buffers given to @ref nrf_ble_ancs_c_attr_add.
 } ble_ancs_c_init_t;
 
 
@@ -546,7 +594,26 @@ ret_code_t nrf_ble_ancs_c_app_attr_add(ble_ancs_c_t                     * p_ancs
 **/
 ret_code_t nrf_ble_ancs_c_attr_req_clear_all(ble_ancs_c_t * p_ancs);
 
+/**@brief Function for dropping all cached app attributes and notification attributes.
+ *
+ * @details Cached notification attributes are dropped automatically on disconnection, since
+ *          notification UIDs are only valid for one connection. Cached app display names are
+ *          kept; call this function if the application connects to a different peer.
+ *
+ * @param[in] p_ancs   iOS notification structure. This structure must be supplied by
+ *                     the application. It identifies the particular client instance to use.
+ *
+ * @retval NRF_SUCCESS    If the caches were cleared.
+ * @retval NRF_ERROR_NULL If @p p_ancs is a NULL pointer.
+ */
+ret_code_t nrf_ble_ancs_c_attr_cache_clear(ble_ancs_c_t * p_ancs);
+
 /**@brief Function for requesting attributes for a notification.
+ *
+ * @details If all requested attributes of the notification are held in the notification
+ *          attribute cache (see @ref BLE_ANCS_C_NOTIF_ATTR_CACHE_SIZE), they are passed to the
+ *          event handler before this function returns, and nothing is sent to the Notification
+ *          Provider.
  *
  * @param[in] p_ancs   iOS notification structure. This structure must be supplied by
  *                     the application. It identifies the particular client instance to use.
@@ -559,6 +626,10 @@ ret_code_t nrf_ble_ancs_c_request_attrs(ble_ancs_c_t                 * p_ancs,
                                         ble_ancs_c_evt_notif_t const * p_notif);
 
 /**@brief Function for requesting attributes for a given app.
+ *
+ * @details If the display name of the app is held in the app attribute cache
+ *          (see @ref BLE_ANCS_C_APP_ATTR_CACHE_SIZE), it is passed to the event handler before
+ *          this function returns, and nothing is sent to the Notification Provider.
  *
  * @param[in] p_ancs   iOS notification structure. This structure must be supplied by
  *                     the application. It identifies the particular client instance to use.
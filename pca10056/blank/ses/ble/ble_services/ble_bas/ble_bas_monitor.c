@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_BAS_MONITOR)
+#include "ble_bas_monitor.h"
+#include "app_timer.h"
+
+
+/**@brief Function for reporting a Battery Level measurement taken at a given time.
+ *
+ * @param[in]   p_monitor     Battery Level monitor structure.
+ * @param[in]   battery_level New battery measurement value.
+ * @param[in]   now           Time of the measurement, in app_timer ticks.
+ *
+ * @retval NRF_SUCCESS If the level was reported, or held back.
+ * @return Otherwise, the error returned by @ref ble_bas_battery_level_update.
+ */
+static ret_code_t level_process(ble_bas_monitor_t * p_monitor, uint8_t battery_level, uint32_t now)
+{
+    uint8_t reported = p_monitor->p_bas->battery_level_last;
+    uint8_t change   = (battery_level > reported) ? (battery_level - reported)
+                                                  : (reported - battery_level);
+
+    if (change < p_monitor->min_change)
+    {
+        return NRF_SUCCESS;
+    }
+
+    if (   p_monitor->is_reported
+        && (app_timer_cnt_diff_compute(now, p_monitor->last_report) < p_monitor->min_interval))
+    {
+        return NRF_SUCCESS;
+    }
+
+    p_monitor->is_reported = true;
+    p_monitor->last_report = now;
+
+    return ble_bas_battery_level_update(p_monitor->p_bas, battery_level, BLE_CONN_HANDLE_ALL);
+}
+
+
+ret_code_t ble_bas_monitor_init(ble_bas_monitor_t * p_monitor, ble_bas_monitor_init_t const * p_monitor_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_monitor);
+    VERIFY_PARAM_NOT_NULL(p_monitor_init);
+    VERIFY_PARAM_NOT_NULL(p_monitor_init->p_bas);
+
+    if (   (p_monitor_init->min_change == 0)
+        || (   (p_monitor_init->convert != NULL)
+            && (p_monitor_init->saadc_idx >= p_monitor_init->saadc_channel_count)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_monitor->p_bas               = p_monitor_init->p_bas;
+    p_monitor->error_handler       = p_monitor_init->error_handler;
+    p_monitor->min_change          = p_monitor_init->min_change;
+    p_monitor->min_interval        = APP_TIMER_TICKS(p_monitor_init->min_interval_ms);
+    p_monitor->last_report         = 0;
+    p_monitor->is_reported         = false;
+    p_monitor->convert             = p_monitor_init->convert;
+    p_monitor->p_context           = p_monitor_init->p_context;
+    p_monitor->saadc_idx           = p_monitor_init->saadc_idx;
+    p_monitor->saadc_channel_count = p_monitor_init->saadc_channel_count;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t ble_bas_monitor_level_set(ble_bas_monitor_t * p_monitor, uint8_t battery_level)
+{
+    VERIFY_PARAM_NOT_NULL(p_monitor);
+
+    return level_process(p_monitor, battery_level, app_timer_cnt_get());
+}
+
+
+#if APP_SAADC_ENABLED
+void ble_bas_monitor_saadc_buffer_process(ble_bas_monitor_t * p_monitor, app_saadc_done_evt_t const * p_done)
+{
+    ret_code_t err_code;
+    int32_t    sum   = 0;
+    uint16_t   count = 0;
+
+    if ((p_monitor == NULL) || (p_done == NULL) || (p_monitor->convert == NULL))
+    {
+        return;
+    }
+
+    // The samples of the battery channel are mixed if its gain was changed in this buffer.
+    if (p_done->gain_transition & (1UL << p_monitor->saadc_idx))
+    {
+        return;
+    }
+
+    for (uint16_t i = p_monitor->saadc_idx; i < p_done->size; i += p_monitor->saadc_channel_count)
+    {
+        sum += p_done->p_buffer[i];
+        count++;
+    }
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    err_code = level_process(p_monitor,
+                             p_monitor->convert((int16_t)(sum / count), p_monitor->p_context),
+                             app_timer_cnt_get());
+
+    // Links that have not enabled notification, or have no room for it, read the new level
+    // from the database.
+    if (   (err_code != NRF_SUCCESS)
+        && (err_code != NRF_ERROR_INVALID_STATE)
+        && (err_code != NRF_ERROR_RESOURCES)
+        && (err_code != NRF_ERROR_BUSY)
+        && (err_code != BLE_ERROR_GATTS_SYS_ATTR_MISSING)
+        && (p_monitor->error_handler != NULL))
+    {
+        p_monitor->error_handler(err_code);
+    }
+}
+#endif // APP_SAADC_ENABLED
+#endif // NRF_MODULE_ENABLED(BLE_BAS_MONITOR)
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup ble_bas_monitor Battery Level hysteresis and SAADC sourcing
+ * @{
+ * @ingroup  ble_bas
+ * @brief    Module for reporting the Battery Level only when it has changed enough.
+ *
+ * @details  @ref ble_bas_battery_level_update updates and notifies the Battery Level on every
+ *           change, so a level derived from a noisy measurement is notified on nearly every
+ *           call. This module sits between the measurement and an initialized @ref ble_bas
+ *           instance, and passes a new level on only if:
+ *
+ *           - it differs from the reported level by at least the minimum change, and
+ *           - the minimum interval has passed since the level was last reported.
+ *
+ *           A level held back by the minimum interval is not stored. The next measurement after
+ *           the interval is compared with the reported level instead, so the reported level
+ *           always follows the latest measurement.
+ *
+ *           The level can be set by the application with @ref ble_bas_monitor_level_set, or
+ *           taken from a channel of an @ref app_saadc acquisition with
+ *           @ref ble_bas_monitor_saadc_buffer_process. In the latter case, the battery voltage
+ *           is one of the channels sampled by the acquisition, and the mean of its samples in
+ *           each filled buffer is converted to a level, so no conversion is added for the
+ *           Battery Service.
+ */
+
+#ifndef BLE_BAS_MONITOR_H__
+#define BLE_BAS_MONITOR_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ble_bas.h"
+#include "ble_srv_common.h"
+#include "sdk_config.h"
+#include "sdk_errors.h"
+#if APP_SAADC_ENABLED
+#include "app_saadc.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for converting the mean of the battery channel samples to a Battery Level.
+ *
+ * @param[in] mean      Mean of the samples of the battery channel in a buffer.
+ * @param[in] p_context Context given in @ref ble_bas_monitor_init_t.
+ *
+ * @return Battery Level, in percent of full capacity.
+ */
+typedef uint8_t (* ble_bas_monitor_convert_t)(int16_t mean, void * p_context);
+
+/**@brief Battery Level monitor structure. Fields are internal. */
+typedef struct
+{
+    ble_bas_t                 * p_bas;              /**< Battery Service instance the level is reported to. */
+    ble_srv_error_handler_t     error_handler;      /**< Function to be called in case of an error. */
+    uint8_t                     min_change;         /**< Minimum change of the level to be reported, in percent. */
+    uint32_t                    min_interval;       /**< Minimum interval between reports, in app_timer ticks. */
+    uint32_t                    last_report;        /**< Time of the last report, in app_timer ticks. */
+    bool                        is_reported;        /**< True once a level has been reported. */
+    ble_bas_monitor_convert_t   convert;            /**< Function converting the battery channel to a level. */
+    void                      * p_context;          /**< Context passed to @ref ble_bas_monitor_t::convert. */
+    uint8_t                     saadc_idx;          /**< Position of the battery channel in the SAADC buffers. */
+    uint8_t                     saadc_channel_count;/**< Number of interleaved channels in the SAADC buffers. */
+} ble_bas_monitor_t;
+
+/**@brief Battery Level monitor init structure. */
+typedef struct
+{
+    ble_bas_t                 * p_bas;                /**< Initialized Battery Service instance. */
+    ble_srv_error_handler_t     error_handler;        /**< Function to be called in case of an error while reporting a level from a SAADC buffer. */
+    uint8_t                     min_change;           /**< Minimum change of the level to be reported, in percent. 1 reports every change. */
+    uint32_t                    min_interval_ms;      /**< Minimum interval between reports, in milliseconds. Must be shorter than the period of the app_timer counter. */
+    ble_bas_monitor_convert_t   convert;              /**< Function converting the battery channel to a level, or NULL if the level is only set by the application. */
+    void                      * p_context;            /**< Context passed to @p convert. */
+    uint8_t                     saadc_idx;            /**< Position of the battery channel in the SAADC buffers. */
+    uint8_t                     saadc_channel_count;  /**< Number of interleaved channels in the SAADC buffers. */
+} ble_bas_monitor_init_t;
+
+
+/**@brief Function for initializing the Battery Level monitor.
+ *
+ * @details The level passed to @ref ble_bas_init counts as the reported level, and the first
+ *          measurement is not held back by the minimum interval.
+ *
+ * @param[out]  p_monitor      Battery Level monitor structure.
+ * @param[in]   p_monitor_init Information needed to initialize the monitor.
+ *
+ * @retval NRF_SUCCESS             If the monitor was initialized.
+ * @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If the minimum change is 0, or the battery channel position is
+ *                                 not below the channel count while @p convert is set.
+ */
+ret_code_t ble_bas_monitor_init(ble_bas_monitor_t * p_monitor, ble_bas_monitor_init_t const * p_monitor_init);
+
+
+/**@brief Function for setting a new Battery Level measurement.
+ *
+ * @details The level is passed to @ref ble_bas_battery_level_update and notified to all
+ *          connected links if it passes the minimum change and the minimum interval.
+ *
+ * @param[in]   p_monitor     Battery Level monitor structure.
+ * @param[in]   battery_level New battery measurement value (in percent of full capacity).
+ *
+ * @retval NRF_SUCCESS If the level was reported, or held back.
+ * @return Otherwise, the error returned by @ref ble_bas_battery_level_update.
+ */
+ret_code_t ble_bas_monitor_level_set(ble_bas_monitor_t * p_monitor, uint8_t battery_level);
+
+
+#if APP_SAADC_ENABLED
+/**@brief Function for setting the Battery Level from a filled buffer of an app_saadc acquisition.
+ *
+ * @details Call from the @ref APP_SAADC_EVT_DONE handler, before the buffer is released. The
+ *          mean of the battery channel samples is converted with @ref ble_bas_monitor_init_t::convert
+ *          and set as with @ref ble_bas_monitor_level_set. A buffer in which the gain of
+ *          the battery channel changed is skipped. Errors other than those of a link that cannot
+ *          be notified are passed to the error handler.
+ *
+ * @param[in]   p_monitor   Battery Level monitor structure.
+ * @param[in]   p_done      Data of the @ref APP_SAADC_EVT_DONE event.
+ */
+void ble_bas_monitor_saadc_buffer_process(ble_bas_monitor_t * p_monitor, app_saadc_done_evt_t const * p_done);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_BAS_MONITOR_H__
+
+/** @} */
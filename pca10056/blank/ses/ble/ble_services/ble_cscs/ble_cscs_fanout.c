@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_FANOUT)
+#include "ble_cscs_fanout.h"
+#include <string.h>
+#include "app_util.h"
+
+#define MAX_CSCM_LEN  (sizeof(uint8_t) + sizeof(uint32_t) + (3 * sizeof(uint16_t)))     /**< Size of a Cycling Speed and Cadence Measurement with all fields present. */
+
+// Cycling Speed and Cadence Measurement flag bits
+#define CSC_MEAS_FLAG_MASK_WHEEL_REV_DATA_PRESENT (0x01 << 0)  /**< Wheel revolution data present flag bit. */
+#define CSC_MEAS_FLAG_MASK_CRANK_REV_DATA_PRESENT (0x01 << 1)  /**< Crank revolution data present flag bit. */
+
+
+uint16_t ble_cscs_fanout_encode(void const * p_context,
+                                void const * p_meas,
+                                uint8_t    * p_buf,
+                                uint16_t     max_len)
+{
+    ble_cscs_t      const * p_cscs            = (ble_cscs_t const *)p_context;
+    ble_cscs_meas_t const * p_csc_measurement = (ble_cscs_meas_t const *)p_meas;
+    uint8_t                 encoded_csc_meas[MAX_CSCM_LEN];
+    uint8_t                 flags = 0;
+    uint8_t                 len   = 1;
+
+    // Cumulative Wheel Revolutions and Last Wheel Event Time Fields
+    if (p_cscs->feature & BLE_CSCS_FEATURE_WHEEL_REV_BIT)
+    {
+        if (p_csc_measurement->is_wheel_rev_data_present)
+        {
+            flags |= CSC_MEAS_FLAG_MASK_WHEEL_REV_DATA_PRESENT;
+            len += uint32_encode(p_csc_measurement->cumulative_wheel_revs, &encoded_csc_meas[len]);
+            len += uint16_encode(p_csc_measurement->last_wheel_event_time, &encoded_csc_meas[len]);
+        }
+    }
+
+    // Cumulative Crank Revolutions and Last Crank Event Time Fields
+    if (p_cscs->feature & BLE_CSCS_FEATURE_CRANK_REV_BIT)
+    {
+        if (p_csc_measurement->is_crank_rev_data_present)
+        {
+            flags |= CSC_MEAS_FLAG_MASK_CRANK_REV_DATA_PRESENT;
+            len += uint16_encode(p_csc_measurement->cumulative_crank_revs, &encoded_csc_meas[len]);
+            len += uint16_encode(p_csc_measurement->last_crank_event_time, &encoded_csc_meas[len]);
+        }
+    }
+
+    // Flags Field
+    encoded_csc_meas[0] = flags;
+
+    if (len > max_len)
+    {
+        return 0;
+    }
+
+    memcpy(p_buf, encoded_csc_meas, len);
+
+    return len;
+}
+
+
+ret_code_t ble_cscs_fanout_init(nrf_ble_fanout_t        * p_fanout,
+                                ble_cscs_t const        * p_cscs,
+                                ble_srv_error_handler_t   error_handler)
+{
+    nrf_ble_fanout_init_t fanout_init;
+
+    VERIFY_PARAM_NOT_NULL(p_cscs);
+
+    memset(&fanout_init, 0, sizeof(fanout_init));
+
+    fanout_init.value_handle  = p_cscs->meas_handles.value_handle;
+    fanout_init.cccd_handle   = p_cscs->meas_handles.cccd_handle;
+    fanout_init.hvx_type      = BLE_GATT_HVX_NOTIFICATION;
+    fanout_init.encode        = ble_cscs_fanout_encode;
+    fanout_init.p_context     = p_cscs;
+    fanout_init.error_handler = error_handler;
+
+    return nrf_ble_fanout_init(p_fanout, &fanout_init);
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BLE_FANOUT)
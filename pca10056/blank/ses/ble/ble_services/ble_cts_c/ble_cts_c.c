@@ -261,6 +261,47 @@ static uint32_t current_time_validate(current_time_char_t * p_time)
 }
 
 
+/**@brief Function for decoding and validating a Current Time value. Depending on the outcome,
+ *        the CTS event handler will be called with the Current Time event or an invalid time event.
+ *
+ * @param[in] p_cts   Current Time Service client structure.
+ * @param[in] p_data  Pointer to the buffer containing the Current Time.
+ * @param[in] length  Length of the buffer containing the Current Time.
+ */
+static void current_time_evt_send(ble_cts_c_t * p_cts, uint8_t const * p_data, uint32_t length)
+{
+    ble_cts_c_evt_t evt;
+    uint32_t        err_code = NRF_SUCCESS;
+
+    err_code = current_time_decode(&evt.params.current_time, p_data, length);
+
+    if (err_code != NRF_SUCCESS)
+    {
+        // The data length was invalid. Decoding was not completed.
+        evt.evt_type = BLE_CTS_C_EVT_INVALID_TIME;
+    }
+    else
+    {
+        // Verify that the time is valid.
+        err_code = current_time_validate(&evt.params.current_time);
+
+        if (err_code != NRF_SUCCESS)
+        {
+            // Invalid time received.
+            evt.evt_type = BLE_CTS_C_EVT_INVALID_TIME;
+        }
+        else
+        {
+            // Valid time reveiced.
+            evt.evt_type = BLE_CTS_C_EVT_CURRENT_TIME;
+        }
+    }
+
+    evt.conn_handle = p_cts->conn_handle;
+    p_cts->evt_handler(p_cts, &evt);
+}
+
+
 /**@brief Function for reading the Current Time. The time is decoded, and then validated.
  *        Depending on the outcome, the CTS event handler will be called with
  *        the Current Time event or an invalid time event.
@@ -270,9 +311,6 @@ static uint32_t current_time_validate(current_time_char_t * p_time)
  */
 static void current_time_read(ble_cts_c_t * p_cts, ble_evt_t const * p_ble_evt)
 {
-    ble_cts_c_evt_t evt;
-    uint32_t        err_code = NRF_SUCCESS;
-
     // Check whether the event is on the same connection as this CTS instance
     if (p_cts->conn_handle != p_ble_evt->evt.gattc_evt.conn_handle)
     {
@@ -281,32 +319,31 @@ static void current_time_read(ble_cts_c_t * p_cts, ble_evt_t const * p_ble_evt)
 
     if (p_ble_evt->evt.gattc_evt.gatt_status == BLE_GATT_STATUS_SUCCESS)
     {
-        err_code = current_time_decode(&evt.params.current_time,
-                                       p_ble_evt->evt.gattc_evt.params.read_rsp.data,
-                                       p_ble_evt->evt.gattc_evt.params.read_rsp.len);
+        current_time_evt_send(p_cts,
+                              p_ble_evt->evt.gattc_evt.params.read_rsp.data,
+                              p_ble_evt->evt.gattc_evt.params.read_rsp.len);
+    }
+}
 
-        if (err_code != NRF_SUCCESS)
-        {
-            // The data length was invalid. Decoding was not completed.
-            evt.evt_type = BLE_CTS_C_EVT_INVALID_TIME;
-        }
-        else
-        {
-            // Verify that the time is valid.
-            err_code = current_time_validate(&evt.params.current_time);
 
-            if (err_code != NRF_SUCCESS)
-            {
-                // Invalid time received.
-                evt.evt_type = BLE_CTS_C_EVT_INVALID_TIME;
-            }
-            else
-            {
-                // Valid time reveiced.
-                evt.evt_type = BLE_CTS_C_EVT_CURRENT_TIME;
-            }
-        }
-        p_cts->evt_handler(p_cts, &evt);
+/**@brief Function for handling a notification of the Current Time.
+ *
+ * @param[in] p_cts      Current Time Service client structure.
+ * @param[in] p_ble_evt  Event received from the BLE stack.
+ */
+static void on_hvx(ble_cts_c_t * p_cts, ble_evt_t const * p_ble_evt)
+{
+    // Check whether the event is on the same connection as this CTS instance
+    if (p_cts->conn_handle != p_ble_evt->evt.gattc_evt.conn_handle)
+    {
+        return;
+    }
+
+    if (p_ble_evt->evt.gattc_evt.params.hvx.handle == p_cts->char_handles.cts_handle)
+    {
+        current_time_evt_send(p_cts,
+                              p_ble_evt->evt.gattc_evt.params.hvx.data,
+                              p_ble_evt->evt.gattc_evt.params.hvx.len);
     }
 }
 
@@ -349,6 +386,10 @@ void ble_cts_c_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
             current_time_read(p_cts, p_ble_evt);
             break;
 
+        case BLE_GATTC_EVT_HVX:
+            on_hvx(p_cts, p_ble_evt);
+            break;
+
         case BLE_GAP_EVT_DISCONNECTED:
             on_disconnect(p_cts, p_ble_evt);
             break;
@@ -381,6 +422,39 @@ uint32_t ble_cts_c_current_time_read(ble_cts_c_t const * p_cts)
 }
 
 
+uint32_t ble_cts_c_current_time_notif_enable(ble_cts_c_t const * p_cts)
+{
+    if (   !ble_cts_c_is_cts_discovered(p_cts)
+        || (p_cts->char_handles.cts_cccd_handle == BLE_GATT_HANDLE_INVALID))
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    NRF_LOG_DEBUG("Configuring CCCD. CCCD Handle = %d, Connection Handle = %d",
+                  p_cts->char_handles.cts_cccd_handle,
+                  p_cts->conn_handle);
+
+    nrf_ble_gq_req_t cccd_req;
+    uint8_t          cccd[BLE_CCCD_VALUE_LEN];
+
+    cccd[0] = LSB_16(BLE_GATT_HVX_NOTIFICATION);
+    cccd[1] = MSB_16(BLE_GATT_HVX_NOTIFICATION);
+
+    memset(&cccd_req, 0, sizeof(nrf_ble_gq_req_t));
+
+    cccd_req.type                        = NRF_BLE_GQ_REQ_GATTC_WRITE;
+    cccd_req.error_handler.cb            = gatt_error_handler;
+    cccd_req.error_handler.p_ctx         = (ble_cts_c_t *)p_cts;
+    cccd_req.params.gattc_write.handle   = p_cts->char_handles.cts_cccd_handle;
+    cccd_req.params.gattc_write.len      = BLE_CCCD_VALUE_LEN;
+    cccd_req.params.gattc_write.p_value  = cccd;
+    cccd_req.params.gattc_write.offset   = 0;
+    cccd_req.params.gattc_write.write_op = BLE_GATT_OP_WRITE_REQ;
+
+    return nrf_ble_gq_item_add(p_cts->p_gatt_queue, &cccd_req, p_cts->conn_handle);
+}
+
+
 uint32_t ble_cts_c_handles_assign(ble_cts_c_t               * p_cts,
                                   const uint16_t              conn_handle,
                                   const ble_cts_c_handles_t * p_peer_handles)
@@ -259,6 +259,22 @@ static __INLINE bool ble_cts_c_is_cts_discovered(const ble_cts_c_t * p_cts)
 uint32_t ble_cts_c_current_time_read(ble_cts_c_t const * p_cts);
 
 
+/**@brief Function for enabling notifications of the Current Time characteristic.
+ *
+ * @details The server notifies the Current Time when it is adjusted, for example by an external
+ *          time reference or a change of time zone. The notified values are reported with the
+ *          @ref BLE_CTS_C_EVT_CURRENT_TIME and @ref BLE_CTS_C_EVT_INVALID_TIME events, as the
+ *          read values.
+ *
+ * @param[in] p_cts Current Time Service client structure.
+ *
+ * @retval NRF_SUCCESS         If the CCCD write was queued.
+ * @retval NRF_ERROR_NOT_FOUND If the Current Time Service or its CCCD was not discovered.
+ * @retval err_code            Otherwise, an error code returned by @ref nrf_ble_gq_item_add.
+ */
+uint32_t ble_cts_c_current_time_notif_enable(ble_cts_c_t const * p_cts);
+
+
 /**@brief Function for assigning handles to this instance of cts_c.
  *
  * @details Call this function when a link has been established with a peer to
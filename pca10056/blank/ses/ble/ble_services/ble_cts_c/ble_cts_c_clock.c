@@ -0,0 +1,405 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_CTS_C_CLOCK)
+#include "ble_cts_c_clock.h"
+#include "app_timer.h"
+#include "app_util_platform.h"
+#include "ble_epoch.h"
+#include "nrf.h"
+
+#define NRF_LOG_MODULE_NAME ble_cts_c_clock
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define CLOCK_TICKS_PER_SECOND  (APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1)) /**< Frequency of the app_timer counter. */
+#define CLOCK_UPDATE_INTERVAL   ((RTC_COUNTER_COUNTER_Msk + 1) / 4)                          /**< Interval (in ticks) at which the counter is extended, well within its wrap-around. */
+
+APP_TIMER_DEF(m_update_timer);                                  /**< Timer extending the counter and checking if resynchronization is due. */
+
+static ble_cts_c_t           * m_p_cts;                         /**< Current Time Service client used to synchronize the clock. */
+static ble_srv_error_handler_t m_error_handler;                 /**< Function to be called in case of an error. */
+static uint32_t                m_last_cnt;                      /**< Counter value at the last update of @ref m_ticks. */
+static uint64_t                m_ticks;                         /**< Counter extended to 64 bits. */
+static bool                    m_synced;                        /**< True once the clock has been synchronized. */
+static uint64_t                m_sync_ticks;                    /**< Extended counter at the last synchronization. */
+static uint64_t                m_sync_t256;                     /**< Time at the last synchronization, in 1/256 s since 1970. */
+static bool                    m_drift_ref_valid;               /**< True if there is a reference point for the drift measurement. */
+static uint64_t                m_drift_ref_ticks;               /**< Extended counter at the reference point of the drift measurement. */
+static uint64_t                m_drift_ref_t256;                /**< Time at the reference point of the drift measurement, in 1/256 s since 1970. */
+static int32_t                 m_drift_ppb;                     /**< Measured drift of the low frequency clock, in parts per billion. */
+
+
+/**@brief Function for forwarding errors to the application.
+ *
+ * @param[in] nrf_error    Error code.
+ */
+static void error_forward(uint32_t nrf_error)
+{
+    if (m_error_handler != NULL)
+    {
+        m_error_handler(nrf_error);
+    }
+}
+
+
+/**@brief Function for converting a Current Time value to 1/256 s since 1970.
+ *
+ * @param[in]  p_time   Exact Time 256 field of the Current Time.
+ * @param[out] p_t256   Time in 1/256 s since 1970.
+ *
+ * @return True if the date is known and valid.
+ */
+static bool t256_from_exact_time(exact_time_256_t const * p_time, uint64_t * p_t256)
+{
+    uint32_t seconds;
+
+    if (!ble_epoch_from_date_time(&p_time->day_date_time.date_time, &seconds))
+    {
+        return false;
+    }
+
+    *p_t256 = ((uint64_t)seconds << 8) | p_time->fractions256;
+
+    return true;
+}
+
+
+/**@brief Function for extending the app_timer counter.
+ *
+ * @details Must be called at least once per wrap-around of the counter, and in a critical region.
+ *
+ * @return Extended counter.
+ */
+static uint64_t ticks_update(void)
+{
+    uint32_t cnt = app_timer_cnt_get();
+
+    m_ticks   += app_timer_cnt_diff_compute(cnt, m_last_cnt);
+    m_last_cnt = cnt;
+
+    return m_ticks;
+}
+
+
+/**@brief Function for converting a number of ticks to 1/256 s, without drift compensation. */
+static uint64_t ticks_to_t256(uint64_t ticks)
+{
+    return (ticks << 8) / CLOCK_TICKS_PER_SECOND;
+}
+
+
+/**@brief Function for getting the local time at a value of the extended counter.
+ *
+ * @param[in] ticks  Extended counter, not older than the last synchronization.
+ *
+ * @return Time in 1/256 s since 1970.
+ */
+static uint64_t t256_at(uint64_t ticks)
+{
+    int64_t elapsed = (int64_t)ticks_to_t256(ticks - m_sync_ticks);
+
+    return m_sync_t256 + (uint64_t)(elapsed + ((elapsed * m_drift_ppb) / 1000000000));
+}
+
+
+/**@brief Function for measuring the drift of the low frequency clock against the server.
+ *
+ * @param[in] ticks  Extended counter when the time was received.
+ * @param[in] t256   Time received from the server, in 1/256 s since 1970.
+ */
+static void drift_measure(uint64_t ticks, uint64_t t256)
+{
+    uint64_t span_ticks = ticks - m_drift_ref_ticks;
+    int64_t  nominal;
+    int64_t  diff;
+    int64_t  max_diff;
+
+    if (span_ticks < ((uint64_t)BLE_CTS_C_CLOCK_MIN_DRIFT_INTERVAL_S * CLOCK_TICKS_PER_SECOND))
+    {
+        // Too short to tell the drift from the resolution of the Current Time.
+        return;
+    }
+
+    nominal  = (int64_t)ticks_to_t256(span_ticks);
+    diff     = (int64_t)(t256 - m_drift_ref_t256) - nominal;
+    max_diff = (nominal * BLE_CTS_C_CLOCK_MAX_DRIFT_PPM) / 1000000;
+
+    if (diff > max_diff)
+    {
+        diff = max_diff;
+    }
+    else if (diff < -max_diff)
+    {
+        diff = -max_diff;
+    }
+
+    m_drift_ppb = (int32_t)((diff * 1000000000) / nominal);
+
+    NRF_LOG_DEBUG("Drift %d ppb over %u s.", m_drift_ppb, (uint32_t)(span_ticks / CLOCK_TICKS_PER_SECOND));
+}
+
+
+/**@brief Function for synchronizing the clock to a Current Time value.
+ *
+ * @param[in] p_time  Current Time received from the server.
+ */
+static void clock_sync(current_time_char_t const * p_time)
+{
+    uint64_t t256;
+    uint64_t ticks;
+    bool     is_jump = p_time->adjust_reason.manual_time_update              ||
+                       p_time->adjust_reason.change_of_time_zone             ||
+                       p_time->adjust_reason.change_of_daylight_savings_time;
+
+    if (!t256_from_exact_time(&p_time->exact_time_256, &t256))
+    {
+        NRF_LOG_DEBUG("Current Time without a date, ignored.");
+        return;
+    }
+
+    CRITICAL_REGION_ENTER();
+
+    ticks = ticks_update();
+
+    if (m_drift_ref_valid && !is_jump)
+    {
+        drift_measure(ticks, t256);
+    }
+    else
+    {
+        // A jump of the time on the server is not drift. Measure from here on.
+        m_drift_ref_valid = true;
+        m_drift_ref_ticks = ticks;
+        m_drift_ref_t256  = t256;
+    }
+
+    m_sync_ticks = ticks;
+    m_sync_t256  = t256;
+    m_synced     = true;
+
+    CRITICAL_REGION_EXIT();
+}
+
+
+/**@brief Function for checking if the clock must be synchronized again.
+ *
+ * @return True if the clock was never synchronized, or the last synchronization is older than
+ *         BLE_CTS_C_CLOCK_RESYNC_INTERVAL_S seconds.
+ */
+static bool resync_is_due(void)
+{
+    bool is_due;
+
+    CRITICAL_REGION_ENTER();
+    is_due = !m_synced ||
+             ((ticks_update() - m_sync_ticks) >=
+              ((uint64_t)BLE_CTS_C_CLOCK_RESYNC_INTERVAL_S * CLOCK_TICKS_PER_SECOND));
+    CRITICAL_REGION_EXIT();
+
+    return is_due;
+}
+
+
+/**@brief Function for reading the Current Time from the server, if it is connected.
+ */
+static void current_time_read(void)
+{
+    uint32_t err_code;
+
+    if ((m_p_cts == NULL) || !ble_cts_c_is_cts_discovered(m_p_cts))
+    {
+        return;
+    }
+
+    err_code = ble_cts_c_current_time_read(m_p_cts);
+    if ((err_code != NRF_SUCCESS) && (err_code != NRF_ERROR_NOT_FOUND))
+    {
+        error_forward(err_code);
+    }
+}
+
+
+/**@brief Function for handling the timeout of the update timer.
+ *
+ * @param[in] p_context  Not used.
+ */
+static void update_timeout_handler(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    // Extends the counter as well.
+    if (resync_is_due())
+    {
+        current_time_read();
+    }
+}
+
+
+ret_code_t ble_cts_c_clock_init(ble_cts_c_clock_init_t const * p_clock_init)
+{
+    ret_code_t err_code;
+
+    VERIFY_PARAM_NOT_NULL(p_clock_init);
+    VERIFY_PARAM_NOT_NULL(p_clock_init->p_cts);
+
+    m_p_cts           = p_clock_init->p_cts;
+    m_error_handler   = p_clock_init->error_handler;
+    m_last_cnt        = app_timer_cnt_get();
+    m_ticks           = 0;
+    m_synced          = false;
+    m_drift_ref_valid = false;
+    m_drift_ppb       = 0;
+
+    err_code = app_timer_create(&m_update_timer, APP_TIMER_MODE_REPEATED, update_timeout_handler);
+    VERIFY_SUCCESS(err_code);
+
+    return app_timer_start(m_update_timer, CLOCK_UPDATE_INTERVAL, NULL);
+}
+
+
+void ble_cts_c_clock_on_cts_c_evt(ble_cts_c_t * p_cts, ble_cts_c_evt_t const * p_evt)
+{
+    uint32_t err_code;
+
+    if ((p_cts == NULL) || (p_cts != m_p_cts) || (p_evt == NULL))
+    {
+        return;
+    }
+
+    switch (p_evt->evt_type)
+    {
+        case BLE_CTS_C_EVT_DISCOVERY_COMPLETE:
+            // Adjustments on the server are notified, so they do not have to be polled for.
+            err_code = ble_cts_c_current_time_notif_enable(p_cts);
+            if ((err_code != NRF_SUCCESS) && (err_code != NRF_ERROR_NOT_FOUND))
+            {
+                error_forward(err_code);
+            }
+
+            if (resync_is_due())
+            {
+                current_time_read();
+            }
+            break;
+
+        case BLE_CTS_C_EVT_CURRENT_TIME:
+            clock_sync(&p_evt->params.current_time);
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+
+bool ble_cts_c_clock_is_synced(void)
+{
+    return m_synced;
+}
+
+
+/**@brief Function for getting the current local time in 1/256 s since 1970.
+ *
+ * @param[out] p_t256  Current time.
+ *
+ * @retval NRF_SUCCESS             If the time was given.
+ * @retval NRF_ERROR_INVALID_STATE If the clock is not synchronized.
+ */
+static ret_code_t t256_get(uint64_t * p_t256)
+{
+    ret_code_t err_code = NRF_ERROR_INVALID_STATE;
+
+    CRITICAL_REGION_ENTER();
+    if (m_synced)
+    {
+        *p_t256  = t256_at(ticks_update());
+        err_code = NRF_SUCCESS;
+    }
+    CRITICAL_REGION_EXIT();
+
+    return err_code;
+}
+
+
+ret_code_t ble_cts_c_clock_time_get(ble_date_time_t * p_date_time, uint8_t * p_fractions256)
+{
+    ret_code_t err_code;
+    uint64_t   t256;
+
+    VERIFY_PARAM_NOT_NULL(p_date_time);
+
+    err_code = t256_get(&t256);
+    VERIFY_SUCCESS(err_code);
+
+    ble_epoch_to_date_time((uint32_t)(t256 >> 8), p_date_time);
+
+    if (p_fractions256 != NULL)
+    {
+        *p_fractions256 = (uint8_t)(t256 & 0xFF);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t ble_cts_c_clock_seconds_get(uint32_t * p_seconds)
+{
+    ret_code_t err_code;
+    uint64_t   t256;
+
+    VERIFY_PARAM_NOT_NULL(p_seconds);
+
+    err_code = t256_get(&t256);
+    VERIFY_SUCCESS(err_code);
+
+    *p_seconds = (uint32_t)(t256 >> 8);
+
+    return NRF_SUCCESS;
+}
+
+
+int32_t ble_cts_c_clock_drift_get(void)
+{
+    return m_drift_ppb;
+}
+
+#endif // NRF_MODULE_ENABLED(BLE_CTS_C_CLOCK)
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup ble_cts_c_clock Local clock synchronized by the Current Time Service client
+ * @{
+ * @ingroup  ble_cts_c
+ * @brief    Module for keeping the wall-clock time locally, from a Current Time Service server.
+ *
+ * @details  Reading the Current Time with @ref ble_cts_c_current_time_read each time the
+ *           application needs a timestamp costs a GATT read and a decode. This module instead
+ *           synchronizes from the server once, and keeps the time locally from the counter of
+ *           @ref app_timer:
+ *
+ *           - The counter is extended to 64 bits by a repeated timer, so the time does not depend
+ *             on how often it is asked for.
+ *           - Notifications of the Current Time are enabled, so adjustments made on the server
+ *             are followed at once. Otherwise, the time is read again every
+ *             BLE_CTS_C_CLOCK_RESYNC_INTERVAL_S seconds.
+ *           - Each synchronization that is not a manual, time zone or daylight saving time
+ *             adjustment measures the drift of the low frequency clock against the server, over
+ *             the time since the first synchronization or the last such adjustment, once that is
+ *             at least BLE_CTS_C_CLOCK_MIN_DRIFT_INTERVAL_S seconds. The local time is corrected
+ *             by the measured drift, limited to BLE_CTS_C_CLOCK_MAX_DRIFT_PPM.
+ *
+ *           The time is the local time of the server, as given by the Current Time characteristic.
+ *
+ * @note     The application must forward the events of its Current Time Service client with
+ *           @ref ble_cts_c_clock_on_cts_c_evt, after assigning the handles with
+ *           @ref ble_cts_c_handles_assign.
+ */
+
+#ifndef BLE_CTS_C_CLOCK_H__
+#define BLE_CTS_C_CLOCK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "ble_srv_common.h"
+#include "ble_date_time.h"
+#include "ble_cts_c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Local clock init structure. */
+typedef struct
+{
+    ble_cts_c_t           * p_cts;         /**< Current Time Service client used to synchronize the clock. */
+    ble_srv_error_handler_t error_handler; /**< Function to be called in case of an error. Can be NULL. */
+} ble_cts_c_clock_init_t;
+
+
+/**@brief Function for initializing the local clock.
+ *
+ * @details Must be called after @ref app_timer_init and @ref ble_cts_c_init.
+ *
+ * @param[in]   p_clock_init Information needed to initialize the clock.
+ *
+ * @retval NRF_SUCCESS    If the clock was initialized.
+ * @retval NRF_ERROR_NULL If any of the input parameters are NULL.
+ * @return Otherwise, an error code from @ref app_timer_create or @ref app_timer_start is returned.
+ */
+ret_code_t ble_cts_c_clock_init(ble_cts_c_clock_init_t const * p_clock_init);
+
+
+/**@brief Function for handling the events of the Current Time Service client.
+ *
+ * @details On @ref BLE_CTS_C_EVT_DISCOVERY_COMPLETE, notifications of the Current Time are
+ *          enabled, and the time is read if the clock is not synchronized or the resynchronization
+ *          is due. On @ref BLE_CTS_C_EVT_CURRENT_TIME, the clock is synchronized.
+ *
+ * @param[in]   p_cts   Current Time Service client structure.
+ * @param[in]   p_evt   Event received from the Current Time Service client.
+ */
+void ble_cts_c_clock_on_cts_c_evt(ble_cts_c_t * p_cts, ble_cts_c_evt_t const * p_evt);
+
+
+/**@brief Function for checking if the local clock has been synchronized.
+ *
+ * @return True once a valid Current Time has been received.
+ */
+bool ble_cts_c_clock_is_synced(void);
+
+
+/**@brief Function for getting the local time.
+ *
+ * @param[out]  p_date_time     Current date and time.
+ * @param[out]  p_fractions256  Fractions of the current second, in 1/256 s. Can be NULL.
+ *
+ * @retval NRF_SUCCESS             If the time was given.
+ * @retval NRF_ERROR_NULL          If @p p_date_time is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If the clock is not synchronized.
+ */
+ret_code_t ble_cts_c_clock_time_get(ble_date_time_t * p_date_time, uint8_t * p_fractions256);
+
+
+/**@brief Function for getting the local time as a number of seconds.
+ *
+ * @param[out]  p_seconds   Seconds since 1970-01-01 00:00:00, in the local time of the server.
+ *
+ * @retval NRF_SUCCESS             If the time was given.
+ * @retval NRF_ERROR_NULL          If @p p_seconds is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If the clock is not synchronized.
+ */
+ret_code_t ble_cts_c_clock_seconds_get(uint32_t * p_seconds);
+
+
+/**@brief Function for getting the measured drift of the low frequency clock.
+ *
+ * @return Drift in parts per billion, positive if the low frequency clock is slow. 0 until it has
+ *         been measured.
+ */
+int32_t ble_cts_c_clock_drift_get(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_CTS_C_CLOCK_H__
+
+/** @} */
@@ -51,9 +51,16 @@
 #include "peer_id.h"
 #include "nrf_sdh_soc.h"
 #include "nrf_strerror.h"
+#include "nrf_bootloader_info.h"
 
 #if (NRF_DFU_BLE_BUTTONLESS_SUPPORTS_BONDS)
 
+#ifndef NRF_DFU_BLE_BUTTONLESS_FAST_ENTER
+#define NRF_DFU_BLE_BUTTONLESS_FAST_ENTER 0
+#endif
+
+#define GPREGRET2_SERVICE_CHANGED_BIT   (0x02)  /**< GPREGRET2 flag, next to the flags of the bootloader, marking that Service Changed must be set pending for all bonded peers. */
+
 
 void ble_dfu_buttonless_on_sys_evt(uint32_t, void * );
 uint32_t nrf_dfu_svci_vector_table_set(void);
@@ -190,6 +197,35 @@ static uint32_t enter_bootloader(void)
 }
 
 
+#if NRF_DFU_BLE_BUTTONLESS_FAST_ENTER
+/**@brief Function for setting Service Changed pending for all bonded peers if the bootloader was
+ *        entered through the fast path before the last reset.
+ */
+static uint32_t service_changed_restore(void)
+{
+    uint32_t ret;
+    uint32_t gpregret2;
+
+    ret = sd_power_gpregret_get(1, &gpregret2);
+    VERIFY_SUCCESS(ret);
+
+    if (((gpregret2 & BOOTLOADER_DFU_GPREGRET2_MASK) != BOOTLOADER_DFU_GPREGRET2) ||
+        ((gpregret2 & GPREGRET2_SERVICE_CHANGED_BIT) == 0))
+    {
+        return NRF_SUCCESS;
+    }
+
+    ret = sd_power_gpregret_clr(1, GPREGRET2_SERVICE_CHANGED_BIT);
+    VERIFY_SUCCESS(ret);
+
+    NRF_LOG_DEBUG("Setting Service Changed indication pending for peers after bootloader entry");
+    gscm_local_database_has_changed();
+
+    return NRF_SUCCESS;
+}
+#endif // NRF_DFU_BLE_BUTTONLESS_FAST_ENTER
+
+
 uint32_t ble_dfu_buttonless_backend_init(ble_dfu_buttonless_t * p_dfu)
 {
     VERIFY_PARAM_NOT_NULL(p_dfu);
@@ -197,6 +233,11 @@ uint32_t ble_dfu_buttonless_backend_init(ble_dfu_buttonless_t * p_dfu)
     // Set the memory used by the backend.
     mp_dfu = p_dfu;
 
+#if NRF_DFU_BLE_BUTTONLESS_FAST_ENTER
+    uint32_t ret = service_changed_restore();
+    VERIFY_SUCCESS(ret);
+#endif
+
     // Initialize the Peer manager handler.
     return pm_register(pm_evt_handler);
 }
@@ -353,6 +394,20 @@ uint32_t ble_dfu_buttonless_bootloader_start_prepare(void)
     // bonded devices.
     mp_dfu->evt_handler(BLE_DFU_EVT_BOOTLOADER_ENTER_PREPARE);
 
+#if NRF_DFU_BLE_BUTTONLESS_FAST_ENTER
+    uint32_t ret;
+
+    // Keep the Service Changed request in GPREGRET2, which survives the reset, instead of
+    // waiting for one flash write per bonded peer. It is applied on the next start of the
+    // application (either because of a successful or aborted DFU).
+    ret = sd_power_gpregret_clr(1, BOOTLOADER_DFU_GPREGRET2_MASK);
+    VERIFY_SUCCESS(ret);
+
+    ret = sd_power_gpregret_set(1, BOOTLOADER_DFU_GPREGRET2 | GPREGRET2_SERVICE_CHANGED_BIT);
+    VERIFY_SUCCESS(ret);
+
+    return ble_dfu_buttonless_bootloader_start_finalize();
+#else
     // Store the number of peers for which Peer Manager is expected to successfully write events.
     mp_dfu->peers_count = peer_id_n_ids();
 
@@ -361,6 +416,7 @@ uint32_t ble_dfu_buttonless_bootloader_start_prepare(void)
     gscm_local_database_has_changed();
 
     return NRF_SUCCESS;
+#endif // NRF_DFU_BLE_BUTTONLESS_FAST_ENTER
 }
 
 #endif // NRF_DFU_BLE_BUTTONLESS_SUPPORTS_BONDS
@@ -66,6 +66,8 @@ NRF_LOG_MODULE_REGISTER();
 #define BLE_DIS_C_ALL_CHARS_DISABLED_MASK 0x0000 /**< All DIS characteristics should be disabled. */
 #define BLE_DIS_C_ALL_CHARS_ENABLED_MASK  0xFFFF /**< All DIS characteristics should be enabled. */
 
+#define READ_ALL_QUEUING_BIT              BLE_DIS_C_CHAR_TYPES_NUM /**< Bit in the pending mask set while @ref ble_dis_c_read_all queues requests. */
+
 
 /**@brief Function for interception of gattc errors.
  *
@@ -86,6 +88,88 @@ static void gatt_error_handler(uint32_t nrf_error, void * p_contex, uint16_t con
 }
 
 
+/**@brief Function for generating the read all done event once every requested read is answered.
+ *
+ * @param[in] p_ble_dis_c  Pointer to the Device Information Client Structure.
+ */
+static void read_all_done_check(ble_dis_c_t * p_ble_dis_c)
+{
+    if ((p_ble_dis_c->read_all_mask == 0) || (p_ble_dis_c->read_all_pending != 0))
+    {
+        return;
+    }
+
+    ble_dis_c_evt_t ble_dis_c_evt;
+
+    memset(&ble_dis_c_evt, 0, sizeof(ble_dis_c_evt_t));
+    ble_dis_c_evt.evt_type                             = BLE_DIS_C_EVT_DIS_C_READ_ALL_DONE;
+    ble_dis_c_evt.conn_handle                          = p_ble_dis_c->conn_handle;
+    ble_dis_c_evt.params.read_all_done.read_mask       = p_ble_dis_c->read_all_mask;
+    ble_dis_c_evt.params.read_all_done.error_mask      = p_ble_dis_c->read_all_errors;
+
+    p_ble_dis_c->read_all_mask   = 0;
+    p_ble_dis_c->read_all_errors = 0;
+
+    if (p_ble_dis_c->evt_handler != NULL)
+    {
+        p_ble_dis_c->evt_handler(p_ble_dis_c, &ble_dis_c_evt);
+    }
+}
+
+
+/**@brief Function for recording the outcome of a read requested by @ref ble_dis_c_read_all.
+ *
+ * @param[in] p_ble_dis_c  Pointer to the Device Information Client Structure.
+ * @param[in] char_type    Characteristic type that was answered.
+ * @param[in] success      True if the characteristic value was read.
+ */
+static void read_all_rsp_handle(ble_dis_c_t         * p_ble_dis_c,
+                                ble_dis_c_char_type_t char_type,
+                                bool                  success)
+{
+    if (!nrf_bitmask_bit_is_set(char_type, &p_ble_dis_c->read_all_pending))
+    {
+        return;
+    }
+
+    nrf_bitmask_bit_clear(char_type, &p_ble_dis_c->read_all_pending);
+    if (!success)
+    {
+        nrf_bitmask_bit_set(char_type, &p_ble_dis_c->read_all_errors);
+    }
+
+    read_all_done_check(p_ble_dis_c);
+}
+
+
+/**@brief Function for interception of gattc errors of requests queued by @ref ble_dis_c_read_all.
+ *
+ * @details The GATT Queue issues the requests of a connection in order, so the failed request is
+ *          the first one that is still unanswered.
+ *
+ * @param[in] nrf_error    Error code returned by SoftDevice.
+ * @param[in] p_contex     Parameter from the event handler.
+ * @param[in] conn_handle  Connection handle.
+ */
+static void read_all_error_handler(uint32_t nrf_error, void * p_contex, uint16_t conn_handle)
+{
+    ble_dis_c_t * const p_ble_dis_c = (ble_dis_c_t *)p_contex;
+
+    gatt_error_handler(nrf_error, p_contex, conn_handle);
+
+    for (ble_dis_c_char_type_t char_type = (ble_dis_c_char_type_t) 0;
+         char_type < BLE_DIS_C_CHAR_TYPES_NUM;
+         char_type++)
+    {
+        if (nrf_bitmask_bit_is_set(char_type, &p_ble_dis_c->read_all_pending))
+        {
+            read_all_rsp_handle(p_ble_dis_c, char_type, false);
+            break;
+        }
+    }
+}
+
+
 /**@brief Function for decoding System ID characteristic value.
  *
  * @param[in]  p_data     Pointer to System ID characteristic data.
@@ -265,6 +349,8 @@ static void on_read_rsp(ble_dis_c_t * p_ble_dis_c, ble_evt_t const * p_ble_evt)
 
             p_ble_dis_c->evt_handler(p_ble_dis_c, &ble_dis_c_evt);
             NRF_LOG_DEBUG("Received correct read response.");
+
+            read_all_rsp_handle(p_ble_dis_c, char_type, true);
         }
         else // Generate error event.
         {
@@ -276,6 +362,8 @@ static void on_read_rsp(ble_dis_c_t * p_ble_dis_c, ble_evt_t const * p_ble_evt)
 
             p_ble_dis_c->evt_handler(p_ble_dis_c, &ble_dis_c_evt);
             NRF_LOG_ERROR("Read request failed: 0x%04X.", p_ble_evt->evt.gattc_evt.gatt_status);
+
+            read_all_rsp_handle(p_ble_dis_c, char_type, false);
         }
     }
 }
@@ -294,7 +382,10 @@ static void on_disconnected(ble_dis_c_t * p_ble_dis_c, const ble_evt_t * p_ble_e
 {
     if (p_ble_dis_c->conn_handle == p_ble_evt->evt.gap_evt.conn_handle)
     {
-        p_ble_dis_c->conn_handle = BLE_CONN_HANDLE_INVALID;
+        p_ble_dis_c->conn_handle      = BLE_CONN_HANDLE_INVALID;
+        p_ble_dis_c->read_all_mask    = 0;
+        p_ble_dis_c->read_all_pending = 0;
+        p_ble_dis_c->read_all_errors  = 0;
 
         if (p_ble_dis_c->evt_handler != NULL)
         {
@@ -324,6 +415,10 @@ ret_code_t ble_dis_c_init(ble_dis_c_t * p_ble_dis_c, ble_dis_c_init_t * p_ble_di
     p_ble_dis_c->p_gatt_queue  = p_ble_dis_c_init->p_gatt_queue;
     p_ble_dis_c->evt_handler   = p_ble_dis_c_init->evt_handler;
     p_ble_dis_c->error_handler = p_ble_dis_c_init->error_handler;
+
+    p_ble_dis_c->read_all_mask    = 0;
+    p_ble_dis_c->read_all_pending = 0;
+    p_ble_dis_c->read_all_errors  = 0;
     memset(p_ble_dis_c->handles, BLE_GATT_HANDLE_INVALID, sizeof(p_ble_dis_c->handles));
 
     // Enable only selected characteristics if characteristic group is defined.
@@ -493,6 +588,69 @@ ret_code_t ble_dis_c_read(ble_dis_c_t * p_ble_dis_c, ble_dis_c_char_type_t char_
 }
 
 
+ret_code_t ble_dis_c_read_all(ble_dis_c_t * p_ble_dis_c)
+{
+    ret_code_t       err_code = NRF_SUCCESS;
+    nrf_ble_gq_req_t dis_c_req;
+
+    VERIFY_PARAM_NOT_NULL(p_ble_dis_c);
+
+    if (p_ble_dis_c->conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (p_ble_dis_c->read_all_mask != 0)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    memset(&dis_c_req, 0, sizeof(dis_c_req));
+    dis_c_req.type                = NRF_BLE_GQ_REQ_GATTC_READ;
+    dis_c_req.error_handler.cb    = read_all_error_handler;
+    dis_c_req.error_handler.p_ctx = p_ble_dis_c;
+
+    // Hold back the done event while requests are being queued.
+    nrf_bitmask_bit_set(READ_ALL_QUEUING_BIT, &p_ble_dis_c->read_all_pending);
+
+    for (ble_dis_c_char_type_t char_type = (ble_dis_c_char_type_t) 0;
+         char_type < BLE_DIS_C_CHAR_TYPES_NUM;
+         char_type++)
+    {
+        if (p_ble_dis_c->handles[char_type] == BLE_GATT_HANDLE_INVALID)
+        {
+            continue;
+        }
+
+        dis_c_req.params.gattc_read.handle = p_ble_dis_c->handles[char_type];
+
+        // Mark the read before queuing it, as the GATT Queue may issue it right away.
+        nrf_bitmask_bit_set(char_type, &p_ble_dis_c->read_all_mask);
+        nrf_bitmask_bit_set(char_type, &p_ble_dis_c->read_all_pending);
+
+        err_code = nrf_ble_gq_item_add(p_ble_dis_c->p_gatt_queue, &dis_c_req, p_ble_dis_c->conn_handle);
+        if (err_code != NRF_SUCCESS)
+        {
+            nrf_bitmask_bit_clear(char_type, &p_ble_dis_c->read_all_mask);
+            nrf_bitmask_bit_clear(char_type, &p_ble_dis_c->read_all_pending);
+            break;
+        }
+    }
+
+    nrf_bitmask_bit_clear(READ_ALL_QUEUING_BIT, &p_ble_dis_c->read_all_pending);
+
+    if (p_ble_dis_c->read_all_mask == 0)
+    {
+        return (err_code == NRF_SUCCESS) ? NRF_ERROR_INVALID_STATE : err_code;
+    }
+
+    // Requests that failed immediately may have answered everything already.
+    read_all_done_check(p_ble_dis_c);
+
+    return err_code;
+}
+
+
 ret_code_t ble_dis_c_handles_assign(ble_dis_c_t              * p_ble_dis_c,
                                     uint16_t                   conn_handle,
                                     ble_dis_c_handle_t const * p_peer_handles)
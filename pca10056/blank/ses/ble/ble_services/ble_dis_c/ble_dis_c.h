@@ -109,7 +109,8 @@ typedef enum
     BLE_DIS_C_EVT_DISCOVERY_COMPLETE,   /**< Event indicating that the DIS and its characteristics were discovered. See @ref ble_dis_c_evt_disc_complete_t. */
     BLE_DIS_C_EVT_DIS_C_READ_RSP,       /**< Event indicating that the client has received a read response from a peer. See @ref ble_dis_c_evt_read_rsp_t. */
     BLE_DIS_C_EVT_DIS_C_READ_RSP_ERROR, /**< Event indicating that the client's read request has failed. See @ref ble_dis_c_evt_read_rsp_err_t. */
-    BLE_DIS_C_EVT_DISCONNECTED          /**< Event indicating that the DIS server has disconnected. */
+    BLE_DIS_C_EVT_DISCONNECTED,         /**< Event indicating that the DIS server has disconnected. */
+    BLE_DIS_C_EVT_DIS_C_READ_ALL_DONE   /**< Event indicating that all reads requested with @ref ble_dis_c_read_all have completed. See @ref ble_dis_c_evt_read_all_done_t. */
 } ble_dis_c_evt_type_t;
 
 /**@brief DIS Client characteristic type. */
@@ -165,6 +166,13 @@ typedef struct
     uint16_t              gatt_status; /**< GATT status code for the read operation, see @ref BLE_GATT_STATUS_CODES. */
 } ble_dis_c_evt_read_rsp_err_t;
 
+/**@brief Event structure for @ref BLE_DIS_C_EVT_DIS_C_READ_ALL_DONE. */
+typedef struct
+{
+    uint16_t read_mask;  /**< Bitmask of characteristic types (see @ref ble_dis_c_char_type_t) that were requested. */
+    uint16_t error_mask; /**< Bitmask of requested characteristic types that could not be read. */
+} ble_dis_c_evt_read_all_done_t;
+
 /**@brief Structure containing the DIS event data received from the peer. */
 typedef struct
 {
@@ -175,6 +183,7 @@ typedef struct
         ble_dis_c_evt_disc_complete_t disc_complete; /**< Discovery Complete Event Parameters. Filled when evt_type is @ref BLE_DIS_C_EVT_DISCOVERY_COMPLETE. */
         ble_dis_c_evt_read_rsp_t      read_rsp;      /**< Read Response Event Parameters. Filled when evt_type is @ref BLE_DIS_C_EVT_DIS_C_READ_RSP. */
         ble_dis_c_evt_read_rsp_err_t  read_rsp_err;  /**< Read Response Error Event Parameters. Filled when evt_type is @ref BLE_DIS_C_EVT_DIS_C_READ_RSP_ERROR. */
+        ble_dis_c_evt_read_all_done_t read_all_done; /**< Read All Done Event Parameters. Filled when evt_type is @ref BLE_DIS_C_EVT_DIS_C_READ_ALL_DONE. */
     } params;
 } ble_dis_c_evt_t;
 
@@ -197,6 +206,9 @@ struct ble_dis_c_s
     ble_srv_error_handler_t error_handler;                     /**< Application error handler to be called in case of an error. */
     ble_dis_c_evt_handler_t evt_handler;                       /**< Application event handler to be called when there is an event related to the DIS. */
     nrf_ble_gq_t          * p_gatt_queue;                      /**< Pointer to BLE GATT Queue instance. */
+    uint16_t                read_all_mask;                     /**< Characteristics requested by @ref ble_dis_c_read_all. */
+    uint16_t                read_all_pending;                  /**< Requested characteristics that have not been answered yet. */
+    uint16_t                read_all_errors;                   /**< Requested characteristics that could not be read. */
 };
 
 /**@brief Structure describing the group of DIS characteristics with which this module can interact. */
@@ -280,6 +292,30 @@ void ble_dis_c_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
 ret_code_t ble_dis_c_read(ble_dis_c_t * p_ble_dis_c, ble_dis_c_char_type_t char_type);
 
 
+/**@brief     Function for reading all enabled characteristics that were found in DIS.
+ *
+ * @details   This function queues a read request for every characteristic with a valid handle
+ *            in one go, so that the GATT Queue issues each request as soon as the previous
+ *            response arrives instead of waiting for the application. Every response is still
+ *            provided with the @ref BLE_DIS_C_EVT_DIS_C_READ_RSP or
+ *            @ref BLE_DIS_C_EVT_DIS_C_READ_RSP_ERROR event. When the last one has been received,
+ *            the @ref BLE_DIS_C_EVT_DIS_C_READ_ALL_DONE event is generated.
+ *
+ * @note      If queuing fails part way, the requests that were already queued are still
+ *            reported by the @ref BLE_DIS_C_EVT_DIS_C_READ_ALL_DONE event.
+ *
+ * @param[in] p_ble_dis_c     Pointer to the DIS client structure.
+ *
+ * @retval    NRF_SUCCESS              If the operation was successful.
+ * @retval    NRF_ERROR_NULL           If a \p p_ble_dis_c was a NULL pointer.
+ * @retval    NRF_ERROR_INVALID_STATE  If connection handle is invalid or no characteristic handle
+ *                                     is valid.
+ * @retval    NRF_ERROR_BUSY           If a previous read of all characteristics is in progress.
+ * @retval    NRF_ERROR_NO_MEM         If the client request queue is full.
+ */
+ret_code_t ble_dis_c_read_all(ble_dis_c_t * p_ble_dis_c);
+
+
 /**@brief Function for assigning handles to this instance of dis_c.
  *
  * @details Call this function when a link has been established with a peer to
@@ -132,4 +132,20 @@
 #define ESCS_FUNCT_REMAIN_CONNECTABLE_SUPPORTED_Yes   (0x01)
 #define ESCS_FUNCT_REMAIN_CONNECTABLE_SUPPORTED_No    (0x00)
 
+// Characteristic: Bulk Configuration (vendor specific, not part of the Eddystone specifications)
+#define ESCS_BULK_CONFIG_VERSION                      (0x01)
+#define ESCS_BULK_CONFIG_HEADER_LENGTH                (4) // Version, ADV interval (big endian) and slot count
+#define ESCS_BULK_CONFIG_VERSION_IDX                  (0)
+#define ESCS_BULK_CONFIG_ADV_INTERVAL_IDX             (1)
+#define ESCS_BULK_CONFIG_SLOT_COUNT_IDX               (3)
+#define ESCS_BULK_CONFIG_ADV_INTERVAL_UNCHANGED       (0x0000) // Written ADV interval that keeps the current interval
+#define ESCS_BULK_CONFIG_SLOT_HEADER_LENGTH           (4) // Slot number, radio TX power, advertised TX power and frame length
+#define ESCS_BULK_CONFIG_SLOT_NO_IDX                  (0)
+#define ESCS_BULK_CONFIG_SLOT_RADIO_TX_PWR_IDX        (1)
+#define ESCS_BULK_CONFIG_SLOT_ADV_TX_PWR_IDX          (2)
+#define ESCS_BULK_CONFIG_SLOT_FRAME_LENGTH_IDX        (3)
+#define ESCS_BULK_CONFIG_ADV_TX_PWR_CALIBRATED        (-128) // Advertised TX power that selects the calibrated ranging data
+#define ESCS_BULK_CONFIG_LENGTH_MAX(slots)            (ESCS_BULK_CONFIG_HEADER_LENGTH + (slots) *                       \
+                                                       (ESCS_BULK_CONFIG_SLOT_HEADER_LENGTH + ESCS_ADV_SLOT_CHAR_LENGTH_MAX))
+
 #endif // ESCS_DEFS_H__
@@ -48,7 +48,20 @@
     #define DEBUG_PRINTF(...)
 #endif
 
+#if NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+#define BULK_CONFIG_LEN_MAX ESCS_BULK_CONFIG_LENGTH_MAX(APP_MAX_ADV_SLOTS)
+
+// The SoftDevice queues each prepared write as handle, offset and length (6 bytes) followed by the
+// data, and terminates the queue with an invalid handle. The default ATT MTU gives the most entries.
+#define PREP_WRITE_DATA_LEN (BLE_GATT_ATT_MTU_DEFAULT - 5)
+#define EID_BUFF_SIZE       MAX(64, (CEIL_DIV(BULK_CONFIG_LEN_MAX, PREP_WRITE_DATA_LEN) * (PREP_WRITE_DATA_LEN + 6) + 2))
+#define LONG_WRITE_LEN_MAX  MAX(ESCS_ADV_SLOT_CHAR_LENGTH_MAX, BULK_CONFIG_LEN_MAX)
+
+STATIC_ASSERT(BULK_CONFIG_LEN_MAX <= BLE_GATTS_VAR_ATTR_LEN_MAX);
+#else
 #define EID_BUFF_SIZE       64
+#define LONG_WRITE_LEN_MAX  ESCS_ADV_SLOT_CHAR_LENGTH_MAX
+#endif
 
 typedef struct
 {
@@ -242,9 +255,28 @@ static ble_add_char_params_t REMAIN_CONNECTABLE_CHAR_INIT =
     .max_len          = 1,
 };
 
+#if NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+static ble_add_char_params_t BULK_CONFIG_CHAR_INIT =
+{
+    .uuid         = BLE_UUID_ESCS_BULK_CONFIG_CHAR,
+    .read_access  = SEC_OPEN,
+    .write_access = SEC_OPEN,
+    .char_props   =
+    {
+       .read  = 1,
+       .write = 1,
+    },
+    .is_defered_read  = true,
+    .is_defered_write = true,
+    .is_var_len       = true,
+    .init_len         = 1,
+    .max_len          = BULK_CONFIG_LEN_MAX,
+};
+#endif
+
 static val_handle_to_uuid_t m_handle_to_uuid_map[BLE_ESCS_NUMBER_OF_CHARACTERISTICS]; //!< Map from handle to UUID.
 static uint8_t              m_handle_to_uuid_map_idx = 0;   //!< Index of map from handle to UUID.
-static uint8_t              m_eid_mem[EID_BUFF_SIZE] = {0}; //!< Memory buffer used for EID writes.
+static uint8_t              m_eid_mem[EID_BUFF_SIZE] = {0}; //!< Memory buffer used for EID and Bulk Configuration writes.
 static ble_user_mem_block_t m_eid_mem_block =
 {
     .p_mem = m_eid_mem,
@@ -370,6 +402,7 @@ static ret_code_t on_write(nrf_ble_escs_t * p_escs, ble_evt_t const * p_ble_evt)
 static void on_long_write(nrf_ble_escs_t * p_escs, ble_evt_t const * p_ble_evt)
 {
     static uint16_t write_evt_uuid;
+    static uint16_t write_evt_handle;
     static bool write_evt_uuid_set = false;
     uint32_t err_code;
 
@@ -386,6 +419,7 @@ static void on_long_write(nrf_ble_escs_t * p_escs, ble_evt_t const * p_ble_evt)
         err_code = get_evt_type_for_handle(p_evt_write->handle, &write_evt_uuid);
         APP_ERROR_CHECK(err_code);
 
+        write_evt_handle   = p_evt_write->handle;
         write_evt_uuid_set = true;
 
         reply.type                     = BLE_GATTS_AUTHORIZE_TYPE_WRITE;
@@ -401,7 +435,7 @@ static void on_long_write(nrf_ble_escs_t * p_escs, ble_evt_t const * p_ble_evt)
 
     else if (p_evt_write->op == BLE_GATTS_OP_EXEC_WRITE_REQ_NOW)
     {
-        uint8_t           value_buffer[ESCS_ADV_SLOT_CHAR_LENGTH_MAX] = {0};
+        uint8_t           value_buffer[LONG_WRITE_LEN_MAX] = {0};
         ble_gatts_value_t value =
         {
             .len = sizeof(value_buffer),
@@ -423,16 +457,17 @@ static void on_long_write(nrf_ble_escs_t * p_escs, ble_evt_t const * p_ble_evt)
         APP_ERROR_CHECK(err_code);
 
         // Now that the value has been accepted using 'sd_ble_gatts_rw_authorize_reply', it can be found in the database.
-        err_code = sd_ble_gatts_value_get(  p_escs->conn_handle,
-                                            p_escs->rw_adv_slot_handles.value_handle,
-                                            &value);
+        err_code = sd_ble_gatts_value_get(p_escs->conn_handle, write_evt_handle, &value);
         APP_ERROR_CHECK(err_code);
 
+        // The write has already been replied to, so the handler must not reply again.
+        p_escs->is_long_write = true;
         p_escs->write_evt_handler(p_escs,
                                   write_evt_uuid,
-                                  p_evt_write->handle,
+                                  write_evt_handle,
                                   value.p_value,
                                   value.len);
+        p_escs->is_long_write = false;
     }
     else
     {
@@ -537,7 +572,8 @@ ret_code_t nrf_ble_escs_on_ble_evt(nrf_ble_escs_t * p_escs, ble_evt_t const * p_
             VERIFY_SUCCESS(err_code);
             break;
 
-        // BLE_EVT_USER_MEM_REQUEST & BLE_EVT_USER_MEM_RELEASE are for long writes to the RW ADV slot characteristic
+        // BLE_EVT_USER_MEM_REQUEST & BLE_EVT_USER_MEM_RELEASE are for long writes to the RW ADV slot
+        // and Bulk Configuration characteristics
         case BLE_EVT_USER_MEM_REQUEST:
             err_code = sd_ble_user_mem_reply(p_escs->conn_handle, &m_eid_mem_block);
             VERIFY_SUCCESS(err_code);
@@ -569,6 +605,7 @@ ret_code_t nrf_ble_escs_init(nrf_ble_escs_t * p_escs, const nrf_ble_escs_init_t
     p_escs->conn_handle       = BLE_CONN_HANDLE_INVALID;
     p_escs->write_evt_handler = p_escs_init->write_evt_handler;
     p_escs->read_evt_handler  = p_escs_init->read_evt_handler;
+    p_escs->is_long_write     = false;
 
     // Add a custom base UUID.
     err_code = sd_ble_uuid_vs_add(&ecs_base_uuid, &p_escs->uuid_type);
@@ -645,5 +682,11 @@ ret_code_t nrf_ble_escs_init(nrf_ble_escs_t * p_escs, const nrf_ble_escs_init_t
                         &p_escs->remain_connectable_handles);
     VERIFY_SUCCESS(err_code);
 
+#if NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+    err_code = char_add(&BULK_CONFIG_CHAR_INIT, p_escs,
+                        &zero_val, &p_escs->bulk_config_handles);
+    VERIFY_SUCCESS(err_code);
+#endif
+
     return NRF_SUCCESS;
 }
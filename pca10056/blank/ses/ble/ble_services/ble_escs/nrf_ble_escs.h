@@ -57,7 +57,11 @@
  * @{
  */
 
+#if NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+#define BLE_ESCS_NUMBER_OF_CHARACTERISTICS 14 //!< Number of characteristics contained in the Eddystone Configuration Service.
+#else
 #define BLE_ESCS_NUMBER_OF_CHARACTERISTICS 13 //!< Number of characteristics contained in the Eddystone Configuration Service.
+#endif
 
 #define BLE_UUID_ESCS_SERVICE 0x7500    //!< UUID of the Eddystone Configuration Service.
 
@@ -74,6 +78,7 @@
 #define BLE_UUID_ESCS_RW_ADV_SLOT_CHAR        0x750A
 #define BLE_UUID_ESCS_FACTORY_RESET_CHAR      0x750B
 #define BLE_UUID_ESCS_REMAIN_CONNECTABLE_CHAR 0x750C
+#define BLE_UUID_ESCS_BULK_CONFIG_CHAR        0x750D //!< Vendor specific, reads and writes the configuration of all slots at once.
 
 #define ESCS_BASE_UUID                                                                          \
     {{0x95, 0xE2, 0xED, 0xEB, 0x1B, 0xA0, 0x39, 0x8A, 0xDF, 0x4B, 0xD3, 0x8E, 0x00, 0x00, 0xC8, \
@@ -219,11 +224,15 @@ struct nrf_ble_escs_s
     ble_gatts_char_handles_t         rw_adv_slot_handles;        //!< Handles related to the ADV Slot Data characteristic (as provided by the SoftDevice).
     ble_gatts_char_handles_t         factory_reset_handles;      //!< Handles related to the (Advanced) Factory reset characteristic (as provided by the SoftDevice).
     ble_gatts_char_handles_t         remain_connectable_handles; //!< Handles related to the (Advanced) Remain Connectable characteristic (as provided by the SoftDevice).
+#if NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+    ble_gatts_char_handles_t         bulk_config_handles;        //!< Handles related to the (Vendor) Bulk Configuration characteristic (as provided by the SoftDevice).
+#endif
     uint16_t                         conn_handle;                //!< Handle of the current connection (as provided by the SoftDevice). @ref BLE_CONN_HANDLE_INVALID if not in a connection.
     nrf_ble_escs_write_evt_handler_t write_evt_handler;          //!< Event handler to be called for handling write attempts.
     nrf_ble_escs_read_evt_handler_t  read_evt_handler;           //!< Event handler to be called for handling read attempts.
     uint8_t                        * p_active_slot;
     uint8_t                          lock_state;
+    bool                             is_long_write;              //!< True while @ref write_evt_handler is called for an executed long write, which the service has already replied to.
 };
 
 
@@ -42,27 +42,20 @@
 #include "ble_gls_db.h"
 
 
-typedef struct
-{
-    bool          in_use_flag;
-    ble_gls_rec_t record;
-} database_entry_t;
+// Record indexes are 8 bits wide in the database API.
+STATIC_ASSERT((BLE_GLS_DB_MAX_RECORDS > 0) && (BLE_GLS_DB_MAX_RECORDS <= 256));
+
+// Slot in m_database that holds the record with the given index.
+#define DB_SLOT(rec_ndx)        ((m_first + (rec_ndx)) % BLE_GLS_DB_MAX_RECORDS)
 
-static database_entry_t m_database[BLE_GLS_DB_MAX_RECORDS];
-static uint8_t          m_database_crossref[BLE_GLS_DB_MAX_RECORDS];
+static ble_gls_rec_t    m_database[BLE_GLS_DB_MAX_RECORDS];  // Ring of records, oldest first.
+static uint16_t         m_first;                             // Slot of the record with index 0.
 static uint16_t         m_num_records;
 
 
 uint32_t ble_gls_db_init(void)
 {
-    int i;
-
-    for (i = 0; i < BLE_GLS_DB_MAX_RECORDS; i++)
-    {
-        m_database[i].in_use_flag = false;
-        m_database_crossref[i]    = 0xFF;
-    }
-
+    m_first       = 0;
     m_num_records = 0;
 
     return NRF_SUCCESS;
@@ -83,61 +76,89 @@ uint32_t ble_gls_db_record_get(uint8_t rec_ndx, ble_gls_rec_t * p_rec)
     }
 
     // copy record to the specified memory
-    *p_rec = m_database[m_database_crossref[rec_ndx]].record;
+    *p_rec = m_database[DB_SLOT(rec_ndx)];
 
     return NRF_SUCCESS;
 }
 
 
-uint32_t ble_gls_db_record_add(ble_gls_rec_t * p_rec)
+ble_gls_rec_t const * ble_gls_db_record_ptr_get(uint8_t rec_ndx)
 {
-    int i;
-
-    if (m_num_records == BLE_GLS_DB_MAX_RECORDS)
+    if (rec_ndx >= m_num_records)
     {
-        return NRF_ERROR_NO_MEM;
+        return NULL;
     }
 
-    // find next available database entry
-    for (i = 0; i < BLE_GLS_DB_MAX_RECORDS; i++)
+    return &m_database[DB_SLOT(rec_ndx)];
+}
+
+
+uint16_t ble_gls_db_lower_bound(uint16_t seq_num)
+{
+    uint16_t low  = 0;
+    uint16_t high = m_num_records;
+
+    while (low < high)
     {
-        if (!m_database[i].in_use_flag)
+        uint16_t mid = low + ((high - low) / 2);
+
+        if (m_database[DB_SLOT(mid)].meas.sequence_number < seq_num)
+        {
+            low = mid + 1;
+        }
+        else
         {
-            m_database[i].in_use_flag = true;
-            m_database[i].record      = *p_rec;
+            high = mid;
+        }
+    }
 
-            m_database_crossref[m_num_records] = i;
-            m_num_records++;
+    return low;
+}
 
-            return NRF_SUCCESS;
-        }
+
+uint32_t ble_gls_db_record_add(ble_gls_rec_t * p_rec)
+{
+    if (m_num_records == BLE_GLS_DB_MAX_RECORDS)
+    {
+        return NRF_ERROR_NO_MEM;
     }
 
-    return NRF_ERROR_NO_MEM;
+    m_database[DB_SLOT(m_num_records)] = *p_rec;
+    m_num_records++;
+
+    return NRF_SUCCESS;
 }
 
 
 uint32_t ble_gls_db_record_delete(uint8_t rec_ndx)
 {
-    int i;
+    uint16_t i;
 
     if (rec_ndx >= m_num_records)
     {
         return NRF_ERROR_NOT_FOUND;
     }
 
-    // free entry
-    m_database[m_database_crossref[rec_ndx]].in_use_flag = false;
+    // Close the gap from whichever side has fewer records to move.
+    if (rec_ndx < (m_num_records / 2))
+    {
+        for (i = rec_ndx; i > 0; i--)
+        {
+            m_database[DB_SLOT(i)] = m_database[DB_SLOT(i - 1)];
+        }
+        m_first = DB_SLOT(1);
+    }
+    else
+    {
+        for (i = rec_ndx; i < (m_num_records - 1); i++)
+        {
+            m_database[DB_SLOT(i)] = m_database[DB_SLOT(i + 1)];
+        }
+    }
 
     // decrease number of records
     m_num_records--;
 
-    // remove cross reference index
-    for (i = rec_ndx; i < m_num_records; i++)
-    {
-        m_database_crossref[i] = m_database_crossref[i + 1];
-    }
-
     return NRF_SUCCESS;
 }
 #endif // NRF_MODULE_ENABLED(BLE_GLS)
@@ -62,7 +62,9 @@
 extern "C" {
 #endif
 
+#ifndef BLE_GLS_DB_MAX_RECORDS
 #define BLE_GLS_DB_MAX_RECORDS      20
+#endif
 
 /**@brief Function for initializing the glucose record database.
  *
@@ -91,6 +93,27 @@ uint16_t ble_gls_db_num_records_get(void);
  */
 uint32_t ble_gls_db_record_get(uint8_t record_num, ble_gls_rec_t * p_rec);
 
+/**@brief Function for getting a pointer to a record in the database, without copying it.
+ *
+ * @param[in]   record_num    Index of the record to retrieve.
+ *
+ * @return      Pointer to the record, or NULL if there is no record with this index. The pointer
+ *              is valid until the database is next changed.
+ */
+ble_gls_rec_t const * ble_gls_db_record_ptr_get(uint8_t record_num);
+
+/**@brief Function for finding the first record with a sequence number greater than or equal to
+ *        a given value.
+ *
+ * @details Records are kept in the order they were added, which is the order of their sequence
+ *          numbers, so this is a binary search.
+ *
+ * @param[in]   seq_num   Sequence number to search for.
+ *
+ * @return      Index of the first such record, or the number of records if there is none.
+ */
+uint16_t ble_gls_db_lower_bound(uint16_t seq_num);
+
 /**@brief Function for adding a record at the end of the database.
  *
  * @details This call adds a record as the last record in the database.
@@ -0,0 +1,433 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_HIDS_FAST)
+#include "ble_hids_fast.h"
+#include <string.h>
+#include "ble_conn_state.h"
+
+
+/**@brief Function for finding the Input Report state of a link.
+ *
+ * @param[in]   p_fast      HID Service fast path structure.
+ * @param[in]   conn_handle Handle of the connection.
+ *
+ * @return      Input Report state of the link, or NULL if the link is not known.
+ */
+static ble_hids_fast_link_t * link_get(ble_hids_fast_t * p_fast, uint16_t conn_handle)
+{
+    uint16_t conn_idx = ble_conn_state_conn_idx(conn_handle);
+
+    if ((conn_idx >= p_fast->link_count) || (p_fast->p_links[conn_idx].conn_handle != conn_handle))
+    {
+        return NULL;
+    }
+
+    return &p_fast->p_links[conn_idx];
+}
+
+
+/**@brief Function for reading the notification state of all Input Reports of a link.
+ *
+ * @details The CCCD values are only valid once the system attributes of the peer have been set,
+ *          which may happen after the Connect event. The read is tried again on the next report
+ *          until it succeeds.
+ *
+ * @param[in]   p_fast      HID Service fast path structure.
+ * @param[in]   p_link      Input Report state of the link.
+ */
+static void cccds_read(ble_hids_fast_t * p_fast, ble_hids_fast_link_t * p_link)
+{
+    uint32_t notif_mask = 0;
+
+    for (uint8_t i = 0; i < p_fast->rep_count; i++)
+    {
+        uint8_t           cccd[BLE_CCCD_VALUE_LEN];
+        ble_gatts_value_t gatts_value;
+
+        memset(&gatts_value, 0, sizeof(gatts_value));
+
+        gatts_value.len     = sizeof(cccd);
+        gatts_value.offset  = 0;
+        gatts_value.p_value = cccd;
+
+        if (sd_ble_gatts_value_get(p_link->conn_handle,
+                                   p_fast->reps[i].cccd_handle,
+                                   &gatts_value) != NRF_SUCCESS)
+        {
+            return;
+        }
+        if (ble_srv_is_notification_enabled(cccd))
+        {
+            notif_mask |= (1UL << i);
+        }
+    }
+
+    p_link->notif_mask = notif_mask;
+    p_link->cccd_known = true;
+}
+
+
+/**@brief Function for notifying an Input Report.
+ *
+ * @param[in]   p_fast      HID Service fast path structure.
+ * @param[in]   conn_handle Handle of the connection.
+ * @param[in]   rep_index   Index of the Input Report.
+ * @param[in]   len         Length of report.
+ * @param[in]   p_data      Report data.
+ *
+ * @return      Error code returned by sd_ble_gatts_hvx.
+ */
+static uint32_t rep_notify(ble_hids_fast_t * p_fast,
+                           uint16_t          conn_handle,
+                           uint8_t           rep_index,
+                           uint16_t          len,
+                           uint8_t const   * p_data)
+{
+    uint32_t               err_code;
+    ble_gatts_hvx_params_t hvx_params;
+    uint16_t               hvx_len = len;
+
+    memset(&hvx_params, 0, sizeof(hvx_params));
+
+    hvx_params.handle = p_fast->reps[rep_index].value_handle;
+    hvx_params.type   = BLE_GATT_HVX_NOTIFICATION;
+    hvx_params.offset = 0;
+    hvx_params.p_len  = &hvx_len;
+    hvx_params.p_data = p_data;
+
+    err_code = sd_ble_gatts_hvx(conn_handle, &hvx_params);
+    if ((err_code == NRF_SUCCESS) && (hvx_len != len))
+    {
+        err_code = NRF_ERROR_DATA_SIZE;
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for sending the held reports of a link, for as long as the notification queue has room.
+ *
+ * @param[in]   p_fast      HID Service fast path structure.
+ * @param[in]   p_link      Input Report state of the link.
+ *
+ * @retval NRF_SUCCESS If the held reports were sent, or are still held because the queue is full.
+ * @return             Otherwise, the error returned by sd_ble_gatts_hvx. The report is dropped.
+ */
+static uint32_t held_reps_send(ble_hids_fast_t * p_fast, ble_hids_fast_link_t * p_link)
+{
+    for (uint8_t i = 0; (i < p_fast->rep_count) && (p_link->held_mask != 0); i++)
+    {
+        uint32_t err_code;
+
+        if ((p_link->held_mask & (1UL << i)) == 0)
+        {
+            continue;
+        }
+
+        err_code = rep_notify(p_fast, p_link->conn_handle, i, p_link->held_len[i], p_link->held[i]);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            return NRF_SUCCESS;
+        }
+
+        p_link->held_mask &= ~(1UL << i);
+        VERIFY_SUCCESS(err_code);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for holding a report until the notification queue has room.
+ *
+ * @param[in]   p_fast      HID Service fast path structure.
+ * @param[in]   p_link      Input Report state of the link.
+ * @param[in]   rep_index   Index of the Input Report.
+ * @param[in]   len         Length of report.
+ * @param[in]   p_data      Report data.
+ */
+static void rep_hold(ble_hids_fast_t      * p_fast,
+                     ble_hids_fast_link_t * p_link,
+                     uint8_t                rep_index,
+                     uint16_t               len,
+                     uint8_t const        * p_data)
+{
+    uint32_t bit = (1UL << rep_index);
+
+    if ((p_link->held_mask & bit) && (p_fast->merge_handler != NULL))
+    {
+        uint16_t held_len = p_fast->merge_handler(rep_index,
+                                                  p_link->held[rep_index],
+                                                  p_link->held_len[rep_index],
+                                                  p_data,
+                                                  len);
+
+        p_link->held_len[rep_index] = MIN(held_len, BLE_HIDS_FAST_REP_MAX_LEN);
+    }
+    else
+    {
+        memcpy(p_link->held[rep_index], p_data, len);
+        p_link->held_len[rep_index] = len;
+    }
+
+    p_link->held_mask |= bit;
+}
+
+
+/**@brief Function for handling write events to an Input Report CCCD.
+ *
+ * @param[in]   p_fast      HID Service fast path structure.
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ */
+static void on_write(ble_hids_fast_t * p_fast, ble_evt_t const * p_ble_evt)
+{
+    ble_gatts_evt_write_t const * p_evt_write = &p_ble_evt->evt.gatts_evt.params.write;
+    ble_hids_fast_link_t        * p_link      = link_get(p_fast, p_ble_evt->evt.gatts_evt.conn_handle);
+
+    if ((p_link == NULL) || (p_evt_write->len != BLE_CCCD_VALUE_LEN))
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < p_fast->rep_count; i++)
+    {
+        if (p_evt_write->handle == p_fast->reps[i].cccd_handle)
+        {
+            if (ble_srv_is_notification_enabled(p_evt_write->data))
+            {
+                p_link->notif_mask |= (1UL << i);
+            }
+            else
+            {
+                p_link->notif_mask &= ~(1UL << i);
+                p_link->held_mask  &= ~(1UL << i);
+            }
+            return;
+        }
+    }
+}
+
+
+uint32_t ble_hids_fast_init(ble_hids_fast_t * p_fast, ble_hids_fast_init_t const * p_fast_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_fast);
+    VERIFY_PARAM_NOT_NULL(p_fast_init);
+    VERIFY_PARAM_NOT_NULL(p_fast_init->p_hids);
+
+    ble_hids_t * p_hids = p_fast_init->p_hids;
+    uint16_t     ctx_offset;
+
+    if (p_hids->inp_rep_count > BLE_HIDS_FAST_INP_REP_MAX)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    p_fast->p_hids        = p_hids;
+    p_fast->error_handler = p_fast_init->error_handler;
+    p_fast->merge_handler = p_fast_init->merge_handler;
+    p_fast->rep_count     = p_hids->inp_rep_count;
+
+    memset(p_fast->rep_index, BLE_HIDS_FAST_REP_INDEX_INVALID, sizeof(p_fast->rep_index));
+
+    // Input Reports come first in the host context, after the data of the boot reports.
+    ctx_offset = sizeof(ble_hids_client_context_t) + BOOT_KB_INPUT_REPORT_MAX_SIZE +
+                 BOOT_KB_OUTPUT_REPORT_MAX_SIZE + BOOT_MOUSE_INPUT_REPORT_MAX_SIZE;
+
+    for (uint8_t i = 0; i < p_fast->rep_count; i++)
+    {
+        uint8_t report_id = p_hids->p_inp_rep_init_array[i].rep_ref.report_id;
+
+        if (   (report_id > BLE_HIDS_FAST_REPORT_ID_MAX)
+            || (p_fast->rep_index[report_id] != BLE_HIDS_FAST_REP_INDEX_INVALID))
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+
+        p_fast->rep_index[report_id]  = i;
+        p_fast->reps[i].value_handle  = p_hids->inp_rep_array[i].char_handles.value_handle;
+        p_fast->reps[i].cccd_handle   = p_hids->inp_rep_array[i].char_handles.cccd_handle;
+        p_fast->reps[i].max_len       = p_hids->p_inp_rep_init_array[i].max_len;
+        p_fast->reps[i].ctx_offset    = ctx_offset;
+
+        ctx_offset += p_fast->reps[i].max_len;
+    }
+
+    for (uint8_t i = 0; i < p_fast->link_count; i++)
+    {
+        memset(&p_fast->p_links[i], 0, sizeof(ble_hids_fast_link_t));
+        p_fast->p_links[i].conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+void ble_hids_fast_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    ble_hids_fast_t      * p_fast = (ble_hids_fast_t *)p_context;
+    ble_hids_fast_link_t * p_link;
+    uint16_t               conn_idx;
+    uint32_t               err_code;
+
+    if ((p_fast == NULL) || (p_fast->p_hids == NULL) || (p_ble_evt == NULL))
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_CONNECTED:
+            conn_idx = ble_conn_state_conn_idx(p_ble_evt->evt.gap_evt.conn_handle);
+            if (conn_idx < p_fast->link_count)
+            {
+                p_link = &p_fast->p_links[conn_idx];
+                memset(p_link, 0, sizeof(ble_hids_fast_link_t));
+                p_link->conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+            }
+            break;
+
+        case BLE_GAP_EVT_DISCONNECTED:
+            p_link = link_get(p_fast, p_ble_evt->evt.gap_evt.conn_handle);
+            if (p_link != NULL)
+            {
+                p_link->conn_handle = BLE_CONN_HANDLE_INVALID;
+                p_link->held_mask   = 0;
+            }
+            break;
+
+        case BLE_GATTS_EVT_WRITE:
+            on_write(p_fast, p_ble_evt);
+            break;
+
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+            p_link = link_get(p_fast, p_ble_evt->evt.gatts_evt.conn_handle);
+            if (p_link != NULL)
+            {
+                err_code = held_reps_send(p_fast, p_link);
+                if ((err_code != NRF_SUCCESS) && (p_fast->error_handler != NULL))
+                {
+                    p_fast->error_handler(err_code);
+                }
+            }
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+
+uint32_t ble_hids_fast_inp_rep_send(ble_hids_fast_t * p_fast,
+                                    uint8_t           report_id,
+                                    uint16_t          len,
+                                    uint8_t const   * p_data,
+                                    uint16_t          conn_handle)
+{
+    VERIFY_PARAM_NOT_NULL(p_fast);
+    VERIFY_PARAM_NOT_NULL(p_data);
+
+    uint32_t               err_code;
+    uint8_t                rep_index;
+    uint8_t              * p_host_rep_data;
+    ble_hids_fast_link_t * p_link;
+
+    if (report_id > BLE_HIDS_FAST_REPORT_ID_MAX)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    rep_index = p_fast->rep_index[report_id];
+    if (rep_index == BLE_HIDS_FAST_REP_INDEX_INVALID)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    if (len > p_fast->reps[rep_index].max_len)
+    {
+        return NRF_ERROR_DATA_SIZE;
+    }
+
+    p_link = link_get(p_fast, conn_handle);
+    if (p_link == NULL)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    if (!p_link->cccd_known)
+    {
+        cccds_read(p_fast, p_link);
+    }
+    if ((p_link->notif_mask & (1UL << rep_index)) == 0)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    // Store the new report data in host's context
+    err_code = blcm_link_ctx_get(p_fast->p_hids->p_link_ctx_storage,
+                                 conn_handle,
+                                 (void *) &p_host_rep_data);
+    VERIFY_SUCCESS(err_code);
+
+    memcpy(p_host_rep_data + p_fast->reps[rep_index].ctx_offset, p_data, len);
+
+    if (p_link->held_mask & (1UL << rep_index))
+    {
+        if (len > BLE_HIDS_FAST_REP_MAX_LEN)
+        {
+            return NRF_ERROR_RESOURCES;
+        }
+
+        // Keep the order of the reports: merge into the held report and send that.
+        rep_hold(p_fast, p_link, rep_index, len, p_data);
+        return held_reps_send(p_fast, p_link);
+    }
+
+    err_code = rep_notify(p_fast, conn_handle, rep_index, len, p_data);
+    if ((err_code == NRF_ERROR_RESOURCES) && (len <= BLE_HIDS_FAST_REP_MAX_LEN))
+    {
+        rep_hold(p_fast, p_link, rep_index, len, p_data);
+        err_code = NRF_SUCCESS;
+    }
+
+    return err_code;
+}
+
+#endif // NRF_MODULE_ENABLED(BLE_HIDS_FAST)
@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup ble_hids_fast HID Service Input Report fast path
+ * @{
+ * @ingroup  ble_hids
+ * @brief    Module for sending Input Reports of the HID Service with minimum latency.
+ *
+ * @details  @ref ble_hids_inp_rep_send finds the characteristic and the host context of a report
+ *           by walking the report arrays on every call, and a report that does not fit in the
+ *           SoftDevice notification queue is rejected. This module is an alternative path for
+ *           sending Input Reports of an initialized @ref ble_hids instance:
+ *
+ *           - The value handle, CCCD handle and host context offset of each Input Report are
+ *             computed once in @ref ble_hids_fast_init, and reports are found by Report ID
+ *             through a direct table.
+ *           - The notification state of each report is kept per link as a bit mask. It is read
+ *             from the CCCDs once after connecting, when the system attributes of the peer are
+ *             in place, and updated on every CCCD write.
+ *           - When the notification queue is full, the report is held per link and report, and
+ *             merged with any later report for the same Report ID, so that only the latest state
+ *             is sent once the queue has room again. By default a later report replaces the held
+ *             one. Reports carrying relative data, such as mouse motion, should supply a
+ *             @ref ble_hids_fast_merge_handler_t that accumulates them instead.
+ *
+ *           Boot mode reports are still sent with @ref ble_hids_boot_kb_inp_rep_send and
+ *           @ref ble_hids_boot_mouse_inp_rep_send.
+ *
+ * @note     The application must register this module as BLE event observer, which is done by
+ *           @ref BLE_HIDS_FAST_DEF.
+ */
+
+#ifndef BLE_HIDS_FAST_H__
+#define BLE_HIDS_FAST_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ble.h"
+#include "ble_srv_common.h"
+#include "ble_hids.h"
+#include "nrf_sdh_ble.h"
+#include "sdk_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Macro for defining a ble_hids_fast instance.
+ *
+ * @param   _name             Name of the instance.
+ * @param   _hids_max_clients Maximum number of HIDS clients connected at a time. Must match
+ *                            the value given to @ref BLE_HIDS_DEF.
+ * @hideinitializer
+ */
+#define BLE_HIDS_FAST_DEF(_name, _hids_max_clients)                      \
+    static ble_hids_fast_link_t CONCAT_2(_name, _links)[(_hids_max_clients)]; \
+    static ble_hids_fast_t _name =                                       \
+    {                                                                    \
+        .p_links    = CONCAT_2(_name, _links),                           \
+        .link_count = (_hids_max_clients)                                \
+    };                                                                   \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                                  \
+                         BLE_HIDS_BLE_OBSERVER_PRIO,                     \
+                         ble_hids_fast_on_ble_evt,                       \
+                         &_name)
+
+#define BLE_HIDS_FAST_REP_INDEX_INVALID 0xFF    /**< Marks a Report ID without Input Report in the Report ID table. */
+
+/**@brief Function for merging an Input Report into a report held while the notification queue is full.
+ *
+ * @param[in]     rep_index   Index of the Input Report.
+ * @param[in,out] p_held      Report held so far. Holds the merged report on return.
+ * @param[in]     held_len    Length of the held report.
+ * @param[in]     p_data      Report to merge into the held report.
+ * @param[in]     len         Length of the report to merge.
+ *
+ * @return Length of the merged report. Must not exceed @ref BLE_HIDS_FAST_REP_MAX_LEN.
+ */
+typedef uint16_t (*ble_hids_fast_merge_handler_t)(uint8_t         rep_index,
+                                                  uint8_t       * p_held,
+                                                  uint16_t        held_len,
+                                                  uint8_t const * p_data,
+                                                  uint16_t        len);
+
+/**@brief Input Report state of a link. */
+typedef struct
+{
+    uint16_t conn_handle;                                                   /**< Handle of the connection, or BLE_CONN_HANDLE_INVALID. */
+    bool     cccd_known;                                                    /**< True once the CCCDs have been read for this link. */
+    uint32_t notif_mask;                                                    /**< Bit n set if notification of Input Report n is enabled. */
+    uint32_t held_mask;                                                     /**< Bit n set if Input Report n is held until the notification queue has room. */
+    uint16_t held_len[BLE_HIDS_FAST_INP_REP_MAX];                           /**< Length of each held report. */
+    uint8_t  held[BLE_HIDS_FAST_INP_REP_MAX][BLE_HIDS_FAST_REP_MAX_LEN];    /**< Held reports. */
+} ble_hids_fast_link_t;
+
+/**@brief Precomputed information about an Input Report. */
+typedef struct
+{
+    uint16_t value_handle;  /**< Handle of the Report characteristic value. */
+    uint16_t cccd_handle;   /**< Handle of the Report characteristic CCCD. */
+    uint16_t max_len;       /**< Maximum length of the report. */
+    uint16_t ctx_offset;    /**< Offset of the report in the host context of @ref ble_hids. */
+} ble_hids_fast_rep_t;
+
+/**@brief HID Service fast path structure. */
+typedef struct
+{
+    ble_hids_t                    * p_hids;                                         /**< HID Service instance the reports belong to. */
+    ble_srv_error_handler_t         error_handler;                                  /**< Function to be called in case of an error. */
+    ble_hids_fast_merge_handler_t   merge_handler;                                  /**< Function merging held reports, or NULL to keep the latest report. */
+    uint8_t                         rep_count;                                      /**< Number of Input Reports. */
+    ble_hids_fast_rep_t             reps[BLE_HIDS_FAST_INP_REP_MAX];                /**< Information about each Input Report. */
+    uint8_t                         rep_index[BLE_HIDS_FAST_REPORT_ID_MAX + 1];     /**< Input Report index of each Report ID. */
+    ble_hids_fast_link_t    * const p_links;                                        /**< Input Report state of each link. */
+    uint8_t                   const link_count;                                     /**< Number of elements in @ref ble_hids_fast_t::p_links. */
+} ble_hids_fast_t;
+
+/**@brief HID Service fast path init structure. */
+typedef struct
+{
+    ble_hids_t                    * p_hids;         /**< Initialized HID Service instance. */
+    ble_srv_error_handler_t         error_handler;  /**< Function to be called in case of an error. */
+    ble_hids_fast_merge_handler_t   merge_handler;  /**< Function merging held reports, or NULL to keep the latest report. */
+} ble_hids_fast_init_t;
+
+
+/**@brief Function for initializing the fast path of a HID Service instance.
+ *
+ * @details Must be called after @ref ble_hids_init, and before any connection is established.
+ *
+ * @param[out]  p_fast      HID Service fast path structure.
+ * @param[in]   p_fast_init Information needed to initialize the fast path.
+ *
+ * @retval NRF_SUCCESS             If the fast path was initialized.
+ * @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+ * @retval NRF_ERROR_NO_MEM        If the HID Service has more than @ref BLE_HIDS_FAST_INP_REP_MAX
+ *                                 Input Reports.
+ * @retval NRF_ERROR_INVALID_PARAM If a Report ID is larger than @ref BLE_HIDS_FAST_REPORT_ID_MAX,
+ *                                 or is used by more than one Input Report.
+ */
+uint32_t ble_hids_fast_init(ble_hids_fast_t * p_fast, ble_hids_fast_init_t const * p_fast_init);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+ *
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ * @param[in]   p_context   HID Service fast path structure.
+ */
+void ble_hids_fast_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+/**@brief Function for sending an Input Report.
+ *
+ * @details The report is stored in the host context of @ref ble_hids, as done by
+ *          @ref ble_hids_inp_rep_send, and notified to the host. If the notification queue is
+ *          full, or an earlier report with the same Report ID is still held, the report is
+ *          merged into the held report, which is sent on the next
+ *          @ref BLE_GATTS_EVT_HVN_TX_COMPLETE event.
+ *
+ * @param[in]   p_fast      HID Service fast path structure.
+ * @param[in]   report_id   Report ID of the Input Report.
+ * @param[in]   len         Length of report.
+ * @param[in]   p_data      Report data.
+ * @param[in]   conn_handle Handle of the connection to the host.
+ *
+ * @retval NRF_SUCCESS             If the report was notified or held.
+ * @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If there is no Input Report with this Report ID.
+ * @retval NRF_ERROR_DATA_SIZE     If the report is longer than the maximum length of the Input Report.
+ * @retval NRF_ERROR_INVALID_STATE If the host has not enabled notification of the Input Report.
+ * @retval NRF_ERROR_NOT_FOUND     If there is no connection with this handle.
+ * @retval NRF_ERROR_RESOURCES     If the notification queue is full and the report is longer than
+ *                                 @ref BLE_HIDS_FAST_REP_MAX_LEN, so it cannot be held.
+ * @retval err_code                Otherwise, the error returned by sd_ble_gatts_hvx.
+ */
+uint32_t ble_hids_fast_inp_rep_send(ble_hids_fast_t * p_fast,
+                                    uint8_t           report_id,
+                                    uint16_t          len,
+                                    uint8_t const   * p_data,
+                                    uint16_t          conn_handle);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_HIDS_FAST_H__
+
+/** @} */
@@ -0,0 +1,543 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_HIDS_TX)
+#include "ble_hids_tx.h"
+#include <string.h>
+#include "ble_conn_state.h"
+
+
+static uint8_t const m_released[BLE_HIDS_TX_REP_MAX_LEN];   /**< Report with all keys released, the state before the first report of a link. */
+
+
+/**@brief Function for finding the transmit state of a link.
+ *
+ * @param[in]   p_tx        HID Service transmit scheduler structure.
+ * @param[in]   conn_handle Handle of the connection.
+ *
+ * @return      Transmit state of the link, or NULL if the link is not known.
+ */
+static ble_hids_tx_link_t * link_get(ble_hids_tx_t const * p_tx, uint16_t conn_handle)
+{
+    uint16_t conn_idx = ble_conn_state_conn_idx(conn_handle);
+
+    if ((conn_idx >= p_tx->link_count) || (p_tx->p_links[conn_idx].conn_handle != conn_handle))
+    {
+        return NULL;
+    }
+
+    return &p_tx->p_links[conn_idx];
+}
+
+
+/**@brief Function for getting a slot of a link, counted from the oldest one.
+ *
+ * @param[in]   p_link  Transmit state of the link.
+ * @param[in]   i       Position of the slot, 0 for the oldest one.
+ *
+ * @return      Slot.
+ */
+static ble_hids_tx_slot_t * slot_get(ble_hids_tx_link_t * p_link, uint8_t i)
+{
+    return &p_link->slots[(p_link->head + i) % BLE_HIDS_TX_QUEUE_SIZE];
+}
+
+
+/**@brief Function for checking if all keys pressed in a report are pressed in another report.
+ *
+ * @param[in]   format  Format of the reports.
+ * @param[in]   p_a     Report whose keys are looked for.
+ * @param[in]   p_b     Report the keys are looked for in.
+ * @param[in]   len     Length of both reports.
+ *
+ * @return      True if every key pressed in @p p_a is pressed in @p p_b.
+ */
+static bool keys_are_subset(ble_hids_tx_rep_format_t format,
+                            uint8_t const          * p_a,
+                            uint8_t const          * p_b,
+                            uint16_t                 len)
+{
+    if (format == BLE_HIDS_TX_FORMAT_BITMAP)
+    {
+        for (uint16_t i = 0; i < len; i++)
+        {
+            if ((p_a[i] & ~p_b[i]) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Keyboard: modifier bitmap, reserved byte, then key codes in any order.
+    if ((len > 0) && ((p_a[0] & ~p_b[0]) != 0))
+    {
+        return false;
+    }
+    for (uint16_t i = 2; i < len; i++)
+    {
+        bool found = (p_a[i] == 0);
+
+        for (uint16_t j = 2; (j < len) && !found; j++)
+        {
+            found = (p_b[j] == p_a[i]);
+        }
+        if (!found)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**@brief Function for checking if a report that is not sent yet can be replaced by a later report.
+ *
+ * @details The host only sees the key state of the later report. No key state is lost if the
+ *          report not sent yet and the later report both only press keys, or both only release
+ *          keys, as then no key changes twice.
+ *
+ * @param[in]   format      Format of the reports.
+ * @param[in]   p_prev      Report sent before the report not sent yet.
+ * @param[in]   p_pending   Report not sent yet.
+ * @param[in]   p_next      Later report.
+ * @param[in]   len         Length of the reports.
+ *
+ * @return      True if @p p_pending can be replaced by @p p_next.
+ */
+static bool rep_is_mergeable(ble_hids_tx_rep_format_t format,
+                             uint8_t const          * p_prev,
+                             uint8_t const          * p_pending,
+                             uint8_t const          * p_next,
+                             uint16_t                 len)
+{
+    if (format == BLE_HIDS_TX_FORMAT_OPAQUE)
+    {
+        return false;
+    }
+
+    return (   keys_are_subset(format, p_prev, p_pending, len)
+            && keys_are_subset(format, p_pending, p_next, len))
+        || (   keys_are_subset(format, p_pending, p_prev, len)
+            && keys_are_subset(format, p_next, p_pending, len));
+}
+
+
+/**@brief Function for merging a report into the latest report of the same source not sent yet.
+ *
+ * @param[in]   p_tx        HID Service transmit scheduler structure.
+ * @param[in]   p_link      Transmit state of the link.
+ * @param[in]   src         Source index of the report.
+ * @param[in]   len         Length of report.
+ * @param[in]   p_data      Report data.
+ *
+ * @return      True if the report was merged, false if it must get a slot of its own.
+ */
+static bool rep_merge(ble_hids_tx_t const * p_tx,
+                      ble_hids_tx_link_t  * p_link,
+                      uint8_t               src,
+                      uint16_t              len,
+                      uint8_t const       * p_data)
+{
+    ble_hids_tx_slot_t * p_pending = NULL;
+    uint8_t const      * p_prev    = NULL;
+    uint8_t              i         = p_link->count;
+
+    while ((i > 0) && (p_pending == NULL))
+    {
+        i--;
+        if (slot_get(p_link, i)->src == src)
+        {
+            p_pending = slot_get(p_link, i);
+        }
+    }
+
+    if ((p_pending == NULL) || (p_pending->len != len))
+    {
+        return false;
+    }
+    if (memcmp(p_pending->data, p_data, len) == 0)
+    {
+        return true;
+    }
+
+    while ((i > 0) && (p_prev == NULL))
+    {
+        i--;
+        if (slot_get(p_link, i)->src == src)
+        {
+            p_prev = slot_get(p_link, i)->data;
+        }
+    }
+
+    if (p_prev == NULL)
+    {
+        if (p_link->sent_len[src] == len)
+        {
+            p_prev = p_link->sent[src];
+        }
+        else if (p_link->sent_len[src] == 0)
+        {
+            p_prev = m_released;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    if (!rep_is_mergeable(p_tx->srcs[src].format, p_prev, p_pending->data, p_data, len))
+    {
+        return false;
+    }
+
+    memcpy(p_pending->data, p_data, len);
+    return true;
+}
+
+
+/**@brief Function for notifying a report.
+ *
+ * @param[in]   p_tx        HID Service transmit scheduler structure.
+ * @param[in]   p_link      Transmit state of the link.
+ * @param[in]   src         Source index of the report.
+ * @param[in]   len         Length of report.
+ * @param[in]   p_data      Report data.
+ *
+ * @return      Error code returned by sd_ble_gatts_hvx.
+ */
+static uint32_t rep_notify(ble_hids_tx_t const * p_tx,
+                           ble_hids_tx_link_t  * p_link,
+                           uint8_t               src,
+                           uint16_t              len,
+                           uint8_t const       * p_data)
+{
+    uint32_t               err_code;
+    ble_gatts_hvx_params_t hvx_params;
+    uint16_t               hvx_len = len;
+
+    memset(&hvx_params, 0, sizeof(hvx_params));
+
+    hvx_params.handle = p_tx->srcs[src].value_handle;
+    hvx_params.type   = BLE_GATT_HVX_NOTIFICATION;
+    hvx_params.offset = 0;
+    hvx_params.p_len  = &hvx_len;
+    hvx_params.p_data = p_data;
+
+    err_code = sd_ble_gatts_hvx(p_link->conn_handle, &hvx_params);
+    if (err_code == NRF_SUCCESS)
+    {
+        memcpy(p_link->sent[src], p_data, len);
+        p_link->sent_len[src] = (uint8_t)len;
+
+        if (hvx_len != len)
+        {
+            err_code = NRF_ERROR_DATA_SIZE;
+        }
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for sending the slots of a link, for as long as the notification queue has room.
+ *
+ * @details A report the host does not accept, for example because it has disabled notification,
+ *          is dropped without error.
+ *
+ * @param[in]   p_tx        HID Service transmit scheduler structure.
+ * @param[in]   p_link      Transmit state of the link.
+ *
+ * @retval NRF_SUCCESS If the slots were sent, or are kept because the queue is full.
+ * @return             Otherwise, the last error returned by sd_ble_gatts_hvx. The report is dropped.
+ */
+static uint32_t slots_send(ble_hids_tx_t const * p_tx, ble_hids_tx_link_t * p_link)
+{
+    uint32_t ret = NRF_SUCCESS;
+
+    while (p_link->count > 0)
+    {
+        ble_hids_tx_slot_t * p_slot   = slot_get(p_link, 0);
+        uint32_t             err_code = rep_notify(p_tx, p_link, p_slot->src, p_slot->len, p_slot->data);
+
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            break;
+        }
+
+        p_link->head = (p_link->head + 1) % BLE_HIDS_TX_QUEUE_SIZE;
+        p_link->count--;
+
+        if (   (err_code != NRF_SUCCESS)
+            && (err_code != NRF_ERROR_INVALID_STATE)
+            && (err_code != BLE_ERROR_GATTS_SYS_ATTR_MISSING))
+        {
+            ret = err_code;
+        }
+    }
+
+    return ret;
+}
+
+
+/**@brief Function for sending or scheduling a report.
+ *
+ * @param[in]   p_tx        HID Service transmit scheduler structure.
+ * @param[in]   src         Source index of the report.
+ * @param[in]   len         Length of report.
+ * @param[in]   p_data      Report data.
+ * @param[in]   conn_handle Handle of the connection to the host.
+ *
+ * @return      See @ref ble_hids_tx_inp_rep_send.
+ */
+static uint32_t rep_send(ble_hids_tx_t * p_tx,
+                         uint8_t         src,
+                         uint16_t        len,
+                         uint8_t const * p_data,
+                         uint16_t        conn_handle)
+{
+    uint32_t             err_code;
+    uint8_t            * p_host_rep_data;
+    ble_hids_tx_link_t * p_link;
+    ble_hids_tx_slot_t * p_slot;
+
+    if ((len > p_tx->srcs[src].max_len) || (len > BLE_HIDS_TX_REP_MAX_LEN))
+    {
+        return NRF_ERROR_DATA_SIZE;
+    }
+
+    p_link = link_get(p_tx, conn_handle);
+    if (p_link == NULL)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    err_code = blcm_link_ctx_get(p_tx->p_hids->p_link_ctx_storage,
+                                 conn_handle,
+                                 (void *) &p_host_rep_data);
+    VERIFY_SUCCESS(err_code);
+
+    if (p_link->count == 0)
+    {
+        err_code = rep_notify(p_tx, p_link, src, len, p_data);
+        if (err_code != NRF_ERROR_RESOURCES)
+        {
+            if (err_code == NRF_SUCCESS)
+            {
+                memcpy(p_host_rep_data + p_tx->srcs[src].ctx_offset, p_data, len);
+            }
+            return err_code;
+        }
+    }
+    else if (rep_merge(p_tx, p_link, src, len, p_data))
+    {
+        memcpy(p_host_rep_data + p_tx->srcs[src].ctx_offset, p_data, len);
+        return NRF_SUCCESS;
+    }
+    else if (p_link->count == BLE_HIDS_TX_QUEUE_SIZE)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    // The slots are sent in order on the next BLE_GATTS_EVT_HVN_TX_COMPLETE event.
+    p_slot      = slot_get(p_link, p_link->count);
+    p_slot->src = src;
+    p_slot->len = (uint8_t)len;
+    memcpy(p_slot->data, p_data, len);
+    p_link->count++;
+
+    memcpy(p_host_rep_data + p_tx->srcs[src].ctx_offset, p_data, len);
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t ble_hids_tx_init(ble_hids_tx_t * p_tx, ble_hids_tx_init_t const * p_tx_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_tx);
+    VERIFY_PARAM_NOT_NULL(p_tx_init);
+    VERIFY_PARAM_NOT_NULL(p_tx_init->p_hids);
+
+    ble_hids_t * p_hids = p_tx_init->p_hids;
+    uint16_t     ctx_offset;
+
+    if (p_hids->inp_rep_count > BLE_HIDS_TX_INP_REP_MAX)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    p_tx->p_hids        = p_hids;
+    p_tx->error_handler = p_tx_init->error_handler;
+
+    memset(p_tx->srcs, 0, sizeof(p_tx->srcs));
+
+    // The Boot Keyboard Input Report comes first in the host context.
+    p_tx->srcs[BLE_HIDS_TX_SRC_BOOT_KB].value_handle = p_hids->boot_kb_inp_rep_handles.value_handle;
+    p_tx->srcs[BLE_HIDS_TX_SRC_BOOT_KB].max_len      = BOOT_KB_INPUT_REPORT_MAX_SIZE;
+    p_tx->srcs[BLE_HIDS_TX_SRC_BOOT_KB].ctx_offset   = sizeof(ble_hids_client_context_t);
+    p_tx->srcs[BLE_HIDS_TX_SRC_BOOT_KB].format       = BLE_HIDS_TX_FORMAT_KEYBOARD;
+
+    // Input Reports come after the data of the boot reports.
+    ctx_offset = sizeof(ble_hids_client_context_t) + BOOT_KB_INPUT_REPORT_MAX_SIZE +
+                 BOOT_KB_OUTPUT_REPORT_MAX_SIZE + BOOT_MOUSE_INPUT_REPORT_MAX_SIZE;
+
+    for (uint8_t i = 0; i < p_hids->inp_rep_count; i++)
+    {
+        p_tx->srcs[i].value_handle = p_hids->inp_rep_array[i].char_handles.value_handle;
+        p_tx->srcs[i].max_len      = p_hids->p_inp_rep_init_array[i].max_len;
+        p_tx->srcs[i].ctx_offset   = ctx_offset;
+        p_tx->srcs[i].format       = (p_tx_init->p_inp_rep_format != NULL) ?
+                                     p_tx_init->p_inp_rep_format[i] : BLE_HIDS_TX_FORMAT_OPAQUE;
+
+        ctx_offset += p_tx->srcs[i].max_len;
+    }
+
+    for (uint8_t i = 0; i < p_tx->link_count; i++)
+    {
+        memset(&p_tx->p_links[i], 0, sizeof(ble_hids_tx_link_t));
+        p_tx->p_links[i].conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+void ble_hids_tx_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    ble_hids_tx_t      * p_tx = (ble_hids_tx_t *)p_context;
+    ble_hids_tx_link_t * p_link;
+    uint16_t             conn_idx;
+    uint32_t             err_code;
+
+    if ((p_tx == NULL) || (p_tx->p_hids == NULL) || (p_ble_evt == NULL))
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_CONNECTED:
+            conn_idx = ble_conn_state_conn_idx(p_ble_evt->evt.gap_evt.conn_handle);
+            if (conn_idx < p_tx->link_count)
+            {
+                p_link = &p_tx->p_links[conn_idx];
+                memset(p_link, 0, sizeof(ble_hids_tx_link_t));
+                p_link->conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+            }
+            break;
+
+        case BLE_GAP_EVT_DISCONNECTED:
+            p_link = link_get(p_tx, p_ble_evt->evt.gap_evt.conn_handle);
+            if (p_link != NULL)
+            {
+                p_link->conn_handle = BLE_CONN_HANDLE_INVALID;
+                p_link->count       = 0;
+            }
+            break;
+
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+            p_link = link_get(p_tx, p_ble_evt->evt.gatts_evt.conn_handle);
+            if (p_link != NULL)
+            {
+                err_code = slots_send(p_tx, p_link);
+                if ((err_code != NRF_SUCCESS) && (p_tx->error_handler != NULL))
+                {
+                    p_tx->error_handler(err_code);
+                }
+            }
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+
+uint32_t ble_hids_tx_inp_rep_send(ble_hids_tx_t * p_tx,
+                                  uint8_t         rep_index,
+                                  uint16_t        len,
+                                  uint8_t const * p_data,
+                                  uint16_t        conn_handle)
+{
+    VERIFY_PARAM_NOT_NULL(p_tx);
+    VERIFY_PARAM_NOT_NULL(p_data);
+
+    if ((p_tx->p_hids == NULL) || (rep_index >= p_tx->p_hids->inp_rep_count))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    return rep_send(p_tx, rep_index, len, p_data, conn_handle);
+}
+
+
+uint32_t ble_hids_tx_boot_kb_inp_rep_send(ble_hids_tx_t * p_tx,
+                                          uint16_t        len,
+                                          uint8_t const * p_data,
+                                          uint16_t        conn_handle)
+{
+    VERIFY_PARAM_NOT_NULL(p_tx);
+    VERIFY_PARAM_NOT_NULL(p_data);
+
+    if (p_tx->srcs[BLE_HIDS_TX_SRC_BOOT_KB].value_handle == BLE_GATT_HANDLE_INVALID)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    return rep_send(p_tx, BLE_HIDS_TX_SRC_BOOT_KB, len, p_data, conn_handle);
+}
+
+
+uint8_t ble_hids_tx_pending_count(ble_hids_tx_t const * p_tx, uint16_t conn_handle)
+{
+    ble_hids_tx_link_t * p_link;
+
+    if (p_tx == NULL)
+    {
+        return 0;
+    }
+
+    p_link = link_get(p_tx, conn_handle);
+
+    return (p_link != NULL) ? p_link->count : 0;
+}
+
+#endif // NRF_MODULE_ENABLED(BLE_HIDS_TX)
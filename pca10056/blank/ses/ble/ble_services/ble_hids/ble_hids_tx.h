@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup ble_hids_tx HID Service transmit scheduler
+ * @{
+ * @ingroup  ble_hids
+ * @brief    Module for sending bursts of HID Service reports without losing keystrokes.
+ *
+ * @details  @ref ble_hids_boot_kb_inp_rep_send and @ref ble_hids_inp_rep_send reject a report
+ *           that does not fit in the SoftDevice notification queue, so the application has to
+ *           retry it. @ref ble_hids_fast holds such a report, but replaces it by any later report
+ *           with the same Report ID, which loses a key pressed and released before the queue has
+ *           room. This module schedules the Boot Keyboard Input Report and the Input Reports of an
+ *           initialized @ref ble_hids instance per link:
+ *
+ *           - Each link has a ring of BLE_HIDS_TX_QUEUE_SIZE slots holding encoded reports in the
+ *             order they were given. The slots are sent as soon as the notification queue has
+ *             room, again on every @ref BLE_GATTS_EVT_HVN_TX_COMPLETE event.
+ *           - A report that is not sent yet is replaced by a later report of the same
+ *             characteristic only if no key state is lost: both reports must press keys, or both
+ *             must release keys (see @ref ble_hids_tx_rep_format_t). Identical reports are sent
+ *             once.
+ *           - When the ring of a link is full and the report cannot be merged, it is rejected, so
+ *             the memory used is bounded and the application knows to try again.
+ *
+ * @note     The application must register this module as BLE event observer, which is done by
+ *           @ref BLE_HIDS_TX_DEF. Do not send reports of the same link through @ref ble_hids or
+ *           @ref ble_hids_fast as well, as they would overtake the scheduled reports.
+ */
+
+#ifndef BLE_HIDS_TX_H__
+#define BLE_HIDS_TX_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ble.h"
+#include "ble_srv_common.h"
+#include "ble_hids.h"
+#include "nrf_sdh_ble.h"
+#include "sdk_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Macro for defining a ble_hids_tx instance.
+ *
+ * @param   _name             Name of the instance.
+ * @param   _hids_max_clients Maximum number of HIDS clients connected at a time. Must match
+ *                            the value given to @ref BLE_HIDS_DEF.
+ * @hideinitializer
+ */
+#define BLE_HIDS_TX_DEF(_name, _hids_max_clients)                            \
+    static ble_hids_tx_link_t CONCAT_2(_name, _links)[(_hids_max_clients)]; \
+    static ble_hids_tx_t _name =                                             \
+    {                                                                        \
+        .p_links    = CONCAT_2(_name, _links),                               \
+        .link_count = (_hids_max_clients)                                    \
+    };                                                                       \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                                      \
+                         BLE_HIDS_BLE_OBSERVER_PRIO,                         \
+                         ble_hids_tx_on_ble_evt,                             \
+                         &_name)
+
+#define BLE_HIDS_TX_SRC_BOOT_KB BLE_HIDS_TX_INP_REP_MAX         /**< Source index of the Boot Keyboard Input Report. Input Reports use their index in @ref ble_hids_t::inp_rep_array. */
+#define BLE_HIDS_TX_SRC_MAX     (BLE_HIDS_TX_INP_REP_MAX + 1)   /**< Number of report sources. */
+
+/**@brief Format of a report, which decides when a report that is not sent yet can be replaced. */
+typedef enum
+{
+    BLE_HIDS_TX_FORMAT_OPAQUE,      /**< Only an identical report is merged. */
+    BLE_HIDS_TX_FORMAT_BITMAP,      /**< Each bit is the state of a key, as in a consumer control bitmap. */
+    BLE_HIDS_TX_FORMAT_KEYBOARD,    /**< Modifier bitmap, reserved byte and array of pressed key codes, as in the Boot Keyboard Input Report. */
+} ble_hids_tx_rep_format_t;
+
+/**@brief Encoded report waiting for the notification queue. */
+typedef struct
+{
+    uint8_t src;                            /**< Source index of the report. */
+    uint8_t len;                            /**< Length of the report. */
+    uint8_t data[BLE_HIDS_TX_REP_MAX_LEN];  /**< Report data. */
+} ble_hids_tx_slot_t;
+
+/**@brief Transmit state of a link. */
+typedef struct
+{
+    uint16_t           conn_handle;                                         /**< Handle of the connection, or BLE_CONN_HANDLE_INVALID. */
+    uint8_t            head;                                                /**< Index of the oldest slot. */
+    uint8_t            count;                                               /**< Number of slots in use. */
+    ble_hids_tx_slot_t slots[BLE_HIDS_TX_QUEUE_SIZE];                       /**< Reports not sent yet, oldest first. */
+    uint8_t            sent_len[BLE_HIDS_TX_SRC_MAX];                       /**< Length of the last report given to the SoftDevice for each source, 0 if none. */
+    uint8_t            sent[BLE_HIDS_TX_SRC_MAX][BLE_HIDS_TX_REP_MAX_LEN];  /**< Last report given to the SoftDevice for each source. */
+} ble_hids_tx_link_t;
+
+/**@brief Precomputed information about a report source. */
+typedef struct
+{
+    uint16_t                 value_handle;  /**< Handle of the report characteristic value, or BLE_GATT_HANDLE_INVALID. */
+    uint16_t                 max_len;       /**< Maximum length of the report. */
+    uint16_t                 ctx_offset;    /**< Offset of the report in the host context of @ref ble_hids. */
+    ble_hids_tx_rep_format_t format;        /**< Format of the report. */
+} ble_hids_tx_src_t;
+
+/**@brief HID Service transmit scheduler structure. */
+typedef struct
+{
+    ble_hids_t                 * p_hids;                        /**< HID Service instance the reports belong to. */
+    ble_srv_error_handler_t      error_handler;                 /**< Function to be called in case of an error. */
+    ble_hids_tx_src_t            srcs[BLE_HIDS_TX_SRC_MAX];     /**< Information about each report source. */
+    ble_hids_tx_link_t   * const p_links;                       /**< Transmit state of each link. */
+    uint8_t                const link_count;                    /**< Number of elements in @ref ble_hids_tx_t::p_links. */
+} ble_hids_tx_t;
+
+/**@brief HID Service transmit scheduler init structure. */
+typedef struct
+{
+    ble_hids_t                     * p_hids;            /**< Initialized HID Service instance. */
+    ble_srv_error_handler_t          error_handler;     /**< Function to be called in case of an error. */
+    ble_hids_tx_rep_format_t const * p_inp_rep_format;  /**< Format of each Input Report, in the order of @ref ble_hids_t::inp_rep_array. NULL for @ref BLE_HIDS_TX_FORMAT_OPAQUE. */
+} ble_hids_tx_init_t;
+
+
+/**@brief Function for initializing the transmit scheduler of a HID Service instance.
+ *
+ * @details Must be called after @ref ble_hids_init, and before any connection is established.
+ *          The Boot Keyboard Input Report always has the @ref BLE_HIDS_TX_FORMAT_KEYBOARD format.
+ *
+ * @param[out]  p_tx        HID Service transmit scheduler structure.
+ * @param[in]   p_tx_init   Information needed to initialize the scheduler.
+ *
+ * @retval NRF_SUCCESS      If the scheduler was initialized.
+ * @retval NRF_ERROR_NULL   If any of the input parameters are NULL.
+ * @retval NRF_ERROR_NO_MEM If the HID Service has more than BLE_HIDS_TX_INP_REP_MAX Input Reports.
+ */
+uint32_t ble_hids_tx_init(ble_hids_tx_t * p_tx, ble_hids_tx_init_t const * p_tx_init);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+ *
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ * @param[in]   p_context   HID Service transmit scheduler structure.
+ */
+void ble_hids_tx_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+/**@brief Function for sending an Input Report.
+ *
+ * @details The report is stored in the host context of @ref ble_hids, as done by
+ *          @ref ble_hids_inp_rep_send, and sent after the reports of the link that are not sent
+ *          yet.
+ *
+ * @param[in]   p_tx        HID Service transmit scheduler structure.
+ * @param[in]   rep_index   Index of the characteristic in @ref ble_hids_t::inp_rep_array.
+ * @param[in]   len         Length of report.
+ * @param[in]   p_data      Report data.
+ * @param[in]   conn_handle Handle of the connection to the host.
+ *
+ * @retval NRF_SUCCESS             If the report was sent, scheduled or merged.
+ * @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If there is no Input Report with this index.
+ * @retval NRF_ERROR_DATA_SIZE     If the report is longer than the maximum length of the Input
+ *                                 Report, or than BLE_HIDS_TX_REP_MAX_LEN.
+ * @retval NRF_ERROR_NOT_FOUND     If there is no connection with this handle.
+ * @retval NRF_ERROR_NO_MEM        If the ring of the link is full. The report is not sent.
+ * @retval err_code                Otherwise, the error returned by sd_ble_gatts_hvx, for example
+ *                                 NRF_ERROR_INVALID_STATE if the host has not enabled
+ *                                 notification.
+ */
+uint32_t ble_hids_tx_inp_rep_send(ble_hids_tx_t * p_tx,
+                                  uint8_t         rep_index,
+                                  uint16_t        len,
+                                  uint8_t const * p_data,
+                                  uint16_t        conn_handle);
+
+
+/**@brief Function for sending a Boot Keyboard Input Report.
+ *
+ * @details As @ref ble_hids_tx_inp_rep_send, for the Boot Keyboard Input Report.
+ *
+ * @param[in]   p_tx        HID Service transmit scheduler structure.
+ * @param[in]   len         Length of report.
+ * @param[in]   p_data      Report data.
+ * @param[in]   conn_handle Handle of the connection to the host.
+ *
+ * @retval NRF_ERROR_NOT_SUPPORTED If the HID Service has no Boot Keyboard Input Report.
+ * @return Otherwise, as @ref ble_hids_tx_inp_rep_send.
+ */
+uint32_t ble_hids_tx_boot_kb_inp_rep_send(ble_hids_tx_t * p_tx,
+                                          uint16_t        len,
+                                          uint8_t const * p_data,
+                                          uint16_t        conn_handle);
+
+
+/**@brief Function for getting the number of reports of a link that are not sent yet.
+ *
+ * @param[in]   p_tx        HID Service transmit scheduler structure.
+ * @param[in]   conn_handle Handle of the connection to the host.
+ *
+ * @return Number of reports waiting for the notification queue, 0 if the link is not known.
+ */
+uint8_t ble_hids_tx_pending_count(ble_hids_tx_t const * p_tx, uint16_t conn_handle);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_HIDS_TX_H__
+
+/** @} */
@@ -0,0 +1,401 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_HRS_MULTI)
+#include "ble_hrs_multi.h"
+#include <string.h>
+#include "ble_conn_state.h"
+
+
+#define OPCODE_LENGTH 1                                                                 /**< Length of opcode inside Heart Rate Measurement packet. */
+#define HANDLE_LENGTH 2                                                                 /**< Length of handle inside Heart Rate Measurement packet. */
+#define MAX_HRM_LEN   MIN(NRF_SDH_BLE_GATT_MAX_MTU_SIZE - OPCODE_LENGTH - HANDLE_LENGTH, \
+                          NRF_BLE_GQ_GATTS_HVX_MAX_DATA_LEN)                            /**< Maximum size of a Heart Rate Measurement that can be queued. */
+
+// Heart Rate Measurement flag bits
+#define HRM_FLAG_MASK_HR_VALUE_16BIT            (0x01 << 0)                             /**< Heart Rate Value Format bit. */
+#define HRM_FLAG_MASK_SENSOR_CONTACT_DETECTED   (0x01 << 1)                             /**< Sensor Contact Detected bit. */
+#define HRM_FLAG_MASK_SENSOR_CONTACT_SUPPORTED  (0x01 << 2)                             /**< Sensor Contact Supported bit. */
+#define HRM_FLAG_MASK_RR_INTERVAL_INCLUDED      (0x01 << 4)                             /**< RR-Interval bit. */
+
+
+/**@brief Function for finding the Heart Rate Measurement state of a link.
+ *
+ * @param[in]   p_multi     Heart Rate Measurement fan-out structure.
+ * @param[in]   conn_handle Handle of the connection.
+ *
+ * @return      Heart Rate Measurement state of the link, or NULL if the link is not known.
+ */
+static ble_hrs_multi_link_t * link_get(ble_hrs_multi_t * p_multi, uint16_t conn_handle)
+{
+    uint16_t conn_idx = ble_conn_state_conn_idx(conn_handle);
+
+    if ((conn_idx >= p_multi->link_count) || (p_multi->p_links[conn_idx].conn_handle != conn_handle))
+    {
+        return NULL;
+    }
+
+    return &p_multi->p_links[conn_idx];
+}
+
+
+/**@brief Function for reading the notification state of a link.
+ *
+ * @details The CCCD value is only valid once the system attributes of the peer have been set,
+ *          which may happen after the Connect event. The read is tried again on the next
+ *          measurement until it succeeds.
+ *
+ * @param[in]   p_multi     Heart Rate Measurement fan-out structure.
+ * @param[in]   p_link      Heart Rate Measurement state of the link.
+ */
+static void cccd_read(ble_hrs_multi_t * p_multi, ble_hrs_multi_link_t * p_link)
+{
+    uint8_t           cccd[BLE_CCCD_VALUE_LEN];
+    ble_gatts_value_t gatts_value;
+
+    memset(&gatts_value, 0, sizeof(gatts_value));
+
+    gatts_value.len     = sizeof(cccd);
+    gatts_value.offset  = 0;
+    gatts_value.p_value = cccd;
+
+    if (sd_ble_gatts_value_get(p_link->conn_handle,
+                               p_multi->p_hrs->hrm_handles.cccd_handle,
+                               &gatts_value) != NRF_SUCCESS)
+    {
+        return;
+    }
+
+    p_link->is_notif_enabled = ble_srv_is_notification_enabled(cccd);
+    p_link->cccd_known       = true;
+}
+
+
+/**@brief Function for encoding a Heart Rate Measurement.
+ *
+ * @param[in]   p_multi            Heart Rate Measurement fan-out structure.
+ * @param[in]   heart_rate         Measurement to be encoded.
+ * @param[in]   rr_start           Sequence number of the first RR-Interval to be encoded.
+ * @param[in]   rr_count           Number of RR-Intervals to be encoded.
+ * @param[out]  p_encoded_buffer   Buffer where the encoded data will be written.
+ *
+ * @return      Size of encoded data.
+ */
+static uint16_t hrm_encode(ble_hrs_multi_t * p_multi,
+                           uint16_t          heart_rate,
+                           uint32_t          rr_start,
+                           uint16_t          rr_count,
+                           uint8_t         * p_encoded_buffer)
+{
+    uint8_t  flags = 0;
+    uint16_t len   = 1;
+
+    // Set sensor contact related flags
+    if (p_multi->p_hrs->is_sensor_contact_supported)
+    {
+        flags |= HRM_FLAG_MASK_SENSOR_CONTACT_SUPPORTED;
+    }
+    if (p_multi->p_hrs->is_sensor_contact_detected)
+    {
+        flags |= HRM_FLAG_MASK_SENSOR_CONTACT_DETECTED;
+    }
+
+    // Encode heart rate measurement
+    if (heart_rate > 0xff)
+    {
+        flags |= HRM_FLAG_MASK_HR_VALUE_16BIT;
+        len   += uint16_encode(heart_rate, &p_encoded_buffer[len]);
+    }
+    else
+    {
+        p_encoded_buffer[len++] = (uint8_t)heart_rate;
+    }
+
+    // Encode rr_interval values
+    if (rr_count > 0)
+    {
+        flags |= HRM_FLAG_MASK_RR_INTERVAL_INCLUDED;
+    }
+    for (uint16_t i = 0; i < rr_count; i++)
+    {
+        uint16_t rr_interval = p_multi->rr_interval[(rr_start + i) % BLE_HRS_MULTI_RR_INTERVALS_MAX];
+
+        len += uint16_encode(rr_interval, &p_encoded_buffer[len]);
+    }
+
+    // Add flags
+    p_encoded_buffer[0] = flags;
+
+    return len;
+}
+
+
+/**@brief Function for handling errors of queued notifications.
+ *
+ * @param[in]   nrf_error   Error code returned by the SoftDevice.
+ * @param[in]   p_ctx       Heart Rate Measurement fan-out structure.
+ * @param[in]   conn_handle Handle of the connection.
+ */
+static void gatt_error_handler(uint32_t nrf_error, void * p_ctx, uint16_t conn_handle)
+{
+    ble_hrs_multi_t * p_multi = (ble_hrs_multi_t *)p_ctx;
+
+    UNUSED_PARAMETER(conn_handle);
+
+    // The link may have disabled notification or disconnected while the notification was queued.
+    if (   (p_multi->error_handler != NULL)
+        && (nrf_error != NRF_ERROR_INVALID_STATE)
+        && (nrf_error != BLE_ERROR_INVALID_CONN_HANDLE))
+    {
+        p_multi->error_handler(nrf_error);
+    }
+}
+
+
+/**@brief Function for handling write events to the Heart Rate Measurement CCCD.
+ *
+ * @param[in]   p_multi     Heart Rate Measurement fan-out structure.
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ */
+static void on_write(ble_hrs_multi_t * p_multi, ble_evt_t const * p_ble_evt)
+{
+    ble_gatts_evt_write_t const * p_evt_write = &p_ble_evt->evt.gatts_evt.params.write;
+    ble_hrs_multi_link_t        * p_link      = link_get(p_multi, p_ble_evt->evt.gatts_evt.conn_handle);
+
+    if (   (p_link == NULL)
+        || (p_evt_write->handle != p_multi->p_hrs->hrm_handles.cccd_handle)
+        || (p_evt_write->len != BLE_CCCD_VALUE_LEN))
+    {
+        return;
+    }
+
+    p_link->is_notif_enabled = ble_srv_is_notification_enabled(p_evt_write->data);
+    p_link->cccd_known       = true;
+
+    if (p_link->is_notif_enabled)
+    {
+        // Start with the RR-Intervals measured from now on.
+        p_link->rr_cursor = p_multi->rr_head;
+    }
+}
+
+
+uint32_t ble_hrs_multi_init(ble_hrs_multi_t * p_multi, ble_hrs_multi_init_t const * p_multi_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_multi);
+    VERIFY_PARAM_NOT_NULL(p_multi_init);
+    VERIFY_PARAM_NOT_NULL(p_multi_init->p_hrs);
+    VERIFY_PARAM_NOT_NULL(p_multi_init->p_gatt_queue);
+
+    p_multi->p_hrs         = p_multi_init->p_hrs;
+    p_multi->p_gatt_queue  = p_multi_init->p_gatt_queue;
+    p_multi->error_handler = p_multi_init->error_handler;
+    p_multi->rr_head       = 0;
+
+    for (uint8_t i = 0; i < p_multi->link_count; i++)
+    {
+        memset(&p_multi->p_links[i], 0, sizeof(ble_hrs_multi_link_t));
+        p_multi->p_links[i].conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+void ble_hrs_multi_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    ble_hrs_multi_t      * p_multi = (ble_hrs_multi_t *)p_context;
+    ble_hrs_multi_link_t * p_link;
+    uint16_t               conn_idx;
+    uint32_t               err_code;
+
+    if ((p_multi == NULL) || (p_multi->p_hrs == NULL) || (p_ble_evt == NULL))
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_CONNECTED:
+            conn_idx = ble_conn_state_conn_idx(p_ble_evt->evt.gap_evt.conn_handle);
+            if (conn_idx < p_multi->link_count)
+            {
+                p_link = &p_multi->p_links[conn_idx];
+                memset(p_link, 0, sizeof(ble_hrs_multi_link_t));
+                p_link->conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+                p_link->max_hrm_len = MIN(BLE_GATT_ATT_MTU_DEFAULT - OPCODE_LENGTH - HANDLE_LENGTH,
+                                          MAX_HRM_LEN);
+                p_link->rr_cursor   = p_multi->rr_head;
+
+                err_code = nrf_ble_gq_conn_handle_register(p_multi->p_gatt_queue, p_link->conn_handle);
+                if ((err_code != NRF_SUCCESS) && (p_multi->error_handler != NULL))
+                {
+                    p_multi->error_handler(err_code);
+                }
+            }
+            break;
+
+        case BLE_GAP_EVT_DISCONNECTED:
+            p_link = link_get(p_multi, p_ble_evt->evt.gap_evt.conn_handle);
+            if (p_link != NULL)
+            {
+                p_link->conn_handle = BLE_CONN_HANDLE_INVALID;
+            }
+            break;
+
+        case BLE_GATTS_EVT_WRITE:
+            on_write(p_multi, p_ble_evt);
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+
+void ble_hrs_multi_on_gatt_evt(ble_hrs_multi_t * p_multi, nrf_ble_gatt_evt_t const * p_gatt_evt)
+{
+    ble_hrs_multi_link_t * p_link;
+
+    if ((p_multi == NULL) || (p_gatt_evt == NULL) || (p_gatt_evt->evt_id != NRF_BLE_GATT_EVT_ATT_MTU_UPDATED))
+    {
+        return;
+    }
+
+    p_link = link_get(p_multi, p_gatt_evt->conn_handle);
+    if (p_link != NULL)
+    {
+        p_link->max_hrm_len = MIN(p_gatt_evt->params.att_mtu_effective - OPCODE_LENGTH - HANDLE_LENGTH,
+                                  MAX_HRM_LEN);
+    }
+}
+
+
+uint32_t ble_hrs_multi_heart_rate_measurement_send(ble_hrs_multi_t * p_multi, uint16_t heart_rate)
+{
+    VERIFY_PARAM_NOT_NULL(p_multi);
+
+    uint32_t         err_code  = NRF_SUCCESS;
+    bool             is_sent   = false;
+    bool             encoded   = false;
+    uint32_t         enc_start = 0;
+    uint16_t         enc_count = 0;
+    uint16_t         len       = 0;
+    uint16_t         hr_len    = (heart_rate > 0xff) ? 3 : 2;  // Flags and heart rate value.
+    uint32_t         rr_oldest = (p_multi->rr_head > BLE_HRS_MULTI_RR_INTERVALS_MAX)
+                               ? (p_multi->rr_head - BLE_HRS_MULTI_RR_INTERVALS_MAX)
+                               : 0;
+    uint8_t          encoded_hrm[MAX_HRM_LEN];
+    nrf_ble_gq_req_t hvx_req;
+
+    for (uint8_t i = 0; i < p_multi->link_count; i++)
+    {
+        ble_hrs_multi_link_t * p_link = &p_multi->p_links[i];
+        uint16_t               hvx_len;
+        uint16_t               rr_count;
+        uint32_t               link_err_code;
+
+        if (p_link->conn_handle == BLE_CONN_HANDLE_INVALID)
+        {
+            continue;
+        }
+        if (!p_link->cccd_known)
+        {
+            cccd_read(p_multi, p_link);
+        }
+        if (!p_link->is_notif_enabled)
+        {
+            continue;
+        }
+
+        // RR-Intervals overwritten in the shared buffer are lost for this link.
+        if (p_link->rr_cursor < rr_oldest)
+        {
+            p_link->rr_cursor = rr_oldest;
+        }
+
+        rr_count = (uint16_t)MIN(p_multi->rr_head - p_link->rr_cursor,
+                                 (p_link->max_hrm_len - hr_len) / sizeof(uint16_t));
+
+        // Links that are up to date with each other share the encoded measurement.
+        if (!encoded || (enc_start != p_link->rr_cursor) || (enc_count != rr_count))
+        {
+            len       = hrm_encode(p_multi, heart_rate, p_link->rr_cursor, rr_count, encoded_hrm);
+            enc_start = p_link->rr_cursor;
+            enc_count = rr_count;
+            encoded   = true;
+        }
+
+        hvx_len = len;
+
+        memset(&hvx_req, 0, sizeof(hvx_req));
+
+        hvx_req.type                     = NRF_BLE_GQ_REQ_GATTS_HVX;
+        hvx_req.error_handler.cb         = gatt_error_handler;
+        hvx_req.error_handler.p_ctx      = p_multi;
+        hvx_req.params.gatts_hvx.type    = BLE_GATT_HVX_NOTIFICATION;
+        hvx_req.params.gatts_hvx.handle  = p_multi->p_hrs->hrm_handles.value_handle;
+        hvx_req.params.gatts_hvx.offset  = 0;
+        hvx_req.params.gatts_hvx.p_len   = &hvx_len;
+        hvx_req.params.gatts_hvx.p_data  = encoded_hrm;
+
+        is_sent       = true;
+        link_err_code = nrf_ble_gq_item_add(p_multi->p_gatt_queue, &hvx_req, p_link->conn_handle);
+        if (link_err_code == NRF_SUCCESS)
+        {
+            p_link->rr_cursor += rr_count;
+        }
+        else
+        {
+            err_code = link_err_code;
+        }
+    }
+
+    return is_sent ? err_code : NRF_ERROR_INVALID_STATE;
+}
+
+
+void ble_hrs_multi_rr_interval_add(ble_hrs_multi_t * p_multi, uint16_t rr_interval)
+{
+    p_multi->rr_interval[p_multi->rr_head % BLE_HRS_MULTI_RR_INTERVALS_MAX] = rr_interval;
+    p_multi->rr_head++;
+}
+#endif // NRF_MODULE_ENABLED(BLE_HRS_MULTI)
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup ble_hrs_multi Heart Rate Measurement fan-out
+ * @{
+ * @ingroup  ble_hrs
+ * @brief    Module for notifying a Heart Rate Measurement to all connected collectors.
+ *
+ * @details  @ref ble_hrs_heart_rate_measurement_send notifies the single link stored in
+ *           @ref ble_hrs_t, and drains the RR-Interval buffer of the service into that one
+ *           notification. This module sends the measurements of an initialized @ref ble_hrs
+ *           instance to every link that has enabled notification of the Heart Rate Measurement
+ *           characteristic:
+ *
+ *           - RR-Intervals are stored once, in a buffer shared by all links. Each link has a
+ *             cursor to the oldest RR-Interval it has not received yet, so a link only moves
+ *             past the RR-Intervals that were queued for it.
+ *           - A measurement is encoded once for all links with the same cursor and maximum
+ *             notification length, which in the usual case is every link. The notification
+ *             length is limited by @ref NRF_BLE_GQ_GATTS_HVX_MAX_DATA_LEN, as the notification
+ *             may have to be buffered by the GATT queue.
+ *           - Notifications are queued through @ref nrf_ble_gq, so a full SoftDevice queue on one
+ *             link does not hold back the others.
+ *
+ *           RR-Intervals must be added with @ref ble_hrs_multi_rr_interval_add instead of
+ *           @ref ble_hrs_rr_interval_add. Do not enable coalescing of @ref NRF_BLE_GQ_REQ_GATTS_HVX
+ *           requests in the GATT queue, as a replaced notification would lose its RR-Intervals.
+ *
+ * @note     The application must register this module as BLE event observer, which is done by
+ *           @ref BLE_HRS_MULTI_DEF, and forward GATT events with @ref ble_hrs_multi_on_gatt_evt.
+ */
+
+#ifndef BLE_HRS_MULTI_H__
+#define BLE_HRS_MULTI_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ble.h"
+#include "ble_srv_common.h"
+#include "ble_hrs.h"
+#include "nrf_ble_gatt.h"
+#include "nrf_ble_gq.h"
+#include "nrf_sdh_ble.h"
+#include "sdk_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Macro for defining a ble_hrs_multi instance.
+ *
+ * @param   _name           Name of the instance.
+ * @param   _max_clients    Maximum number of collectors connected at a time.
+ * @hideinitializer
+ */
+#define BLE_HRS_MULTI_DEF(_name, _max_clients)                           \
+    static ble_hrs_multi_link_t CONCAT_2(_name, _links)[(_max_clients)]; \
+    static ble_hrs_multi_t _name =                                       \
+    {                                                                    \
+        .p_links    = CONCAT_2(_name, _links),                           \
+        .link_count = (_max_clients)                                     \
+    };                                                                   \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                                  \
+                         BLE_HRS_BLE_OBSERVER_PRIO,                      \
+                         ble_hrs_multi_on_ble_evt,                       \
+                         &_name)
+
+/**@brief Heart Rate Measurement state of a link. */
+typedef struct
+{
+    uint16_t conn_handle;       /**< Handle of the connection, or BLE_CONN_HANDLE_INVALID. */
+    bool     cccd_known;        /**< True once the CCCD has been read for this link. */
+    bool     is_notif_enabled;  /**< True if notification of the Heart Rate Measurement is enabled. */
+    uint16_t max_hrm_len;       /**< Maximum length of a Heart Rate Measurement notified on this link. */
+    uint32_t rr_cursor;         /**< Sequence number of the oldest RR-Interval not yet queued for this link. */
+} ble_hrs_multi_link_t;
+
+/**@brief Heart Rate Measurement fan-out structure. */
+typedef struct
+{
+    ble_hrs_t                    * p_hrs;                                       /**< Heart Rate Service instance the measurements belong to. */
+    nrf_ble_gq_t                 * p_gatt_queue;                                /**< GATT queue used to send the notifications. */
+    ble_srv_error_handler_t        error_handler;                               /**< Function to be called in case of an error. */
+    uint16_t                       rr_interval[BLE_HRS_MULTI_RR_INTERVALS_MAX]; /**< RR-Intervals shared by all links, indexed by sequence number. */
+    uint32_t                       rr_head;                                     /**< Sequence number of the next RR-Interval to be added. */
+    ble_hrs_multi_link_t   * const p_links;                                     /**< Heart Rate Measurement state of each link. */
+    uint8_t                  const link_count;                                  /**< Number of elements in @ref ble_hrs_multi_t::p_links. */
+} ble_hrs_multi_t;
+
+/**@brief Heart Rate Measurement fan-out init structure. */
+typedef struct
+{
+    ble_hrs_t               * p_hrs;            /**< Initialized Heart Rate Service instance. */
+    nrf_ble_gq_t            * p_gatt_queue;     /**< GATT queue used to send the notifications. */
+    ble_srv_error_handler_t   error_handler;    /**< Function to be called in case of an error. */
+} ble_hrs_multi_init_t;
+
+
+/**@brief Function for initializing the fan-out of a Heart Rate Service instance.
+ *
+ * @details Must be called after @ref ble_hrs_init, and before any connection is established.
+ *
+ * @param[out]  p_multi      Heart Rate Measurement fan-out structure.
+ * @param[in]   p_multi_init Information needed to initialize the fan-out.
+ *
+ * @retval NRF_SUCCESS    If the fan-out was initialized.
+ * @retval NRF_ERROR_NULL If any of the input parameters are NULL.
+ */
+uint32_t ble_hrs_multi_init(ble_hrs_multi_t * p_multi, ble_hrs_multi_init_t const * p_multi_init);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+ *
+ * @details Registers each new link with the GATT queue.
+ *
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ * @param[in]   p_context   Heart Rate Measurement fan-out structure.
+ */
+void ble_hrs_multi_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+/**@brief Function for handling events from the GATT library.
+ *
+ * @param[in]   p_multi     Heart Rate Measurement fan-out structure.
+ * @param[in]   p_gatt_evt  Event received from the GATT library.
+ */
+void ble_hrs_multi_on_gatt_evt(ble_hrs_multi_t * p_multi, nrf_ble_gatt_evt_t const * p_gatt_evt);
+
+
+/**@brief Function for sending a Heart Rate Measurement to all links.
+ *
+ * @details The measurement is notified on every link that has enabled notification of the
+ *          Heart Rate Measurement characteristic, with as many of the RR-Intervals not yet
+ *          received by that link as fit in one notification. The remaining RR-Intervals are sent
+ *          with the next measurement. If a link fails to queue the notification, its
+ *          RR-Intervals are kept and the other links are still served.
+ *
+ * @param[in]   p_multi     Heart Rate Measurement fan-out structure.
+ * @param[in]   heart_rate  New heart rate measurement.
+ *
+ * @retval NRF_SUCCESS             If the measurement was queued on every link with notification
+ *                                 enabled.
+ * @retval NRF_ERROR_NULL          If @p p_multi is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If no link has enabled notification.
+ * @retval err_code                Otherwise, the last error returned by @ref nrf_ble_gq_item_add.
+ */
+uint32_t ble_hrs_multi_heart_rate_measurement_send(ble_hrs_multi_t * p_multi, uint16_t heart_rate);
+
+
+/**@brief Function for adding a RR-Interval measurement to the buffer shared by all links.
+ *
+ * @details If a link has not received the oldest RR-Interval when the buffer is full, that
+ *          RR-Interval is lost for the link, as done by @ref ble_hrs_rr_interval_add.
+ *
+ * @param[in]   p_multi     Heart Rate Measurement fan-out structure.
+ * @param[in]   rr_interval New RR-Interval measurement (will be buffered until the next
+ *                          transmission of Heart Rate Measurement).
+ */
+void ble_hrs_multi_rr_interval_add(ble_hrs_multi_t * p_multi, uint16_t rr_interval);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_HRS_MULTI_H__
+
+/** @} */
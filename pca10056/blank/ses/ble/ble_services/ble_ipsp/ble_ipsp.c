@@ -159,6 +159,7 @@ NRF_LOG_MODULE_REGISTER();
 #define RX_BUFFER_TOTAL_SIZE          (BLE_IPSP_RX_BUFFER_SIZE * BLE_IPSP_RX_BUFFER_COUNT)          /**< Total receive buffer size reserved for each IPSP channel. */
 #define MAX_L2CAP_RX_BUFFER           (RX_BUFFER_TOTAL_SIZE * BLE_IPSP_MAX_CHANNELS)                /**< Total receive buffer received for all channels. */
 #define INVALID_CHANNEL_INSTANCE      0xFF                                                          /**< Indicates channel instance is invalid. */
+#define INVALID_TX_BUFFER             0xFF                                                          /**< Indicates a pending frame does not use a gather buffer. */
 
 
 /**@brief IPSP Channel States. */
@@ -190,6 +191,15 @@ typedef struct
 } peer_connection_t;
 
 
+/**@brief Frame pending transmission on a channel. */
+typedef struct
+{
+    uint8_t         const * p_sdu;                                                                  /**< SDU handed to the SoftDevice. NULL if the entry is free. */
+    ble_ipsp_frag_t const * p_chain;                                                                /**< Fragment chain sent zero-copy, NULL if the SDU was gathered or sent with @ref ble_ipsp_send. */
+    uint8_t                 tx_buffer;                                                              /**< Gather buffer used by the SDU, INVALID_TX_BUFFER if none. */
+} tx_frame_t;
+
+
 /**@brief IPSP Channel Information. */
 typedef struct
 {
@@ -198,12 +208,15 @@ typedef struct
     uint16_t     rx_buffer_status;                                                                  /**< Usage status of RX buffers. */
     uint8_t      state;                                                                             /**< State information for the channel. See @ref channel_state_t for details. */
     uint8_t    * p_rx_buffer;                                                                       /**< Receive buffer for the channel. */
+    tx_frame_t   tx_frame[BLE_IPSP_TX_QUEUE_SIZE];                                                  /**< Frames pending transmission on the channel. */
 } channel_t;
 
 
 static ble_ipsp_evt_handler_t m_evt_handler = NULL;                                                 /**< Asynchronous event notification callback registered with the module. */
 static channel_t              m_channel[BLE_IPSP_MAX_CHANNELS];                                     /**< Table of channels managed by the module. */
 static uint8_t                m_rx_buffer[MAX_L2CAP_RX_BUFFER];                                     /**< Receive buffer reserved for all channels to receive data on the L2CAP IPSP channel. */
+static uint8_t                m_tx_buffer[BLE_IPSP_TX_BUFFER_COUNT][BLE_IPSP_MTU];                  /**< Transmit gather buffers shared by all channels, used for fragment chains that are not contiguous. */
+static bool                   m_tx_buffer_in_use[BLE_IPSP_TX_BUFFER_COUNT];                         /**< Usage status of the transmit gather buffers. */
 static peer_connection_t      m_connected_device[IPSP_MAX_CONNECTED_DEVICES];                       /**< Table maintaining list of peer devices and the connection handle.
                                                                                                       \n This information is needed for the 6lowpan compression and decompression.
                                                                                                       \n And no interface exists to query the softdevice. */
@@ -273,6 +286,33 @@ static __INLINE void channel_init(uint8_t ch_id)
     m_channel[ch_id].rx_buffer_status = 0;
     m_channel[ch_id].state            = CHANNEL_IDLE;
     m_channel[ch_id].p_rx_buffer      = &m_rx_buffer[ch_id*RX_BUFFER_TOTAL_SIZE];
+
+    for (uint32_t index = 0; index < BLE_IPSP_TX_QUEUE_SIZE; index++)
+    {
+        m_channel[ch_id].tx_frame[index].p_sdu     = NULL;
+        m_channel[ch_id].tx_frame[index].p_chain   = NULL;
+        m_channel[ch_id].tx_frame[index].tx_buffer = INVALID_TX_BUFFER;
+    }
+}
+
+
+/**@brief Release a frame pending transmission on a channel, and its gather buffer if any.
+ *
+ * @param[in] ch_id Identifies the IPSP channel on which the procedure is requested.
+ * @param[in] index Index of the frame in the channel's transmit queue.
+ */
+static __INLINE void tx_frame_free(uint8_t ch_id, uint32_t index)
+{
+    tx_frame_t * p_frame = &m_channel[ch_id].tx_frame[index];
+
+    if (p_frame->tx_buffer != INVALID_TX_BUFFER)
+    {
+        m_tx_buffer_in_use[p_frame->tx_buffer] = false;
+    }
+
+    p_frame->p_sdu     = NULL;
+    p_frame->p_chain   = NULL;
+    p_frame->tx_buffer = INVALID_TX_BUFFER;
 }
 
 
@@ -285,6 +325,12 @@ static __INLINE void channel_free(uint8_t ch_id)
     BLE_IPSP_TRC("[Index 0x%02X]:[Conn Handle 0x%04X]:[CID 0x%04X]: Freeing channel",
              ch_id, m_channel[ch_id].conn_handle, m_channel[ch_id].cid);
 
+    // Return gather buffers of frames the SoftDevice did not report back.
+    for (uint32_t index = 0; index < BLE_IPSP_TX_QUEUE_SIZE; index++)
+    {
+        tx_frame_free(ch_id, index);
+    }
+
     channel_init(ch_id);
 }
 
@@ -342,21 +388,84 @@ static __INLINE void app_notify(ble_ipsp_handle_t * p_handle, ble_ipsp_evt_t * p
 }
 
 
-/**@brief Verifies if the buffer is TX buffer on the channel or not.
+/**@brief Searches a frame pending transmission on the channel by its SDU buffer.
  *
  * @param[in] ch_id    Identifies the IPSP channel for which the procedure is requested.
- * @param[in] p_buffer Address of the buffer being verified to be TX or not.
+ * @param[in] p_buffer Address of the SDU buffer reported by the SoftDevice.
+ *
+ * @retval Index of the frame in the channel's transmit queue if found, else,
+ *         BLE_IPSP_TX_QUEUE_SIZE indicating the buffer is not a TX buffer of the channel.
  */
-static __INLINE bool is_tx_buffer(uint32_t ch_id, const uint8_t * p_buffer)
+static __INLINE uint32_t tx_frame_search(uint8_t ch_id, uint8_t const * p_buffer)
 {
-    // If the buffer is in the RX buffer list, then it is not TX!
-    if ((p_buffer >= (uint8_t *)&m_channel[ch_id].p_rx_buffer) &&
-        (p_buffer <  (uint8_t *)&m_channel[ch_id].p_rx_buffer[RX_BUFFER_TOTAL_SIZE]))
+    for (uint32_t index = 0; index < BLE_IPSP_TX_QUEUE_SIZE; index++)
     {
-        return false;
+        if ((m_channel[ch_id].tx_frame[index].p_sdu != NULL) &&
+            (m_channel[ch_id].tx_frame[index].p_sdu == p_buffer))
+        {
+            return index;
+        }
     }
 
-    return true;
+    return BLE_IPSP_TX_QUEUE_SIZE;
+}
+
+
+/**@brief Hand an SDU to the SoftDevice and track it in the channel's transmit queue.
+ *
+ * @param[in] ch_id     Identifies the IPSP channel for which the procedure is requested.
+ * @param[in] p_data    SDU to be transmitted.
+ * @param[in] data_len  Length of the SDU.
+ * @param[in] p_chain   Fragment chain sent zero-copy, or NULL.
+ * @param[in] tx_buffer Gather buffer holding the SDU, or INVALID_TX_BUFFER.
+ *
+ * @retval NRF_SUCCESS If the SDU was queued, else, an error code indicating reason for failure.
+ *                     On failure, the gather buffer is released.
+ */
+static uint32_t tx_frame_submit(uint8_t                 ch_id,
+                                uint8_t         const * p_data,
+                                uint16_t                data_len,
+                                ble_ipsp_frag_t const * p_chain,
+                                uint8_t                 tx_buffer)
+{
+    uint32_t err_code = (NRF_ERROR_BLE_IPSP_ERR_BASE + NRF_ERROR_NO_MEM);
+
+    for (uint32_t index = 0; index < BLE_IPSP_TX_QUEUE_SIZE; index++)
+    {
+        tx_frame_t * p_frame = &m_channel[ch_id].tx_frame[index];
+
+        if (p_frame->p_sdu == NULL)
+        {
+            const ble_data_t sdu_buf =
+            {
+                .p_data = (uint8_t *)p_data,
+                .len    = data_len
+            };
+
+            BLE_IPSP_TRC("p_sdu_buf = %p, p_sdu_buf.p_data = %p", &sdu_buf, p_data);
+
+            // Record the frame before handing it over, so that the TX event can find it.
+            p_frame->p_sdu     = p_data;
+            p_frame->p_chain   = p_chain;
+            p_frame->tx_buffer = tx_buffer;
+
+            err_code = sd_ble_l2cap_ch_tx(m_channel[ch_id].conn_handle,
+                                          m_channel[ch_id].cid,
+                                          &sdu_buf);
+            if (err_code != NRF_SUCCESS)
+            {
+                tx_frame_free(ch_id, index);
+            }
+            return err_code;
+        }
+    }
+
+    if (tx_buffer != INVALID_TX_BUFFER)
+    {
+        m_tx_buffer_in_use[tx_buffer] = false;
+    }
+
+    return err_code;
 }
 
 
@@ -413,14 +522,17 @@ void ble_ipsp_evt_handler(ble_evt_t const * p_evt)
 {
     VERIFY_MODULE_IS_INITIALIZED_VOID();
 
-    ble_ipsp_handle_t    handle;
-    ble_ipsp_evt_t       ipsp_event;
-    uint32_t             retval;
-    uint8_t              ch_id;
-    bool                 notify_event;
-    bool                 submit_rx_buffer;
+    ble_ipsp_handle_t       handle;
+    ble_ipsp_evt_t          ipsp_event;
+    ble_ipsp_frag_t const * p_frag;
+    uint32_t                retval;
+    uint32_t                tx_index;
+    uint8_t                 ch_id;
+    bool                    notify_event;
+    bool                    submit_rx_buffer;
 
     ch_id                 = INVALID_CHANNEL_INSTANCE;
+    p_frag                = NULL;
     notify_event          = false;
     submit_rx_buffer      = false;
     retval                = NRF_SUCCESS;
@@ -677,6 +789,14 @@ void ble_ipsp_evt_handler(ble_evt_t const * p_evt)
             if ((ch_id != INVALID_CHANNEL_INSTANCE) &&
                 p_evt->evt.l2cap_evt.local_cid == m_channel[ch_id].cid)
             {
+                tx_index = tx_frame_search(ch_id, p_evt->evt.l2cap_evt.params.tx.sdu_buf.p_data);
+
+                if (tx_index < BLE_IPSP_TX_QUEUE_SIZE)
+                {
+                    p_frag = m_channel[ch_id].tx_frame[tx_index].p_chain;
+                    tx_frame_free(ch_id, tx_index);
+                }
+
                 // Initialize the event.
                 ipsp_event.evt_id = BLE_IPSP_EVT_CHANNEL_DATA_TX_COMPLETE;
 
@@ -699,10 +819,21 @@ void ble_ipsp_evt_handler(ble_evt_t const * p_evt)
                                     p_evt->evt.l2cap_evt.local_cid,
                                     &ch_id);
 
+            tx_index = BLE_IPSP_TX_QUEUE_SIZE;
+
             if ((ch_id != INVALID_CHANNEL_INSTANCE) &&
-                (p_evt->evt.l2cap_evt.local_cid == m_channel[ch_id].cid) &&
-                (is_tx_buffer(ch_id, p_evt->evt.l2cap_evt.params.ch_sdu_buf_released.sdu_buf.p_data)))
+                (p_evt->evt.l2cap_evt.local_cid == m_channel[ch_id].cid))
             {
+                tx_index = tx_frame_search(ch_id,
+                                           p_evt->evt.l2cap_evt.params.ch_sdu_buf_released.sdu_buf.p_data);
+            }
+
+            // Receive buffers released by the SoftDevice are not reported to the application.
+            if (tx_index < BLE_IPSP_TX_QUEUE_SIZE)
+            {
+                p_frag = m_channel[ch_id].tx_frame[tx_index].p_chain;
+                tx_frame_free(ch_id, tx_index);
+
                 // Initialize the event.
                 ipsp_event.evt_id     = BLE_IPSP_EVT_CHANNEL_DATA_TX_COMPLETE;
                 ipsp_event.evt_result = NRF_ERROR_BLE_IPSP_LINK_DISCONNECTED;
@@ -749,6 +880,7 @@ void ble_ipsp_evt_handler(ble_evt_t const * p_evt)
         }
 
         event_param.p_l2cap_evt = &p_evt->evt.l2cap_evt;
+        event_param.p_frag      = p_frag;
         ipsp_event.p_evt_param  = &event_param;
 
         app_notify(&handle, &ipsp_event);
@@ -802,6 +934,8 @@ uint32_t ble_ipsp_init(const ble_ipsp_init_t * p_init)
     {
         connected_device_init(i);
     }
+
+    memset(m_tx_buffer_in_use, 0, sizeof(m_tx_buffer_in_use));
     BLE_IPSP_MUTEX_UNLOCK();
 
     BLE_IPSP_EXIT();
@@ -906,18 +1040,91 @@ uint32_t ble_ipsp_send(ble_ipsp_handle_t const * p_handle,
 
     if (err_code == NRF_SUCCESS)
     {
-        const ble_data_t p_sdu_buf =
+        err_code = tx_frame_submit(ch_id, p_data, data_len, NULL, INVALID_TX_BUFFER);
+    }
+
+    BLE_IPSP_MUTEX_UNLOCK();
+
+    BLE_IPSP_EXIT_WITH_RESULT(err_code);
+
+    return err_code;
+}
+
+
+uint32_t ble_ipsp_send_chain(ble_ipsp_handle_t const * p_handle,
+                             ble_ipsp_frag_t   const * p_chain)
+{
+    BLE_IPSP_ENTRY();
+
+    VERIFY_MODULE_IS_INITIALIZED();
+    NULL_PARAM_CHECK(p_handle);
+    NULL_PARAM_CHECK(p_chain);
+    VERIFY_CON_HANDLE(p_handle->conn_handle);
+
+    ble_ipsp_frag_t const * p_frag;
+    uint32_t                err_code;
+    uint32_t                total_len  = 0;
+    bool                    contiguous = true;
+    uint8_t                 tx_buffer  = INVALID_TX_BUFFER;
+    uint8_t                 ch_id;
+
+    for (p_frag = p_chain; p_frag != NULL; p_frag = p_frag->p_next)
+    {
+        NULL_PARAM_CHECK(p_frag->p_data);
+
+        if ((p_frag->p_next != NULL) &&
+            (p_frag->p_next->p_data != &p_frag->p_data[p_frag->len]))
         {
-            .p_data = (uint8_t *)p_data,
-            .len    = data_len
-        };
+            contiguous = false;
+        }
+
+        total_len += p_frag->len;
+    }
+
+    if (total_len > BLE_IPSP_MTU)
+    {
+        return (NRF_ERROR_BLE_IPSP_ERR_BASE + NRF_ERROR_DATA_SIZE);
+    }
+
+    BLE_IPSP_MUTEX_LOCK();
 
-        BLE_IPSP_TRC("p_sdu_buf = %p, p_sdu_buf.p_data = %p",
-                 &p_sdu_buf, p_data);
+    err_code = channel_search(p_handle->conn_handle, p_handle->cid, &ch_id);
 
-        err_code = sd_ble_l2cap_ch_tx(p_handle->conn_handle,
-                                      p_handle->cid,
-                                      &p_sdu_buf);
+    if ((err_code == NRF_SUCCESS) && contiguous)
+    {
+        // The chain already is one SDU in memory, hand it over as is.
+        err_code = tx_frame_submit(ch_id, p_chain->p_data, (uint16_t)total_len,
+                                   p_chain, INVALID_TX_BUFFER);
+    }
+    else if (err_code == NRF_SUCCESS)
+    {
+        for (uint32_t index = 0; index < BLE_IPSP_TX_BUFFER_COUNT; index++)
+        {
+            if (!m_tx_buffer_in_use[index])
+            {
+                m_tx_buffer_in_use[index] = true;
+                tx_buffer                 = (uint8_t)index;
+                break;
+            }
+        }
+
+        if (tx_buffer == INVALID_TX_BUFFER)
+        {
+            err_code = (NRF_ERROR_BLE_IPSP_ERR_BASE + NRF_ERROR_NO_MEM);
+        }
+        else
+        {
+            uint32_t offset = 0;
+
+            for (p_frag = p_chain; p_frag != NULL; p_frag = p_frag->p_next)
+            {
+                memcpy(&m_tx_buffer[tx_buffer][offset], p_frag->p_data, p_frag->len);
+                offset += p_frag->len;
+            }
+
+            err_code = tx_frame_submit(ch_id, m_tx_buffer[tx_buffer], (uint16_t)total_len,
+                                       NULL, tx_buffer);
+        }
     }
 
     BLE_IPSP_MUTEX_UNLOCK();
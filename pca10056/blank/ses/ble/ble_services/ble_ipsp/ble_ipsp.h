@@ -61,13 +61,16 @@
 
 #include <stdint.h>
 #include "ble.h"
+#include "sdk_config.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /**@brief Maximum IPSP channels required to be supported. */
+#ifndef BLE_IPSP_MAX_CHANNELS
 #define BLE_IPSP_MAX_CHANNELS                              1
+#endif
 
 /**@brief Maximum Transmit Unit on IPSP channel. */
 #define BLE_IPSP_MTU                                       1280
@@ -99,7 +102,36 @@ extern "C" {
  *          be received while an SDU is being consumed by the application
  *          (6LoWPAN/IP Stack).
  */
+#ifndef BLE_IPSP_RX_BUFFER_COUNT
 #define BLE_IPSP_RX_BUFFER_COUNT                           4
+#endif
+
+#if (BLE_IPSP_RX_BUFFER_COUNT < 1) || (BLE_IPSP_RX_BUFFER_COUNT > 16)
+#error "BLE_IPSP_RX_BUFFER_COUNT must be between 1 and 16, the usage of the buffers is kept in a 16-bit mask."
+#endif
+
+/**@brief Maximum number of SDUs pending transmission per IPSP channel.
+ *
+ * @details Number of frames that can be queued with the SoftDevice on one channel before
+ *          the first one completes. The SoftDevice L2CAP TX queue size configured for the
+ *          link should be at least this value for the frames to be pipelined.
+ */
+#ifndef BLE_IPSP_TX_QUEUE_SIZE
+#define BLE_IPSP_TX_QUEUE_SIZE                             2
+#endif
+
+/**@brief Number of transmit gather buffers shared by all IPSP channels.
+ *
+ * @details Each gather buffer is of size @ref BLE_IPSP_MTU and is used only when a fragment
+ *          chain passed to @ref ble_ipsp_send_chain is not contiguous in memory.
+ */
+#ifndef BLE_IPSP_TX_BUFFER_COUNT
+#define BLE_IPSP_TX_BUFFER_COUNT                           1
+#endif
+
+#if (BLE_IPSP_TX_QUEUE_SIZE < 1) || (BLE_IPSP_TX_BUFFER_COUNT < 1)
+#error "BLE_IPSP_TX_QUEUE_SIZE and BLE_IPSP_TX_BUFFER_COUNT must be at least 1."
+#endif
 
 /**@brief L2CAP Protocol Service Multiplexers number. */
 #define BLE_IPSP_PSM                                       0x0023
@@ -115,11 +147,27 @@ typedef enum
 } ble_ipsp_evt_type_t;
 
 
+/**@brief Transmit buffer fragment.
+ *
+ * @details Fragments are linked through p_next to describe one frame, for example a 6LoWPAN
+ *          header fragment followed by one or more payload fragments.
+ */
+typedef struct ble_ipsp_frag_s
+{
+    struct ble_ipsp_frag_s const * p_next;                                                          /**< Next fragment of the frame, NULL for the last fragment. */
+    uint8_t                const * p_data;                                                          /**< Fragment data. */
+    uint16_t                       len;                                                             /**< Length of the fragment data. */
+    void                         * p_context;                                                       /**< Application context of the fragment, not used by the module. */
+} ble_ipsp_frag_t;
+
+
 /**@brief IPSP event parameter. */
 typedef struct
 {
     ble_l2cap_evt_t const   * p_l2cap_evt;                                                          /**< L2CAP event parameters. */
     ble_gap_addr_t  const   * p_peer;                                                               /**< Peer device address. */
+    ble_ipsp_frag_t const   * p_frag;                                                               /**< Head of the fragment chain released with @ref BLE_IPSP_EVT_CHANNEL_DATA_TX_COMPLETE.
+                                                                                                      \n NULL if the frame was not sent zero-copy by @ref ble_ipsp_send_chain. */
 } ble_ipsp_event_param_t;
 
 
@@ -203,6 +251,9 @@ uint32_t ble_ipsp_connect(ble_ipsp_handle_t const * p_handle);
  *                     @ref BLE_IPSP_EVT_CHANNEL_DATA_TX_COMPLETE event is notified.
  * @param[in] data_len Length/size of data to be transferred.
  *
+ * @note At most @ref BLE_IPSP_TX_QUEUE_SIZE frames can be pending on a channel. To send a
+ *       frame whose header and payload are in separate buffers, use @ref ble_ipsp_send_chain.
+ *
  * @retval NRF_SUCCESS If initialization of the service was successful, else,
  *                     an error code indicating reason for failure.
  */
@@ -211,6 +262,29 @@ uint32_t ble_ipsp_send(ble_ipsp_handle_t const * p_handle,
                        uint16_t                  data_len);
 
 
+/**@brief Function for sending an IP frame described by a chain of fragments to peer.
+ *
+ * @details The frame is transmitted as one SDU. Several frames may be pending on a channel,
+ *          up to @ref BLE_IPSP_TX_QUEUE_SIZE.
+ *          If the chain has a single fragment, or all fragments are adjacent in memory, the
+ *          fragments are handed to the SoftDevice without copying. They must stay resident
+ *          until @ref BLE_IPSP_EVT_CHANNEL_DATA_TX_COMPLETE is notified with p_frag set to
+ *          p_chain.
+ *          Otherwise, the fragments are gathered into one of the
+ *          @ref BLE_IPSP_TX_BUFFER_COUNT shared transmit buffers and are released to the
+ *          application as soon as this function returns.
+ *
+ * @param[in] p_handle Instance of the logical channel and peer for which the data is intended.
+ * @param[in] p_chain  Head of the fragment chain. The total length must not exceed
+ *                     @ref BLE_IPSP_MTU.
+ *
+ * @retval NRF_SUCCESS If the frame was queued for transmission, else,
+ *                     an error code indicating reason for failure.
+ */
+uint32_t ble_ipsp_send_chain(ble_ipsp_handle_t const * p_handle,
+                             ble_ipsp_frag_t   const * p_chain);
+
+
 /**@brief Function for disconnecting IP transport.
  *
  * @param[in] p_handle Identifies IPSP transport.
@@ -41,6 +41,18 @@
 #if NRF_MODULE_ENABLED(BLE_LBS)
 #include "ble_lbs.h"
 #include "ble_srv_common.h"
+#include "ble_srv_gatt_table.h"
+
+
+/**@brief LED Button Service definition: the Button and LED characteristics. */
+BLE_SRV_GATT_SERVICE_DEF(m_lbs_service, ble_lbs_t, LBS_UUID_SERVICE,
+                         BLE_SRV_GATT_UUID_TYPE_FIELD(ble_lbs_t, uuid_type), service_handle,
+    BLE_SRV_GATT_CHAR_CCCD(ble_lbs_t, button_char_handles, LBS_UUID_BUTTON_CHAR,
+                           SEC_OPEN, SEC_NO_ACCESS, SEC_OPEN, sizeof(uint8_t), false,
+                           .read = 1, .notify = 1),
+    BLE_SRV_GATT_CHAR(ble_lbs_t, led_char_handles, LBS_UUID_LED_CHAR,
+                      SEC_OPEN, SEC_OPEN, sizeof(uint8_t), false,
+                      .read = 1, .write = 1));
 
 
 /**@brief Function for handling the Write event.
@@ -80,9 +92,7 @@ void ble_lbs_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
 
 uint32_t ble_lbs_init(ble_lbs_t * p_lbs, const ble_lbs_init_t * p_lbs_init)
 {
-    uint32_t              err_code;
-    ble_uuid_t            ble_uuid;
-    ble_add_char_params_t add_char_params;
+    uint32_t err_code;
 
     // Initialize service structure.
     p_lbs->led_write_handler = p_lbs_init->led_write_handler;
@@ -92,45 +102,7 @@ uint32_t ble_lbs_init(ble_lbs_t * p_lbs, const ble_lbs_init_t * p_lbs_init)
     err_code = sd_ble_uuid_vs_add(&base_uuid, &p_lbs->uuid_type);
     VERIFY_SUCCESS(err_code);
 
-    ble_uuid.type = p_lbs->uuid_type;
-    ble_uuid.uuid = LBS_UUID_SERVICE;
-
-    err_code = sd_ble_gatts_service_add(BLE_GATTS_SRVC_TYPE_PRIMARY, &ble_uuid, &p_lbs->service_handle);
-    VERIFY_SUCCESS(err_code);
-
-    // Add Button characteristic.
-    memset(&add_char_params, 0, sizeof(add_char_params));
-    add_char_params.uuid              = LBS_UUID_BUTTON_CHAR;
-    add_char_params.uuid_type         = p_lbs->uuid_type;
-    add_char_params.init_len          = sizeof(uint8_t);
-    add_char_params.max_len           = sizeof(uint8_t);
-    add_char_params.char_props.read   = 1;
-    add_char_params.char_props.notify = 1;
-
-    add_char_params.read_access       = SEC_OPEN;
-    add_char_params.cccd_write_access = SEC_OPEN;
-
-    err_code = characteristic_add(p_lbs->service_handle,
-                                  &add_char_params,
-                                  &p_lbs->button_char_handles);
-    if (err_code != NRF_SUCCESS)
-    {
-        return err_code;
-    }
-
-    // Add LED characteristic.
-    memset(&add_char_params, 0, sizeof(add_char_params));
-    add_char_params.uuid             = LBS_UUID_LED_CHAR;
-    add_char_params.uuid_type        = p_lbs->uuid_type;
-    add_char_params.init_len         = sizeof(uint8_t);
-    add_char_params.max_len          = sizeof(uint8_t);
-    add_char_params.char_props.read  = 1;
-    add_char_params.char_props.write = 1;
-
-    add_char_params.read_access  = SEC_OPEN;
-    add_char_params.write_access = SEC_OPEN;
-
-    return characteristic_add(p_lbs->service_handle, &add_char_params, &p_lbs->led_char_handles);
+    return ble_srv_gatt_service_add(&m_lbs_service, p_lbs);
 }
 
 
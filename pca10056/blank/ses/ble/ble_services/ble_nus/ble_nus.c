@@ -61,9 +61,938 @@ NRF_LOG_MODULE_REGISTER();
 #define BLE_NUS_MAX_RX_CHAR_LEN        BLE_NUS_MAX_DATA_LEN /**< Maximum length of the RX Characteristic (in bytes). */
 #define BLE_NUS_MAX_TX_CHAR_LEN        BLE_NUS_MAX_DATA_LEN /**< Maximum length of the TX Characteristic (in bytes). */
 
+#if BLE_NUS_L2CAP_ENABLED
+#define L2CAP_SDU_LEN_SIZE             2                    /**< Size of the SDU length field carried in the first PDU of an SDU. */
+#endif
+
 #define NUS_BASE_UUID                  {{0x9E, 0xCA, 0xDC, 0x24, 0x0E, 0xE5, 0xA9, 0xE0, 0x93, 0xF3, 0xA3, 0xB5, 0x00, 0x00, 0x40, 0x6E}} /**< Used vendor specific UUID. */
 
 
+#if BLE_NUS_STREAM_ENABLED
+/**@brief Function for sending an event of the streaming TX mode.
+ *
+ * @param[in] p_nus Nordic UART Service structure.
+ * @param[in] type  Event type.
+ */
+static void stream_evt_send(ble_nus_t * p_nus, ble_nus_evt_type_t type)
+{
+    ble_nus_evt_t evt;
+
+    if (p_nus->data_handler == NULL)
+    {
+        return;
+    }
+
+    memset(&evt, 0, sizeof(ble_nus_evt_t));
+    evt.type        = type;
+    evt.p_nus       = p_nus;
+    evt.conn_handle = p_nus->stream_conn_handle;
+
+    UNUSED_RETURN_VALUE(blcm_link_ctx_get(p_nus->p_link_ctx_storage,
+                                          evt.conn_handle,
+                                          (void *) &evt.p_link_ctx));
+
+    p_nus->data_handler(&evt);
+}
+
+
+/**@brief Function for handing the stream buffer to the SoftDevice.
+ *
+ * @details Notifications are sent until the buffer is empty or the SoftDevice queue is full.
+ *          If the stream was stopped, the data is dropped instead. Nothing is done while the
+ *          stream is paused.
+ *
+ * @param[in]  p_nus   Nordic UART Service structure.
+ * @param[out] p_freed Set to true if space was freed in the buffer.
+ *
+ * @retval NRF_SUCCESS        If the buffer is empty.
+ * @retval NRF_ERROR_BUSY     If the buffer is being sent from another context.
+ * @retval NRF_ERROR_RESOURCES If the SoftDevice queue is full. Otherwise, the error returned by
+ *                            @ref sd_ble_gatts_hvx.
+ */
+static ret_code_t stream_drain(ble_nus_t * p_nus, bool * p_freed)
+{
+    ret_code_t             err_code;
+    ble_gatts_hvx_params_t hvx_params;
+    uint8_t              * p_data;
+    uint8_t              * p_hvx_data;
+    size_t                 length;
+    uint16_t               hvx_len;
+    uint16_t               conn_handle;
+    bool                   flush;
+#if BLE_NUS_LZ_ENABLED
+    uint8_t                packet[BLE_NUS_MAX_DATA_LEN];
+    size_t                 taken = 0;
+    bool                   compress;
+#endif
+
+    for (;;)
+    {
+        flush       = p_nus->stream_flush;
+        conn_handle = p_nus->stream_conn_handle;
+
+        if (!flush && ((conn_handle == BLE_CONN_HANDLE_INVALID) || p_nus->stream_paused))
+        {
+            return NRF_SUCCESS;
+        }
+
+        if (flush)
+        {
+            p_nus->stream_flush = false;
+        }
+        length              = flush ? SIZE_MAX : p_nus->stream_max_len;
+#if BLE_NUS_LZ_ENABLED
+        compress = !flush && (conn_handle == p_nus->lz_conn_handle);
+        if (compress)
+        {
+            // Take all contiguous data, the encoder stops when the packet is full.
+            length = SIZE_MAX;
+        }
+#endif
+
+        err_code = nrf_ringbuf_mirrored_get(p_nus->p_stream_buf,
+                                            BLE_NUS_MAX_DATA_LEN,
+                                            &p_data,
+                                            &length,
+                                            true);
+        VERIFY_SUCCESS(err_code);
+
+        if (length == 0)
+        {
+            // The buffer is released by the ring buffer when it is empty.
+            return NRF_SUCCESS;
+        }
+
+        if (flush)
+        {
+            UNUSED_RETURN_VALUE(nrf_ringbuf_free(&p_nus->p_stream_buf->ringbuf, length));
+            *p_freed = true;
+            continue;
+        }
+
+        p_hvx_data = p_data;
+#if BLE_NUS_LZ_ENABLED
+        if (compress)
+        {
+            p_hvx_data = packet;
+            length     = nrf_lz_encode(&p_nus->lz_enc,
+                                       p_data,
+                                       length,
+                                       packet,
+                                       MAX(p_nus->stream_max_len, NRF_LZ_PACKET_LEN_MIN),
+                                       &taken);
+        }
+#endif
+        hvx_len = (uint16_t)length;
+
+        memset(&hvx_params, 0, sizeof(hvx_params));
+        hvx_params.handle = p_nus->tx_handles.value_handle;
+        hvx_params.p_data = p_hvx_data;
+        hvx_params.p_len  = &hvx_len;
+        hvx_params.type   = BLE_GATT_HVX_NOTIFICATION;
+
+        err_code = sd_ble_gatts_hvx(conn_handle, &hvx_params);
+        if (err_code != NRF_SUCCESS)
+        {
+            UNUSED_RETURN_VALUE(nrf_ringbuf_free(&p_nus->p_stream_buf->ringbuf, 0));
+            return err_code;
+        }
+
+#if BLE_NUS_LZ_ENABLED
+        if (compress)
+        {
+            nrf_lz_enc_commit(&p_nus->lz_enc, p_data, taken);
+            UNUSED_RETURN_VALUE(nrf_ringbuf_free(&p_nus->p_stream_buf->ringbuf, taken));
+            *p_freed = true;
+            continue;
+        }
+#endif
+        UNUSED_RETURN_VALUE(nrf_ringbuf_free(&p_nus->p_stream_buf->ringbuf, hvx_len));
+        *p_freed = true;
+    }
+}
+
+
+/**@brief Function for sending the stream buffer.
+ *
+ * @details Only one context sends the buffer at a time. A context finding the buffer taken
+ *          marks it as pending and the context sending it looks at the buffer again before
+ *          returning, so data written meanwhile is not left behind.
+ *
+ * @param[in] p_nus Nordic UART Service structure.
+ */
+static void stream_process(ble_nus_t * p_nus)
+{
+    ret_code_t err_code;
+    bool       freed = false;
+
+    p_nus->stream_pending = true;
+
+    do
+    {
+        p_nus->stream_pending = false;
+
+        err_code = stream_drain(p_nus, &freed);
+        if (err_code == NRF_ERROR_BUSY)
+        {
+            // Leave the data to the context sending the buffer.
+            p_nus->stream_pending = true;
+            return;
+        }
+    } while (p_nus->stream_pending);
+
+    if ((err_code != NRF_SUCCESS) && (err_code != NRF_ERROR_RESOURCES))
+    {
+        NRF_LOG_WARNING("Stream paused on 0x%02X connection handle, error 0x%x.",
+                        p_nus->stream_conn_handle, err_code);
+        p_nus->stream_paused = true;
+    }
+
+    if (!freed)
+    {
+        return;
+    }
+
+    if (p_nus->stream_blocked)
+    {
+        p_nus->stream_blocked = false;
+        stream_evt_send(p_nus, BLE_NUS_EVT_STREAM_WRITABLE);
+    }
+
+    if ((err_code == NRF_SUCCESS)                              &&
+        (p_nus->stream_conn_handle != BLE_CONN_HANDLE_INVALID) &&
+        !p_nus->stream_paused)
+    {
+        stream_evt_send(p_nus, BLE_NUS_EVT_STREAM_EMPTY);
+    }
+}
+#endif // BLE_NUS_STREAM_ENABLED
+
+
+#if BLE_NUS_RX_CREDITS_ENABLED || (BLE_NUS_L2CAP_ENABLED && BLE_NUS_RX_BUF_ENABLED)
+/**@brief Function for getting the free space in the RX buffer.
+ *
+ * @param[in] p_rx_buf RX buffer.
+ *
+ * @return Number of bytes that can be stored.
+ */
+static uint32_t rx_buf_free_space_get(nrf_ringbuf_t const * p_rx_buf)
+{
+    return p_rx_buf->bufsize_mask + 1 - (p_rx_buf->p_cb->wr_idx - p_rx_buf->p_cb->rd_idx);
+}
+#endif
+
+
+#if BLE_NUS_RX_CREDITS_ENABLED
+/**@brief Function for notifying the peer of the RX credits.
+ *
+ * @details If the SoftDevice queue is full, the notification is sent again on the next
+ *          @ref BLE_GATTS_EVT_HVN_TX_COMPLETE event.
+ *
+ * @param[in] p_nus Nordic UART Service structure.
+ */
+static void credits_send(ble_nus_t * p_nus)
+{
+    ret_code_t             err_code;
+    ble_gatts_hvx_params_t hvx_params;
+    uint8_t                encoded_limit[sizeof(uint32_t)];
+    uint16_t               length;
+    uint16_t               conn_handle = p_nus->credits_conn_handle;
+
+    if (conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return;
+    }
+
+    length = uint32_encode(p_nus->credits_limit, encoded_limit);
+
+    memset(&hvx_params, 0, sizeof(hvx_params));
+    hvx_params.handle = p_nus->credits_handles.value_handle;
+    hvx_params.p_data = encoded_limit;
+    hvx_params.p_len  = &length;
+    hvx_params.type   = BLE_GATT_HVX_NOTIFICATION;
+
+    err_code = sd_ble_gatts_hvx(conn_handle, &hvx_params);
+
+    p_nus->credits_pending = (err_code == NRF_ERROR_RESOURCES);
+    if ((err_code != NRF_SUCCESS) && (err_code != NRF_ERROR_RESOURCES))
+    {
+        NRF_LOG_WARNING("RX credits could not be sent to 0x%02X connection handle, error 0x%x.",
+                        conn_handle, err_code);
+    }
+}
+
+
+/**@brief Function for handling a write to the CCCD of the RX Credits characteristic.
+ *
+ * @param[in] p_nus       Nordic UART Service structure.
+ * @param[in] conn_handle Connection handle of the peer.
+ * @param[in] p_evt_write Write event parameters.
+ */
+static void on_credits_cccd_write(ble_nus_t                   * p_nus,
+                                  uint16_t                      conn_handle,
+                                  ble_gatts_evt_write_t const * p_evt_write)
+{
+    if (ble_srv_is_notification_enabled(p_evt_write->data))
+    {
+        p_nus->credits_conn_handle = conn_handle;
+        p_nus->credits_limit       = rx_buf_free_space_get(p_nus->p_rx_buf);
+        credits_send(p_nus);
+    }
+    else if (conn_handle == p_nus->credits_conn_handle)
+    {
+        p_nus->credits_conn_handle = BLE_CONN_HANDLE_INVALID;
+        p_nus->credits_pending     = false;
+    }
+}
+#endif // BLE_NUS_RX_CREDITS_ENABLED
+
+
+#if BLE_NUS_RX_BUF_ENABLED
+/**@brief Function for storing data written by the peer in the RX buffer.
+ *
+ * @param[in] p_nus    Nordic UART Service structure.
+ * @param[in] p_evt    Event with the connection fields filled in.
+ * @param[in] p_data   Received data.
+ * @param[in] data_len Length of the data.
+ */
+static void on_rx_buf_write(ble_nus_t     * p_nus,
+                            ble_nus_evt_t * p_evt,
+                            uint8_t const * p_data,
+                            size_t          data_len)
+{
+    size_t length = data_len;
+
+    if (nrf_ringbuf_cpy_put(p_nus->p_rx_buf, p_data, &length) != NRF_SUCCESS)
+    {
+        length = 0;
+    }
+
+    if (p_nus->data_handler == NULL)
+    {
+        return;
+    }
+
+    if (length != 0)
+    {
+        p_evt->type                  = BLE_NUS_EVT_RX_BUF_DATA;
+        p_evt->params.rx_data.length = (uint16_t)length;
+
+        p_nus->data_handler(p_evt);
+    }
+
+    if (length < data_len)
+    {
+        NRF_LOG_WARNING("RX buffer full, %d bytes dropped.", data_len - length);
+
+        p_evt->type                  = BLE_NUS_EVT_RX_BUF_FULL;
+        p_evt->params.rx_data.length = (uint16_t)(data_len - length);
+
+        p_nus->data_handler(p_evt);
+    }
+}
+#endif // BLE_NUS_RX_BUF_ENABLED
+
+
+/**@brief Function for passing data written by the peer to the application.
+ *
+ * @param[in] p_nus    Nordic UART Service structure.
+ * @param[in] p_evt    Event with the connection fields filled in.
+ * @param[in] p_data   Received data.
+ * @param[in] data_len Length of the data.
+ */
+static void rx_data_deliver(ble_nus_t     * p_nus,
+                            ble_nus_evt_t * p_evt,
+                            uint8_t const * p_data,
+                            size_t          data_len)
+{
+#if BLE_NUS_RX_BUF_ENABLED
+    if (p_nus->p_rx_buf != NULL)
+    {
+        on_rx_buf_write(p_nus, p_evt, p_data, data_len);
+        return;
+    }
+#endif
+
+    if (p_nus->data_handler != NULL)
+    {
+        p_evt->type                  = BLE_NUS_EVT_RX_DATA;
+        p_evt->params.rx_data.p_data = p_data;
+        p_evt->params.rx_data.length = (uint16_t)data_len;
+
+        p_nus->data_handler(p_evt);
+    }
+}
+
+
+#if BLE_NUS_LZ_ENABLED
+/**@brief Context of the decoding of a packet written by the peer. */
+typedef struct
+{
+    ble_nus_t     * p_nus; /**< Nordic UART Service structure. */
+    ble_nus_evt_t * p_evt; /**< Event with the connection fields filled in. */
+} lz_rx_ctx_t;
+
+
+/**@brief Function for handling the data decoded from a packet written by the peer.
+ *
+ * @param[in] p_data    Decoded data.
+ * @param[in] length    Length of the data.
+ * @param[in] p_context Decoding context.
+ */
+static void lz_rx_data_handler(uint8_t const * p_data, size_t length, void * p_context)
+{
+    lz_rx_ctx_t * p_ctx = (lz_rx_ctx_t *)p_context;
+
+    rx_data_deliver(p_ctx->p_nus, p_ctx->p_evt, p_data, length);
+}
+
+
+/**@brief Function for sending an event of the compression.
+ *
+ * @param[in] p_nus Nordic UART Service structure.
+ * @param[in] p_evt Event with the connection fields filled in.
+ * @param[in] type  Event type.
+ */
+static void lz_evt_send(ble_nus_t * p_nus, ble_nus_evt_t * p_evt, ble_nus_evt_type_t type)
+{
+    if (p_nus->data_handler != NULL)
+    {
+        p_evt->type = type;
+        p_nus->data_handler(p_evt);
+    }
+}
+
+
+/**@brief Function for decoding a packet written by the peer to the RX characteristic.
+ *
+ * @details A packet that cannot be decoded breaks the stream, so compression is stopped.
+ *
+ * @param[in] p_nus       Nordic UART Service structure.
+ * @param[in] p_evt       Event with the connection fields filled in.
+ * @param[in] p_evt_write Write event parameters.
+ */
+static void on_lz_rx_write(ble_nus_t                   * p_nus,
+                           ble_nus_evt_t               * p_evt,
+                           ble_gatts_evt_write_t const * p_evt_write)
+{
+    ret_code_t  err_code;
+    lz_rx_ctx_t ctx =
+    {
+        .p_nus = p_nus,
+        .p_evt = p_evt
+    };
+
+    err_code = nrf_lz_decode(&p_nus->lz_dec,
+                             p_evt_write->data,
+                             p_evt_write->len,
+                             lz_rx_data_handler,
+                             &ctx,
+                             NULL);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_WARNING("Invalid packet from 0x%02X connection handle, compression stopped.",
+                        p_evt->conn_handle);
+
+        p_nus->lz_conn_handle = BLE_CONN_HANDLE_INVALID;
+        lz_evt_send(p_nus, p_evt, BLE_NUS_EVT_LZ_STOPPED);
+    }
+}
+
+
+/**@brief Function for handling a write to the Compression characteristic.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ */
+static void on_lz_write_authorize(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    ret_code_t                            err_code;
+    ble_gatts_rw_authorize_reply_params_t reply;
+    ble_nus_evt_t                         evt;
+    ble_gatts_evt_write_t const         * p_write     =
+        &p_ble_evt->evt.gatts_evt.params.authorize_request.request.write;
+    uint16_t                              conn_handle = p_ble_evt->evt.gatts_evt.conn_handle;
+    ble_nus_evt_type_t                    evt_type    = BLE_NUS_EVT_LZ_STOPPED;
+    uint16_t                              status      = BLE_GATT_STATUS_SUCCESS;
+    bool                                  notify      = false;
+
+    if (p_write->op != BLE_GATTS_OP_WRITE_REQ)
+    {
+        status = BLE_GATT_STATUS_ATTERR_REQUEST_NOT_SUPPORTED;
+    }
+    else if (p_write->len != sizeof(uint8_t))
+    {
+        status = BLE_GATT_STATUS_ATTERR_INVALID_ATT_VAL_LENGTH;
+    }
+    else if (p_write->data[0] == 0)
+    {
+        notify = (conn_handle == p_nus->lz_conn_handle);
+        if (notify)
+        {
+            p_nus->lz_conn_handle = BLE_CONN_HANDLE_INVALID;
+        }
+    }
+    else if (!nrf_lz_format_is_supported(p_write->data[0]) ||
+             ((p_nus->lz_conn_handle != BLE_CONN_HANDLE_INVALID) &&
+              (p_nus->lz_conn_handle != conn_handle)))
+    {
+        status = BLE_GATT_STATUS_ATTERR_WRITE_NOT_PERMITTED;
+    }
+    else
+    {
+        // Both streams start over, also if the link was already compressing.
+        UNUSED_RETURN_VALUE(nrf_lz_enc_init(&p_nus->lz_enc, p_write->data[0]));
+        UNUSED_RETURN_VALUE(nrf_lz_dec_init(&p_nus->lz_dec, p_write->data[0]));
+
+        p_nus->lz_conn_handle = conn_handle;
+        evt_type              = BLE_NUS_EVT_LZ_STARTED;
+        notify                = true;
+    }
+
+    memset(&reply, 0, sizeof(reply));
+    reply.type                     = BLE_GATTS_AUTHORIZE_TYPE_WRITE;
+    reply.params.write.gatt_status = status;
+
+    err_code = sd_ble_gatts_rw_authorize_reply(conn_handle, &reply);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("Compression write could not be replied, error 0x%x.", err_code);
+    }
+
+    if (notify)
+    {
+        memset(&evt, 0, sizeof(ble_nus_evt_t));
+        evt.p_nus       = p_nus;
+        evt.conn_handle = conn_handle;
+
+        UNUSED_RETURN_VALUE(blcm_link_ctx_get(p_nus->p_link_ctx_storage,
+                                              conn_handle,
+                                              (void *) &evt.p_link_ctx));
+
+        lz_evt_send(p_nus, &evt, evt_type);
+    }
+}
+
+
+/**@brief Function for handling the @ref BLE_GATTS_EVT_RW_AUTHORIZE_REQUEST event from the SoftDevice.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ */
+static void on_rw_authorize_request(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    ble_gatts_evt_rw_authorize_request_t const * p_auth_req =
+        &p_ble_evt->evt.gatts_evt.params.authorize_request;
+
+    if ((p_auth_req->type == BLE_GATTS_AUTHORIZE_TYPE_WRITE) &&
+        (p_auth_req->request.write.handle == p_nus->lz_handles.value_handle))
+    {
+        on_lz_write_authorize(p_nus, p_ble_evt);
+    }
+}
+#endif // BLE_NUS_LZ_ENABLED
+
+
+#if BLE_NUS_L2CAP_ENABLED
+/**@brief Function for sending an event of the L2CAP channel.
+ *
+ * @param[in] p_nus  Nordic UART Service structure.
+ * @param[in] type   Event type.
+ * @param[in] p_data Buffer of a @ref BLE_NUS_EVT_L2CAP_TX_DONE event, otherwise NULL.
+ * @param[in] length Number of bytes of the buffer sent.
+ */
+static void l2cap_evt_send(ble_nus_t          * p_nus,
+                           ble_nus_evt_type_t   type,
+                           uint8_t const      * p_data,
+                           uint32_t             length)
+{
+    ble_nus_evt_t evt;
+
+    if (p_nus->data_handler == NULL)
+    {
+        return;
+    }
+
+    memset(&evt, 0, sizeof(ble_nus_evt_t));
+    evt.type                   = type;
+    evt.p_nus                  = p_nus;
+    evt.conn_handle            = p_nus->l2cap_conn_handle;
+    evt.params.l2cap_tx.p_data = p_data;
+    evt.params.l2cap_tx.length = length;
+
+    UNUSED_RETURN_VALUE(blcm_link_ctx_get(p_nus->p_link_ctx_storage,
+                                          evt.conn_handle,
+                                          (void *) &evt.p_link_ctx));
+
+    p_nus->data_handler(&evt);
+}
+
+
+/**@brief Function for keeping receive buffers posted on the L2CAP channel.
+ *
+ * @details The SoftDevice grants the peer credits for the posted buffers. With an RX buffer, a
+ *          buffer is only posted while the RX buffer has room for a full SDU in every posted
+ *          buffer, so the peer runs out of credits instead of overflowing it. An empty RX buffer
+ *          always gets one posted buffer, so the channel does not stall on an RX buffer smaller
+ *          than the MTU.
+ *
+ * @param[in] p_nus Nordic UART Service structure.
+ */
+static void l2cap_rx_resume(ble_nus_t * p_nus)
+{
+    ret_code_t err_code;
+    ble_data_t sdu_buf;
+
+    while (p_nus->l2cap_rx_posted < BLE_NUS_L2CAP_RX_QUEUE_SIZE)
+    {
+#if BLE_NUS_RX_BUF_ENABLED
+        if (p_nus->p_rx_buf != NULL)
+        {
+            uint32_t free_space = rx_buf_free_space_get(p_nus->p_rx_buf);
+            bool     fits       = (free_space >= (p_nus->l2cap_rx_posted + 1u) * BLE_NUS_L2CAP_MTU);
+            bool     empty      = (p_nus->l2cap_rx_posted == 0) &&
+                                  (free_space == p_nus->p_rx_buf->bufsize_mask + 1);
+
+            if (!fits && !empty)
+            {
+                return; // Posted again by ble_nus_rx_free.
+            }
+        }
+#endif
+
+        sdu_buf.p_data = p_nus->l2cap_rx_bufs[p_nus->l2cap_rx_next];
+        sdu_buf.len    = BLE_NUS_L2CAP_MTU;
+
+        err_code = sd_ble_l2cap_ch_rx(p_nus->l2cap_conn_handle, p_nus->l2cap_cid, &sdu_buf);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            return; // The SoftDevice receive queue is full, the buffer will be posted again on the next BLE_L2CAP_EVT_CH_RX event.
+        }
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_WARNING("L2CAP receive buffer could not be posted, error 0x%x.", err_code);
+            return;
+        }
+
+        p_nus->l2cap_rx_next = (p_nus->l2cap_rx_next + 1) % BLE_NUS_L2CAP_RX_QUEUE_SIZE;
+        p_nus->l2cap_rx_posted++;
+    }
+}
+
+
+/**@brief Function for getting the number of credits needed to send an SDU.
+ *
+ * @param[in] p_nus   Nordic UART Service structure.
+ * @param[in] sdu_len Length of the SDU.
+ *
+ * @return The number of PDUs the SDU is segmented into.
+ */
+static uint16_t l2cap_sdu_credits_get(ble_nus_t * p_nus, uint16_t sdu_len)
+{
+    uint32_t tx_mps = MAX(p_nus->l2cap_tx_params.tx_mps, BLE_L2CAP_MPS_MIN);
+
+    return (uint16_t)((sdu_len + L2CAP_SDU_LEN_SIZE + tx_mps - 1) / tx_mps);
+}
+
+
+/**@brief Function for ending the transfer of the buffer given to @ref ble_nus_l2cap_send.
+ *
+ * @param[in] p_nus Nordic UART Service structure.
+ */
+static void l2cap_tx_complete(ble_nus_t * p_nus)
+{
+    uint8_t const * p_data = p_nus->p_l2cap_tx_data;
+
+    // Cleared first, so that the next buffer can be sent from the event handler.
+    p_nus->p_l2cap_tx_data = NULL;
+
+    l2cap_evt_send(p_nus, BLE_NUS_EVT_L2CAP_TX_DONE, p_data, p_nus->l2cap_tx_sent);
+}
+
+
+/**@brief Function for queuing the next SDUs of the buffer being sent.
+ *
+ * @details SDUs of up to the MTU of the peer are queued until the whole buffer has been handed to
+ *          the SoftDevice, its queue is full, or the peer has not granted the credits the next
+ *          SDU needs. An SDU is always queued when nothing is in flight, the SoftDevice then holds
+ *          it until the credits arrive. If the SoftDevice refuses an SDU, the transfer ends after
+ *          the SDUs already queued.
+ *
+ * @param[in] p_nus Nordic UART Service structure.
+ */
+static void l2cap_tx_resume(ble_nus_t * p_nus)
+{
+    ret_code_t err_code;
+    ble_data_t sdu;
+    uint16_t   credits;
+
+    while (p_nus->l2cap_tx_queued < p_nus->l2cap_tx_len)
+    {
+        sdu.len = (uint16_t)MIN(p_nus->l2cap_tx_len - p_nus->l2cap_tx_queued,
+                                p_nus->l2cap_tx_params.tx_mtu);
+        credits = l2cap_sdu_credits_get(p_nus, sdu.len);
+
+        if (   (credits > p_nus->l2cap_tx_credits)
+            && (p_nus->l2cap_tx_queued != p_nus->l2cap_tx_sent))
+        {
+            return; // Resumed on the next BLE_L2CAP_EVT_CH_TX or BLE_L2CAP_EVT_CH_CREDIT event.
+        }
+
+        sdu.p_data = (uint8_t *)&p_nus->p_l2cap_tx_data[p_nus->l2cap_tx_queued];
+
+        err_code = sd_ble_l2cap_ch_tx(p_nus->l2cap_conn_handle, p_nus->l2cap_cid, &sdu);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            return; // The SoftDevice queue is full, resumed on the next BLE_L2CAP_EVT_CH_TX event.
+        }
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_WARNING("L2CAP send stopped, error 0x%x.", err_code);
+
+            p_nus->l2cap_tx_len = p_nus->l2cap_tx_queued;
+            if (p_nus->l2cap_tx_sent == p_nus->l2cap_tx_queued)
+            {
+                l2cap_tx_complete(p_nus);
+            }
+            return;
+        }
+
+        p_nus->l2cap_tx_queued  += sdu.len;
+        p_nus->l2cap_tx_credits -= MIN(credits, p_nus->l2cap_tx_credits);
+    }
+}
+
+
+/**@brief Function for forgetting the L2CAP channel.
+ *
+ * @details A transfer in progress is ended first, and @ref BLE_NUS_EVT_L2CAP_DISCONNECTED is sent
+ *          if the channel was set up. The SoftDevice gives back all posted buffers with the
+ *          channel.
+ *
+ * @param[in] p_nus Nordic UART Service structure.
+ */
+static void l2cap_released(ble_nus_t * p_nus)
+{
+    bool connected = p_nus->l2cap_connected;
+
+    p_nus->l2cap_connected  = false;
+    p_nus->l2cap_rx_posted  = 0;
+    p_nus->l2cap_rx_next    = 0;
+    p_nus->l2cap_tx_credits = 0;
+
+    if (p_nus->p_l2cap_tx_data != NULL)
+    {
+        l2cap_tx_complete(p_nus);
+    }
+
+    if (connected)
+    {
+        l2cap_evt_send(p_nus, BLE_NUS_EVT_L2CAP_DISCONNECTED, NULL, 0);
+    }
+
+    p_nus->l2cap_conn_handle = BLE_CONN_HANDLE_INVALID;
+    p_nus->l2cap_cid         = BLE_L2CAP_CID_INVALID;
+}
+
+
+/**@brief Function for checking if an L2CAP event is for the channel of the service.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ *
+ * @retval true  If the event is for the channel.
+ * @retval false Otherwise.
+ */
+static bool l2cap_evt_is_for_channel(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    return (p_nus->l2cap_conn_handle != BLE_CONN_HANDLE_INVALID)                &&
+           (p_ble_evt->evt.l2cap_evt.conn_handle == p_nus->l2cap_conn_handle) &&
+           (p_ble_evt->evt.l2cap_evt.local_cid == p_nus->l2cap_cid);
+}
+
+
+/**@brief Function for handling the @ref BLE_L2CAP_EVT_CH_SETUP_REQUEST event from the SoftDevice.
+ *
+ * @details Requests for other PSMs are left to the modules that own them. A request is refused if
+ *          a channel is already open or being set up.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ */
+static void on_l2cap_ch_setup_request(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    ret_code_t                  err_code;
+    ble_l2cap_ch_setup_params_t setup_params;
+    uint16_t                    conn_handle = p_ble_evt->evt.l2cap_evt.conn_handle;
+    uint16_t                    local_cid   = p_ble_evt->evt.l2cap_evt.local_cid;
+
+    if (p_ble_evt->evt.l2cap_evt.params.ch_setup_request.le_psm != BLE_NUS_L2CAP_PSM)
+    {
+        return;
+    }
+
+    memset(&setup_params, 0, sizeof(setup_params));
+    setup_params.le_psm = BLE_NUS_L2CAP_PSM;
+
+    if (p_nus->l2cap_conn_handle != BLE_CONN_HANDLE_INVALID)
+    {
+        NRF_LOG_WARNING("L2CAP channel refused on 0x%02X connection handle, one is already open.",
+                        conn_handle);
+        setup_params.status = BLE_L2CAP_CH_STATUS_CODE_NO_RESOURCES;
+    }
+    else
+    {
+        setup_params.status           = BLE_L2CAP_CH_STATUS_CODE_SUCCESS;
+        setup_params.rx_params.rx_mtu = BLE_NUS_L2CAP_MTU;
+        setup_params.rx_params.rx_mps = BLE_NUS_L2CAP_MPS;
+    }
+
+    err_code = sd_ble_l2cap_ch_setup(conn_handle, &local_cid, &setup_params);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("L2CAP channel setup could not be replied, error 0x%x.", err_code);
+        return;
+    }
+
+    if (setup_params.status == BLE_L2CAP_CH_STATUS_CODE_SUCCESS)
+    {
+        p_nus->l2cap_conn_handle = conn_handle;
+        p_nus->l2cap_cid         = local_cid;
+    }
+}
+
+
+/**@brief Function for handling the @ref BLE_L2CAP_EVT_CH_SETUP event from the SoftDevice.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ */
+static void on_l2cap_ch_setup(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    if (!l2cap_evt_is_for_channel(p_nus, p_ble_evt))
+    {
+        return;
+    }
+
+    p_nus->l2cap_tx_params  = p_ble_evt->evt.l2cap_evt.params.ch_setup.tx_params;
+    p_nus->l2cap_tx_credits = p_nus->l2cap_tx_params.credits;
+    p_nus->l2cap_rx_posted  = 0;
+    p_nus->l2cap_rx_next    = 0;
+    p_nus->l2cap_connected  = true;
+
+    NRF_LOG_INFO("L2CAP channel open on 0x%02X connection handle, MTU %d.",
+                 p_nus->l2cap_conn_handle, p_nus->l2cap_tx_params.tx_mtu);
+
+    l2cap_rx_resume(p_nus);
+    l2cap_evt_send(p_nus, BLE_NUS_EVT_L2CAP_CONNECTED, NULL, 0);
+}
+
+
+/**@brief Function for handling the @ref BLE_L2CAP_EVT_CH_RX event from the SoftDevice.
+ *
+ * @details The SDU is passed on like data written to the RX characteristic, then its buffer is
+ *          posted again.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ */
+static void on_l2cap_ch_rx(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    ble_nus_evt_t                 evt;
+    ble_l2cap_evt_ch_rx_t const * p_rx = &p_ble_evt->evt.l2cap_evt.params.rx;
+
+    if (!p_nus->l2cap_connected || !l2cap_evt_is_for_channel(p_nus, p_ble_evt))
+    {
+        return;
+    }
+
+    if (p_nus->l2cap_rx_posted > 0)
+    {
+        p_nus->l2cap_rx_posted--;
+    }
+
+    memset(&evt, 0, sizeof(ble_nus_evt_t));
+    evt.p_nus       = p_nus;
+    evt.conn_handle = p_nus->l2cap_conn_handle;
+
+    UNUSED_RETURN_VALUE(blcm_link_ctx_get(p_nus->p_link_ctx_storage,
+                                          evt.conn_handle,
+                                          (void *) &evt.p_link_ctx));
+
+    rx_data_deliver(p_nus, &evt, p_rx->sdu_buf.p_data, MIN(p_rx->sdu_len, p_rx->sdu_buf.len));
+
+    if (p_nus->l2cap_connected)
+    {
+        l2cap_rx_resume(p_nus);
+    }
+}
+
+
+/**@brief Function for handling the @ref BLE_L2CAP_EVT_CH_TX event from the SoftDevice.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ */
+static void on_l2cap_ch_tx(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    if ((p_nus->p_l2cap_tx_data == NULL) || !l2cap_evt_is_for_channel(p_nus, p_ble_evt))
+    {
+        return;
+    }
+
+    p_nus->l2cap_tx_sent += p_ble_evt->evt.l2cap_evt.params.tx.sdu_buf.len;
+
+    if (p_nus->l2cap_tx_sent >= p_nus->l2cap_tx_len)
+    {
+        l2cap_tx_complete(p_nus);
+    }
+    else
+    {
+        l2cap_tx_resume(p_nus);
+    }
+}
+
+
+/**@brief Function for handling the @ref BLE_L2CAP_EVT_CH_CREDIT event from the SoftDevice.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ */
+static void on_l2cap_ch_credit(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    if (!l2cap_evt_is_for_channel(p_nus, p_ble_evt))
+    {
+        return;
+    }
+
+    p_nus->l2cap_tx_credits += p_ble_evt->evt.l2cap_evt.params.credit.credits;
+
+    if (p_nus->p_l2cap_tx_data != NULL)
+    {
+        l2cap_tx_resume(p_nus);
+    }
+}
+
+
+/**@brief Function for handling the @ref BLE_L2CAP_EVT_CH_RELEASED and
+ *        @ref BLE_L2CAP_EVT_CH_SETUP_REFUSED events from the SoftDevice.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ */
+static void on_l2cap_ch_released(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    if (l2cap_evt_is_for_channel(p_nus, p_ble_evt))
+    {
+        NRF_LOG_INFO("L2CAP channel released on 0x%02X connection handle.",
+                     p_nus->l2cap_conn_handle);
+        l2cap_released(p_nus);
+    }
+}
+#endif // BLE_NUS_L2CAP_ENABLED
+
+
 /**@brief Function for handling the @ref BLE_GAP_EVT_CONNECTED event from the SoftDevice.
  *
  * @param[in] p_nus     Nordic UART Service structure.
@@ -123,15 +1052,12 @@ static void on_connect(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
  */
 static void on_write(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
 {
-    ret_code_t                    err_code;
     ble_nus_evt_t                 evt;
     ble_nus_client_context_t    * p_client;
     ble_gatts_evt_write_t const * p_evt_write = &p_ble_evt->evt.gatts_evt.params.write;
 
-    err_code = blcm_link_ctx_get(p_nus->p_link_ctx_storage,
-                                 p_ble_evt->evt.gatts_evt.conn_handle,
-                                 (void *) &p_client);
-    if (err_code != NRF_SUCCESS)
+    p_client = blcm_link_ctx_evt_get(p_nus->p_link_ctx_storage, p_ble_evt);
+    if (p_client == NULL)
     {
         NRF_LOG_ERROR("Link context for 0x%02X connection handle could not be fetched.",
                       p_ble_evt->evt.gatts_evt.conn_handle);
@@ -156,6 +1082,12 @@ static void on_write(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
             {
                 p_client->is_notification_enabled = false;
                 evt.type                          = BLE_NUS_EVT_COMM_STOPPED;
+#if BLE_NUS_STREAM_ENABLED
+                if (evt.conn_handle == p_nus->stream_conn_handle)
+                {
+                    p_nus->stream_paused = true;
+                }
+#endif
             }
 
             if (p_nus->data_handler != NULL)
@@ -165,14 +1097,23 @@ static void on_write(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
 
         }
     }
+#if BLE_NUS_RX_CREDITS_ENABLED
+    else if ((p_evt_write->handle == p_nus->credits_handles.cccd_handle) &&
+             (p_evt_write->len == 2))
+    {
+        on_credits_cccd_write(p_nus, evt.conn_handle, p_evt_write);
+    }
+#endif
+#if BLE_NUS_LZ_ENABLED
     else if ((p_evt_write->handle == p_nus->rx_handles.value_handle) &&
-             (p_nus->data_handler != NULL))
+             (evt.conn_handle == p_nus->lz_conn_handle))
     {
-        evt.type                  = BLE_NUS_EVT_RX_DATA;
-        evt.params.rx_data.p_data = p_evt_write->data;
-        evt.params.rx_data.length = p_evt_write->len;
-
-        p_nus->data_handler(&evt);
+        on_lz_rx_write(p_nus, &evt, p_evt_write);
+    }
+#endif
+    else if (p_evt_write->handle == p_nus->rx_handles.value_handle)
+    {
+        rx_data_deliver(p_nus, &evt, p_evt_write->data, p_evt_write->len);
     }
     else
     {
@@ -188,20 +1129,33 @@ static void on_write(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
  */
 static void on_hvx_tx_complete(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
 {
-    ret_code_t                 err_code;
     ble_nus_evt_t              evt;
     ble_nus_client_context_t * p_client;
 
-    err_code = blcm_link_ctx_get(p_nus->p_link_ctx_storage,
-                                 p_ble_evt->evt.gatts_evt.conn_handle,
-                                 (void *) &p_client);
-    if (err_code != NRF_SUCCESS)
+    p_client = blcm_link_ctx_evt_get(p_nus->p_link_ctx_storage, p_ble_evt);
+    if (p_client == NULL)
     {
         NRF_LOG_ERROR("Link context for 0x%02X connection handle could not be fetched.",
                       p_ble_evt->evt.gatts_evt.conn_handle);
         return;
     }
 
+#if BLE_NUS_STREAM_ENABLED
+    if ((p_nus->p_stream_buf != NULL) &&
+        (p_ble_evt->evt.gatts_evt.conn_handle == p_nus->stream_conn_handle))
+    {
+        stream_process(p_nus);
+    }
+#endif
+
+#if BLE_NUS_RX_CREDITS_ENABLED
+    if ((p_nus->credits_pending) &&
+        (p_ble_evt->evt.gatts_evt.conn_handle == p_nus->credits_conn_handle))
+    {
+        credits_send(p_nus);
+    }
+#endif
+
     if ((p_client->is_notification_enabled) && (p_nus->data_handler != NULL))
     {
         memset(&evt, 0, sizeof(ble_nus_evt_t));
@@ -215,6 +1169,48 @@ static void on_hvx_tx_complete(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
 }
 
 
+#if BLE_NUS_STREAM_ENABLED || BLE_NUS_RX_CREDITS_ENABLED || BLE_NUS_LZ_ENABLED || BLE_NUS_L2CAP_ENABLED
+/**@brief Function for handling the @ref BLE_GAP_EVT_DISCONNECTED event from the SoftDevice.
+ *
+ * @param[in] p_nus     Nordic UART Service structure.
+ * @param[in] p_ble_evt Pointer to the event received from BLE stack.
+ */
+static void on_disconnect(ble_nus_t * p_nus, ble_evt_t const * p_ble_evt)
+{
+    uint16_t conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+
+#if BLE_NUS_STREAM_ENABLED
+    if ((p_nus->p_stream_buf != NULL) && (conn_handle == p_nus->stream_conn_handle))
+    {
+        UNUSED_RETURN_VALUE(ble_nus_stream_stop(p_nus));
+    }
+#endif
+
+#if BLE_NUS_RX_CREDITS_ENABLED
+    if (conn_handle == p_nus->credits_conn_handle)
+    {
+        p_nus->credits_conn_handle = BLE_CONN_HANDLE_INVALID;
+        p_nus->credits_pending     = false;
+    }
+#endif
+
+#if BLE_NUS_LZ_ENABLED
+    if (conn_handle == p_nus->lz_conn_handle)
+    {
+        p_nus->lz_conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+#endif
+
+#if BLE_NUS_L2CAP_ENABLED
+    if (conn_handle == p_nus->l2cap_conn_handle)
+    {
+        l2cap_released(p_nus);
+    }
+#endif
+}
+#endif // BLE_NUS_STREAM_ENABLED || BLE_NUS_RX_CREDITS_ENABLED || BLE_NUS_LZ_ENABLED || BLE_NUS_L2CAP_ENABLED
+
+
 void ble_nus_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
 {
     if ((p_context == NULL) || (p_ble_evt == NULL))
@@ -234,10 +1230,49 @@ void ble_nus_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
             on_write(p_nus, p_ble_evt);
             break;
 
+#if BLE_NUS_STREAM_ENABLED || BLE_NUS_RX_CREDITS_ENABLED || BLE_NUS_LZ_ENABLED || BLE_NUS_L2CAP_ENABLED
+        case BLE_GAP_EVT_DISCONNECTED:
+            on_disconnect(p_nus, p_ble_evt);
+            break;
+#endif
+
+#if BLE_NUS_LZ_ENABLED
+        case BLE_GATTS_EVT_RW_AUTHORIZE_REQUEST:
+            on_rw_authorize_request(p_nus, p_ble_evt);
+            break;
+#endif
+
         case BLE_GATTS_EVT_HVN_TX_COMPLETE:
             on_hvx_tx_complete(p_nus, p_ble_evt);
             break;
 
+#if BLE_NUS_L2CAP_ENABLED
+        case BLE_L2CAP_EVT_CH_SETUP_REQUEST:
+            on_l2cap_ch_setup_request(p_nus, p_ble_evt);
+            break;
+
+        case BLE_L2CAP_EVT_CH_SETUP:
+            on_l2cap_ch_setup(p_nus, p_ble_evt);
+            break;
+
+        case BLE_L2CAP_EVT_CH_SETUP_REFUSED:
+        case BLE_L2CAP_EVT_CH_RELEASED:
+            on_l2cap_ch_released(p_nus, p_ble_evt);
+            break;
+
+        case BLE_L2CAP_EVT_CH_RX:
+            on_l2cap_ch_rx(p_nus, p_ble_evt);
+            break;
+
+        case BLE_L2CAP_EVT_CH_TX:
+            on_l2cap_ch_tx(p_nus, p_ble_evt);
+            break;
+
+        case BLE_L2CAP_EVT_CH_CREDIT:
+            on_l2cap_ch_credit(p_nus, p_ble_evt);
+            break;
+#endif
+
         default:
             // No implementation needed.
             break;
@@ -258,6 +1293,51 @@ uint32_t ble_nus_init(ble_nus_t * p_nus, ble_nus_init_t const * p_nus_init)
     // Initialize the service structure.
     p_nus->data_handler = p_nus_init->data_handler;
 
+#if BLE_NUS_STREAM_ENABLED
+    p_nus->p_stream_buf       = p_nus_init->p_stream_buf;
+    p_nus->stream_conn_handle = BLE_CONN_HANDLE_INVALID;
+    p_nus->stream_pending     = false;
+    p_nus->stream_flush       = false;
+    p_nus->stream_paused      = false;
+    p_nus->stream_blocked     = false;
+
+    if (p_nus->p_stream_buf != NULL)
+    {
+        nrf_ringbuf_init(&p_nus->p_stream_buf->ringbuf);
+    }
+#endif
+
+#if BLE_NUS_RX_BUF_ENABLED
+    p_nus->p_rx_buf = p_nus_init->p_rx_buf;
+
+    if (p_nus->p_rx_buf != NULL)
+    {
+        nrf_ringbuf_init(p_nus->p_rx_buf);
+    }
+#endif
+
+#if BLE_NUS_RX_CREDITS_ENABLED
+    memset(&p_nus->credits_handles, 0, sizeof(p_nus->credits_handles));
+    p_nus->credits_conn_handle = BLE_CONN_HANDLE_INVALID;
+    p_nus->credits_limit       = 0;
+    p_nus->credits_pending     = false;
+#endif
+
+#if BLE_NUS_LZ_ENABLED
+    memset(&p_nus->lz_handles, 0, sizeof(p_nus->lz_handles));
+    p_nus->lz_conn_handle = BLE_CONN_HANDLE_INVALID;
+#endif
+
+#if BLE_NUS_L2CAP_ENABLED
+    memset(&p_nus->l2cap_handles, 0, sizeof(p_nus->l2cap_handles));
+    p_nus->l2cap_conn_handle = BLE_CONN_HANDLE_INVALID;
+    p_nus->l2cap_cid         = BLE_L2CAP_CID_INVALID;
+    p_nus->l2cap_connected   = false;
+    p_nus->p_l2cap_tx_data   = NULL;
+    p_nus->l2cap_rx_posted   = 0;
+    p_nus->l2cap_rx_next     = 0;
+#endif
+
     /**@snippet [Adding proprietary Service to the SoftDevice] */
     // Add a custom base UUID.
     err_code = sd_ble_uuid_vs_add(&nus_base_uuid, &p_nus->uuid_type);
@@ -306,9 +1386,134 @@ uint32_t ble_nus_init(ble_nus_t * p_nus, ble_nus_init_t const * p_nus_init)
     add_char_params.write_access      = SEC_OPEN;
     add_char_params.cccd_write_access = SEC_OPEN;
 
-    return characteristic_add(p_nus->service_handle, &add_char_params, &p_nus->tx_handles);
+    err_code = characteristic_add(p_nus->service_handle, &add_char_params, &p_nus->tx_handles);
     /**@snippet [Adding proprietary characteristic to the SoftDevice] */
+
+#if BLE_NUS_RX_CREDITS_ENABLED
+    if ((err_code == NRF_SUCCESS) && (p_nus->p_rx_buf != NULL))
+    {
+        uint8_t encoded_limit[sizeof(uint32_t)];
+
+        // Add the RX Credits Characteristic.
+        memset(&add_char_params, 0, sizeof(add_char_params));
+        add_char_params.uuid              = BLE_UUID_NUS_RX_CREDITS_CHARACTERISTIC;
+        add_char_params.uuid_type         = p_nus->uuid_type;
+        add_char_params.max_len           = sizeof(encoded_limit);
+        add_char_params.init_len          = uint32_encode(0, encoded_limit);
+        add_char_params.p_init_value      = encoded_limit;
+        add_char_params.char_props.read   = 1;
+        add_char_params.char_props.notify = 1;
+
+        add_char_params.read_access       = SEC_OPEN;
+        add_char_params.cccd_write_access = SEC_OPEN;
+
+        err_code = characteristic_add(p_nus->service_handle,
+                                      &add_char_params,
+                                      &p_nus->credits_handles);
+    }
+#endif
+
+#if BLE_NUS_LZ_ENABLED
+    if (err_code == NRF_SUCCESS)
+    {
+        uint8_t format = NRF_LZ_FORMAT_DEFAULT;
+
+        // Add the Compression Characteristic. Writes are authorized to check the format.
+        memset(&add_char_params, 0, sizeof(add_char_params));
+        add_char_params.uuid             = BLE_UUID_NUS_LZ_CHARACTERISTIC;
+        add_char_params.uuid_type        = p_nus->uuid_type;
+        add_char_params.max_len          = sizeof(format);
+        add_char_params.init_len         = sizeof(format);
+        add_char_params.p_init_value     = &format;
+        add_char_params.is_defered_write = true;
+        add_char_params.char_props.read  = 1;
+        add_char_params.char_props.write = 1;
+
+        add_char_params.read_access      = SEC_OPEN;
+        add_char_params.write_access     = SEC_OPEN;
+
+        err_code = characteristic_add(p_nus->service_handle,
+                                      &add_char_params,
+                                      &p_nus->lz_handles);
+    }
+#endif
+
+#if BLE_NUS_L2CAP_ENABLED
+    if (err_code == NRF_SUCCESS)
+    {
+        uint8_t encoded_psm[sizeof(uint16_t)];
+
+        // Add the L2CAP PSM Characteristic.
+        memset(&add_char_params, 0, sizeof(add_char_params));
+        add_char_params.uuid            = BLE_UUID_NUS_L2CAP_PSM_CHARACTERISTIC;
+        add_char_params.uuid_type       = p_nus->uuid_type;
+        add_char_params.max_len         = sizeof(encoded_psm);
+        add_char_params.init_len        = uint16_encode(BLE_NUS_L2CAP_PSM, encoded_psm);
+        add_char_params.p_init_value    = encoded_psm;
+        add_char_params.char_props.read = 1;
+
+        add_char_params.read_access     = SEC_OPEN;
+
+        err_code = characteristic_add(p_nus->service_handle,
+                                      &add_char_params,
+                                      &p_nus->l2cap_handles);
+    }
+#endif
+
+    return err_code;
+}
+
+
+#if BLE_NUS_LZ_ENABLED
+/**@brief Function for sending data to a peer that started compression.
+ *
+ * @details The packet can take up to the larger of the data length and the payload of the
+ *          default ATT MTU, so it always fits the MTU of the link. The data is only added to the
+ *          stream if the notification was queued.
+ *
+ * @param[in]     p_nus       Nordic UART Service structure.
+ * @param[in]     p_data      Data to be sent.
+ * @param[in,out] p_length    Length of the data. Number of bytes sent.
+ * @param[in]     conn_handle Connection handle of the peer.
+ *
+ * @return The error returned by @ref sd_ble_gatts_hvx.
+ */
+static uint32_t lz_data_send(ble_nus_t * p_nus,
+                             uint8_t   * p_data,
+                             uint16_t  * p_length,
+                             uint16_t    conn_handle)
+{
+    ret_code_t             err_code;
+    ble_gatts_hvx_params_t hvx_params;
+    uint8_t                packet[BLE_NUS_MAX_DATA_LEN];
+    size_t                 taken;
+    uint16_t               packet_len;
+
+    packet_len = (uint16_t)nrf_lz_encode(&p_nus->lz_enc,
+                                         p_data,
+                                         *p_length,
+                                         packet,
+                                         MAX(*p_length,
+                                             BLE_GATT_ATT_MTU_DEFAULT - OPCODE_LENGTH - HANDLE_LENGTH),
+                                         &taken);
+
+    memset(&hvx_params, 0, sizeof(hvx_params));
+
+    hvx_params.handle = p_nus->tx_handles.value_handle;
+    hvx_params.p_data = packet;
+    hvx_params.p_len  = &packet_len;
+    hvx_params.type   = BLE_GATT_HVX_NOTIFICATION;
+
+    err_code = sd_ble_gatts_hvx(conn_handle, &hvx_params);
+    if (err_code == NRF_SUCCESS)
+    {
+        nrf_lz_enc_commit(&p_nus->lz_enc, p_data, taken);
+        *p_length = (uint16_t)taken;
+    }
+
+    return err_code;
 }
+#endif // BLE_NUS_LZ_ENABLED
 
 
 uint32_t ble_nus_data_send(ble_nus_t * p_nus,
@@ -340,6 +1545,13 @@ uint32_t ble_nus_data_send(ble_nus_t * p_nus,
         return NRF_ERROR_INVALID_PARAM;
     }
 
+#if BLE_NUS_LZ_ENABLED
+    if (conn_handle == p_nus->lz_conn_handle)
+    {
+        return lz_data_send(p_nus, p_data, p_length, conn_handle);
+    }
+#endif
+
     memset(&hvx_params, 0, sizeof(hvx_params));
 
     hvx_params.handle = p_nus->tx_handles.value_handle;
@@ -351,4 +1563,175 @@ uint32_t ble_nus_data_send(ble_nus_t * p_nus,
 }
 
 
+#if BLE_NUS_STREAM_ENABLED
+uint32_t ble_nus_stream_start(ble_nus_t * p_nus, uint16_t conn_handle, uint16_t max_data_len)
+{
+    ret_code_t                 err_code;
+    ble_nus_client_context_t * p_client;
+
+    VERIFY_PARAM_NOT_NULL(p_nus);
+
+    if (p_nus->p_stream_buf == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if ((max_data_len == 0) || (max_data_len > BLE_NUS_MAX_DATA_LEN))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    err_code = blcm_link_ctx_get(p_nus->p_link_ctx_storage, conn_handle, (void *) &p_client);
+    VERIFY_SUCCESS(err_code);
+
+    if ((conn_handle == BLE_CONN_HANDLE_INVALID) || (p_client == NULL))
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    if (!p_client->is_notification_enabled)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    p_nus->stream_max_len     = max_data_len;
+    p_nus->stream_conn_handle = conn_handle;
+    p_nus->stream_paused      = false;
+
+    stream_process(p_nus);
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t ble_nus_stream_write(ble_nus_t * p_nus, uint8_t const * p_data, size_t * p_length)
+{
+    ret_code_t err_code;
+    size_t     requested;
+
+    VERIFY_PARAM_NOT_NULL(p_nus);
+    VERIFY_PARAM_NOT_NULL(p_data);
+    VERIFY_PARAM_NOT_NULL(p_length);
+
+    if (p_nus->p_stream_buf == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    requested = *p_length;
+
+    err_code = nrf_ringbuf_cpy_put(&p_nus->p_stream_buf->ringbuf, p_data, p_length);
+    VERIFY_SUCCESS(err_code);
+
+    if (*p_length < requested)
+    {
+        p_nus->stream_blocked = true;
+    }
+
+    stream_process(p_nus);
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t ble_nus_stream_stop(ble_nus_t * p_nus)
+{
+    VERIFY_PARAM_NOT_NULL(p_nus);
+
+    if (p_nus->p_stream_buf == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    p_nus->stream_conn_handle = BLE_CONN_HANDLE_INVALID;
+    p_nus->stream_flush       = true;
+
+    stream_process(p_nus);
+
+    return NRF_SUCCESS;
+}
+#endif // BLE_NUS_STREAM_ENABLED
+
+
+#if BLE_NUS_RX_BUF_ENABLED
+uint32_t ble_nus_rx_get(ble_nus_t * p_nus, uint8_t ** pp_data, size_t * p_length)
+{
+    VERIFY_PARAM_NOT_NULL(p_nus);
+    VERIFY_PARAM_NOT_NULL(pp_data);
+    VERIFY_PARAM_NOT_NULL(p_length);
+
+    if (p_nus->p_rx_buf == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    return nrf_ringbuf_get(p_nus->p_rx_buf, pp_data, p_length, true);
+}
+
+
+uint32_t ble_nus_rx_free(ble_nus_t * p_nus, size_t length)
+{
+    ret_code_t err_code;
+
+    VERIFY_PARAM_NOT_NULL(p_nus);
+
+    if (p_nus->p_rx_buf == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    err_code = nrf_ringbuf_free(p_nus->p_rx_buf, length);
+    VERIFY_SUCCESS(err_code);
+
+#if BLE_NUS_RX_CREDITS_ENABLED
+    if ((length != 0) && (p_nus->credits_conn_handle != BLE_CONN_HANDLE_INVALID))
+    {
+        p_nus->credits_limit += length;
+        credits_send(p_nus);
+    }
+#endif
+
+#if BLE_NUS_L2CAP_ENABLED
+    if ((length != 0) && p_nus->l2cap_connected)
+    {
+        l2cap_rx_resume(p_nus);
+    }
+#endif
+
+    return NRF_SUCCESS;
+}
+#endif // BLE_NUS_RX_BUF_ENABLED
+
+
+#if BLE_NUS_L2CAP_ENABLED
+uint32_t ble_nus_l2cap_send(ble_nus_t * p_nus, uint8_t const * p_data, uint32_t length)
+{
+    VERIFY_PARAM_NOT_NULL(p_nus);
+    VERIFY_PARAM_NOT_NULL(p_data);
+
+    if (length == 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    if (!p_nus->l2cap_connected)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (p_nus->p_l2cap_tx_data != NULL)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    p_nus->p_l2cap_tx_data = p_data;
+    p_nus->l2cap_tx_len    = length;
+    p_nus->l2cap_tx_queued = 0;
+    p_nus->l2cap_tx_sent   = 0;
+
+    l2cap_tx_resume(p_nus);
+
+    return NRF_SUCCESS;
+}
+#endif // BLE_NUS_L2CAP_ENABLED
+
+
 #endif // NRF_MODULE_ENABLED(BLE_NUS)
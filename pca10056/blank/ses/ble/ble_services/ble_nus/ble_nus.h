@@ -70,6 +70,26 @@
 #include "ble_srv_common.h"
 #include "nrf_sdh_ble.h"
 #include "ble_link_ctx_manager.h"
+#if BLE_NUS_STREAM_ENABLED || BLE_NUS_RX_BUF_ENABLED
+#include "nrf_ringbuf.h"
+#endif
+#if BLE_NUS_STREAM_ENABLED
+#include "nrf_ringbuf_span.h"
+#endif
+#if BLE_NUS_LZ_ENABLED
+#include "nrf_lz.h"
+#endif
+#if BLE_NUS_L2CAP_ENABLED
+#include "ble_l2cap.h"
+#endif
+
+#if BLE_NUS_RX_CREDITS_ENABLED && !BLE_NUS_RX_BUF_ENABLED
+#error "BLE_NUS_RX_CREDITS_ENABLED requires BLE_NUS_RX_BUF_ENABLED."
+#endif
+
+#if BLE_NUS_LZ_ENABLED && !NRF_MODULE_ENABLED(NRF_LZ)
+#error "BLE_NUS_LZ_ENABLED requires NRF_LZ_ENABLED."
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -96,6 +116,41 @@ extern "C" {
 
 #define BLE_UUID_NUS_SERVICE 0x0001 /**< The UUID of the Nordic UART Service. */
 
+/**@brief   The UUID of the RX Credits Characteristic.
+ *
+ * @details Present if @c BLE_NUS_RX_CREDITS_ENABLED is set. The characteristic can be read and
+ *          notified. Its value is a 32-bit little-endian number of bytes the peer may write to
+ *          the RX characteristic, counted from when it enabled notifications of the RX Credits
+ *          characteristic. It starts at the free space of the RX buffer and grows as the
+ *          application frees received data, so a peer that stops at the limit never overflows
+ *          the buffer. The flow control is meant for one peer writing at a time.
+ */
+#define BLE_UUID_NUS_RX_CREDITS_CHARACTERISTIC 0x0004
+
+/**@brief   The UUID of the Compression Characteristic.
+ *
+ * @details Present if @c BLE_NUS_LZ_ENABLED is set. Reading it gives the largest @ref nrf_lz
+ *          format supported by the server. The peer starts compression by writing, with a write
+ *          request, the format it chose with @ref nrf_lz_format_negotiate, and stops it by
+ *          writing 0. From the write response on, the data of every write to the RX
+ *          characteristic and of every notification of the TX characteristic on that link is an
+ *          @ref nrf_lz packet, and the peer must not send data while its write is pending. The
+ *          write is rejected if the format is not supported or another link uses compression.
+ *          The RX credits count the bytes before compression.
+ */
+#define BLE_UUID_NUS_LZ_CHARACTERISTIC 0x0005
+
+/**@brief   The UUID of the L2CAP PSM Characteristic.
+ *
+ * @details Present if @c BLE_NUS_L2CAP_ENABLED is set. Reading it gives the 16-bit
+ *          little-endian LE PSM on which the server accepts an L2CAP channel. Once the peer has
+ *          opened the channel, every SDU it sends is handled like a write to the RX
+ *          characteristic, and @ref ble_nus_l2cap_send sends SDUs to it. The RX and TX
+ *          characteristics stay usable, so a peer without the channel falls back to them. One
+ *          link at a time can open the channel. The data on the channel is never compressed.
+ */
+#define BLE_UUID_NUS_L2CAP_PSM_CHARACTERISTIC 0x0006
+
 #define OPCODE_LENGTH        1
 #define HANDLE_LENGTH        2
 
@@ -107,6 +162,21 @@ extern "C" {
     #warning NRF_SDH_BLE_GATT_MAX_MTU_SIZE is not defined.
 #endif
 
+#if BLE_NUS_STREAM_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief   Macro for defining the ring buffer of the streaming TX mode.
+ *
+ * @details The buffer has a mirror area of @ref BLE_NUS_MAX_DATA_LEN bytes, so every notification
+ *          is sent from one contiguous block, also when the data wraps. Pass the instance to
+ *          @ref ble_nus_init in @ref ble_nus_init_t::p_stream_buf.
+ *
+ * @param _name Name of the ring buffer instance.
+ * @param _size Size of the buffer (must be a power of 2).
+ * @hideinitializer
+ */
+#define BLE_NUS_STREAM_BUF_DEF(_name, _size) \
+    NRF_RINGBUF_MIRRORED_DEF(_name, _size, BLE_NUS_MAX_DATA_LEN)
+#endif // BLE_NUS_STREAM_ENABLED
+
 
 /**@brief   Nordic UART Service event types. */
 typedef enum
@@ -115,6 +185,23 @@ typedef enum
     BLE_NUS_EVT_TX_RDY,       /**< Service is ready to accept new data to be transmitted. */
     BLE_NUS_EVT_COMM_STARTED, /**< Notification has been enabled. */
     BLE_NUS_EVT_COMM_STOPPED, /**< Notification has been disabled. */
+#if BLE_NUS_STREAM_ENABLED
+    BLE_NUS_EVT_STREAM_WRITABLE, /**< Space was freed in the stream buffer after @ref ble_nus_stream_write could not take all data. */
+    BLE_NUS_EVT_STREAM_EMPTY,    /**< All data in the stream buffer has been handed to the SoftDevice. */
+#endif
+#if BLE_NUS_RX_BUF_ENABLED
+    BLE_NUS_EVT_RX_BUF_DATA,     /**< Data received and stored in the RX buffer. */
+    BLE_NUS_EVT_RX_BUF_FULL,     /**< Data received and dropped, because the RX buffer was full. */
+#endif
+#if BLE_NUS_LZ_ENABLED
+    BLE_NUS_EVT_LZ_STARTED,      /**< The peer started compression on the link. */
+    BLE_NUS_EVT_LZ_STOPPED,      /**< The peer stopped compression, or a packet received from it could not be decoded. */
+#endif
+#if BLE_NUS_L2CAP_ENABLED
+    BLE_NUS_EVT_L2CAP_CONNECTED,    /**< The peer opened the L2CAP channel. */
+    BLE_NUS_EVT_L2CAP_DISCONNECTED, /**< The L2CAP channel was released. */
+    BLE_NUS_EVT_L2CAP_TX_DONE,      /**< The buffer given to @ref ble_nus_l2cap_send was sent, or the channel was released before. */
+#endif
 } ble_nus_evt_type_t;
 
 
@@ -125,6 +212,8 @@ typedef struct ble_nus_s ble_nus_t;
 /**@brief   Nordic UART Service @ref BLE_NUS_EVT_RX_DATA event data.
  *
  * @details This structure is passed to an event when @ref BLE_NUS_EVT_RX_DATA occurs.
+ *          For @c BLE_NUS_EVT_RX_BUF_DATA and @c BLE_NUS_EVT_RX_BUF_FULL, @p p_data is NULL and
+ *          @p length is the number of bytes stored or dropped.
  */
 typedef struct
 {
@@ -133,6 +222,16 @@ typedef struct
 } ble_nus_evt_rx_data_t;
 
 
+#if BLE_NUS_L2CAP_ENABLED
+/**@brief   Nordic UART Service @ref BLE_NUS_EVT_L2CAP_TX_DONE event data. */
+typedef struct
+{
+    uint8_t const * p_data; /**< Buffer given to @ref ble_nus_l2cap_send. */
+    uint32_t        length; /**< Number of bytes sent, less than the buffer length if the channel was released. */
+} ble_nus_evt_l2cap_tx_t;
+#endif
+
+
 /**@brief Nordic UART Service client context structure.
  *
  * @details This structure contains state context related to hosts.
@@ -155,7 +254,10 @@ typedef struct
     ble_nus_client_context_t * p_link_ctx;  /**< A pointer to the link context. */
     union
     {
-        ble_nus_evt_rx_data_t rx_data; /**< @ref BLE_NUS_EVT_RX_DATA event data. */
+        ble_nus_evt_rx_data_t  rx_data;  /**< @ref BLE_NUS_EVT_RX_DATA event data. */
+#if BLE_NUS_L2CAP_ENABLED
+        ble_nus_evt_l2cap_tx_t l2cap_tx; /**< @ref BLE_NUS_EVT_L2CAP_TX_DONE event data. */
+#endif
     } params;
 } ble_nus_evt_t;
 
@@ -173,6 +275,12 @@ typedef void (* ble_nus_data_handler_t) (ble_nus_evt_t * p_evt);
 typedef struct
 {
     ble_nus_data_handler_t data_handler; /**< Event handler to be called for handling received data. */
+#if BLE_NUS_STREAM_ENABLED
+    nrf_ringbuf_mirrored_t const * p_stream_buf; /**< Buffer of the streaming TX mode defined with @ref BLE_NUS_STREAM_BUF_DEF, or NULL if the mode is not used. */
+#endif
+#if BLE_NUS_RX_BUF_ENABLED
+    nrf_ringbuf_t const *  p_rx_buf;     /**< Buffer for received data defined with NRF_RINGBUF_DEF, or NULL to pass the data in @ref BLE_NUS_EVT_RX_DATA. */
+#endif
 } ble_nus_init_t;
 
 
@@ -188,6 +296,45 @@ struct ble_nus_s
     ble_gatts_char_handles_t        rx_handles;         /**< Handles related to the RX characteristic (as provided by the SoftDevice). */
     blcm_link_ctx_storage_t * const p_link_ctx_storage; /**< Pointer to link context storage with handles of all current connections and its context. */
     ble_nus_data_handler_t          data_handler;       /**< Event handler to be called for handling received data. */
+#if BLE_NUS_STREAM_ENABLED
+    nrf_ringbuf_mirrored_t const *  p_stream_buf;       /**< Buffer of the streaming TX mode. */
+    uint16_t                        stream_conn_handle; /**< Connection the stream is sent to, BLE_CONN_HANDLE_INVALID if the stream is stopped. */
+    uint16_t                        stream_max_len;     /**< Maximum length of one stream notification. */
+    volatile bool                   stream_pending;     /**< Set when the stream buffer must be looked at again by the context sending it. */
+    volatile bool                   stream_flush;       /**< Set when the data in the stream buffer is to be dropped. */
+    bool                            stream_paused;      /**< Set when notifications were disabled or could not be sent. */
+    bool                            stream_blocked;     /**< Set when @ref ble_nus_stream_write could not take all data. */
+#endif
+#if BLE_NUS_RX_BUF_ENABLED
+    nrf_ringbuf_t const *           p_rx_buf;           /**< Buffer for received data. */
+#endif
+#if BLE_NUS_RX_CREDITS_ENABLED
+    ble_gatts_char_handles_t        credits_handles;    /**< Handles related to the RX Credits characteristic (as provided by the SoftDevice). */
+    uint16_t                        credits_conn_handle; /**< Connection that enabled notifications of the RX Credits characteristic. */
+    uint32_t                        credits_limit;      /**< Number of bytes the peer may send since it enabled the notifications. */
+    bool                            credits_pending;    /**< Set when the credits could not be notified and must be sent again. */
+#endif
+#if BLE_NUS_LZ_ENABLED
+    ble_gatts_char_handles_t        lz_handles;         /**< Handles related to the Compression characteristic (as provided by the SoftDevice). */
+    uint16_t                        lz_conn_handle;     /**< Connection using compression, BLE_CONN_HANDLE_INVALID if none. */
+    nrf_lz_enc_t                    lz_enc;             /**< Encoder of the notifications sent to the peer. */
+    nrf_lz_dec_t                    lz_dec;             /**< Decoder of the data written by the peer. */
+#endif
+#if BLE_NUS_L2CAP_ENABLED
+    ble_gatts_char_handles_t        l2cap_handles;      /**< Handles related to the L2CAP PSM characteristic (as provided by the SoftDevice). */
+    uint16_t                        l2cap_conn_handle;  /**< Connection of the L2CAP channel, BLE_CONN_HANDLE_INVALID if there is none. */
+    uint16_t                        l2cap_cid;          /**< Local channel ID of the L2CAP channel. */
+    bool                            l2cap_connected;    /**< Set when the channel is set up, cleared while it is being set up. */
+    ble_l2cap_ch_tx_params_t        l2cap_tx_params;    /**< Transmit parameters of the channel. */
+    uint16_t                        l2cap_tx_credits;   /**< Credits granted by the peer and not used by the queued SDUs. */
+    uint8_t const *                 p_l2cap_tx_data;    /**< Buffer being sent, NULL if there is none. */
+    uint32_t                        l2cap_tx_len;       /**< Length of the buffer being sent. */
+    uint32_t                        l2cap_tx_queued;    /**< Number of bytes of the buffer handed to the SoftDevice. */
+    uint32_t                        l2cap_tx_sent;      /**< Number of bytes of the buffer sent. */
+    uint8_t                         l2cap_rx_posted;    /**< Number of receive buffers held by the SoftDevice. */
+    uint8_t                         l2cap_rx_next;      /**< Next receive buffer to post. */
+    uint8_t                         l2cap_rx_bufs[BLE_NUS_L2CAP_RX_QUEUE_SIZE][BLE_NUS_L2CAP_MTU]; /**< Receive buffers, posted to the SoftDevice in turn. */
+#endif
 };
 
 
@@ -222,6 +369,10 @@ void ble_nus_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
  * @details This function sends the input string as an RX characteristic notification to the
  *          peer.
  *
+ *          If the peer started compression, the string is sent in a packet of up to the larger of
+ *          @p p_length and 20 bytes, so @p p_length can be set to less than the string length
+ *          if it does not compress.
+ *
  * @param[in]     p_nus       Pointer to the Nordic UART Service structure.
  * @param[in]     p_data      String to be sent.
  * @param[in,out] p_length    Pointer Length of the string. Amount of sent bytes.
@@ -235,6 +386,133 @@ uint32_t ble_nus_data_send(ble_nus_t * p_nus,
                            uint16_t    conn_handle);
 
 
+#if BLE_NUS_STREAM_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief   Function for starting the streaming TX mode on a connection.
+ *
+ * @details Data in the stream buffer is sent in notifications of up to @p max_data_len bytes,
+ *          compressed if the peer started compression.
+ *          The SoftDevice queue is filled until it returns NRF_ERROR_RESOURCES and refilled on
+ *          every @ref BLE_GATTS_EVT_HVN_TX_COMPLETE event, so no application retry loop is
+ *          needed. Sending pauses when the peer disables notifications. Call this function again
+ *          to resume it. The stream is stopped and its data dropped on disconnection.
+ *
+ *          @ref BLE_NUS_EVT_STREAM_WRITABLE and @ref BLE_NUS_EVT_STREAM_EMPTY can be called from
+ *          the BLE event context and from the context calling @ref ble_nus_stream_write.
+ *
+ * @param[in] p_nus        Pointer to the Nordic UART Service structure.
+ * @param[in] conn_handle  Connection Handle of the destination client.
+ * @param[in] max_data_len Maximum length of one notification, typically the effective ATT MTU
+ *                         minus 3 as reported by nrf_ble_gatt.
+ *
+ * @retval NRF_SUCCESS             If the stream was started.
+ * @retval NRF_ERROR_NULL          If @p p_nus is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If @p max_data_len is 0 or exceeds @ref BLE_NUS_MAX_DATA_LEN.
+ * @retval NRF_ERROR_INVALID_STATE If no stream buffer was given to @ref ble_nus_init or
+ *                                 notifications are not enabled by the peer.
+ * @retval NRF_ERROR_NOT_FOUND     If @p conn_handle does not identify a connected client.
+ */
+uint32_t ble_nus_stream_start(ble_nus_t * p_nus, uint16_t conn_handle, uint16_t max_data_len);
+
+
+/**@brief   Function for writing data to the stream buffer.
+ *
+ * @details The data is copied to the buffer and sending is started if the stream is started.
+ *          Data can be written before @ref ble_nus_stream_start to be sent when the stream
+ *          starts. If the buffer cannot take all data, @p p_length is set to the number of bytes
+ *          taken and @ref BLE_NUS_EVT_STREAM_WRITABLE is sent once space has been freed.
+ *
+ * @param[in]     p_nus    Pointer to the Nordic UART Service structure.
+ * @param[in]     p_data   Data to be sent.
+ * @param[in,out] p_length Length of the data. Number of bytes taken.
+ *
+ * @retval NRF_SUCCESS             If the data was taken (possibly partially).
+ * @retval NRF_ERROR_NULL          If a pointer is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If no stream buffer was given to @ref ble_nus_init.
+ * @retval NRF_ERROR_BUSY          If the buffer is being written from another context.
+ */
+uint32_t ble_nus_stream_write(ble_nus_t * p_nus, uint8_t const * p_data, size_t * p_length);
+
+
+/**@brief   Function for stopping the streaming TX mode and dropping the buffered data.
+ *
+ * @details Notifications already handed to the SoftDevice are still sent.
+ *
+ * @param[in] p_nus Pointer to the Nordic UART Service structure.
+ *
+ * @retval NRF_SUCCESS             If the stream was stopped.
+ * @retval NRF_ERROR_NULL          If @p p_nus is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If no stream buffer was given to @ref ble_nus_init.
+ */
+uint32_t ble_nus_stream_stop(ble_nus_t * p_nus);
+#endif // BLE_NUS_STREAM_ENABLED
+
+
+#if BLE_NUS_RX_BUF_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief   Function for getting received data from the RX buffer.
+ *
+ * @details The data was written by the SoftDevice event handler straight into the buffer given
+ *          to @ref ble_nus_init, so it stays valid until it is released with
+ *          @ref ble_nus_rx_free. Only one context can read the buffer at a time.
+ *
+ * @param[in]     p_nus    Pointer to the Nordic UART Service structure.
+ * @param[out]    pp_data  Pointer to the data.
+ * @param[in,out] p_length Requested length. Length of the data got, which can be shorter at the
+ *                         wrap of the buffer (0 if the buffer is empty).
+ *
+ * @retval NRF_SUCCESS             If the data was got (possibly of 0 length).
+ * @retval NRF_ERROR_NULL          If a pointer is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If no RX buffer was given to @ref ble_nus_init.
+ * @retval NRF_ERROR_BUSY          If the buffer is being read from another context.
+ */
+uint32_t ble_nus_rx_get(ble_nus_t * p_nus, uint8_t ** pp_data, size_t * p_length);
+
+
+/**@brief   Function for releasing data got with @ref ble_nus_rx_get.
+ *
+ * @details If @c BLE_NUS_RX_CREDITS_ENABLED is set, the freed space is granted to the peer with a
+ *          notification of the RX Credits characteristic.
+ *
+ * @param[in] p_nus  Pointer to the Nordic UART Service structure.
+ * @param[in] length Number of bytes to release, at most the length got. Pass 0 to release
+ *                   the buffer without consuming data.
+ *
+ * @retval NRF_SUCCESS             If the data was released.
+ * @retval NRF_ERROR_NULL          If @p p_nus is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If no RX buffer was given to @ref ble_nus_init.
+ * @retval NRF_ERROR_NO_MEM        If @p length exceeds the data in the buffer.
+ */
+uint32_t ble_nus_rx_free(ble_nus_t * p_nus, size_t length);
+#endif // BLE_NUS_RX_BUF_ENABLED
+
+
+#if BLE_NUS_L2CAP_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief   Function for sending a buffer on the L2CAP channel.
+ *
+ * @details The buffer is split into SDUs of up to the MTU of the peer. SDUs are queued in the
+ *          SoftDevice while the peer has granted credits for them, so several are in flight at a
+ *          time, and more are queued on every @ref BLE_L2CAP_EVT_CH_TX and
+ *          @ref BLE_L2CAP_EVT_CH_CREDIT event. @ref BLE_NUS_EVT_L2CAP_TX_DONE is sent when the
+ *          whole buffer has been sent, or when the channel is released before.
+ *
+ *          If @c BLE_NUS_RX_BUF_ENABLED is set, receive buffers are only posted while the RX
+ *          buffer has room for the SDUs they can hold, so a peer that runs out of credits waits
+ *          for @ref ble_nus_rx_free instead of having its data dropped.
+ *
+ * @param[in] p_nus  Pointer to the Nordic UART Service structure.
+ * @param[in] p_data Buffer to be sent. It must stay valid until @ref BLE_NUS_EVT_L2CAP_TX_DONE
+ *                   is received.
+ * @param[in] length Length of the buffer.
+ *
+ * @retval NRF_SUCCESS             If sending was started.
+ * @retval NRF_ERROR_NULL          If a pointer is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If @p length is 0.
+ * @retval NRF_ERROR_INVALID_STATE If the L2CAP channel is not open.
+ * @retval NRF_ERROR_BUSY          If a buffer is already being sent.
+ */
+uint32_t ble_nus_l2cap_send(ble_nus_t * p_nus, uint8_t const * p_data, uint32_t length);
+#endif // BLE_NUS_L2CAP_ENABLED
+
+
 #ifdef __cplusplus
 }
 #endif
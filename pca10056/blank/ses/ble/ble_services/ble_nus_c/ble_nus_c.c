@@ -99,6 +99,18 @@ void ble_nus_c_on_db_disc_evt(ble_nus_c_t * p_ble_nus_c, ble_db_discovery_evt_t
                     nus_c_evt.handles.nus_tx_cccd_handle = p_chars[i].cccd_handle;
                     break;
 
+#if BLE_NUS_C_LZ_ENABLED
+                case BLE_UUID_NUS_LZ_CHARACTERISTIC:
+                    nus_c_evt.handles.nus_lz_handle = p_chars[i].characteristic.handle_value;
+                    break;
+#endif
+
+#if BLE_NUS_C_L2CAP_ENABLED
+                case BLE_UUID_NUS_L2CAP_PSM_CHARACTERISTIC:
+                    nus_c_evt.handles.nus_l2cap_psm_handle = p_chars[i].characteristic.handle_value;
+                    break;
+#endif
+
                 default:
                     break;
             }
@@ -112,6 +124,515 @@ void ble_nus_c_on_db_disc_evt(ble_nus_c_t * p_ble_nus_c, ble_db_discovery_evt_t
     }
 }
 
+#if BLE_NUS_C_LZ_ENABLED
+/**@brief Function for sending an event of the compression.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ * @param[in] evt_type    Event type.
+ */
+static void lz_evt_send(ble_nus_c_t * p_ble_nus_c, ble_nus_c_evt_type_t evt_type)
+{
+    ble_nus_c_evt_t ble_nus_c_evt;
+
+    if (p_ble_nus_c->evt_handler == NULL)
+    {
+        return;
+    }
+
+    memset(&ble_nus_c_evt, 0, sizeof(ble_nus_c_evt_t));
+    ble_nus_c_evt.evt_type    = evt_type;
+    ble_nus_c_evt.conn_handle = p_ble_nus_c->conn_handle;
+
+    p_ble_nus_c->evt_handler(p_ble_nus_c, &ble_nus_c_evt);
+}
+
+
+/**@brief Function for handling the data decoded from a notification of the server.
+ *
+ * @param[in] p_data    Decoded data.
+ * @param[in] length    Length of the data.
+ * @param[in] p_context Pointer to the NUS Client structure.
+ */
+static void lz_rx_data_handler(uint8_t const * p_data, size_t length, void * p_context)
+{
+    ble_nus_c_t   * p_ble_nus_c = (ble_nus_c_t *)p_context;
+    ble_nus_c_evt_t ble_nus_c_evt;
+
+    memset(&ble_nus_c_evt, 0, sizeof(ble_nus_c_evt_t));
+    ble_nus_c_evt.evt_type    = BLE_NUS_C_EVT_NUS_TX_EVT;
+    ble_nus_c_evt.conn_handle = p_ble_nus_c->conn_handle;
+    ble_nus_c_evt.p_data      = (uint8_t *)p_data;
+    ble_nus_c_evt.data_len    = (uint16_t)length;
+
+    p_ble_nus_c->evt_handler(p_ble_nus_c, &ble_nus_c_evt);
+}
+
+
+/**@brief Function for intercepting the errors of the requests on the Compression characteristic.
+ *
+ * @details The request is given up, so a start of the compression is reported as failed.
+ *
+ * @param[in] nrf_error   Error code.
+ * @param[in] p_ctx       Parameter from the event handler.
+ * @param[in] conn_handle Connection handle.
+ */
+static void lz_gatt_error_handler(uint32_t   nrf_error,
+                                  void     * p_ctx,
+                                  uint16_t   conn_handle)
+{
+    ble_nus_c_t * p_ble_nus_c = (ble_nus_c_t *)p_ctx;
+
+    p_ble_nus_c->lz_pending = false;
+    if (p_ble_nus_c->lz_format == 0)
+    {
+        lz_evt_send(p_ble_nus_c, BLE_NUS_C_EVT_LZ_STOPPED);
+    }
+
+    gatt_error_handler(nrf_error, p_ctx, conn_handle);
+}
+
+
+/**@brief Function for writing a format to the Compression characteristic of the server.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ * @param[in] format      Format to write, 0 to stop compression.
+ *
+ * @return The error code returned by @ref nrf_ble_gq_item_add.
+ */
+static uint32_t lz_format_write(ble_nus_c_t * p_ble_nus_c, uint8_t format)
+{
+    uint32_t         err_code;
+    nrf_ble_gq_req_t write_req;
+
+    memset(&write_req, 0, sizeof(nrf_ble_gq_req_t));
+
+    write_req.type                        = NRF_BLE_GQ_REQ_GATTC_WRITE;
+    write_req.error_handler.cb            = lz_gatt_error_handler;
+    write_req.error_handler.p_ctx         = p_ble_nus_c;
+    write_req.params.gattc_write.handle   = p_ble_nus_c->handles.nus_lz_handle;
+    write_req.params.gattc_write.len      = sizeof(format);
+    write_req.params.gattc_write.offset   = 0;
+    write_req.params.gattc_write.p_value  = &format;
+    write_req.params.gattc_write.write_op = BLE_GATT_OP_WRITE_REQ;
+    write_req.params.gattc_write.flags    = BLE_GATT_EXEC_WRITE_FLAG_PREPARED_WRITE;
+
+    err_code = nrf_ble_gq_item_add(p_ble_nus_c->p_gatt_queue, &write_req, p_ble_nus_c->conn_handle);
+    if (err_code == NRF_SUCCESS)
+    {
+        p_ble_nus_c->lz_req_format = format;
+        p_ble_nus_c->lz_pending    = true;
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for handling the read response of the Compression characteristic.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ * @param[in] p_ble_evt   Pointer to the BLE event received.
+ */
+static void on_lz_read_rsp(ble_nus_c_t * p_ble_nus_c, ble_evt_t const * p_ble_evt)
+{
+    uint32_t                         err_code;
+    ble_gattc_evt_read_rsp_t const * p_rsp  = &p_ble_evt->evt.gattc_evt.params.read_rsp;
+    uint8_t                          format = 0;
+
+    if (!p_ble_nus_c->lz_pending || (p_rsp->handle != p_ble_nus_c->handles.nus_lz_handle))
+    {
+        return;
+    }
+
+    p_ble_nus_c->lz_pending = false;
+
+    if ((p_ble_evt->evt.gattc_evt.gatt_status == BLE_GATT_STATUS_SUCCESS) &&
+        (p_rsp->len == sizeof(format)))
+    {
+        format = nrf_lz_format_negotiate(p_rsp->data[0]);
+    }
+
+    if (format == 0)
+    {
+        NRF_LOG_WARNING("Compression format of the server not supported.");
+        lz_evt_send(p_ble_nus_c, BLE_NUS_C_EVT_LZ_STOPPED);
+        return;
+    }
+
+    err_code = lz_format_write(p_ble_nus_c, format);
+    if (err_code != NRF_SUCCESS)
+    {
+        lz_evt_send(p_ble_nus_c, BLE_NUS_C_EVT_LZ_STOPPED);
+        gatt_error_handler(err_code, p_ble_nus_c, p_ble_nus_c->conn_handle);
+    }
+}
+
+
+/**@brief Function for handling the write response of the Compression characteristic.
+ *
+ * @details The server compresses its notifications from when it sent the response, and expects
+ *          compressed data from now on.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ * @param[in] p_ble_evt   Pointer to the BLE event received.
+ */
+static void on_lz_write_rsp(ble_nus_c_t * p_ble_nus_c, ble_evt_t const * p_ble_evt)
+{
+    uint8_t format = p_ble_nus_c->lz_req_format;
+
+    if (   !p_ble_nus_c->lz_pending
+        || (p_ble_evt->evt.gattc_evt.params.write_rsp.handle != p_ble_nus_c->handles.nus_lz_handle))
+    {
+        return;
+    }
+
+    p_ble_nus_c->lz_pending = false;
+
+    if (p_ble_evt->evt.gattc_evt.gatt_status != BLE_GATT_STATUS_SUCCESS)
+    {
+        NRF_LOG_WARNING("Compression write refused, GATT status 0x%x.",
+                        p_ble_evt->evt.gattc_evt.gatt_status);
+        if (format != 0)
+        {
+            lz_evt_send(p_ble_nus_c, BLE_NUS_C_EVT_LZ_STOPPED);
+        }
+        else
+        {
+            // The server still compresses.
+            gatt_error_handler(NRF_ERROR_INVALID_STATE, p_ble_nus_c, p_ble_nus_c->conn_handle);
+        }
+        return;
+    }
+
+    if (format != 0)
+    {
+        UNUSED_RETURN_VALUE(nrf_lz_enc_init(&p_ble_nus_c->lz_enc, format));
+        UNUSED_RETURN_VALUE(nrf_lz_dec_init(&p_ble_nus_c->lz_dec, format));
+    }
+
+    p_ble_nus_c->lz_format = format;
+    lz_evt_send(p_ble_nus_c, (format != 0) ? BLE_NUS_C_EVT_LZ_STARTED : BLE_NUS_C_EVT_LZ_STOPPED);
+}
+#endif // BLE_NUS_C_LZ_ENABLED
+
+#if BLE_NUS_C_L2CAP_ENABLED
+#define L2CAP_SDU_LEN_SIZE 2 /**< Size of the SDU length field carried in the first PDU of an SDU. */
+
+/**@brief Function for sending an event of the L2CAP channel.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ * @param[in] evt_type    Event type.
+ * @param[in] p_data      Buffer of a @ref BLE_NUS_C_EVT_L2CAP_TX_DONE event, otherwise NULL.
+ * @param[in] length      Number of bytes of the buffer sent.
+ */
+static void l2cap_evt_send(ble_nus_c_t          * p_ble_nus_c,
+                           ble_nus_c_evt_type_t   evt_type,
+                           uint8_t const        * p_data,
+                           uint32_t               length)
+{
+    ble_nus_c_evt_t ble_nus_c_evt;
+
+    if (p_ble_nus_c->evt_handler == NULL)
+    {
+        return;
+    }
+
+    memset(&ble_nus_c_evt, 0, sizeof(ble_nus_c_evt_t));
+    ble_nus_c_evt.evt_type    = evt_type;
+    ble_nus_c_evt.conn_handle = p_ble_nus_c->conn_handle;
+    ble_nus_c_evt.p_data      = (uint8_t *)p_data;
+    ble_nus_c_evt.l2cap_len   = length;
+
+    p_ble_nus_c->evt_handler(p_ble_nus_c, &ble_nus_c_evt);
+}
+
+
+/**@brief Function for keeping receive buffers posted on the L2CAP channel.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ */
+static void l2cap_rx_resume(ble_nus_c_t * p_ble_nus_c)
+{
+    uint32_t   err_code;
+    ble_data_t sdu_buf;
+
+    while (p_ble_nus_c->l2cap_rx_posted < BLE_NUS_C_L2CAP_RX_QUEUE_SIZE)
+    {
+        sdu_buf.p_data = p_ble_nus_c->l2cap_rx_bufs[p_ble_nus_c->l2cap_rx_next];
+        sdu_buf.len    = BLE_NUS_C_L2CAP_MTU;
+
+        err_code = sd_ble_l2cap_ch_rx(p_ble_nus_c->conn_handle, p_ble_nus_c->l2cap_cid, &sdu_buf);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            return; // The SoftDevice receive queue is full, the buffer will be posted again on the next BLE_L2CAP_EVT_CH_RX event.
+        }
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_WARNING("L2CAP receive buffer could not be posted, error 0x%x.", err_code);
+            return;
+        }
+
+        p_ble_nus_c->l2cap_rx_next = (p_ble_nus_c->l2cap_rx_next + 1) % BLE_NUS_C_L2CAP_RX_QUEUE_SIZE;
+        p_ble_nus_c->l2cap_rx_posted++;
+    }
+}
+
+
+/**@brief Function for ending the transfer of the buffer given to @ref ble_nus_c_l2cap_send.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ */
+static void l2cap_tx_complete(ble_nus_c_t * p_ble_nus_c)
+{
+    uint8_t const * p_data = p_ble_nus_c->p_l2cap_tx_data;
+
+    // Cleared first, so that the next buffer can be sent from the event handler.
+    p_ble_nus_c->p_l2cap_tx_data = NULL;
+
+    l2cap_evt_send(p_ble_nus_c, BLE_NUS_C_EVT_L2CAP_TX_DONE, p_data, p_ble_nus_c->l2cap_tx_sent);
+}
+
+
+/**@brief Function for queuing the next SDUs of the buffer being sent.
+ *
+ * @details SDUs are queued while the server has granted the credits they need. An SDU is always
+ *          queued when nothing is in flight, the SoftDevice then holds it until the credits
+ *          arrive. If the SoftDevice refuses an SDU, the transfer ends after the SDUs already
+ *          queued.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ */
+static void l2cap_tx_resume(ble_nus_c_t * p_ble_nus_c)
+{
+    uint32_t   err_code;
+    ble_data_t sdu;
+    uint32_t   tx_mps = MAX(p_ble_nus_c->l2cap_tx_params.tx_mps, BLE_L2CAP_MPS_MIN);
+    uint16_t   credits;
+
+    while (p_ble_nus_c->l2cap_tx_queued < p_ble_nus_c->l2cap_tx_len)
+    {
+        sdu.len = (uint16_t)MIN(p_ble_nus_c->l2cap_tx_len - p_ble_nus_c->l2cap_tx_queued,
+                                p_ble_nus_c->l2cap_tx_params.tx_mtu);
+        credits = (uint16_t)((sdu.len + L2CAP_SDU_LEN_SIZE + tx_mps - 1) / tx_mps);
+
+        if (   (credits > p_ble_nus_c->l2cap_tx_credits)
+            && (p_ble_nus_c->l2cap_tx_queued != p_ble_nus_c->l2cap_tx_sent))
+        {
+            return; // Resumed on the next BLE_L2CAP_EVT_CH_TX or BLE_L2CAP_EVT_CH_CREDIT event.
+        }
+
+        sdu.p_data = (uint8_t *)&p_ble_nus_c->p_l2cap_tx_data[p_ble_nus_c->l2cap_tx_queued];
+
+        err_code = sd_ble_l2cap_ch_tx(p_ble_nus_c->conn_handle, p_ble_nus_c->l2cap_cid, &sdu);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            return; // The SoftDevice queue is full, resumed on the next BLE_L2CAP_EVT_CH_TX event.
+        }
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_WARNING("L2CAP send stopped, error 0x%x.", err_code);
+
+            p_ble_nus_c->l2cap_tx_len = p_ble_nus_c->l2cap_tx_queued;
+            if (p_ble_nus_c->l2cap_tx_sent == p_ble_nus_c->l2cap_tx_queued)
+            {
+                l2cap_tx_complete(p_ble_nus_c);
+            }
+            return;
+        }
+
+        p_ble_nus_c->l2cap_tx_queued  += sdu.len;
+        p_ble_nus_c->l2cap_tx_credits -= MIN(credits, p_ble_nus_c->l2cap_tx_credits);
+    }
+}
+
+
+/**@brief Function for forgetting the L2CAP channel.
+ *
+ * @details A transfer in progress is ended first, then @ref BLE_NUS_C_EVT_L2CAP_DISCONNECTED is
+ *          sent if the channel was open or being opened.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ */
+static void l2cap_released(ble_nus_c_t * p_ble_nus_c)
+{
+    bool notify = p_ble_nus_c->l2cap_connected || p_ble_nus_c->l2cap_pending;
+
+    p_ble_nus_c->l2cap_cid        = BLE_L2CAP_CID_INVALID;
+    p_ble_nus_c->l2cap_connected  = false;
+    p_ble_nus_c->l2cap_pending    = false;
+    p_ble_nus_c->l2cap_rx_posted  = 0;
+    p_ble_nus_c->l2cap_rx_next    = 0;
+    p_ble_nus_c->l2cap_tx_credits = 0;
+
+    if (p_ble_nus_c->p_l2cap_tx_data != NULL)
+    {
+        l2cap_tx_complete(p_ble_nus_c);
+    }
+
+    if (notify)
+    {
+        l2cap_evt_send(p_ble_nus_c, BLE_NUS_C_EVT_L2CAP_DISCONNECTED, NULL, 0);
+    }
+}
+
+
+/**@brief Function for intercepting the errors of the read of the L2CAP PSM characteristic.
+ *
+ * @param[in] nrf_error   Error code.
+ * @param[in] p_ctx       Parameter from the event handler.
+ * @param[in] conn_handle Connection handle.
+ */
+static void l2cap_gatt_error_handler(uint32_t   nrf_error,
+                                     void     * p_ctx,
+                                     uint16_t   conn_handle)
+{
+    ble_nus_c_t * p_ble_nus_c = (ble_nus_c_t *)p_ctx;
+
+    l2cap_released(p_ble_nus_c);
+    gatt_error_handler(nrf_error, p_ctx, conn_handle);
+}
+
+
+/**@brief Function for handling the read response of the L2CAP PSM characteristic.
+ *
+ * @details The channel is set up on the PSM read, with the SoftDevice as initiator.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ * @param[in] p_ble_evt   Pointer to the BLE event received.
+ */
+static void on_l2cap_psm_read_rsp(ble_nus_c_t * p_ble_nus_c, ble_evt_t const * p_ble_evt)
+{
+    uint32_t                         err_code;
+    ble_gattc_evt_read_rsp_t const * p_rsp = &p_ble_evt->evt.gattc_evt.params.read_rsp;
+    ble_l2cap_ch_setup_params_t      setup_params;
+    uint16_t                         local_cid = BLE_L2CAP_CID_INVALID;
+
+    if (   !p_ble_nus_c->l2cap_pending
+        || (p_ble_nus_c->l2cap_cid != BLE_L2CAP_CID_INVALID)
+        || (p_rsp->handle != p_ble_nus_c->handles.nus_l2cap_psm_handle))
+    {
+        return;
+    }
+
+    if ((p_ble_evt->evt.gattc_evt.gatt_status != BLE_GATT_STATUS_SUCCESS) ||
+        (p_rsp->len != sizeof(uint16_t)))
+    {
+        NRF_LOG_WARNING("L2CAP PSM of the server could not be read.");
+        l2cap_released(p_ble_nus_c);
+        return;
+    }
+
+    memset(&setup_params, 0, sizeof(setup_params));
+    setup_params.le_psm           = uint16_decode(p_rsp->data);
+    setup_params.rx_params.rx_mtu = BLE_NUS_C_L2CAP_MTU;
+    setup_params.rx_params.rx_mps = BLE_NUS_C_L2CAP_MPS;
+
+    err_code = sd_ble_l2cap_ch_setup(p_ble_nus_c->conn_handle, &local_cid, &setup_params);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_WARNING("L2CAP channel setup failed, error 0x%x.", err_code);
+        l2cap_released(p_ble_nus_c);
+        gatt_error_handler(err_code, p_ble_nus_c, p_ble_nus_c->conn_handle);
+        return;
+    }
+
+    p_ble_nus_c->l2cap_cid = local_cid;
+}
+
+
+/**@brief Function for handling the L2CAP events of the channel.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ * @param[in] p_ble_evt   Pointer to the BLE event received.
+ */
+static void on_l2cap_evt(ble_nus_c_t * p_ble_nus_c, ble_evt_t const * p_ble_evt)
+{
+    ble_l2cap_evt_t const * p_l2cap_evt = &p_ble_evt->evt.l2cap_evt;
+
+    if (   (p_ble_nus_c->l2cap_cid == BLE_L2CAP_CID_INVALID)
+        || (p_l2cap_evt->local_cid != p_ble_nus_c->l2cap_cid))
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_L2CAP_EVT_CH_SETUP:
+            p_ble_nus_c->l2cap_tx_params  = p_l2cap_evt->params.ch_setup.tx_params;
+            p_ble_nus_c->l2cap_tx_credits = p_ble_nus_c->l2cap_tx_params.credits;
+            p_ble_nus_c->l2cap_pending    = false;
+            p_ble_nus_c->l2cap_connected  = true;
+
+            l2cap_rx_resume(p_ble_nus_c);
+            l2cap_evt_send(p_ble_nus_c, BLE_NUS_C_EVT_L2CAP_CONNECTED, NULL, 0);
+            break;
+
+        case BLE_L2CAP_EVT_CH_SETUP_REFUSED:
+            NRF_LOG_WARNING("L2CAP channel refused, status 0x%x.",
+                            p_l2cap_evt->params.ch_setup_refused.status);
+            l2cap_released(p_ble_nus_c);
+            break;
+
+        case BLE_L2CAP_EVT_CH_RELEASED:
+            l2cap_released(p_ble_nus_c);
+            break;
+
+        case BLE_L2CAP_EVT_CH_RX:
+            if (p_ble_nus_c->l2cap_rx_posted > 0)
+            {
+                p_ble_nus_c->l2cap_rx_posted--;
+            }
+
+            if (p_ble_nus_c->evt_handler != NULL)
+            {
+                ble_nus_c_evt_t ble_nus_c_evt;
+
+                memset(&ble_nus_c_evt, 0, sizeof(ble_nus_c_evt_t));
+                ble_nus_c_evt.evt_type    = BLE_NUS_C_EVT_NUS_TX_EVT;
+                ble_nus_c_evt.conn_handle = p_ble_nus_c->conn_handle;
+                ble_nus_c_evt.p_data      = p_l2cap_evt->params.rx.sdu_buf.p_data;
+                ble_nus_c_evt.data_len    = MIN(p_l2cap_evt->params.rx.sdu_len,
+                                                p_l2cap_evt->params.rx.sdu_buf.len);
+
+                p_ble_nus_c->evt_handler(p_ble_nus_c, &ble_nus_c_evt);
+            }
+
+            if (p_ble_nus_c->l2cap_connected)
+            {
+                l2cap_rx_resume(p_ble_nus_c);
+            }
+            break;
+
+        case BLE_L2CAP_EVT_CH_TX:
+            if (p_ble_nus_c->p_l2cap_tx_data == NULL)
+            {
+                break;
+            }
+
+            p_ble_nus_c->l2cap_tx_sent += p_l2cap_evt->params.tx.sdu_buf.len;
+            if (p_ble_nus_c->l2cap_tx_sent >= p_ble_nus_c->l2cap_tx_len)
+            {
+                l2cap_tx_complete(p_ble_nus_c);
+            }
+            else
+            {
+                l2cap_tx_resume(p_ble_nus_c);
+            }
+            break;
+
+        case BLE_L2CAP_EVT_CH_CREDIT:
+            p_ble_nus_c->l2cap_tx_credits += p_l2cap_evt->params.credit.credits;
+            if (p_ble_nus_c->p_l2cap_tx_data != NULL)
+            {
+                l2cap_tx_resume(p_ble_nus_c);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+#endif // BLE_NUS_C_L2CAP_ENABLED
+
 /**@brief     Function for handling Handle Value Notification received from the SoftDevice.
  *
  * @details   This function uses the Handle Value Notification received from the SoftDevice
@@ -130,15 +651,131 @@ static void on_hvx(ble_nus_c_t * p_ble_nus_c, ble_evt_t const * p_ble_evt)
     {
         ble_nus_c_evt_t ble_nus_c_evt;
 
-        ble_nus_c_evt.evt_type = BLE_NUS_C_EVT_NUS_TX_EVT;
-        ble_nus_c_evt.p_data   = (uint8_t *)p_ble_evt->evt.gattc_evt.params.hvx.data;
-        ble_nus_c_evt.data_len = p_ble_evt->evt.gattc_evt.params.hvx.len;
+#if BLE_NUS_C_LZ_ENABLED
+        if (p_ble_nus_c->lz_format != 0)
+        {
+            uint32_t err_code = nrf_lz_decode(&p_ble_nus_c->lz_dec,
+                                              p_ble_evt->evt.gattc_evt.params.hvx.data,
+                                              p_ble_evt->evt.gattc_evt.params.hvx.len,
+                                              lz_rx_data_handler,
+                                              p_ble_nus_c,
+                                              NULL);
+            if (err_code != NRF_SUCCESS)
+            {
+                NRF_LOG_WARNING("Invalid packet from the server, compression stopped.");
+                p_ble_nus_c->lz_format = 0;
+                lz_evt_send(p_ble_nus_c, BLE_NUS_C_EVT_LZ_STOPPED);
+            }
+            return;
+        }
+#endif
+
+        memset(&ble_nus_c_evt, 0, sizeof(ble_nus_c_evt));
+        ble_nus_c_evt.evt_type    = BLE_NUS_C_EVT_NUS_TX_EVT;
+        ble_nus_c_evt.conn_handle = p_ble_nus_c->conn_handle;
+        ble_nus_c_evt.p_data      = (uint8_t *)p_ble_evt->evt.gattc_evt.params.hvx.data;
+        ble_nus_c_evt.data_len    = p_ble_evt->evt.gattc_evt.params.hvx.len;
+        ble_nus_c_evt.p_ble_evt   = p_ble_evt;
 
         p_ble_nus_c->evt_handler(p_ble_nus_c, &ble_nus_c_evt);
         NRF_LOG_DEBUG("Client sending data.");
     }
 }
 
+#if BLE_NUS_C_STREAM_ENABLED
+/**@brief Function for ending the stream and reporting it to the application.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ * @param[in] result      NRF_SUCCESS or the error that stopped the stream.
+ */
+static void stream_complete(ble_nus_c_t * p_ble_nus_c, uint32_t result)
+{
+    ble_nus_c_evt_t ble_nus_c_evt;
+
+    memset(&ble_nus_c_evt, 0, sizeof(ble_nus_c_evt_t));
+    ble_nus_c_evt.evt_type      = BLE_NUS_C_EVT_STREAM_COMPLETE;
+    ble_nus_c_evt.conn_handle   = p_ble_nus_c->conn_handle;
+    ble_nus_c_evt.p_data        = (uint8_t *)p_ble_nus_c->p_stream_data;
+    ble_nus_c_evt.stream_len    = p_ble_nus_c->stream_offset;
+    ble_nus_c_evt.stream_result = result;
+
+    p_ble_nus_c->p_stream_data = NULL;
+
+    if (p_ble_nus_c->evt_handler != NULL)
+    {
+        p_ble_nus_c->evt_handler(p_ble_nus_c, &ble_nus_c_evt);
+    }
+}
+
+
+/**@brief Function for handing the stream to the SoftDevice until its queue is full.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS Client structure.
+ */
+static void stream_process(ble_nus_c_t * p_ble_nus_c)
+{
+    uint32_t                 err_code;
+    ble_gattc_write_params_t write_params;
+    size_t                   taken;
+#if BLE_NUS_C_LZ_ENABLED
+    uint8_t                  packet[BLE_NUS_MAX_DATA_LEN];
+#endif
+
+    memset(&write_params, 0, sizeof(write_params));
+    write_params.write_op = BLE_GATT_OP_WRITE_CMD;
+    write_params.flags    = BLE_GATT_EXEC_WRITE_FLAG_PREPARED_WRITE;
+    write_params.handle   = p_ble_nus_c->handles.nus_rx_handle;
+    write_params.offset   = 0;
+
+    while (p_ble_nus_c->stream_offset < p_ble_nus_c->stream_len)
+    {
+        size_t remaining = p_ble_nus_c->stream_len - p_ble_nus_c->stream_offset;
+
+        write_params.p_value = &p_ble_nus_c->p_stream_data[p_ble_nus_c->stream_offset];
+        write_params.len     = (uint16_t)MIN(remaining, p_ble_nus_c->stream_max_len);
+        taken                = write_params.len;
+#if BLE_NUS_C_LZ_ENABLED
+        if (p_ble_nus_c->lz_format != 0)
+        {
+            write_params.len     = (uint16_t)nrf_lz_encode(&p_ble_nus_c->lz_enc,
+                                                           write_params.p_value,
+                                                           remaining,
+                                                           packet,
+                                                           MAX(p_ble_nus_c->stream_max_len,
+                                                               NRF_LZ_PACKET_LEN_MIN),
+                                                           &taken);
+            write_params.p_value = packet;
+        }
+#endif
+
+        err_code = sd_ble_gattc_write(p_ble_nus_c->conn_handle, &write_params);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            return;
+        }
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_WARNING("Stream stopped, error 0x%x.", err_code);
+            stream_complete(p_ble_nus_c, err_code);
+            return;
+        }
+
+#if BLE_NUS_C_LZ_ENABLED
+        if (p_ble_nus_c->lz_format != 0)
+        {
+            nrf_lz_enc_commit(&p_ble_nus_c->lz_enc,
+                              &p_ble_nus_c->p_stream_data[p_ble_nus_c->stream_offset],
+                              taken);
+        }
+#endif
+        p_ble_nus_c->stream_offset += taken;
+    }
+
+    stream_complete(p_ble_nus_c, NRF_SUCCESS);
+}
+#endif // BLE_NUS_C_STREAM_ENABLED
+
+
 uint32_t ble_nus_c_init(ble_nus_c_t * p_ble_nus_c, ble_nus_c_init_t * p_ble_nus_c_init)
 {
     uint32_t      err_code;
@@ -161,6 +798,21 @@ uint32_t ble_nus_c_init(ble_nus_c_t * p_ble_nus_c, ble_nus_c_init_t * p_ble_nus_
     p_ble_nus_c->handles.nus_tx_handle = BLE_GATT_HANDLE_INVALID;
     p_ble_nus_c->handles.nus_rx_handle = BLE_GATT_HANDLE_INVALID;
     p_ble_nus_c->p_gatt_queue          = p_ble_nus_c_init->p_gatt_queue;
+#if BLE_NUS_C_STREAM_ENABLED
+    p_ble_nus_c->p_stream_data         = NULL;
+#endif
+#if BLE_NUS_C_LZ_ENABLED
+    p_ble_nus_c->handles.nus_lz_handle = BLE_GATT_HANDLE_INVALID;
+    p_ble_nus_c->lz_format             = 0;
+    p_ble_nus_c->lz_pending            = false;
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+    p_ble_nus_c->handles.nus_l2cap_psm_handle = BLE_GATT_HANDLE_INVALID;
+    p_ble_nus_c->l2cap_cid                    = BLE_L2CAP_CID_INVALID;
+    p_ble_nus_c->l2cap_pending                = false;
+    p_ble_nus_c->l2cap_connected              = false;
+    p_ble_nus_c->p_l2cap_tx_data              = NULL;
+#endif
 
     return ble_db_discovery_evt_register(&uart_uuid);
 }
@@ -187,7 +839,57 @@ void ble_nus_c_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
             on_hvx(p_ble_nus_c, p_ble_evt);
             break;
 
+#if BLE_NUS_C_LZ_ENABLED || BLE_NUS_C_L2CAP_ENABLED
+        case BLE_GATTC_EVT_READ_RSP:
+#if BLE_NUS_C_LZ_ENABLED
+            on_lz_read_rsp(p_ble_nus_c, p_ble_evt);
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+            on_l2cap_psm_read_rsp(p_ble_nus_c, p_ble_evt);
+#endif
+            break;
+#endif
+
+#if BLE_NUS_C_L2CAP_ENABLED
+        case BLE_L2CAP_EVT_CH_SETUP:
+        case BLE_L2CAP_EVT_CH_SETUP_REFUSED:
+        case BLE_L2CAP_EVT_CH_RELEASED:
+        case BLE_L2CAP_EVT_CH_RX:
+        case BLE_L2CAP_EVT_CH_TX:
+        case BLE_L2CAP_EVT_CH_CREDIT:
+            on_l2cap_evt(p_ble_nus_c, p_ble_evt);
+            break;
+#endif
+
+#if BLE_NUS_C_LZ_ENABLED
+        case BLE_GATTC_EVT_WRITE_RSP:
+            on_lz_write_rsp(p_ble_nus_c, p_ble_evt);
+            break;
+#endif
+
+#if BLE_NUS_C_STREAM_ENABLED
+        case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+            if (p_ble_nus_c->p_stream_data != NULL)
+            {
+                stream_process(p_ble_nus_c);
+            }
+            break;
+#endif
+
         case BLE_GAP_EVT_DISCONNECTED:
+#if BLE_NUS_C_STREAM_ENABLED
+            if (p_ble_nus_c->p_stream_data != NULL)
+            {
+                stream_complete(p_ble_nus_c, NRF_ERROR_INVALID_STATE);
+            }
+#endif
+#if BLE_NUS_C_LZ_ENABLED
+            p_ble_nus_c->lz_format  = 0;
+            p_ble_nus_c->lz_pending = false;
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+            l2cap_released(p_ble_nus_c);
+#endif
             if (p_ble_evt->evt.gap_evt.conn_handle == p_ble_nus_c->conn_handle
                     && p_ble_nus_c->evt_handler != NULL)
             {
@@ -246,6 +948,62 @@ uint32_t ble_nus_c_tx_notif_enable(ble_nus_c_t * p_ble_nus_c)
 }
 
 
+#if BLE_NUS_C_LZ_ENABLED
+/**@brief Function for sending a string to a server that accepted compression.
+ *
+ * @details Each packet can take up to the larger of the string length and the payload of the
+ *          default ATT MTU, so it fits the MTU of the link if the string does.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS client structure.
+ * @param[in] p_string    String to be sent.
+ * @param[in] length      Length of the string.
+ *
+ * @return The error code returned by @ref nrf_ble_gq_item_add.
+ */
+static uint32_t lz_string_send(ble_nus_c_t * p_ble_nus_c, uint8_t const * p_string, uint16_t length)
+{
+    uint32_t         err_code;
+    nrf_ble_gq_req_t write_req;
+    uint8_t          packet[BLE_NUS_MAX_DATA_LEN];
+    size_t           offset = 0;
+    size_t           taken;
+
+    memset(&write_req, 0, sizeof(nrf_ble_gq_req_t));
+
+    write_req.type                        = NRF_BLE_GQ_REQ_GATTC_WRITE;
+    write_req.error_handler.cb            = gatt_error_handler;
+    write_req.error_handler.p_ctx         = p_ble_nus_c;
+    write_req.params.gattc_write.handle   = p_ble_nus_c->handles.nus_rx_handle;
+    write_req.params.gattc_write.offset   = 0;
+    write_req.params.gattc_write.p_value  = packet;
+    write_req.params.gattc_write.write_op = BLE_GATT_OP_WRITE_CMD;
+    write_req.params.gattc_write.flags    = BLE_GATT_EXEC_WRITE_FLAG_PREPARED_WRITE;
+
+    do
+    {
+        write_req.params.gattc_write.len =
+            (uint16_t)nrf_lz_encode(&p_ble_nus_c->lz_enc,
+                                    &p_string[offset],
+                                    length - offset,
+                                    packet,
+                                    MAX(length, BLE_GATT_ATT_MTU_DEFAULT - OPCODE_LENGTH - HANDLE_LENGTH),
+                                    &taken);
+
+        // The GATT Queue copies the packet, so it is sent in any case.
+        err_code = nrf_ble_gq_item_add(p_ble_nus_c->p_gatt_queue,
+                                       &write_req,
+                                       p_ble_nus_c->conn_handle);
+        VERIFY_SUCCESS(err_code);
+
+        nrf_lz_enc_commit(&p_ble_nus_c->lz_enc, &p_string[offset], taken);
+        offset += taken;
+    } while (offset < length);
+
+    return NRF_SUCCESS;
+}
+#endif // BLE_NUS_C_LZ_ENABLED
+
+
 uint32_t ble_nus_c_string_send(ble_nus_c_t * p_ble_nus_c, uint8_t * p_string, uint16_t length)
 {
     VERIFY_PARAM_NOT_NULL(p_ble_nus_c);
@@ -264,6 +1022,16 @@ uint32_t ble_nus_c_string_send(ble_nus_c_t * p_ble_nus_c, uint8_t * p_string, ui
         NRF_LOG_WARNING("Connection handle invalid.");
         return NRF_ERROR_INVALID_STATE;
     }
+#if BLE_NUS_C_LZ_ENABLED
+    if (p_ble_nus_c->lz_pending)
+    {
+        return NRF_ERROR_BUSY;
+    }
+    if (p_ble_nus_c->lz_format != 0)
+    {
+        return lz_string_send(p_ble_nus_c, p_string, length);
+    }
+#endif
 
     write_req.type                        = NRF_BLE_GQ_REQ_GATTC_WRITE;
     write_req.error_handler.cb            = gatt_error_handler;
@@ -279,6 +1047,193 @@ uint32_t ble_nus_c_string_send(ble_nus_c_t * p_ble_nus_c, uint8_t * p_string, ui
 }
 
 
+#if BLE_NUS_C_STREAM_ENABLED
+uint32_t ble_nus_c_stream_send(ble_nus_c_t   * p_ble_nus_c,
+                               uint8_t const * p_data,
+                               size_t          length,
+                               uint16_t        max_data_len)
+{
+    VERIFY_PARAM_NOT_NULL(p_ble_nus_c);
+    VERIFY_PARAM_NOT_NULL(p_data);
+
+    if ((length == 0) || (max_data_len == 0) || (max_data_len > BLE_NUS_MAX_DATA_LEN))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    if (p_ble_nus_c->conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        NRF_LOG_WARNING("Connection handle invalid.");
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (p_ble_nus_c->p_stream_data != NULL)
+    {
+        return NRF_ERROR_BUSY;
+    }
+#if BLE_NUS_C_LZ_ENABLED
+    if (p_ble_nus_c->lz_pending)
+    {
+        return NRF_ERROR_BUSY;
+    }
+#endif
+
+    p_ble_nus_c->p_stream_data  = p_data;
+    p_ble_nus_c->stream_len     = length;
+    p_ble_nus_c->stream_offset  = 0;
+    p_ble_nus_c->stream_max_len = max_data_len;
+
+    stream_process(p_ble_nus_c);
+
+    return NRF_SUCCESS;
+}
+#endif // BLE_NUS_C_STREAM_ENABLED
+
+
+#if BLE_NUS_C_LZ_ENABLED
+uint32_t ble_nus_c_lz_start(ble_nus_c_t * p_ble_nus_c)
+{
+    uint32_t         err_code;
+    nrf_ble_gq_req_t read_req;
+
+    VERIFY_PARAM_NOT_NULL(p_ble_nus_c);
+
+    if (   (p_ble_nus_c->conn_handle == BLE_CONN_HANDLE_INVALID)
+        || (p_ble_nus_c->handles.nus_lz_handle == BLE_GATT_HANDLE_INVALID))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+#if BLE_NUS_C_STREAM_ENABLED
+    if (p_ble_nus_c->p_stream_data != NULL)
+    {
+        return NRF_ERROR_BUSY;
+    }
+#endif
+    if (p_ble_nus_c->lz_pending)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    memset(&read_req, 0, sizeof(nrf_ble_gq_req_t));
+
+    read_req.type                     = NRF_BLE_GQ_REQ_GATTC_READ;
+    read_req.error_handler.cb         = lz_gatt_error_handler;
+    read_req.error_handler.p_ctx      = p_ble_nus_c;
+    read_req.params.gattc_read.handle = p_ble_nus_c->handles.nus_lz_handle;
+    read_req.params.gattc_read.offset = 0;
+
+    err_code = nrf_ble_gq_item_add(p_ble_nus_c->p_gatt_queue, &read_req, p_ble_nus_c->conn_handle);
+    if (err_code == NRF_SUCCESS)
+    {
+        p_ble_nus_c->lz_pending = true;
+    }
+
+    return err_code;
+}
+
+
+uint32_t ble_nus_c_lz_stop(ble_nus_c_t * p_ble_nus_c)
+{
+    VERIFY_PARAM_NOT_NULL(p_ble_nus_c);
+
+    if ((p_ble_nus_c->conn_handle == BLE_CONN_HANDLE_INVALID) || (p_ble_nus_c->lz_format == 0))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+#if BLE_NUS_C_STREAM_ENABLED
+    if (p_ble_nus_c->p_stream_data != NULL)
+    {
+        return NRF_ERROR_BUSY;
+    }
+#endif
+    if (p_ble_nus_c->lz_pending)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    return lz_format_write(p_ble_nus_c, 0);
+}
+#endif // BLE_NUS_C_LZ_ENABLED
+
+
+#if BLE_NUS_C_L2CAP_ENABLED
+uint32_t ble_nus_c_l2cap_open(ble_nus_c_t * p_ble_nus_c)
+{
+    uint32_t         err_code;
+    nrf_ble_gq_req_t read_req;
+
+    VERIFY_PARAM_NOT_NULL(p_ble_nus_c);
+
+    if (   (p_ble_nus_c->conn_handle == BLE_CONN_HANDLE_INVALID)
+        || (p_ble_nus_c->handles.nus_l2cap_psm_handle == BLE_GATT_HANDLE_INVALID)
+        || p_ble_nus_c->l2cap_connected)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (p_ble_nus_c->l2cap_pending)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    memset(&read_req, 0, sizeof(nrf_ble_gq_req_t));
+
+    read_req.type                     = NRF_BLE_GQ_REQ_GATTC_READ;
+    read_req.error_handler.cb         = l2cap_gatt_error_handler;
+    read_req.error_handler.p_ctx      = p_ble_nus_c;
+    read_req.params.gattc_read.handle = p_ble_nus_c->handles.nus_l2cap_psm_handle;
+    read_req.params.gattc_read.offset = 0;
+
+    err_code = nrf_ble_gq_item_add(p_ble_nus_c->p_gatt_queue, &read_req, p_ble_nus_c->conn_handle);
+    if (err_code == NRF_SUCCESS)
+    {
+        p_ble_nus_c->l2cap_pending = true;
+    }
+
+    return err_code;
+}
+
+
+uint32_t ble_nus_c_l2cap_send(ble_nus_c_t * p_ble_nus_c, uint8_t const * p_data, uint32_t length)
+{
+    VERIFY_PARAM_NOT_NULL(p_ble_nus_c);
+    VERIFY_PARAM_NOT_NULL(p_data);
+
+    if (length == 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    if (!p_ble_nus_c->l2cap_connected)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (p_ble_nus_c->p_l2cap_tx_data != NULL)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    p_ble_nus_c->p_l2cap_tx_data = p_data;
+    p_ble_nus_c->l2cap_tx_len    = length;
+    p_ble_nus_c->l2cap_tx_queued = 0;
+    p_ble_nus_c->l2cap_tx_sent   = 0;
+
+    l2cap_tx_resume(p_ble_nus_c);
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t ble_nus_c_l2cap_close(ble_nus_c_t * p_ble_nus_c)
+{
+    VERIFY_PARAM_NOT_NULL(p_ble_nus_c);
+
+    if (!p_ble_nus_c->l2cap_connected)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    return sd_ble_l2cap_ch_release(p_ble_nus_c->conn_handle, p_ble_nus_c->l2cap_cid);
+}
+#endif // BLE_NUS_C_L2CAP_ENABLED
+
+
 uint32_t ble_nus_c_handles_assign(ble_nus_c_t               * p_ble_nus,
                                   uint16_t                    conn_handle,
                                   ble_nus_c_handles_t const * p_peer_handles)
@@ -291,7 +1246,23 @@ uint32_t ble_nus_c_handles_assign(ble_nus_c_t               * p_ble_nus,
         p_ble_nus->handles.nus_tx_cccd_handle = p_peer_handles->nus_tx_cccd_handle;
         p_ble_nus->handles.nus_tx_handle      = p_peer_handles->nus_tx_handle;
         p_ble_nus->handles.nus_rx_handle      = p_peer_handles->nus_rx_handle;
+#if BLE_NUS_C_LZ_ENABLED
+        p_ble_nus->handles.nus_lz_handle      = p_peer_handles->nus_lz_handle;
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+        p_ble_nus->handles.nus_l2cap_psm_handle = p_peer_handles->nus_l2cap_psm_handle;
+#endif
     }
+#if BLE_NUS_C_LZ_ENABLED
+    p_ble_nus->lz_format  = 0;
+    p_ble_nus->lz_pending = false;
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+    p_ble_nus->l2cap_cid       = BLE_L2CAP_CID_INVALID;
+    p_ble_nus->l2cap_pending   = false;
+    p_ble_nus->l2cap_connected = false;
+    p_ble_nus->p_l2cap_tx_data = NULL;
+#endif
     return nrf_ble_gq_conn_handle_register(p_ble_nus->p_gatt_queue, conn_handle);
 }
 #endif // NRF_MODULE_ENABLED(BLE_NUS_C)
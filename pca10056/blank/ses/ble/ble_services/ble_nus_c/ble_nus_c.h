@@ -72,6 +72,16 @@
 #include "nrf_sdh_ble.h"
 
 #include "sdk_config.h"
+#if BLE_NUS_C_LZ_ENABLED
+#include "nrf_lz.h"
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+#include "ble_l2cap.h"
+#endif
+
+#if BLE_NUS_C_LZ_ENABLED && !NRF_MODULE_ENABLED(NRF_LZ)
+#error "BLE_NUS_C_LZ_ENABLED requires NRF_LZ_ENABLED."
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -105,6 +115,8 @@ NRF_SDH_BLE_OBSERVERS(_name ## _obs,                     \
 #define BLE_UUID_NUS_SERVICE            0x0001                      /**< The UUID of the Nordic UART Service. */
 #define BLE_UUID_NUS_RX_CHARACTERISTIC  0x0002                      /**< The UUID of the RX Characteristic. */
 #define BLE_UUID_NUS_TX_CHARACTERISTIC  0x0003                      /**< The UUID of the TX Characteristic. */
+#define BLE_UUID_NUS_LZ_CHARACTERISTIC  0x0005                      /**< The UUID of the Compression Characteristic. */
+#define BLE_UUID_NUS_L2CAP_PSM_CHARACTERISTIC 0x0006                /**< The UUID of the L2CAP PSM Characteristic. */
 
 #define OPCODE_LENGTH 1
 #define HANDLE_LENGTH 2
@@ -123,7 +135,19 @@ typedef enum
 {
     BLE_NUS_C_EVT_DISCOVERY_COMPLETE,   /**< Event indicating that the NUS service and its characteristics were found. */
     BLE_NUS_C_EVT_NUS_TX_EVT,           /**< Event indicating that the central received something from a peer. */
-    BLE_NUS_C_EVT_DISCONNECTED          /**< Event indicating that the NUS server disconnected. */
+    BLE_NUS_C_EVT_DISCONNECTED,         /**< Event indicating that the NUS server disconnected. */
+#if BLE_NUS_C_STREAM_ENABLED
+    BLE_NUS_C_EVT_STREAM_COMPLETE,      /**< Event indicating that the buffer given to @ref ble_nus_c_stream_send was handed to the SoftDevice, or that sending it failed. */
+#endif
+#if BLE_NUS_C_LZ_ENABLED
+    BLE_NUS_C_EVT_LZ_STARTED,           /**< Event indicating that the server accepted compression. */
+    BLE_NUS_C_EVT_LZ_STOPPED,           /**< Event indicating that compression was stopped, refused by the server, or that a notification could not be decoded. */
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+    BLE_NUS_C_EVT_L2CAP_CONNECTED,      /**< Event indicating that the L2CAP channel is open. */
+    BLE_NUS_C_EVT_L2CAP_DISCONNECTED,   /**< Event indicating that the L2CAP channel was released, or could not be opened. */
+    BLE_NUS_C_EVT_L2CAP_TX_DONE,        /**< Event indicating that the buffer given to @ref ble_nus_c_l2cap_send was sent, or that sending it stopped. */
+#endif
 } ble_nus_c_evt_type_t;
 
 /**@brief Handles on the connected peer device needed to interact with it. */
@@ -132,6 +156,12 @@ typedef struct
     uint16_t nus_tx_handle;      /**< Handle of the NUS TX characteristic, as provided by a discovery. */
     uint16_t nus_tx_cccd_handle; /**< Handle of the CCCD of the NUS TX characteristic, as provided by a discovery. */
     uint16_t nus_rx_handle;      /**< Handle of the NUS RX characteristic, as provided by a discovery. */
+#if BLE_NUS_C_LZ_ENABLED
+    uint16_t nus_lz_handle;      /**< Handle of the NUS Compression characteristic, as provided by a discovery, or BLE_GATT_HANDLE_INVALID if the server does not support compression. */
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+    uint16_t nus_l2cap_psm_handle; /**< Handle of the NUS L2CAP PSM characteristic, as provided by a discovery, or BLE_GATT_HANDLE_INVALID if the server has no L2CAP channel. */
+#endif
 } ble_nus_c_handles_t;
 
 /**@brief Structure containing the NUS event data received from the peer. */
@@ -142,7 +172,15 @@ typedef struct
     uint16_t             max_data_len;
     uint8_t            * p_data;
     uint16_t             data_len;
+    ble_evt_t const    * p_ble_evt;   /**< SoftDevice event that @p p_data points into, or NULL if the data was decompressed or received on the L2CAP channel. This is filled if the evt_type is @ref BLE_NUS_C_EVT_NUS_TX_EVT. */
     ble_nus_c_handles_t  handles;     /**< Handles on which the Nordic UART service characteristics were discovered on the peer device. This is filled if the evt_type is @ref BLE_NUS_C_EVT_DISCOVERY_COMPLETE.*/
+#if BLE_NUS_C_STREAM_ENABLED
+    size_t               stream_len;    /**< Number of bytes handed to the SoftDevice. This is filled if the evt_type is @ref BLE_NUS_C_EVT_STREAM_COMPLETE, together with @p p_data. */
+    uint32_t             stream_result; /**< NRF_SUCCESS if the whole buffer was handed to the SoftDevice, otherwise the error that stopped the stream. */
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+    uint32_t             l2cap_len;     /**< Number of bytes the server acknowledged. This is filled if the evt_type is @ref BLE_NUS_C_EVT_L2CAP_TX_DONE, together with @p p_data. */
+#endif
 } ble_nus_c_evt_t;
 
 // Forward declaration of the ble_nus_t type.
@@ -164,6 +202,33 @@ struct ble_nus_c_s
     ble_nus_c_evt_handler_t   evt_handler;    /**< Application event handler to be called when there is an event related to the NUS. */
     ble_srv_error_handler_t   error_handler;  /**< Function to be called in case of an error. */
     nrf_ble_gq_t            * p_gatt_queue;   /**< Pointer to BLE GATT Queue instance. */
+#if BLE_NUS_C_STREAM_ENABLED
+    uint8_t const           * p_stream_data;  /**< Buffer being streamed, NULL if no stream is in progress. */
+    size_t                    stream_len;     /**< Length of the buffer being streamed. */
+    size_t                    stream_offset;  /**< Number of bytes of the buffer handed to the SoftDevice. */
+    uint16_t                  stream_max_len; /**< Maximum length of one write command. */
+#endif
+#if BLE_NUS_C_LZ_ENABLED
+    nrf_lz_enc_t              lz_enc;         /**< Encoder of the data sent to the server. */
+    nrf_lz_dec_t              lz_dec;         /**< Decoder of the notifications of the server. */
+    uint8_t                   lz_format;      /**< Format of the compression in use, 0 if the data is not compressed. */
+    uint8_t                   lz_req_format;  /**< Format written to the server, 0 to stop compression. */
+    bool                      lz_pending;     /**< Set while the Compression characteristic is being read or written. */
+#endif
+#if BLE_NUS_C_L2CAP_ENABLED
+    uint16_t                  l2cap_cid;        /**< Local CID of the L2CAP channel, BLE_L2CAP_CID_INVALID if there is none. */
+    bool                      l2cap_pending;    /**< Set while the L2CAP PSM characteristic is being read or the channel is being set up. */
+    bool                      l2cap_connected;  /**< Set while the L2CAP channel is open. */
+    ble_l2cap_ch_tx_params_t  l2cap_tx_params;  /**< Transmit parameters of the L2CAP channel. */
+    uint16_t                  l2cap_tx_credits; /**< Credits left for sending on the L2CAP channel. */
+    uint8_t const           * p_l2cap_tx_data;  /**< Buffer being sent on the L2CAP channel, NULL if none. */
+    uint32_t                  l2cap_tx_len;     /**< Length of the buffer being sent. */
+    uint32_t                  l2cap_tx_queued;  /**< Number of bytes of the buffer handed to the SoftDevice. */
+    uint32_t                  l2cap_tx_sent;    /**< Number of bytes of the buffer acknowledged by the server. */
+    uint8_t                   l2cap_rx_posted;  /**< Number of receive buffers posted to the SoftDevice. */
+    uint8_t                   l2cap_rx_next;    /**< Index of the next receive buffer to post. */
+    uint8_t                   l2cap_rx_bufs[BLE_NUS_C_L2CAP_RX_QUEUE_SIZE][BLE_NUS_C_L2CAP_MTU]; /**< Receive buffers, posted to the SoftDevice in turn. */
+#endif
 };
 
 /**@brief NUS Client initialization structure. */
@@ -236,16 +301,151 @@ uint32_t ble_nus_c_tx_notif_enable(ble_nus_c_t * p_ble_nus_c);
  *
  * @details This function writes the RX characteristic of the server.
  *
+ *          If compression is in use, the string is sent in packets of up to the larger of
+ *          @p length and 20 bytes, so a string that does not compress takes two writes. If
+ *          queuing the second one fails, the first part of the string has been sent.
+ *
  * @param[in] p_ble_nus_c Pointer to the NUS client structure.
  * @param[in] p_string    String to be sent.
  * @param[in] length      Length of the string.
  *
- * @retval NRF_SUCCESS If the string was sent successfully. 
- * @retval err_code    Otherwise, this API propagates the error code returned by function @ref nrf_ble_gq_item_add.
+ * @retval NRF_SUCCESS    If the string was sent successfully.
+ * @retval NRF_ERROR_BUSY If compression is being started or stopped.
+ * @retval err_code       Otherwise, this API propagates the error code returned by function @ref nrf_ble_gq_item_add.
  */
 uint32_t ble_nus_c_string_send(ble_nus_c_t * p_ble_nus_c, uint8_t * p_string, uint16_t length);
 
 
+#if BLE_NUS_C_STREAM_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief Function for streaming a buffer to the server.
+ * @details The buffer is split into write commands of up to @p max_data_len bytes to the RX
+ *          characteristic. They are written directly to the SoftDevice, without a GATT Queue
+ *          item or a copy per chunk. The SoftDevice queue is filled until it is full and
+ *          refilled on every BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE event.
+ *          @ref BLE_NUS_C_EVT_STREAM_COMPLETE is sent once, when the whole buffer has been
+ *          handed to the SoftDevice or when sending stopped on an error or a disconnection.
+ *          The event can be sent before this function returns.
+ * @param[in] p_ble_nus_c  Pointer to the NUS client structure.
+ * @param[in] p_data       Buffer to be sent. It must stay valid until
+ *                         @ref BLE_NUS_C_EVT_STREAM_COMPLETE is received.
+ * @param[in] length       Length of the buffer.
+ * @param[in] max_data_len Maximum length of one write command, typically the effective ATT MTU
+ *                         minus 3 as reported by nrf_ble_gatt.
+ * @retval NRF_SUCCESS             If the stream was started.
+ * @retval NRF_ERROR_NULL          If a pointer is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If @p length is 0, or @p max_data_len is 0 or exceeds
+ *                                 @ref BLE_NUS_MAX_DATA_LEN.
+ * @retval NRF_ERROR_INVALID_STATE If there is no connection.
+ * @retval NRF_ERROR_BUSY          If a stream is already in progress, or compression is being
+ *                                 started or stopped.
+ */
+uint32_t ble_nus_c_stream_send(ble_nus_c_t   * p_ble_nus_c,
+                               uint8_t const * p_data,
+                               size_t          length,
+                               uint16_t        max_data_len);
+#endif // BLE_NUS_C_STREAM_ENABLED
+
+
+#if BLE_NUS_C_LZ_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief Function for starting compression of the data exchanged with the server.
+ *
+ * @details The format supported by the server is read from its Compression characteristic, the
+ *          format with the smaller window is chosen with @ref nrf_lz_format_negotiate and written
+ *          back. @ref BLE_NUS_C_EVT_LZ_STARTED is sent when the server accepted it, from when
+ *          the data sent and received on the link is compressed. @ref BLE_NUS_C_EVT_LZ_STOPPED
+ *          is sent if it did not. No data can be sent in between.
+ *
+ * @note    Do not enable coalescing of @ref NRF_BLE_GQ_REQ_GATTC_WRITE requests in the GATT queue,
+ *          as a replaced packet would break the compressed stream.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS client structure.
+ *
+ * @retval NRF_SUCCESS             If the Compression characteristic is being read.
+ * @retval NRF_ERROR_NULL          If @p p_ble_nus_c is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If there is no connection, or the server has no Compression
+ *                                 characteristic.
+ * @retval NRF_ERROR_BUSY          If compression is being started or stopped, or a stream is in
+ *                                 progress.
+ * @retval err_code                Otherwise, the error code returned by @ref nrf_ble_gq_item_add.
+ */
+uint32_t ble_nus_c_lz_start(ble_nus_c_t * p_ble_nus_c);
+
+
+/**@brief Function for stopping compression.
+ *
+ * @details @ref BLE_NUS_C_EVT_LZ_STOPPED is sent when the server confirmed it. No data can be
+ *          sent until then.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS client structure.
+ *
+ * @retval NRF_SUCCESS             If the Compression characteristic is being written.
+ * @retval NRF_ERROR_NULL          If @p p_ble_nus_c is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If compression is not in use.
+ * @retval NRF_ERROR_BUSY          If compression is being started or stopped, or a stream is in
+ *                                 progress.
+ * @retval err_code                Otherwise, the error code returned by @ref nrf_ble_gq_item_add.
+ */
+uint32_t ble_nus_c_lz_stop(ble_nus_c_t * p_ble_nus_c);
+#endif // BLE_NUS_C_LZ_ENABLED
+
+
+#if BLE_NUS_C_L2CAP_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief Function for opening the L2CAP channel to the server.
+ *
+ * @details The PSM is read from the L2CAP PSM characteristic of the server, then an LE
+ *          credit-based channel is set up on it. @ref BLE_NUS_C_EVT_L2CAP_CONNECTED is sent when
+ *          the channel is open, @ref BLE_NUS_C_EVT_L2CAP_DISCONNECTED if it could not be opened.
+ *          Data received on the channel is sent in @ref BLE_NUS_C_EVT_NUS_TX_EVT events, like
+ *          notifications. The data exchanged on the channel is never compressed.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS client structure.
+ *
+ * @retval NRF_SUCCESS             If the L2CAP PSM characteristic is being read.
+ * @retval NRF_ERROR_NULL          If @p p_ble_nus_c is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If there is no connection, the server has no L2CAP PSM
+ *                                 characteristic, or the channel is already open.
+ * @retval NRF_ERROR_BUSY          If the channel is being opened.
+ * @retval err_code                Otherwise, the error code returned by @ref nrf_ble_gq_item_add.
+ */
+uint32_t ble_nus_c_l2cap_open(ble_nus_c_t * p_ble_nus_c);
+
+
+/**@brief Function for sending a buffer on the L2CAP channel.
+ *
+ * @details The buffer is split into SDUs of up to the MTU of the server, sent as the server
+ *          grants credits. @ref BLE_NUS_C_EVT_L2CAP_TX_DONE is sent once, when the server
+ *          received the whole buffer or when sending stopped on an error or a release of the
+ *          channel. The event can be sent before this function returns.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS client structure.
+ * @param[in] p_data      Buffer to be sent. It must stay valid until
+ *                        @ref BLE_NUS_C_EVT_L2CAP_TX_DONE is received.
+ * @param[in] length      Length of the buffer.
+ *
+ * @retval NRF_SUCCESS             If sending was started.
+ * @retval NRF_ERROR_NULL          If a pointer is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If @p length is 0.
+ * @retval NRF_ERROR_INVALID_STATE If the channel is not open.
+ * @retval NRF_ERROR_BUSY          If a buffer is already being sent.
+ */
+uint32_t ble_nus_c_l2cap_send(ble_nus_c_t * p_ble_nus_c, uint8_t const * p_data, uint32_t length);
+
+
+/**@brief Function for releasing the L2CAP channel.
+ *
+ * @details @ref BLE_NUS_C_EVT_L2CAP_DISCONNECTED is sent when the channel was released.
+ *
+ * @param[in] p_ble_nus_c Pointer to the NUS client structure.
+ *
+ * @retval NRF_SUCCESS             If the channel is being released.
+ * @retval NRF_ERROR_NULL          If @p p_ble_nus_c is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If the channel is not open.
+ * @retval err_code                Otherwise, the error code returned by sd_ble_l2cap_ch_release.
+ */
+uint32_t ble_nus_c_l2cap_close(ble_nus_c_t * p_ble_nus_c);
+#endif // BLE_NUS_C_L2CAP_ENABLED
+
+
 /**@brief Function for assigning handles to this instance of nus_c.
  *
  * @details Call this function when a link has been established with a peer to
@@ -0,0 +1,518 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_NUS_C_BRIDGE)
+#include <string.h>
+
+#include "ble_nus_c_bridge.h"
+#include "nrf_ringbuf_span.h"
+#include "nrf_sdh.h"
+#include "nrf_sdh_dispatch.h"
+#include "crc16.h"
+#include "nrf_assert.h"
+
+#define BRIDGE_EVT_POOL   (NRF_MODULE_ENABLED(NRF_SDH_DISPATCH) && (NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE > 0))
+#define BRIDGE_FRAME_MAX  (BLE_NUS_C_BRIDGE_HDR_LEN + BLE_NUS_MAX_DATA_LEN + BLE_NUS_C_BRIDGE_CRC_LEN)
+
+STATIC_ASSERT(IS_POWER_OF_TWO(BLE_NUS_C_BRIDGE_TX_RING_SIZE));
+STATIC_ASSERT(BLE_NUS_C_BRIDGE_TX_RING_SIZE >= 2 * BLE_NUS_MAX_DATA_LEN);
+
+/**@brief Results of handling a frame received on the UART. */
+typedef enum
+{
+    FRAME_DONE,    ///< Frame written to its link, or dropped.
+    FRAME_INVALID, ///< Wrong CRC, the frame does not start here.
+    FRAME_BLOCKED, ///< GATT Queue full, the frame must be handled again.
+} frame_result_t;
+
+
+/**@brief Function for getting the space left in the transmit ring buffer. */
+static size_t ring_free_get(ble_nus_c_bridge_t const * p_bridge)
+{
+    nrf_ringbuf_t const * p_ring = p_bridge->p_ring;
+
+    return p_ring->bufsize_mask + 1 - (p_ring->p_cb->wr_idx - p_ring->p_cb->rd_idx);
+}
+
+
+/**@brief Function for suspending the SoftDevice event dispatch when frames or ring buffer space
+ *        run short, and for resuming it when half of them are free again.
+ */
+static void backpressure_update(ble_nus_c_bridge_t * p_bridge)
+{
+    uint32_t used = p_bridge->tx_head - p_bridge->tx_tail;
+
+    if (!p_bridge->suspended)
+    {
+        if ((used == BLE_NUS_C_BRIDGE_FRAME_COUNT) || (ring_free_get(p_bridge) < BLE_NUS_MAX_DATA_LEN))
+        {
+            p_bridge->suspended = true;
+            nrf_sdh_suspend();
+        }
+    }
+    else if (   (used <= BLE_NUS_C_BRIDGE_FRAME_COUNT / 2)
+             && (ring_free_get(p_bridge) >= BLE_NUS_C_BRIDGE_TX_RING_SIZE / 2))
+    {
+        p_bridge->suspended = false;
+        nrf_sdh_resume();
+    }
+}
+
+
+/**@brief Function for releasing the payload of a frame sent on the UART.
+ *
+ * @details Frames are sent in the order they are queued, so the ring buffer is freed in the
+ *          order it was allocated.
+ */
+static void frame_sent(nrfx_uarte_tx_desc_t * p_desc, bool aborted)
+{
+    ble_nus_c_bridge_t       * p_bridge = p_desc->p_context;
+    ble_nus_c_bridge_frame_t * p_frame  = (ble_nus_c_bridge_frame_t *)p_desc;
+
+    ASSERT(p_frame == &p_bridge->frames[p_bridge->tx_tail % BLE_NUS_C_BRIDGE_FRAME_COUNT]);
+
+#if BRIDGE_EVT_POOL
+    if (p_frame->p_ble_evt != NULL)
+    {
+        nrf_sdh_dispatch_ble_evt_put(p_frame->p_ble_evt);
+        p_frame->p_ble_evt = NULL;
+    }
+#endif
+    if (p_frame->ring_len != 0)
+    {
+        UNUSED_RETURN_VALUE(nrf_ringbuf_free(p_bridge->p_ring, p_frame->ring_len));
+        p_frame->ring_len = 0;
+    }
+    if (!aborted)
+    {
+        p_bridge->stats.tx_frames++;
+    }
+
+    p_bridge->tx_tail++;
+    backpressure_update(p_bridge);
+}
+
+
+/**@brief Function for copying a payload to the transmit ring buffer.
+ *
+ * @return Number of buffers of the frame used, 0 if there was no space.
+ */
+static size_t payload_copy(ble_nus_c_bridge_t       * p_bridge,
+                           ble_nus_c_bridge_frame_t * p_frame,
+                           uint8_t const            * p_data,
+                           uint16_t                   length)
+{
+    nrf_ringbuf_span_t span;
+    size_t             alloc_len = length;
+    size_t             iov_cnt   = 0;
+
+    if (nrf_ringbuf_span_alloc(p_bridge->p_ring, &span, &alloc_len, true) != NRF_SUCCESS)
+    {
+        return 0;
+    }
+    if (alloc_len < length)
+    {
+        if (alloc_len != 0)
+        {
+            UNUSED_RETURN_VALUE(nrf_ringbuf_put(p_bridge->p_ring, 0));
+        }
+        return 0;
+    }
+
+    for (uint32_t i = 0; (i < ARRAY_SIZE(span.p_data)) && (span.length[i] != 0); i++)
+    {
+        memcpy(span.p_data[i], p_data, span.length[i]);
+        p_frame->iov[1 + i].p_data = span.p_data[i];
+        p_frame->iov[1 + i].length = span.length[i];
+        p_data += span.length[i];
+        iov_cnt++;
+    }
+    UNUSED_RETURN_VALUE(nrf_ringbuf_put(p_bridge->p_ring, length));
+
+    p_frame->ring_len = length;
+    p_bridge->stats.tx_copied++;
+    return iov_cnt;
+}
+
+
+void ble_nus_c_bridge_on_nus_c_evt(ble_nus_c_bridge_t    * p_bridge,
+                                   ble_nus_c_t const     * p_ble_nus_c,
+                                   ble_nus_c_evt_t const * p_evt)
+{
+    ASSERT(p_bridge != NULL);
+    ASSERT(p_evt != NULL);
+
+    if (   (p_evt->evt_type != BLE_NUS_C_EVT_NUS_TX_EVT)
+        || (p_ble_nus_c < p_bridge->p_nus_c)
+        || (p_ble_nus_c >= p_bridge->p_nus_c + p_bridge->link_count))
+    {
+        return;
+    }
+    if (p_bridge->tx_head - p_bridge->tx_tail >= BLE_NUS_C_BRIDGE_FRAME_COUNT)
+    {
+        p_bridge->stats.tx_dropped++;
+        return;
+    }
+
+    ble_nus_c_bridge_frame_t * p_frame = &p_bridge->frames[p_bridge->tx_head % BLE_NUS_C_BRIDGE_FRAME_COUNT];
+    size_t                     iov_cnt = 1;
+    uint16_t                   crc;
+
+    p_frame->hdr[0]    = (uint8_t)(p_ble_nus_c - p_bridge->p_nus_c);
+    p_frame->hdr[1]    = (uint8_t)p_evt->data_len;
+    p_frame->hdr[2]    = (uint8_t)(p_evt->data_len >> 8);
+    p_frame->iov[0]    = (nrfx_uarte_iovec_t){ .p_data = p_frame->hdr, .length = sizeof(p_frame->hdr) };
+    p_frame->p_ble_evt = NULL;
+    p_frame->ring_len  = 0;
+
+    if (p_evt->data_len != 0)
+    {
+#if BRIDGE_EVT_POOL
+        // Keep the event and send the payload from it.
+        if (   (p_evt->p_ble_evt != NULL)
+            && (nrf_sdh_dispatch_ble_evt_get(p_evt->p_ble_evt) == NRF_SUCCESS))
+        {
+            p_frame->p_ble_evt = p_evt->p_ble_evt;
+            p_frame->iov[1]    = (nrfx_uarte_iovec_t){ .p_data = p_evt->p_data, .length = p_evt->data_len };
+            iov_cnt++;
+        }
+        else
+#endif
+        {
+            size_t payload_cnt = payload_copy(p_bridge, p_frame, p_evt->p_data, p_evt->data_len);
+            if (payload_cnt == 0)
+            {
+                p_bridge->stats.tx_dropped++;
+                backpressure_update(p_bridge);
+                return;
+            }
+            iov_cnt += payload_cnt;
+        }
+    }
+
+    crc = crc16_compute(p_frame->hdr, sizeof(p_frame->hdr), NULL);
+    crc = crc16_compute(p_evt->p_data, p_evt->data_len, &crc);
+    p_frame->crc[0] = (uint8_t)crc;
+    p_frame->crc[1] = (uint8_t)(crc >> 8);
+    p_frame->iov[iov_cnt++] = (nrfx_uarte_iovec_t){ .p_data = p_frame->crc, .length = sizeof(p_frame->crc) };
+
+    p_frame->desc.p_iov     = p_frame->iov;
+    p_frame->desc.iov_cnt   = iov_cnt;
+    p_frame->desc.handler   = frame_sent;
+    p_frame->desc.p_context = p_bridge;
+
+    p_bridge->tx_head++;
+
+    // Every buffer is in Data RAM: the pooled event, the ring buffer and the frame itself.
+    nrfx_err_t err_code = nrfx_uarte_tx_queue(p_bridge->p_uarte, &p_frame->desc);
+    ASSERT(err_code == NRFX_SUCCESS);
+    UNUSED_VARIABLE(err_code);
+
+    backpressure_update(p_bridge);
+}
+
+
+/**@brief Function for getting the length of a frame from its header.
+ *
+ * @return Length of the frame, 0 if the length field is not valid.
+ */
+static size_t frame_len_get(uint8_t const * p_hdr)
+{
+    uint16_t length = uint16_decode(&p_hdr[1]);
+
+    return (length <= BLE_NUS_MAX_DATA_LEN) ?
+           (BLE_NUS_C_BRIDGE_HDR_LEN + length + BLE_NUS_C_BRIDGE_CRC_LEN) : 0;
+}
+
+
+/**@brief Function for checking a complete frame from the UART and writing it to its link. */
+static frame_result_t frame_handle(ble_nus_c_bridge_t * p_bridge, uint8_t * p_frame, size_t frame_len)
+{
+    uint16_t length = (uint16_t)(frame_len - BLE_NUS_C_BRIDGE_HDR_LEN - BLE_NUS_C_BRIDGE_CRC_LEN);
+    uint16_t crc    = crc16_compute(p_frame, BLE_NUS_C_BRIDGE_HDR_LEN + length, NULL);
+
+    if (crc != uint16_decode(&p_frame[frame_len - BLE_NUS_C_BRIDGE_CRC_LEN]))
+    {
+        return FRAME_INVALID;
+    }
+    if (p_frame[0] >= p_bridge->link_count)
+    {
+        p_bridge->stats.rx_dropped++;
+        return FRAME_DONE;
+    }
+
+    ret_code_t err_code = ble_nus_c_string_send(&p_bridge->p_nus_c[p_frame[0]],
+                                                &p_frame[BLE_NUS_C_BRIDGE_HDR_LEN],
+                                                length);
+    if (err_code == NRF_ERROR_NO_MEM)
+    {
+        return FRAME_BLOCKED;
+    }
+    if (err_code == NRF_SUCCESS)
+    {
+        p_bridge->stats.rx_frames++;
+    }
+    else
+    {
+        p_bridge->stats.rx_dropped++;
+    }
+    return FRAME_DONE;
+}
+
+
+/**@brief Function for removing bytes from the start of the frame that wrapped. */
+static void rx_asm_skip(ble_nus_c_bridge_t * p_bridge, size_t length)
+{
+    p_bridge->rx_asm_len -= length;
+    memmove(p_bridge->rx_asm, &p_bridge->rx_asm[length], p_bridge->rx_asm_len);
+}
+
+
+/**@brief Function for handling the frames received on the UART.
+ *
+ * @details Frames are handled in place in the reception buffer. Only a frame that wraps at the
+ *          end of the buffer is copied, to @p rx_asm. After a wrong length or CRC, one byte is
+ *          skipped and the frame is looked for again.
+ */
+static void rx_process(ble_nus_c_bridge_t * p_bridge)
+{
+    while (!p_bridge->rx_blocked)
+    {
+        frame_result_t result;
+        size_t         frame_len;
+        uint8_t      * p_data;
+        size_t         length;
+
+        if (p_bridge->rx_asm_len >= BLE_NUS_C_BRIDGE_HDR_LEN)
+        {
+            frame_len = frame_len_get(p_bridge->rx_asm);
+            if (frame_len == 0)
+            {
+                rx_asm_skip(p_bridge, 1);
+                p_bridge->stats.rx_skipped++;
+                continue;
+            }
+            if (p_bridge->rx_asm_len >= frame_len)
+            {
+                result = frame_handle(p_bridge, p_bridge->rx_asm, frame_len);
+                if (result == FRAME_BLOCKED)
+                {
+                    p_bridge->rx_blocked = true;
+                    break;
+                }
+                if (result == FRAME_INVALID)
+                {
+                    rx_asm_skip(p_bridge, 1);
+                    p_bridge->stats.rx_skipped++;
+                }
+                else
+                {
+                    rx_asm_skip(p_bridge, frame_len);
+                }
+                continue;
+            }
+        }
+
+        length = nrfx_uarte_rx_cont_get(p_bridge->p_uarte, &p_data);
+        if (length == 0)
+        {
+            break;
+        }
+
+        if (p_bridge->rx_asm_len == 0)
+        {
+            if (length >= BLE_NUS_C_BRIDGE_HDR_LEN)
+            {
+                frame_len = frame_len_get(p_data);
+                if (frame_len == 0)
+                {
+                    nrfx_uarte_rx_cont_free(p_bridge->p_uarte, 1);
+                    p_bridge->stats.rx_skipped++;
+                    continue;
+                }
+                if (length >= frame_len)
+                {
+                    result = frame_handle(p_bridge, p_data, frame_len);
+                    if (result == FRAME_BLOCKED)
+                    {
+                        // The frame stays in the reception buffer.
+                        p_bridge->rx_blocked = true;
+                        break;
+                    }
+                    if (result == FRAME_INVALID)
+                    {
+                        nrfx_uarte_rx_cont_free(p_bridge->p_uarte, 1);
+                        p_bridge->stats.rx_skipped++;
+                    }
+                    else
+                    {
+                        nrfx_uarte_rx_cont_free(p_bridge->p_uarte, frame_len);
+                    }
+                    continue;
+                }
+            }
+            if (p_data + length != p_bridge->p_rx_end)
+            {
+                // The rest of the frame is not received yet.
+                break;
+            }
+        }
+
+        // The frame wraps at the end of the buffer: copy what is needed to complete the header,
+        // then the frame.
+        size_t needed = (p_bridge->rx_asm_len < BLE_NUS_C_BRIDGE_HDR_LEN) ?
+                        BLE_NUS_C_BRIDGE_HDR_LEN : frame_len_get(p_bridge->rx_asm);
+        size_t copy_len = MIN(length, needed - p_bridge->rx_asm_len);
+
+        memcpy(&p_bridge->rx_asm[p_bridge->rx_asm_len], p_data, copy_len);
+        nrfx_uarte_rx_cont_free(p_bridge->p_uarte, copy_len);
+        p_bridge->rx_asm_len += copy_len;
+    }
+}
+
+
+/**@brief Function for handling the events of the continuous reception. */
+static void rx_cont_handler(nrfx_uarte_rx_cont_evt_t const * p_event, void * p_context)
+{
+    ble_nus_c_bridge_t * p_bridge = p_context;
+
+    switch (p_event->type)
+    {
+        case NRFX_UARTE_RX_CONT_EVT_DATA:
+            rx_process(p_bridge);
+            break;
+
+        case NRFX_UARTE_RX_CONT_EVT_OVERRUN:
+            // The frames are found again with the CRC.
+            p_bridge->stats.rx_overruns++;
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+void ble_nus_c_bridge_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    ble_nus_c_bridge_t * p_bridge = p_context;
+
+    if ((p_bridge == NULL) || (p_ble_evt == NULL) || (p_bridge->p_uarte == NULL))
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+        case BLE_GAP_EVT_DISCONNECTED:
+            // Space may be free in the GATT Queue, or the write will now fail and be dropped.
+            if (p_bridge->rx_blocked)
+            {
+                p_bridge->rx_blocked = false;
+                rx_process(p_bridge);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+ret_code_t ble_nus_c_bridge_init(ble_nus_c_bridge_t * p_bridge, ble_nus_c_bridge_init_t const * p_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_bridge);
+    VERIFY_PARAM_NOT_NULL(p_init);
+    VERIFY_PARAM_NOT_NULL(p_init->p_uarte);
+    VERIFY_PARAM_NOT_NULL(p_init->p_nus_c);
+    VERIFY_PARAM_NOT_NULL(p_init->p_rx_buffer);
+    VERIFY_PARAM_NOT_NULL(p_bridge->p_ring);
+
+    if (p_init->link_count == 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    nrf_ringbuf_init(p_bridge->p_ring);
+
+    p_bridge->p_uarte    = p_init->p_uarte;
+    p_bridge->p_nus_c    = p_init->p_nus_c;
+    p_bridge->link_count = p_init->link_count;
+    p_bridge->suspended  = false;
+    p_bridge->rx_blocked = false;
+    p_bridge->p_rx_end   = p_init->p_rx_buffer + p_init->rx_length;
+    p_bridge->tx_head    = 0;
+    p_bridge->tx_tail    = 0;
+    p_bridge->rx_asm_len = 0;
+    memset(p_bridge->frames, 0, sizeof(p_bridge->frames));
+    memset(&p_bridge->stats, 0, sizeof(p_bridge->stats));
+
+    nrfx_uarte_rx_cont_config_t const rx_config =
+    {
+        .counter    = p_init->rx_counter,
+        .idle_timer = p_init->rx_idle_timer,
+        .idle_us    = p_init->rx_idle_us,
+        .p_buffer   = p_init->p_rx_buffer,
+        .length     = p_init->rx_length,
+        .handler    = rx_cont_handler,
+        .p_context  = p_bridge,
+    };
+
+    nrfx_err_t err_code = nrfx_uarte_rx_cont_start(p_init->p_uarte, &rx_config);
+    if (err_code != NRFX_SUCCESS)
+    {
+        p_bridge->p_uarte = NULL;
+        return (ret_code_t)err_code;
+    }
+    return NRF_SUCCESS;
+}
+
+
+void ble_nus_c_bridge_stats_get(ble_nus_c_bridge_t const * p_bridge, ble_nus_c_bridge_stats_t * p_stats)
+{
+    ASSERT(p_bridge != NULL);
+    ASSERT(p_stats != NULL);
+
+    *p_stats = p_bridge->stats;
+}
+
+#endif // NRF_MODULE_ENABLED(BLE_NUS_C_BRIDGE)
@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup ble_nus_c_bridge Nordic UART Service Client to UARTE bridge
+ * @{
+ * @ingroup  ble_nus_c
+ * @brief    Framed forwarding between NUS client links and a UARTE.
+ *
+ * @details  Notifications of the NUS TX characteristic of every link are sent on the UART as
+ *           frames, and frames received on the UART are written to the RX characteristic of
+ *           the link they name. A frame is:
+ *
+ *           | Link ID | Length (LE) | Payload      | CRC-16 (LE) |
+ *           |---------|-------------|--------------|-------------|
+ *           | 1 byte  | 2 bytes     | Length bytes | 2 bytes     |
+ *
+ *           The link ID is the index of the client in the array given at initialization, and
+ *           the CRC is the CRC-16-CCITT of @ref crc16_compute over the link ID, length and
+ *           payload.
+ *
+ *           Notifications are not copied when the BLE events come from the pool of
+ *           nrf_sdh_dispatch (NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE). The event is retained and
+ *           the frame is queued with @ref nrfx_uarte_tx_queue as three buffers: the header,
+ *           the payload in the event and the CRC, so consecutive frames are sent back to back
+ *           by EasyDMA. The event is released when its frame is sent. Other notifications,
+ *           for example decompressed ones, are copied once to a transmit ring buffer.
+ *
+ *           When the UART falls behind, retained events keep the pool used up, so the
+ *           SoftDevice stops handing events over and the link layer flow control slows the
+ *           server down. If the frames or the ring buffer run short, the module also suspends
+ *           the SoftDevice event dispatch with @ref nrf_sdh_suspend until half of them are free.
+ *
+ *           Frames from the UART are received continuously with @ref nrfx_uarte_rx_cont_start
+ *           and written from the reception buffer, unless they wrap at its end. When the GATT
+ *           Queue is full, the frame is kept in the buffer and written again on the next write
+ *           command TX complete event, so reception fills the buffer meanwhile.
+ *
+ * @note     The UARTE interrupt priority must be the priority BLE events are dispatched at, so
+ *           that the module is not entered from both at the same time.
+ */
+
+#ifndef BLE_NUS_C_BRIDGE_H__
+#define BLE_NUS_C_BRIDGE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "nrfx_uarte.h"
+#include "nrfx_uarte_tx_queue.h"
+#include "nrfx_uarte_rx_cont.h"
+#include "nrf_ringbuf.h"
+#include "ble_nus_c.h"
+#include "nrf_sdh_ble.h"
+#include "sdk_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BLE_NUS_C_BRIDGE_HDR_LEN 3 /**< Length of the link ID and length fields of a frame. */
+#define BLE_NUS_C_BRIDGE_CRC_LEN 2 /**< Length of the CRC of a frame. */
+
+/**@brief   Macro for defining a ble_nus_c_bridge instance.
+ *
+ * @param   _name   Name of the instance.
+ * @hideinitializer
+ */
+#define BLE_NUS_C_BRIDGE_DEF(_name)                                                     \
+NRF_RINGBUF_DEF(CONCAT_2(_name, _ring), BLE_NUS_C_BRIDGE_TX_RING_SIZE);                 \
+static ble_nus_c_bridge_t _name = { .p_ring = &CONCAT_2(_name, _ring) };                \
+NRF_SDH_BLE_OBSERVER(_name ## _obs,                                                     \
+                     BLE_NUS_C_BRIDGE_BLE_OBSERVER_PRIO,                                \
+                     ble_nus_c_bridge_on_ble_evt, &_name)
+
+/**@brief Frame being sent on the UART. */
+typedef struct
+{
+    nrfx_uarte_tx_desc_t desc;                            /**< Transmission descriptor. */
+    nrfx_uarte_iovec_t   iov[4];                          /**< Header, payload in up to two segments, and CRC. */
+    uint8_t              hdr[BLE_NUS_C_BRIDGE_HDR_LEN];   /**< Link ID and length. */
+    uint8_t              crc[BLE_NUS_C_BRIDGE_CRC_LEN];   /**< CRC of the frame. */
+    ble_evt_t const    * p_ble_evt;                       /**< Retained event holding the payload, or NULL if it was copied. */
+    uint16_t             ring_len;                        /**< Length of the payload in the transmit ring buffer. */
+} ble_nus_c_bridge_frame_t;
+
+/**@brief Counters of the bridge. */
+typedef struct
+{
+    uint32_t tx_frames;     /**< Frames sent on the UART. */
+    uint32_t tx_copied;     /**< Frames whose payload was copied to the transmit ring buffer. */
+    uint32_t tx_dropped;    /**< Notifications dropped for lack of a frame or of ring buffer space. */
+    uint32_t rx_frames;     /**< Frames from the UART written to a link. */
+    uint32_t rx_dropped;    /**< Valid frames dropped because the link was not usable. */
+    uint32_t rx_skipped;    /**< Bytes skipped to find the start of a frame with a valid length and CRC. */
+    uint32_t rx_overruns;   /**< Overruns of the reception buffer. */
+} ble_nus_c_bridge_stats_t;
+
+/**@brief Bridge initialization structure. */
+typedef struct
+{
+    nrfx_uarte_t const * p_uarte;       /**< UARTE instance, initialized with an event handler. */
+    ble_nus_c_t        * p_nus_c;       /**< Array of NUS clients, indexed by link ID. */
+    uint8_t              link_count;    /**< Number of clients in the array. */
+    nrfx_timer_t         rx_counter;    /**< TIMER instance counting the received bytes. */
+    nrfx_timer_t         rx_idle_timer; /**< TIMER instance detecting the idle line. */
+    uint32_t             rx_idle_us;    /**< Idle line time in microseconds. */
+    uint8_t            * p_rx_buffer;   /**< Reception buffer in Data RAM. */
+    size_t               rx_length;     /**< Length of the reception buffer. Must be a power of two. */
+} ble_nus_c_bridge_init_t;
+
+/**@brief Bridge structure. */
+typedef struct
+{
+    nrf_ringbuf_t const    * p_ring;          /**< Transmit ring buffer for copied payloads. */
+    nrfx_uarte_t const     * p_uarte;         /**< UARTE instance. */
+    ble_nus_c_t            * p_nus_c;         /**< Array of NUS clients. */
+    uint8_t                  link_count;      /**< Number of clients in the array. */
+    bool                     suspended;       /**< Set while the module keeps the SoftDevice event dispatch suspended. */
+    bool                     rx_blocked;      /**< Set while the GATT Queue is full. */
+    uint8_t const          * p_rx_end;        /**< End of the reception buffer. */
+    uint32_t                 tx_head;         /**< Number of frames queued. */
+    uint32_t volatile        tx_tail;         /**< Number of frames sent. */
+    ble_nus_c_bridge_frame_t frames[BLE_NUS_C_BRIDGE_FRAME_COUNT]; /**< Frames, used in turn. */
+    uint16_t                 rx_asm_len;      /**< Number of bytes of the frame that wrapped, copied to @p rx_asm. */
+    uint8_t                  rx_asm[BLE_NUS_C_BRIDGE_HDR_LEN + BLE_NUS_MAX_DATA_LEN + BLE_NUS_C_BRIDGE_CRC_LEN]; /**< Frame that wrapped at the end of the reception buffer. */
+    ble_nus_c_bridge_stats_t stats;           /**< Counters. */
+} ble_nus_c_bridge_t;
+
+
+/**@brief Function for initializing the bridge and starting the reception on the UART.
+ *
+ * @param[in] p_bridge Bridge instance defined with @ref BLE_NUS_C_BRIDGE_DEF.
+ * @param[in] p_init   Initialization structure.
+ *
+ * @retval NRF_SUCCESS             If the bridge was initialized.
+ * @retval NRF_ERROR_NULL          If a parameter was NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If @p link_count was 0.
+ * @retval err_code                Otherwise, the error returned by @ref nrfx_uarte_rx_cont_start.
+ */
+ret_code_t ble_nus_c_bridge_init(ble_nus_c_bridge_t * p_bridge, ble_nus_c_bridge_init_t const * p_init);
+
+
+/**@brief Function for forwarding the events of a NUS client.
+ *
+ * @details Call this function from the event handler of every client in the array. Only
+ *          @ref BLE_NUS_C_EVT_NUS_TX_EVT is used.
+ *
+ * @param[in] p_bridge    Bridge instance.
+ * @param[in] p_ble_nus_c NUS client the event is from.
+ * @param[in] p_evt       Event of the client.
+ */
+void ble_nus_c_bridge_on_nus_c_evt(ble_nus_c_bridge_t    * p_bridge,
+                                   ble_nus_c_t const     * p_ble_nus_c,
+                                   ble_nus_c_evt_t const * p_evt);
+
+
+/**@brief Function for handling BLE events from the SoftDevice.
+ *
+ * @details Registered by @ref BLE_NUS_C_BRIDGE_DEF. Frames waiting for the GATT Queue are
+ *          written when a write command TX complete event is received.
+ *
+ * @param[in] p_ble_evt Pointer to the BLE event.
+ * @param[in] p_context Pointer to the bridge instance.
+ */
+void ble_nus_c_bridge_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+/**@brief Function for getting the counters of the bridge.
+ *
+ * @param[in]  p_bridge Bridge instance.
+ * @param[out] p_stats  Counters.
+ */
+void ble_nus_c_bridge_stats_get(ble_nus_c_bridge_t const * p_bridge, ble_nus_c_bridge_stats_t * p_stats);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_NUS_C_BRIDGE_H__
+
+/** @} */
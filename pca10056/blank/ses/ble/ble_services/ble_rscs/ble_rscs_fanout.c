@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_FANOUT)
+#include "ble_rscs_fanout.h"
+#include <string.h>
+#include "app_util.h"
+
+#define MAX_RSCM_LEN  ((2 * sizeof(uint8_t)) + (2 * sizeof(uint16_t)) + sizeof(uint32_t)) /**< Size of a Running Speed and Cadence Measurement with all fields present. */
+
+// Running Speed and Cadence Measurement flag bits
+#define RSC_MEAS_FLAG_INSTANT_STRIDE_LEN_PRESENT (0x01 << 0)               /**< Instantaneous Stride Length Present flag bit. */
+#define RSC_MEAS_FLAG_TOTAL_DISTANCE_PRESENT     (0x01 << 1)               /**< Total Distance Present flag bit. */
+#define RSC_MEAS_FLAG_WALKING_OR_RUNNING_BIT     (0x01 << 2)               /**< Walking or Running Status flag bit. */
+
+
+uint16_t ble_rscs_fanout_encode(void const * p_context,
+                                void const * p_meas,
+                                uint8_t    * p_buf,
+                                uint16_t     max_len)
+{
+    ble_rscs_t      const * p_rscs            = (ble_rscs_t const *)p_context;
+    ble_rscs_meas_t const * p_rsc_measurement = (ble_rscs_meas_t const *)p_meas;
+    uint8_t                 encoded_rsc_meas[MAX_RSCM_LEN];
+    uint8_t                 flags = 0;
+    uint8_t                 len   = 1;
+
+    // Instantaneous speed field
+    len += uint16_encode(p_rsc_measurement->inst_speed, &encoded_rsc_meas[len]);
+
+    // Instantaneous cadence field
+    encoded_rsc_meas[len++] = p_rsc_measurement->inst_cadence;
+
+    // Instantaneous stride length field
+    if (p_rscs->feature & BLE_RSCS_FEATURE_INSTANT_STRIDE_LEN_BIT)
+    {
+        if (p_rsc_measurement->is_inst_stride_len_present)
+        {
+            flags |= RSC_MEAS_FLAG_INSTANT_STRIDE_LEN_PRESENT;
+            len   += uint16_encode(p_rsc_measurement->inst_stride_length,
+                                   &encoded_rsc_meas[len]);
+        }
+    }
+
+    // Total distance field
+    if (p_rscs->feature & BLE_RSCS_FEATURE_TOTAL_DISTANCE_BIT)
+    {
+        if (p_rsc_measurement->is_total_distance_present)
+        {
+            flags |= RSC_MEAS_FLAG_TOTAL_DISTANCE_PRESENT;
+            len   += uint32_encode(p_rsc_measurement->total_distance, &encoded_rsc_meas[len]);
+        }
+    }
+
+    // Flags field
+    if (p_rscs->feature & BLE_RSCS_FEATURE_WALKING_OR_RUNNING_STATUS_BIT)
+    {
+        if (p_rsc_measurement->is_running)
+        {
+            flags |= RSC_MEAS_FLAG_WALKING_OR_RUNNING_BIT;
+        }
+    }
+    encoded_rsc_meas[0] = flags;
+
+    if (len > max_len)
+    {
+        return 0;
+    }
+
+    memcpy(p_buf, encoded_rsc_meas, len);
+
+    return len;
+}
+
+
+ret_code_t ble_rscs_fanout_init(nrf_ble_fanout_t        * p_fanout,
+                                ble_rscs_t const        * p_rscs,
+                                ble_srv_error_handler_t   error_handler)
+{
+    nrf_ble_fanout_init_t fanout_init;
+
+    VERIFY_PARAM_NOT_NULL(p_rscs);
+
+    memset(&fanout_init, 0, sizeof(fanout_init));
+
+    fanout_init.value_handle  = p_rscs->meas_handles.value_handle;
+    fanout_init.cccd_handle   = p_rscs->meas_handles.cccd_handle;
+    fanout_init.hvx_type      = BLE_GATT_HVX_NOTIFICATION;
+    fanout_init.encode        = ble_rscs_fanout_encode;
+    fanout_init.p_context     = p_rscs;
+    fanout_init.error_handler = error_handler;
+
+    return nrf_ble_fanout_init(p_fanout, &fanout_init);
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BLE_FANOUT)
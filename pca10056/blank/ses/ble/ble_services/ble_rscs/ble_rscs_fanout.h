@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup ble_rscs_fanout Running Speed and Cadence Measurement fan-out
+ * @{
+ * @ingroup  ble_rscs
+ * @brief    Running Speed and Cadence Measurement encoder for @ref nrf_ble_fanout.
+ *
+ * @details  @ref ble_rscs_measurement_send notifies the single link stored in @ref ble_rscs_t.
+ *           With this module, the measurements of an initialized @ref ble_rscs instance are
+ *           encoded once and notified to every link through @ref nrf_ble_fanout_send:
+ *           @code
+ *               NRF_BLE_FANOUT_DEF(m_rsc_fanout, NRF_SDH_BLE_PERIPHERAL_LINK_COUNT);
+ *
+ *               err_code = ble_rscs_fanout_init(&m_rsc_fanout, &m_rscs, error_handler);
+ *               ...
+ *               err_code = nrf_ble_fanout_send(&m_rsc_fanout, &rsc_measurement);
+ *           @endcode
+ */
+
+#ifndef BLE_RSCS_FANOUT_H__
+#define BLE_RSCS_FANOUT_H__
+
+#include <stdint.h>
+#include "ble_rscs.h"
+#include "nrf_ble_fanout.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for encoding a Running Speed and Cadence Measurement.
+ *
+ * @details Encoder of type @ref nrf_ble_fanout_encode_t, with a @ref ble_rscs_t as context and a
+ *          @ref ble_rscs_meas_t as measurement. The encoding is the one of
+ *          @ref ble_rscs_measurement_send.
+ */
+uint16_t ble_rscs_fanout_encode(void const * p_context,
+                                void const * p_meas,
+                                uint8_t    * p_buf,
+                                uint16_t     max_len);
+
+
+/**@brief Function for initializing the fan-out of the Running Speed and Cadence Measurement.
+ *
+ * @param[out]  p_fanout      Measurement fan-out structure.
+ * @param[in]   p_rscs        Initialized Running Speed and Cadence Service instance.
+ * @param[in]   error_handler Function to be called in case of an error.
+ *
+ * @return      Result of @ref nrf_ble_fanout_init.
+ */
+ret_code_t ble_rscs_fanout_init(nrf_ble_fanout_t        * p_fanout,
+                                ble_rscs_t const        * p_rscs,
+                                ble_srv_error_handler_t   error_handler);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_RSCS_FANOUT_H__
+
+/** @} */
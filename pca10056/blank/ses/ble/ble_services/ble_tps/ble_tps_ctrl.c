@@ -0,0 +1,350 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_TPS_CTRL)
+#include "ble_tps_ctrl.h"
+#include <string.h>
+#include "ble_conn_state.h"
+
+#if (BLE_CONN_STATE_STATS_ENABLED != 1)
+#error "ble_tps_ctrl requires BLE_CONN_STATE_STATS_ENABLED."
+#endif
+
+#define RSSI_THRESHOLD_DBM 1    /**< Change of the RSSI reported with BLE_GAP_EVT_RSSI_CHANGED, in dBm. */
+
+
+/**@brief TX power levels supported by the radio, in dBm, in ascending order. */
+static int8_t const m_levels[] =
+{
+#if defined(NRF52840_XXAA) || defined(NRF52833_XXAA)
+    -40, -20, -16, -12, -8, -4, 0, 2, 3, 4, 5, 6, 7, 8
+#else
+    -40, -20, -16, -12, -8, -4, 0, 3, 4
+#endif
+};
+
+
+/**@brief Function for finding the highest supported level not above a TX power.
+ *
+ * @param[in]   tx_power    TX power in dBm.
+ *
+ * @return      Index of the level, or 0 if the TX power is below all levels.
+ */
+static uint8_t level_find(int8_t tx_power)
+{
+    uint8_t level = 0;
+
+    while ((level + 1 < ARRAY_SIZE(m_levels)) && (m_levels[level + 1] <= tx_power))
+    {
+        level++;
+    }
+
+    return level;
+}
+
+
+/**@brief Function for finding the TX power state of a link.
+ *
+ * @param[in]   p_ctrl      TX power control structure.
+ * @param[in]   conn_handle Handle of the connection.
+ *
+ * @return      TX power state of the link, or NULL if the link is not known.
+ */
+static ble_tps_ctrl_link_t * link_get(ble_tps_ctrl_t const * p_ctrl, uint16_t conn_handle)
+{
+    uint16_t conn_idx = ble_conn_state_conn_idx(conn_handle);
+
+    if ((conn_idx >= p_ctrl->link_count) || (p_ctrl->p_links[conn_idx].conn_handle != conn_handle))
+    {
+        return NULL;
+    }
+
+    return &p_ctrl->p_links[conn_idx];
+}
+
+
+/**@brief Function for setting the TX power of a link.
+ *
+ * @details The TX Power Level characteristic is updated if the link is the one tracked by the
+ *          TX Power Service.
+ *
+ * @param[in]   p_ctrl      TX power control structure.
+ * @param[in]   p_link      TX power state of the link.
+ * @param[in]   level       Index of the new TX power.
+ *
+ * @return      NRF_SUCCESS, or the error returned by the SoftDevice.
+ */
+static uint32_t level_set(ble_tps_ctrl_t * p_ctrl, ble_tps_ctrl_link_t * p_link, uint8_t level)
+{
+    uint32_t err_code;
+
+    err_code = sd_ble_gap_tx_power_set(BLE_GAP_TX_POWER_ROLE_CONN, p_link->conn_handle, m_levels[level]);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    p_link->level = level;
+
+    if ((p_ctrl->p_tps != NULL) && (p_ctrl->p_tps->conn_handle == p_link->conn_handle))
+    {
+        err_code = ble_tps_tx_power_level_set(p_ctrl->p_tps, m_levels[level]);
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for handling the Connect event.
+ *
+ * @param[in]   p_ctrl      TX power control structure.
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ */
+static void on_connect(ble_tps_ctrl_t * p_ctrl, ble_evt_t const * p_ble_evt)
+{
+    uint16_t              conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+    uint16_t              conn_idx    = ble_conn_state_conn_idx(conn_handle);
+    ble_tps_ctrl_link_t * p_link;
+    uint32_t              err_code;
+
+    if (conn_idx >= p_ctrl->link_count)
+    {
+        return;
+    }
+
+    p_link                = &p_ctrl->p_links[conn_idx];
+    p_link->conn_handle   = conn_handle;
+    p_link->step_rssi_cnt = 0;
+
+    err_code = sd_ble_gap_tx_power_set(BLE_GAP_TX_POWER_ROLE_CONN,
+                                       conn_handle,
+                                       m_levels[p_ctrl->level_initial]);
+    if (err_code == NRF_SUCCESS)
+    {
+        p_link->level = p_ctrl->level_initial;
+
+        // The TX Power Service follows the most recently connected link.
+        if (p_ctrl->p_tps != NULL)
+        {
+            err_code = ble_tps_tx_power_level_set(p_ctrl->p_tps, m_levels[p_link->level]);
+        }
+    }
+
+    if (err_code == NRF_SUCCESS)
+    {
+        err_code = sd_ble_gap_rssi_start(conn_handle, RSSI_THRESHOLD_DBM, BLE_TPS_CTRL_RSSI_SKIP_COUNT);
+
+        // The RSSI reporting may already have been started by the application.
+        if (err_code == NRF_ERROR_INVALID_STATE)
+        {
+            err_code = NRF_SUCCESS;
+        }
+    }
+
+    if ((err_code != NRF_SUCCESS) && (p_ctrl->error_handler != NULL))
+    {
+        p_ctrl->error_handler(err_code);
+    }
+}
+
+
+/**@brief Function for handling the RSSI Changed event.
+ *
+ * @details Steps the TX power of the link by one level if the estimated RSSI at the peer is
+ *          outside the target band, and enough RSSI samples were taken since the last step.
+ *
+ * @param[in]   p_ctrl      TX power control structure.
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ */
+static void on_rssi_changed(ble_tps_ctrl_t * p_ctrl, ble_evt_t const * p_ble_evt)
+{
+    uint16_t               conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+    ble_tps_ctrl_link_t  * p_link      = link_get(p_ctrl, conn_handle);
+    ble_conn_state_stats_t stats;
+    ble_tps_ctrl_evt_t     evt;
+    int32_t                peer_rssi;
+    uint8_t                level;
+    uint32_t               err_code;
+
+    if ((p_link == NULL) || !ble_conn_state_stats_get(ble_conn_state_conn_idx(conn_handle), &stats))
+    {
+        return;
+    }
+
+    if ((stats.rssi_cnt == 0) || (stats.rssi_cnt - p_link->step_rssi_cnt < p_ctrl->settle_samples))
+    {
+        return;
+    }
+
+    // Both directions are assumed to have the same path loss.
+    peer_rssi = stats.rssi_avg + m_levels[p_link->level] - p_ctrl->peer_tx_power;
+    level     = p_link->level;
+
+    if ((peer_rssi < p_ctrl->rssi_low) && (level < p_ctrl->level_max))
+    {
+        level++;
+    }
+    else if ((peer_rssi > p_ctrl->rssi_high) && (level > p_ctrl->level_min))
+    {
+        level--;
+    }
+    else
+    {
+        return;
+    }
+
+    err_code = level_set(p_ctrl, p_link, level);
+    if (err_code != NRF_SUCCESS)
+    {
+        if (p_ctrl->error_handler != NULL)
+        {
+            p_ctrl->error_handler(err_code);
+        }
+        return;
+    }
+
+    p_link->step_rssi_cnt = stats.rssi_cnt;
+
+    if (p_ctrl->evt_handler != NULL)
+    {
+        evt.conn_handle = conn_handle;
+        evt.tx_power    = m_levels[level];
+        evt.peer_rssi   = (int8_t)(stats.rssi_avg + m_levels[level] - p_ctrl->peer_tx_power);
+
+        p_ctrl->evt_handler(&evt);
+    }
+}
+
+
+void ble_tps_ctrl_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    ble_tps_ctrl_t      * p_ctrl = (ble_tps_ctrl_t *)p_context;
+    ble_tps_ctrl_link_t * p_link;
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_CONNECTED:
+            on_connect(p_ctrl, p_ble_evt);
+            break;
+
+        case BLE_GAP_EVT_DISCONNECTED:
+            p_link = link_get(p_ctrl, p_ble_evt->evt.gap_evt.conn_handle);
+            if (p_link != NULL)
+            {
+                p_link->conn_handle = BLE_CONN_HANDLE_INVALID;
+            }
+            break;
+
+        case BLE_GAP_EVT_RSSI_CHANGED:
+            on_rssi_changed(p_ctrl, p_ble_evt);
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+
+uint32_t ble_tps_ctrl_init(ble_tps_ctrl_t * p_ctrl, ble_tps_ctrl_init_t const * p_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_ctrl);
+    VERIFY_PARAM_NOT_NULL(p_init);
+
+    if ((p_init->min_tx_power > p_init->max_tx_power) ||
+        (p_init->max_tx_power < m_levels[0])          ||
+        (p_init->rssi_low >= p_init->rssi_high))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_ctrl->level_max = level_find(p_init->max_tx_power);
+    p_ctrl->level_min = level_find(p_init->min_tx_power);
+
+    if (m_levels[p_ctrl->level_min] < p_init->min_tx_power)
+    {
+        // Round the lowest TX power up, so that it stays within the range.
+        p_ctrl->level_min++;
+    }
+
+    if (p_ctrl->level_min > p_ctrl->level_max)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_ctrl->level_initial  = MAX(p_ctrl->level_min,
+                                 MIN(p_ctrl->level_max, level_find(p_init->initial_tx_power)));
+    p_ctrl->p_tps          = p_init->p_tps;
+    p_ctrl->evt_handler    = p_init->evt_handler;
+    p_ctrl->error_handler  = p_init->error_handler;
+    p_ctrl->peer_tx_power  = p_init->peer_tx_power;
+    p_ctrl->rssi_low       = p_init->rssi_low;
+    p_ctrl->rssi_high      = p_init->rssi_high;
+    p_ctrl->settle_samples = p_init->settle_samples;
+
+    for (uint32_t i = 0; i < p_ctrl->link_count; i++)
+    {
+        p_ctrl->p_links[i].conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t ble_tps_ctrl_tx_power_get(ble_tps_ctrl_t const * p_ctrl,
+                                   uint16_t               conn_handle,
+                                   int8_t               * p_tx_power)
+{
+    ble_tps_ctrl_link_t const * p_link;
+
+    VERIFY_PARAM_NOT_NULL(p_ctrl);
+    VERIFY_PARAM_NOT_NULL(p_tx_power);
+
+    p_link = link_get(p_ctrl, conn_handle);
+    if (p_link == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    *p_tx_power = m_levels[p_link->level];
+
+    return NRF_SUCCESS;
+}
+#endif // NRF_MODULE_ENABLED(BLE_TPS_CTRL)
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup ble_tps_ctrl TX power control
+ * @{
+ * @ingroup  ble_tps
+ * @brief    Module for adapting the TX power of each link to the RSSI of the link.
+ *
+ * @details  The TX power of each connection is stepped through the levels supported by the
+ *           radio, so that the signal received by the peer stays within a target RSSI band:
+ *
+ *           - The RSSI of the link is the average kept by @ref ble_conn_state_stats_get, which
+ *             this module enables with @ref sd_ble_gap_rssi_start when the link is connected.
+ *           - The RSSI at the peer is estimated from the RSSI of the link, assuming the path loss
+ *             is the same in both directions and the peer transmits at
+ *             @ref ble_tps_ctrl_init_t::peer_tx_power.
+ *           - The power is raised by one level when the estimate is below the band, and lowered
+ *             by one level when it is above the band. Between steps, the average must take in
+ *             @ref ble_tps_ctrl_init_t::settle_samples new RSSI samples.
+ *
+ *           If a @ref ble_tps instance is given, its TX Power Level characteristic is set to the
+ *           TX power of the link tracked by the service. The characteristic holds one value for
+ *           all links, so with several links it follows the most recently connected one.
+ *
+ * @note     The application must register this module as BLE event observer, which is done by
+ *           @ref BLE_TPS_CTRL_DEF. Requires @ref BLE_CONN_STATE_STATS_ENABLED.
+ */
+
+#ifndef BLE_TPS_CTRL_H__
+#define BLE_TPS_CTRL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ble.h"
+#include "ble_srv_common.h"
+#include "ble_tps.h"
+#include "nrf_sdh_ble.h"
+#include "sdk_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Macro for defining a ble_tps_ctrl instance.
+ *
+ * @param   _name       Name of the instance.
+ * @param   _max_links  Maximum number of links connected at a time.
+ * @hideinitializer
+ */
+#define BLE_TPS_CTRL_DEF(_name, _max_links)                             \
+    static ble_tps_ctrl_link_t CONCAT_2(_name, _links)[(_max_links)];   \
+    static ble_tps_ctrl_t _name =                                       \
+    {                                                                   \
+        .p_links    = CONCAT_2(_name, _links),                          \
+        .link_count = (_max_links)                                      \
+    };                                                                  \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                                 \
+                         BLE_TPS_BLE_OBSERVER_PRIO,                     \
+                         ble_tps_ctrl_on_ble_evt,                       \
+                         &_name)
+
+/**@brief TX power change of a link, passed to @ref ble_tps_ctrl_evt_handler_t. */
+typedef struct
+{
+    uint16_t conn_handle;   /**< Handle of the connection. */
+    int8_t   tx_power;      /**< New TX power of the link, in dBm. */
+    int8_t   peer_rssi;     /**< Estimated RSSI at the peer with the new TX power, in dBm. */
+} ble_tps_ctrl_evt_t;
+
+/**@brief TX power change handler type. */
+typedef void (*ble_tps_ctrl_evt_handler_t)(ble_tps_ctrl_evt_t const * p_evt);
+
+/**@brief TX power state of a link. */
+typedef struct
+{
+    uint16_t conn_handle;   /**< Handle of the connection, or BLE_CONN_HANDLE_INVALID. */
+    uint8_t  level;         /**< Index of the current TX power in the levels supported by the radio. */
+    uint32_t step_rssi_cnt; /**< Number of RSSI samples of the link when the TX power was last set. */
+} ble_tps_ctrl_link_t;
+
+/**@brief TX power control structure. */
+typedef struct
+{
+    ble_tps_t                  * p_tps;          /**< TX Power Service updated with the TX power, or NULL. */
+    ble_tps_ctrl_evt_handler_t   evt_handler;    /**< Function to be called when the TX power of a link is changed, or NULL. */
+    ble_srv_error_handler_t      error_handler;  /**< Function to be called in case of an error. */
+    uint8_t                      level_initial;  /**< Index of the TX power of a new link. */
+    uint8_t                      level_min;      /**< Index of the lowest TX power used. */
+    uint8_t                      level_max;      /**< Index of the highest TX power used. */
+    int8_t                       peer_tx_power;  /**< Assumed TX power of the peers, in dBm. */
+    int8_t                       rssi_low;       /**< Lower end of the target RSSI band at the peer, in dBm. */
+    int8_t                       rssi_high;      /**< Upper end of the target RSSI band at the peer, in dBm. */
+    uint8_t                      settle_samples; /**< Number of RSSI samples taken in between two steps. */
+    ble_tps_ctrl_link_t  * const p_links;        /**< TX power state of each link. */
+    uint8_t                const link_count;     /**< Number of elements in @ref ble_tps_ctrl_t::p_links. */
+} ble_tps_ctrl_t;
+
+/**@brief TX power control init structure. */
+typedef struct
+{
+    ble_tps_t                  * p_tps;            /**< Initialized TX Power Service to be updated, or NULL. */
+    ble_tps_ctrl_evt_handler_t   evt_handler;      /**< Function to be called when the TX power of a link is changed, or NULL. */
+    ble_srv_error_handler_t      error_handler;    /**< Function to be called in case of an error. */
+    int8_t                       initial_tx_power; /**< TX power of a new link, in dBm. */
+    int8_t                       min_tx_power;     /**< Lowest TX power used, in dBm. */
+    int8_t                       max_tx_power;     /**< Highest TX power used, in dBm. */
+    int8_t                       peer_tx_power;    /**< Assumed TX power of the peers, in dBm. */
+    int8_t                       rssi_low;         /**< Lower end of the target RSSI band at the peer, in dBm. */
+    int8_t                       rssi_high;        /**< Upper end of the target RSSI band at the peer, in dBm. The difference to @p rssi_low is the hysteresis, and should exceed the largest step between two TX power levels. */
+    uint8_t                      settle_samples;   /**< Number of RSSI samples taken in between two steps. */
+} ble_tps_ctrl_init_t;
+
+
+/**@brief Function for initializing the TX power control.
+ *
+ * @details The TX powers are rounded down to levels supported by the radio, and clamped to the
+ *          range of @p min_tx_power to @p max_tx_power. Must be called before any connection is
+ *          established.
+ *
+ * @param[out]  p_ctrl      TX power control structure.
+ * @param[in]   p_init      Information needed to initialize the TX power control.
+ *
+ * @retval NRF_SUCCESS             If the TX power control was initialized.
+ * @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If no supported level is within the TX power range, or if the
+ *                                 RSSI band is empty.
+ */
+uint32_t ble_tps_ctrl_init(ble_tps_ctrl_t * p_ctrl, ble_tps_ctrl_init_t const * p_init);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+ *
+ * @details Sets the initial TX power of each new link and steps it on RSSI changes.
+ *
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ * @param[in]   p_context   TX power control structure.
+ */
+void ble_tps_ctrl_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+/**@brief Function for reading the TX power of a link.
+ *
+ * @param[in]   p_ctrl       TX power control structure.
+ * @param[in]   conn_handle  Handle of the connection.
+ * @param[out]  p_tx_power   TX power of the link, in dBm.
+ *
+ * @retval NRF_SUCCESS             If the TX power was read.
+ * @retval NRF_ERROR_NULL          If any of the pointers are NULL.
+ * @retval NRF_ERROR_INVALID_STATE If the link is not known.
+ */
+uint32_t ble_tps_ctrl_tx_power_get(ble_tps_ctrl_t const * p_ctrl,
+                                   uint16_t               conn_handle,
+                                   int8_t               * p_tx_power);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_TPS_CTRL_H__
+
+/** @} */
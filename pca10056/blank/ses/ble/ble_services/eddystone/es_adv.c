@@ -45,6 +45,8 @@
 #include "es_slot.h"
 
 #define MULTIPROT_BEACON_DELAY_MS                75                                  //!< Maximum delay of the beacon send by multiprotocol example.
+#define IN_PLACE_ADV_INTERVAL_MARGIN_MS          10                                  //!< Maximum random advertising delay added by the link layer to each advertising event.
+#define IN_PLACE_ADV_INTERVAL_MS_MIN             20                                  //!< Minimum advertising interval for non-connectable advertising.
 
 static es_adv_evt_handler_t m_adv_evt_handler;                                       //!< Eddystone advertisement event handler.
 static bool                 m_is_connected       = false;                            //!< Is the Eddystone beacon in a connected state.
@@ -52,26 +54,47 @@ static bool                 m_remain_connectable = false;
 static uint8_t              m_ecs_uuid_type      = 0;                                //!< UUID type of the Eddystone Configuration Service.
 static uint16_t             m_adv_interval       = APP_CFG_NON_CONN_ADV_INTERVAL_MS; //!< Current advertisement interval.
 
-static uint8_t   m_enc_advdata[BLE_GAP_ADV_SET_DATA_SIZE_MAX];                    //!< Buffer for storing an encoded advertising set.
+static uint8_t   m_enc_advdata[2][BLE_GAP_ADV_SET_DATA_SIZE_MAX];                 //!< Buffers for storing an encoded advertising set.
 static uint8_t   m_enc_scan_response_data[BLE_GAP_ADV_SET_DATA_SIZE_MAX];         //!< Buffer for storing an encoded scan data.
 static uint8_t  *mp_adv_handle;                                                   //!< Pointer to the advertising handle.
 
-/**@brief Struct that contains pointers to the encoded advertising data. */
-static ble_gap_adv_data_t m_adv_data =
+/**@brief Structs that contain pointers to the encoded advertising data.
+ *
+ * @details While non-connectable advertising is running, the next frame is encoded into the
+ *          set that the SoftDevice is not using, and then handed over without stopping advertising.
+ */
+static ble_gap_adv_data_t m_adv_data_sets[2] =
 {
-    .adv_data =
     {
-        .p_data = m_enc_advdata,
-        .len    = BLE_GAP_ADV_SET_DATA_SIZE_MAX
+        .adv_data =
+        {
+            .p_data = m_enc_advdata[0],
+            .len    = BLE_GAP_ADV_SET_DATA_SIZE_MAX
+        },
+        .scan_rsp_data =
+        {
+            .p_data = m_enc_scan_response_data,
+            .len    = BLE_GAP_ADV_SET_DATA_SIZE_MAX
+        }
     },
-    .scan_rsp_data =
     {
-        .p_data = m_enc_scan_response_data,
-        .len    = BLE_GAP_ADV_SET_DATA_SIZE_MAX
-        
+        .adv_data =
+        {
+            .p_data = m_enc_advdata[1],
+            .len    = BLE_GAP_ADV_SET_DATA_SIZE_MAX
+        },
+        .scan_rsp_data =
+        {
+            .p_data = NULL,
+            .len    = 0
+        }
     }
 };
 
+static uint8_t  m_adv_data_index;                                                 //!< Index of the advertising data set last given to the SoftDevice.
+static uint16_t m_in_place_interval;                                              //!< Interval (in milliseconds) of the running non-connectable advertising whose data is updated in place, or 0 if there is none.
+static int8_t   m_adv_tx_pwr;                                                     //!< TX power last set for advertising.
+
 /**@brief Function for invoking registered callback.
  *
  * @param[in] evt Event to issue to callback.
@@ -86,14 +109,16 @@ static void invoke_callback(es_adv_evt_t evt)
 
 /**@brief Starting advertising.
  * @param[in]   p_adv_params  Advertisement parameters to use.
+ *
+ * @return NRF_SUCCESS if advertising was started, or NRF_ERROR_BUSY if the SoftDevice was busy.
  */
-static void adv_start(ble_gap_adv_params_t * p_adv_params)
+static ret_code_t adv_start(ble_gap_adv_params_t * p_adv_params)
 {
     ret_code_t err_code = NRF_SUCCESS;
 
     es_tlm_adv_cnt_inc();
 
-    err_code = sd_ble_gap_adv_set_configure(mp_adv_handle, &m_adv_data, p_adv_params);
+    err_code = sd_ble_gap_adv_set_configure(mp_adv_handle, &m_adv_data_sets[m_adv_data_index], p_adv_params);
     APP_ERROR_CHECK(err_code);
 
     err_code = sd_ble_gap_adv_start(*mp_adv_handle, BLE_CONN_CFG_TAG_DEFAULT);
@@ -102,6 +127,7 @@ static void adv_start(ble_gap_adv_params_t * p_adv_params)
     {
         APP_ERROR_CHECK(err_code);
     }
+    return err_code;
 }
 
 
@@ -155,14 +181,20 @@ static void connectable_adv_start(void)
     scrsp_data.uuids_complete.uuid_cnt = sizeof(scrp_uuids) / sizeof(scrp_uuids[0]);
     scrsp_data.uuids_complete.p_uuids  = scrp_uuids;
 
-    m_adv_data.scan_rsp_data.p_data = m_enc_scan_response_data;
-    m_adv_data.scan_rsp_data.len    = BLE_GAP_ADV_SET_DATA_SIZE_MAX;
+    // Only the first set has room for a scan response.
+    m_adv_data_index    = 0;
+    m_in_place_interval = 0;
+
+    m_adv_data_sets[0].adv_data.p_data      = m_enc_advdata[0];
+    m_adv_data_sets[0].adv_data.len         = BLE_GAP_ADV_SET_DATA_SIZE_MAX;
+    m_adv_data_sets[0].scan_rsp_data.p_data = m_enc_scan_response_data;
+    m_adv_data_sets[0].scan_rsp_data.len    = BLE_GAP_ADV_SET_DATA_SIZE_MAX;
 
     // As the data to be written does not depend on the slot_no, we can safely send
-    es_adv_frame_fill_connectable_adv_data(&scrsp_data, &m_adv_data);
+    es_adv_frame_fill_connectable_adv_data(&scrsp_data, &m_adv_data_sets[0]);
 
     get_adv_params(&connectable_adv_params, false, m_remain_connectable);
-    adv_start(&connectable_adv_params);
+    (void)adv_start(&connectable_adv_params);
 
     invoke_callback(ES_ADV_EVT_CONNECTABLE_ADV_STARTED);
 }
@@ -178,6 +210,8 @@ static void adv_stop(void)
         APP_ERROR_CHECK(err_code);
     }
 
+    m_in_place_interval = 0;
+
     es_adv_timing_stop();
 }
 
@@ -196,6 +230,50 @@ static void adv_restart(void)
 }
 
 
+/**@brief Function for getting the interval to use if frames are updated in place.
+ *
+ * @details If all frames of the schedule are equally spaced, advertising keeps running at a
+ *          slightly shorter interval than the spacing, so that every frame goes on air at least
+ *          once despite the random advertising delay. Only the data is updated for each frame.
+ *
+ * @return Advertising interval in milliseconds, or 0 if advertising must be restarted for each frame.
+ */
+static uint16_t in_place_interval_get(void)
+{
+    uint16_t spacing = es_adv_timing_frame_spacing_get();
+
+#ifdef MULTIPROTOCOL_802154_MODE
+    // Multiprotocol examples delay beacons, so keep restarting advertising for every frame.
+    spacing = 0;
+#endif // MULTIPROTOCOL_802154_MODE
+
+    if (spacing < IN_PLACE_ADV_INTERVAL_MS_MIN + IN_PLACE_ADV_INTERVAL_MARGIN_MS)
+    {
+        return 0;
+    }
+    return spacing - IN_PLACE_ADV_INTERVAL_MARGIN_MS;
+}
+
+
+/**@brief Function for setting the advertising TX power if it changed. */
+static void adv_tx_power_set(int8_t tx_pwr, bool skip_invalid_handle)
+{
+    ret_code_t err_code;
+
+    if ((m_in_place_interval != 0) && (tx_pwr == m_adv_tx_pwr))
+    {
+        return;
+    }
+
+    err_code = sd_ble_gap_tx_power_set(BLE_GAP_TX_POWER_ROLE_ADV, 0, tx_pwr);
+    if (!skip_invalid_handle || (err_code != BLE_ERROR_INVALID_ADV_HANDLE))
+    {
+        APP_ERROR_CHECK(err_code);
+    }
+    m_adv_tx_pwr = tx_pwr;
+}
+
+
 /**@brief Function handling events from @ref es_adv_timing.c.
  *
  * @param[in] p_evt Advertisement timing event.
@@ -204,39 +282,63 @@ static void adv_timing_callback(const es_adv_timing_evt_t * p_evt)
 {
     ret_code_t            err_code;
     ble_gap_adv_params_t  non_connectable_adv_params;
-    const es_slot_reg_t * p_reg = es_slot_get_registry();
+    const es_slot_reg_t * p_reg    = es_slot_get_registry();
+    uint16_t              interval = in_place_interval_get();
+    bool                  in_place = (interval != 0) && (interval == m_in_place_interval);
+    uint8_t               next     = m_adv_data_index ^ 1;
 
-    // As new advertisement data will be loaded, stop advertising.
-    err_code = sd_ble_gap_adv_stop(*mp_adv_handle);
-    if (err_code != NRF_ERROR_INVALID_STATE && err_code != BLE_ERROR_INVALID_ADV_HANDLE)
+    if (!in_place)
     {
-        APP_ERROR_CHECK(err_code);
+        // As new advertisement data will be loaded, stop advertising.
+        err_code = sd_ble_gap_adv_stop(*mp_adv_handle);
+        if (err_code != NRF_ERROR_INVALID_STATE && err_code != BLE_ERROR_INVALID_ADV_HANDLE)
+        {
+            APP_ERROR_CHECK(err_code);
+        }
+        m_in_place_interval = 0;
     }
 
+    // The encoder takes the size of the buffer in the length field. The frame filler may have
+    // pointed the set at cached data, so hand it its own buffer again.
+    m_adv_data_sets[next].adv_data.p_data = m_enc_advdata[next];
+    m_adv_data_sets[next].adv_data.len    = BLE_GAP_ADV_SET_DATA_SIZE_MAX;
+
     // If a non-eTLM frame is to be advertised.
     if (p_evt->evt_id == ES_ADV_TIMING_EVT_ADV_SLOT)
     {
-        err_code = sd_ble_gap_tx_power_set(BLE_GAP_TX_POWER_ROLE_ADV, 0, p_reg->slots[p_evt->slot_no].radio_tx_pwr);
-        if (err_code != BLE_ERROR_INVALID_ADV_HANDLE)
-        {
-            APP_ERROR_CHECK(err_code);
-        }
-            es_adv_frame_fill_non_connectable_adv_data(p_evt->slot_no, false, &m_adv_data);
-        }
+        adv_tx_power_set(p_reg->slots[p_evt->slot_no].radio_tx_pwr, true);
+        es_adv_frame_fill_non_connectable_adv_data(p_evt->slot_no, false, &m_adv_data_sets[next]);
+    }
 
     // If an eTLM frame is to be advertised
     else if (p_evt->evt_id == ES_ADV_TIMING_EVT_ADV_ETLM)
     {
-        err_code = sd_ble_gap_tx_power_set(BLE_GAP_TX_POWER_ROLE_ADV, 0, p_reg->slots[p_reg->tlm_slot].radio_tx_pwr);
-        APP_ERROR_CHECK(err_code);
-
-        es_adv_frame_fill_non_connectable_adv_data(p_evt->slot_no, true, &m_adv_data);
+        adv_tx_power_set(p_reg->slots[p_reg->tlm_slot].radio_tx_pwr, false);
+        es_adv_frame_fill_non_connectable_adv_data(p_evt->slot_no, true, &m_adv_data_sets[next]);
     }
 
+    m_adv_data_index = next;
+
     invoke_callback(ES_ADV_EVT_NON_CONN_ADV);
 
+    if (in_place)
+    {
+        es_tlm_adv_cnt_inc();
+
+        err_code = sd_ble_gap_adv_set_configure(mp_adv_handle, &m_adv_data_sets[next], NULL);
+        APP_ERROR_CHECK(err_code);
+        return;
+    }
+
     get_adv_params(&non_connectable_adv_params, true, m_remain_connectable);
-    adv_start(&non_connectable_adv_params);
+    if (interval != 0)
+    {
+        non_connectable_adv_params.interval = MSEC_TO_UNITS(interval, UNIT_0_625_MS);
+    }
+    if (adv_start(&non_connectable_adv_params) == NRF_SUCCESS)
+    {
+        m_in_place_interval = interval;
+    }
 }
 
 
@@ -274,7 +376,8 @@ void es_adv_on_ble_evt(ble_evt_t const * p_ble_evt)
     switch (p_ble_evt->header.evt_id)
     {
         case BLE_GAP_EVT_CONNECTED:
-            m_is_connected = true;
+            m_is_connected      = true;
+            m_in_place_interval = 0;
 
             // The beacon must provide these advertisements for the client to see updated values
             // during the connection.
@@ -290,6 +393,8 @@ void es_adv_on_ble_evt(ble_evt_t const * p_ble_evt)
             break;
 
         case BLE_GAP_EVT_ADV_SET_TERMINATED:
+            m_in_place_interval = 0;
+
             if (p_ble_evt->evt.gap_evt.params.adv_set_terminated.reason == BLE_GAP_EVT_ADV_SET_TERMINATED_REASON_TIMEOUT &&
                 !m_is_connected)
             {
@@ -347,6 +452,8 @@ void es_adv_init(uint8_t                     ecs_uuid_type,
     m_remain_connectable = remain_connectable;
     m_adv_interval       = adv_interval;
     mp_adv_handle        = p_adv_handle;
+    m_adv_data_index     = 0;
+    m_in_place_interval  = 0;
 
     es_tlm_init();
 
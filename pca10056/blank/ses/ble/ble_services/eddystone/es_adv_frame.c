@@ -40,6 +40,8 @@
 #include "es_adv_frame.h"
 #include "es_slot.h"
 
+static uint8_t const * mp_adv_data_in_use; //!< Advertising data last handed out, which the SoftDevice may still be using.
+
 
 /**@brief Function for setting advertisement data, using 'ble_advdata_encode'.
  *
@@ -91,6 +93,8 @@ static void fill_adv_data(ble_advdata_t * p_scrsp_data, uint8_array_t * p_es_dat
 void es_adv_frame_fill_connectable_adv_data(ble_advdata_t * p_scrsp_data, ble_gap_adv_data_t * const p_adv_data)
 {
     fill_adv_data(p_scrsp_data, NULL, p_adv_data);
+
+    mp_adv_data_in_use = p_adv_data->adv_data.p_data;
 }
 
 
@@ -98,6 +102,7 @@ void es_adv_frame_fill_non_connectable_adv_data(uint8_t slot_no, bool etlm, ble_
 {
     uint8_array_t         es_data_array = {0};
     const es_slot_reg_t * p_reg         = es_slot_get_registry();
+    es_slot_adv_cache_t * p_cache;
 
     if (etlm)
     {
@@ -116,5 +121,44 @@ void es_adv_frame_fill_non_connectable_adv_data(uint8_t slot_no, bool etlm, ble_
     es_data_array.p_data = (uint8_t *)&p_reg->slots[slot_no].adv_frame.frame;
     es_data_array.size   = p_reg->slots[slot_no].adv_frame.length;
 
-    fill_adv_data(NULL, &es_data_array, p_adv_data);
+    p_cache = es_slot_adv_cache_get(slot_no);
+
+    // The cache can only be (re)encoded while the SoftDevice is not advertising from it.
+    if (!p_cache->valid && (p_cache->data != mp_adv_data_in_use))
+    {
+        ble_gap_adv_data_t cache_data =
+        {
+            .adv_data =
+            {
+                .p_data = p_cache->data,
+                .len    = sizeof(p_cache->data)
+            }
+        };
+
+        fill_adv_data(NULL, &es_data_array, &cache_data);
+        p_cache->len   = cache_data.adv_data.len;
+        p_cache->valid = true;
+    }
+
+    if (!p_cache->valid)
+    {
+        fill_adv_data(NULL, &es_data_array, p_adv_data);
+    }
+    else
+    {
+        if (p_cache->data != mp_adv_data_in_use)
+        {
+            p_adv_data->adv_data.p_data = p_cache->data;
+        }
+        else
+        {
+            // Updating advertising data requires a buffer other than the one on air.
+            memcpy(p_adv_data->adv_data.p_data, p_cache->data, p_cache->len);
+        }
+        p_adv_data->adv_data.len         = p_cache->len;
+        p_adv_data->scan_rsp_data.p_data = NULL;
+        p_adv_data->scan_rsp_data.len    = 0;
+    }
+
+    mp_adv_data_in_use = p_adv_data->adv_data.p_data;
 }
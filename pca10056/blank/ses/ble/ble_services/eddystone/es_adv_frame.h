@@ -60,6 +60,10 @@ void es_adv_frame_fill_connectable_adv_data(ble_advdata_t * p_scrsp_data, ble_ga
 /**@brief Function for setting up non-connectable advertisement data using @ref
  * ble_advdata_encode.
  *
+ * @details The encoded data of a slot is cached and reused until the frame of the slot changes.
+ *          @p p_adv_data must point to a buffer the SoftDevice is not using. The buffer pointer
+ *          may be replaced with a pointer to the cached data.
+ *
  * @param[in]     slot_no Slot to fill in data for.
  * @param[in]     etlm    Flag that specifies if Eddystone-TLM is required.
  * @param[in,out] p_adv_data   Pointer to the encoded advertising data (including scan response).
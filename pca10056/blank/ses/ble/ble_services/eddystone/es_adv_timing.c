@@ -41,15 +41,16 @@
 #include "es_adv_timing.h"
 #include "es_adv_timing_resolver.h"
 #include "es_slot.h"
+#include "nordic_common.h"
 
 
-APP_TIMER_DEF(m_es_adv_interval_timer);                         //!< Timer for advertising the set of slots.
-APP_TIMER_DEF(m_es_slot_timer);                                 //!< Timer for advertising individual slots.
+APP_TIMER_DEF(m_es_adv_timer);                                  //!< Timer for advertising the slots, one frame at a time.
 
 static nrf_ble_escs_adv_interval_t     m_current_adv_interval;  //!< Current advertisement interval.
 static es_adv_timing_callback_t        m_timing_mgr_callback;   //!< Registered callback.
 static es_adv_timing_resolver_result_t m_adv_timing_result;     //!< Current advertising timing result.
 static bool                            m_non_conn_adv_active;   //!< Is the beacon advertising non-conn advertisements?
+static uint16_t                        m_frame_spacing_ms;      //!< Spacing between all frames of the schedule, or 0 if it differs between frames.
 
 /**@brief Function for invoking registered callback.
  *
@@ -81,34 +82,46 @@ static bool tlm_should_be_advertised(uint32_t adv_event_cnt)
 #endif // APP_CONFIG_TLM_ADV_INTERLEAVE_RATIO > 1
 
 
-/**@brief Timeout handler for the advertisement slot timer. */
-static void adv_slot_timeout(void * p_context)
+/**@brief Timeout handler for the advertisement timer.
+ *
+ * @details Each timeout advertises one entry of the schedule and starts the timer for the
+ *          next entry. The delay after the last entry completes the advertisement interval.
+ */
+static void adv_timeout(void * p_context)
 {
-
     ret_code_t err_code;
-    uint32_t active_slot_index = (uint32_t)p_context;
+    uint32_t   active_slot_index = (uint32_t)p_context;
 
     es_adv_timing_evt_t evt;
 
+    if (!m_non_conn_adv_active)
+    {
+        return;
+    }
+
+    if ((es_slot_get_registry()->num_configured_slots == 0) || (m_adv_timing_result.len_timing_results == 0))
+    {
+        err_code = app_timer_start(m_es_adv_timer, APP_TIMER_TICKS(m_current_adv_interval), NULL);
+        APP_ERROR_CHECK(err_code);
+        return;
+    }
+
+    if (active_slot_index >= m_adv_timing_result.len_timing_results)
+    {
+        active_slot_index = 0;
+    }
+
+    err_code = app_timer_start(m_es_adv_timer,
+                               APP_TIMER_TICKS(m_adv_timing_result.timing_results[active_slot_index].delay_ms),
+                               (void *)((active_slot_index + 1) % m_adv_timing_result.len_timing_results));
+    APP_ERROR_CHECK(err_code);
+
     evt.slot_no = m_adv_timing_result.timing_results[active_slot_index].slot_no;
 
     evt.evt_id = m_adv_timing_result.timing_results[active_slot_index].is_etlm
                      ? ES_ADV_TIMING_EVT_ADV_ETLM
                      : ES_ADV_TIMING_EVT_ADV_SLOT;
 
-    // Trigger an event for the next slot if this slot is not the last to be advertised in this event.
-    // Note: since we check 'm_adv_timing_result.len_timing_results > 1' we can safely cast the result of
-    //       the subtraction to a uint32.
-    if (m_non_conn_adv_active && \
-        m_adv_timing_result.len_timing_results > 1 && \
-        active_slot_index < (uint32_t)(m_adv_timing_result.len_timing_results - 1))
-    {
-        err_code = app_timer_start( m_es_slot_timer,
-                                    APP_TIMER_TICKS(m_adv_timing_result.timing_results[active_slot_index].delay_ms),
-                                    (void*)(active_slot_index + 1));
-        APP_ERROR_CHECK(err_code);
-    }
-
 #if APP_CONFIG_TLM_ADV_INTERLEAVE_RATIO > 1
     static uint32_t adv_event_cnt = 0;
 
@@ -127,47 +140,29 @@ static void adv_slot_timeout(void * p_context)
 }
 
 
-/**@brief Timeout handler for the advertisement interval timer. */
-static void adv_interval_timeout(void * p_context)
-{
-    if (es_slot_get_registry()->num_configured_slots > 0)
-    {
-        // Trigger slot timeout for advertising the first slot.
-        // Note: The slot number is not the index in the slot registry, it is the index of the active slots.
-        adv_slot_timeout(NULL);
-    }
-
-    if (m_non_conn_adv_active)
-    {
-        uint32_t err_code = app_timer_start(m_es_adv_interval_timer,
-                                   APP_TIMER_TICKS(m_current_adv_interval),
-                                   NULL);
-        APP_ERROR_CHECK(err_code);
-    }
-}
-
-
 void es_adv_timing_timers_init(void)
 {
     ret_code_t err_code;
 
-    err_code = app_timer_create(&m_es_adv_interval_timer,
+    err_code = app_timer_create(&m_es_adv_timer,
                                 APP_TIMER_MODE_SINGLE_SHOT,
-                                adv_interval_timeout);
-    APP_ERROR_CHECK(err_code);
-
-    err_code = app_timer_create(&m_es_slot_timer,
-                                APP_TIMER_MODE_SINGLE_SHOT,
-                                adv_slot_timeout);
+                                adv_timeout);
     APP_ERROR_CHECK(err_code);
 }
 
 
-/**@brief Function for finding and setting advertisement timing configuration. */
+/**@brief Function for finding and setting advertisement timing configuration.
+ *
+ * @details The whole schedule of one advertisement interval is computed here, so that the timer
+ *          handler only has to look up the next entry.
+ */
 static void adv_timing_set(void)
 {
     ret_code_t            err_code;
     const es_slot_reg_t * p_reg = es_slot_get_registry();
+    uint32_t              elapsed_ms = 0;
+    uint16_t              max_delay_ms;
+    uint8_t               last;
 
     es_adv_timing_resolver_input_t resolver_input = {
         .adv_interval             = m_current_adv_interval,
@@ -181,6 +176,42 @@ static void adv_timing_set(void)
 
     err_code = es_adv_timing_resolve(&resolver_input);
     APP_ERROR_CHECK(err_code);
+
+    m_frame_spacing_ms = 0;
+
+    if (m_adv_timing_result.len_timing_results == 0)
+    {
+        return;
+    }
+
+    // Let the last frame take up the rest of the advertisement interval.
+    last = m_adv_timing_result.len_timing_results - 1;
+
+    for (uint32_t i = 0; i < last; i++)
+    {
+        elapsed_ms += m_adv_timing_result.timing_results[i].delay_ms;
+    }
+
+    m_adv_timing_result.timing_results[last].delay_ms =
+        (elapsed_ms + APP_CONFIG_ADV_FRAME_SPACING_MS_MIN <= m_current_adv_interval)
+        ? (uint16_t)(m_current_adv_interval - elapsed_ms)
+        : APP_CONFIG_ADV_FRAME_SPACING_MS_MIN;
+
+    // The frames are equally spaced if the delays only differ by the rounding of the interval
+    // division, which the last frame absorbs.
+    m_frame_spacing_ms = m_adv_timing_result.timing_results[0].delay_ms;
+    max_delay_ms       = m_frame_spacing_ms;
+
+    for (uint32_t i = 1; i <= last; i++)
+    {
+        m_frame_spacing_ms = MIN(m_frame_spacing_ms, m_adv_timing_result.timing_results[i].delay_ms);
+        max_delay_ms       = MAX(max_delay_ms, m_adv_timing_result.timing_results[i].delay_ms);
+    }
+
+    if (max_delay_ms - m_frame_spacing_ms > last)
+    {
+        m_frame_spacing_ms = 0;
+    }
 }
 
 
@@ -196,25 +227,38 @@ void es_adv_timing_start(uint16_t adv_interval)
     {
         m_current_adv_interval = adv_interval;
 
-        err_code = app_timer_start(m_es_adv_interval_timer,
+        adv_timing_set();
+
+        // Ignored if the timer is already running the schedule.
+        err_code = app_timer_start(m_es_adv_timer,
                                    APP_TIMER_TICKS(m_current_adv_interval),
                                    NULL);
         APP_ERROR_CHECK(err_code);
-
-        adv_timing_set();
     }
 }
 
 
 void es_adv_timing_stop(void)
 {
-    m_non_conn_adv_active = false; // Stops timers from being re-fired.
+    ret_code_t err_code;
+
+    m_non_conn_adv_active = false; // Stops the timer from being re-fired.
+
+    err_code = app_timer_stop(m_es_adv_timer);
+    APP_ERROR_CHECK(err_code);
+}
+
+
+uint16_t es_adv_timing_frame_spacing_get(void)
+{
+    return m_frame_spacing_ms;
 }
 
 
 void es_adv_timing_init(es_adv_timing_callback_t p_handler)
 {
     m_non_conn_adv_active = false;
+    m_frame_spacing_ms    = 0;
     m_timing_mgr_callback = p_handler;
     memset(&m_adv_timing_result, 0, sizeof(m_adv_timing_result));
 }
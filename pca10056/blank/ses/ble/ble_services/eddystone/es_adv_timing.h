@@ -80,6 +80,13 @@ void es_adv_timing_start(uint16_t adv_interval);
 /**@brief Function for stopping Eddystone advertisement timing event generation. */
 void es_adv_timing_stop(void);
 
+/**@brief Function for getting the spacing of the advertisement schedule.
+ *
+ * @return Shortest time between two consecutive timing events in milliseconds, if the frames
+ *         of the schedule are equally spaced apart from rounding. Otherwise, 0.
+ */
+uint16_t es_adv_timing_frame_spacing_get(void);
+
 /**@brief Function for initializing the Eddystone advertisement timers.
  */
 void es_adv_timing_timers_init(void);
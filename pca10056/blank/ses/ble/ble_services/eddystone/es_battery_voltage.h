@@ -54,11 +54,26 @@
 void es_battery_voltage_init(void);
 
 /**@brief Function for reading the battery voltage.
+ *
+ * @details Unless @c APP_CONFIG_BATTERY_VOLTAGE_EXTERNAL is set, the last conversion result is
+ *          returned and a new conversion is started. If app_saadc is enabled, the conversion
+ *          is requested on its auxiliary channel, so the SAADC is shared with the application's
+ *          acquisition instead of being initialized here.
  *
  * @param[out]   p_vbatt       Pointer to the battery voltage value.
  */
 void es_battery_voltage_get(uint16_t * p_vbatt);
 
+/**@brief Function for providing the battery voltage sampled by the application.
+ *
+ * @details With @c APP_CONFIG_BATTERY_VOLTAGE_EXTERNAL set to 1, this module does not use the
+ *          SAADC. The application takes the supply voltage from its own SAADC acquisition
+ *          and passes it here, for example from its buffer handler.
+ *
+ * @param[in]    vbatt         Battery voltage in millivolts.
+ */
+void es_battery_voltage_set(uint16_t vbatt);
+
 /**
  * @}
  */
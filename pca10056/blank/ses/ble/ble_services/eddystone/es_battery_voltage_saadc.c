@@ -37,10 +37,23 @@
  * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  */
+#include "sdk_common.h"
 #include "es_battery_voltage.h"
-#include "nrf_drv_saadc.h"
+#include "es_app_config.h"
 #include "sdk_macros.h"
 
+#ifndef APP_CONFIG_BATTERY_VOLTAGE_EXTERNAL
+#define APP_CONFIG_BATTERY_VOLTAGE_EXTERNAL 0
+#endif
+
+#if !APP_CONFIG_BATTERY_VOLTAGE_EXTERNAL
+#if NRF_MODULE_ENABLED(APP_SAADC)
+#include "app_saadc.h"
+#else
+#include "nrf_drv_saadc.h"
+#endif
+#endif
+
 #define ADC_REF_VOLTAGE_IN_MILLIVOLTS  600  //!< Reference voltage (in milli volts) used by ADC while doing conversion.
 #define DIODE_FWD_VOLT_DROP_MILLIVOLTS 270  //!< Typical forward voltage drop of the diode (Part no: SD103ATW-7-F) that is connected in series with the voltage supply. This is the voltage drop when the forward current is 1mA. Source: Data sheet of 'SURFACE MOUNT SCHOTTKY BARRIER DIODE ARRAY' available at www.diodes.com.
 #define ADC_RES_10BIT                  1024 //!< Maximum digital value for 10-bit ADC conversion.
@@ -48,9 +61,89 @@
 #define ADC_RESULT_IN_MILLI_VOLTS(ADC_VALUE) \
     ((((ADC_VALUE) *ADC_REF_VOLTAGE_IN_MILLIVOLTS) / ADC_RES_10BIT) * ADC_PRE_SCALING_COMPENSATION)
 
-static nrf_saadc_value_t adc_buf;                   //!< Buffer used for storing ADC value.
 static uint16_t          m_batt_lvl_in_milli_volts; //!< Current battery level.
 
+void es_battery_voltage_set(uint16_t vbatt)
+{
+    m_batt_lvl_in_milli_volts = vbatt;
+}
+
+#if APP_CONFIG_BATTERY_VOLTAGE_EXTERNAL
+
+void es_battery_voltage_init(void)
+{
+    // The application samples the supply voltage, see @ref es_battery_voltage_set.
+}
+
+
+void es_battery_voltage_get(uint16_t * p_vbatt)
+{
+    VERIFY_PARAM_NOT_NULL_VOID(p_vbatt);
+
+    *p_vbatt = m_batt_lvl_in_milli_volts;
+}
+
+#elif NRF_MODULE_ENABLED(APP_SAADC)
+
+/**@brief Function handling the VDD conversion done by the application's SAADC acquisition.
+ *
+ * @param[in] value           Conversion result.
+ * @param[in] resolution_bits Resolution of the conversion.
+ * @param[in] p_context       Not used.
+ */
+static void vdd_sample_handler(nrf_saadc_value_t value, uint8_t resolution_bits, void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    int32_t adc_value = (value < 0) ? 0 : value;
+
+    m_batt_lvl_in_milli_volts =
+        (uint16_t)(((adc_value * ADC_REF_VOLTAGE_IN_MILLIVOLTS * ADC_PRE_SCALING_COMPENSATION)
+                    >> resolution_bits) + DIODE_FWD_VOLT_DROP_MILLIVOLTS);
+}
+
+
+static app_saadc_aux_request_t const m_vdd_request =
+{
+    .pin_p  = NRF_SAADC_INPUT_VDD,
+    .pin_n  = NRF_SAADC_INPUT_DISABLED,
+    .config =
+    {
+        .resistor_p = NRF_SAADC_RESISTOR_DISABLED,
+        .resistor_n = NRF_SAADC_RESISTOR_DISABLED,
+        .gain       = NRF_SAADC_GAIN1_6,
+        .reference  = NRF_SAADC_REFERENCE_INTERNAL,
+        .acq_time   = NRF_SAADC_ACQTIME_10US,
+        .mode       = NRF_SAADC_MODE_SINGLE_ENDED,
+        .burst      = NRF_SAADC_BURST_DISABLED,
+    },
+    .handler   = vdd_sample_handler,
+    .p_context = NULL,
+};
+
+
+void es_battery_voltage_init(void)
+{
+    // The SAADC belongs to app_saadc, which may not be initialized yet. VDD is converted on
+    // its auxiliary channel from the first reading on.
+}
+
+
+void es_battery_voltage_get(uint16_t * p_vbatt)
+{
+    VERIFY_PARAM_NOT_NULL_VOID(p_vbatt);
+
+    *p_vbatt = m_batt_lvl_in_milli_volts;
+
+    // The result is used by the next reading. Without app_saadc running or with its queue
+    // full, the previous value is kept.
+    (void)app_saadc_aux_request(&m_vdd_request);
+}
+
+#else
+
+static nrf_saadc_value_t adc_buf;                   //!< Buffer used for storing ADC value.
+
 /**@brief Function handling events from 'nrf_drv_saadc.c'.
  *
  * @param[in] p_evt SAADC event.
@@ -102,3 +195,5 @@ void es_battery_voltage_get(uint16_t * p_vbatt)
         APP_ERROR_CHECK(err_code);
     }
 }
+
+#endif // APP_CONFIG_BATTERY_VOLTAGE_EXTERNAL
@@ -55,6 +55,7 @@
 #define RECORD_KEY_PUB_KEY 0x3              //!< File record for public key.
 #define RECORD_KEY_LOCK_KEY 0x4             //!< File record for lock key.
 #define RECORD_KEY_BEACON_CONFIG 0x5        //!< File record for lock key.
+#define RECORD_BIT(key) (1UL << (key))      //!< Bit of a record in @ref m_synced_records.
 
 static uint16_t RECORD_KEY_SLOTS[5] = {0x6, 0x7, 0x8, 0x9, 0xa}; //!< File record for slots.
 
@@ -72,6 +73,7 @@ typedef struct
 static volatile uint32_t m_num_pending_ops;                         //!< Current number of outstanding FDS operations.
 static volatile bool     m_factory_reset_done;                      //!< Has a factory reset operation been completed.
 static uint16_t          m_conn_handle = BLE_CONN_HANDLE_INVALID;   //!< Current connection handle.
+static uint32_t          m_synced_records;                          //!< Records whose access buffer holds what is stored in flash, one bit per record key.
 
 
 #if APP_MAX_ADV_SLOTS > 32
@@ -120,6 +122,7 @@ static void fds_cb(fds_evt_t const * const p_evt)
             if (p_evt->del.file_id == FILE_ID_ES_FLASH)
             {
                 m_factory_reset_done = true;
+                m_synced_records    &= RECORD_BIT(RECORD_KEY_LOCK_KEY);
             }
             // Fall through
         case FDS_EVT_DEL_RECORD:
@@ -151,6 +154,11 @@ static void fds_cb(fds_evt_t const * const p_evt)
         case FDS_EVT_UPDATE:
             // Fall through:
         case FDS_EVT_WRITE:
+            if ((p_evt->id != FDS_EVT_GC) && (p_evt->result != NRF_SUCCESS))
+            {
+                // The record in flash does not match the access buffer.
+                m_synced_records &= ~RECORD_BIT(p_evt->write.record_key);
+            }
             if (m_num_pending_ops > 0)
             {
                 m_num_pending_ops--;
@@ -161,6 +169,10 @@ static void fds_cb(fds_evt_t const * const p_evt)
 
 
 /**@brief Function performing flash access (read/write/clear).
+ *
+ * @details The access buffer of a record keeps the data last read from or written to flash.
+ *          Writing the same data again is skipped, so that persisting the unchanged slots on
+ *          every disconnect does not wear the flash or trigger garbage collection.
  *
  * @param[in] p_params Flash access parameters.
  */
@@ -176,6 +188,15 @@ static ret_code_t access_flash_data(const flash_access_params_t * p_params)
         .file_id     = p_params->file_id
     };
 
+    if ((p_params->access_type == ES_FLASH_ACCESS_WRITE) &&
+        ((m_synced_records & RECORD_BIT(p_params->record_key)) != 0) &&
+        (memcmp(p_params->p_data_buf, p_params->p_data, p_params->size_bytes) == 0))
+    {
+        return NRF_SUCCESS;
+    }
+
+    m_synced_records &= ~RECORD_BIT(p_params->record_key);
+
     err_code = fds_record_find_by_key(p_params->record_key, &desc, &ft);
 
     // If its a read or clear, we can not accept errors on lookup
@@ -195,11 +216,13 @@ static ret_code_t access_flash_data(const flash_access_params_t * p_params)
             err_code = fds_record_open(&desc, &record);
             RETURN_IF_ERROR(err_code);
 
-            memcpy(p_params->p_data, record.p_data, p_params->size_bytes);
+            memcpy(p_params->p_data_buf, record.p_data, p_params->size_bytes);
+            memcpy(p_params->p_data, p_params->p_data_buf, p_params->size_bytes);
 
             err_code = fds_record_close(&desc);
             RETURN_IF_ERROR(err_code);
 
+            m_synced_records |= RECORD_BIT(p_params->record_key);
             break;
 
         case ES_FLASH_ACCESS_WRITE:
@@ -220,6 +243,7 @@ static ret_code_t access_flash_data(const flash_access_params_t * p_params)
 
             RETURN_IF_ERROR(err_code);
             m_num_pending_ops++;
+            m_synced_records |= RECORD_BIT(p_params->record_key);
             break;
 
         case ES_FLASH_ACCESS_CLEAR:
@@ -344,6 +368,8 @@ ret_code_t es_flash_init(void)
 
     m_factory_reset_done = false;
 
+    m_synced_records = 0;
+
     err_code = fds_register(fds_cb);
     RETURN_IF_ERROR(err_code);
 
@@ -87,7 +87,7 @@ typedef struct
 typedef enum
 {
     ES_FLASH_ACCESS_READ,  //!< Read data.
-    ES_FLASH_ACCESS_WRITE, //!< Write data.
+    ES_FLASH_ACCESS_WRITE, //!< Write data. Skipped if the same data is already stored.
     ES_FLASH_ACCESS_CLEAR  //!< Clear data.
 } es_flash_access_t;
 
@@ -57,7 +57,7 @@ static ret_code_t send_read_reply(nrf_ble_escs_t * p_escs, ble_gatts_rw_authoriz
 }
 
 
-static ret_code_t read_value(nrf_ble_escs_t * p_escs, uint8_t length, const void * p_value)
+static ret_code_t read_value(nrf_ble_escs_t * p_escs, uint16_t length, const void * p_value)
 {
     VERIFY_PARAM_NOT_NULL(p_escs);
     VERIFY_PARAM_NOT_NULL(p_value);
@@ -90,13 +90,20 @@ static ret_code_t read_from_gattdb(nrf_ble_escs_t * p_escs, uint16_t val_handle)
 }
 
 
-static ret_code_t read_adv_slot(nrf_ble_escs_t * p_escs, uint8_t active_slot, const es_slot_reg_t * p_reg)
+/**@brief Function for getting the ADV Slot Data read value of a slot.
+ *
+ * @param[in]  active_slot Slot to read.
+ * @param[in]  p_reg       Slot registry.
+ * @param[out] eid_buf     Buffer to fill if the slot is an EID slot.
+ * @param[out] pp_data     Pointer to the read value.
+ *
+ * @return Length of the read value.
+ */
+static uint16_t adv_slot_value_get(uint8_t               active_slot,
+                                   const es_slot_reg_t * p_reg,
+                                   uint8_t               eid_buf[ES_EID_GATTS_READ_LENGTH],
+                                   uint8_t const      ** pp_data)
 {
-    VERIFY_PARAM_NOT_NULL(p_escs);
-
-    ble_gatts_rw_authorize_reply_params_t reply = {0};
-    uint8_t                               eid_buf[14];
-
     // If an EID slot is read, load scaler, clock value and ephemeral ID.
     if (p_reg->slots[active_slot].adv_frame.type == ES_FRAME_TYPE_EID)
     {
@@ -105,8 +112,6 @@ static ret_code_t read_adv_slot(nrf_ble_escs_t * p_escs, uint8_t active_slot, co
         clock_value          = BYTES_REVERSE_32BIT(clock_value);
         /*lint -restore */
 
-        reply.params.read.len = ES_EID_GATTS_READ_LENGTH;
-
         // Fill EID buffer with data
         eid_buf[ES_EID_GATTS_READ_FRAME_TYPE_IDX] = ES_FRAME_TYPE_EID;
         eid_buf[ES_EID_GATTS_READ_EXPONENT_IDX]   = es_security_scaler_get(active_slot);
@@ -117,7 +122,9 @@ static ret_code_t read_adv_slot(nrf_ble_escs_t * p_escs, uint8_t active_slot, co
                &p_reg->slots[active_slot].adv_frame.frame.eid.eid,
                ES_EID_ID_LENGTH);
         /*lint -restore */
-        reply.params.read.p_data = eid_buf;
+        *pp_data = eid_buf;
+
+        return ES_EID_GATTS_READ_LENGTH;
     }
 
     // Otherwise, simply load the contents of the frame.
@@ -129,16 +136,82 @@ static ret_code_t read_adv_slot(nrf_ble_escs_t * p_escs, uint8_t active_slot, co
             // Fill eTLM slot using EID key from first EID slot.
             es_slot_etlm_update(p_reg->eid_slots_configured[0]);
         }
-        reply.params.read.len    = p_reg->slots[active_slot].adv_frame.length;
-        reply.params.read.p_data = (uint8_t *)&p_reg->slots[active_slot].adv_frame.frame;
+        *pp_data = (uint8_t const *)&p_reg->slots[active_slot].adv_frame.frame;
+
+        return p_reg->slots[active_slot].adv_frame.length;
     }
+}
+
+
+static ret_code_t read_adv_slot(nrf_ble_escs_t * p_escs, uint8_t active_slot, const es_slot_reg_t * p_reg)
+{
+    VERIFY_PARAM_NOT_NULL(p_escs);
 
+    ble_gatts_rw_authorize_reply_params_t reply = {0};
+    uint8_t                               eid_buf[ES_EID_GATTS_READ_LENGTH];
+
+    reply.params.read.len         = adv_slot_value_get(active_slot, p_reg, eid_buf, &reply.params.read.p_data);
     reply.params.read.gatt_status = BLE_GATT_STATUS_SUCCESS;
 
     return send_read_reply(p_escs, &reply);
 }
 
 
+#if NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+/**@brief Function for reading the configuration of all slots.
+ *
+ * @details The value has the format of a Bulk Configuration write, except that the frame of each
+ *          configured slot is given as it is read from the ADV Slot Data characteristic.
+ */
+static ret_code_t read_bulk_config(nrf_ble_escs_t * p_escs, const es_slot_reg_t * p_reg)
+{
+    VERIFY_PARAM_NOT_NULL(p_escs);
+
+    static uint8_t bulk_buf[ESCS_BULK_CONFIG_LENGTH_MAX(APP_MAX_ADV_SLOTS)];
+    uint8_t        eid_buf[ES_EID_GATTS_READ_LENGTH];
+    uint16_t       pos        = ESCS_BULK_CONFIG_HEADER_LENGTH;
+    uint8_t        slot_count = 0;
+
+    bulk_buf[ESCS_BULK_CONFIG_VERSION_IDX] = ESCS_BULK_CONFIG_VERSION;
+    (void)uint16_big_encode(es_adv_interval_get(), &bulk_buf[ESCS_BULK_CONFIG_ADV_INTERVAL_IDX]);
+
+    for (uint8_t slot_no = 0; slot_no < APP_MAX_ADV_SLOTS; ++slot_no)
+    {
+        uint8_t const * p_frame;
+        uint16_t        frame_length;
+
+        if (!p_reg->slots[slot_no].configured)
+        {
+            continue;
+        }
+
+        if ((p_reg->num_configured_eid_slots > 0) && p_reg->tlm_configured && (p_reg->tlm_slot == slot_no))
+        {
+            es_slot_etlm_update(p_reg->eid_slots_configured[0]);
+        }
+
+        frame_length = adv_slot_value_get(slot_no, p_reg, eid_buf, &p_frame);
+
+        bulk_buf[pos + ESCS_BULK_CONFIG_SLOT_NO_IDX]           = slot_no;
+        bulk_buf[pos + ESCS_BULK_CONFIG_SLOT_RADIO_TX_PWR_IDX] = (uint8_t)p_reg->slots[slot_no].radio_tx_pwr;
+        bulk_buf[pos + ESCS_BULK_CONFIG_SLOT_ADV_TX_PWR_IDX]   = p_reg->slots[slot_no].adv_custom_tx_power
+                                                                     ? (uint8_t)p_reg->slots[slot_no].custom_tx_power
+                                                                     : (uint8_t)ESCS_BULK_CONFIG_ADV_TX_PWR_CALIBRATED;
+        bulk_buf[pos + ESCS_BULK_CONFIG_SLOT_FRAME_LENGTH_IDX] = (uint8_t)frame_length;
+        pos += ESCS_BULK_CONFIG_SLOT_HEADER_LENGTH;
+
+        memcpy(&bulk_buf[pos], p_frame, frame_length);
+        pos += frame_length;
+        slot_count++;
+    }
+
+    bulk_buf[ESCS_BULK_CONFIG_SLOT_COUNT_IDX] = slot_count;
+
+    return read_value(p_escs, pos, bulk_buf);
+}
+#endif // NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+
+
 ret_code_t es_gatts_read_handle_locked_read(nrf_ble_escs_t * p_escs, uint16_t uuid)
 {
     VERIFY_PARAM_NOT_NULL(p_escs);
@@ -239,6 +312,11 @@ ret_code_t es_gatts_read_handle_unlocked_read(nrf_ble_escs_t * p_escs,
         case BLE_UUID_ESCS_RW_ADV_SLOT_CHAR:
             return read_adv_slot(p_escs, active_slot, p_reg);
 
+#if NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+        case BLE_UUID_ESCS_BULK_CONFIG_CHAR:
+            return read_bulk_config(p_escs, p_reg);
+#endif
+
         default:
             return NRF_ERROR_INVALID_PARAM;
     }
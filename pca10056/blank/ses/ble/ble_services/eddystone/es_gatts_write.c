@@ -97,6 +97,108 @@ static bool length_is_valid(uint8_t const * p_data, uint8_t length)
 }
 
 
+#if NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+/**@brief Function checking if a Bulk Configuration write is valid.
+ *
+ * @details All slot entries are checked before any of them is applied, so that a configuration is
+ *          either applied in full or not at all.
+ *
+ * @param[in] p_data Written Bulk Configuration data.
+ * @param[in] length Written length.
+ *
+ * @retval true If the data is valid.
+ * @retval false If the data is not valid.
+ */
+static bool bulk_config_is_valid(uint8_t const * p_data, uint16_t length)
+{
+    bool     slot_written[APP_MAX_ADV_SLOTS] = {false};
+    uint16_t pos                             = ESCS_BULK_CONFIG_HEADER_LENGTH;
+
+    if ((length < ESCS_BULK_CONFIG_HEADER_LENGTH) ||
+        (p_data[ESCS_BULK_CONFIG_VERSION_IDX] != ESCS_BULK_CONFIG_VERSION) ||
+        (p_data[ESCS_BULK_CONFIG_SLOT_COUNT_IDX] > APP_MAX_ADV_SLOTS))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < p_data[ESCS_BULK_CONFIG_SLOT_COUNT_IDX]; ++i)
+    {
+        uint8_t slot_no;
+        uint8_t frame_length;
+
+        if (length - pos < ESCS_BULK_CONFIG_SLOT_HEADER_LENGTH)
+        {
+            return false;
+        }
+
+        slot_no      = p_data[pos + ESCS_BULK_CONFIG_SLOT_NO_IDX];
+        frame_length = p_data[pos + ESCS_BULK_CONFIG_SLOT_FRAME_LENGTH_IDX];
+        pos         += ESCS_BULK_CONFIG_SLOT_HEADER_LENGTH;
+
+        if ((slot_no >= APP_MAX_ADV_SLOTS) || slot_written[slot_no])
+        {
+            return false;
+        }
+
+        if ((length - pos < frame_length) || !length_is_valid(&p_data[pos], frame_length))
+        {
+            return false;
+        }
+
+        slot_written[slot_no] = true;
+        pos                  += frame_length;
+    }
+
+    return (pos == length);
+}
+
+
+/**@brief Function for applying a validated Bulk Configuration write.
+ *
+ * @details Each slot entry is applied as a write to the ADV Slot Data, Radio Tx Power and
+ *          (Advanced) Advertised Tx Power characteristics of that slot, in that order.
+ *
+ * @param[in] p_data Written Bulk Configuration data.
+ */
+static void bulk_config_apply(uint8_t const * p_data)
+{
+    uint16_t adv_interval = uint16_big_decode(&p_data[ESCS_BULK_CONFIG_ADV_INTERVAL_IDX]);
+    uint16_t pos          = ESCS_BULK_CONFIG_HEADER_LENGTH;
+
+    for (uint32_t i = 0; i < p_data[ESCS_BULK_CONFIG_SLOT_COUNT_IDX]; ++i)
+    {
+        uint8_t                     slot_no      = p_data[pos + ESCS_BULK_CONFIG_SLOT_NO_IDX];
+        nrf_ble_escs_radio_tx_pwr_t radio_tx_pwr = (int8_t)p_data[pos + ESCS_BULK_CONFIG_SLOT_RADIO_TX_PWR_IDX];
+        nrf_ble_escs_adv_tx_pwr_t   adv_tx_pwr   = (int8_t)p_data[pos + ESCS_BULK_CONFIG_SLOT_ADV_TX_PWR_IDX];
+        uint8_t                     frame_length = p_data[pos + ESCS_BULK_CONFIG_SLOT_FRAME_LENGTH_IDX];
+        uint8_t const             * p_frame      = &p_data[pos + ESCS_BULK_CONFIG_SLOT_HEADER_LENGTH];
+
+        es_slot_on_write(slot_no, frame_length, p_frame);
+
+        // TLM frames carry no ranging data.
+        if ((frame_length == 0) || (p_frame[0] != ES_FRAME_TYPE_TLM))
+        {
+            es_slot_radio_tx_pwr_set(slot_no, radio_tx_pwr);
+
+            if (adv_tx_pwr != ESCS_BULK_CONFIG_ADV_TX_PWR_CALIBRATED)
+            {
+                es_slot_set_adv_custom_tx_power(slot_no, adv_tx_pwr);
+            }
+        }
+
+        pos += ESCS_BULK_CONFIG_SLOT_HEADER_LENGTH + frame_length;
+    }
+
+    if (adv_interval != ESCS_BULK_CONFIG_ADV_INTERVAL_UNCHANGED)
+    {
+        es_adv_interval_set(adv_interval);
+    }
+
+    es_adv_interval_set(es_adv_interval_get()); // Ensure that valid advertisement interval is used.
+}
+#endif // NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+
+
 ret_code_t es_gatts_write_handle_unlocked_write(nrf_ble_escs_t * p_escs,
                                                 uint16_t         uuid,
                                                 uint16_t         val_handle,
@@ -109,7 +211,7 @@ ret_code_t es_gatts_write_handle_unlocked_write(nrf_ble_escs_t * p_escs,
 
     ret_code_t                            err_code;
     ble_gatts_rw_authorize_reply_params_t reply      = {0};
-    bool                                  long_write = false;
+    bool                                  long_write = p_escs->is_long_write;
 
     reply.params.write.gatt_status = BLE_GATT_STATUS_SUCCESS;
 
@@ -164,10 +266,6 @@ ret_code_t es_gatts_write_handle_unlocked_write(nrf_ble_escs_t * p_escs,
             break;
 
         case BLE_UUID_ESCS_RW_ADV_SLOT_CHAR:
-            if (length > 20)
-            {
-                long_write = true;
-            }
             reply.params.write.gatt_status = length_is_valid(p_data, length)
                                                  ? BLE_GATT_STATUS_SUCCESS
                                                  : BLE_GATT_STATUS_ATTERR_INVALID_ATT_VAL_LENGTH;
@@ -201,6 +299,19 @@ ret_code_t es_gatts_write_handle_unlocked_write(nrf_ble_escs_t * p_escs,
 #endif
             break;
 
+#if NRF_BLE_ESCS_BULK_CONFIG_ENABLED
+        case BLE_UUID_ESCS_BULK_CONFIG_CHAR:
+            reply.params.write.gatt_status = bulk_config_is_valid(p_data, length)
+                                                 ? BLE_GATT_STATUS_SUCCESS
+                                                 : BLE_GATT_STATUS_ATTERR_INVALID_ATT_VAL_LENGTH;
+
+            if (reply.params.write.gatt_status == BLE_GATT_STATUS_SUCCESS)
+            {
+                bulk_config_apply(p_data);
+            }
+            break;
+#endif
+
         default:
             break;
     }
@@ -47,6 +47,9 @@
 #include "modes.h"
 #include "nrf_crypto.h"
 #include "nrf_soc.h"
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+#include "nrf_crypto_jobq.h"
+#endif
 
 #define NONCE_SIZE                  (6)
 #define TAG_SIZE                    (2)
@@ -68,9 +71,20 @@ typedef struct
 {
     nrf_ecb_hal_data_t   aes_ecb_ik;
     nrf_ecb_hal_data_t   aes_ecb_tk;
-    uint8_t              eid[ES_EID_ID_LENGTH];
+    uint8_t              eid[2][ES_EID_ID_LENGTH]; //!< Active EID and the precomputed EID for the next rotation.
+    uint8_t              eid_active;               //!< Index of the active EID in @ref eid.
+    uint32_t             eid_time;                 //!< Time counter, with the K lowest bits cleared, of the active EID.
+    uint32_t             eid_next_time;            //!< Time counter, with the K lowest bits cleared, of the precomputed EID.
+    bool                 eid_next_ready;           //!< Whether the precomputed EID is valid.
+    uint16_t             tk_time;                  //!< Upper 16 bits of the time counter that the temporary key was generated for.
+    bool                 tk_valid;                 //!< Whether the temporary key is valid for @ref tk_time.
     es_security_timing_t timing;
     bool                 is_occupied;
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+    nrf_crypto_jobq_job_t ecdh_job;                         //!< Job of the ECDH key exchange.
+    uint8_t               ecdh_pub[ESCS_ECDH_KEY_SIZE];     //!< Public ECDH key of the phone, for @ref ecdh_job.
+    uint8_t               ecdh_scaler_k;                    //!< Rotation period exponent received with @ref ecdh_pub.
+#endif
 } es_security_slot_t;
 
 /**@brief Key pair structure. */
@@ -99,24 +113,64 @@ static nrf_crypto_aead_context_t                    m_aead_context;
 static nrf_crypto_ecc_key_pair_generate_context_t   ecc_key_pair_generate_context;
 static nrf_crypto_ecdh_context_t                    ecdh_context;
 
-/**@brief Generates a temporary key with the Identity key. */
-static void temp_key_generate(uint8_t slot_no);
+/**@brief Encrypts one block with the ECB peripheral. */
+static void ecb_block_encrypt(nrf_ecb_hal_data_t * p_ecb_data)
+{
+    ret_code_t err_code = sd_ecb_block_encrypt(p_ecb_data);
+    APP_ERROR_CHECK(err_code);
+}
 
-/**@brief Generates a EID with the Temporary Key*/
-static void eid_generate(uint8_t slot_no)
+
+/**@brief Clears the K lowest bits of a time counter value. */
+static uint32_t k_bits_cleared_time_get(uint8_t slot_no, uint32_t time_counter)
 {
-    ret_code_t  err_code;
-    size_t      ciphertext_size = AES_ECB_CIPHERTEXT_LENGTH;
+    return (time_counter >> m_security_slot[slot_no].timing.k_scaler)
+           << m_security_slot[slot_no].timing.k_scaler;
+}
 
-    temp_key_generate(slot_no);
+
+/**@brief Generates a temporary key with the Identity key.
+ *
+ * @details The temporary key only changes every 2^16 seconds, so it is kept until then.
+ */
+static void temp_key_generate(uint8_t slot_no, uint32_t time_counter)
+{
+    uint16_t tk_time = (uint16_t)(time_counter >> 16);
+
+    if (m_security_slot[slot_no].tk_valid && (m_security_slot[slot_no].tk_time == tk_time))
+    {
+        return;
+    }
+
+    memset(m_security_slot[slot_no].aes_ecb_ik.cleartext, 0, ESCS_AES_KEY_SIZE);
+    m_security_slot[slot_no].aes_ecb_ik.cleartext[11] = 0xFF;
+    m_security_slot[slot_no].aes_ecb_ik.cleartext[14] = (uint8_t)((time_counter >> 24) & 0xff);
+    m_security_slot[slot_no].aes_ecb_ik.cleartext[15] = (uint8_t)((time_counter >> 16) & 0xff);
+
+    ecb_block_encrypt(&m_security_slot[slot_no].aes_ecb_ik);
+
+    memcpy(m_security_slot[slot_no].aes_ecb_tk.key,
+           m_security_slot[slot_no].aes_ecb_ik.ciphertext,
+           ESCS_AES_KEY_SIZE);
+
+    m_security_slot[slot_no].tk_time  = tk_time;
+    m_security_slot[slot_no].tk_valid = true;
+}
+
+
+/**@brief Computes the EID of a slot for a given time with the Temporary Key.
+ *
+ * @param[in]  slot_no             The index of the slot.
+ * @param[in]  k_bits_cleared_time Time counter with the K lowest bits cleared.
+ * @param[out] p_eid               Buffer for the EID.
+ */
+static void eid_compute(uint8_t slot_no, uint32_t k_bits_cleared_time, uint8_t * p_eid)
+{
+    temp_key_generate(slot_no, k_bits_cleared_time);
 
     memset(m_security_slot[slot_no].aes_ecb_tk.cleartext, 0, ESCS_AES_KEY_SIZE);
     m_security_slot[slot_no].aes_ecb_tk.cleartext[11] = m_security_slot[slot_no].timing.k_scaler;
 
-    uint32_t k_bits_cleared_time =
-        (m_security_slot[slot_no].timing.time_counter >> m_security_slot[slot_no].timing.k_scaler)
-        << m_security_slot[slot_no].timing.k_scaler;
-
     m_security_slot[slot_no].aes_ecb_tk.cleartext[12] =
         (uint8_t)((k_bits_cleared_time >> 24) & 0xff);
     m_security_slot[slot_no].aes_ecb_tk.cleartext[13] =
@@ -124,79 +178,69 @@ static void eid_generate(uint8_t slot_no)
     m_security_slot[slot_no].aes_ecb_tk.cleartext[14] = (uint8_t)((k_bits_cleared_time >> 8) & 0xff);
     m_security_slot[slot_no].aes_ecb_tk.cleartext[15] = (uint8_t)((k_bits_cleared_time) & 0xff);
 
-    err_code = nrf_crypto_aes_crypt(&m_aes_context,
-                                    &g_nrf_crypto_aes_ecb_128_info,
-                                    NRF_CRYPTO_ENCRYPT,                             // Operation
-                                    m_security_slot[slot_no].aes_ecb_tk.key,        // Key
-                                    NULL,                                           // IV
-                                    m_security_slot[slot_no].aes_ecb_tk.cleartext,  // Data in
-                                    AES_ECB_CLEARTEXT_LENGTH,                       // Data in size
-                                    m_security_slot[slot_no].aes_ecb_tk.ciphertext, // Data out
-                                    &ciphertext_size);                              // Data out size
+    ecb_block_encrypt(&m_security_slot[slot_no].aes_ecb_tk);
 
-    APP_ERROR_CHECK(err_code);
+    memcpy(p_eid, m_security_slot[slot_no].aes_ecb_tk.ciphertext, ES_EID_ID_LENGTH);
+}
 
-    memcpy(m_security_slot[slot_no].eid,
-           m_security_slot[slot_no].aes_ecb_tk.ciphertext,
-           ES_EID_ID_LENGTH);
+
+/**@brief Generates the EID for the current time of a slot. */
+static void eid_generate(uint8_t slot_no)
+{
+    es_security_slot_t * p_slot = &m_security_slot[slot_no];
+
+    p_slot->eid_time       = k_bits_cleared_time_get(slot_no, p_slot->timing.time_counter);
+    p_slot->eid_next_ready = false;
+
+    eid_compute(slot_no, p_slot->eid_time, p_slot->eid[p_slot->eid_active]);
 
     m_security_callback(slot_no, ES_SECURITY_MSG_EID);
 }
 
 
-/**@brief Generates a temporary key with the Identity key. */
-static void temp_key_generate(uint8_t slot_no)
+/**@brief Computes the EID for the next rotation of a slot into the inactive EID buffer. */
+static void eid_precompute(uint8_t slot_no)
 {
-    ret_code_t  err_code;
-    size_t      ciphertext_size = AES_ECB_CIPHERTEXT_LENGTH;
+    es_security_slot_t * p_slot    = &m_security_slot[slot_no];
+    uint32_t             next_time = p_slot->eid_time + (1UL << p_slot->timing.k_scaler);
 
-    memset(m_security_slot[slot_no].aes_ecb_ik.cleartext, 0, ESCS_AES_KEY_SIZE);
-    m_security_slot[slot_no].aes_ecb_ik.cleartext[11] = 0xFF;
-    m_security_slot[slot_no].aes_ecb_ik.cleartext[14] =
-        (uint8_t)((m_security_slot[slot_no].timing.time_counter >> 24) & 0xff);
-    m_security_slot[slot_no].aes_ecb_ik.cleartext[15] =
-        (uint8_t)((m_security_slot[slot_no].timing.time_counter >> 16) & 0xff);
+    eid_compute(slot_no, next_time, p_slot->eid[p_slot->eid_active ^ 1]);
 
-    err_code = nrf_crypto_aes_crypt(&m_aes_context,
-                                    &g_nrf_crypto_aes_ecb_128_info,
-                                    NRF_CRYPTO_ENCRYPT,                             // Operation
-                                    m_security_slot[slot_no].aes_ecb_ik.key,        // Key
-                                    NULL,                                           // IV
-                                    m_security_slot[slot_no].aes_ecb_ik.cleartext,  // Data in
-                                    AES_ECB_CLEARTEXT_LENGTH,                       // Data in size
-                                    m_security_slot[slot_no].aes_ecb_ik.ciphertext, // Data out
-                                    &ciphertext_size);                              // Data out size
-
-    APP_ERROR_CHECK(err_code);
-
-    memcpy(m_security_slot[slot_no].aes_ecb_tk.key,
-           m_security_slot[slot_no].aes_ecb_ik.ciphertext,
-           ESCS_AES_KEY_SIZE);
+    p_slot->eid_next_time  = next_time;
+    p_slot->eid_next_ready = true;
 }
 
 
 /**@brief See if EID should be re-calculated.
+ *
+ * @details At a rotation, the precomputed EID is swapped in if it is for the new time. Otherwise,
+ *          the EID is generated on the spot.
+ *
+ * @return True if the EID has changed.
  */
-static void check_rollovers_and_update_eid(uint8_t slot_no)
+static bool check_rollovers_and_update_eid(uint8_t slot_no)
 {
-    static uint32_t last_invocation_time_counter = 0;
-    uint32_t scaler = 2 << (m_security_slot[slot_no].timing.k_scaler - 1);
-    uint32_t diff;
+    es_security_slot_t * p_slot = &m_security_slot[slot_no];
+    uint32_t             time   = k_bits_cleared_time_get(slot_no, p_slot->timing.time_counter);
 
-    if (last_invocation_time_counter == 0)
+    if (time == p_slot->eid_time)
     {
-        last_invocation_time_counter = m_security_slot[slot_no].timing.time_counter;
+        return false;
     }
 
-    diff = m_security_slot[slot_no].timing.time_counter - last_invocation_time_counter;
-
-    if (diff >= scaler)
+    if (p_slot->eid_next_ready && (p_slot->eid_next_time == time))
     {
-        // Store to last scaler-aligned time.
-        last_invocation_time_counter = (m_security_slot[slot_no].timing.time_counter / scaler) * scaler;
+        p_slot->eid_active    ^= 1;
+        p_slot->eid_time       = time;
+        p_slot->eid_next_ready = false;
 
+        m_security_callback(slot_no, ES_SECURITY_MSG_EID);
+    }
+    else
+    {
         eid_generate(slot_no);
     }
+    return true;
 }
 
 
@@ -229,12 +273,25 @@ void es_security_update_time(void)
 
     if (second_since_last_invocation > 0)
     {
+        bool rotated = false;
+
         for (uint32_t i = 0; i < APP_MAX_EID_SLOTS; ++i)
         {
             if (m_security_slot[i].is_occupied)
             {
                 m_security_slot[i].timing.time_counter += second_since_last_invocation;
-                check_rollovers_and_update_eid(i);
+                rotated |= check_rollovers_and_update_eid(i);
+            }
+        }
+
+        // Move the AES work for the next rotation away from the rotation instant. Only one
+        // slot is served per invocation to spread the work of multiple EID slots.
+        for (uint32_t i = 0; (i < APP_MAX_EID_SLOTS) && !rotated; ++i)
+        {
+            if (m_security_slot[i].is_occupied && !m_security_slot[i].eid_next_ready)
+            {
+                eid_precompute(i);
+                break;
             }
         }
 
@@ -264,6 +321,7 @@ void es_security_eid_slots_restore(uint8_t         slot_no,
     m_security_slot[slot_no].timing.k_scaler     = k_scaler;
     m_security_slot[slot_no].timing.time_counter = time_counter;
     memcpy(m_security_slot[slot_no].aes_ecb_ik.key, p_ik, ESCS_AES_KEY_SIZE);
+    m_security_slot[slot_no].tk_valid    = false;
     m_security_slot[slot_no].is_occupied = true;
     m_security_callback(slot_no, ES_SECURITY_MSG_IK);
     eid_generate(slot_no);
@@ -350,13 +408,21 @@ void es_security_shared_ik_receive(uint8_t slot_no, uint8_t * p_encrypted_ik, ui
 
     APP_ERROR_CHECK(err_code);
 
+    m_security_slot[slot_no].tk_valid = false;
+
     eid_generate(slot_no);
 
     m_security_callback(slot_no, ES_SECURITY_MSG_IK);
 }
 
 
-void es_security_client_pub_ecdh_receive(uint8_t slot_no, uint8_t * p_pub_ecdh, uint8_t scaler_k)
+/**@brief Derives the Identity key of a slot from the public ECDH key of the phone.
+ *
+ * @param[in] slot_no    The index of the slot.
+ * @param[in] p_pub_ecdh Public 32-byte ECDH key of the phone.
+ * @param[in] scaler_k   Rotation period exponent.
+ */
+static void ecdh_exchange(uint8_t slot_no, uint8_t const * p_pub_ecdh, uint8_t scaler_k)
 {
     ret_code_t                  err_code;
     nrf_crypto_ecc_public_key_t phone_public;                       // Phone public ECDH key
@@ -432,6 +498,7 @@ void es_security_client_pub_ecdh_receive(uint8_t slot_no, uint8_t * p_pub_ecdh,
 
     // Truncate the key material to 128 bits to convert it to an AES-128 secret key (Identity key).
     memcpy(m_security_slot[slot_no].aes_ecb_ik.key, key_material, ESCS_AES_KEY_SIZE);
+    m_security_slot[slot_no].tk_valid = false;
 
     eid_generate(slot_no);
 
@@ -440,6 +507,46 @@ void es_security_client_pub_ecdh_receive(uint8_t slot_no, uint8_t * p_pub_ecdh,
 }
 
 
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+/**@brief Runs the ECDH key exchange of a slot from the crypto job queue. */
+static ret_code_t ecdh_job_run(nrf_crypto_jobq_job_t * p_job)
+{
+    uint8_t              slot_no = (uint8_t)(uintptr_t)p_job->p_context;
+    es_security_slot_t * p_slot  = &m_security_slot[slot_no];
+
+    ecdh_exchange(slot_no, p_slot->ecdh_pub, p_slot->ecdh_scaler_k);
+
+    return NRF_SUCCESS;
+}
+#endif
+
+
+void es_security_client_pub_ecdh_receive(uint8_t slot_no, uint8_t * p_pub_ecdh, uint8_t scaler_k)
+{
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+    ret_code_t           err_code;
+    es_security_slot_t * p_slot = &m_security_slot[slot_no];
+
+    // The exchange takes a while, so it runs from the scheduler. The slot is taken into use and
+    // reported through the callback when the Identity key is ready. A newer key replaces one
+    // whose exchange has not started yet.
+    UNUSED_RETURN_VALUE(nrf_crypto_jobq_cancel(&p_slot->ecdh_job));
+
+    memcpy(p_slot->ecdh_pub, p_pub_ecdh, ESCS_ECDH_KEY_SIZE);
+    p_slot->ecdh_scaler_k = scaler_k;
+
+    err_code = nrf_crypto_jobq_submit(&p_slot->ecdh_job,
+                                      NRF_CRYPTO_JOBQ_PRIO_NORMAL,
+                                      ecdh_job_run,
+                                      NULL,
+                                      (void *)(uintptr_t)slot_no);
+    APP_ERROR_CHECK(err_code);
+#else
+    ecdh_exchange(slot_no, p_pub_ecdh, scaler_k);
+#endif
+}
+
+
 void es_security_pub_ecdh_get(uint8_t slot_no, uint8_t * p_edch_buffer)
 {
     ret_code_t  err_code;
@@ -461,6 +568,9 @@ uint32_t es_security_clock_get(uint8_t slot_no)
 
 void es_security_eid_slot_destroy(uint8_t slot_no)
 {
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+    UNUSED_RETURN_VALUE(nrf_crypto_jobq_cancel(&m_security_slot[slot_no].ecdh_job));
+#endif
     memset(&m_security_slot[slot_no], 0, sizeof(es_security_slot_t));
 }
 
@@ -473,7 +583,9 @@ uint8_t es_security_scaler_get(uint8_t slot_no)
 
 void es_security_eid_get(uint8_t slot_no, uint8_t * p_eid_buffer)
 {
-    memcpy(p_eid_buffer, m_security_slot[slot_no].eid, ES_EID_ID_LENGTH);
+    memcpy(p_eid_buffer,
+           m_security_slot[slot_no].eid[m_security_slot[slot_no].eid_active],
+           ES_EID_ID_LENGTH);
 }
 
 
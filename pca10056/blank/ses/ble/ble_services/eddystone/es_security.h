@@ -167,6 +167,8 @@ uint32_t es_security_clock_get(uint8_t slot_no);
  *
  * @details This function checks how much time has passed since the last
  * invocation and, if required, updates the EID, the temporary key, or both.
+ * The EID for the next rotation of a slot is computed ahead of time, in an
+ * invocation where no slot rotates, so that a rotation only swaps buffers.
  * The function generates an @ref ES_SECURITY_MSG_STORE_TIME event
  * for each active security slot every 24 hours.
  */
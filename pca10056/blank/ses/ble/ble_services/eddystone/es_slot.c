@@ -48,6 +48,7 @@
 
 static es_slot_reg_t m_reg;             //!< Slot registry.
 static bool m_eid_loaded_from_flash;    //!< Set to true if EID slot has been loaded from flash.
+static es_slot_adv_cache_t m_adv_caches[APP_MAX_ADV_SLOTS]; //!< Encoded advertising data of each slot.
 
 #define RANGING_DATA_INDEX  (1)         //!< Index of ranging data within frames that contain ranging data.
 #define RANGING_DATA_LENGTH (1)         //!< Length of ranging data.
@@ -65,6 +66,16 @@ static void slot_boundary_check(uint8_t * p_slot)
 }
 
 
+/**@brief Function for marking the encoded advertising data of a slot as outdated.
+ *
+ * @param[in] slot_no       Slot number whose frame has changed.
+ */
+static void adv_cache_invalidate(uint8_t slot_no)
+{
+    m_adv_caches[slot_no].valid = false;
+}
+
+
 /**@brief Function loading slot data from flash.
  *
  * @param[in] slot_no       Slot number to be used.
@@ -77,6 +88,7 @@ static void load_slot_from_flash(uint8_t slot_no)
     if (err_code != FDS_ERR_NOT_FOUND)
     {
         APP_ERROR_CHECK(err_code);
+        adv_cache_invalidate(slot_no);
 
         if (m_reg.slots[slot_no].adv_frame.type == ES_FRAME_TYPE_EID)
         {
@@ -154,6 +166,8 @@ static void set_ranging_data_for_slot(uint8_t slot_no, nrf_ble_escs_radio_tx_pwr
             APP_ERROR_CHECK(NRF_ERROR_INVALID_PARAM);
             break;
     }
+
+    adv_cache_invalidate(slot_no);
 }
 
 
@@ -295,6 +309,8 @@ void es_slot_on_write(uint8_t slot_no, uint8_t length, uint8_t const * p_frame_d
         APP_ERROR_CHECK(NRF_ERROR_NULL);
     }
 
+    adv_cache_invalidate(slot_no);
+
     // Cleared
     if (length == 0 || (length == 1 && p_frame_data[0] == 0))
     {
@@ -369,6 +385,7 @@ void es_slot_tlm_update(void)
     if (m_reg.tlm_configured)
     {
         es_tlm_tlm_get(&m_reg.slots[m_reg.tlm_slot].adv_frame.frame.tlm);
+        adv_cache_invalidate(m_reg.tlm_slot);
     }
 }
 
@@ -390,6 +407,15 @@ void es_slot_etlm_update(uint8_t eid_slot_no)
 
     memcpy(&m_reg.slots[m_reg.tlm_slot].adv_frame.frame.etlm, &etlm, sizeof(es_etlm_frame_t));
     m_reg.slots[m_reg.tlm_slot].adv_frame.length = sizeof(es_etlm_frame_t);
+    adv_cache_invalidate(m_reg.tlm_slot);
+}
+
+
+es_slot_adv_cache_t * es_slot_adv_cache_get(uint8_t slot_no)
+{
+    slot_boundary_check(&slot_no);
+
+    return &m_adv_caches[slot_no];
 }
 
 
@@ -405,6 +431,7 @@ void es_slots_init(const es_slot_t * p_default_slot)
     es_flash_flags_t flash_flags = {{0}};
 
     es_slot_reg_init(&m_reg);
+    memset(m_adv_caches, 0, sizeof(m_adv_caches));
 
     m_eid_loaded_from_flash = false;
 
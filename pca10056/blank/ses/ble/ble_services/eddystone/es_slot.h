@@ -43,6 +43,7 @@
 #include <stdint.h>
 #include "es_app_config.h"
 #include "nrf_ble_escs.h"
+#include "ble_gap.h"
 
 /**
  * @file
@@ -98,6 +99,18 @@ typedef struct
     uint8_t   enc_key[ESCS_AES_KEY_SIZE];
 } es_slot_reg_t;
 
+/**@brief Encoded advertising data of a slot.
+ *
+ * @details The data is encoded once and reused for every advertising event of the slot until the
+ *          slot is reconfigured, its EID rotates or its TLM data is refreshed.
+ */
+typedef struct
+{
+    uint8_t  data[BLE_GAP_ADV_SET_DATA_SIZE_MAX]; //!< Encoded advertising data.
+    uint16_t len;                                 //!< Length of the encoded advertising data.
+    bool     valid;                               //!< Flag that specifies if the data matches the current frame of the slot.
+} es_slot_adv_cache_t;
+
 /**@brief Function for initializing the Eddystone slots with default values.
  *
  * @details This function synchronizes all slots with the initial values.
@@ -185,6 +198,14 @@ void es_slot_etlm_update(uint8_t eid_slot_no);
  */
 const es_slot_reg_t * es_slot_get_registry(void);
 
+/**@brief Function for getting the encoded advertising data cache of a slot.
+ *
+ * @param[in]       slot_no         The index of the slot.
+ *
+ * @return  A pointer to the cache of the slot.
+ */
+es_slot_adv_cache_t * es_slot_adv_cache_get(uint8_t slot_no);
+
 /**@brief Function for setting a custom advertisement TX power for a given slot.
  *
  * @parameternoteslot
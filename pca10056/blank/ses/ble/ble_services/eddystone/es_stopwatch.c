@@ -44,30 +44,31 @@
 #include "es_stopwatch.h"
 #include "sdk_macros.h"
 #include "app_timer.h"
+#include "app_timer_timestamp.h"
 #include "es_app_config.h"
 
-static uint32_t m_ticks_last_returned[ES_STOPWATCH_MAX_USERS];
+static uint64_t m_ticks_last_returned[ES_STOPWATCH_MAX_USERS];
 static uint32_t m_ids_ticks_wrap[ES_STOPWATCH_MAX_USERS];
 static uint8_t  m_nof_ids     = 0;
 static bool     m_initialized = false;
 
 uint32_t es_stopwatch_check(es_stopwatch_id_t id)
 {
-    uint32_t ticks_current = app_timer_cnt_get();
-    uint32_t ticks_diff;
+    uint64_t ticks_current = app_timer_timestamp_get();
+    uint64_t ticks_diff;
 
     if (m_ids_ticks_wrap[id] == 0)
     {
         APP_ERROR_CHECK(NRF_ERROR_INVALID_STATE);
     }
 
-    ticks_diff = app_timer_cnt_diff_compute(ticks_current, m_ticks_last_returned[id]);
+    ticks_diff = ticks_current - m_ticks_last_returned[id];
 
     if (ticks_diff >= m_ids_ticks_wrap[id])
     {
         m_ticks_last_returned[id] = (ticks_current / m_ids_ticks_wrap[id]) * m_ids_ticks_wrap[id];
 
-        return ticks_diff / m_ids_ticks_wrap[id];
+        return (uint32_t)(ticks_diff / m_ids_ticks_wrap[id]);
     }
 
     return 0;
@@ -48,20 +48,29 @@
 
 #define TICKS_100_MS APP_TIMER_TICKS(100) //!< Tick count for 100ms.
 
+#ifndef APP_CONFIG_TLM_VBATT_UPDATE_INTERVAL_SECONDS
+#define APP_CONFIG_TLM_VBATT_UPDATE_INTERVAL_SECONDS APP_CONFIG_TLM_TEMP_VBATT_UPDATE_INTERVAL_SECONDS
+#endif
+
+#ifndef APP_CONFIG_TLM_TEMP_UPDATE_INTERVAL_SECONDS
+#define APP_CONFIG_TLM_TEMP_UPDATE_INTERVAL_SECONDS APP_CONFIG_TLM_TEMP_VBATT_UPDATE_INTERVAL_SECONDS
+#endif
+
 static es_tlm_frame_t    m_tlm;
 static uint32_t          m_le_adv_cnt;
 static es_stopwatch_id_t m_time_sec_sw_id;
-static es_stopwatch_id_t m_tlm_refresh_sw_id;
+static uint32_t          m_time_total_100_ms;  //!< Time since initialization, in 0.1 seconds.
+static uint32_t          m_vbatt_updated_100_ms; //!< Time of the last VBATT update, in 0.1 seconds.
+static uint32_t          m_temp_updated_100_ms;  //!< Time of the last TEMP update, in 0.1 seconds.
 
 /**@brief Function for updating the ADV_SEC field of TLM*/
 static void update_time(void)
 {
-    static uint32_t time_total_100_ms = 0;
-    uint32_t        be_time_100_ms; // Big endian version of 0.1 second counter.
+    uint32_t be_time_100_ms; // Big endian version of 0.1 second counter.
 
-    time_total_100_ms += es_stopwatch_check(m_time_sec_sw_id);
+    m_time_total_100_ms += es_stopwatch_check(m_time_sec_sw_id);
 
-    be_time_100_ms = BYTES_REVERSE_32BIT(time_total_100_ms);
+    be_time_100_ms = BYTES_REVERSE_32BIT(m_time_total_100_ms);
 
     memcpy(m_tlm.sec_cnt, &be_time_100_ms, ES_TLM_SEC_CNT_LENGTH);
 }
@@ -70,6 +79,8 @@ static void update_time(void)
 /**@brief Function for updating the TEMP field of TLM*/
 static void update_temp(void)
 {
+    m_temp_updated_100_ms = m_time_total_100_ms;
+
     int32_t temp;                                        // variable to hold temp reading
     (void)sd_temp_get(&temp);                            // get new temperature
     int16_t temp_new = (int16_t) temp;                   // convert from int32_t to int16_t
@@ -81,6 +92,8 @@ static void update_temp(void)
 /**@brief Function for updating the VBATT field of TLM*/
 static void update_vbatt(void)
 {
+    m_vbatt_updated_100_ms = m_time_total_100_ms;
+
     uint16_t vbatt;                 // Variable to hold voltage reading
     es_battery_voltage_get(&vbatt); // Get new battery voltage
     m_tlm.vbatt[0] = (uint8_t)(vbatt >> 8);
@@ -101,9 +114,18 @@ void es_tlm_tlm_get(es_tlm_frame_t * p_tlm_frame)
     update_time();
     update_adv_cnt();
 
-    if (es_stopwatch_check(m_tlm_refresh_sw_id) > 0)
+    // The sensors are only sampled when their field is due, not for every frame. The stopwatch
+    // of the ADV_SEC field is used as the time base, since app_timer counter differences
+    // cannot express intervals of several minutes.
+    if (m_time_total_100_ms - m_temp_updated_100_ms >=
+        APP_CONFIG_TLM_TEMP_UPDATE_INTERVAL_SECONDS * 10UL)
     {
         update_temp();
+    }
+
+    if (m_time_total_100_ms - m_vbatt_updated_100_ms >=
+        APP_CONFIG_TLM_VBATT_UPDATE_INTERVAL_SECONDS * 10UL)
+    {
         update_vbatt();
     }
 
@@ -126,15 +148,12 @@ void es_tlm_init(void)
     m_tlm.version    = ES_TLM_VERSION_TLM;
     m_le_adv_cnt     = 0;
 
+    m_time_total_100_ms = 0;
+
     update_time();
     update_vbatt();
     update_temp();
 
     err_code = es_stopwatch_create(&m_time_sec_sw_id, APP_TIMER_TICKS(100));
     APP_ERROR_CHECK(err_code);
-
-    err_code = es_stopwatch_create(
-        &m_tlm_refresh_sw_id,
-        APP_TIMER_TICKS(APP_CONFIG_TLM_TEMP_VBATT_UPDATE_INTERVAL_SECONDS * 1000));
-    APP_ERROR_CHECK(err_code);
 }
@@ -182,6 +182,7 @@ static void on_ble_evt(ble_evt_t const * p_ble_evt)
             APP_ERROR_CHECK(err_code);
 
             es_flash_beacon_config_t beacon_config;
+            memset(&beacon_config, 0, sizeof(beacon_config)); // Padding is compared by es_flash.
             beacon_config.adv_interval       = es_adv_interval_get();
             beacon_config.remain_connectable = es_adv_remain_connectable_get();
 
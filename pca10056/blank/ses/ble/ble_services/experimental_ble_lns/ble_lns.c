@@ -79,6 +79,10 @@ NRF_LOG_MODULE_REGISTER();
 #define NAV_FLAG_WAYPOINT_REACHED                        (0x01 << 7)         /**< Waypoint Reached bit. */
 #define NAV_FLAG_DESTINATION_REACHED                     (0x01 << 8)         /**< Destination Reached bit. */
 
+#define OPCODE_LENGTH                                   1  /**< Length of opcode inside a notification. */
+#define HANDLE_LENGTH                                   2  /**< Length of handle inside a notification. */
+#define BLE_LNS_LOC_SPEED_DEFAULT_LEN                   (BLE_GATT_ATT_MTU_DEFAULT - OPCODE_LENGTH - HANDLE_LENGTH) /**< Maximum Location and Speed notification length with the default ATT MTU. */
+
 #define BLE_LNS_NAV_MAX_LEN                             19 /**< The length of a navigation notification when all features are enabled. See @ref ble_lns_navigation_t to see what this represents, or check https://developer.bluetooth.org/gatt/characteristics/Pages/CharacteristicViewer.aspx?u=org.bluetooth.characteristic.navigation.xml. */
 
 
@@ -139,7 +143,8 @@ static void on_connect(ble_lns_t * p_lns, ble_evt_t const * p_ble_evt)
 {
     ret_code_t err_code;
 
-    p_lns->conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+    p_lns->conn_handle       = p_ble_evt->evt.gap_evt.conn_handle;
+    p_lns->max_loc_speed_len = BLE_LNS_LOC_SPEED_DEFAULT_LEN;
 
     // clear pending notifications
     p_lns->pending_loc_speed_notifications[0].is_pending    = false;
@@ -614,7 +619,7 @@ static ret_code_t loc_speed_char_add(ble_lns_t * p_lns, ble_lns_init_t const * p
     memset(&add_char_params, 0, sizeof(add_char_params));
 
     add_char_params.uuid              = BLE_UUID_LN_LOCATION_AND_SPEED_CHAR;
-    add_char_params.max_len           = BLE_GATT_ATT_MTU_DEFAULT ;
+    add_char_params.max_len           = BLE_LNS_LOC_SPEED_MAX_LEN;
     add_char_params.init_len          = len;
     add_char_params.p_init_value      = &encoded_initial_loc_speed1[0];
     add_char_params.is_var_len        = true;
@@ -822,6 +827,7 @@ ret_code_t ble_lns_init(ble_lns_t * p_lns, ble_lns_init_t const * p_lns_init)
     p_lns->available_features    = p_lns_init->available_features;
     p_lns->is_navigation_present = p_lns_init->is_navigation_present;
     p_lns->p_gatt_queue          = p_lns_init->p_gatt_queue;
+    p_lns->max_loc_speed_len     = BLE_LNS_LOC_SPEED_DEFAULT_LEN;
 
     // clear pending notifications
     p_lns->pending_loc_speed_notifications[0].is_pending = false;
@@ -930,31 +936,46 @@ ret_code_t ble_lns_loc_speed_send(ble_lns_t * p_lns)
     notif1->is_pending = false;
     notif2->is_pending = false;
 
-    // check if it is necessary to send packet 1
-    if (p_lns->available_features & (BLE_LNS_FEATURE_INSTANT_SPEED_SUPPORTED
-                                    | BLE_LNS_FEATURE_TOTAL_DISTANCE_SUPPORTED
-                                    | BLE_LNS_FEATURE_LOCATION_SUPPORTED))
+    bool const packet1_needed = (p_lns->available_features & (BLE_LNS_FEATURE_INSTANT_SPEED_SUPPORTED
+                                                              | BLE_LNS_FEATURE_TOTAL_DISTANCE_SUPPORTED
+                                                              | BLE_LNS_FEATURE_LOCATION_SUPPORTED)) != 0;
+    bool       packet2_needed = (p_lns->available_features & (BLE_LNS_FEATURE_ELEVATION_SUPPORTED
+                                                              | BLE_LNS_FEATURE_HEADING_SUPPORTED
+                                                              | BLE_LNS_FEATURE_ROLLING_TIME_SUPPORTED
+                                                              | BLE_LNS_FEATURE_UTC_TIME_SUPPORTED)) != 0;
+
+    if (packet1_needed)
     {
-        // encode
-        notif1->len        = loc_speed_encode_packet1(p_lns, p_lns->p_location_speed, &notif1->data[0]);
-        notif1->handle     = p_lns->loc_speed_handles.value_handle;
-        notif1->is_pending = true;
+        notif1->len    = loc_speed_encode_packet1(p_lns, p_lns->p_location_speed, &notif1->data[0]);
+        notif1->handle = p_lns->loc_speed_handles.value_handle;
+    }
 
-        // send
-        notification_buffer_process(p_lns);
+    if (packet2_needed)
+    {
+        notif2->len    = loc_speed_encode_packet2(p_lns, p_lns->p_location_speed, &notif2->data[0]);
+        notif2->handle = p_lns->loc_speed_handles.value_handle;
     }
 
-    // check if it is necessary to send packet 2
-    if (p_lns->available_features & (BLE_LNS_FEATURE_ELEVATION_SUPPORTED
-                                    | BLE_LNS_FEATURE_HEADING_SUPPORTED
-                                    | BLE_LNS_FEATURE_ROLLING_TIME_SUPPORTED
-                                    | BLE_LNS_FEATURE_UTC_TIME_SUPPORTED))
+    // If the whole record fits in one notification, merge packet 2 into packet 1.
+    if (packet1_needed && packet2_needed &&
+        (notif1->len + notif2->len - sizeof(uint16_t) <= p_lns->max_loc_speed_len))
     {
-        notif2->len        = loc_speed_encode_packet2(p_lns, p_lns->p_location_speed, &notif2->data[0]);
-        notif2->handle     = p_lns->loc_speed_handles.value_handle;
-        notif2->is_pending = true;
+        uint16_t const flags = uint16_decode(&notif1->data[0]) | uint16_decode(&notif2->data[0]);
+
+        memcpy(&notif1->data[notif1->len], &notif2->data[sizeof(uint16_t)], notif2->len - sizeof(uint16_t));
+        notif1->len += notif2->len - sizeof(uint16_t);
+        uint16_encode(flags, &notif1->data[0]); //lint !e534 "Ignoring return value of function"
+
+        packet2_needed = false;
+    }
+
+    notif1->is_pending = packet1_needed;
+    notif2->is_pending = packet2_needed;
 
-        // send
+    // send
+    notification_buffer_process(p_lns);
+    if (packet2_needed)
+    {
         notification_buffer_process(p_lns);
     }
 
@@ -1001,6 +1022,19 @@ ret_code_t ble_lns_navigation_send(ble_lns_t * p_lns)
 }
 
 
+void ble_lns_on_gatt_evt(ble_lns_t * p_lns, nrf_ble_gatt_evt_t const * p_gatt_evt)
+{
+    VERIFY_PARAM_NOT_NULL_VOID(p_lns);
+    VERIFY_PARAM_NOT_NULL_VOID(p_gatt_evt);
+
+    if (    (p_lns->conn_handle == p_gatt_evt->conn_handle)
+        &&  (p_gatt_evt->evt_id == NRF_BLE_GATT_EVT_ATT_MTU_UPDATED))
+    {
+        p_lns->max_loc_speed_len = p_gatt_evt->params.att_mtu_effective - OPCODE_LENGTH - HANDLE_LENGTH;
+    }
+}
+
+
 ret_code_t ble_lns_add_route(ble_lns_t * p_lns, ble_lns_route_t * p_route)
 {
     VERIFY_PARAM_NOT_NULL(p_lns);
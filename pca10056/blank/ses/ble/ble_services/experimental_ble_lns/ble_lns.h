@@ -69,6 +69,7 @@
 #include "sdk_common.h"
 #include "nrf_sdh_ble.h"
 #include "nrf_ble_gq.h"
+#include "nrf_ble_gatt.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -103,6 +104,8 @@ typedef struct
     ble_lns_evt_type_t evt_type;
 } ble_lns_evt_t;
 
+#define BLE_LNS_LOC_SPEED_MAX_LEN 28   /**< The length of a Location and Speed record when all fields are present. Sent as a single notification when the ATT MTU allows it. */
+
 // Forward declarations of the ble_lns types.
 typedef struct ble_lns_init_s        ble_lns_init_t;
 typedef struct ble_lns_s             ble_lns_t;
@@ -116,7 +119,7 @@ typedef struct
     bool     is_pending;
     uint16_t handle;
     uint16_t len;
-    uint8_t  data[BLE_GATT_ATT_MTU_DEFAULT];
+    uint8_t  data[BLE_LNS_LOC_SPEED_MAX_LEN];
 } notification_t;
 
 
@@ -181,7 +184,8 @@ struct ble_lns_s
     bool                          is_loc_speed_notification_enabled;    /**< True if notification is enabled on the Location and Speed characteristic. */
     bool                          is_nav_notification_enabled;          /**< True if notification is enabled on the Navigation characteristic. */
 
-    notification_t                pending_loc_speed_notifications[2];   /**< This buffer holds location and speed notifications. */
+    uint16_t                      max_loc_speed_len;                    /**< Current maximum Location and Speed notification length, adjusted according to the current ATT MTU. */
+    notification_t                pending_loc_speed_notifications[2];   /**< This buffer holds location and speed notifications. A new record replaces any of them that are still unsent. */
     notification_t                pending_navigation_notification;      /**< This buffer holds navigation notifications. */
     ble_lns_loc_speed_t         * p_location_speed;                     /**< Location and Speed. */
     ble_lns_pos_quality_t       * p_position_quality;                   /**< Position measurement quality. */
@@ -319,11 +323,24 @@ ret_code_t ble_lns_init(ble_lns_t * p_lns, ble_lns_init_t const * p_lns_init);
 void ble_lns_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
 
 
+/**@brief   Function for handling the GATT module's events.
+ *
+ * @details Handles all events from the GATT module of interest to the Location and Navigation
+ *          Service. Once the ATT MTU allows it, a Location and Speed record is sent as a single
+ *          notification instead of being split into two.
+ *
+ * @param[in]   p_lns       Location and Navigation Service structure.
+ * @param[in]   p_gatt_evt  Event received from the GATT module.
+ */
+void ble_lns_on_gatt_evt(ble_lns_t * p_lns, nrf_ble_gatt_evt_t const * p_gatt_evt);
+
+
 /**@brief   Function for sending location and speed data if notification has been enabled.
  *
  * @details The application calls this function after having performed a location and speed determination.
  *          If notification has been enabled, the location and speed data is encoded and sent to
- *          the client.
+ *          the client. Packets of a previous record that could not be sent yet are replaced, so
+ *          the client always receives the latest fix.
  *
  * @param[in]   p_lns   Location and Navigation Service structure holding the location and speed data.
  *
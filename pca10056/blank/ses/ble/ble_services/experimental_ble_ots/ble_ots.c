@@ -43,6 +43,7 @@
 #include "ble_ots.h"
 #include "ble_ots_object.h"
 #include "ble_ots_oacp.h"
+#include "ble_ots_olcp.h"
 #include "fds.h"
 
 #define BLE_OTS_MAX_OBJ_TYPE_SIZE               16
@@ -76,10 +77,12 @@
  *
  * @param[in]   p_ots                   Object Transfer Service structure.
  * @param[in]   read_access             Read security level for the feature characteristic.
+ * @param[in]   olcp_supported          True if the service has an object directory.
  * @param[in]   p_feature_char_handles  Pointer to the handles for the feature characteristic.
  */
 static uint32_t feature_char_add(ble_ots_t * const          p_ots,
                                  security_req_t             read_access,
+                                 bool                       olcp_supported,
                                  ble_gatts_char_handles_t * p_feature_char_handles)
 {
     ble_add_char_params_t add_char_params;
@@ -97,6 +100,12 @@ static uint32_t feature_char_add(ble_ots_t * const          p_ots,
     oacp_features |= (1 << BLE_OTS_OACP_SUPPORT_FEATURE_ABORT_bp);
 
     olcp_features = 0;
+    if (olcp_supported)
+    {
+        olcp_features |= (1 << BLE_OTS_OLCP_SUPPORT_FEATURE_GOTO_bp);
+        olcp_features |= (1 << BLE_OTS_OLCP_SUPPORT_FEATURE_REQ_NUM_OBJECTS_bp);
+        olcp_features |= (1 << BLE_OTS_OLCP_SUPPORT_FEATURE_CLEAR_MARKING_bp);
+    }
 
     uint32_t i = 0;
     i += uint32_encode(oacp_features, &feature[i]);
@@ -155,7 +164,7 @@ uint32_t ble_ots_init(ble_ots_t * p_ots, ble_ots_init_t * p_ots_init)
         return NRF_ERROR_NULL;
     }
 
-    if (p_ots_init->p_object == NULL)
+    if ((p_ots_init->p_object == NULL) && (p_ots_init->olcp_init.pp_objects == NULL))
     {
         return NRF_ERROR_NULL;
     }
@@ -195,7 +204,10 @@ uint32_t ble_ots_init(ble_ots_t * p_ots, ble_ots_init_t * p_ots_init)
         return err_code;
     }
 
-    err_code = feature_char_add(p_ots, p_ots_init->feature_char_read_access, &p_ots->feature_handles);
+    err_code = feature_char_add(p_ots,
+                                p_ots_init->feature_char_read_access,
+                                (p_ots_init->olcp_init.pp_objects != NULL),
+                                &p_ots->feature_handles);
     if (err_code != NRF_SUCCESS)
     {
         return err_code;
@@ -212,6 +224,12 @@ uint32_t ble_ots_init(ble_ots_t * p_ots, ble_ots_init_t * p_ots_init)
     {
         return err_code;
     }
+    err_code = ble_ots_olcp_init(&p_ots->olcp_chars, &p_ots_init->olcp_init);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
     p_ots->oacp_chars.ots_l2cap.conn_mps = p_ots_init->rx_mps;
     p_ots->oacp_chars.ots_l2cap.conn_mtu = p_ots_init->rx_mtu;
 
@@ -230,6 +248,7 @@ void ble_ots_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
     }
     ble_ots_oacp_on_ble_evt(&p_ots->oacp_chars, p_ble_evt);
     ble_ots_object_on_ble_evt(&p_ots->object_chars, p_ble_evt);
+    ble_ots_olcp_on_ble_evt(&p_ots->olcp_chars, p_ble_evt);
 
     switch (p_ble_evt->header.evt_id)
     {
@@ -81,11 +81,17 @@ NRF_SDH_BLE_OBSERVER(_name ## _ble_obs,
 #define BLE_OTS_MAX_OACP_SIZE           21
 #define BLE_OTS_WRITE_MODE_TRUNCATE     (1 << 1)
 #define BLE_OTS_WRITE_MODE_NO_TRUNCATE  0
+#define BLE_OTS_OBJ_ID_LEN              6      /**< Length of an object ID in bytes. */
+#define BLE_OTS_OBJ_ID_FIRST            0x100  /**< ID of the first object of a directory. Lower IDs are reserved. */
+#define BLE_OTS_MAX_OLCP_SIZE           7
+#define BLE_OTS_OLCP_NO_OBJECT          0xFFFF /**< No object of the directory is selected. */
+#define BLE_OTS_MAX_LIST_FILTER_SIZE    (1 + BLE_OTS_NAME_MAX_SIZE)
 
 // Forward declarations.
 typedef struct ble_ots_s ble_ots_t;
 typedef struct ble_ots_oacp_s ble_ots_oacp_t;
 typedef struct ble_ots_l2cap_s ble_ots_l2cap_t;
+typedef struct ble_ots_olcp_s ble_ots_olcp_t;
 
 
 /*------------------------------------------ BLE OTS OBJECT --------------------------------------*/
@@ -118,11 +124,42 @@ typedef struct
     } param;
 } ble_ots_obj_type_t;
 
+/**@brief Handler a storage backend calls when it can accept data again after returning
+ *        NRF_ERROR_BUSY.
+ *
+ * @param[in] p_ready_context The context given to the open function of the backend.
+ */
+typedef void (*ble_ots_obj_backend_ready_handler_t)(void * p_ready_context);
+
+/**@brief Storage backend of an object.
+ *
+ * @details An object with a backend is not kept in RAM. The L2CAP module reads and writes it one
+ *          SDU at a time, so the object can be as large as the storage. A transfer is started with
+ *          open, continued with read or write at successive offsets, and ended with close.
+ *          write and close may return NRF_ERROR_BUSY while the backend is storing earlier data.
+ *          The backend then calls the ready handler, and the call is repeated. close only
+ *          succeeds once all written data is in storage.
+ */
+typedef struct
+{
+    uint32_t (*open)(void                              * p_context,
+                     uint32_t                            offset,
+                     uint32_t                            len,
+                     bool                                write,
+                     ble_ots_obj_backend_ready_handler_t ready_handler,
+                     void                              * p_ready_context);
+    uint32_t (*read)(void * p_context, uint32_t offset, uint8_t * p_data, uint16_t len);
+    uint32_t (*write)(void * p_context, uint32_t offset, uint8_t const * p_data, uint16_t len);
+    uint32_t (*close)(void * p_context);
+} ble_ots_obj_backend_t;
+
 /**@brief The structure representing one Object Transfer Service object. */
 typedef struct
 {
     uint8_t                  name[BLE_OTS_NAME_MAX_SIZE];    /**< The name of the object. If the name is "", the object will be invalidated on disconnect. */
-    uint8_t                  data[BLE_OTS_MAX_OBJ_SIZE];
+    uint8_t                  data[BLE_OTS_MAX_OBJ_SIZE];     /**< The object data, if the object has no storage backend. */
+    ble_ots_obj_backend_t const * p_backend;                 /**< Storage backend of the object, or NULL to keep the object in @p data. */
+    void                        * p_backend_context;         /**< Context passed to the functions of the backend. */
     uint32_t                 current_size;
     ble_ots_obj_type_t       type;
     ble_ots_obj_properties_t properties;
@@ -185,8 +222,8 @@ typedef struct
     ble_ots_l2cap_evt_type_t type;
     struct
     {
-        uint8_t  * p_data;
-        uint16_t   len;
+        uint8_t  * p_data;                                  /**< The object data, or NULL if the object has a storage backend. */
+        uint32_t   len;
     } param;
 } ble_ots_l2cap_evt_t;
 
@@ -210,9 +247,19 @@ struct ble_ots_l2cap_s
     ble_l2cap_ch_rx_params_t rx_params;
     ble_l2cap_ch_tx_params_t tx_params;
     uint16_t                 remaining_bytes;       /**< The number of remaining bytes in the current transfer. */
-    uint16_t                 transmitted_bytes;
-    uint16_t                 received_bytes;
-    uint16_t                 transfer_len;          /**< The total number of bytes in the current transfer. */
+    uint32_t                 transmitted_bytes;
+    uint32_t                 queued_bytes;          /**< The number of bytes of the current transfer handed to the SoftDevice for transmission. */
+    uint32_t                 received_bytes;
+    uint16_t                 tx_credits;            /**< The number of credits granted by the peer that are not yet claimed by a queued SDU. */
+    uint8_t                  rx_bufs_posted;        /**< The number of receive buffers currently held by the SoftDevice. */
+    uint8_t                  rx_buf_next;           /**< Index of the next receive buffer to post. */
+    uint8_t                  tx_bufs_queued;        /**< The number of SDU buffers queued for transmission when streaming from a backend. */
+    uint8_t                  tx_buf_next;           /**< Index of the next SDU buffer to fill when streaming from a backend. */
+    bool                     is_streaming;          /**< The current transfer reads or writes the storage backend of the current object. */
+    uint8_t                  rx_bufs_pending;       /**< The number of received SDUs the storage backend has not accepted yet. */
+    uint8_t                  rx_buf_oldest;         /**< Index of the oldest receive buffer that is pending or posted. */
+    uint32_t                 transfer_offset;       /**< The object offset of the current transfer. */
+    uint32_t                 transfer_len;          /**< The total number of bytes in the current transfer. */
     uint16_t                 local_cid;             /**< Connection ID of the current connection. */
     uint16_t                 conn_mtu;              /**< The maximum transmission unit, that is the number of packets that can be sent or received. */
     uint16_t                 conn_mps;              /**< MPS defines the maximum payload size in bytes. */
@@ -335,6 +382,104 @@ struct ble_ots_oacp_s
 };
 
 
+/*------------------------------------------ BLE OTS OLCP ----------------------------------------*/
+
+/**< Types of Object List Control Point Procedures. */
+typedef enum
+{
+    BLE_OTS_OLCP_PROC_FIRST         = 0x01, //!< Select the first object of the list.
+    BLE_OTS_OLCP_PROC_LAST          = 0x02, //!< Select the last object of the list.
+    BLE_OTS_OLCP_PROC_PREVIOUS      = 0x03, //!< Select the object before the current object.
+    BLE_OTS_OLCP_PROC_NEXT          = 0x04, //!< Select the object after the current object.
+    BLE_OTS_OLCP_PROC_GOTO          = 0x05, //!< Select the object with a given ID.
+    BLE_OTS_OLCP_PROC_ORDER         = 0x06, //!< Sort the list.
+    BLE_OTS_OLCP_PROC_REQ_NUM_OBJS  = 0x07, //!< Request the number of objects in the list.
+    BLE_OTS_OLCP_PROC_CLEAR_MARKING = 0x08, //!< Clear the marking of the objects in the list.
+    BLE_OTS_OLCP_PROC_RESP          = 0x70  //!< Procedure response.
+} ble_ots_olcp_proc_type_t;
+
+/**< Object List Control Point return codes. */
+typedef enum
+{
+    BLE_OTS_OLCP_RES_SUCCESS          = 0x01, //!< Success.
+    BLE_OTS_OLCP_RES_OPCODE_NOT_SUP   = 0x02, //!< Not supported.
+    BLE_OTS_OLCP_RES_INV_PARAM        = 0x03, //!< Invalid parameter.
+    BLE_OTS_OLCP_RES_OPER_FAILED      = 0x04, //!< Operation failed.
+    BLE_OTS_OLCP_RES_OUT_OF_BONDS     = 0x05, //!< There is no object before the first or after the last object.
+    BLE_OTS_OLCP_RES_TOO_MANY_OBJ     = 0x06, //!< Too many objects.
+    BLE_OTS_OLCP_RES_NO_OBJ           = 0x07, //!< The list is empty.
+    BLE_OTS_OLCP_RES_OBJ_ID_NOT_FOUND = 0x08  //!< No object in the list has the ID.
+} ble_ots_olcp_res_code_t;
+
+/**< Types of Object List Filters. */
+typedef enum
+{
+    BLE_OTS_LIST_FILTER_NO_FILTER     = 0x00, //!< All objects are listed.
+    BLE_OTS_LIST_FILTER_NAME_STARTS   = 0x01, //!< Objects whose name starts with a string.
+    BLE_OTS_LIST_FILTER_NAME_ENDS     = 0x02, //!< Objects whose name ends with a string.
+    BLE_OTS_LIST_FILTER_NAME_CONTAINS = 0x03, //!< Objects whose name contains a string.
+    BLE_OTS_LIST_FILTER_NAME_EXACTLY  = 0x04, //!< Objects whose name is a string.
+    BLE_OTS_LIST_FILTER_TYPE          = 0x05, //!< Objects of a type.
+    BLE_OTS_LIST_FILTER_CREATED       = 0x06, //!< Objects created in a period. Not supported.
+    BLE_OTS_LIST_FILTER_MODIFIED      = 0x07, //!< Objects modified in a period. Not supported.
+    BLE_OTS_LIST_FILTER_CURRENT_SIZE  = 0x08, //!< Objects whose current size is in a range.
+    BLE_OTS_LIST_FILTER_ALLOC_SIZE    = 0x09, //!< Objects whose allocated size is in a range.
+    BLE_OTS_LIST_FILTER_MARKED        = 0x0A  //!< Marked objects.
+} ble_ots_list_filter_type_t;
+
+/**@brief Object List Filter. */
+typedef struct
+{
+    ble_ots_list_filter_type_t type;
+    union
+    {
+        struct
+        {
+            uint8_t len;
+            uint8_t str[BLE_OTS_NAME_MAX_SIZE];
+        } name;                                             /**< String to match the object names with. */
+        ble_ots_obj_type_t obj_type;                        /**< Type of the listed objects. */
+        struct
+        {
+            uint32_t min;
+            uint32_t max;
+        } size;                                             /**< Range of the sizes of the listed objects, inclusive. */
+    } param;
+} ble_ots_list_filter_t;
+
+/**@brief OLCP initialization properties. */
+typedef struct
+{
+    ble_ots_t                * p_ots;
+    ble_ots_object_t        ** pp_objects;                      /**< Slots of the object directory, or NULL to only expose the current object. The slots must be NULL or point to objects. */
+    uint16_t                   object_count;                    /**< Number of slots of the object directory. */
+    security_req_t             id_read_access;                  /**< The read security level for the Object ID characteristic. */
+    security_req_t             write_access;                    /**< The write security level for the OLCP. */
+    security_req_t             cccd_write_access;               /**< The write security level for the OLCP CCCD. */
+    security_req_t             filter_read_access;              /**< The read security level for the Object List Filter characteristic. */
+    security_req_t             filter_write_access;             /**< The write security level for the Object List Filter characteristic. */
+} ble_ots_olcp_init_t;
+
+/**@brief The structure holding the object directory and the OLCP state.
+ *
+ * @details The directory is an index of object slots. The object in slot n has the ID
+ *          @ref BLE_OTS_OBJ_ID_FIRST + n, so an object is found from its ID without a search.
+ *          The list the client navigates holds the valid objects of the directory in slot
+ *          order that pass the list filter.
+ */
+struct ble_ots_olcp_s
+{
+    ble_ots_t                  * p_ots;
+    ble_ots_object_t          ** pp_objects;                    /**< Slots of the object directory. */
+    uint16_t                     object_count;                  /**< Number of slots of the object directory. */
+    uint16_t                     current;                       /**< Slot of the current object, or @ref BLE_OTS_OLCP_NO_OBJECT. */
+    ble_ots_list_filter_t        filter;                        /**< The list filter written by the client. */
+    ble_gatts_char_handles_t     obj_id_handles;                /**< The characteristic handles of the Object ID. */
+    ble_gatts_char_handles_t     olcp_handles;                  /**< The characteristic handles of the OLCP. */
+    ble_gatts_char_handles_t     filter_handles;                /**< The characteristic handles of the Object List Filter. */
+};
+
+
 /*------------------------------------------ BLE OTS ---------------------------------------------*/
 
 /**@brief The event type indicates which module the event is connected to.*/
@@ -344,7 +489,8 @@ typedef enum
     BLE_OTS_EVT_OBJECT,
     BLE_OTS_EVT_INDICATION_ENABLED,
     BLE_OTS_EVT_INDICATION_DISABLED,
-    BLE_OTS_EVT_OBJECT_RECEIVED                                 /**< If this event is received, data is now available in the current object.*/
+    BLE_OTS_EVT_OBJECT_RECEIVED,                                /**< If this event is received, data is now available in the current object.*/
+    BLE_OTS_EVT_OBJECT_SELECTED                                 /**< The client selected another current object through the OLCP. */
 } ble_ots_evt_type_t;
 
 /**@brief This structure represents the state of the Object Transfer Service. */
@@ -355,7 +501,7 @@ typedef struct
     {
         ble_ots_oacp_evt_t   oacp_evt;
         ble_ots_object_evt_t object_evt;
-
+        ble_ots_object_t   * p_selected;                        /**< The new current object, or NULL if no object is selected. Provided with @ref BLE_OTS_EVT_OBJECT_SELECTED. */
     } evt;                                                      /**< Event data. */
 } ble_ots_evt_t;
 
@@ -367,10 +513,11 @@ typedef struct
 {
     ble_ots_evt_handler_t         evt_handler;
     ble_srv_error_handler_t       error_handler;
-    ble_ots_object_t            * p_object;                     /**< Pointer to the object. */
+    ble_ots_object_t            * p_object;                     /**< Pointer to the object. Can be NULL if an object directory is given in @p olcp_init. */
     security_req_t                feature_char_read_access;     /**< Read security level for the feature characteristic value. */
     ble_ots_object_chars_init_t   object_chars_init;            /**< The initialization structure of the object characteristics. */
     ble_ots_oacp_init_t           oacp_init;                    /**< The initialization structure of the object action control point. */
+    ble_ots_olcp_init_t           olcp_init;                    /**< The initialization structure of the object list control point. */
     uint16_t                      rx_mps;                       /**< Size of L2CAP Rx MPS (must be at least BLE_L2CAP_MPS_MIN).*/
     uint16_t                      rx_mtu;                       /**< Size of L2CAP Rx MTU (must be at least BLE_L2CAP_MTU_MIN).*/
     nrf_ble_gq_t                * p_gatt_queue;                 /**< Pointer to BLE GATT queue instance. */
@@ -385,6 +532,7 @@ struct ble_ots_s
     ble_gatts_char_handles_t     feature_handles;
     ble_ots_object_chars_t       object_chars;                  /**< The structure holding the object characteristics representation. */
     ble_ots_oacp_t               oacp_chars;                    /**< The structure holding the object action control point characteristics representation. */
+    ble_ots_olcp_t               olcp_chars;                    /**< The structure holding the object directory and the object list control point characteristics representation. */
     ble_ots_object_t           * p_current_object;              /**< Pointer to the currently selected object. */
     nrf_ble_gq_t               * p_gatt_queue;                  /**< Pointer to BLE GATT queue instance. */
 };
@@ -469,6 +617,46 @@ uint32_t ble_ots_object_set_properties(ble_ots_object_chars_t   * p_ots_object_c
 
 
 
+/**@brief Function for adding an object to the object directory.
+ *
+ * @details The object takes the first free slot of the directory. It is listed to the client
+ *          once it is valid.
+ *
+ * @param[in]   p_ots       Object Transfer Service structure.
+ * @param[in]   p_object    The object to add.
+ * @param[out]  p_id        The ID of the object. Can be NULL.
+ *
+ * @retval NRF_SUCCESS              If the object was added.
+ * @retval NRF_ERROR_NULL           If @p p_ots or @p p_object is NULL.
+ * @retval NRF_ERROR_NOT_SUPPORTED  If the service has no object directory.
+ * @retval NRF_ERROR_NO_MEM         If all slots of the directory are in use.
+ */
+uint32_t ble_ots_dir_object_add(ble_ots_t * p_ots, ble_ots_object_t * p_object, uint64_t * p_id);
+
+/**@brief Function for removing an object from the object directory.
+ *
+ * @details If the object is the current object, no object is selected afterwards.
+ *
+ * @param[in]   p_ots       Object Transfer Service structure.
+ * @param[in]   id          The ID of the object.
+ *
+ * @retval NRF_SUCCESS              If the object was removed.
+ * @retval NRF_ERROR_NULL           If @p p_ots is NULL.
+ * @retval NRF_ERROR_NOT_FOUND      If no object has the ID.
+ * @retval NRF_ERROR_BUSY           If the object is being transferred.
+ */
+uint32_t ble_ots_dir_object_remove(ble_ots_t * p_ots, uint64_t id);
+
+/**@brief Function for getting an object of the object directory from its ID.
+ *
+ * @param[in]   p_ots       Object Transfer Service structure.
+ * @param[in]   id          The ID of the object.
+ *
+ * @return The object, or NULL if no object has the ID.
+ */
+ble_ots_object_t * ble_ots_dir_object_get(ble_ots_t const * p_ots, uint64_t id);
+
+
 #endif // BLE_OTS_H__
 
 /** @} */
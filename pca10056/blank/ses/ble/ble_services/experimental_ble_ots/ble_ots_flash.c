@@ -0,0 +1,354 @@
+/**
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_OTS_FLASH)
+#include "ble_ots_flash.h"
+
+#include <string.h>
+#include "nrf_fstorage.h"
+#ifdef SOFTDEVICE_PRESENT
+#include "nrf_fstorage_sd.h"
+#else
+#include "nrf_fstorage_nvmc.h"
+#endif
+
+#define FLASH_PAGE_SIZE 0x1000
+#define FLASH_END_ADDR  (BLE_OTS_FLASH_START_ADDR + BLE_OTS_FLASH_SIZE)
+
+STATIC_ASSERT((BLE_OTS_FLASH_START_ADDR % FLASH_PAGE_SIZE) == 0);
+STATIC_ASSERT((FLASH_PAGE_SIZE % BLE_OTS_FLASH_BUF_SIZE) == 0);
+
+typedef enum
+{
+    FLUSH_IDLE,
+    FLUSH_ERASE,        // Erasing the page the flushed buffer starts in.
+    FLUSH_WRITE,        // Writing the flushed buffer.
+} flush_state_t;
+
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt);
+
+NRF_FSTORAGE_DEF(nrf_fstorage_t m_fs) =
+{
+    .evt_handler = fs_evt_handler,
+    .start_addr  = BLE_OTS_FLASH_START_ADDR,
+    .end_addr    = FLASH_END_ADDR,
+};
+
+static uint32_t      m_bufs[2][BLE_OTS_FLASH_BUF_SIZE / sizeof(uint32_t)];  // Write buffers, word aligned for nrf_fstorage.
+static uint8_t       m_fill_buf;                                            // Buffer collecting written data.
+static uint16_t      m_fill_len;                                            // Number of bytes in that buffer.
+static uint32_t      m_fill_addr;                                           // Flash address of that buffer.
+static uint8_t       m_flush_buf;                                           // Buffer being written to flash.
+static uint16_t      m_flush_len;                                           // Number of bytes being written, 0 if none.
+static uint32_t      m_flush_addr;                                          // Flash address being written.
+static uint32_t      m_erase_addr;                                          // The pages from the write start up to this address are erased.
+static flush_state_t m_flush_state;
+static ret_code_t    m_flush_result;                                        // Error of a failed flush, reported by the next call.
+static uint32_t      m_next_offset;                                         // Object offset the next write must start at.
+static bool          m_writing;
+
+static ble_ots_obj_backend_ready_handler_t m_ready_handler;
+static void                              * mp_ready_context;
+
+
+/**@brief Function for starting the erase or write of the buffer being flushed.
+ */
+static ret_code_t flush_start(void)
+{
+    ret_code_t err_code;
+
+    if (m_flush_addr >= m_erase_addr)
+    {
+        m_flush_state = FLUSH_ERASE;
+        err_code      = nrf_fstorage_erase(&m_fs, m_erase_addr, 1, NULL);
+    }
+    else
+    {
+        m_flush_state = FLUSH_WRITE;
+        err_code      = nrf_fstorage_write(&m_fs, m_flush_addr, m_bufs[m_flush_buf], m_flush_len, NULL);
+    }
+
+    if (err_code != NRF_SUCCESS)
+    {
+        m_flush_state = FLUSH_IDLE;
+        m_flush_len   = 0;
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for flushing the buffer being filled, and filling the other one.
+ */
+static ret_code_t buffer_flush(void)
+{
+    uint8_t * p_fill = (uint8_t *)m_bufs[m_fill_buf];
+
+    // Flash is written in whole words. Pad the last word of a partial buffer with erased bytes.
+    m_flush_len = ALIGN_NUM(sizeof(uint32_t), m_fill_len);
+    memset(&p_fill[m_fill_len], 0xFF, m_flush_len - m_fill_len);
+
+    m_flush_buf  = m_fill_buf;
+    m_flush_addr = m_fill_addr;
+
+    m_fill_buf   = m_fill_buf ^ 1;
+    m_fill_addr += m_fill_len;
+    m_fill_len   = 0;
+
+    return flush_start();
+}
+
+
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt)
+{
+    ret_code_t err_code = p_evt->result;
+
+    if ((err_code == NRF_SUCCESS) && (m_flush_state == FLUSH_ERASE))
+    {
+        m_erase_addr += FLASH_PAGE_SIZE;
+        err_code      = flush_start();
+        if (err_code == NRF_SUCCESS)
+        {
+            return;
+        }
+    }
+
+    m_flush_state = FLUSH_IDLE;
+    m_flush_len   = 0;
+
+    if ((err_code == NRF_SUCCESS) && (m_fill_len == BLE_OTS_FLASH_BUF_SIZE))
+    {
+        // The other buffer was filled while this one was written.
+        err_code = buffer_flush();
+    }
+    if (err_code != NRF_SUCCESS)
+    {
+        m_flush_result = err_code;
+    }
+
+    if (m_ready_handler != NULL)
+    {
+        m_ready_handler(mp_ready_context);
+    }
+}
+
+
+static uint32_t flash_open(void                              * p_context,
+                           uint32_t                            offset,
+                           uint32_t                            len,
+                           bool                                write,
+                           ble_ots_obj_backend_ready_handler_t ready_handler,
+                           void                              * p_ready_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if ((len > BLE_OTS_FLASH_SIZE) || (offset > BLE_OTS_FLASH_SIZE - len))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+    if (m_flush_len != 0)
+    {
+        // The data of an interrupted write is still being written.
+        return NRF_ERROR_BUSY;
+    }
+
+    m_ready_handler  = ready_handler;
+    mp_ready_context = p_ready_context;
+    m_writing        = write;
+
+    if (write)
+    {
+        if ((offset % FLASH_PAGE_SIZE) != 0)
+        {
+            m_writing = false;
+            return NRF_ERROR_INVALID_ADDR;
+        }
+
+        m_fill_buf     = 0;
+        m_fill_len     = 0;
+        m_fill_addr    = BLE_OTS_FLASH_START_ADDR + offset;
+        m_erase_addr   = m_fill_addr;
+        m_next_offset  = offset;
+        m_flush_result = NRF_SUCCESS;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+static uint32_t flash_read(void * p_context, uint32_t offset, uint8_t * p_data, uint16_t len)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if ((len > BLE_OTS_FLASH_SIZE) || (offset > BLE_OTS_FLASH_SIZE - len))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    memcpy(p_data, (uint8_t const *)(BLE_OTS_FLASH_START_ADDR + offset), len);
+
+    return NRF_SUCCESS;
+}
+
+
+static uint32_t flash_write(void * p_context, uint32_t offset, uint8_t const * p_data, uint16_t len)
+{
+    ret_code_t err_code;
+    uint8_t  * p_fill;
+    uint16_t   n;
+
+    UNUSED_PARAMETER(p_context);
+
+    if (!m_writing)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (m_flush_result != NRF_SUCCESS)
+    {
+        return m_flush_result;
+    }
+    if (offset != m_next_offset)
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+    if ((len > BLE_OTS_FLASH_BUF_SIZE) || (len > BLE_OTS_FLASH_SIZE - offset))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+    if ((m_fill_len + len > BLE_OTS_FLASH_BUF_SIZE) && (m_flush_len != 0))
+    {
+        // Both buffers are in use. The ready handler is called when the flush completes.
+        return NRF_ERROR_BUSY;
+    }
+
+    n      = MIN(len, BLE_OTS_FLASH_BUF_SIZE - m_fill_len);
+    p_fill = (uint8_t *)m_bufs[m_fill_buf];
+    memcpy(&p_fill[m_fill_len], p_data, n);
+    m_fill_len += n;
+
+    if ((m_fill_len == BLE_OTS_FLASH_BUF_SIZE) && (m_flush_len == 0))
+    {
+        err_code = buffer_flush();
+        if (err_code != NRF_SUCCESS)
+        {
+            return err_code;
+        }
+
+        p_fill = (uint8_t *)m_bufs[m_fill_buf];
+        memcpy(p_fill, &p_data[n], len - n);
+        m_fill_len = len - n;
+    }
+
+    m_next_offset += len;
+
+    return NRF_SUCCESS;
+}
+
+
+static uint32_t flash_close(void * p_context)
+{
+    ret_code_t err_code;
+
+    UNUSED_PARAMETER(p_context);
+
+    if (!m_writing)
+    {
+        return NRF_SUCCESS;
+    }
+    if (m_flush_result != NRF_SUCCESS)
+    {
+        m_writing = false;
+        return m_flush_result;
+    }
+    if (m_flush_len != 0)
+    {
+        return NRF_ERROR_BUSY;
+    }
+    if (m_fill_len != 0)
+    {
+        err_code = buffer_flush();
+        if (err_code != NRF_SUCCESS)
+        {
+            m_writing = false;
+            return err_code;
+        }
+        return NRF_ERROR_BUSY;
+    }
+
+    m_writing = false;
+
+    return NRF_SUCCESS;
+}
+
+
+ble_ots_obj_backend_t const ble_ots_flash_backend =
+{
+    .open  = flash_open,
+    .read  = flash_read,
+    .write = flash_write,
+    .close = flash_close,
+};
+
+
+ret_code_t ble_ots_flash_init(void)
+{
+    ret_code_t err_code;
+
+#ifdef SOFTDEVICE_PRESENT
+    err_code = nrf_fstorage_init(&m_fs, &nrf_fstorage_sd, NULL);
+#else
+    err_code = nrf_fstorage_init(&m_fs, &nrf_fstorage_nvmc, NULL);
+#endif
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+    if (m_fs.p_flash_info->erase_unit != FLASH_PAGE_SIZE)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    m_flush_state = FLUSH_IDLE;
+    m_flush_len   = 0;
+    m_writing     = false;
+
+    return NRF_SUCCESS;
+}
+#endif // NRF_MODULE_ENABLED(BLE_OTS_FLASH)
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**@file
+ *
+ * @defgroup ble_sdk_srv_ots_flash Object Transfer Service, flash storage backend
+ * @{
+ * @ingroup  ble_ots
+ * @brief    Object Transfer Service module
+ *
+ * @details  This module keeps one object in the flash pages given by BLE_OTS_FLASH_START_ADDR and
+ *           BLE_OTS_FLASH_PAGES. It is used by setting the backend of the object:
+ *           @code
+ *               m_object.p_backend         = &ble_ots_flash_backend;
+ *               m_object.p_backend_context = NULL;
+ *               m_object.alloc_len         = BLE_OTS_FLASH_SIZE;
+ *           @endcode
+ *           The application can fill the object itself, for example with captured samples, by
+ *           calling the functions of @ref ble_ots_flash_backend directly.
+ *
+ *           Writes must start at a page boundary and continue at successive offsets. Pages are
+ *           erased as the write reaches them. The data is collected in one of two RAM buffers
+ *           while the other is written, which keeps pace with an L2CAP transfer.
+ */
+
+#ifndef BLE_OTS_FLASH_H__
+#define BLE_OTS_FLASH_H__
+
+#include <stdint.h>
+#include "sdk_errors.h"
+#include "ble_ots.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BLE_OTS_FLASH_SIZE  (BLE_OTS_FLASH_PAGES * 0x1000)  /**< Size of the largest object the flash backend can hold. */
+
+/**@brief The flash storage backend. The context of its functions is not used. */
+extern ble_ots_obj_backend_t const ble_ots_flash_backend;
+
+
+/**@brief Function for initializing the flash storage backend.
+ *
+ * @retval NRF_SUCCESS             If the backend was initialized.
+ * @retval NRF_ERROR_NOT_SUPPORTED If the flash page size is not 4 kB.
+ * @return                         Otherwise an error code from nrf_fstorage_init().
+ */
+ret_code_t ble_ots_flash_init(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_OTS_FLASH_H__
+
+/** @} */ // End tag for the file.
@@ -49,15 +49,16 @@
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
 
-#define SDU_SIZE 1024
+#define SDU_SIZE     1024
+#define SDU_LEN_SIZE 2                                      /**< Size of the SDU length field carried in the first PDU of an SDU. */
 
 
-static uint8_t data[SDU_SIZE];
-static ble_data_t m_sdu_buf =
-{
-    .p_data = data,
-    .len    = SDU_SIZE
-};
+static uint8_t  m_rx_bufs[BLE_OTS_L2CAP_RX_QUEUE_SIZE][SDU_SIZE]; /**< Receive buffers, posted to the SoftDevice in turn. */
+static uint16_t m_rx_lens[BLE_OTS_L2CAP_RX_QUEUE_SIZE];           /**< Length of the SDU held by each pending receive buffer. */
+static uint8_t  m_tx_bufs[BLE_OTS_L2CAP_TX_QUEUE_SIZE][SDU_SIZE]; /**< Transmit buffers, filled from the storage backend of the object in turn. */
+
+
+static void rx_process(ble_ots_l2cap_t * p_ots_l2cap);
 
 bool ble_ots_l2cap_is_channel_available(ble_ots_l2cap_t * p_ots_l2cap)
 {
@@ -96,44 +97,82 @@ uint32_t ble_ots_l2cap_init(ble_ots_l2cap_t * p_ots_l2cap, ble_ots_l2cap_init_t
 
     p_ots_l2cap->local_cid  = BLE_OTS_INVALID_CID;
 
-    p_ots_l2cap->p_ots_oacp               = p_ots_l2cap_init->p_ots_oacp;
-    p_ots_l2cap->evt_handler              = p_ots_l2cap_init->evt_handler;
-    p_ots_l2cap->rx_params.sdu_buf.len    = m_sdu_buf.len;
-    p_ots_l2cap->rx_params.sdu_buf.p_data = m_sdu_buf.p_data;
+    p_ots_l2cap->p_ots_oacp  = p_ots_l2cap_init->p_ots_oacp;
+    p_ots_l2cap->evt_handler = p_ots_l2cap_init->evt_handler;
 
     p_ots_l2cap->state = NOT_CONNECTED;
 
     return NRF_SUCCESS;
 }
 
-/**@brief This function receives the next MTU of the object.
+/**@brief This function keeps receive buffers posted for the rest of the object.
+ *
+ * @details Buffers are posted until @ref BLE_OTS_L2CAP_RX_QUEUE_SIZE of them are held by the
+ *          SoftDevice, or until the posted buffers can hold the remaining bytes of the object,
+ *          so that the peer never has to wait for a buffer between two SDUs.
  *
  * @param[in] p_ots_l2cap Object Transfer Service structure.
+ *
+ * @return NRF_SUCCESS, or the error returned by sd_ble_l2cap_ch_rx.
  */
-static void receive_resume(ble_ots_l2cap_t * p_ots_l2cap)
+static ret_code_t receive_resume(ble_ots_l2cap_t * p_ots_l2cap)
 {
     ret_code_t err_code;
     ble_data_t sdu_buf;
+    uint32_t   sdu_max;
 
-    sdu_buf.p_data = &p_ots_l2cap->rx_params.sdu_buf.p_data[p_ots_l2cap->received_bytes];
-    sdu_buf.len    = p_ots_l2cap->rx_params.sdu_buf.len - p_ots_l2cap->received_bytes;
+    sdu_max = MIN(MAX(p_ots_l2cap->conn_mtu, BLE_L2CAP_MTU_MIN), SDU_SIZE);
 
-    err_code = sd_ble_l2cap_ch_rx(p_ots_l2cap->p_ots_oacp->p_ots->conn_handle,
-                                  p_ots_l2cap->local_cid,
-                                  &sdu_buf);
+    // Received SDUs the backend has not accepted yet still occupy their buffers.
+    uint8_t bufs_used = p_ots_l2cap->rx_bufs_posted + p_ots_l2cap->rx_bufs_pending;
 
-    if (err_code == NRF_ERROR_RESOURCES)
+    while (   (bufs_used < BLE_OTS_L2CAP_RX_QUEUE_SIZE)
+           && (p_ots_l2cap->received_bytes + bufs_used * sdu_max < p_ots_l2cap->transfer_len))
     {
-        return; // Too many SDUs queued for transmission, the transmission will be tried again on the next BLE_L2CAP_EVT_CH_RX event.
-    }
+        sdu_buf.p_data = m_rx_bufs[p_ots_l2cap->rx_buf_next];
+        sdu_buf.len    = SDU_SIZE;
 
-    if (err_code != NRF_SUCCESS && p_ots_l2cap->p_ots_oacp->p_ots->error_handler != NULL)
-    {
-            p_ots_l2cap->p_ots_oacp->p_ots->error_handler(err_code);
+        err_code = sd_ble_l2cap_ch_rx(p_ots_l2cap->p_ots_oacp->p_ots->conn_handle,
+                                      p_ots_l2cap->local_cid,
+                                      &sdu_buf);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            return NRF_SUCCESS; // The SoftDevice receive queue is full, the buffer will be posted again on the next BLE_L2CAP_EVT_CH_RX event.
+        }
+        if (err_code != NRF_SUCCESS)
+        {
+            return err_code;
+        }
+
+        p_ots_l2cap->rx_buf_next = (p_ots_l2cap->rx_buf_next + 1) % BLE_OTS_L2CAP_RX_QUEUE_SIZE;
+        p_ots_l2cap->rx_bufs_posted++;
+        bufs_used++;
     }
+
+    return NRF_SUCCESS;
+}
+
+/**@brief This function returns the number of credits needed to send an SDU.
+ *
+ * @param[in] p_ots_l2cap Object Transfer Service structure.
+ * @param[in] sdu_len     Length of the SDU.
+ *
+ * @return The number of PDUs the SDU is segmented into.
+ */
+static uint16_t sdu_credits_get(ble_ots_l2cap_t * p_ots_l2cap, uint16_t sdu_len)
+{
+    uint16_t tx_mps = MAX(p_ots_l2cap->tx_params.tx_mps, BLE_L2CAP_MPS_MIN);
+
+    return (uint16_t)((sdu_len + SDU_LEN_SIZE + tx_mps - 1) / tx_mps);
 }
 
-/**@brief This function sends the next MTU of the object.
+/**@brief This function queues the next SDUs of the object.
+ *
+ * @details SDUs of up to tx_mtu bytes are queued until the whole object has been handed to the
+ *          SoftDevice, its TX queue is full, or the peer has not granted the credits the next
+ *          SDU needs. An SDU is always queued when nothing is in flight, the SoftDevice then holds
+ *          it until the credits arrive. When streaming, each SDU is read from the storage backend
+ *          into a free transmit buffer just before it is queued.
  *
  * @param[in] p_ots_l2cap Object Transfer Service structure.
  */
@@ -141,25 +180,91 @@ static void send_resume(ble_ots_l2cap_t * p_ots_l2cap)
 {
     ret_code_t err_code;
     uint16_t   tx_size;
-
-    tx_size = MIN(p_ots_l2cap->transfer_len - p_ots_l2cap->transmitted_bytes,
-                  p_ots_l2cap->tx_params.tx_mtu);
-
+    uint16_t   credits;
     ble_data_t obj;
-    obj.p_data = &p_ots_l2cap->tx_transfer_buffer.p_data[p_ots_l2cap->transmitted_bytes];
-    obj.len    = tx_size;
 
-    err_code = sd_ble_l2cap_ch_tx(p_ots_l2cap->p_ots_oacp->p_ots->conn_handle,
-                                  p_ots_l2cap->local_cid,
-                                  &obj);
-    if (err_code == NRF_ERROR_RESOURCES)
+    while (p_ots_l2cap->queued_bytes < p_ots_l2cap->transfer_len)
     {
-        return; // Too many SDUs queued for transmission, the transmission will be tried again on the next BLE_L2CAP_EVT_CH_TX event.
+        tx_size = MIN(p_ots_l2cap->transfer_len - p_ots_l2cap->queued_bytes,
+                      p_ots_l2cap->tx_params.tx_mtu);
+        if (p_ots_l2cap->is_streaming)
+        {
+            tx_size = MIN(tx_size, SDU_SIZE);
+        }
+        credits = sdu_credits_get(p_ots_l2cap, tx_size);
+
+        if (   (credits > p_ots_l2cap->tx_credits)
+            && (p_ots_l2cap->queued_bytes != p_ots_l2cap->transmitted_bytes))
+        {
+            return; // Not enough credits for another SDU, the transmission will be resumed on the next BLE_L2CAP_EVT_CH_TX or BLE_L2CAP_EVT_CH_CREDIT event.
+        }
+
+        if (p_ots_l2cap->is_streaming)
+        {
+            ble_ots_object_t * p_obj = p_ots_l2cap->p_ots_oacp->p_ots->p_current_object;
+
+            if (p_ots_l2cap->tx_bufs_queued == BLE_OTS_L2CAP_TX_QUEUE_SIZE)
+            {
+                return; // All transmit buffers are queued, the transmission will be resumed on the next BLE_L2CAP_EVT_CH_TX event.
+            }
+
+            obj.p_data = m_tx_bufs[p_ots_l2cap->tx_buf_next];
+            err_code   = p_obj->p_backend->read(p_obj->p_backend_context,
+                                                p_ots_l2cap->transfer_offset + p_ots_l2cap->queued_bytes,
+                                                obj.p_data,
+                                                tx_size);
+        }
+        else
+        {
+            obj.p_data = &p_ots_l2cap->tx_transfer_buffer.p_data[p_ots_l2cap->queued_bytes];
+            err_code   = NRF_SUCCESS;
+        }
+        obj.len = tx_size;
+
+        if (err_code == NRF_SUCCESS)
+        {
+            err_code = sd_ble_l2cap_ch_tx(p_ots_l2cap->p_ots_oacp->p_ots->conn_handle,
+                                          p_ots_l2cap->local_cid,
+                                          &obj);
+        }
+
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            return; // Too many SDUs queued for transmission, the transmission will be tried again on the next BLE_L2CAP_EVT_CH_TX event.
+        }
+
+        if (err_code != NRF_SUCCESS)
+        {
+            if (p_ots_l2cap->p_ots_oacp->p_ots->error_handler != NULL)
+            {
+                p_ots_l2cap->p_ots_oacp->p_ots->error_handler(err_code);
+            }
+            return;
+        }
+
+        p_ots_l2cap->queued_bytes += tx_size;
+        p_ots_l2cap->tx_credits   -= MIN(credits, p_ots_l2cap->tx_credits);
+
+        if (p_ots_l2cap->is_streaming)
+        {
+            p_ots_l2cap->tx_buf_next = (p_ots_l2cap->tx_buf_next + 1) % BLE_OTS_L2CAP_TX_QUEUE_SIZE;
+            p_ots_l2cap->tx_bufs_queued++;
+        }
     }
+}
+
+
+/**@brief This function is called by the storage backend when it can accept data again.
+ *
+ * @param[in] p_ready_context Object transfer service l2cap module structure.
+ */
+static void backend_ready(void * p_ready_context)
+{
+    ble_ots_l2cap_t * p_ots_l2cap = p_ready_context;
 
-    if (err_code != NRF_SUCCESS && p_ots_l2cap->p_ots_oacp->p_ots->error_handler != NULL)
+    if (p_ots_l2cap->state == RECEIVING)
     {
-            p_ots_l2cap->p_ots_oacp->p_ots->error_handler(err_code);
+        rx_process(p_ots_l2cap);
     }
 }
 
@@ -191,7 +296,63 @@ uint32_t ble_ots_l2cap_obj_send(ble_ots_l2cap_t * p_ots_l2cap, uint8_t * p_data,
     p_ots_l2cap->tx_transfer_buffer.len    = data_len;
 
     p_ots_l2cap->transmitted_bytes = 0;
+    p_ots_l2cap->queued_bytes      = 0;
+    p_ots_l2cap->transfer_offset   = 0;
     p_ots_l2cap->transfer_len      = data_len;
+    p_ots_l2cap->is_streaming      = false;
+
+    p_ots_l2cap->state = SENDING;
+
+    send_resume(p_ots_l2cap);
+
+    return NRF_SUCCESS;
+}
+
+uint32_t ble_ots_l2cap_obj_stream_send(ble_ots_l2cap_t * p_ots_l2cap, uint32_t offset, uint32_t len)
+{
+    uint32_t           err_code;
+    ble_ots_object_t * p_obj;
+
+    if (p_ots_l2cap == NULL)
+    {
+        return NRF_ERROR_NULL;
+    }
+    if (len == 0)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+    if (p_ots_l2cap->local_cid == BLE_L2CAP_CID_INVALID)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (p_ots_l2cap->state != CONNECTED)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    p_obj = p_ots_l2cap->p_ots_oacp->p_ots->p_current_object;
+    if ((p_obj == NULL) || (p_obj->p_backend == NULL))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    err_code = p_obj->p_backend->open(p_obj->p_backend_context, offset, len, false,
+                                      backend_ready, p_ots_l2cap);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    p_ots_l2cap->tx_transfer_buffer.p_data = NULL;
+    p_ots_l2cap->tx_transfer_buffer.len    = 0;
+
+    p_ots_l2cap->transmitted_bytes = 0;
+    p_ots_l2cap->queued_bytes      = 0;
+    p_ots_l2cap->transfer_offset   = offset;
+    p_ots_l2cap->transfer_len      = len;
+    p_ots_l2cap->tx_bufs_queued    = 0;
+    p_ots_l2cap->tx_buf_next       = 0;
+    p_ots_l2cap->is_streaming      = true;
 
     p_ots_l2cap->state = SENDING;
 
@@ -200,9 +361,10 @@ uint32_t ble_ots_l2cap_obj_send(ble_ots_l2cap_t * p_ots_l2cap, uint8_t * p_data,
     return NRF_SUCCESS;
 }
 
-uint32_t ble_ots_l2cap_start_recv(ble_ots_l2cap_t * p_ots_l2cap, uint16_t len)
+uint32_t ble_ots_l2cap_start_recv(ble_ots_l2cap_t * p_ots_l2cap, uint32_t offset, uint32_t len)
 {
-    uint32_t err_code;
+    uint32_t           err_code;
+    ble_ots_object_t * p_obj;
 
     if (p_ots_l2cap == NULL)
     {
@@ -216,12 +378,28 @@ uint32_t ble_ots_l2cap_start_recv(ble_ots_l2cap_t * p_ots_l2cap, uint16_t len)
     {
         return NRF_ERROR_INVALID_STATE;
     }
-    p_ots_l2cap->received_bytes  = 0;
-    p_ots_l2cap->transfer_len    = len;
 
-    err_code = sd_ble_l2cap_ch_rx(p_ots_l2cap->p_ots_oacp->p_ots->conn_handle,
-                                  p_ots_l2cap->local_cid,
-                                  &p_ots_l2cap->rx_params.sdu_buf);
+    p_obj = p_ots_l2cap->p_ots_oacp->p_ots->p_current_object;
+    if (p_obj->p_backend != NULL)
+    {
+        err_code = p_obj->p_backend->open(p_obj->p_backend_context, offset, len, true,
+                                          backend_ready, p_ots_l2cap);
+        if (err_code != NRF_SUCCESS)
+        {
+            return err_code;
+        }
+    }
+    else if (offset + len > BLE_OTS_MAX_OBJ_SIZE)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    p_ots_l2cap->received_bytes    = 0;
+    p_ots_l2cap->transfer_offset   = offset;
+    p_ots_l2cap->transfer_len      = len;
+    p_ots_l2cap->is_streaming      = (p_obj->p_backend != NULL);
+
+    err_code = receive_resume(p_ots_l2cap);
     if (err_code == NRF_SUCCESS)
     {
         p_ots_l2cap->state = RECEIVING;
@@ -291,6 +469,11 @@ static inline void on_l2cap_ch_setup(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t co
     p_ots_l2cap->tx_params.credits = p_ble_evt->evt.l2cap_evt.params.ch_setup.tx_params.credits;
     p_ots_l2cap->tx_params.tx_mps  = p_ble_evt->evt.l2cap_evt.params.ch_setup.tx_params.tx_mps;
     p_ots_l2cap->tx_params.tx_mtu  = p_ble_evt->evt.l2cap_evt.params.ch_setup.tx_params.tx_mtu;
+    p_ots_l2cap->tx_credits        = p_ots_l2cap->tx_params.credits;
+    p_ots_l2cap->rx_bufs_posted    = 0;
+    p_ots_l2cap->rx_bufs_pending   = 0;
+    p_ots_l2cap->rx_buf_oldest     = 0;
+    p_ots_l2cap->rx_buf_next       = 0;
     ble_ots_l2cap_evt_t evt;
 
     evt.type = BLE_OTS_L2CAP_EVT_CH_CONNECTED;
@@ -317,10 +500,45 @@ static inline void on_l2cap_ch_released(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t
 
     p_ots_l2cap->evt_handler(p_ots_l2cap, &evt);
 
+    if (p_ots_l2cap->is_streaming && (p_ots_l2cap->state != CONNECTED))
+    {
+        // End the interrupted transfer. Data received so far is still stored.
+        ble_ots_object_t * p_obj = p_ots_l2cap->p_ots_oacp->p_ots->p_current_object;
+
+        (void)p_obj->p_backend->close(p_obj->p_backend_context);
+    }
+
     p_ots_l2cap->state = NOT_CONNECTED;
 
-    p_ots_l2cap->local_cid = BLE_OTS_INVALID_CID;
+    // The SoftDevice releases all posted buffers with the channel.
+    p_ots_l2cap->local_cid       = BLE_OTS_INVALID_CID;
+    p_ots_l2cap->rx_bufs_posted  = 0;
+    p_ots_l2cap->rx_bufs_pending = 0;
+    p_ots_l2cap->rx_buf_oldest   = 0;
+    p_ots_l2cap->rx_buf_next     = 0;
+    p_ots_l2cap->tx_credits      = 0;
+    p_ots_l2cap->is_streaming    = false;
+}
 
+
+/**@brief Function for handling the BLE_L2CAP_EVT_CH_CREDIT event.
+ *
+ * @param[in] p_ots_l2cap Object transfer service l2cap module structure.
+ * @param[in] p_ble_evt   Pointer to the event received from BLE stack.
+ */
+static void on_l2cap_ch_credit(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t const * p_ble_evt)
+{
+    if(p_ots_l2cap->local_cid != p_ble_evt->evt.l2cap_evt.local_cid)
+    {
+        return;
+    }
+
+    p_ots_l2cap->tx_credits += p_ble_evt->evt.l2cap_evt.params.credit.credits;
+
+    if (p_ots_l2cap->state == SENDING)
+    {
+        send_resume(p_ots_l2cap);
+    }
 }
 
 
@@ -341,8 +559,19 @@ static void on_l2cap_ch_tx(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t const * p_bl
     NRF_LOG_HEXDUMP_DEBUG(p_ble_evt->evt.l2cap_evt.params.tx.sdu_buf.p_data,
                           p_ble_evt->evt.l2cap_evt.params.tx.sdu_buf.len);
 
+    if (p_ots_l2cap->state != SENDING)
+    {
+        return;
+    }
+
+    if (p_ots_l2cap->is_streaming && (p_ots_l2cap->tx_bufs_queued > 0))
+    {
+        // Transmit buffers are returned in the order they were queued.
+        p_ots_l2cap->tx_bufs_queued--;
+    }
+
     p_ots_l2cap->transmitted_bytes += p_ble_evt->evt.l2cap_evt.params.tx.sdu_buf.len;
-    uint16_t remaining_tx_bytes = p_ots_l2cap->tx_transfer_buffer.len - p_ots_l2cap->transmitted_bytes;
+    uint32_t remaining_tx_bytes = p_ots_l2cap->transfer_len - p_ots_l2cap->transmitted_bytes;
 
     NRF_LOG_DEBUG("Total bytes transmitted: %i ",
                   (p_ots_l2cap->transmitted_bytes));
@@ -353,10 +582,16 @@ static void on_l2cap_ch_tx(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t const * p_bl
     {
         ble_ots_l2cap_evt_t evt;
 
+        if (p_ots_l2cap->is_streaming)
+        {
+            ble_ots_object_t * p_obj = p_ots_l2cap->p_ots_oacp->p_ots->p_current_object;
+
+            (void)p_obj->p_backend->close(p_obj->p_backend_context);
+        }
+
         evt.type = BLE_OTS_L2CAP_EVT_SEND_COMPLETE;
-        evt.param.len = p_ots_l2cap->transfer_len;
         evt.param.p_data = p_ots_l2cap->tx_transfer_buffer.p_data;
-        evt.param.len = p_ots_l2cap->tx_transfer_buffer.len;
+        evt.param.len = p_ots_l2cap->transfer_len;
 
         p_ots_l2cap->evt_handler(p_ots_l2cap, &evt);
 
@@ -371,42 +606,152 @@ static void on_l2cap_ch_tx(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t const * p_bl
 }
 
 
-static void on_l2cap_ch_rx(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t const * p_ble_evt)
+/**@brief This function drops the received SDUs that are not stored yet.
+ *
+ * @param[in] p_ots_l2cap Object transfer service l2cap module structure.
+ */
+static void rx_pending_drop(ble_ots_l2cap_t * p_ots_l2cap)
 {
-    if(p_ots_l2cap->local_cid != p_ble_evt->evt.l2cap_evt.local_cid)
-    {
-        return;
-    }
+    p_ots_l2cap->rx_buf_oldest   = (p_ots_l2cap->rx_buf_oldest + p_ots_l2cap->rx_bufs_pending)
+                                   % BLE_OTS_L2CAP_RX_QUEUE_SIZE;
+    p_ots_l2cap->rx_bufs_pending = 0;
+}
 
-    NRF_LOG_DEBUG("Bytes received: %i", p_ble_evt->evt.l2cap_evt.params.rx.sdu_len);
-    NRF_LOG_HEXDUMP_DEBUG(p_ble_evt->evt.l2cap_evt.params.rx.sdu_buf.p_data,
-                          p_ble_evt->evt.l2cap_evt.params.rx.sdu_len);
 
-    ble_ots_l2cap_evt_t evt;
+/**@brief This function stores the pending SDUs, and completes the transfer after the last one.
+ *
+ * @details When the storage backend is busy, the SDUs are kept pending and their buffers are not
+ *          posted again, which stops the peer once the other buffers are used. The backend calls
+ *          @ref backend_ready when it can accept data, and the SDUs are stored then.
+ *
+ * @param[in] p_ots_l2cap Object transfer service l2cap module structure.
+ */
+static void rx_process(ble_ots_l2cap_t * p_ots_l2cap)
+{
+    ret_code_t         err_code = NRF_SUCCESS;
+    ble_ots_object_t * p_obj    = p_ots_l2cap->p_ots_oacp->p_ots->p_current_object;
+
+    while (p_ots_l2cap->rx_bufs_pending > 0)
+    {
+        uint8_t  idx    = p_ots_l2cap->rx_buf_oldest;
+        uint32_t offset = p_ots_l2cap->transfer_offset + p_ots_l2cap->received_bytes;
+
+        if (p_ots_l2cap->is_streaming)
+        {
+            err_code = p_obj->p_backend->write(p_obj->p_backend_context,
+                                               offset,
+                                               m_rx_bufs[idx],
+                                               m_rx_lens[idx]);
+        }
+        else
+        {
+            memcpy(&p_obj->data[offset], m_rx_bufs[idx], m_rx_lens[idx]);
+        }
 
-    memcpy(&p_ots_l2cap->p_ots_oacp->p_ots->p_current_object->data[p_ots_l2cap->received_bytes],
-           p_ble_evt->evt.l2cap_evt.params.rx.sdu_buf.p_data,
-           p_ble_evt->evt.l2cap_evt.params.rx.sdu_len);
+        if (err_code == NRF_ERROR_BUSY)
+        {
+            return;
+        }
+        if (err_code != NRF_SUCCESS)
+        {
+            rx_pending_drop(p_ots_l2cap);
+            p_ots_l2cap->state = CONNECTED;
+            if (p_ots_l2cap->p_ots_oacp->p_ots->error_handler != NULL)
+            {
+                p_ots_l2cap->p_ots_oacp->p_ots->error_handler(err_code);
+            }
+            return;
+        }
 
-    p_ots_l2cap->received_bytes += p_ble_evt->evt.l2cap_evt.params.rx.sdu_len;
+        p_ots_l2cap->received_bytes += m_rx_lens[idx];
+        p_ots_l2cap->rx_buf_oldest   = (idx + 1) % BLE_OTS_L2CAP_RX_QUEUE_SIZE;
+        p_ots_l2cap->rx_bufs_pending--;
+    }
 
-    uint16_t remaining_bytes = (p_ots_l2cap->transfer_len - p_ots_l2cap->received_bytes);
+    uint32_t remaining_bytes = (p_ots_l2cap->transfer_len - p_ots_l2cap->received_bytes);
 
     NRF_LOG_DEBUG("Remaining bytes to receive: %i", remaining_bytes);
 
     if(remaining_bytes == 0)
     {
+        ble_ots_l2cap_evt_t evt;
+
+        if (p_ots_l2cap->is_streaming)
+        {
+            err_code = p_obj->p_backend->close(p_obj->p_backend_context);
+            if (err_code == NRF_ERROR_BUSY)
+            {
+                return; // The backend is still storing the data, the transfer will be completed on its ready call.
+            }
+            if ((err_code != NRF_SUCCESS) && (p_ots_l2cap->p_ots_oacp->p_ots->error_handler != NULL))
+            {
+                p_ots_l2cap->p_ots_oacp->p_ots->error_handler(err_code);
+            }
+        }
+
         evt.type         = BLE_OTS_L2CAP_EVT_RECV_COMPLETE;
-        evt.param.len    = p_ots_l2cap->rx_params.sdu_buf.len;
-        evt.param.p_data = p_ots_l2cap->rx_params.sdu_buf.p_data;
-        p_ots_l2cap->evt_handler(p_ots_l2cap, &evt);
+        evt.param.len    = p_ots_l2cap->received_bytes;
+        evt.param.p_data = p_ots_l2cap->is_streaming ? NULL : p_obj->data;
         p_ots_l2cap->state = CONNECTED;
         p_ots_l2cap->transfer_len = 0;
+        p_ots_l2cap->evt_handler(p_ots_l2cap, &evt);
     }
     else
     {
-        receive_resume(p_ots_l2cap);
+        err_code = receive_resume(p_ots_l2cap);
+        if (err_code != NRF_SUCCESS && p_ots_l2cap->p_ots_oacp->p_ots->error_handler != NULL)
+        {
+            p_ots_l2cap->p_ots_oacp->p_ots->error_handler(err_code);
+        }
+    }
+}
+
+
+static void on_l2cap_ch_rx(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t const * p_ble_evt)
+{
+    uint8_t  idx;
+    uint32_t rx_len;
+    uint32_t expected_bytes;
+
+    if(p_ots_l2cap->local_cid != p_ble_evt->evt.l2cap_evt.local_cid)
+    {
+        return;
     }
+
+    NRF_LOG_DEBUG("Bytes received: %i", p_ble_evt->evt.l2cap_evt.params.rx.sdu_len);
+    NRF_LOG_HEXDUMP_DEBUG(p_ble_evt->evt.l2cap_evt.params.rx.sdu_buf.p_data,
+                          p_ble_evt->evt.l2cap_evt.params.rx.sdu_len);
+
+    if (p_ots_l2cap->rx_bufs_posted == 0)
+    {
+        return;
+    }
+
+    // Receive buffers are returned in the order they were posted, so this is the buffer after the
+    // pending ones.
+    idx = (p_ots_l2cap->rx_buf_oldest + p_ots_l2cap->rx_bufs_pending) % BLE_OTS_L2CAP_RX_QUEUE_SIZE;
+    p_ots_l2cap->rx_bufs_posted--;
+
+    expected_bytes = p_ots_l2cap->transfer_len - p_ots_l2cap->received_bytes;
+    for (uint8_t i = 0; i < p_ots_l2cap->rx_bufs_pending; i++)
+    {
+        expected_bytes -= m_rx_lens[(p_ots_l2cap->rx_buf_oldest + i) % BLE_OTS_L2CAP_RX_QUEUE_SIZE];
+    }
+
+    rx_len = MIN(p_ble_evt->evt.l2cap_evt.params.rx.sdu_len,
+                 p_ble_evt->evt.l2cap_evt.params.rx.sdu_buf.len);
+    rx_len = MIN(rx_len, expected_bytes);
+
+    if ((p_ots_l2cap->state != RECEIVING) || (rx_len == 0))
+    {
+        p_ots_l2cap->rx_buf_oldest = (idx + 1) % BLE_OTS_L2CAP_RX_QUEUE_SIZE;
+        return;
+    }
+
+    m_rx_lens[idx] = (uint16_t)rx_len;
+    p_ots_l2cap->rx_bufs_pending++;
+
+    rx_process(p_ots_l2cap);
 }
 
 
@@ -444,6 +789,7 @@ void ble_ots_l2cap_on_ble_evt(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t const * p
             break;
 
         case BLE_L2CAP_EVT_CH_CREDIT:
+            on_l2cap_ch_credit(p_ots_l2cap, p_ble_evt);
             break;
 
         case BLE_L2CAP_EVT_CH_RX:
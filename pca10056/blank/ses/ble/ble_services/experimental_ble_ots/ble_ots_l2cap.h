@@ -88,15 +88,34 @@ void ble_ots_l2cap_on_ble_evt(ble_ots_l2cap_t * p_ots_l2cap, ble_evt_t const * p
 uint32_t ble_ots_l2cap_obj_send(ble_ots_l2cap_t * p_ots_l2cap, uint8_t * p_data, uint16_t data_len);
 
 
-/**@brief Function starting to receive data to the transfer buffer.
+/**@brief Function starting to send a part of the current object from its storage backend.
+ *
+ * @details The data is read from the backend one SDU at a time, as transmit buffers become free.
+ *
+ * @param[in]   p_ots_l2cap Object transfer service l2cap module structure.
+ * @param[in]   offset      The object offset of the data to be sent.
+ * @param[in]   len         The length of the data to be sent.
+ *
+ * @return      NRF_SUCCESS             If the transmission was started.
+ * @return      NRF_ERROR_INVALID_STATE When in an invalid state, or if the current object has no
+ *                                      storage backend. Otherwise an other error code.
+ */
+uint32_t ble_ots_l2cap_obj_stream_send(ble_ots_l2cap_t * p_ots_l2cap, uint32_t offset, uint32_t len);
+
+
+/**@brief Function starting to receive data to the current object.
+ *
+ * @details The data is written to the storage backend of the object if it has one, otherwise to
+ *          the object data in RAM.
  *
  * @param[in]   p_ots_l2cap     Object transfer service l2cap module structure.
+ * @param[in]   offset          The object offset where the received data is to be written.
  * @param[in]   len             The length of the data to be received.
  *
  * @return      NRF_SUCCESS             If the transmission was started.
  * @return      NRF_ERROR_INVALID_STATE When in an invalid state. Otherwise an other error code.
  */
-uint32_t ble_ots_l2cap_start_recv(ble_ots_l2cap_t * p_ots_l2cap, uint16_t len);
+uint32_t ble_ots_l2cap_start_recv(ble_ots_l2cap_t * p_ots_l2cap, uint32_t offset, uint32_t len);
 
 
 /**@brief Function that checks if the channel is available for transmission.
@@ -143,9 +143,6 @@ static void ots_l2cap_evt_handler(ble_ots_l2cap_t * p_ots_l2cap, ble_ots_l2cap_e
             break;
         case BLE_OTS_L2CAP_EVT_RECV_COMPLETE:
             NRF_LOG_INFO("BLE_OTS_L2CAP_EVT_RECV_COMPLETE.");
-            memcpy(p_ots_l2cap->p_ots_oacp->p_ots->p_current_object->data, 
-                   p_ots_l2cap->rx_params.sdu_buf.p_data, 
-                   p_ots_l2cap->rx_params.sdu_buf.len);
             err_code = ble_ots_object_set_current_size(&p_ots_l2cap->p_ots_oacp->p_ots->object_chars,
                                                        p_ots_l2cap->p_ots_oacp->p_ots->p_current_object,
                                                        p_ots_l2cap->p_ots_oacp->p_ots->p_current_object->current_size);
@@ -240,7 +237,7 @@ static inline ble_ots_oacp_res_code_t oacp_write_proc(ble_ots_oacp_t * p_ots_oac
         return BLE_OTS_OACP_RES_OBJ_LOCKED;
     }
 
-    err_code = ble_ots_l2cap_start_recv(&p_ots_oacp->ots_l2cap,  length);
+    err_code = ble_ots_l2cap_start_recv(&p_ots_oacp->ots_l2cap, offset, length);
     if (err_code != NRF_SUCCESS)
     {
         return BLE_OTS_OACP_RES_OPER_FAILED;
@@ -253,7 +250,11 @@ static inline ble_ots_oacp_res_code_t oacp_write_proc(ble_ots_oacp_t * p_ots_oac
     ble_ots_evt.evt.oacp_evt.type = BLE_OTS_OACP_EVT_REQ_WRITE;
     ble_ots_evt.evt.oacp_evt.evt.p_object = p_ots_oacp->p_ots->p_current_object;
 
-    p_ots_oacp->p_ots->p_current_object->current_size = length;
+    if (   (mode & BLE_OTS_WRITE_MODE_TRUNCATE)
+        || (offset + length > p_ots_oacp->p_ots->p_current_object->current_size))
+    {
+        p_ots_oacp->p_ots->p_current_object->current_size = offset + length;
+    }
 
     p_ots_oacp->p_ots->evt_handler(p_ots_oacp->p_ots, &ble_ots_evt);
 
@@ -314,9 +315,18 @@ static inline ble_ots_oacp_res_code_t oacp_read_proc(ble_ots_oacp_t * p_ots_oacp
 
     p_ots_oacp->p_ots->evt_handler(p_ots_oacp->p_ots, &ble_ots_evt);
     
-    ret_code_t err_code = ble_ots_l2cap_obj_send(&p_ots_oacp->ots_l2cap,
-                                                 p_ots_oacp->p_ots->p_current_object->data,
-                                                 p_ots_oacp->p_ots->p_current_object->current_size);
+    ret_code_t err_code;
+
+    if (p_ots_oacp->p_ots->p_current_object->p_backend != NULL)
+    {
+        err_code = ble_ots_l2cap_obj_stream_send(&p_ots_oacp->ots_l2cap, offset, length);
+    }
+    else
+    {
+        err_code = ble_ots_l2cap_obj_send(&p_ots_oacp->ots_l2cap,
+                                          &p_ots_oacp->p_ots->p_current_object->data[offset],
+                                          (uint16_t)length);
+    }
     if (err_code != NRF_SUCCESS)
     {
         NRF_LOG_ERROR("ble_ots_l2cap_obj_send returned error 0x%x", err_code);
@@ -335,6 +345,11 @@ static inline ble_ots_oacp_res_code_t oacp_abort_proc(ble_ots_oacp_t * p_ots_oac
 {
     uint32_t err_code;
 
+    if (p_ots_oacp->p_ots->p_current_object == NULL)
+    {
+        return BLE_OTS_OACP_RES_INV_OBJ;
+    }
+
     err_code = ble_ots_l2cap_abort_transmission(&p_ots_oacp->ots_l2cap);
     if (err_code != NRF_SUCCESS)
     {
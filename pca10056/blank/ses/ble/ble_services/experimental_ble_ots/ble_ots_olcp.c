@@ -0,0 +1,858 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "ble_ots_olcp.h"
+
+#include <string.h>
+
+#include "ble_ots.h"
+#include "ble_ots_object.h"
+
+#define NRF_LOG_MODULE_NAME ble_ots_olcp
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define OLCP_INDICATION_LEN             3                               /**< Indication data length. */
+#define OLCP_WRITE_REQUEST_REJECTED     BLE_GATT_STATUS_ATTERR_APP_BEGIN /**< The Object List Filter value was rejected. */
+
+
+/**@brief Function for interception of GATT errors and @ref nrf_ble_gq errors.
+ *
+ * @param[in] nrf_error   Error code.
+ * @param[in] p_ctx       Parameter from the event handler.
+ * @param[in] conn_handle Connection handle.
+ */
+static void gatt_error_handler(uint32_t   nrf_error,
+                               void     * p_ctx,
+                               uint16_t   conn_handle)
+{
+    ble_ots_t * p_ots = (ble_ots_t *)p_ctx;
+
+    if (p_ots->error_handler != NULL)
+    {
+        p_ots->error_handler(nrf_error);
+    }
+}
+
+
+/**@brief Function for reporting an error to the application.
+ *
+ * @param[in] p_ots_olcp    Pointer to the OLCP structure.
+ * @param[in] err_code      Error code.
+ */
+static void error_report(ble_ots_olcp_t * p_ots_olcp, uint32_t err_code)
+{
+    if ((err_code != NRF_SUCCESS) && (p_ots_olcp->p_ots->error_handler != NULL))
+    {
+        p_ots_olcp->p_ots->error_handler(err_code);
+    }
+}
+
+
+/**@brief Checks if the cccd handle is configured for indication
+ *
+ * @param[in] p_ots_olcp Pointer to the OLCP structure.
+ */
+static bool is_cccd_configured(ble_ots_olcp_t * const p_ots_olcp)
+{
+    uint32_t          err_code;
+    uint8_t           cccd_value_buf[BLE_CCCD_VALUE_LEN];
+    ble_gatts_value_t gatts_value;
+
+    memset(&gatts_value, 0, sizeof(gatts_value));
+
+    gatts_value.len     = BLE_CCCD_VALUE_LEN;
+    gatts_value.offset  = 0;
+    gatts_value.p_value = cccd_value_buf;
+
+    err_code = sd_ble_gatts_value_get(p_ots_olcp->p_ots->conn_handle,
+                                      p_ots_olcp->olcp_handles.cccd_handle,
+                                      &gatts_value);
+    if (err_code == BLE_ERROR_GATTS_SYS_ATTR_MISSING)
+    {
+        return false;
+    }
+    if (err_code != NRF_SUCCESS)
+    {
+        error_report(p_ots_olcp, err_code);
+        return false;
+    }
+    return ble_srv_is_indication_enabled(cccd_value_buf);
+}
+
+
+/**@brief Function for checking if the name of an object matches the name filter.
+ *
+ * @param[in] p_filter  The list filter.
+ * @param[in] p_name    The null-terminated name of the object.
+ */
+static bool name_match(ble_ots_list_filter_t const * p_filter, uint8_t const * p_name)
+{
+    uint8_t const * p_str    = p_filter->param.name.str;
+    uint32_t        str_len  = p_filter->param.name.len;
+    uint32_t        name_len = strnlen((char const *)p_name, BLE_OTS_NAME_MAX_SIZE);
+
+    if (str_len > name_len)
+    {
+        return false;
+    }
+
+    switch (p_filter->type)
+    {
+        case BLE_OTS_LIST_FILTER_NAME_STARTS:
+            return (memcmp(p_name, p_str, str_len) == 0);
+
+        case BLE_OTS_LIST_FILTER_NAME_ENDS:
+            return (memcmp(&p_name[name_len - str_len], p_str, str_len) == 0);
+
+        case BLE_OTS_LIST_FILTER_NAME_EXACTLY:
+            return (str_len == name_len) && (memcmp(p_name, p_str, str_len) == 0);
+
+        case BLE_OTS_LIST_FILTER_NAME_CONTAINS:
+            for (uint32_t i = 0; i + str_len <= name_len; i++)
+            {
+                if (memcmp(&p_name[i], p_str, str_len) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+
+        default:
+            return false;
+    }
+}
+
+
+/**@brief Function for checking if the object in a slot is in the list.
+ *
+ * @param[in] p_ots_olcp    Pointer to the OLCP structure.
+ * @param[in] slot          Slot of the object directory.
+ */
+static bool is_listed(ble_ots_olcp_t const * p_ots_olcp, uint16_t slot)
+{
+    ble_ots_object_t      const * p_obj    = p_ots_olcp->pp_objects[slot];
+    ble_ots_list_filter_t const * p_filter = &p_ots_olcp->filter;
+
+    if ((p_obj == NULL) || !p_obj->is_valid)
+    {
+        return false;
+    }
+
+    switch (p_filter->type)
+    {
+        case BLE_OTS_LIST_FILTER_NO_FILTER:
+            return true;
+
+        case BLE_OTS_LIST_FILTER_NAME_STARTS:
+        case BLE_OTS_LIST_FILTER_NAME_ENDS:
+        case BLE_OTS_LIST_FILTER_NAME_CONTAINS:
+        case BLE_OTS_LIST_FILTER_NAME_EXACTLY:
+            return name_match(p_filter, p_obj->name);
+
+        case BLE_OTS_LIST_FILTER_TYPE:
+            if (p_obj->type.len != p_filter->param.obj_type.len)
+            {
+                return false;
+            }
+            if (p_obj->type.len == sizeof(uint16_t))
+            {
+                return p_obj->type.param.type16 == p_filter->param.obj_type.param.type16;
+            }
+            return memcmp(p_obj->type.param.type128,
+                          p_filter->param.obj_type.param.type128,
+                          sizeof(p_obj->type.param.type128)) == 0;
+
+        case BLE_OTS_LIST_FILTER_CURRENT_SIZE:
+            return (p_obj->current_size >= p_filter->param.size.min)
+                && (p_obj->current_size <= p_filter->param.size.max);
+
+        case BLE_OTS_LIST_FILTER_ALLOC_SIZE:
+            return (p_obj->alloc_len >= p_filter->param.size.min)
+                && (p_obj->alloc_len <= p_filter->param.size.max);
+
+        case BLE_OTS_LIST_FILTER_MARKED:
+            return p_obj->properties.decoded.is_marked;
+
+        default:
+            return false;
+    }
+}
+
+
+/**@brief Function for finding the next listed slot from a slot, in a direction.
+ *
+ * @param[in] p_ots_olcp    Pointer to the OLCP structure.
+ * @param[in] start         The first slot to check.
+ * @param[in] forward       True to search towards the last slot.
+ *
+ * @return The slot, or @ref BLE_OTS_OLCP_NO_OBJECT if no slot is listed.
+ */
+static uint16_t listed_find(ble_ots_olcp_t const * p_ots_olcp, int32_t start, bool forward)
+{
+    int32_t const step = forward ? 1 : -1;
+
+    for (int32_t slot = start; (slot >= 0) && (slot < p_ots_olcp->object_count); slot += step)
+    {
+        if (is_listed(p_ots_olcp, (uint16_t)slot))
+        {
+            return (uint16_t)slot;
+        }
+    }
+    return BLE_OTS_OLCP_NO_OBJECT;
+}
+
+
+/**@brief Function for setting the value of the Object ID characteristic.
+ *
+ * @param[in] p_ots_olcp    Pointer to the OLCP structure.
+ */
+static uint32_t obj_id_value_set(ble_ots_olcp_t * p_ots_olcp)
+{
+    uint8_t           id[BLE_OTS_OBJ_ID_LEN];
+    ble_gatts_value_t gatts_value;
+
+    memset(&gatts_value, 0, sizeof(gatts_value));
+
+    if (p_ots_olcp->current != BLE_OTS_OLCP_NO_OBJECT)
+    {
+        gatts_value.len = uint48_encode(BLE_OTS_OBJ_ID_FIRST + p_ots_olcp->current, id);
+    }
+    gatts_value.p_value = id;
+
+    return sd_ble_gatts_value_set(p_ots_olcp->p_ots->conn_handle,
+                                  p_ots_olcp->obj_id_handles.value_handle,
+                                  &gatts_value);
+}
+
+
+/**@brief Function for selecting the current object.
+ *
+ * @details The object characteristics are refreshed, and the application is notified.
+ *
+ * @param[in] p_ots_olcp    Pointer to the OLCP structure.
+ * @param[in] slot          Slot of the new current object, or @ref BLE_OTS_OLCP_NO_OBJECT.
+ */
+static void current_set(ble_ots_olcp_t * p_ots_olcp, uint16_t slot)
+{
+    ble_ots_t * p_ots = p_ots_olcp->p_ots;
+
+    p_ots_olcp->current     = slot;
+    p_ots->p_current_object = (slot == BLE_OTS_OLCP_NO_OBJECT) ? NULL : p_ots_olcp->pp_objects[slot];
+
+    error_report(p_ots_olcp, ble_ots_object_refresh_current(&p_ots->object_chars));
+    error_report(p_ots_olcp, obj_id_value_set(p_ots_olcp));
+
+    if (p_ots->evt_handler != NULL)
+    {
+        ble_ots_evt_t ble_ots_evt;
+
+        ble_ots_evt.type           = BLE_OTS_EVT_OBJECT_SELECTED;
+        ble_ots_evt.evt.p_selected = p_ots->p_current_object;
+        p_ots->evt_handler(p_ots, &ble_ots_evt);
+    }
+}
+
+
+/**@brief Function for executing an Object List Control Point procedure.
+ *
+ * @param[in]  p_ots_olcp       Pointer to the OLCP structure.
+ * @param[in]  p_data           The procedure as written by the client.
+ * @param[in]  len              Length of the procedure.
+ * @param[out] p_num_objects    The number of objects in the list, for
+ *                              @ref BLE_OTS_OLCP_PROC_REQ_NUM_OBJS.
+ */
+static ble_ots_olcp_res_code_t olcp_do_proc(ble_ots_olcp_t * p_ots_olcp,
+                                            uint8_t  const * p_data,
+                                            uint16_t         len,
+                                            uint32_t       * p_num_objects)
+{
+    ble_ots_object_t * p_current = p_ots_olcp->p_ots->p_current_object;
+    uint16_t           slot;
+
+    switch ((ble_ots_olcp_proc_type_t)p_data[0])
+    {
+        case BLE_OTS_OLCP_PROC_FIRST:
+        case BLE_OTS_OLCP_PROC_LAST:
+        case BLE_OTS_OLCP_PROC_PREVIOUS:
+        case BLE_OTS_OLCP_PROC_NEXT:
+        case BLE_OTS_OLCP_PROC_GOTO:
+            if ((p_current != NULL) && p_current->is_locked)
+            {
+                // The current object is being transferred.
+                return BLE_OTS_OLCP_RES_OPER_FAILED;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    switch ((ble_ots_olcp_proc_type_t)p_data[0])
+    {
+        case BLE_OTS_OLCP_PROC_FIRST:
+        case BLE_OTS_OLCP_PROC_LAST:
+        {
+            bool first = (p_data[0] == BLE_OTS_OLCP_PROC_FIRST);
+
+            slot = listed_find(p_ots_olcp, first ? 0 : p_ots_olcp->object_count - 1, first);
+            if (slot == BLE_OTS_OLCP_NO_OBJECT)
+            {
+                return BLE_OTS_OLCP_RES_NO_OBJ;
+            }
+        } break;
+
+        case BLE_OTS_OLCP_PROC_PREVIOUS:
+        case BLE_OTS_OLCP_PROC_NEXT:
+        {
+            bool next = (p_data[0] == BLE_OTS_OLCP_PROC_NEXT);
+
+            if (   (p_ots_olcp->current == BLE_OTS_OLCP_NO_OBJECT)
+                || !is_listed(p_ots_olcp, p_ots_olcp->current))
+            {
+                return BLE_OTS_OLCP_RES_OPER_FAILED;
+            }
+            slot = listed_find(p_ots_olcp, (int32_t)p_ots_olcp->current + (next ? 1 : -1), next);
+            if (slot == BLE_OTS_OLCP_NO_OBJECT)
+            {
+                return BLE_OTS_OLCP_RES_OUT_OF_BONDS;
+            }
+        } break;
+
+        case BLE_OTS_OLCP_PROC_GOTO:
+        {
+            if (len != 1 + BLE_OTS_OBJ_ID_LEN)
+            {
+                return BLE_OTS_OLCP_RES_INV_PARAM;
+            }
+
+            uint64_t id = uint48_decode(&p_data[1]);
+
+            // The ID is the index of the slot, so the object is found without a search.
+            if (   (id < BLE_OTS_OBJ_ID_FIRST)
+                || (id - BLE_OTS_OBJ_ID_FIRST >= p_ots_olcp->object_count)
+                || !is_listed(p_ots_olcp, (uint16_t)(id - BLE_OTS_OBJ_ID_FIRST)))
+            {
+                return BLE_OTS_OLCP_RES_OBJ_ID_NOT_FOUND;
+            }
+            slot = (uint16_t)(id - BLE_OTS_OBJ_ID_FIRST);
+        } break;
+
+        case BLE_OTS_OLCP_PROC_REQ_NUM_OBJS:
+            *p_num_objects = 0;
+            for (slot = 0; slot < p_ots_olcp->object_count; slot++)
+            {
+                if (is_listed(p_ots_olcp, slot))
+                {
+                    (*p_num_objects)++;
+                }
+            }
+            return BLE_OTS_OLCP_RES_SUCCESS;
+
+        case BLE_OTS_OLCP_PROC_CLEAR_MARKING:
+            for (slot = 0; slot < p_ots_olcp->object_count; slot++)
+            {
+                if (is_listed(p_ots_olcp, slot))
+                {
+                    p_ots_olcp->pp_objects[slot]->properties.decoded.is_marked = false;
+                }
+            }
+            error_report(p_ots_olcp, ble_ots_object_refresh_current(&p_ots_olcp->p_ots->object_chars));
+            return BLE_OTS_OLCP_RES_SUCCESS;
+
+        default:
+            // Unsupported op code.
+            return BLE_OTS_OLCP_RES_OPCODE_NOT_SUP;
+    }
+
+    current_set(p_ots_olcp, slot);
+
+    return BLE_OTS_OLCP_RES_SUCCESS;
+}
+
+
+/**@brief Sending the olcp procedure response back to the client.
+ *
+ * @param[in] p_ots_olcp        Pointer to the OLCP structure.
+ * @param[in] req_op_code       The operation code of the procedure.
+ * @param[in] result_code       The result of the procedure.
+ * @param[in] num_objects       The number of objects in the list, sent with the response to
+ *                              @ref BLE_OTS_OLCP_PROC_REQ_NUM_OBJS.
+ */
+static uint32_t olcp_response_send(ble_ots_olcp_t        * p_ots_olcp,
+                                   uint8_t                 req_op_code,
+                                   ble_ots_olcp_res_code_t result_code,
+                                   uint32_t                num_objects)
+{
+    uint16_t           index = 0;
+    uint8_t            data[BLE_OTS_MAX_OLCP_SIZE];
+    nrf_ble_gq_req_t   ots_req;
+
+    data[index++] = BLE_OTS_OLCP_PROC_RESP;
+    data[index++] = req_op_code;
+    data[index++] = (uint8_t)result_code;
+
+    if (   (req_op_code == BLE_OTS_OLCP_PROC_REQ_NUM_OBJS)
+        && (result_code == BLE_OTS_OLCP_RES_SUCCESS))
+    {
+        index += uint32_encode(num_objects, &data[index]);
+    }
+
+    memset(&ots_req, 0, sizeof(nrf_ble_gq_req_t));
+
+    ots_req.type                    = NRF_BLE_GQ_REQ_GATTS_HVX;
+    ots_req.error_handler.cb        = gatt_error_handler;
+    ots_req.error_handler.p_ctx     = p_ots_olcp->p_ots;
+    ots_req.params.gatts_hvx.type   = BLE_GATT_HVX_INDICATION;
+    ots_req.params.gatts_hvx.handle = p_ots_olcp->olcp_handles.value_handle;
+    ots_req.params.gatts_hvx.offset = 0;
+    ots_req.params.gatts_hvx.p_data = data;
+    ots_req.params.gatts_hvx.p_len  = &index;
+
+    return nrf_ble_gq_item_add(p_ots_olcp->p_ots->p_gatt_queue,
+                               &ots_req,
+                               p_ots_olcp->p_ots->conn_handle);
+}
+
+
+/**@brief Function for replying to a write authorization request.
+ *
+ * @param[in] p_ots_olcp    Pointer to the OLCP structure.
+ * @param[in] gatt_status   The GATT status of the reply.
+ */
+static void write_authorize_reply(ble_ots_olcp_t * p_ots_olcp, uint16_t gatt_status)
+{
+    ble_gatts_rw_authorize_reply_params_t auth_reply;
+
+    memset(&auth_reply, 0, sizeof(auth_reply));
+
+    auth_reply.type                     = BLE_GATTS_AUTHORIZE_TYPE_WRITE;
+    auth_reply.params.write.gatt_status = gatt_status;
+    auth_reply.params.write.update      = 1;
+
+    error_report(p_ots_olcp,
+                 sd_ble_gatts_rw_authorize_reply(p_ots_olcp->p_ots->conn_handle, &auth_reply));
+}
+
+
+static void on_olcp_write(ble_ots_olcp_t * p_ots_olcp, ble_gatts_evt_write_t const * p_evt_write)
+{
+    ble_ots_olcp_res_code_t olcp_status;
+    uint32_t                num_objects = 0;
+
+    if (!is_cccd_configured(p_ots_olcp))
+    {
+        NRF_LOG_DEBUG("OLCP indications not enabled.");
+        write_authorize_reply(p_ots_olcp, BLE_GATT_STATUS_ATTERR_CPS_CCCD_CONFIG_ERROR);
+        return;
+    }
+
+    write_authorize_reply(p_ots_olcp, BLE_GATT_STATUS_SUCCESS);
+
+    if (p_evt_write->len == 0)
+    {
+        return;
+    }
+
+    olcp_status = olcp_do_proc(p_ots_olcp, p_evt_write->data, p_evt_write->len, &num_objects);
+
+    error_report(p_ots_olcp,
+                 olcp_response_send(p_ots_olcp, p_evt_write->data[0], olcp_status, num_objects));
+}
+
+
+/**@brief Decode an Object List Filter value.
+ *
+ * @param[in]   p_data      The value written by the client.
+ * @param[in]   len         Length of the value.
+ * @param[out]  p_filter    The decoded filter.
+ *
+ * @return true if the filter is valid and supported.
+ */
+static bool filter_decode(uint8_t const * p_data, uint16_t len, ble_ots_list_filter_t * p_filter)
+{
+    if (len == 0)
+    {
+        return false;
+    }
+
+    memset(p_filter, 0, sizeof(*p_filter));
+
+    p_filter->type = (ble_ots_list_filter_type_t)p_data[0];
+    p_data++;
+    len--;
+
+    switch (p_filter->type)
+    {
+        case BLE_OTS_LIST_FILTER_NO_FILTER:
+        case BLE_OTS_LIST_FILTER_MARKED:
+            return (len == 0);
+
+        case BLE_OTS_LIST_FILTER_NAME_STARTS:
+        case BLE_OTS_LIST_FILTER_NAME_ENDS:
+        case BLE_OTS_LIST_FILTER_NAME_CONTAINS:
+        case BLE_OTS_LIST_FILTER_NAME_EXACTLY:
+            if (len > BLE_OTS_NAME_MAX_SIZE)
+            {
+                return false;
+            }
+            p_filter->param.name.len = (uint8_t)len;
+            memcpy(p_filter->param.name.str, p_data, len);
+            return true;
+
+        case BLE_OTS_LIST_FILTER_TYPE:
+            if (len == sizeof(uint16_t))
+            {
+                p_filter->param.obj_type.param.type16 = uint16_decode(p_data);
+            }
+            else if (len == sizeof(p_filter->param.obj_type.param.type128))
+            {
+                memcpy(p_filter->param.obj_type.param.type128, p_data, len);
+            }
+            else
+            {
+                return false;
+            }
+            p_filter->param.obj_type.len = (uint8_t)len;
+            return true;
+
+        case BLE_OTS_LIST_FILTER_CURRENT_SIZE:
+        case BLE_OTS_LIST_FILTER_ALLOC_SIZE:
+            if (len != 2 * sizeof(uint32_t))
+            {
+                return false;
+            }
+            p_filter->param.size.min = uint32_decode(&p_data[0]);
+            p_filter->param.size.max = uint32_decode(&p_data[sizeof(uint32_t)]);
+            return (p_filter->param.size.min <= p_filter->param.size.max);
+
+        default:
+            // The objects have no time stamps to filter on.
+            return false;
+    }
+}
+
+
+static void on_filter_write(ble_ots_olcp_t * p_ots_olcp, ble_gatts_evt_write_t const * p_evt_write)
+{
+    ble_ots_list_filter_t filter;
+
+    if (!filter_decode(p_evt_write->data, p_evt_write->len, &filter))
+    {
+        write_authorize_reply(p_ots_olcp, OLCP_WRITE_REQUEST_REJECTED);
+        return;
+    }
+
+    write_authorize_reply(p_ots_olcp, BLE_GATT_STATUS_SUCCESS);
+
+    p_ots_olcp->filter = filter;
+
+    // The current object is kept only if it is still in the list.
+    if (   (p_ots_olcp->current != BLE_OTS_OLCP_NO_OBJECT)
+        && !is_listed(p_ots_olcp, p_ots_olcp->current))
+    {
+        current_set(p_ots_olcp, BLE_OTS_OLCP_NO_OBJECT);
+    }
+}
+
+
+static void on_rw_authorize_request(ble_ots_olcp_t * p_ots_olcp, ble_gatts_evt_t const * p_gatts_evt)
+{
+    ble_gatts_evt_rw_authorize_request_t const * p_auth_req =
+        &p_gatts_evt->params.authorize_request;
+
+    if (   (p_auth_req->type != BLE_GATTS_AUTHORIZE_TYPE_WRITE)
+        || (p_auth_req->request.write.op == BLE_GATTS_OP_PREP_WRITE_REQ)
+        || (p_auth_req->request.write.op == BLE_GATTS_OP_EXEC_WRITE_REQ_NOW)
+        || (p_auth_req->request.write.op == BLE_GATTS_OP_EXEC_WRITE_REQ_CANCEL))
+    {
+        return;
+    }
+
+    if (p_auth_req->request.write.handle == p_ots_olcp->olcp_handles.value_handle)
+    {
+        on_olcp_write(p_ots_olcp, &p_auth_req->request.write);
+    }
+    else if (p_auth_req->request.write.handle == p_ots_olcp->filter_handles.value_handle)
+    {
+        on_filter_write(p_ots_olcp, &p_auth_req->request.write);
+    }
+}
+
+
+/**@brief     Function for handling the BLE_GAP_EVT_DISCONNECTED event.
+ *
+ * @details   The list filter is not kept for the next client.
+ *
+ * @param[in] p_ots_olcp  OTS OLCP Structure.
+ */
+static void on_disconnect(ble_ots_olcp_t * p_ots_olcp)
+{
+    uint8_t           value = BLE_OTS_LIST_FILTER_NO_FILTER;
+    ble_gatts_value_t gatts_value;
+
+    memset(&p_ots_olcp->filter, 0, sizeof(p_ots_olcp->filter));
+
+    memset(&gatts_value, 0, sizeof(gatts_value));
+    gatts_value.len     = sizeof(value);
+    gatts_value.p_value = &value;
+
+    error_report(p_ots_olcp, sd_ble_gatts_value_set(BLE_CONN_HANDLE_INVALID,
+                                                    p_ots_olcp->filter_handles.value_handle,
+                                                    &gatts_value));
+}
+
+
+void ble_ots_olcp_on_ble_evt(ble_ots_olcp_t * p_ots_olcp, ble_evt_t const * p_ble_evt)
+{
+    if ((p_ots_olcp == NULL) || (p_ble_evt == NULL) || !ble_ots_olcp_is_supported(p_ots_olcp))
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_DISCONNECTED:
+            on_disconnect(p_ots_olcp);
+            break;
+
+        case BLE_GATTS_EVT_RW_AUTHORIZE_REQUEST:
+            on_rw_authorize_request(p_ots_olcp, &p_ble_evt->evt.gatts_evt);
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+
+/**@brief Adds the Object ID, OLCP and Object List Filter characteristics.
+ *
+ * @param[in] p_ots_olcp        Pointer to the OLCP structure.
+ * @param[in] p_ots_olcp_init   Information needed to initialize the module.
+ *
+ * @return NRF_SUCCESS When added successfully, else an error code from characteristic_add().
+ */
+static uint32_t olcp_chars_add(ble_ots_olcp_t * const p_ots_olcp, ble_ots_olcp_init_t const * p_ots_olcp_init)
+{
+    uint32_t              err_code;
+    uint16_t              service_handle = p_ots_olcp->p_ots->service_handle;
+    uint8_t               filter         = BLE_OTS_LIST_FILTER_NO_FILTER;
+    ble_add_char_params_t add_char_params;
+
+    memset(&add_char_params, 0, sizeof(add_char_params));
+
+    add_char_params.uuid            = BLE_UUID_OTS_OBJECT_ID;
+    add_char_params.uuid_type       = BLE_UUID_TYPE_BLE;
+    add_char_params.max_len         = BLE_OTS_OBJ_ID_LEN;
+    add_char_params.is_var_len      = 1;
+    add_char_params.char_props.read = 1;
+    add_char_params.read_access     = p_ots_olcp_init->id_read_access;
+
+    err_code = characteristic_add(service_handle, &add_char_params, &p_ots_olcp->obj_id_handles);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    memset(&add_char_params, 0, sizeof(add_char_params));
+
+    add_char_params.uuid                = BLE_UUID_OTS_OLCP;
+    add_char_params.uuid_type           = BLE_UUID_TYPE_BLE;
+    add_char_params.max_len             = BLE_OTS_MAX_OLCP_SIZE;
+    add_char_params.is_var_len          = 1;
+    add_char_params.char_props.indicate = true;
+    add_char_params.char_props.write    = true;
+    add_char_params.cccd_write_access   = p_ots_olcp_init->cccd_write_access;
+    add_char_params.is_defered_write    = true;
+    add_char_params.write_access        = p_ots_olcp_init->write_access;
+
+    err_code = characteristic_add(service_handle, &add_char_params, &p_ots_olcp->olcp_handles);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    memset(&add_char_params, 0, sizeof(add_char_params));
+
+    add_char_params.uuid             = BLE_UUID_OTS_LF;
+    add_char_params.uuid_type        = BLE_UUID_TYPE_BLE;
+    add_char_params.max_len          = BLE_OTS_MAX_LIST_FILTER_SIZE;
+    add_char_params.init_len         = sizeof(filter);
+    add_char_params.p_init_value     = &filter;
+    add_char_params.is_var_len       = 1;
+    add_char_params.char_props.read  = 1;
+    add_char_params.char_props.write = 1;
+    add_char_params.read_access      = p_ots_olcp_init->filter_read_access;
+    add_char_params.is_defered_write = true;
+    add_char_params.write_access     = p_ots_olcp_init->filter_write_access;
+
+    return characteristic_add(service_handle, &add_char_params, &p_ots_olcp->filter_handles);
+}
+
+
+uint32_t ble_ots_olcp_init(ble_ots_olcp_t * p_ots_olcp, ble_ots_olcp_init_t * p_ots_olcp_init)
+{
+    uint32_t err_code;
+
+    if (p_ots_olcp == NULL || p_ots_olcp_init == NULL)
+    {
+        return NRF_ERROR_NULL;
+    }
+
+    memset(p_ots_olcp, 0, sizeof(*p_ots_olcp));
+
+    p_ots_olcp->p_ots        = p_ots_olcp_init->p_ots;
+    p_ots_olcp->pp_objects   = p_ots_olcp_init->pp_objects;
+    p_ots_olcp->object_count = p_ots_olcp_init->object_count;
+    p_ots_olcp->current      = BLE_OTS_OLCP_NO_OBJECT;
+
+    if (p_ots_olcp->pp_objects == NULL)
+    {
+        return NRF_SUCCESS;
+    }
+
+    if ((p_ots_olcp->object_count == 0) || (p_ots_olcp->object_count == BLE_OTS_OLCP_NO_OBJECT))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    for (uint16_t slot = 0; slot < p_ots_olcp->object_count; slot++)
+    {
+        if (   (p_ots_olcp->p_ots->p_current_object != NULL)
+            && (p_ots_olcp->pp_objects[slot] == p_ots_olcp->p_ots->p_current_object))
+        {
+            p_ots_olcp->current = slot;
+            break;
+        }
+    }
+
+    err_code = olcp_chars_add(p_ots_olcp, p_ots_olcp_init);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    return obj_id_value_set(p_ots_olcp);
+}
+
+
+bool ble_ots_olcp_is_supported(ble_ots_olcp_t const * p_ots_olcp)
+{
+    return (p_ots_olcp->pp_objects != NULL);
+}
+
+
+uint32_t ble_ots_dir_object_add(ble_ots_t * p_ots, ble_ots_object_t * p_object, uint64_t * p_id)
+{
+    if ((p_ots == NULL) || (p_object == NULL))
+    {
+        return NRF_ERROR_NULL;
+    }
+
+    ble_ots_olcp_t * p_ots_olcp = &p_ots->olcp_chars;
+
+    if (!ble_ots_olcp_is_supported(p_ots_olcp))
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    for (uint16_t slot = 0; slot < p_ots_olcp->object_count; slot++)
+    {
+        if (p_ots_olcp->pp_objects[slot] == NULL)
+        {
+            p_ots_olcp->pp_objects[slot] = p_object;
+            if (p_id != NULL)
+            {
+                *p_id = BLE_OTS_OBJ_ID_FIRST + slot;
+            }
+            return NRF_SUCCESS;
+        }
+    }
+
+    return NRF_ERROR_NO_MEM;
+}
+
+
+uint32_t ble_ots_dir_object_remove(ble_ots_t * p_ots, uint64_t id)
+{
+    if (p_ots == NULL)
+    {
+        return NRF_ERROR_NULL;
+    }
+
+    ble_ots_olcp_t   * p_ots_olcp = &p_ots->olcp_chars;
+    ble_ots_object_t * p_object   = ble_ots_dir_object_get(p_ots, id);
+
+    if (p_object == NULL)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+    if (p_object->is_locked)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    uint16_t slot = (uint16_t)(id - BLE_OTS_OBJ_ID_FIRST);
+
+    p_ots_olcp->pp_objects[slot] = NULL;
+    if (p_ots_olcp->current == slot)
+    {
+        current_set(p_ots_olcp, BLE_OTS_OLCP_NO_OBJECT);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+ble_ots_object_t * ble_ots_dir_object_get(ble_ots_t const * p_ots, uint64_t id)
+{
+    if ((p_ots == NULL) || !ble_ots_olcp_is_supported(&p_ots->olcp_chars))
+    {
+        return NULL;
+    }
+
+    if ((id < BLE_OTS_OBJ_ID_FIRST) || (id - BLE_OTS_OBJ_ID_FIRST >= p_ots->olcp_chars.object_count))
+    {
+        return NULL;
+    }
+
+    return p_ots->olcp_chars.pp_objects[id - BLE_OTS_OBJ_ID_FIRST];
+}
@@ -113,6 +113,19 @@ static void on_hvx(nrf_ble_gatts_c_t const * const p_gatts_c,
         GATTS_LOG ("Service Changed indication.\n\r");
         evt_handler(&evt);
 
+        if (p_gatts_c->p_db_discovery != NULL)
+        {
+            // Only the services in the affected range are discovered again.
+            err_code = ble_db_discovery_range_start(p_gatts_c->p_db_discovery,
+                                                    p_ble_gattc_evt->conn_handle,
+                                                    &evt.params.handle_range);
+
+            if ((err_code != NRF_SUCCESS) && (p_gatts_c->err_handler != NULL))
+            {
+                p_gatts_c->err_handler(err_code);
+            }
+        }
+
     }
 }
 
@@ -128,9 +141,10 @@ ret_code_t nrf_ble_gatts_c_init(nrf_ble_gatts_c_t      * p_gatts_c,
 
     memset (p_gatts_c, 0, sizeof(nrf_ble_gatts_c_t));
 
-    p_gatts_c->conn_handle  = BLE_CONN_HANDLE_INVALID;
-    p_gatts_c->evt_handler  = p_gatts_c_init->evt_handler;
-    p_gatts_c->p_gatt_queue = p_gatts_c_init->p_gatt_queue; 
+    p_gatts_c->conn_handle    = BLE_CONN_HANDLE_INVALID;
+    p_gatts_c->evt_handler    = p_gatts_c_init->evt_handler;
+    p_gatts_c->p_gatt_queue   = p_gatts_c_init->p_gatt_queue; 
+    p_gatts_c->p_db_discovery = p_gatts_c_init->p_db_discovery;
 
     err_code = ble_db_discovery_evt_register(&m_gatts_uuid);
     VERIFY_SUCCESS(err_code);
@@ -47,6 +47,9 @@
  *
  * @details This module implements a client for the Generic Attribute Profile (GATT) Service.
  *          It subscribes to indications from the Service Changed characteristic (0x2A05).
+ *          If a DB Discovery instance is given at initialization, the services in the handle
+ *          range of an indication are rediscovered with @ref ble_db_discovery_range_start, so
+ *          only the client modules of the changed services get discovery events.
  *
  * @note    The application must register this module as a BLE event observer with the
  *          NRF_SDH_BLE_OBSERVER macro. Example:
@@ -115,7 +118,7 @@ typedef struct
     union
     {
         ble_gatt_db_char_t       srv_changed_char;   /**< Handles for the Service Changed characteristic. This is filled if the event type is @ref NRF_BLE_GATTS_C_EVT_DISCOVERY_COMPLETE. */
-        ble_gattc_handle_range_t handle_range;       /**< The affected attribute handle range in which the service has changed. This will be provided if the event type is @ref NRF_BLE_GATTS_C_EVT_SRV_CHANGED.*/
+        ble_gattc_handle_range_t handle_range;       /**< The affected attribute handle range in which the service has changed. This will be provided if the event type is @ref NRF_BLE_GATTS_C_EVT_SRV_CHANGED. Pass it to @ref ble_db_discovery_range_start if no DB Discovery instance was given at initialization.*/
     } params;
 } nrf_ble_gatts_c_evt_t;
 
@@ -138,6 +141,7 @@ typedef struct
     nrf_ble_gatts_c_evt_handler_t   evt_handler;      /**< Pointer to event handler function. */
     ble_srv_error_handler_t         err_handler;      /**< Pointer to error handler function. */
     nrf_ble_gq_t                  * p_gatt_queue;     /**< Pointer to the BLE GATT Queue instance. */
+    ble_db_discovery_t            * p_db_discovery;   /**< Pointer to the DB Discovery instance of the link, or NULL. */
 } nrf_ble_gatts_c_t;
 
 /**@brief   Initialization parameters. These must be supplied when calling @ref nrf_ble_gatts_c_init. */
@@ -146,6 +150,7 @@ typedef struct
     nrf_ble_gatts_c_evt_handler_t   evt_handler; /**< Event handler that is called by the Service Changed Client module when any related event occurs. */
     ble_srv_error_handler_t         err_handler; /**< Error handler that is called by the Service Changed Client module if any error occurs. */
     nrf_ble_gq_t                  * p_gatt_queue;     /**< Pointer to the BLE GATT Queue instance. */
+    ble_db_discovery_t            * p_db_discovery;   /**< Pointer to the DB Discovery instance of the link. The affected services are rediscovered on a Service Changed indication. NULL to leave the rediscovery to the application. */
 } nrf_ble_gatts_c_init_t;
 
 
@@ -37,32 +37,327 @@
  * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  */
+#include "sdk_common.h"
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include "cgms_db.h"
+#if CGMS_DB_FLASH_ENABLED
+#include "nrf_fstorage.h"
+#ifdef SOFTDEVICE_PRESENT
+#include "nrf_fstorage_sd.h"
+#else
+#include "nrf_fstorage_nvmc.h"
+#endif
+#endif
+
+
+static bool m_ordered;  // Whether the time offsets of the records never decrease, so that they can be binary searched.
+
+
+#if CGMS_DB_FLASH_ENABLED
+/*
+ * The records are kept in an append-only ring of flash pages. Each page starts with a header that
+ * holds its place in the ring, followed by fixed-size slots that are written once each. Only the
+ * newest page is partly filled, so the page and slot of a record follow from its index. When the
+ * ring is full, the oldest page is erased and reused, so all pages are erased equally often.
+ * Records that are not yet written are kept in a RAM queue.
+ */
+#define FLASH_PAGE_SIZE         0x1000
+#define PAGE_MAGIC              0xC6D5DB01                      // Marks a page header.
+#define SLOT_MAGIC              0xC6D5                          // Marks a written slot.
+#define RECS_PER_PAGE           ((FLASH_PAGE_SIZE - sizeof(page_hdr_t)) / sizeof(slot_t))
+#define PAGE_ADDR(page)         (CGMS_DB_FLASH_START_ADDR + ((page) * FLASH_PAGE_SIZE))
+#define SLOT_ADDR(page, slot)   (PAGE_ADDR(page) + sizeof(page_hdr_t) + ((slot) * sizeof(slot_t)))
+#define NEXT_PAGE(page)         (((page) + 1) % CGMS_DB_FLASH_PAGES)
+
+STATIC_ASSERT((CGMS_DB_FLASH_START_ADDR % FLASH_PAGE_SIZE) == 0);
+STATIC_ASSERT(CGMS_DB_FLASH_PAGES >= 2);
 
 typedef struct
 {
-    bool           in_use_flag;
-    ble_cgms_rec_t record;
-} database_entry_t;
+    uint32_t magic;     // PAGE_MAGIC.
+    uint32_t seq;       // Increases by one for each page that is taken into use.
+} page_hdr_t;
 
-static database_entry_t m_database[CGMS_DB_MAX_RECORDS];
-static uint8_t          m_database_crossref[CGMS_DB_MAX_RECORDS];
-static uint16_t         m_num_records;
+typedef union
+{
+    struct
+    {
+        uint16_t       magic;   // SLOT_MAGIC.
+        ble_cgms_rec_t record;
+    } s;
+    uint32_t align;             // Keeps the size a whole number of words, as flash writes need.
+} slot_t;
+
+typedef enum
+{
+    FLASH_IDLE,
+    FLASH_ERASE,        // Erasing the page after the newest page.
+    FLASH_HDR_WRITE,    // Writing the header of that page.
+    FLASH_REC_WRITE,    // Writing the oldest queued record.
+} flash_state_t;
 
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt);
 
-ret_code_t cgms_db_init(void)
+NRF_FSTORAGE_DEF(nrf_fstorage_t m_fs) =
+{
+    .evt_handler = fs_evt_handler,
+    .start_addr  = CGMS_DB_FLASH_START_ADDR,
+    .end_addr    = CGMS_DB_FLASH_START_ADDR + (CGMS_DB_FLASH_PAGES * FLASH_PAGE_SIZE),
+};
+
+static uint16_t      m_first_offset[CGMS_DB_FLASH_PAGES];  // Time offset of the first record in each page in use.
+static uint16_t      m_oldest_page;                        // Page holding record 0.
+static uint16_t      m_pages_used;                         // Number of pages in use, the newest being m_oldest_page + m_pages_used - 1.
+static uint16_t      m_newest_count;                       // Number of records written in the newest page.
+static uint32_t      m_newest_seq;                         // Header sequence number of the newest page.
+static page_hdr_t    m_hdr;                                // Source of the header write in progress.
+static slot_t        m_queue[CGMS_DB_FLASH_QUEUE_SIZE];    // Records waiting to be written, oldest first.
+static uint16_t      m_queue_first;
+static uint16_t      m_queue_count;
+static flash_state_t m_flash_state;
+
+
+static uint16_t newest_page(void)
+{
+    return (m_oldest_page + m_pages_used - 1) % CGMS_DB_FLASH_PAGES;
+}
+
+
+static uint16_t flash_num_records(void)
+{
+    return (m_pages_used == 0) ? 0 : (((m_pages_used - 1) * RECS_PER_PAGE) + m_newest_count);
+}
+
+
+static ble_cgms_rec_t const * flash_record_ptr(uint16_t record_num)
 {
-    int i;
+    uint16_t       page   = (m_oldest_page + (record_num / RECS_PER_PAGE)) % CGMS_DB_FLASH_PAGES;
+    slot_t const * p_slot = (slot_t const *)SLOT_ADDR(page, record_num % RECS_PER_PAGE);
 
-    for (i = 0; i < CGMS_DB_MAX_RECORDS; i++)
+    return &p_slot->s.record;
+}
+
+
+/**@brief Function for starting the next flash operation, if none is in progress.
+ */
+static void flash_process(void)
+{
+    ret_code_t err_code;
+
+    if ((m_flash_state != FLASH_IDLE) || (m_queue_count == 0))
     {
-        m_database[i].in_use_flag = false;
-        m_database_crossref[i]    = 0xFF;
+        return;
     }
 
+    if ((m_pages_used == 0) || (m_newest_count == RECS_PER_PAGE))
+    {
+        uint16_t page = (m_pages_used == 0) ? m_oldest_page : NEXT_PAGE(newest_page());
+
+        if (m_pages_used == CGMS_DB_FLASH_PAGES)
+        {
+            // The ring is full. Drop the oldest page so that it can be reused.
+            m_oldest_page = NEXT_PAGE(m_oldest_page);
+            m_pages_used--;
+        }
+
+        m_flash_state = FLASH_ERASE;
+        err_code      = nrf_fstorage_erase(&m_fs, PAGE_ADDR(page), 1, NULL);
+    }
+    else
+    {
+        m_flash_state = FLASH_REC_WRITE;
+        err_code      = nrf_fstorage_write(&m_fs,
+                                           SLOT_ADDR(newest_page(), m_newest_count),
+                                           &m_queue[m_queue_first],
+                                           sizeof(slot_t),
+                                           NULL);
+    }
+
+    if (err_code != NRF_SUCCESS)
+    {
+        // The fstorage queue is full. Try again on the next event or record.
+        m_flash_state = FLASH_IDLE;
+    }
+}
+
+
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt)
+{
+    flash_state_t state = m_flash_state;
+    uint16_t      page  = (m_pages_used == 0) ? m_oldest_page : NEXT_PAGE(newest_page());
+
+    m_flash_state = FLASH_IDLE;
+
+    if (p_evt->result == NRF_SUCCESS)
+    {
+        switch (state)
+        {
+            case FLASH_ERASE:
+                m_hdr.magic   = PAGE_MAGIC;
+                m_hdr.seq     = m_newest_seq + 1;
+                m_flash_state = FLASH_HDR_WRITE;
+                if (nrf_fstorage_write(&m_fs, PAGE_ADDR(page), &m_hdr, sizeof(m_hdr), NULL) != NRF_SUCCESS)
+                {
+                    // Erase again later.
+                    m_flash_state = FLASH_IDLE;
+                }
+                return;
+
+            case FLASH_HDR_WRITE:
+                m_pages_used++;
+                m_newest_count = 0;
+                m_newest_seq   = m_hdr.seq;
+                break;
+
+            case FLASH_REC_WRITE:
+                if (m_newest_count == 0)
+                {
+                    m_first_offset[newest_page()] = m_queue[m_queue_first].s.record.meas.time_offset;
+                }
+                m_newest_count++;
+                m_queue_first = (m_queue_first + 1) % CGMS_DB_FLASH_QUEUE_SIZE;
+                m_queue_count--;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    flash_process();
+}
+
+
+/**@brief Function for finding the records written before a reset.
+ */
+static ret_code_t flash_scan(void)
+{
+    ret_code_t err_code;
+    bool       found = false;
+    uint32_t   oldest_seq = 0;
+
+#ifdef SOFTDEVICE_PRESENT
+    err_code = nrf_fstorage_init(&m_fs, &nrf_fstorage_sd, NULL);
+#else
+    err_code = nrf_fstorage_init(&m_fs, &nrf_fstorage_nvmc, NULL);
+#endif
+    if ((err_code != NRF_SUCCESS) && (err_code != NRF_ERROR_INVALID_STATE))
+    {
+        return err_code;
+    }
+    if (m_fs.p_flash_info->erase_unit != FLASH_PAGE_SIZE)
+    {
+        return NRF_ERROR_INTERNAL;
+    }
+
+    m_oldest_page  = 0;
+    m_pages_used   = 0;
+    m_newest_count = 0;
+    m_newest_seq   = 0;
+    m_queue_first  = 0;
+    m_queue_count  = 0;
+    m_flash_state  = FLASH_IDLE;
+
+    // Pages in use hold consecutive sequence numbers, so the oldest page and the number of pages
+    // follow from the lowest and highest ones.
+    for (uint16_t page = 0; page < CGMS_DB_FLASH_PAGES; page++)
+    {
+        page_hdr_t const * p_hdr = (page_hdr_t const *)PAGE_ADDR(page);
+
+        if (p_hdr->magic != PAGE_MAGIC)
+        {
+            continue;
+        }
+        if (!found || (p_hdr->seq < oldest_seq))
+        {
+            oldest_seq    = p_hdr->seq;
+            m_oldest_page = page;
+        }
+        if (!found || (p_hdr->seq > m_newest_seq))
+        {
+            m_newest_seq = p_hdr->seq;
+        }
+        found = true;
+    }
+
+    if (found)
+    {
+        m_pages_used = (uint16_t)MIN(m_newest_seq - oldest_seq + 1, CGMS_DB_FLASH_PAGES);
+
+        uint16_t page = newest_page();
+        while ((m_newest_count < RECS_PER_PAGE)
+               && (((slot_t const *)SLOT_ADDR(page, m_newest_count))->s.magic == SLOT_MAGIC))
+        {
+            m_newest_count++;
+        }
+        if (m_newest_count == 0)
+        {
+            // The page was taken into use, but nothing was written to it.
+            m_pages_used--;
+            m_newest_seq--;
+        }
+    }
+
+    for (uint16_t i = 0; i < m_pages_used; i++)
+    {
+        uint16_t page = (m_oldest_page + i) % CGMS_DB_FLASH_PAGES;
+        m_first_offset[page] = flash_record_ptr(i * RECS_PER_PAGE)->meas.time_offset;
+    }
+
+    return NRF_SUCCESS;
+}
+#else
+// Slot in m_database that holds the record with the given index.
+#define DB_SLOT(record_num)     ((m_first + (record_num)) % CGMS_DB_MAX_RECORDS)
+
+static ble_cgms_rec_t m_database[CGMS_DB_MAX_RECORDS];  // Ring of records, oldest first.
+static uint16_t       m_first;                          // Slot of the record with index 0.
+static uint16_t       m_num_records;
+#endif // CGMS_DB_FLASH_ENABLED
+
+
+/**@brief Function for getting a pointer to a record, without copying it.
+ *
+ * @param[in] record_num  Index of the record. Must be less than the number of records.
+ */
+static ble_cgms_rec_t const * record_ptr_get(uint16_t record_num)
+{
+#if CGMS_DB_FLASH_ENABLED
+    uint16_t flash_count = flash_num_records();
+
+    if (record_num < flash_count)
+    {
+        return flash_record_ptr(record_num);
+    }
+    return &m_queue[(m_queue_first + record_num - flash_count) % CGMS_DB_FLASH_QUEUE_SIZE].s.record;
+#else
+    return &m_database[DB_SLOT(record_num)];
+#endif
+}
+
+
+ret_code_t cgms_db_init(void)
+{
+    m_ordered = true;
+
+#if CGMS_DB_FLASH_ENABLED
+    ret_code_t err_code = flash_scan();
+    VERIFY_SUCCESS(err_code);
+
+    for (uint16_t i = 1; i < flash_num_records(); i++)
+    {
+        if (record_ptr_get(i)->meas.time_offset < record_ptr_get(i - 1)->meas.time_offset)
+        {
+            m_ordered = false;
+            break;
+        }
+    }
+#else
+    m_first       = 0;
     m_num_records = 0;
+#endif
 
     return NRF_SUCCESS;
 }
@@ -70,18 +365,22 @@ ret_code_t cgms_db_init(void)
 
 uint16_t cgms_db_num_records_get(void)
 {
+#if CGMS_DB_FLASH_ENABLED
+    return flash_num_records() + m_queue_count;
+#else
     return m_num_records;
+#endif
 }
 
 
-ret_code_t cgms_db_record_get(uint8_t record_num, ble_cgms_rec_t * p_rec)
+ret_code_t cgms_db_record_get(uint16_t record_num, ble_cgms_rec_t * p_rec)
 {
-    if ((record_num >= m_num_records) || (m_num_records == 0))
+    if (record_num >= cgms_db_num_records_get())
     {
         return NRF_ERROR_NOT_FOUND;
     }
     // copy record to the specified memory
-    *p_rec = m_database[m_database_crossref[record_num]].record;
+    *p_rec = *record_ptr_get(record_num);
 
     return NRF_SUCCESS;
 }
@@ -89,55 +388,183 @@ ret_code_t cgms_db_record_get(uint8_t record_num, ble_cgms_rec_t * p_rec)
 
 ret_code_t cgms_db_record_add(ble_cgms_rec_t * p_rec)
 {
-    int i;
+    uint16_t num_records = cgms_db_num_records_get();
 
-    if (m_num_records == CGMS_DB_MAX_RECORDS)
+    if ((num_records > 0) && (p_rec->meas.time_offset < record_ptr_get(num_records - 1)->meas.time_offset))
     {
-        return NRF_ERROR_NO_MEM;
+        m_ordered = false;
     }
 
-    // find next available database entry
-    for (i = 0; i < CGMS_DB_MAX_RECORDS; i++)
+#if CGMS_DB_FLASH_ENABLED
+    if (m_queue_count == CGMS_DB_FLASH_QUEUE_SIZE)
     {
-        if (!m_database[i].in_use_flag)
-        {
-            m_database[i].in_use_flag = true;
-            m_database[i].record      = *p_rec;
+        return NRF_ERROR_BUSY;
+    }
 
-            m_database_crossref[m_num_records] = i;
-            m_num_records++;
+    slot_t * p_slot = &m_queue[(m_queue_first + m_queue_count) % CGMS_DB_FLASH_QUEUE_SIZE];
 
-            return NRF_SUCCESS;
-        }
+    memset(p_slot, 0, sizeof(slot_t));
+    p_slot->s.magic  = SLOT_MAGIC;
+    p_slot->s.record = *p_rec;
+    m_queue_count++;
+
+    flash_process();
+#else
+    if (m_num_records == CGMS_DB_MAX_RECORDS)
+    {
+        return NRF_ERROR_NO_MEM;
     }
 
-    return NRF_ERROR_NO_MEM;
+    m_database[DB_SLOT(m_num_records)] = *p_rec;
+    m_num_records++;
+#endif
+
+    return NRF_SUCCESS;
 }
 
 
-ret_code_t cgms_db_record_delete(uint8_t record_num)
+ret_code_t cgms_db_record_delete(uint16_t record_num)
 {
-    int i;
-
-    if (record_num >= m_num_records)
+    if (record_num >= cgms_db_num_records_get())
     {
         // Deleting a non-existent record is not an error
         return NRF_SUCCESS;
     }
 
-    // free entry
-    m_database[m_database_crossref[record_num]].in_use_flag = false;
+#if CGMS_DB_FLASH_ENABLED
+    // Records are only removed when their page is reused.
+    return NRF_ERROR_NOT_SUPPORTED;
+#else
+    uint16_t i;
+
+    // Close the gap from whichever side has fewer records to move.
+    if (record_num < (m_num_records / 2))
+    {
+        for (i = record_num; i > 0; i--)
+        {
+            m_database[DB_SLOT(i)] = m_database[DB_SLOT(i - 1)];
+        }
+        m_first = DB_SLOT(1);
+    }
+    else
+    {
+        for (i = record_num; i < (m_num_records - 1); i++)
+        {
+            m_database[DB_SLOT(i)] = m_database[DB_SLOT(i + 1)];
+        }
+    }
 
     // decrease number of records
     m_num_records--;
 
-    // remove cross reference index
-    for (i = record_num; i < m_num_records; i++)
+    return NRF_SUCCESS;
+#endif
+}
+
+
+/**@brief Function for finding the first record with a time offset greater than an offset, or
+ *        greater than or equal to it, in a database where time offsets never decrease.
+ *
+ * @param[in] offset     The offset to compare with.
+ * @param[in] inclusive  Whether a record with an equal time offset counts.
+ *
+ * @return The index of the record, or the number of records if there is none.
+ */
+static uint16_t upper_index_get(uint16_t offset, bool inclusive)
+{
+    uint16_t low  = 0;
+    uint16_t high = cgms_db_num_records_get();
+
+#if CGMS_DB_FLASH_ENABLED
+    // Narrow the search down to one page using the first time offset of each page. The newest
+    // page has no first time offset until its first record is written.
+    uint16_t page_count = ((m_pages_used > 0) && (m_newest_count == 0)) ? (m_pages_used - 1) : m_pages_used;
+    uint16_t page_low   = 0;
+    uint16_t page_high  = page_count;
+
+    while (page_low < page_high)
+    {
+        uint16_t mid      = page_low + ((page_high - page_low) / 2);
+        uint16_t mid_offs = m_first_offset[(m_oldest_page + mid) % CGMS_DB_FLASH_PAGES];
+
+        if (inclusive ? (mid_offs < offset) : (mid_offs <= offset))
+        {
+            page_low = mid + 1;
+        }
+        else
+        {
+            page_high = mid;
+        }
+    }
+    if (page_low > 0)
     {
-        m_database_crossref[i] = m_database_crossref[i + 1];
+        low = (page_low - 1) * RECS_PER_PAGE;
     }
+    if (page_low < page_count)
+    {
+        high = page_low * RECS_PER_PAGE;
+    }
+#endif
 
-    return NRF_SUCCESS;
+    while (low < high)
+    {
+        uint16_t mid      = low + ((high - low) / 2);
+        uint16_t mid_offs = record_ptr_get(mid)->meas.time_offset;
+
+        if (inclusive ? (mid_offs < offset) : (mid_offs <= offset))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+
+ret_code_t cgms_db_record_index_greater_or_equal_get(uint16_t offset, uint16_t * p_record_num)
+{
+    uint16_t num_records = cgms_db_num_records_get();
+
+    if (m_ordered)
+    {
+        *p_record_num = upper_index_get(offset, true);
+        return (*p_record_num < num_records) ? NRF_SUCCESS : NRF_ERROR_NOT_FOUND;
+    }
+
+    for (*p_record_num = 0; *p_record_num < num_records; (*p_record_num)++)
+    {
+        if (record_ptr_get(*p_record_num)->meas.time_offset >= offset)
+        {
+            return NRF_SUCCESS;
+        }
+    }
+    return NRF_ERROR_NOT_FOUND;
 }
 
 
+ret_code_t cgms_db_record_index_less_or_equal_get(uint16_t offset, uint16_t * p_record_num)
+{
+    if (m_ordered)
+    {
+        *p_record_num = upper_index_get(offset, false);
+        if (*p_record_num == 0)
+        {
+            return NRF_ERROR_NOT_FOUND;
+        }
+        (*p_record_num)--;
+        return NRF_SUCCESS;
+    }
+
+    for (*p_record_num = cgms_db_num_records_get(); (*p_record_num)-- > 0;)
+    {
+        if (record_ptr_get(*p_record_num)->meas.time_offset <= offset)
+        {
+            return NRF_SUCCESS;
+        }
+    }
+    return NRF_ERROR_NOT_FOUND;
+}
@@ -50,6 +50,11 @@
  *          Replace this module if this implementation does not suit
  *          your application. Any replacement implementation should follow the API below to ensure
  *          that the qualification of the @ref ble_cgms is not compromised.
+ *
+ *          The records are kept in a RAM ring of @ref CGMS_DB_MAX_RECORDS records or, if
+ *          CGMS_DB_FLASH_ENABLED is set, in an append-only ring of CGMS_DB_FLASH_PAGES flash pages
+ *          using @ref nrf_fstorage. When the flash ring is full, the oldest page of records is
+ *          erased to make room.
  */
 
 #ifndef BLE_CGMS_DB_H__
@@ -62,7 +67,9 @@
 extern "C" {
 #endif
 
-#define CGMS_DB_MAX_RECORDS 100 // !< Number of records that can be stored in the database.
+#ifndef CGMS_DB_MAX_RECORDS
+#define CGMS_DB_MAX_RECORDS 100 // !< Number of records that can be stored in the database, when it is kept in RAM.
+#endif
 
 
 /**@brief Function for initializing the glucose record database.
@@ -86,14 +93,16 @@ uint16_t cgms_db_num_records_get(void);
  *
  * @retval NRF_SUCCESS If the record was successfully retrieved.
  */
-ret_code_t cgms_db_record_get(uint8_t record_num, ble_cgms_rec_t * p_rec);
+ret_code_t cgms_db_record_get(uint16_t record_num, ble_cgms_rec_t * p_rec);
 
 
 /**@brief Function for adding a record at the end of the database.
  *
  * @param[in] p_rec  Pointer to the record to add to the database.
  *
- * @retval NRF_SUCCESS If the record was successfully added to the database.
+ * @retval NRF_SUCCESS      If the record was successfully added to the database.
+ * @retval NRF_ERROR_NO_MEM If the database is full. Only in RAM.
+ * @retval NRF_ERROR_BUSY   If too many records are waiting to be written to flash.
  */
 ret_code_t cgms_db_record_add(ble_cgms_rec_t * p_rec);
 
@@ -104,9 +113,40 @@ ret_code_t cgms_db_record_add(ble_cgms_rec_t * p_rec);
  *
  * @param[in] record_num  Index of the record to delete.
  *
- * @retval NRF_SUCCESS If the record was successfully deleted from the database.
+ * @retval NRF_SUCCESS             If the record was successfully deleted from the database.
+ * @retval NRF_ERROR_NOT_SUPPORTED If the database is in flash, where records are only removed
+ *                                 to make room for new ones.
+ */
+ret_code_t cgms_db_record_delete(uint16_t record_num);
+
+
+/**@brief Function for finding the first record with a time offset greater than or equal to a
+ *        given offset.
+ *
+ * @details While time offsets never decrease from one record to the next, this is a binary
+ *          search. Otherwise, the records are searched in order.
+ *
+ * @param[in]  offset        The time offset to compare with.
+ * @param[out] p_record_num  Index of the record.
+ *
+ * @retval NRF_SUCCESS         If the record was found.
+ * @retval NRF_ERROR_NOT_FOUND If no record has a time offset greater than or equal to offset.
+ */
+ret_code_t cgms_db_record_index_greater_or_equal_get(uint16_t offset, uint16_t * p_record_num);
+
+
+/**@brief Function for finding the last record with a time offset less than or equal to a given
+ *        offset.
+ *
+ * @details See @ref cgms_db_record_index_greater_or_equal_get.
+ *
+ * @param[in]  offset        The time offset to compare with.
+ * @param[out] p_record_num  Index of the record.
+ *
+ * @retval NRF_SUCCESS         If the record was found.
+ * @retval NRF_ERROR_NOT_FOUND If no record has a time offset less than or equal to offset.
  */
-ret_code_t cgms_db_record_delete(uint8_t record_num);
+ret_code_t cgms_db_record_index_less_or_equal_get(uint16_t offset, uint16_t * p_record_num);
 
 
 #ifdef __cplusplus
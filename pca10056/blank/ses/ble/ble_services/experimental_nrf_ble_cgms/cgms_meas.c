@@ -157,14 +157,14 @@ ret_code_t cgms_meas_send(nrf_ble_cgms_t * p_cgms, ble_cgms_rec_t * p_rec, uint8
     uint32_t               err_code;
     uint8_t                encoded_meas[NRF_BLE_CGMS_MEAS_LEN_MAX + NRF_BLE_CGMS_MEAS_REC_LEN_MAX];
     uint16_t               len     = 0;
-    uint16_t               hvx_len = NRF_BLE_CGMS_MEAS_LEN_MAX;
+    uint16_t               hvx_len;
     int                    i;
     ble_gatts_hvx_params_t hvx_params;
 
     for (i = 0; i < *p_count; i++)
     {
         uint8_t meas_len = cgms_meas_encode(p_cgms, &(p_rec[i].meas), (encoded_meas + len));
-        if (len + meas_len >= NRF_BLE_CGMS_MEAS_LEN_MAX)
+        if (len + meas_len > p_cgms->max_meas_len)
         {
             break;
         }
@@ -46,10 +46,7 @@
 #include "nrf_ble_gq.h"
 #include "cgms_meas.h"
 
-#define OPERAND_LESS_GREATER_FILTER_TYPE_SIZE  1 // !< 1 byte.
 #define OPERAND_LESS_GREATER_FILTER_PARAM_SIZE 2 // !< 2 bytes.
-#define OPERAND_LESS_GREATER_SIZE              OPERAND_LESS_GREATER_FILTER_TYPE_SIZE \
-                                             + OPERAND_LESS_GREATER_FILTER_PARAM_SIZE  // !< Total size of the operand.
 
 
 /**@brief Function for adding a characteristic for the Record Access Control Point.
@@ -83,28 +80,25 @@ ret_code_t cgms_racp_char_add(nrf_ble_cgms_t * p_cgms)
 
 /**@brief Function for sending response from Specific Operation Control Point.
  *
- * @param[in]   p_cgms        Service instance.
- * @param[in]   p_racp_val   RACP value to be sent.
+ * @param[in]   p_cgms         Service instance.
+ * @param[in]   p_encoded_resp Encoded RACP response, copied by the GATT queue.
+ * @param[in]   len            Length of the encoded response.
  */
-static void racp_send(nrf_ble_cgms_t * p_cgms, ble_racp_value_t * p_racp_val)
+static void racp_send(nrf_ble_cgms_t * p_cgms, uint8_t * p_encoded_resp, uint16_t len)
 {
     uint32_t         err_code;
-    uint8_t          encoded_resp[25];
-    uint16_t         len;
     nrf_ble_gq_req_t cgms_req;
 
     memset(&cgms_req, 0, sizeof(nrf_ble_gq_req_t));
 
     // Send indication
-    len = ble_racp_encode(p_racp_val, encoded_resp);
-
     cgms_req.type                               = NRF_BLE_GQ_REQ_GATTS_HVX;
     cgms_req.error_handler.cb                   = p_cgms->gatt_err_handler;
     cgms_req.error_handler.p_ctx                = p_cgms;
     cgms_req.params.gatts_hvx.type    = BLE_GATT_HVX_INDICATION;
     cgms_req.params.gatts_hvx.handle  = p_cgms->char_handles.racp.value_handle;
     cgms_req.params.gatts_hvx.offset  = 0;
-    cgms_req.params.gatts_hvx.p_data  = encoded_resp;
+    cgms_req.params.gatts_hvx.p_data  = p_encoded_resp;
     cgms_req.params.gatts_hvx.p_len   = &len;
 
     err_code = nrf_ble_gq_item_add(p_cgms->p_gatt_queue, &cgms_req, p_cgms->conn_handle);
@@ -127,68 +121,76 @@ static void racp_send(nrf_ble_cgms_t * p_cgms, ble_racp_value_t * p_racp_val)
  */
 static void racp_response_code_send(nrf_ble_cgms_t * p_cgms, uint8_t opcode, uint8_t value)
 {
-    p_cgms->racp_data.pending_racp_response.opcode      = RACP_OPCODE_RESPONSE_CODE;
-    p_cgms->racp_data.pending_racp_response.operator    = RACP_OPERATOR_NULL;
-    p_cgms->racp_data.pending_racp_response.operand_len = 2;
-    p_cgms->racp_data.pending_racp_response.p_operand   =
-        p_cgms->racp_data.pending_racp_response_operand;
-
-    p_cgms->racp_data.pending_racp_response_operand[0] = opcode;
-    p_cgms->racp_data.pending_racp_response_operand[1] = value;
+    uint8_t encoded_resp[BLE_RACP_RESPONSE_LEN];
 
-    racp_send(p_cgms, &p_cgms->racp_data.pending_racp_response);
+    racp_send(p_cgms, encoded_resp, ble_racp_response_code_encode(opcode, value, encoded_resp));
 }
 
 
-/**@brief Function for responding to the ALL operation.
+/**@brief Function for reporting the next run of records in a range.
+ *
+ * @details Fetches as many records as can fit in one Glucose Measurement notification at the
+ *          current ATT MTU, starting at the current record index, and sends them. The record
+ *          index is only advanced by the number of records the SoftDevice accepted, so a
+ *          notification rejected because the TX queue is full is rebuilt on the next call.
  *
  * @param[in]   p_cgms   Service instance.
+ * @param[in]   end_ndx  Index following the last record of the range.
  *
  * @return      NRF_SUCCESS on success, otherwise an error code.
  */
-static uint32_t racp_report_records_all(nrf_ble_cgms_t * p_cgms)
+static ret_code_t racp_report_records_range(nrf_ble_cgms_t * p_cgms, uint16_t end_ndx)
 {
-    uint16_t total_records = cgms_db_num_records_get();
-    uint16_t cur_nb_rec;
-    uint8_t  i;
-    uint8_t  nb_rec_to_send;
+    ret_code_t     err_code;
+    ble_cgms_rec_t rec[NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX];
+    uint16_t       rec_nb_left_to_send;
+    uint16_t       rec_nb_per_notif;
+    uint8_t        nb_rec_to_send;
+    uint16_t       i;
 
-    if (p_cgms->racp_data.racp_proc_record_ndx >= total_records)
+    if (p_cgms->racp_data.racp_proc_record_ndx >= end_ndx)
     {
         p_cgms->racp_data.racp_procesing_active = false;
+
+        return NRF_SUCCESS;
     }
-    else
-    {
-        uint32_t       err_code;
-        ble_cgms_rec_t rec[NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX];
 
-        cur_nb_rec = total_records - p_cgms->racp_data.racp_proc_record_ndx;
-        if (cur_nb_rec > NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX)
-        {
-            cur_nb_rec = NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX;
-        }
-        nb_rec_to_send = (uint8_t)cur_nb_rec;
+    rec_nb_left_to_send = end_ndx - p_cgms->racp_data.racp_proc_record_ndx;
+    rec_nb_per_notif    = MIN(p_cgms->max_meas_len / NRF_BLE_CGMS_MEAS_REC_LEN_MIN,
+                              NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX);
+    nb_rec_to_send      = (uint8_t)MIN(rec_nb_left_to_send, rec_nb_per_notif);
 
-        for (i = 0; i < cur_nb_rec; i++)
-        {
-            err_code = cgms_db_record_get(p_cgms->racp_data.racp_proc_record_ndx + i, &(rec[i]));
-            if (err_code != NRF_SUCCESS)
-            {
-                return err_code;
-            }
-        }
-        err_code = cgms_meas_send(p_cgms, rec, &nb_rec_to_send);
+    for (i = 0; i < nb_rec_to_send; i++)
+    {
+        err_code = cgms_db_record_get(p_cgms->racp_data.racp_proc_record_ndx + i, &(rec[i]));
         if (err_code != NRF_SUCCESS)
         {
             return err_code;
         }
-        p_cgms->racp_data.racp_proc_record_ndx += nb_rec_to_send;
     }
+    err_code = cgms_meas_send(p_cgms, rec, &nb_rec_to_send);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+    p_cgms->racp_data.racp_proc_record_ndx += nb_rec_to_send;
 
     return NRF_SUCCESS;
 }
 
 
+/**@brief Function for responding to the ALL operation.
+ *
+ * @param[in]   p_cgms   Service instance.
+ *
+ * @return      NRF_SUCCESS on success, otherwise an error code.
+ */
+static uint32_t racp_report_records_all(nrf_ble_cgms_t * p_cgms)
+{
+    return racp_report_records_range(p_cgms, cgms_db_num_records_get());
+}
+
+
 /**@brief Function for responding to the FIRST or the LAST operation.
  *
  * @param[in]   p_cgms   Service instance.
@@ -247,50 +249,8 @@ static uint32_t racp_report_records_first_last(nrf_ble_cgms_t * p_cgms)
  */
 static ret_code_t racp_report_records_less_equal(nrf_ble_cgms_t * p_cgms)
 {
-    uint16_t total_rec_nb_to_send;
-    uint16_t rec_nb_left_to_send;
-    uint8_t  nb_rec_to_send;
-    uint16_t i;
-
-    total_rec_nb_to_send = p_cgms->racp_data.racp_proc_records_ndx_last_to_send +1;
-
-    if (p_cgms->racp_data.racp_proc_record_ndx >= total_rec_nb_to_send)
-    {
-        p_cgms->racp_data.racp_procesing_active = false;
-    }
-    else
-    {
-        ret_code_t     err_code;
-        ble_cgms_rec_t rec[NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX];
-
-        rec_nb_left_to_send = total_rec_nb_to_send - p_cgms->racp_data.racp_proc_records_reported;
-
-        if (rec_nb_left_to_send > NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX)
-        {
-            nb_rec_to_send = NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX;
-        }
-        else
-        {
-            nb_rec_to_send = (uint8_t)rec_nb_left_to_send;
-        }
-
-        for (i = 0; i < nb_rec_to_send; i++)
-        {
-            err_code = cgms_db_record_get(p_cgms->racp_data.racp_proc_record_ndx + i, &(rec[i]));
-            if (err_code != NRF_SUCCESS)
-            {
-                return err_code;
-            }
-        }
-        err_code = cgms_meas_send(p_cgms, rec, &nb_rec_to_send);
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-        p_cgms->racp_data.racp_proc_record_ndx += nb_rec_to_send;
-    }
-
-   return NRF_SUCCESS;
+    return racp_report_records_range(p_cgms,
+                                     p_cgms->racp_data.racp_proc_records_ndx_last_to_send + 1);
 }
 
 
@@ -302,49 +262,7 @@ static ret_code_t racp_report_records_less_equal(nrf_ble_cgms_t * p_cgms)
  */
 static ret_code_t racp_report_records_greater_equal(nrf_ble_cgms_t * p_cgms)
 {
-    ret_code_t err_code;
-    uint16_t   total_rec_nb = cgms_db_num_records_get();
-    uint16_t   rec_nb_left_to_send;
-    uint8_t    nb_rec_to_send;
-    uint16_t   i;
-
-
-    total_rec_nb = cgms_db_num_records_get();
-    if (p_cgms->racp_data.racp_proc_record_ndx >= total_rec_nb)
-    {
-        p_cgms->racp_data.racp_procesing_active = false;
-
-        return NRF_SUCCESS;
-    }
-
-    ble_cgms_rec_t rec[NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX];
-
-    rec_nb_left_to_send = total_rec_nb - p_cgms->racp_data.racp_proc_record_ndx;
-    if (rec_nb_left_to_send > NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX)
-    {
-        nb_rec_to_send = NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX;
-    }
-    else
-    {
-        nb_rec_to_send = (uint8_t)rec_nb_left_to_send;
-    }
-
-    for (i = 0; i < nb_rec_to_send; i++)
-    {
-        err_code = cgms_db_record_get(p_cgms->racp_data.racp_proc_record_ndx + i, &(rec[i]));
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-    }
-    err_code = cgms_meas_send(p_cgms, rec, &nb_rec_to_send);
-    if (err_code != NRF_SUCCESS)
-    {
-        return err_code;
-    }
-    p_cgms->racp_data.racp_proc_record_ndx += nb_rec_to_send;
-
-   return NRF_SUCCESS;
+    return racp_report_records_range(p_cgms, cgms_db_num_records_get());
 }
 
 
@@ -508,15 +426,22 @@ static bool is_request_to_be_executed(nrf_ble_cgms_t         * p_cgms,
             case RACP_OPERATOR_LESS_OR_EQUAL:
                 // Fall Through.
             case RACP_OPERATOR_GREATER_OR_EQUAL:
-                if (*(p_racp_request->p_operand) == RACP_OPERAND_FILTER_TYPE_FACING_TIME)
+            {
+                uint8_t filter_type;
+
+                if (ble_racp_filter_type_get(p_racp_request, &filter_type) &&
+                    (filter_type == RACP_OPERAND_FILTER_TYPE_FACING_TIME))
                 {
                     *p_response_code = RACP_RESPONSE_PROCEDURE_NOT_DONE;
                 }
-                if (p_racp_request->operand_len != OPERAND_LESS_GREATER_SIZE)
+                if (!ble_racp_filter_params_get(p_racp_request,
+                                                OPERAND_LESS_GREATER_FILTER_PARAM_SIZE,
+                                                NULL,
+                                                NULL))
                 {
                     *p_response_code = RACP_RESPONSE_INVALID_OPERAND;
                 }
-                break;
+            } break;
 
             case RACP_OPERATOR_RANGE:
                 *p_response_code = RACP_RESPONSE_OPERATOR_UNSUPPORTED;
@@ -545,74 +470,6 @@ static bool is_request_to_be_executed(nrf_ble_cgms_t         * p_cgms,
 }
 
 
-
-
-/**@brief Function for getting a record with time offset less or equal to the input param.
- *
- * @param[in]  offset     The record that this function returns must have an time offset less or greater to this.
- * @param[out] record_num Pointer to the record index of the record that has the desired time offset.
- *
- * @retval NRF_SUCCESS If the record was successfully retrieved.
- * @retval NRF_ERROR_NOT_FOUND A record with the desired offset does not exist in the database.
- * @return                     If functions from other modules return errors to this function,
- *                             the @ref nrf_error are propagated.
- */
-static ret_code_t record_index_offset_less_or_equal_get(uint16_t offset, uint16_t * record_num)
-{
-    ret_code_t err_code;
-    ble_cgms_rec_t rec;
-    uint16_t upper_bound = cgms_db_num_records_get();
-
-    for((*record_num) = upper_bound; (*record_num)-- >0;)
-    {
-        err_code = cgms_db_record_get(*record_num, &rec);
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-        if (rec.meas.time_offset <= offset)
-        {
-            return NRF_SUCCESS;
-        }
-    }
-    return NRF_ERROR_NOT_FOUND;
-}
-
-
-
-/**@brief Function for getting a record with time offset greater or equal to the input param.
- *
- * @param[in]  offset     The record that this function returns must have an time offset equal or
- *                        greater to this.
- * @param[out] record_num Pointer to the record index of the record that has the desired time offset.
- *
- * @retval NRF_SUCCESS         If the record was successfully retrieved.
- * @retval NRF_ERROR_NOT_FOUND A record with the desired offset does not exist in the database.
- * @return                     If functions from other modules return errors to this function,
- *                             the @ref nrf_error are propagated.
- */
-static ret_code_t record_index_offset_greater_or_equal_get(uint16_t offset, uint16_t * record_num)
-{
-    ret_code_t     err_code;
-    ble_cgms_rec_t rec;
-    uint16_t       upper_bound = cgms_db_num_records_get();
-
-    for(*record_num = 0; *record_num < upper_bound; (*record_num)++)
-    {
-        err_code = cgms_db_record_get(*record_num, &rec);
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-        if (rec.meas.time_offset >= offset)
-        {
-            return NRF_SUCCESS;
-        }
-    }
-    return NRF_ERROR_NOT_FOUND;
-}
-
-
 /**@brief Function for processing a REPORT RECORDS request.
  *
  * @details Set initial values before entering the state machine of racp_report_records_procedure().
@@ -623,6 +480,9 @@ static ret_code_t record_index_offset_greater_or_equal_get(uint16_t offset, uint
 static void report_records_request_execute(nrf_ble_cgms_t   * p_cgms,
                                            ble_racp_value_t * p_racp_request)
 {
+    uint16_t offset_min;
+    uint16_t offset_max;
+
     p_cgms->racp_data.racp_procesing_active = true;
 
     p_cgms->racp_data.racp_proc_record_ndx               = 0;
@@ -630,10 +490,12 @@ static void report_records_request_execute(nrf_ble_cgms_t   * p_cgms,
     p_cgms->racp_data.racp_proc_records_reported         = 0;
     p_cgms->racp_data.racp_proc_records_ndx_last_to_send = 0;
 
+    // The operand was validated by is_request_to_be_executed().
+    (void)ble_racp_filter_uint16_range_get(p_racp_request, &offset_min, &offset_max);
+
     if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_GREATER_OR_EQUAL)
     {
-        uint16_t  offset_requested = uint16_decode(&p_cgms->racp_data.racp_request.p_operand[OPERAND_LESS_GREATER_FILTER_TYPE_SIZE]);
-        ret_code_t err_code = record_index_offset_greater_or_equal_get(offset_requested, &p_cgms->racp_data.racp_proc_record_ndx);
+        ret_code_t err_code = cgms_db_record_index_greater_or_equal_get(offset_min, &p_cgms->racp_data.racp_proc_record_ndx);
         if (err_code != NRF_SUCCESS)
         {
             racp_report_records_completed(p_cgms);
@@ -642,9 +504,8 @@ static void report_records_request_execute(nrf_ble_cgms_t   * p_cgms,
     }
     if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_LESS_OR_EQUAL)
     {
-        uint16_t   offset_requested = uint16_decode(&p_cgms->racp_data.racp_request.p_operand[OPERAND_LESS_GREATER_FILTER_TYPE_SIZE]);
-        ret_code_t err_code         = record_index_offset_less_or_equal_get(offset_requested,
-                                                                            &p_cgms->racp_data.racp_proc_records_ndx_last_to_send);
+        ret_code_t err_code         = cgms_db_record_index_less_or_equal_get(offset_max,
+                                                                             &p_cgms->racp_data.racp_proc_records_ndx_last_to_send);
         if (err_code != NRF_SUCCESS)
         {
             racp_report_records_completed(p_cgms);
@@ -664,6 +525,7 @@ static void report_num_records_request_execute(nrf_ble_cgms_t   * p_cgms,
 {
     uint16_t total_records;
     uint16_t num_records;
+    uint8_t  encoded_resp[BLE_RACP_RESPONSE_LEN];
 
     total_records = cgms_db_num_records_get();
     num_records   = 0;
@@ -683,8 +545,12 @@ static void report_num_records_request_execute(nrf_ble_cgms_t   * p_cgms,
     else if (p_racp_request->operator == RACP_OPERATOR_GREATER_OR_EQUAL)
     {
         uint16_t   index_of_offset;
-        uint16_t   offset_requested = uint16_decode(&p_cgms->racp_data.racp_request.p_operand[OPERAND_LESS_GREATER_FILTER_TYPE_SIZE]);
-        ret_code_t err_code         = record_index_offset_greater_or_equal_get(offset_requested, &index_of_offset);
+        uint16_t   offset_requested;
+        uint16_t   offset_max;
+        ret_code_t err_code;
+
+        (void)ble_racp_filter_uint16_range_get(p_racp_request, &offset_requested, &offset_max);
+        err_code = cgms_db_record_index_greater_or_equal_get(offset_requested, &index_of_offset);
 
         if (err_code != NRF_SUCCESS)
         {
@@ -696,16 +562,7 @@ static void report_num_records_request_execute(nrf_ble_cgms_t   * p_cgms,
         }
     }
 
-    p_cgms->racp_data.pending_racp_response.opcode      = RACP_OPCODE_NUM_RECS_RESPONSE;
-    p_cgms->racp_data.pending_racp_response.operator    = RACP_OPERATOR_NULL;
-    p_cgms->racp_data.pending_racp_response.operand_len = sizeof(uint16_t);
-    p_cgms->racp_data.pending_racp_response.p_operand   =
-        p_cgms->racp_data.pending_racp_response_operand;
-
-    p_cgms->racp_data.pending_racp_response_operand[0] = num_records & 0xFF;
-    p_cgms->racp_data.pending_racp_response_operand[1] = num_records >> 8;
-
-    racp_send(p_cgms, &p_cgms->racp_data.pending_racp_response);
+    racp_send(p_cgms, encoded_resp, ble_racp_num_recs_response_encode(num_records, encoded_resp));
 }
 
 
@@ -39,9 +39,9 @@
  */
 #include <stdint.h>
 #include <string.h>
-#include <time.h>
 #include "ble.h"
 #include "ble_srv_common.h"
+#include "ble_epoch.h"
 #include "nrf_ble_cgms.h"
 #include "cgms_sst.h"
 
@@ -62,48 +62,6 @@ void sst_decode(ble_cgms_sst_t * p_sst, const uint8_t * p_data, const uint16_t l
 }
 
 
-void convert_ble_time_c_time(ble_cgms_sst_t * p_sst, struct tm * p_c_time_date)
-{
-    p_c_time_date->tm_sec  = p_sst->date_time.seconds;
-    p_c_time_date->tm_min  = p_sst->date_time.minutes;
-    p_c_time_date->tm_hour = p_sst->date_time.hours;
-    p_c_time_date->tm_mday = p_sst->date_time.day;
-    p_c_time_date->tm_mon  = p_sst->date_time.month;
-    p_c_time_date->tm_year = p_sst->date_time.year - 1900;
-
-    // Ignore daylight saving for this conversion.
-    p_c_time_date->tm_isdst = 0;
-}
-
-
-void calc_sst(uint16_t offset, struct tm * p_c_time_date)
-{
-    time_t c_time_in_sec;
-
-    c_time_in_sec  = mktime(p_c_time_date);
-    c_time_in_sec  = c_time_in_sec - (offset * 60);
-    *p_c_time_date = *(localtime(&c_time_in_sec));
-
-    if (p_c_time_date->tm_isdst == 1)
-    {
-        // Daylight saving time is not used and must be removed.
-        p_c_time_date->tm_hour = p_c_time_date->tm_hour - 1;
-        p_c_time_date->tm_isdst = 0;
-    }
-}
-
-
-static void convert_c_time_ble_time(ble_cgms_sst_t * p_sst, struct tm * p_c_time_date)
-{
-    p_sst->date_time.seconds = p_c_time_date->tm_sec;
-    p_sst->date_time.minutes = p_c_time_date->tm_min;
-    p_sst->date_time.hours   = p_c_time_date->tm_hour;
-    p_sst->date_time.day     = p_c_time_date->tm_mday;
-    p_sst->date_time.month   = p_c_time_date->tm_mon;
-    p_sst->date_time.year    = p_c_time_date->tm_year + 1900;
-}
-
-
 static uint8_t sst_encode(ble_cgms_sst_t * p_sst, uint8_t * p_encoded_sst)
 {
     uint8_t len;
@@ -120,14 +78,19 @@ static uint8_t sst_encode(ble_cgms_sst_t * p_sst, uint8_t * p_encoded_sst)
 static ret_code_t cgm_update_sst(nrf_ble_cgms_t * p_cgms, ble_gatts_evt_write_t const * p_evt_write)
 {
     ble_cgms_sst_t sst;
-    struct tm      c_time_and_date;
+    uint32_t       seconds;
+    uint32_t const offset = (uint32_t)p_cgms->sensor_status.time_offset * 60;
 
     memset(&sst, 0, sizeof(ble_cgms_sst_t));
 
     sst_decode(&sst, p_evt_write->data, p_evt_write->len);
-    convert_ble_time_c_time(&sst, &c_time_and_date);
-    calc_sst(p_cgms->sensor_status.time_offset, &c_time_and_date);
-    convert_c_time_ble_time(&sst, &c_time_and_date);
+
+    // The written time is the current time. The session started time offset minutes before.
+    // Time zone and daylight saving time are kept as written.
+    if (ble_epoch_from_date_time(&sst.date_time, &seconds) && (seconds >= offset))
+    {
+        ble_epoch_to_date_time(seconds - offset, &sst.date_time);
+    }
 
     return cgms_sst_set(p_cgms, &sst);
 }
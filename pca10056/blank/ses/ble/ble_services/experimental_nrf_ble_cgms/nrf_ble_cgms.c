@@ -260,6 +260,7 @@ ret_code_t nrf_ble_cgms_init(nrf_ble_cgms_t * p_cgms, const nrf_ble_cgms_init_t
     p_cgms->nb_run_session     = 0;
     p_cgms->conn_handle        = BLE_CONN_HANDLE_INVALID;
     p_cgms->gatt_err_handler   = gatt_error_handler;
+    p_cgms->max_meas_len       = NRF_BLE_CGMS_MEAS_LEN_DEFAULT;
 
     p_cgms->feature.feature         = 0;
     p_cgms->feature.feature        |= NRF_BLE_CGMS_FEAT_MULTIPLE_BOND_SUPPORTED;
@@ -381,10 +382,12 @@ void nrf_ble_cgms_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
     {
         case BLE_GAP_EVT_CONNECTED:
             p_cgms->conn_handle    = p_ble_evt->evt.gap_evt.conn_handle;
+            p_cgms->max_meas_len   = NRF_BLE_CGMS_MEAS_LEN_DEFAULT;
             break;
 
         case BLE_GAP_EVT_DISCONNECTED:
-            p_cgms->conn_handle = BLE_CONN_HANDLE_INVALID;
+            p_cgms->conn_handle  = BLE_CONN_HANDLE_INVALID;
+            p_cgms->max_meas_len = NRF_BLE_CGMS_MEAS_LEN_DEFAULT;
             break;
 
         case BLE_GATTS_EVT_WRITE:
@@ -406,6 +409,19 @@ void nrf_ble_cgms_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
 }
 
 
+void nrf_ble_cgms_on_gatt_evt(nrf_ble_cgms_t * p_cgms, nrf_ble_gatt_evt_t const * p_gatt_evt)
+{
+    if (    (p_cgms->conn_handle == p_gatt_evt->conn_handle)
+        &&  (p_gatt_evt->evt_id == NRF_BLE_GATT_EVT_ATT_MTU_UPDATED))
+    {
+        uint16_t max_meas_len = p_gatt_evt->params.att_mtu_effective -
+                                NRF_BLE_CGMS_MEAS_OP_LEN - NRF_BLE_CGMS_MEAS_HANDLE_LEN;
+
+        p_cgms->max_meas_len = MIN(max_meas_len, NRF_BLE_CGMS_MEAS_LEN_MAX);
+    }
+}
+
+
 ret_code_t nrf_ble_cgms_meas_create(nrf_ble_cgms_t * p_cgms, ble_cgms_rec_t * p_rec)
 {
     uint32_t err_code       = NRF_SUCCESS;
@@ -69,6 +69,7 @@
 #include "ble_racp.h"
 #include "nrf_sdh_ble.h"
 #include "nrf_ble_gq.h"
+#include "nrf_ble_gatt.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -153,7 +154,10 @@ NRF_SDH_BLE_OBSERVER(_name ## _obs,
  * @{ */
 #define NRF_BLE_CGMS_MEAS_OP_LEN            1                               //!< Length of the opcode inside the Glucose Measurement packet.
 #define NRF_BLE_CGMS_MEAS_HANDLE_LEN        2                               //!< Length of the handle inside the Glucose Measurement packet.
-#define NRF_BLE_CGMS_MEAS_LEN_MAX           (BLE_GATT_ATT_MTU_DEFAULT - \
+#define NRF_BLE_CGMS_MEAS_LEN_DEFAULT       (BLE_GATT_ATT_MTU_DEFAULT - \
+                                             NRF_BLE_CGMS_MEAS_OP_LEN - \
+                                             NRF_BLE_CGMS_MEAS_HANDLE_LEN)  //!< Size of a transmitted Glucose Measurement before the ATT MTU has been exchanged.
+#define NRF_BLE_CGMS_MEAS_LEN_MAX           (NRF_SDH_BLE_GATT_MAX_MTU_SIZE - \
                                              NRF_BLE_CGMS_MEAS_OP_LEN - \
                                              NRF_BLE_CGMS_MEAS_HANDLE_LEN)  //!< Maximum size of a transmitted Glucose Measurement.
 
@@ -171,10 +175,9 @@ NRF_SDH_BLE_OBSERVER(_name ## _obs,
 #define NRF_BLE_CGMS_CRC_LEN                2                               //!< Length of the CRC bytes (if used).
 #define NRF_BLE_CGMS_SRT_LEN                2                               //!< Length of the Session Run Time attribute.
 
-#define NRF_BLE_CGMS_SOCP_RESP_LEN          (NRF_BLE_CGMS_MEAS_LEN_MAX - \
+#define NRF_BLE_CGMS_SOCP_RESP_LEN          (NRF_BLE_CGMS_MEAS_LEN_DEFAULT - \
                                             NRF_BLE_CGMS_SOCP_RESP_CODE_LEN) //!< Max lenth of a SOCP response.
 
-#define NRF_BLE_CGMS_RACP_PENDING_OPERANDS_MAX 2                             // !< Maximum number of pending Record Access Control Point operations.
 /** @} */
 
 /**
@@ -311,9 +314,7 @@ typedef struct
     uint16_t         racp_proc_records_ndx_last_to_send;                                    /**< The last record to send, can be used together with racp_proc_record_ndx to determine a range of records to send. (used by greater/less filters). */
     uint16_t         racp_proc_records_reported;                                            /**< Number of reported records. */
     ble_racp_value_t racp_request;                                                          /**< RACP procedure that has been requested from the peer. */
-    ble_racp_value_t pending_racp_response;                                                 /**< RACP response to be sent. */
     bool             racp_procesing_active;                                                 /**< RACP processing active. */
-    uint8_t          pending_racp_response_operand[NRF_BLE_CGMS_RACP_PENDING_OPERANDS_MAX]; /**< Operand of the RACP response to be sent. */
 } nrf_ble_cgms_racp_t;
 
 
@@ -349,6 +350,7 @@ struct ble_cgms_s
     uint16_t                    session_run_time;                            /**< Variable to store the expected run time of a session. */
     nrf_ble_cgm_status_t        sensor_status;                               /**< Structure to keep track of the sensor status. */
     nrf_ble_cgms_racp_t         racp_data;                                   /**< Structure to manage Record Access requests. */
+    uint16_t                    max_meas_len;                                /**< Current maximum Glucose Measurement notification length, adjusted according to the current ATT MTU. */
 };
 
 /** @} */
@@ -396,6 +398,18 @@ ret_code_t nrf_ble_cgms_init(nrf_ble_cgms_t * p_cgms, const nrf_ble_cgms_init_t
 void nrf_ble_cgms_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
 
 
+/**@brief Function for handling the GATT module's events.
+ *
+ * @details Tracks the effective ATT MTU of the connection so that Glucose Measurement
+ *          notifications, including those sent during a RACP Report Stored Records procedure,
+ *          carry as many records as fit into one packet.
+ *
+ * @param[in] p_cgms     Instance of the CGM Service.
+ * @param[in] p_gatt_evt Event received from the GATT module.
+ */
+void nrf_ble_cgms_on_gatt_evt(nrf_ble_cgms_t * p_cgms, nrf_ble_gatt_evt_t const * p_gatt_evt);
+
+
 /**@brief Function for reporting a new glucose measurement to the CGM Service module.
  *
  * @details The application calls this function after having performed a new glucose measurement.
@@ -43,6 +43,7 @@
 #include <stdlib.h>
 #include "nrf_ble_ots_c.h"
 #include "nrf_ble_ots_c_oacp.h"
+#include "nrf_ble_ots_c_olcp.h"
 #include "nrf_ble_ots_c_l2cap.h"
 #include "ble.h"
 
@@ -69,11 +70,44 @@ NRF_LOG_MODULE_REGISTER();
 #define BLE_OTS_OLCP_SUPPORT_FEATURE_REQ_NUM_OBJECTS_bp 2
 #define BLE_OTS_OLCP_SUPPORT_FEATURE_CLEAR_MARKING_bp   3
 
+#define BLE_OTS_OACP_RESP_LEN                           3   /**< Length of an OACP response: op code, request op code and result code. */
+#define BLE_OTS_OLCP_RESP_LEN                           3   /**< Length of an OLCP response: op code, request op code and result code. */
+#define BLE_OTS_OBJ_ID_LEN                              6   /**< Length of an object ID. */
+
 #define MODULE_INITIALIZED (p_ots_c->initialized)   /**< Macro designating whether the module was initialized properly. */
 
 static const ble_uuid_t m_ots_uuid = {BLE_UUID_OTS_SERVICE, BLE_UUID_TYPE_BLE};  /**< Object Transfer Service UUID. */
 
 
+/**@brief Function for suspending the object fetch, if one is in progress.
+ *
+ * @details The bytes received so far are kept, so that the fetch can be continued with
+ *          @ref nrf_ble_ots_c_obj_fetch_resume.
+ *
+ * @param[in] p_ots_c Pointer to the Object Transfer instance.
+ */
+static void fetch_suspend(nrf_ble_ots_c_t * p_ots_c)
+{
+    if (   (p_ots_c->fetch_state == NRF_BLE_OTS_C_FETCH_IDLE)
+        || (p_ots_c->fetch_state == NRF_BLE_OTS_C_FETCH_SUSPENDED))
+    {
+        return;
+    }
+
+    nrf_ble_ots_c_evt_t evt;
+
+    p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_SUSPENDED;
+
+    NRF_LOG_DEBUG("Object fetch suspended at offset %d.", p_ots_c->received_bytes);
+
+    evt.evt_type             = NRF_BLE_OTS_C_EVT_OBJ_READ_SUSPENDED;
+    evt.conn_handle          = p_ots_c->conn_handle;
+    evt.params.object.len    = p_ots_c->received_bytes;
+    evt.params.object.p_data = p_ots_c->current_obj->p_data;
+    p_ots_c->evt_handler(&evt);
+}
+
+
 /**@brief Function for intercepting the errors of GATTC and the BLE GATT Queue.
  *
  * @param[in] nrf_error   Error code.
@@ -88,6 +122,13 @@ static void gatt_error_handler(uint32_t   nrf_error,
 
     NRF_LOG_DEBUG("A GATT Client error has occurred on conn_handle: 0X%X", conn_handle);
 
+    if (   (p_ots_c->fetch_state == NRF_BLE_OTS_C_FETCH_SELECTING)
+        || (p_ots_c->fetch_state == NRF_BLE_OTS_C_FETCH_METADATA)
+        || (p_ots_c->fetch_state == NRF_BLE_OTS_C_FETCH_REQUESTED))
+    {
+        fetch_suspend(p_ots_c);
+    }
+
     if (p_ots_c->err_handler != NULL)
     {
         p_ots_c->err_handler(nrf_error);
@@ -107,6 +148,8 @@ ret_code_t nrf_ble_ots_c_init(nrf_ble_ots_c_t      * p_ots_c,
     memset (p_ots_c, 0, sizeof(nrf_ble_ots_c_t));
 
     p_ots_c->conn_handle      = BLE_CONN_HANDLE_INVALID;
+    p_ots_c->local_cid        = BLE_L2CAP_CID_INVALID;
+    p_ots_c->fetch_state      = NRF_BLE_OTS_C_FETCH_IDLE;
     p_ots_c->evt_handler      = p_ots_c_init->evt_handler;
     p_ots_c->err_handler      = p_ots_c_init->err_handler;
     p_ots_c->p_gatt_queue     = p_ots_c_init->p_gatt_queue;
@@ -201,6 +244,283 @@ ret_code_t nrf_ble_ots_c_obj_properties_read(nrf_ble_ots_c_t * const p_ots_c)
 }
 
 
+ret_code_t nrf_ble_ots_c_obj_id_read(nrf_ble_ots_c_t * const p_ots_c)
+{
+    VERIFY_MODULE_INITIALIZED();
+
+    if (p_ots_c->service.object_id_char.handle_value == BLE_GATT_HANDLE_INVALID)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    nrf_ble_gq_req_t read_req;
+
+    memset(&read_req, 0, sizeof(nrf_ble_gq_req_t));
+
+    read_req.type                     = NRF_BLE_GQ_REQ_GATTC_READ;
+    read_req.error_handler.cb         = p_ots_c->gatt_err_handler;
+    read_req.error_handler.p_ctx      = (nrf_ble_ots_c_t *)p_ots_c;
+    read_req.params.gattc_read.handle = p_ots_c->service.object_id_char.handle_value;
+    read_req.params.gattc_read.offset = 0;
+
+    return nrf_ble_gq_item_add(p_ots_c->p_gatt_queue, &read_req, p_ots_c->conn_handle);
+}
+
+
+/**@brief Function for queuing the metadata reads of an object fetch.
+ *
+ * @details Both reads are added to the BLE GATT Queue at once, so that the Object Properties
+ *          characteristic is read as soon as the Object Size read is answered.
+ *
+ * @param[in] p_ots_c Pointer to the Object Transfer instance.
+ */
+static ret_code_t fetch_metadata_read(nrf_ble_ots_c_t * const p_ots_c)
+{
+    ret_code_t err_code;
+
+    p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_METADATA;
+
+    err_code = nrf_ble_ots_c_obj_size_read(p_ots_c);
+    if (err_code == NRF_SUCCESS)
+    {
+        err_code = nrf_ble_ots_c_obj_properties_read(p_ots_c);
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for starting or restarting an object fetch.
+ *
+ * @details If the object is fetched by ID, it is selected first. Otherwise the metadata of
+ *          the current object is read right away.
+ *
+ * @param[in] p_ots_c Pointer to the Object Transfer instance.
+ */
+static ret_code_t fetch_start(nrf_ble_ots_c_t * const p_ots_c)
+{
+    ret_code_t err_code;
+
+    if (   (p_ots_c->conn_handle == BLE_CONN_HANDLE_INVALID)
+        || !ots_gatt_handles_are_valid(p_ots_c))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (p_ots_c->fetch_by_id)
+    {
+        p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_SELECTING;
+
+        err_code = nrf_ble_ots_c_olcp_goto(p_ots_c, p_ots_c->fetch_obj_id);
+    }
+    else
+    {
+        err_code = fetch_metadata_read(p_ots_c);
+    }
+    if (err_code != NRF_SUCCESS)
+    {
+        p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_SUSPENDED;
+    }
+
+    return err_code;
+}
+
+
+ret_code_t nrf_ble_ots_c_obj_fetch(nrf_ble_ots_c_t * const p_ots_c, ble_data_t * p_obj)
+{
+    VERIFY_MODULE_INITIALIZED();
+    VERIFY_PARAM_NOT_NULL(p_obj);
+
+    if (   (p_ots_c->fetch_state != NRF_BLE_OTS_C_FETCH_IDLE)
+        && (p_ots_c->fetch_state != NRF_BLE_OTS_C_FETCH_SUSPENDED))
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    p_ots_c->current_obj    = p_obj;
+    p_ots_c->received_bytes = 0;
+    p_ots_c->transfer_len   = 0;
+    p_ots_c->fetch_by_id    = false;
+
+    return fetch_start(p_ots_c);
+}
+
+
+ret_code_t nrf_ble_ots_c_obj_fetch_by_id(nrf_ble_ots_c_t * const p_ots_c,
+                                         uint64_t                obj_id,
+                                         ble_data_t            * p_obj)
+{
+    VERIFY_MODULE_INITIALIZED();
+    VERIFY_PARAM_NOT_NULL(p_obj);
+
+    if (   (p_ots_c->fetch_state != NRF_BLE_OTS_C_FETCH_IDLE)
+        && (p_ots_c->fetch_state != NRF_BLE_OTS_C_FETCH_SUSPENDED))
+    {
+        return NRF_ERROR_BUSY;
+    }
+    if (p_ots_c->service.object_list_cp_char.handle_value == BLE_GATT_HANDLE_INVALID)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    p_ots_c->current_obj    = p_obj;
+    p_ots_c->received_bytes = 0;
+    p_ots_c->transfer_len   = 0;
+    p_ots_c->fetch_by_id    = true;
+    p_ots_c->fetch_obj_id   = obj_id;
+
+    return fetch_start(p_ots_c);
+}
+
+
+ret_code_t nrf_ble_ots_c_obj_fetch_resume(nrf_ble_ots_c_t * const p_ots_c)
+{
+    VERIFY_MODULE_INITIALIZED();
+
+    if (p_ots_c->fetch_state != NRF_BLE_OTS_C_FETCH_SUSPENDED)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    return fetch_start(p_ots_c);
+}
+
+
+/**@brief Function for requesting the object once its metadata has been read.
+ *
+ * @param[in] p_ots_c Pointer to the Object Transfer instance.
+ * @param[in] prop    Properties of the object.
+ */
+static void fetch_on_metadata(nrf_ble_ots_c_t * p_ots_c, nrf_ble_ots_c_obj_properties_t prop)
+{
+    ret_code_t err_code;
+
+    if (!prop.decoded.is_read_permitted)
+    {
+        NRF_LOG_WARNING("Object fetch failed, the object cannot be read.");
+        p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_IDLE;
+        if (p_ots_c->err_handler != NULL)
+        {
+            p_ots_c->err_handler(NRF_ERROR_FORBIDDEN);
+        }
+        return;
+    }
+
+    if (p_ots_c->received_bytes > p_ots_c->transfer_len)
+    {
+        // The object shrank while the fetch was suspended, so it is not the same object.
+        p_ots_c->received_bytes = 0;
+    }
+
+    if (p_ots_c->received_bytes == p_ots_c->transfer_len)
+    {
+        nrf_ble_ots_c_evt_t evt;
+
+        p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_IDLE;
+
+        evt.evt_type             = NRF_BLE_OTS_C_EVT_OBJ_READ;
+        evt.conn_handle          = p_ots_c->conn_handle;
+        evt.params.object.len    = p_ots_c->transfer_len;
+        evt.params.object.p_data = p_ots_c->current_obj->p_data;
+        p_ots_c->evt_handler(&evt);
+        return;
+    }
+
+    err_code = nrf_ble_ots_c_oacp_read_object(p_ots_c,
+                                              p_ots_c->received_bytes,
+                                              p_ots_c->transfer_len - p_ots_c->received_bytes);
+    if (err_code != NRF_SUCCESS)
+    {
+        fetch_suspend(p_ots_c);
+        return;
+    }
+
+    p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_REQUESTED;
+}
+
+
+/**@brief Function for starting to receive the object when the peer accepts the OACP Read procedure.
+ *
+ * @details The receive buffers are posted before the response is passed on to the application,
+ *          so that they are in place when the peer starts sending.
+ *
+ * @param[in] p_ots_c   Pointer to the Object Transfer instance.
+ * @param[in] p_ble_evt Pointer to the SoftDevice event.
+ */
+static void fetch_on_hvx(nrf_ble_ots_c_t * p_ots_c, const ble_evt_t * p_ble_evt)
+{
+    ble_gattc_evt_hvx_t const * p_hvx = &p_ble_evt->evt.gattc_evt.params.hvx;
+    ret_code_t                  err_code;
+
+    if (   (p_ots_c->fetch_state != NRF_BLE_OTS_C_FETCH_REQUESTED)
+        || (p_ots_c->conn_handle != p_ble_evt->evt.gattc_evt.conn_handle)
+        || (p_hvx->handle != p_ots_c->service.object_action_cp_char.handle_value)
+        || (p_hvx->len < BLE_OTS_OACP_RESP_LEN)
+        || (p_hvx->data[0] != NRF_BLE_OTS_C_OACP_PROC_RESP)
+        || (p_hvx->data[1] != NRF_BLE_OTS_C_OACP_PROC_READ))
+    {
+        return;
+    }
+
+    if (p_hvx->data[2] != NRF_BLE_OTS_C_OACP_RES_SUCCESS)
+    {
+        // The result code is passed on to the application in NRF_BLE_OTS_C_EVT_OACP_RESP.
+        p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_SUSPENDED;
+        return;
+    }
+
+    p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_RECEIVING;
+
+    err_code = nrf_ble_ots_c_l2cap_obj_receive_at(p_ots_c,
+                                                  p_ots_c->current_obj,
+                                                  p_ots_c->received_bytes,
+                                                  p_ots_c->transfer_len - p_ots_c->received_bytes);
+    if (err_code != NRF_SUCCESS)
+    {
+        fetch_suspend(p_ots_c);
+        if (p_ots_c->err_handler != NULL)
+        {
+            p_ots_c->err_handler(err_code);
+        }
+    }
+}
+
+
+/**@brief Function for reading the metadata of the object once the peer has selected it.
+ *
+ * @param[in] p_ots_c   Pointer to the Object Transfer instance.
+ * @param[in] p_ble_evt Pointer to the SoftDevice event.
+ */
+static void fetch_on_olcp_hvx(nrf_ble_ots_c_t * p_ots_c, const ble_evt_t * p_ble_evt)
+{
+    ble_gattc_evt_hvx_t const * p_hvx = &p_ble_evt->evt.gattc_evt.params.hvx;
+
+    if (   (p_ots_c->fetch_state != NRF_BLE_OTS_C_FETCH_SELECTING)
+        || (p_ots_c->conn_handle != p_ble_evt->evt.gattc_evt.conn_handle)
+        || (p_hvx->handle != p_ots_c->service.object_list_cp_char.handle_value)
+        || (p_hvx->len < BLE_OTS_OLCP_RESP_LEN)
+        || (p_hvx->data[0] != NRF_BLE_OTS_C_OLCP_PROC_RESP)
+        || (p_hvx->data[1] != NRF_BLE_OTS_C_OLCP_PROC_GOTO))
+    {
+        return;
+    }
+
+    if (p_hvx->data[2] != NRF_BLE_OTS_C_OLCP_RES_SUCCESS)
+    {
+        // The object cannot be selected, so the fetch cannot be resumed either. The result code
+        // is passed on to the application in NRF_BLE_OTS_C_EVT_OLCP_RESP.
+        NRF_LOG_WARNING("Object fetch failed, the object cannot be selected.");
+        p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_IDLE;
+        return;
+    }
+
+    if (fetch_metadata_read(p_ots_c) != NRF_SUCCESS)
+    {
+        fetch_suspend(p_ots_c);
+    }
+}
+
+
 static void prop_read_rsp_decode(nrf_ble_ots_c_t * p_ots_c, const ble_evt_t * p_ble_evt)
 {
     const ble_gattc_evt_read_rsp_t * p_response;
@@ -214,6 +534,11 @@ static void prop_read_rsp_decode(nrf_ble_ots_c_t * p_ots_c, const ble_evt_t * p_
     evt.params.prop.raw = properties;
     evt.evt_type        = NRF_BLE_OTS_C_EVT_PROP_READ_RESP;
     p_ots_c->evt_handler(&evt);
+
+    if (p_ots_c->fetch_state == NRF_BLE_OTS_C_FETCH_METADATA)
+    {
+        fetch_on_metadata(p_ots_c, evt.params.prop);
+    }
 }
 
 /**@brief     Function for handling read response events.
@@ -285,12 +610,30 @@ static void on_read_rsp(nrf_ble_ots_c_t * p_ots_c, const ble_evt_t * p_ble_evt)
         len += sizeof(uint32_t);
 /*lint -restore*/
 
+        if (p_ots_c->fetch_state == NRF_BLE_OTS_C_FETCH_METADATA)
+        {
+            // Only as much of the object as fits in the buffer is fetched.
+            p_ots_c->transfer_len = MIN(evt.params.size.current_size, p_ots_c->current_obj->len);
+        }
+
         p_ots_c->evt_handler(&evt);
     }
     if (p_response->handle == p_ots_c->service.object_prop_char.handle_value)
     {
         prop_read_rsp_decode(p_ots_c, p_ble_evt);
     }
+    if (   (p_response->handle == p_ots_c->service.object_id_char.handle_value)
+        && (p_response->handle != BLE_GATT_HANDLE_INVALID))
+    {
+        nrf_ble_ots_c_evt_t evt;
+
+        evt.conn_handle   = p_ble_evt->evt.gattc_evt.conn_handle;
+        evt.evt_type      = NRF_BLE_OTS_C_EVT_OBJ_ID_READ_RESP;
+        // An empty value means that no object is selected.
+        evt.params.obj_id = (p_response->len == BLE_OTS_OBJ_ID_LEN) ? uint48_decode(p_response->data) : 0;
+
+        p_ots_c->evt_handler(&evt);
+    }
 }
 
 
@@ -302,6 +645,9 @@ void nrf_ble_ots_c_on_db_disc_evt(nrf_ble_ots_c_t const * const p_ots_c,
     nrf_ble_ots_c_evt_t evt;
     ble_gatt_db_char_t* p_chars;
 
+    // The list characteristics are optional, so the handles not found must be invalid.
+    memset(&evt, 0, sizeof(evt));
+
     p_chars      = p_evt->params.discovered_db.charateristics;
     evt.evt_type = NRF_BLE_OTS_C_EVT_DISCOVERY_FAILED;
 
@@ -357,6 +703,28 @@ void nrf_ble_ots_c_on_db_disc_evt(nrf_ble_ots_c_t const * const p_ots_c,
                     evt.params.handles.object_action_cp_cccd.handle = p_chars[i].cccd_handle;
                     break;
 
+                case BLE_UUID_OTS_OBJECT_ID:
+                    NRF_LOG_DEBUG("Object ID Characteristic found.\r\n");
+                    memcpy(&evt.params.handles.object_id_char,
+                           &p_chars[i].characteristic,
+                           sizeof(ble_gattc_char_t));
+                    break;
+
+                case BLE_UUID_OTS_OLCP:
+                    NRF_LOG_DEBUG("Object List Control Point found. CCCD Handle %x\r\n", p_chars[i].cccd_handle);
+                    memcpy(&evt.params.handles.object_list_cp_char,
+                           &p_chars[i].characteristic,
+                           sizeof(ble_gattc_char_t));
+                    evt.params.handles.object_list_cp_cccd.handle = p_chars[i].cccd_handle;
+                    break;
+
+                case BLE_UUID_OTS_LF:
+                    NRF_LOG_DEBUG("Object List Filter Characteristic found.\r\n");
+                    memcpy(&evt.params.handles.list_filter_char,
+                           &p_chars[i].characteristic,
+                           sizeof(ble_gattc_char_t));
+                    break;
+
                 default:
                     break;
             }
@@ -387,6 +755,8 @@ static void on_disconnect(nrf_ble_ots_c_t * const p_ots_c, ble_evt_t const * con
 {
     if (p_ots_c->conn_handle == p_ble_evt->evt.gap_evt.conn_handle)
     {
+        fetch_suspend(p_ots_c);
+
         p_ots_c->conn_handle = BLE_CONN_HANDLE_INVALID;
 
         if (ots_gatt_handles_are_valid(p_ots_c))
@@ -424,6 +794,19 @@ void nrf_ble_ots_c_on_ble_evt(ble_evt_t const * const p_ble_evt,
             on_read_rsp(p_ots_c, p_ble_evt);
             break;
 
+        case BLE_GATTC_EVT_HVX:
+            fetch_on_hvx(p_ots_c, p_ble_evt);
+            fetch_on_olcp_hvx(p_ots_c, p_ble_evt);
+            break;
+
+        case BLE_L2CAP_EVT_CH_RELEASED:
+            if (   (p_ots_c->local_cid != BLE_L2CAP_CID_INVALID)
+                && (p_ots_c->local_cid == p_ble_evt->evt.l2cap_evt.local_cid))
+            {
+                fetch_suspend(p_ots_c);
+            }
+            break;
+
         case BLE_GATTC_EVT_WRITE_RSP:
             if ((p_ble_evt->evt.gattc_evt.error_handle != BLE_GATT_HANDLE_INVALID)
                 && (p_ble_evt->evt.gattc_evt.error_handle ==
@@ -439,6 +822,20 @@ void nrf_ble_ots_c_on_ble_evt(ble_evt_t const * const p_ble_evt,
                                  p_ble_evt->evt.gattc_evt.error_handle,
                                  p_ble_evt->evt.gattc_evt.gatt_status);
                 }
+
+                if (p_ots_c->fetch_state == NRF_BLE_OTS_C_FETCH_REQUESTED)
+                {
+                    fetch_suspend(p_ots_c);
+                }
+            }
+            else if (   (p_ble_evt->evt.gattc_evt.error_handle != BLE_GATT_HANDLE_INVALID)
+                     && (p_ble_evt->evt.gattc_evt.error_handle ==
+                         p_ots_c->service.object_list_cp_char.handle_value)
+                     && (p_ots_c->fetch_state == NRF_BLE_OTS_C_FETCH_SELECTING))
+            {
+                NRF_LOG_INFO("Write to OLCP failed, error response %x\r\n",
+                             p_ble_evt->evt.gattc_evt.gatt_status);
+                fetch_suspend(p_ots_c);
             }
             break;
 
@@ -447,6 +844,7 @@ void nrf_ble_ots_c_on_ble_evt(ble_evt_t const * const p_ble_evt,
     }
     ots_c_l2cap_on_ble_evt(p_ots_c, p_ble_evt);
     ots_c_oacp_on_ble_evt(p_ots_c, p_ble_evt);
+    ots_c_olcp_on_ble_evt(p_ots_c, p_ble_evt);
 }
 
 
@@ -466,6 +864,10 @@ ret_code_t nrf_ble_ots_c_handles_assign(nrf_ble_ots_c_t               * const p_
         p_ots_c->service.object_prop_char.handle_value      = p_peer_handles->object_prop_char.handle_value;
         p_ots_c->service.object_action_cp_char.handle_value = p_peer_handles->object_action_cp_char.handle_value;
         p_ots_c->service.object_action_cp_cccd.handle       = p_peer_handles->object_action_cp_cccd.handle;
+        p_ots_c->service.object_id_char.handle_value        = p_peer_handles->object_id_char.handle_value;
+        p_ots_c->service.object_list_cp_char.handle_value   = p_peer_handles->object_list_cp_char.handle_value;
+        p_ots_c->service.object_list_cp_cccd.handle         = p_peer_handles->object_list_cp_cccd.handle;
+        p_ots_c->service.list_filter_char.handle_value      = p_peer_handles->list_filter_char.handle_value;
 
     }
 
@@ -58,6 +58,7 @@
 #include "ble_srv_common.h"
 #include "ble_db_discovery.h"
 #include "sdk_errors.h"
+#include "sdk_config.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -115,6 +116,49 @@ typedef enum
     NRF_BLE_OTS_C_OACP_RES_OPER_FAILED    = 0x0A  //!< Operation failed.
 } ble_ots_c_oacp_res_code_t;
 
+/** @brief Types of Object List Control Point Procedures. */
+typedef enum
+{
+    NRF_BLE_OTS_C_OLCP_PROC_FIRST         = 0x01, //!< Select the first object.
+    NRF_BLE_OTS_C_OLCP_PROC_LAST          = 0x02, //!< Select the last object.
+    NRF_BLE_OTS_C_OLCP_PROC_PREVIOUS      = 0x03, //!< Select the previous object.
+    NRF_BLE_OTS_C_OLCP_PROC_NEXT          = 0x04, //!< Select the next object.
+    NRF_BLE_OTS_C_OLCP_PROC_GOTO          = 0x05, //!< Select an object by ID.
+    NRF_BLE_OTS_C_OLCP_PROC_ORDER         = 0x06, //!< Sort the list.
+    NRF_BLE_OTS_C_OLCP_PROC_REQ_NUM_OBJS  = 0x07, //!< Request the number of objects.
+    NRF_BLE_OTS_C_OLCP_PROC_CLEAR_MARKING = 0x08, //!< Clear the marking of the objects.
+    NRF_BLE_OTS_C_OLCP_PROC_RESP          = 0x70  //!< Procedure response.
+} ble_ots_c_olcp_proc_type_t;
+
+/** @brief Object List Control Point return codes. */
+typedef enum
+{
+    NRF_BLE_OTS_C_OLCP_RES_SUCCESS          = 0x01, //!< Success.
+    NRF_BLE_OTS_C_OLCP_RES_OPCODE_NOT_SUP   = 0x02, //!< Not supported.
+    NRF_BLE_OTS_C_OLCP_RES_INV_PARAM        = 0x03, //!< Invalid parameter.
+    NRF_BLE_OTS_C_OLCP_RES_OPER_FAILED      = 0x04, //!< Operation failed.
+    NRF_BLE_OTS_C_OLCP_RES_OUT_OF_BONDS     = 0x05, //!< No object before the first or after the last object.
+    NRF_BLE_OTS_C_OLCP_RES_TOO_MANY_OBJ     = 0x06, //!< Too many objects.
+    NRF_BLE_OTS_C_OLCP_RES_NO_OBJ           = 0x07, //!< The list is empty.
+    NRF_BLE_OTS_C_OLCP_RES_OBJ_ID_NOT_FOUND = 0x08  //!< No object has the ID.
+} ble_ots_c_olcp_res_code_t;
+
+/** @brief Types of Object List Filters. */
+typedef enum
+{
+    NRF_BLE_OTS_C_LIST_FILTER_NO_FILTER     = 0x00, //!< All objects. No parameter.
+    NRF_BLE_OTS_C_LIST_FILTER_NAME_STARTS   = 0x01, //!< Name starts with the parameter string.
+    NRF_BLE_OTS_C_LIST_FILTER_NAME_ENDS     = 0x02, //!< Name ends with the parameter string.
+    NRF_BLE_OTS_C_LIST_FILTER_NAME_CONTAINS = 0x03, //!< Name contains the parameter string.
+    NRF_BLE_OTS_C_LIST_FILTER_NAME_EXACTLY  = 0x04, //!< Name is the parameter string.
+    NRF_BLE_OTS_C_LIST_FILTER_TYPE          = 0x05, //!< Object type is the 16-bit or 128-bit UUID parameter.
+    NRF_BLE_OTS_C_LIST_FILTER_CREATED       = 0x06, //!< Created between the two date-time parameters.
+    NRF_BLE_OTS_C_LIST_FILTER_MODIFIED      = 0x07, //!< Modified between the two date-time parameters.
+    NRF_BLE_OTS_C_LIST_FILTER_CURRENT_SIZE  = 0x08, //!< Current size between the two uint32 parameters.
+    NRF_BLE_OTS_C_LIST_FILTER_ALLOC_SIZE    = 0x09, //!< Allocated size between the two uint32 parameters.
+    NRF_BLE_OTS_C_LIST_FILTER_MARKED        = 0x0A  //!< Marked objects. No parameter.
+} ble_ots_c_list_filter_type_t;
+
 /**@brief Type of the Object Transfer Service Client event. */
 typedef enum
 {
@@ -127,9 +171,23 @@ typedef enum
     NRF_BLE_OTS_C_EVT_OBJ_WRITE,          //!< Event indicating that the Object Transfer Service Client finished writing an object to the peer.
     NRF_BLE_OTS_C_EVT_CHANNEL_RELEASED,   //!< Event indicating that the L2CAP Connection Oriented Channel was disconnected.
     NRF_BLE_OTS_C_EVT_SIZE_READ_RESP,     //!< Event indicating that the object size characteristic was read.
-    NRF_BLE_OTS_C_EVT_PROP_READ_RESP      //!< Event indicating that the object properties characteristic was read.
+    NRF_BLE_OTS_C_EVT_PROP_READ_RESP,     //!< Event indicating that the object properties characteristic was read.
+    NRF_BLE_OTS_C_EVT_OBJ_READ_SUSPENDED, //!< Event indicating that an object fetch was interrupted. The bytes received so far will be provided in the event. See @ref nrf_ble_ots_c_obj_fetch_resume.
+    NRF_BLE_OTS_C_EVT_OLCP_RESP,          //!< Event indicating that a response was received (result of a write to the OLCP).
+    NRF_BLE_OTS_C_EVT_OBJ_ID_READ_RESP    //!< Event indicating that the object ID characteristic was read.
 } nrf_ble_ots_c_evt_type_t;
 
+/**@brief States of an object fetch. See @ref nrf_ble_ots_c_obj_fetch. */
+typedef enum
+{
+    NRF_BLE_OTS_C_FETCH_IDLE,      //!< No fetch in progress.
+    NRF_BLE_OTS_C_FETCH_SELECTING, //!< The OLCP Go To procedure was written, waiting for the response.
+    NRF_BLE_OTS_C_FETCH_METADATA,  //!< The Object Size and Object Properties characteristics are being read.
+    NRF_BLE_OTS_C_FETCH_REQUESTED, //!< The OACP Read procedure was written, waiting for the response.
+    NRF_BLE_OTS_C_FETCH_RECEIVING, //!< The object is being received on the L2CAP channel.
+    NRF_BLE_OTS_C_FETCH_SUSPENDED  //!< The fetch was interrupted, and can be resumed from @ref nrf_ble_ots_c_t::received_bytes.
+} nrf_ble_ots_c_fetch_state_t;
+
 /** @brief Structure to hold the features of a server. */
 typedef struct
 {
@@ -181,6 +239,10 @@ typedef struct
     ble_gattc_char_t    object_prop_char;      //!< Object properties (0x2AC4).
     ble_gattc_char_t    object_action_cp_char; //!< Object action control point (0x2AC5).
     ble_gattc_desc_t    object_action_cp_cccd; //!< Object action control point descriptor. Enables or disables Object Transfer notifications.
+    ble_gattc_char_t    object_id_char;        //!< Object ID (0x2AC3). Only present if the server has more than one object.
+    ble_gattc_char_t    object_list_cp_char;   //!< Object list control point (0x2AC6). Only present if the server has more than one object.
+    ble_gattc_desc_t    object_list_cp_cccd;   //!< Object list control point descriptor. Enables or disables OLCP indications.
+    ble_gattc_char_t    list_filter_char;      //!< Object list filter (0x2AC7). Only present if the server has more than one object.
 } nrf_ble_ots_c_service_t;
 
 /** @brief Structure to hold responses received when writing to the Object Action Control Point on the server. */
@@ -190,6 +252,14 @@ typedef struct
     ble_ots_c_oacp_res_code_t  result_code;
 } nrf_ble_ots_c_oacp_response_t;
 
+/** @brief Structure to hold responses received when writing to the Object List Control Point on the server. */
+typedef struct
+{
+    ble_ots_c_olcp_proc_type_t request_op_code;
+    ble_ots_c_olcp_res_code_t  result_code;
+    uint32_t                   num_objects; /**< Number of objects in the list, if @p request_op_code is @ref NRF_BLE_OTS_C_OLCP_PROC_REQ_NUM_OBJS. */
+} nrf_ble_ots_c_olcp_response_t;
+
 /** @brief Structure to hold the size of the object on the server when read from the Object Size characteristic on the server. */
 typedef struct
 {
@@ -208,9 +278,11 @@ typedef struct
         nrf_ble_ots_c_feature_t        feature;  /**< Will be provided if the event type is @ref NRF_BLE_OTS_C_EVT_FEATURE_READ_RESP.*/
         nrf_ble_ots_c_service_t        handles;  /**< Handles that the Object Transfer service occupies in the peer device. Will be filled if the event type is @ref NRF_BLE_OTS_C_EVT_DISCOVERY_COMPLETE.*/
         nrf_ble_ots_c_oacp_response_t  response; /**< Will be provided if the event type is @ref NRF_BLE_OTS_C_EVT_OACP_RESP. */
-        ble_data_t                     object;   /**< Will be provided if the event type is @ref NRF_BLE_OTS_C_EVT_OBJ_READ. */
+        ble_data_t                     object;   /**< Will be provided if the event type is @ref NRF_BLE_OTS_C_EVT_OBJ_READ or @ref NRF_BLE_OTS_C_EVT_OBJ_READ_SUSPENDED. */
         nrf_ble_ots_c_obj_size         size;     /**< Will be provided if the event type is @ref NRF_BLE_OTS_C_EVT_SIZE_READ_RESP. */
         nrf_ble_ots_c_obj_properties_t prop;     /**< Will be provided if the eevnt type is @ref NRF_BLE_OTS_C_EVT_PROP_READ_RESP. */
+        nrf_ble_ots_c_olcp_response_t  olcp_response; /**< Will be provided if the event type is @ref NRF_BLE_OTS_C_EVT_OLCP_RESP. */
+        uint64_t                       obj_id;   /**< Will be provided if the event type is @ref NRF_BLE_OTS_C_EVT_OBJ_ID_READ_RESP. */
     } params;
 } nrf_ble_ots_c_evt_t;
 
@@ -234,9 +306,16 @@ typedef struct
     uint16_t                    local_cid;         /**< Connection ID of the current connection. */
     ble_l2cap_evt_ch_setup_t    ch_setup;          /**< Parameters of the L2CAP Channel Setup Completed event. */
     uint32_t                    transmitted_bytes; /**< Variable used when transferring an object to the peer. */
-    uint32_t                    received_bytes;    /**< Variable used when transferring an object from the peer. */
+    uint32_t                    received_bytes;    /**< Offset in the object up to which it has been received from the peer. */
+    uint32_t                    transfer_len;      /**< Offset in the object at which the current receive ends. */
     ble_data_t                * current_obj;       /**< Pointer to the current object to be transferred. */
     nrf_ble_gq_t              * p_gatt_queue;      /**< Pointer to the BLE GATT Queue instance. */
+    nrf_ble_ots_c_fetch_state_t fetch_state;       /**< State of the object fetch. */
+    bool                        fetch_by_id;       /**< The object of the fetch is selected by ID before it is read. */
+    uint64_t                    fetch_obj_id;      /**< ID of the object of the fetch, if @p fetch_by_id is set. */
+    uint8_t                     rx_bufs_posted;    /**< Number of receive buffers held by the SoftDevice. */
+    uint8_t                     rx_buf_next;       /**< Index of the next receive buffer to post. */
+    uint8_t                     rx_bufs[BLE_OTS_C_L2CAP_RX_QUEUE_SIZE][BLE_OTS_C_L2CAP_SDU_SIZE]; /**< Receive buffers, posted to the SoftDevice in turn. */
 } nrf_ble_ots_c_t;
 
 
@@ -309,6 +388,91 @@ ret_code_t nrf_ble_ots_c_obj_size_read(nrf_ble_ots_c_t * const p_ots_c);
 ret_code_t nrf_ble_ots_c_obj_properties_read(nrf_ble_ots_c_t * const p_ots_c);
 
 
+/**@brief Function for fetching the current object of the server.
+
+   @details The Object Size and Object Properties characteristics are read back to back through
+            the BLE GATT Queue. If the object can be read, the OACP Read procedure is then written
+            for as much of the object as fits in @p p_obj, and the object is received on the L2CAP
+            channel through @ref BLE_OTS_C_L2CAP_RX_QUEUE_SIZE posted buffers. The L2CAP channel
+            must be set up and OACP indications enabled before calling this function.
+            @ref NRF_BLE_OTS_C_EVT_OBJ_READ is raised when the object has been received.
+
+            If the link or the channel is lost before that, @ref NRF_BLE_OTS_C_EVT_OBJ_READ_SUSPENDED
+            is raised and the fetch can be continued with @ref nrf_ble_ots_c_obj_fetch_resume. The
+            same is true if the peer rejects the OACP Read procedure.
+
+   @param[in,out] p_ots_c Pointer to Object Transfer Client structure.
+   @param[in]     p_obj   Buffer in which to store the object. Must stay valid until the fetch
+                          is complete or abandoned.
+
+   @retval NRF_SUCCESS             The metadata reads were queued.
+   @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+   @retval NRF_ERROR_BUSY          If a fetch is already in progress.
+   @retval NRF_ERROR_INVALID_STATE If there is no connection, or the handles of the peer are invalid.
+   @retval err_code                Otherwise, this API propagates the error code returned by function @ref nrf_ble_gq_item_add.
+*/
+ret_code_t nrf_ble_ots_c_obj_fetch(nrf_ble_ots_c_t * const p_ots_c, ble_data_t * p_obj);
+
+
+/**@brief Function for resuming a suspended object fetch.
+
+   @details Call this function once the link has been reestablished and assigned with
+            @ref nrf_ble_ots_c_handles_assign, and the L2CAP channel has been set up again.
+            The metadata of the object is read again, and the OACP Read procedure is written
+            from the offset at which the fetch was interrupted. If the object is now smaller than
+            that offset, it is fetched again from the start. The object is otherwise assumed to
+            be unchanged.
+
+   @param[in,out] p_ots_c Pointer to Object Transfer Client structure.
+
+   @retval NRF_SUCCESS             The metadata reads were queued.
+   @retval NRF_ERROR_INVALID_STATE If no fetch is suspended, there is no connection, or the handles
+                                   of the peer are invalid.
+   @retval err_code                Otherwise, this API propagates the error code returned by function @ref nrf_ble_gq_item_add.
+*/
+ret_code_t nrf_ble_ots_c_obj_fetch_resume(nrf_ble_ots_c_t * const p_ots_c);
+
+
+/**@brief Function for fetching an object of the server by its ID.
+
+   @details The object is selected with the OLCP Go To procedure, and then fetched as with
+            @ref nrf_ble_ots_c_obj_fetch, so the objects before it in the list do not have to be
+            walked. OLCP and OACP indications must be enabled before calling this function.
+            If the server has no object with the ID, the fetch ends, and the result is provided
+            with @ref NRF_BLE_OTS_C_EVT_OLCP_RESP. A suspended fetch selects the object again
+            when it is resumed.
+
+   @note    The Object List Control Point is only found if @ref BLE_GATT_DB_MAX_CHARS leaves
+            room for the 9 characteristics of the service.
+
+   @param[in,out] p_ots_c Pointer to Object Transfer Client structure.
+   @param[in]     obj_id  ID of the object.
+   @param[in]     p_obj   Buffer in which to store the object. Must stay valid until the fetch
+                          is complete or abandoned.
+
+   @retval NRF_SUCCESS             The OLCP Go To procedure was queued.
+   @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+   @retval NRF_ERROR_BUSY          If a fetch is already in progress.
+   @retval NRF_ERROR_NOT_SUPPORTED If the Object List Control Point of the peer was not discovered.
+   @retval NRF_ERROR_INVALID_STATE If there is no connection, or the handles of the peer are invalid.
+   @retval err_code                Otherwise, this API propagates the error code returned by function @ref nrf_ble_gq_item_add.
+*/
+ret_code_t nrf_ble_ots_c_obj_fetch_by_id(nrf_ble_ots_c_t * const p_ots_c,
+                                         uint64_t                obj_id,
+                                         ble_data_t            * p_obj);
+
+
+/**@brief Function for reading the Object ID characteristic (@ref BLE_UUID_OTS_OBJECT_ID) on the server.
+
+   @param[in,out] p_ots_c Pointer to Object Transfer Client structure.
+
+   @retval NRF_SUCCESS             Operation success.
+   @retval NRF_ERROR_INVALID_STATE If the Object ID characteristic has not been discovered.
+   @retval err_code                Otherwise, this API propagates the error code returned by function @ref nrf_ble_gq_item_add.
+*/
+ret_code_t nrf_ble_ots_c_obj_id_read(nrf_ble_ots_c_t * const p_ots_c);
+
+
 /**@brief Function for handling the Application's BLE Stack events.
 
    @param[in]     p_ble_evt   Pointer to the BLE event received.
@@ -67,6 +67,7 @@ static void on_l2cap_ch_setup_complete(nrf_ble_ots_c_t * const p_ots_c,
     p_ots_c->ch_setup.tx_params.peer_mps = p_ble_evt->evt.l2cap_evt.params.ch_setup.tx_params.peer_mps;
     p_ots_c->ch_setup.tx_params.tx_mtu   = p_ble_evt->evt.l2cap_evt.params.ch_setup.tx_params.tx_mtu; 
     p_ots_c->ch_setup.tx_params.credits  = p_ble_evt->evt.l2cap_evt.params.ch_setup.tx_params.credits;
+    p_ots_c->rx_bufs_posted              = 0;
 }
 
 
@@ -99,31 +100,42 @@ static void send_resume(nrf_ble_ots_c_t * const p_ots_c)
 }
 
 
-/**@brief This function receives the next of the object.
+/**@brief This function keeps receive buffers posted for the rest of the object.
+ *
+ * @details Buffers are posted until @ref BLE_OTS_C_L2CAP_RX_QUEUE_SIZE of them are held by the
+ *          SoftDevice, or until the posted buffers can hold the remaining bytes of the object,
+ *          so that the peer never has to wait for a buffer between two SDUs.
  *
  * @param[in] p_ots_c  Object Transfer Service Instance.
+ *
+ * @return NRF_SUCCESS, or the error returned by sd_ble_l2cap_ch_rx.
  */
-static void receive_resume(nrf_ble_ots_c_t * const p_ots_c)
+static ret_code_t receive_resume(nrf_ble_ots_c_t * const p_ots_c)
 {
     ret_code_t err_code;
     ble_data_t sdu_buf;
 
-    sdu_buf.p_data = &p_ots_c->current_obj->p_data[p_ots_c->received_bytes];
-    sdu_buf.len    = p_ots_c->current_obj->len - p_ots_c->received_bytes;
-
-    err_code = sd_ble_l2cap_ch_rx(p_ots_c->conn_handle,
-                                  p_ots_c->local_cid,
-                                  &sdu_buf);
-
-    if (err_code == NRF_ERROR_RESOURCES)
+    while (   (p_ots_c->rx_bufs_posted < BLE_OTS_C_L2CAP_RX_QUEUE_SIZE)
+           && (p_ots_c->received_bytes + p_ots_c->rx_bufs_posted * BLE_OTS_C_L2CAP_SDU_SIZE
+               < p_ots_c->transfer_len))
     {
-        return; // Too many SDUs queued for transmission, the transmission will be tried again on the next BLE_L2CAP_EVT_CH_RX event.
+        sdu_buf.p_data = p_ots_c->rx_bufs[p_ots_c->rx_buf_next];
+        sdu_buf.len    = BLE_OTS_C_L2CAP_SDU_SIZE;
+
+        err_code = sd_ble_l2cap_ch_rx(p_ots_c->conn_handle,
+                                      p_ots_c->local_cid,
+                                      &sdu_buf);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            return NRF_SUCCESS; // The SoftDevice receive queue is full, the buffer will be posted again on the next BLE_L2CAP_EVT_CH_RX event.
+        }
+        VERIFY_SUCCESS(err_code);
+
+        p_ots_c->rx_bufs_posted++;
+        p_ots_c->rx_buf_next = (p_ots_c->rx_buf_next + 1) % BLE_OTS_C_L2CAP_RX_QUEUE_SIZE;
     }
 
-    if(err_code != NRF_SUCCESS && p_ots_c->err_handler != NULL)
-    {
-        p_ots_c->err_handler(err_code);
-    }
+    return NRF_SUCCESS;
 }
 
 
@@ -185,25 +197,46 @@ static void on_l2cap_ch_rx(nrf_ble_ots_c_t * const p_ots_c,
     NRF_LOG_HEXDUMP_DEBUG(p_ble_evt->evt.l2cap_evt.params.rx.sdu_buf.p_data,
                           p_ble_evt->evt.l2cap_evt.params.rx.sdu_len);
 
-    memcpy(&p_ots_c->current_obj->p_data[p_ots_c->received_bytes],  //Not needed`? buffer provied
+    if (p_ots_c->rx_bufs_posted > 0)
+    {
+        p_ots_c->rx_bufs_posted--;
+    }
+
+    if ((p_ots_c->current_obj == NULL) || (p_ots_c->received_bytes >= p_ots_c->transfer_len))
+    {
+        return; // A buffer left posted by a previous transfer.
+    }
+
+    // The SoftDevice fills the posted buffers in order, so the SDU continues the object.
+    uint32_t len = MIN(p_ble_evt->evt.l2cap_evt.params.rx.sdu_len,
+                       p_ots_c->transfer_len - p_ots_c->received_bytes);
+
+    memcpy(&p_ots_c->current_obj->p_data[p_ots_c->received_bytes],
            p_ble_evt->evt.l2cap_evt.params.rx.sdu_buf.p_data,
-           p_ble_evt->evt.l2cap_evt.params.rx.sdu_len);
+           len);
 
-    p_ots_c->received_bytes += p_ble_evt->evt.l2cap_evt.params.rx.sdu_len;
-    uint16_t remaining_bytes = (p_ots_c->current_obj->len - p_ots_c->received_bytes);
+    p_ots_c->received_bytes += len;
 
-    if(remaining_bytes == 0)
+    if (p_ots_c->received_bytes == p_ots_c->transfer_len)
     {
         nrf_ble_ots_c_evt_t evt;
 
+        // Done before raising the event, so that the next fetch can be started from the handler.
+        p_ots_c->fetch_state = NRF_BLE_OTS_C_FETCH_IDLE;
+
         evt.evt_type             = NRF_BLE_OTS_C_EVT_OBJ_READ;
-        evt.params.object.len    = p_ots_c->current_obj->len;
+        evt.conn_handle          = p_ots_c->conn_handle;
+        evt.params.object.len    = p_ots_c->transfer_len;
         evt.params.object.p_data = p_ots_c->current_obj->p_data;
         p_ots_c->evt_handler(&evt);
     }
     else
     {
-        receive_resume(p_ots_c);
+        ret_code_t err_code = receive_resume(p_ots_c);
+        if ((err_code != NRF_SUCCESS) && (p_ots_c->err_handler != NULL))
+        {
+            p_ots_c->err_handler(err_code);
+        }
     }
 }
 
@@ -216,9 +249,19 @@ static void on_l2cap_ch_rx(nrf_ble_ots_c_t * const p_ots_c,
 static void on_l2cap_ch_released(nrf_ble_ots_c_t * const p_ots_c,
                                  ble_evt_t const * const p_ble_evt)
 {
+    if(p_ots_c->local_cid != p_ble_evt->evt.l2cap_evt.local_cid)
+    {
+        return;
+    }
+
     nrf_ble_ots_c_evt_t evt;
 
-    evt.evt_type = NRF_BLE_OTS_C_EVT_CHANNEL_RELEASED;
+    // The SoftDevice gives back all the buffers posted on the channel.
+    p_ots_c->local_cid      = BLE_L2CAP_CID_INVALID;
+    p_ots_c->rx_bufs_posted = 0;
+
+    evt.evt_type    = NRF_BLE_OTS_C_EVT_CHANNEL_RELEASED;
+    evt.conn_handle = p_ble_evt->evt.l2cap_evt.conn_handle;
     p_ots_c->evt_handler(&evt);
 }
 
@@ -246,14 +289,35 @@ ret_code_t nrf_ble_ots_c_l2cap_obj_send(nrf_ble_ots_c_t * const p_ots_c, ble_dat
 
 ret_code_t nrf_ble_ots_c_l2cap_obj_receive(nrf_ble_ots_c_t * const p_ots_c, ble_data_t  * p_obj)
 {
-    uint32_t err_code;
-    p_ots_c->received_bytes = 0;
+    VERIFY_PARAM_NOT_NULL(p_obj);
+
+    return nrf_ble_ots_c_l2cap_obj_receive_at(p_ots_c, p_obj, 0, p_obj->len);
+}
+
+
+ret_code_t nrf_ble_ots_c_l2cap_obj_receive_at(nrf_ble_ots_c_t * const p_ots_c,
+                                              ble_data_t            * p_obj,
+                                              uint32_t                offset,
+                                              uint32_t                len)
+{
+    VERIFY_MODULE_INITIALIZED();
+    VERIFY_PARAM_NOT_NULL(p_ots_c);
+    VERIFY_PARAM_NOT_NULL(p_obj);
+
+    if ((offset > p_obj->len) || (len > p_obj->len - offset))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    if (p_ots_c->local_cid == BLE_L2CAP_CID_INVALID)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
     p_ots_c->current_obj    = p_obj;
+    p_ots_c->received_bytes = offset;
+    p_ots_c->transfer_len   = offset + len;
 
-    err_code = sd_ble_l2cap_ch_rx(p_ots_c->conn_handle,
-                                  p_ots_c->local_cid,
-                                  p_ots_c->current_obj);
-    return err_code;
+    return receive_resume(p_ots_c);
 }
 
 
@@ -264,16 +328,15 @@ void ots_c_l2cap_on_ble_evt(nrf_ble_ots_c_t * const p_ots_c,
     VERIFY_PARAM_NOT_NULL_VOID(p_ots_c);
     VERIFY_PARAM_NOT_NULL_VOID(p_ble_evt);
 
-    if (p_ble_evt->evt.l2cap_evt.local_cid != p_ots_c->local_cid)
-    {
-        return;
-    }
-
     switch (p_ble_evt->header.evt_id)
     {
         case BLE_L2CAP_EVT_CH_SETUP:
-            NRF_LOG_DEBUG("BLE_L2CAP_EVT_CH_SETUP");
-            on_l2cap_ch_setup_complete(p_ots_c, p_ble_evt);
+            // The channel does not have a known CID until it is set up.
+            if (p_ble_evt->evt.l2cap_evt.conn_handle == p_ots_c->conn_handle)
+            {
+                NRF_LOG_DEBUG("BLE_L2CAP_EVT_CH_SETUP");
+                on_l2cap_ch_setup_complete(p_ots_c, p_ble_evt);
+            }
             break;
 
         case BLE_L2CAP_EVT_CH_TX:
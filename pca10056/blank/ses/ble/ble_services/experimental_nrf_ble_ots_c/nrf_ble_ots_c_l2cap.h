@@ -95,10 +95,35 @@ ret_code_t nrf_ble_ots_c_l2cap_obj_send(nrf_ble_ots_c_t * const p_ots_c, ble_dat
 
    @param[in,out] p_ots_c Pointer to Object Transfer client structure.
    @param[in,out] p_obj   Pointer to buffer where the received data will be stored.
+
+   @retval NRF_SUCCESS If the receive buffers were posted.
+   @return             Otherwise, the error returned by @ref nrf_ble_ots_c_l2cap_obj_receive_at.
 */
 ret_code_t nrf_ble_ots_c_l2cap_obj_receive(nrf_ble_ots_c_t * const p_ots_c, ble_data_t  * p_obj);
 
 
+/**@brief Function for receiving a part of an object.
+
+   @details The received data is stored in @p p_obj from @p offset onwards. call
+            @ref nrf_ble_ots_c_oacp_read_object with the same offset and length before this function.
+
+   @param[in,out] p_ots_c Pointer to Object Transfer client structure.
+   @param[in,out] p_obj   Pointer to buffer holding the object.
+   @param[in]     offset  Offset in the object of the first byte to receive.
+   @param[in]     len     Number of bytes to receive.
+
+   @retval NRF_SUCCESS             If the receive buffers were posted.
+   @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+   @retval NRF_ERROR_INVALID_PARAM If @p offset and @p len do not fit in @p p_obj.
+   @retval NRF_ERROR_INVALID_STATE If the L2CAP channel is not set up.
+   @retval err_code                Otherwise, the error returned by sd_ble_l2cap_ch_rx.
+*/
+ret_code_t nrf_ble_ots_c_l2cap_obj_receive_at(nrf_ble_ots_c_t * const p_ots_c,
+                                              ble_data_t            * p_obj,
+                                              uint32_t                offset,
+                                              uint32_t                len);
+
+
 #endif // NRF_BLE_OTS_C_L2CAP_H__
 
 /** @} */
@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_OTS_C)
+#include <string.h>
+#include "nrf_ble_ots_c_olcp.h"
+#include "ble.h"
+
+#define NRF_LOG_MODULE_NAME ble_ots_c_olcp
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define BLE_OTS_OLCP_GOTO_OP_SIZE       7   /**< Op code and 48-bit object ID. */
+#define BLE_OTS_OLCP_RESP_LEN           3   /**< Length of an OLCP response without parameter. */
+#define BLE_OTS_LIST_FILTER_MAX_PARAM   (NRF_BLE_GQ_GATTC_WRITE_MAX_DATA_LEN - 1) /**< Longest filter parameter the BLE GATT Queue can write. */
+
+#define MODULE_INITIALIZED (p_ots_c->initialized)
+
+
+/**@brief Function for checking whether the OLCP of the peer is discovered and connected.
+
+   @param[in] p_ots_c Pointer to Object Transfer client structure.
+*/
+static ret_code_t olcp_check(nrf_ble_ots_c_t const * const p_ots_c)
+{
+    if (p_ots_c->conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (p_ots_c->service.object_list_cp_char.handle_value == BLE_GATT_HANDLE_INVALID)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for queuing a write to the peer.
+
+   @param[in] p_ots_c Pointer to Object Transfer client structure.
+   @param[in] handle  Handle of the characteristic value.
+   @param[in] p_val   Value to write. Copied by the BLE GATT Queue.
+   @param[in] len     Length of the value.
+*/
+static ret_code_t write_queue(nrf_ble_ots_c_t * const p_ots_c,
+                              uint16_t                handle,
+                              uint8_t const         * p_val,
+                              uint16_t                len)
+{
+    nrf_ble_gq_req_t write_req;
+
+    memset(&write_req, 0, sizeof(nrf_ble_gq_req_t));
+
+    write_req.type                        = NRF_BLE_GQ_REQ_GATTC_WRITE;
+    write_req.error_handler.cb            = p_ots_c->gatt_err_handler;
+    write_req.error_handler.p_ctx         = (nrf_ble_ots_c_t *)p_ots_c;
+    write_req.params.gattc_write.handle   = handle;
+    write_req.params.gattc_write.len      = len;
+    write_req.params.gattc_write.offset   = 0;
+    write_req.params.gattc_write.p_value  = p_val;
+    write_req.params.gattc_write.write_op = BLE_GATT_OP_WRITE_REQ;
+
+    return nrf_ble_gq_item_add(p_ots_c->p_gatt_queue, &write_req, p_ots_c->conn_handle);
+}
+
+
+/**@brief Function for handling the indications from the Object List Control Point.
+
+   @param[in] p_ots_c         Pointer to Object Transfer client structure.
+   @param[in] p_ble_gattc_evt Pointer to a GATTC event.
+*/
+static void on_hvx(nrf_ble_ots_c_t const * const p_ots_c,
+                   ble_gattc_evt_t const * const p_ble_gattc_evt)
+{
+    ble_gattc_evt_hvx_t const * p_hvx       = &p_ble_gattc_evt->params.hvx;
+    uint16_t                    olcp_handle = p_ots_c->service.object_list_cp_char.handle_value;
+
+    if (   (olcp_handle == BLE_GATT_HANDLE_INVALID)
+        || (p_hvx->handle != olcp_handle)
+        || (p_ble_gattc_evt->conn_handle != p_ots_c->conn_handle))
+    {
+        return;
+    }
+
+    ret_code_t err_code = sd_ble_gattc_hv_confirm(p_ble_gattc_evt->conn_handle, olcp_handle);
+    if ((err_code != NRF_SUCCESS) && (p_ots_c->err_handler != NULL))
+    {
+        p_ots_c->err_handler(err_code);
+    }
+
+    if ((p_hvx->len < BLE_OTS_OLCP_RESP_LEN) || (p_hvx->data[0] != NRF_BLE_OTS_C_OLCP_PROC_RESP))
+    {
+        return;
+    }
+
+    nrf_ble_ots_c_evt_t evt;
+
+    memset(&evt, 0, sizeof(evt));
+
+    evt.evt_type                              = NRF_BLE_OTS_C_EVT_OLCP_RESP;
+    evt.conn_handle                           = p_ble_gattc_evt->conn_handle;
+    evt.params.olcp_response.request_op_code  = (ble_ots_c_olcp_proc_type_t)p_hvx->data[1];
+    evt.params.olcp_response.result_code      = (ble_ots_c_olcp_res_code_t)p_hvx->data[2];
+    if (p_hvx->len >= BLE_OTS_OLCP_RESP_LEN + sizeof(uint32_t))
+    {
+        evt.params.olcp_response.num_objects = uint32_decode(&p_hvx->data[BLE_OTS_OLCP_RESP_LEN]);
+    }
+    p_ots_c->evt_handler(&evt);
+}
+
+
+ret_code_t nrf_ble_ots_c_olcp_indication_enable(nrf_ble_ots_c_t * const p_ots_c,
+                                                bool const             indication_enable)
+{
+    VERIFY_MODULE_INITIALIZED();
+    VERIFY_SUCCESS(olcp_check(p_ots_c));
+
+    uint8_t  cccd[BLE_CCCD_VALUE_LEN];
+    uint16_t cccd_val = (indication_enable) ? BLE_GATT_HVX_INDICATION : 0;
+
+    cccd[0] = LSB_16(cccd_val);
+    cccd[1] = MSB_16(cccd_val);
+
+    return write_queue(p_ots_c, p_ots_c->service.object_list_cp_cccd.handle, cccd, sizeof(cccd));
+}
+
+
+ret_code_t nrf_ble_ots_c_olcp_proc(nrf_ble_ots_c_t * const p_ots_c, ble_ots_c_olcp_proc_type_t proc)
+{
+    VERIFY_MODULE_INITIALIZED();
+
+    if ((proc == NRF_BLE_OTS_C_OLCP_PROC_GOTO) || (proc == NRF_BLE_OTS_C_OLCP_PROC_ORDER))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    VERIFY_SUCCESS(olcp_check(p_ots_c));
+
+    uint8_t op_code = (uint8_t)proc;
+
+    return write_queue(p_ots_c, p_ots_c->service.object_list_cp_char.handle_value, &op_code, sizeof(op_code));
+}
+
+
+ret_code_t nrf_ble_ots_c_olcp_goto(nrf_ble_ots_c_t * const p_ots_c, uint64_t obj_id)
+{
+    VERIFY_MODULE_INITIALIZED();
+    VERIFY_SUCCESS(olcp_check(p_ots_c));
+
+    uint8_t  val[BLE_OTS_OLCP_GOTO_OP_SIZE];
+    uint32_t i = 0;
+
+    val[i++] = NRF_BLE_OTS_C_OLCP_PROC_GOTO;
+    i += uint48_encode(obj_id, &val[i]);
+
+    return write_queue(p_ots_c, p_ots_c->service.object_list_cp_char.handle_value, val, i);
+}
+
+
+ret_code_t nrf_ble_ots_c_list_filter_write(nrf_ble_ots_c_t            * const p_ots_c,
+                                           ble_ots_c_list_filter_type_t         type,
+                                           uint8_t const                      * p_param,
+                                           uint8_t                              param_len)
+{
+    VERIFY_MODULE_INITIALIZED();
+
+    if ((param_len > BLE_OTS_LIST_FILTER_MAX_PARAM) || ((param_len > 0) && (p_param == NULL)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    if (p_ots_c->conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (p_ots_c->service.list_filter_char.handle_value == BLE_GATT_HANDLE_INVALID)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    uint8_t val[1 + BLE_OTS_LIST_FILTER_MAX_PARAM];
+
+    val[0] = (uint8_t)type;
+    if (param_len > 0)
+    {
+        memcpy(&val[1], p_param, param_len);
+    }
+
+    return write_queue(p_ots_c, p_ots_c->service.list_filter_char.handle_value, val, 1 + param_len);
+}
+
+
+void ots_c_olcp_on_ble_evt(nrf_ble_ots_c_t * const p_ots_c,
+                           ble_evt_t const * const p_ble_evt)
+{
+    VERIFY_MODULE_INITIALIZED_VOID();
+    VERIFY_PARAM_NOT_NULL_VOID(p_ots_c);
+    VERIFY_PARAM_NOT_NULL_VOID(p_ble_evt);
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GATTC_EVT_HVX:
+            on_hvx(p_ots_c, &(p_ble_evt->evt.gattc_evt));
+            break;
+
+        default:
+            break;
+    }
+}
+
+#endif // NRF_MODULE_ENABLED(BLE_OTS_C)
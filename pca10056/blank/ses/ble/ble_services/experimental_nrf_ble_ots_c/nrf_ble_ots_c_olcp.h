@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+ /**@file
+ *
+ * @defgroup nrf_ble_ots_c_olcp Object Transfer Service Client Object List Control Point
+ * @{
+ * @ingroup  nrf_ble_ots_c
+ * @brief    Object List Control Point module
+ *
+ * @details  This is the Object List Control Point module of the Object Transfer Service (OTS) Client.
+ *           It selects the current object of a server that has more than one object.
+ */
+
+#ifndef NRF_BLE_OTS_C_OLCP_H__
+#define NRF_BLE_OTS_C_OLCP_H__
+
+#include <stdint.h>
+#include "ble_gattc.h"
+#include "ble.h"
+#include "nrf_error.h"
+#include "ble_srv_common.h"
+#include "sdk_errors.h"
+#include "nrf_ble_ots_c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Function for enabling remote indication on the Object List Control Point.
+
+   @param[in,out] p_ots_c Pointer to Object Transfer Client structure.
+   @param[in]     enable  True to enable Object List Control Point (OLCP) indication; false to disable.
+
+   @retval NRF_SUCCESS             Operation success.
+   @retval NRF_ERROR_NOT_SUPPORTED If the Object List Control Point of the peer was not discovered.
+   @retval err_code                If functions from other modules return errors to this function,
+                                   the @ref nrf_error are propagated.
+*/
+ret_code_t nrf_ble_ots_c_olcp_indication_enable(nrf_ble_ots_c_t * const p_ots_c,
+                                                bool                const enable);
+
+
+/**@brief Function for requesting an Object List Control Point procedure without parameters.
+
+   @details The peer indicates a response on the Object List Control Point, which is provided
+            with @ref NRF_BLE_OTS_C_EVT_OLCP_RESP.
+
+   @param[in,out] p_ots_c Pointer to Object Transfer Client structure.
+   @param[in]     proc    The procedure. Must not be @ref NRF_BLE_OTS_C_OLCP_PROC_GOTO.
+
+   @retval NRF_SUCCESS             Operation success.
+   @retval NRF_ERROR_INVALID_PARAM If @p proc needs parameters.
+   @retval NRF_ERROR_NOT_SUPPORTED If the Object List Control Point of the peer was not discovered.
+   @retval NRF_ERROR_INVALID_STATE Module is not initialized, or there is no connection.
+   @retval err_code                Otherwise, this API propagates the error code returned by function @ref nrf_ble_gq_item_add.
+*/
+ret_code_t nrf_ble_ots_c_olcp_proc(nrf_ble_ots_c_t * const p_ots_c, ble_ots_c_olcp_proc_type_t proc);
+
+
+/**@brief Function for selecting an object by its ID.
+
+   @param[in,out] p_ots_c Pointer to Object Transfer Client structure.
+   @param[in]     obj_id  ID of the object. Only the lower 48 bits are used.
+
+   @retval NRF_SUCCESS             Operation success.
+   @retval NRF_ERROR_NOT_SUPPORTED If the Object List Control Point of the peer was not discovered.
+   @retval NRF_ERROR_INVALID_STATE Module is not initialized, or there is no connection.
+   @retval err_code                Otherwise, this API propagates the error code returned by function @ref nrf_ble_gq_item_add.
+*/
+ret_code_t nrf_ble_ots_c_olcp_goto(nrf_ble_ots_c_t * const p_ots_c, uint64_t obj_id);
+
+
+/**@brief Function for writing the Object List Filter on the server.
+
+   @param[in,out] p_ots_c     Pointer to Object Transfer Client structure.
+   @param[in]     type        Type of the filter.
+   @param[in]     p_param     Parameter of the filter, encoded as by the Object Transfer Service.
+                              Can be NULL if @p param_len is 0.
+   @param[in]     param_len   Length of the parameter.
+
+   @retval NRF_SUCCESS             Operation success.
+   @retval NRF_ERROR_INVALID_PARAM If the filter does not fit in NRF_BLE_GQ_GATTC_WRITE_MAX_DATA_LEN.
+   @retval NRF_ERROR_NOT_SUPPORTED If the Object List Filter of the peer was not discovered.
+   @retval NRF_ERROR_INVALID_STATE Module is not initialized, or there is no connection.
+   @retval err_code                Otherwise, this API propagates the error code returned by function @ref nrf_ble_gq_item_add.
+*/
+ret_code_t nrf_ble_ots_c_list_filter_write(nrf_ble_ots_c_t            * const p_ots_c,
+                                           ble_ots_c_list_filter_type_t         type,
+                                           uint8_t const                      * p_param,
+                                           uint8_t                              param_len);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+
+   @param[in,out] p_ots_c   Pointer to Object Transfer client structure.
+   @param[in]     p_ble_evt Pointer to the BLE event received.
+*/
+void ots_c_olcp_on_ble_evt(nrf_ble_ots_c_t * const p_ots_c,
+                           ble_evt_t const * const p_ble_evt);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BLE_OTS_C_OLCP_H__
+
+/** @} */
@@ -91,10 +91,16 @@ static ret_code_t ctrlpt_char_add(nrf_ble_bms_t * p_bms, nrf_ble_bms_init_t cons
 
 /**@brief Forward an authorization request to the application, if necessary.
  *
- * @param[in] p_bms    Bond Management Service structure.
- * @param[in] p_ctrlpt Pointer to the received Control Point value.
+ * @details The authorization code is copied straight from the received value into the event, and
+ *          only for op codes that require authorization.
+ *
+ * @param[in] p_bms      Bond Management Service structure.
+ * @param[in] p_ctrlpt   Pointer to the decoded Control Point value.
+ * @param[in] p_rcvd_val Received write value.
  */
-static void ctrlpt_auth(nrf_ble_bms_t * p_bms, nrf_ble_bms_ctrlpt_t * p_ctrlpt)
+static void ctrlpt_auth(nrf_ble_bms_t              * p_bms,
+                        nrf_ble_bms_ctrlpt_t const * p_ctrlpt,
+                        uint8_t const              * p_rcvd_val)
 {
     nrf_ble_bms_features_t * p_feature = &p_bms->feature;
 
@@ -122,7 +128,7 @@ static void ctrlpt_auth(nrf_ble_bms_t * p_bms, nrf_ble_bms_ctrlpt_t * p_ctrlpt)
             memset(&bms_evt, 0, sizeof(bms_evt));
             bms_evt.evt_type      = NRF_BLE_BMS_EVT_AUTH;
             bms_evt.auth_code.len = p_ctrlpt->auth_code.len;
-            memcpy(bms_evt.auth_code.code, p_ctrlpt->auth_code.code, p_ctrlpt->auth_code.len);
+            memcpy(bms_evt.auth_code.code, &p_rcvd_val[NRF_BLE_BMS_CTRLPT_MIN_LEN], p_ctrlpt->auth_code.len);
 
             p_bms->auth_status = NRF_BLE_BMS_AUTH_STATUS_PENDING;
 
@@ -137,6 +143,9 @@ static void ctrlpt_auth(nrf_ble_bms_t * p_bms, nrf_ble_bms_ctrlpt_t * p_ctrlpt)
 
 
 /**@brief Decode an incoming Control Point write.
+ *
+ * @note The authorization code is not copied into @p p_ctrlpt, only its length is decoded. It is
+ *       read from @p p_rcvd_val when authorization is requested.
  *
  * @param[in]    p_rcvd_val Received write value.
  * @param[in]    len        Value length.
@@ -157,7 +166,6 @@ static ret_code_t ctrlpt_decode(uint8_t const        * p_rcvd_val,
 
     p_ctrlpt->op_code       = (nrf_ble_bms_op_t) p_rcvd_val[pos++];
     p_ctrlpt->auth_code.len = (len - pos);
-    memcpy(p_ctrlpt->auth_code.code, &(p_rcvd_val[pos]), p_ctrlpt->auth_code.len);
 
     return NRF_SUCCESS;
 }
@@ -265,7 +273,7 @@ static uint16_t ctrlpt_process(nrf_ble_bms_t        * p_bms,
     }
 
     /* Request authorization */
-    ctrlpt_auth(p_bms, p_ctrlpt);
+    ctrlpt_auth(p_bms, p_ctrlpt, p_rcvd_val);
     if (p_bms->auth_status != NRF_BLE_BMS_AUTH_STATUS_ALLOWED)
     {
         NRF_LOG_ERROR("Control point long write: Invalid auth.");
@@ -476,12 +484,12 @@ uint16_t on_qwr_auth_req(nrf_ble_bms_t * p_bms, nrf_ble_qwr_t * p_qwr, nrf_ble_q
 uint16_t on_qwr_exec_write(nrf_ble_bms_t * p_bms, nrf_ble_qwr_t * p_qwr, nrf_ble_qwr_evt_t * p_evt)
 {
     ret_code_t           err_code;
-    uint16_t             len = NRF_BLE_BMS_CTRLPT_MAX_LEN;
-    uint8_t              mem_buffer[NRF_BLE_BMS_CTRLPT_MAX_LEN];
+    uint8_t              mem_buffer[NRF_BLE_BMS_CTRLPT_MIN_LEN];
     nrf_ble_bms_ctrlpt_t ctrlpt;
     ble_gatts_value_t    ctrlpt_value;
 
-    ctrlpt_value.len     = NRF_BLE_BMS_CTRLPT_MAX_LEN;
+    /* The value was authorized when the write was requested, so only the op code is read. */
+    ctrlpt_value.len     = NRF_BLE_BMS_CTRLPT_MIN_LEN;
     ctrlpt_value.offset  = 0;
     ctrlpt_value.p_value = mem_buffer;
 
@@ -494,7 +502,7 @@ uint16_t on_qwr_exec_write(nrf_ble_bms_t * p_bms, nrf_ble_qwr_t * p_qwr, nrf_ble
     }
 
     /* Decode operation */
-    err_code = ctrlpt_decode(ctrlpt_value.p_value, len, &ctrlpt);
+    err_code = ctrlpt_decode(ctrlpt_value.p_value, ctrlpt_value.len, &ctrlpt);
     if (err_code != NRF_SUCCESS)
     {
         NRF_LOG_ERROR("Control point write: Operation failed.");
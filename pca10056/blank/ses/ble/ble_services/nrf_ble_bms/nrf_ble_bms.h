@@ -202,7 +202,12 @@ typedef struct nrf_ble_bms_s nrf_ble_bms_t;
 /**@brief   BMS event handler type. */
 typedef void (* nrf_ble_bms_bond_handler_t) (nrf_ble_bms_t const * p_bms);
 
-/**@brief   BMS bond management callbacks. */
+/**@brief   BMS bond management callbacks.
+ *
+ * @details With the Peer Manager, @ref pm_peers_delete and @ref pm_peers_delete_except (with the
+ *          peer ID of the requesting device) delete many bonds as a single operation, when
+ *          PM_BULK_DELETE_ENABLED is set.
+ */
 typedef struct
 {
     nrf_ble_bms_bond_handler_t delete_requesting;            //!< Function to be called to delete the bonding information of the requesting device.
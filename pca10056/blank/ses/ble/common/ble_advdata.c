@@ -41,6 +41,12 @@
 #include "ble_gap.h"
 #include "ble_srv_common.h"
 #include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_UUID_CACHE)
+#include "ble_uuid_cache.h"
+#define UUID_ENCODE ble_uuid_cache_encode
+#else
+#define UUID_ENCODE sd_ble_uuid_encode
+#endif
 
 // NOTE: For now, Security Manager Out of Band Flags (OOB) are omitted from the advertising data.
 
@@ -266,7 +272,7 @@ static ret_code_t uuid_list_sized_encode(const ble_advdata_uuid_list_t * p_uuid_
         ble_uuid_t uuid = p_uuid_list->p_uuids[i];
 
         // Find encoded uuid size.
-        err_code = sd_ble_uuid_encode(&uuid, &encoded_size, NULL);
+        err_code = UUID_ENCODE(&uuid, &encoded_size, NULL);
         VERIFY_SUCCESS(err_code);
 
         // Check size.
@@ -290,7 +296,7 @@ static ret_code_t uuid_list_sized_encode(const ble_advdata_uuid_list_t * p_uuid_
             }
 
             // Write UUID.
-            err_code = sd_ble_uuid_encode(&uuid, &encoded_size, &p_encoded_data[*p_offset]);
+            err_code = UUID_ENCODE(&uuid, &encoded_size, &p_encoded_data[*p_offset]);
             VERIFY_SUCCESS(err_code);
             *p_offset += encoded_size;
         }
@@ -671,9 +677,103 @@ uint8_t * ble_advdata_parse(uint8_t  * p_encoded_data,
 }
 
 
-bool ble_advdata_name_find(uint8_t const * p_encoded_data,
-                           uint16_t        data_len,
-                           char    const * p_target_name)
+ret_code_t ble_advdata_index_build(ble_advdata_index_t       * p_index,
+                                   uint8_t             const * p_encoded_data,
+                                   uint16_t                    data_len)
+{
+    VERIFY_PARAM_NOT_NULL(p_index);
+    VERIFY_PARAM_NOT_NULL(p_encoded_data);
+
+    p_index->p_encoded_data = p_encoded_data;
+    p_index->data_len       = data_len;
+    p_index->entry_cnt      = 0;
+    p_index->truncated      = false;
+
+    // Walk the data as ble_advdata_search() does, so that the index gives the same results.
+    for (uint16_t i = 0; (i + 1) < data_len; i += (p_encoded_data[i] + 1))
+    {
+        ble_advdata_index_entry_t * p_entry;
+
+        if (p_index->entry_cnt == BLE_ADVDATA_INDEX_SIZE)
+        {
+            p_index->truncated = true;
+            break;
+        }
+
+        p_entry          = &p_index->entry[p_index->entry_cnt++];
+        p_entry->ad_type = p_encoded_data[i + 1];
+        p_entry->offset  = i + AD_DATA_OFFSET;
+        p_entry->len     = p_encoded_data[i] ? (p_encoded_data[i] - 1) : 0;
+
+        if ((p_entry->offset + p_entry->len) > data_len)
+        {
+            // Malformed. Extends beyond provided data, and no AD structure follows.
+            p_entry->len = 0;
+            break;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for finding the first AD structure of a type, in the index if there is one.
+ *
+ * @param[in]  p_encoded_data Data buffer containing the encoded Advertising data.
+ * @param[in]  data_len       Length of the data buffer \p p_encoded_data.
+ * @param[in]  p_index        Index of the data, or NULL.
+ * @param[in]  ad_type        Type of data to search for.
+ * @param[out] p_offset       Offset of the found data. Not changed if the function returns 0.
+ *
+ * @return The length of the found data, or 0 as for @ref ble_advdata_search.
+ */
+static uint16_t field_search(uint8_t             const * p_encoded_data,
+                             uint16_t                    data_len,
+                             ble_advdata_index_t const * p_index,
+                             uint8_t                     ad_type,
+                             uint16_t                  * p_offset)
+{
+    if ((p_index == NULL) || (p_encoded_data == NULL))
+    {
+        *p_offset = 0;
+        return ble_advdata_search(p_encoded_data, data_len, p_offset, ad_type);
+    }
+
+    for (uint8_t i = 0; i < p_index->entry_cnt; i++)
+    {
+        ble_advdata_index_entry_t const * p_entry = &p_index->entry[i];
+
+        if (p_entry->ad_type == ad_type)
+        {
+            if (p_entry->len != 0)
+            {
+                *p_offset = p_entry->offset;
+            }
+            return p_entry->len;
+        }
+    }
+
+    if (p_index->truncated)
+    {
+        // Continue the search after the start of the last recorded AD structure.
+        uint16_t offset = p_index->entry[BLE_ADVDATA_INDEX_SIZE - 1].offset - 1;
+        uint16_t len    = ble_advdata_search(p_encoded_data, data_len, &offset, ad_type);
+
+        if (len != 0)
+        {
+            *p_offset = offset;
+        }
+        return len;
+    }
+
+    return 0;
+}
+
+
+static bool name_find(uint8_t             const * p_encoded_data,
+                      uint16_t                    data_len,
+                      ble_advdata_index_t const * p_index,
+                      char                const * p_target_name)
 {
     uint16_t        parsed_name_len;
     uint8_t const * p_parsed_name;
@@ -685,10 +785,11 @@ bool ble_advdata_name_find(uint8_t const * p_encoded_data,
     }
 
 
-    parsed_name_len = ble_advdata_search(p_encoded_data,
-                                         data_len,
-                                         &data_offset,
-                                         BLE_GAP_AD_TYPE_COMPLETE_LOCAL_NAME);
+    parsed_name_len = field_search(p_encoded_data,
+                                   data_len,
+                                   p_index,
+                                   BLE_GAP_AD_TYPE_COMPLETE_LOCAL_NAME,
+                                   &data_offset);
 
     p_parsed_name = &p_encoded_data[data_offset];
 
@@ -704,10 +805,11 @@ bool ble_advdata_name_find(uint8_t const * p_encoded_data,
 }
 
 
-bool ble_advdata_short_name_find(uint8_t const * p_encoded_data,
-                                 uint16_t        data_len,
-                                 char    const * p_target_name,
-                                 uint8_t const   short_name_min_len)
+static bool short_name_find(uint8_t             const * p_encoded_data,
+                            uint16_t                    data_len,
+                            ble_advdata_index_t const * p_index,
+                            char                const * p_target_name,
+                            uint8_t             const   short_name_min_len)
 {
     uint16_t        parsed_name_len;
     uint8_t const * p_parsed_name;
@@ -718,10 +820,11 @@ bool ble_advdata_short_name_find(uint8_t const * p_encoded_data,
         return false;
     }
 
-    parsed_name_len = ble_advdata_search(p_encoded_data,
-                                         data_len,
-                                         &data_offset,
-                                         BLE_GAP_AD_TYPE_SHORT_LOCAL_NAME);
+    parsed_name_len = field_search(p_encoded_data,
+                                   data_len,
+                                   p_index,
+                                   BLE_GAP_AD_TYPE_SHORT_LOCAL_NAME,
+                                   &data_offset);
 
     p_parsed_name = &p_encoded_data[data_offset];
 
@@ -738,9 +841,10 @@ bool ble_advdata_short_name_find(uint8_t const * p_encoded_data,
 }
 
 
-bool ble_advdata_uuid_find(uint8_t    const * p_encoded_data,
-                           uint16_t           data_len,
-                           ble_uuid_t const * p_target_uuid)
+static bool uuid_find(uint8_t             const * p_encoded_data,
+                      uint16_t                    data_len,
+                      ble_advdata_index_t const * p_index,
+                      ble_uuid_t          const * p_target_uuid)
 {
 
     ret_code_t      err_code;
@@ -751,7 +855,7 @@ bool ble_advdata_uuid_find(uint8_t    const * p_encoded_data,
     uint8_t         raw_uuid[UUID128_SIZE];
     uint8_t         ad_types[N_AD_TYPES];
 
-    err_code = sd_ble_uuid_encode(p_target_uuid, &raw_uuid_len, raw_uuid);
+    err_code = UUID_ENCODE(p_target_uuid, &raw_uuid_len, raw_uuid);
 
     if ((p_encoded_data == NULL) || (err_code != NRF_SUCCESS))
     {
@@ -783,7 +887,7 @@ bool ble_advdata_uuid_find(uint8_t    const * p_encoded_data,
 
     for (uint8_t i = 0; (i < N_AD_TYPES) && (data_offset == 0); i++)
     {
-        parsed_uuid_len = ble_advdata_search(p_encoded_data, data_len, &data_offset, ad_types[i]);
+        parsed_uuid_len = field_search(p_encoded_data, data_len, p_index, ad_types[i], &data_offset);
     }
 
     if (data_offset == 0)
@@ -808,15 +912,20 @@ bool ble_advdata_uuid_find(uint8_t    const * p_encoded_data,
 }
 
 
-bool ble_advdata_appearance_find(uint8_t  const * p_encoded_data,
-                                 uint16_t         data_len,
-                                 uint16_t const * p_target_appearance)
+static bool appearance_find(uint8_t             const * p_encoded_data,
+                            uint16_t                    data_len,
+                            ble_advdata_index_t const * p_index,
+                            uint16_t            const * p_target_appearance)
 {
     uint16_t        data_offset = 0;
     uint8_t         appearance_len;
     uint16_t        decoded_appearance;
 
-    appearance_len = ble_advdata_search(p_encoded_data, data_len, &data_offset, BLE_GAP_AD_TYPE_APPEARANCE);
+    appearance_len = field_search(p_encoded_data,
+                                  data_len,
+                                  p_index,
+                                  BLE_GAP_AD_TYPE_APPEARANCE,
+                                  &data_offset);
 
     if (   (data_offset == 0)
         || (p_target_appearance == NULL)
@@ -836,3 +945,209 @@ bool ble_advdata_appearance_find(uint8_t  const * p_encoded_data,
     // Could not find the appearance among the encoded data.
     return false;
 }
+
+
+bool ble_advdata_name_find(uint8_t const * p_encoded_data,
+                           uint16_t        data_len,
+                           char    const * p_target_name)
+{
+    return name_find(p_encoded_data, data_len, NULL, p_target_name);
+}
+
+
+bool ble_advdata_short_name_find(uint8_t const * p_encoded_data,
+                                 uint16_t        data_len,
+                                 char    const * p_target_name,
+                                 uint8_t const   short_name_min_len)
+{
+    return short_name_find(p_encoded_data, data_len, NULL, p_target_name, short_name_min_len);
+}
+
+
+bool ble_advdata_uuid_find(uint8_t    const * p_encoded_data,
+                           uint16_t           data_len,
+                           ble_uuid_t const * p_target_uuid)
+{
+    return uuid_find(p_encoded_data, data_len, NULL, p_target_uuid);
+}
+
+
+bool ble_advdata_appearance_find(uint8_t  const * p_encoded_data,
+                                 uint16_t         data_len,
+                                 uint16_t const * p_target_appearance)
+{
+    return appearance_find(p_encoded_data, data_len, NULL, p_target_appearance);
+}
+
+
+uint8_t const * ble_advdata_index_parse(ble_advdata_index_t const * p_index,
+                                        uint8_t                     ad_type,
+                                        uint16_t                  * p_len)
+{
+    uint16_t offset = 0;
+    uint16_t len    = field_search(p_index->p_encoded_data,
+                                   p_index->data_len,
+                                   p_index,
+                                   ad_type,
+                                   &offset);
+
+    if (p_len != NULL)
+    {
+        *p_len = len;
+    }
+
+    return (len == 0) ? NULL : &p_index->p_encoded_data[offset];
+}
+
+
+bool ble_advdata_index_name_find(ble_advdata_index_t const * p_index,
+                                 char                const * p_target_name)
+{
+    return name_find(p_index->p_encoded_data, p_index->data_len, p_index, p_target_name);
+}
+
+
+bool ble_advdata_index_short_name_find(ble_advdata_index_t const * p_index,
+                                       char                const * p_target_name,
+                                       uint8_t             const   short_name_min_len)
+{
+    return short_name_find(p_index->p_encoded_data,
+                           p_index->data_len,
+                           p_index,
+                           p_target_name,
+                           short_name_min_len);
+}
+
+
+bool ble_advdata_index_uuid_find(ble_advdata_index_t const * p_index,
+                                 ble_uuid_t          const * p_target_uuid)
+{
+    return uuid_find(p_index->p_encoded_data, p_index->data_len, p_index, p_target_uuid);
+}
+
+
+bool ble_advdata_index_appearance_find(ble_advdata_index_t const * p_index,
+                                       uint16_t            const * p_target_appearance)
+{
+    return appearance_find(p_index->p_encoded_data,
+                           p_index->data_len,
+                           p_index,
+                           p_target_appearance);
+}
+
+
+ret_code_t ble_advdata_template_init(ble_advdata_template_t       * p_template,
+                                     ble_advdata_t          const * p_advdata,
+                                     uint8_t                      * p_buf0,
+                                     uint8_t                      * p_buf1,
+                                     uint16_t                       buf_size)
+{
+    ret_code_t err_code;
+
+    VERIFY_PARAM_NOT_NULL(p_template);
+    VERIFY_PARAM_NOT_NULL(p_advdata);
+    VERIFY_PARAM_NOT_NULL(p_buf0);
+    VERIFY_PARAM_NOT_NULL(p_buf1);
+
+    p_template->len = buf_size;
+    err_code = ble_advdata_encode(p_advdata, p_buf0, &p_template->len);
+    VERIFY_SUCCESS(err_code);
+
+    memcpy(p_buf1, p_buf0, p_template->len);
+
+    p_template->p_buf[0]    = p_buf0;
+    p_template->p_buf[1]    = p_buf1;
+    p_template->active      = 0;
+    p_template->sync_needed = false;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t ble_advdata_template_field_find(ble_advdata_template_t const * p_template,
+                                           uint8_t                        ad_type,
+                                           ble_advdata_template_field_t * p_field)
+{
+    uint16_t offset = 0;
+    uint16_t len    = ble_advdata_search(p_template->p_buf[p_template->active],
+                                         p_template->len,
+                                         &offset,
+                                         ad_type);
+
+    if (len == 0)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    p_field->offset = offset;
+    p_field->len    = len;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t ble_advdata_template_service_data_find(ble_advdata_template_t const * p_template,
+                                                  uint16_t                       service_uuid,
+                                                  ble_advdata_template_field_t * p_field)
+{
+    uint8_t const * p_data = p_template->p_buf[p_template->active];
+    uint16_t        offset = 0;
+    uint16_t        len;
+
+    while ((len = ble_advdata_search(p_data,
+                                     p_template->len,
+                                     &offset,
+                                     BLE_GAP_AD_TYPE_SERVICE_DATA)) != 0)
+    {
+        if ((len > AD_TYPE_SERV_DATA_16BIT_UUID_SIZE) &&
+            (uint16_decode(&p_data[offset]) == service_uuid))
+        {
+            p_field->offset = offset + AD_TYPE_SERV_DATA_16BIT_UUID_SIZE;
+            p_field->len    = len - AD_TYPE_SERV_DATA_16BIT_UUID_SIZE;
+            return NRF_SUCCESS;
+        }
+    }
+
+    return NRF_ERROR_NOT_FOUND;
+}
+
+
+ret_code_t ble_advdata_template_write(ble_advdata_template_t             * p_template,
+                                      ble_advdata_template_field_t const * p_field,
+                                      uint16_t                             offset,
+                                      uint8_t                      const * p_data,
+                                      uint16_t                             len)
+{
+    uint8_t * p_spare = p_template->p_buf[p_template->active ^ 1];
+
+    if (((uint32_t)offset + len) > p_field->len)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    // The spare buffer still holds the data handed over before the last swap.
+    if (p_template->sync_needed)
+    {
+        memcpy(p_spare, p_template->p_buf[p_template->active], p_template->len);
+        p_template->sync_needed = false;
+    }
+
+    memcpy(&p_spare[p_field->offset + offset], p_data, len);
+
+    return NRF_SUCCESS;
+}
+
+
+void ble_advdata_template_swap(ble_advdata_template_t * p_template,
+                               ble_data_t             * p_data)
+{
+    // Without a write since the last swap, the spare buffer is older than the active one.
+    if (!p_template->sync_needed)
+    {
+        p_template->active      ^= 1;
+        p_template->sync_needed  = true;
+    }
+
+    p_data->p_data = p_template->p_buf[p_template->active];
+    p_data->len    = p_template->len;
+}
@@ -86,6 +86,10 @@ extern "C" {
 
 #define BLE_ADV_DATA_MATCH_FULL_NAME       0xff
 
+#ifndef BLE_ADVDATA_INDEX_SIZE
+#define BLE_ADVDATA_INDEX_SIZE             8                                   /**< Number of AD structures an index holds. AD structures beyond this number are searched in the data. */
+#endif
+
 
 /**@brief Security Manager TK value. */
 typedef struct
@@ -317,6 +321,204 @@ bool ble_advdata_appearance_find(uint8_t   const * p_encoded_data,
                                  uint16_t  const * p_target_appearance);
 
 
+/**@brief AD structure recorded in an advertising data index. */
+typedef struct
+{
+    uint16_t offset;  /**< Offset of the AD data in the encoded data. */
+    uint8_t  len;     /**< Length of the AD data, 0 if the AD structure is empty or malformed. */
+    uint8_t  ad_type; /**< AD type. */
+} ble_advdata_index_entry_t;
+
+/**@brief Index of the AD structures in encoded Advertising or Scan Response data. */
+typedef struct
+{
+    uint8_t           const * p_encoded_data;                 /**< Indexed data. */
+    uint16_t                  data_len;                       /**< Length of the indexed data. */
+    uint8_t                   entry_cnt;                      /**< Number of recorded AD structures. */
+    bool                      truncated;                      /**< True if AD structures follow the recorded ones. */
+    ble_advdata_index_entry_t entry[BLE_ADVDATA_INDEX_SIZE];  /**< Recorded AD structures, in the order of the data. */
+} ble_advdata_index_t;
+
+
+/**@brief Function for indexing the AD structures of encoded Advertising or Scan Response data.
+ *
+ * @details The data is walked once, and the index functions below then look up AD types in the
+ *          index instead of searching the data from the start. They give the same results as the
+ *          functions without an index. The data must stay valid and unchanged while the index
+ *          is used.
+ *
+ * @param[out] p_index        Index to build.
+ * @param[in]  p_encoded_data Data buffer containing the encoded Advertising data.
+ * @param[in]  data_len       Length of the data buffer \p p_encoded_data.
+ *
+ * @retval NRF_SUCCESS    If the index was built.
+ * @retval NRF_ERROR_NULL If a NULL pointer was provided.
+ */
+ret_code_t ble_advdata_index_build(ble_advdata_index_t       * p_index,
+                                   uint8_t             const * p_encoded_data,
+                                   uint16_t                    data_len);
+
+
+/**@brief Function for getting specific data from indexed Advertising or Scan Response data.
+ *
+ * @param[in]  p_index Index of the data.
+ * @param[in]  ad_type Type of data to search for.
+ * @param[out] p_len   Length of the found data. Can be NULL.
+ *
+ * @return Pointer to the found data, or NULL if no data was found with the type \p ad_type.
+ */
+uint8_t const * ble_advdata_index_parse(ble_advdata_index_t const * p_index,
+                                        uint8_t                     ad_type,
+                                        uint16_t                  * p_len);
+
+
+/**@brief Function for searching indexed Advertising data for a complete local name.
+ *
+ * @details See @ref ble_advdata_name_find.
+ */
+bool ble_advdata_index_name_find(ble_advdata_index_t const * p_index,
+                                 char                const * p_target_name);
+
+
+/**@brief Function for searching indexed Advertising data for a device shortened name.
+ *
+ * @details See @ref ble_advdata_short_name_find.
+ */
+bool ble_advdata_index_short_name_find(ble_advdata_index_t const * p_index,
+                                       char                const * p_target_name,
+                                       uint8_t             const   short_name_min_len);
+
+
+/**@brief Function for searching indexed Advertising data for a UUID (16-bit or 128-bit).
+ *
+ * @details See @ref ble_advdata_uuid_find.
+ */
+bool ble_advdata_index_uuid_find(ble_advdata_index_t const * p_index,
+                                 ble_uuid_t          const * p_target_uuid);
+
+
+/**@brief Function for searching indexed Advertising data for an appearance.
+ *
+ * @details See @ref ble_advdata_appearance_find.
+ */
+bool ble_advdata_index_appearance_find(ble_advdata_index_t const * p_index,
+                                       uint16_t            const * p_target_appearance);
+
+
+/**@brief Advertising data template.
+ *
+ * @details The data is encoded once into two buffers. Fields located with
+ *          @ref ble_advdata_template_field_find or @ref ble_advdata_template_service_data_find
+ *          are then updated in place with @ref ble_advdata_template_write, which changes
+ *          the buffer not in use by the SoftDevice, and @ref ble_advdata_template_swap hands
+ *          over that buffer. Neither step encodes the data again.
+ */
+typedef struct
+{
+    uint8_t  * p_buf[2];    /**< Buffers holding the encoded data. */
+    uint16_t   len;         /**< Length of the encoded data. */
+    uint8_t    active;      /**< Index of the buffer last returned by @ref ble_advdata_template_swap. */
+    bool       sync_needed; /**< True if the buffer not in use must be updated from the active one before writing. */
+} ble_advdata_template_t;
+
+/**@brief Location of a field in an advertising data template. */
+typedef struct
+{
+    uint16_t offset; /**< Offset of the field data in the encoded data. */
+    uint16_t len;    /**< Length of the field data. */
+} ble_advdata_template_field_t;
+
+
+/**@brief Function for encoding data into an advertising data template.
+ *
+ * @details Both buffers must stay valid while the template is used. The buffer to pass to
+ *          the SoftDevice first is obtained with @ref ble_advdata_template_swap.
+ *
+ * @param[out] p_template Template to initialize.
+ * @param[in]  p_advdata  Content of the encoded data, as for @ref ble_advdata_encode.
+ * @param[in]  p_buf0     First buffer for the encoded data.
+ * @param[in]  p_buf1     Second buffer for the encoded data.
+ * @param[in]  buf_size   Size of each buffer.
+ *
+ * @retval NRF_SUCCESS             If the data was encoded.
+ * @retval NRF_ERROR_NULL          If a NULL pointer was provided.
+ * @retval NRF_ERROR_INVALID_PARAM If a wrong parameter was provided in \p p_advdata.
+ * @retval NRF_ERROR_DATA_SIZE     If the data does not fit into the buffers.
+ */
+ret_code_t ble_advdata_template_init(ble_advdata_template_t       * p_template,
+                                     ble_advdata_t          const * p_advdata,
+                                     uint8_t                      * p_buf0,
+                                     uint8_t                      * p_buf1,
+                                     uint16_t                       buf_size);
+
+
+/**@brief Function for locating the first field of a given type in an advertising data template.
+ *
+ * @details For example, the manufacturer specific data field starts with the two bytes of the
+ *          company identifier, followed by the additional data.
+ *
+ * @param[in]  p_template Template to search.
+ * @param[in]  ad_type    AD type of the field.
+ * @param[out] p_field    Location of the field data.
+ *
+ * @retval NRF_SUCCESS         If the field was found.
+ * @retval NRF_ERROR_NOT_FOUND If the template has no field of type \p ad_type.
+ */
+ret_code_t ble_advdata_template_field_find(ble_advdata_template_t const * p_template,
+                                           uint8_t                        ad_type,
+                                           ble_advdata_template_field_t * p_field);
+
+
+/**@brief Function for locating the additional data of a service in an advertising data template.
+ *
+ * @param[in]  p_template   Template to search.
+ * @param[in]  service_uuid 16-bit UUID of the service.
+ * @param[out] p_field      Location of the additional service data, following the UUID.
+ *
+ * @retval NRF_SUCCESS         If the service data was found.
+ * @retval NRF_ERROR_NOT_FOUND If the template has no additional data for \p service_uuid.
+ */
+ret_code_t ble_advdata_template_service_data_find(ble_advdata_template_t const * p_template,
+                                                  uint16_t                       service_uuid,
+                                                  ble_advdata_template_field_t * p_field);
+
+
+/**@brief Function for writing into a field of an advertising data template.
+ *
+ * @details The data is written to the buffer not in use by the SoftDevice. Several writes can be
+ *          made before the buffer is handed over with @ref ble_advdata_template_swap.
+ *
+ * @param[in,out] p_template Template to update.
+ * @param[in]     p_field    Field to write to.
+ * @param[in]     offset     Offset within the field data.
+ * @param[in]     p_data     Data to write.
+ * @param[in]     len        Length of \p p_data.
+ *
+ * @retval NRF_SUCCESS              If the data was written.
+ * @retval NRF_ERROR_INVALID_LENGTH If the data does not fit into the field.
+ */
+ret_code_t ble_advdata_template_write(ble_advdata_template_t             * p_template,
+                                      ble_advdata_template_field_t const * p_field,
+                                      uint16_t                             offset,
+                                      uint8_t                      const * p_data,
+                                      uint16_t                             len);
+
+
+/**@brief Function for handing over the updated buffer of an advertising data template.
+ *
+ * @details The returned buffer becomes the active one and must be passed to the SoftDevice,
+ *          for example with @ref sd_ble_gap_adv_set_configure. The previously active buffer is
+ *          not touched until the next call to @ref ble_advdata_template_write, which must come
+ *          after the SoftDevice has released it. Without writes since the last call, the active
+ *          buffer is returned again.
+ *
+ * @param[in,out] p_template Template to update.
+ * @param[out]    p_data     Buffer and length of the encoded data.
+ */
+void ble_advdata_template_swap(ble_advdata_template_t * p_template,
+                               ble_data_t             * p_data);
+
+
 #ifdef __cplusplus
 }
 #endif
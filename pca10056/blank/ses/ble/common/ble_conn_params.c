@@ -58,6 +58,36 @@
 #error Invalid NRF_SDH_BLE_PERIPHERAL_LINK_COUNT value. Set it in SDK config (nrf_sdh_ble).
 #endif
 
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_THRESHOLD > NRF_BLE_CONN_PARAMS_ADAPTIVE_BUSY_THRESHOLD)
+#error NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_THRESHOLD must not be larger than NRF_BLE_CONN_PARAMS_ADAPTIVE_BUSY_THRESHOLD.
+#endif
+
+/** @brief Parameter sets of the adaptive mode.
+ */
+typedef enum
+{
+    ADAPTIVE_SET_INITIAL,                                   //!< The parameters given at initialization, requested on connection.
+    ADAPTIVE_SET_ACTIVE,                                    //!< @ref ble_conn_params_init_t::p_active_conn_params.
+    ADAPTIVE_SET_IDLE,                                      //!< @ref ble_conn_params_init_t::p_idle_conn_params.
+} adaptive_set_t;
+
+/** @brief State of the adaptive mode on a link.
+ */
+typedef struct
+{
+    app_timer_id_t timer_id;                                //!< The ID of the timer sampling the traffic of this link.
+    bool           sampling;                                //!< Whether the sampling timer is running.
+    bool           pending;                                 //!< Whether a switch has been requested and the peer has not answered yet.
+    uint8_t        set;                                     //!< The last parameter set requested, see @ref adaptive_set_t.
+    uint16_t       demand;                                  //!< The demand last reported with @ref ble_conn_params_adaptive_demand_set.
+    uint32_t       pkt_cnt;                                 //!< The number of packets sent and received in the current period.
+    uint32_t       idle_ms;                                 //!< For how long the link has been idle.
+    uint32_t       holdoff_ticks;                           //!< Time after the last switch during which no new switch is requested. 0 once it has passed.
+    uint32_t       switch_ticks;                            //!< Timer counter value at the last switch.
+} adaptive_link_t;
+#endif
+
 /** @brief Each peripheral link has such an instance associated with it.
  */
 typedef struct
@@ -67,6 +97,9 @@ typedef struct
     uint8_t               update_count;          //!< The number of times the connection parameters have been attempted negotiated on this link.
     uint8_t               params_ok;             //!< Whether the current connection parameters on this link are acceptable according to the @p preferred_conn_params, and configured maximum deviations.
     ble_gap_conn_params_t preferred_conn_params; //!< The desired connection parameters for this link.
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+    adaptive_link_t       adaptive;              //!< State of the adaptive mode on this link.
+#endif
 } ble_conn_params_instance_t;
 
 static app_timer_t                m_timer_data[NRF_BLE_CONN_PARAMS_INSTANCE_COUNT] = {{{0}}};          //!< Data needed for timers.
@@ -74,6 +107,11 @@ static ble_conn_params_instance_t m_conn_params_instances[NRF_BLE_CONN_PARAMS_IN
 static ble_conn_params_init_t     m_conn_params_config;                                                //!< Configuration as provided by the application during intialization.
 static ble_gap_conn_params_t      m_preferred_conn_params;                                             //!< The preferred connection parameters as specified during initialization.
 //lint -esym(551, m_preferred_conn_params) "Not accessed"
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+static app_timer_t                m_adaptive_timer_data[NRF_BLE_CONN_PARAMS_INSTANCE_COUNT] = {{{0}}}; //!< Data needed for the sampling timers.
+static ble_gap_conn_params_t      m_adaptive_conn_params[2];                                           //!< The active and idle parameter sets, indexed by @ref adaptive_set_t - 1.
+static bool                       m_adaptive_enabled;                                                  //!< Whether the adaptive mode was enabled at initialization.
+#endif
 
 
 /**@brief Function for retrieving the conn_params instance belonging to a conn_handle
@@ -250,6 +288,255 @@ static void update_timeout_handler(void * p_context)
 }
 
 
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+/**@brief Function for checking whether the hold-off time after the last switch of a link has passed.
+ *
+ * @details Once passed, the hold-off time is cleared, so that the wrapping of the timer counter
+ *          cannot make it appear again.
+ *
+ * @param[in]  p_link  Adaptive state of the link.
+ *
+ * @return  Whether a new switch may be requested.
+ */
+static bool adaptive_holdoff_passed(adaptive_link_t * p_link)
+{
+    if (p_link->holdoff_ticks != 0)
+    {
+        uint32_t elapsed = app_timer_cnt_diff_compute(app_timer_cnt_get(), p_link->switch_ticks);
+
+        if (elapsed < p_link->holdoff_ticks)
+        {
+            return false;
+        }
+        p_link->holdoff_ticks = 0;
+    }
+
+    return true;
+}
+
+
+/**@brief Function for requesting a parameter set of the adaptive mode on a link.
+ *
+ * @details Nothing is requested if the set was already requested, while the peer has not answered
+ *          a previous switch or a negotiation of the module is in progress, or during the hold-off
+ *          time after the last switch.
+ *
+ * @param[in]  conn_handle  Connection to switch.
+ * @param[in]  p_instance   Configuration for the connection.
+ * @param[in]  set          Set to request, @ref ADAPTIVE_SET_ACTIVE or @ref ADAPTIVE_SET_IDLE.
+ */
+static void adaptive_switch(uint16_t conn_handle, ble_conn_params_instance_t * p_instance, adaptive_set_t set)
+{
+    adaptive_link_t * p_link = &p_instance->adaptive;
+
+    if ((p_link->set == set) || p_link->pending)
+    {
+        return;
+    }
+
+    if (!p_instance->params_ok && (p_instance->update_count != 0))
+    {
+        // A negotiation is in progress, let it finish first.
+        return;
+    }
+
+    if (!adaptive_holdoff_passed(p_link))
+    {
+        return;
+    }
+
+    ble_gap_conn_params_t * p_conn_params = &m_adaptive_conn_params[set - 1];
+
+    if (send_update_request(conn_handle, p_conn_params))
+    {
+        // The set replaces the parameters of a negotiation that has not sent its first request yet.
+        ret_code_t err_code = app_timer_stop(p_instance->timer_id);
+        if (err_code != NRF_SUCCESS)
+        {
+            send_error_evt(err_code);
+        }
+
+        p_instance->preferred_conn_params = *p_conn_params;
+        p_instance->params_ok             = false;
+        p_link->set                       = set;
+        p_link->pending                   = true;
+        p_link->idle_ms                   = 0;
+        p_link->switch_ticks              = app_timer_cnt_get();
+        p_link->holdoff_ticks             = APP_TIMER_TICKS(NRF_BLE_CONN_PARAMS_ADAPTIVE_HOLDOFF_MS);
+    }
+}
+
+
+/**@brief Function for starting to sample the traffic of a link, if not already started.
+ *
+ * @param[in]  conn_handle  Connection to sample.
+ * @param[in]  p_link       Adaptive state of the link.
+ */
+static void adaptive_sampling_start(uint16_t conn_handle, adaptive_link_t * p_link)
+{
+    if (!p_link->sampling)
+    {
+        ret_code_t err_code = app_timer_start(p_link->timer_id,
+                                              APP_TIMER_TICKS(NRF_BLE_CONN_PARAMS_ADAPTIVE_SAMPLE_MS),
+                                              (void *)(uint32_t)conn_handle);
+        if (err_code != NRF_SUCCESS)
+        {
+            send_error_evt(err_code);
+            return;
+        }
+        p_link->sampling = true;
+    }
+}
+
+
+/**@brief Function for counting packets sent or received on a link.
+ *
+ * @param[in]  conn_handle  Connection the packets were sent or received on.
+ * @param[in]  count        Number of packets.
+ */
+static void adaptive_on_traffic(uint16_t conn_handle, uint32_t count)
+{
+    ble_conn_params_instance_t * p_instance = instance_get(conn_handle);
+
+    if (m_adaptive_enabled && (p_instance != NULL))
+    {
+        p_instance->adaptive.pkt_cnt += count;
+        adaptive_sampling_start(conn_handle, &p_instance->adaptive);
+    }
+}
+
+
+/**@brief Function called at the end of each sampling period of a link. This is triggered by app_timer.
+ *
+ * @details A period with enough traffic moves the link to the active set. Idle periods are added
+ *          up until the idle timeout, and periods in between reset this time. The timer is stopped
+ *          on a link that was moved to the idle set and stays idle, and started again by traffic.
+ *
+ * @param[in]  p_context  Context identifying which connection this is for.
+ */
+static void adaptive_timeout_handler(void * p_context)
+{
+    uint16_t                     conn_handle = (uint16_t)(uint32_t)p_context;
+    ble_conn_params_instance_t * p_instance  = instance_get(conn_handle);
+
+    if (p_instance == NULL)
+    {
+        return;
+    }
+
+    adaptive_link_t * p_link = &p_instance->adaptive;
+    uint32_t          load   = p_link->pkt_cnt + p_link->demand;
+
+    p_link->pkt_cnt = 0;
+
+    if (load >= NRF_BLE_CONN_PARAMS_ADAPTIVE_BUSY_THRESHOLD)
+    {
+        p_link->idle_ms = 0;
+        adaptive_switch(conn_handle, p_instance, ADAPTIVE_SET_ACTIVE);
+    }
+    else if (load < NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_THRESHOLD)
+    {
+        p_link->idle_ms = MIN(p_link->idle_ms + NRF_BLE_CONN_PARAMS_ADAPTIVE_SAMPLE_MS,
+                              NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_TIMEOUT_MS);
+        if (p_link->idle_ms >= NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_TIMEOUT_MS)
+        {
+            adaptive_switch(conn_handle, p_instance, ADAPTIVE_SET_IDLE);
+        }
+    }
+    else
+    {
+        p_link->idle_ms = 0;
+    }
+
+    if (   (p_link->set == ADAPTIVE_SET_IDLE)
+        && !p_link->pending
+        && (load == 0)
+        && adaptive_holdoff_passed(p_link))
+    {
+        ret_code_t err_code = app_timer_stop(p_link->timer_id);
+        if (err_code != NRF_SUCCESS)
+        {
+            send_error_evt(err_code);
+        }
+        p_link->sampling = false;
+    }
+}
+
+
+/**@brief Function for starting the adaptive mode on a new link.
+ *
+ * @param[in]  conn_handle  Connection to start on.
+ * @param[in]  p_instance   Configuration for the connection.
+ */
+static void adaptive_on_connect(uint16_t conn_handle, ble_conn_params_instance_t * p_instance)
+{
+    adaptive_link_t * p_link = &p_instance->adaptive;
+
+    p_link->sampling      = false;
+    p_link->pending       = false;
+    p_link->set           = ADAPTIVE_SET_INITIAL;
+    p_link->demand        = 0;
+    p_link->pkt_cnt       = 0;
+    p_link->idle_ms       = 0;
+    p_link->holdoff_ticks = 0;
+
+    if (m_adaptive_enabled)
+    {
+        adaptive_sampling_start(conn_handle, p_link);
+    }
+}
+
+
+/**@brief Function for stopping the adaptive mode on a link.
+ *
+ * @param[in]  p_instance  Configuration for the connection.
+ */
+static void adaptive_on_disconnect(ble_conn_params_instance_t * p_instance)
+{
+    adaptive_link_t * p_link = &p_instance->adaptive;
+
+    if (p_link->sampling)
+    {
+        ret_code_t err_code = app_timer_stop(p_link->timer_id);
+        if (err_code != NRF_SUCCESS)
+        {
+            send_error_evt(err_code);
+        }
+        p_link->sampling = false;
+    }
+}
+
+
+/**@brief Function for handling the answer of the peer to a switch.
+ *
+ * @details The parameters chosen by the peer are kept even if they do not match the requested set,
+ *          and the next switch then waits for at least next_conn_params_update_delay.
+ *
+ * @param[in]  p_instance     Configuration for the connection.
+ * @param[in]  p_conn_params  The new connection parameters.
+ */
+static void adaptive_on_conn_params_update(ble_conn_params_instance_t   * p_instance,
+                                           ble_gap_conn_params_t const * p_conn_params)
+{
+    adaptive_link_t * p_link = &p_instance->adaptive;
+
+    p_link->pending          = false;
+    p_instance->update_count = 0;
+    p_instance->params_ok    = is_conn_params_ok(&p_instance->preferred_conn_params,
+                                                 p_conn_params,
+                                                 NRF_BLE_CONN_PARAMS_MAX_SLAVE_LATENCY_DEVIATION,
+                                                 NRF_BLE_CONN_PARAMS_MAX_SUPERVISION_TIMEOUT_DEVIATION);
+    if (!p_instance->params_ok)
+    {
+        // Declined by the peer.
+        p_link->switch_ticks  = app_timer_cnt_get();
+        p_link->holdoff_ticks = MAX(APP_TIMER_TICKS(NRF_BLE_CONN_PARAMS_ADAPTIVE_HOLDOFF_MS),
+                                    m_conn_params_config.next_conn_params_update_delay);
+    }
+}
+#endif // (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+
+
 ret_code_t ble_conn_params_init(const ble_conn_params_init_t * p_init)
 {
     ret_code_t err_code;
@@ -279,6 +566,15 @@ ret_code_t ble_conn_params_init(const ble_conn_params_init_t * p_init)
         }
     }
 
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+    m_adaptive_enabled = (p_init->p_active_conn_params != NULL) && (p_init->p_idle_conn_params != NULL);
+    if (m_adaptive_enabled)
+    {
+        m_adaptive_conn_params[ADAPTIVE_SET_ACTIVE - 1] = *p_init->p_active_conn_params;
+        m_adaptive_conn_params[ADAPTIVE_SET_IDLE - 1]   = *p_init->p_idle_conn_params;
+    }
+#endif
+
     //lint -save -e681 "Loop not entered" when NRF_BLE_CONN_PARAMS_INSTANCE_COUNT is 0
     for (uint32_t i = 0; i < NRF_BLE_CONN_PARAMS_INSTANCE_COUNT; i++)
     {
@@ -294,6 +590,19 @@ ret_code_t ble_conn_params_init(const ble_conn_params_init_t * p_init)
         {
             return NRF_ERROR_INTERNAL;
         }
+
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+        p_instance->adaptive.timer_id = &m_adaptive_timer_data[i];
+        p_instance->adaptive.sampling = false;
+
+        err_code = app_timer_create(&p_instance->adaptive.timer_id,
+                                    APP_TIMER_MODE_REPEATED,
+                                    adaptive_timeout_handler);
+        if (err_code != NRF_SUCCESS)
+        {
+            return NRF_ERROR_INTERNAL;
+        }
+#endif
     }
     //lint -restore
 
@@ -329,6 +638,28 @@ ret_code_t ble_conn_params_stop(void)
             }
         }
     //lint -restore
+
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+    for (uint32_t i = 0; i < NRF_BLE_CONN_PARAMS_INSTANCE_COUNT; i++)
+    {
+        adaptive_link_t * p_link = &m_conn_params_instances[i].adaptive;
+
+        if (p_link->sampling)
+        {
+            err_code = app_timer_stop(p_link->timer_id);
+            if (err_code == NRF_ERROR_NO_MEM)
+            {
+                return NRF_ERROR_BUSY;
+            }
+            if (err_code != NRF_SUCCESS)
+            {
+                return NRF_ERROR_INTERNAL;
+            }
+            p_link->sampling = false;
+        }
+    }
+#endif
+
     return NRF_SUCCESS;
 }
 
@@ -407,6 +738,10 @@ static void on_connect(ble_evt_t const * p_ble_evt)
                                               NRF_BLE_CONN_PARAMS_MAX_SLAVE_LATENCY_DEVIATION,
                                               NRF_BLE_CONN_PARAMS_MAX_SUPERVISION_TIMEOUT_DEVIATION);
 
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+    adaptive_on_connect(conn_handle, p_instance);
+#endif
+
     // Check if we shall handle negotiation on connect
     if (m_conn_params_config.start_on_notify_cccd_handle == BLE_GATT_HANDLE_INVALID)
     {
@@ -434,6 +769,10 @@ static void on_disconnect(ble_evt_t const * p_ble_evt)
             send_error_evt(err_code);
         }
 
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+        adaptive_on_disconnect(p_instance);
+#endif
+
         instance_free(p_instance);
     }
 }
@@ -497,6 +836,15 @@ static void on_conn_params_update(ble_evt_t const * p_ble_evt)
 
     if (p_instance != NULL)
     {
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+        if (p_instance->adaptive.pending)
+        {
+            adaptive_on_conn_params_update(p_instance,
+                                           &p_ble_evt->evt.gap_evt.params.conn_param_update.conn_params);
+            return;
+        }
+#endif
+
         p_instance->params_ok = is_conn_params_ok(
                                      &p_instance->preferred_conn_params,
                                      &p_ble_evt->evt.gap_evt.params.conn_param_update.conn_params,
@@ -528,12 +876,31 @@ static void ble_evt_handler(ble_evt_t const * p_ble_evt, void * p_context)
 
         case BLE_GATTS_EVT_WRITE:
             on_write(p_ble_evt);
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+            adaptive_on_traffic(p_ble_evt->evt.gatts_evt.conn_handle, 1);
+#endif
             break;
 
         case BLE_GAP_EVT_CONN_PARAM_UPDATE:
             on_conn_params_update(p_ble_evt);
             break;
 
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+            adaptive_on_traffic(p_ble_evt->evt.gatts_evt.conn_handle,
+                                p_ble_evt->evt.gatts_evt.params.hvn_tx_complete.count);
+            break;
+
+        case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+            adaptive_on_traffic(p_ble_evt->evt.gattc_evt.conn_handle,
+                                p_ble_evt->evt.gattc_evt.params.write_cmd_tx_complete.count);
+            break;
+
+        case BLE_GATTC_EVT_HVX:
+            adaptive_on_traffic(p_ble_evt->evt.gattc_evt.conn_handle, 1);
+            break;
+#endif
+
         default:
             // No implementation needed.
             break;
@@ -567,6 +934,38 @@ ret_code_t ble_conn_params_change_conn_params(uint16_t                conn_handl
     return err_code;
 }
 
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+ret_code_t ble_conn_params_adaptive_demand_set(uint16_t conn_handle, uint16_t demand)
+{
+    ble_conn_params_instance_t * p_instance = instance_get(conn_handle);
+
+    if (!m_adaptive_enabled)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if ((conn_handle == BLE_CONN_HANDLE_INVALID) || (p_instance == NULL))
+    {
+        return BLE_ERROR_INVALID_CONN_HANDLE;
+    }
+
+    p_instance->adaptive.demand = demand;
+
+    if (demand != 0)
+    {
+        adaptive_sampling_start(conn_handle, &p_instance->adaptive);
+    }
+
+    if (demand >= NRF_BLE_CONN_PARAMS_ADAPTIVE_BUSY_THRESHOLD)
+    {
+        p_instance->adaptive.idle_ms = 0;
+        adaptive_switch(conn_handle, p_instance, ADAPTIVE_SET_ACTIVE);
+    }
+
+    return NRF_SUCCESS;
+}
+#endif // (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+
 NRF_SDH_BLE_OBSERVER(m_ble_observer, BLE_CONN_PARAMS_BLE_OBSERVER_PRIO, ble_evt_handler, NULL);
 
 #endif //ENABLED
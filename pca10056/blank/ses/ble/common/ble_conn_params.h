@@ -52,6 +52,7 @@
 #include "ble.h"
 #include "ble_srv_common.h"
 #include "sdk_errors.h"
+#include "sdk_config.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -86,6 +87,10 @@ typedef struct
     bool                          disconnect_on_fail;               //!< Set to TRUE if a failed connection parameters update shall cause an automatic disconnection, set to FALSE otherwise.
     ble_conn_params_evt_handler_t evt_handler;                      //!< Event handler to be called for handling events in the Connection Parameters.
     ble_srv_error_handler_t       error_handler;                    //!< Function to be called in case of an error.
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1) || defined(__SDK_DOXYGEN__)
+    ble_gap_conn_params_t const * p_active_conn_params;             //!< Connection parameters requested while a link is busy. Set this and @p p_idle_conn_params to NULL to disable the adaptive mode.
+    ble_gap_conn_params_t const * p_idle_conn_params;               //!< Connection parameters requested after a link has been idle for NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_TIMEOUT_MS.
+#endif
 } ble_conn_params_init_t;
 
 
@@ -147,6 +152,32 @@ ret_code_t ble_conn_params_stop(void);
 ret_code_t ble_conn_params_change_conn_params(uint16_t                conn_handle,
                                               ble_gap_conn_params_t * p_new_params);
 
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1) || defined(__SDK_DOXYGEN__)
+/**@brief Function for reporting the traffic demand of a link to the adaptive mode.
+ *
+ *  @details In the adaptive mode, the module counts the packets sent and received on each link
+ *       over periods of NRF_BLE_CONN_PARAMS_ADAPTIVE_SAMPLE_MS. A link with at least
+ *       NRF_BLE_CONN_PARAMS_ADAPTIVE_BUSY_THRESHOLD packets in a period is moved to the active
+ *       set. A link with fewer than NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_THRESHOLD packets per period
+ *       for NRF_BLE_CONN_PARAMS_ADAPTIVE_IDLE_TIMEOUT_MS is moved to the idle set. Two switches are
+ *       at least NRF_BLE_CONN_PARAMS_ADAPTIVE_HOLDOFF_MS apart. If the peer declines a set, the
+ *       parameters it chose are kept until the next switch.
+ *
+ *       Use this function to report data that is waiting to be sent, for example the depth of a
+ *       transmission queue. The demand is added to the packet count of every period until it is
+ *       reported again, and a demand reaching the busy threshold starts the switch to the active set
+ *       at once instead of at the end of the period.
+ *
+ * @param[in]  conn_handle  The connection to report the demand for.
+ * @param[in]  demand       Number of packets waiting to be sent. 0 when the queue is empty.
+ *
+ * @retval NRF_SUCCESS                    Demand recorded.
+ * @retval BLE_ERROR_INVALID_CONN_HANDLE  The provided connection handle is invalid.
+ * @retval NRF_ERROR_INVALID_STATE        The adaptive mode was not enabled at initialization.
+ */
+ret_code_t ble_conn_params_adaptive_demand_set(uint16_t conn_handle, uint16_t demand);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
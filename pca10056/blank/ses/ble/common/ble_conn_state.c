@@ -43,15 +43,26 @@
 #include <string.h>
 #include "ble.h"
 #include "nrf_atflags.h"
+#include "nrf_atomic_bitset.h"
 #include "app_error.h"
 #include "nrf_sdh_ble.h"
 #include "app_util_platform.h"
+#if (BLE_CONN_STATE_STATS_ENABLED == 1)
+#include "app_util.h"
+#include "ble_hci.h"
+#endif
 
 
 
 #define DEFAULT_FLAG_COLLECTION_COUNT 6                                /**< The number of flags kept for each connection, excluding user flags. */
 #define TOTAL_FLAG_COLLECTION_COUNT (DEFAULT_FLAG_COLLECTION_COUNT \
                                    + BLE_CONN_STATE_USER_FLAG_COUNT)   /**< The number of flags kept for each connection, including user flags. */
+#define CONN_HANDLE_MASK (UINT32_MAX >> (32 - BLE_CONN_STATE_MAX_CONNECTIONS)) /**< Flags of all valid connection handles. */
+
+#if (BLE_CONN_STATE_STATS_ENABLED == 1)
+#define STATS_READ_RETRIES 3                                           /**< Number of times a copy of the statistics interrupted by an update is retried. */
+#define RSSI_FRAC_BITS     4                                           /**< Number of fractional bits of the RSSI average. */
+#endif
 
 /**@brief Structure containing all the flag collections maintained by the Connection State module.
  */
@@ -87,11 +98,45 @@ ANON_UNIONS_DISABLE;
 static ble_conn_state_t m_bcs = {0}; /**< Instantiation of the internal state. */
 
 
+/**@brief Structure containing the connection handle lists, rebuilt only when a connection is
+ *        added, disconnected, or invalidated.
+ */
+typedef struct
+{
+    volatile uint32_t                 seq;     /**< Incremented before and after each rebuild, so it is odd while the lists are being rebuilt. */
+    volatile bool                     dirty;   /**< Set when the lists no longer match the flag collections. */
+    ble_conn_state_conn_handle_list_t valid;   /**< Handles of all valid connections. */
+    ble_conn_state_conn_handle_list_t central; /**< Handles of the connected links in which the local device is the central. */
+    ble_conn_state_conn_handle_list_t periph;  /**< Handles of the connected links in which the local device is the peripheral. */
+} conn_lists_t;
+
+static conn_lists_t m_lists = {.dirty = true}; /**< Cached connection handle lists. */
+
+
+#if (BLE_CONN_STATE_STATS_ENABLED == 1)
+/**@brief Structure containing the statistics of a connection and the state needed to update them.
+ */
+typedef struct
+{
+    volatile uint32_t      seq;      /**< Incremented before and after each update, so it is odd while the statistics are being updated. */
+    int16_t                rssi_acc; /**< RSSI average with @ref RSSI_FRAC_BITS fractional bits. */
+    ble_conn_state_stats_t stats;    /**< Statistics of the connection. */
+} conn_stats_t;
+
+static conn_stats_t m_stats[BLE_CONN_STATE_MAX_CONNECTIONS]; /**< Statistics of each connection, indexed by connection handle. */
+#endif
+
+
 /**@brief Function for resetting all internal memory to the values it had at initialization.
  */
 void bcs_internal_state_reset(void)
 {
     memset( &m_bcs, 0, sizeof(ble_conn_state_t) );
+    memset(&m_lists, 0, sizeof(conn_lists_t));
+    m_lists.dirty = true;
+#if (BLE_CONN_STATE_STATS_ENABLED == 1)
+    memset(m_stats, 0, sizeof(m_stats));
+#endif
 }
 
 
@@ -100,15 +145,11 @@ ble_conn_state_conn_handle_list_t conn_handle_list_get(nrf_atflags_t flags)
     ble_conn_state_conn_handle_list_t conn_handle_list;
     conn_handle_list.len = 0;
 
-    if (flags != 0)
+    flags &= CONN_HANDLE_MASK;
+    while (flags != 0)
     {
-        for (uint32_t i = 0; i < BLE_CONN_STATE_MAX_CONNECTIONS; i++)
-        {
-            if (nrf_atflags_get(&flags, i))
-            {
-                conn_handle_list.conn_handles[conn_handle_list.len++] = i;
-            }
-        }
+        conn_handle_list.conn_handles[conn_handle_list.len++] = nrf_atomic_bits_find_first(flags);
+        flags &= flags - 1;
     }
 
     return conn_handle_list;
@@ -117,16 +158,88 @@ ble_conn_state_conn_handle_list_t conn_handle_list_get(nrf_atflags_t flags)
 
 uint32_t active_flag_count(nrf_atflags_t flags)
 {
-    uint32_t set_flag_count = 0;
+    return nrf_atomic_bits_count(flags & CONN_HANDLE_MASK);
+}
+
 
-    for (uint32_t i = 0; i < BLE_CONN_STATE_MAX_CONNECTIONS; i++)
+/**@brief Function for rebuilding the cached connection handle lists if they are out of date.
+ *
+ * @details The lists are rebuilt with interrupts disabled, so a rebuild is never interrupted by
+ *          another one. The sequence number tells a reader that was interrupted by a rebuild to
+ *          copy again, see @ref lists_read.
+ */
+static void lists_rebuild(void)
+{
+    CRITICAL_REGION_ENTER();
+
+    if (m_lists.dirty)
     {
-        if (nrf_atflags_get(&flags, i))
+        nrf_atflags_t connected_flags = m_bcs.flags.connected_flags;
+        nrf_atflags_t central_flags   = m_bcs.flags.central_flags;
+
+        m_lists.seq++;
+        __DMB();
+
+        m_lists.valid   = conn_handle_list_get(m_bcs.flags.valid_flags);
+        m_lists.central = conn_handle_list_get(central_flags & connected_flags);
+        m_lists.periph  = conn_handle_list_get(~central_flags & connected_flags);
+        m_lists.dirty   = false;
+
+        __DMB();
+        m_lists.seq++;
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
+
+/**@brief Function for copying a field of the cached connection handle lists.
+ *
+ * @details The lists are rebuilt first if a connection changed since the last rebuild.
+ *
+ * @param[out] p_dst  Where to copy the field.
+ * @param[in]  p_src  Field of @ref m_lists.
+ * @param[in]  size   Size of the field.
+ */
+static void lists_read(void * p_dst, void const * p_src, size_t size)
+{
+    for (;;)
+    {
+        if (m_lists.dirty)
+        {
+            lists_rebuild();
+        }
+
+        uint32_t seq = m_lists.seq;
+        __DMB();
+
+        if ((seq & 1) == 0)
         {
-            set_flag_count += 1;
+            memcpy(p_dst, p_src, size);
+            __DMB();
+
+            if (m_lists.seq == seq)
+            {
+                return;
+            }
         }
     }
-    return set_flag_count;
+}
+
+
+/**@brief Function for getting the number of entries of a cached connection handle list.
+ *
+ * @param[in]  p_list  List in @ref m_lists.
+ *
+ * @return  Number of connection handles in the list.
+ */
+static uint32_t lists_len_get(ble_conn_state_conn_handle_list_t const * p_list)
+{
+    uint32_t len;
+
+    lists_read(&len, &p_list->len, sizeof(len));
+
+    return len;
 }
 
 
@@ -150,19 +263,6 @@ static bool record_activate(uint16_t conn_handle)
 }
 
 
-/**@brief Function for marking a connection record as invalid and resetting the values.
- *
- * @param p_record  The record to invalidate.
- */
-static void record_invalidate(uint16_t conn_handle)
-{
-    for (uint32_t i = 0; i < TOTAL_FLAG_COLLECTION_COUNT; i++)
-    {
-        nrf_atflags_clear(&m_bcs.flag_array[i], conn_handle);
-    }
-}
-
-
 /**@brief Function for marking a connection as disconnected. See @ref BLE_CONN_STATUS_DISCONNECTED.
  *
  * @param p_record   The record of the connection to set as disconnected.
@@ -178,15 +278,18 @@ static void record_set_disconnected(uint16_t conn_handle)
  */
 static void record_purge_disconnected()
 {
-    nrf_atflags_t                     disconnected_flags = ~m_bcs.flags.connected_flags;
-    ble_conn_state_conn_handle_list_t disconnected_list;
+    nrf_atflags_t disconnected_flags = ~m_bcs.flags.connected_flags;
 
     UNUSED_RETURN_VALUE(nrf_atomic_u32_and(&disconnected_flags, m_bcs.flags.valid_flags));
-    disconnected_list  =  conn_handle_list_get(disconnected_flags);
 
-    for (uint32_t i = 0; i < disconnected_list.len; i++)
+    // Invalidate all disconnected records at once, one operation per flag collection.
+    if (disconnected_flags != 0)
     {
-        record_invalidate(disconnected_list.conn_handles[i]);
+        for (uint32_t i = 0; i < TOTAL_FLAG_COLLECTION_COUNT; i++)
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_u32_and(&m_bcs.flag_array[i], ~disconnected_flags));
+        }
+        m_lists.dirty = true;
     }
 }
 
@@ -220,6 +323,145 @@ static void flag_toggle(nrf_atflags_t * p_flags, uint16_t conn_handle, bool valu
     }
 }
 
+#if (BLE_CONN_STATE_STATS_ENABLED == 1)
+/**@brief Function for adding an RSSI sample to the statistics of a connection.
+ *
+ * @param[in]  p_rec  Statistics of the connection.
+ * @param[in]  rssi   RSSI sample in dBm.
+ */
+static void stats_rssi_add(conn_stats_t * p_rec, int8_t rssi)
+{
+    int16_t sample = (int16_t)(rssi * (1 << RSSI_FRAC_BITS));
+
+    if (p_rec->stats.rssi_cnt == 0)
+    {
+        p_rec->rssi_acc = sample;
+    }
+    else
+    {
+        p_rec->rssi_acc += (sample - p_rec->rssi_acc) / (1 << BLE_CONN_STATE_STATS_RSSI_SHIFT);
+    }
+
+    // Round to the nearest dBm, away from zero at halfway.
+    int16_t half = (p_rec->rssi_acc < 0) ? -(1 << (RSSI_FRAC_BITS - 1)) : (1 << (RSSI_FRAC_BITS - 1));
+
+    p_rec->stats.rssi     = rssi;
+    p_rec->stats.rssi_avg = (int8_t)((p_rec->rssi_acc + half) / (1 << RSSI_FRAC_BITS));
+    p_rec->stats.rssi_cnt++;
+}
+
+
+/**@brief Function for updating the statistics of a connection from a BLE event.
+ *
+ * @details The sequence number of the record is odd while it is updated, see
+ *          @ref ble_conn_state_stats_get.
+ *
+ * @param[in]  conn_handle  Connection handle of the event.
+ * @param[in]  p_ble_evt    Event received from the BLE stack.
+ */
+static void stats_on_ble_evt(uint16_t conn_handle, ble_evt_t const * p_ble_evt)
+{
+    if ((conn_handle >= BLE_CONN_STATE_MAX_CONNECTIONS)
+        || !nrf_atflags_get(&m_bcs.flags.valid_flags, conn_handle))
+    {
+        return;
+    }
+
+    conn_stats_t           * p_rec   = &m_stats[conn_handle];
+    ble_conn_state_stats_t * p_stats = &p_rec->stats;
+
+    p_rec->seq++;
+    __DMB();
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_CONNECTED:
+            memset(p_stats, 0, sizeof(ble_conn_state_stats_t));
+            p_rec->rssi_acc        = 0;
+            p_stats->tx_phy        = BLE_GAP_PHY_1MBPS;
+            p_stats->rx_phy        = BLE_GAP_PHY_1MBPS;
+            p_stats->conn_interval = p_ble_evt->evt.gap_evt.params.connected.conn_params.max_conn_interval;
+            p_stats->att_mtu       = BLE_GATT_ATT_MTU_DEFAULT;
+            memset(p_stats->ch_map, 0xFF, sizeof(p_stats->ch_map));
+            p_stats->ch_map[sizeof(p_stats->ch_map) - 1] = 0x1F;
+            break;
+
+        case BLE_GAP_EVT_CONN_PARAM_UPDATE:
+            p_stats->conn_interval =
+                p_ble_evt->evt.gap_evt.params.conn_param_update.conn_params.max_conn_interval;
+            break;
+
+        case BLE_GAP_EVT_PHY_UPDATE:
+            if (p_ble_evt->evt.gap_evt.params.phy_update.status == BLE_HCI_STATUS_CODE_SUCCESS)
+            {
+                p_stats->tx_phy = p_ble_evt->evt.gap_evt.params.phy_update.tx_phy;
+                p_stats->rx_phy = p_ble_evt->evt.gap_evt.params.phy_update.rx_phy;
+            }
+            break;
+
+        case BLE_GAP_EVT_RSSI_CHANGED:
+            stats_rssi_add(p_rec, p_ble_evt->evt.gap_evt.params.rssi_changed.rssi);
+            break;
+
+        case BLE_GATTS_EVT_EXCHANGE_MTU_REQUEST:
+            p_stats->att_mtu = MAX(BLE_GATT_ATT_MTU_DEFAULT,
+                                   MIN(p_ble_evt->evt.gatts_evt.params.exchange_mtu_request.client_rx_mtu,
+                                       NRF_SDH_BLE_GATT_MAX_MTU_SIZE));
+            break;
+
+        case BLE_GATTC_EVT_EXCHANGE_MTU_RSP:
+            if (p_ble_evt->evt.gattc_evt.gatt_status == BLE_GATT_STATUS_SUCCESS)
+            {
+                p_stats->att_mtu = MAX(BLE_GATT_ATT_MTU_DEFAULT,
+                                       MIN(p_ble_evt->evt.gattc_evt.params.exchange_mtu_rsp.server_rx_mtu,
+                                           NRF_SDH_BLE_GATT_MAX_MTU_SIZE));
+            }
+            break;
+
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+            p_stats->hvn_tx_cnt += p_ble_evt->evt.gatts_evt.params.hvn_tx_complete.count;
+            break;
+
+        case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+            p_stats->write_cmd_tx_cnt += p_ble_evt->evt.gattc_evt.params.write_cmd_tx_complete.count;
+            break;
+
+        case BLE_GATTS_EVT_WRITE:
+            p_stats->rx_cnt++;
+            p_stats->rx_bytes += p_ble_evt->evt.gatts_evt.params.write.len;
+            break;
+
+        case BLE_GATTS_EVT_RW_AUTHORIZE_REQUEST:
+            if (p_ble_evt->evt.gatts_evt.params.authorize_request.type == BLE_GATTS_AUTHORIZE_TYPE_WRITE)
+            {
+                p_stats->rx_cnt++;
+                p_stats->rx_bytes += p_ble_evt->evt.gatts_evt.params.authorize_request.request.write.len;
+            }
+            break;
+
+        case BLE_GATTC_EVT_HVX:
+            p_stats->rx_cnt++;
+            p_stats->rx_bytes += p_ble_evt->evt.gattc_evt.params.hvx.len;
+            break;
+
+        case BLE_GATTC_EVT_READ_RSP:
+            if (p_ble_evt->evt.gattc_evt.gatt_status == BLE_GATT_STATUS_SUCCESS)
+            {
+                p_stats->rx_cnt++;
+                p_stats->rx_bytes += p_ble_evt->evt.gattc_evt.params.read_rsp.len;
+            }
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+
+    __DMB();
+    p_rec->seq++;
+}
+#endif // (BLE_CONN_STATE_STATS_ENABLED == 1)
+
 /**
  * @brief Function for handling BLE events.
  *
@@ -251,10 +493,13 @@ static void ble_evt_handler(ble_evt_t const * p_ble_evt, void * p_context)
                 // No implementation required.
             }
 
+            // Marked after the role is set, so the lists are not rebuilt in between.
+            m_lists.dirty = true;
             break;
 
         case BLE_GAP_EVT_DISCONNECTED:
             record_set_disconnected(conn_handle);
+            m_lists.dirty = true;
             break;
 
         case BLE_GAP_EVT_CONN_SEC_UPDATE:
@@ -275,6 +520,10 @@ static void ble_evt_handler(ble_evt_t const * p_ble_evt, void * p_context)
             }
             break;
     }
+
+#if (BLE_CONN_STATE_STATS_ENABLED == 1)
+    stats_on_ble_evt(conn_handle, p_ble_evt);
+#endif
 }
 
 NRF_SDH_BLE_OBSERVER(m_ble_evt_observer, BLE_CONN_STATE_BLE_OBSERVER_PRIO, ble_evt_handler, NULL);
@@ -361,43 +610,43 @@ uint32_t ble_conn_state_conn_count(void)
 
 uint32_t ble_conn_state_central_conn_count(void)
 {
-    nrf_atflags_t central_conn_flags = m_bcs.flags.central_flags;
-    UNUSED_RETURN_VALUE(nrf_atomic_u32_and(&central_conn_flags, m_bcs.flags.connected_flags));
-
-    return active_flag_count(central_conn_flags);
+    return lists_len_get(&m_lists.central);
 }
 
 
 uint32_t ble_conn_state_peripheral_conn_count(void)
 {
-    nrf_atflags_t peripheral_conn_flags = ~m_bcs.flags.central_flags;
-    UNUSED_RETURN_VALUE(nrf_atomic_u32_and(&peripheral_conn_flags, m_bcs.flags.connected_flags));
-
-    return active_flag_count(peripheral_conn_flags);
+    return lists_len_get(&m_lists.periph);
 }
 
 
 ble_conn_state_conn_handle_list_t ble_conn_state_conn_handles(void)
 {
-    return conn_handle_list_get(m_bcs.flags.valid_flags);
+    ble_conn_state_conn_handle_list_t conn_handle_list;
+
+    lists_read(&conn_handle_list, &m_lists.valid, sizeof(conn_handle_list));
+
+    return conn_handle_list;
 }
 
 
 ble_conn_state_conn_handle_list_t ble_conn_state_central_handles(void)
 {
-    nrf_atflags_t central_conn_flags = m_bcs.flags.central_flags;
-    UNUSED_RETURN_VALUE(nrf_atomic_u32_and(&central_conn_flags, m_bcs.flags.connected_flags));
+    ble_conn_state_conn_handle_list_t conn_handle_list;
+
+    lists_read(&conn_handle_list, &m_lists.central, sizeof(conn_handle_list));
 
-    return conn_handle_list_get(central_conn_flags);
+    return conn_handle_list;
 }
 
 
 ble_conn_state_conn_handle_list_t ble_conn_state_periph_handles(void)
 {
-    nrf_atflags_t peripheral_conn_flags = ~m_bcs.flags.central_flags;
-    UNUSED_RETURN_VALUE(nrf_atomic_u32_and(&peripheral_conn_flags, m_bcs.flags.connected_flags));
+    ble_conn_state_conn_handle_list_t conn_handle_list;
+
+    lists_read(&conn_handle_list, &m_lists.periph, sizeof(conn_handle_list));
 
-    return conn_handle_list_get(peripheral_conn_flags);
+    return conn_handle_list;
 }
 
 
@@ -462,16 +711,12 @@ static uint32_t for_each_set_flag(nrf_atflags_t                  flags,
 
     uint32_t call_count = 0;
 
-    if (flags != 0)
+    flags &= CONN_HANDLE_MASK;
+    while (flags != 0)
     {
-        for (uint32_t i = 0; i < BLE_CONN_STATE_MAX_CONNECTIONS; i++)
-        {
-            if (nrf_atflags_get(&flags, i))
-            {
-                user_function(i, p_context);
-                call_count += 1;
-            }
-        }
+        user_function(nrf_atomic_bits_find_first(flags), p_context);
+        flags &= flags - 1;
+        call_count += 1;
     }
     return call_count;
 }
@@ -495,3 +740,54 @@ uint32_t ble_conn_state_for_each_set_user_flag(ble_conn_state_user_flag_id_t  fl
 
     return for_each_set_flag(m_bcs.flags.user_flags[flag_id], user_function, p_context);
 }
+
+
+#if (BLE_CONN_STATE_STATS_ENABLED == 1)
+bool ble_conn_state_stats_get(uint16_t conn_idx, ble_conn_state_stats_t * p_stats)
+{
+    if ((p_stats == NULL) || !ble_conn_state_valid(conn_idx))
+    {
+        return false;
+    }
+
+    conn_stats_t const * p_rec = &m_stats[conn_idx];
+
+    for (uint32_t i = 0; i < STATS_READ_RETRIES; i++)
+    {
+        uint32_t seq = p_rec->seq;
+        __DMB();
+
+        if ((seq & 1) == 0)
+        {
+            memcpy(p_stats, &p_rec->stats, sizeof(ble_conn_state_stats_t));
+            __DMB();
+
+            if (p_rec->seq == seq)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+void ble_conn_state_stats_ch_map_set(uint16_t conn_handle, uint8_t const * p_ch_map)
+{
+    if ((p_ch_map == NULL) || !ble_conn_state_valid(conn_handle))
+    {
+        return;
+    }
+
+    conn_stats_t * p_rec = &m_stats[conn_handle];
+
+    p_rec->seq++;
+    __DMB();
+
+    memcpy(p_rec->stats.ch_map, p_ch_map, sizeof(p_rec->stats.ch_map));
+
+    __DMB();
+    p_rec->seq++;
+}
+#endif // (BLE_CONN_STATE_STATS_ENABLED == 1)
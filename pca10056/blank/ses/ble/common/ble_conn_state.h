@@ -68,6 +68,7 @@
 #include "ble.h"
 #include "ble_gap.h"
 #include "nrf_atomic.h"
+#include "sdk_config.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -128,6 +129,31 @@ typedef enum
 } ble_conn_state_user_flag_id_t;
 
 
+#if (BLE_CONN_STATE_STATS_ENABLED == 1) || defined(__SDK_DOXYGEN__)
+
+/**@brief Traffic and radio statistics of a connection. See @ref ble_conn_state_stats_get.
+ *
+ * @details The counters are reset when the connection is established and kept after it is
+ *          disconnected, until the connection handle is invalidated.
+ */
+typedef struct
+{
+    uint32_t hvn_tx_cnt;       /**< Notifications sent, as reported by @ref BLE_GATTS_EVT_HVN_TX_COMPLETE. */
+    uint32_t write_cmd_tx_cnt; /**< Write commands sent, as reported by @ref BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE. */
+    uint32_t rx_cnt;           /**< Writes, notifications, indications and read responses received. */
+    uint32_t rx_bytes;         /**< Attribute value bytes received in those packets. */
+    uint32_t rssi_cnt;         /**< Number of RSSI samples received with @ref BLE_GAP_EVT_RSSI_CHANGED. */
+    int8_t   rssi;             /**< Last RSSI sample in dBm. Only valid if rssi_cnt is not 0. */
+    int8_t   rssi_avg;         /**< Exponentially weighted average of the RSSI samples in dBm, see @ref BLE_CONN_STATE_STATS_RSSI_SHIFT. */
+    uint8_t  tx_phy;           /**< Current transmitter PHY (see @ref BLE_GAP_PHYS). */
+    uint8_t  rx_phy;           /**< Current receiver PHY (see @ref BLE_GAP_PHYS). */
+    uint16_t conn_interval;    /**< Current connection interval in 1.25 ms units. */
+    uint16_t att_mtu;          /**< Current ATT MTU. */
+    uint8_t  ch_map[5];        /**< Data channels used by the connection, one bit per channel index. All 37 at connection, see @ref ble_conn_state_stats_ch_map_set. */
+} ble_conn_state_stats_t;
+
+#endif // (BLE_CONN_STATE_STATS_ENABLED == 1) || defined(__SDK_DOXYGEN__)
+
 /**@brief Function to be called when a flag ID is set. See @ref ble_conn_state_for_each_set_user_flag.
  *
  * @param[in]  conn_handle  The connection the flag is set for.
@@ -350,6 +376,43 @@ uint32_t ble_conn_state_for_each_set_user_flag(ble_conn_state_user_flag_id_t  fl
                                                ble_conn_state_user_function_t user_function,
                                                void                         * p_context);
 
+
+#if (BLE_CONN_STATE_STATS_ENABLED == 1) || defined(__SDK_DOXYGEN__)
+
+/**@brief Function for reading the statistics of a connection.
+ *
+ * @details The statistics are updated from the BLE event handler of the module and can be read
+ *          from any context without locking. A copy that was interrupted by an update is retried,
+ *          so the returned statistics are always consistent.
+ *
+ *          RSSI samples are only reported after @ref sd_ble_gap_rssi_start has been called for
+ *          the connection. The ATT MTU is the smaller of the MTU of the peer and
+ *          NRF_SDH_BLE_GATT_MAX_MTU_SIZE, which is what @ref nrf_ble_gatt negotiates by default.
+ *
+ * @param[in]  conn_idx  Index of the connection, see @ref ble_conn_state_conn_idx.
+ * @param[out] p_stats   Statistics of the connection.
+ *
+ * @retval true   If the statistics were copied.
+ * @retval false  If @p conn_idx does not refer to a valid connection, or if the function was
+ *                called from an interrupt that preempted an update of the statistics.
+ */
+bool ble_conn_state_stats_get(uint16_t conn_idx, ble_conn_state_stats_t * p_stats);
+
+
+/**@brief Function for recording the channel map of a connection in its statistics.
+ *
+ * @details The channel map is not reported in a BLE event, so the module that sets it with
+ *          @ref sd_ble_opt_set must record it here. Must be called from the context of the BLE
+ *          event handlers, as the statistics have one writer.
+ *
+ * @param[in]  conn_handle  Handle of the connection.
+ * @param[in]  p_ch_map     Data channels used by the connection, in the format of
+ *                          @ref ble_gap_opt_ch_map_t::ch_map.
+ */
+void ble_conn_state_stats_ch_map_set(uint16_t conn_handle, uint8_t const * p_ch_map);
+
+#endif // (BLE_CONN_STATE_STATS_ENABLED == 1) || defined(__SDK_DOXYGEN__)
+
 /** @} */
 /** @} */
 
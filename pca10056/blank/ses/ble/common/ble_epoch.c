@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "ble_epoch.h"
+
+#define DAYS_0000_TO_1970   719468UL    /**< Days from 0000-03-01 to 1970-01-01. */
+#define DAYS_PER_ERA        146097UL    /**< Days in 400 years. */
+
+
+uint32_t ble_epoch_days_from_date(uint32_t year, uint32_t month, uint32_t day)
+{
+    // Years start in March, so the leap day is the last day of the year.
+    uint32_t y   = (month <= 2) ? (year - 1) : year;
+    uint32_t era = y / 400;
+    uint32_t yoe = y - (era * 400);
+    uint32_t doy = ((153 * ((month > 2) ? (month - 3) : (month + 9))) + 2) / 5 + day - 1;
+    uint32_t doe = (yoe * 365) + (yoe / 4) - (yoe / 100) + doy;
+
+    return (era * DAYS_PER_ERA) + doe - DAYS_0000_TO_1970;
+}
+
+
+void ble_epoch_date_from_days(uint32_t days, ble_date_time_t * p_date_time)
+{
+    uint32_t z   = days + DAYS_0000_TO_1970;
+    uint32_t era = z / DAYS_PER_ERA;
+    uint32_t doe = z - (era * DAYS_PER_ERA);
+    uint32_t yoe = (doe - (doe / 1460) + (doe / 36524) - (doe / 146096)) / 365;
+    uint32_t doy = doe - ((365 * yoe) + (yoe / 4) - (yoe / 100));
+    uint32_t mp  = ((5 * doy) + 2) / 153;
+    uint32_t m   = (mp < 10) ? (mp + 3) : (mp - 9);
+
+    p_date_time->year  = (uint16_t)(yoe + (era * 400) + ((m <= 2) ? 1 : 0));
+    p_date_time->month = (uint8_t)m;
+    p_date_time->day   = (uint8_t)(doy - (((153 * mp) + 2) / 5) + 1);
+}
+
+
+uint8_t ble_epoch_day_of_week(uint32_t days)
+{
+    // 1970-01-01 was a Thursday.
+    return (uint8_t)(((days + 3) % 7) + 1);
+}
+
+
+bool ble_epoch_from_date_time(ble_date_time_t const * p_date_time, uint32_t * p_seconds)
+{
+    static uint8_t const days_in_month[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    if (   (p_date_time->year  < BLE_EPOCH_YEAR_MIN) || (p_date_time->year > BLE_EPOCH_YEAR_MAX)
+        || (p_date_time->month < 1) || (p_date_time->month > 12)
+        || (p_date_time->day   < 1) || (p_date_time->day > days_in_month[p_date_time->month - 1])
+        || (p_date_time->hours > 23) || (p_date_time->minutes > 59) || (p_date_time->seconds > 59))
+    {
+        return false;
+    }
+
+    *p_seconds = (ble_epoch_days_from_date(p_date_time->year, p_date_time->month, p_date_time->day) *
+                  BLE_EPOCH_SEC_PER_DAY)
+               + ((uint32_t)p_date_time->hours * 3600)
+               + ((uint32_t)p_date_time->minutes * 60)
+               + p_date_time->seconds;
+
+    return true;
+}
+
+
+void ble_epoch_to_date_time(uint32_t seconds, ble_date_time_t * p_date_time)
+{
+    uint32_t days           = seconds / BLE_EPOCH_SEC_PER_DAY;
+    uint32_t seconds_of_day = seconds - (days * BLE_EPOCH_SEC_PER_DAY);
+
+    ble_epoch_date_from_days(days, p_date_time);
+
+    p_date_time->hours   = (uint8_t)(seconds_of_day / 3600);
+    seconds_of_day      -= (uint32_t)p_date_time->hours * 3600;
+    p_date_time->minutes = (uint8_t)(seconds_of_day / 60);
+    p_date_time->seconds = (uint8_t)(seconds_of_day - ((uint32_t)p_date_time->minutes * 60));
+}
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * @file
+ *
+ * @defgroup ble_epoch Date and time arithmetic in seconds since 1970
+ * @ingroup ble_sdk_lib
+ * @{
+ * @brief Conversion between @ref ble_date_time_t and seconds since 1970-01-01 00:00:00.
+ *
+ * @details Dates are converted with the days-from-civil algorithm, using only 32 bit
+ *          multiplications and divisions by constants, so no libc time functions are needed.
+ *          Time zones and daylight saving time are not applied. The epoch fits in 32 bits from
+ *          @ref BLE_EPOCH_YEAR_MIN through @ref BLE_EPOCH_YEAR_MAX.
+ */
+
+#ifndef BLE_EPOCH_H__
+#define BLE_EPOCH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "app_util.h"
+#include "ble_date_time.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BLE_EPOCH_YEAR_MIN      1970        /**< First year that can be converted. */
+#define BLE_EPOCH_YEAR_MAX      2105        /**< Last year that can be converted. */
+#define BLE_EPOCH_SEC_PER_DAY   86400UL     /**< Number of seconds in a day. */
+
+/**@brief Function for converting a date to a number of days since 1970-01-01.
+ *
+ * @param[in] year   Year, from @ref BLE_EPOCH_YEAR_MIN.
+ * @param[in] month  Month, from 1 to 12.
+ * @param[in] day    Day of the month, from 1.
+ *
+ * @return Number of days since 1970-01-01.
+ */
+uint32_t ble_epoch_days_from_date(uint32_t year, uint32_t month, uint32_t day);
+
+
+/**@brief Function for converting a number of days since 1970-01-01 to a date.
+ *
+ * @param[in]  days         Number of days since 1970-01-01.
+ * @param[out] p_date_time  Date. The time of day is not changed.
+ */
+void ble_epoch_date_from_days(uint32_t days, ble_date_time_t * p_date_time);
+
+
+/**@brief Function for getting the day of the week of a number of days since 1970-01-01.
+ *
+ * @param[in] days  Number of days since 1970-01-01.
+ *
+ * @return Day of the week, from 1 (Monday) to 7 (Sunday), as in the Day of Week characteristic.
+ */
+uint8_t ble_epoch_day_of_week(uint32_t days);
+
+
+/**@brief Function for converting a date and time to seconds since 1970-01-01 00:00:00.
+ *
+ * @param[in]  p_date_time  Date and time.
+ * @param[out] p_seconds    Seconds since 1970-01-01 00:00:00.
+ *
+ * @note February 29 is accepted in every year. In a year that is not a leap year, it is taken
+ *       as March 1.
+ *
+ * @return True if the date and time are known, valid, and from @ref BLE_EPOCH_YEAR_MIN through
+ *         @ref BLE_EPOCH_YEAR_MAX.
+ */
+bool ble_epoch_from_date_time(ble_date_time_t const * p_date_time, uint32_t * p_seconds);
+
+
+/**@brief Function for converting seconds since 1970-01-01 00:00:00 to a date and time.
+ *
+ * @param[in]  seconds      Seconds since 1970-01-01 00:00:00.
+ * @param[out] p_date_time  Date and time.
+ */
+void ble_epoch_to_date_time(uint32_t seconds, ble_date_time_t * p_date_time);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_EPOCH_H__
+
+/** @} */
@@ -0,0 +1,384 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "ble_gatt_db_compact.h"
+#include <string.h>
+#include "sdk_common.h"
+
+#define BLOCK_HDR_LEN   sizeof(ble_gatt_db_compact_t *) /**< A block starts with the address of its database. */
+#define SRV_LEN         8                               /**< UUID, UUID type, characteristic count and handle range. */
+#define CHAR_LEN        9                               /**< UUID, UUID type, properties, flags, declaration and value handles. */
+#define DESC_COUNT      4                               /**< Descriptors stored for a characteristic. */
+
+#define FLAG_EXT_PROPS  (1U << 0)                       /**< ble_gattc_char_t::char_ext_props is set. */
+#define FLAG_DESC_POS   4                               /**< Bit of the first descriptor present flag. */
+
+STATIC_ASSERT(sizeof(ble_gatt_char_props_t) == 1);
+
+
+/**@brief Function for getting the descriptor handles of a characteristic, in storage order. */
+static void desc_handles_get(ble_gatt_db_char_t const * p_char, uint16_t * p_handles)
+{
+    p_handles[0] = p_char->cccd_handle;
+    p_handles[1] = p_char->ext_prop_handle;
+    p_handles[2] = p_char->user_desc_handle;
+    p_handles[3] = p_char->report_ref_handle;
+}
+
+
+/**@brief Function for getting the stored length of a characteristic. */
+static uint32_t char_len(ble_gatt_db_char_t const * p_char)
+{
+    uint16_t handles[DESC_COUNT];
+    uint32_t len = CHAR_LEN;
+
+    desc_handles_get(p_char, handles);
+    for (uint32_t i = 0; i < DESC_COUNT; i++)
+    {
+        if (handles[i] != BLE_GATT_HANDLE_INVALID)
+        {
+            len += sizeof(uint16_t);
+        }
+    }
+
+    return len;
+}
+
+
+/**@brief Function for storing a 16-bit value, least significant byte first. */
+static uint8_t * u16_put(uint8_t * p_dst, uint16_t value)
+{
+    p_dst[0] = (uint8_t)value;
+    p_dst[1] = (uint8_t)(value >> 8);
+
+    return p_dst + sizeof(uint16_t);
+}
+
+
+/**@brief Function for reading a value stored with @ref u16_put. */
+static uint16_t u16_get(uint8_t const * p_src)
+{
+    return (uint16_t)(p_src[0] | (p_src[1] << 8));
+}
+
+
+/**@brief Function for packing a service and its characteristics.
+ *
+ * @return End of the packed service.
+ */
+static uint8_t * srv_pack(uint8_t * p_dst, ble_gatt_db_srv_t const * p_srv)
+{
+    p_dst    = u16_put(p_dst, p_srv->srv_uuid.uuid);
+    *p_dst++ = p_srv->srv_uuid.type;
+    *p_dst++ = p_srv->char_count;
+    p_dst    = u16_put(p_dst, p_srv->handle_range.start_handle);
+    p_dst    = u16_put(p_dst, p_srv->handle_range.end_handle);
+
+    for (uint32_t i = 0; i < p_srv->char_count; i++)
+    {
+        ble_gatt_db_char_t const * p_char = &p_srv->charateristics[i];
+        uint8_t                  * p_flags;
+        uint16_t                   handles[DESC_COUNT];
+
+        p_dst    = u16_put(p_dst, p_char->characteristic.uuid.uuid);
+        *p_dst++ = p_char->characteristic.uuid.type;
+        memcpy(p_dst++, &p_char->characteristic.char_props, 1);
+        p_flags  = p_dst++;
+        *p_flags = p_char->characteristic.char_ext_props ? FLAG_EXT_PROPS : 0;
+        p_dst    = u16_put(p_dst, p_char->characteristic.handle_decl);
+        p_dst    = u16_put(p_dst, p_char->characteristic.handle_value);
+
+        desc_handles_get(p_char, handles);
+        for (uint32_t j = 0; j < DESC_COUNT; j++)
+        {
+            if (handles[j] != BLE_GATT_HANDLE_INVALID)
+            {
+                *p_flags |= (uint8_t)(1U << (FLAG_DESC_POS + j));
+                p_dst     = u16_put(p_dst, handles[j]);
+            }
+        }
+    }
+
+    return p_dst;
+}
+
+
+/**@brief Function for unpacking a characteristic.
+ *
+ * @return Start of the next characteristic or service.
+ */
+static uint8_t const * char_unpack(uint8_t const * p_src, ble_gatt_db_char_t * p_char)
+{
+    uint16_t handles[DESC_COUNT];
+    uint8_t  flags;
+
+    memset(p_char, 0, sizeof(*p_char));
+
+    p_char->characteristic.uuid.uuid      = u16_get(p_src);
+    p_char->characteristic.uuid.type      = p_src[2];
+    memcpy(&p_char->characteristic.char_props, &p_src[3], 1);
+    flags                                 = p_src[4];
+    p_char->characteristic.char_ext_props = (flags & FLAG_EXT_PROPS) ? 1 : 0;
+    p_char->characteristic.handle_decl    = u16_get(&p_src[5]);
+    p_char->characteristic.handle_value   = u16_get(&p_src[7]);
+    p_src += CHAR_LEN;
+
+    for (uint32_t i = 0; i < DESC_COUNT; i++)
+    {
+        handles[i] = BLE_GATT_HANDLE_INVALID;
+        if (flags & (1U << (FLAG_DESC_POS + i)))
+        {
+            handles[i] = u16_get(p_src);
+            p_src     += sizeof(uint16_t);
+        }
+    }
+
+    p_char->cccd_handle       = handles[0];
+    p_char->ext_prop_handle   = handles[1];
+    p_char->user_desc_handle  = handles[2];
+    p_char->report_ref_handle = handles[3];
+
+    return p_src;
+}
+
+
+/**@brief Function for skipping to a characteristic, or to the next service.
+ *
+ * @param[in] p_src     Start of the service.
+ * @param[in] char_ind  Index of the characteristic, or the characteristic count of the service
+ *                      to skip the whole service.
+ */
+static uint8_t const * char_find(uint8_t const * p_src, uint32_t char_ind)
+{
+    p_src += SRV_LEN;
+
+    for (uint32_t i = 0; i < char_ind; i++)
+    {
+        uint8_t flags = p_src[4];
+
+        p_src += CHAR_LEN;
+        for (uint32_t j = 0; j < DESC_COUNT; j++)
+        {
+            if (flags & (1U << (FLAG_DESC_POS + j)))
+            {
+                p_src += sizeof(uint16_t);
+            }
+        }
+    }
+
+    return p_src;
+}
+
+
+/**@brief Function for finding a service of a database.
+ *
+ * @return Start of the service, or NULL if there is no service at @p srv_ind.
+ */
+static uint8_t const * srv_find(ble_gatt_db_compact_t const * p_db, uint32_t srv_ind)
+{
+    uint8_t const * p_src;
+
+    if ((p_db->p_arena == NULL) || (srv_ind >= p_db->srv_count))
+    {
+        return NULL;
+    }
+
+    p_src = &p_db->p_arena->p_mem[p_db->offset + BLOCK_HDR_LEN];
+    for (uint32_t i = 0; i < srv_ind; i++)
+    {
+        p_src = char_find(p_src, p_src[3]);
+    }
+
+    return p_src;
+}
+
+
+uint32_t ble_gatt_db_compact_len(ble_gatt_db_srv_t const * p_srvs, uint32_t srv_count)
+{
+    uint32_t len = BLOCK_HDR_LEN;
+
+    for (uint32_t i = 0; i < srv_count; i++)
+    {
+        len += SRV_LEN;
+        for (uint32_t j = 0; j < p_srvs[i].char_count; j++)
+        {
+            len += char_len(&p_srvs[i].charateristics[j]);
+        }
+    }
+
+    return len;
+}
+
+
+ret_code_t ble_gatt_db_compact_store(ble_gatt_db_arena_t     * p_arena,
+                                     ble_gatt_db_compact_t   * p_db,
+                                     ble_gatt_db_srv_t const * p_srvs,
+                                     uint32_t                  srv_count)
+{
+    uint32_t  len;
+    uint32_t  prev_len;
+    uint8_t * p_dst;
+
+    VERIFY_PARAM_NOT_NULL(p_arena);
+    VERIFY_PARAM_NOT_NULL(p_db);
+    VERIFY_PARAM_NOT_NULL(p_srvs);
+
+    if ((p_db->p_arena != NULL) && (p_db->p_arena != p_arena))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    for (uint32_t i = 0; i < srv_count; i++)
+    {
+        if (p_srvs[i].char_count > BLE_GATT_DB_MAX_CHARS)
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+    }
+
+    len      = ble_gatt_db_compact_len(p_srvs, srv_count);
+    prev_len = (p_db->p_arena != NULL) ? p_db->len : 0;
+
+    if ((srv_count > UINT8_MAX) || (p_arena->used - prev_len + len > p_arena->size))
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    ble_gatt_db_compact_free(p_db);
+
+    p_dst = &p_arena->p_mem[p_arena->used];
+    memcpy(p_dst, &p_db, BLOCK_HDR_LEN);
+    p_dst += BLOCK_HDR_LEN;
+    for (uint32_t i = 0; i < srv_count; i++)
+    {
+        p_dst = srv_pack(p_dst, &p_srvs[i]);
+    }
+
+    p_db->p_arena   = p_arena;
+    p_db->offset    = p_arena->used;
+    p_db->len       = (uint16_t)len;
+    p_db->srv_count = (uint8_t)srv_count;
+
+    p_arena->used  += (uint16_t)len;
+
+    return NRF_SUCCESS;
+}
+
+
+void ble_gatt_db_compact_free(ble_gatt_db_compact_t * p_db)
+{
+    ble_gatt_db_arena_t * p_arena;
+    uint32_t              next;
+
+    if ((p_db == NULL) || (p_db->p_arena == NULL))
+    {
+        return;
+    }
+
+    p_arena = p_db->p_arena;
+    next    = p_db->offset + p_db->len;
+
+    // The blocks after this one are moved down, and their databases are told where they are now.
+    memmove(&p_arena->p_mem[p_db->offset], &p_arena->p_mem[next], p_arena->used - next);
+    p_arena->used -= p_db->len;
+
+    for (uint32_t offset = p_db->offset; offset < p_arena->used; )
+    {
+        ble_gatt_db_compact_t * p_moved;
+
+        memcpy(&p_moved, &p_arena->p_mem[offset], BLOCK_HDR_LEN);
+        p_moved->offset = (uint16_t)offset;
+        offset         += p_moved->len;
+    }
+
+    memset(p_db, 0, sizeof(*p_db));
+}
+
+
+ret_code_t ble_gatt_db_compact_srv_get(ble_gatt_db_compact_t const * p_db,
+                                       uint32_t                      srv_ind,
+                                       ble_gatt_db_srv_t           * p_srv)
+{
+    uint8_t const * p_src;
+
+    VERIFY_PARAM_NOT_NULL(p_db);
+    VERIFY_PARAM_NOT_NULL(p_srv);
+
+    p_src = srv_find(p_db, srv_ind);
+    if (p_src == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_srv->srv_uuid.uuid             = u16_get(p_src);
+    p_srv->srv_uuid.type             = p_src[2];
+    p_srv->char_count                = p_src[3];
+    p_srv->handle_range.start_handle = u16_get(&p_src[4]);
+    p_srv->handle_range.end_handle   = u16_get(&p_src[6]);
+
+    p_src += SRV_LEN;
+    for (uint32_t i = 0; i < p_srv->char_count; i++)
+    {
+        p_src = char_unpack(p_src, &p_srv->charateristics[i]);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t ble_gatt_db_compact_char_get(ble_gatt_db_compact_t const * p_db,
+                                        uint32_t                      srv_ind,
+                                        uint32_t                      char_ind,
+                                        ble_gatt_db_char_t          * p_char)
+{
+    uint8_t const * p_src;
+
+    VERIFY_PARAM_NOT_NULL(p_db);
+    VERIFY_PARAM_NOT_NULL(p_char);
+
+    p_src = srv_find(p_db, srv_ind);
+    if ((p_src == NULL) || (char_ind >= p_src[3]))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    UNUSED_RETURN_VALUE(char_unpack(char_find(p_src, char_ind), p_char));
+
+    return NRF_SUCCESS;
+}
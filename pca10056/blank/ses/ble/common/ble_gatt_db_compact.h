@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup ble_sdk_lib_gatt_db_compact Compact GATT Database Storage
+ * @{
+ * @ingroup  ble_sdk_lib
+ * @brief    Packed storage of @ref ble_gatt_db_srv_t records in a shared arena.
+ *
+ * @details  A @ref ble_gatt_db_srv_t holds room for @ref BLE_GATT_DB_MAX_CHARS characteristics,
+ *           each with all four descriptor handles. This module packs a list of services into a
+ *           block of an arena, storing only the characteristics found and the descriptor handles
+ *           present, so a block takes what the peer actually has. The services are read back as
+ *           @ref ble_gatt_db_srv_t and @ref ble_gatt_db_char_t with the accessor functions.
+ *
+ *           The blocks of an arena are kept packed: freeing a block moves the blocks after it,
+ *           and updates the @ref ble_gatt_db_compact_t they belong to. A
+ *           @ref ble_gatt_db_compact_t must therefore stay at the same address while it holds a
+ *           block, and pointers into the arena must not be kept.
+ *
+ * @note     The functions are not reentrant. An arena must only be used from one execution
+ *           context.
+ */
+
+#ifndef BLE_GATT_DB_COMPACT_H__
+#define BLE_GATT_DB_COMPACT_H__
+
+#include <stdint.h>
+#include "nordic_common.h"
+#include "sdk_errors.h"
+#include "ble_gatt_db.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Macro for defining an arena.
+ *
+ * @param   _name   Name of the arena.
+ * @param   _size   Size of the arena in bytes, at most 65535.
+ * @hideinitializer
+ */
+#define BLE_GATT_DB_ARENA_DEF(_name, _size)                                         \
+    static uint32_t CONCAT_2(_name, _mem)[CEIL_DIV((_size), sizeof(uint32_t))];     \
+    static ble_gatt_db_arena_t _name =                                              \
+    {                                                                               \
+        .p_mem = (uint8_t *)CONCAT_2(_name, _mem),                                  \
+        .size  = (_size),                                                           \
+        .used  = 0                                                                  \
+    }
+
+/**@brief Arena holding the blocks of several databases. */
+typedef struct
+{
+    uint8_t  * p_mem;   /**< Memory of the arena. */
+    uint16_t   size;    /**< Size of @p p_mem. */
+    uint16_t   used;    /**< Bytes taken by the blocks, from the start of @p p_mem. */
+} ble_gatt_db_arena_t;
+
+/**@brief Database stored in an arena.
+ *
+ * @warning This structure must be zero-initialized.
+ */
+typedef struct
+{
+    ble_gatt_db_arena_t * p_arena;   /**< Arena holding the block, NULL if the database is empty. */
+    uint16_t              offset;    /**< Offset of the block in the arena. */
+    uint16_t              len;       /**< Length of the block, including its header. */
+    uint8_t               srv_count; /**< Number of services in the block. */
+} ble_gatt_db_compact_t;
+
+
+/**@brief Function for getting the number of bytes a list of services takes in an arena.
+ *
+ * @param[in] p_srvs    Services.
+ * @param[in] srv_count Number of services in @p p_srvs.
+ *
+ * @return Length of the block.
+ */
+uint32_t ble_gatt_db_compact_len(ble_gatt_db_srv_t const * p_srvs, uint32_t srv_count);
+
+
+/**@brief Function for storing a list of services in an arena.
+ *
+ * @details The previous block of @p p_db is replaced. If the services do not fit, the previous
+ *          block is kept.
+ *
+ * @param[in]     p_arena   Arena.
+ * @param[in,out] p_db      Database to store the services in.
+ * @param[in]     p_srvs    Services. Only the first @ref ble_gatt_db_srv_t::char_count
+ *                          characteristics of each are stored.
+ * @param[in]     srv_count Number of services in @p p_srvs.
+ *
+ * @retval NRF_SUCCESS             If the services were stored.
+ * @retval NRF_ERROR_NULL          If a parameter is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If @p p_db holds a block of another arena.
+ * @retval NRF_ERROR_NO_MEM        If the arena has no room for the services.
+ */
+ret_code_t ble_gatt_db_compact_store(ble_gatt_db_arena_t     * p_arena,
+                                     ble_gatt_db_compact_t   * p_db,
+                                     ble_gatt_db_srv_t const * p_srvs,
+                                     uint32_t                  srv_count);
+
+
+/**@brief Function for freeing the block of a database.
+ *
+ * @param[in,out] p_db Database. Nothing is done if it is empty.
+ */
+void ble_gatt_db_compact_free(ble_gatt_db_compact_t * p_db);
+
+
+/**@brief Function for reading a service of a database.
+ *
+ * @param[in]  p_db    Database.
+ * @param[in]  srv_ind Index of the service, in the order the services were stored.
+ * @param[out] p_srv   Service. The characteristics after @ref ble_gatt_db_srv_t::char_count are
+ *                     not written.
+ *
+ * @retval NRF_SUCCESS             If the service was read.
+ * @retval NRF_ERROR_INVALID_PARAM If the database has no service at @p srv_ind.
+ */
+ret_code_t ble_gatt_db_compact_srv_get(ble_gatt_db_compact_t const * p_db,
+                                       uint32_t                      srv_ind,
+                                       ble_gatt_db_srv_t           * p_srv);
+
+
+/**@brief Function for reading a characteristic of a service of a database.
+ *
+ * @param[in]  p_db     Database.
+ * @param[in]  srv_ind  Index of the service.
+ * @param[in]  char_ind Index of the characteristic in the service.
+ * @param[out] p_char   Characteristic, with BLE_GATT_HANDLE_INVALID for the descriptors that
+ *                      are not present.
+ *
+ * @retval NRF_SUCCESS             If the characteristic was read.
+ * @retval NRF_ERROR_INVALID_PARAM If the database has no such characteristic.
+ */
+ret_code_t ble_gatt_db_compact_char_get(ble_gatt_db_compact_t const * p_db,
+                                        uint32_t                      srv_ind,
+                                        uint32_t                      char_ind,
+                                        ble_gatt_db_char_t          * p_char);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_GATT_DB_COMPACT_H__
+
+/** @} */
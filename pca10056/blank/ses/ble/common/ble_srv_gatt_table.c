@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "ble_srv_gatt_table.h"
+#include <string.h>
+#include "nordic_common.h"
+#include "ble.h"
+
+
+uint32_t ble_srv_gatt_service_add(ble_srv_gatt_service_t const * p_service, void * p_instance)
+{
+    uint32_t         err_code;
+    ble_uuid_t       uuid;
+    ble_gatts_attr_t attr_char_value;
+    uint8_t        * p_base = (uint8_t *)p_instance;
+    uint16_t       * p_service_handle;
+
+    if ((p_service == NULL) || (p_instance == NULL))
+    {
+        return NRF_ERROR_NULL;
+    }
+
+    p_service_handle = (uint16_t *)(p_base + p_service->service_handle_offset);
+
+    uuid.type = (p_service->uuid_type_offset == BLE_SRV_GATT_UUID_TYPE_SIG) ?
+                BLE_UUID_TYPE_BLE : p_base[p_service->uuid_type_offset];
+    uuid.uuid = p_service->uuid;
+
+    err_code = sd_ble_gatts_service_add(BLE_GATTS_SRVC_TYPE_PRIMARY, &uuid, p_service_handle);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    memset(&attr_char_value, 0, sizeof(attr_char_value));
+    attr_char_value.p_uuid = &uuid;
+
+    for (uint8_t i = 0; i < p_service->char_count; i++)
+    {
+        ble_srv_gatt_char_t const * p_char = &p_service->p_chars[i];
+
+        uuid.uuid = p_char->uuid;
+
+        attr_char_value.p_attr_md = &p_char->attr_md;
+        attr_char_value.max_len   = p_char->max_len;
+        attr_char_value.p_value   = p_char->p_init_value;
+        attr_char_value.init_len  = p_char->init_len;
+
+        err_code = sd_ble_gatts_characteristic_add(*p_service_handle,
+                                                   &p_char->char_md,
+                                                   &attr_char_value,
+                                                   (ble_gatts_char_handles_t *)(p_base + p_char->handles_offset));
+        if (err_code != NRF_SUCCESS)
+        {
+            return err_code;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t ble_srv_gatt_table_add(ble_srv_gatt_table_entry_t const * p_table, uint8_t count)
+{
+    uint32_t err_code;
+
+    if (p_table == NULL)
+    {
+        return NRF_ERROR_NULL;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        err_code = ble_srv_gatt_service_add(p_table[i].p_service, p_table[i].p_instance);
+        if (err_code != NRF_SUCCESS)
+        {
+            return err_code;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
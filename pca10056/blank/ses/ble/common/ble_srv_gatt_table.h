@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup ble_srv_gatt_table Table-driven service definitions
+ * @{
+ * @ingroup ble_sdk_srv
+ * @brief Static service definitions that are added to the GATT table in one pass.
+ *
+ * @details A service and its characteristics are described by a static constant table, in
+ *          which the attribute metadata expected by the SoftDevice is already encoded. Adding
+ *          the service then only takes one SoftDevice call per attribute, without the parameter
+ *          setup that @ref characteristic_add does for every characteristic. The handles are
+ *          written to the service instance structure, at the offsets given by the table.
+ *
+ *          The tables must be defined at file scope, as the CCCD metadata is referred to through
+ *          C99 compound literals. Example:
+ *          @code
+ *              BLE_SRV_GATT_SERVICE_DEF(m_my_service, my_service_t, MY_UUID_SERVICE,
+ *                                       BLE_SRV_GATT_UUID_TYPE_SIG, service_handle,
+ *                  BLE_SRV_GATT_CHAR_CCCD(my_service_t, meas_handles, MY_UUID_MEAS_CHAR,
+ *                                         SEC_OPEN, SEC_NO_ACCESS, SEC_OPEN, 20, true,
+ *                                         .notify = 1),
+ *                  BLE_SRV_GATT_CHAR(my_service_t, ctrl_handles, MY_UUID_CTRL_CHAR,
+ *                                    SEC_OPEN, SEC_OPEN, 1, false, .read = 1, .write = 1));
+ *
+ *              err_code = ble_srv_gatt_service_add(&m_my_service, p_my_service);
+ *          @endcode
+ *
+ *          Characteristics with a user description, a presentation format or a value in
+ *          application memory are still added with @ref characteristic_add.
+ */
+
+#ifndef BLE_SRV_GATT_TABLE_H__
+#define BLE_SRV_GATT_TABLE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ble.h"
+#include "ble_gatts.h"
+#include "app_util.h"
+#include "ble_srv_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BLE_SRV_GATT_UUID_TYPE_SIG 0xFFFF   /**< The service uses the Bluetooth SIG base UUID. */
+
+/**@brief Macro for giving the offset of the vendor specific UUID type of the service in its
+ *        instance structure.
+ *
+ * @param[in] _type   Type of the service instance structure.
+ * @param[in] _field  Field of type uint8_t holding the value returned by @ref sd_ble_uuid_vs_add.
+ */
+#define BLE_SRV_GATT_UUID_TYPE_FIELD(_type, _field) ((uint16_t)offsetof(_type, _field))
+
+/**@brief Macro for encoding a @ref security_req_t level as a @ref ble_gap_conn_sec_mode_t
+ *        initializer at compile time.
+ */
+#define BLE_SRV_GATT_SEC_MODE(_level)                                                         \
+    {                                                                                         \
+        .sm = ((_level) == SEC_NO_ACCESS) ? 0 : (((_level) >= SEC_SIGNED) ? 2 : 1),           \
+        .lv = ((_level) == SEC_NO_ACCESS) ? 0 :                                               \
+              (((_level) >= SEC_SIGNED) ? ((_level) - SEC_SIGNED + 1) : (_level))             \
+    }
+
+/**@brief Macro for the metadata of a CCCD that is stored in the stack and is always readable.
+ *
+ * @param[in] _write_access  @ref security_req_t level for writing the CCCD.
+ */
+#define BLE_SRV_GATT_CCCD_MD(_write_access)                                                   \
+    (&(ble_gatts_attr_md_t const)                                                             \
+    {                                                                                         \
+        .read_perm  = BLE_SRV_GATT_SEC_MODE(SEC_OPEN),                                        \
+        .write_perm = BLE_SRV_GATT_SEC_MODE(_write_access),                                   \
+        .vloc       = BLE_GATTS_VLOC_STACK                                                    \
+    })
+
+/**@brief Macro for describing a characteristic without a CCCD, with its value in the stack.
+ *
+ * @param[in] _type          Type of the service instance structure.
+ * @param[in] _field         Field of type @ref ble_gatts_char_handles_t receiving the handles.
+ * @param[in] _uuid          16-bit UUID, using the UUID type of the service.
+ * @param[in] _read_access   @ref security_req_t level for reading the value.
+ * @param[in] _write_access  @ref security_req_t level for writing the value.
+ * @param[in] _max_len       Maximum length of the value. A fixed length value is initially
+ *                           zeroed to that length, a variable length value is initially empty.
+ * @param[in] _is_var_len    True if the value has variable length.
+ * @param[in] ...            Designated initializers of the @ref ble_gatt_char_props_t fields,
+ *                           for example .read = 1.
+ */
+#define BLE_SRV_GATT_CHAR(_type, _field, _uuid, _read_access, _write_access,                   \
+                          _max_len, _is_var_len, ...)                                          \
+    {                                                                                          \
+        .uuid           = (_uuid),                                                             \
+        .max_len        = (_max_len),                                                          \
+        .init_len       = (_is_var_len) ? 0 : (_max_len),                                      \
+        .handles_offset = (uint16_t)offsetof(_type, _field),                                   \
+        .char_md        = { .char_props = { __VA_ARGS__ } },                                   \
+        .attr_md        =                                                                      \
+        {                                                                                      \
+            .read_perm  = BLE_SRV_GATT_SEC_MODE(_read_access),                                 \
+            .write_perm = BLE_SRV_GATT_SEC_MODE(_write_access),                                \
+            .vlen       = (_is_var_len) ? 1 : 0,                                               \
+            .vloc       = BLE_GATTS_VLOC_STACK                                                 \
+        }                                                                                      \
+    }
+
+/**@brief Macro for describing a characteristic with a CCCD, with its value in the stack.
+ *
+ * @details The parameters are the ones of @ref BLE_SRV_GATT_CHAR, with in addition
+ *          @p _cccd_write_access, the @ref security_req_t level for writing the CCCD.
+ */
+#define BLE_SRV_GATT_CHAR_CCCD(_type, _field, _uuid, _read_access, _write_access,              \
+                               _cccd_write_access, _max_len, _is_var_len, ...)                 \
+    {                                                                                          \
+        .uuid           = (_uuid),                                                             \
+        .max_len        = (_max_len),                                                          \
+        .init_len       = (_is_var_len) ? 0 : (_max_len),                                      \
+        .handles_offset = (uint16_t)offsetof(_type, _field),                                   \
+        .char_md        =                                                                      \
+        {                                                                                      \
+            .char_props = { __VA_ARGS__ },                                                     \
+            .p_cccd_md  = BLE_SRV_GATT_CCCD_MD(_cccd_write_access)                             \
+        },                                                                                     \
+        .attr_md        =                                                                      \
+        {                                                                                      \
+            .read_perm  = BLE_SRV_GATT_SEC_MODE(_read_access),                                 \
+            .write_perm = BLE_SRV_GATT_SEC_MODE(_write_access),                                \
+            .vlen       = (_is_var_len) ? 1 : 0,                                               \
+            .vloc       = BLE_GATTS_VLOC_STACK                                                 \
+        }                                                                                      \
+    }
+
+/**@brief Macro for defining a primary service and the table of its characteristics.
+ *
+ * @param[in] _name                  Name of the @ref ble_srv_gatt_service_t constant.
+ * @param[in] _type                  Type of the service instance structure.
+ * @param[in] _uuid                  16-bit service UUID.
+ * @param[in] _uuid_type_offset      @ref BLE_SRV_GATT_UUID_TYPE_SIG, or
+ *                                   @ref BLE_SRV_GATT_UUID_TYPE_FIELD for a vendor specific UUID.
+ * @param[in] _service_handle_field  Field of type uint16_t receiving the service handle.
+ * @param[in] ...                    Characteristics, in the order in which they are added, given
+ *                                   with @ref BLE_SRV_GATT_CHAR or @ref BLE_SRV_GATT_CHAR_CCCD.
+ */
+#define BLE_SRV_GATT_SERVICE_DEF(_name, _type, _uuid, _uuid_type_offset,                       \
+                                 _service_handle_field, ...)                                   \
+    static ble_srv_gatt_char_t const _name ## _chars[] = { __VA_ARGS__ };                      \
+    static ble_srv_gatt_service_t const _name =                                                \
+    {                                                                                          \
+        .uuid                  = (_uuid),                                                      \
+        .uuid_type_offset      = (_uuid_type_offset),                                          \
+        .service_handle_offset = (uint16_t)offsetof(_type, _service_handle_field),             \
+        .p_chars               = _name ## _chars,                                              \
+        .char_count            = ARRAY_SIZE(_name ## _chars)                                   \
+    }
+
+/**@brief Characteristic of a table-driven service definition. */
+typedef struct
+{
+    uint16_t            uuid;           /**< Characteristic UUID (16 bits), using the UUID type of the service. */
+    uint16_t            max_len;        /**< Maximum length of the characteristic value. */
+    uint16_t            init_len;       /**< Initial length of the characteristic value. The value is zeroed if there is no initial value. */
+    uint8_t           * p_init_value;   /**< Initial encoded value of the characteristic, or NULL. */
+    uint16_t            handles_offset; /**< Offset of the @ref ble_gatts_char_handles_t in the service instance structure. */
+    ble_gatts_char_md_t char_md;        /**< Precomputed characteristic metadata. */
+    ble_gatts_attr_md_t attr_md;        /**< Precomputed metadata of the characteristic value. */
+} ble_srv_gatt_char_t;
+
+/**@brief Table-driven service definition. */
+typedef struct
+{
+    uint16_t                    uuid;                  /**< Service UUID (16 bits). */
+    uint16_t                    uuid_type_offset;      /**< Offset of the vendor specific UUID type in the service instance structure, or @ref BLE_SRV_GATT_UUID_TYPE_SIG. */
+    uint16_t                    service_handle_offset; /**< Offset of the service handle in the service instance structure. */
+    ble_srv_gatt_char_t const * p_chars;               /**< Characteristics of the service. */
+    uint8_t                     char_count;            /**< Number of characteristics. */
+} ble_srv_gatt_service_t;
+
+/**@brief Service to be added by @ref ble_srv_gatt_table_add. */
+typedef struct
+{
+    ble_srv_gatt_service_t const * p_service;  /**< Service definition. */
+    void                         * p_instance; /**< Service instance structure receiving the handles. */
+} ble_srv_gatt_table_entry_t;
+
+
+/**@brief Function for adding a primary service from its table-driven definition.
+ *
+ * @param[in]  p_service   Service definition.
+ * @param[out] p_instance  Service instance structure. The UUID type must already be set in it
+ *                         for a vendor specific service. The handles are written to it.
+ *
+ * @retval NRF_SUCCESS    If the service was added successfully.
+ * @retval NRF_ERROR_NULL If any of the given pointers is NULL.
+ * @return Otherwise, an error code from the SoftDevice is returned.
+ */
+uint32_t ble_srv_gatt_service_add(ble_srv_gatt_service_t const * p_service, void * p_instance);
+
+
+/**@brief Function for adding several services from their table-driven definitions in one pass.
+ *
+ * @param[in]  p_table  Services to be added, in order.
+ * @param[in]  count    Number of services.
+ *
+ * @retval NRF_SUCCESS    If all services were added successfully.
+ * @retval NRF_ERROR_NULL If any of the given pointers is NULL.
+ * @return Otherwise, the error code for the first service that could not be added is returned.
+ */
+uint32_t ble_srv_gatt_table_add(ble_srv_gatt_table_entry_t const * p_table, uint8_t count);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_SRV_GATT_TABLE_H__
+
+/** @} */
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(BLE_UUID_CACHE)
+#include "ble_uuid_cache.h"
+
+#include <string.h>
+#include "app_util_platform.h"
+#include "nrf_sdh.h"
+
+#define UUID16_SIZE     2   /**< Size of 16 bit UUID. */
+#define UUID128_SIZE    16  /**< Size of 128 bit UUID. */
+
+/**@brief Encoded vendor specific UUID. */
+typedef struct
+{
+    ble_uuid_t uuid;                   /**< Type and 16 bit value, type BLE_UUID_TYPE_UNKNOWN if the entry is free. */
+    uint8_t    uuid_le[UUID128_SIZE];  /**< Encoded UUID. */
+} uuid_cache_entry_t;
+
+static uuid_cache_entry_t m_entries[BLE_UUID_CACHE_SIZE];
+static uint8_t            m_next; /**< Entry replaced next. */
+
+
+/**@brief Function for finding a UUID and copying its encoding.
+ *
+ * @return True if the UUID was found.
+ */
+static bool entry_get(ble_uuid_t const * p_uuid, uint8_t * p_uuid_le)
+{
+    bool found = false;
+
+    CRITICAL_REGION_ENTER();
+    for (uint32_t i = 0; i < BLE_UUID_CACHE_SIZE; i++)
+    {
+        if (   (m_entries[i].uuid.type == p_uuid->type)
+            && (m_entries[i].uuid.uuid == p_uuid->uuid))
+        {
+            if (p_uuid_le != NULL)
+            {
+                memcpy(p_uuid_le, m_entries[i].uuid_le, UUID128_SIZE);
+            }
+            found = true;
+            break;
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    return found;
+}
+
+
+/**@brief Function for adding an encoded UUID, in place of the oldest entry. */
+static void entry_put(ble_uuid_t const * p_uuid, uint8_t const * p_uuid_le)
+{
+    CRITICAL_REGION_ENTER();
+    m_entries[m_next].uuid = *p_uuid;
+    memcpy(m_entries[m_next].uuid_le, p_uuid_le, UUID128_SIZE);
+    m_next = (m_next + 1) % BLE_UUID_CACHE_SIZE;
+    CRITICAL_REGION_EXIT();
+}
+
+
+ret_code_t ble_uuid_cache_encode(ble_uuid_t const * p_uuid, uint8_t * p_uuid_le_len, uint8_t * p_uuid_le)
+{
+    VERIFY_PARAM_NOT_NULL(p_uuid);
+    VERIFY_PARAM_NOT_NULL(p_uuid_le_len);
+
+    if (p_uuid->type == BLE_UUID_TYPE_BLE)
+    {
+        if (p_uuid_le != NULL)
+        {
+            UNUSED_RETURN_VALUE(uint16_encode(p_uuid->uuid, p_uuid_le));
+        }
+        *p_uuid_le_len = UUID16_SIZE;
+        return NRF_SUCCESS;
+    }
+
+    if ((p_uuid->type >= BLE_UUID_TYPE_VENDOR_BEGIN) && entry_get(p_uuid, p_uuid_le))
+    {
+        *p_uuid_le_len = UUID128_SIZE;
+        return NRF_SUCCESS;
+    }
+
+    uint8_t    uuid_le[UUID128_SIZE];
+    uint8_t    uuid_le_len;
+    ret_code_t err_code = sd_ble_uuid_encode(p_uuid, &uuid_le_len, uuid_le);
+    VERIFY_SUCCESS(err_code);
+
+    if ((p_uuid->type >= BLE_UUID_TYPE_VENDOR_BEGIN) && (uuid_le_len == UUID128_SIZE))
+    {
+        entry_put(p_uuid, uuid_le);
+    }
+    if (p_uuid_le != NULL)
+    {
+        memcpy(p_uuid_le, uuid_le, uuid_le_len);
+    }
+    *p_uuid_le_len = uuid_le_len;
+    return NRF_SUCCESS;
+}
+
+
+void ble_uuid_cache_clear(void)
+{
+    CRITICAL_REGION_ENTER();
+    for (uint32_t i = 0; i < BLE_UUID_CACHE_SIZE; i++)
+    {
+        m_entries[i].uuid.type = BLE_UUID_TYPE_UNKNOWN;
+    }
+    m_next = 0;
+    CRITICAL_REGION_EXIT();
+}
+
+
+/**@brief Function for clearing the cache when the SoftDevice is disabled. */
+static void sdh_state_evt_handler(nrf_sdh_state_evt_t state, void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if (state == NRF_SDH_EVT_STATE_DISABLED)
+    {
+        ble_uuid_cache_clear();
+    }
+}
+
+NRF_SDH_STATE_OBSERVER(m_ble_uuid_cache_state_observer, BLE_UUID_CACHE_STATE_OBSERVER_PRIO) =
+{
+    .handler   = sdh_state_evt_handler,
+    .p_context = NULL,
+};
+
+#endif // NRF_MODULE_ENABLED(BLE_UUID_CACHE)
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * @file
+ *
+ * @defgroup ble_uuid_cache Encoded UUID cache
+ * @ingroup ble_sdk_lib
+ * @{
+ * @brief Encoding of UUIDs without a SoftDevice call after the first use.
+ *
+ * @details @ref ble_uuid_cache_encode has the same contract as sd_ble_uuid_encode(). Bluetooth
+ *          SIG UUIDs are encoded directly. Vendor specific UUIDs are encoded by the SoftDevice
+ *          the first time and kept, keyed by type and 16 bit value, so encoding the advertising
+ *          data again does not call the SoftDevice. When the cache is full, the oldest entry is
+ *          replaced.
+ *
+ *          The cache is cleared when the SoftDevice is disabled, as vendor specific types are
+ *          assigned again after it is enabled. Call @ref ble_uuid_cache_clear after removing a
+ *          base UUID with sd_ble_uuid_vs_remove().
+ */
+
+#ifndef BLE_UUID_CACHE_H__
+#define BLE_UUID_CACHE_H__
+
+#include <stdint.h>
+#include "ble.h"
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for encoding a UUID, as sd_ble_uuid_encode().
+ *
+ * @param[in]  p_uuid        UUID to encode.
+ * @param[out] p_uuid_le_len Length of the encoded UUID, 2 or 16.
+ * @param[out] p_uuid_le     Encoded UUID in little endian, or NULL to only get the length.
+ *
+ * @retval NRF_SUCCESS   If the UUID was encoded.
+ * @retval err_code      Otherwise, the error returned by sd_ble_uuid_encode().
+ */
+ret_code_t ble_uuid_cache_encode(ble_uuid_t const * p_uuid, uint8_t * p_uuid_le_len, uint8_t * p_uuid_le);
+
+/**@brief Function for removing all entries from the cache. */
+void ble_uuid_cache_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLE_UUID_CACHE_H__
+
+/** @} */
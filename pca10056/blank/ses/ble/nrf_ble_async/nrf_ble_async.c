@@ -0,0 +1,487 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_ASYNC)
+#include "nrf_ble_async.h"
+#include <string.h>
+#include "app_util_platform.h"
+
+#define NRF_LOG_MODULE_NAME nrf_ble_async
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+
+/**@brief Function for adding an operation to the pending list of an instance. */
+static void op_link(nrf_ble_async_t * p_async, nrf_ble_async_op_t * p_op)
+{
+    p_op->p_next = NULL;
+
+    CRITICAL_REGION_ENTER();
+    if (p_async->p_tail == NULL)
+    {
+        p_async->p_head = p_op;
+    }
+    else
+    {
+        p_async->p_tail->p_next = p_op;
+    }
+    p_async->p_tail = p_op;
+    CRITICAL_REGION_EXIT();
+}
+
+
+/**@brief Function for removing an operation from the pending list of its instance.
+ *
+ * @return True if the operation was pending, false if it had already been completed.
+ */
+static bool op_unlink(nrf_ble_async_op_t * p_op)
+{
+    nrf_ble_async_t    * p_async = p_op->p_async;
+    nrf_ble_async_op_t * p_prev  = NULL;
+    nrf_ble_async_op_t * p_cur;
+
+    CRITICAL_REGION_ENTER();
+    for (p_cur = p_async->p_head; (p_cur != NULL) && (p_cur != p_op); p_cur = p_cur->p_next)
+    {
+        p_prev = p_cur;
+    }
+
+    if (p_cur != NULL)
+    {
+        if (p_prev == NULL)
+        {
+            p_async->p_head = p_op->p_next;
+        }
+        else
+        {
+            p_prev->p_next = p_op->p_next;
+        }
+        if (p_async->p_tail == p_op)
+        {
+            p_async->p_tail = p_prev;
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    return (p_cur != NULL);
+}
+
+
+/**@brief Function for finding the oldest pending operation matching a response.
+ *
+ * @param[in] p_async     Instance.
+ * @param[in] type        Type of operation.
+ * @param[in] conn_handle Connection handle.
+ * @param[in] handle      Attribute handle.
+ *
+ * @return Matching operation, or NULL if there is none.
+ */
+static nrf_ble_async_op_t * op_find(nrf_ble_async_t const * p_async,
+                                    nrf_ble_async_op_type_t type,
+                                    uint16_t                conn_handle,
+                                    uint16_t                handle)
+{
+    nrf_ble_async_op_t * p_op;
+
+    for (p_op = p_async->p_head; p_op != NULL; p_op = p_op->p_next)
+    {
+        if (   (p_op->type == type)
+            && (p_op->conn_handle == conn_handle)
+            && (p_op->handle == handle))
+        {
+            break;
+        }
+    }
+
+    return p_op;
+}
+
+
+/**@brief Function for completing an operation that was removed from the pending list. */
+static void op_complete(nrf_ble_async_op_t * p_op, ret_code_t err_code)
+{
+    NRF_LOG_DEBUG("Operation 0x%08x on link 0x%x completed: %d",
+                  (uint32_t)p_op, p_op->conn_handle, err_code);
+
+    nrf_async_op_end(p_op->p_task, err_code);
+}
+
+
+/**@brief Function for handling errors of the GATT queue for a request added by this module. */
+static void gatt_error_handler(uint32_t nrf_error, void * p_ctx, uint16_t conn_handle)
+{
+    nrf_ble_async_op_t * p_op = (nrf_ble_async_op_t *)p_ctx;
+
+    UNUSED_PARAMETER(conn_handle);
+
+    if (op_unlink(p_op))
+    {
+        op_complete(p_op, nrf_error);
+    }
+}
+
+
+/**@brief Function for starting an operation.
+ *
+ * @details Counts the operation as pending in the task and adds it to the pending list. If
+ *          @p p_req is not NULL, the request is added to the GATT queue.
+ */
+static void op_start(nrf_ble_async_t    * p_async,
+                     nrf_async_task_t   * p_task,
+                     nrf_ble_async_op_t * p_op,
+                     uint16_t             conn_handle,
+                     nrf_ble_gq_req_t   * p_req)
+{
+    ret_code_t err_code;
+
+    p_op->p_async     = p_async;
+    p_op->p_task      = p_task;
+    p_op->conn_handle = conn_handle;
+    p_op->gatt_status = BLE_GATT_STATUS_SUCCESS;
+
+    nrf_async_op_begin(p_task);
+    op_link(p_async, p_op);
+
+    if (p_req == NULL)
+    {
+        return;
+    }
+
+    p_req->error_handler.cb    = gatt_error_handler;
+    p_req->error_handler.p_ctx = p_op;
+
+    err_code = nrf_ble_gq_item_add(p_async->p_gatt_queue, p_req, conn_handle);
+    if ((err_code != NRF_SUCCESS) && op_unlink(p_op))
+    {
+        op_complete(p_op, err_code);
+    }
+}
+
+
+/**@brief Function for completing the operations of a link.
+ *
+ * @param[in] p_async        Instance.
+ * @param[in] conn_handle    Connection handle.
+ * @param[in] discovery_only True to complete only the discovery operations.
+ * @param[in] err_code       Result of the operations.
+ */
+static void link_ops_complete(nrf_ble_async_t * p_async,
+                              uint16_t          conn_handle,
+                              bool              discovery_only,
+                              ret_code_t        err_code)
+{
+    nrf_ble_async_op_t * p_op = p_async->p_head;
+
+    while (p_op != NULL)
+    {
+        nrf_ble_async_op_t * p_next = p_op->p_next;
+
+        if (   (p_op->conn_handle == conn_handle)
+            && (!discovery_only || (p_op->type == NRF_BLE_ASYNC_OP_DISCOVERY))
+            && op_unlink(p_op))
+        {
+            op_complete(p_op, err_code);
+        }
+        p_op = p_next;
+    }
+}
+
+
+/**@brief Function for taking the operation matching a read or write response off the pending list.
+ *
+ * @param[in] p_async     Instance.
+ * @param[in] p_ble_evt   Response event.
+ * @param[in] type        Type of operation.
+ * @param[in] handle      Attribute handle of the response.
+ *
+ * @return Operation, with the GATT status of the response, or NULL if it was not requested by
+ *         this module.
+ */
+static nrf_ble_async_op_t * rsp_op_get(nrf_ble_async_t         * p_async,
+                                       ble_evt_t         const * p_ble_evt,
+                                       nrf_ble_async_op_type_t   type,
+                                       uint16_t                  handle)
+{
+    ble_gattc_evt_t const * p_gattc_evt = &p_ble_evt->evt.gattc_evt;
+    nrf_ble_async_op_t    * p_op;
+
+    if (p_gattc_evt->gatt_status != BLE_GATT_STATUS_SUCCESS)
+    {
+        handle = p_gattc_evt->error_handle;
+    }
+
+    p_op = op_find(p_async, type, p_gattc_evt->conn_handle, handle);
+    if ((p_op == NULL) || !op_unlink(p_op))
+    {
+        // Response to a request of another module.
+        return NULL;
+    }
+
+    p_op->gatt_status = p_gattc_evt->gatt_status;
+    return p_op;
+}
+
+
+/**@brief Function for handling the BLE_GATTC_EVT_READ_RSP event. */
+static void on_read_rsp(nrf_ble_async_t * p_async, ble_evt_t const * p_ble_evt)
+{
+    ble_gattc_evt_read_rsp_t const * p_rsp = &p_ble_evt->evt.gattc_evt.params.read_rsp;
+    nrf_ble_async_op_t             * p_op;
+
+    p_op = rsp_op_get(p_async, p_ble_evt, NRF_BLE_ASYNC_OP_READ, p_rsp->handle);
+    if (p_op == NULL)
+    {
+        return;
+    }
+
+    if (p_op->gatt_status != BLE_GATT_STATUS_SUCCESS)
+    {
+        op_complete(p_op, NRF_BLE_ASYNC_ERROR_GATT_STATUS);
+        return;
+    }
+
+    p_op->len = MIN(p_rsp->len, p_op->max_len);
+    memcpy(p_op->p_data, p_rsp->data, p_op->len);
+    op_complete(p_op, NRF_SUCCESS);
+}
+
+
+/**@brief Function for handling the BLE_GATTC_EVT_WRITE_RSP event. */
+static void on_write_rsp(nrf_ble_async_t * p_async, ble_evt_t const * p_ble_evt)
+{
+    ble_gattc_evt_write_rsp_t const * p_rsp = &p_ble_evt->evt.gattc_evt.params.write_rsp;
+    nrf_ble_async_op_t              * p_op;
+
+    if (p_rsp->write_op != BLE_GATT_OP_WRITE_REQ)
+    {
+        return;
+    }
+
+    p_op = rsp_op_get(p_async, p_ble_evt, NRF_BLE_ASYNC_OP_WRITE, p_rsp->handle);
+    if (p_op == NULL)
+    {
+        return;
+    }
+
+    op_complete(p_op, (p_op->gatt_status == BLE_GATT_STATUS_SUCCESS) ?
+                      NRF_SUCCESS : NRF_BLE_ASYNC_ERROR_GATT_STATUS);
+}
+
+
+ret_code_t nrf_ble_async_init(nrf_ble_async_t * p_async, nrf_ble_gq_t * p_gatt_queue)
+{
+    VERIFY_PARAM_NOT_NULL(p_async);
+    VERIFY_PARAM_NOT_NULL(p_gatt_queue);
+
+    p_async->p_gatt_queue = p_gatt_queue;
+    p_async->p_head       = NULL;
+    p_async->p_tail       = NULL;
+
+    return NRF_SUCCESS;
+}
+
+
+void nrf_ble_async_read(nrf_ble_async_t    * p_async,
+                        nrf_async_task_t   * p_task,
+                        nrf_ble_async_op_t * p_op,
+                        uint16_t             conn_handle,
+                        uint16_t             handle,
+                        uint8_t            * p_data,
+                        uint16_t             max_len)
+{
+    nrf_ble_gq_req_t req;
+
+    memset(&req, 0, sizeof(req));
+
+    p_op->type    = NRF_BLE_ASYNC_OP_READ;
+    p_op->handle  = handle;
+    p_op->p_data  = p_data;
+    p_op->max_len = max_len;
+    p_op->len     = 0;
+
+    req.type                     = NRF_BLE_GQ_REQ_GATTC_READ;
+    req.params.gattc_read.handle = handle;
+    req.params.gattc_read.offset = 0;
+
+    op_start(p_async, p_task, p_op, conn_handle, &req);
+}
+
+
+void nrf_ble_async_write(nrf_ble_async_t    * p_async,
+                         nrf_async_task_t   * p_task,
+                         nrf_ble_async_op_t * p_op,
+                         uint16_t             conn_handle,
+                         uint16_t             handle,
+                         uint8_t const      * p_data,
+                         uint16_t             len)
+{
+    nrf_ble_gq_req_t req;
+
+    memset(&req, 0, sizeof(req));
+
+    p_op->type   = NRF_BLE_ASYNC_OP_WRITE;
+    p_op->handle = handle;
+
+    req.type                        = NRF_BLE_GQ_REQ_GATTC_WRITE;
+    req.params.gattc_write.write_op = BLE_GATT_OP_WRITE_REQ;
+    req.params.gattc_write.flags    = BLE_GATT_EXEC_WRITE_FLAG_PREPARED_WRITE;
+    req.params.gattc_write.handle   = handle;
+    req.params.gattc_write.offset   = 0;
+    req.params.gattc_write.len      = len;
+    req.params.gattc_write.p_value  = p_data;
+
+    op_start(p_async, p_task, p_op, conn_handle, &req);
+}
+
+
+void nrf_ble_async_cccd_write(nrf_ble_async_t    * p_async,
+                              nrf_async_task_t   * p_task,
+                              nrf_ble_async_op_t * p_op,
+                              uint16_t             conn_handle,
+                              uint16_t             cccd_handle,
+                              uint16_t             value)
+{
+    uint8_t cccd[BLE_CCCD_VALUE_LEN];
+
+    // The GATT queue copies the value, so it can be on the stack.
+    cccd[0] = LSB_16(value);
+    cccd[1] = MSB_16(value);
+
+    nrf_ble_async_write(p_async, p_task, p_op, conn_handle, cccd_handle, cccd, sizeof(cccd));
+}
+
+
+void nrf_ble_async_discovery_wait(nrf_ble_async_t    * p_async,
+                                  nrf_async_task_t   * p_task,
+                                  nrf_ble_async_op_t * p_op,
+                                  uint16_t             conn_handle,
+                                  ble_uuid_t const   * p_srv_uuid,
+                                  ble_gatt_db_srv_t  * p_db)
+{
+    p_op->type     = NRF_BLE_ASYNC_OP_DISCOVERY;
+    p_op->handle   = BLE_GATT_HANDLE_INVALID;
+    p_op->srv_uuid = *p_srv_uuid;
+    p_op->p_db     = p_db;
+
+    op_start(p_async, p_task, p_op, conn_handle, NULL);
+}
+
+
+void nrf_ble_async_on_db_disc_evt(nrf_ble_async_t * p_async, ble_db_discovery_evt_t const * p_evt)
+{
+    nrf_ble_async_op_t * p_op;
+    ble_uuid_t const   * p_uuid;
+    ret_code_t           err_code;
+
+    switch (p_evt->evt_type)
+    {
+        case BLE_DB_DISCOVERY_COMPLETE:
+            p_uuid   = &p_evt->params.discovered_db.srv_uuid;
+            err_code = NRF_SUCCESS;
+            break;
+
+        case BLE_DB_DISCOVERY_SRV_NOT_FOUND:
+            p_uuid   = &p_evt->params.discovered_db.srv_uuid;
+            err_code = NRF_ERROR_NOT_FOUND;
+            break;
+
+        case BLE_DB_DISCOVERY_ERROR:
+            // The discovery of the link was aborted, which ends the wait for every service.
+            link_ops_complete(p_async, p_evt->conn_handle, true, p_evt->params.err_code);
+            return;
+
+        default:
+            return;
+    }
+
+    for (p_op = p_async->p_head; p_op != NULL; p_op = p_op->p_next)
+    {
+        if (   (p_op->type == NRF_BLE_ASYNC_OP_DISCOVERY)
+            && (p_op->conn_handle == p_evt->conn_handle)
+            && (p_op->srv_uuid.type == p_uuid->type)
+            && (p_op->srv_uuid.uuid == p_uuid->uuid))
+        {
+            break;
+        }
+    }
+
+    if ((p_op == NULL) || !op_unlink(p_op))
+    {
+        return;
+    }
+
+    if ((err_code == NRF_SUCCESS) && (p_op->p_db != NULL))
+    {
+        *p_op->p_db = p_evt->params.discovered_db;
+    }
+    op_complete(p_op, err_code);
+}
+
+
+void nrf_ble_async_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    nrf_ble_async_t * p_async = (nrf_ble_async_t *)p_context;
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GATTC_EVT_READ_RSP:
+            on_read_rsp(p_async, p_ble_evt);
+            break;
+
+        case BLE_GATTC_EVT_WRITE_RSP:
+            on_write_rsp(p_async, p_ble_evt);
+            break;
+
+        case BLE_GATTC_EVT_TIMEOUT:
+            link_ops_complete(p_async, p_ble_evt->evt.gattc_evt.conn_handle, false,
+                              NRF_ERROR_TIMEOUT);
+            break;
+
+        case BLE_GAP_EVT_DISCONNECTED:
+            link_ops_complete(p_async, p_ble_evt->evt.gap_evt.conn_handle, false,
+                              BLE_ERROR_INVALID_CONN_HANDLE);
+            break;
+
+        default:
+            break;
+    }
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BLE_ASYNC)
@@ -0,0 +1,259 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ble_async GATT client operations for cooperative tasks
+ * @{
+ * @ingroup ble_sdk_lib
+ * @brief Module for awaiting GATT client requests and service discovery in @ref nrf_async tasks.
+ *
+ * @details Each operation is described by a @ref nrf_ble_async_op_t owned by the task, usually
+ *          in its state structure. Reads and writes are added to @ref nrf_ble_gq, and the
+ *          operation completes when the response with the same connection and attribute handle
+ *          is received. A discovery operation completes on the @ref ble_db_discovery event of
+ *          its service. Operations on different links run in parallel. Operations on one link
+ *          are sent by the GATT queue back to back, without a round trip through the
+ *          application between them.
+ *
+ *          An operation that fails completes with the error of the GATT queue or the SoftDevice.
+ *          If the peer responds with an error, the operation completes with
+ *          @ref NRF_BLE_ASYNC_ERROR_GATT_STATUS, and the status is in
+ *          @ref nrf_ble_async_op_t::gatt_status. All operations of a link complete with
+ *          BLE_ERROR_INVALID_CONN_HANDLE when it disconnects, and with NRF_ERROR_TIMEOUT on a
+ *          GATT client timeout.
+ *
+ *          Example of a task reading two characteristics at the same time:
+ *          @code
+ *          NRF_ASYNC_BEGIN(p_task);
+ *          nrf_ble_async_read(&m_async, p_task, &p_ctx->op_a, conn_handle, handle_a,
+ *                             p_ctx->value_a, sizeof(p_ctx->value_a));
+ *          nrf_ble_async_read(&m_async, p_task, &p_ctx->op_b, conn_handle, handle_b,
+ *                             p_ctx->value_b, sizeof(p_ctx->value_b));
+ *          NRF_ASYNC_AWAIT_ALL(p_task, p_ctx->err_code);
+ *          NRF_ASYNC_END(p_task);
+ *          @endcode
+ *
+ * @note    The application must register this module as BLE event observer, which is done by
+ *          @ref NRF_BLE_ASYNC_DEF, and forward the events of @ref ble_db_discovery with
+ *          @ref nrf_ble_async_on_db_disc_evt. Do not enable coalescing of
+ *          @ref NRF_BLE_GQ_REQ_GATTC_WRITE requests in the GATT queue, as a merged write has only
+ *          one response. Reads longer than one ATT_MTU are not supported.
+ */
+
+#ifndef NRF_BLE_ASYNC_H__
+#define NRF_BLE_ASYNC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_common.h"
+#include "ble.h"
+#include "ble_gatt_db.h"
+#include "ble_db_discovery.h"
+#include "nrf_ble_gq.h"
+#include "nrf_sdh_ble.h"
+#include "nrf_async.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief   Macro for defining a nrf_ble_async instance.
+ *
+ * @param   _name   Name of the instance.
+ * @hideinitializer
+ */
+#define NRF_BLE_ASYNC_DEF(_name)                          \
+    static nrf_ble_async_t _name;                         \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                   \
+                         NRF_BLE_ASYNC_BLE_OBSERVER_PRIO, \
+                         nrf_ble_async_on_ble_evt,        \
+                         &_name)
+
+#define NRF_BLE_ASYNC_ERROR_GATT_STATUS NRF_ERROR_FORBIDDEN //!< Operation result if the peer responded with an error.
+
+/**@brief Type of an operation. */
+typedef enum
+{
+    NRF_BLE_ASYNC_OP_READ,      //!< Read of a characteristic value or descriptor.
+    NRF_BLE_ASYNC_OP_WRITE,     //!< Write request to a characteristic value or descriptor.
+    NRF_BLE_ASYNC_OP_DISCOVERY, //!< Discovery of a service by @ref ble_db_discovery.
+} nrf_ble_async_op_type_t;
+
+typedef struct nrf_ble_async_s    nrf_ble_async_t;
+typedef struct nrf_ble_async_op_s nrf_ble_async_op_t;
+
+/**@brief Operation structure. Must not be changed while the operation is pending. */
+struct nrf_ble_async_op_s
+{
+    nrf_ble_async_op_t      * p_next;      //!< Next pending operation of the instance.
+    nrf_ble_async_t         * p_async;     //!< Instance the operation is pending in.
+    nrf_async_task_t        * p_task;      //!< Task waiting for the operation.
+    nrf_ble_async_op_type_t   type;        //!< Type of operation.
+    uint16_t                  conn_handle; //!< Connection handle.
+    uint16_t                  handle;      //!< Attribute handle, for reads and writes.
+    ble_uuid_t                srv_uuid;    //!< Service UUID, for discoveries.
+    uint16_t                  gatt_status; //!< GATT status of the response, BLE_GATT_STATUS_SUCCESS if none was received.
+    uint8_t                 * p_data;      //!< Buffer for the read value.
+    uint16_t                  max_len;     //!< Size of @ref nrf_ble_async_op_t::p_data.
+    uint16_t                  len;         //!< Length of the read value.
+    ble_gatt_db_srv_t       * p_db;        //!< Buffer for the discovered service, or NULL.
+};
+
+/**@brief Instance structure. */
+struct nrf_ble_async_s
+{
+    nrf_ble_gq_t       * p_gatt_queue; //!< GATT queue the requests are added to.
+    nrf_ble_async_op_t * p_head;       //!< Oldest pending operation.
+    nrf_ble_async_op_t * p_tail;       //!< Newest pending operation.
+};
+
+
+/**@brief Function for initializing an instance.
+ *
+ * @param[out] p_async      Instance.
+ * @param[in]  p_gatt_queue GATT queue used to send the requests. The links must be registered
+ *                          with it by the application.
+ *
+ * @retval NRF_SUCCESS    If the instance was initialized.
+ * @retval NRF_ERROR_NULL If any of the parameters is NULL.
+ */
+ret_code_t nrf_ble_async_init(nrf_ble_async_t * p_async, nrf_ble_gq_t * p_gatt_queue);
+
+
+/**@brief Function for reading an attribute value as an operation of a task.
+ *
+ * @param[in]  p_async     Instance.
+ * @param[in]  p_task      Task being run.
+ * @param[out] p_op        Operation structure.
+ * @param[in]  conn_handle Connection handle.
+ * @param[in]  handle      Attribute handle.
+ * @param[out] p_data      Buffer for the value. The length is in @ref nrf_ble_async_op_t::len.
+ * @param[in]  max_len     Size of @p p_data. A longer value is truncated.
+ */
+void nrf_ble_async_read(nrf_ble_async_t    * p_async,
+                        nrf_async_task_t   * p_task,
+                        nrf_ble_async_op_t * p_op,
+                        uint16_t             conn_handle,
+                        uint16_t             handle,
+                        uint8_t            * p_data,
+                        uint16_t             max_len);
+
+
+/**@brief Function for writing an attribute value with a write request as an operation of a task.
+ *
+ * @param[in]  p_async     Instance.
+ * @param[in]  p_task      Task being run.
+ * @param[out] p_op        Operation structure.
+ * @param[in]  conn_handle Connection handle.
+ * @param[in]  handle      Attribute handle.
+ * @param[in]  p_data      Value, which is copied by the GATT queue.
+ * @param[in]  len         Length of the value.
+ */
+void nrf_ble_async_write(nrf_ble_async_t    * p_async,
+                         nrf_async_task_t   * p_task,
+                         nrf_ble_async_op_t * p_op,
+                         uint16_t             conn_handle,
+                         uint16_t             handle,
+                         uint8_t const      * p_data,
+                         uint16_t             len);
+
+
+/**@brief Function for writing a Client Characteristic Configuration descriptor as an operation of
+ *        a task.
+ *
+ * @param[in]  p_async     Instance.
+ * @param[in]  p_task      Task being run.
+ * @param[out] p_op        Operation structure.
+ * @param[in]  conn_handle Connection handle.
+ * @param[in]  cccd_handle Handle of the descriptor.
+ * @param[in]  value       BLE_GATT_HVX_NOTIFICATION, BLE_GATT_HVX_INDICATION or 0.
+ */
+void nrf_ble_async_cccd_write(nrf_ble_async_t    * p_async,
+                              nrf_async_task_t   * p_task,
+                              nrf_ble_async_op_t * p_op,
+                              uint16_t             conn_handle,
+                              uint16_t             cccd_handle,
+                              uint16_t             value);
+
+
+/**@brief Function for waiting for the discovery of a service as an operation of a task.
+ *
+ * @details The discovery is started by the application with @ref ble_db_discovery_start, which
+ *          discovers all registered services. The operation completes with NRF_ERROR_NOT_FOUND if
+ *          the peer does not have the service.
+ *
+ * @param[in]  p_async     Instance.
+ * @param[in]  p_task      Task being run.
+ * @param[out] p_op        Operation structure.
+ * @param[in]  conn_handle Connection handle.
+ * @param[in]  p_srv_uuid  UUID of the service, registered with @ref ble_db_discovery_evt_register.
+ * @param[out] p_db        Buffer for the discovered service, or NULL.
+ */
+void nrf_ble_async_discovery_wait(nrf_ble_async_t    * p_async,
+                                  nrf_async_task_t   * p_task,
+                                  nrf_ble_async_op_t * p_op,
+                                  uint16_t             conn_handle,
+                                  ble_uuid_t const   * p_srv_uuid,
+                                  ble_gatt_db_srv_t  * p_db);
+
+
+/**@brief Function for handling the events of the database discovery module.
+ *
+ * @param[in] p_async Instance.
+ * @param[in] p_evt   Event received from @ref ble_db_discovery.
+ */
+void nrf_ble_async_on_db_disc_evt(nrf_ble_async_t * p_async, ble_db_discovery_evt_t const * p_evt);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+ *
+ * @param[in] p_ble_evt Event received from the BLE stack.
+ * @param[in] p_context Instance.
+ */
+void nrf_ble_async_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BLE_ASYNC_H__
+
+/** @} */
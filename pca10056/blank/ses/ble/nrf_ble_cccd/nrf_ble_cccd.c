@@ -0,0 +1,639 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_CCCD)
+#include "nrf_ble_cccd.h"
+#include "ble.h"
+#include "ble_gattc.h"
+#include "ble_srv_common.h"
+
+#define NRF_LOG_MODULE_NAME nrf_ble_cccd
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+
+/**@brief Function for forwarding SoftDevice errors to the application.
+ *
+ * @param[in] nrf_error    Error code returned by SoftDevice.
+ * @param[in] p_cccd       CCCD configuration structure.
+ */
+static void error_forward(uint32_t nrf_error, nrf_ble_cccd_t const * p_cccd)
+{
+    if (p_cccd->error_handler != NULL)
+    {
+        p_cccd->error_handler(nrf_error);
+    }
+}
+
+
+/**@brief Function for clearing the CCCD values and going back to collecting them.
+ *
+ * @param[in] p_cccd  CCCD configuration structure.
+ */
+static void entries_reset(nrf_ble_cccd_t * p_cccd)
+{
+    p_cccd->state       = NRF_BLE_CCCD_STATE_IDLE;
+    p_cccd->count       = 0;
+    p_cccd->rsp_idx     = 0;
+    p_cccd->error_count = 0;
+}
+
+
+/**@brief Function for reporting the result of a CCCD write to the application.
+ *
+ * @param[in] p_cccd       CCCD configuration structure.
+ * @param[in] idx          Index of the entry.
+ * @param[in] gatt_status  GATT status of the write.
+ */
+static void write_rsp_report(nrf_ble_cccd_t * p_cccd, uint8_t idx, uint16_t gatt_status)
+{
+    nrf_ble_cccd_evt_t evt;
+
+    if (gatt_status != BLE_GATT_STATUS_SUCCESS)
+    {
+        NRF_LOG_DEBUG("CCCD 0x%04X write failed: 0x%04X.", p_cccd->entries[idx].cccd_handle, gatt_status);
+        p_cccd->error_count++;
+    }
+
+    if (p_cccd->evt_handler != NULL)
+    {
+        memset(&evt, 0, sizeof(evt));
+        evt.evt_type                     = NRF_BLE_CCCD_EVT_WRITE_RSP;
+        evt.conn_handle                  = p_cccd->conn_handle;
+        evt.params.write_rsp.cccd_handle = p_cccd->entries[idx].cccd_handle;
+        evt.params.write_rsp.value       = p_cccd->entries[idx].value;
+        evt.params.write_rsp.gatt_status = gatt_status;
+
+        p_cccd->evt_handler(p_cccd, &evt);
+    }
+}
+
+
+/**@brief Function for reporting that all CCCD writes were answered.
+ *
+ * @param[in] p_cccd    CCCD configuration structure.
+ * @param[in] prepared  True if the CCCDs were written with one prepared write sequence.
+ */
+static void done_report(nrf_ble_cccd_t * p_cccd, bool prepared)
+{
+    nrf_ble_cccd_evt_t evt;
+
+    memset(&evt, 0, sizeof(evt));
+    evt.evt_type                = NRF_BLE_CCCD_EVT_DONE;
+    evt.conn_handle             = p_cccd->conn_handle;
+    evt.params.done.count       = p_cccd->count;
+    evt.params.done.error_count = p_cccd->error_count;
+    evt.params.done.prepared    = prepared;
+
+    entries_reset(p_cccd);
+
+    if (p_cccd->evt_handler != NULL)
+    {
+        p_cccd->evt_handler(p_cccd, &evt);
+    }
+}
+
+
+/**@brief Function for queuing one write to the peer.
+ *
+ * @param[in] p_cccd    CCCD configuration structure.
+ * @param[in] write_op  Write operation, see @ref BLE_GATT_WRITE_OPS.
+ * @param[in] flags     Execute write flags, see @ref BLE_GATT_EXEC_WRITE_FLAGS.
+ * @param[in] p_entry   CCCD value to be written. NULL for an execute write.
+ * @param[in] error_cb  Handler for errors from the SoftDevice.
+ *
+ * @return    Error code from @ref nrf_ble_gq_item_add.
+ */
+static ret_code_t write_queue(nrf_ble_cccd_t             * p_cccd,
+                              uint8_t                      write_op,
+                              uint8_t                      flags,
+                              nrf_ble_cccd_entry_t const * p_entry,
+                              nrf_ble_gq_req_error_cb_t    error_cb)
+{
+    nrf_ble_gq_req_t cccd_req;
+    uint8_t          cccd[BLE_CCCD_VALUE_LEN];
+
+    memset(&cccd_req, 0, sizeof(cccd_req));
+
+    cccd_req.type                        = NRF_BLE_GQ_REQ_GATTC_WRITE;
+    cccd_req.error_handler.cb            = error_cb;
+    cccd_req.error_handler.p_ctx         = p_cccd;
+    cccd_req.params.gattc_write.write_op = write_op;
+    cccd_req.params.gattc_write.flags    = flags;
+    cccd_req.params.gattc_write.offset   = 0;
+
+    if (p_entry != NULL)
+    {
+        cccd[0] = LSB_16(p_entry->value);
+        cccd[1] = MSB_16(p_entry->value);
+
+        cccd_req.params.gattc_write.handle  = p_entry->cccd_handle;
+        cccd_req.params.gattc_write.len     = BLE_CCCD_VALUE_LEN;
+        cccd_req.params.gattc_write.p_value = cccd;
+    }
+
+    return nrf_ble_gq_item_add(p_cccd->p_gatt_queue, &cccd_req, p_cccd->conn_handle);
+}
+
+
+static void write_error_handler(uint32_t nrf_error, void * p_ctx, uint16_t conn_handle);
+static void prepare_error_handler(uint32_t nrf_error, void * p_ctx, uint16_t conn_handle);
+static void exec_error_handler(uint32_t nrf_error, void * p_ctx, uint16_t conn_handle);
+
+
+/**@brief Function for error handling of requests whose failure does not change the state.
+ */
+static void gatt_error_handler(uint32_t nrf_error, void * p_ctx, uint16_t conn_handle)
+{
+    UNUSED_PARAMETER(conn_handle);
+
+    error_forward(nrf_error, (nrf_ble_cccd_t const *)p_ctx);
+}
+
+
+/**@brief Function for queuing the writes of all CCCD values.
+ *
+ * @details Queuing stops at the first write that cannot be queued. The callers then drop the
+ *          following values, so that the @ref NRF_BLE_CCCD_EVT_DONE event covers the queued
+ *          ones only.
+ *
+ * @param[in]  p_cccd      CCCD configuration structure.
+ * @param[in]  write_op    @ref BLE_GATT_OP_WRITE_REQ or @ref BLE_GATT_OP_PREP_WRITE_REQ.
+ * @param[out] p_err_code  Error code from @ref nrf_ble_gq_item_add for the first write that
+ *                         could not be queued, NRF_SUCCESS otherwise.
+ *
+ * @return    Number of queued writes.
+ */
+static uint8_t entries_queue(nrf_ble_cccd_t * p_cccd, uint8_t write_op, ret_code_t * p_err_code)
+{
+    nrf_ble_gq_req_error_cb_t const error_cb = (write_op == BLE_GATT_OP_WRITE_REQ) ?
+                                               write_error_handler : prepare_error_handler;
+    uint8_t const count = p_cccd->count;
+
+    p_cccd->rsp_idx     = 0;
+    p_cccd->error_count = 0;
+    *p_err_code         = NRF_SUCCESS;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        *p_err_code = write_queue(p_cccd, write_op, 0, &p_cccd->entries[i], error_cb);
+        if (*p_err_code != NRF_SUCCESS)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+
+/**@brief Function for falling back to writing the CCCD values one by one.
+ *
+ * @param[in] p_cccd  CCCD configuration structure.
+ */
+static void single_writes_start(nrf_ble_cccd_t * p_cccd)
+{
+    ret_code_t err_code;
+    uint8_t    queued;
+
+    p_cccd->state = NRF_BLE_CCCD_STATE_WRITE;
+
+    queued = entries_queue(p_cccd, BLE_GATT_OP_WRITE_REQ, &err_code);
+    if (err_code != NRF_SUCCESS)
+    {
+        error_forward(err_code, p_cccd);
+
+        p_cccd->count = queued;
+        if (p_cccd->rsp_idx >= p_cccd->count)
+        {
+            done_report(p_cccd, false);
+        }
+    }
+}
+
+
+/**@brief Function for continuing once every prepared write has been answered.
+ *
+ * @param[in] p_cccd  CCCD configuration structure.
+ */
+static void prepare_check(nrf_ble_cccd_t * p_cccd)
+{
+    ret_code_t err_code;
+    bool       all_prepared = true;
+    bool       any_prepared = false;
+
+    if (p_cccd->rsp_idx < p_cccd->count)
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < p_cccd->count; i++)
+    {
+        if (p_cccd->entries[i].gatt_status == BLE_GATT_STATUS_SUCCESS)
+        {
+            any_prepared = true;
+        }
+        else
+        {
+            all_prepared = false;
+        }
+    }
+
+    if (all_prepared)
+    {
+        p_cccd->state = NRF_BLE_CCCD_STATE_EXECUTE;
+
+        err_code = write_queue(p_cccd,
+                               BLE_GATT_OP_EXEC_WRITE_REQ,
+                               BLE_GATT_EXEC_WRITE_FLAG_PREPARED_WRITE,
+                               NULL,
+                               exec_error_handler);
+        if (err_code == NRF_SUCCESS)
+        {
+            return;
+        }
+
+        error_forward(err_code, p_cccd);
+    }
+    else
+    {
+        NRF_LOG_DEBUG("Prepared CCCD writes rejected, writing them one by one.");
+
+        p_cccd->prepared_write_rejected = true;
+
+        if (any_prepared)
+        {
+            // Drop the values that the peer has queued.
+            err_code = write_queue(p_cccd,
+                                   BLE_GATT_OP_EXEC_WRITE_REQ,
+                                   BLE_GATT_EXEC_WRITE_FLAG_PREPARED_CANCEL,
+                                   NULL,
+                                   gatt_error_handler);
+            if (err_code != NRF_SUCCESS)
+            {
+                error_forward(err_code, p_cccd);
+            }
+        }
+    }
+
+    single_writes_start(p_cccd);
+}
+
+
+/**@brief Function for handling the response to the execute write.
+ *
+ * @param[in] p_cccd       CCCD configuration structure.
+ * @param[in] gatt_status  GATT status of the execute write.
+ */
+static void exec_rsp_handle(nrf_ble_cccd_t * p_cccd, uint16_t gatt_status)
+{
+    if (gatt_status != BLE_GATT_STATUS_SUCCESS)
+    {
+        NRF_LOG_DEBUG("Execute write failed: 0x%04X, writing CCCDs one by one.", gatt_status);
+
+        // The peer has discarded the prepared values.
+        p_cccd->prepared_write_rejected = true;
+        single_writes_start(p_cccd);
+        return;
+    }
+
+    for (uint8_t i = 0; i < p_cccd->count; i++)
+    {
+        write_rsp_report(p_cccd, i, BLE_GATT_STATUS_SUCCESS);
+    }
+
+    done_report(p_cccd, true);
+}
+
+
+/**@brief Function for recording the result of the single write that is answered next.
+ *
+ * @param[in] p_cccd       CCCD configuration structure.
+ * @param[in] gatt_status  GATT status of the write.
+ */
+static void write_rsp_handle(nrf_ble_cccd_t * p_cccd, uint16_t gatt_status)
+{
+    write_rsp_report(p_cccd, p_cccd->rsp_idx, gatt_status);
+
+    p_cccd->rsp_idx++;
+    if (p_cccd->rsp_idx >= p_cccd->count)
+    {
+        done_report(p_cccd, false);
+    }
+}
+
+
+/**@brief Function for error handling of queued single writes.
+ *
+ * @details The BLE GATT Queue issues the requests of a link in order, so the failed request is
+ *          the one whose response is expected next.
+ */
+static void write_error_handler(uint32_t nrf_error, void * p_ctx, uint16_t conn_handle)
+{
+    nrf_ble_cccd_t * p_cccd = (nrf_ble_cccd_t *)p_ctx;
+
+    UNUSED_PARAMETER(conn_handle);
+    error_forward(nrf_error, p_cccd);
+
+    if ((p_cccd->state == NRF_BLE_CCCD_STATE_WRITE) && (p_cccd->rsp_idx < p_cccd->count))
+    {
+        write_rsp_handle(p_cccd, BLE_GATT_STATUS_UNKNOWN);
+    }
+}
+
+
+/**@brief Function for error handling of queued prepared writes.
+ */
+static void prepare_error_handler(uint32_t nrf_error, void * p_ctx, uint16_t conn_handle)
+{
+    nrf_ble_cccd_t * p_cccd = (nrf_ble_cccd_t *)p_ctx;
+
+    UNUSED_PARAMETER(conn_handle);
+    error_forward(nrf_error, p_cccd);
+
+    if ((p_cccd->state == NRF_BLE_CCCD_STATE_PREPARE) && (p_cccd->rsp_idx < p_cccd->count))
+    {
+        p_cccd->entries[p_cccd->rsp_idx++].gatt_status = BLE_GATT_STATUS_UNKNOWN;
+        prepare_check(p_cccd);
+    }
+}
+
+
+/**@brief Function for error handling of the queued execute write.
+ */
+static void exec_error_handler(uint32_t nrf_error, void * p_ctx, uint16_t conn_handle)
+{
+    nrf_ble_cccd_t * p_cccd = (nrf_ble_cccd_t *)p_ctx;
+
+    UNUSED_PARAMETER(conn_handle);
+    error_forward(nrf_error, p_cccd);
+
+    if (p_cccd->state == NRF_BLE_CCCD_STATE_EXECUTE)
+    {
+        exec_rsp_handle(p_cccd, BLE_GATT_STATUS_UNKNOWN);
+    }
+}
+
+
+/**@brief Function for checking whether a write response relates to the expected CCCD.
+ *
+ * @param[in] p_cccd        CCCD configuration structure.
+ * @param[in] p_gattc_evt   GATTC event with the write response.
+ */
+static bool rsp_is_expected(nrf_ble_cccd_t const * p_cccd, ble_gattc_evt_t const * p_gattc_evt)
+{
+    if (p_cccd->rsp_idx >= p_cccd->count)
+    {
+        return false;
+    }
+
+    uint16_t const cccd_handle = p_cccd->entries[p_cccd->rsp_idx].cccd_handle;
+
+    return (p_gattc_evt->params.write_rsp.handle == cccd_handle) ||
+           ((p_gattc_evt->gatt_status != BLE_GATT_STATUS_SUCCESS) &&
+            (p_gattc_evt->error_handle == cccd_handle));
+}
+
+
+/**@brief Function for handling the Write Response event.
+ *
+ * @param[in] p_cccd     CCCD configuration structure.
+ * @param[in] p_ble_evt  Event received from the BLE stack.
+ */
+static void on_write_rsp(nrf_ble_cccd_t * p_cccd, ble_evt_t const * p_ble_evt)
+{
+    ble_gattc_evt_t const * p_gattc_evt = &p_ble_evt->evt.gattc_evt;
+    uint8_t const           write_op    = p_gattc_evt->params.write_rsp.write_op;
+
+    if (p_gattc_evt->conn_handle != p_cccd->conn_handle)
+    {
+        return;
+    }
+
+    switch (p_cccd->state)
+    {
+        case NRF_BLE_CCCD_STATE_PREPARE:
+            if ((write_op == BLE_GATT_OP_PREP_WRITE_REQ) && rsp_is_expected(p_cccd, p_gattc_evt))
+            {
+                p_cccd->entries[p_cccd->rsp_idx++].gatt_status = p_gattc_evt->gatt_status;
+                prepare_check(p_cccd);
+            }
+            break;
+
+        case NRF_BLE_CCCD_STATE_EXECUTE:
+            if (write_op == BLE_GATT_OP_EXEC_WRITE_REQ)
+            {
+                exec_rsp_handle(p_cccd, p_gattc_evt->gatt_status);
+            }
+            break;
+
+        case NRF_BLE_CCCD_STATE_WRITE:
+            if ((write_op == BLE_GATT_OP_WRITE_REQ) && rsp_is_expected(p_cccd, p_gattc_evt))
+            {
+                write_rsp_handle(p_cccd, p_gattc_evt->gatt_status);
+            }
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+
+ret_code_t nrf_ble_cccd_init(nrf_ble_cccd_t            * p_cccd,
+                             nrf_ble_cccd_init_t const * p_cccd_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_cccd);
+    VERIFY_PARAM_NOT_NULL(p_cccd_init);
+    VERIFY_PARAM_NOT_NULL(p_cccd_init->p_gatt_queue);
+
+    p_cccd->conn_handle             = BLE_CONN_HANDLE_INVALID;
+    p_cccd->p_gatt_queue            = p_cccd_init->p_gatt_queue;
+    p_cccd->evt_handler             = p_cccd_init->evt_handler;
+    p_cccd->error_handler           = p_cccd_init->error_handler;
+    p_cccd->prepared_write          = p_cccd_init->prepared_write;
+    p_cccd->prepared_write_rejected = false;
+
+    entries_reset(p_cccd);
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_ble_cccd_conn_handle_assign(nrf_ble_cccd_t * p_cccd, uint16_t conn_handle)
+{
+    VERIFY_PARAM_NOT_NULL(p_cccd);
+
+    p_cccd->conn_handle             = conn_handle;
+    p_cccd->prepared_write_rejected = false;
+
+    entries_reset(p_cccd);
+
+    return nrf_ble_gq_conn_handle_register(p_cccd->p_gatt_queue, conn_handle);
+}
+
+
+ret_code_t nrf_ble_cccd_add(nrf_ble_cccd_t * p_cccd, uint16_t cccd_handle, uint16_t value)
+{
+    VERIFY_PARAM_NOT_NULL(p_cccd);
+    VERIFY_TRUE(cccd_handle != BLE_GATT_HANDLE_INVALID, NRF_ERROR_INVALID_PARAM);
+
+    if ((p_cccd->conn_handle == BLE_CONN_HANDLE_INVALID) ||
+        (p_cccd->state != NRF_BLE_CCCD_STATE_IDLE))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    for (uint8_t i = 0; i < p_cccd->count; i++)
+    {
+        if (p_cccd->entries[i].cccd_handle == cccd_handle)
+        {
+            p_cccd->entries[i].value = value;
+            return NRF_SUCCESS;
+        }
+    }
+
+    if (p_cccd->count >= NRF_BLE_CCCD_MAX_ENTRIES)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    p_cccd->entries[p_cccd->count].cccd_handle = cccd_handle;
+    p_cccd->entries[p_cccd->count].value       = value;
+    p_cccd->entries[p_cccd->count].gatt_status = BLE_GATT_STATUS_SUCCESS;
+    p_cccd->count++;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_ble_cccd_flush(nrf_ble_cccd_t * p_cccd)
+{
+    ret_code_t err_code;
+    uint8_t    queued;
+    bool       prepare;
+
+    VERIFY_PARAM_NOT_NULL(p_cccd);
+
+    if ((p_cccd->conn_handle == BLE_CONN_HANDLE_INVALID) ||
+        (p_cccd->state != NRF_BLE_CCCD_STATE_IDLE)       ||
+        (p_cccd->count == 0))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    // A single value gains nothing from a prepared write sequence.
+    prepare = p_cccd->prepared_write && !p_cccd->prepared_write_rejected && (p_cccd->count > 1);
+
+    NRF_LOG_DEBUG("Writing %d CCCDs on connection 0x%04X.", p_cccd->count, p_cccd->conn_handle);
+
+    p_cccd->state = prepare ? NRF_BLE_CCCD_STATE_PREPARE : NRF_BLE_CCCD_STATE_WRITE;
+
+    queued = entries_queue(p_cccd,
+                           prepare ? BLE_GATT_OP_PREP_WRITE_REQ : BLE_GATT_OP_WRITE_REQ,
+                           &err_code);
+    if (err_code == NRF_SUCCESS)
+    {
+        return NRF_SUCCESS;
+    }
+
+    if (queued == 0)
+    {
+        // Nothing was queued, so keep the values for another attempt.
+        p_cccd->state       = NRF_BLE_CCCD_STATE_IDLE;
+        p_cccd->rsp_idx     = 0;
+        p_cccd->error_count = 0;
+        return err_code;
+    }
+
+    p_cccd->count = queued;
+    if (p_cccd->rsp_idx >= p_cccd->count)
+    {
+        // Every queued request has already failed.
+        if (prepare)
+        {
+            prepare_check(p_cccd);
+        }
+        else
+        {
+            done_report(p_cccd, false);
+        }
+    }
+
+    return err_code;
+}
+
+
+void nrf_ble_cccd_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    nrf_ble_cccd_t * p_cccd = (nrf_ble_cccd_t *)p_context;
+
+    if ((p_cccd == NULL) || (p_ble_evt == NULL))
+    {
+        return;
+    }
+
+    if (p_cccd->conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GATTC_EVT_WRITE_RSP:
+            on_write_rsp(p_cccd, p_ble_evt);
+            break;
+
+        case BLE_GAP_EVT_DISCONNECTED:
+            if (p_ble_evt->evt.gap_evt.conn_handle == p_cccd->conn_handle)
+            {
+                p_cccd->conn_handle = BLE_CONN_HANDLE_INVALID;
+                entries_reset(p_cccd);
+            }
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BLE_CCCD)
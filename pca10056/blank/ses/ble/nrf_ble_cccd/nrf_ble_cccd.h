@@ -0,0 +1,266 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ble_cccd CCCD configuration module
+ * @{
+ * @ingroup ble_sdk_lib
+ * @brief Module for writing the CCCDs of a peer back-to-back after service discovery.
+ *
+ * @details Client modules each write their own CCCD as a separate request. This module instead
+ *          collects the CCCD values that are wanted on a link with @ref nrf_ble_cccd_add, and
+ *          sends all of them with @ref nrf_ble_cccd_flush through the BLE GATT Queue, without
+ *          waiting for the application between the writes.
+ *
+ *          If @ref nrf_ble_cccd_init_t::prepared_write is set, the values are first sent as one
+ *          prepared write sequence followed by a single execute write. If the peer rejects any of
+ *          the prepared writes or the execute write, the sequence is cancelled and the values
+ *          are written one by one instead. Prepared writes are then no longer tried on that link.
+ *
+ *          The result of every CCCD write is reported with an @ref NRF_BLE_CCCD_EVT_WRITE_RSP
+ *          event, followed by an @ref NRF_BLE_CCCD_EVT_DONE event when all of them are answered.
+ *
+ * @note    The application must register this module as BLE event observer using the
+ *          NRF_SDH_BLE_OBSERVER macro. Example:
+ *          @code
+ *              nrf_ble_cccd_t instance;
+ *              NRF_SDH_BLE_OBSERVER(anything, NRF_BLE_CCCD_BLE_OBSERVER_PRIO,
+ *                                   nrf_ble_cccd_on_ble_evt, &instance);
+ *          @endcode
+ */
+
+#ifndef NRF_BLE_CCCD_H__
+#define NRF_BLE_CCCD_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_common.h"
+#include "ble.h"
+#include "ble_srv_common.h"
+#include "nrf_ble_gq.h"
+#include "nrf_sdh_ble.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief   Macro for defining a nrf_ble_cccd instance.
+ *
+ * @param   _name   Name of the instance.
+ * @hideinitializer
+ */
+#define NRF_BLE_CCCD_DEF(_name)                          \
+    static nrf_ble_cccd_t _name;                         \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                  \
+                         NRF_BLE_CCCD_BLE_OBSERVER_PRIO, \
+                         nrf_ble_cccd_on_ble_evt,        \
+                         &_name)
+
+/**@brief   Macro for defining an array of nrf_ble_cccd instances.
+ *
+ * @param   _name   Name of the array.
+ * @param   _cnt    Size of the array.
+ * @hideinitializer
+ */
+#define NRF_BLE_CCCDS_DEF(_name, _cnt)                    \
+    static nrf_ble_cccd_t _name[_cnt];                    \
+    NRF_SDH_BLE_OBSERVERS(_name ## _obs,                  \
+                          NRF_BLE_CCCD_BLE_OBSERVER_PRIO, \
+                          nrf_ble_cccd_on_ble_evt,        \
+                          &_name,                         \
+                          _cnt)
+
+
+/**@brief CCCD configuration module event types. */
+typedef enum
+{
+    NRF_BLE_CCCD_EVT_WRITE_RSP, //!< Event that indicates that a CCCD write was answered. See @ref nrf_ble_cccd_evt_t::params::write_rsp.
+    NRF_BLE_CCCD_EVT_DONE,      //!< Event that indicates that all CCCD writes of the last @ref nrf_ble_cccd_flush were answered. See @ref nrf_ble_cccd_evt_t::params::done.
+} nrf_ble_cccd_evt_type_t;
+
+/**@brief CCCD configuration module events. */
+typedef struct
+{
+    nrf_ble_cccd_evt_type_t evt_type;    //!< Type of the event.
+    uint16_t                conn_handle; //!< Connection handle on which the event occurred.
+    union
+    {
+        struct
+        {
+            uint16_t cccd_handle; //!< Handle of the CCCD.
+            uint16_t value;       //!< Value that was written to the CCCD.
+            uint16_t gatt_status; //!< GATT status of the write, see @ref BLE_GATT_STATUS_CODES.
+        } write_rsp;              //!< Parameters of @ref NRF_BLE_CCCD_EVT_WRITE_RSP.
+        struct
+        {
+            uint8_t count;        //!< Number of CCCDs that were written.
+            uint8_t error_count;  //!< Number of CCCD writes that failed.
+            bool    prepared;     //!< True if the CCCDs were written with one prepared write sequence.
+        } done;                   //!< Parameters of @ref NRF_BLE_CCCD_EVT_DONE.
+    } params;
+} nrf_ble_cccd_evt_t;
+
+// Forward declaration of the nrf_ble_cccd_t type.
+typedef struct nrf_ble_cccd_s nrf_ble_cccd_t;
+
+/**@brief CCCD configuration module event handler type. */
+typedef void (* nrf_ble_cccd_evt_handler_t)(nrf_ble_cccd_t * p_cccd, nrf_ble_cccd_evt_t const * p_evt);
+
+/**@brief State of the CCCD writes on the link. */
+typedef enum
+{
+    NRF_BLE_CCCD_STATE_IDLE,     //!< Collecting CCCD values.
+    NRF_BLE_CCCD_STATE_PREPARE,  //!< Waiting for the responses to the prepared writes.
+    NRF_BLE_CCCD_STATE_EXECUTE,  //!< Waiting for the response to the execute write.
+    NRF_BLE_CCCD_STATE_WRITE,    //!< Waiting for the responses to the single writes.
+} nrf_ble_cccd_state_t;
+
+/**@brief CCCD value to be written. */
+typedef struct
+{
+    uint16_t cccd_handle; //!< Handle of the CCCD.
+    uint16_t value;       //!< Value to be written.
+    uint16_t gatt_status; //!< GATT status of the prepared write.
+} nrf_ble_cccd_entry_t;
+
+/**@brief CCCD configuration structure.
+ * @details This structure contains status information for the CCCD configuration module. */
+struct nrf_ble_cccd_s
+{
+    uint16_t                   conn_handle;                           //!< Connection handle.
+    nrf_ble_gq_t             * p_gatt_queue;                          //!< Pointer to BLE GATT Queue instance.
+    nrf_ble_cccd_evt_handler_t evt_handler;                           //!< Event handler.
+    ble_srv_error_handler_t    error_handler;                         //!< Error handler.
+    bool                       prepared_write;                        //!< Flag that indicates whether a prepared write sequence is tried.
+    bool                       prepared_write_rejected;               //!< Flag that indicates whether the peer on the link rejected a prepared write sequence.
+    nrf_ble_cccd_state_t       state;                                 //!< State of the CCCD writes.
+    nrf_ble_cccd_entry_t       entries[NRF_BLE_CCCD_MAX_ENTRIES];     //!< CCCD values to be written.
+    uint8_t                    count;                                 //!< Number of CCCD values to be written.
+    uint8_t                    rsp_idx;                               //!< Index of the entry whose response is expected next.
+    uint8_t                    error_count;                           //!< Number of CCCD writes that failed.
+};
+
+/**@brief CCCD configuration init structure. */
+typedef struct
+{
+    nrf_ble_gq_t             * p_gatt_queue;  //!< Pointer to BLE GATT Queue instance.
+    nrf_ble_cccd_evt_handler_t evt_handler;   //!< Event handler.
+    ble_srv_error_handler_t    error_handler; //!< Error handler.
+    bool                       prepared_write; //!< Try to write all CCCDs with one prepared write sequence.
+} nrf_ble_cccd_init_t;
+
+
+/**@brief Function for initializing the CCCD configuration module.
+ *
+ * @param[out] p_cccd      CCCD configuration structure. This structure must be supplied by the
+ *                         application.
+ * @param[in]  p_cccd_init Initialization structure.
+ *
+ * @retval NRF_SUCCESS    If the module was initialized successfully.
+ * @retval NRF_ERROR_NULL If any of the given pointers is NULL.
+ */
+ret_code_t nrf_ble_cccd_init(nrf_ble_cccd_t            * p_cccd,
+                             nrf_ble_cccd_init_t const * p_cccd_init);
+
+
+/**@brief Function for assigning a connection handle to a given instance of the module.
+ *
+ * @details Call this function when a link with a peer has been established. Any CCCD values
+ *          that were collected for a previous link are discarded.
+ *
+ * @param[in]  p_cccd      CCCD configuration structure.
+ * @param[in]  conn_handle Connection handle to be associated with the given instance.
+ *
+ * @retval NRF_SUCCESS    If the assignment was successful.
+ * @retval NRF_ERROR_NULL If any of the given pointers is NULL.
+ * @return Otherwise, an error code from @ref nrf_ble_gq_conn_handle_register is returned.
+ */
+ret_code_t nrf_ble_cccd_conn_handle_assign(nrf_ble_cccd_t * p_cccd, uint16_t conn_handle);
+
+
+/**@brief Function for adding a CCCD value to be written by the next @ref nrf_ble_cccd_flush.
+ *
+ * @details Adding a CCCD that was already added replaces its value.
+ *
+ * @param[in]  p_cccd      CCCD configuration structure.
+ * @param[in]  cccd_handle Handle of the CCCD on the peer, as found by the discovery.
+ * @param[in]  value       Value to be written, for example @ref BLE_GATT_HVX_NOTIFICATION.
+ *
+ * @retval NRF_SUCCESS             If the value was added.
+ * @retval NRF_ERROR_NULL          If any of the given pointers is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If the CCCD handle is invalid.
+ * @retval NRF_ERROR_INVALID_STATE If no link is assigned, or a flush is in progress.
+ * @retval NRF_ERROR_NO_MEM        If @ref NRF_BLE_CCCD_MAX_ENTRIES values were already added.
+ */
+ret_code_t nrf_ble_cccd_add(nrf_ble_cccd_t * p_cccd, uint16_t cccd_handle, uint16_t value);
+
+
+/**@brief Function for writing all added CCCD values to the peer.
+ *
+ * @details The writes are queued in the BLE GATT Queue in one go. The added values are cleared
+ *          once the @ref NRF_BLE_CCCD_EVT_DONE event has been generated.
+ *
+ * @param[in]  p_cccd CCCD configuration structure.
+ *
+ * @retval NRF_SUCCESS             If the writes were queued.
+ * @retval NRF_ERROR_NULL          If any of the given pointers is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If no link is assigned, no value was added, or a flush is
+ *                                 already in progress.
+ * @return Otherwise, an error code from @ref nrf_ble_gq_item_add is returned. The writes that
+ *         were queued before the error are still reported.
+ */
+ret_code_t nrf_ble_cccd_flush(nrf_ble_cccd_t * p_cccd);
+
+
+/**@brief Function for handling BLE stack events.
+ *
+ * @param[in] p_ble_evt Event received from the BLE stack.
+ * @param[in] p_context CCCD configuration structure.
+ */
+void nrf_ble_cccd_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BLE_CCCD_H__
+
+/** @} */
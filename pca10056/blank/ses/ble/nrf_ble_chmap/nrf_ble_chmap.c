@@ -0,0 +1,323 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_CHMAP)
+#include "nrf_ble_chmap.h"
+#include <string.h>
+
+#define NRF_LOG_MODULE_NAME nrf_ble_chmap
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define ENERGY_FRAC_BITS    4   /**< Fractional bits of the average channel energy. */
+#define ENERGY_AVG_WEIGHT   8   /**< Inverse weight of a new report in the average channel energy. */
+
+
+/**@brief Function for checking whether a channel is in a channel map.
+ *
+ * @param[in] p_map    Channel map.
+ * @param[in] channel  Index of the data channel.
+ *
+ * @return Whether the channel is used.
+ */
+static bool channel_is_used(uint8_t const * p_map, uint32_t channel)
+{
+    return (p_map[channel / 8] & (1 << (channel % 8))) != 0;
+}
+
+
+/**@brief Function for setting the channel map on a central link.
+ *
+ * @details Used with @ref ble_conn_state_for_each_set_user_flag. The flag of the link is cleared
+ *          unless the SoftDevice is busy with a previous channel map update.
+ *
+ * @param[in] conn_handle Handle of the connection.
+ * @param[in] p_context   Adaptive channel map structure.
+ */
+static void link_map_set(uint16_t conn_handle, void * p_context)
+{
+    nrf_ble_chmap_t * p_chmap = (nrf_ble_chmap_t *)p_context;
+    ble_opt_t         opt;
+    ret_code_t        err_code;
+
+    memset(&opt, 0, sizeof(opt));
+    opt.gap_opt.ch_map.conn_handle = conn_handle;
+    memcpy(opt.gap_opt.ch_map.ch_map, p_chmap->ch_map, NRF_BLE_CHMAP_LEN);
+
+    err_code = sd_ble_opt_set(BLE_GAP_OPT_CH_MAP, &opt);
+    if (err_code == NRF_ERROR_BUSY)
+    {
+        // Retried with the next survey report.
+        return;
+    }
+
+    ble_conn_state_user_flag_set(conn_handle, p_chmap->flag_id, false);
+
+    if (err_code == NRF_SUCCESS)
+    {
+#if (BLE_CONN_STATE_STATS_ENABLED == 1)
+        ble_conn_state_stats_ch_map_set(conn_handle, p_chmap->ch_map);
+#endif
+    }
+    else if ((err_code != BLE_ERROR_INVALID_CONN_HANDLE) && (p_chmap->error_handler != NULL))
+    {
+        // The link may have been disconnected since the flag was set.
+        p_chmap->error_handler(err_code);
+    }
+}
+
+
+/**@brief Function for choosing the channels of the map from their average energy.
+ *
+ * @details If the map changed, every central link is flagged to receive it.
+ *
+ * @param[in,out] p_chmap Adaptive channel map structure.
+ */
+static void map_update(nrf_ble_chmap_t * p_chmap)
+{
+    int32_t const threshold = p_chmap->busy_threshold * (1 << ENERGY_FRAC_BITS);
+    uint8_t       map[NRF_BLE_CHMAP_LEN];
+    uint32_t      count = 0;
+
+    memset(map, 0, sizeof(map));
+
+    for (uint32_t ch = 0; ch < NRF_BLE_CHMAP_DATA_CHANNELS; ch++)
+    {
+        nrf_ble_chmap_channel_t * p_channel = &p_chmap->channel[ch];
+
+        if (p_channel->hold > 0)
+        {
+            p_channel->hold--;
+            continue;
+        }
+
+        if (p_channel->measured && (p_channel->energy_acc > threshold))
+        {
+            p_channel->hold = p_chmap->reprobe_updates;
+            continue;
+        }
+
+        map[ch / 8] |= (1 << (ch % 8));
+        count++;
+    }
+
+    // Keep the quietest of the removed channels if too few are free.
+    while (count < p_chmap->min_channels)
+    {
+        uint32_t quietest = NRF_BLE_CHMAP_DATA_CHANNELS;
+
+        for (uint32_t ch = 0; ch < NRF_BLE_CHMAP_DATA_CHANNELS; ch++)
+        {
+            if (!channel_is_used(map, ch) &&
+                ((quietest == NRF_BLE_CHMAP_DATA_CHANNELS) ||
+                 (p_chmap->channel[ch].energy_acc < p_chmap->channel[quietest].energy_acc)))
+            {
+                quietest = ch;
+            }
+        }
+
+        map[quietest / 8] |= (1 << (quietest % 8));
+        count++;
+    }
+
+    if (memcmp(map, p_chmap->ch_map, sizeof(map)) != 0)
+    {
+        ble_conn_state_conn_handle_list_t centrals = ble_conn_state_central_handles();
+
+        NRF_LOG_INFO("Channel map of %d channels", count);
+
+        memcpy(p_chmap->ch_map, map, sizeof(map));
+
+        for (uint32_t i = 0; i < centrals.len; i++)
+        {
+            ble_conn_state_user_flag_set(centrals.conn_handles[i], p_chmap->flag_id, true);
+        }
+    }
+}
+
+
+/**@brief Function for handling a channel survey report.
+ *
+ * @param[in,out] p_chmap   Adaptive channel map structure.
+ * @param[in]     p_report  Energy measured on each channel.
+ */
+static void on_survey_report(nrf_ble_chmap_t                               * p_chmap,
+                             ble_gap_evt_qos_channel_survey_report_t const * p_report)
+{
+    for (uint32_t ch = 0; ch < NRF_BLE_CHMAP_DATA_CHANNELS; ch++)
+    {
+        nrf_ble_chmap_channel_t * p_channel = &p_chmap->channel[ch];
+        int8_t                    energy    = p_report->channel_energy[ch];
+        int32_t                   sample;
+
+        if (energy == BLE_GAP_POWER_LEVEL_INVALID)
+        {
+            continue;
+        }
+
+        sample = energy * (1 << ENERGY_FRAC_BITS);
+
+        if (!p_channel->measured)
+        {
+            p_channel->energy_acc = (int16_t)sample;
+            p_channel->measured   = true;
+        }
+        else
+        {
+            p_channel->energy_acc += (int16_t)((sample - p_channel->energy_acc) / ENERGY_AVG_WEIGHT);
+        }
+    }
+
+    if (++p_chmap->reports >= p_chmap->reports_per_update)
+    {
+        p_chmap->reports = 0;
+        map_update(p_chmap);
+    }
+
+    UNUSED_RETURN_VALUE(ble_conn_state_for_each_set_user_flag(p_chmap->flag_id, link_map_set, p_chmap));
+}
+
+
+/**@brief Function for handling the Connect event.
+ *
+ * @details A new central link uses all channels, and receives the map if it has fewer.
+ *
+ * @param[in,out] p_chmap   Adaptive channel map structure.
+ * @param[in]     p_ble_evt Event received from the BLE stack.
+ */
+static void on_connect(nrf_ble_chmap_t * p_chmap, ble_evt_t const * p_ble_evt)
+{
+    uint16_t conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+    uint8_t  all[NRF_BLE_CHMAP_LEN];
+
+    if (p_ble_evt->evt.gap_evt.params.connected.role != BLE_GAP_ROLE_CENTRAL)
+    {
+        return;
+    }
+
+    memset(all, 0xFF, sizeof(all));
+    all[NRF_BLE_CHMAP_LEN - 1] = 0x1F;
+
+    if (memcmp(all, p_chmap->ch_map, sizeof(all)) != 0)
+    {
+        ble_conn_state_user_flag_set(conn_handle, p_chmap->flag_id, true);
+        link_map_set(conn_handle, p_chmap);
+    }
+}
+
+
+ret_code_t nrf_ble_chmap_init(nrf_ble_chmap_t * p_chmap, nrf_ble_chmap_init_t const * p_init)
+{
+    ret_code_t err_code;
+
+    VERIFY_PARAM_NOT_NULL(p_chmap);
+    VERIFY_PARAM_NOT_NULL(p_init);
+
+    if ((p_init->min_channels < 2)                           ||
+        (p_init->min_channels > NRF_BLE_CHMAP_DATA_CHANNELS) ||
+        (p_init->reports_per_update == 0))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    memset(p_chmap, 0, sizeof(nrf_ble_chmap_t));
+
+    p_chmap->flag_id = ble_conn_state_user_flag_acquire();
+    if (p_chmap->flag_id == BLE_CONN_STATE_USER_FLAG_INVALID)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    memset(p_chmap->ch_map, 0xFF, sizeof(p_chmap->ch_map));
+    p_chmap->ch_map[NRF_BLE_CHMAP_LEN - 1] = 0x1F;
+
+    p_chmap->busy_threshold     = p_init->busy_threshold;
+    p_chmap->min_channels       = p_init->min_channels;
+    p_chmap->reports_per_update = p_init->reports_per_update;
+    p_chmap->reprobe_updates    = p_init->reprobe_updates;
+    p_chmap->error_handler      = p_init->error_handler;
+
+    err_code = sd_ble_gap_qos_channel_survey_start(p_init->survey_interval_us);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("sd_ble_gap_qos_channel_survey_start returned 0x%x", err_code);
+    }
+
+    return err_code;
+}
+
+
+ret_code_t nrf_ble_chmap_get(nrf_ble_chmap_t const * p_chmap, uint8_t * p_map)
+{
+    VERIFY_PARAM_NOT_NULL(p_chmap);
+    VERIFY_PARAM_NOT_NULL(p_map);
+
+    memcpy(p_map, p_chmap->ch_map, NRF_BLE_CHMAP_LEN);
+
+    return NRF_SUCCESS;
+}
+
+
+void nrf_ble_chmap_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    nrf_ble_chmap_t * p_chmap = (nrf_ble_chmap_t *)p_context;
+
+    if (p_chmap->reports_per_update == 0)
+    {
+        // Not initialized.
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_QOS_CHANNEL_SURVEY_REPORT:
+            on_survey_report(p_chmap, &p_ble_evt->evt.gap_evt.params.qos_channel_survey_report);
+            break;
+
+        case BLE_GAP_EVT_CONNECTED:
+            on_connect(p_chmap, p_ble_evt);
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+#endif // NRF_MODULE_ENABLED(NRF_BLE_CHMAP)
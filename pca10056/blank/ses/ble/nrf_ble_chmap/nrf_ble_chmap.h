@@ -0,0 +1,179 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ble_chmap Adaptive channel map
+ * @{
+ * @ingroup ble_sdk_lib
+ * @brief Module for removing congested data channels from the channel map of central links.
+ *
+ * @details The energy on each data channel is measured with the QoS channel survey of the
+ *          SoftDevice, which uses the radio time left free by the connections and scans all
+ *          channels regardless of the channel maps in use. Channels occupied by other 2.4 GHz
+ *          networks, such as Wi-Fi, show a high energy:
+ *          - The energy reports of each channel are averaged.
+ *          - Every @ref nrf_ble_chmap_init_t::reports_per_update reports, channels with an average
+ *            above @ref nrf_ble_chmap_init_t::busy_threshold are removed from the map. A removed
+ *            channel stays out for @ref nrf_ble_chmap_init_t::reprobe_updates updates, and is
+ *            then put back if its energy has dropped.
+ *          - If less than @ref nrf_ble_chmap_init_t::min_channels channels are free, the quietest
+ *            busy channels are kept in the map.
+ *          - A changed map is set on every central link with @ref sd_ble_opt_set, and on each new
+ *            central link. With @ref BLE_CONN_STATE_STATS_ENABLED, the map of each link is
+ *            recorded in its @ref ble_conn_state_stats_t.
+ *
+ *          The SoftDevice does not report the CRC errors of each channel, so the map is based on
+ *          the channel energy only. Peripheral links follow the channel map of their central.
+ *
+ * @note    The application must register this module as BLE event observer, which is done by
+ *          @ref NRF_BLE_CHMAP_DEF. The SoftDevice must be configured with
+ *          @ref ble_gap_cfg_role_count_t::qos_channel_survey_role_available set.
+ */
+
+#ifndef NRF_BLE_CHMAP_H__
+#define NRF_BLE_CHMAP_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ble.h"
+#include "ble_gap.h"
+#include "ble_srv_common.h"
+#include "ble_conn_state.h"
+#include "nrf_sdh_ble.h"
+#include "sdk_config.h"
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_BLE_CHMAP_DATA_CHANNELS 37  /**< Number of data channels. */
+#define NRF_BLE_CHMAP_LEN           5   /**< Length of a channel map, in bytes. */
+
+/**@brief Macro for defining a nrf_ble_chmap instance.
+ *
+ * @param   _name       Name of the instance.
+ * @hideinitializer
+ */
+#define NRF_BLE_CHMAP_DEF(_name)                                                \
+    static nrf_ble_chmap_t _name;                                               \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                                         \
+                         NRF_BLE_CHMAP_BLE_OBSERVER_PRIO,                       \
+                         nrf_ble_chmap_on_ble_evt,                              \
+                         &_name)
+
+/**@brief State of a data channel. */
+typedef struct
+{
+    int16_t energy_acc;  /**< Average energy, in dBm with 4 fractional bits. */
+    bool    measured;    /**< True once the channel has been measured. */
+    uint8_t hold;        /**< Number of updates the channel is still kept out of the map. */
+} nrf_ble_chmap_channel_t;
+
+/**@brief Adaptive channel map init structure. */
+typedef struct
+{
+    uint32_t                survey_interval_us; /**< Interval between two surveys of all channels, in microseconds. 0 to survey continuously. */
+    int8_t                  busy_threshold;     /**< Average energy above which a channel is removed, in dBm. */
+    uint8_t                 min_channels;       /**< Number of channels always kept in the map, 2 to 37. */
+    uint16_t                reports_per_update; /**< Number of survey reports averaged between two updates of the map. */
+    uint8_t                 reprobe_updates;    /**< Number of updates a removed channel stays out of the map. */
+    ble_srv_error_handler_t error_handler;      /**< Function to be called in case of an error. */
+} nrf_ble_chmap_init_t;
+
+/**@brief Adaptive channel map structure. */
+typedef struct
+{
+    nrf_ble_chmap_channel_t       channel[NRF_BLE_CHMAP_DATA_CHANNELS]; /**< State of each data channel. */
+    uint8_t                       ch_map[NRF_BLE_CHMAP_LEN];            /**< Channel map set on the central links. */
+    ble_conn_state_user_flag_id_t flag_id;                              /**< Connection state flag of the central links the map still has to be set on. */
+    uint16_t                      reports;                              /**< Number of survey reports since the last update. */
+    int8_t                        busy_threshold;                       /**< Average energy above which a channel is removed, in dBm. */
+    uint8_t                       min_channels;                         /**< Number of channels always kept in the map. */
+    uint16_t                      reports_per_update;                   /**< Number of survey reports between two updates. */
+    uint8_t                       reprobe_updates;                      /**< Number of updates a removed channel stays out of the map. */
+    ble_srv_error_handler_t       error_handler;                        /**< Function to be called in case of an error. */
+} nrf_ble_chmap_t;
+
+
+/**@brief Function for initializing the adaptive channel map and starting the channel survey.
+ *
+ * @details Must be called after the SoftDevice BLE stack is enabled. The map starts with all
+ *          data channels.
+ *
+ * @param[out] p_chmap Adaptive channel map structure.
+ * @param[in]  p_init  Settings of the adaptive channel map.
+ *
+ * @retval NRF_SUCCESS             If the channel survey was started.
+ * @retval NRF_ERROR_NULL          If any of the parameters is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If the minimum channel count or the number of reports per
+ *                                 update is not valid.
+ * @retval NRF_ERROR_NO_MEM        If no connection state user flag is free.
+ * @return Otherwise, the error code returned by @ref sd_ble_gap_qos_channel_survey_start.
+ */
+ret_code_t nrf_ble_chmap_init(nrf_ble_chmap_t * p_chmap, nrf_ble_chmap_init_t const * p_init);
+
+
+/**@brief Function for getting the current channel map.
+ *
+ * @param[in]  p_chmap Adaptive channel map structure.
+ * @param[out] p_map   Channel map, @ref NRF_BLE_CHMAP_LEN bytes, one bit per data channel.
+ *
+ * @retval NRF_SUCCESS    If the map was copied.
+ * @retval NRF_ERROR_NULL If any of the parameters is NULL.
+ */
+ret_code_t nrf_ble_chmap_get(nrf_ble_chmap_t const * p_chmap, uint8_t * p_map);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+ *
+ * @param[in] p_ble_evt Event received from the BLE stack.
+ * @param[in] p_context Adaptive channel map structure.
+ */
+void nrf_ble_chmap_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BLE_CHMAP_H__
+
+/** @} */
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_CONN_CFG)
+#include "nrf_ble_conn_cfg.h"
+#include <string.h>
+
+#define NRF_LOG_MODULE_NAME nrf_ble_conn_cfg
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+
+/**@brief Function for checking a profile against the profiles before it in the table.
+ *
+ * @param[in] p_profiles Profile table.
+ * @param[in] index      Index of the profile to check.
+ *
+ * @return True if the profile can be set.
+ */
+static bool profile_is_valid(nrf_ble_conn_cfg_profile_t const * p_profiles, uint8_t index)
+{
+    nrf_ble_conn_cfg_profile_t const * p_profile = &p_profiles[index];
+
+    if (   (p_profile->conn_cfg_tag == BLE_CONN_CFG_TAG_DEFAULT)
+        || (p_profile->conn_count == 0)
+        || (p_profile->event_length < BLE_GAP_EVENT_LENGTH_MIN)
+        || ((p_profile->att_mtu != 0) && (p_profile->att_mtu < BLE_GATT_ATT_MTU_DEFAULT)))
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < index; i++)
+    {
+        if (p_profiles[i].conn_cfg_tag == p_profile->conn_cfg_tag)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/**@brief Function for setting the connection configuration of one profile.
+ *
+ * @param[in] p_profile Profile to set.
+ * @param[in] ram_start Start of the application RAM.
+ *
+ * @return Error code returned by @ref sd_ble_cfg_set.
+ */
+static ret_code_t profile_set(nrf_ble_conn_cfg_profile_t const * p_profile, uint32_t ram_start)
+{
+    ret_code_t err_code;
+    ble_cfg_t  ble_cfg;
+
+    memset(&ble_cfg, 0, sizeof(ble_cfg));
+    ble_cfg.conn_cfg.conn_cfg_tag                     = p_profile->conn_cfg_tag;
+    ble_cfg.conn_cfg.params.gap_conn_cfg.conn_count   = p_profile->conn_count;
+    ble_cfg.conn_cfg.params.gap_conn_cfg.event_length = p_profile->event_length;
+
+    err_code = sd_ble_cfg_set(BLE_CONN_CFG_GAP, &ble_cfg, ram_start);
+    VERIFY_SUCCESS(err_code);
+
+    memset(&ble_cfg, 0, sizeof(ble_cfg));
+    ble_cfg.conn_cfg.conn_cfg_tag                 = p_profile->conn_cfg_tag;
+    ble_cfg.conn_cfg.params.gatt_conn_cfg.att_mtu = (p_profile->att_mtu != 0) ? p_profile->att_mtu
+                                                                              : BLE_GATT_ATT_MTU_DEFAULT;
+
+    // Also replaces an ATT MTU set by nrf_sdh_ble_default_cfg_set with the same tag.
+    err_code = sd_ble_cfg_set(BLE_CONN_CFG_GATT, &ble_cfg, ram_start);
+    VERIFY_SUCCESS(err_code);
+
+    if (p_profile->hvn_tx_queue_size != 0)
+    {
+        memset(&ble_cfg, 0, sizeof(ble_cfg));
+        ble_cfg.conn_cfg.conn_cfg_tag                            = p_profile->conn_cfg_tag;
+        ble_cfg.conn_cfg.params.gatts_conn_cfg.hvn_tx_queue_size = p_profile->hvn_tx_queue_size;
+
+        err_code = sd_ble_cfg_set(BLE_CONN_CFG_GATTS, &ble_cfg, ram_start);
+        VERIFY_SUCCESS(err_code);
+    }
+
+    if (p_profile->write_cmd_tx_queue_size != 0)
+    {
+        memset(&ble_cfg, 0, sizeof(ble_cfg));
+        ble_cfg.conn_cfg.conn_cfg_tag                                  = p_profile->conn_cfg_tag;
+        ble_cfg.conn_cfg.params.gattc_conn_cfg.write_cmd_tx_queue_size = p_profile->write_cmd_tx_queue_size;
+
+        err_code = sd_ble_cfg_set(BLE_CONN_CFG_GATTC, &ble_cfg, ram_start);
+        VERIFY_SUCCESS(err_code);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_ble_conn_cfg_set(nrf_ble_conn_cfg_profile_t const * p_profiles,
+                                uint8_t                            profile_count,
+                                uint32_t                           ram_start)
+{
+    ret_code_t err_code;
+    uint32_t   links = 0;
+
+    VERIFY_PARAM_NOT_NULL(p_profiles);
+
+    if (profile_count == 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < profile_count; i++)
+    {
+        if (!profile_is_valid(p_profiles, i))
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+
+        links += p_profiles[i].conn_count;
+    }
+
+    for (uint8_t i = 0; i < profile_count; i++)
+    {
+        err_code = profile_set(&p_profiles[i], ram_start);
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_ERROR("Tag %d not set, error 0x%x.", p_profiles[i].conn_cfg_tag, err_code);
+            return err_code;
+        }
+
+        NRF_LOG_DEBUG("Tag %d: %d links, event length %d units.",
+                      p_profiles[i].conn_cfg_tag,
+                      p_profiles[i].conn_count,
+                      p_profiles[i].event_length);
+    }
+
+    if (links > NRF_SDH_BLE_TOTAL_LINK_COUNT)
+    {
+        // Not an error, but the RAM of the links over the role count is never used.
+        NRF_LOG_WARNING("Profiles allow %d links, only %d can be connected.",
+                        links,
+                        NRF_SDH_BLE_TOTAL_LINK_COUNT);
+    }
+
+    return NRF_SUCCESS;
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BLE_CONN_CFG)
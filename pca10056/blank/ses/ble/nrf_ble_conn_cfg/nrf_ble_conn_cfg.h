@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ble_conn_cfg Connection configuration profiles
+ * @{
+ * @ingroup ble_sdk_lib
+ * @brief Module for sizing the SoftDevice connection configurations by the needs of the links.
+ *
+ * @details @ref nrf_sdh_ble_default_cfg_set gives all links one connection configuration, so
+ *          every link gets the event length, queues and ATT MTU needed by the most demanding one.
+ *          The SoftDevice reserves RAM for each connection a configuration allows, so this RAM
+ *          grows with the link count.
+ *
+ *          This module sets one connection configuration for each profile in a table, for example
+ *          a streaming profile with a long event length and deep queues for one link, and a
+ *          telemetry profile with the smallest buffers for the other links. The connection count of
+ *          each profile limits the links that can use it at a time. The tag of a profile is passed
+ *          when a connection is made:
+ *          - By @ref nrf_ble_scan, with @ref nrf_ble_scan_init_t::conn_cfg_tag_handler, chosen from
+ *            the advertising report of each matched device.
+ *          - By @ref ble_advertising, with @ref ble_advertising_conn_cfg_tag_handler_set, chosen
+ *            each time an advertising mode is started.
+ *
+ *          Connecting fails with NRF_ERROR_CONN_COUNT while all links of the profile are in use.
+ *
+ * @note    @ref nrf_sdh_ble_default_cfg_set must still be called, as it sets the role counts. It
+ *          also sets a connection configuration for @ref NRF_SDH_BLE_TOTAL_LINK_COUNT links with
+ *          the tag it is given. Give it the tag of one of the profiles, which is then replaced by
+ *          @ref nrf_ble_conn_cfg_set, so that no RAM is reserved for it.
+ */
+
+#ifndef NRF_BLE_CONN_CFG_H__
+#define NRF_BLE_CONN_CFG_H__
+
+#include <stdint.h>
+#include "ble.h"
+#include "ble_gap.h"
+#include "sdk_config.h"
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Connection configuration profile. */
+typedef struct
+{
+    uint8_t  conn_cfg_tag;            /**< Tag of the configuration, must not be @ref BLE_CONN_CFG_TAG_DEFAULT. */
+    uint8_t  conn_count;              /**< Number of links that can use the configuration at a time. */
+    uint16_t event_length;            /**< Event length of the links, in 1.25 ms units. */
+    uint16_t att_mtu;                 /**< Largest ATT MTU of the links. 0 to keep @ref BLE_GATT_ATT_MTU_DEFAULT. */
+    uint8_t  hvn_tx_queue_size;       /**< Handle Value Notifications queued per link. 0 to keep the SoftDevice default. */
+    uint8_t  write_cmd_tx_queue_size; /**< Write Without Response requests queued per link. 0 to keep the SoftDevice default. */
+} nrf_ble_conn_cfg_profile_t;
+
+
+/**@brief Function for setting the connection configurations of the profiles.
+ *
+ * @details Must be called after @ref nrf_sdh_ble_default_cfg_set and before
+ *          @ref nrf_sdh_ble_enable. The table is not used after this function returns.
+ *
+ * @param[in] p_profiles    Profiles to set.
+ * @param[in] profile_count Number of elements in @p p_profiles.
+ * @param[in] ram_start     Start of the application RAM.
+ *
+ * @retval NRF_SUCCESS             If all configurations were set.
+ * @retval NRF_ERROR_NULL          If @p p_profiles is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If there is no profile, a tag is the default one or used twice,
+ *                                 a profile has no link, or an event length or ATT MTU is too small.
+ * @return Other error code returned by @ref sd_ble_cfg_set.
+ */
+ret_code_t nrf_ble_conn_cfg_set(nrf_ble_conn_cfg_profile_t const * p_profiles,
+                                uint8_t                            profile_count,
+                                uint32_t                           ram_start);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BLE_CONN_CFG_H__
+
+/** @} */
@@ -0,0 +1,323 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_CONN_PLAN)
+#include "nrf_ble_conn_plan.h"
+#include <string.h>
+#include "ble_conn_state.h"
+
+#define NRF_LOG_MODULE_NAME nrf_ble_conn_plan
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define UNIT_US             1250    /**< Length of a connection interval or event length unit, in microseconds. */
+#define T_IFS_US            150     /**< Inter frame space, in microseconds. */
+#define PDU_OVERHEAD_1M     14      /**< Preamble, access address, header, MIC and CRC on the 1 Mbps PHY, in octets. */
+#define PDU_OVERHEAD_2M     15      /**< Preamble, access address, header, MIC and CRC on the 2 Mbps PHY, in octets. */
+#define ATT_OVERHEAD        7       /**< L2CAP and ATT headers of a notification or write command, in octets. */
+#define DATA_LENGTH_MIN     27      /**< Shortest link layer payload, in octets. */
+#define DATA_LENGTH_MAX     251     /**< Longest link layer payload, in octets. */
+
+
+/**@brief Function for computing the air time of a data PDU.
+ *
+ * @param[in] phy BLE_GAP_PHY_1MBPS or BLE_GAP_PHY_2MBPS.
+ * @param[in] len Payload length, in octets.
+ *
+ * @return Air time, in microseconds.
+ */
+static uint32_t pdu_time_us(uint8_t phy, uint16_t len)
+{
+    return (phy == BLE_GAP_PHY_2MBPS) ? ((PDU_OVERHEAD_2M + len) * 4) : ((PDU_OVERHEAD_1M + len) * 8);
+}
+
+
+/**@brief Function for predicting the application data sent per second on a link.
+ *
+ * @param[in] conn_interval Connection interval, in 1.25 ms units.
+ * @param[in] event_length  Event length, in 1.25 ms units.
+ * @param[in] phy           Transmit PHY.
+ * @param[in] data_length   Link layer payload, in octets.
+ *
+ * @return Capacity, in bytes per second.
+ */
+static uint32_t capacity_get(uint16_t conn_interval, uint16_t event_length, uint8_t phy, uint16_t data_length)
+{
+    // A packet of full length and the empty packet acknowledging it.
+    uint32_t pair_us = pdu_time_us(phy, data_length) + T_IFS_US + pdu_time_us(phy, 0) + T_IFS_US;
+    uint32_t packets = ((uint32_t)MIN(event_length, conn_interval) * UNIT_US) / pair_us;
+
+    if ((conn_interval == 0) || (data_length <= ATT_OVERHEAD))
+    {
+        return 0;
+    }
+
+    return (packets * (data_length - ATT_OVERHEAD) * (1000000 / UNIT_US)) / conn_interval;
+}
+
+
+/**@brief Function for finding the state of a central link.
+ *
+ * @return State of the link, or NULL if it is not a central link.
+ */
+static nrf_ble_conn_plan_link_t * link_get(nrf_ble_conn_plan_t const * p_plan, uint16_t conn_handle)
+{
+    uint16_t conn_idx = ble_conn_state_conn_idx(conn_handle);
+
+    if (   (conn_handle == BLE_CONN_HANDLE_INVALID)
+        || (conn_idx >= p_plan->link_count)
+        || (p_plan->p_links[conn_idx].conn_handle != conn_handle))
+    {
+        return NULL;
+    }
+
+    return &p_plan->p_links[conn_idx];
+}
+
+
+/**@brief Function for moving a link to the planned connection parameters. */
+static void link_params_update(nrf_ble_conn_plan_t * p_plan, uint16_t conn_handle)
+{
+    ret_code_t err_code = sd_ble_gap_conn_param_update(conn_handle, &p_plan->conn_params);
+
+    if (err_code == NRF_ERROR_BUSY)
+    {
+        // Another procedure is running. The link keeps its interval until the next request.
+        NRF_LOG_WARNING("Link 0x%x busy, interval not updated.", conn_handle);
+    }
+    else if (   (err_code != NRF_SUCCESS)
+             && (err_code != NRF_ERROR_INVALID_STATE)
+             && (err_code != BLE_ERROR_INVALID_CONN_HANDLE)
+             && (p_plan->error_handler != NULL))
+    {
+        p_plan->error_handler(err_code);
+    }
+}
+
+
+/**@brief Function for handling the BLE_GAP_EVT_CONNECTED event. */
+static void on_connected(nrf_ble_conn_plan_t * p_plan, ble_gap_evt_t const * p_gap_evt)
+{
+    ble_gap_evt_connected_t const * p_connected = &p_gap_evt->params.connected;
+    uint16_t                        conn_idx    = ble_conn_state_conn_idx(p_gap_evt->conn_handle);
+    nrf_ble_conn_plan_link_t      * p_link;
+
+    if ((p_connected->role != BLE_GAP_ROLE_CENTRAL) || (conn_idx >= p_plan->link_count))
+    {
+        return;
+    }
+
+    p_link                = &p_plan->p_links[conn_idx];
+    p_link->conn_handle   = p_gap_evt->conn_handle;
+    p_link->conn_interval = p_connected->conn_params.max_conn_interval;
+    p_link->phy           = BLE_GAP_PHY_1MBPS;
+    p_link->data_length   = DATA_LENGTH_MIN;
+
+    if (p_link->conn_interval != p_plan->conn_params.max_conn_interval)
+    {
+        NRF_LOG_DEBUG("Link 0x%x connected with interval %d, moving it to %d.",
+                      p_link->conn_handle, p_link->conn_interval, p_plan->conn_params.max_conn_interval);
+        link_params_update(p_plan, p_link->conn_handle);
+    }
+}
+
+
+ret_code_t nrf_ble_conn_plan_init(nrf_ble_conn_plan_t * p_plan, nrf_ble_conn_plan_init_t const * p_init)
+{
+    uint16_t event_length_min;
+    uint32_t interval;
+
+    VERIFY_PARAM_NOT_NULL(p_plan);
+    VERIFY_PARAM_NOT_NULL(p_init);
+
+    if (   (p_init->links == 0)
+        || (p_init->min_conn_interval < BLE_GAP_CP_MIN_CONN_INTVL_MIN)
+        || (p_init->max_conn_interval > BLE_GAP_CP_MAX_CONN_INTVL_MAX)
+        || (p_init->min_conn_interval > p_init->max_conn_interval)
+        || ((p_init->phy != BLE_GAP_PHY_1MBPS) && (p_init->phy != BLE_GAP_PHY_2MBPS))
+        || (p_init->data_length < DATA_LENGTH_MIN)
+        || (p_init->data_length > DATA_LENGTH_MAX))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    event_length_min = MAX(p_init->min_event_length, BLE_GAP_EVENT_LENGTH_MIN);
+
+    // Shortest interval holding all events, within the allowed range.
+    interval = (uint32_t)p_init->links * event_length_min + p_init->reserved_time;
+    interval = MAX(interval, p_init->min_conn_interval);
+    if (interval > p_init->max_conn_interval)
+    {
+        NRF_LOG_WARNING("%d links need an interval of %d units.", p_init->links, interval);
+        return NRF_ERROR_NO_MEM;
+    }
+
+    // The supervision timeout must be longer than two intervals, slave latency included.
+    if (   ((uint32_t)p_init->conn_sup_timeout * 10000)
+        <= ((uint32_t)(1 + p_init->slave_latency) * interval * UNIT_US * 2))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_plan->conn_params.min_conn_interval = (uint16_t)interval;
+    p_plan->conn_params.max_conn_interval = (uint16_t)interval;
+    p_plan->conn_params.slave_latency     = p_init->slave_latency;
+    p_plan->conn_params.conn_sup_timeout  = p_init->conn_sup_timeout;
+    p_plan->event_length                  = (uint16_t)((interval - p_init->reserved_time) / p_init->links);
+    p_plan->conn_cfg_tag                  = p_init->conn_cfg_tag;
+    p_plan->links                         = p_init->links;
+    p_plan->phy                           = p_init->phy;
+    p_plan->data_length                   = p_init->data_length;
+    p_plan->error_handler                 = p_init->error_handler;
+
+    for (uint32_t i = 0; i < p_plan->link_count; i++)
+    {
+        p_plan->p_links[i].conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+
+    NRF_LOG_INFO("%d links: interval %d, event length %d units, %d B/s per link.",
+                 p_plan->links,
+                 interval,
+                 p_plan->event_length,
+                 nrf_ble_conn_plan_capacity_get(p_plan));
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_ble_conn_plan_cfg_set(nrf_ble_conn_plan_t const * p_plan, uint32_t ram_start)
+{
+    ble_cfg_t ble_cfg;
+
+    VERIFY_PARAM_NOT_NULL(p_plan);
+
+    memset(&ble_cfg, 0, sizeof(ble_cfg));
+    ble_cfg.conn_cfg.conn_cfg_tag                     = p_plan->conn_cfg_tag;
+    ble_cfg.conn_cfg.params.gap_conn_cfg.conn_count   = p_plan->links;
+    ble_cfg.conn_cfg.params.gap_conn_cfg.event_length = p_plan->event_length;
+
+    return sd_ble_cfg_set(BLE_CONN_CFG_GAP, &ble_cfg, ram_start);
+}
+
+
+ble_gap_conn_params_t const * nrf_ble_conn_plan_conn_params_get(nrf_ble_conn_plan_t const * p_plan)
+{
+    return &p_plan->conn_params;
+}
+
+
+uint32_t nrf_ble_conn_plan_capacity_get(nrf_ble_conn_plan_t const * p_plan)
+{
+    return capacity_get(p_plan->conn_params.max_conn_interval,
+                        p_plan->event_length,
+                        p_plan->phy,
+                        p_plan->data_length);
+}
+
+
+uint32_t nrf_ble_conn_plan_link_capacity_get(nrf_ble_conn_plan_t const * p_plan, uint16_t conn_handle)
+{
+    nrf_ble_conn_plan_link_t const * p_link = link_get(p_plan, conn_handle);
+
+    if (p_link == NULL)
+    {
+        return 0;
+    }
+
+    return capacity_get(p_link->conn_interval, p_plan->event_length, p_link->phy, p_link->data_length);
+}
+
+
+void nrf_ble_conn_plan_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    nrf_ble_conn_plan_t      * p_plan    = (nrf_ble_conn_plan_t *)p_context;
+    ble_gap_evt_t const      * p_gap_evt = &p_ble_evt->evt.gap_evt;
+    nrf_ble_conn_plan_link_t * p_link;
+
+    if (p_ble_evt->header.evt_id == BLE_GAP_EVT_CONNECTED)
+    {
+        on_connected(p_plan, p_gap_evt);
+        return;
+    }
+
+    if (   (p_ble_evt->header.evt_id < BLE_GAP_EVT_BASE)
+        || (p_ble_evt->header.evt_id > BLE_GAP_EVT_LAST))
+    {
+        return;
+    }
+
+    p_link = link_get(p_plan, p_gap_evt->conn_handle);
+    if (p_link == NULL)
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_DISCONNECTED:
+            p_link->conn_handle = BLE_CONN_HANDLE_INVALID;
+            break;
+
+        case BLE_GAP_EVT_CONN_PARAM_UPDATE:
+            p_link->conn_interval = p_gap_evt->params.conn_param_update.conn_params.max_conn_interval;
+            break;
+
+        case BLE_GAP_EVT_CONN_PARAM_UPDATE_REQUEST:
+            // Another interval would make the link drift into the events of the others.
+            link_params_update(p_plan, p_link->conn_handle);
+            break;
+
+        case BLE_GAP_EVT_PHY_UPDATE:
+            if (p_gap_evt->params.phy_update.status == BLE_HCI_STATUS_CODE_SUCCESS)
+            {
+                p_link->phy = p_gap_evt->params.phy_update.tx_phy;
+            }
+            break;
+
+        case BLE_GAP_EVT_DATA_LENGTH_UPDATE:
+            p_link->data_length = p_gap_evt->params.data_length_update.effective_params.max_tx_octets;
+            break;
+
+        default:
+            break;
+    }
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BLE_CONN_PLAN)
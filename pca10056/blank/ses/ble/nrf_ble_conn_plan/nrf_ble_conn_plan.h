@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ble_conn_plan Central connection planner
+ * @{
+ * @ingroup ble_sdk_lib
+ * @brief Module for spacing the connection events of many central links.
+ *
+ * @details The SoftDevice places the connection event of a new central link right after the
+ *          events of the existing central links, if they have the same connection interval. The
+ *          links then share the radio without collisions as long as the event lengths of all
+ *          links fit in one interval. Links with different intervals drift against each other, and
+ *          the SoftDevice drops the events that collide.
+ *
+ *          This module chooses one connection interval and one event length for all links, so
+ *          that @ref nrf_ble_conn_plan_init_t::link_count events plus the time reserved for
+ *          scanning tile the interval:
+ *          - The interval is the smallest in the given range that holds the events of all links
+ *            at the shortest event length.
+ *          - The rest of the interval, less the reserved time, is shared equally by the links as
+ *            event length.
+ *
+ *          The event length is set on a connection configuration with
+ *          @ref nrf_ble_conn_plan_cfg_set, and the interval is used for every connection with
+ *          @ref nrf_ble_conn_plan_conn_params_get, for example as the connection parameters of
+ *          @ref nrf_ble_scan. Requests of the peers to change the interval are answered with the
+ *          planned parameters, and links established with another interval are moved to it.
+ *
+ *          The capacity of a link is predicted from the number of full-length packets with an
+ *          empty acknowledgment that fit in its event, using the PHY and data length of the link.
+ *          It is an upper bound for notifications or write commands.
+ *
+ * @note    The application must register this module as BLE event observer, which is done by
+ *          @ref NRF_BLE_CONN_PLAN_DEF, and must not answer connection parameter update requests
+ *          on the central links itself. @ref ble_conn_params only handles the peripheral role, and
+ *          is not affected.
+ */
+
+#ifndef NRF_BLE_CONN_PLAN_H__
+#define NRF_BLE_CONN_PLAN_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ble.h"
+#include "ble_gap.h"
+#include "ble_srv_common.h"
+#include "nrf_sdh_ble.h"
+#include "sdk_config.h"
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Macro for defining a nrf_ble_conn_plan instance.
+ *
+ * @param   _name       Name of the instance.
+ * @param   _max_links  Maximum number of central links connected at a time.
+ * @hideinitializer
+ */
+#define NRF_BLE_CONN_PLAN_DEF(_name, _max_links)                                \
+    static nrf_ble_conn_plan_link_t CONCAT_2(_name, _links)[(_max_links)];      \
+    static nrf_ble_conn_plan_t _name =                                          \
+    {                                                                           \
+        .p_links    = CONCAT_2(_name, _links),                                  \
+        .link_count = (_max_links)                                              \
+    };                                                                          \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                                         \
+                         NRF_BLE_CONN_PLAN_BLE_OBSERVER_PRIO,                   \
+                         nrf_ble_conn_plan_on_ble_evt,                          \
+                         &_name)
+
+/**@brief State of a central link. */
+typedef struct
+{
+    uint16_t conn_handle;   /**< Handle of the connection, or BLE_CONN_HANDLE_INVALID. */
+    uint16_t conn_interval; /**< Connection interval, in 1.25 ms units. */
+    uint8_t  phy;           /**< Transmit PHY, BLE_GAP_PHY_1MBPS or BLE_GAP_PHY_2MBPS. */
+    uint16_t data_length;   /**< Maximum transmitted link layer payload, in octets. */
+} nrf_ble_conn_plan_link_t;
+
+/**@brief Connection planner init structure. */
+typedef struct
+{
+    uint16_t                min_conn_interval; /**< Shortest connection interval allowed, in 1.25 ms units. */
+    uint16_t                max_conn_interval; /**< Longest connection interval allowed, in 1.25 ms units. */
+    uint16_t                slave_latency;     /**< Slave latency of the links. */
+    uint16_t                conn_sup_timeout;  /**< Supervision timeout of the links, in 10 ms units. */
+    uint8_t                 links;             /**< Number of links sharing the interval. */
+    uint8_t                 conn_cfg_tag;      /**< Connection configuration used by the links. */
+    uint16_t                min_event_length;  /**< Shortest event length of a link, in 1.25 ms units. 0 for BLE_GAP_EVENT_LENGTH_MIN. */
+    uint16_t                reserved_time;     /**< Time left free in every interval for scanning and advertising, in 1.25 ms units. */
+    uint8_t                 phy;               /**< PHY expected on the links, BLE_GAP_PHY_1MBPS or BLE_GAP_PHY_2MBPS. */
+    uint16_t                data_length;       /**< Link layer payload expected on the links, in octets. */
+    ble_srv_error_handler_t error_handler;     /**< Function to be called in case of an error. */
+} nrf_ble_conn_plan_init_t;
+
+/**@brief Connection planner structure. */
+typedef struct
+{
+    ble_gap_conn_params_t            conn_params;   /**< Planned connection parameters. */
+    uint16_t                         event_length;  /**< Planned event length, in 1.25 ms units. */
+    uint8_t                          conn_cfg_tag;  /**< Connection configuration used by the links. */
+    uint8_t                          links;         /**< Number of links sharing the interval. */
+    uint8_t                          phy;           /**< PHY expected on the links. */
+    uint16_t                         data_length;   /**< Link layer payload expected on the links, in octets. */
+    ble_srv_error_handler_t          error_handler; /**< Function to be called in case of an error. */
+    nrf_ble_conn_plan_link_t * const p_links;       /**< State of each central link. */
+    uint8_t                    const link_count;    /**< Number of elements in @ref nrf_ble_conn_plan_t::p_links. */
+} nrf_ble_conn_plan_t;
+
+
+/**@brief Function for planning the connection interval and event length.
+ *
+ * @param[out] p_plan Connection planner structure.
+ * @param[in]  p_init Requirements of the links.
+ *
+ * @retval NRF_SUCCESS             If the links fit in the allowed intervals.
+ * @retval NRF_ERROR_NULL          If any of the parameters is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If the intervals, the supervision timeout, the PHY or the data
+ *                                 length are not valid, or no link is planned.
+ * @retval NRF_ERROR_NO_MEM        If the events of all links do not fit in the longest interval.
+ */
+ret_code_t nrf_ble_conn_plan_init(nrf_ble_conn_plan_t * p_plan, nrf_ble_conn_plan_init_t const * p_init);
+
+
+/**@brief Function for setting the planned event length on the connection configuration.
+ *
+ * @details Must be called after @ref nrf_sdh_ble_default_cfg_set and before
+ *          @ref nrf_sdh_ble_enable. If the tag is the default one, the configuration set by
+ *          @ref nrf_sdh_ble_default_cfg_set is replaced.
+ *
+ * @param[in] p_plan    Connection planner structure.
+ * @param[in] ram_start Start of the application RAM.
+ *
+ * @return Error code returned by @ref sd_ble_cfg_set.
+ */
+ret_code_t nrf_ble_conn_plan_cfg_set(nrf_ble_conn_plan_t const * p_plan, uint32_t ram_start);
+
+
+/**@brief Function for getting the planned connection parameters.
+ *
+ * @param[in] p_plan Connection planner structure.
+ *
+ * @return Parameters to connect with, which have the same minimum and maximum interval.
+ */
+ble_gap_conn_params_t const * nrf_ble_conn_plan_conn_params_get(nrf_ble_conn_plan_t const * p_plan);
+
+
+/**@brief Function for getting the predicted capacity of a link of the plan.
+ *
+ * @param[in] p_plan Connection planner structure.
+ *
+ * @return Application data one link can send per second, in bytes.
+ */
+uint32_t nrf_ble_conn_plan_capacity_get(nrf_ble_conn_plan_t const * p_plan);
+
+
+/**@brief Function for getting the predicted capacity of a connected link.
+ *
+ * @details Uses the interval, PHY and data length of the link, which may differ from the plan
+ *          while an update is in progress or if the peer does not support them.
+ *
+ * @param[in] p_plan      Connection planner structure.
+ * @param[in] conn_handle Handle of the connection.
+ *
+ * @return Application data the link can send per second, in bytes, or 0 if the link is not a
+ *         central link.
+ */
+uint32_t nrf_ble_conn_plan_link_capacity_get(nrf_ble_conn_plan_t const * p_plan, uint16_t conn_handle);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+ *
+ * @param[in] p_ble_evt Event received from the BLE stack.
+ * @param[in] p_context Connection planner structure.
+ */
+void nrf_ble_conn_plan_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BLE_CONN_PLAN_H__
+
+/** @} */
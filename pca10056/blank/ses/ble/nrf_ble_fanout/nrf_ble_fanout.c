@@ -0,0 +1,506 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_FANOUT)
+#include "nrf_ble_fanout.h"
+#include <string.h>
+#include "ble_conn_state.h"
+#include "nrf_memobj_iov.h"
+#include "nrf_assert.h"
+
+#define NRF_LOG_MODULE_NAME nrf_ble_fanout
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define OPCODE_LENGTH 1 /**< Length of opcode inside a notification or indication. */
+#define HANDLE_LENGTH 2 /**< Length of handle inside a notification or indication. */
+
+
+/**@brief Function for forwarding SoftDevice errors to the application.
+ *
+ * @param[in] nrf_error    Error code returned by SoftDevice.
+ * @param[in] p_fanout     Measurement fan-out structure.
+ */
+static void error_forward(uint32_t nrf_error, nrf_ble_fanout_t const * p_fanout)
+{
+    if (p_fanout->error_handler != NULL)
+    {
+        p_fanout->error_handler(nrf_error);
+    }
+}
+
+
+/**@brief Function for finding the measurement state of a link.
+ *
+ * @param[in]   p_fanout    Measurement fan-out structure.
+ * @param[in]   conn_handle Handle of the connection.
+ *
+ * @return      Measurement state of the link, or NULL if the link is not known.
+ */
+static nrf_ble_fanout_link_t * link_get(nrf_ble_fanout_t * p_fanout, uint16_t conn_handle)
+{
+    uint16_t conn_idx = ble_conn_state_conn_idx(conn_handle);
+
+    if ((conn_idx >= p_fanout->link_count) || (p_fanout->p_links[conn_idx].conn_handle != conn_handle))
+    {
+        return NULL;
+    }
+
+    return &p_fanout->p_links[conn_idx];
+}
+
+
+/**@brief Function for releasing the measurement held by a link.
+ *
+ * @param[in]   p_link      Measurement state of the link.
+ */
+static void pending_release(nrf_ble_fanout_link_t * p_link)
+{
+    if (p_link->p_pending != NULL)
+    {
+        nrf_memobj_put(p_link->p_pending);
+        p_link->p_pending = NULL;
+    }
+}
+
+
+/**@brief Function for checking a CCCD value against the HVX type of the fan-out.
+ *
+ * @param[in]   p_fanout    Measurement fan-out structure.
+ * @param[in]   p_cccd      Encoded CCCD value.
+ *
+ * @return      True if the measurements must be sent with this CCCD value.
+ */
+static bool cccd_is_enabled(nrf_ble_fanout_t const * p_fanout, uint8_t const * p_cccd)
+{
+    return (p_fanout->hvx_type == BLE_GATT_HVX_INDICATION) ? ble_srv_is_indication_enabled(p_cccd) :
+                                                             ble_srv_is_notification_enabled(p_cccd);
+}
+
+
+/**@brief Function for reading the CCCD state of a link.
+ *
+ * @details The CCCD value is only valid once the system attributes of the peer have been set,
+ *          which may happen after the Connect event. The read is tried again on the next
+ *          measurement until it succeeds.
+ *
+ * @param[in]   p_fanout    Measurement fan-out structure.
+ * @param[in]   p_link      Measurement state of the link.
+ */
+static void cccd_read(nrf_ble_fanout_t * p_fanout, nrf_ble_fanout_link_t * p_link)
+{
+    uint8_t           cccd[BLE_CCCD_VALUE_LEN];
+    ble_gatts_value_t gatts_value;
+
+    memset(&gatts_value, 0, sizeof(gatts_value));
+
+    gatts_value.len     = sizeof(cccd);
+    gatts_value.offset  = 0;
+    gatts_value.p_value = cccd;
+
+    if (sd_ble_gatts_value_get(p_link->conn_handle, p_fanout->cccd_handle, &gatts_value) != NRF_SUCCESS)
+    {
+        return;
+    }
+
+    p_link->is_enabled = cccd_is_enabled(p_fanout, cccd);
+    p_link->cccd_known = true;
+}
+
+
+/**@brief Function for sending an encoded measurement on a link.
+ *
+ * @param[in]   p_fanout    Measurement fan-out structure.
+ * @param[in]   p_link      Measurement state of the link.
+ * @param[in]   p_data      Encoded measurement.
+ * @param[in]   len         Length of the encoded measurement.
+ *
+ * @return      Error code returned by @ref sd_ble_gatts_hvx, or NRF_ERROR_DATA_SIZE if the
+ *              measurement was truncated.
+ */
+static uint32_t hvx_send(nrf_ble_fanout_t      * p_fanout,
+                         nrf_ble_fanout_link_t * p_link,
+                         uint8_t               * p_data,
+                         uint16_t                len)
+{
+    uint32_t               err_code;
+    uint16_t               hvx_len = len;
+    ble_gatts_hvx_params_t hvx_params;
+
+    memset(&hvx_params, 0, sizeof(hvx_params));
+
+    hvx_params.handle = p_fanout->value_handle;
+    hvx_params.type   = p_fanout->hvx_type;
+    hvx_params.offset = 0;
+    hvx_params.p_len  = &hvx_len;
+    hvx_params.p_data = p_data;
+
+    err_code = sd_ble_gatts_hvx(p_link->conn_handle, &hvx_params);
+    if ((err_code == NRF_SUCCESS) && (hvx_len != len))
+    {
+        err_code = NRF_ERROR_DATA_SIZE;
+    }
+
+    if ((err_code == NRF_SUCCESS) && (p_fanout->hvx_type == BLE_GATT_HVX_INDICATION))
+    {
+        p_link->hvc_pending = true;
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for checking if a link must keep a measurement and send it later.
+ *
+ * @param[in]   err_code    Error code returned by @ref hvx_send.
+ */
+static bool hvx_retry_needed(uint32_t err_code)
+{
+    // The SoftDevice queue of the link is full, or an indication is waiting for its confirmation.
+    return (err_code == NRF_ERROR_RESOURCES) || (err_code == NRF_ERROR_BUSY);
+}
+
+
+/**@brief Function for sending the measurement held by a link, once it has room for it.
+ *
+ * @param[in]   p_fanout    Measurement fan-out structure.
+ * @param[in]   p_link      Measurement state of the link.
+ */
+static void pending_send(nrf_ble_fanout_t * p_fanout, nrf_ble_fanout_link_t * p_link)
+{
+    uint32_t err_code;
+
+    if ((p_link->p_pending == NULL) || p_link->hvc_pending)
+    {
+        return;
+    }
+
+    err_code = hvx_send(p_fanout,
+                        p_link,
+                        nrf_memobj_contiguous_get(p_link->p_pending, NULL),
+                        p_link->pending_len);
+    if (hvx_retry_needed(err_code))
+    {
+        return;
+    }
+
+    pending_release(p_link);
+
+    // The link may have disabled the characteristic or disconnected meanwhile.
+    if (   (err_code != NRF_SUCCESS)
+        && (err_code != NRF_ERROR_INVALID_STATE)
+        && (err_code != BLE_ERROR_INVALID_CONN_HANDLE))
+    {
+        error_forward(err_code, p_fanout);
+    }
+}
+
+
+/**@brief Function for sending a new measurement on a link, or keeping it for later.
+ *
+ * @param[in]   p_fanout    Measurement fan-out structure.
+ * @param[in]   p_link      Measurement state of the link.
+ * @param[in]   p_obj       Memory object holding the encoded measurement.
+ * @param[in]   len         Length of the encoded measurement.
+ *
+ * @return      NRF_SUCCESS if the measurement was sent or kept, otherwise the error code
+ *              returned by @ref hvx_send.
+ */
+static uint32_t link_serve(nrf_ble_fanout_t      * p_fanout,
+                           nrf_ble_fanout_link_t * p_link,
+                           nrf_memobj_t          * p_obj,
+                           uint16_t                len)
+{
+    uint32_t err_code = NRF_ERROR_BUSY;
+
+    // The new measurement replaces the one the link is still holding.
+    pending_release(p_link);
+
+    if (!p_link->hvc_pending)
+    {
+        err_code = hvx_send(p_fanout, p_link, nrf_memobj_contiguous_get(p_obj, NULL), len);
+    }
+
+    if (hvx_retry_needed(err_code))
+    {
+        nrf_memobj_get(p_obj);
+        p_link->p_pending   = p_obj;
+        p_link->pending_len = len;
+        err_code            = NRF_SUCCESS;
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for handling write events to the CCCD of the measurement characteristic.
+ *
+ * @param[in]   p_fanout    Measurement fan-out structure.
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ */
+static void on_write(nrf_ble_fanout_t * p_fanout, ble_evt_t const * p_ble_evt)
+{
+    ble_gatts_evt_write_t const * p_evt_write = &p_ble_evt->evt.gatts_evt.params.write;
+    nrf_ble_fanout_link_t       * p_link      = link_get(p_fanout, p_ble_evt->evt.gatts_evt.conn_handle);
+
+    if (   (p_link == NULL)
+        || (p_evt_write->handle != p_fanout->cccd_handle)
+        || (p_evt_write->len != BLE_CCCD_VALUE_LEN))
+    {
+        return;
+    }
+
+    p_link->is_enabled = cccd_is_enabled(p_fanout, p_evt_write->data);
+    p_link->cccd_known = true;
+
+    if (!p_link->is_enabled)
+    {
+        pending_release(p_link);
+    }
+}
+
+
+ret_code_t nrf_ble_fanout_init(nrf_ble_fanout_t            * p_fanout,
+                               nrf_ble_fanout_init_t const * p_fanout_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_fanout);
+    VERIFY_PARAM_NOT_NULL(p_fanout_init);
+    VERIFY_PARAM_NOT_NULL(p_fanout_init->encode);
+
+    if (   (p_fanout_init->hvx_type != BLE_GATT_HVX_NOTIFICATION)
+        && (p_fanout_init->hvx_type != BLE_GATT_HVX_INDICATION))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_fanout->value_handle  = p_fanout_init->value_handle;
+    p_fanout->cccd_handle   = p_fanout_init->cccd_handle;
+    p_fanout->hvx_type      = p_fanout_init->hvx_type;
+    p_fanout->encode        = p_fanout_init->encode;
+    p_fanout->p_context     = p_fanout_init->p_context;
+    p_fanout->error_handler = p_fanout_init->error_handler;
+
+    for (uint8_t i = 0; i < p_fanout->link_count; i++)
+    {
+        memset(&p_fanout->p_links[i], 0, sizeof(nrf_ble_fanout_link_t));
+        p_fanout->p_links[i].conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+
+    return nrf_memobj_pool_init(p_fanout->p_pool);
+}
+
+
+void nrf_ble_fanout_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    nrf_ble_fanout_t      * p_fanout = (nrf_ble_fanout_t *)p_context;
+    nrf_ble_fanout_link_t * p_link;
+    uint16_t                conn_idx;
+
+    if ((p_fanout == NULL) || (p_fanout->encode == NULL) || (p_ble_evt == NULL))
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_CONNECTED:
+            conn_idx = ble_conn_state_conn_idx(p_ble_evt->evt.gap_evt.conn_handle);
+            if (conn_idx < p_fanout->link_count)
+            {
+                p_link = &p_fanout->p_links[conn_idx];
+                pending_release(p_link);
+                memset(p_link, 0, sizeof(nrf_ble_fanout_link_t));
+                p_link->conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+                p_link->max_len     = MIN(BLE_GATT_ATT_MTU_DEFAULT - OPCODE_LENGTH - HANDLE_LENGTH,
+                                          NRF_BLE_FANOUT_MAX_DATA_LEN);
+            }
+            break;
+
+        case BLE_GAP_EVT_DISCONNECTED:
+            p_link = link_get(p_fanout, p_ble_evt->evt.gap_evt.conn_handle);
+            if (p_link != NULL)
+            {
+                pending_release(p_link);
+                p_link->conn_handle = BLE_CONN_HANDLE_INVALID;
+            }
+            break;
+
+        case BLE_GATTS_EVT_WRITE:
+            on_write(p_fanout, p_ble_evt);
+            break;
+
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+            p_link = link_get(p_fanout, p_ble_evt->evt.gatts_evt.conn_handle);
+            if ((p_link != NULL) && (p_fanout->hvx_type == BLE_GATT_HVX_NOTIFICATION))
+            {
+                pending_send(p_fanout, p_link);
+            }
+            break;
+
+        case BLE_GATTS_EVT_HVC:
+            p_link = link_get(p_fanout, p_ble_evt->evt.gatts_evt.conn_handle);
+            if (   (p_link != NULL)
+                && (p_ble_evt->evt.gatts_evt.params.hvc.handle == p_fanout->value_handle))
+            {
+                p_link->hvc_pending = false;
+                pending_send(p_fanout, p_link);
+            }
+            break;
+
+        case BLE_GATTS_EVT_TIMEOUT:
+            // No more ATT traffic is possible on the link.
+            p_link = link_get(p_fanout, p_ble_evt->evt.gatts_evt.conn_handle);
+            if (p_link != NULL)
+            {
+                pending_release(p_link);
+                p_link->hvc_pending = false;
+                p_link->is_enabled  = false;
+                p_link->cccd_known  = true;
+            }
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+
+void nrf_ble_fanout_on_gatt_evt(nrf_ble_fanout_t * p_fanout, nrf_ble_gatt_evt_t const * p_gatt_evt)
+{
+    nrf_ble_fanout_link_t * p_link;
+
+    if ((p_fanout == NULL) || (p_gatt_evt == NULL) || (p_gatt_evt->evt_id != NRF_BLE_GATT_EVT_ATT_MTU_UPDATED))
+    {
+        return;
+    }
+
+    p_link = link_get(p_fanout, p_gatt_evt->conn_handle);
+    if (p_link != NULL)
+    {
+        p_link->max_len = MIN(p_gatt_evt->params.att_mtu_effective - OPCODE_LENGTH - HANDLE_LENGTH,
+                              NRF_BLE_FANOUT_MAX_DATA_LEN);
+    }
+}
+
+
+ret_code_t nrf_ble_fanout_send(nrf_ble_fanout_t * p_fanout, void const * p_meas)
+{
+    VERIFY_PARAM_NOT_NULL(p_fanout);
+    VERIFY_PARAM_NOT_NULL(p_meas);
+
+    ret_code_t     err_code = NRF_SUCCESS;
+    uint32_t       link_err_code;
+    bool           is_enabled = false;
+    uint16_t       max_len    = NRF_BLE_FANOUT_MAX_DATA_LEN;
+    uint16_t       len;
+    nrf_memobj_t * p_obj;
+    uint8_t      * p_data;
+
+    // Find the links to be served, and the length that fits all of them.
+    for (uint8_t i = 0; i < p_fanout->link_count; i++)
+    {
+        nrf_ble_fanout_link_t * p_link = &p_fanout->p_links[i];
+
+        if (p_link->conn_handle == BLE_CONN_HANDLE_INVALID)
+        {
+            continue;
+        }
+
+        if (!p_link->cccd_known)
+        {
+            cccd_read(p_fanout, p_link);
+        }
+
+        if (p_link->is_enabled)
+        {
+            is_enabled = true;
+            max_len    = MIN(max_len, p_link->max_len);
+        }
+    }
+
+    if (!is_enabled)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    p_obj = nrf_memobj_alloc(p_fanout->p_pool, max_len);
+    if (p_obj == NULL)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    // The reference of the sender, released once every link has sent or kept the measurement.
+    nrf_memobj_get(p_obj);
+
+    p_data = nrf_memobj_contiguous_get(p_obj, NULL);
+    ASSERT(p_data != NULL);
+
+    len = p_fanout->encode(p_fanout->p_context, p_meas, p_data, max_len);
+    if ((len == 0) || (len > max_len))
+    {
+        nrf_memobj_put(p_obj);
+        return NRF_ERROR_DATA_SIZE;
+    }
+
+    for (uint8_t i = 0; i < p_fanout->link_count; i++)
+    {
+        nrf_ble_fanout_link_t * p_link = &p_fanout->p_links[i];
+
+        if ((p_link->conn_handle == BLE_CONN_HANDLE_INVALID) || !p_link->is_enabled)
+        {
+            continue;
+        }
+
+        link_err_code = link_serve(p_fanout, p_link, p_obj, len);
+        if (link_err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_DEBUG("Measurement not sent on connection 0x%04X: 0x%08X.",
+                          p_link->conn_handle, link_err_code);
+            err_code = link_err_code;
+        }
+    }
+
+    nrf_memobj_put(p_obj);
+
+    return err_code;
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BLE_FANOUT)
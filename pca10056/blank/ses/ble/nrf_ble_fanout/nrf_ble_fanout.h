@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ble_fanout Measurement fan-out module
+ * @{
+ * @ingroup ble_sdk_lib
+ * @brief Module for notifying or indicating a measurement to all connected collectors.
+ *
+ * @details The measurement services (for example @ref ble_cscs, @ref ble_rscs, @ref ble_hts,
+ *          @ref ble_bps and @ref ble_hrs) encode and send every measurement to the single link
+ *          stored in their service structure. This module sends the measurements of one
+ *          characteristic of an initialized service to every link that has enabled notification
+ *          or indication of it:
+ *
+ *          - A measurement is encoded once, with the encoder given in
+ *            @ref nrf_ble_fanout_init_t::encode, into a memory object that is shared by all links.
+ *            It is encoded for the lowest maximum notification length of those links.
+ *          - If the SoftDevice cannot take the measurement on a link yet, the link keeps a
+ *            reference to the memory object and the measurement is sent again when the link has
+ *            room. The memory object is released when the last link has sent it. A link only
+ *            keeps its latest measurement: a new measurement replaces the one it is still holding.
+ *          - For indications, a link holds its next measurement until the previous one is
+ *            confirmed by the peer.
+ *
+ *          The state of the CCCD is read from the SoftDevice the first time a link is served, so
+ *          bonded peers that enabled the characteristic in an earlier connection are included
+ *          once their system attributes are set.
+ *
+ * @note    The application must register this module as BLE event observer, which is done by
+ *          @ref NRF_BLE_FANOUT_DEF, and forward GATT events with @ref nrf_ble_fanout_on_gatt_evt.
+ */
+
+#ifndef NRF_BLE_FANOUT_H__
+#define NRF_BLE_FANOUT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_common.h"
+#include "ble.h"
+#include "ble_srv_common.h"
+#include "nrf_ble_gatt.h"
+#include "nrf_memobj.h"
+#include "nrf_balloc_idx.h"
+#include "nrf_sdh_ble.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Size of the memory object chunks. A measurement fits in the first chunk, next to the
+ *        head fields of the memory object, so it is always contiguous.
+ */
+#define NRF_BLE_FANOUT_CHUNK_SIZE (NRF_BLE_FANOUT_MAX_DATA_LEN + sizeof(uint32_t))
+
+/**@brief   Macro for defining a nrf_ble_fanout instance.
+ *
+ * @details The memory object pool holds one measurement per link, and the one being sent.
+ *
+ * @param   _name           Name of the instance.
+ * @param   _max_clients    Maximum number of collectors connected at a time.
+ * @hideinitializer
+ */
+#define NRF_BLE_FANOUT_DEF(_name, _max_clients)                                          \
+    static nrf_ble_fanout_link_t CONCAT_2(_name, _links)[(_max_clients)];                \
+    NRF_MEMOBJ_POOL_DEF(CONCAT_2(_name, _pool), NRF_BLE_FANOUT_CHUNK_SIZE,               \
+                        (_max_clients) + 1);                                             \
+    static nrf_ble_fanout_t _name =                                                      \
+    {                                                                                    \
+        .p_links    = CONCAT_2(_name, _links),                                           \
+        .link_count = (_max_clients),                                                    \
+        .p_pool     = &CONCAT_2(_name, _pool)                                            \
+    };                                                                                   \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                                                  \
+                         NRF_BLE_FANOUT_BLE_OBSERVER_PRIO,                               \
+                         nrf_ble_fanout_on_ble_evt,                                      \
+                         &_name)
+
+/**@brief Function for encoding a measurement.
+ *
+ * @param[in]  p_context  Context given in @ref nrf_ble_fanout_init_t::p_context, usually the
+ *                        service instance.
+ * @param[in]  p_meas     Measurement given to @ref nrf_ble_fanout_send.
+ * @param[out] p_buf      Buffer for the encoded measurement.
+ * @param[in]  max_len    Size of the buffer, which is the maximum notification length.
+ *
+ * @return Length of the encoded measurement, or 0 if it does not fit in @p max_len bytes.
+ */
+typedef uint16_t (* nrf_ble_fanout_encode_t)(void const * p_context,
+                                             void const * p_meas,
+                                             uint8_t    * p_buf,
+                                             uint16_t     max_len);
+
+/**@brief Measurement state of a link. */
+typedef struct
+{
+    uint16_t       conn_handle;  /**< Handle of the connection, or BLE_CONN_HANDLE_INVALID. */
+    bool           cccd_known;   /**< True once the CCCD has been read for this link. */
+    bool           is_enabled;   /**< True if notification or indication of the characteristic is enabled. */
+    bool           hvc_pending;  /**< True while an indication waits for its confirmation. */
+    uint16_t       max_len;      /**< Maximum length of a measurement sent on this link. */
+    nrf_memobj_t * p_pending;    /**< Measurement waiting to be sent on this link, or NULL. */
+    uint16_t       pending_len;  /**< Length of the measurement in @ref nrf_ble_fanout_link_t::p_pending. */
+} nrf_ble_fanout_link_t;
+
+/**@brief Measurement fan-out structure. */
+typedef struct
+{
+    uint16_t                        value_handle;  /**< Handle of the measurement characteristic value. */
+    uint16_t                        cccd_handle;   /**< Handle of the CCCD of the measurement characteristic. */
+    uint8_t                         hvx_type;      /**< BLE_GATT_HVX_NOTIFICATION or BLE_GATT_HVX_INDICATION. */
+    nrf_ble_fanout_encode_t         encode;        /**< Measurement encoder. */
+    void const                    * p_context;     /**< Context passed to the encoder. */
+    ble_srv_error_handler_t         error_handler; /**< Function to be called in case of an error. */
+    nrf_ble_fanout_link_t   * const p_links;       /**< Measurement state of each link. */
+    uint8_t                   const link_count;    /**< Number of elements in @ref nrf_ble_fanout_t::p_links. */
+    nrf_memobj_pool_t const * const p_pool;        /**< Pool of the shared measurement buffers. */
+} nrf_ble_fanout_t;
+
+/**@brief Measurement fan-out init structure. */
+typedef struct
+{
+    uint16_t                value_handle;  /**< Handle of the measurement characteristic value. */
+    uint16_t                cccd_handle;   /**< Handle of the CCCD of the measurement characteristic. */
+    uint8_t                 hvx_type;      /**< BLE_GATT_HVX_NOTIFICATION or BLE_GATT_HVX_INDICATION. */
+    nrf_ble_fanout_encode_t encode;        /**< Measurement encoder. */
+    void const            * p_context;     /**< Context passed to the encoder. */
+    ble_srv_error_handler_t error_handler; /**< Function to be called in case of an error. */
+} nrf_ble_fanout_init_t;
+
+
+/**@brief Function for initializing a measurement fan-out.
+ *
+ * @details Must be called after the service is initialized, and before any connection is
+ *          established.
+ *
+ * @param[out]  p_fanout      Measurement fan-out structure.
+ * @param[in]   p_fanout_init Information needed to initialize the fan-out.
+ *
+ * @retval NRF_SUCCESS             If the fan-out was initialized.
+ * @retval NRF_ERROR_NULL          If any of the input parameters or the encoder are NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If the HVX type is neither a notification nor an indication.
+ * @return Otherwise, an error code from @ref nrf_memobj_pool_init is returned.
+ */
+ret_code_t nrf_ble_fanout_init(nrf_ble_fanout_t            * p_fanout,
+                               nrf_ble_fanout_init_t const * p_fanout_init);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+ *
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ * @param[in]   p_context   Measurement fan-out structure.
+ */
+void nrf_ble_fanout_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+/**@brief Function for handling events from the GATT library.
+ *
+ * @param[in]   p_fanout    Measurement fan-out structure.
+ * @param[in]   p_gatt_evt  Event received from the GATT library.
+ */
+void nrf_ble_fanout_on_gatt_evt(nrf_ble_fanout_t * p_fanout, nrf_ble_gatt_evt_t const * p_gatt_evt);
+
+
+/**@brief Function for sending a measurement to all links.
+ *
+ * @details The measurement is encoded once and sent on every link that has enabled notification
+ *          or indication of the characteristic. A link that cannot take it yet keeps it and
+ *          sends it as soon as possible, unless a newer measurement is sent first.
+ *
+ * @param[in]   p_fanout    Measurement fan-out structure.
+ * @param[in]   p_meas      Measurement, passed to the encoder.
+ *
+ * @retval NRF_SUCCESS             If the measurement was sent or kept on every link with the
+ *                                 characteristic enabled.
+ * @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+ * @retval NRF_ERROR_INVALID_STATE If no link has enabled the characteristic.
+ * @retval NRF_ERROR_DATA_SIZE     If the measurement did not fit in a notification.
+ * @retval NRF_ERROR_NO_MEM        If there was no memory object left for the measurement.
+ * @retval err_code                Otherwise, the last error returned by @ref sd_ble_gatts_hvx.
+ */
+ret_code_t nrf_ble_fanout_send(nrf_ble_fanout_t * p_fanout, void const * p_meas);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BLE_FANOUT_H__
+
+/** @} */
@@ -56,6 +56,18 @@ NRF_LOG_MODULE_REGISTER();
 STATIC_ASSERT(NRF_SDH_BLE_GAP_DATA_LENGTH < 252);
 
 
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+/**@brief Throughput profile procedures, run in this order. */
+enum
+{
+    THROUGHPUT_STATE_IDLE,          //!< The profile is not being applied.
+    THROUGHPUT_STATE_ATT_MTU,       //!< Waiting for the ATT MTU exchange.
+    THROUGHPUT_STATE_DATA_LENGTH,   //!< Waiting for the data length update.
+    THROUGHPUT_STATE_PHY,           //!< Waiting for the PHY update.
+};
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+
+
 /**@brief Initialize a link's parameters to defaults. */
 static void link_init(nrf_ble_gatt_link_t * p_link)
 {
@@ -67,6 +79,11 @@ static void link_init(nrf_ble_gatt_link_t * p_link)
     p_link->data_length_desired        = NRF_SDH_BLE_GAP_DATA_LENGTH;
     p_link->data_length_effective      = BLE_GAP_DATA_LENGTH_DEFAULT;
 #endif // !defined (S112) && !defined(S312) && !defined (S122)
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+    p_link->throughput_state           = THROUGHPUT_STATE_IDLE;
+    p_link->tx_phy                     = BLE_GAP_PHY_1MBPS;
+    p_link->rx_phy                     = BLE_GAP_PHY_1MBPS;
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
 }
 
 /**@brief   Start a data length update request procedure on a given connection. */
@@ -112,6 +129,151 @@ static ret_code_t data_length_update(uint16_t conn_handle, uint16_t data_length)
 #endif // !defined (S112) && !defined(S312) && !defined (S122)
 
 
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+/**@brief Start the throughput profile on a new connection.
+ *
+ * @param[in]   p_gatt      GATT structure.
+ * @param[in]   conn_handle Connection handle.
+ */
+static void throughput_start(nrf_ble_gatt_t * p_gatt, uint16_t conn_handle)
+{
+    ret_code_t err_code;
+    ble_opt_t  opt;
+
+    // Connection event extension is a global option, enable it once.
+    if (!p_gatt->conn_evt_ext)
+    {
+        memset(&opt, 0, sizeof(opt));
+        opt.common_opt.conn_evt_ext.enable = 1;
+
+        err_code = sd_ble_opt_set(BLE_COMMON_OPT_CONN_EVT_EXT, &opt);
+        if (err_code == NRF_SUCCESS)
+        {
+            p_gatt->conn_evt_ext = true;
+        }
+        else
+        {
+            NRF_LOG_ERROR("sd_ble_opt_set() (connection event extension) returned %s.",
+                          nrf_strerror_get(err_code));
+        }
+    }
+
+    p_gatt->links[conn_handle].throughput_state = THROUGHPUT_STATE_ATT_MTU;
+}
+
+
+/**@brief Continue the throughput profile after a procedure has finished.
+ *
+ * @details The next procedure is started only when the one that is running is @p finished.
+ *          A procedure that is not needed or cannot be started is skipped. After the PHY
+ *          update, an event with the effective link parameters is sent to the user.
+ *
+ * @param[in]   p_gatt      GATT structure.
+ * @param[in]   conn_handle Connection handle.
+ * @param[in]   finished    Procedure that has finished.
+ */
+static void throughput_continue(nrf_ble_gatt_t * p_gatt, uint16_t conn_handle, uint8_t finished)
+{
+    nrf_ble_gatt_link_t * p_link = &p_gatt->links[conn_handle];
+    ret_code_t            err_code;
+
+    if (p_link->throughput_state != finished)
+    {
+        return;
+    }
+
+    if (p_link->throughput_state == THROUGHPUT_STATE_ATT_MTU)
+    {
+        if (p_link->att_mtu_exchange_requested || p_link->att_mtu_exchange_pending)
+        {
+            return;
+        }
+
+        p_link->throughput_state = THROUGHPUT_STATE_DATA_LENGTH;
+
+#if !defined (S112) && !defined(S312) && !defined (S122)
+        if (   (p_link->data_length_desired > p_link->data_length_effective)
+            && (data_length_update(conn_handle, p_link->data_length_desired) == NRF_SUCCESS))
+        {
+            return;
+        }
+#endif // !defined (S112) && !defined(S312) && !defined (S122)
+    }
+
+    if (p_link->throughput_state == THROUGHPUT_STATE_DATA_LENGTH)
+    {
+        ble_gap_phys_t const phys =
+        {
+            .tx_phys = BLE_GAP_PHY_2MBPS,
+            .rx_phys = BLE_GAP_PHY_2MBPS,
+        };
+
+        p_link->throughput_state = THROUGHPUT_STATE_PHY;
+
+        NRF_LOG_DEBUG("Requesting 2 Mbps PHY on connection 0x%x.", conn_handle);
+
+        err_code = sd_ble_gap_phy_update(conn_handle, &phys);
+        if (err_code == NRF_SUCCESS)
+        {
+            return;
+        }
+
+        NRF_LOG_ERROR("sd_ble_gap_phy_update() on connection 0x%x returned %s.",
+                      conn_handle, nrf_strerror_get(err_code));
+    }
+
+    p_link->throughput_state = THROUGHPUT_STATE_IDLE;
+
+    NRF_LOG_DEBUG("Throughput profile applied on connection 0x%x.", conn_handle);
+
+    if (p_gatt->evt_handler != NULL)
+    {
+        nrf_ble_gatt_evt_t const evt =
+        {
+            .evt_id      = NRF_BLE_GATT_EVT_THROUGHPUT_READY,
+            .conn_handle = conn_handle,
+            .params.throughput =
+            {
+                .att_mtu_effective = p_link->att_mtu_effective,
+#if !defined (S112) && !defined(S312) && !defined (S122)
+                .data_length       = p_link->data_length_effective,
+#endif // !defined (S112) && !defined(S312) && !defined (S122)
+                .tx_phy            = p_link->tx_phy,
+                .rx_phy            = p_link->rx_phy,
+                .conn_evt_ext      = p_gatt->conn_evt_ext,
+            },
+        };
+
+        p_gatt->evt_handler(p_gatt, &evt);
+    }
+}
+
+
+/**@brief   Handle a BLE_GAP_EVT_PHY_UPDATE event.
+ *
+ * @param[in]   p_gatt      GATT structure.
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ */
+static void on_phy_update_evt(nrf_ble_gatt_t * p_gatt, ble_evt_t const * p_ble_evt)
+{
+    ble_gap_evt_t const * p_gap_evt = &p_ble_evt->evt.gap_evt;
+    nrf_ble_gatt_link_t * p_link    = &p_gatt->links[p_gap_evt->conn_handle];
+
+    if (p_gap_evt->params.phy_update.status == BLE_HCI_STATUS_CODE_SUCCESS)
+    {
+        p_link->tx_phy = p_gap_evt->params.phy_update.tx_phy;
+        p_link->rx_phy = p_gap_evt->params.phy_update.rx_phy;
+    }
+
+    NRF_LOG_DEBUG("PHY update on connection 0x%x: status 0x%x, TX PHY %u, RX PHY %u.",
+                  p_gap_evt->conn_handle, p_gap_evt->params.phy_update.status,
+                  p_link->tx_phy, p_link->rx_phy);
+
+    throughput_continue(p_gatt, p_gap_evt->conn_handle, THROUGHPUT_STATE_PHY);
+}
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+
+
 /**@brief Handle a connected event.
  *
  * Begins an ATT MTU exchange procedure, followed by a data length update request as necessary.
@@ -148,6 +310,13 @@ static void on_connected_evt(nrf_ble_gatt_t * p_gatt, ble_evt_t const * p_ble_ev
             break;
     }
 
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+    if (p_gatt->throughput_profile)
+    {
+        throughput_start(p_gatt, conn_handle);
+    }
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+
 #if NRF_BLE_GATT_MTU_EXCHANGE_INITIATION_ENABLED
     // Begin an ATT MTU exchange if necessary.
     if (p_link->att_mtu_desired > p_link->att_mtu_effective)
@@ -177,6 +346,15 @@ static void on_connected_evt(nrf_ble_gatt_t * p_gatt, ble_evt_t const * p_ble_ev
     }
 #endif // NRF_BLE_GATT_MTU_EXCHANGE_INITIATION_ENABLED
 
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+    // The data length is updated after the ATT MTU exchange.
+    if (p_link->throughput_state != THROUGHPUT_STATE_IDLE)
+    {
+        throughput_continue(p_gatt, conn_handle, THROUGHPUT_STATE_ATT_MTU);
+        return;
+    }
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+
 #if !defined (S112) && !defined(S312) && !defined (S122)
     // Send a data length update request if necessary.
     if (p_link->data_length_desired > p_link->data_length_effective)
@@ -234,6 +412,10 @@ static void on_exchange_mtu_rsp_evt(nrf_ble_gatt_t * p_gatt, ble_evt_t const * p
 
     p_link->att_mtu_exchange_requested = false;
     p_link->att_mtu_exchange_pending   = false;
+
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+    throughput_continue(p_gatt, conn_handle, THROUGHPUT_STATE_ATT_MTU);
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
 }
 
 
@@ -287,6 +469,10 @@ static void on_exchange_mtu_request_evt(nrf_ble_gatt_t * p_gatt, ble_evt_t const
 
         p_gatt->evt_handler(p_gatt, &evt);
     }
+
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+    throughput_continue(p_gatt, conn_handle, THROUGHPUT_STATE_ATT_MTU);
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
 }
 
 
@@ -332,6 +518,10 @@ static void on_data_length_update_evt(nrf_ble_gatt_t * p_gatt, ble_evt_t const *
 
         p_gatt->evt_handler(p_gatt, &evt);
     }
+
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+    throughput_continue(p_gatt, conn_handle, THROUGHPUT_STATE_DATA_LENGTH);
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
 }
 
 
@@ -377,6 +567,10 @@ ret_code_t nrf_ble_gatt_init(nrf_ble_gatt_t * p_gatt, nrf_ble_gatt_evt_handler_t
     p_gatt->att_mtu_desired_periph  = NRF_SDH_BLE_GATT_MAX_MTU_SIZE;
     p_gatt->att_mtu_desired_central = NRF_SDH_BLE_GATT_MAX_MTU_SIZE;
     p_gatt->data_length             = NRF_SDH_BLE_GAP_DATA_LENGTH;
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+    p_gatt->throughput_profile      = false;
+    p_gatt->conn_evt_ext            = false;
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
 
     for (uint32_t i = 0; i < NRF_BLE_GATT_LINK_COUNT; i++)
     {
@@ -415,6 +609,17 @@ ret_code_t nrf_ble_gatt_att_mtu_central_set(nrf_ble_gatt_t * p_gatt, uint16_t de
 }
 
 
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+ret_code_t nrf_ble_gatt_throughput_profile_set(nrf_ble_gatt_t * p_gatt, bool enable)
+{
+    VERIFY_PARAM_NOT_NULL(p_gatt);
+
+    p_gatt->throughput_profile = enable;
+    return NRF_SUCCESS;
+}
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+
+
 uint16_t nrf_ble_gatt_eff_mtu_get(nrf_ble_gatt_t const * p_gatt, uint16_t conn_handle)
 {
     if ((p_gatt == NULL) || (conn_handle >= NRF_BLE_GATT_LINK_COUNT))
@@ -525,6 +730,12 @@ void nrf_ble_gatt_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
             break;
 #endif // !defined (S112) && !defined(S312) && !defined (S122)
 
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+        case BLE_GAP_EVT_PHY_UPDATE:
+            on_phy_update_evt(p_gatt, p_ble_evt);
+            break;
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+
         default:
             break;
     }
@@ -83,8 +83,25 @@ typedef enum
 {
   NRF_BLE_GATT_EVT_ATT_MTU_UPDATED     = 0xA77,  //!< The ATT_MTU size was updated.
   NRF_BLE_GATT_EVT_DATA_LENGTH_UPDATED = 0xDA7A, //!< The data length was updated.
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+  NRF_BLE_GATT_EVT_THROUGHPUT_READY    = 0xFA57, //!< The throughput profile procedures have finished.
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
 } nrf_ble_gatt_evt_id_t;
 
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+/**@brief   Link parameters reported by @ref NRF_BLE_GATT_EVT_THROUGHPUT_READY. */
+typedef struct
+{
+    uint16_t att_mtu_effective;         //!< Effective ATT_MTU.
+#if !defined (S112) && !defined(S312)
+    uint8_t  data_length;               //!< Effective data length.
+#endif // !defined (S112) && !defined(S312)
+    uint8_t  tx_phy;                    //!< TX PHY, see @ref BLE_GAP_PHYS.
+    uint8_t  rx_phy;                    //!< RX PHY, see @ref BLE_GAP_PHYS.
+    bool     conn_evt_ext;              //!< Connection event extension is enabled.
+} nrf_ble_gatt_throughput_t;
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+
 /**@brief   GATT module event. */
 typedef struct
 {
@@ -96,6 +113,9 @@ typedef struct
 #if !defined (S112) && !defined(S312)
         uint8_t  data_length;           //!< Data length value.
 #endif // !defined (S112) && !defined(S312)
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+        nrf_ble_gatt_throughput_t throughput; //!< Final link parameters.
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
     } params;
 } nrf_ble_gatt_evt_t;
 
@@ -119,6 +139,11 @@ typedef struct
     uint8_t  data_length_desired;           //!< Desired data length (in bytes).
     uint8_t  data_length_effective;         //!< Requested data length (in bytes).
 #endif // !defined (S112) && !defined(S312)
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+    uint8_t  throughput_state;              //!< Throughput profile procedure that is running.
+    uint8_t  tx_phy;                        //!< TX PHY of the connection.
+    uint8_t  rx_phy;                        //!< RX PHY of the connection.
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
 } nrf_ble_gatt_link_t;
 
 
@@ -130,6 +155,10 @@ struct nrf_ble_gatt_s
     uint8_t                    data_length;                     //!< Data length to use for the next connection that is established.
     nrf_ble_gatt_link_t        links[NRF_BLE_GATT_LINK_COUNT];  //!< GATT related information for all active connections.
     nrf_ble_gatt_evt_handler_t evt_handler;                     //!< GATT event handler.
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+    bool                       throughput_profile;              //!< Apply the throughput profile to the next connections.
+    bool                       conn_evt_ext;                    //!< Connection event extension was enabled.
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
 };
 
 
@@ -211,6 +240,32 @@ ret_code_t nrf_ble_gatt_data_length_get(nrf_ble_gatt_t const * p_gatt,
                                         uint8_t              * p_data_length);
 #endif // !defined (S112) && !defined(S312)
 
+#if NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+/**@brief   Function for applying the throughput profile to the next connections.
+ *
+ * @details When a connection is established, connection event extension is enabled and the
+ *          following procedures are run one after another, so that they do not collide:
+ *          - ATT_MTU exchange, as without the profile.
+ *          - Data length update to the data length set with @ref nrf_ble_gatt_data_length_set.
+ *          - PHY update to 2 Mbps.
+ *          Each step starts when the previous one has finished or could not be started.
+ *          @ref NRF_BLE_GATT_EVT_THROUGHPUT_READY then reports the effective parameters.
+ *          The ATT_MTU and data length events are still sent when their parameter changes.
+ *
+ * @note    The maximum connection event length is set with NRF_SDH_BLE_GAP_EVENT_LENGTH in the
+ *          SoftDevice configuration. PHY update requests from the peer must still be answered by
+ *          the application.
+ *
+ * @param[in]   p_gatt  Pointer to the GATT structure.
+ * @param[in]   enable  Whether to apply the profile.
+ *
+ * @retval NRF_SUCCESS      If the operation was successful.
+ * @retval NRF_ERROR_NULL   If @p p_gatt is NULL.
+ */
+ret_code_t nrf_ble_gatt_throughput_profile_set(nrf_ble_gatt_t * p_gatt, bool enable);
+#endif // NRF_BLE_GATT_THROUGHPUT_PROFILE_ENABLED
+
+
 /**@brief   Function for handling BLE stack events.
  *
  * @details This function handles events from the BLE stack that are of interest to the module.
@@ -42,11 +42,16 @@
 #if NRF_MODULE_ENABLED(NRF_BLE_GQ)
 
 #include "nrf_ble_gq.h"
+#include "nrf_memobj_iov.h"
+#include "app_util_platform.h"
+#include "nrf_profiler.h"
 
 #define NRF_LOG_MODULE_NAME nrf_ble_gq
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
 
+NRF_PROFILER_PROBE_DEF(ble_gq_queue_process);
+
 /**@brief Pointer used to describe memory allocator for GATT request. */
 typedef ret_code_t (* req_data_alloc_t) (nrf_memobj_pool_t const * p_data_pool, 
                                          nrf_ble_gq_req_t  * const p_req);
@@ -73,6 +78,16 @@ static ret_code_t gattc_write_alloc(nrf_memobj_pool_t const * p_data_pool,
         return NRF_ERROR_INVALID_LENGTH;
     }
 
+#if NRF_BLE_GQ_INLINE_DATA_LEN
+    // Keep short payloads in the request descriptor.
+    if (p_gattc_write->len <= NRF_BLE_GQ_INLINE_DATA_LEN)
+    {
+        p_req->p_mem_obj = NULL;
+        memcpy(p_req->inline_data, p_gattc_write->p_value, p_gattc_write->len);
+        return NRF_SUCCESS;
+    }
+#endif
+
     // Allocate memory for GATTC write request.
     p_req->p_mem_obj = nrf_memobj_alloc(p_data_pool,
                                         p_gattc_write->len);
@@ -110,6 +125,17 @@ static ret_code_t gatts_hvx_alloc(nrf_memobj_pool_t const * p_data_pool,
         return NRF_ERROR_INVALID_LENGTH;
     }
 
+#if NRF_BLE_GQ_INLINE_DATA_LEN
+    // Keep short payloads in the request descriptor.
+    if (*p_gatts_hvx->p_len <= NRF_BLE_GQ_INLINE_DATA_LEN)
+    {
+        p_req->p_mem_obj = NULL;
+        memcpy(p_req->inline_data, p_gatts_hvx->p_len, sizeof(uint16_t));
+        memcpy(&p_req->inline_data[sizeof(uint16_t)], p_gatts_hvx->p_data, *p_gatts_hvx->p_len);
+        return NRF_SUCCESS;
+    }
+#endif
+
     // Allocate memory for GATTS notification or indication request.
     p_req->p_mem_obj = nrf_memobj_alloc(p_data_pool,
                                         *p_gatts_hvx->p_len + sizeof(uint16_t));
@@ -142,6 +168,265 @@ static const req_data_alloc_t m_req_data_alloc[NRF_BLE_GQ_REQ_NUM] =
 };
 
 
+/**@brief Function frees the data allocated for a request, if there is any.
+ *
+ * @param[in] p_req  Pointer to the request.
+ */
+static void req_data_free(nrf_ble_gq_req_t const * const p_req)
+{
+    if ((m_req_data_alloc[p_req->type] != NULL) && (p_req->p_mem_obj != NULL))
+    {
+        nrf_memobj_free(p_req->p_mem_obj);
+        NRF_LOG_DEBUG("Pointer to freed memory block: %p.", p_req->p_mem_obj);
+    }
+}
+
+
+#if NRF_BLE_GQ_COALESCE_ENABLED
+/**@brief Function checks if a new request can be merged with a queued one.
+ *
+ * @param[in] p_queued  Pointer to the queued request.
+ * @param[in] p_req     Pointer to the new request.
+ *
+ * @retval  true   If the queued request can absorb the new one.
+ * @retval  false  If the new request has to be queued on its own.
+ */
+static bool req_is_coalescable(nrf_ble_gq_req_t const * const p_queued,
+                               nrf_ble_gq_req_t const * const p_req)
+{
+    nrf_ble_gq_req_error_handler_t const * p_queued_eh = &p_queued->error_handler;
+    nrf_ble_gq_req_error_handler_t const * p_req_eh    = &p_req->error_handler;
+
+    if (p_queued->type != p_req->type)
+    {
+        return false;
+    }
+
+    // Keep requests apart if both requesters have to be notified of a failure.
+    if ((p_queued_eh->cb != NULL) && (p_req_eh->cb != NULL) &&
+        ((p_queued_eh->cb != p_req_eh->cb) || (p_queued_eh->p_ctx != p_req_eh->p_ctx)))
+    {
+        return false;
+    }
+
+    switch (p_req->type)
+    {
+        case NRF_BLE_GQ_REQ_GATTC_READ:
+        {
+            return (p_queued->params.gattc_read.handle == p_req->params.gattc_read.handle) &&
+                   (p_queued->params.gattc_read.offset == p_req->params.gattc_read.offset);
+        }
+
+        case NRF_BLE_GQ_REQ_GATTC_WRITE:
+        {
+            nrf_ble_gq_gattc_write_t const * p_queued_write = &p_queued->params.gattc_write;
+            nrf_ble_gq_gattc_write_t const * p_req_write    = &p_req->params.gattc_write;
+
+            if ((p_req_write->write_op != BLE_GATT_OP_WRITE_REQ) &&
+                (p_req_write->write_op != BLE_GATT_OP_WRITE_CMD))
+            {
+                return false;
+            }
+            return (p_queued_write->write_op == p_req_write->write_op) &&
+                   (p_queued_write->handle   == p_req_write->handle)   &&
+                   (p_queued_write->offset   == 0)                     &&
+                   (p_req_write->offset      == 0);
+        }
+
+        case NRF_BLE_GQ_REQ_GATTS_HVX:
+        {
+            nrf_ble_gq_gatts_hvx_t const * p_queued_hvx = &p_queued->params.gatts_hvx;
+            nrf_ble_gq_gatts_hvx_t const * p_req_hvx    = &p_req->params.gatts_hvx;
+
+            return (p_req_hvx->type      == BLE_GATT_HVX_NOTIFICATION) &&
+                   (p_queued_hvx->type   == BLE_GATT_HVX_NOTIFICATION) &&
+                   (p_queued_hvx->handle == p_req_hvx->handle)         &&
+                   (p_queued_hvx->offset == 0)                         &&
+                   (p_req_hvx->offset    == 0);
+        }
+
+        default:
+            return false;
+    }
+}
+
+
+/**@brief Function merges a new request into a queued one.
+ *
+ * @param[in]     p_data_pool  Pointer to general memory pool.
+ * @param[in,out] p_queued     Pointer to the queued request.
+ * @param[in]     p_req        Pointer to the new request.
+ *
+ * @retval    NRF_SUCCESS  If the request was merged.
+ * @retval    err_code     Error code of the data allocation for the new payload.
+ */
+static ret_code_t req_merge(nrf_memobj_pool_t const * p_data_pool,
+                            nrf_ble_gq_req_t  * const p_queued,
+                            nrf_ble_gq_req_t  * const p_req)
+{
+    if (m_req_data_alloc[p_req->type] != NULL)
+    {
+        // Replace the queued payload with the new one.
+        ret_code_t err_code = m_req_data_alloc[p_req->type](p_data_pool, p_req);
+        VERIFY_SUCCESS(err_code);
+
+        req_data_free(p_queued);
+
+        p_queued->p_mem_obj = p_req->p_mem_obj;
+        p_queued->params    = p_req->params;
+#if NRF_BLE_GQ_INLINE_DATA_LEN
+        memcpy(p_queued->inline_data, p_req->inline_data, sizeof(p_queued->inline_data));
+#endif
+    }
+
+    if (p_req->error_handler.cb != NULL)
+    {
+        p_queued->error_handler = p_req->error_handler;
+    }
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function coalesces a new request with a matching queued one.
+ *
+ * @details The queued requests are scanned in place in a critical region, so the queue is
+ *          never modified while the BLE event handler may be processing it. The request at
+ *          the front is skipped, as it may already have been taken for sending.
+ *
+ * @param[in] p_gatt_queue  Pointer to the BGQ instance.
+ * @param[in] p_queue       Pointer to the queue of the connection.
+ * @param[in] p_req         Pointer to the new request.
+ *
+ * @retval    NRF_SUCCESS          If the request was merged with a queued one.
+ * @retval    NRF_ERROR_NOT_FOUND  If the request has to be queued.
+ * @retval    err_code             Error code of the data allocation for the new payload.
+ */
+static ret_code_t req_coalesce(nrf_ble_gq_t const * const p_gatt_queue,
+                               nrf_queue_t  const * const p_queue,
+                               nrf_ble_gq_req_t   * const p_req)
+{
+    ret_code_t         err_code = NRF_ERROR_NOT_FOUND;
+    nrf_ble_gq_req_t * p_items  = (nrf_ble_gq_req_t *)p_queue->p_buffer;
+    size_t             idx;
+
+    if ((p_gatt_queue->coalesce_mask & (1UL << p_req->type)) == 0)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    CRITICAL_REGION_ENTER();
+    idx = p_queue->p_cb->front;
+    while (idx != p_queue->p_cb->back)
+    {
+        // The queue buffer holds one element more than the queue size.
+        idx = (idx < p_queue->size) ? (idx + 1) : 0;
+        if (idx == p_queue->p_cb->back)
+        {
+            break;
+        }
+        if (req_is_coalescable(&p_items[idx], p_req))
+        {
+            err_code = req_merge(p_gatt_queue->p_data_pool, &p_items[idx], p_req);
+            break;
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (err_code == NRF_SUCCESS)
+    {
+        NRF_LOG_DEBUG("GATT request (%d) coalesced with a queued one.", p_req->type);
+    }
+    return err_code;
+}
+#endif // NRF_BLE_GQ_COALESCE_ENABLED
+
+
+#if NRF_BLE_GQ_CREDITS_ENABLED
+/**@brief Function gets the SoftDevice TX queue credits used by a GATT request.
+ *
+ * @param[in] p_link  Pointer to the state of the connection.
+ * @param[in] p_req   Pointer to GATT request.
+ *
+ * @return    Pointer to the number of free places in the TX queue, or NULL if the request
+ *            does not use a TX queue.
+ */
+static uint8_t * req_credits_get(nrf_ble_gq_link_t      * const p_link,
+                                 nrf_ble_gq_req_t const * const p_req)
+{
+    if ((p_req->type == NRF_BLE_GQ_REQ_GATTC_WRITE) &&
+        (p_req->params.gattc_write.write_op == BLE_GATT_OP_WRITE_CMD))
+    {
+        return &p_link->write_cmd_credits;
+    }
+    if ((p_req->type == NRF_BLE_GQ_REQ_GATTS_HVX) &&
+        (p_req->params.gatts_hvx.type == BLE_GATT_HVX_NOTIFICATION))
+    {
+        return &p_link->hvn_credits;
+    }
+    return NULL;
+}
+
+
+/**@brief Function updates the SoftDevice TX queue credits with the result of a GATT request.
+ *
+ * @param[in] p_credits  Pointer to the credits used by the request, or NULL.
+ * @param[in] err_code   Error code returned by SoftDevice.
+ *
+ * @return    Error code to handle. NRF_ERROR_RESOURCES is returned as NRF_ERROR_BUSY, so that
+ *            the request is kept until there is room in the TX queue.
+ */
+static ret_code_t req_credits_update(uint8_t * const p_credits, ret_code_t err_code)
+{
+    if (p_credits == NULL)
+    {
+        return err_code;
+    }
+
+    if (err_code == NRF_ERROR_RESOURCES)
+    {
+        // The TX queue is fuller than tracked, wait for the TX complete event.
+        *p_credits = 0;
+        return NRF_ERROR_BUSY;
+    }
+
+    // A notification that failed with NRF_ERROR_DATA_SIZE was still queued, only shortened.
+    if (((err_code == NRF_SUCCESS) || (err_code == NRF_ERROR_DATA_SIZE)) && (*p_credits > 0))
+    {
+        (*p_credits)--;
+    }
+    return err_code;
+}
+
+
+/**@brief Function returns the SoftDevice TX queue credits freed by TX complete events.
+ *
+ * @param[in] p_link     Pointer to the state of the connection.
+ * @param[in] p_ble_evt  Pointer to the BLE event.
+ */
+static void credits_on_ble_evt(nrf_ble_gq_link_t * const p_link, ble_evt_t const * p_ble_evt)
+{
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+            p_link->write_cmd_credits =
+                MIN(p_link->write_cmd_credits +
+                    p_ble_evt->evt.gattc_evt.params.write_cmd_tx_complete.count,
+                    p_link->write_cmd_queue_size);
+            break;
+
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+            p_link->hvn_credits =
+                MIN(p_link->hvn_credits + p_ble_evt->evt.gatts_evt.params.hvn_tx_complete.count,
+                    p_link->hvn_queue_size);
+            break;
+
+        default:
+            break;
+    }
+}
+#endif // NRF_BLE_GQ_CREDITS_ENABLED
+
+
 /**@brief Function handles error codes returned by GATT requests.
  *
  * @param[in] p_req       Pointer to GATT request.
@@ -172,19 +457,36 @@ __STATIC_INLINE void request_err_code_handle(nrf_ble_gq_req_t const * const p_re
 
 /**@brief Function processes subsequent requests from the BGQ instance queue.
  *
- * @param[in] p_queue      Pointer to the queue instance.
- * @param[in] conn_handle  Connection handle.
+ * @param[in] p_gatt_queue  Pointer to the BGQ instance.
+ * @param[in] conn_id       ID of the registered connection.
+ *
+ * @retval  true   If a request was taken from the queue.
+ * @retval  false  If the queue is empty or Softdevice is busy.
  */
-static void queue_process(nrf_queue_t const * const p_queue, uint16_t conn_handle)
+static bool queue_req_process(nrf_ble_gq_t const * const p_gatt_queue, uint16_t conn_id)
 {
-    ret_code_t       err_code;
-    nrf_ble_gq_req_t ble_req;
+    nrf_queue_t const * p_queue     = &p_gatt_queue->p_req_queue[conn_id];
+    uint16_t            conn_handle = p_gatt_queue->p_conn_handles[conn_id];
+    ret_code_t          err_code;
+    nrf_ble_gq_req_t    ble_req;
+#if NRF_BLE_GQ_CREDITS_ENABLED
+    uint8_t           * p_credits;
+#endif
 
     NRF_LOG_DEBUG("Processing the request queue...");
 
     err_code = nrf_queue_peek(p_queue, &ble_req);
     if (err_code == NRF_SUCCESS) // Queue is not empty
     {
+#if NRF_BLE_GQ_CREDITS_ENABLED
+        p_credits = req_credits_get(&p_gatt_queue->p_links[conn_id], &ble_req);
+        if ((p_credits != NULL) && (*p_credits == 0))
+        {
+            NRF_LOG_DEBUG("SD TX queue is full. The request will be sent after TX complete.");
+            return false;
+        }
+#endif
+
         switch (ble_req.type)
         {
             case NRF_BLE_GQ_REQ_GATTC_READ:
@@ -198,11 +500,26 @@ static void queue_process(nrf_queue_t const * const p_queue, uint16_t conn_handl
             {
                 uint8_t write_data[NRF_BLE_GQ_GATTC_WRITE_MAX_DATA_LEN];
 
-                // Retrieve allocated data.
-                ble_req.params.gattc_write.p_value = write_data;
-                nrf_memobj_read(ble_req.p_mem_obj,
-                                (void *) ble_req.params.gattc_write.p_value,
-                                ble_req.params.gattc_write.len, 0);
+#if NRF_BLE_GQ_INLINE_DATA_LEN
+                if (ble_req.p_mem_obj == NULL)
+                {
+                    // The payload is held in the request descriptor.
+                    ble_req.params.gattc_write.p_value = ble_req.inline_data;
+                }
+                else
+#endif
+                {
+                    // Use allocated data in place if it is contiguous, otherwise retrieve it.
+                    ble_req.params.gattc_write.p_value = nrf_memobj_contiguous_get(ble_req.p_mem_obj,
+                                                                                   NULL);
+                    if (ble_req.params.gattc_write.p_value == NULL)
+                    {
+                        ble_req.params.gattc_write.p_value = write_data;
+                        nrf_memobj_read(ble_req.p_mem_obj,
+                                        (void *) ble_req.params.gattc_write.p_value,
+                                        ble_req.params.gattc_write.len, 0);
+                    }
+                }
 
                 NRF_LOG_DEBUG("GATTC Write Request");
                 err_code = sd_ble_gattc_write(conn_handle,
@@ -236,18 +553,38 @@ static void queue_process(nrf_queue_t const * const p_queue, uint16_t conn_handl
                 uint8_t  hvx_data[NRF_BLE_GQ_GATTS_HVX_MAX_DATA_LEN];
                 uint16_t len;
                 uint16_t hvx_len;
+                uint8_t * p_obj_data;
 
-                // Retrieve allocated data.
-                ble_req.params.gatts_hvx.p_data = hvx_data;
-                nrf_memobj_read(ble_req.p_mem_obj,
-                                (void *) &hvx_len,
-                                sizeof(uint16_t),
-                                0);
+#if NRF_BLE_GQ_INLINE_DATA_LEN
+                if (ble_req.p_mem_obj == NULL)
+                {
+                    // The payload is held in the request descriptor.
+                    p_obj_data = ble_req.inline_data;
+                    memcpy(&hvx_len, p_obj_data, sizeof(uint16_t));
+                }
+                else
+#endif
+                {
+                    // Retrieve allocated data. If it is contiguous, the payload is used in place.
+                    p_obj_data = nrf_memobj_contiguous_get(ble_req.p_mem_obj, NULL);
+                    nrf_memobj_read(ble_req.p_mem_obj,
+                                    (void *) &hvx_len,
+                                    sizeof(uint16_t),
+                                    0);
+                }
                 ble_req.params.gatts_hvx.p_len = &hvx_len;
-                nrf_memobj_read(ble_req.p_mem_obj,
-                                (void *) ble_req.params.gatts_hvx.p_data,
-                                *ble_req.params.gatts_hvx.p_len,
-                                sizeof(uint16_t));
+                if (p_obj_data != NULL)
+                {
+                    ble_req.params.gatts_hvx.p_data = p_obj_data + sizeof(uint16_t);
+                }
+                else
+                {
+                    ble_req.params.gatts_hvx.p_data = hvx_data;
+                    nrf_memobj_read(ble_req.p_mem_obj,
+                                    (void *) ble_req.params.gatts_hvx.p_data,
+                                    *ble_req.params.gatts_hvx.p_len,
+                                    sizeof(uint16_t));
+                }
 
                 len = hvx_len;
 
@@ -267,6 +604,10 @@ static void queue_process(nrf_queue_t const * const p_queue, uint16_t conn_handl
                 break;
         }
 
+#if NRF_BLE_GQ_CREDITS_ENABLED
+        err_code = req_credits_update(p_credits, err_code);
+#endif
+
         if (err_code == NRF_ERROR_BUSY) // Softdevice is processing another GATT request.
         {
             NRF_LOG_DEBUG("SD is currently busy. The GATT request procedure will be attempted \
@@ -275,17 +616,84 @@ static void queue_process(nrf_queue_t const * const p_queue, uint16_t conn_handl
         else
         {
             // Remove last request descriptor from the queue and free data associated with it.
-            if (m_req_data_alloc[ble_req.type] != NULL)
-            {
-                nrf_memobj_free(ble_req.p_mem_obj);
-                NRF_LOG_DEBUG("Pointer to freed memory block: %p.", ble_req.p_mem_obj);
-            }
+            req_data_free(&ble_req);
             UNUSED_RETURN_VALUE(nrf_queue_pop(p_queue, &ble_req));
 
             request_err_code_handle(&ble_req, conn_handle, err_code);
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**@brief Function processes subsequent requests from the BGQ instance queue, timed by the
+ *        ble_gq_queue_process probe.
+ *
+ * @param[in] p_gatt_queue  Pointer to the BGQ instance.
+ * @param[in] conn_id       ID of the registered connection.
+ *
+ * @return  Value returned by @ref queue_req_process.
+ */
+static bool queue_process(nrf_ble_gq_t const * const p_gatt_queue, uint16_t conn_id)
+{
+    bool processed;
+
+    NRF_PROFILER_BEGIN(ble_gq_queue_process);
+    processed = queue_req_process(p_gatt_queue, conn_id);
+    NRF_PROFILER_END(ble_gq_queue_process);
+
+    return processed;
+}
+
+
+#if NRF_BLE_GQ_SCHED_ENABLED
+/**@brief Function processes the queues of all registered connections in deficit round-robin order.
+ *
+ * @details Every connection with queued requests gets its quantum added to its deficit, and
+ *          issues requests until the deficit is used, the queue is empty or Softdevice is busy.
+ *          The deficit is cleared when the queue is empty. The deficit left over while
+ *          Softdevice is busy is capped at one quantum. The connection served first
+ *          moves on by one every round.
+ *
+ * @param[in] p_gatt_queue Pointer to the BGQ instance.
+ */
+static void queues_schedule(nrf_ble_gq_t * const p_gatt_queue)
+{
+    uint16_t first_id = p_gatt_queue->sched_first_id;
+
+    for (uint16_t i = 0; i < p_gatt_queue->max_conns; i++)
+    {
+        uint16_t            conn_id = (first_id + i) % p_gatt_queue->max_conns;
+        nrf_queue_t const * p_queue = &p_gatt_queue->p_req_queue[conn_id];
+        nrf_ble_gq_link_t * p_link  = &p_gatt_queue->p_links[conn_id];
+
+        if ((p_gatt_queue->p_conn_handles[conn_id] == BLE_CONN_HANDLE_INVALID) ||
+            nrf_queue_is_empty(p_queue))
+        {
+            p_link->deficit = 0;
+            continue;
+        }
+
+        p_link->deficit += p_link->quantum;
+        while ((p_link->deficit > 0) && queue_process(p_gatt_queue, conn_id))
+        {
+            p_link->deficit--;
+        }
+
+        if (nrf_queue_is_empty(p_queue))
+        {
+            p_link->deficit = 0;
+        }
+        else
+        {
+            p_link->deficit = MIN(p_link->deficit, p_link->quantum);
         }
     }
+
+    p_gatt_queue->sched_first_id = (first_id + 1) % p_gatt_queue->max_conns;
 }
+#endif // NRF_BLE_GQ_SCHED_ENABLED
 
 
 /**@brief Function purges all requests from BGQ instance queues that are
@@ -313,11 +721,7 @@ static void queues_purge(nrf_ble_gq_t const * const p_gatt_queue)
         while (err_code == NRF_SUCCESS)
         {
             // Free data associated with this request if there is any.
-            if (m_req_data_alloc[ble_req.type] != NULL)
-            {
-                nrf_memobj_free(ble_req.p_mem_obj);
-                NRF_LOG_DEBUG("Pointer to freed memory block: %p.", ble_req.p_mem_obj);
-            }
+            req_data_free(&ble_req);
 
             err_code = nrf_queue_pop(p_queue, &ble_req);
         }
@@ -329,15 +733,28 @@ static void queues_purge(nrf_ble_gq_t const * const p_gatt_queue)
 
 /**@brief Function processes single GATT request without queue.
  *
- * @param[in] p_req        Pointer to GATT request.
- * @param[in] conn_handle  Connection handle.
+ * @param[in] p_gatt_queue  Pointer to the BGQ instance.
+ * @param[in] p_req         Pointer to GATT request.
+ * @param[in] conn_id       ID of the registered connection.
  *
  * @retval  true   If request is accepted by Softdevice.
  * @retval  false  If Softdevice is busy and the request should be queued.
  */
-static bool request_process(nrf_ble_gq_req_t const * const p_req, uint16_t conn_handle)
+static bool request_process(nrf_ble_gq_t     const * const p_gatt_queue,
+                            nrf_ble_gq_req_t const * const p_req,
+                            uint16_t                       conn_id)
 {
-    ret_code_t err_code = NRF_SUCCESS;
+    uint16_t   conn_handle = p_gatt_queue->p_conn_handles[conn_id];
+    ret_code_t err_code    = NRF_SUCCESS;
+#if NRF_BLE_GQ_CREDITS_ENABLED
+    uint8_t  * p_credits   = req_credits_get(&p_gatt_queue->p_links[conn_id], p_req);
+
+    if ((p_credits != NULL) && (*p_credits == 0))
+    {
+        NRF_LOG_DEBUG("SD TX queue is full. The request will be sent after TX complete.");
+        return false;
+    }
+#endif
 
     switch (p_req->type)
     {
@@ -395,6 +812,10 @@ static bool request_process(nrf_ble_gq_req_t const * const p_req, uint16_t conn_
             break;
     }
 
+#if NRF_BLE_GQ_CREDITS_ENABLED
+    err_code = req_credits_update(p_credits, err_code);
+#endif
+
     if (err_code == NRF_ERROR_BUSY) // Softdevice is processing another GATT request.
     {
         NRF_LOG_DEBUG("SD is currently busy. The GATT request procedure will be attempted \
@@ -446,6 +867,16 @@ static ret_code_t conn_handle_register(nrf_ble_gq_t const * const p_gatt_queue,
         if (p_gatt_queue->p_conn_handles[id] == BLE_CONN_HANDLE_INVALID)
         {
             p_gatt_queue->p_conn_handles[id] = conn_handle;
+#if NRF_BLE_GQ_SCHED_ENABLED
+            p_gatt_queue->p_links[id].deficit = 0;
+            p_gatt_queue->p_links[id].quantum = NRF_BLE_GQ_SCHED_DEFAULT_QUANTUM;
+#endif
+#if NRF_BLE_GQ_CREDITS_ENABLED
+            p_gatt_queue->p_links[id].write_cmd_queue_size = NRF_BLE_GQ_WRITE_CMD_TX_QUEUE_SIZE;
+            p_gatt_queue->p_links[id].write_cmd_credits    = NRF_BLE_GQ_WRITE_CMD_TX_QUEUE_SIZE;
+            p_gatt_queue->p_links[id].hvn_queue_size       = NRF_BLE_GQ_HVN_TX_QUEUE_SIZE;
+            p_gatt_queue->p_links[id].hvn_credits          = NRF_BLE_GQ_HVN_TX_QUEUE_SIZE;
+#endif
             return NRF_SUCCESS;
         }
     }
@@ -498,13 +929,23 @@ ret_code_t nrf_ble_gq_item_add(nrf_ble_gq_t const * const p_gatt_queue,
     // Try processing a request without buffering.
     if (nrf_queue_is_empty(&p_gatt_queue->p_req_queue[conn_id]))
     {
-        bool req_processed = request_process(p_req, conn_handle);
+        bool req_processed = request_process(p_gatt_queue, p_req, conn_id);
         if (req_processed)
         {
             return err_code;
         }
     }
 
+#if NRF_BLE_GQ_COALESCE_ENABLED
+    // Update a matching queued request instead of adding another one.
+    err_code = req_coalesce(p_gatt_queue, &p_gatt_queue->p_req_queue[conn_id], p_req);
+    if (err_code != NRF_ERROR_NOT_FOUND)
+    {
+        return err_code;
+    }
+    err_code = NRF_SUCCESS;
+#endif
+
     // Prepare request for buffering and add it to the queue.
     if (m_req_data_alloc[p_req->type] != NULL)
     {
@@ -515,18 +956,38 @@ ret_code_t nrf_ble_gq_item_add(nrf_ble_gq_t const * const p_gatt_queue,
     }
 
     err_code = nrf_queue_push(&p_gatt_queue->p_req_queue[conn_id], p_req);
-    if ((err_code != NRF_SUCCESS) && (m_req_data_alloc[p_req->type] != NULL))
+    if (err_code != NRF_SUCCESS)
     {
-        nrf_memobj_free(p_req->p_mem_obj);
-        NRF_LOG_DEBUG("Pointer to freed memory block: %p.", p_req->p_mem_obj);
+        req_data_free(p_req);
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+        nrf_mem_telemetry_failure_record(p_gatt_queue);
+#endif
     }
 
     // Check if Softdevice is still busy.
-    queue_process(&p_gatt_queue->p_req_queue[conn_id], conn_handle);
+    UNUSED_RETURN_VALUE(queue_process(p_gatt_queue, conn_id));
     return err_code;
 }
 
 
+#if NRF_BLE_GQ_COALESCE_ENABLED
+ret_code_t nrf_ble_gq_coalesce_set(nrf_ble_gq_t * const p_gatt_queue, uint32_t mask)
+{
+    VERIFY_PARAM_NOT_NULL(p_gatt_queue);
+
+    if ((mask & ~(NRF_BLE_GQ_COALESCE_GATTC_READ  |
+                  NRF_BLE_GQ_COALESCE_GATTC_WRITE |
+                  NRF_BLE_GQ_COALESCE_GATTS_HVX)) != 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_gatt_queue->coalesce_mask = mask;
+    return NRF_SUCCESS;
+}
+#endif // NRF_BLE_GQ_COALESCE_ENABLED
+
+
 ret_code_t nrf_ble_gq_conn_handle_register(nrf_ble_gq_t * const p_gatt_queue, uint16_t conn_handle)
 {
     ret_code_t err_code = NRF_SUCCESS;
@@ -556,6 +1017,82 @@ ret_code_t nrf_ble_gq_conn_handle_register(nrf_ble_gq_t * const p_gatt_queue, ui
 }
 
 
+#if NRF_BLE_GQ_SCHED_ENABLED
+ret_code_t nrf_ble_gq_conn_quantum_set(nrf_ble_gq_t * const p_gatt_queue,
+                                       uint16_t             conn_handle,
+                                       uint8_t              quantum)
+{
+    uint16_t conn_id;
+
+    VERIFY_PARAM_NOT_NULL(p_gatt_queue);
+
+    conn_id = conn_handle_id_find(p_gatt_queue, conn_handle);
+    if ((quantum == 0) || (conn_id == p_gatt_queue->max_conns))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_gatt_queue->p_links[conn_id].quantum = quantum;
+    return NRF_SUCCESS;
+}
+#endif // NRF_BLE_GQ_SCHED_ENABLED
+
+
+#if NRF_BLE_GQ_CREDITS_ENABLED
+ret_code_t nrf_ble_gq_conn_tx_queue_size_set(nrf_ble_gq_t * const p_gatt_queue,
+                                             uint16_t             conn_handle,
+                                             uint8_t              write_cmd_tx_queue,
+                                             uint8_t              hvn_tx_queue)
+{
+    nrf_ble_gq_link_t * p_link;
+    uint16_t            conn_id;
+
+    VERIFY_PARAM_NOT_NULL(p_gatt_queue);
+
+    conn_id = conn_handle_id_find(p_gatt_queue, conn_handle);
+    if ((write_cmd_tx_queue == 0) || (hvn_tx_queue == 0) || (conn_id == p_gatt_queue->max_conns))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_link                       = &p_gatt_queue->p_links[conn_id];
+    p_link->write_cmd_queue_size = write_cmd_tx_queue;
+    p_link->write_cmd_credits    = write_cmd_tx_queue;
+    p_link->hvn_queue_size       = hvn_tx_queue;
+    p_link->hvn_credits          = hvn_tx_queue;
+    return NRF_SUCCESS;
+}
+#endif // NRF_BLE_GQ_CREDITS_ENABLED
+
+
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+void nrf_ble_gq_mem_telemetry_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats)
+{
+    nrf_ble_gq_t const * p_gatt_queue = p_object;
+
+    for (uint16_t conn_id = 0; conn_id < p_gatt_queue->max_conns; conn_id++)
+    {
+        nrf_queue_t const * p_queue = &p_gatt_queue->p_req_queue[conn_id];
+
+        p_stats->capacity   += p_queue->size;
+        p_stats->used       += nrf_queue_utilization_get(p_queue);
+        p_stats->high_water += nrf_queue_max_utilization_get(p_queue);
+    }
+}
+
+
+void nrf_ble_gq_mem_telemetry_reset(void const * p_object)
+{
+    nrf_ble_gq_t const * p_gatt_queue = p_object;
+
+    for (uint16_t conn_id = 0; conn_id < p_gatt_queue->max_conns; conn_id++)
+    {
+        nrf_queue_max_utilization_reset(&p_gatt_queue->p_req_queue[conn_id]);
+    }
+}
+#endif // NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+
+
 void nrf_ble_gq_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
 {
     nrf_ble_gq_t * p_gatt_queue = (nrf_ble_gq_t *) p_context;
@@ -603,7 +1140,20 @@ void nrf_ble_gq_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
     }
     else
     {
-        queue_process(&p_gatt_queue->p_req_queue[conn_id], conn_handle);
+#if NRF_BLE_GQ_CREDITS_ENABLED
+        credits_on_ble_evt(&p_gatt_queue->p_links[conn_id], p_ble_evt);
+#endif
+#if NRF_BLE_GQ_SCHED_ENABLED
+        // Serve all connections, not only the one that the event belongs to.
+        queues_schedule(p_gatt_queue);
+#elif NRF_BLE_GQ_CREDITS_ENABLED
+        // Fill the room in the TX queues, one request at a time otherwise.
+        while (queue_process(p_gatt_queue, conn_id))
+        {
+        }
+#else
+        UNUSED_RETURN_VALUE(queue_process(p_gatt_queue, conn_id));
+#endif
     }
 }
 
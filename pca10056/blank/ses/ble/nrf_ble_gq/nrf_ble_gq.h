@@ -57,8 +57,10 @@
 #include <stdint.h>
 #include "sdk_common.h"
 #include "nrf_memobj.h"
+#include "nrf_balloc_idx.h"
 #include "nrf_queue.h"
 #include "nrf_sdh_ble.h"
+#include "nrf_mem_telemetry.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -100,14 +102,17 @@ extern "C" {
     NRF_QUEUE_DEF(uint16_t, CONCAT_2(_name, purge_queue), _max_connections,                            \
                   NRF_QUEUE_MODE_NO_OVERFLOW);                                                         \
     NRF_MEMOBJ_POOL_DEF(CONCAT_2(_name, pool), _pool_elem_size, _pool_elem_count);                     \
+    NRF_BLE_GQ_LINKS_DEF(_name, _max_connections)                                                      \
     static nrf_ble_gq_t _name =                                                                        \
     {                                                                                                  \
         .max_conns      = (_max_connections),                                                          \
         .p_conn_handles = CONCAT_2(_name, conn_handles_arr),                                           \
         .p_req_queue    = CONCAT_2(_name, req_queue),                                                  \
         .p_purge_queue  = &CONCAT_2(_name, purge_queue),                                               \
-        .p_data_pool    = &CONCAT_2(_name, pool)                                                       \
+        .p_data_pool    = &CONCAT_2(_name, pool),                                                      \
+        NRF_BLE_GQ_LINKS_INIT(_name)                                                                   \
     };                                                                                                 \
+    NRF_BLE_GQ_MEM_TELEMETRY_DEF(_name)                                                                \
     NRF_SDH_BLE_OBSERVER(_name ## _obs,                                                                \
                          NRF_BLE_GQ_BLE_OBSERVER_PRIO,                                                 \
                          nrf_ble_gq_on_ble_evt, &_name)
@@ -121,6 +126,40 @@ extern "C" {
  */
 #define NRF_BLE_GQ_CONN_HANDLE_INIT(_arg) BLE_CONN_HANDLE_INVALID,
 
+/**@brief Whether nrf_ble_gq_t instances keep a state per registered connection. */
+#define NRF_BLE_GQ_LINKS_ENABLED (NRF_BLE_GQ_SCHED_ENABLED || NRF_BLE_GQ_CREDITS_ENABLED)
+
+#if NRF_BLE_GQ_LINKS_ENABLED
+/**@brief Helping macro used to define the state of connections for nrf_ble_gq_t instance.
+ *        Used in @ref NRF_BLE_GQ_CUSTOM_DEF.
+ */
+#define NRF_BLE_GQ_LINKS_DEF(_name, _max_connections) \
+    static nrf_ble_gq_link_t CONCAT_2(_name, links_arr)[(_max_connections)];
+
+/**@brief Helping macro used to initialize the connection state field of nrf_ble_gq_t instance.
+ *        Used in @ref NRF_BLE_GQ_CUSTOM_DEF.
+ */
+#define NRF_BLE_GQ_LINKS_INIT(_name) .p_links = CONCAT_2(_name, links_arr),
+#else
+#define NRF_BLE_GQ_LINKS_DEF(_name, _max_connections)
+#define NRF_BLE_GQ_LINKS_INIT(_name)
+#endif // NRF_BLE_GQ_LINKS_ENABLED
+
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+/**@brief Helping macro used to register the request queues of nrf_ble_gq_t instance with
+ *        @ref nrf_mem_telemetry. Used in @ref NRF_BLE_GQ_CUSTOM_DEF.
+ */
+#define NRF_BLE_GQ_MEM_TELEMETRY_DEF(_name)                                    \
+    NRF_MEM_TELEMETRY_SOURCE_DEF(_name,                                         \
+                                 STRINGIFY(_name),                              \
+                                 &_name,                                        \
+                                 NRF_MEM_TELEMETRY_UNIT_ELEMENTS,               \
+                                 nrf_ble_gq_mem_telemetry_usage_get,            \
+                                 nrf_ble_gq_mem_telemetry_reset);
+#else
+#define NRF_BLE_GQ_MEM_TELEMETRY_DEF(_name)
+#endif // NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+
 /**@brief BLE GATT request types. */
 typedef enum
 {
@@ -178,6 +217,9 @@ typedef struct
     nrf_ble_gq_req_type_t            type;          /**< Type of request. */
     nrf_memobj_t                   * p_mem_obj;     /**< Memory object for data that cannot be contained in request descriptor. */
     nrf_ble_gq_req_error_handler_t   error_handler; /**< Error handler structure. */
+#if NRF_BLE_GQ_INLINE_DATA_LEN
+    uint8_t                          inline_data[NRF_BLE_GQ_INLINE_DATA_LEN + sizeof(uint16_t)]; /**< Data of a queued request that is short enough to be held in the descriptor. Laid out as in the memory object. Used when p_mem_obj is NULL. */
+#endif
     union
     {
         nrf_ble_gq_gattc_read_t          gattc_read;      /**< GATTC read parameters. Filled when nrf_ble_gq_req_t::type is @ref NRF_BLE_GQ_REQ_GATTC_READ. */
@@ -189,6 +231,21 @@ typedef struct
     } params;
 } nrf_ble_gq_req_t;
 
+/**@brief State of a registered connection. */
+typedef struct
+{
+#if NRF_BLE_GQ_SCHED_ENABLED
+    uint16_t deficit;              /**< Number of requests the connection may still issue in the current round. */
+    uint8_t  quantum;              /**< Number of requests added to the deficit every round. */
+#endif
+#if NRF_BLE_GQ_CREDITS_ENABLED
+    uint8_t  write_cmd_queue_size; /**< Size of the SoftDevice write command TX queue. */
+    uint8_t  write_cmd_credits;    /**< Number of free places in the write command TX queue. */
+    uint8_t  hvn_queue_size;       /**< Size of the SoftDevice notification TX queue. */
+    uint8_t  hvn_credits;          /**< Number of free places in the notification TX queue. */
+#endif
+} nrf_ble_gq_link_t;
+
 /**@brief Descriptor for the BLE GATT Queue instance. */
 typedef struct
 {
@@ -197,8 +254,42 @@ typedef struct
     nrf_queue_t const * const p_req_queue;    /**< Pointer to array of queue instances used to hold nrf_ble_gq_req_t instances.*/
     nrf_queue_t const * const p_purge_queue;  /**< Pointer to the queue instance used to hold indexes of queues to purge.*/
     nrf_memobj_pool_t const * p_data_pool;    /**< Memory pool used to obtain nrf_memobj_t instances.*/
+#if NRF_BLE_GQ_COALESCE_ENABLED
+    uint32_t                  coalesce_mask;  /**< Request types that are coalesced. See @ref nrf_ble_gq_coalesce_set. */
+#endif
+#if NRF_BLE_GQ_LINKS_ENABLED
+    nrf_ble_gq_link_t       * p_links;        /**< Pointer to array with state of registered connections. */
+#endif
+#if NRF_BLE_GQ_SCHED_ENABLED
+    uint16_t                  sched_first_id; /**< ID of the connection served first in the next round. */
+#endif
 } nrf_ble_gq_t;
 
+/**@brief Coalescing of @ref NRF_BLE_GQ_REQ_GATTC_READ requests.
+ *
+ * @details A read of the same handle and offset as a queued one is dropped. Its error handler
+ *          is used if the queued read has none. Reads with different error handlers are not
+ *          merged, so that each requester is notified of a failure. The read response event is
+ *          received by all BLE observers.
+ */
+#define NRF_BLE_GQ_COALESCE_GATTC_READ  (1UL << NRF_BLE_GQ_REQ_GATTC_READ)
+
+/**@brief Coalescing of @ref NRF_BLE_GQ_REQ_GATTC_WRITE requests.
+ *
+ * @details A write request or command to offset 0 of the same handle as a queued one, for
+ *          example a CCCD write, replaces the payload of the queued one. The error handler of
+ *          the later request is used if the queued write has none. Writes with different error
+ *          handlers are not merged. Prepared writes are never merged.
+ */
+#define NRF_BLE_GQ_COALESCE_GATTC_WRITE (1UL << NRF_BLE_GQ_REQ_GATTC_WRITE)
+
+/**@brief Coalescing of @ref NRF_BLE_GQ_REQ_GATTS_HVX requests.
+ *
+ * @details A notification of the same handle as a queued one replaces its value. Indications
+ *          are never merged.
+ */
+#define NRF_BLE_GQ_COALESCE_GATTS_HVX   (1UL << NRF_BLE_GQ_REQ_GATTS_HVX)
+
 
 /**@brief Function for adding a GATT request to the BGQ instance.
  *
@@ -223,6 +314,27 @@ ret_code_t nrf_ble_gq_item_add(nrf_ble_gq_t const * const p_gatt_queue,
                                uint16_t                   conn_handle);
 
 
+#if NRF_BLE_GQ_COALESCE_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief Function for selecting request types that are coalesced in the BGQ instance.
+ *
+ * @details When a request of a selected type is added while an equivalent request for the same
+ *          connection is already queued, the queued request is updated instead of adding
+ *          another one. Queue order is kept. The request at the front of the queue may already
+ *          be being sent and is never updated. By default, no request types are coalesced.
+ *
+ * @param[in] p_gatt_queue  Pointer to the BGQ instance.
+ * @param[in] mask          Bitwise OR of @ref NRF_BLE_GQ_COALESCE_GATTC_READ,
+ *                          @ref NRF_BLE_GQ_COALESCE_GATTC_WRITE and
+ *                          @ref NRF_BLE_GQ_COALESCE_GATTS_HVX, or 0.
+ *
+ * @retval    NRF_SUCCESS             If the mask was set.
+ * @retval    NRF_ERROR_NULL          If \p p_gatt_queue was NULL.
+ * @retval    NRF_ERROR_INVALID_PARAM If \p mask selects a request type that cannot be coalesced.
+ */
+ret_code_t nrf_ble_gq_coalesce_set(nrf_ble_gq_t * const p_gatt_queue, uint32_t mask);
+#endif // NRF_BLE_GQ_COALESCE_ENABLED
+
+
 /**@brief Function for registering connection handle in the BGQ instance.
  *
  * @details This function is used for registering connection handle in the BGQ instance. From this
@@ -239,6 +351,59 @@ ret_code_t nrf_ble_gq_item_add(nrf_ble_gq_t const * const p_gatt_queue,
 ret_code_t nrf_ble_gq_conn_handle_register(nrf_ble_gq_t * const p_gatt_queue, uint16_t conn_handle);
 
 
+#if NRF_BLE_GQ_SCHED_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief Function for setting the scheduling quantum of a connection.
+ *
+ * @details On every GATT event, the queues of all registered connections are processed in
+ *          deficit round-robin order. In each round, a connection may issue up to its quantum of
+ *          requests, plus the part of the previous quantum it could not use because the
+ *          SoftDevice was busy. A chatty connection then cannot hold up the queues of the other
+ *          ones, and a connection with a larger quantum gets a larger share. The quantum is reset
+ *          to NRF_BLE_GQ_SCHED_DEFAULT_QUANTUM when the connection handle is registered.
+ *          With NRF_BLE_GQ_CREDITS_ENABLED, a quantum at least as large as the TX queues of the
+ *          connection lets write commands and notifications fill them in one round.
+ *
+ * @param[in] p_gatt_queue  Pointer to the BGQ instance.
+ * @param[in] conn_handle   Registered connection handle.
+ * @param[in] quantum       Number of requests per round, at least one.
+ *
+ * @retval    NRF_SUCCESS             If the quantum was set.
+ * @retval    NRF_ERROR_NULL          If \p p_gatt_queue was NULL.
+ * @retval    NRF_ERROR_INVALID_PARAM If \p conn_handle is not registered or \p quantum is 0.
+ */
+ret_code_t nrf_ble_gq_conn_quantum_set(nrf_ble_gq_t * const p_gatt_queue,
+                                       uint16_t             conn_handle,
+                                       uint8_t              quantum);
+#endif // NRF_BLE_GQ_SCHED_ENABLED
+
+
+#if NRF_BLE_GQ_CREDITS_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief Function for setting the SoftDevice TX queue sizes of a connection.
+ *
+ * @details Write commands and notifications are sent without waiting for the previous one to
+ *          be transmitted while there is room in the SoftDevice TX queue of the connection.
+ *          The room is tracked from the number of packets sent and the count reported by the
+ *          BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE and BLE_GATTS_EVT_HVN_TX_COMPLETE events. The sizes
+ *          are reset to NRF_BLE_GQ_WRITE_CMD_TX_QUEUE_SIZE and NRF_BLE_GQ_HVN_TX_QUEUE_SIZE when
+ *          the connection handle is registered. Call this function right after registration if
+ *          the connection uses a different configuration.
+ *
+ * @param[in] p_gatt_queue        Pointer to the BGQ instance.
+ * @param[in] conn_handle         Registered connection handle.
+ * @param[in] write_cmd_tx_queue  write_cmd_tx_queue_size of the connection configuration.
+ * @param[in] hvn_tx_queue        hvn_tx_queue_size of the connection configuration.
+ *
+ * @retval    NRF_SUCCESS             If the sizes were set.
+ * @retval    NRF_ERROR_NULL          If \p p_gatt_queue was NULL.
+ * @retval    NRF_ERROR_INVALID_PARAM If \p conn_handle is not registered or a size is 0.
+ */
+ret_code_t nrf_ble_gq_conn_tx_queue_size_set(nrf_ble_gq_t * const p_gatt_queue,
+                                             uint16_t             conn_handle,
+                                             uint8_t              write_cmd_tx_queue,
+                                             uint8_t              hvn_tx_queue);
+#endif // NRF_BLE_GQ_CREDITS_ENABLED
+
+
 /**@brief     Function for handling BLE events from the SoftDevice.
  *
  * @details   This function handles the BLE events received from the SoftDevice. If a BLE
@@ -251,6 +416,26 @@ ret_code_t nrf_ble_gq_conn_handle_register(nrf_ble_gq_t * const p_gatt_queue, ui
 void nrf_ble_gq_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
 
 
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+/**@brief   Function for getting the use of the request queues of a BGQ instance.
+ *
+ * @details The queues of all connections are summed. The high-water mark is the sum of the
+ *          highest use of each queue. Used by @ref NRF_BLE_GQ_CUSTOM_DEF.
+ *
+ * @param[in]  p_object  Pointer to the BGQ instance.
+ * @param[out] p_stats   Use of the queues.
+ */
+void nrf_ble_gq_mem_telemetry_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats);
+
+
+/**@brief   Function for clearing the highest use of the request queues of a BGQ instance.
+ *
+ * @param[in]  p_object  Pointer to the BGQ instance.
+ */
+void nrf_ble_gq_mem_telemetry_reset(void const * p_object);
+#endif // NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+
+
 #ifdef __cplusplus
 }
 #endif
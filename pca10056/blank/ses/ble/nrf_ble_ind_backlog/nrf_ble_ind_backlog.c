@@ -0,0 +1,535 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_IND_BACKLOG)
+#include "nrf_ble_ind_backlog.h"
+#include <string.h>
+#include "ble_conn_params.h"
+
+#define NRF_LOG_MODULE_NAME nrf_ble_ind_backlog
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+
+/**@brief Function for forwarding SoftDevice errors to the application.
+ *
+ * @param[in] nrf_error    Error code returned by SoftDevice.
+ * @param[in] p_backlog    Stored measurement backlog structure.
+ */
+static void error_forward(uint32_t nrf_error, nrf_ble_ind_backlog_t const * p_backlog)
+{
+    if (p_backlog->error_handler != NULL)
+    {
+        p_backlog->error_handler(nrf_error);
+    }
+}
+
+
+/**@brief Function for finding out if a service must be sent on the current link.
+ *
+ * @details The CCCD value is only valid once the system attributes of the peer have been set,
+ *          which may happen after the Connect event. The read is tried again on the next
+ *          attempt to send until it succeeds.
+ *
+ * @param[in]   p_backlog   Stored measurement backlog structure.
+ * @param[in]   p_srv       Backlog of the service.
+ *
+ * @return      True if the collector has enabled the characteristic.
+ */
+static bool srv_is_enabled(nrf_ble_ind_backlog_t const * p_backlog, nrf_ble_ind_backlog_srv_t * p_srv)
+{
+    uint8_t           cccd[BLE_CCCD_VALUE_LEN];
+    ble_gatts_value_t gatts_value;
+
+    if (p_srv->cccd_known)
+    {
+        return p_srv->is_enabled;
+    }
+
+    memset(&gatts_value, 0, sizeof(gatts_value));
+
+    gatts_value.len     = sizeof(cccd);
+    gatts_value.offset  = 0;
+    gatts_value.p_value = cccd;
+
+    if (sd_ble_gatts_value_get(p_backlog->conn_handle, p_srv->cccd_handle, &gatts_value) == NRF_SUCCESS)
+    {
+        p_srv->is_enabled = (p_srv->hvx_type == BLE_GATT_HVX_INDICATION) ?
+                            ble_srv_is_indication_enabled(cccd) :
+                            ble_srv_is_notification_enabled(cccd);
+        p_srv->cccd_known = true;
+    }
+
+    return p_srv->cccd_known && p_srv->is_enabled;
+}
+
+
+/**@brief Function for removing the oldest measurement from the backlog of a service.
+ *
+ * @param[in]   p_backlog   Stored measurement backlog structure.
+ * @param[in]   p_srv       Backlog of the service.
+ */
+static void srv_pop(nrf_ble_ind_backlog_t const * p_backlog, nrf_ble_ind_backlog_srv_t * p_srv)
+{
+    p_srv->head = (uint8_t)((p_srv->head + 1) % p_srv->depth);
+    p_srv->count--;
+
+    if ((p_srv->count == 0) && (p_backlog->evt_handler != NULL))
+    {
+        nrf_ble_ind_backlog_evt_t evt;
+
+        evt.evt_type = NRF_BLE_IND_BACKLOG_EVT_SRV_EMPTY;
+        evt.p_srv    = p_srv;
+
+        p_backlog->evt_handler(&evt);
+    }
+}
+
+
+/**@brief Function for sending the oldest measurement of a service.
+ *
+ * @param[in]   p_backlog   Stored measurement backlog structure.
+ * @param[in]   p_srv       Backlog of the service.
+ *
+ * @return      Error code returned by @ref sd_ble_gatts_hvx, or NRF_ERROR_DATA_SIZE if the
+ *              measurement was truncated.
+ */
+static uint32_t hvx_send(nrf_ble_ind_backlog_t const * p_backlog, nrf_ble_ind_backlog_srv_t * p_srv)
+{
+    uint32_t               err_code;
+    uint16_t               len     = p_srv->p_len[p_srv->head];
+    uint16_t               hvx_len = len;
+    ble_gatts_hvx_params_t hvx_params;
+
+    memset(&hvx_params, 0, sizeof(hvx_params));
+
+    hvx_params.handle = p_srv->value_handle;
+    hvx_params.type   = p_srv->hvx_type;
+    hvx_params.offset = 0;
+    hvx_params.p_len  = &hvx_len;
+    hvx_params.p_data = p_srv->p_data[p_srv->head];
+
+    err_code = sd_ble_gatts_hvx(p_backlog->conn_handle, &hvx_params);
+    if ((err_code == NRF_SUCCESS) && (hvx_len != len))
+    {
+        err_code = NRF_ERROR_DATA_SIZE;
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for handling an error returned when sending a measurement.
+ *
+ * @param[in]   p_backlog   Stored measurement backlog structure.
+ * @param[in]   p_srv       Backlog of the service.
+ * @param[in]   err_code    Error code returned by @ref hvx_send.
+ *
+ * @return      True if the measurement was removed from the backlog.
+ */
+static bool hvx_error_handle(nrf_ble_ind_backlog_t     * p_backlog,
+                             nrf_ble_ind_backlog_srv_t * p_srv,
+                             uint32_t                    err_code)
+{
+    switch (err_code)
+    {
+        case NRF_ERROR_BUSY:
+            // Another indication is in progress on the link. Sending resumes on its confirmation.
+        case NRF_ERROR_RESOURCES:
+            // The SoftDevice queue is full. Sending resumes on BLE_GATTS_EVT_HVN_TX_COMPLETE.
+            return false;
+
+        case NRF_ERROR_TIMEOUT:
+            // An ATT timeout occurred. The measurement is sent again on the next link.
+            return false;
+
+        case BLE_ERROR_GATTS_SYS_ATTR_MISSING:
+            p_srv->cccd_known = false;
+            return false;
+
+        case NRF_ERROR_INVALID_STATE:
+            // The characteristic was disabled. Sending resumes once the collector enables it.
+            p_srv->is_enabled = false;
+            return false;
+
+        default:
+            // The measurement cannot be sent, drop it so it does not block the backlog.
+            NRF_LOG_DEBUG("Dropping measurement of handle 0x%04X: 0x%08X.", p_srv->value_handle, err_code);
+            error_forward(err_code, p_backlog);
+            srv_pop(p_backlog, p_srv);
+            return true;
+    }
+}
+
+
+/**@brief Function for reporting the number of waiting measurements to @ref ble_conn_params.
+ *
+ * @param[in]   p_backlog   Stored measurement backlog structure.
+ */
+static void demand_update(nrf_ble_ind_backlog_t * p_backlog)
+{
+    uint32_t err_code = NRF_ERROR_INVALID_STATE;
+    uint32_t demand   = 0;
+
+    for (uint8_t i = 0; i < p_backlog->srv_count; i++)
+    {
+        demand += p_backlog->p_srv[i]->count;
+    }
+
+    if ((p_backlog->conn_handle == BLE_CONN_HANDLE_INVALID) || (demand == p_backlog->reported_demand))
+    {
+        return;
+    }
+
+#if (NRF_BLE_CONN_PARAMS_ADAPTIVE_ENABLED == 1)
+    err_code = ble_conn_params_adaptive_demand_set(p_backlog->conn_handle,
+                                                   (uint16_t)MIN(demand, UINT16_MAX));
+#endif
+
+    // Without the adaptive mode, switch between the fast and the preferred parameters.
+    if ((err_code == NRF_ERROR_INVALID_STATE) && (p_backlog->p_fast_conn_params != NULL))
+    {
+        err_code = NRF_SUCCESS;
+
+        if ((demand == 0) != (p_backlog->reported_demand == 0))
+        {
+            err_code = ble_conn_params_change_conn_params(
+                           p_backlog->conn_handle,
+                           (demand != 0) ? (ble_gap_conn_params_t *)p_backlog->p_fast_conn_params : NULL);
+        }
+    }
+
+    if ((err_code == NRF_SUCCESS) || (err_code == NRF_ERROR_INVALID_STATE))
+    {
+        p_backlog->reported_demand = demand;
+    }
+    else if (err_code != NRF_ERROR_BUSY)
+    {
+        error_forward(err_code, p_backlog);
+    }
+}
+
+
+/**@brief Function for sending as much of the backlog as the link allows.
+ *
+ * @details Notifications are sent until the SoftDevice queue is full. One indication is sent,
+ *          starting with the service after the one that sent the previous indication.
+ *
+ * @param[in]   p_backlog   Stored measurement backlog structure.
+ */
+static void backlog_send(nrf_ble_ind_backlog_t * p_backlog)
+{
+    uint32_t err_code;
+
+    if (p_backlog->conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < p_backlog->srv_count; i++)
+    {
+        uint8_t                     srv_idx = (uint8_t)((p_backlog->next_srv + i) % p_backlog->srv_count);
+        nrf_ble_ind_backlog_srv_t * p_srv   = p_backlog->p_srv[srv_idx];
+
+        if ((p_srv->count == 0) || !srv_is_enabled(p_backlog, p_srv))
+        {
+            continue;
+        }
+
+        if (p_srv->hvx_type == BLE_GATT_HVX_NOTIFICATION)
+        {
+            do
+            {
+                err_code = hvx_send(p_backlog, p_srv);
+                if (err_code == NRF_SUCCESS)
+                {
+                    srv_pop(p_backlog, p_srv);
+                }
+                else if (!hvx_error_handle(p_backlog, p_srv, err_code))
+                {
+                    break;
+                }
+            } while (p_srv->count != 0);
+        }
+        else if (p_backlog->p_ind_srv == NULL)
+        {
+            // The measurement stays in the backlog until it is confirmed.
+            err_code = hvx_send(p_backlog, p_srv);
+            if (err_code == NRF_SUCCESS)
+            {
+                p_backlog->p_ind_srv = p_srv;
+                p_backlog->next_srv  = (uint8_t)((srv_idx + 1) % p_backlog->srv_count);
+            }
+            else
+            {
+                (void)hvx_error_handle(p_backlog, p_srv, err_code);
+            }
+        }
+    }
+
+    demand_update(p_backlog);
+}
+
+
+/**@brief Function for handling write events to the CCCDs of the registered services.
+ *
+ * @param[in]   p_backlog   Stored measurement backlog structure.
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ */
+static void on_write(nrf_ble_ind_backlog_t * p_backlog, ble_evt_t const * p_ble_evt)
+{
+    ble_gatts_evt_write_t const * p_evt_write = &p_ble_evt->evt.gatts_evt.params.write;
+
+    if (   (p_ble_evt->evt.gatts_evt.conn_handle != p_backlog->conn_handle)
+        || (p_evt_write->len != BLE_CCCD_VALUE_LEN))
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < p_backlog->srv_count; i++)
+    {
+        nrf_ble_ind_backlog_srv_t * p_srv = p_backlog->p_srv[i];
+
+        if (p_evt_write->handle == p_srv->cccd_handle)
+        {
+            p_srv->is_enabled = (p_srv->hvx_type == BLE_GATT_HVX_INDICATION) ?
+                                ble_srv_is_indication_enabled(p_evt_write->data) :
+                                ble_srv_is_notification_enabled(p_evt_write->data);
+            p_srv->cccd_known = true;
+
+            if (p_srv->is_enabled)
+            {
+                backlog_send(p_backlog);
+            }
+            return;
+        }
+    }
+}
+
+
+/**@brief Function for forgetting the state of the link.
+ *
+ * @details A measurement whose indication was not confirmed stays in the backlog.
+ *
+ * @param[in]   p_backlog   Stored measurement backlog structure.
+ */
+static void link_reset(nrf_ble_ind_backlog_t * p_backlog)
+{
+    p_backlog->p_ind_srv       = NULL;
+    p_backlog->reported_demand = 0;
+
+    for (uint8_t i = 0; i < p_backlog->srv_count; i++)
+    {
+        p_backlog->p_srv[i]->cccd_known = false;
+        p_backlog->p_srv[i]->is_enabled = false;
+    }
+}
+
+
+ret_code_t nrf_ble_ind_backlog_init(nrf_ble_ind_backlog_t            * p_backlog,
+                                    nrf_ble_ind_backlog_init_t const * p_backlog_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_backlog);
+    VERIFY_PARAM_NOT_NULL(p_backlog_init);
+
+    memset(p_backlog, 0, sizeof(nrf_ble_ind_backlog_t));
+
+    p_backlog->conn_handle        = BLE_CONN_HANDLE_INVALID;
+    p_backlog->p_fast_conn_params = p_backlog_init->p_fast_conn_params;
+    p_backlog->evt_handler        = p_backlog_init->evt_handler;
+    p_backlog->error_handler      = p_backlog_init->error_handler;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_ble_ind_backlog_srv_register(nrf_ble_ind_backlog_t          * p_backlog,
+                                            nrf_ble_ind_backlog_srv_t      * p_srv,
+                                            ble_gatts_char_handles_t const * p_handles,
+                                            uint8_t                          hvx_type)
+{
+    VERIFY_PARAM_NOT_NULL(p_backlog);
+    VERIFY_PARAM_NOT_NULL(p_srv);
+    VERIFY_PARAM_NOT_NULL(p_handles);
+
+    if ((hvx_type != BLE_GATT_HVX_INDICATION) && (hvx_type != BLE_GATT_HVX_NOTIFICATION))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if (p_backlog->srv_count >= NRF_BLE_IND_BACKLOG_MAX_SERVICES)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    p_srv->head         = 0;
+    p_srv->count        = 0;
+    p_srv->value_handle = p_handles->value_handle;
+    p_srv->cccd_handle  = p_handles->cccd_handle;
+    p_srv->hvx_type     = hvx_type;
+    p_srv->cccd_known   = false;
+    p_srv->is_enabled   = false;
+
+    p_backlog->p_srv[p_backlog->srv_count++] = p_srv;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_ble_ind_backlog_push(nrf_ble_ind_backlog_t     * p_backlog,
+                                    nrf_ble_ind_backlog_srv_t * p_srv,
+                                    uint8_t const             * p_data,
+                                    uint16_t                    len)
+{
+    uint8_t idx;
+
+    VERIFY_PARAM_NOT_NULL(p_backlog);
+    VERIFY_PARAM_NOT_NULL(p_srv);
+    VERIFY_PARAM_NOT_NULL(p_data);
+
+    if ((len == 0) || (len > NRF_BLE_IND_BACKLOG_MAX_DATA_LEN))
+    {
+        return NRF_ERROR_DATA_SIZE;
+    }
+
+    if (p_srv->count >= p_srv->depth)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    idx = (uint8_t)((p_srv->head + p_srv->count) % p_srv->depth);
+
+    memcpy(p_srv->p_data[idx], p_data, len);
+    p_srv->p_len[idx] = len;
+    p_srv->count++;
+
+    backlog_send(p_backlog);
+
+    return NRF_SUCCESS;
+}
+
+
+uint8_t nrf_ble_ind_backlog_count_get(nrf_ble_ind_backlog_srv_t const * p_srv)
+{
+    return (p_srv == NULL) ? 0 : p_srv->count;
+}
+
+
+void nrf_ble_ind_backlog_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    nrf_ble_ind_backlog_t * p_backlog = (nrf_ble_ind_backlog_t *)p_context;
+
+    if ((p_backlog == NULL) || (p_ble_evt == NULL))
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_CONNECTED:
+            if (p_backlog->conn_handle == BLE_CONN_HANDLE_INVALID)
+            {
+                p_backlog->conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
+                link_reset(p_backlog);
+                backlog_send(p_backlog);
+            }
+            break;
+
+        case BLE_GAP_EVT_DISCONNECTED:
+            if (p_ble_evt->evt.gap_evt.conn_handle == p_backlog->conn_handle)
+            {
+                p_backlog->conn_handle = BLE_CONN_HANDLE_INVALID;
+                link_reset(p_backlog);
+            }
+            break;
+
+        case BLE_GAP_EVT_CONN_SEC_UPDATE:
+            // The system attributes of a bonded peer may have been set meanwhile.
+            if (p_ble_evt->evt.gap_evt.conn_handle == p_backlog->conn_handle)
+            {
+                backlog_send(p_backlog);
+            }
+            break;
+
+        case BLE_GATTS_EVT_WRITE:
+            on_write(p_backlog, p_ble_evt);
+            break;
+
+        case BLE_GATTS_EVT_HVC:
+            if (p_ble_evt->evt.gatts_evt.conn_handle != p_backlog->conn_handle)
+            {
+                break;
+            }
+
+            if (   (p_backlog->p_ind_srv != NULL)
+                && (p_ble_evt->evt.gatts_evt.params.hvc.handle == p_backlog->p_ind_srv->value_handle))
+            {
+                nrf_ble_ind_backlog_srv_t * p_srv = p_backlog->p_ind_srv;
+
+                p_backlog->p_ind_srv = NULL;
+                srv_pop(p_backlog, p_srv);
+            }
+
+            // Any confirmation frees the link for the next indication.
+            backlog_send(p_backlog);
+            break;
+
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+            if (p_ble_evt->evt.gatts_evt.conn_handle == p_backlog->conn_handle)
+            {
+                backlog_send(p_backlog);
+            }
+            break;
+
+        case BLE_GATTS_EVT_TIMEOUT:
+            // No more ATT traffic is possible on the link. The measurement is sent again on the next one.
+            if (p_ble_evt->evt.gatts_evt.conn_handle == p_backlog->conn_handle)
+            {
+                p_backlog->p_ind_srv = NULL;
+            }
+            break;
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BLE_IND_BACKLOG)
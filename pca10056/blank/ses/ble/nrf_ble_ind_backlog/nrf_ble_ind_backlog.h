@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ble_ind_backlog Stored measurement backlog
+ * @{
+ * @ingroup ble_sdk_lib
+ * @brief Module for sending the stored measurements of several services back-to-back.
+ *
+ * @details Services such as @ref ble_hts and @ref ble_bps send one measurement at a time and
+ *          leave it to the application to send the next one after the confirmation. Measurements
+ *          stored while the collector was away are then sent slowly, or lost if the application
+ *          cannot keep them. This module keeps a backlog of encoded measurements for each
+ *          registered service and sends them as soon as the collector has enabled the
+ *          characteristic:
+ *
+ *          - ATT allows one indication at a time on a link. The next indication is sent from the
+ *            confirmation of the previous one, without waiting for the application.
+ *          - The services with a backlog take turns, so one service with many measurements does
+ *            not hold back the others.
+ *          - Notifications (for example Glucose Measurements) are sent as long as the SoftDevice
+ *            has room for them, and continue on BLE_GATTS_EVT_HVN_TX_COMPLETE.
+ *          - While there is a backlog, the number of waiting measurements is reported to the
+ *            adaptive mode of @ref ble_conn_params, so the link moves to its active parameter set.
+ *            If the adaptive mode is not enabled, @ref nrf_ble_ind_backlog_init_t::p_fast_conn_params
+ *            is requested instead, and the preferred parameters are restored once the backlog is
+ *            sent.
+ *
+ *          Measurements are removed from the backlog once indicated and confirmed, or once
+ *          notified. The backlog is kept across disconnections, and sending resumes on the next
+ *          connection. While a service has a backlog, new measurements of that service should
+ *          also be added to the backlog, to keep them in order.
+ *
+ * @note    The application must register this module as BLE event observer, which is done by
+ *          @ref NRF_BLE_IND_BACKLOG_DEF.
+ */
+
+#ifndef NRF_BLE_IND_BACKLOG_H__
+#define NRF_BLE_IND_BACKLOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_common.h"
+#include "ble.h"
+#include "ble_gap.h"
+#include "ble_srv_common.h"
+#include "nrf_sdh_ble.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief   Macro for defining a nrf_ble_ind_backlog instance.
+ *
+ * @param   _name   Name of the instance.
+ * @hideinitializer
+ */
+#define NRF_BLE_IND_BACKLOG_DEF(_name)                          \
+    static nrf_ble_ind_backlog_t _name;                         \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                         \
+                         NRF_BLE_IND_BACKLOG_BLE_OBSERVER_PRIO, \
+                         nrf_ble_ind_backlog_on_ble_evt,        \
+                         &_name)
+
+/**@brief   Macro for defining the backlog of a service.
+ *
+ * @param   _name   Name of the service backlog.
+ * @param   _depth  Maximum number of measurements in the backlog.
+ * @hideinitializer
+ */
+#define NRF_BLE_IND_BACKLOG_SRV_DEF(_name, _depth)                                      \
+    STATIC_ASSERT(((_depth) > 0) && ((_depth) <= UINT8_MAX));                           \
+    static uint8_t  CONCAT_2(_name, _data)[(_depth)][NRF_BLE_IND_BACKLOG_MAX_DATA_LEN]; \
+    static uint16_t CONCAT_2(_name, _len)[(_depth)];                                    \
+    static nrf_ble_ind_backlog_srv_t _name =                                            \
+    {                                                                                   \
+        .p_data = CONCAT_2(_name, _data),                                               \
+        .p_len  = CONCAT_2(_name, _len),                                                \
+        .depth  = (_depth)                                                              \
+    }
+
+/**@brief Stored measurement backlog event types. */
+typedef enum
+{
+    NRF_BLE_IND_BACKLOG_EVT_SRV_EMPTY, //!< Event that indicates that the backlog of a service was sent. See @ref nrf_ble_ind_backlog_evt_t::p_srv.
+} nrf_ble_ind_backlog_evt_type_t;
+
+/**@brief Backlog of a service.
+ *
+ * @note The fields are set by @ref NRF_BLE_IND_BACKLOG_SRV_DEF and
+ *       @ref nrf_ble_ind_backlog_srv_register.
+ */
+typedef struct
+{
+    uint8_t     (* const p_data)[NRF_BLE_IND_BACKLOG_MAX_DATA_LEN]; //!< Encoded measurements.
+    uint16_t     * const p_len;                                     //!< Length of each encoded measurement.
+    uint8_t        const depth;                                     //!< Maximum number of measurements.
+    uint8_t              head;                                      //!< Index of the oldest measurement.
+    uint8_t              count;                                     //!< Number of measurements in the backlog.
+    uint16_t             value_handle;                              //!< Handle of the measurement characteristic value.
+    uint16_t             cccd_handle;                               //!< Handle of the CCCD of the measurement characteristic.
+    uint8_t              hvx_type;                                  //!< BLE_GATT_HVX_INDICATION or BLE_GATT_HVX_NOTIFICATION.
+    bool                 cccd_known;                                //!< True once the CCCD has been read on the current link.
+    bool                 is_enabled;                                //!< True if the characteristic is enabled on the current link.
+} nrf_ble_ind_backlog_srv_t;
+
+/**@brief Stored measurement backlog event. */
+typedef struct
+{
+    nrf_ble_ind_backlog_evt_type_t    evt_type; //!< Type of the event.
+    nrf_ble_ind_backlog_srv_t const * p_srv;    //!< Service whose backlog the event relates to.
+} nrf_ble_ind_backlog_evt_t;
+
+/**@brief Stored measurement backlog event handler type. */
+typedef void (* nrf_ble_ind_backlog_evt_handler_t)(nrf_ble_ind_backlog_evt_t const * p_evt);
+
+/**@brief Stored measurement backlog structure.
+ *
+ * @note The fields are internal, use the functions of the module to access them.
+ */
+typedef struct
+{
+    uint16_t                            conn_handle;                                   //!< Handle of the current connection, or BLE_CONN_HANDLE_INVALID.
+    nrf_ble_ind_backlog_srv_t         * p_srv[NRF_BLE_IND_BACKLOG_MAX_SERVICES];       //!< Registered services.
+    uint8_t                             srv_count;                                     //!< Number of registered services.
+    uint8_t                             next_srv;                                      //!< Service to be looked at first when the next indication is sent.
+    nrf_ble_ind_backlog_srv_t         * p_ind_srv;                                     //!< Service whose indication waits for confirmation, or NULL.
+    uint32_t                            reported_demand;                               //!< Number of waiting measurements last reported to @ref ble_conn_params.
+    ble_gap_conn_params_t const       * p_fast_conn_params;                            //!< Parameters requested while there is a backlog, if the adaptive mode is not used.
+    nrf_ble_ind_backlog_evt_handler_t   evt_handler;                                   //!< Function to be called for the events of the module.
+    ble_srv_error_handler_t             error_handler;                                 //!< Function to be called in case of an error.
+} nrf_ble_ind_backlog_t;
+
+/**@brief Stored measurement backlog init structure. */
+typedef struct
+{
+    ble_gap_conn_params_t const       * p_fast_conn_params; //!< Parameters to request while there is a backlog, if the adaptive mode of @ref ble_conn_params is not enabled. Can be NULL.
+    nrf_ble_ind_backlog_evt_handler_t   evt_handler;        //!< Function to be called for the events of the module. Can be NULL.
+    ble_srv_error_handler_t             error_handler;      //!< Function to be called in case of an error. Can be NULL.
+} nrf_ble_ind_backlog_init_t;
+
+
+/**@brief Function for initializing a stored measurement backlog.
+ *
+ * @param[out]  p_backlog      Stored measurement backlog structure.
+ * @param[in]   p_backlog_init Information needed to initialize the backlog.
+ *
+ * @retval NRF_SUCCESS    If the backlog was initialized.
+ * @retval NRF_ERROR_NULL If any of the input parameters are NULL.
+ */
+ret_code_t nrf_ble_ind_backlog_init(nrf_ble_ind_backlog_t            * p_backlog,
+                                    nrf_ble_ind_backlog_init_t const * p_backlog_init);
+
+
+/**@brief Function for registering the backlog of a service.
+ *
+ * @details Must be called after the service is initialized, and before any connection is
+ *          established.
+ *
+ * @param[in]   p_backlog  Stored measurement backlog structure.
+ * @param[in]   p_srv      Backlog of the service, defined with @ref NRF_BLE_IND_BACKLOG_SRV_DEF.
+ * @param[in]   p_handles  Handles of the measurement characteristic.
+ * @param[in]   hvx_type   BLE_GATT_HVX_INDICATION or BLE_GATT_HVX_NOTIFICATION.
+ *
+ * @retval NRF_SUCCESS             If the service was registered.
+ * @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If the HVX type is neither an indication nor a notification.
+ * @retval NRF_ERROR_NO_MEM        If NRF_BLE_IND_BACKLOG_MAX_SERVICES services are registered.
+ */
+ret_code_t nrf_ble_ind_backlog_srv_register(nrf_ble_ind_backlog_t          * p_backlog,
+                                            nrf_ble_ind_backlog_srv_t      * p_srv,
+                                            ble_gatts_char_handles_t const * p_handles,
+                                            uint8_t                          hvx_type);
+
+
+/**@brief Function for adding an encoded measurement to the backlog of a service.
+ *
+ * @details The measurement is sent at once if the collector is connected and has enabled the
+ *          characteristic.
+ *
+ * @param[in]   p_backlog  Stored measurement backlog structure.
+ * @param[in]   p_srv      Registered backlog of the service.
+ * @param[in]   p_data     Encoded measurement, in the format of the characteristic value.
+ * @param[in]   len        Length of the encoded measurement.
+ *
+ * @retval NRF_SUCCESS         If the measurement was added.
+ * @retval NRF_ERROR_NULL      If any of the input parameters are NULL.
+ * @retval NRF_ERROR_DATA_SIZE If the length is 0 or above NRF_BLE_IND_BACKLOG_MAX_DATA_LEN.
+ * @retval NRF_ERROR_NO_MEM    If the backlog of the service is full. The measurement is not added.
+ */
+ret_code_t nrf_ble_ind_backlog_push(nrf_ble_ind_backlog_t     * p_backlog,
+                                    nrf_ble_ind_backlog_srv_t * p_srv,
+                                    uint8_t const             * p_data,
+                                    uint16_t                    len);
+
+
+/**@brief Function for getting the number of measurements in the backlog of a service.
+ *
+ * @param[in]   p_srv      Backlog of the service.
+ *
+ * @return Number of measurements that were not sent yet, including one waiting for its
+ *         confirmation.
+ */
+uint8_t nrf_ble_ind_backlog_count_get(nrf_ble_ind_backlog_srv_t const * p_srv);
+
+
+/**@brief Function for handling the Application's BLE Stack events.
+ *
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ * @param[in]   p_context   Stored measurement backlog structure.
+ */
+void nrf_ble_ind_backlog_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BLE_IND_BACKLOG_H__
+
+/** @} */
@@ -68,6 +68,7 @@ ret_code_t nrf_ble_qwr_init(nrf_ble_qwr_t            * p_qwr,
     p_qwr->is_user_mem_reply_pending = false;
     p_qwr->mem_buffer                = p_qwr_init->mem_buffer;
     p_qwr->callback                  = p_qwr_init->callback;
+    p_qwr->streaming                 = p_qwr_init->streaming;
     p_qwr->nb_written_handles        = 0;
 #endif
     return NRF_SUCCESS;
@@ -81,8 +82,8 @@ ret_code_t nrf_ble_qwr_attr_register(nrf_ble_qwr_t * p_qwr, uint16_t attr_handle
     VERIFY_MODULE_INITIALIZED();
 
     if ((p_qwr->nb_registered_attr == NRF_BLE_QWR_MAX_ATTR)
-        || (p_qwr->mem_buffer.p_mem == NULL)
-        || (p_qwr->mem_buffer.len == 0))
+        || (!p_qwr->streaming && ((p_qwr->mem_buffer.p_mem == NULL)
+                               || (p_qwr->mem_buffer.len == 0))))
     {
         return (NRF_ERROR_NO_MEM);
     }
@@ -109,6 +110,11 @@ ret_code_t nrf_ble_qwr_value_get(nrf_ble_qwr_t * p_qwr,
     VERIFY_PARAM_NOT_NULL(p_len);
     VERIFY_MODULE_INITIALIZED();
 
+    if (p_qwr->streaming)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
     uint16_t i          = 0;
     uint16_t handle     = BLE_GATT_HANDLE_INVALID;
     uint16_t val_len    = 0;
@@ -175,7 +181,10 @@ static void user_mem_reply(nrf_ble_qwr_t * p_qwr)
 #if (NRF_BLE_QWR_MAX_ATTR == 0)
         err_code = sd_ble_user_mem_reply(p_qwr->conn_handle, NULL);
 #else
-        err_code = sd_ble_user_mem_reply(p_qwr->conn_handle, &p_qwr->mem_buffer);
+        // In streaming mode, replying without memory makes the SoftDevice forward every prepare
+        // write request to the application.
+        err_code = sd_ble_user_mem_reply(p_qwr->conn_handle,
+                                         p_qwr->streaming ? NULL : &p_qwr->mem_buffer);
 #endif
         if (err_code == NRF_SUCCESS)
         {
@@ -193,6 +202,32 @@ static void user_mem_reply(nrf_ble_qwr_t * p_qwr)
 }
 
 
+#if (NRF_BLE_QWR_MAX_ATTR > 0)
+/**@brief Cancel the current operation. In streaming mode, tell the application to discard the
+ *        data it kept for each written handle.
+ *
+ * @param[in]   p_qwr        QWR structure.
+ */
+static void queued_writes_cancel(nrf_ble_qwr_t * p_qwr)
+{
+    if (p_qwr->streaming)
+    {
+        for (uint16_t i = 0; i < p_qwr->nb_written_handles; i++)
+        {
+            nrf_ble_qwr_evt_t evt;
+            memset(&evt, 0, sizeof(evt));
+            evt.evt_type    = NRF_BLE_QWR_EVT_CANCEL_WRITE;
+            evt.attr_handle = p_qwr->written_attr_handles[i];
+            /*lint -e534 -save "Ignoring return value of function" */
+            p_qwr->callback(p_qwr, &evt);
+            /*lint -restore*/
+        }
+    }
+    p_qwr->nb_written_handles = 0;
+}
+#endif
+
+
 /**@brief Handle a user memory request event.
  *
  * @param[in]   p_qwr        QWR structure.
@@ -223,7 +258,7 @@ static void on_user_mem_release(nrf_ble_qwr_t          * p_qwr,
         (p_common_evt->conn_handle == p_qwr->conn_handle))
     {
         // Cancel the current operation.
-        p_qwr->nb_written_handles = 0;
+        queued_writes_cancel(p_qwr);
     }
 #endif
 }
@@ -269,11 +304,30 @@ static void on_prepare_write(nrf_ble_qwr_t               * p_qwr,
         }
     }
 
+    if (p_qwr->streaming && (auth_reply.params.write.gatt_status == BLE_GATT_STATUS_SUCCESS))
+    {
+        nrf_ble_qwr_evt_t evt;
+
+        evt.evt_type    = NRF_BLE_QWR_EVT_PREPARE_WRITE;
+        evt.attr_handle = p_evt_write->handle;
+        evt.offset      = p_evt_write->offset;
+        evt.len         = p_evt_write->len;
+        evt.p_data      = p_evt_write->data;
+
+        auth_reply.params.write.gatt_status = p_qwr->callback(p_qwr, &evt);
+
+        // The SoftDevice echoes the accepted data back to the peer in the prepare write response.
+        auth_reply.params.write.update = 1;
+        auth_reply.params.write.offset = p_evt_write->offset;
+        auth_reply.params.write.len    = p_evt_write->len;
+        auth_reply.params.write.p_data = p_evt_write->data;
+    }
+
     err_code = sd_ble_gatts_rw_authorize_reply(p_qwr->conn_handle, &auth_reply);
     if (err_code != NRF_SUCCESS)
     {
         // Cancel the current operation.
-        p_qwr->nb_written_handles = 0;
+        queued_writes_cancel(p_qwr);
 
         // Report error to application.
         p_qwr->error_handler(err_code);
@@ -314,6 +368,7 @@ static void on_execute_write(nrf_ble_qwr_t               * p_qwr,
         nrf_ble_qwr_evt_t evt;
         uint16_t          ret_val;
 
+        memset(&evt, 0, sizeof(evt));
         evt.evt_type    = NRF_BLE_QWR_EVT_AUTH_REQUEST;
         evt.attr_handle = p_qwr->written_attr_handles[i];
         ret_val         = p_qwr->callback(p_qwr, &evt);
@@ -336,6 +391,7 @@ static void on_execute_write(nrf_ble_qwr_t               * p_qwr,
         for (uint16_t i = 0; i < p_qwr->nb_written_handles; i++)
         {
             nrf_ble_qwr_evt_t evt;
+            memset(&evt, 0, sizeof(evt));
             evt.evt_type    = NRF_BLE_QWR_EVT_EXECUTE_WRITE;
             evt.attr_handle = p_qwr->written_attr_handles[i];
             /*lint -e534 -save "Ignoring return value of function" */
@@ -344,8 +400,12 @@ static void on_execute_write(nrf_ble_qwr_t               * p_qwr,
 
             auth_reply.params.write.gatt_status = BLE_GATT_STATUS_SUCCESS;
         }
+        p_qwr->nb_written_handles = 0;
+    }
+    else
+    {
+        queued_writes_cancel(p_qwr);
     }
-    p_qwr->nb_written_handles = 0;
 }
 
 
@@ -370,7 +430,7 @@ static void on_cancel_write(nrf_ble_qwr_t               * p_qwr,
         // Report error to application.
         p_qwr->error_handler(err_code);
     }
-    p_qwr->nb_written_handles = 0;
+    queued_writes_cancel(p_qwr);
 }
 #endif
 
@@ -475,7 +535,7 @@ void nrf_ble_qwr_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
             {
                 p_qwr->conn_handle = BLE_CONN_HANDLE_INVALID;
 #if (NRF_BLE_QWR_MAX_ATTR > 0)
-                p_qwr->nb_written_handles = 0;
+                queued_writes_cancel(p_qwr);
 #endif
             }
             break; // BLE_GAP_EVT_DISCONNECTED
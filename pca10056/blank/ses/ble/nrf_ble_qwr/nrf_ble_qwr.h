@@ -47,6 +47,12 @@
  * @details This module handles prepare write, execute write, and cancel write
  * commands. It also manages memory requests related to these operations.
  *
+ * By default, the SoftDevice queues the prepared writes in @ref nrf_ble_qwr_init_t::mem_buffer,
+ * which must be large enough for the longest queued write on the link. In streaming mode
+ * (@ref nrf_ble_qwr_init_t::streaming), no memory is given to the SoftDevice. Each prepared write
+ * is instead passed to the application in an @ref NRF_BLE_QWR_EVT_PREPARE_WRITE event as it
+ * arrives, so that it can be checked and appended to wherever the value is staged.
+ *
  * @note     The application must propagate BLE stack events to this module by calling
  *           @ref nrf_ble_qwr_on_ble_evt().
  */
@@ -99,6 +105,8 @@ typedef enum
 {
     NRF_BLE_QWR_EVT_EXECUTE_WRITE, //!< Event that indicates that an execute write command was received for a registered handle and that the received data was actually written and is now ready.
     NRF_BLE_QWR_EVT_AUTH_REQUEST,  //!< Event that indicates that an execute write command was received for a registered handle and that the write request must now be accepted or rejected.
+    NRF_BLE_QWR_EVT_PREPARE_WRITE, //!< Streaming mode only. Event that indicates that a prepare write request was received for a registered handle. The data must be accepted, and kept until the execute write, or rejected.
+    NRF_BLE_QWR_EVT_CANCEL_WRITE,  //!< Streaming mode only. Event that indicates that the queued writes to a registered handle were cancelled or rejected, so the data kept from @ref NRF_BLE_QWR_EVT_PREPARE_WRITE events must be discarded.
 } nrf_ble_qwr_evt_type_t;
 
 /**@brief Queued Writes module events. */
@@ -106,6 +114,9 @@ typedef struct
 {
     nrf_ble_qwr_evt_type_t evt_type;    //!< Type of the event.
     uint16_t               attr_handle; //!< Handle of the attribute to which the event relates.
+    uint16_t               offset;      //!< Offset of the data in the attribute value. Only for @ref NRF_BLE_QWR_EVT_PREPARE_WRITE.
+    uint16_t               len;         //!< Length of the data. Only for @ref NRF_BLE_QWR_EVT_PREPARE_WRITE.
+    uint8_t const        * p_data;      //!< The data. Only valid during the event. Only for @ref NRF_BLE_QWR_EVT_PREPARE_WRITE.
 } nrf_ble_qwr_evt_t;
 
 // Forward declaration of the nrf_ble_qwr_t type.
@@ -115,7 +126,8 @@ struct nrf_ble_qwr_t;
  *
  * If the provided event is of type @ref NRF_BLE_QWR_EVT_AUTH_REQUEST,
  * this function must accept or reject the execute write request by returning
- * one of the @ref BLE_GATT_STATUS_CODES.*/
+ * one of the @ref BLE_GATT_STATUS_CODES. The same applies to each prepared write in an
+ * @ref NRF_BLE_QWR_EVT_PREPARE_WRITE event.*/
 typedef uint16_t (* nrf_ble_qwr_evt_handler_t) (struct nrf_ble_qwr_t * p_qwr,
                                                 nrf_ble_qwr_evt_t    * p_evt);
 
@@ -134,6 +146,7 @@ typedef struct nrf_ble_qwr_t
     uint8_t                   nb_written_handles;                         //!< Number of attributes that have been written to during the current prepare write or execute write operation.
     ble_user_mem_block_t      mem_buffer;                                 //!< Memory buffer that is provided to the SoftDevice on an ON_USER_MEM_REQUEST event.
     nrf_ble_qwr_evt_handler_t callback;                                   //!< Event handler function that is called for events concerning the handles of all registered attributes.
+    bool                      streaming;                                  //!< Flag that indicates whether prepared writes are passed to the callback instead of being queued in mem_buffer.
 #endif
 } nrf_ble_qwr_t;
 
@@ -144,8 +157,9 @@ typedef struct
 {
     ble_srv_error_handler_t   error_handler; //!< Error handler.
 #if (NRF_BLE_QWR_MAX_ATTR > 0)
-    ble_user_mem_block_t      mem_buffer;    //!< Memory buffer that is provided to the SoftDevice on an ON_USER_MEM_REQUEST event.
+    ble_user_mem_block_t      mem_buffer;    //!< Memory buffer that is provided to the SoftDevice on an ON_USER_MEM_REQUEST event. Not used in streaming mode.
     nrf_ble_qwr_evt_handler_t callback;      //!< Event handler function that is called for events concerning the handles of all registered attributes.
+    bool                      streaming;     //!< Pass each prepared write to the callback in an @ref NRF_BLE_QWR_EVT_PREPARE_WRITE event, instead of having the SoftDevice queue them in mem_buffer.
 #endif
 } nrf_ble_qwr_init_t;
 
@@ -207,7 +221,8 @@ void nrf_ble_qwr_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
  * @param[in]  attr_handle Handle of the attribute to register.
  *
  * @retval NRF_SUCCESS             If the registration was successful.
- * @retval NRF_ERROR_NO_MEM        If no more memory is available to add this registration.
+ * @retval NRF_ERROR_NO_MEM        If no more memory is available to add this registration, or if
+ *                                 no memory buffer was given and streaming mode is not used.
  * @retval NRF_ERROR_NULL          If any of the given pointers is NULL.
  * @retval NRF_ERROR_INVALID_STATE If the given context has not been initialized.
  */
@@ -228,7 +243,8 @@ ret_code_t nrf_ble_qwr_attr_register(nrf_ble_qwr_t * p_qwr, uint16_t attr_handle
  * @retval NRF_SUCCESS             If the data was retrieved and stored successfully.
  * @retval NRF_ERROR_NO_MEM        If the provided buffer was smaller than the received data.
  * @retval NRF_ERROR_NULL          If any of the given pointers is NULL.
- * @retval NRF_ERROR_INVALID_STATE If the given context has not been initialized.
+ * @retval NRF_ERROR_INVALID_STATE If the given context has not been initialized, or if it uses
+ *                                 streaming mode, where the module does not keep the data.
  */
 ret_code_t nrf_ble_qwr_value_get(nrf_ble_qwr_t * p_qwr,
                                  uint16_t        attr_handle,
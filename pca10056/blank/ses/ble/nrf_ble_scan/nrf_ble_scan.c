@@ -51,11 +51,264 @@
 #include "nrf_assert.h"
 #include "sdk_macros.h"
 #include "ble_advdata.h"
+#if (NRF_BLE_SCAN_DEDUP_ENABLED == 1) || (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+#include "app_timer.h"
+#endif
+#if (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+#include "ble_conn_state.h"
+#endif
 
 #define NRF_LOG_MODULE_NAME ble_scan
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
 
+/**@brief Whether the static configuration scans on Coded PHY. */
+#define SCAN_PHY_CODED_USED ((NRF_BLE_SCAN_SCAN_PHY != BLE_GAP_PHY_NOT_SET) && \
+                             (NRF_BLE_SCAN_SCAN_PHY & BLE_GAP_PHY_CODED))
+
+#if SCAN_PHY_CODED_USED && (NRF_BLE_SCAN_BUFFER < BLE_GAP_SCAN_BUFFER_EXTENDED_MIN)
+#error "Scanning on Coded PHY requires NRF_BLE_SCAN_BUFFER of at least BLE_GAP_SCAN_BUFFER_EXTENDED_MIN."
+#endif
+
+#define HASH_INIT  0x811C9DC5UL /**< FNV-1a offset basis. */
+#define HASH_PRIME 0x01000193UL /**< FNV-1a prime. */
+
+
+#if (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+STATIC_ASSERT(NRF_BLE_SCAN_CONNECT_QUEUE_SIZE > 0);
+STATIC_ASSERT(NRF_BLE_SCAN_CONNECT_QUEUE_SIZE <= UINT8_MAX);
+
+
+/**@brief Function for comparing two GAP addresses.
+ *
+ * @param[in] p_addr_a First address.
+ * @param[in] p_addr_b Second address.
+ *
+ * @return Whether the addresses are equal.
+ */
+static bool conn_queue_addr_equal(ble_gap_addr_t const * const p_addr_a,
+                                  ble_gap_addr_t const * const p_addr_b)
+{
+    return (p_addr_a->addr_type == p_addr_b->addr_type) &&
+           (memcmp(p_addr_a->addr, p_addr_b->addr, BLE_GAP_ADDR_LEN) == 0);
+}
+
+
+/**@brief Function for counting the central links not yet used or claimed by the queue.
+ *
+ * @param[in] p_queue Connect queue.
+ *
+ * @return Number of devices that can still be queued.
+ */
+static uint32_t conn_queue_free_links(nrf_ble_scan_conn_queue_t const * const p_queue)
+{
+    uint32_t used = ble_conn_state_central_conn_count() + p_queue->count;
+
+    if (p_queue->connecting)
+    {
+        used++;
+    }
+
+    return (used < NRF_SDH_BLE_CENTRAL_LINK_COUNT) ? (NRF_SDH_BLE_CENTRAL_LINK_COUNT - used) : 0;
+}
+
+
+/**@brief Function for queueing a matched device.
+ *
+ * @details A device that is already queued or being connected to is not queued again. A device
+ *          is dropped if the queue is full or would claim more than the free central links.
+ *
+ * @param[in,out] p_queue      Connect queue.
+ * @param[in]     p_addr       Address of the device.
+ * @param[in]     conn_cfg_tag Connection configuration used to connect to the device.
+ */
+static void conn_queue_add(nrf_ble_scan_conn_queue_t * const p_queue,
+                           ble_gap_addr_t const      * const p_addr,
+                           uint8_t                         conn_cfg_tag)
+{
+    uint32_t index;
+
+    if (p_queue->connecting && conn_queue_addr_equal(&p_queue->connecting_addr, p_addr))
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < p_queue->count; i++)
+    {
+        if (conn_queue_addr_equal(&p_queue->addr[(p_queue->first + i) % NRF_BLE_SCAN_CONNECT_QUEUE_SIZE],
+                                  p_addr))
+        {
+            return;
+        }
+    }
+
+    if ((p_queue->count == NRF_BLE_SCAN_CONNECT_QUEUE_SIZE) || (conn_queue_free_links(p_queue) == 0))
+    {
+        NRF_LOG_DEBUG("No free central link for the matched device");
+        return;
+    }
+
+    if (p_queue->count == 0)
+    {
+        p_queue->collect_ticks = app_timer_cnt_get();
+    }
+
+    index                        = (p_queue->first + p_queue->count) % NRF_BLE_SCAN_CONNECT_QUEUE_SIZE;
+    p_queue->addr[index]         = *p_addr;
+    p_queue->conn_cfg_tag[index] = conn_cfg_tag;
+    p_queue->count++;
+
+    NRF_LOG_DEBUG("Queued the matched device, %d queued", p_queue->count);
+}
+
+
+/**@brief Function for checking whether the collection of matched devices is over.
+ *
+ * @param[in] p_queue Connect queue.
+ *
+ * @return Whether the queued devices are to be connected to now.
+ */
+static bool conn_queue_is_due(nrf_ble_scan_conn_queue_t const * const p_queue)
+{
+    if ((p_queue->count == 0) || p_queue->connecting)
+    {
+        return false;
+    }
+
+    if ((p_queue->count == NRF_BLE_SCAN_CONNECT_QUEUE_SIZE) || (conn_queue_free_links(p_queue) == 0))
+    {
+        return true;
+    }
+
+    return app_timer_cnt_diff_compute(app_timer_cnt_get(), p_queue->collect_ticks) >=
+           APP_TIMER_TICKS(NRF_BLE_SCAN_CONNECT_QUEUE_COLLECT_MS);
+}
+
+
+/**@brief Function for connecting to the next queued device.
+ *
+ * @details Devices that cannot be connected to are reported with
+ *          @ref NRF_BLE_SCAN_EVT_CONNECTING_ERROR and skipped. Once the queue is empty, the
+ *          scanning is resumed with the filters still active, unless it ended on its own.
+ *
+ * @param[in,out] p_scan_ctx Pointer to the Scanning Module instance.
+ */
+static void conn_queue_connect_next(nrf_ble_scan_t * const p_scan_ctx)
+{
+    nrf_ble_scan_conn_queue_t * const p_queue = &p_scan_ctx->conn_queue;
+    ret_code_t                        err_code;
+    scan_evt_t                        scan_evt;
+    uint8_t                           conn_cfg_tag;
+
+    p_queue->connecting = false;
+
+    while (p_queue->count > 0)
+    {
+        p_queue->connecting_addr = p_queue->addr[p_queue->first];
+        conn_cfg_tag             = p_queue->conn_cfg_tag[p_queue->first];
+        p_queue->first           = (p_queue->first + 1) % NRF_BLE_SCAN_CONNECT_QUEUE_SIZE;
+        p_queue->count--;
+
+        // Scanning and connecting cannot be done at the same time.
+        nrf_ble_scan_stop();
+
+        err_code = sd_ble_gap_connect(&p_queue->connecting_addr,
+                                      &p_scan_ctx->scan_params,
+                                      &p_scan_ctx->conn_params,
+                                      conn_cfg_tag);
+
+        NRF_LOG_DEBUG("Connection status: %d, %d queued", err_code, p_queue->count);
+
+        if (err_code == NRF_SUCCESS)
+        {
+            p_queue->connecting = true;
+            return;
+        }
+
+        if (p_scan_ctx->evt_handler != NULL)
+        {
+            memset(&scan_evt, 0, sizeof(scan_evt));
+            scan_evt.scan_evt_id                    = NRF_BLE_SCAN_EVT_CONNECTING_ERROR;
+            scan_evt.params.connecting_err.err_code = err_code;
+
+            p_scan_ctx->evt_handler(&scan_evt);
+        }
+    }
+
+    if (p_queue->resume_scan)
+    {
+        UNUSED_RETURN_VALUE(nrf_ble_scan_start(p_scan_ctx));
+    }
+}
+
+
+/**@brief Function for handling the BLE events that end a connection attempt of the queue.
+ *
+ * @param[in,out] p_scan_ctx Pointer to the Scanning Module instance.
+ * @param[in]     p_ble_evt  Event received from the BLE stack.
+ */
+static void conn_queue_on_ble_evt(nrf_ble_scan_t * const p_scan_ctx, ble_evt_t const * p_ble_evt)
+{
+    nrf_ble_scan_conn_queue_t * const p_queue   = &p_scan_ctx->conn_queue;
+    ble_gap_evt_t const       * const p_gap_evt = &p_ble_evt->evt.gap_evt;
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_ADV_REPORT:
+            if (conn_queue_is_due(p_queue))
+            {
+                p_queue->resume_scan = true;
+                conn_queue_connect_next(p_scan_ctx);
+            }
+            break;
+
+        case BLE_GAP_EVT_CONNECTED:
+            if (p_queue->connecting && (p_gap_evt->params.connected.role == BLE_GAP_ROLE_CENTRAL))
+            {
+                conn_queue_connect_next(p_scan_ctx);
+            }
+            break;
+
+        case BLE_GAP_EVT_TIMEOUT:
+            if ((p_gap_evt->params.timeout.src == BLE_GAP_TIMEOUT_SRC_CONN) && p_queue->connecting)
+            {
+                conn_queue_connect_next(p_scan_ctx);
+            }
+            else if ((p_gap_evt->params.timeout.src == BLE_GAP_TIMEOUT_SRC_SCAN) &&
+                     !p_queue->connecting && (p_queue->count > 0))
+            {
+                // Connect to the devices collected before the scanning ended, but do not resume it.
+                p_queue->resume_scan = false;
+                conn_queue_connect_next(p_scan_ctx);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+#endif // NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED
+
+
+/**@brief Function for choosing the connection configuration used to connect to a device.
+ *
+ * @param[in] p_scan_ctx   Pointer to the Scanning Module instance.
+ * @param[in] p_adv_report Advertising report of the device.
+ *
+ * @return Tag returned by @ref nrf_ble_scan_t::conn_cfg_tag_handler, or
+ *         @ref nrf_ble_scan_t::conn_cfg_tag if there is no handler.
+ */
+static uint8_t conn_cfg_tag_get(nrf_ble_scan_t           const * const p_scan_ctx,
+                                ble_gap_evt_adv_report_t const * const p_adv_report)
+{
+    if (p_scan_ctx->conn_cfg_tag_handler != NULL)
+    {
+        return p_scan_ctx->conn_cfg_tag_handler(p_adv_report);
+    }
+
+    return p_scan_ctx->conn_cfg_tag;
+}
+
 
 /**@brief Function for establishing the connection with a device.
  *
@@ -68,9 +321,18 @@ NRF_LOG_MODULE_REGISTER();
  * @param[in] p_scan_ctx   Pointer to the Scanning Module instance.
  * @param[in] p_adv_report Advertising data.
  */
-static void nrf_ble_scan_connect_with_target(nrf_ble_scan_t           const * const p_scan_ctx,
+static void nrf_ble_scan_connect_with_target(nrf_ble_scan_t                 * const p_scan_ctx,
                                              ble_gap_evt_adv_report_t const * const p_adv_report)
 {
+#if (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+    // Connect once the collection of matched devices is over.
+    if (p_scan_ctx->connect_if_match)
+    {
+        conn_queue_add(&p_scan_ctx->conn_queue,
+                       &p_adv_report->peer_addr,
+                       conn_cfg_tag_get(p_scan_ctx, p_adv_report));
+    }
+#else
     ret_code_t err_code;
     scan_evt_t scan_evt;
 
@@ -78,7 +340,7 @@ static void nrf_ble_scan_connect_with_target(nrf_ble_scan_t           const * co
     ble_gap_addr_t const        * p_addr        = &p_adv_report->peer_addr;
     ble_gap_scan_params_t const * p_scan_params = &p_scan_ctx->scan_params;
     ble_gap_conn_params_t const * p_conn_params = &p_scan_ctx->conn_params;
-    uint8_t                       con_cfg_tag   = p_scan_ctx->conn_cfg_tag;
+    uint8_t                       con_cfg_tag;
 
     // Return if the automatic connection is disabled.
     if (!p_scan_ctx->connect_if_match)
@@ -86,6 +348,8 @@ static void nrf_ble_scan_connect_with_target(nrf_ble_scan_t           const * co
         return;
     }
 
+    con_cfg_tag = conn_cfg_tag_get(p_scan_ctx, p_adv_report);
+
     // Stop scanning.
     nrf_ble_scan_stop();
 
@@ -109,11 +373,113 @@ static void nrf_ble_scan_connect_with_target(nrf_ble_scan_t           const * co
     {
         p_scan_ctx->evt_handler(&scan_evt);
     }
-
+#endif // NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED
 }
 
 
 #if (NRF_BLE_SCAN_FILTER_ENABLE == 1)
+/**@brief AD structures compared by the filters. */
+typedef enum
+{
+    ADV_FIELD_NAME,             /**< Complete Local Name. */
+    ADV_FIELD_SHORT_NAME,       /**< Shortened Local Name. */
+    ADV_FIELD_APPEARANCE,       /**< Appearance. */
+    ADV_FIELD_UUID16_COMPLETE,  /**< Complete list of 16-bit Service UUIDs. */
+    ADV_FIELD_UUID16_MORE,      /**< Incomplete list of 16-bit Service UUIDs. */
+    ADV_FIELD_UUID128_COMPLETE, /**< Complete list of 128-bit Service UUIDs. */
+    ADV_FIELD_UUID128_MORE,     /**< Incomplete list of 128-bit Service UUIDs. */
+    ADV_FIELD_CNT
+} adv_field_t;
+
+/**@brief AD structures of an advertising report, found in one pass. */
+typedef struct
+{
+    struct
+    {
+        uint8_t const * p_data; /**< Data of the AD structure. */
+        uint16_t        len;    /**< Length of the data, 0 if the AD structure is absent or malformed. */
+    } field[ADV_FIELD_CNT];
+} adv_fields_t;
+
+
+/**@brief Function for getting the field of an AD type compared by the filters.
+ *
+ * @param[in] ad_type AD type.
+ *
+ * @return Field of the AD type, or ADV_FIELD_CNT if no filter compares it.
+ */
+static adv_field_t adv_field_get(uint8_t ad_type)
+{
+    switch (ad_type)
+    {
+        case BLE_GAP_AD_TYPE_COMPLETE_LOCAL_NAME:
+            return ADV_FIELD_NAME;
+
+        case BLE_GAP_AD_TYPE_SHORT_LOCAL_NAME:
+            return ADV_FIELD_SHORT_NAME;
+
+        case BLE_GAP_AD_TYPE_APPEARANCE:
+            return ADV_FIELD_APPEARANCE;
+
+        case BLE_GAP_AD_TYPE_16BIT_SERVICE_UUID_COMPLETE:
+            return ADV_FIELD_UUID16_COMPLETE;
+
+        case BLE_GAP_AD_TYPE_16BIT_SERVICE_UUID_MORE_AVAILABLE:
+            return ADV_FIELD_UUID16_MORE;
+
+        case BLE_GAP_AD_TYPE_128BIT_SERVICE_UUID_COMPLETE:
+            return ADV_FIELD_UUID128_COMPLETE;
+
+        case BLE_GAP_AD_TYPE_128BIT_SERVICE_UUID_MORE_AVAILABLE:
+            return ADV_FIELD_UUID128_MORE;
+
+        default:
+            return ADV_FIELD_CNT;
+    }
+}
+
+
+/**@brief Function for finding the AD structures compared by the filters.
+ *
+ * @details The advertising data is walked once. Same as with @ref ble_advdata_search, only the
+ *          first AD structure of each type is used, and it is ignored if it is malformed.
+ *
+ * @param[in]  p_adv_report Advertising report to parse.
+ * @param[out] p_fields     AD structures found.
+ */
+static void adv_fields_parse(ble_gap_evt_adv_report_t const * const p_adv_report,
+                             adv_fields_t                   * const p_fields)
+{
+    uint8_t const * p_data   = p_adv_report->data.p_data;
+    uint16_t        data_len = p_adv_report->data.len;
+    uint32_t        seen     = 0;
+    uint16_t        i        = 0;
+
+    memset(p_fields, 0, sizeof(adv_fields_t));
+
+    while ((i + 1 < data_len) && (seen != ((1UL << ADV_FIELD_CNT) - 1)))
+    {
+        adv_field_t field = adv_field_get(p_data[i + 1]);
+
+        if ((field != ADV_FIELD_CNT) && !(seen & (1UL << field)))
+        {
+            uint16_t len = p_data[i] ? (p_data[i] - 1) : 0;
+
+            seen |= (1UL << field);
+
+            if ((len != 0) && ((i + 2 + len) <= data_len))
+            {
+                p_fields->field[field].p_data = &p_data[i + 2];
+                p_fields->field[field].len    = len;
+            }
+        }
+
+        // Jump to next data.
+        i += (p_data[i] + 1);
+    }
+}
+
+
 #if (NRF_BLE_SCAN_ADDRESS_CNT > 0)
 
 /**@brief Function for searching for the provided address in the advertisement packets.
@@ -141,6 +507,41 @@ static bool find_peer_addr(ble_gap_evt_adv_report_t const * const p_adv_report,
 }
 
 
+#if (NRF_BLE_SCAN_ADDR_TABLE_ENABLED == 1)
+/**@brief Function for finding an address in the address table.
+ *
+ * @details The table is probed linearly from the slot selected by the hash of the address.
+ *          One slot is always free, so the probing ends.
+ *
+ * @param[in] p_filter Address filter data.
+ * @param[in] p_addr   Address to search for. The address length must correspond to @ref BLE_GAP_ADDR_LEN.
+ *
+ * @return The slot holding the address, or the free slot where the address is to be added.
+ */
+static nrf_ble_scan_addr_slot_t * addr_table_slot_find(nrf_ble_scan_addr_filter_t const * const p_filter,
+                                                       uint8_t                    const *       p_addr)
+{
+    uint32_t hash = HASH_INIT;
+    uint32_t index;
+
+    for (uint32_t i = 0; i < BLE_GAP_ADDR_LEN; i++)
+    {
+        hash = (hash ^ p_addr[i]) * HASH_PRIME;
+    }
+
+    index = hash & p_filter->table_mask;
+
+    while (p_filter->p_table[index].used &&
+           (memcmp(p_filter->p_table[index].addr, p_addr, BLE_GAP_ADDR_LEN) != 0))
+    {
+        index = (index + 1) & p_filter->table_mask;
+    }
+
+    return &p_filter->p_table[index];
+}
+#endif // NRF_BLE_SCAN_ADDR_TABLE_ENABLED
+
+
 /** @brief Function for comparing the provided address with the addresses of the advertising devices.
  *
  * @param[in] p_adv_report    Advertising data to parse.
@@ -154,6 +555,16 @@ static bool adv_addr_compare(ble_gap_evt_adv_report_t const * const p_adv_report
     ble_gap_addr_t const * p_addr  = p_scan_ctx->scan_filters.addr_filter.target_addr;
     uint8_t                counter = p_scan_ctx->scan_filters.addr_filter.addr_cnt;
 
+#if (NRF_BLE_SCAN_ADDR_TABLE_ENABLED == 1)
+    nrf_ble_scan_addr_filter_t const * p_filter = &p_scan_ctx->scan_filters.addr_filter;
+
+    if ((p_filter->p_table != NULL) &&
+        addr_table_slot_find(p_filter, p_adv_report->peer_addr.addr)->used)
+    {
+        return true;
+    }
+#endif
+
     for (uint8_t index = 0; index < counter; index++)
     {
         // Search for address.
@@ -183,6 +594,33 @@ static ret_code_t nrf_ble_scan_addr_filter_add(nrf_ble_scan_t * const p_scan_ctx
     uint8_t        * p_counter     = &p_scan_ctx->scan_filters.addr_filter.addr_cnt;
     uint8_t          index;
 
+#if (NRF_BLE_SCAN_ADDR_TABLE_ENABLED == 1)
+    nrf_ble_scan_addr_filter_t * p_filter = &p_scan_ctx->scan_filters.addr_filter;
+
+    if (p_filter->p_table != NULL)
+    {
+        nrf_ble_scan_addr_slot_t * p_slot = addr_table_slot_find(p_filter, p_addr);
+
+        // Check for duplicated filter.
+        if (p_slot->used)
+        {
+            return NRF_SUCCESS;
+        }
+
+        // Keep one slot free.
+        if (p_filter->table_cnt >= p_filter->table_mask)
+        {
+            return NRF_ERROR_NO_MEM;
+        }
+
+        memcpy(p_slot->addr, p_addr, BLE_GAP_ADDR_LEN);
+        p_slot->used = true;
+        p_filter->table_cnt++;
+
+        return NRF_SUCCESS;
+    }
+#endif
+
     // If no memory for filter.
     if (*p_counter >= NRF_BLE_SCAN_ADDRESS_CNT)
     {
@@ -222,28 +660,26 @@ static ret_code_t nrf_ble_scan_addr_filter_add(nrf_ble_scan_t * const p_scan_ctx
 #if (NRF_BLE_SCAN_NAME_CNT > 0)
 /** @brief Function for comparing the provided name with the advertised name.
  *
- * @param[in] p_adv_report    Advertising data to parse.
+ * @param[in] p_fields        AD structures of the advertising report.
  * @param[in] p_scan_ctx      Pointer to the Scanning Module instance.
  *
  * @retval True when the names match. False otherwise.
  */
-static bool adv_name_compare(ble_gap_evt_adv_report_t const * p_adv_report,
-                             nrf_ble_scan_t     const * const p_scan_ctx)
+static bool adv_name_compare(adv_fields_t   const * const p_fields,
+                             nrf_ble_scan_t const * const p_scan_ctx)
 {
     nrf_ble_scan_name_filter_t const * p_name_filter = &p_scan_ctx->scan_filters.name_filter;
     uint8_t                            counter       =
         p_scan_ctx->scan_filters.name_filter.name_cnt;
-    uint8_t  index;
-    uint16_t data_len;
-
-    data_len = p_adv_report->data.len;
+    uint8_t const *                    p_name        = p_fields->field[ADV_FIELD_NAME].p_data;
+    uint16_t                           name_len      = p_fields->field[ADV_FIELD_NAME].len;
+    uint8_t                            index;
 
     // Compare the name found with the name filter.
     for (index = 0; index < counter; index++)
     {
-        if (ble_advdata_name_find(p_adv_report->data.p_data,
-                                  data_len,
-                                  p_name_filter->target_name[index]))
+        if ((name_len == p_name_filter->target_name_len[index]) &&
+            (memcmp(p_name_filter->target_name[index], p_name, name_len) == 0))
         {
             return true;
         }
@@ -292,6 +728,7 @@ static ret_code_t nrf_ble_scan_name_filter_add(nrf_ble_scan_t * const p_scan_ctx
     }
 
     // Add name to filter.
+    p_scan_ctx->scan_filters.name_filter.target_name_len[*counter] = name_len;
     memcpy(p_scan_ctx->scan_filters.name_filter.target_name[(*counter)++],
            p_name,
            strlen(p_name));
@@ -308,29 +745,32 @@ static ret_code_t nrf_ble_scan_name_filter_add(nrf_ble_scan_t * const p_scan_ctx
 #if (NRF_BLE_SCAN_SHORT_NAME_CNT > 0)
 /** @brief Function for comparing the provided short name with the advertised short name.
  *
- * @param[in] p_adv_report    Advertising data to parse.
+ * @param[in] p_fields        AD structures of the advertising report.
  * @param[in] p_scan_ctx      Pointer to the Scanning Module instance.
  *
  * @retval True when the names match. False otherwise.
  */
-static bool adv_short_name_compare(ble_gap_evt_adv_report_t const * const p_adv_report,
-                                   nrf_ble_scan_t           const * const p_scan_ctx)
+static bool adv_short_name_compare(adv_fields_t   const * const p_fields,
+                                   nrf_ble_scan_t const * const p_scan_ctx)
 {
     nrf_ble_scan_short_name_filter_t const * p_name_filter =
         &p_scan_ctx->scan_filters.short_name_filter;
-    uint8_t  counter = p_scan_ctx->scan_filters.short_name_filter.name_cnt;
-    uint8_t  index;
-    uint16_t data_len;
+    uint8_t         counter  = p_scan_ctx->scan_filters.short_name_filter.name_cnt;
+    uint8_t const * p_name   = p_fields->field[ADV_FIELD_SHORT_NAME].p_data;
+    uint16_t        name_len = p_fields->field[ADV_FIELD_SHORT_NAME].len;
+    uint8_t         index;
 
-    data_len = p_adv_report->data.len;
+    if (name_len == 0)
+    {
+        return false;
+    }
 
     // Compare the name found with the name filters.
     for (index = 0; index < counter; index++)
     {
-        if (ble_advdata_short_name_find(p_adv_report->data.p_data,
-                                        data_len,
-                                        p_name_filter->short_name[index].short_target_name,
-                                        p_name_filter->short_name[index].short_name_min_len))
+        if ((name_len >= p_name_filter->short_name[index].short_name_min_len) &&
+            (name_len < p_name_filter->short_name[index].short_target_name_len) &&
+            (memcmp(p_name_filter->short_name[index].short_target_name, p_name, name_len) == 0))
         {
             return true;
         }
@@ -385,6 +825,7 @@ static ret_code_t nrf_ble_scan_short_name_filter_add(nrf_ble_scan_t            *
     // Add name to the filter.
     p_short_name_filter->short_name[(*p_counter)].short_name_min_len =
         p_short_name->short_name_min_len;
+    p_short_name_filter->short_name[(*p_counter)].short_target_name_len = name_len;
     memcpy(p_short_name_filter->short_name[(*p_counter)++].short_target_name,
            p_short_name->p_short_name,
            strlen(p_short_name->p_short_name));
@@ -399,54 +840,113 @@ static ret_code_t nrf_ble_scan_short_name_filter_add(nrf_ble_scan_t            *
 
 
 #if (NRF_BLE_SCAN_UUID_CNT > 0)
+#define UUID16_SIZE 2 /**< Size of 16 bit UUID. */
+
+STATIC_ASSERT(NRF_BLE_SCAN_UUID_CNT <= 32);
+
+/**@brief Function for hashing an encoded UUID.
+ *
+ * @details The hash is the low bits of the 16-bit UUID, or of the 16-bit alias of a 128-bit UUID.
+ *
+ * @param[in] p_raw   Encoded UUID.
+ * @param[in] raw_len Length of the encoded UUID.
+ *
+ * @return Hash of the UUID, below 32.
+ */
+static uint8_t uuid_hash(uint8_t const * p_raw, uint8_t raw_len)
+{
+    return p_raw[(raw_len == NRF_BLE_SCAN_UUID_RAW_MAX_LEN) ? 12 : 0] & 0x1F;
+}
+
+
+/**@brief Function for marking the UUID filters found in a list of advertised UUIDs.
+ *
+ * @param[in]     p_uuid_filter Pointer to the UUID filter.
+ * @param[in]     p_list        Advertised UUIDs.
+ * @param[in]     list_len      Length of the advertised UUIDs.
+ * @param[in]     raw_len       Length of one advertised UUID.
+ * @param[in,out] p_match_mask  Bit n is set if UUID filter n is found.
+ */
+static void uuid_list_match(nrf_ble_scan_uuid_filter_t const * p_uuid_filter,
+                            uint8_t                    const * p_list,
+                            uint16_t                           list_len,
+                            uint8_t                            raw_len,
+                            uint32_t                         * p_match_mask)
+{
+    for (uint16_t list_offset = 0; (list_offset + raw_len) <= list_len; list_offset += raw_len)
+    {
+        uint8_t const * p_raw = &p_list[list_offset];
+
+        if (!(p_uuid_filter->uuid_hash_mask & (1UL << uuid_hash(p_raw, raw_len))))
+        {
+            continue;
+        }
+
+        for (uint8_t index = 0; index < p_uuid_filter->uuid_cnt; index++)
+        {
+            if ((p_uuid_filter->uuid_raw_len[index] == raw_len) &&
+                (memcmp(p_uuid_filter->uuid_raw[index], p_raw, raw_len) == 0))
+            {
+                *p_match_mask |= (1UL << index);
+            }
+        }
+    }
+}
+
+
 /**@brief Function for comparing the provided UUID with the UUID in the advertisement packets.
  *
+ * @details Same as with @ref ble_advdata_uuid_find, the complete list of UUIDs of a size is
+ *          used if present, otherwise the incomplete one.
+ *
+ * @param[in]   p_fields       AD structures of the advertising report.
  * @param[in]   p_adv_report   Advertising data to parse.
  * @param[in]   p_scan_ctx     Pointer to the Scanning Module instance.
  *
  * @return      True if the UUIDs match. False otherwise.
  */
-static bool adv_uuid_compare(ble_gap_evt_adv_report_t const * const p_adv_report,
+static bool adv_uuid_compare(adv_fields_t             const * const p_fields,
+                             ble_gap_evt_adv_report_t const * const p_adv_report,
                              nrf_ble_scan_t           const * const p_scan_ctx)
 {
     nrf_ble_scan_uuid_filter_t const * p_uuid_filter    = &p_scan_ctx->scan_filters.uuid_filter;
     bool const                         all_filters_mode = p_scan_ctx->scan_filters.all_filters_mode;
     uint8_t const                      counter          =
         p_scan_ctx->scan_filters.uuid_filter.uuid_cnt;
-    uint8_t  index;
-    uint16_t data_len;
-    uint8_t  uuid_match_cnt = 0;
-
-    data_len = p_adv_report->data.len;
+    uint32_t                           match_mask       = 0;
+    adv_field_t                        field;
+
+    field = (p_fields->field[ADV_FIELD_UUID16_COMPLETE].len != 0) ?
+            ADV_FIELD_UUID16_COMPLETE : ADV_FIELD_UUID16_MORE;
+    uuid_list_match(p_uuid_filter,
+                    p_fields->field[field].p_data,
+                    p_fields->field[field].len,
+                    UUID16_SIZE,
+                    &match_mask);
+
+    field = (p_fields->field[ADV_FIELD_UUID128_COMPLETE].len != 0) ?
+            ADV_FIELD_UUID128_COMPLETE : ADV_FIELD_UUID128_MORE;
+    uuid_list_match(p_uuid_filter,
+                    p_fields->field[field].p_data,
+                    p_fields->field[field].len,
+                    NRF_BLE_SCAN_UUID_RAW_MAX_LEN,
+                    &match_mask);
 
-    for (index = 0; index < counter; index++)
+    for (uint8_t index = 0; index < counter; index++)
     {
-
-        if (ble_advdata_uuid_find(p_adv_report->data.p_data,
-                                  data_len,
+        // A UUID whose vendor-specific base was not known when it was added is looked up here.
+        if ((p_uuid_filter->uuid_raw_len[index] == 0) &&
+            ble_advdata_uuid_find(p_adv_report->data.p_data,
+                                  p_adv_report->data.len,
                                   &p_uuid_filter->uuid[index]))
         {
-            uuid_match_cnt++;
-
-            // In the normal filter mode, only one UUID is needed to match.
-            if (!all_filters_mode)
-            {
-                break;
-            }
-        }
-        else if (all_filters_mode)
-        {
-            break;
-        }
-        else
-        {
-            // Do nothing.
+            match_mask |= (1UL << index);
         }
     }
 
     // In the multifilter mode, all UUIDs must be found in the advertisement packets.
-    if ((all_filters_mode && (uuid_match_cnt == counter)) ||
-        ((!all_filters_mode) && (uuid_match_cnt > 0)))
+    if ((all_filters_mode && (match_mask == ((1UL << counter) - 1))) ||
+        ((!all_filters_mode) && (match_mask != 0)))
     {
         return true;
     }
@@ -485,7 +985,21 @@ static ret_code_t nrf_ble_scan_uuid_filter_add(nrf_ble_scan_t * const p_scan_ctx
         }
     }
 
-    // Add UUID to the filter.
+    // Add UUID to the filter, encoded as in the advertising data.
+    nrf_ble_scan_uuid_filter_t * p_filter = &p_scan_ctx->scan_filters.uuid_filter;
+    uint8_t                      raw_len  = NRF_BLE_SCAN_UUID_RAW_MAX_LEN;
+
+    if ((sd_ble_uuid_encode(p_uuid, &raw_len, p_filter->uuid_raw[*p_counter]) == NRF_SUCCESS) &&
+        ((raw_len == UUID16_SIZE) || (raw_len == NRF_BLE_SCAN_UUID_RAW_MAX_LEN)))
+    {
+        p_filter->uuid_raw_len[*p_counter] = raw_len;
+        p_filter->uuid_hash_mask          |= (1UL << uuid_hash(p_filter->uuid_raw[*p_counter], raw_len));
+    }
+    else
+    {
+        p_filter->uuid_raw_len[*p_counter] = 0;
+    }
+
     p_uuid_filter[(*p_counter)++] = *p_uuid;
     NRF_LOG_DEBUG("Added filter on UUID %x", p_uuid->uuid);
 
@@ -499,29 +1013,33 @@ static ret_code_t nrf_ble_scan_uuid_filter_add(nrf_ble_scan_t * const p_scan_ctx
 #if (NRF_BLE_SCAN_APPEARANCE_CNT)
 /**@brief Function for comparing the provided appearance with the appearance in the advertisement packets.
  *
- * @param[in]     p_adv_report Advertising data to parse.
+ * @param[in]     p_fields     AD structures of the advertising report.
  * @param[in,out] p_scan_ctx   Pointer to the Scanning Module instance.
  *
  * @return      True if the appearances match. False otherwise.
  */
-static bool adv_appearance_compare(ble_gap_evt_adv_report_t const * const p_adv_report,
-                                   nrf_ble_scan_t           const * const p_scan_ctx)
+static bool adv_appearance_compare(adv_fields_t   const * const p_fields,
+                                   nrf_ble_scan_t const * const p_scan_ctx)
 {
     nrf_ble_scan_appearance_filter_t const * p_appearance_filter =
         &p_scan_ctx->scan_filters.appearance_filter;
     uint8_t const counter =
         p_scan_ctx->scan_filters.appearance_filter.appearance_cnt;
     uint8_t  index;
-    uint16_t data_len;
+    uint16_t decoded_appearance;
 
-    data_len = p_adv_report->data.len;
+    if (p_fields->field[ADV_FIELD_APPEARANCE].len < sizeof(uint16_t))
+    {
+        // Could not find any Appearance in the encoded data.
+        return false;
+    }
+
+    decoded_appearance = uint16_decode(p_fields->field[ADV_FIELD_APPEARANCE].p_data);
 
     // Verify if the advertised appearance matches the provided appearance.
     for (index = 0; index < counter; index++)
     {
-        if (ble_advdata_appearance_find(p_adv_report->data.p_data,
-                                        data_len,
-                                        &p_appearance_filter->appearance[index]))
+        if (decoded_appearance == p_appearance_filter->appearance[index])
         {
             return true;
         }
@@ -631,6 +1149,7 @@ ret_code_t nrf_ble_scan_all_filter_remove(nrf_ble_scan_t * const p_scan_ctx)
 #if (NRF_BLE_SCAN_NAME_CNT > 0)
     nrf_ble_scan_name_filter_t * p_name_filter = &p_scan_ctx->scan_filters.name_filter;
     memset(p_name_filter->target_name, 0, sizeof(p_name_filter->target_name));
+    memset(p_name_filter->target_name_len, 0, sizeof(p_name_filter->target_name_len));
     p_name_filter->name_cnt = 0;
 #endif
 
@@ -645,12 +1164,21 @@ ret_code_t nrf_ble_scan_all_filter_remove(nrf_ble_scan_t * const p_scan_ctx)
     nrf_ble_scan_addr_filter_t * p_addr_filter = &p_scan_ctx->scan_filters.addr_filter;
     memset(p_addr_filter->target_addr, 0, sizeof(p_addr_filter->target_addr));
     p_addr_filter->addr_cnt = 0;
+#if (NRF_BLE_SCAN_ADDR_TABLE_ENABLED == 1)
+    if (p_addr_filter->p_table != NULL)
+    {
+        memset(p_addr_filter->p_table, 0, (p_addr_filter->table_mask + 1) * sizeof(p_addr_filter->p_table[0]));
+    }
+    p_addr_filter->table_cnt = 0;
+#endif
 #endif
 
 #if (NRF_BLE_SCAN_UUID_CNT > 0)
     nrf_ble_scan_uuid_filter_t * p_uuid_filter = &p_scan_ctx->scan_filters.uuid_filter;
     memset(p_uuid_filter->uuid, 0, sizeof(p_uuid_filter->uuid));
-    p_uuid_filter->uuid_cnt = 0;
+    memset(p_uuid_filter->uuid_raw_len, 0, sizeof(p_uuid_filter->uuid_raw_len));
+    p_uuid_filter->uuid_hash_mask = 0;
+    p_uuid_filter->uuid_cnt       = 0;
 #endif
 
 #if (NRF_BLE_SCAN_APPEARANCE_CNT > 0)
@@ -664,6 +1192,34 @@ ret_code_t nrf_ble_scan_all_filter_remove(nrf_ble_scan_t * const p_scan_ctx)
 }
 
 
+#if (NRF_BLE_SCAN_ADDR_TABLE_ENABLED == 1)
+ret_code_t nrf_ble_scan_addr_table_set(nrf_ble_scan_t           * const p_scan_ctx,
+                                       nrf_ble_scan_addr_slot_t *       p_slots,
+                                       uint32_t                         slot_cnt)
+{
+    VERIFY_PARAM_NOT_NULL(p_scan_ctx);
+
+    nrf_ble_scan_addr_filter_t * p_filter = &p_scan_ctx->scan_filters.addr_filter;
+
+    if ((p_slots != NULL) && ((slot_cnt < 2) || ((slot_cnt & (slot_cnt - 1)) != 0)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_filter->p_table    = p_slots;
+    p_filter->table_mask = (p_slots != NULL) ? (slot_cnt - 1) : 0;
+    p_filter->table_cnt  = 0;
+
+    if (p_slots != NULL)
+    {
+        memset(p_slots, 0, slot_cnt * sizeof(p_slots[0]));
+    }
+
+    return NRF_SUCCESS;
+}
+#endif // NRF_BLE_SCAN_ADDR_TABLE_ENABLED
+
+
 ret_code_t nrf_ble_scan_filters_enable(nrf_ble_scan_t * const p_scan_ctx,
                                        uint8_t                mode,
                                        bool                   match_all)
@@ -775,13 +1331,135 @@ ret_code_t nrf_ble_scan_filter_get(nrf_ble_scan_t * const   p_scan_ctx,
 
 #endif // NRF_BLE_SCAN_FILTER_ENABLE
 
+#if (NRF_BLE_SCAN_DEDUP_ENABLED == 1)
+
+#define DEDUP_WINDOW_MAX_MS ((APP_TIMER_MAX_CNT_VAL / APP_TIMER_CLOCK_FREQ) * 1000) /**< Window that fits in the app_timer counter with any prescaler. */
+
+STATIC_ASSERT(NRF_BLE_SCAN_DEDUP_CACHE_SIZE > 0);
+STATIC_ASSERT(NRF_BLE_SCAN_DEDUP_WINDOW_MS <= DEDUP_WINDOW_MAX_MS);
+
+
+/**@brief Function for emptying the deduplication cache.
+ *
+ * @param[in,out] p_dedup Deduplication cache.
+ */
+static void dedup_clear(nrf_ble_scan_dedup_t * const p_dedup)
+{
+    memset(p_dedup->entry, 0, sizeof(p_dedup->entry));
+    p_dedup->seq = 0;
+}
+
+
+/**@brief Function for hashing the address and the data of an advertising report.
+ *
+ * @param[in] p_adv_report Advertising report.
+ *
+ * @return FNV-1a hash of the report.
+ */
+static uint32_t dedup_hash(ble_gap_evt_adv_report_t const * const p_adv_report)
+{
+    uint32_t hash = (HASH_INIT ^ p_adv_report->peer_addr.addr_type) * HASH_PRIME;
+
+    for (uint32_t i = 0; i < BLE_GAP_ADDR_LEN; i++)
+    {
+        hash = (hash ^ p_adv_report->peer_addr.addr[i]) * HASH_PRIME;
+    }
+
+    for (uint32_t i = 0; i < p_adv_report->data.len; i++)
+    {
+        hash = (hash ^ p_adv_report->data.p_data[i]) * HASH_PRIME;
+    }
+
+    return hash;
+}
+
+
+/**@brief Function for checking whether an advertising report repeats a forwarded report.
+ *
+ * @details A report that is not in the cache replaces the entry received the longest time ago.
+ *
+ * @param[in,out] p_dedup      Deduplication cache.
+ * @param[in]     p_adv_report Advertising report.
+ *
+ * @retval true  If the report is not to be forwarded.
+ * @retval false If the report is to be forwarded. It is then remembered as forwarded.
+ */
+static bool dedup_is_duplicate(nrf_ble_scan_dedup_t           * const p_dedup,
+                               ble_gap_evt_adv_report_t const * const p_adv_report)
+{
+    nrf_ble_scan_dedup_entry_t * p_entry  = NULL;
+    nrf_ble_scan_dedup_entry_t * p_oldest = &p_dedup->entry[0];
+    uint32_t                     hash;
+    uint32_t                     now;
+
+    if (p_dedup->window_ticks == 0)
+    {
+        return false;
+    }
+
+    // Sequence number 0 marks free entries.
+    if (++p_dedup->seq == 0)
+    {
+        dedup_clear(p_dedup);
+        p_dedup->seq = 1;
+    }
+
+    hash = dedup_hash(p_adv_report);
+
+    for (uint32_t i = 0; i < NRF_BLE_SCAN_DEDUP_CACHE_SIZE; i++)
+    {
+        nrf_ble_scan_dedup_entry_t * p_cur = &p_dedup->entry[i];
+
+        if ((p_cur->seen_seq != 0)                                         &&
+            (p_cur->hash == hash)                                          &&
+            (p_cur->addr.addr_type == p_adv_report->peer_addr.addr_type) &&
+            (memcmp(p_cur->addr.addr, p_adv_report->peer_addr.addr, BLE_GAP_ADDR_LEN) == 0))
+        {
+            p_entry = p_cur;
+            break;
+        }
+
+        if (p_cur->seen_seq < p_oldest->seen_seq)
+        {
+            p_oldest = p_cur;
+        }
+    }
+
+    now = app_timer_cnt_get();
+
+    if (p_entry != NULL)
+    {
+        p_entry->seen_seq = p_dedup->seq;
+
+        if ((app_timer_cnt_diff_compute(now, p_entry->forward_ticks) < p_dedup->window_ticks) &&
+            (abs(p_adv_report->rssi - p_entry->rssi) < p_dedup->rssi_threshold))
+        {
+            return true;
+        }
+    }
+    else
+    {
+        p_entry           = p_oldest;
+        p_entry->addr     = p_adv_report->peer_addr;
+        p_entry->hash     = hash;
+        p_entry->seen_seq = p_dedup->seq;
+    }
+
+    p_entry->forward_ticks = now;
+    p_entry->rssi          = p_adv_report->rssi;
+
+    return false;
+}
+
+#endif // NRF_BLE_SCAN_DEDUP_ENABLED
+
 /**@brief Function for calling the BLE_GAP_EVT_ADV_REPORT event to check whether the received
  *        scanning data matches the scan configuration.
  *
  * @param[in] p_scan_ctx    Pointer to the Scanning Module instance.
  * @param[in] p_adv_report  Advertising report.
  */
-static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_scan_ctx,
+static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t                 * const p_scan_ctx,
                                        ble_gap_evt_adv_report_t const * const p_adv_report)
 {
     scan_evt_t scan_evt;
@@ -809,8 +1487,9 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
     }
 
 #if (NRF_BLE_SCAN_FILTER_ENABLE == 1)
-    bool const all_filter_mode   = p_scan_ctx->scan_filters.all_filters_mode;
-    bool       is_filter_matched = false;
+    bool const   all_filter_mode   = p_scan_ctx->scan_filters.all_filters_mode;
+    bool         is_filter_matched = false;
+    adv_fields_t adv_fields;
 
 #if (NRF_BLE_SCAN_ADDRESS_CNT > 0)
     bool const addr_filter_enabled = p_scan_ctx->scan_filters.addr_filter.addr_filter_enabled;
@@ -852,12 +1531,19 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
     }
 #endif
 
+    // In the multifilter mode, the remaining filters are not checked once one does not match.
+    // Otherwise, all filters are checked to report every match.
+    if (!all_filter_mode || (filter_match_cnt == filter_cnt))
+    {
+        adv_fields_parse(p_adv_report, &adv_fields);
+    }
+
 #if (NRF_BLE_SCAN_NAME_CNT > 0)
     // Check the name filter.
-    if (name_filter_enabled)
+    if (name_filter_enabled && (!all_filter_mode || (filter_match_cnt == filter_cnt)))
     {
         filter_cnt++;
-        if (adv_name_compare(p_adv_report, p_scan_ctx))
+        if (adv_name_compare(&adv_fields, p_scan_ctx))
         {
             filter_match_cnt++;
 
@@ -869,10 +1555,10 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
 #endif
 
 #if (NRF_BLE_SCAN_SHORT_NAME_CNT > 0)
-    if (short_name_filter_enabled)
+    if (short_name_filter_enabled && (!all_filter_mode || (filter_match_cnt == filter_cnt)))
     {
         filter_cnt++;
-        if (adv_short_name_compare(p_adv_report, p_scan_ctx))
+        if (adv_short_name_compare(&adv_fields, p_scan_ctx))
         {
             filter_match_cnt++;
 
@@ -885,10 +1571,10 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
 
 #if (NRF_BLE_SCAN_UUID_CNT > 0)
     // Check the UUID filter.
-    if (uuid_filter_enabled)
+    if (uuid_filter_enabled && (!all_filter_mode || (filter_match_cnt == filter_cnt)))
     {
         filter_cnt++;
-        if (adv_uuid_compare(p_adv_report, p_scan_ctx))
+        if (adv_uuid_compare(&adv_fields, p_adv_report, p_scan_ctx))
         {
             filter_match_cnt++;
             // Information about the filters matched.
@@ -900,10 +1586,10 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
 
 #if (NRF_BLE_SCAN_APPEARANCE_CNT > 0)
     // Check the appearance filter.
-    if (appearance_filter_enabled)
+    if (appearance_filter_enabled && (!all_filter_mode || (filter_match_cnt == filter_cnt)))
     {
         filter_cnt++;
-        if (adv_appearance_compare(p_adv_report, p_scan_ctx))
+        if (adv_appearance_compare(&adv_fields, p_scan_ctx))
         {
             filter_match_cnt++;
             // Information about the filters matched.
@@ -915,7 +1601,9 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
     scan_evt.scan_evt_id = NRF_BLE_SCAN_EVT_NOT_FOUND;
 #endif
 
-    scan_evt.params.filter_match.p_adv_report = p_adv_report;
+    scan_evt.params.filter_match.p_adv_report  = p_adv_report;
+    scan_evt.params.filter_match.primary_phy   = p_adv_report->primary_phy;
+    scan_evt.params.filter_match.secondary_phy = p_adv_report->secondary_phy;
 
     // In the multifilter mode, the number of the active filters must equal the number of the filters matched to generate the notification.
     if (all_filter_mode && (filter_match_cnt == filter_cnt))
@@ -965,6 +1653,102 @@ bool is_whitelist_used(nrf_ble_scan_t const * const p_scan_ctx)
 }
 
 
+/**@brief Function for setting the scan interval and window of the scanning parameters.
+ *
+ * @param[out] p_scan_params Scanning parameters.
+ * @param[in]  interval      Scan interval, in units of 0.625 ms.
+ * @param[in]  window        Scan window, in units of 0.625 ms.
+ */
+static void scan_timing_write(ble_gap_scan_params_t * const p_scan_params,
+                              uint16_t                      interval,
+                              uint16_t                      window)
+{
+#if (NRF_SD_BLE_API_VERSION > 7)
+    p_scan_params->interval_us = interval * UNIT_0_625_MS;
+    p_scan_params->window_us   = window * UNIT_0_625_MS;
+#else
+    p_scan_params->interval    = interval;
+    p_scan_params->window      = window;
+#endif // #if (NRF_SD_BLE_API_VERSION > 7)
+}
+
+
+/**@brief Function for combining the timing of the scanned PHYs into the scanning parameters.
+ *
+ * @details The SoftDevice uses one interval and window for all scanned PHYs, and scans the
+ *          window on each PHY within the interval. With both PHYs, the larger window is used,
+ *          at the interval that keeps the higher duty cycle, which must be at least twice the
+ *          window.
+ *
+ * @param[out] p_scan_params Scanning parameters.
+ * @param[in]  p_1m          Timing on 1M PHY, or NULL.
+ * @param[in]  p_coded       Timing on Coded PHY, or NULL.
+ *
+ * @retval NRF_SUCCESS             If the timing was combined.
+ * @retval NRF_ERROR_INVALID_PARAM If the timing is not valid.
+ * @retval NRF_ERROR_NOT_SUPPORTED If Coded PHY needs a larger scan buffer.
+ */
+static ret_code_t scan_phy_timing_combine(ble_gap_scan_params_t           * const p_scan_params,
+                                          nrf_ble_scan_phy_timing_t const * const p_1m,
+                                          nrf_ble_scan_phy_timing_t const * const p_coded)
+{
+    bool const use_1m    = (p_1m != NULL) && (p_1m->window != 0);
+    bool const use_coded = (p_coded != NULL) && (p_coded->window != 0);
+    uint32_t   interval;
+    uint32_t   window;
+
+    if ((!use_1m && !use_coded)                                 ||
+        (use_1m && (p_1m->window > p_1m->interval))             ||
+        (use_coded && (p_coded->window > p_coded->interval)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if (use_coded && (NRF_BLE_SCAN_BUFFER < BLE_GAP_SCAN_BUFFER_EXTENDED_MIN))
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    if (use_1m && use_coded)
+    {
+        nrf_ble_scan_phy_timing_t const * p_dense;
+
+        // Scale the interval of the PHY with the higher duty cycle to the larger window.
+        p_dense  = ((uint32_t)p_1m->window * p_coded->interval >=
+                    (uint32_t)p_coded->window * p_1m->interval) ? p_1m : p_coded;
+        window   = MAX(p_1m->window, p_coded->window);
+        interval = (window * p_dense->interval) / p_dense->window;
+        interval = MAX(interval, 2 * window);
+    }
+    else
+    {
+        nrf_ble_scan_phy_timing_t const * p_timing = use_1m ? p_1m : p_coded;
+
+        interval = p_timing->interval;
+        window   = p_timing->window;
+    }
+
+    if (interval > BLE_GAP_SCAN_INTERVAL_MAX)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    scan_timing_write(p_scan_params, (uint16_t)interval, (uint16_t)window);
+
+    p_scan_params->scan_phys = (use_1m ? BLE_GAP_PHY_1MBPS : 0) |
+                               (use_coded ? BLE_GAP_PHY_CODED : 0);
+    if (use_coded)
+    {
+        p_scan_params->extended = 1;
+    }
+
+    NRF_LOG_DEBUG("Scanning PHYs 0x%x, interval %d, window %d",
+                  p_scan_params->scan_phys, interval, window);
+
+    return NRF_SUCCESS;
+}
+
+
 /**@brief Function for restoring the default scanning parameters.
  *
  * @param[out] p_scan_ctx    Pointer to the Scanning Module instance.
@@ -972,17 +1756,34 @@ bool is_whitelist_used(nrf_ble_scan_t const * const p_scan_ctx)
 static void nrf_ble_scan_default_param_set(nrf_ble_scan_t * const p_scan_ctx)
 {
     // Set the default parameters.
+    memset(&p_scan_ctx->scan_params, 0, sizeof(p_scan_ctx->scan_params));
+
     p_scan_ctx->scan_params.active        = 1;
-#if (NRF_SD_BLE_API_VERSION > 7)
-    p_scan_ctx->scan_params.interval_us   = NRF_BLE_SCAN_SCAN_INTERVAL * UNIT_0_625_MS;
-    p_scan_ctx->scan_params.window_us     = NRF_BLE_SCAN_SCAN_WINDOW * UNIT_0_625_MS;
-#else
-    p_scan_ctx->scan_params.interval      = NRF_BLE_SCAN_SCAN_INTERVAL;
-    p_scan_ctx->scan_params.window        = NRF_BLE_SCAN_SCAN_WINDOW;
-#endif // #if (NRF_SD_BLE_API_VERSION > 7)
     p_scan_ctx->scan_params.timeout       = NRF_BLE_SCAN_SCAN_DURATION;
     p_scan_ctx->scan_params.filter_policy = BLE_GAP_SCAN_FP_ACCEPT_ALL;
+
+#if SCAN_PHY_CODED_USED
+    nrf_ble_scan_phy_timing_t const timing_1m =
+    {
+        .interval = NRF_BLE_SCAN_SCAN_INTERVAL,
+        .window   = NRF_BLE_SCAN_SCAN_WINDOW
+    };
+    nrf_ble_scan_phy_timing_t const timing_coded =
+    {
+        .interval = NRF_BLE_SCAN_CODED_SCAN_INTERVAL,
+        .window   = NRF_BLE_SCAN_CODED_SCAN_WINDOW
+    };
+    ret_code_t err_code;
+
+    err_code = scan_phy_timing_combine(&p_scan_ctx->scan_params,
+                                       (NRF_BLE_SCAN_SCAN_PHY & BLE_GAP_PHY_1MBPS) ? &timing_1m : NULL,
+                                       &timing_coded);
+    ASSERT(err_code == NRF_SUCCESS);
+    UNUSED_VARIABLE(err_code);
+#else
+    scan_timing_write(&p_scan_ctx->scan_params, NRF_BLE_SCAN_SCAN_INTERVAL, NRF_BLE_SCAN_SCAN_WINDOW);
     p_scan_ctx->scan_params.scan_phys     = BLE_GAP_PHY_1MBPS;
+#endif
 }
 
 
@@ -1060,6 +1861,8 @@ ret_code_t nrf_ble_scan_init(nrf_ble_scan_t            * const p_scan_ctx,
         p_scan_ctx->connect_if_match = p_init->connect_if_match;
         p_scan_ctx->conn_cfg_tag     = p_init->conn_cfg_tag;
 
+        p_scan_ctx->conn_cfg_tag_handler = p_init->conn_cfg_tag_handler;
+
         if (p_init->p_scan_param != NULL)
         {
             p_scan_ctx->scan_params = *p_init->p_scan_param;
@@ -1086,13 +1889,24 @@ ret_code_t nrf_ble_scan_init(nrf_ble_scan_t            * const p_scan_ctx,
         nrf_ble_scan_default_param_set(p_scan_ctx);
         nrf_ble_scan_default_conn_param_set(p_scan_ctx);
 
-        p_scan_ctx->connect_if_match = false;
+        p_scan_ctx->connect_if_match     = false;
+        p_scan_ctx->conn_cfg_tag_handler = NULL;
     }
 
     // Assign a buffer where the advertising reports are to be stored by the SoftDevice.
     p_scan_ctx->scan_buffer.p_data = p_scan_ctx->scan_buffer_data;
     p_scan_ctx->scan_buffer.len    = NRF_BLE_SCAN_BUFFER;
 
+#if (NRF_BLE_SCAN_DEDUP_ENABLED == 1)
+    p_scan_ctx->dedup.window_ticks   = APP_TIMER_TICKS(NRF_BLE_SCAN_DEDUP_WINDOW_MS);
+    p_scan_ctx->dedup.rssi_threshold = NRF_BLE_SCAN_DEDUP_RSSI_THRESHOLD;
+    dedup_clear(&p_scan_ctx->dedup);
+#endif
+
+#if (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+    memset(&p_scan_ctx->conn_queue, 0, sizeof(p_scan_ctx->conn_queue));
+#endif
+
     return NRF_SUCCESS;
 }
 
@@ -1157,6 +1971,50 @@ ret_code_t nrf_ble_scan_params_set(nrf_ble_scan_t              * const p_scan_ct
 }
 
 
+ret_code_t nrf_ble_scan_phy_timing_set(nrf_ble_scan_t                  * const p_scan_ctx,
+                                       nrf_ble_scan_phy_timing_t const * const p_1m,
+                                       nrf_ble_scan_phy_timing_t const * const p_coded)
+{
+    VERIFY_PARAM_NOT_NULL(p_scan_ctx);
+
+    return scan_phy_timing_combine(&p_scan_ctx->scan_params, p_1m, p_coded);
+}
+
+
+#if (NRF_BLE_SCAN_DEDUP_ENABLED == 1)
+ret_code_t nrf_ble_scan_dedup_set(nrf_ble_scan_t * const p_scan_ctx,
+                                  uint32_t               window_ms,
+                                  uint8_t                rssi_threshold)
+{
+    VERIFY_PARAM_NOT_NULL(p_scan_ctx);
+
+    if (window_ms > DEDUP_WINDOW_MAX_MS)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_scan_ctx->dedup.window_ticks   = APP_TIMER_TICKS(window_ms);
+    p_scan_ctx->dedup.rssi_threshold = rssi_threshold;
+    dedup_clear(&p_scan_ctx->dedup);
+
+    return NRF_SUCCESS;
+}
+#endif // NRF_BLE_SCAN_DEDUP_ENABLED
+
+
+#if (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+ret_code_t nrf_ble_scan_connect_queue_clear(nrf_ble_scan_t * const p_scan_ctx)
+{
+    VERIFY_PARAM_NOT_NULL(p_scan_ctx);
+
+    p_scan_ctx->conn_queue.count       = 0;
+    p_scan_ctx->conn_queue.resume_scan = false;
+
+    return NRF_SUCCESS;
+}
+#endif
+
+
 /**@brief Function for calling the BLE_GAP_EVT_CONNECTED event.
  *
  * @param[in] p_scan_ctx  Pointer to the Scanning Module instance.
@@ -1203,6 +2061,14 @@ void nrf_ble_scan_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_contex)
     switch (p_ble_evt->header.evt_id)
     {
         case BLE_GAP_EVT_ADV_REPORT:
+#if (NRF_BLE_SCAN_DEDUP_ENABLED == 1)
+            if (dedup_is_duplicate(&p_scan_data->dedup, p_adv_report))
+            {
+                // Resume the scanning without forwarding the report.
+                UNUSED_RETURN_VALUE(sd_ble_gap_scan_start(NULL, &p_scan_data->scan_buffer));
+                break;
+            }
+#endif
             nrf_ble_scan_on_adv_report(p_scan_data, p_adv_report);
             break;
 
@@ -1217,6 +2083,10 @@ void nrf_ble_scan_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_contex)
         default:
             break;
     }
+
+#if (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+    conn_queue_on_ble_evt(p_scan_data, p_ble_evt);
+#endif
 }
 
 
@@ -130,6 +130,20 @@ typedef struct
     uint8_t      short_name_min_len; /**< Minimum length of the short name. */
 } nrf_ble_scan_short_name_t;
 
+
+/**@brief Handler for choosing the connection configuration of a matched device.
+ *
+ * @details Called when the module is about to connect to the device, so that links with
+ *          different needs can use connection configurations of different size, see
+ *          @ref sd_ble_cfg_set.
+ *
+ * @param[in] p_adv_report Advertising report that matched the filters or the whitelist.
+ *
+ * @return Tag of the connection configuration to connect with.
+ */
+typedef uint8_t (*nrf_ble_scan_conn_cfg_tag_handler_t)(ble_gap_evt_adv_report_t const * p_adv_report);
+
+
 /**@brief Structure for Scanning Module initialization.
  */
 typedef struct
@@ -138,9 +152,19 @@ typedef struct
     bool                          connect_if_match; /**< If set to true, the module automatically connects after a filter match or successful identification of a device from the whitelist. */
     ble_gap_conn_params_t const * p_conn_param;     /**< Connection parameters. Can be initialized as NULL. If NULL, the default static configuration is used. */
     uint8_t                       conn_cfg_tag;     /**< Variable to keep track of what connection settings will be used if a filer match or a whitelist match results in a connection. */
+    nrf_ble_scan_conn_cfg_tag_handler_t conn_cfg_tag_handler; /**< Handler choosing the connection settings for each device. Can be initialized as NULL, in which case conn_cfg_tag is used for all connections. */
 } nrf_ble_scan_init_t;
 
 
+/**@brief Scan timing of one PHY, used by @ref nrf_ble_scan_phy_timing_set.
+ */
+typedef struct
+{
+    uint16_t interval; /**< Scan interval, in units of 0.625 ms. */
+    uint16_t window;   /**< Scan window, in units of 0.625 ms. Set to 0 to not scan on the PHY. */
+} nrf_ble_scan_phy_timing_t;
+
+
 /**@brief Structure for setting the filter status.
  *
  * @details This structure is used for sending filter status to the main application.
@@ -159,8 +183,10 @@ typedef struct
  */
 typedef struct
 {
-    ble_gap_evt_adv_report_t const * p_adv_report; /**< Event structure for @ref BLE_GAP_EVT_ADV_REPORT. This data allows the main application to establish connection. */
-    nrf_ble_scan_filter_match        filter_match; /**< Matching filters. Information about matched filters. */
+    ble_gap_evt_adv_report_t const * p_adv_report;  /**< Event structure for @ref BLE_GAP_EVT_ADV_REPORT. This data allows the main application to establish connection. */
+    nrf_ble_scan_filter_match        filter_match;  /**< Matching filters. Information about matched filters. */
+    uint8_t                          primary_phy;   /**< PHY the advertising packet was received on, see @ref BLE_GAP_PHYS. */
+    uint8_t                          secondary_phy; /**< PHY of the auxiliary packets, or BLE_GAP_PHY_NOT_SET for legacy advertising, see @ref BLE_GAP_PHYS. */
 } nrf_ble_scan_evt_filter_match_t;
 
 
@@ -212,6 +238,7 @@ typedef void (*nrf_ble_scan_evt_handler_t)(scan_evt_t const * p_scan_evt);
 typedef struct
 {
     char    target_name[NRF_BLE_SCAN_NAME_CNT][NRF_BLE_SCAN_NAME_MAX_LEN]; /**< Names that the main application will scan for, and that will be advertised by the peripherals. */
+    uint8_t target_name_len[NRF_BLE_SCAN_NAME_CNT];                        /**< Lengths of the names, compared before the names. */
     uint8_t name_cnt;                                                      /**< Name filter counter. */
     bool    name_filter_enabled;                                           /**< Flag to inform about enabling or disabling this filter. */
 } nrf_ble_scan_name_filter_t;
@@ -223,6 +250,7 @@ typedef struct
     struct
     {
         char    short_target_name[NRF_BLE_SCAN_SHORT_NAME_MAX_LEN]; /**< Short names that the main application will scan for, and that will be advertised by the peripherals. */
+        uint8_t short_target_name_len;                              /**< Length of the short name. */
         uint8_t short_name_min_len;                                 /**< Minimum length of the short name. */
     } short_name[NRF_BLE_SCAN_SHORT_NAME_CNT];
     uint8_t name_cnt;                                               /**< Short name filter counter. */
@@ -230,21 +258,45 @@ typedef struct
 } nrf_ble_scan_short_name_filter_t;
 #endif
 
+#if (NRF_BLE_SCAN_ADDR_TABLE_ENABLED == 1)
+#if (NRF_BLE_SCAN_ADDRESS_CNT == 0)
+#error "NRF_BLE_SCAN_ADDR_TABLE_ENABLED requires NRF_BLE_SCAN_ADDRESS_CNT > 0."
+#endif
+
+/**@brief Slot of the address table. The slots are supplied with @ref nrf_ble_scan_addr_table_set.
+ */
+typedef struct
+{
+    uint8_t addr[BLE_GAP_ADDR_LEN]; /**< Address in the format used by the SoftDevice. */
+    bool    used;                   /**< True if the slot holds an address. */
+} nrf_ble_scan_addr_slot_t;
+#endif
+
 #if (NRF_BLE_SCAN_ADDRESS_CNT > 0)
 typedef struct
 {
     ble_gap_addr_t target_addr[NRF_BLE_SCAN_ADDRESS_CNT]; /**< Addresses in the same format as the format used by the SoftDevice that the main application will scan for, and that will be advertised by the peripherals. */
     uint8_t        addr_cnt;                              /**< Address filter counter. */
     bool           addr_filter_enabled;                   /**< Flag to inform about enabling or disabling this filter. */
+#if (NRF_BLE_SCAN_ADDR_TABLE_ENABLED == 1)
+    nrf_ble_scan_addr_slot_t * p_table;                   /**< Address table, or NULL if the addresses are kept in @p target_addr. */
+    uint32_t                   table_mask;                /**< Number of slots in the table minus 1. */
+    uint32_t                   table_cnt;                 /**< Number of addresses in the table. */
+#endif
 } nrf_ble_scan_addr_filter_t;
 #endif
 
 #if (NRF_BLE_SCAN_UUID_CNT > 0)
+#define NRF_BLE_SCAN_UUID_RAW_MAX_LEN 16 /**< Length of an encoded 128-bit UUID. */
+
 typedef struct
 {
-    ble_uuid_t uuid[NRF_BLE_SCAN_UUID_CNT]; /**< UUIDs that the main application will scan for, and that will be advertised by the peripherals. */
-    uint8_t    uuid_cnt;                    /**< UUID filter counter. */
-    bool       uuid_filter_enabled;         /**< Flag to inform about enabling or disabling this filter. */
+    ble_uuid_t uuid[NRF_BLE_SCAN_UUID_CNT];                                  /**< UUIDs that the main application will scan for, and that will be advertised by the peripherals. */
+    uint8_t    uuid_raw[NRF_BLE_SCAN_UUID_CNT][NRF_BLE_SCAN_UUID_RAW_MAX_LEN]; /**< UUIDs as encoded in the advertising data. */
+    uint8_t    uuid_raw_len[NRF_BLE_SCAN_UUID_CNT];                          /**< Lengths of the encoded UUIDs, 0 if a UUID could not be encoded when it was added. */
+    uint32_t   uuid_hash_mask;                                               /**< Bit n is set if an encoded UUID hashes to n. Advertised UUIDs hashing to a clear bit are skipped. */
+    uint8_t    uuid_cnt;                                                     /**< UUID filter counter. */
+    bool       uuid_filter_enabled;                                          /**< Flag to inform about enabling or disabling this filter. */
 } nrf_ble_scan_uuid_filter_t;
 #endif
 
@@ -286,6 +338,48 @@ typedef struct
 
 #endif // NRF_BLE_SCAN_FILTER_ENABLE
 
+#if (NRF_BLE_SCAN_DEDUP_ENABLED == 1)
+/**@brief Advertising report remembered by the deduplication cache.
+ */
+typedef struct
+{
+    ble_gap_addr_t addr;          /**< Address of the advertiser. */
+    uint32_t       hash;          /**< Hash of the address and the advertising data. */
+    uint32_t       forward_ticks; /**< Value of the app_timer counter when the report was last forwarded. */
+    uint32_t       seen_seq;      /**< Value of @ref nrf_ble_scan_dedup_t::seq when the report was last received, or 0 if the entry is free. */
+    int8_t         rssi;          /**< RSSI of the report when it was last forwarded. */
+} nrf_ble_scan_dedup_entry_t;
+
+/**@brief Deduplication cache.
+ *
+ * @details Reports are looked up by their hash, and the entry received the longest time ago
+ *          is replaced when the cache is full.
+ */
+typedef struct
+{
+    nrf_ble_scan_dedup_entry_t entry[NRF_BLE_SCAN_DEDUP_CACHE_SIZE]; /**< Remembered reports. */
+    uint32_t                   seq;                                  /**< Incremented with every received report. */
+    uint32_t                   window_ticks;                         /**< Time during which an unchanged report is suppressed, 0 to forward all reports. */
+    uint8_t                    rssi_threshold;                       /**< RSSI change that forwards an unchanged report. */
+} nrf_ble_scan_dedup_t;
+#endif // NRF_BLE_SCAN_DEDUP_ENABLED
+
+#if (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+/**@brief Queue of the matched devices to connect to.
+ */
+typedef struct
+{
+    ble_gap_addr_t addr[NRF_BLE_SCAN_CONNECT_QUEUE_SIZE]; /**< Addresses of the devices, in the order they were matched. */
+    uint8_t        conn_cfg_tag[NRF_BLE_SCAN_CONNECT_QUEUE_SIZE]; /**< Connection configuration used to connect to each device. */
+    uint8_t        first;                                 /**< Index of the oldest address. */
+    uint8_t        count;                                 /**< Number of queued addresses. */
+    bool           connecting;                            /**< True while a connection initiated by the queue is being established. */
+    bool           resume_scan;                           /**< True if the scanning is resumed once the queue is empty. */
+    ble_gap_addr_t connecting_addr;                       /**< Address of the device being connected to. */
+    uint32_t       collect_ticks;                         /**< Value of the app_timer counter when the first address was queued. */
+} nrf_ble_scan_conn_queue_t;
+#endif // NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED
+
 /**@brief Scan module instance. Options for the different scanning modes.
  *
  * @details This structure stores all module settings. It is used to enable or disable scanning modes
@@ -299,10 +393,17 @@ typedef struct
     bool                       connect_if_match;                      /**< If set to true, the module automatically connects after a filter match or successful identification of a device from the whitelist. */
     ble_gap_conn_params_t      conn_params;                           /**< Connection parameters. */
     uint8_t                    conn_cfg_tag;                          /**< Variable to keep track of what connection settings will be used if a filer match or a whitelist match results in a connection. */
+    nrf_ble_scan_conn_cfg_tag_handler_t conn_cfg_tag_handler;         /**< Handler choosing the connection settings for each device, or NULL to use conn_cfg_tag. */
     ble_gap_scan_params_t      scan_params;                           /**< GAP scanning parameters. */
     nrf_ble_scan_evt_handler_t evt_handler;                           /**< Handler for the scanning events. Can be initialized as NULL if no handling is implemented in the main application. */
     uint8_t                    scan_buffer_data[NRF_BLE_SCAN_BUFFER]; /**< Buffer where advertising reports will be stored by the SoftDevice. */
     ble_data_t                 scan_buffer;                           /**< Structure-stored pointer to the buffer where advertising reports will be stored by the SoftDevice. */
+#if (NRF_BLE_SCAN_DEDUP_ENABLED == 1)
+    nrf_ble_scan_dedup_t       dedup;                                 /**< Cache of the forwarded advertising reports. */
+#endif
+#if (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+    nrf_ble_scan_conn_queue_t  conn_queue;                            /**< Matched devices waiting to be connected to. */
+#endif
 } nrf_ble_scan_t;
 
 
@@ -356,6 +457,36 @@ ret_code_t nrf_ble_scan_start(nrf_ble_scan_t const * const p_scan_ctx);
 void nrf_ble_scan_stop(void);
 
 
+/**@brief Function for scanning on 1M PHY, Coded PHY, or both, with a timing per PHY.
+ *
+ * @details The SoftDevice scans both PHYs in one session, without the gap of restarting the
+ *          scanner between them. It uses one interval and one window for both PHYs: within each
+ *          interval, it scans the window on 1M PHY and then the window on Coded PHY. When both
+ *          PHYs are enabled, the window is the larger of the two windows, and the interval is
+ *          the one that keeps the higher of the two duty cycles at that window, but at least
+ *          twice the window. No PHY is then scanned for a shorter window or a smaller part of
+ *          the time than requested.
+ *
+ *          Scanning on Coded PHY uses extended scanning, which needs an @ref NRF_BLE_SCAN_BUFFER
+ *          of at least BLE_GAP_SCAN_BUFFER_EXTENDED_MIN. The other scanning parameters are kept.
+ *          The new timing is used from the next call to @ref nrf_ble_scan_start.
+ *
+ * @param[in,out] p_scan_ctx Pointer to the Scanning Module instance.
+ * @param[in]     p_1m       Timing on 1M PHY. Can be NULL to not scan on 1M PHY.
+ * @param[in]     p_coded    Timing on Coded PHY. Can be NULL to not scan on Coded PHY.
+ *
+ * @retval NRF_SUCCESS             If the timing was set.
+ * @retval NRF_ERROR_NULL          If @p p_scan_ctx is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If no PHY has a window, if a window is longer than its
+ *                                 interval, or if the combined interval is too long.
+ * @retval NRF_ERROR_NOT_SUPPORTED If Coded PHY is requested with a scan buffer that is too small
+ *                                 for extended scanning.
+ */
+ret_code_t nrf_ble_scan_phy_timing_set(nrf_ble_scan_t                  * const p_scan_ctx,
+                                       nrf_ble_scan_phy_timing_t const * const p_1m,
+                                       nrf_ble_scan_phy_timing_t const * const p_coded);
+
+
 #if (NRF_BLE_SCAN_FILTER_ENABLE == 1)
 
 /**@brief Function for enabling filtering.
@@ -443,6 +574,34 @@ ret_code_t nrf_ble_scan_filter_set(nrf_ble_scan_t     * const p_scan_ctx,
 ret_code_t nrf_ble_scan_all_filter_remove(nrf_ble_scan_t * const p_scan_ctx);
 
 
+#if (NRF_BLE_SCAN_ADDR_TABLE_ENABLED == 1) || defined(__SDK_DOXYGEN__)
+/**@brief Function for keeping the address filters in a hash table.
+ *
+ * @details Address filters set afterwards with @ref nrf_ble_scan_filter_set are added to the
+ *          table instead of the @ref NRF_BLE_SCAN_ADDRESS_CNT fixed entries, and advertising
+ *          reports are matched against the table with a single hash lookup. This allows
+ *          matching against many more devices than fit in the SoftDevice whitelist.
+ *          One slot always stays free, so the table holds up to @p slot_cnt - 1 addresses.
+ *          Lookups get slower as the table fills up; keep at least a quarter of the slots free.
+ *
+ *          The filters already added to the fixed entries are kept. The buffer is emptied
+ *          by this function and by @ref nrf_ble_scan_all_filter_remove, and must stay valid
+ *          while it is set.
+ *
+ * @param[in,out] p_scan_ctx Pointer to the Scanning Module instance.
+ * @param[in]     p_slots    Slots of the table, or NULL to stop using a table.
+ * @param[in]     slot_cnt   Number of slots, a power of two of at least 2. Ignored if @p p_slots is NULL.
+ *
+ * @retval NRF_SUCCESS             If the table is set successfully.
+ * @retval NRF_ERROR_NULL          If @p p_scan_ctx is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If @p slot_cnt is not a power of two of at least 2.
+ */
+ret_code_t nrf_ble_scan_addr_table_set(nrf_ble_scan_t           * const p_scan_ctx,
+                                       nrf_ble_scan_addr_slot_t *       p_slots,
+                                       uint32_t                         slot_cnt);
+#endif
+
+
 #endif // NRF_BLE_SCAN_FILTER_ENABLE
 
 
@@ -466,6 +625,44 @@ ret_code_t nrf_ble_scan_params_set(nrf_ble_scan_t        * const p_scan_ctx,
                                    ble_gap_scan_params_t const * p_scan_param);
 
 
+#if (NRF_BLE_SCAN_DEDUP_ENABLED == 1) || defined(__SDK_DOXYGEN__)
+/**@brief Function for changing the suppression of repeated advertising reports.
+ *
+ * @details An advertising report with the same address and data as a report forwarded less than
+ *          @p window_ms ago is not passed to the event handler, unless its RSSI differs from the
+ *          forwarded one by @p rssi_threshold or more. The scanning is resumed as usual.
+ *          The defaults are @ref NRF_BLE_SCAN_DEDUP_WINDOW_MS and
+ *          @ref NRF_BLE_SCAN_DEDUP_RSSI_THRESHOLD. Calling this function empties the cache.
+ *
+ * @param[in,out] p_scan_ctx     Pointer to the Scanning Module instance.
+ * @param[in]     window_ms      Suppression window in milliseconds. 0 forwards all reports.
+ * @param[in]     rssi_threshold RSSI change in dBm that forwards a report within the window.
+ *
+ * @retval NRF_SUCCESS             If the settings are changed successfully.
+ * @retval NRF_ERROR_NULL          If a NULL pointer is passed as input.
+ * @retval NRF_ERROR_INVALID_PARAM If the window exceeds the range of the app_timer counter.
+ */
+ret_code_t nrf_ble_scan_dedup_set(nrf_ble_scan_t * const p_scan_ctx,
+                                  uint32_t               window_ms,
+                                  uint8_t                rssi_threshold);
+#endif
+
+
+#if (NRF_BLE_SCAN_CONNECT_QUEUE_ENABLED == 1)
+/**@brief Function for emptying the queue of the matched devices to connect to.
+ *
+ * @details A connection that is being established is not cancelled, but no other device of the
+ *          queue is connected to, and the scanning is not resumed when it completes.
+ *
+ * @param[in,out] p_scan_ctx Pointer to the Scanning Module instance.
+ *
+ * @retval NRF_SUCCESS    If the queue was emptied.
+ * @retval NRF_ERROR_NULL If a NULL pointer is passed as input.
+ */
+ret_code_t nrf_ble_scan_connect_queue_clear(nrf_ble_scan_t * const p_scan_ctx);
+#endif
+
+
 /**@brief Function for handling the BLE stack events of the application.
  *
  * @param[in]     p_ble_evt     Pointer to the BLE event received.
@@ -0,0 +1,738 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLE_TPUT)
+#include "nrf_ble_tput.h"
+#include <string.h>
+#include "nrf.h"
+#include "app_timer.h"
+
+#define NRF_LOG_MODULE_NAME nrf_ble_tput
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define TICKS_PER_SECOND    (APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1)) /**< Frequency of the app_timer counter. */
+#define TICKS_MASK          RTC_COUNTER_COUNTER_Msk                                      /**< Width of the app_timer counter. */
+#define ATT_HVX_HEADER_LEN  3                                                            /**< Length of the opcode and handle of a notification or write command. */
+#define CONN_SUP_TIMEOUT    MSEC_TO_UNITS(4000, UNIT_10_MS)                              /**< Supervision timeout requested with the connection interval. */
+
+STATIC_ASSERT(NRF_SDH_BLE_GATT_MAX_MTU_SIZE - ATT_HVX_HEADER_LEN >= NRF_BLE_TPUT_HEADER_LEN);
+
+static uint8_t m_packet[NRF_SDH_BLE_GATT_MAX_MTU_SIZE - ATT_HVX_HEADER_LEN]; /**< Packet being handed to the SoftDevice, which copies it. */
+
+
+/**@brief Function for converting app_timer ticks to microseconds.
+ *
+ * @param[in]   ticks   Number of ticks.
+ *
+ * @return      Number of microseconds.
+ */
+static uint32_t ticks_to_us(uint32_t ticks)
+{
+    return (uint32_t)(((uint64_t)ticks * 1000000) / TICKS_PER_SECOND);
+}
+
+
+/**@brief Function for finding out if this device sends the data of the transfer.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ *
+ * @return      True if this device is the sender in the selected mode.
+ */
+static bool is_sender(nrf_ble_tput_t const * p_tput)
+{
+    if (p_tput->params.mode == NRF_BLE_TPUT_MODE_NOTIF)
+    {
+        return (p_tput->role == BLE_GAP_ROLE_PERIPH);
+    }
+    return (p_tput->role == BLE_GAP_ROLE_CENTRAL);
+}
+
+
+/**@brief Function for checking the parameters of a transfer.
+ *
+ * @param[in]   p_params    Parameters of the transfer.
+ *
+ * @return      True if the parameters are valid.
+ */
+static bool params_are_valid(nrf_ble_tput_params_t const * p_params)
+{
+    return (p_params->mode <= NRF_BLE_TPUT_MODE_WRITE_CMD)                 &&
+           (p_params->att_mtu >= BLE_GATT_ATT_MTU_DEFAULT)                  &&
+           (p_params->att_mtu <= NRF_SDH_BLE_GATT_MAX_MTU_SIZE)             &&
+           (p_params->data_length >= BLE_GAP_DATA_LENGTH_DEFAULT)           &&
+           (p_params->data_length <= BLE_GAP_DATA_LENGTH_MAX)               &&
+           ((p_params->phy == BLE_GAP_PHY_1MBPS) ||
+            (p_params->phy == BLE_GAP_PHY_2MBPS) ||
+            (p_params->phy == BLE_GAP_PHY_CODED))                           &&
+           (p_params->conn_interval >= BLE_GAP_CP_MIN_CONN_INTVL_MIN)       &&
+           (p_params->conn_interval <= BLE_GAP_CP_MAX_CONN_INTVL_MAX)       &&
+           (p_params->length >= NRF_BLE_TPUT_HEADER_LEN);
+}
+
+
+/**@brief Function for requesting the PHY of the transfer.
+ *
+ * @details If the SoftDevice is busy with another procedure, the request is made again on the
+ *          next link parameter event.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ */
+static void phy_request(nrf_ble_tput_t * p_tput)
+{
+    ret_code_t     err_code;
+    ble_gap_phys_t phys =
+    {
+        .tx_phys = p_tput->params.phy,
+        .rx_phys = p_tput->params.phy,
+    };
+
+    if ((p_tput->link.tx_phy == p_tput->params.phy) && (p_tput->link.rx_phy == p_tput->params.phy))
+    {
+        p_tput->phy_pending = false;
+        return;
+    }
+
+    err_code = sd_ble_gap_phy_update(p_tput->conn_handle, &phys);
+    if (err_code == NRF_ERROR_BUSY)
+    {
+        p_tput->phy_pending = true;
+        return;
+    }
+
+    p_tput->phy_pending = false;
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_WARNING("PHY update request failed, error 0x%x.", err_code);
+    }
+}
+
+
+/**@brief Function for requesting the connection interval and then the PHY of the transfer.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ */
+static void link_params_request(nrf_ble_tput_t * p_tput)
+{
+    ret_code_t            err_code;
+    ble_gap_conn_params_t conn_params =
+    {
+        .min_conn_interval = p_tput->params.conn_interval,
+        .max_conn_interval = p_tput->params.conn_interval,
+        .slave_latency     = 0,
+        .conn_sup_timeout  = CONN_SUP_TIMEOUT,
+    };
+
+    if (p_tput->link.conn_interval != p_tput->params.conn_interval)
+    {
+        err_code = sd_ble_gap_conn_param_update(p_tput->conn_handle, &conn_params);
+        if (err_code == NRF_SUCCESS)
+        {
+            // The PHY update is requested once the connection parameters are settled.
+            p_tput->phy_pending = true;
+            return;
+        }
+        NRF_LOG_WARNING("Connection parameter update request failed, error 0x%x.", err_code);
+    }
+
+    phy_request(p_tput);
+}
+
+
+/**@brief Function for starting the measurement of a transfer.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ * @param[in]   ticks   app_timer counter at the start of the transfer.
+ */
+static void transfer_reset(nrf_ble_tput_t * p_tput, uint32_t ticks)
+{
+    p_tput->running          = true;
+    p_tput->seq              = 0;
+    p_tput->bytes            = 0;
+    p_tput->packets_done     = 0;
+    p_tput->pkts_per_evt_max = 0;
+    p_tput->last_ticks       = ticks;
+    p_tput->elapsed_ticks    = 0;
+    p_tput->rx_first_len     = 0;
+    p_tput->lost             = 0;
+    p_tput->first_offset     = 0;
+    p_tput->delay_min        = 0;
+    p_tput->delay_max        = 0;
+    p_tput->delay_sum        = 0;
+}
+
+
+/**@brief Function for adding the time since the last update to the duration of the transfer.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ * @param[in]   ticks   Current app_timer counter.
+ */
+static void elapsed_update(nrf_ble_tput_t * p_tput, uint32_t ticks)
+{
+    p_tput->elapsed_ticks += app_timer_cnt_diff_compute(ticks, p_tput->last_ticks);
+    p_tput->last_ticks     = ticks;
+}
+
+
+/**@brief Function for finishing a transfer and reporting it.
+ *
+ * @param[in]   p_tput      Benchmark structure.
+ * @param[in]   complete    False if the transfer was stopped before all data was transferred.
+ */
+static void transfer_finish(nrf_ble_tput_t * p_tput, bool complete)
+{
+    nrf_ble_tput_result_t result;
+    uint32_t              rate_bytes;
+    uint32_t              interval_us;
+
+    p_tput->running = false;
+
+    memset(&result, 0, sizeof(result));
+    result.is_sender   = is_sender(p_tput);
+    result.is_complete = complete;
+    result.bytes       = p_tput->bytes;
+    result.packets     = p_tput->packets_done;
+    result.elapsed_us  = ticks_to_us(p_tput->elapsed_ticks);
+
+    p_tput->link.att_mtu = nrf_ble_gatt_eff_mtu_get(p_tput->p_gatt, p_tput->conn_handle);
+#if !defined (S112) && !defined(S312)
+    (void)nrf_ble_gatt_data_length_get(p_tput->p_gatt, p_tput->conn_handle, &p_tput->link.data_length);
+#endif // !defined (S112) && !defined(S312)
+    result.link = p_tput->link;
+
+    // The receiver measures from the first packet, so the first packet is not part of the rate.
+    rate_bytes  = result.is_sender ? p_tput->bytes : (p_tput->bytes - p_tput->rx_first_len);
+    interval_us = (uint32_t)p_tput->link.conn_interval * 1250;
+    if (result.elapsed_us != 0)
+    {
+        result.kbps             = (uint32_t)(((uint64_t)rate_bytes * 8000) / result.elapsed_us);
+        result.pkts_per_evt_x10 = (uint32_t)(((uint64_t)result.packets * 10 * interval_us) /
+                                             result.elapsed_us);
+    }
+
+    if (result.is_sender)
+    {
+        result.pkts_per_evt_max = p_tput->pkts_per_evt_max;
+    }
+    else if (p_tput->packets_done != 0)
+    {
+        int32_t delay_avg = (int32_t)(p_tput->delay_sum / (int32_t)p_tput->packets_done);
+
+        result.latency_avg_us = ticks_to_us((uint32_t)(delay_avg - p_tput->delay_min));
+        result.latency_max_us = ticks_to_us((uint32_t)(p_tput->delay_max - p_tput->delay_min));
+        result.lost           = p_tput->lost;
+    }
+
+    NRF_LOG_INFO("%s %s: %u bytes in %u ms, %u kbps.",
+                 result.is_sender ? "TX" : "RX",
+                 complete ? "done" : "stopped",
+                 result.bytes,
+                 result.elapsed_us / 1000,
+                 result.kbps);
+    NRF_LOG_INFO("ATT_MTU %u, data length %u, PHY 0x%x/0x%x, interval %u x 1.25 ms.",
+                 result.link.att_mtu,
+                 result.link.data_length,
+                 result.link.tx_phy,
+                 result.link.rx_phy,
+                 result.link.conn_interval);
+    NRF_LOG_INFO("%u packets, %u.%u per connection event, %u at most per event.",
+                 result.packets,
+                 result.pkts_per_evt_x10 / 10,
+                 result.pkts_per_evt_x10 % 10,
+                 result.pkts_per_evt_max);
+    if (!result.is_sender)
+    {
+        NRF_LOG_INFO("Latency above the fastest packet: %u us average, %u us max, %u lost.",
+                     result.latency_avg_us,
+                     result.latency_max_us,
+                     result.lost);
+    }
+
+    if (p_tput->evt_handler != NULL)
+    {
+        nrf_ble_tput_evt_t evt =
+        {
+            .evt_type    = NRF_BLE_TPUT_EVT_DONE,
+            .conn_handle = p_tput->conn_handle,
+            .p_result    = &result,
+        };
+
+        p_tput->evt_handler(&evt);
+    }
+}
+
+
+/**@brief Function for handing one packet to the SoftDevice.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ * @param[in]   len     Length of the packet in @ref m_packet.
+ *
+ * @return      NRF_SUCCESS, NRF_ERROR_RESOURCES if the SoftDevice queue is full, or an error.
+ */
+static ret_code_t packet_send(nrf_ble_tput_t * p_tput, uint16_t len)
+{
+    if (p_tput->params.mode == NRF_BLE_TPUT_MODE_NOTIF)
+    {
+#if NRF_MODULE_ENABLED(BLE_NUS)
+        return ble_nus_data_send(p_tput->p_nus, m_packet, &len, p_tput->conn_handle);
+#endif
+    }
+    else
+    {
+#if NRF_MODULE_ENABLED(BLE_NUS_C)
+        ble_gattc_write_params_t const write_params =
+        {
+            .write_op = BLE_GATT_OP_WRITE_CMD,
+            .flags    = 0,
+            .handle   = p_tput->p_nus_c->handles.nus_rx_handle,
+            .offset   = 0,
+            .len      = len,
+            .p_value  = m_packet,
+        };
+
+        return sd_ble_gattc_write(p_tput->conn_handle, &write_params);
+#endif
+    }
+
+    return NRF_ERROR_NOT_SUPPORTED;
+}
+
+
+/**@brief Function for filling the SoftDevice queue with packets.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ *
+ * @return      NRF_SUCCESS if the queue is full or all data is queued, otherwise an error.
+ */
+static ret_code_t tx_fill(nrf_ble_tput_t * p_tput)
+{
+    uint16_t max_len = nrf_ble_gatt_eff_mtu_get(p_tput->p_gatt, p_tput->conn_handle);
+
+    max_len = (max_len > ATT_HVX_HEADER_LEN) ? (max_len - ATT_HVX_HEADER_LEN) : 0;
+    max_len = (uint16_t)MIN(MAX(max_len, NRF_BLE_TPUT_HEADER_LEN), sizeof(m_packet));
+
+    while (p_tput->bytes < p_tput->params.length)
+    {
+        ret_code_t err_code;
+        uint16_t   len = (uint16_t)MIN(max_len, p_tput->params.length - p_tput->bytes);
+
+        len = MAX(len, NRF_BLE_TPUT_HEADER_LEN);
+
+        (void)uint32_encode(p_tput->seq, &m_packet[0]);
+        (void)uint32_encode(app_timer_cnt_get(), &m_packet[4]);
+        if (p_tput->data_handler != NULL)
+        {
+            p_tput->data_handler(&m_packet[NRF_BLE_TPUT_HEADER_LEN], len - NRF_BLE_TPUT_HEADER_LEN);
+        }
+        else
+        {
+            for (uint16_t i = NRF_BLE_TPUT_HEADER_LEN; i < len; i++)
+            {
+                m_packet[i] = (uint8_t)(p_tput->seq + i);
+            }
+        }
+
+        err_code = packet_send(p_tput, len);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            // Sending continues on the next transmit complete event.
+            return NRF_SUCCESS;
+        }
+        VERIFY_SUCCESS(err_code);
+
+        p_tput->seq++;
+        p_tput->bytes += len;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for handling the completion of packets on the sender.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ * @param[in]   count   Number of packets completed since the last event.
+ */
+static void on_tx_complete(nrf_ble_tput_t * p_tput, uint8_t count)
+{
+    ret_code_t err_code;
+
+    if (!p_tput->running)
+    {
+        return;
+    }
+
+    elapsed_update(p_tput, app_timer_cnt_get());
+    p_tput->packets_done    += count;
+    p_tput->pkts_per_evt_max = MAX(p_tput->pkts_per_evt_max, count);
+
+    err_code = tx_fill(p_tput);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_WARNING("Sending failed, error 0x%x.", err_code);
+        transfer_finish(p_tput, false);
+    }
+    else if ((p_tput->bytes >= p_tput->params.length) && (p_tput->packets_done >= p_tput->seq))
+    {
+        transfer_finish(p_tput, true);
+    }
+}
+
+
+/**@brief Function for handling a packet on the receiver.
+ *
+ * @details A packet with sequence number 0 starts a new transfer.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ * @param[in]   p_data  Packet.
+ * @param[in]   len     Length of the packet.
+ */
+static void on_rx_packet(nrf_ble_tput_t * p_tput, uint8_t const * p_data, uint16_t len)
+{
+    uint32_t const ticks = app_timer_cnt_get();
+    uint32_t       seq;
+    uint32_t       offset;
+    int32_t        delay;
+
+    if (len < NRF_BLE_TPUT_HEADER_LEN)
+    {
+        return;
+    }
+
+    seq    = uint32_decode(&p_data[0]);
+    offset = (ticks - uint32_decode(&p_data[4])) & TICKS_MASK;
+
+    if (seq == 0)
+    {
+        transfer_reset(p_tput, ticks);
+        p_tput->first_offset = offset;
+        p_tput->rx_first_len = len;
+    }
+    else if (!p_tput->running)
+    {
+        return;
+    }
+    else
+    {
+        elapsed_update(p_tput, ticks);
+    }
+
+    if (seq > p_tput->seq)
+    {
+        p_tput->lost += seq - p_tput->seq;
+    }
+    p_tput->seq = seq + 1;
+
+    // The offset between the clocks is unknown, so the delay is taken relative to the first
+    // packet, as a signed number of ticks.
+    offset = (offset - p_tput->first_offset) & TICKS_MASK;
+    delay  = (offset & ((TICKS_MASK + 1) >> 1)) ? ((int32_t)offset - (int32_t)(TICKS_MASK + 1))
+                                                : (int32_t)offset;
+    p_tput->delay_min  = MIN(p_tput->delay_min, delay);
+    p_tput->delay_max  = MAX(p_tput->delay_max, delay);
+    p_tput->delay_sum += delay;
+
+    p_tput->bytes += len;
+    p_tput->packets_done++;
+
+    if (p_tput->bytes >= p_tput->params.length)
+    {
+        transfer_finish(p_tput, true);
+    }
+}
+
+
+/**@brief Function for handling the Connected event.
+ *
+ * @param[in]   p_tput      Benchmark structure.
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ */
+static void on_connected(nrf_ble_tput_t * p_tput, ble_evt_t const * p_ble_evt)
+{
+    ble_gap_evt_connected_t const * p_connected = &p_ble_evt->evt.gap_evt.params.connected;
+
+    if (p_tput->conn_handle != BLE_CONN_HANDLE_INVALID)
+    {
+        return;
+    }
+
+    p_tput->conn_handle        = p_ble_evt->evt.gap_evt.conn_handle;
+    p_tput->role               = p_connected->role;
+    p_tput->running            = false;
+    p_tput->phy_pending        = false;
+    p_tput->link.att_mtu       = BLE_GATT_ATT_MTU_DEFAULT;
+    p_tput->link.data_length   = BLE_GAP_DATA_LENGTH_DEFAULT;
+    p_tput->link.tx_phy        = BLE_GAP_PHY_1MBPS;
+    p_tput->link.rx_phy        = BLE_GAP_PHY_1MBPS;
+    p_tput->link.conn_interval = p_connected->conn_params.max_conn_interval;
+
+    link_params_request(p_tput);
+}
+
+
+void nrf_ble_tput_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    nrf_ble_tput_t * p_tput = (nrf_ble_tput_t *)p_context;
+
+    if ((p_tput == NULL) || (p_tput->p_gatt == NULL))
+    {
+        return;
+    }
+
+    if (p_ble_evt->header.evt_id == BLE_GAP_EVT_CONNECTED)
+    {
+        on_connected(p_tput, p_ble_evt);
+        return;
+    }
+
+    // All other events handled here have the connection handle at the same place.
+    if (p_ble_evt->evt.gap_evt.conn_handle != p_tput->conn_handle)
+    {
+        return;
+    }
+
+    switch (p_ble_evt->header.evt_id)
+    {
+        case BLE_GAP_EVT_DISCONNECTED:
+            if (p_tput->running)
+            {
+                transfer_finish(p_tput, false);
+            }
+            p_tput->conn_handle = BLE_CONN_HANDLE_INVALID;
+            break;
+
+        case BLE_GAP_EVT_CONN_PARAM_UPDATE:
+            p_tput->link.conn_interval =
+                p_ble_evt->evt.gap_evt.params.conn_param_update.conn_params.max_conn_interval;
+            if (p_tput->phy_pending)
+            {
+                phy_request(p_tput);
+            }
+            break;
+
+        case BLE_GAP_EVT_PHY_UPDATE_REQUEST:
+        {
+            ret_code_t           err_code;
+            ble_gap_phys_t const phys =
+            {
+                .tx_phys = p_tput->params.phy,
+                .rx_phys = p_tput->params.phy,
+            };
+
+            err_code = sd_ble_gap_phy_update(p_tput->conn_handle, &phys);
+            if (err_code != NRF_SUCCESS)
+            {
+                NRF_LOG_WARNING("PHY update reply failed, error 0x%x.", err_code);
+            }
+        } break;
+
+        case BLE_GAP_EVT_PHY_UPDATE:
+            if (p_ble_evt->evt.gap_evt.params.phy_update.status == BLE_HCI_STATUS_CODE_SUCCESS)
+            {
+                p_tput->link.tx_phy = p_ble_evt->evt.gap_evt.params.phy_update.tx_phy;
+                p_tput->link.rx_phy = p_ble_evt->evt.gap_evt.params.phy_update.rx_phy;
+            }
+            if (p_tput->phy_pending)
+            {
+                phy_request(p_tput);
+            }
+            break;
+
+#if !defined (S112) && !defined(S312)
+        case BLE_GAP_EVT_DATA_LENGTH_UPDATE:
+            p_tput->link.data_length =
+                p_ble_evt->evt.gap_evt.params.data_length_update.effective_params.max_tx_octets;
+            if (p_tput->phy_pending)
+            {
+                phy_request(p_tput);
+            }
+            break;
+#endif // !defined (S112) && !defined(S312)
+
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+            if (p_tput->params.mode == NRF_BLE_TPUT_MODE_NOTIF)
+            {
+                on_tx_complete(p_tput, p_ble_evt->evt.gatts_evt.params.hvn_tx_complete.count);
+            }
+            break;
+
+        case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+            if (p_tput->params.mode == NRF_BLE_TPUT_MODE_WRITE_CMD)
+            {
+                on_tx_complete(p_tput, p_ble_evt->evt.gattc_evt.params.write_cmd_tx_complete.count);
+            }
+            break;
+
+#if NRF_MODULE_ENABLED(BLE_NUS)
+        case BLE_GATTS_EVT_WRITE:
+        {
+            ble_gatts_evt_write_t const * p_write = &p_ble_evt->evt.gatts_evt.params.write;
+
+            if ((p_tput->p_nus != NULL)                               &&
+                (p_tput->params.mode == NRF_BLE_TPUT_MODE_WRITE_CMD)  &&
+                (p_write->handle == p_tput->p_nus->rx_handles.value_handle) &&
+                (p_write->op == BLE_GATTS_OP_WRITE_CMD))
+            {
+                on_rx_packet(p_tput, p_write->data, p_write->len);
+            }
+        } break;
+#endif
+
+#if NRF_MODULE_ENABLED(BLE_NUS_C)
+        case BLE_GATTC_EVT_HVX:
+        {
+            ble_gattc_evt_hvx_t const * p_hvx = &p_ble_evt->evt.gattc_evt.params.hvx;
+
+            if ((p_tput->p_nus_c != NULL)                          &&
+                (p_tput->params.mode == NRF_BLE_TPUT_MODE_NOTIF)   &&
+                (p_hvx->handle == p_tput->p_nus_c->handles.nus_tx_handle) &&
+                (p_hvx->type == BLE_GATT_HVX_NOTIFICATION))
+            {
+                on_rx_packet(p_tput, p_hvx->data, p_hvx->len);
+            }
+        } break;
+#endif
+
+        default:
+            // No implementation needed.
+            break;
+    }
+}
+
+
+ret_code_t nrf_ble_tput_params_set(nrf_ble_tput_t * p_tput, nrf_ble_tput_params_t const * p_params)
+{
+    ret_code_t err_code;
+
+    VERIFY_PARAM_NOT_NULL(p_tput);
+    VERIFY_PARAM_NOT_NULL(p_params);
+
+    if (!params_are_valid(p_params))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    if (p_tput->running)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    err_code = nrf_ble_gatt_att_mtu_periph_set(p_tput->p_gatt, p_params->att_mtu);
+    VERIFY_SUCCESS(err_code);
+    err_code = nrf_ble_gatt_att_mtu_central_set(p_tput->p_gatt, p_params->att_mtu);
+    VERIFY_SUCCESS(err_code);
+#if !defined (S112) && !defined(S312)
+    err_code = nrf_ble_gatt_data_length_set(p_tput->p_gatt, BLE_CONN_HANDLE_INVALID, p_params->data_length);
+    VERIFY_SUCCESS(err_code);
+#endif // !defined (S112) && !defined(S312)
+
+    p_tput->params = *p_params;
+
+    if (p_tput->conn_handle != BLE_CONN_HANDLE_INVALID)
+    {
+        link_params_request(p_tput);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_ble_tput_init(nrf_ble_tput_t * p_tput, nrf_ble_tput_init_t const * p_tput_init)
+{
+    VERIFY_PARAM_NOT_NULL(p_tput);
+    VERIFY_PARAM_NOT_NULL(p_tput_init);
+    VERIFY_PARAM_NOT_NULL(p_tput_init->p_gatt);
+
+    memset(p_tput, 0, sizeof(*p_tput));
+    p_tput->p_gatt       = p_tput_init->p_gatt;
+#if NRF_MODULE_ENABLED(BLE_NUS)
+    p_tput->p_nus        = p_tput_init->p_nus;
+#endif
+#if NRF_MODULE_ENABLED(BLE_NUS_C)
+    p_tput->p_nus_c      = p_tput_init->p_nus_c;
+#endif
+    p_tput->evt_handler  = p_tput_init->evt_handler;
+    p_tput->data_handler = p_tput_init->data_handler;
+    p_tput->conn_handle  = BLE_CONN_HANDLE_INVALID;
+
+    return nrf_ble_tput_params_set(p_tput, &p_tput_init->params);
+}
+
+
+ret_code_t nrf_ble_tput_start(nrf_ble_tput_t * p_tput)
+{
+    ret_code_t err_code;
+    bool       has_service = false;
+
+    VERIFY_PARAM_NOT_NULL(p_tput);
+
+    if ((p_tput->conn_handle == BLE_CONN_HANDLE_INVALID) || !is_sender(p_tput))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+    if (p_tput->running)
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+#if NRF_MODULE_ENABLED(BLE_NUS)
+    has_service |= (p_tput->params.mode == NRF_BLE_TPUT_MODE_NOTIF) && (p_tput->p_nus != NULL);
+#endif
+#if NRF_MODULE_ENABLED(BLE_NUS_C)
+    has_service |= (p_tput->params.mode == NRF_BLE_TPUT_MODE_WRITE_CMD) &&
+                   (p_tput->p_nus_c != NULL)                            &&
+                   (p_tput->p_nus_c->handles.nus_rx_handle != BLE_GATT_HANDLE_INVALID);
+#endif
+    if (!has_service)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    transfer_reset(p_tput, app_timer_cnt_get());
+
+    err_code = tx_fill(p_tput);
+    if (err_code != NRF_SUCCESS)
+    {
+        p_tput->running = false;
+    }
+
+    return err_code;
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BLE_TPUT)
@@ -0,0 +1,303 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ble_tput BLE throughput and latency benchmark
+ * @{
+ * @ingroup ble_sdk_lib
+ * @brief Module for measuring the throughput and latency of a Nordic UART Service link.
+ *
+ * @details One device runs @ref ble_nus as peripheral and the other runs @ref ble_nus_c as
+ *          central. Both use this module with the same @ref nrf_ble_tput_params_t. The link
+ *          parameters are negotiated when the devices connect:
+ *
+ *          - The ATT_MTU and the data length are requested through @ref nrf_ble_gatt, for the
+ *            next connection.
+ *          - The connection interval is requested with a connection parameter update, and the
+ *            PHY with a PHY update once the connection parameters are settled. PHY update
+ *            requests from the peer are answered with the same PHY.
+ *
+ *          The sender fills the SoftDevice queue until it is full and refills it on every
+ *          transmit complete event. With @ref NRF_BLE_TPUT_MODE_NOTIF the peripheral sends
+ *          notifications of the NUS TX characteristic, and with @ref NRF_BLE_TPUT_MODE_WRITE_CMD
+ *          the central sends write commands to the NUS RX characteristic. Each packet starts with
+ *          a sequence number and the app_timer counter at the time it was handed to the
+ *          SoftDevice. The rest of the packet is filled by @ref nrf_ble_tput_init_t::data_handler,
+ *          for example with SAADC samples, or with a synthetic pattern.
+ *
+ *          When the transfer is finished, both sides log a report and pass it to the event
+ *          handler:
+ *
+ *          - Throughput of the payload, from the start of the transfer to the last transmit
+ *            complete event on the sender, and from the first to the last packet on the receiver.
+ *          - Per-packet latency on the receiver. The devices do not share a clock, so the latency
+ *            is reported as the delay above the fastest packet of the transfer. Clock drift adds
+ *            an error of up to the sum of the sleep clock accuracies of both devices.
+ *          - Packets per connection event, as an average over the transfer, and on the sender as
+ *            the largest number of packets completed in one transmit complete event.
+ *          - Sequence numbers missing on the receiver.
+ *
+ * @note    The application must register this module as BLE event observer, which is done by
+ *          @ref NRF_BLE_TPUT_DEF. The app_timer module must be initialized. The module measures
+ *          one link at a time.
+ */
+
+#ifndef NRF_BLE_TPUT_H__
+#define NRF_BLE_TPUT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_common.h"
+#include "ble.h"
+#include "ble_gap.h"
+#include "nrf_ble_gatt.h"
+#include "nrf_sdh_ble.h"
+#if NRF_MODULE_ENABLED(BLE_NUS)
+#include "ble_nus.h"
+#endif
+#if NRF_MODULE_ENABLED(BLE_NUS_C)
+#include "ble_nus_c.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief   Macro for defining a nrf_ble_tput instance.
+ *
+ * @param   _name   Name of the instance.
+ * @hideinitializer
+ */
+#define NRF_BLE_TPUT_DEF(_name)                          \
+    static nrf_ble_tput_t _name;                         \
+    NRF_SDH_BLE_OBSERVER(_name ## _obs,                  \
+                         NRF_BLE_TPUT_BLE_OBSERVER_PRIO, \
+                         nrf_ble_tput_on_ble_evt,        \
+                         &_name)
+
+#define NRF_BLE_TPUT_HEADER_LEN 8 //!< Length of the sequence number and timestamp at the start of each packet.
+
+/**@brief Direction of the transfer. */
+typedef enum
+{
+    NRF_BLE_TPUT_MODE_NOTIF,     //!< The peripheral sends notifications to the central.
+    NRF_BLE_TPUT_MODE_WRITE_CMD, //!< The central sends write commands to the peripheral.
+} nrf_ble_tput_mode_t;
+
+/**@brief Benchmark event types. */
+typedef enum
+{
+    NRF_BLE_TPUT_EVT_DONE, //!< The transfer finished or was stopped by a disconnection. See @ref nrf_ble_tput_evt_t::p_result.
+} nrf_ble_tput_evt_type_t;
+
+/**@brief Parameters of a transfer, which must be the same on both devices. */
+typedef struct
+{
+    nrf_ble_tput_mode_t mode;           //!< Direction of the transfer.
+    uint16_t            att_mtu;        //!< ATT_MTU to request, at most NRF_SDH_BLE_GATT_MAX_MTU_SIZE.
+    uint8_t             data_length;    //!< Data length to request (27 to 251 bytes).
+    uint8_t             phy;            //!< PHY to request, see @ref BLE_GAP_PHYS.
+    uint16_t            conn_interval;  //!< Connection interval to request (in 1.25 ms units).
+    uint32_t            length;         //!< Number of bytes to transfer.
+} nrf_ble_tput_params_t;
+
+/**@brief Parameters of the link, as negotiated. */
+typedef struct
+{
+    uint16_t att_mtu;       //!< Effective ATT_MTU.
+    uint8_t  data_length;   //!< Effective data length.
+    uint8_t  tx_phy;        //!< TX PHY, see @ref BLE_GAP_PHYS.
+    uint8_t  rx_phy;        //!< RX PHY, see @ref BLE_GAP_PHYS.
+    uint16_t conn_interval; //!< Connection interval (in 1.25 ms units).
+} nrf_ble_tput_link_t;
+
+/**@brief Report of a transfer. */
+typedef struct
+{
+    bool                is_sender;          //!< True if this device sent the data.
+    bool                is_complete;        //!< False if the transfer was stopped by a disconnection or an error.
+    uint32_t            bytes;              //!< Number of bytes sent or received.
+    uint32_t            packets;            //!< Number of packets sent or received.
+    uint32_t            elapsed_us;         //!< Duration of the transfer (in microseconds).
+    uint32_t            kbps;               //!< Throughput (in kilobits per second).
+    uint32_t            pkts_per_evt_x10;   //!< Average number of packets per connection event, multiplied by 10.
+    uint16_t            pkts_per_evt_max;   //!< Largest number of packets completed in one transmit complete event (sender only).
+    uint32_t            latency_avg_us;     //!< Average latency above the fastest packet (receiver only).
+    uint32_t            latency_max_us;     //!< Largest latency above the fastest packet (receiver only).
+    uint32_t            lost;               //!< Number of missing sequence numbers (receiver only).
+    nrf_ble_tput_link_t link;               //!< Parameters of the link during the transfer.
+} nrf_ble_tput_result_t;
+
+/**@brief Benchmark event. */
+typedef struct
+{
+    nrf_ble_tput_evt_type_t       evt_type;     //!< Type of event.
+    uint16_t                      conn_handle;  //!< Connection the transfer ran on.
+    nrf_ble_tput_result_t const * p_result;     //!< Report of the transfer.
+} nrf_ble_tput_evt_t;
+
+/**@brief Function for filling the payload of a packet after the header.
+ *
+ * @param[out]  p_data  Payload to fill.
+ * @param[in]   len     Length of the payload.
+ */
+typedef void (*nrf_ble_tput_data_handler_t)(uint8_t * p_data, uint16_t len);
+
+/**@brief Benchmark event handler type. */
+typedef void (*nrf_ble_tput_evt_handler_t)(nrf_ble_tput_evt_t const * p_evt);
+
+/**@brief Benchmark structure.
+ *
+ * @note The fields are set by @ref nrf_ble_tput_init and are not to be changed by the
+ *       application.
+ */
+typedef struct
+{
+    nrf_ble_gatt_t              * p_gatt;           //!< GATT module negotiating the ATT_MTU and the data length.
+#if NRF_MODULE_ENABLED(BLE_NUS)
+    ble_nus_t                   * p_nus;            //!< Nordic UART Service used in the peripheral role, or NULL.
+#endif
+#if NRF_MODULE_ENABLED(BLE_NUS_C)
+    ble_nus_c_t                 * p_nus_c;          //!< Nordic UART Service client used in the central role, or NULL.
+#endif
+    nrf_ble_tput_evt_handler_t    evt_handler;      //!< Application event handler, or NULL.
+    nrf_ble_tput_data_handler_t   data_handler;     //!< Payload source, or NULL for a synthetic pattern.
+    nrf_ble_tput_params_t         params;           //!< Parameters of the transfer.
+    uint16_t                      conn_handle;      //!< Handle of the current connection, or BLE_CONN_HANDLE_INVALID.
+    uint8_t                       role;             //!< GAP role on the current connection.
+    bool                          phy_pending;      //!< A PHY update is to be requested.
+    bool                          running;          //!< A transfer is in progress.
+    nrf_ble_tput_link_t           link;             //!< Parameters of the current connection.
+    uint32_t                      seq;              //!< Sender: next sequence number. Receiver: next expected sequence number.
+    uint32_t                      bytes;            //!< Number of bytes queued or received.
+    uint32_t                      packets_done;     //!< Sender: number of packets completed. Receiver: number of packets received.
+    uint16_t                      pkts_per_evt_max; //!< Largest number of packets completed in one event.
+    uint32_t                      last_ticks;       //!< app_timer counter at the last time the elapsed time was updated.
+    uint32_t                      elapsed_ticks;    //!< Duration of the transfer (in app_timer ticks).
+    uint32_t                      rx_first_len;     //!< Length of the first packet received, which is not part of the throughput.
+    uint32_t                      lost;             //!< Number of missing sequence numbers.
+    uint32_t                      first_offset;     //!< Clock offset of the first packet received.
+    int32_t                       delay_min;        //!< Smallest delay relative to the first packet (in ticks).
+    int32_t                       delay_max;        //!< Largest delay relative to the first packet (in ticks).
+    int64_t                       delay_sum;        //!< Sum of the delays relative to the first packet (in ticks).
+} nrf_ble_tput_t;
+
+/**@brief Benchmark init structure. */
+typedef struct
+{
+    nrf_ble_gatt_t              * p_gatt;       //!< Initialized GATT module.
+#if NRF_MODULE_ENABLED(BLE_NUS)
+    ble_nus_t                   * p_nus;        //!< Initialized Nordic UART Service on the peripheral, or NULL.
+#endif
+#if NRF_MODULE_ENABLED(BLE_NUS_C)
+    ble_nus_c_t                 * p_nus_c;      //!< Initialized Nordic UART Service client on the central, or NULL.
+#endif
+    nrf_ble_tput_evt_handler_t    evt_handler;  //!< Application event handler, or NULL.
+    nrf_ble_tput_data_handler_t   data_handler; //!< Payload source, or NULL for a synthetic pattern.
+    nrf_ble_tput_params_t         params;       //!< Parameters of the transfer.
+} nrf_ble_tput_init_t;
+
+
+/**@brief Function for initializing the benchmark.
+ *
+ * @details Must be called after @ref nrf_ble_gatt_init and the initialization of the Nordic UART
+ *          Service or its client, and before the devices connect.
+ *
+ * @param[out]  p_tput      Benchmark structure.
+ * @param[in]   p_tput_init Information needed to initialize the benchmark.
+ *
+ * @retval NRF_SUCCESS             If the benchmark was initialized.
+ * @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If the parameters are invalid.
+ */
+ret_code_t nrf_ble_tput_init(nrf_ble_tput_t * p_tput, nrf_ble_tput_init_t const * p_tput_init);
+
+
+/**@brief Function for changing the parameters of the next transfers.
+ *
+ * @details The ATT_MTU and the data length are requested on the next connection. The PHY and
+ *          the connection interval are also requested at once if there is a connection.
+ *
+ * @param[in]   p_tput      Benchmark structure.
+ * @param[in]   p_params    Parameters of the transfer.
+ *
+ * @retval NRF_SUCCESS             If the parameters were set.
+ * @retval NRF_ERROR_NULL          If any of the input parameters are NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If the parameters are invalid.
+ * @retval NRF_ERROR_BUSY          If a transfer is in progress.
+ */
+ret_code_t nrf_ble_tput_params_set(nrf_ble_tput_t * p_tput, nrf_ble_tput_params_t const * p_params);
+
+
+/**@brief Function for starting a transfer on the sender.
+ *
+ * @details Call this function on the peripheral once the central has enabled notifications
+ *          (@ref BLE_NUS_EVT_COMM_STARTED), or on the central once the handles of the peer have
+ *          been assigned with @ref ble_nus_c_handles_assign. The receiver needs no call: it
+ *          starts measuring on the first packet with sequence number 0. Packets are sized for
+ *          the ATT_MTU at the time of the call, so start after the ATT_MTU exchange has finished.
+ *
+ * @param[in]   p_tput  Benchmark structure.
+ *
+ * @retval NRF_SUCCESS             If the transfer was started.
+ * @retval NRF_ERROR_NULL          If @p p_tput is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If there is no connection, or this device is not the sender in
+ *                                 the selected mode.
+ * @retval NRF_ERROR_BUSY          If a transfer is in progress.
+ * @retval err_code                Otherwise, the error returned when sending the first packet.
+ */
+ret_code_t nrf_ble_tput_start(nrf_ble_tput_t * p_tput);
+
+
+/**@brief Function for handling BLE stack events.
+ *
+ * @param[in]   p_ble_evt   Event received from the BLE stack.
+ * @param[in]   p_context   Benchmark structure.
+ */
+void nrf_ble_tput_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BLE_TPUT_H__
+
+/** @} */
@@ -65,132 +65,327 @@ NRF_LOG_MODULE_REGISTER();
     _lvl = (PENALITY_LVL_TO_PENALITY_MS(_lvl) >= (PM_RA_PROTECTION_MAX_WAIT_INTERVAL)) ? \
            (_lvl) : (_lvl + 1)
 
+// Every entry waits in one of the expiry queues below. All entries in a queue wait for the same
+// duration and are appended in the order they are scheduled, so each queue is sorted by deadline
+// and only the queue heads have to be inspected to find the next expiry.
+#define PENALITY_LVL_COUNT  16                  /**< Number of penality levels, each with its own expiry queue. */
+#define QUEUE_REWARD        PENALITY_LVL_COUNT  /**< Expiry queue of peers waiting for the next reward step. */
+#define QUEUE_COUNT         (PENALITY_LVL_COUNT + 1)
+#define PEER_ID_INVALID     0xFF
+
+STATIC_ASSERT(PENALITY_LVL_TO_PENALITY_MS((PENALITY_LVL_COUNT - 1)) >= PM_RA_PROTECTION_MAX_WAIT_INTERVAL,
+              "PM_RA_PROTECTION_MAX_WAIT_INTERVAL needs more penality levels than are supported.");
+STATIC_ASSERT(PM_RA_PROTECTION_TRACKED_PEERS_NUM < PEER_ID_INVALID,
+              "PM_RA_PROTECTION_TRACKED_PEERS_NUM is too large.");
+
 
 /**@brief Tracked peer state. */
 typedef struct
 {
     ble_gap_addr_t peer_addr;      /**< BLE address, used to identify peer. */
-    uint32_t       reward_ticks;   /**< Accumulated reward ticks, used to decrease penality level
-                                        after achieving certain threshold. */
-    uint32_t       penality_ticks; /**< Accumulated penality ticks, used to determine remaining time
-                                        in which pairing attempts should be rejected. */
+    uint32_t       deadline;       /**< Time of the next state transition: the end of the waiting
+                                        interval while active, the next reward step otherwise. */
     uint8_t        penality_lvl;   /**< Accumulated penality level, used to determine waiting interval
                                         after failed authorization attempt. */
     bool           is_active;      /**< Flag indicating that the waiting interval for this peer has not
                                         passed yet. */
     bool           is_valid;       /**< Flag indicating that this entry is valid in the peer blacklist. */
+    uint8_t        hash_next;      /**< Next entry in the same hash bucket, or in the free list. */
+    uint8_t        queue;          /**< Expiry queue the entry is in. */
+    uint8_t        queue_prev;     /**< Previous entry in the expiry queue. */
+    uint8_t        queue_next;     /**< Next entry in the expiry queue. */
 } blacklisted_peer_t;
 
+/**@brief Expiry queue, a list of entries sorted by deadline. */
+typedef struct
+{
+    uint8_t head;
+    uint8_t tail;
+} expiry_queue_t;
+
 APP_TIMER_DEF(m_pairing_attempt_timer);
 static blacklisted_peer_t m_blacklisted_peers[PM_RA_PROTECTION_TRACKED_PEERS_NUM];
-static uint32_t           m_ticks_cnt;
+static uint8_t            m_buckets[PM_RA_PROTECTION_TRACKED_PEERS_NUM]; /**< Hash table of entries keyed by address. */
+static expiry_queue_t     m_queues[QUEUE_COUNT];
+static uint8_t            m_free_id;   /**< First entry of the free list. */
+static uint32_t           m_now;       /**< Ticks elapsed since initialization, wraps around. */
+static uint32_t           m_ticks_cnt; /**< RTC counter value when m_now was last updated. */
 
 
-/**@brief Function for updating the state of blacklisted peers after timer has been stopped or
- *        timed out.
+/**@brief Function for checking whether a deadline has been reached. */
+static bool deadline_passed(uint32_t deadline, uint32_t now)
+{
+    return ((int32_t)(now - deadline) >= 0);
+}
+
+
+/**@brief Function for bringing the module time up to date.
  *
- * @param[in]  ticks_passed  The number of ticks since the timer has started.
+ * @return Current module time in ticks.
  */
-static uint32_t blacklisted_peers_state_update(uint32_t ticks_passed)
+static uint32_t time_update(void)
 {
-    uint32_t minimal_ticks = UINT32_MAX;
+    uint32_t ticks_cnt = app_timer_cnt_get();
 
-    for (uint32_t id = 0; id < ARRAY_SIZE(m_blacklisted_peers); id++)
+    m_now      += app_timer_cnt_diff_compute(ticks_cnt, m_ticks_cnt);
+    m_ticks_cnt = ticks_cnt;
+
+    return m_now;
+}
+
+
+/**@brief Function for getting the hash bucket of a peer address. */
+static uint8_t * bucket_get(ble_gap_addr_t const * p_addr)
+{
+    uint32_t hash = 2166136261UL;
+
+    for (uint32_t i = 0; i < BLE_GAP_ADDR_LEN; i++)
     {
-        blacklisted_peer_t * p_bl_peer = &m_blacklisted_peers[id];
+        hash = (hash ^ p_addr->addr[i]) * 16777619UL;
+    }
+
+    return &m_buckets[hash % ARRAY_SIZE(m_buckets)];
+}
+
 
-        if (p_bl_peer->is_valid)
+/**@brief Function for finding the entry of a peer.
+ *
+ * @return Entry ID, or @ref PEER_ID_INVALID if the peer is not tracked.
+ */
+static uint8_t peer_find(ble_gap_addr_t const * p_addr)
+{
+    uint8_t id = *bucket_get(p_addr);
+
+    while (id != PEER_ID_INVALID)
+    {
+        if (memcmp(p_addr->addr, m_blacklisted_peers[id].peer_addr.addr, BLE_GAP_ADDR_LEN) == 0)
         {
-            if (p_bl_peer->is_active)
-            {
-                if (p_bl_peer->penality_ticks > ticks_passed)
-                {
-                    p_bl_peer->penality_ticks -= ticks_passed;
-                    minimal_ticks              = MIN(minimal_ticks, p_bl_peer->penality_ticks);
-                }
-                else
-                {
-                    p_bl_peer->is_active = false;
-
-                    if (p_bl_peer->penality_lvl == 0)
-                    {
-                        p_bl_peer->is_valid = false;
-                        NRF_LOG_DEBUG("Peer has been removed from the blacklist, its address:");
-                        NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr,
-                                              sizeof(p_bl_peer->peer_addr.addr));
-                    }
-                    else
-                    {
-                        minimal_ticks = MIN(minimal_ticks, PAIR_REWARD_TICKS);
-                    }
-
-                    NRF_LOG_DEBUG("Pairing waiting interval has expired for:");
-                    NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr,
-                                          sizeof(p_bl_peer->peer_addr.addr));
-                }
-            }
-            else
-            {
-                if (p_bl_peer->penality_lvl == 0)
-                {
-                    p_bl_peer->is_valid = false;
-                    NRF_LOG_DEBUG("Peer has been removed from the blacklist, its address:");
-                    NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr,
-                                          sizeof(p_bl_peer->peer_addr.addr));
-                }
-                else
-                {
-                    p_bl_peer->reward_ticks += ticks_passed;
-                    if (p_bl_peer->reward_ticks >= PAIR_REWARD_TICKS)
-                    {
-                        p_bl_peer->penality_lvl--;
-                        p_bl_peer->reward_ticks -= PAIR_REWARD_TICKS;
-                        NRF_LOG_DEBUG("Peer penality level has decreased to %d for device:",
-                                      p_bl_peer->penality_lvl);
-                        NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr,
-                                              sizeof(p_bl_peer->peer_addr.addr));
-                    }
-
-                    minimal_ticks = MIN(minimal_ticks,
-                                        (PAIR_REWARD_TICKS - p_bl_peer->reward_ticks));
-                }
-            }
+            break;
         }
+        id = m_blacklisted_peers[id].hash_next;
     }
 
-    return minimal_ticks;
+    return id;
 }
 
 
-/**@brief Function for handling state transition of blacklisted peers.
+/**@brief Function for appending an entry to an expiry queue.
  *
- * @param[in]  context  Context containing the number of ticks since the timer has started.
+ * @param[in]  id        Entry ID.
+ * @param[in]  queue     Expiry queue. All entries in it must wait for the same duration.
+ * @param[in]  deadline  Time of the next state transition of the entry.
  */
-static void blacklisted_peers_state_transition_handle(void * context)
+static void queue_append(uint8_t id, uint8_t queue, uint32_t deadline)
 {
-    ret_code_t err_code;
-    uint32_t   minimal_ticks;
-    uint32_t   ticks_passed = (uint32_t) context;
+    blacklisted_peer_t * p_bl_peer = &m_blacklisted_peers[id];
+    expiry_queue_t     * p_queue   = &m_queues[queue];
+
+    p_bl_peer->deadline   = deadline;
+    p_bl_peer->queue      = queue;
+    p_bl_peer->queue_prev = p_queue->tail;
+    p_bl_peer->queue_next = PEER_ID_INVALID;
+
+    if (p_queue->tail == PEER_ID_INVALID)
+    {
+        p_queue->head = id;
+    }
+    else
+    {
+        m_blacklisted_peers[p_queue->tail].queue_next = id;
+    }
+    p_queue->tail = id;
+}
+
+
+/**@brief Function for unlinking an entry from its expiry queue. */
+static void queue_remove(uint8_t id)
+{
+    blacklisted_peer_t * p_bl_peer = &m_blacklisted_peers[id];
+    expiry_queue_t     * p_queue   = &m_queues[p_bl_peer->queue];
+
+    if (p_bl_peer->queue_prev == PEER_ID_INVALID)
+    {
+        p_queue->head = p_bl_peer->queue_next;
+    }
+    else
+    {
+        m_blacklisted_peers[p_bl_peer->queue_prev].queue_next = p_bl_peer->queue_next;
+    }
+
+    if (p_bl_peer->queue_next == PEER_ID_INVALID)
+    {
+        p_queue->tail = p_bl_peer->queue_prev;
+    }
+    else
+    {
+        m_blacklisted_peers[p_bl_peer->queue_next].queue_prev = p_bl_peer->queue_prev;
+    }
+}
+
+
+/**@brief Function for finding the entry with the earliest deadline.
+ *
+ * @return Entry ID, or @ref PEER_ID_INVALID if no peer is tracked.
+ */
+static uint8_t earliest_find(void)
+{
+    uint8_t earliest = PEER_ID_INVALID;
+
+    for (uint32_t queue = 0; queue < QUEUE_COUNT; queue++)
+    {
+        uint8_t id = m_queues[queue].head;
+
+        if ((id != PEER_ID_INVALID) &&
+            ((earliest == PEER_ID_INVALID) ||
+             !deadline_passed(m_blacklisted_peers[earliest].deadline,
+                              m_blacklisted_peers[id].deadline)))
+        {
+            earliest = id;
+        }
+    }
+
+    return earliest;
+}
+
+
+/**@brief Function for removing a peer from the blacklist. */
+static void peer_remove(uint8_t id)
+{
+    blacklisted_peer_t * p_bl_peer = &m_blacklisted_peers[id];
+    uint8_t            * p_id      = bucket_get(&p_bl_peer->peer_addr);
+
+    queue_remove(id);
+
+    while (*p_id != id)
+    {
+        p_id = &m_blacklisted_peers[*p_id].hash_next;
+    }
+    *p_id = p_bl_peer->hash_next;
+
+    p_bl_peer->is_valid  = false;
+    p_bl_peer->hash_next = m_free_id;
+    m_free_id            = id;
+
+    NRF_LOG_DEBUG("Peer has been removed from the blacklist, its address:");
+    NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr, sizeof(p_bl_peer->peer_addr.addr));
+}
+
+
+/**@brief Function for handling the state transition of a blacklisted peer whose deadline has
+ *        been reached.
+ *
+ * @param[in]  id  Entry ID.
+ */
+static void peer_expire(uint8_t id)
+{
+    blacklisted_peer_t * p_bl_peer = &m_blacklisted_peers[id];
+    uint32_t             deadline  = p_bl_peer->deadline;
+
+    if (p_bl_peer->is_active)
+    {
+        p_bl_peer->is_active = false;
+
+        NRF_LOG_DEBUG("Pairing waiting interval has expired for:");
+        NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr, sizeof(p_bl_peer->peer_addr.addr));
+    }
+    else
+    {
+        p_bl_peer->penality_lvl--;
+
+        NRF_LOG_DEBUG("Peer penality level has decreased to %d for device:",
+                      p_bl_peer->penality_lvl);
+        NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr, sizeof(p_bl_peer->peer_addr.addr));
+    }
+
+    if (p_bl_peer->penality_lvl == 0)
+    {
+        peer_remove(id);
+    }
+    else
+    {
+        // Reward steps are counted from the deadline rather than from the current time, so that a
+        // late timer does not delay them.
+        queue_remove(id);
+        queue_append(id, QUEUE_REWARD, deadline + PAIR_REWARD_TICKS);
+    }
+}
+
 
-    minimal_ticks = blacklisted_peers_state_update(ticks_passed);
-    m_ticks_cnt   = app_timer_cnt_get();
+/**@brief Function for updating the state of all blacklisted peers whose deadline has been reached.
+ *
+ * @param[in]  now  Current module time.
+ */
+static void blacklisted_peers_state_update(uint32_t now)
+{
+    uint8_t id;
 
-    if (minimal_ticks != UINT32_MAX)
+    while (((id = earliest_find()) != PEER_ID_INVALID) &&
+           deadline_passed(m_blacklisted_peers[id].deadline, now))
     {
-        err_code = app_timer_start(m_pairing_attempt_timer,
-                                   minimal_ticks,
-                                   (void *) minimal_ticks);
+        peer_expire(id);
+    }
+}
+
+
+/**@brief Function for starting the timer for the earliest deadline, if there is one.
+ *
+ * @param[in]  now  Current module time.
+ */
+static void timer_start(uint32_t now)
+{
+    ret_code_t err_code;
+    uint8_t    id = earliest_find();
+
+    if (id != PEER_ID_INVALID)
+    {
+        uint32_t timeout = MAX(m_blacklisted_peers[id].deadline - now, APP_TIMER_MIN_TIMEOUT_TICKS);
+
+        err_code = app_timer_start(m_pairing_attempt_timer, timeout, NULL);
         if (err_code != NRF_SUCCESS)
         {
             NRF_LOG_WARNING("app_timer_start() returned %s", nrf_strerror_get(err_code));
         }
-        NRF_LOG_DEBUG("Restarting the timer");
     }
 }
 
 
+/**@brief Function for handling state transition of blacklisted peers.
+ *
+ * @param[in]  context  Unused.
+ */
+static void blacklisted_peers_state_transition_handle(void * context)
+{
+    UNUSED_PARAMETER(context);
+
+    uint32_t now = time_update();
+
+    blacklisted_peers_state_update(now);
+    timer_start(now);
+    NRF_LOG_DEBUG("Restarting the timer");
+}
+
+
 ret_code_t ast_init(void)
 {
+    memset(m_buckets, PEER_ID_INVALID, sizeof(m_buckets));
+
+    for (uint32_t queue = 0; queue < QUEUE_COUNT; queue++)
+    {
+        m_queues[queue].head = PEER_ID_INVALID;
+        m_queues[queue].tail = PEER_ID_INVALID;
+    }
+
+    for (uint32_t id = 0; id < ARRAY_SIZE(m_blacklisted_peers); id++)
+    {
+        m_blacklisted_peers[id].is_valid  = false;
+        m_blacklisted_peers[id].hash_next = (id + 1 < ARRAY_SIZE(m_blacklisted_peers)) ?
+                                            (id + 1) : PEER_ID_INVALID;
+    }
+    m_free_id = 0;
+
+    m_now       = 0;
+    m_ticks_cnt = app_timer_cnt_get();
+
     ret_code_t err_code = app_timer_create(&m_pairing_attempt_timer,
                                            APP_TIMER_MODE_SINGLE_SHOT,
                                            blacklisted_peers_state_transition_handle);
@@ -201,11 +396,11 @@ ret_code_t ast_init(void)
 
 void ast_auth_error_notify(uint16_t conn_handle)
 {
-    ret_code_t     err_code;
-    ble_gap_addr_t peer_addr;
-    uint32_t       new_timeout;
-    uint32_t       free_id      = ARRAY_SIZE(m_blacklisted_peers);
-    bool           new_bl_entry = true;
+    ret_code_t           err_code;
+    ble_gap_addr_t       peer_addr;
+    blacklisted_peer_t * p_bl_peer;
+    uint32_t             now;
+    uint8_t              id;
 
     // Get the peer address associated with connection handle.
     err_code = im_ble_addr_get(conn_handle, &peer_addr);
@@ -218,7 +413,7 @@ void ast_auth_error_notify(uint16_t conn_handle)
         return;
     }
 
-    // Stop the timer and update the state of all blacklisted peers.
+    // Stop the timer and catch up on the deadlines that have already passed.
     err_code = app_timer_stop(m_pairing_attempt_timer);
     if (err_code != NRF_SUCCESS)
     {
@@ -226,81 +421,59 @@ void ast_auth_error_notify(uint16_t conn_handle)
         return;
     }
 
-    new_timeout = blacklisted_peers_state_update(app_timer_cnt_diff_compute(app_timer_cnt_get(),
-                                                                            m_ticks_cnt));
-    m_ticks_cnt = app_timer_cnt_get();
+    now = time_update();
+    blacklisted_peers_state_update(now);
 
-    // Check if authorization has failed for already blacklisted peer.
-    for (uint32_t id = 0; id < ARRAY_SIZE(m_blacklisted_peers); id++)
+    id = peer_find(&peer_addr);
+    if (id != PEER_ID_INVALID)
     {
-        blacklisted_peer_t * p_bl_peer = &m_blacklisted_peers[id];
+        // Authorization has failed for already blacklisted peer.
+        uint8_t lvl;
 
-        if (p_bl_peer->is_valid)
-        {
-            if (memcmp(peer_addr.addr, p_bl_peer->peer_addr.addr, BLE_GAP_ADDR_LEN) == 0)
-            {
-                uint8_t lvl = p_bl_peer->penality_lvl;
-
-                PENALITY_LVL_NEXT_SET(lvl);
-                p_bl_peer->penality_lvl   = lvl;
-                p_bl_peer->reward_ticks   = 0;
-                p_bl_peer->penality_ticks = PENALITY_LVL_TO_PENALITY_TICKS(lvl);
-
-                new_timeout = MIN(new_timeout, p_bl_peer->penality_ticks);
-
-                p_bl_peer->is_active = true;
-                new_bl_entry         = false;
-
-                NRF_LOG_DEBUG("Pairing waiting interval has been renewed. "
-                              "Penality level: %d for device:",
-                              lvl);
-                NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr,
-                                      sizeof(p_bl_peer->peer_addr.addr));
-            }
-        }
-        else
-        {
-            free_id = id;
-        }
-    }
+        p_bl_peer = &m_blacklisted_peers[id];
+        lvl       = p_bl_peer->penality_lvl;
+
+        PENALITY_LVL_NEXT_SET(lvl);
+        p_bl_peer->penality_lvl = lvl;
+        p_bl_peer->is_active    = true;
 
-    // Add a new peer to the blacklist.
-    if (new_bl_entry)
+        queue_remove(id);
+        queue_append(id, lvl, now + PENALITY_LVL_TO_PENALITY_TICKS(lvl));
+
+        NRF_LOG_DEBUG("Pairing waiting interval has been renewed. "
+                      "Penality level: %d for device:",
+                      lvl);
+        NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr, sizeof(p_bl_peer->peer_addr.addr));
+    }
+    else if (m_free_id != PEER_ID_INVALID)
     {
-        if (free_id < ARRAY_SIZE(m_blacklisted_peers))
-        {
-            blacklisted_peer_t * p_bl_peer = &m_blacklisted_peers[free_id];
+        // Add a new peer to the blacklist.
+        uint8_t * p_bucket = bucket_get(&peer_addr);
 
-            memcpy(&p_bl_peer->peer_addr, &peer_addr, sizeof(peer_addr));
+        id        = m_free_id;
+        p_bl_peer = &m_blacklisted_peers[id];
+        m_free_id = p_bl_peer->hash_next;
 
-            p_bl_peer->penality_lvl   = 0;
-            p_bl_peer->reward_ticks   = 0;
-            p_bl_peer->penality_ticks = PENALITY_LVL_TO_PENALITY_TICKS(p_bl_peer->penality_lvl);
+        memcpy(&p_bl_peer->peer_addr, &peer_addr, sizeof(peer_addr));
 
-            new_timeout = MIN(new_timeout, p_bl_peer->penality_ticks);
+        p_bl_peer->penality_lvl = 0;
+        p_bl_peer->is_active    = true;
+        p_bl_peer->is_valid     = true;
+        p_bl_peer->hash_next    = *p_bucket;
+        *p_bucket               = id;
 
-            p_bl_peer->is_active = true;
-            p_bl_peer->is_valid  = true;
-            NRF_LOG_DEBUG("New peer has been added to the blacklist:");
-            NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr, sizeof(p_bl_peer->peer_addr.addr));
-        }
-        else
-        {
-            NRF_LOG_WARNING("No space to blacklist another peer ID");
-        }
-    }
+        queue_append(id, 0, now + PENALITY_LVL_TO_PENALITY_TICKS(0));
 
-    // Restart the timer.
-    if (new_timeout != UINT32_MAX)
+        NRF_LOG_DEBUG("New peer has been added to the blacklist:");
+        NRF_LOG_HEXDUMP_DEBUG(p_bl_peer->peer_addr.addr, sizeof(p_bl_peer->peer_addr.addr));
+    }
+    else
     {
-        err_code = app_timer_start(m_pairing_attempt_timer,
-                                   new_timeout,
-                                   (void *) new_timeout);
-        if (err_code != NRF_SUCCESS)
-        {
-            NRF_LOG_WARNING("app_timer_start() returned %s", nrf_strerror_get(err_code));
-        }
+        NRF_LOG_WARNING("No space to blacklist another peer ID");
     }
+
+    // Restart the timer.
+    timer_start(now);
 }
 
 
@@ -308,6 +481,7 @@ bool ast_peer_blacklisted(uint16_t conn_handle)
 {
     ret_code_t     err_code;
     ble_gap_addr_t peer_addr;
+    uint8_t        id;
 
     err_code = im_ble_addr_get(conn_handle, &peer_addr);
     if (err_code != NRF_SUCCESS)
@@ -319,21 +493,9 @@ bool ast_peer_blacklisted(uint16_t conn_handle)
         return true;
     }
 
-    for (uint32_t id = 0; id < ARRAY_SIZE(m_blacklisted_peers); id++)
-    {
-        blacklisted_peer_t * p_bl_peer = &m_blacklisted_peers[id];
-
-        if (p_bl_peer->is_valid)
-        {
-            if ((memcmp(peer_addr.addr, p_bl_peer->peer_addr.addr, BLE_GAP_ADDR_LEN) == 0) &&
-                (p_bl_peer->is_active))
-            {
-                return true;
-            }
-        }
-    }
+    id = peer_find(&peer_addr);
 
-    return false;
+    return ((id != PEER_ID_INVALID) && m_blacklisted_peers[id].is_active);
 }
 
 
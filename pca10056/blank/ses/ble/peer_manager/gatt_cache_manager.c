@@ -87,10 +87,22 @@ static ble_conn_state_user_flag_id_t  m_flag_service_changed_sent;    /**< Flag
 static ble_conn_state_user_flag_id_t  m_flag_car_update_pending;      /**< Flag ID for flag collection to keep track of which connections need to have their Central Address Resolution value stored. */
 static ble_conn_state_user_flag_id_t  m_flag_car_handle_queried;      /**< Flag ID for flag collection to keep track of which connections are pending Central Address Resolution handle reply. */
 static ble_conn_state_user_flag_id_t  m_flag_car_value_queried;       /**< Flag ID for flag collection to keep track of which connections are pending Central Address Resolution value reply. */
+#if PM_GATT_CACHING_ENABLED
+static ble_gatts_char_handles_t       m_db_hash_handles;              /**< Handles of the Database Hash characteristic. */
+static ble_gatts_char_handles_t       m_client_features_handles;      /**< Handles of the Client Supported Features characteristic. */
+static uint8_t                        m_client_features[BLE_CONN_STATE_MAX_CONNECTIONS]; /**< The Client Supported Features value of each connection. */
+
+#define GCM_UUID_DB_HASH                0x2B2A  /**< The UUID of the Database Hash characteristic. */
+#define GCM_UUID_CLIENT_FEATURES        0x2B29  /**< The UUID of the Client Supported Features characteristic. */
+#define GCM_CLIENT_FEATURES_LEN         1       /**< The length of the Client Supported Features value. */
+#define GCM_CLIENT_FEATURES_SUPPORTED   0x01    /**< The client features known to this server: Robust Caching. */
+#endif
 
 #ifdef PM_SERVICE_CHANGED_ENABLED
     STATIC_ASSERT(PM_SERVICE_CHANGED_ENABLED || !NRF_SDH_BLE_SERVICE_CHANGED,
                  "PM_SERVICE_CHANGED_ENABLED should be enabled if NRF_SDH_BLE_SERVICE_CHANGED is enabled.");
+    STATIC_ASSERT(PM_SERVICE_CHANGED_ENABLED || !PM_GATT_CACHING_ENABLED,
+                 "PM_SERVICE_CHANGED_ENABLED should be enabled if PM_GATT_CACHING_ENABLED is enabled.");
 #else
     #define PM_SERVICE_CHANGED_ENABLED 1
 #endif
@@ -520,6 +532,209 @@ static __INLINE void update_pending_flags_check(void)
 }
 
 
+#if PM_GATT_CACHING_ENABLED
+/**@brief Function for adding one of the GATT caching characteristics.
+ *
+ * @param[in]  service_handle  The service to add the characteristic to.
+ * @param[in]  uuid            The UUID of the characteristic.
+ * @param[in]  len             The length of the value.
+ * @param[in]  writable        Whether the characteristic can be written.
+ * @param[out] p_handles       The handles of the characteristic.
+ *
+ * @return  Any error from @ref sd_ble_gatts_characteristic_add.
+ */
+static ret_code_t gatt_caching_char_add(uint16_t                   service_handle,
+                                        uint16_t                   uuid,
+                                        uint16_t                   len,
+                                        bool                       writable,
+                                        ble_gatts_char_handles_t * p_handles)
+{
+    ble_gatts_char_md_t char_md;
+    ble_gatts_attr_md_t attr_md;
+    ble_gatts_attr_t    attr_char_value;
+    ble_uuid_t          char_uuid = {.uuid = uuid, .type = BLE_UUID_TYPE_BLE};
+
+    memset(&char_md, 0, sizeof(char_md));
+    memset(&attr_md, 0, sizeof(attr_md));
+    memset(&attr_char_value, 0, sizeof(attr_char_value));
+
+    char_md.char_props.read  = 1;
+    char_md.char_props.write = writable;
+
+    // The values are given per connection, so all accesses are authorized.
+    BLE_GAP_CONN_SEC_MODE_SET_OPEN(&attr_md.read_perm);
+    if (writable)
+    {
+        BLE_GAP_CONN_SEC_MODE_SET_OPEN(&attr_md.write_perm);
+    }
+    attr_md.vloc    = BLE_GATTS_VLOC_STACK;
+    attr_md.rd_auth = 1;
+    attr_md.wr_auth = writable;
+
+    attr_char_value.p_uuid    = &char_uuid;
+    attr_char_value.p_attr_md = &attr_md;
+    attr_char_value.init_len  = len;
+    attr_char_value.max_len   = len;
+
+    return sd_ble_gatts_characteristic_add(service_handle, &char_md, &attr_char_value, p_handles);
+}
+
+
+/**@brief Function for adding the Database Hash and Client Supported Features characteristics.
+ *
+ * @details The GATT service of the SoftDevice cannot be extended, so the characteristics are put
+ *          in a GATT service of their own. If the SoftDevice does not allow that, they are put
+ *          in the last service added by the application. Clients find them by UUID.
+ *
+ * @return  Any error from @ref sd_ble_gatts_service_add or @ref sd_ble_gatts_characteristic_add.
+ */
+static ret_code_t gatt_caching_init(void)
+{
+    ret_code_t err_code;
+    uint16_t   service_handle;
+    ble_uuid_t service_uuid = {.uuid = BLE_UUID_GATT, .type = BLE_UUID_TYPE_BLE};
+
+    memset(m_client_features, 0, sizeof(m_client_features));
+
+    err_code = sd_ble_gatts_service_add(BLE_GATTS_SRVC_TYPE_PRIMARY, &service_uuid, &service_handle);
+    if (err_code == NRF_ERROR_FORBIDDEN)
+    {
+        service_handle = BLE_GATT_HANDLE_INVALID;
+    }
+    else if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    err_code = gatt_caching_char_add(service_handle,
+                                     GCM_UUID_DB_HASH,
+                                     GSCM_DB_HASH_LEN,
+                                     false,
+                                     &m_db_hash_handles);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    return gatt_caching_char_add(service_handle,
+                                 GCM_UUID_CLIENT_FEATURES,
+                                 GCM_CLIENT_FEATURES_LEN,
+                                 true,
+                                 &m_client_features_handles);
+}
+
+
+/**@brief Function for marking a client as change-aware after it has read the Database Hash.
+ *
+ * @details The client now knows whether the database has changed, so a pending service changed
+ *          indication is dropped, unless it has already been sent.
+ *
+ * @param[in]  conn_handle  The connection of the client.
+ */
+static void change_aware_set(uint16_t conn_handle)
+{
+    if (   ble_conn_state_user_flag_get(conn_handle, m_flag_service_changed_pending)
+        && !ble_conn_state_user_flag_get(conn_handle, m_flag_service_changed_sent))
+    {
+        pm_peer_id_t peer_id = im_peer_id_get_by_conn_handle(conn_handle);
+
+        ble_conn_state_user_flag_set(conn_handle, m_flag_service_changed_pending, false);
+
+        if (peer_id != PM_PEER_ID_INVALID)
+        {
+            gscm_db_change_notification_done(peer_id);
+        }
+    }
+}
+
+
+/**@brief Function for replying to a read or write of the GATT caching characteristics.
+ *
+ * @param[in]  p_gatts_evt  The @ref BLE_GATTS_EVT_RW_AUTHORIZE_REQUEST event.
+ */
+static void gatt_caching_authorize_request_process(ble_gatts_evt_t const * p_gatts_evt)
+{
+    ble_gatts_evt_rw_authorize_request_t const * p_request = &p_gatts_evt->params.authorize_request;
+    ble_gatts_rw_authorize_reply_params_t        reply;
+    uint16_t                                     conn_handle = p_gatts_evt->conn_handle;
+    uint16_t                                     conn_idx    = ble_conn_state_conn_idx(conn_handle);
+    uint8_t                                      db_hash[GSCM_DB_HASH_LEN];
+    uint16_t                                     handle;
+
+    handle = (p_request->type == BLE_GATTS_AUTHORIZE_TYPE_READ) ? p_request->request.read.handle
+                                                                : p_request->request.write.handle;
+
+    if (   ((handle != m_db_hash_handles.value_handle) && (handle != m_client_features_handles.value_handle))
+        || (conn_idx >= BLE_CONN_STATE_MAX_CONNECTIONS))
+    {
+        return;
+    }
+
+    memset(&reply, 0, sizeof(reply));
+    reply.type = p_request->type;
+
+    if (p_request->type == BLE_GATTS_AUTHORIZE_TYPE_READ)
+    {
+        reply.params.read.gatt_status = BLE_GATT_STATUS_SUCCESS;
+        reply.params.read.update      = 1;
+
+        if (handle == m_db_hash_handles.value_handle)
+        {
+            if (gscm_db_hash_get(db_hash) == NRF_SUCCESS)
+            {
+                reply.params.read.len    = GSCM_DB_HASH_LEN;
+                reply.params.read.p_data = db_hash;
+                change_aware_set(conn_handle);
+            }
+            else
+            {
+                reply.params.read.gatt_status = BLE_GATT_STATUS_ATTERR_UNLIKELY_ERROR;
+                reply.params.read.update      = 0;
+            }
+        }
+        else
+        {
+            reply.params.read.len    = GCM_CLIENT_FEATURES_LEN;
+            reply.params.read.p_data = &m_client_features[conn_idx];
+        }
+    }
+    else
+    {
+        ble_gatts_evt_write_t const * p_write = &p_request->request.write;
+
+        if (p_write->op != BLE_GATTS_OP_WRITE_REQ)
+        {
+            reply.params.write.gatt_status = BLE_GATT_STATUS_ATTERR_REQUEST_NOT_SUPPORTED;
+        }
+        else if ((p_write->offset != 0) || (p_write->len != GCM_CLIENT_FEATURES_LEN))
+        {
+            reply.params.write.gatt_status = BLE_GATT_STATUS_ATTERR_INVALID_ATT_VAL_LENGTH;
+        }
+        else
+        {
+            // A client may not clear features it has enabled, so the bits are only ever set.
+            // Unknown features are ignored.
+            m_client_features[conn_idx] |= (p_write->data[0] & GCM_CLIENT_FEATURES_SUPPORTED);
+
+            reply.params.write.gatt_status = BLE_GATT_STATUS_SUCCESS;
+            reply.params.write.update      = 1;
+            reply.params.write.len         = GCM_CLIENT_FEATURES_LEN;
+            reply.params.write.p_data      = &m_client_features[conn_idx];
+        }
+    }
+
+    ret_code_t err_code = sd_ble_gatts_rw_authorize_reply(conn_handle, &reply);
+    if ((err_code != NRF_SUCCESS) && (err_code != BLE_ERROR_INVALID_CONN_HANDLE))
+    {
+        NRF_LOG_ERROR("sd_ble_gatts_rw_authorize_reply() returned %s for conn_handle: %d",
+                      nrf_strerror_get(err_code),
+                      conn_handle);
+        send_unexpected_error(conn_handle, err_code);
+    }
+}
+#endif // PM_GATT_CACHING_ENABLED
+
+
 /**@brief Callback function for events from the ID Manager module.
  *        This function is registered in the ID Manager module.
  *
@@ -642,6 +857,16 @@ ret_code_t gcm_init()
 
     nrf_mtx_init(&m_db_update_in_progress_mutex);
 
+#if PM_GATT_CACHING_ENABLED
+    ret_code_t err_code = gatt_caching_init();
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("Could not add the GATT caching characteristics. Error: %s.",
+                      nrf_strerror_get(err_code));
+        return NRF_ERROR_INTERNAL;
+    }
+#endif
+
     m_module_initialized = true;
 
     return NRF_SUCCESS;
@@ -684,6 +909,22 @@ void gcm_ble_evt_handler(ble_evt_t const * p_ble_evt)
             local_db_apply_in_evt(conn_handle);
             break;
 
+#if PM_GATT_CACHING_ENABLED
+        case BLE_GAP_EVT_CONNECTED:
+        {
+            uint16_t conn_idx = ble_conn_state_conn_idx(p_ble_evt->evt.gap_evt.conn_handle);
+            if (conn_idx < BLE_CONN_STATE_MAX_CONNECTIONS)
+            {
+                m_client_features[conn_idx] = 0;
+            }
+            break;
+        }
+
+        case BLE_GATTS_EVT_RW_AUTHORIZE_REQUEST:
+            gatt_caching_authorize_request_process(&p_ble_evt->evt.gatts_evt);
+            break;
+#endif
+
 #if PM_SERVICE_CHANGED_ENABLED
         case BLE_GATTS_EVT_SC_CONFIRM:
         {
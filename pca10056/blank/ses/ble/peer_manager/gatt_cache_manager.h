@@ -97,7 +97,8 @@ ret_code_t gcm_local_db_cache_update(uint16_t conn_handle);
 /**@brief Function for manually informing that the local database has changed.
  *
  * @details This causes a service changed notification to be sent to all bonded peers that
- *          subscribe to it.
+ *          subscribe to it. If @ref PM_GATT_CACHING_ENABLED is set, the Database Hash is
+ *          recomputed the next time it is read.
  */
 void gcm_local_database_has_changed(void);
 
@@ -49,6 +49,12 @@
 #include "peer_database.h"
 #include "peer_data_storage.h"
 #include "id_manager.h"
+#if PM_GATT_CACHING_ENABLED
+#include "nrf_soc.h"
+#endif
+#if PM_COMPACT_SYS_ATTR_ENABLED
+#include "crc16.h"
+#endif
 
 #define NRF_LOG_MODULE_NAME peer_manager_gscm
 #if PM_LOG_ENABLED
@@ -83,9 +89,150 @@ static pm_evt_handler_internal_t m_evt_handlers[] =
 #define SYS_ATTR_SYS                    (BLE_GATTS_SYS_ATTR_FLAG_SYS_SRVCS)
 #define SYS_ATTR_USR                    (BLE_GATTS_SYS_ATTR_FLAG_USR_SRVCS)
 #define SYS_ATTR_BOTH                   (SYS_ATTR_SYS | SYS_ATTR_USR)
+#define SYS_ATTR_COMPACT                (1UL << 31) /**< Set in the flags of a record stored in the compact format. */
 
 static bool               m_module_initialized;
 static pm_peer_id_t       m_current_sc_store_peer_id;
+#if PM_GATT_CACHING_ENABLED
+static bool               m_db_hash_valid;                  /**< Whether @ref m_db_hash is up to date with the local database. */
+static uint8_t            m_db_hash[GSCM_DB_HASH_LEN];      /**< The Database Hash of the local database, little endian. */
+
+#define DB_HASH_BLOCK_LEN       16      /**< The block size of AES-CMAC. */
+#define DB_HASH_VALUE_MAX_LEN   19      /**< The longest attribute value included in the hash: a characteristic declaration with a 128-bit UUID. */
+
+/**@brief Struct for an AES-CMAC computation over a stream of data, with an all-zero key.
+ */
+typedef struct
+{
+    nrf_ecb_hal_data_t ecb;                     /**< The ECB data. The cleartext is the next block, the ciphertext is the result so far. */
+    uint8_t            k1[DB_HASH_BLOCK_LEN];   /**< Subkey for a complete last block. K2 is derived from K1 when needed. */
+    uint8_t            block[DB_HASH_BLOCK_LEN];/**< Data not yet encrypted. Kept back until more data arrives, since the last block is treated differently. */
+    uint8_t            block_len;               /**< The number of bytes in block. */
+} db_hash_cmac_t;
+#endif
+#if PM_COMPACT_SYS_ATTR_ENABLED
+#define SYS_ATTR_ENTRY_LEN          6   /**< Handle, length and value of one CCCD in the system attribute data. */
+#define SYS_ATTR_CRC_LEN            2   /**< The CRC at the end of the system attribute data. */
+#define SYS_ATTR_COMPACT_HEADER_LEN 4   /**< Table ID and CCCD count at the start of a compact record. */
+#define SYS_ATTR_COMPACT_MAX_LEN    (SYS_ATTR_COMPACT_HEADER_LEN + ((PM_COMPACT_SYS_ATTR_MAX_CCCDS + 3) / 4))
+#define SYS_ATTR_FULL_MAX_LEN       ((PM_COMPACT_SYS_ATTR_MAX_CCCDS * SYS_ATTR_ENTRY_LEN) + SYS_ATTR_CRC_LEN)
+
+static bool               m_cccd_table_valid;                                   /**< Whether @ref m_cccd_handles is up to date with the local database. */
+static bool               m_cccd_table_overflow;                                /**< Whether the local database has more than @ref PM_COMPACT_SYS_ATTR_MAX_CCCDS CCCDs. */
+static uint16_t           m_cccd_count;                                         /**< The number of handles in @ref m_cccd_handles. */
+static uint16_t           m_cccd_table_id;                                      /**< CRC of @ref m_cccd_handles, stored in each compact record. */
+static uint16_t           m_cccd_handles[PM_COMPACT_SYS_ATTR_MAX_CCCDS];        /**< The handles of all CCCDs and SCCDs in the local database, in order. */
+static uint8_t            m_sys_attr_buf[SYS_ATTR_FULL_MAX_LEN];                /**< Full system attribute data rebuilt from a compact record. */
+#endif
+#if PM_SYS_ATTR_CACHE_ENABLED
+/**@brief Struct for the most recent system attributes of a bonded peer, kept in RAM.
+ */
+typedef struct
+{
+    pm_peer_id_t peer_id;                               /**< The peer, or @ref PM_PEER_ID_INVALID if the entry is unused. */
+    uint16_t     len;                                   /**< The length of data. */
+    uint32_t     flags;                                 /**< The flags to give to @ref sd_ble_gatts_sys_attr_set. */
+    uint32_t     last_use;                              /**< The value of @ref m_sys_attr_cache_tick when the entry was last used. */
+    uint8_t      data[PM_SYS_ATTR_CACHE_MAX_LEN];       /**< The full system attributes, as given by @ref sd_ble_gatts_sys_attr_get. */
+} sys_attr_cache_entry_t;
+
+static sys_attr_cache_entry_t m_sys_attr_cache[PM_SYS_ATTR_CACHE_SIZE];
+static uint32_t               m_sys_attr_cache_tick;
+#endif
+
+
+#if PM_SYS_ATTR_CACHE_ENABLED
+/**@brief Function for forgetting the cached system attributes of a peer.
+ *
+ * @param[in] peer_id  The peer, or @ref PM_PEER_ID_INVALID to forget all peers.
+ */
+static void sys_attr_cache_invalidate(pm_peer_id_t peer_id)
+{
+    for (uint32_t i = 0; i < PM_SYS_ATTR_CACHE_SIZE; i++)
+    {
+        if ((peer_id == PM_PEER_ID_INVALID) || (m_sys_attr_cache[i].peer_id == peer_id))
+        {
+            m_sys_attr_cache[i].peer_id = PM_PEER_ID_INVALID;
+        }
+    }
+}
+
+
+/**@brief Function for finding the cached system attributes of a peer.
+ *
+ * @param[in] peer_id  The peer.
+ *
+ * @return  The entry of the peer, or NULL if the peer is not cached.
+ */
+static sys_attr_cache_entry_t * sys_attr_cache_find(pm_peer_id_t peer_id)
+{
+    for (uint32_t i = 0; i < PM_SYS_ATTR_CACHE_SIZE; i++)
+    {
+        if (m_sys_attr_cache[i].peer_id == peer_id)
+        {
+            m_sys_attr_cache[i].last_use = ++m_sys_attr_cache_tick;
+            return &m_sys_attr_cache[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+/**@brief Function for caching the system attributes of a peer.
+ *
+ * @details A peer has at most one entry. Otherwise, an unused entry or the least recently used
+ *          entry is replaced, so the cache holds the peers that connected most recently.
+ *
+ * @param[in] peer_id  The peer.
+ * @param[in] p_data   The full system attributes.
+ * @param[in] len      The length of p_data.
+ * @param[in] flags    The flags the data applies to.
+ */
+static void sys_attr_cache_store(pm_peer_id_t    peer_id,
+                                 uint8_t const * p_data,
+                                 uint16_t        len,
+                                 uint32_t        flags)
+{
+    sys_attr_cache_entry_t * p_entry = sys_attr_cache_find(peer_id);
+
+    if (len > PM_SYS_ATTR_CACHE_MAX_LEN)
+    {
+        // Too big for the cache, so the peer can only be served from flash.
+        sys_attr_cache_invalidate(peer_id);
+        return;
+    }
+
+    for (uint32_t i = 0; (p_entry == NULL) && (i < PM_SYS_ATTR_CACHE_SIZE); i++)
+    {
+        if (m_sys_attr_cache[i].peer_id == PM_PEER_ID_INVALID)
+        {
+            p_entry = &m_sys_attr_cache[i];
+        }
+    }
+
+    if (p_entry == NULL)
+    {
+        p_entry = &m_sys_attr_cache[0];
+        for (uint32_t i = 1; i < PM_SYS_ATTR_CACHE_SIZE; i++)
+        {
+            if (m_sys_attr_cache[i].last_use < p_entry->last_use)
+            {
+                p_entry = &m_sys_attr_cache[i];
+            }
+        }
+    }
+
+    if (len > 0)
+    {
+        memcpy(p_entry->data, p_data, len);
+    }
+    p_entry->peer_id  = peer_id;
+    p_entry->len      = len;
+    p_entry->flags    = flags;
+    p_entry->last_use = ++m_sys_attr_cache_tick;
+}
+#endif // PM_SYS_ATTR_CACHE_ENABLED
 
 
 /**@brief Function for resetting the module variable(s) of the GSCM module.
@@ -94,6 +241,15 @@ static void internal_state_reset()
 {
     m_module_initialized       = false;
     m_current_sc_store_peer_id = PM_PEER_ID_INVALID;
+#if PM_GATT_CACHING_ENABLED
+    m_db_hash_valid            = false;
+#endif
+#if PM_COMPACT_SYS_ATTR_ENABLED
+    m_cccd_table_valid         = false;
+#endif
+#if PM_SYS_ATTR_CACHE_ENABLED
+    sys_attr_cache_invalidate(PM_PEER_ID_INVALID);
+#endif
 
     // If PM_SERVICE_CHANGED_ENABLED is 0, this variable is unused.
     UNUSED_VARIABLE(m_current_sc_store_peer_id);
@@ -170,6 +326,10 @@ static void service_changed_pending_set(void)
 
 
 
+#endif
+
+
+#if !defined(PM_SERVICE_CHANGED_ENABLED) || (PM_SERVICE_CHANGED_ENABLED == 1) || PM_SYS_ATTR_CACHE_ENABLED
 /**@brief Event handler for events from the Peer Database module.
  *        This function is extern in Peer Database.
  *
@@ -177,14 +337,187 @@ static void service_changed_pending_set(void)
  */
 void gscm_pdb_evt_handler(pm_evt_t * p_event)
 {
+#if PM_SYS_ATTR_CACHE_ENABLED
+    switch (p_event->evt_id)
+    {
+        case PM_EVT_PEER_DATA_UPDATE_SUCCEEDED:
+            if (   (p_event->params.peer_data_update_succeeded.data_id == PM_PEER_DATA_ID_GATT_LOCAL)
+                && (p_event->params.peer_data_update_succeeded.action == PM_PEER_DATA_OP_DELETE))
+            {
+                sys_attr_cache_invalidate(p_event->peer_id);
+            }
+            break;
+
+        case PM_EVT_PEER_DELETE_SUCCEEDED:
+            sys_attr_cache_invalidate(p_event->peer_id);
+            break;
+
+        case PM_EVT_PEERS_DELETE_SUCCEEDED:
+            sys_attr_cache_invalidate(PM_PEER_ID_INVALID);
+            break;
+
+        default:
+            break;
+    }
+#endif
+
+#if !defined(PM_SERVICE_CHANGED_ENABLED) || (PM_SERVICE_CHANGED_ENABLED == 1)
     if (m_current_sc_store_peer_id != PM_PEER_ID_INVALID)
     {
         service_changed_pending_set();
     }
+#endif
 }
 #endif
 
 
+#if PM_COMPACT_SYS_ATTR_ENABLED
+/**@brief Function for finding the handles of all CCCDs and SCCDs in the local database.
+ *
+ * @retval true   @ref m_cccd_handles is up to date and can be used.
+ * @retval false  The database has too many CCCDs, or could not be read.
+ */
+static bool cccd_table_get(void)
+{
+    if (m_cccd_table_valid)
+    {
+        return !m_cccd_table_overflow;
+    }
+
+    m_cccd_count          = 0;
+    m_cccd_table_overflow = false;
+
+    for (uint32_t handle = 1; handle <= UINT16_MAX; handle++)
+    {
+        ble_uuid_t uuid;
+        ret_code_t err_code = sd_ble_gatts_attr_get((uint16_t)handle, &uuid, NULL);
+
+        if ((err_code == NRF_ERROR_NOT_FOUND) || (err_code == BLE_ERROR_INVALID_ATTR_HANDLE))
+        {
+            // Past the last attribute.
+            break;
+        }
+        else if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_ERROR("sd_ble_gatts_attr_get() returned %s for handle %d.",
+                          nrf_strerror_get(err_code),
+                          handle);
+            return false;
+        }
+
+        if (    (uuid.type == BLE_UUID_TYPE_BLE)
+            && ((uuid.uuid == BLE_UUID_DESCRIPTOR_CLIENT_CHAR_CONFIG)
+             || (uuid.uuid == BLE_UUID_DESCRIPTOR_SERVER_CHAR_CONFIG)))
+        {
+            if (m_cccd_count == PM_COMPACT_SYS_ATTR_MAX_CCCDS)
+            {
+                NRF_LOG_WARNING("More than PM_COMPACT_SYS_ATTR_MAX_CCCDS CCCDs, storing full system attributes.");
+                m_cccd_table_overflow = true;
+                break;
+            }
+            m_cccd_handles[m_cccd_count++] = (uint16_t)handle;
+        }
+    }
+
+    m_cccd_table_id    = crc16_compute((uint8_t const *)m_cccd_handles,
+                                       m_cccd_count * sizeof(m_cccd_handles[0]),
+                                       NULL);
+    m_cccd_table_valid = true;
+
+    return !m_cccd_table_overflow;
+}
+
+
+/**@brief Function for replacing the system attributes in a local database record by the compact
+ *        format, if it holds nothing but the CCCDs in @ref m_cccd_handles.
+ *
+ * @details The compact format is the table ID and CCCD count, followed by 2 bits per CCCD. It is
+ *          only used if @ref sys_attr_compact_decode gives back the exact same data, otherwise the
+ *          record is left as it is.
+ *
+ * @param[inout] p_local_gatt_db  The record, as filled by @ref sd_ble_gatts_sys_attr_get.
+ */
+static void sys_attr_compact_encode(pm_peer_data_local_gatt_db_t * p_local_gatt_db)
+{
+    uint8_t         compact[SYS_ATTR_COMPACT_MAX_LEN];
+    uint8_t const * p_data = p_local_gatt_db->data;
+    uint16_t        len    = p_local_gatt_db->len;
+
+    if (!cccd_table_get()
+        || (len != ((m_cccd_count * SYS_ATTR_ENTRY_LEN) + SYS_ATTR_CRC_LEN))
+        || (crc16_compute(p_data, len - SYS_ATTR_CRC_LEN, NULL) != uint16_decode(&p_data[len - SYS_ATTR_CRC_LEN])))
+    {
+        NRF_LOG_DEBUG("System attributes don't match the CCCD table, storing them in full.");
+        return;
+    }
+
+    memset(compact, 0, sizeof(compact));
+    (void)uint16_encode(m_cccd_table_id, &compact[0]);
+    (void)uint16_encode(m_cccd_count, &compact[2]);
+
+    for (uint32_t i = 0; i < m_cccd_count; i++)
+    {
+        uint8_t const * p_entry = &p_data[i * SYS_ATTR_ENTRY_LEN];
+
+        if (   (uint16_decode(&p_entry[0]) != m_cccd_handles[i])
+            || (uint16_decode(&p_entry[2]) != sizeof(uint16_t))
+            || (p_entry[4] > 0x03)
+            || (p_entry[5] != 0))
+        {
+            NRF_LOG_DEBUG("System attributes don't match the CCCD table, storing them in full.");
+            return;
+        }
+        compact[SYS_ATTR_COMPACT_HEADER_LEN + (i / 4)] |= (uint8_t)(p_entry[4] << ((i % 4) * 2));
+    }
+
+    p_local_gatt_db->len    = SYS_ATTR_COMPACT_HEADER_LEN + ((m_cccd_count + 3) / 4);
+    p_local_gatt_db->flags |= SYS_ATTR_COMPACT;
+    memcpy(p_local_gatt_db->data, compact, p_local_gatt_db->len);
+}
+
+
+/**@brief Function for rebuilding the full system attributes from a compact record.
+ *
+ * @param[inout] pp_data  In: The compact record. Out: The full system attributes.
+ * @param[inout] p_len    Length of the data pointed to by pp_data.
+ *
+ * @retval true   The system attributes were rebuilt into @ref m_sys_attr_buf.
+ * @retval false  The record was made for a different local database.
+ */
+static bool sys_attr_compact_decode(uint8_t const ** pp_data, uint16_t * p_len)
+{
+    uint8_t const * p_compact = *pp_data;
+
+    if (   !cccd_table_get()
+        || (*p_len < SYS_ATTR_COMPACT_HEADER_LEN)
+        || (uint16_decode(&p_compact[0]) != m_cccd_table_id)
+        || (uint16_decode(&p_compact[2]) != m_cccd_count)
+        || (*p_len != (SYS_ATTR_COMPACT_HEADER_LEN + ((m_cccd_count + 3) / 4))))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < m_cccd_count; i++)
+    {
+        uint8_t * p_entry = &m_sys_attr_buf[i * SYS_ATTR_ENTRY_LEN];
+
+        (void)uint16_encode(m_cccd_handles[i], &p_entry[0]);
+        (void)uint16_encode(sizeof(uint16_t), &p_entry[2]);
+        p_entry[4] = (p_compact[SYS_ATTR_COMPACT_HEADER_LEN + (i / 4)] >> ((i % 4) * 2)) & 0x03;
+        p_entry[5] = 0;
+    }
+
+    uint16_t len = m_cccd_count * SYS_ATTR_ENTRY_LEN;
+    (void)uint16_encode(crc16_compute(m_sys_attr_buf, len, NULL), &m_sys_attr_buf[len]);
+
+    *pp_data = m_sys_attr_buf;
+    *p_len   = len + SYS_ATTR_CRC_LEN;
+
+    return true;
+}
+#endif // PM_COMPACT_SYS_ATTR_ENABLED
+
+
 ret_code_t gscm_init()
 {
     NRF_PM_DEBUG_CHECK(!m_module_initialized);
@@ -228,6 +561,16 @@ ret_code_t gscm_local_db_cache_update(uint16_t conn_handle)
 
                 if (err_code == NRF_SUCCESS)
                 {
+#if PM_SYS_ATTR_CACHE_ENABLED
+                    // The SoftDevice holds the latest values, whether or not they reach flash.
+                    sys_attr_cache_store(peer_id,
+                                         p_local_gatt_db->data,
+                                         p_local_gatt_db->len,
+                                         p_local_gatt_db->flags);
+#endif
+#if PM_COMPACT_SYS_ATTR_ENABLED
+                    sys_attr_compact_encode(p_local_gatt_db);
+#endif
                     pm_peer_data_flash_t curr_peer_data;
 
                     err_code = pdb_peer_data_ptr_get(peer_id,
@@ -243,6 +586,7 @@ ret_code_t gscm_local_db_cache_update(uint16_t conn_handle)
                     }
 
                     if((err_code == NRF_ERROR_NOT_FOUND)
+                        || (p_local_gatt_db->flags != curr_peer_data.p_local_gatt_db->flags)
                         || (p_local_gatt_db->len != curr_peer_data.p_local_gatt_db->len)
                         || (memcmp(p_local_gatt_db->data, curr_peer_data.p_local_gatt_db->data,
                                     p_local_gatt_db->len) != 0))
@@ -315,6 +659,23 @@ ret_code_t gscm_local_db_cache_apply(uint16_t conn_handle)
     uint32_t             sys_attr_flags  = (SYS_ATTR_BOTH);
     bool                 all_attributes_applied = true;
 
+#if PM_SYS_ATTR_CACHE_ENABLED
+    sys_attr_cache_entry_t const * p_cache_entry = NULL;
+
+    if (peer_id != PM_PEER_ID_INVALID)
+    {
+        p_cache_entry = sys_attr_cache_find(peer_id);
+    }
+
+    if (p_cache_entry != NULL)
+    {
+        // Apply the cached copy without searching the flash.
+        p_sys_attr_data = (p_cache_entry->len > 0) ? p_cache_entry->data : NULL;
+        sys_attr_len    = p_cache_entry->len;
+        sys_attr_flags  = p_cache_entry->flags;
+    }
+    else
+#endif
     if (peer_id != PM_PEER_ID_INVALID)
     {
         err_code = pdb_peer_data_ptr_get(peer_id, PM_PEER_DATA_ID_GATT_LOCAL, &peer_data);
@@ -326,7 +687,35 @@ ret_code_t gscm_local_db_cache_apply(uint16_t conn_handle)
             p_sys_attr_data = p_local_gatt_db->data;
             sys_attr_len    = p_local_gatt_db->len;
             sys_attr_flags  = p_local_gatt_db->flags;
+
+            if (sys_attr_flags & SYS_ATTR_COMPACT)
+            {
+                sys_attr_flags &= SYS_ATTR_BOTH;
+#if PM_COMPACT_SYS_ATTR_ENABLED
+                if (!sys_attr_compact_decode(&p_sys_attr_data, &sys_attr_len))
+#endif
+                {
+                    // The record was made for a different local database.
+                    NRF_LOG_DEBUG("Stored CCCD states don't match the local database, not applying them.");
+                    all_attributes_applied = false;
+                    p_sys_attr_data        = NULL;
+                    sys_attr_len           = 0;
+                }
+            }
+#if PM_SYS_ATTR_CACHE_ENABLED
+            if (all_attributes_applied)
+            {
+                sys_attr_cache_store(peer_id, p_sys_attr_data, sys_attr_len, sys_attr_flags);
+            }
+#endif
+        }
+#if PM_SYS_ATTR_CACHE_ENABLED
+        else if (err_code == NRF_ERROR_NOT_FOUND)
+        {
+            // Remember that the peer has no system attributes.
+            sys_attr_cache_store(peer_id, NULL, 0, sys_attr_flags);
         }
+#endif
     }
 
     do
@@ -379,6 +768,15 @@ ret_code_t gscm_local_db_cache_apply(uint16_t conn_handle)
 void gscm_local_database_has_changed(void)
 {
     NRF_PM_DEBUG_CHECK(m_module_initialized);
+#if PM_GATT_CACHING_ENABLED
+    m_db_hash_valid = false;
+#endif
+#if PM_COMPACT_SYS_ATTR_ENABLED
+    m_cccd_table_valid = false;
+#endif
+#if PM_SYS_ATTR_CACHE_ENABLED
+    sys_attr_cache_invalidate(PM_PEER_ID_INVALID);
+#endif
     m_current_sc_store_peer_id = pds_next_peer_id_get(PM_PEER_ID_INVALID);
     service_changed_pending_set();
 }
@@ -454,4 +852,222 @@ void gscm_db_change_notification_done(pm_peer_id_t peer_id)
     //lint -restore
 }
 #endif
+
+
+#if PM_GATT_CACHING_ENABLED
+/**@brief Function for doubling a value in GF(2^128), as used for the AES-CMAC subkeys.
+ *
+ * @param[in]  p_in   The value, most significant byte first.
+ * @param[out] p_out  The doubled value. Can be the same as p_in.
+ */
+static void cmac_subkey_double(uint8_t const * p_in, uint8_t * p_out)
+{
+    bool msb = (p_in[0] & 0x80) != 0;
+
+    for (uint32_t i = 0; i < DB_HASH_BLOCK_LEN - 1; i++)
+    {
+        p_out[i] = (uint8_t)((p_in[i] << 1) | (p_in[i + 1] >> 7));
+    }
+    p_out[DB_HASH_BLOCK_LEN - 1] = (uint8_t)(p_in[DB_HASH_BLOCK_LEN - 1] << 1);
+
+    if (msb)
+    {
+        p_out[DB_HASH_BLOCK_LEN - 1] ^= 0x87;
+    }
+}
+
+
+/**@brief Function for encrypting the next block of an AES-CMAC computation.
+ *
+ * @param[inout] p_cmac   The computation. The block is XORed into the result so far.
+ * @param[in]    p_block  The block.
+ */
+static void cmac_block_encrypt(db_hash_cmac_t * p_cmac, uint8_t const * p_block)
+{
+    for (uint32_t i = 0; i < DB_HASH_BLOCK_LEN; i++)
+    {
+        p_cmac->ecb.cleartext[i] = p_cmac->ecb.ciphertext[i] ^ p_block[i];
+    }
+
+    (void) sd_ecb_block_encrypt(&p_cmac->ecb);
+}
+
+
+static void cmac_init(db_hash_cmac_t * p_cmac)
+{
+    memset(p_cmac, 0, sizeof(db_hash_cmac_t));
+
+    // L = AES(0), K1 = L * 2. The ciphertext is then reset to be the all-zero initial value.
+    (void) sd_ecb_block_encrypt(&p_cmac->ecb);
+    cmac_subkey_double(p_cmac->ecb.ciphertext, p_cmac->k1);
+    memset(p_cmac->ecb.ciphertext, 0, DB_HASH_BLOCK_LEN);
+}
+
+
+static void cmac_update(db_hash_cmac_t * p_cmac, uint8_t const * p_data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++)
+    {
+        if (p_cmac->block_len == DB_HASH_BLOCK_LEN)
+        {
+            cmac_block_encrypt(p_cmac, p_cmac->block);
+            p_cmac->block_len = 0;
+        }
+        p_cmac->block[p_cmac->block_len++] = p_data[i];
+    }
+}
+
+
+static void cmac_final(db_hash_cmac_t * p_cmac, uint8_t * p_mac)
+{
+    uint8_t subkey[DB_HASH_BLOCK_LEN];
+
+    memcpy(subkey, p_cmac->k1, DB_HASH_BLOCK_LEN);
+
+    if (p_cmac->block_len < DB_HASH_BLOCK_LEN)
+    {
+        // Incomplete last block (or no data). Pad it, and use K2 = K1 * 2.
+        p_cmac->block[p_cmac->block_len] = 0x80;
+        memset(&p_cmac->block[p_cmac->block_len + 1], 0, DB_HASH_BLOCK_LEN - p_cmac->block_len - 1);
+        cmac_subkey_double(subkey, subkey);
+    }
+
+    for (uint32_t i = 0; i < DB_HASH_BLOCK_LEN; i++)
+    {
+        p_cmac->block[i] ^= subkey[i];
+    }
+
+    cmac_block_encrypt(p_cmac, p_cmac->block);
+    memcpy(p_mac, p_cmac->ecb.ciphertext, DB_HASH_BLOCK_LEN);
+}
+
+
+/**@brief Function for checking whether an attribute is included in the Database Hash.
+ *
+ * @param[in]  p_uuid        The type of the attribute.
+ * @param[out] p_with_value  Whether the value of the attribute is included as well.
+ *
+ * @return  Whether the attribute is included.
+ */
+static bool db_hash_attr_included(ble_uuid_t const * p_uuid, bool * p_with_value)
+{
+    if (p_uuid->type != BLE_UUID_TYPE_BLE)
+    {
+        return false;
+    }
+
+    switch (p_uuid->uuid)
+    {
+        case BLE_UUID_SERVICE_PRIMARY:
+        case BLE_UUID_SERVICE_SECONDARY:
+        case BLE_UUID_SERVICE_INCLUDE:
+        case BLE_UUID_CHARACTERISTIC:
+        case BLE_UUID_DESCRIPTOR_CHAR_EXT_PROP:
+            *p_with_value = true;
+            return true;
+
+        case BLE_UUID_DESCRIPTOR_CHAR_USER_DESC:
+        case BLE_UUID_DESCRIPTOR_CLIENT_CHAR_CONFIG:
+        case BLE_UUID_DESCRIPTOR_SERVER_CHAR_CONFIG:
+        case BLE_UUID_DESCRIPTOR_CHAR_PRESENTATION_FORMAT:
+        case BLE_UUID_DESCRIPTOR_CHAR_AGGREGATE_FORMAT:
+            *p_with_value = false;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+
+/**@brief Function for computing the Database Hash of the local database.
+ *
+ * @details See the Bluetooth Core Specification 5.1, Vol 3, Part G, Section 7.3. The handle, type
+ *          and (for declarations) value of each included attribute are fed to AES-CMAC in
+ *          little-endian order, the same way they are sent over the air.
+ *
+ * @param[out] p_hash  The hash, little endian.
+ *
+ * @retval NRF_SUCCESS  The hash was computed.
+ * @retval Other        Error from @ref sd_ble_gatts_attr_get or @ref sd_ble_gatts_value_get.
+ */
+static ret_code_t db_hash_compute(uint8_t * p_hash)
+{
+    ret_code_t     err_code;
+    db_hash_cmac_t cmac;
+    uint8_t        mac[DB_HASH_BLOCK_LEN];
+
+    cmac_init(&cmac);
+
+    for (uint32_t handle = 1; handle <= UINT16_MAX; handle++)
+    {
+        ble_uuid_t uuid;
+        bool       with_value;
+
+        err_code = sd_ble_gatts_attr_get((uint16_t)handle, &uuid, NULL);
+        if ((err_code == NRF_ERROR_NOT_FOUND) || (err_code == BLE_ERROR_INVALID_ATTR_HANDLE))
+        {
+            // Past the last attribute.
+            break;
+        }
+        else if (err_code != NRF_SUCCESS)
+        {
+            return err_code;
+        }
+
+        if (!db_hash_attr_included(&uuid, &with_value))
+        {
+            continue;
+        }
+
+        uint8_t header[4] = {LSB_16(handle), MSB_16(handle), LSB_16(uuid.uuid), MSB_16(uuid.uuid)};
+        cmac_update(&cmac, header, sizeof(header));
+
+        if (with_value)
+        {
+            uint8_t           value[DB_HASH_VALUE_MAX_LEN];
+            ble_gatts_value_t gatts_value = {.len = sizeof(value), .offset = 0, .p_value = value};
+
+            err_code = sd_ble_gatts_value_get(BLE_CONN_HANDLE_INVALID, (uint16_t)handle, &gatts_value);
+            if (err_code != NRF_SUCCESS)
+            {
+                return err_code;
+            }
+            cmac_update(&cmac, value, MIN(gatts_value.len, sizeof(value)));
+        }
+    }
+
+    cmac_final(&cmac, mac);
+
+    // The characteristic value is little endian, while AES works most significant byte first.
+    for (uint32_t i = 0; i < GSCM_DB_HASH_LEN; i++)
+    {
+        p_hash[i] = mac[GSCM_DB_HASH_LEN - 1 - i];
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t gscm_db_hash_get(uint8_t * p_hash)
+{
+    NRF_PM_DEBUG_CHECK(m_module_initialized);
+    NRF_PM_DEBUG_CHECK(p_hash != NULL);
+
+    if (!m_db_hash_valid)
+    {
+        ret_code_t err_code = db_hash_compute(m_db_hash);
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_ERROR("Could not compute the Database Hash. Error: %s.", nrf_strerror_get(err_code));
+            return NRF_ERROR_INTERNAL;
+        }
+        m_db_hash_valid = true;
+    }
+
+    memcpy(p_hash, m_db_hash, GSCM_DB_HASH_LEN);
+
+    return NRF_SUCCESS;
+}
+#endif // PM_GATT_CACHING_ENABLED
 #endif // NRF_MODULE_ENABLED(PEER_MANAGER)
@@ -153,6 +153,23 @@ ret_code_t gscm_service_changed_ind_send(uint16_t conn_handle);
  */
 void gscm_db_change_notification_done(pm_peer_id_t peer_id);
 
+
+#if PM_GATT_CACHING_ENABLED
+#define GSCM_DB_HASH_LEN    16  //!< The length of the Database Hash.
+
+/**@brief Function for getting the Database Hash of the local database.
+ *
+ * @details The hash is computed the first time it is needed, and again after each call to
+ *          @ref gscm_local_database_has_changed.
+ *
+ * @param[out] p_hash  Buffer of @ref GSCM_DB_HASH_LEN bytes to receive the hash, little endian.
+ *
+ * @retval NRF_SUCCESS         The hash was copied.
+ * @retval NRF_ERROR_INTERNAL  The hash could not be computed.
+ */
+ret_code_t gscm_db_hash_get(uint8_t * p_hash);
+#endif
+
 /** @}
  * @endcond
 */
@@ -94,6 +94,83 @@ static im_connection_t m_connections[IM_MAX_CONN_HANDLES];
 static uint8_t         m_wlisted_peer_cnt;
 static pm_peer_id_t    m_wlisted_peers[BLE_GAP_WHITELIST_ADDR_MAX_COUNT];
 
+#if PM_RPA_CACHE_ENABLED
+#define IM_ECB_BATCH_SIZE               (8)     //!< The number of IRKs encrypted in one call to sd_ecb_blocks_encrypt().
+
+/**@brief An IRK of a bonded peer, kept in RAM for address resolution.
+ */
+typedef struct
+{
+    pm_peer_id_t  peer_id;  /**< The peer the IRK belongs to. */
+    soc_ecb_key_t key;      /**< The IRK, in the byte order expected by the ECB. */
+} im_irk_entry_t;
+
+/**@brief A resolvable private address, and the peer it was resolved to.
+ */
+typedef struct
+{
+    uint8_t      addr[BLE_GAP_ADDR_LEN];    /**< The address. */
+    pm_peer_id_t peer_id;                   /**< The peer the address resolved to, or @ref PM_PEER_ID_INVALID if it belongs to no bonded peer. */
+    uint32_t     last_use;                  /**< The value of @ref m_rpa_cache_tick when the entry was last used. */
+    bool         valid;                     /**< Whether the entry is in use. */
+} im_rpa_cache_entry_t;
+
+static im_irk_entry_t       m_irk_table[PM_RPA_CACHE_IRK_COUNT];
+static uint32_t             m_irk_cnt;
+static bool                 m_irk_table_valid;      /**< Whether @ref m_irk_table reflects the bonding data in flash. */
+static bool                 m_irk_table_complete;   /**< Whether @ref m_irk_table holds the IRKs of all bonded peers. */
+static im_rpa_cache_entry_t m_rpa_cache[PM_RPA_CACHE_SIZE];
+static uint32_t             m_rpa_cache_tick;
+#endif // PM_RPA_CACHE_ENABLED
+
+#if PM_ID_INDEX_ENABLED
+#define IM_INDEX_SLOT_EMPTY             (PM_PEER_ID_INVALID)        //!< Peer ID of a slot that has not been used since the index was built.
+#define IM_INDEX_SLOT_DELETED           (PM_PEER_ID_INVALID - 1)    //!< Peer ID of a slot whose entry has been removed.
+#define IM_INDEX_MASK                   (PM_ID_INDEX_SIZE - 1)
+
+STATIC_ASSERT((PM_ID_INDEX_SIZE & IM_INDEX_MASK) == 0, "PM_ID_INDEX_SIZE must be a power of 2.");
+
+/**@brief The kinds of keys in the identity index.
+ */
+typedef enum
+{
+    IM_INDEX_KEY_MASTER_ID, /**< The master ID of an LTK. */
+    IM_INDEX_KEY_ADDR,      /**< An identity address. */
+    IM_INDEX_KEY_IRK,       /**< An IRK. */
+} im_index_key_t;
+
+/**@brief A slot in the identity index.
+ */
+typedef struct
+{
+    uint32_t     hash;      /**< The hash of the key. The key itself is checked against the bonding data in flash. */
+    pm_peer_id_t peer_id;   /**< The peer the key belongs to, or @ref IM_INDEX_SLOT_EMPTY or @ref IM_INDEX_SLOT_DELETED. */
+} im_index_slot_t;
+
+static im_index_slot_t m_index[PM_ID_INDEX_SIZE];   /**< Hash table with linear probing. */
+static uint32_t        m_index_deleted;             /**< The number of slots marked @ref IM_INDEX_SLOT_DELETED. */
+static bool            m_index_valid;               /**< Whether @ref m_index reflects the bonding data in flash. */
+static bool            m_index_complete;            /**< Whether all keys fit in @ref m_index. If not, lookups that miss search the flash. */
+#endif // PM_ID_INDEX_ENABLED
+
+#if PM_ID_KEY_CACHE_ENABLED
+/**@brief The identity address and IRK of a bonded peer, kept in RAM for the whitelist and the
+ *        device identities list.
+ */
+typedef struct
+{
+    pm_peer_id_t     peer_id;   /**< The peer the keys belong to. */
+    ble_gap_id_key_t id_key;    /**< The identity address and IRK of the peer. */
+} im_id_key_entry_t;
+
+static im_id_key_entry_t m_id_keys[PM_ID_KEY_CACHE_SIZE];
+static uint32_t          m_id_key_cnt;
+static bool              m_id_keys_valid;           /**< Whether @ref m_id_keys reflects the bonding data in flash. */
+static bool              m_id_keys_complete;        /**< Whether @ref m_id_keys holds the keys of all bonded peers. If not, peers that miss are read from flash. */
+static bool              m_wlist_all_bonded;        /**< Whether the whitelist and device identities list follow the bonded peers. */
+static bool              m_wlist_all_bonded_pending;/**< Whether the lists changed but could not be given to the SoftDevice yet. */
+#endif // PM_ID_KEY_CACHE_ENABLED
+
 
 /**@brief Function for sending an event to all registered event handlers.
  *
@@ -161,71 +238,741 @@ bool addr_compare(ble_gap_addr_t const * p_addr1, ble_gap_addr_t const * p_addr2
 }
 
 
-void im_ble_evt_handler(ble_evt_t const * ble_evt)
+#if PM_ID_INDEX_ENABLED || PM_ID_KEY_CACHE_ENABLED
+/**@brief Function for checking whether an address is an identity address that can be whitelisted.
+ */
+static bool addr_is_identity(ble_gap_addr_t const * p_addr)
 {
-    ble_gap_evt_t gap_evt;
-    pm_peer_id_t  bonded_matching_peer_id;
+    return (   (p_addr->addr_type == BLE_GAP_ADDR_TYPE_PUBLIC)
+            || (p_addr->addr_type == BLE_GAP_ADDR_TYPE_RANDOM_STATIC));
+}
+#endif
 
-    if (ble_evt->header.evt_id != BLE_GAP_EVT_CONNECTED)
+
+#if PM_ID_INDEX_ENABLED
+/**@brief Function for calculating the hash of a key in the identity index (32-bit FNV-1a).
+ *
+ * @param[in] key_type  The kind of key.
+ * @param[in] p_key     The key.
+ * @param[in] len       The length of the key.
+ *
+ * @return  The hash.
+ */
+static uint32_t index_hash(im_index_key_t key_type, uint8_t const * p_key, uint32_t len)
+{
+    uint32_t hash = 2166136261UL;
+
+    hash = (hash ^ key_type) * 16777619UL;
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        hash = (hash ^ p_key[i]) * 16777619UL;
+    }
+
+    return hash;
+}
+
+
+static uint32_t master_id_hash(ble_gap_master_id_t const * p_master_id)
+{
+    uint8_t key[sizeof(uint16_t) + BLE_GAP_SEC_RAND_LEN];
+
+    key[0] = (uint8_t)(p_master_id->ediv);
+    key[1] = (uint8_t)(p_master_id->ediv >> 8);
+    memcpy(&key[2], p_master_id->rand, BLE_GAP_SEC_RAND_LEN);
+
+    return index_hash(IM_INDEX_KEY_MASTER_ID, key, sizeof(key));
+}
+
+
+static uint32_t addr_hash(ble_gap_addr_t const * p_addr)
+{
+    uint8_t key[1 + BLE_GAP_ADDR_LEN];
+
+    key[0] = p_addr->addr_type;
+    memcpy(&key[1], p_addr->addr, BLE_GAP_ADDR_LEN);
+
+    return index_hash(IM_INDEX_KEY_ADDR, key, sizeof(key));
+}
+
+
+static uint32_t irk_hash(ble_gap_irk_t const * p_irk)
+{
+    return index_hash(IM_INDEX_KEY_IRK, p_irk->irk, BLE_GAP_SEC_KEY_LEN);
+}
+
+
+/**@brief Function for adding a key to the identity index.
+ *
+ * @param[in] hash     The hash of the key.
+ * @param[in] peer_id  The peer the key belongs to.
+ */
+static void index_insert(uint32_t hash, pm_peer_id_t peer_id)
+{
+    for (uint32_t i = 0; i < PM_ID_INDEX_SIZE; i++)
+    {
+        im_index_slot_t * p_slot = &m_index[(hash + i) & IM_INDEX_MASK];
+
+        if ((p_slot->peer_id == IM_INDEX_SLOT_EMPTY) || (p_slot->peer_id == IM_INDEX_SLOT_DELETED))
+        {
+            if (p_slot->peer_id == IM_INDEX_SLOT_DELETED)
+            {
+                m_index_deleted--;
+            }
+            p_slot->hash    = hash;
+            p_slot->peer_id = peer_id;
+            return;
+        }
+    }
+
+    NRF_LOG_DEBUG("Identity index is full.");
+    m_index_complete = false;
+}
+
+
+/**@brief Function for adding the keys in a peer's bonding data to the identity index.
+ *
+ * @param[in] peer_id         The peer.
+ * @param[in] p_bonding_data  The bonding data of the peer.
+ */
+static void index_peer_add(pm_peer_id_t peer_id, pm_peer_data_bonding_t const * p_bonding_data)
+{
+    if (im_master_id_is_valid(&p_bonding_data->own_ltk.master_id))
+    {
+        index_insert(master_id_hash(&p_bonding_data->own_ltk.master_id), peer_id);
+    }
+
+    if (im_master_id_is_valid(&p_bonding_data->peer_ltk.master_id))
+    {
+        index_insert(master_id_hash(&p_bonding_data->peer_ltk.master_id), peer_id);
+    }
+
+    if (addr_is_identity(&p_bonding_data->peer_ble_id.id_addr_info))
+    {
+        index_insert(addr_hash(&p_bonding_data->peer_ble_id.id_addr_info), peer_id);
+    }
+
+    if (is_valid_irk(&p_bonding_data->peer_ble_id.id_info))
+    {
+        index_insert(irk_hash(&p_bonding_data->peer_ble_id.id_info), peer_id);
+    }
+}
+
+
+/**@brief Function for removing all keys of a peer from the identity index.
+ *
+ * @param[in] peer_id  The peer.
+ */
+static void index_peer_remove(pm_peer_id_t peer_id)
+{
+    for (uint32_t i = 0; i < PM_ID_INDEX_SIZE; i++)
+    {
+        if (m_index[i].peer_id == peer_id)
+        {
+            m_index[i].peer_id = IM_INDEX_SLOT_DELETED;
+            m_index_deleted++;
+        }
+    }
+}
+
+
+/**@brief Function for making sure the identity index is usable, by building it from the bonding
+ *        data in flash if needed.
+ *
+ * @details The index is also rebuilt when many entries have been removed, to keep lookups that
+ *          miss short.
+ */
+static void index_ensure(void)
+{
+    pm_peer_id_t         peer_id;
+    pm_peer_data_flash_t peer_data;
+
+    if (m_index_valid && (m_index_deleted <= (PM_ID_INDEX_SIZE / 4)))
     {
-        // Nothing to do.
         return;
     }
 
-    gap_evt                 = ble_evt->evt.gap_evt;
-    bonded_matching_peer_id = PM_PEER_ID_INVALID;
+    for (uint32_t i = 0; i < PM_ID_INDEX_SIZE; i++)
+    {
+        m_index[i].peer_id = IM_INDEX_SLOT_EMPTY;
+    }
+    m_index_deleted  = 0;
+    m_index_complete = true;
+
+    pds_peer_data_iterate_prepare();
+
+    while (pds_peer_data_iterate(PM_PEER_DATA_ID_BONDING, &peer_id, &peer_data))
+    {
+        index_peer_add(peer_id, peer_data.p_bonding_data);
+    }
+
+    m_index_valid = true;
+}
+
+
+/**@brief Function for finding the next peer in the identity index with a key that has a given hash.
+ *
+ * @param[in]    hash     The hash of the key.
+ * @param[inout] p_probe  In: The number of slots already searched, 0 for the first call.
+ *                        Out: The number of slots searched.
+ * @param[out]   p_data   The bonding data of the peer that was found.
+ *
+ * @return  The peer, or @ref PM_PEER_ID_INVALID if there are no more peers with the hash.
+ */
+static pm_peer_id_t index_find_next(uint32_t hash, uint32_t * p_probe, pm_peer_data_flash_t * p_data)
+{
+    while (*p_probe < PM_ID_INDEX_SIZE)
+    {
+        im_index_slot_t const * p_slot = &m_index[(hash + *p_probe) & IM_INDEX_MASK];
+
+        (*p_probe)++;
+
+        if (p_slot->peer_id == IM_INDEX_SLOT_EMPTY)
+        {
+            break;
+        }
+
+        if (   (p_slot->peer_id != IM_INDEX_SLOT_DELETED)
+            && (p_slot->hash == hash)
+            && (pdb_peer_data_ptr_get(p_slot->peer_id, PM_PEER_DATA_ID_BONDING, p_data) == NRF_SUCCESS))
+        {
+            return p_slot->peer_id;
+        }
+    }
+
+    *p_probe = PM_ID_INDEX_SIZE;
+    return PM_PEER_ID_INVALID;
+}
+#endif // PM_ID_INDEX_ENABLED
+
+
+/**@brief Function for finding a bonded peer whose IRK resolves an address, by searching all
+ *        bonding data in flash.
+ *
+ * @param[in] p_addr  The resolvable address.
+ *
+ * @return  The matching peer, or @ref PM_PEER_ID_INVALID if none was found.
+ */
+static pm_peer_id_t irk_flash_resolve(ble_gap_addr_t const * p_addr)
+{
+    pm_peer_id_t         peer_id;
+    pm_peer_data_flash_t peer_data;
+
+    pds_peer_data_iterate_prepare();
+
+    while (pds_peer_data_iterate(PM_PEER_DATA_ID_BONDING, &peer_id, &peer_data))
+    {
+        if (im_address_resolve(p_addr, &peer_data.p_bonding_data->peer_ble_id.id_info))
+        {
+            return peer_id;
+        }
+    }
+    return PM_PEER_ID_INVALID;
+}
+
+
+#if PM_RPA_CACHE_ENABLED
+/**@brief Function for forgetting all IRKs and resolved addresses. They are reloaded on the next
+ *        lookup.
+ */
+static void rpa_cache_reset(void)
+{
+    m_irk_table_valid = false;
+    memset(m_rpa_cache, 0, sizeof(m_rpa_cache));
+}
+
+
+/**@brief Function for loading the IRKs of all bonded peers into @ref m_irk_table.
+ */
+static void irk_table_build(void)
+{
+    pm_peer_id_t         peer_id;
+    pm_peer_data_flash_t peer_data;
+
+    m_irk_cnt            = 0;
+    m_irk_table_complete = true;
+
+    pds_peer_data_iterate_prepare();
 
-    if (   gap_evt.params.connected.peer_addr.addr_type
-        != BLE_GAP_ADDR_TYPE_RANDOM_PRIVATE_NON_RESOLVABLE)
+    while (pds_peer_data_iterate(PM_PEER_DATA_ID_BONDING, &peer_id, &peer_data))
     {
-        /* Search the database for bonding data matching the one that triggered the event.
-         * Public and static addresses can be matched on address alone, while resolvable
-         * random addresses can be resolved agains known IRKs. Non-resolvable random addresses
-         * are never matching because they are not longterm form of identification.
-         */
+        ble_gap_irk_t const * p_irk = &peer_data.p_bonding_data->peer_ble_id.id_info;
+
+        if (!is_valid_irk(p_irk))
+        {
+            continue;
+        }
+
+        if (m_irk_cnt == PM_RPA_CACHE_IRK_COUNT)
+        {
+            m_irk_table_complete = false;
+            break;
+        }
+
+        m_irk_table[m_irk_cnt].peer_id = peer_id;
+        for (uint32_t i = 0; i < SOC_ECB_KEY_LENGTH; i++)
+        {
+            m_irk_table[m_irk_cnt].key[i] = p_irk->irk[SOC_ECB_KEY_LENGTH - 1 - i];
+        }
+        m_irk_cnt++;
+    }
+
+    m_irk_table_valid = true;
+}
+
+
+/**@brief Function for finding a bonded peer whose IRK resolves an address, among the IRKs in
+ *        @ref m_irk_table.
+ *
+ * @details The hash is calculated for several IRKs in each call to the SoftDevice.
+ *
+ * @param[in] p_addr  The resolvable address.
+ *
+ * @return  The matching peer, or @ref PM_PEER_ID_INVALID if none was found.
+ */
+static pm_peer_id_t irk_table_resolve(ble_gap_addr_t const * p_addr)
+{
+    soc_ecb_cleartext_t      cleartext;
+    soc_ecb_ciphertext_t     ciphertext[IM_ECB_BATCH_SIZE];
+    nrf_ecb_hal_data_block_t blocks[IM_ECB_BATCH_SIZE];
 
-        pm_peer_id_t         peer_id;
-        pm_peer_data_flash_t peer_data;
+    // See ah() for the layout.
+    memset(cleartext, 0, SOC_ECB_KEY_LENGTH - IM_ADDR_CLEARTEXT_LENGTH);
+    for (uint32_t i = 0; i < IM_ADDR_CLEARTEXT_LENGTH; i++)
+    {
+        cleartext[SOC_ECB_KEY_LENGTH - 1 - i] = p_addr->addr[IM_ADDR_CIPHERTEXT_LENGTH + i];
+    }
 
-        pds_peer_data_iterate_prepare();
+    for (uint32_t first = 0; first < m_irk_cnt; first += IM_ECB_BATCH_SIZE)
+    {
+        uint32_t const n_blocks = MIN(m_irk_cnt - first, IM_ECB_BATCH_SIZE);
 
-        switch (gap_evt.params.connected.peer_addr.addr_type)
+        for (uint32_t i = 0; i < n_blocks; i++)
         {
-            case BLE_GAP_ADDR_TYPE_PUBLIC:
-            case BLE_GAP_ADDR_TYPE_RANDOM_STATIC:
+            blocks[i].p_key        = &m_irk_table[first + i].key;
+            blocks[i].p_cleartext  = &cleartext;
+            blocks[i].p_ciphertext = &ciphertext[i];
+        }
+
+        // Can only return NRF_SUCCESS.
+        (void) sd_ecb_blocks_encrypt(n_blocks, blocks);
+
+        for (uint32_t i = 0; i < n_blocks; i++)
+        {
+            uint32_t j = 0;
+
+            while (   (j < IM_ADDR_CIPHERTEXT_LENGTH)
+                   && (ciphertext[i][SOC_ECB_KEY_LENGTH - 1 - j] == p_addr->addr[j]))
+            {
+                j++;
+            }
+
+            if (j == IM_ADDR_CIPHERTEXT_LENGTH)
             {
-                while (pds_peer_data_iterate(PM_PEER_DATA_ID_BONDING, &peer_id, &peer_data))
+                return m_irk_table[first + i].peer_id;
+            }
+        }
+    }
+
+    return PM_PEER_ID_INVALID;
+}
+
+
+/**@brief Function for remembering which peer a resolvable address belongs to.
+ *
+ * @details A peer has at most one entry, so the entry for its previous address is replaced when
+ *          it starts using a new one. Otherwise, the least recently used entry is replaced.
+ *
+ * @param[in] p_addr   The resolvable address.
+ * @param[in] peer_id  The peer the address resolved to, or @ref PM_PEER_ID_INVALID.
+ */
+static void rpa_cache_store(ble_gap_addr_t const * p_addr, pm_peer_id_t peer_id)
+{
+    im_rpa_cache_entry_t * p_entry = &m_rpa_cache[0];
+
+    for (uint32_t i = 0; i < PM_RPA_CACHE_SIZE; i++)
+    {
+        if (!m_rpa_cache[i].valid)
+        {
+            p_entry = &m_rpa_cache[i];
+            break;
+        }
+        if ((peer_id != PM_PEER_ID_INVALID) && (m_rpa_cache[i].peer_id == peer_id))
+        {
+            p_entry = &m_rpa_cache[i];
+            break;
+        }
+        if (m_rpa_cache[i].last_use < p_entry->last_use)
+        {
+            p_entry = &m_rpa_cache[i];
+        }
+    }
+
+    memcpy(p_entry->addr, p_addr->addr, BLE_GAP_ADDR_LEN);
+    p_entry->peer_id  = peer_id;
+    p_entry->last_use = ++m_rpa_cache_tick;
+    p_entry->valid    = true;
+}
+
+
+/**@brief Function for finding the bonded peer a resolvable address belongs to, using the cache.
+ *
+ * @param[in] p_addr  The resolvable address.
+ *
+ * @return  The matching peer, or @ref PM_PEER_ID_INVALID if none was found.
+ */
+static pm_peer_id_t rpa_cache_resolve(ble_gap_addr_t const * p_addr)
+{
+    pm_peer_id_t peer_id;
+
+    for (uint32_t i = 0; i < PM_RPA_CACHE_SIZE; i++)
+    {
+        if (   m_rpa_cache[i].valid
+            && (memcmp(m_rpa_cache[i].addr, p_addr->addr, BLE_GAP_ADDR_LEN) == 0))
+        {
+            m_rpa_cache[i].last_use = ++m_rpa_cache_tick;
+            return m_rpa_cache[i].peer_id;
+        }
+    }
+
+    if (!m_irk_table_valid)
+    {
+        irk_table_build();
+    }
+
+    peer_id = irk_table_resolve(p_addr);
+
+    if ((peer_id == PM_PEER_ID_INVALID) && !m_irk_table_complete)
+    {
+        peer_id = irk_flash_resolve(p_addr);
+    }
+
+    rpa_cache_store(p_addr, peer_id);
+
+    return peer_id;
+}
+#endif // PM_RPA_CACHE_ENABLED
+
+
+pm_peer_id_t im_peer_id_get_by_addr(ble_gap_addr_t const * p_addr)
+{
+    pm_peer_id_t         peer_id;
+    pm_peer_data_flash_t peer_data;
+
+    NRF_PM_DEBUG_CHECK(p_addr != NULL);
+
+    /* Public and static addresses can be matched on address alone, while resolvable
+     * random addresses can be resolved agains known IRKs. Non-resolvable random addresses
+     * are never matching because they are not longterm form of identification.
+     */
+    switch (p_addr->addr_type)
+    {
+        case BLE_GAP_ADDR_TYPE_PUBLIC:
+        case BLE_GAP_ADDR_TYPE_RANDOM_STATIC:
+#if PM_ID_INDEX_ENABLED
+        {
+            uint32_t const hash  = addr_hash(p_addr);
+            uint32_t       probe = 0;
+
+            index_ensure();
+
+            while ((peer_id = index_find_next(hash, &probe, &peer_data)) != PM_PEER_ID_INVALID)
+            {
+                if (addr_compare(p_addr, &peer_data.p_bonding_data->peer_ble_id.id_addr_info))
                 {
-                    if (addr_compare(&gap_evt.params.connected.peer_addr,
-                                     &peer_data.p_bonding_data->peer_ble_id.id_addr_info))
-                    {
-                        bonded_matching_peer_id = peer_id;
-                        break;
-                    }
+                    return peer_id;
                 }
             }
-            break;
 
-            case BLE_GAP_ADDR_TYPE_RANDOM_PRIVATE_RESOLVABLE:
+            if (m_index_complete)
+            {
+                break;
+            }
+        }
+#endif
+            pds_peer_data_iterate_prepare();
+
+            while (pds_peer_data_iterate(PM_PEER_DATA_ID_BONDING, &peer_id, &peer_data))
             {
-                while (pds_peer_data_iterate(PM_PEER_DATA_ID_BONDING, &peer_id, &peer_data))
+                if (addr_compare(p_addr, &peer_data.p_bonding_data->peer_ble_id.id_addr_info))
                 {
-                    if (im_address_resolve(&gap_evt.params.connected.peer_addr,
-                                           &peer_data.p_bonding_data->peer_ble_id.id_info))
-                    {
-                        bonded_matching_peer_id = peer_id;
-                        break;
-                    }
+                    return peer_id;
                 }
             }
             break;
 
-            default:
-                NRF_PM_DEBUG_CHECK(false);
-                break;
+        case BLE_GAP_ADDR_TYPE_RANDOM_PRIVATE_RESOLVABLE:
+#if PM_RPA_CACHE_ENABLED
+            return rpa_cache_resolve(p_addr);
+#else
+            return irk_flash_resolve(p_addr);
+#endif
+
+        default:
+            break;
+    }
+
+    return PM_PEER_ID_INVALID;
+}
+
+
+#if PM_ID_INDEX_ENABLED
+/**@brief Function for updating the identity index after the bonding data of a peer has changed.
+ *
+ * @param[in] peer_id  The peer whose bonding data was written or deleted.
+ */
+static void index_peer_update(pm_peer_id_t peer_id)
+{
+    pm_peer_data_flash_t peer_data;
+
+    if (!m_index_valid)
+    {
+        // Will be built on the next lookup.
+        return;
+    }
+
+    index_peer_remove(peer_id);
+
+    if (pdb_peer_data_ptr_get(peer_id, PM_PEER_DATA_ID_BONDING, &peer_data) == NRF_SUCCESS)
+    {
+        index_peer_add(peer_id, peer_data.p_bonding_data);
+    }
+}
+#endif // PM_ID_INDEX_ENABLED
+
+
+#if PM_ID_KEY_CACHE_ENABLED
+/**@brief Function for loading the identity keys of all bonded peers into @ref m_id_keys.
+ */
+static void id_keys_build(void)
+{
+    pm_peer_id_t         peer_id;
+    pm_peer_data_flash_t peer_data;
+
+    m_id_key_cnt       = 0;
+    m_id_keys_complete = true;
+
+    pds_peer_data_iterate_prepare();
+
+    while (pds_peer_data_iterate(PM_PEER_DATA_ID_BONDING, &peer_id, &peer_data))
+    {
+        if (m_id_key_cnt == PM_ID_KEY_CACHE_SIZE)
+        {
+            m_id_keys_complete = false;
+            break;
+        }
+
+        m_id_keys[m_id_key_cnt].peer_id = peer_id;
+        m_id_keys[m_id_key_cnt].id_key  = peer_data.p_bonding_data->peer_ble_id;
+        m_id_key_cnt++;
+    }
+
+    m_id_keys_valid = true;
+}
+
+
+/**@brief Function for finding the identity keys of a peer in @ref m_id_keys.
+ *
+ * @param[in] peer_id  The peer.
+ *
+ * @return  The entry of the peer, or NULL if the peer is not in the cache.
+ */
+static im_id_key_entry_t * id_key_entry_find(pm_peer_id_t peer_id)
+{
+    if (!m_id_keys_valid)
+    {
+        id_keys_build();
+    }
+
+    for (uint32_t i = 0; i < m_id_key_cnt; i++)
+    {
+        if (m_id_keys[i].peer_id == peer_id)
+        {
+            return &m_id_keys[i];
         }
     }
 
+    return NULL;
+}
+
+
+/**@brief Function for updating the identity keys of a peer whose bonding data was written or
+ *        deleted.
+ *
+ * @param[in] peer_id  The peer.
+ */
+static void id_keys_peer_update(pm_peer_id_t peer_id)
+{
+    pm_peer_data_flash_t peer_data;
+    im_id_key_entry_t  * p_entry;
+
+    if (!m_id_keys_valid)
+    {
+        // Will be built on the next lookup.
+        return;
+    }
+
+    p_entry = id_key_entry_find(peer_id);
+
+    if (pdb_peer_data_ptr_get(peer_id, PM_PEER_DATA_ID_BONDING, &peer_data) != NRF_SUCCESS)
+    {
+        if (!m_id_keys_complete)
+        {
+            // A bond that did not fit may fit now.
+            m_id_keys_valid = false;
+        }
+        else if (p_entry != NULL)
+        {
+            // Keep the entries packed.
+            *p_entry = m_id_keys[--m_id_key_cnt];
+        }
+        return;
+    }
+
+    if (p_entry == NULL)
+    {
+        if (m_id_key_cnt == PM_ID_KEY_CACHE_SIZE)
+        {
+            m_id_keys_complete = false;
+            return;
+        }
+        p_entry          = &m_id_keys[m_id_key_cnt++];
+        p_entry->peer_id = peer_id;
+    }
+
+    p_entry->id_key = peer_data.p_bonding_data->peer_ble_id;
+}
+
+
+/**@brief Function for giving the bonded peers to the SoftDevice as the whitelist and the device
+ *        identities list.
+ *
+ * @details Peers whose identity address cannot be whitelisted are skipped. If a list is in use,
+ *          the lists are given again on the next call to @ref im_whitelist_get.
+ *
+ * @return  The error returned by @ref im_whitelist_set or @ref im_device_identities_list_set.
+ */
+static ret_code_t wlist_all_bonded_apply(void)
+{
+    pm_peer_id_t peers[MIN(BLE_GAP_WHITELIST_ADDR_MAX_COUNT, BLE_GAP_DEVICE_IDENTITIES_MAX_COUNT)];
+    uint32_t     peer_cnt = 0;
+    ret_code_t   ret;
+
+    if (!m_id_keys_valid)
+    {
+        id_keys_build();
+    }
+
+    for (uint32_t i = 0; (i < m_id_key_cnt) && (peer_cnt < ARRAY_SIZE(peers)); i++)
+    {
+        if (addr_is_identity(&m_id_keys[i].id_key.id_addr_info))
+        {
+            peers[peer_cnt++] = m_id_keys[i].peer_id;
+        }
+    }
+
+    ret = im_whitelist_set(peers, peer_cnt);
+    if (ret == NRF_SUCCESS)
+    {
+        ret = im_device_identities_list_set(peers, peer_cnt);
+    }
+
+    m_wlist_all_bonded_pending = (   (ret == BLE_ERROR_GAP_WHITELIST_IN_USE)
+                                  || (ret == BLE_ERROR_GAP_DEVICE_IDENTITIES_IN_USE));
+
+    return ret;
+}
+
+
+/**@brief Function for giving the updated bonded peers to the SoftDevice, if the lists follow them.
+ */
+static void wlist_all_bonded_update(void)
+{
+    if (m_wlist_all_bonded)
+    {
+        ret_code_t ret = wlist_all_bonded_apply();
+        if ((ret != NRF_SUCCESS) && !m_wlist_all_bonded_pending)
+        {
+            NRF_LOG_WARNING("Could not update the whitelist of bonded peers, nrf_error: %#x.", ret);
+        }
+    }
+}
+#endif // PM_ID_KEY_CACHE_ENABLED
+
+
+void im_pdb_evt_handler(pm_evt_t * p_event)
+{
+#if PM_RPA_CACHE_ENABLED || PM_ID_INDEX_ENABLED || PM_ID_KEY_CACHE_ENABLED
+    switch (p_event->evt_id)
+    {
+        case PM_EVT_PEER_DATA_UPDATE_SUCCEEDED:
+            if (p_event->params.peer_data_update_succeeded.data_id == PM_PEER_DATA_ID_BONDING)
+            {
+#if PM_RPA_CACHE_ENABLED
+                rpa_cache_reset();
+#endif
+#if PM_ID_INDEX_ENABLED
+                index_peer_update(p_event->peer_id);
+#endif
+#if PM_ID_KEY_CACHE_ENABLED
+                id_keys_peer_update(p_event->peer_id);
+                wlist_all_bonded_update();
+#endif
+            }
+            break;
+
+        case PM_EVT_PEER_DELETE_SUCCEEDED:
+#if PM_RPA_CACHE_ENABLED
+            rpa_cache_reset();
+#endif
+#if PM_ID_INDEX_ENABLED
+            index_peer_update(p_event->peer_id);
+#endif
+#if PM_ID_KEY_CACHE_ENABLED
+            id_keys_peer_update(p_event->peer_id);
+            wlist_all_bonded_update();
+#endif
+            break;
+
+        case PM_EVT_PEERS_DELETE_SUCCEEDED:
+        case PM_EVT_PEERS_DELETE_FAILED:
+#if PM_RPA_CACHE_ENABLED
+            rpa_cache_reset();
+#endif
+#if PM_ID_INDEX_ENABLED
+            m_index_valid = false; // Rebuilt from the remaining bonds on the next lookup.
+#endif
+#if PM_ID_KEY_CACHE_ENABLED
+            m_id_keys_valid = false;
+            wlist_all_bonded_update();
+#endif
+            break;
+
+        default:
+            break;
+    }
+#else
+    UNUSED_PARAMETER(p_event);
+#endif
+}
+
+
+void im_ble_evt_handler(ble_evt_t const * ble_evt)
+{
+    ble_gap_evt_t gap_evt;
+    pm_peer_id_t  bonded_matching_peer_id;
+
+    if (ble_evt->header.evt_id != BLE_GAP_EVT_CONNECTED)
+    {
+        // Nothing to do.
+        return;
+    }
+
+    gap_evt = ble_evt->evt.gap_evt;
+
+    // Search the database for bonding data matching the one that triggered the event.
+    bonded_matching_peer_id = im_peer_id_get_by_addr(&gap_evt.params.connected.peer_addr);
+
     m_connections[gap_evt.conn_handle].peer_id      = bonded_matching_peer_id;
     m_connections[gap_evt.conn_handle].peer_address = gap_evt.params.connected.peer_addr;
 
@@ -283,6 +1030,43 @@ pm_peer_id_t im_find_duplicate_bonding_data(pm_peer_data_bonding_t const * p_bon
 
     NRF_PM_DEBUG_CHECK(p_bonding_data != NULL);
 
+#if PM_ID_INDEX_ENABLED
+    // A duplicate has either the same identity address or the same IRK.
+    uint32_t hashes[2];
+    uint32_t n_hashes = 0;
+
+    if (addr_is_identity(&p_bonding_data->peer_ble_id.id_addr_info))
+    {
+        hashes[n_hashes++] = addr_hash(&p_bonding_data->peer_ble_id.id_addr_info);
+    }
+    if (is_valid_irk(&p_bonding_data->peer_ble_id.id_info))
+    {
+        hashes[n_hashes++] = irk_hash(&p_bonding_data->peer_ble_id.id_info);
+    }
+
+    index_ensure();
+
+    for (uint32_t i = 0; i < n_hashes; i++)
+    {
+        uint32_t probe = 0;
+
+        while ((peer_id = index_find_next(hashes[i], &probe, &peer_data_duplicate)) != PM_PEER_ID_INVALID)
+        {
+            if (  (peer_id != peer_id_skip)
+                && im_is_duplicate_bonding_data(p_bonding_data,
+                                                peer_data_duplicate.p_bonding_data))
+            {
+                return peer_id;
+            }
+        }
+    }
+
+    if (m_index_complete)
+    {
+        return PM_PEER_ID_INVALID;
+    }
+#endif
+
     pds_peer_data_iterate_prepare();
 
     while (pds_peer_data_iterate(PM_PEER_DATA_ID_BONDING, &peer_id, &peer_data_duplicate))
@@ -350,6 +1134,32 @@ pm_peer_id_t im_peer_id_get_by_master_id(ble_gap_master_id_t const * p_master_id
 
     NRF_PM_DEBUG_CHECK(p_master_id != NULL);
 
+#if PM_ID_INDEX_ENABLED
+    if (!im_master_id_is_valid(p_master_id))
+    {
+        return PM_PEER_ID_INVALID;
+    }
+
+    uint32_t const hash  = master_id_hash(p_master_id);
+    uint32_t       probe = 0;
+
+    index_ensure();
+
+    while ((peer_id = index_find_next(hash, &probe, &peer_data)) != PM_PEER_ID_INVALID)
+    {
+        if (im_master_ids_compare(p_master_id, &peer_data.p_bonding_data->own_ltk.master_id) ||
+            im_master_ids_compare(p_master_id, &peer_data.p_bonding_data->peer_ltk.master_id))
+        {
+            return peer_id;
+        }
+    }
+
+    if (m_index_complete)
+    {
+        return PM_PEER_ID_INVALID;
+    }
+#endif
+
     pds_peer_data_iterate_prepare();
 
     // For each stored peer, check if the master_id matches p_master_id
@@ -429,6 +1239,76 @@ ret_code_t im_peer_free(pm_peer_id_t peer_id)
 }
 
 
+#if PM_BULK_DELETE_ENABLED
+ret_code_t im_peers_free(pm_peer_id_t peer_id_to_keep)
+{
+    ret_code_t ret = pdb_peers_free(peer_id_to_keep);
+
+    if (ret == NRF_SUCCESS)
+    {
+        for (uint16_t conn_handle = 0; conn_handle < IM_MAX_CONN_HANDLES; conn_handle++)
+        {
+            if (   (m_connections[conn_handle].peer_id != peer_id_to_keep)
+                && (m_connections[conn_handle].peer_id < PM_PEER_ID_N_AVAILABLE_IDS))
+            {
+                m_connections[conn_handle].peer_id = PM_PEER_ID_INVALID;
+            }
+        }
+    }
+    return ret;
+}
+#endif
+
+
+/**@brief Function for getting the identity address and IRK of a peer, from RAM if they are
+ *        cached, otherwise from flash.
+ *
+ * @param[in]  peer_id   The peer.
+ * @param[out] p_id_key  The identity address and IRK.
+ *
+ * @retval NRF_SUCCESS          If the keys were found.
+ * @retval NRF_ERROR_NOT_FOUND  If the peer is not bonded.
+ */
+static ret_code_t id_key_get(pm_peer_id_t peer_id, ble_gap_id_key_t * p_id_key)
+{
+    ret_code_t             ret;
+    pm_peer_data_bonding_t bond_data;
+    pm_peer_data_t         peer_data;
+
+    uint32_t const buf_size = sizeof(bond_data);
+
+#if PM_ID_KEY_CACHE_ENABLED
+    im_id_key_entry_t const * p_entry = id_key_entry_find(peer_id);
+
+    if (p_entry != NULL)
+    {
+        *p_id_key = p_entry->id_key;
+        return NRF_SUCCESS;
+    }
+    if (m_id_keys_complete)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+#endif
+
+    memset(&peer_data, 0x00, sizeof(peer_data));
+    memset(&bond_data, 0x00, sizeof(bond_data));
+    peer_data.p_bonding_data = &bond_data;
+
+    // Read peer data from flash.
+    ret = pds_peer_data_read(peer_id, PM_PEER_DATA_ID_BONDING, &peer_data, &buf_size);
+
+    if ((ret == NRF_ERROR_NOT_FOUND) || (ret == NRF_ERROR_INVALID_PARAM))
+    {
+        // Peer data coulnd't be found in flash or peer ID is not valid.
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    *p_id_key = bond_data.peer_ble_id;
+    return NRF_SUCCESS;
+}
+
+
 /**@brief Given a list of peers, loads their GAP address and IRK into the provided buffers.
  */
 static ret_code_t peers_id_keys_get(pm_peer_id_t   const * p_peers,
@@ -438,12 +1318,8 @@ static ret_code_t peers_id_keys_get(pm_peer_id_t   const * p_peers,
                                     ble_gap_irk_t        * p_gap_irks,
                                     uint32_t             * p_irk_cnt)
 {
-    ret_code_t ret;
-
-    pm_peer_data_bonding_t bond_data;
-    pm_peer_data_t         peer_data;
-
-    uint32_t const buf_size = sizeof(bond_data);
+    ret_code_t       ret;
+    ble_gap_id_key_t id_key;
 
     bool copy_addrs = false;
     bool copy_irks  = false;
@@ -469,26 +1345,18 @@ static ret_code_t peers_id_keys_get(pm_peer_id_t   const * p_peers,
         *p_irk_cnt = 0;
     }
 
-    memset(&peer_data, 0x00, sizeof(peer_data));
-    peer_data.p_bonding_data = &bond_data;
-
-    // Read through flash memory and look for peers ID keys.
+    // Look for peers ID keys.
 
     for (uint32_t i = 0; i < peer_cnt; i++)
     {
-        memset(&bond_data, 0x00, sizeof(bond_data));
-
-        // Read peer data from flash.
-        ret = pds_peer_data_read(p_peers[i], PM_PEER_DATA_ID_BONDING,
-                                 &peer_data, &buf_size);
+        ret = id_key_get(p_peers[i], &id_key);
 
-        if ((ret == NRF_ERROR_NOT_FOUND) || (ret == NRF_ERROR_INVALID_PARAM))
+        if (ret != NRF_SUCCESS)
         {
-            // Peer data coulnd't be found in flash or peer ID is not valid.
-            return NRF_ERROR_NOT_FOUND;
+            return ret;
         }
 
-        uint8_t const addr_type = bond_data.peer_ble_id.id_addr_info.addr_type;
+        uint8_t const addr_type = id_key.id_addr_info.addr_type;
 
         if ((addr_type != BLE_GAP_ADDR_TYPE_PUBLIC) &&
             (addr_type != BLE_GAP_ADDR_TYPE_RANDOM_STATIC))
@@ -500,14 +1368,14 @@ static ret_code_t peers_id_keys_get(pm_peer_id_t   const * p_peers,
         // Copy the GAP address.
         if (copy_addrs)
         {
-            memcpy(&p_gap_addrs[i], &bond_data.peer_ble_id.id_addr_info, sizeof(ble_gap_addr_t));
+            memcpy(&p_gap_addrs[i], &id_key.id_addr_info, sizeof(ble_gap_addr_t));
             (*p_addr_cnt)++;
         }
 
         // Copy the IRK.
         if (copy_irks)
         {
-            memcpy(&p_gap_irks[i], bond_data.peer_ble_id.id_info.irk, BLE_GAP_SEC_KEY_LEN);
+            memcpy(&p_gap_irks[i], id_key.id_info.irk, BLE_GAP_SEC_KEY_LEN);
             (*p_irk_cnt)++;
         }
     }
@@ -519,9 +1387,7 @@ static ret_code_t peers_id_keys_get(pm_peer_id_t   const * p_peers,
 ret_code_t im_device_identities_list_set(pm_peer_id_t const * p_peers,
                                          uint32_t             peer_cnt)
 {
-    ret_code_t             ret;
-    pm_peer_data_t         peer_data;
-    pm_peer_data_bonding_t bond_data;
+    ret_code_t ret;
 
     ble_gap_id_key_t         keys[BLE_GAP_DEVICE_IDENTITIES_MAX_COUNT];
     ble_gap_id_key_t const * key_ptrs[BLE_GAP_DEVICE_IDENTITIES_MAX_COUNT];
@@ -537,9 +1403,6 @@ ret_code_t im_device_identities_list_set(pm_peer_id_t const * p_peers,
         return sd_ble_gap_device_identities_set(NULL, NULL, 0);
     }
 
-    peer_data.p_bonding_data = &bond_data;
-    uint32_t const buf_size  = sizeof(bond_data);
-
     memset(keys, 0x00, sizeof(keys));
     for (uint32_t i = 0; i < BLE_GAP_DEVICE_IDENTITIES_MAX_COUNT; i++)
     {
@@ -548,13 +1411,9 @@ ret_code_t im_device_identities_list_set(pm_peer_id_t const * p_peers,
 
     for (uint32_t i = 0; i < peer_cnt; i++)
     {
-        memset(&bond_data, 0x00, sizeof(bond_data));
-
-        // Read peer data from flash.
-        ret = pds_peer_data_read(p_peers[i], PM_PEER_DATA_ID_BONDING,
-                                 &peer_data, &buf_size);
+        ret = id_key_get(p_peers[i], &keys[i]);
 
-        if ((ret == NRF_ERROR_NOT_FOUND) || (ret == NRF_ERROR_INVALID_PARAM))
+        if (ret != NRF_SUCCESS)
         {
             NRF_LOG_WARNING("peer id %d: Peer data could not be found in flash. Remove the peer ID "
                             "from the peer list and try again.",
@@ -562,7 +1421,7 @@ ret_code_t im_device_identities_list_set(pm_peer_id_t const * p_peers,
             return NRF_ERROR_NOT_FOUND;
         }
 
-        uint8_t const addr_type = bond_data.peer_ble_id.id_addr_info.addr_type;
+        uint8_t const addr_type = keys[i].id_addr_info.addr_type;
 
         if ((addr_type != BLE_GAP_ADDR_TYPE_PUBLIC) &&
             (addr_type != BLE_GAP_ADDR_TYPE_RANDOM_STATIC))
@@ -572,9 +1431,6 @@ ret_code_t im_device_identities_list_set(pm_peer_id_t const * p_peers,
                             p_peers[i]);
             return BLE_ERROR_GAP_INVALID_BLE_ADDR;
         }
-
-        // Copy data to the buffer.
-        memcpy(&keys[i], &bond_data.peer_ble_id, sizeof(ble_gap_id_key_t));
     }
 
     return sd_ble_gap_device_identities_set(key_ptrs, NULL, peer_cnt);
@@ -619,6 +1475,14 @@ ret_code_t im_whitelist_get(ble_gap_addr_t * p_addrs,
     NRF_PM_DEBUG_CHECK((p_addrs    != NULL) || (p_irks    != NULL));
     NRF_PM_DEBUG_CHECK((p_addr_cnt != NULL) || (p_irk_cnt != NULL));
 
+#if PM_ID_KEY_CACHE_ENABLED
+    if (m_wlist_all_bonded && m_wlist_all_bonded_pending)
+    {
+        // The lists were in use when the bonds changed. This is called before they are used again.
+        UNUSED_RETURN_VALUE(wlist_all_bonded_apply());
+    }
+#endif
+
     if (((p_addr_cnt != NULL) && (m_wlisted_peer_cnt > *p_addr_cnt)) ||
         ((p_irk_cnt  != NULL) && (m_wlisted_peer_cnt > *p_irk_cnt)))
     {
@@ -689,6 +1553,17 @@ ret_code_t im_whitelist_set(pm_peer_id_t const * p_peers,
 }
 
 
+#if PM_ID_KEY_CACHE_ENABLED
+ret_code_t im_whitelist_all_bonded_set(bool enable)
+{
+    m_wlist_all_bonded         = enable;
+    m_wlist_all_bonded_pending = false;
+
+    return enable ? wlist_all_bonded_apply() : NRF_SUCCESS;
+}
+#endif
+
+
 /**@brief Function for calculating the ah() hash function described in Bluetooth core specification
  *        4.2 section 3.H.2.2.2.
  *
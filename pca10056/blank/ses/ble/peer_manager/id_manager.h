@@ -78,6 +78,19 @@ void im_ble_evt_handler(ble_evt_t const * p_ble_evt);
 pm_peer_id_t im_peer_id_get_by_conn_handle(uint16_t conn_handle);
 
 
+/**@brief Function for retrieving the peer ID of a bonded peer, given one of its addresses.
+ *
+ * @details Identity addresses are compared to the stored ones, and resolvable private addresses
+ *          are resolved against the stored IRKs. If @ref PM_RPA_CACHE_ENABLED is set, resolved
+ *          addresses are cached.
+ *
+ * @param[in]  p_addr  The address of the peer.
+ *
+ * @return  The peer ID, or @ref PM_PEER_ID_INVALID if no bonded peer matched the address.
+ */
+pm_peer_id_t im_peer_id_get_by_addr(ble_gap_addr_t const * p_addr);
+
+
 /**@brief Function for getting the corresponding peer ID from a master ID (EDIV and rand).
  *
  * @param[in]  p_master_id  The master ID.
@@ -172,6 +185,18 @@ void im_new_peer_id(uint16_t conn_handle, pm_peer_id_t peer_id);
 ret_code_t im_peer_free(pm_peer_id_t peer_id);
 
 
+/**@brief Function for deleting the data of all peers from flash as a single operation, and
+ *        disassociating them from any connection handles they are associated with.
+ *
+ * @note Requires @ref PM_BULK_DELETE_ENABLED.
+ *
+ * @param[in]  peer_id_to_keep  A peer that is not freed, or @ref PM_PEER_ID_INVALID to free all.
+ *
+ * @return Any error code returned by @ref pdb_peers_free.
+ */
+ret_code_t im_peers_free(pm_peer_id_t peer_id_to_keep);
+
+
 /**@brief Function to set the local Bluetooth identity address.
  *
  * @details The local Bluetooth identity address is the address that identifies this device to other
@@ -306,6 +331,16 @@ ret_code_t im_device_identities_list_set(pm_peer_id_t const * p_peers,
                                          uint32_t             peer_cnt);
 
 
+/**@brief Function for making the whitelist and the device identities list follow the bonded peers.
+ *
+ * @param[in] enable  Whether the lists follow the bonded peers.
+ *
+ * @return  The error from @ref im_whitelist_set or @ref im_device_identities_list_set. If a list
+ *          is in use, it is set again on the next call to @ref im_whitelist_get.
+ */
+ret_code_t im_whitelist_all_bonded_set(bool enable);
+
+
 /** @}
  * @endcond
  */
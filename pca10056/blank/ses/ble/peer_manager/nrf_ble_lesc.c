@@ -43,11 +43,27 @@
 
 #include "nrf_ble_lesc.h"
 #include "nrf_crypto.h"
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+#include "nrf_crypto_jobq.h"
+#endif
+
+#if (NRF_BLE_LESC_MAX_OPS_PER_CALL > 0)
+#include "nrf_nvic.h"
+#include "nrf_soc.h"
+#endif
 
 #define NRF_LOG_MODULE_NAME nrf_ble_lesc
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
 
+#ifndef NRF_BLE_LESC_KEYPAIR_POOL_SIZE
+#define NRF_BLE_LESC_KEYPAIR_POOL_SIZE 0
+#endif
+
+#ifndef NRF_BLE_LESC_MAX_OPS_PER_CALL
+#define NRF_BLE_LESC_MAX_OPS_PER_CALL 0
+#endif
+
 /**@brief Descriptor of the peer public key. */
 typedef struct
 {
@@ -58,11 +74,22 @@ typedef struct
     bool                        passkey_displayed; /**< Flag indicating that the passkey display event has been received. */
 } nrf_ble_lesc_peer_pub_key_t;
 
+/**@brief Descriptor of a local key pair. */
+typedef struct
+{
+    nrf_crypto_ecc_private_key_t private_key; /**< Private key. */
+    ble_gap_lesc_p256_pk_t       public_key;  /**< Public key, in little-endian raw format. Only used for spare key pairs. */
+    bool                         is_ready;    /**< Flag indicating that this is a spare key pair that has been generated. */
+} nrf_ble_lesc_keypair_t;
+
 /**@brief   The maximum number of peripheral and central connections combined.
  *          This value is based on what is configured in the SoftDevice handler sdk_config.
  */
 #define NRF_BLE_LESC_LINK_COUNT (NRF_SDH_BLE_PERIPHERAL_LINK_COUNT + NRF_SDH_BLE_CENTRAL_LINK_COUNT)
 
+/**@brief   The number of local key pairs: the one in use, and the spare ones. */
+#define NRF_BLE_LESC_KEYPAIR_COUNT (1 + NRF_BLE_LESC_KEYPAIR_POOL_SIZE)
+
 __ALIGN(4) static ble_gap_lesc_p256_pk_t m_lesc_public_key;                             /**< LESC ECC Public Key. */
 __ALIGN(4) static ble_gap_lesc_dhkey_t   m_lesc_dh_key;                                 /**< LESC ECC DH Key. */
 
@@ -71,13 +98,19 @@ static nrf_crypto_ecdh_context_t                  m_ecdh_context;
 static bool                                       m_ble_lesc_internal_error;            /**< Flag indicating that the module encountered an internal error. */
 static bool                                       m_keypair_generated;                  /**< Flag indicating that the local ECDH key pair was generated. */
 static nrf_crypto_ecc_key_pair_generate_context_t m_keygen_context;                     /**< Context to generate private/public key pair. */
-static nrf_crypto_ecc_private_key_t               m_private_key;                        /**< Allocated private key type to use for LESC DH generation. */
+static nrf_ble_lesc_keypair_t                     m_keypairs[NRF_BLE_LESC_KEYPAIR_COUNT]; /**< Local key pairs. The private key of @ref m_keypair_idx is used for LESC DH generation. */
+static uint8_t                                    m_keypair_idx;                        /**< Index of the key pair in use. */
+static bool                                       m_keypair_regen_pending;              /**< Flag indicating that a new key pair is to be taken into use once no DH key requests are pending. */
 static nrf_crypto_ecc_public_key_t                m_public_key;                         /**< Allocated public key type to use for LESC DH generation. */
 static nrf_ble_lesc_peer_pub_key_t                m_peer_keys[NRF_BLE_LESC_LINK_COUNT]; /**< Array of pointers to peer public keys, used for LESC DH generation. */
+static uint16_t                                   m_next_link;                          /**< Link whose DH key request is handled first in the next call to @ref nrf_ble_lesc_request_handler. */
 
 static bool                                       m_lesc_oobd_own_generated;
 static ble_gap_lesc_oob_data_t                    m_ble_lesc_oobd_own;                  /**< LESC OOB data used in LESC OOB pairing mode. */
 static nrf_ble_lesc_peer_oob_data_handler         m_lesc_oobd_peer_handler;
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+static nrf_crypto_jobq_job_t                      m_lesc_job;                           /**< Crypto job that runs @ref nrf_ble_lesc_request_handler. */
+#endif
 
 ret_code_t nrf_ble_lesc_init(void)
 {
@@ -122,6 +155,14 @@ ret_code_t nrf_ble_lesc_init(void)
     // Reset module state.
     m_ble_lesc_internal_error = false;
     m_keypair_generated       = false;
+    m_keypair_regen_pending   = false;
+    m_keypair_idx             = 0;
+    m_next_link               = 0;
+
+    for (uint32_t i = 0; i < NRF_BLE_LESC_KEYPAIR_COUNT; i++)
+    {
+        m_keypairs[i].is_ready = false;
+    }
 
     // Generate ECC key pair. Only one key pair is automatically generated by this module.
     err_code = nrf_ble_lesc_keypair_generate();
@@ -129,28 +170,26 @@ ret_code_t nrf_ble_lesc_init(void)
 }
 
 
-ret_code_t nrf_ble_lesc_keypair_generate(void)
+/**@brief Function for generating an ECC key pair.
+ *
+ * @param[out] p_private_key  Private key.
+ * @param[out] p_public_raw   Public key, in little-endian raw format.
+ *
+ * @retval NRF_SUCCESS If the operation was successful.
+ * @retval Other       Other error codes might be returned by the @ref nrf_crypto_ecc_key_pair_generate,
+ *                     @ref nrf_crypto_ecc_public_key_to_raw and @ref nrf_crypto_ecc_byte_order_invert
+ *                     functions.
+ */
+static ret_code_t keypair_generate(nrf_crypto_ecc_private_key_t * p_private_key,
+                                   uint8_t                      * p_public_raw)
 {
     ret_code_t err_code;
     size_t     public_len = NRF_CRYPTO_ECC_SECP256R1_RAW_PUBLIC_KEY_SIZE;
 
-    // Check if any DH computation is pending
-    for (uint32_t i = 0; i < ARRAY_SIZE(m_peer_keys); i++)
-    {
-        if (m_peer_keys[i].is_valid)
-        {
-            return NRF_ERROR_BUSY;
-        }
-    }
-
-    // Update flag to indicate that there is no valid private key.
-    m_keypair_generated       = false;
-    m_lesc_oobd_own_generated = false;
-
     NRF_LOG_DEBUG("Generating ECC key pair");
     err_code = nrf_crypto_ecc_key_pair_generate(&m_keygen_context,
                                                 &g_nrf_crypto_ecc_secp256r1_curve_info,
-                                                &m_private_key,
+                                                p_private_key,
                                                 &m_public_key);
     if (err_code != NRF_SUCCESS)
     {
@@ -160,7 +199,7 @@ ret_code_t nrf_ble_lesc_keypair_generate(void)
 
     // Convert to a raw type.
     err_code = nrf_crypto_ecc_public_key_to_raw(&m_public_key,
-                                                m_lesc_public_key.pk,
+                                                p_public_raw,
                                                 &public_len);
     if (err_code != NRF_SUCCESS)
     {
@@ -170,14 +209,56 @@ ret_code_t nrf_ble_lesc_keypair_generate(void)
 
     // Invert the raw type to little-endian (required for BLE).
     err_code = nrf_crypto_ecc_byte_order_invert(&g_nrf_crypto_ecc_secp256r1_curve_info,
-                                                m_lesc_public_key.pk,
-                                                m_lesc_public_key.pk,
+                                                p_public_raw,
+                                                p_public_raw,
                                                 NRF_CRYPTO_ECC_SECP256R1_RAW_PUBLIC_KEY_SIZE);
     if (err_code != NRF_SUCCESS)
     {
         NRF_LOG_ERROR("nrf_crypto_ecc_byte_order_invert() returned error 0x%x.", err_code);
     }
-    else
+
+    return err_code;
+}
+
+
+ret_code_t nrf_ble_lesc_keypair_generate(void)
+{
+    ret_code_t err_code;
+
+    // Check if any DH computation is pending
+    for (uint32_t i = 0; i < ARRAY_SIZE(m_peer_keys); i++)
+    {
+        if (m_peer_keys[i].is_valid)
+        {
+            return NRF_ERROR_BUSY;
+        }
+    }
+
+    // Update flag to indicate that there is no valid private key.
+    m_keypair_generated       = false;
+    m_lesc_oobd_own_generated = false;
+    m_keypair_regen_pending   = false;
+
+#if (NRF_BLE_LESC_KEYPAIR_POOL_SIZE > 0)
+    // Take a spare key pair into use if one has been generated.
+    for (uint8_t i = 0; i < NRF_BLE_LESC_KEYPAIR_COUNT; i++)
+    {
+        if (m_keypairs[i].is_ready)
+        {
+            NRF_LOG_DEBUG("Using spare ECC key pair %d", i);
+            m_keypairs[i].is_ready = false;
+            m_keypair_idx          = i;
+
+            memcpy(m_lesc_public_key.pk, m_keypairs[i].public_key.pk, BLE_GAP_LESC_P256_PK_LEN);
+
+            m_keypair_generated = true;
+            return NRF_SUCCESS;
+        }
+    }
+#endif
+
+    err_code = keypair_generate(&m_keypairs[m_keypair_idx].private_key, m_lesc_public_key.pk);
+    if (err_code == NRF_SUCCESS)
     {
         // Set the flag to indicate that there is a valid ECDH key pair generated.
         m_keypair_generated = true;
@@ -275,7 +356,7 @@ static ret_code_t compute_and_give_dhkey(nrf_ble_lesc_peer_pub_key_t * p_peer_pu
     if (p_peer_public_key->is_valid)
     {
         err_code = nrf_crypto_ecdh_compute(&m_ecdh_context,
-                                           &m_private_key,
+                                           &m_keypairs[m_keypair_idx].private_key,
                                            &p_peer_public_key->value,
                                            p_shared_secret,
                                            &shared_secret_size);
@@ -304,9 +385,58 @@ static ret_code_t compute_and_give_dhkey(nrf_ble_lesc_peer_pub_key_t * p_peer_pu
 }
 
 
+#if (NRF_BLE_LESC_KEYPAIR_POOL_SIZE > 0)
+/**@brief Function for finding a spare key pair that has not been generated yet.
+ *
+ * @return Pointer to the key pair, or NULL if all spare key pairs are ready.
+ */
+static nrf_ble_lesc_keypair_t * spare_keypair_find(void)
+{
+    for (uint8_t i = 0; i < NRF_BLE_LESC_KEYPAIR_COUNT; i++)
+    {
+        if ((i != m_keypair_idx) && !m_keypairs[i].is_ready)
+        {
+            return &m_keypairs[i];
+        }
+    }
+
+    return NULL;
+}
+#endif
+
+
+/**@brief Function for checking whether another ECC operation may be done in the current call to
+ *        @ref nrf_ble_lesc_request_handler.
+ *
+ * @details If not, the main loop is woken up, so that the handler is called again soon.
+ *
+ * @param[in]  op_cnt  The number of ECC operations done in the current call.
+ *
+ * @retval true  If another operation may be done.
+ * @retval false If the limit of operations per call has been reached.
+ */
+static bool op_allowed(uint32_t op_cnt)
+{
+#if (NRF_BLE_LESC_MAX_OPS_PER_CALL > 0)
+    if (op_cnt >= NRF_BLE_LESC_MAX_OPS_PER_CALL)
+    {
+        // Pend the SoftDevice event interrupt to return from sd_app_evt_wait(). No events will be
+        // found, so this has no other effect.
+        UNUSED_RETURN_VALUE(sd_nvic_SetPendingIRQ(SD_EVT_IRQn));
+        return false;
+    }
+#else
+    UNUSED_PARAMETER(op_cnt);
+#endif
+    return true;
+}
+
+
 ret_code_t nrf_ble_lesc_request_handler(void)
 {
     ret_code_t err_code = NRF_SUCCESS;
+    uint32_t   op_cnt   = 0;
+    uint16_t   first    = m_next_link;
 
     // If the LESC module is in an invalid state, a restart is required.
     if (m_ble_lesc_internal_error)
@@ -314,25 +444,149 @@ ret_code_t nrf_ble_lesc_request_handler(void)
         return NRF_ERROR_INTERNAL;
     }
 
-    for (uint16_t i = 0; i < NRF_BLE_LESC_LINK_COUNT; i++)
+    // Take the links in turns, so that all are served when the number of operations is limited.
+    for (uint16_t n = 0; n < NRF_BLE_LESC_LINK_COUNT; n++)
     {
+        uint16_t i = (first + n) % NRF_BLE_LESC_LINK_COUNT;
+
         if (m_peer_keys[i].is_requested)
         {
+            if (!op_allowed(op_cnt))
+            {
+                return NRF_SUCCESS;
+            }
+
             err_code                         = compute_and_give_dhkey(&m_peer_keys[i], i);
             m_peer_keys[i].is_requested      = false;
             m_peer_keys[i].is_valid          = false;
             m_peer_keys[i].passkey_requested = false;
             m_peer_keys[i].passkey_displayed = false;
+            m_next_link                      = (i + 1) % NRF_BLE_LESC_LINK_COUNT;
+            op_cnt++;
 
             VERIFY_SUCCESS(err_code);
 
         }
     }
 
+    if (m_keypair_regen_pending)
+    {
+        if (!op_allowed(op_cnt))
+        {
+            return NRF_SUCCESS;
+        }
+
+        err_code = nrf_ble_lesc_keypair_generate();
+        VERIFY_SUCCESS(err_code);
+        op_cnt++;
+    }
+
+#if (NRF_BLE_LESC_KEYPAIR_POOL_SIZE > 0)
+    // Generate one spare key pair per call, and only when there was nothing else to do.
+    nrf_ble_lesc_keypair_t * p_spare = spare_keypair_find();
+
+    if ((p_spare != NULL) && (op_cnt == 0))
+    {
+        err_code = keypair_generate(&p_spare->private_key, p_spare->public_key.pk);
+        VERIFY_SUCCESS(err_code);
+        p_spare->is_ready = true;
+    }
+#endif
+
     return err_code;
 }
 
 
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+/**@brief Function for checking whether @ref nrf_ble_lesc_request_handler has work left.
+ *
+ * @param[out] p_urgent Set to true if a peer is waiting for a DH key.
+ */
+static bool work_pending(bool * p_urgent)
+{
+    *p_urgent = false;
+
+    for (uint16_t i = 0; i < NRF_BLE_LESC_LINK_COUNT; i++)
+    {
+        if (m_peer_keys[i].is_requested)
+        {
+            *p_urgent = true;
+            return true;
+        }
+    }
+
+#if (NRF_BLE_LESC_KEYPAIR_POOL_SIZE > 0)
+    if (spare_keypair_find() != NULL)
+    {
+        return true;
+    }
+#endif
+
+    return m_keypair_regen_pending;
+}
+
+
+static ret_code_t lesc_job_run(nrf_crypto_jobq_job_t * p_job)
+{
+    UNUSED_PARAMETER(p_job);
+
+    return nrf_ble_lesc_request_handler();
+}
+
+
+static void lesc_job_submit(void);
+
+
+static void lesc_job_done(nrf_crypto_jobq_job_t * p_job, ret_code_t result)
+{
+    UNUSED_PARAMETER(p_job);
+
+    if (result != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("nrf_ble_lesc_request_handler() returned error 0x%x.", result);
+        m_ble_lesc_internal_error = true;
+        return;
+    }
+
+    lesc_job_submit();
+}
+
+
+/**@brief Function for queuing @ref nrf_ble_lesc_request_handler in the crypto job queue.
+ *
+ * @details DH key requests are queued at high priority, because the peer times out the pairing
+ *          procedure. Key pair generation is queued at low priority. The job is queued again when
+ *          it is done if work is left.
+ */
+static void lesc_job_submit(void)
+{
+    ret_code_t err_code;
+    bool       urgent;
+
+    if (m_ble_lesc_internal_error || !work_pending(&urgent))
+    {
+        return;
+    }
+
+    // A queued key pair generation must not hold back a DH key request.
+    if (urgent && m_lesc_job.queued && (m_lesc_job.prio != NRF_CRYPTO_JOBQ_PRIO_HIGH))
+    {
+        UNUSED_RETURN_VALUE(nrf_crypto_jobq_cancel(&m_lesc_job));
+    }
+
+    err_code = nrf_crypto_jobq_submit(&m_lesc_job,
+                                      urgent ? NRF_CRYPTO_JOBQ_PRIO_HIGH : NRF_CRYPTO_JOBQ_PRIO_LOW,
+                                      lesc_job_run,
+                                      lesc_job_done,
+                                      NULL);
+    if ((err_code != NRF_SUCCESS) && (err_code != NRF_ERROR_BUSY))
+    {
+        NRF_LOG_ERROR("nrf_crypto_jobq_submit() returned error 0x%x.", err_code);
+    }
+}
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+
+
 /**@brief Function for handling a DH key request event.
  *
  * @param[in]  conn_handle      Connection handle.
@@ -502,7 +756,12 @@ void nrf_ble_lesc_on_ble_evt(ble_evt_t const * p_ble_evt)
         case BLE_GAP_EVT_AUTH_STATUS:
             // Generate new pairing keys.
              err_code = nrf_ble_lesc_keypair_generate();
-             if (err_code != NRF_SUCCESS)
+             if (err_code == NRF_ERROR_BUSY)
+             {
+                // Another link is still pairing. Retry in nrf_ble_lesc_request_handler().
+                m_keypair_regen_pending = true;
+             }
+             else if (err_code != NRF_SUCCESS)
              {
                 m_ble_lesc_internal_error = true;
              }
@@ -513,6 +772,10 @@ void nrf_ble_lesc_on_ble_evt(ble_evt_t const * p_ble_evt)
         default:
             break;
     }
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+    lesc_job_submit();
+#endif
 }
 
 
@@ -76,6 +76,9 @@ ret_code_t nrf_ble_lesc_init(void);
  *
  * @details This function generates an ECC key pair, which consists of a private and public key. Keys are
  *          generated using ECC and are used to create LESC DH key during authentication procedures.
+ *          If @ref NRF_BLE_LESC_KEYPAIR_POOL_SIZE is non-zero and a spare key pair has already been
+ *          generated by @ref nrf_ble_lesc_request_handler, that key pair is used instead, and no
+ *          ECC operation is performed.
  *
  * @retval NRF_SUCCESS    If the operation was successful.
  * @retval NRF_ERROR_BUSY If any pending request needs to be processed by @ref nrf_ble_lesc_request_handler.
@@ -136,6 +139,12 @@ void nrf_ble_lesc_peer_oob_data_handler_set(nrf_ble_lesc_peer_oob_data_handler h
  * @note This function should be called systematically (e.g. in the main application loop) to handle
  *       any pending DH key requests.
  *
+ * @note If @ref NRF_BLE_LESC_MAX_OPS_PER_CALL is non-zero, at most that many ECC operations are
+ *       performed per call, and the links are served in turns. When work is left, the SoftDevice
+ *       event interrupt is pended so that the main loop does not sleep before calling this function
+ *       again. Spare key pairs (see @ref NRF_BLE_LESC_KEYPAIR_POOL_SIZE) are generated one per call,
+ *       and only in calls that had nothing else to do.
+ *
  * @retval NRF_SUCCESS        If the operation was successful.
  * @retval NRF_ERROR_INTERNAL If the LESC module encountered an internal error. The only way to recover from
  *                            this type of error is to reset the application.
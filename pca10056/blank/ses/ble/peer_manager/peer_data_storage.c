@@ -48,6 +48,9 @@
 #include "peer_manager_internal.h"
 #include "peer_id.h"
 #include "fds.h"
+#if PM_BULK_DELETE_ENABLED
+#include "nrf_atflags.h"
+#endif
 
 #define NRF_LOG_MODULE_NAME peer_manager_pds
 #if PM_LOG_ENABLED
@@ -89,6 +92,39 @@ static volatile bool m_peer_delete_deferred = false;
 // A token used for Flash Data Storage searches.
 static fds_find_token_t m_fds_ftok;
 
+#if PM_BULK_DELETE_ENABLED
+// States of a bulk delete started by pds_peers_free().
+typedef enum
+{
+    BULK_DELETE_IDLE,    // No bulk delete is in progress.
+    BULK_DELETE_FILES,   // The files of the deleted peers are being deleted.
+    BULK_DELETE_GC,      // All files are deleted, garbage collection is waiting for room in the FDS queue.
+    BULK_DELETE_GC_BUSY, // Garbage collection is running.
+} bulk_delete_state_t;
+
+static bulk_delete_state_t m_bulk_delete_state;
+static bool                m_bulk_delete_erased;  // Whether any file delete was queued by the bulk delete.
+
+// Peers whose file delete has been queued by the bulk delete.
+NRF_ATFLAGS_DEF(m_bulk_delete_queued, PM_PEER_ID_N_AVAILABLE_IDS);
+#endif
+
+#if (PM_PEER_DATA_CACHE_ENABLED == 1)
+// An entry of the peer data cache.
+typedef struct
+{
+    fds_record_desc_t desc;     // Descriptor of the record. Only valid if found is true.
+    uint32_t          last_use; // Value of m_cache_seq when the entry was last used. 0 if the entry is free.
+    pm_peer_id_t      peer_id;  // Peer the record belongs to.
+    uint8_t           data_id;  // Peer data ID of the record.
+    bool              found;    // Whether the record exists in flash.
+} pds_cache_entry_t;
+
+// Flash descriptors of recently used records, so that they are not searched for again.
+static pds_cache_entry_t m_cache[PM_PEER_DATA_CACHE_SIZE];
+static uint32_t          m_cache_seq;
+#endif
+
 
 // Function for dispatching events to all registered event handlers.
 static void pds_evt_send(pm_evt_t * p_event)
@@ -181,6 +217,139 @@ static void send_unexpected_error(pm_peer_id_t peer_id, ret_code_t err_code)
 }
 
 
+#if PM_BULK_DELETE_ENABLED
+// Function for ending a bulk delete and sending its completion event.
+static void bulk_delete_end(pm_evt_id_t evt_id, ret_code_t err_code)
+{
+    pm_evt_t pds_evt;
+
+    m_bulk_delete_state = BULK_DELETE_IDLE;
+    memset(m_bulk_delete_queued, 0x00, sizeof(m_bulk_delete_queued));
+
+    // Peers deleted during garbage collection, or left after a failure, are deleted one at a time.
+    m_peer_delete_deferred = (peer_id_get_next_deleted(PM_PEER_ID_INVALID) != PM_PEER_ID_INVALID);
+
+    memset(&pds_evt, 0x00, sizeof(pm_evt_t));
+    pds_evt.evt_id  = evt_id;
+    pds_evt.peer_id = PM_PEER_ID_INVALID;
+    pds_evt.params.peers_delete_failed_evt.error = err_code;
+
+    pds_evt_send(&pds_evt);
+}
+
+
+// Function for deleting the files of all deleted peers.
+// The file deletes are queued in FDS back-to-back, and garbage collection is run once they are done.
+static void bulk_delete_process(void)
+{
+    ret_code_t        ret;
+    pm_peer_id_t      peer_id;
+    fds_record_desc_t desc;
+    fds_find_token_t  ftok;
+
+    m_peer_delete_deferred = false;
+
+    if (m_bulk_delete_state == BULK_DELETE_FILES)
+    {
+        peer_id = peer_id_get_next_deleted(PM_PEER_ID_INVALID);
+
+        while (peer_id != PM_PEER_ID_INVALID)
+        {
+            if (!nrf_atflags_get(m_bulk_delete_queued, peer_id))
+            {
+                memset(&ftok, 0x00, sizeof(fds_find_token_t));
+
+                if (fds_record_find_in_file(peer_id_to_file_id(peer_id), &desc, &ftok)
+                    == FDS_ERR_NOT_FOUND)
+                {
+                    peer_id_free(peer_id);
+                }
+                else
+                {
+                    ret = fds_file_delete(peer_id_to_file_id(peer_id));
+
+                    if (ret == FDS_ERR_NO_SPACE_IN_QUEUES)
+                    {
+                        // Continue when FDS has completed some of the queued operations.
+                        m_peer_delete_deferred = true;
+                        return;
+                    }
+                    else if (ret != NRF_SUCCESS)
+                    {
+                        NRF_LOG_ERROR("Could not delete peer data. fds_file_delete() returned 0x%x for peer_id: %d",
+                                      ret,
+                                      peer_id);
+                        bulk_delete_end(PM_EVT_PEERS_DELETE_FAILED, ret);
+                        return;
+                    }
+
+                    nrf_atflags_set(m_bulk_delete_queued, peer_id);
+                    m_bulk_delete_erased = true;
+                }
+            }
+
+            peer_id = peer_id_get_next_deleted(peer_id);
+        }
+
+        if (peer_id_get_next_deleted(PM_PEER_ID_INVALID) != PM_PEER_ID_INVALID)
+        {
+            // Wait for the queued file deletes to complete.
+            return;
+        }
+
+        if (!m_bulk_delete_erased)
+        {
+            // Nothing was written to flash, so there is nothing to garbage collect.
+            bulk_delete_end(PM_EVT_PEERS_DELETE_SUCCEEDED, NRF_SUCCESS);
+            return;
+        }
+
+        m_bulk_delete_state = BULK_DELETE_GC;
+    }
+
+    if (m_bulk_delete_state == BULK_DELETE_GC)
+    {
+        ret = fds_gc();
+
+        if (ret == NRF_SUCCESS)
+        {
+            m_bulk_delete_state = BULK_DELETE_GC_BUSY;
+        }
+        else if (ret == FDS_ERR_NO_SPACE_IN_QUEUES)
+        {
+            m_peer_delete_deferred = true;
+        }
+        else
+        {
+            // The peers are deleted. The space is reclaimed by the next garbage collection.
+            NRF_LOG_WARNING("Could not start garbage collection after deleting peers. fds_gc() returned 0x%x.",
+                            ret);
+            bulk_delete_end(PM_EVT_PEERS_DELETE_SUCCEEDED, NRF_SUCCESS);
+        }
+    }
+}
+
+
+// Function for handling the deletion of a peer's file during a bulk delete.
+static void bulk_delete_file_deleted(pm_peer_id_t peer_id, ret_code_t result)
+{
+    if (result != NRF_SUCCESS)
+    {
+        bulk_delete_end(PM_EVT_PEERS_DELETE_FAILED, result);
+    }
+    else if (peer_id_is_deleted(peer_id))
+    {
+        // A peer whose file was already being deleted when the bulk delete started can see its
+        // file deleted twice. Only the first one frees the peer ID.
+        nrf_atflags_clear(m_bulk_delete_queued, peer_id);
+        peer_id_free(peer_id);
+    }
+
+    m_peer_delete_deferred = true; // Trigger remaining deletes.
+}
+#endif // PM_BULK_DELETE_ENABLED
+
+
 // Function for deleting all data beloning to a peer.
 // These operations will be sent to FDS one at a time.
 static void peer_data_delete_process()
@@ -191,6 +360,14 @@ static void peer_data_delete_process()
     fds_record_desc_t desc;
     fds_find_token_t  ftok;
 
+#if PM_BULK_DELETE_ENABLED
+    if (m_bulk_delete_state != BULK_DELETE_IDLE)
+    {
+        bulk_delete_process();
+        return;
+    }
+#endif
+
     m_peer_delete_deferred = false;
 
     memset(&ftok, 0x00, sizeof(fds_find_token_t));
@@ -224,6 +401,116 @@ static void peer_data_delete_process()
 }
 
 
+#if (PM_PEER_DATA_CACHE_ENABLED == 1)
+// Function for finding the cache entry of a record, or NULL if it is not cached.
+static pds_cache_entry_t * cache_find(pm_peer_id_t peer_id, pm_peer_data_id_t data_id)
+{
+    for (uint32_t i = 0; i < PM_PEER_DATA_CACHE_SIZE; i++)
+    {
+        if (   (m_cache[i].last_use != 0)
+            && (m_cache[i].peer_id  == peer_id)
+            && (m_cache[i].data_id  == data_id))
+        {
+            return &m_cache[i];
+        }
+    }
+    return NULL;
+}
+
+
+// Function for caching the descriptor of a record, or that the record does not exist if p_desc is NULL.
+// The least recently used entry is replaced if the record is not cached already.
+static void cache_store(pm_peer_id_t              peer_id,
+                        pm_peer_data_id_t         data_id,
+                        fds_record_desc_t const * p_desc)
+{
+    pds_cache_entry_t * p_entry = cache_find(peer_id, data_id);
+
+    if (p_entry == NULL)
+    {
+        p_entry = &m_cache[0];
+        for (uint32_t i = 1; (i < PM_PEER_DATA_CACHE_SIZE) && (p_entry->last_use != 0); i++)
+        {
+            if (m_cache[i].last_use < p_entry->last_use)
+            {
+                p_entry = &m_cache[i];
+            }
+        }
+        p_entry->peer_id = peer_id;
+        p_entry->data_id = (uint8_t)data_id;
+    }
+
+    p_entry->found    = (p_desc != NULL);
+    p_entry->last_use = ++m_cache_seq;
+    if (p_desc != NULL)
+    {
+        p_entry->desc = *p_desc;
+    }
+}
+
+
+// Function for removing a record from the cache. PM_PEER_DATA_ID_INVALID removes all records of the peer.
+static void cache_invalidate(pm_peer_id_t peer_id, pm_peer_data_id_t data_id)
+{
+    for (uint32_t i = 0; i < PM_PEER_DATA_CACHE_SIZE; i++)
+    {
+        if (   (m_cache[i].peer_id == peer_id)
+            && ((data_id == PM_PEER_DATA_ID_INVALID) || (m_cache[i].data_id == data_id)))
+        {
+            m_cache[i].last_use = 0;
+        }
+    }
+}
+
+
+// Function for keeping the cache in line with the result of an FDS operation.
+// Updates through this module cache the descriptor of the new record when they are queued, so it
+// is only dropped if the operation failed or the record was written by someone else.
+static void cache_on_fds_evt(fds_evt_t const * const p_fds_evt)
+{
+    pm_peer_id_t      peer_id = file_id_to_peer_id(p_fds_evt->write.file_id);
+    pm_peer_data_id_t data_id = record_key_to_peer_data_id(p_fds_evt->write.record_key);
+
+    switch (p_fds_evt->id)
+    {
+        case FDS_EVT_WRITE:
+        case FDS_EVT_UPDATE:
+        {
+            pds_cache_entry_t * p_entry = file_id_within_pm_range(p_fds_evt->write.file_id)
+                                        ? cache_find(peer_id, data_id) : NULL;
+
+            if (   (p_entry != NULL)
+                && (   (p_fds_evt->result != NRF_SUCCESS)
+                    || !p_entry->found
+                    || (p_entry->desc.record_id != p_fds_evt->write.record_id)))
+            {
+                p_entry->last_use = 0;
+            }
+            break;
+        }
+
+        case FDS_EVT_DEL_RECORD:
+            if (file_id_within_pm_range(p_fds_evt->del.file_id))
+            {
+                cache_invalidate(peer_id, data_id);
+            }
+            break;
+
+        case FDS_EVT_DEL_FILE:
+            if (file_id_within_pm_range(p_fds_evt->del.file_id))
+            {
+                cache_invalidate(file_id_to_peer_id(p_fds_evt->del.file_id), PM_PEER_DATA_ID_INVALID);
+            }
+            break;
+
+        default:
+            // No action.
+            break;
+    }
+}
+#endif // (PM_PEER_DATA_CACHE_ENABLED == 1)
+
+
 static ret_code_t peer_data_find(pm_peer_id_t              peer_id,
                                  pm_peer_data_id_t         data_id,
                                  fds_record_desc_t * const p_desc)
@@ -235,6 +522,21 @@ static ret_code_t peer_data_find(pm_peer_id_t              peer_id,
     NRF_PM_DEBUG_CHECK(peer_data_id_is_valid(data_id));
     NRF_PM_DEBUG_CHECK(p_desc != NULL);
 
+#if (PM_PEER_DATA_CACHE_ENABLED == 1)
+    pds_cache_entry_t * p_entry = cache_find(peer_id, data_id);
+
+    if (p_entry != NULL)
+    {
+        p_entry->last_use = ++m_cache_seq;
+        if (!p_entry->found)
+        {
+            return NRF_ERROR_NOT_FOUND;
+        }
+        *p_desc = p_entry->desc;
+        return NRF_SUCCESS;
+    }
+#endif
+
     memset(&ftok, 0x00, sizeof(fds_find_token_t));
 
     uint16_t file_id    = peer_id_to_file_id(peer_id);
@@ -242,6 +544,10 @@ static ret_code_t peer_data_find(pm_peer_id_t              peer_id,
 
     ret = fds_record_find(file_id, record_key, p_desc, &ftok);
 
+#if (PM_PEER_DATA_CACHE_ENABLED == 1)
+    cache_store(peer_id, data_id, (ret == NRF_SUCCESS) ? p_desc : NULL);
+#endif
+
     if (ret != NRF_SUCCESS)
     {
         return NRF_ERROR_NOT_FOUND;
@@ -283,6 +589,10 @@ static void fds_evt_handler(fds_evt_t const * const p_fds_evt)
         .peer_id = file_id_to_peer_id(p_fds_evt->write.file_id)
     };
 
+#if (PM_PEER_DATA_CACHE_ENABLED == 1)
+    cache_on_fds_evt(p_fds_evt);
+#endif
+
     switch (p_fds_evt->id)
     {
         case FDS_EVT_WRITE:
@@ -317,6 +627,15 @@ static void fds_evt_handler(fds_evt_t const * const p_fds_evt)
             if (    file_id_within_pm_range(p_fds_evt->del.file_id)
                 && (p_fds_evt->del.record_key == FDS_RECORD_KEY_DIRTY))
             {
+#if PM_BULK_DELETE_ENABLED
+                if (m_bulk_delete_state != BULK_DELETE_IDLE)
+                {
+                    // No event is sent for each peer, only when the bulk delete completes.
+                    bulk_delete_file_deleted(pds_evt.peer_id, p_fds_evt->result);
+                    break;
+                }
+#endif
+
                 if (p_fds_evt->result == NRF_SUCCESS)
                 {
                     pds_evt.evt_id = PM_EVT_PEER_DELETE_SUCCEEDED;
@@ -346,6 +665,14 @@ static void fds_evt_handler(fds_evt_t const * const p_fds_evt)
             }
             pds_evt.peer_id = PM_PEER_ID_INVALID;
             pds_evt_send(&pds_evt);
+
+#if PM_BULK_DELETE_ENABLED
+            if (m_bulk_delete_state == BULK_DELETE_GC_BUSY)
+            {
+                // A failed garbage collection is reported above. The peers are deleted regardless.
+                bulk_delete_end(PM_EVT_PEERS_DELETE_SUCCEEDED, NRF_SUCCESS);
+            }
+#endif
             break;
 
         default:
@@ -415,6 +742,25 @@ ret_code_t pds_peer_data_read(pm_peer_id_t                    peer_id,
     // Shouldn't fail, unless the record was deleted in the meanwhile or the CRC check has failed.
     ret = fds_record_open(&rec_desc, &rec_flash);
 
+#if (PM_PEER_DATA_CACHE_ENABLED == 1)
+    if (ret != NRF_SUCCESS)
+    {
+        // The cached descriptor may refer to a record that is still being written. Search the flash.
+        cache_invalidate(peer_id, data_id);
+        ret = peer_data_find(peer_id, data_id, &rec_desc);
+        if (ret == NRF_SUCCESS)
+        {
+            ret = fds_record_open(&rec_desc, &rec_flash);
+        }
+    }
+
+    if (ret == NRF_SUCCESS)
+    {
+        // Opening locates the record in flash, keep its address for the next read.
+        cache_store(peer_id, data_id, &rec_desc);
+    }
+#endif
+
     if (ret != NRF_SUCCESS)
     {
         return NRF_ERROR_NOT_FOUND;
@@ -537,6 +883,10 @@ ret_code_t pds_peer_data_store(pm_peer_id_t                 peer_id,
     switch (ret)
     {
         case NRF_SUCCESS:
+#if (PM_PEER_DATA_CACHE_ENABLED == 1)
+            // The descriptor now refers to the record being written.
+            cache_store(peer_id, p_peer_data->data_id, &rec_desc);
+#endif
             if (p_store_token != NULL)
             {
                 // Update the store token.
@@ -586,6 +936,9 @@ ret_code_t pds_peer_data_delete(pm_peer_id_t peer_id, pm_peer_data_id_t data_id)
     switch (ret)
     {
         case NRF_SUCCESS:
+#if (PM_PEER_DATA_CACHE_ENABLED == 1)
+            cache_invalidate(peer_id, data_id);
+#endif
             return NRF_SUCCESS;
 
         case FDS_ERR_NO_SPACE_IN_QUEUES:
@@ -621,6 +974,25 @@ ret_code_t pds_peer_id_free(pm_peer_id_t peer_id)
 }
 
 
+#if PM_BULK_DELETE_ENABLED
+ret_code_t pds_peers_free(pm_peer_id_t peer_id_to_keep)
+{
+    NRF_PM_DEBUG_CHECK(m_module_initialized);
+    VERIFY_FALSE((m_bulk_delete_state != BULK_DELETE_IDLE), NRF_ERROR_BUSY);
+
+    // Mark all peers as deleted in one pass, before any flash operation is started.
+    peer_id_delete_all(peer_id_to_keep);
+
+    m_bulk_delete_state  = BULK_DELETE_FILES;
+    m_bulk_delete_erased = false;
+
+    bulk_delete_process();
+
+    return NRF_SUCCESS;
+}
+#endif
+
+
 bool pds_peer_id_is_allocated(pm_peer_id_t peer_id)
 {
     NRF_PM_DEBUG_CHECK(m_module_initialized);
@@ -649,6 +1021,13 @@ pm_peer_id_t pds_next_deleted_peer_id_get(pm_peer_id_t prev_peer_id)
 }
 
 
+uint32_t pds_peer_ids_get(pm_peer_id_t * p_peer_ids, uint32_t max_ids)
+{
+    NRF_PM_DEBUG_CHECK(m_module_initialized);
+    return peer_id_used_ids_get(p_peer_ids, max_ids);
+}
+
+
 uint32_t pds_peer_count_get(void)
 {
     NRF_PM_DEBUG_CHECK(m_module_initialized);
@@ -181,6 +181,24 @@ pm_peer_id_t pds_peer_id_allocate(void);
 ret_code_t pds_peer_id_free(pm_peer_id_t peer_id);
 
 
+/**@brief Function for freeing the IDs of all peers and deleting all data associated with them in
+ *        flash, as a single operation.
+ *
+ * @details All peers are marked as deleted at once. The deletion of their files is queued in Flash
+ *          Data Storage back-to-back, and garbage collection is run once all files are deleted.
+ *          Instead of an event for each peer, a single @ref PM_EVT_PEERS_DELETE_SUCCEEDED or @ref
+ *          PM_EVT_PEERS_DELETE_FAILED event is sent. It can be sent before this function returns.
+ *
+ * @note Requires @ref PM_BULK_DELETE_ENABLED.
+ *
+ * @param[in]  peer_id_to_keep  A peer that is not deleted, or @ref PM_PEER_ID_INVALID to delete all.
+ *
+ * @retval NRF_SUCCESS     The operation was initiated successfully.
+ * @retval NRF_ERROR_BUSY  A previous operation has not completed yet.
+ */
+ret_code_t pds_peers_free(pm_peer_id_t peer_id_to_keep);
+
+
 /**@brief Function for finding out whether a peer ID is in use.
  *
  * @param[in]  peer_id  The peer ID to inquire about.
@@ -231,6 +249,16 @@ pm_peer_id_t pds_next_peer_id_get(pm_peer_id_t prev_peer_id);
 pm_peer_id_t pds_next_deleted_peer_id_get(pm_peer_id_t prev_peer_id);
 
 
+/**@brief Function for getting all peer IDs not pending deletion, in one call.
+ *
+ * @param[out] p_peer_ids  Array to write the peer IDs to, in increasing order.
+ * @param[in]  max_ids     Number of elements in @p p_peer_ids.
+ *
+ * @return  The number of peer IDs written, at most @p max_ids.
+ */
+uint32_t pds_peer_ids_get(pm_peer_id_t * p_peer_ids, uint32_t max_ids);
+
+
 /**@brief Function for querying the number of valid peer IDs available. I.E the number of peers
  *        in persistent storage.
  *
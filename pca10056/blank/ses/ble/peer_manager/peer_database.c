@@ -46,6 +46,13 @@
 #include "peer_manager_internal.h"
 #include "peer_data_storage.h"
 #include "pm_buffer.h"
+#include "id_manager.h"
+#if PM_DEFERRED_STORE_ENABLED
+#include "app_timer.h"
+#if NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+#include "nrf_pwr_mgmt.h"
+#endif
+#endif
 
 #define NRF_LOG_MODULE_NAME peer_manager_pdb
 #if PM_LOG_ENABLED
@@ -82,10 +89,11 @@ do
 // Peer Database event handlers in other Peer Manager submodules.
 extern void pm_pdb_evt_handler(pm_evt_t * p_event);
 extern void sm_pdb_evt_handler(pm_evt_t * p_event);
-#if !defined(PM_SERVICE_CHANGED_ENABLED) || (PM_SERVICE_CHANGED_ENABLED == 1)
+#if !defined(PM_SERVICE_CHANGED_ENABLED) || (PM_SERVICE_CHANGED_ENABLED == 1) || PM_SYS_ATTR_CACHE_ENABLED
 extern void gscm_pdb_evt_handler(pm_evt_t * p_event);
 #endif
 extern void gcm_pdb_evt_handler(pm_evt_t * p_event);
+extern void im_pdb_evt_handler(pm_evt_t * p_event);
 
 // Peer Database events' handlers.
 // The number of elements in this array is PDB_EVENT_HANDLERS_CNT.
@@ -93,10 +101,11 @@ static pm_evt_handler_internal_t const m_evt_handlers[] =
 {
     pm_pdb_evt_handler,
     sm_pdb_evt_handler,
-#if !defined(PM_SERVICE_CHANGED_ENABLED) || (PM_SERVICE_CHANGED_ENABLED == 1)
+#if !defined(PM_SERVICE_CHANGED_ENABLED) || (PM_SERVICE_CHANGED_ENABLED == 1) || PM_SYS_ATTR_CACHE_ENABLED
     gscm_pdb_evt_handler,
 #endif
     gcm_pdb_evt_handler,
+    im_pdb_evt_handler,
 };
 
 
@@ -112,6 +121,7 @@ typedef struct
     uint8_t             buffer_block_id;       /**< The index of the first (or only) buffer block containing peer data. */
     uint8_t             store_flash_full : 1;  /**< Flag indicating that the buffer was attempted written to flash, but a flash full error was returned and the operation should be retried after room has been made. */
     uint8_t             store_busy       : 1;  /**< Flag indicating that the buffer was attempted written to flash, but a busy error was returned and the operation should be retried. */
+    uint8_t             store_deferred   : 1;  /**< Flag indicating that store has been called for the buffer, but the write to flash is held back so that later updates can be merged into it. */
 } pdb_buffer_record_t;
 
 
@@ -119,6 +129,16 @@ static bool                m_module_initialized;
 static pm_buffer_t         m_write_buffer;                                 /**< The internal states of the write buffer. */
 static pdb_buffer_record_t m_write_buffer_records[PM_FLASH_BUFFERS];       /**< The available write buffer records. */
 static bool                m_pending_store = false;                        /**< Whether there are any pending (Not yet successfully requested in Peer Data Storage) store operations. This flag is for convenience only. The real bookkeeping is in the records (@ref m_write_buffer_records). */
+NRF_MEM_TELEMETRY_SOURCE_DEF(m_write_buffer, "pdb_write_buffer", &m_write_buffer,
+                             NRF_MEM_TELEMETRY_UNIT_ELEMENTS,
+                             pm_buffer_mem_telemetry_usage_get, NULL);
+#if PM_DEFERRED_STORE_ENABLED
+APP_TIMER_DEF(m_deferred_store_timer);                                     /**< Timer bounding how long deferred data is held in RAM. */
+static bool                m_deferred_timer_running;                       /**< Whether @ref m_deferred_store_timer has been started. */
+#if NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+static bool                m_shutdown_pending;                             /**< Whether the shutdown procedure is waiting for this module to finish writing to flash. */
+#endif
+#endif
 
 
 
@@ -133,6 +153,7 @@ static void write_buffer_record_invalidate(pdb_buffer_record_t * p_record)
     p_record->buffer_block_id  = PM_BUFFER_INVALID_ID;
     p_record->store_busy       = false;
     p_record->store_flash_full = false;
+    p_record->store_deferred   = false;
     p_record->n_bufs           = 0;
     p_record->store_token      = PM_STORE_TOKEN_INVALID;
 }
@@ -224,10 +245,9 @@ static pdb_buffer_record_t * write_buffer_record_find_unused(void)
  */
 static void write_buffer_record_release(pdb_buffer_record_t * p_write_buffer_record)
 {
-    for (uint32_t i = 0; i < p_write_buffer_record->n_bufs; i++)
-    {
-        pm_buffer_release(&m_write_buffer, p_write_buffer_record->buffer_block_id + i);
-    }
+    pm_buffer_run_release(&m_write_buffer,
+                          p_write_buffer_record->buffer_block_id,
+                          p_write_buffer_record->n_bufs);
 
     write_buffer_record_invalidate(p_write_buffer_record);
 }
@@ -357,6 +377,8 @@ ret_code_t write_buf_store(pdb_buffer_record_t * p_write_buffer_record)
                                      p_write_buffer_record->n_bufs);
     write_buf_length_words_set(&peer_data);
 
+    p_write_buffer_record->store_deferred = false;
+
     err_code = pds_peer_data_store(p_write_buffer_record->peer_id,
                                    &peer_data,
                                    &p_write_buffer_record->store_token);
@@ -474,6 +496,171 @@ static void reattempt_previous_operations(bool retry_flash_full)
 }
 
 
+#if PM_DEFERRED_STORE_ENABLED
+/**@brief Function for checking whether a store operation on a piece of data can be deferred.
+ *
+ * @details Only the local GATT database is deferred. It is rewritten in full on every update, and
+ *          losing the latest version only means the CCCDs are restored to an earlier state.
+ *
+ * @param[in]  data_id  The data ID to check.
+ *
+ * @return  Whether store operations on @p data_id are deferred.
+ */
+static bool store_is_deferrable(pm_peer_data_id_t data_id)
+{
+    return (data_id == PM_PEER_DATA_ID_GATT_LOCAL);
+}
+
+
+/**@brief Function for writing held data to persistent storage.
+ *
+ * @param[in]  peer_id  The peer to write data for, or @ref PM_PEER_ID_INVALID for all peers.
+ */
+static void deferred_store_flush(pm_peer_id_t peer_id)
+{
+    bool deferred_left = false;
+
+    for (uint32_t i = 0; i < PM_FLASH_BUFFERS; i++)
+    {
+        pdb_buffer_record_t * p_record = &m_write_buffer_records[i];
+
+        if (!p_record->store_deferred)
+        {
+            continue;
+        }
+
+        if ((peer_id != PM_PEER_ID_INVALID) && (p_record->peer_id != peer_id))
+        {
+            deferred_left = true;
+            continue;
+        }
+
+        NRF_LOG_DEBUG("Writing deferred data. peer_id: %d, data_id: %d",
+                      p_record->peer_id,
+                      p_record->data_id);
+
+        // Errors are reported through events.
+        UNUSED_RETURN_VALUE(write_buf_store_in_event(p_record));
+    }
+
+    if (!deferred_left && m_deferred_timer_running)
+    {
+        ret_code_t err_code = app_timer_stop(m_deferred_store_timer);
+        UNUSED_VARIABLE(err_code); // The timer has either been stopped, or has already expired.
+        m_deferred_timer_running = false;
+    }
+}
+
+
+/**@brief Function for holding back the write of a buffer so that later updates can be merged into
+ *        it.
+ *
+ * @param[in]  p_write_buffer_record  The write buffer record to defer.
+ *
+ * @retval NRF_SUCCESS  The write was deferred, or it was started if the timer could not be used.
+ * @return Any error code returned by @ref write_buf_store.
+ */
+static ret_code_t deferred_store_start(pdb_buffer_record_t * p_write_buffer_record)
+{
+    p_write_buffer_record->store_deferred = true;
+
+    if (!m_deferred_timer_running)
+    {
+        ret_code_t err_code = app_timer_start(m_deferred_store_timer,
+                                              APP_TIMER_TICKS(PM_DEFERRED_STORE_DELAY_MS),
+                                              NULL);
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_WARNING("app_timer_start() returned %s, writing data immediately.",
+                            nrf_strerror_get(err_code));
+            return write_buf_store(p_write_buffer_record);
+        }
+
+        m_deferred_timer_running = true;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for handling the expiry of @ref m_deferred_store_timer.
+ *
+ * @param[in]  p_context  Unused.
+ */
+static void deferred_store_timeout_handler(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    m_deferred_timer_running = false;
+    deferred_store_flush(PM_PEER_ID_INVALID);
+}
+
+
+#if NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+/**@brief Function for checking whether any write buffers are still on their way to flash.
+ *
+ * @details Writes that failed because flash is full are not waited for, since they might never
+ *          complete.
+ *
+ * @return  Whether any writes are in progress.
+ */
+static bool store_in_progress(void)
+{
+    for (uint32_t i = 0; i < PM_FLASH_BUFFERS; i++)
+    {
+        if (   m_write_buffer_records[i].store_busy
+            || m_write_buffer_records[i].store_deferred
+            || (m_write_buffer_records[i].store_token != PM_STORE_TOKEN_INVALID))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**@brief Function for continuing a shutdown that was blocked by @ref pdb_shutdown_handler, once
+ *        all writes have completed.
+ */
+static void shutdown_continue_check(void)
+{
+    if (m_shutdown_pending && !store_in_progress())
+    {
+        m_shutdown_pending = false;
+        nrf_pwr_mgmt_shutdown(NRF_PWR_MGMT_SHUTDOWN_CONTINUE);
+    }
+}
+
+
+/**@brief Handler for shutdown preparation events from the Power Management module.
+ *
+ * @details Writes all held data to flash, and blocks the shutdown until the writes have completed.
+ *
+ * @param[in]  event  The shutdown type.
+ *
+ * @return  Whether the module is ready for shutdown.
+ */
+static bool pdb_shutdown_handler(nrf_pwr_mgmt_evt_t event)
+{
+    UNUSED_PARAMETER(event);
+
+    if (!m_module_initialized)
+    {
+        return true;
+    }
+
+    deferred_store_flush(PM_PEER_ID_INVALID);
+
+    m_shutdown_pending = store_in_progress();
+
+    return !m_shutdown_pending;
+}
+
+NRF_PWR_MGMT_HANDLER_REGISTER(pdb_shutdown_handler, 0);
+#endif // NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+#endif // PM_DEFERRED_STORE_ENABLED
+
+
 /**@brief Function for handling events from the Peer Data Storage module.
  *        This function is extern in Peer Data Storage.
  *
@@ -525,6 +712,28 @@ void pdb_pds_evt_handler(pm_evt_t * p_event)
     }
 
     reattempt_previous_operations(retry_flash_full);
+
+#if PM_DEFERRED_STORE_ENABLED && NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+    shutdown_continue_check();
+#endif
+}
+
+
+void pdb_ble_evt_handler(ble_evt_t const * p_ble_evt)
+{
+#if PM_DEFERRED_STORE_ENABLED
+    if (p_ble_evt->header.evt_id == BLE_GAP_EVT_DISCONNECTED)
+    {
+        pm_peer_id_t peer_id = im_peer_id_get_by_conn_handle(p_ble_evt->evt.gap_evt.conn_handle);
+
+        if (peer_id != PM_PEER_ID_INVALID)
+        {
+            deferred_store_flush(peer_id);
+        }
+    }
+#else
+    UNUSED_PARAMETER(p_ble_evt);
+#endif
 }
 
 
@@ -544,18 +753,34 @@ ret_code_t pdb_init()
         return NRF_ERROR_INTERNAL;
     }
 
+#if PM_DEFERRED_STORE_ENABLED
+    err_code = app_timer_create(&m_deferred_store_timer,
+                                APP_TIMER_MODE_SINGLE_SHOT,
+                                deferred_store_timeout_handler);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("app_timer_create() returned %s.", nrf_strerror_get(err_code));
+        return NRF_ERROR_INTERNAL;
+    }
+#endif
+
     m_module_initialized = true;
 
     return NRF_SUCCESS;
 }
 
 
-ret_code_t pdb_peer_free(pm_peer_id_t peer_id)
+/**@brief Function for releasing all write buffers of a peer.
+ *
+ * @param[in]  peer_id  The peer whose write buffers to release.
+ *
+ * @retval NRF_SUCCESS         The write buffers were released.
+ * @retval NRF_ERROR_INTERNAL  A write buffer could not be released.
+ */
+static ret_code_t peer_write_bufs_release(pm_peer_id_t peer_id)
 {
     ret_code_t err_code;
 
-    NRF_PM_DEBUG_CHECK(m_module_initialized);
-
     uint32_t index = 0;
     pdb_buffer_record_t * p_record = write_buffer_record_find_next(peer_id, &index);
 
@@ -578,6 +803,19 @@ ret_code_t pdb_peer_free(pm_peer_id_t peer_id)
         p_record = write_buffer_record_find_next(peer_id, &index);
     }
 
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t pdb_peer_free(pm_peer_id_t peer_id)
+{
+    ret_code_t err_code;
+
+    NRF_PM_DEBUG_CHECK(m_module_initialized);
+
+    err_code = peer_write_bufs_release(peer_id);
+    VERIFY_SUCCESS(err_code);
+
     err_code = pds_peer_id_free(peer_id);
 
     if ((err_code == NRF_SUCCESS) || (err_code == NRF_ERROR_INVALID_PARAM))
@@ -595,6 +833,42 @@ ret_code_t pdb_peer_free(pm_peer_id_t peer_id)
 }
 
 
+#if PM_BULK_DELETE_ENABLED
+ret_code_t pdb_peers_free(pm_peer_id_t peer_id_to_keep)
+{
+    ret_code_t   err_code;
+    pm_peer_id_t peer_id;
+
+    NRF_PM_DEBUG_CHECK(m_module_initialized);
+
+    peer_id = pds_next_peer_id_get(PM_PEER_ID_INVALID);
+
+    while (peer_id != PM_PEER_ID_INVALID)
+    {
+        if (peer_id != peer_id_to_keep)
+        {
+            err_code = peer_write_bufs_release(peer_id);
+            VERIFY_SUCCESS(err_code);
+        }
+        peer_id = pds_next_peer_id_get(peer_id);
+    }
+
+    err_code = pds_peers_free(peer_id_to_keep);
+
+    if ((err_code == NRF_SUCCESS) || (err_code == NRF_ERROR_BUSY))
+    {
+        return err_code;
+    }
+    else
+    {
+        NRF_LOG_ERROR("Peers were not properly released. pds_peers_free() returned %s.",
+                      nrf_strerror_get(err_code));
+        return NRF_ERROR_INTERNAL;
+    }
+}
+#endif
+
+
 ret_code_t pdb_peer_data_ptr_get(pm_peer_id_t                 peer_id,
                                  pm_peer_data_id_t            data_id,
                                  pm_peer_data_flash_t * const p_peer_data)
@@ -629,12 +903,34 @@ ret_code_t pdb_write_buf_get(pm_peer_id_t      peer_id,
 
     p_write_buffer_record = write_buffer_record_find(peer_id, data_id);
 
+#if PM_DEFERRED_STORE_ENABLED
+    if ((p_write_buffer_record != NULL) && p_write_buffer_record->store_deferred)
+    {
+        if (n_bufs <= p_write_buffer_record->n_bufs)
+        {
+            // Merge the update into the held buffer. The caller rewrites the data in full.
+            n_bufs     = p_write_buffer_record->n_bufs;
+            new_record = true;
+        }
+        else
+        {
+            // The held buffer is too small, so write it and continue with a new one.
+            UNUSED_RETURN_VALUE(write_buf_store_in_event(p_write_buffer_record));
+            p_write_buffer_record = write_buffer_record_find(peer_id, data_id);
+        }
+    }
+#endif
+
     if (p_write_buffer_record == NULL)
     {
         // No buffer exists.
         write_buffer_record_acquire(&p_write_buffer_record, peer_id, data_id);
         if (p_write_buffer_record == NULL)
         {
+#if PM_DEFERRED_STORE_ENABLED
+            // Free up the buffers held by deferred writes.
+            deferred_store_flush(PM_PEER_ID_INVALID);
+#endif
             return NRF_ERROR_BUSY;
         }
     }
@@ -651,6 +947,9 @@ ret_code_t pdb_write_buf_get(pm_peer_id_t      peer_id,
         if (p_write_buffer_record->buffer_block_id == PM_BUFFER_INVALID_ID)
         {
             write_buffer_record_invalidate(p_write_buffer_record);
+#if PM_DEFERRED_STORE_ENABLED
+            deferred_store_flush(PM_PEER_ID_INVALID);
+#endif
             return NRF_ERROR_BUSY;
         }
 
@@ -719,6 +1018,14 @@ ret_code_t pdb_write_buf_store(pm_peer_id_t      peer_id,
 
     p_write_buffer_record->peer_id = new_peer_id;
     p_write_buffer_record->data_id = data_id;
+
+#if PM_DEFERRED_STORE_ENABLED
+    if (store_is_deferrable(data_id))
+    {
+        return deferred_store_start(p_write_buffer_record);
+    }
+#endif
+
     return write_buf_store(p_write_buffer_record);
 }
 
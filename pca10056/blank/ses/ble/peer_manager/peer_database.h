@@ -41,6 +41,7 @@
 #define PEER_DATABASE_H__
 
 #include <stdint.h>
+#include "ble.h"
 #include "peer_manager_types.h"
 #include "peer_manager_internal.h"
 #include "sdk_errors.h"
@@ -89,6 +90,19 @@ ret_code_t pdb_init(void);
  */
 ret_code_t pdb_peer_free(pm_peer_id_t peer_id);
 
+/**@brief Function for freeing the persistent bond storage of all peers as a single operation.
+ *
+ * @note This function will call @ref pdb_write_buf_release on the data for these peers.
+ * @note Requires @ref PM_BULK_DELETE_ENABLED.
+ *
+ * @param[in] peer_id_to_keep  A peer that is not freed, or @ref PM_PEER_ID_INVALID to free all.
+ *
+ * @retval NRF_SUCCESS         Peer IDs were released and clear operation was initiated successfully.
+ * @retval NRF_ERROR_BUSY      A previous operation has not completed yet.
+ * @retval NRF_ERROR_INTERNAL  An unexpected error happened.
+ */
+ret_code_t pdb_peers_free(pm_peer_id_t peer_id_to_keep);
+
 /**@brief Function for retrieving a pointer to peer data in flash (read-only).
  *
  * @note  Dereferencing this pointer is not the safest thing to do if interrupts are enabled,
@@ -168,6 +182,10 @@ ret_code_t pdb_write_buf_release(pm_peer_id_t peer_id, pm_peer_data_id_t data_id
  * @param[in]  new_peer_id  The ID to put in flash. This is usually the same as peer_id, but
  *                          must be valid, i.e. allocated (and smaller than @ref PM_PEER_ID_N_AVAILABLE_IDS).
  *
+ * @note When @ref PM_DEFERRED_STORE_ENABLED is set, the write of the local GATT database is held
+ *       back for up to @ref PM_DEFERRED_STORE_DELAY_MS. Until then, @ref pdb_write_buf_get gives
+ *       the same buffer again, even if fewer buffers are requested, so that updates are merged.
+ *
  * @retval NRF_SUCCESS              Data storing was successfully started.
  * @retval NRF_ERROR_STORAGE_FULL   No space available in persistent storage. Please clear some
  *                                  space, the operation will be reattempted after the next compress
@@ -180,6 +198,15 @@ ret_code_t pdb_write_buf_store(pm_peer_id_t      peer_id,
                                pm_peer_data_id_t data_id,
                                pm_peer_id_t      new_peer_id);
 
+/**@brief Function for handling BLE events.
+ *
+ * @details When @ref PM_DEFERRED_STORE_ENABLED is set, held data for a peer is written to
+ *          persistent storage when the peer disconnects.
+ *
+ * @param[in]  p_ble_evt  The BLE event.
+ */
+void pdb_ble_evt_handler(ble_evt_t const * p_ble_evt);
+
 /** @}
  * @endcond
  */
@@ -46,6 +46,10 @@
 #include "sdk_errors.h"
 #include "peer_manager_types.h"
 #include "nrf_atflags.h"
+#include "nrf_atomic_bitset.h"
+
+
+#define PI_WORD_CNT  NRF_ATOMIC_BITSET_WORDS(PM_PEER_ID_N_AVAILABLE_IDS)  /**< Number of words in each bitmap. */
 
 
 typedef struct
@@ -147,36 +151,45 @@ bool peer_id_is_deleted(pm_peer_id_t peer_id)
 }
 
 
-pm_peer_id_t next_id_get(pm_peer_id_t prev_peer_id, nrf_atflags_t * p_peer_id_flags)
+/**@brief Function for finding the next peer ID whose flag is set, one word at a time.
+ *
+ * @param[in]  prev_peer_id     The previous peer ID, or @ref PM_PEER_ID_INVALID to start from the
+ *                              first peer ID.
+ * @param[in]  p_peer_id_flags  The flags to search.
+ *
+ * @return  The next peer ID whose flag is set, or @ref PM_PEER_ID_INVALID if there is none.
+ */
+static pm_peer_id_t next_id_get(pm_peer_id_t prev_peer_id, nrf_atflags_t const * p_peer_id_flags)
 {
-    pm_peer_id_t i = (prev_peer_id == PM_PEER_ID_INVALID) ? 0 : (prev_peer_id + 1);
-    for (; i < PM_PEER_ID_N_AVAILABLE_IDS; i++)
-    {
-        if (nrf_atflags_get(p_peer_id_flags, i))
-        {
-            return i;
-        }
-    }
+    uint32_t start   = (prev_peer_id == PM_PEER_ID_INVALID) ? 0 : (prev_peer_id + 1);
+    uint32_t peer_id = nrf_atomic_bitset_find_next(p_peer_id_flags, PI_WORD_CNT, start);
 
-    return PM_PEER_ID_INVALID;
+    return (peer_id < PM_PEER_ID_N_AVAILABLE_IDS) ? (pm_peer_id_t)peer_id : PM_PEER_ID_INVALID;
 }
 
 
 pm_peer_id_t peer_id_get_next_used(pm_peer_id_t peer_id)
 {
-    peer_id = next_id_get(peer_id, m_pi.used_peer_ids);
+    uint32_t start = (peer_id == PM_PEER_ID_INVALID) ? 0 : (peer_id + 1);
+    uint32_t mask  = UINT32_MAX << (start % 32);
 
-    while (peer_id != PM_PEER_ID_INVALID)
+    // Used peer IDs that are not marked for deletion, a word at a time.
+    for (uint32_t i = start / 32; i < PI_WORD_CNT; i++)
     {
-        if (!peer_id_is_deleted(peer_id))
+        uint32_t word = m_pi.used_peer_ids[i] & ~m_pi.deleted_peer_ids[i] & mask;
+
+        if (word != 0)
         {
-            return peer_id;
+            uint32_t next_peer_id = (i * 32) + nrf_atomic_bits_find_first(word);
+
+            return (next_peer_id < PM_PEER_ID_N_AVAILABLE_IDS) ? (pm_peer_id_t)next_peer_id
+                                                               : PM_PEER_ID_INVALID;
         }
 
-        peer_id = next_id_get(peer_id, m_pi.used_peer_ids);
+        mask = UINT32_MAX;
     }
 
-    return peer_id;
+    return PM_PEER_ID_INVALID;
 }
 
 
@@ -186,15 +199,54 @@ pm_peer_id_t peer_id_get_next_deleted(pm_peer_id_t prev_peer_id)
 }
 
 
-uint32_t peer_id_n_ids(void)
+uint32_t peer_id_used_ids_get(pm_peer_id_t * p_peer_ids, uint32_t max_ids)
 {
     uint32_t n_ids = 0;
 
-    for (pm_peer_id_t i = 0; i < PM_PEER_ID_N_AVAILABLE_IDS; i++)
+    for (uint32_t i = 0; (i < PI_WORD_CNT) && (n_ids < max_ids); i++)
     {
-        n_ids += nrf_atflags_get(m_pi.used_peer_ids, i);
+        uint32_t word = m_pi.used_peer_ids[i] & ~m_pi.deleted_peer_ids[i];
+
+        while ((word != 0) && (n_ids < max_ids))
+        {
+            uint32_t peer_id = (i * 32) + nrf_atomic_bits_find_first(word);
+
+            if (peer_id >= PM_PEER_ID_N_AVAILABLE_IDS)
+            {
+                return n_ids;
+            }
+
+            p_peer_ids[n_ids++] = (pm_peer_id_t)peer_id;
+
+            // Clear the lowest set bit.
+            word &= (word - 1);
+        }
     }
 
     return n_ids;
 }
+
+
+void peer_id_delete_all(pm_peer_id_t peer_id_to_keep)
+{
+    uint32_t used[PI_WORD_CNT];
+
+    for (uint32_t i = 0; i < PI_WORD_CNT; i++)
+    {
+        used[i] = m_pi.used_peer_ids[i];
+    }
+
+    if (peer_id_to_keep < PM_PEER_ID_N_AVAILABLE_IDS)
+    {
+        used[peer_id_to_keep / 32] &= ~(1UL << (peer_id_to_keep % 32));
+    }
+
+    nrf_atomic_bitset_fetch_or(m_pi.deleted_peer_ids, used, NULL, PI_WORD_CNT);
+}
+
+
+uint32_t peer_id_n_ids(void)
+{
+    return nrf_atomic_bitset_count(m_pi.used_peer_ids, PI_WORD_CNT);
+}
 #endif // NRF_MODULE_ENABLED(PEER_MANAGER)
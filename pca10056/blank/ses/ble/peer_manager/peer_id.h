@@ -148,6 +148,27 @@ pm_peer_id_t peer_id_get_next_used(pm_peer_id_t prev_peer_id);
 pm_peer_id_t peer_id_get_next_deleted(pm_peer_id_t prev_peer_id);
 
 
+/**@brief Function for getting all used peer IDs that are not marked for deletion, in one call.
+ *
+ * @details The bitmaps are read a word at a time, so this is faster than looping with
+ *          @ref peer_id_get_next_used.
+ *
+ * @param[out] p_peer_ids  Array to write the peer IDs to, in increasing order.
+ * @param[in]  max_ids     Number of elements in @p p_peer_ids.
+ *
+ * @return  The number of peer IDs written, at most @p max_ids.
+ */
+uint32_t peer_id_used_ids_get(pm_peer_id_t * p_peer_ids, uint32_t max_ids);
+
+
+/**@brief Function for marking all used peer IDs for deletion, except one.
+ *
+ * @param[in]  peer_id_to_keep  The peer ID to leave unmarked, or @ref PM_PEER_ID_INVALID to mark
+ *                              all of them.
+ */
+void peer_id_delete_all(pm_peer_id_t peer_id_to_keep);
+
+
 /**@brief Function for querying the number of valid peer IDs available. I.E the number of peers
  *        in persistent storage.
  *
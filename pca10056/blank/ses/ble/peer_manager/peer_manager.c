@@ -52,6 +52,14 @@
 #include "ble_conn_state.h"
 #include "peer_manager_internal.h"
 #include "nrf_sdh_ble.h"
+#if PM_RANK_INDEX_ENABLED
+#include "app_timer.h"
+#include "nrf_atflags.h"
+#include "nrf_atomic_bitset.h"
+#if NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+#include "nrf_pwr_mgmt.h"
+#endif
+#endif
 
 #define NRF_LOG_MODULE_NAME peer_manager
 #if PM_LOG_ENABLED
@@ -71,6 +79,10 @@ NRF_LOG_MODULE_REGISTER();
     #define PM_PEER_RANKS_ENABLED 1
 #endif
 
+#if PM_RANK_INDEX_ENABLED && (PM_PEER_RANKS_ENABLED == 0)
+#error "PM_RANK_INDEX_ENABLED requires PM_PEER_RANKS_ENABLED."
+#endif
+
 #define MODULE_INITIALIZED      (m_module_initialized)                  /**< Macro indicating whether the module has been initialized properly. */
 
 
@@ -84,6 +96,23 @@ static pm_evt_handler_t              m_evt_handlers[PM_MAX_REGISTRANTS];/**< The
 static uint8_t                       m_n_registrants;                   /**< The number of event handlers registered through @ref pm_register. */
 
 static ble_conn_state_user_flag_id_t m_flag_conn_excluded = BLE_CONN_STATE_USER_FLAG_INVALID;  /**< User flag indicating whether a connection is excluded from being handled by the Peer Manager. */
+#if PM_RANK_INDEX_ENABLED
+APP_TIMER_DEF(m_rank_store_timer);                                      /**< Timer bounding how long rank updates are held in RAM. */
+NRF_ATFLAGS_DEF(m_rank_dirty, PM_PEER_ID_N_AVAILABLE_IDS);              /**< Peers whose rank in RAM has not been written to flash. */
+static bool                          m_rank_index_built;                /**< Whether the rank index holds the ranks of all peers. */
+static bool                          m_rank_timer_running;              /**< Whether @ref m_rank_store_timer has been started. */
+static bool                          m_rank_storing;                    /**< Whether the dirty ranks are being written to flash. */
+#if NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+static bool                          m_rank_shutdown_pending;           /**< Whether the shutdown procedure is waiting for the ranks to be written. */
+#endif
+static pm_store_token_t              m_rank_store_token;                /**< The store token of the rank write in progress, or @ref PM_STORE_TOKEN_INVALID. */
+static pm_peer_id_t                  m_rank_store_peer;                 /**< The peer of the rank write in progress. */
+static pm_peer_id_t                  m_rank_head;                       /**< The highest ranked peer, or @ref PM_PEER_ID_INVALID. */
+static pm_peer_id_t                  m_rank_tail;                       /**< The lowest ranked peer, or @ref PM_PEER_ID_INVALID. */
+static pm_peer_id_t                  m_rank_higher[PM_PEER_ID_N_AVAILABLE_IDS]; /**< For each peer, the next higher ranked peer. */
+static pm_peer_id_t                  m_rank_lower[PM_PEER_ID_N_AVAILABLE_IDS];  /**< For each peer, the next lower ranked peer. */
+static uint32_t                      m_rank[PM_PEER_ID_N_AVAILABLE_IDS];        /**< The rank of each peer in the index. */
+#endif
 
 /**@brief Function for sending a Peer Manager event to all subscribers.
  *
@@ -119,6 +148,414 @@ static void rank_vars_update(void)
 #endif
 
 
+#if PM_RANK_INDEX_ENABLED
+/**@brief Function for checking whether a peer is in the rank index.
+ *
+ * @param[in]  peer_id  The peer to check.
+ */
+static bool rank_index_contains(pm_peer_id_t peer_id)
+{
+    return (peer_id == m_rank_head) || (m_rank_higher[peer_id] != PM_PEER_ID_INVALID);
+}
+
+
+/**@brief Function for taking a peer out of the rank index.
+ *
+ * @param[in]  peer_id  The peer to remove. Nothing is done if it is not in the index.
+ */
+static void rank_index_remove(pm_peer_id_t peer_id)
+{
+    pm_peer_id_t higher;
+    pm_peer_id_t lower;
+
+    if (!m_rank_index_built || (peer_id >= PM_PEER_ID_N_AVAILABLE_IDS) || !rank_index_contains(peer_id))
+    {
+        return;
+    }
+
+    higher = m_rank_higher[peer_id];
+    lower  = m_rank_lower[peer_id];
+
+    if (higher == PM_PEER_ID_INVALID)
+    {
+        m_rank_head = lower;
+    }
+    else
+    {
+        m_rank_lower[higher] = lower;
+    }
+
+    if (lower == PM_PEER_ID_INVALID)
+    {
+        m_rank_tail = higher;
+    }
+    else
+    {
+        m_rank_higher[lower] = higher;
+    }
+
+    m_rank_higher[peer_id] = PM_PEER_ID_INVALID;
+    m_rank_lower[peer_id]  = PM_PEER_ID_INVALID;
+}
+
+
+/**@brief Function for putting a peer in the rank index, below all peers with a higher rank.
+ *
+ * @details Walks from the highest ranked peer. This is only done when building the index, as the
+ *          peer ranked highest by @ref pm_peer_rank_highest goes first.
+ *
+ * @param[in]  peer_id  The peer to insert. It must not be in the index.
+ * @param[in]  rank     The rank of the peer.
+ */
+static void rank_index_insert(pm_peer_id_t peer_id, uint32_t rank)
+{
+    pm_peer_id_t lower  = m_rank_head;
+    pm_peer_id_t higher = PM_PEER_ID_INVALID;
+
+    // Ties are kept in peer ID order, like pm_peer_ranks_get() without the index.
+    while ((lower != PM_PEER_ID_INVALID) && (m_rank[lower] > rank))
+    {
+        higher = lower;
+        lower  = m_rank_lower[lower];
+    }
+
+    m_rank[peer_id]        = rank;
+    m_rank_higher[peer_id] = higher;
+    m_rank_lower[peer_id]  = lower;
+
+    if (higher == PM_PEER_ID_INVALID)
+    {
+        m_rank_head = peer_id;
+    }
+    else
+    {
+        m_rank_lower[higher] = peer_id;
+    }
+
+    if (lower == PM_PEER_ID_INVALID)
+    {
+        m_rank_tail = peer_id;
+    }
+    else
+    {
+        m_rank_higher[lower] = peer_id;
+    }
+}
+
+
+/**@brief Function for building the rank index from the ranks of the peers in flash.
+ *
+ * @details Ranks that have not been written to flash yet are taken from RAM.
+ *
+ * @retval NRF_SUCCESS         If the index was built.
+ * @retval NRF_ERROR_INTERNAL  If a rank could not be read.
+ */
+static ret_code_t rank_index_build(void)
+{
+    pm_peer_id_t peer_id;
+
+    m_rank_head = PM_PEER_ID_INVALID;
+    m_rank_tail = PM_PEER_ID_INVALID;
+    memset(m_rank_higher, 0xFF, sizeof(m_rank_higher));
+    memset(m_rank_lower,  0xFF, sizeof(m_rank_lower));
+
+    for (peer_id = 0; peer_id < PM_PEER_ID_N_AVAILABLE_IDS; peer_id++)
+    {
+        if (!pds_peer_id_is_allocated(peer_id) || pds_peer_id_is_deleted(peer_id))
+        {
+            nrf_atflags_clear(m_rank_dirty, peer_id);
+        }
+    }
+
+    peer_id = pds_next_peer_id_get(PM_PEER_ID_INVALID);
+
+    while (peer_id != PM_PEER_ID_INVALID)
+    {
+        ret_code_t     err_code  = NRF_SUCCESS;
+        uint32_t       peer_rank = m_rank[peer_id];
+        //lint -save -e65 -e64
+        uint32_t       length    = sizeof(peer_rank);
+        pm_peer_data_t peer_data = {.p_peer_rank = &peer_rank};
+        //lint -restore
+
+        if (!nrf_atflags_get(m_rank_dirty, peer_id))
+        {
+            err_code = pds_peer_data_read(peer_id, PM_PEER_DATA_ID_PEER_RANK, &peer_data, &length);
+        }
+
+        if (err_code == NRF_SUCCESS)
+        {
+            rank_index_insert(peer_id, peer_rank);
+        }
+        else if (err_code != NRF_ERROR_NOT_FOUND)
+        {
+            NRF_LOG_ERROR("Could not build the rank index. pds_peer_data_read() returned %s. "\
+                          "peer_id: %d",
+                          nrf_strerror_get(err_code),
+                          peer_id);
+            return NRF_ERROR_INTERNAL;
+        }
+
+        peer_id = pds_next_peer_id_get(peer_id);
+    }
+
+    m_rank_index_built = true;
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for starting @ref m_rank_store_timer, unless it is already running.
+ *
+ * @retval true   If the timer is running.
+ * @retval false  If the timer could not be started.
+ */
+static bool rank_store_timer_start(void)
+{
+    if (!m_rank_timer_running)
+    {
+        ret_code_t err_code = app_timer_start(m_rank_store_timer,
+                                              APP_TIMER_TICKS(PM_RANK_INDEX_STORE_DELAY_MS),
+                                              NULL);
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_WARNING("app_timer_start() returned %s.", nrf_strerror_get(err_code));
+            return false;
+        }
+
+        m_rank_timer_running = true;
+    }
+
+    return true;
+}
+
+
+/**@brief Function for ending the writing of the ranks, and continuing a shutdown waiting for it.
+ */
+static void rank_store_end(void)
+{
+    m_rank_storing = false;
+
+#if NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+    if (m_rank_shutdown_pending)
+    {
+        m_rank_shutdown_pending = false;
+        nrf_pwr_mgmt_shutdown(NRF_PWR_MGMT_SHUTDOWN_CONTINUE);
+    }
+#endif
+}
+
+
+/**@brief Function for writing the next rank that has changed since it was last written to flash.
+ *
+ * @details One rank is written at a time. Further ranks are written as the writes complete, until
+ *          no rank is left. If a write cannot be started, the remaining ranks are written when
+ *          @ref m_rank_store_timer expires again.
+ */
+static void rank_store_next(void)
+{
+    ret_code_t   err_code = NRF_ERROR_INVALID_PARAM;
+    pm_peer_id_t peer_id  = PM_PEER_ID_INVALID;
+
+    if (!m_rank_storing || (m_rank_store_token != PM_STORE_TOKEN_INVALID))
+    {
+        return;
+    }
+
+    while (err_code == NRF_ERROR_INVALID_PARAM)
+    {
+        uint32_t dirty = nrf_atomic_bitset_find_first(m_rank_dirty, ARRAY_SIZE(m_rank_dirty));
+
+        if (dirty >= PM_PEER_ID_N_AVAILABLE_IDS)
+        {
+            m_rank_store_token = PM_STORE_TOKEN_INVALID;
+            rank_store_end();
+            return;
+        }
+
+        peer_id = (pm_peer_id_t)dirty;
+
+        //lint -save -e65 -e64
+        pm_peer_data_flash_t peer_data = {.length_words = BYTES_TO_WORDS(sizeof(m_rank[peer_id])),
+                                          .data_id      = PM_PEER_DATA_ID_PEER_RANK,
+                                          .p_peer_rank  = &m_rank[peer_id]};
+        //lint -restore
+
+        // Cleared before the write, so that a new rank given meanwhile is written again.
+        nrf_atflags_clear(m_rank_dirty, peer_id);
+
+        // NRF_ERROR_INVALID_PARAM means the peer is gone, so its rank is dropped.
+        err_code = pds_peer_data_store(peer_id, &peer_data, &m_rank_store_token);
+    }
+
+    if (err_code == NRF_SUCCESS)
+    {
+        m_rank_store_peer = peer_id;
+        return;
+    }
+
+    m_rank_store_token = PM_STORE_TOKEN_INVALID;
+    nrf_atflags_set(m_rank_dirty, peer_id);
+
+    if (err_code == NRF_ERROR_STORAGE_FULL)
+    {
+        pm_evt_t storage_full_evt;
+
+        memset(&storage_full_evt, 0, sizeof(pm_evt_t));
+        storage_full_evt.evt_id      = PM_EVT_STORAGE_FULL;
+        storage_full_evt.peer_id     = peer_id;
+        storage_full_evt.conn_handle = im_conn_handle_get(peer_id);
+
+        evt_send(&storage_full_evt);
+    }
+    else if (err_code != NRF_ERROR_BUSY)
+    {
+        NRF_LOG_ERROR("Could not store rank. pds_peer_data_store() returned %s. peer_id: %d",
+                      nrf_strerror_get(err_code),
+                      peer_id);
+    }
+
+    // A shutdown does not wait for ranks that cannot be written.
+    rank_store_end();
+    UNUSED_RETURN_VALUE(rank_store_timer_start());
+}
+
+
+/**@brief Function for starting to write all ranks that have changed.
+ */
+static void rank_store_start(void)
+{
+    m_rank_storing = true;
+    rank_store_next();
+}
+
+
+/**@brief Function for handling the expiry of @ref m_rank_store_timer.
+ *
+ * @param[in]  p_context  Unused.
+ */
+static void rank_store_timeout_handler(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    m_rank_timer_running = false;
+    rank_store_start();
+}
+
+
+/**@brief Function for giving a peer the highest rank in RAM, to be written to flash later.
+ *
+ * @param[in]  peer_id  The peer to rank highest.
+ */
+static void rank_index_highest_set(pm_peer_id_t peer_id)
+{
+    m_current_highest_peer_rank += 1;
+    m_highest_ranked_peer        = peer_id;
+
+    rank_index_remove(peer_id);
+    rank_index_insert(peer_id, m_current_highest_peer_rank);
+
+    nrf_atflags_set(m_rank_dirty, peer_id);
+
+    if (m_rank_storing)
+    {
+        // Written by the ongoing writes.
+        rank_store_next();
+    }
+    else if (!rank_store_timer_start())
+    {
+        rank_store_start();
+    }
+}
+
+
+/**@brief Function for keeping the rank index up to date with the events from the Peer Database.
+ *
+ * @param[in]  p_pdb_evt  The incoming Peer Database event.
+ */
+static void rank_index_pdb_evt_handle(pm_evt_t * p_pdb_evt)
+{
+    switch (p_pdb_evt->evt_id)
+    {
+        case PM_EVT_PEER_DATA_UPDATE_SUCCEEDED:
+        case PM_EVT_PEER_DATA_UPDATE_FAILED:
+            if (   (m_rank_store_token != PM_STORE_TOKEN_INVALID)
+                && (m_rank_store_token == p_pdb_evt->params.peer_data_update_succeeded.token))
+            {
+                m_rank_store_token = PM_STORE_TOKEN_INVALID;
+
+                if (p_pdb_evt->evt_id == PM_EVT_PEER_DATA_UPDATE_FAILED)
+                {
+                    nrf_atflags_set(m_rank_dirty, m_rank_store_peer);
+                }
+
+                p_pdb_evt->params.peer_data_update_succeeded.token = PM_STORE_TOKEN_INVALID;
+            }
+            else if (   (p_pdb_evt->evt_id == PM_EVT_PEER_DATA_UPDATE_SUCCEEDED)
+                     && (p_pdb_evt->params.peer_data_update_succeeded.data_id == PM_PEER_DATA_ID_PEER_RANK))
+            {
+                // The rank was written or deleted by the application, so it is read again.
+                nrf_atflags_clear(m_rank_dirty, p_pdb_evt->peer_id);
+                m_rank_index_built = false;
+            }
+            rank_store_next();
+            break;
+
+        case PM_EVT_PEER_DELETE_SUCCEEDED:
+            nrf_atflags_clear(m_rank_dirty, p_pdb_evt->peer_id);
+            rank_index_remove(p_pdb_evt->peer_id);
+            rank_store_next();
+            break;
+
+        case PM_EVT_PEERS_DELETE_SUCCEEDED:
+        case PM_EVT_PEERS_DELETE_FAILED:
+            m_rank_index_built = false;
+            rank_store_next();
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+#if NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+/**@brief Handler for shutdown preparation events from the Power Management module.
+ *
+ * @details Writes all ranks held in RAM to flash, and blocks the shutdown until they are written.
+ *
+ * @param[in]  event  The shutdown type.
+ *
+ * @return  Whether the module is ready for shutdown.
+ */
+static bool rank_shutdown_handler(nrf_pwr_mgmt_evt_t event)
+{
+    UNUSED_PARAMETER(event);
+
+    if (!m_module_initialized)
+    {
+        return true;
+    }
+
+    if (m_rank_timer_running)
+    {
+        UNUSED_RETURN_VALUE(app_timer_stop(m_rank_store_timer));
+        m_rank_timer_running = false;
+    }
+
+    m_rank_shutdown_pending = false;
+    rank_store_start();
+
+    m_rank_shutdown_pending = m_rank_storing;
+
+    return !m_rank_shutdown_pending;
+}
+
+NRF_PWR_MGMT_HANDLER_REGISTER(rank_shutdown_handler, 0);
+#endif // NRF_MODULE_ENABLED(NRF_PWR_MGMT)
+#endif // PM_RANK_INDEX_ENABLED
+
+
 /**@brief Event handler for events from the Peer Database module.
  *        This handler is extern in the Peer Database module.
  *
@@ -130,6 +567,10 @@ void pm_pdb_evt_handler(pm_evt_t * p_pdb_evt)
 
     p_pdb_evt->conn_handle = im_conn_handle_get(p_pdb_evt->peer_id);
 
+#if PM_RANK_INDEX_ENABLED
+    rank_index_pdb_evt_handle(p_pdb_evt);
+#endif
+
     switch (p_pdb_evt->evt_id)
     {
 #if PM_PEER_RANKS_ENABLED == 1
@@ -234,6 +675,17 @@ void pm_pdb_evt_handler(pm_evt_t * p_pdb_evt)
             }
             break;
 
+#if PM_BULK_DELETE_ENABLED && (PM_PEER_RANKS_ENABLED == 1)
+        case PM_EVT_PEERS_DELETE_SUCCEEDED:
+        case PM_EVT_PEERS_DELETE_FAILED:
+            if (m_peer_rank_initialized)
+            {
+                // Sent by a bulk delete instead of an event for each peer.
+                rank_vars_update();
+            }
+            break;
+#endif
+
         default:
             // Do nothing.
             break;
@@ -351,6 +803,7 @@ static void ble_evt_handler(ble_evt_t const * p_ble_evt, void * p_context)
     im_ble_evt_handler(p_ble_evt);
     sm_ble_evt_handler(p_ble_evt);
     gcm_ble_evt_handler(p_ble_evt);
+    pdb_ble_evt_handler(p_ble_evt);
 }
 
 NRF_SDH_BLE_OBSERVER(m_ble_evt_observer, PM_BLE_OBSERVER_PRIO, ble_evt_handler, NULL);
@@ -362,6 +815,12 @@ static void internal_state_reset()
 {
     m_highest_ranked_peer = PM_PEER_ID_INVALID;
     m_peer_rank_token     = PM_STORE_TOKEN_INVALID;
+#if PM_RANK_INDEX_ENABLED
+    m_rank_index_built    = false;
+    m_rank_storing        = false;
+    m_rank_store_token    = PM_STORE_TOKEN_INVALID;
+    memset(m_rank_dirty, 0, sizeof(m_rank_dirty));
+#endif
 }
 
 
@@ -413,6 +872,17 @@ ret_code_t pm_init(void)
 
     internal_state_reset();
 
+#if PM_RANK_INDEX_ENABLED
+    err_code = app_timer_create(&m_rank_store_timer,
+                                APP_TIMER_MODE_SINGLE_SHOT,
+                                rank_store_timeout_handler);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("%s failed because app_timer_create() returned %s.", __func__, nrf_strerror_get(err_code));
+        return NRF_ERROR_INTERNAL;
+    }
+#endif
+
     m_peer_rank_initialized = false;
     m_module_initialized    = true;
 
@@ -598,6 +1068,18 @@ ret_code_t pm_device_identities_list_set(pm_peer_id_t const * p_peers,
 }
 
 
+ret_code_t pm_whitelist_all_bonded_set(bool enable)
+{
+    VERIFY_MODULE_INITIALIZED();
+#if PM_ID_KEY_CACHE_ENABLED
+    return im_whitelist_all_bonded_set(enable);
+#else
+    UNUSED_PARAMETER(enable);
+    return NRF_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+
 ret_code_t pm_conn_sec_status_get(uint16_t conn_handle, pm_conn_sec_status_t * p_conn_sec_status)
 {
     VERIFY_MODULE_INITIALIZED();
@@ -637,6 +1119,16 @@ ret_code_t pm_peer_id_get(uint16_t conn_handle, pm_peer_id_t * p_peer_id)
 }
 
 
+ret_code_t pm_peer_id_get_by_addr(ble_gap_addr_t const * p_addr, pm_peer_id_t * p_peer_id)
+{
+    VERIFY_MODULE_INITIALIZED();
+    VERIFY_PARAM_NOT_NULL(p_addr);
+    VERIFY_PARAM_NOT_NULL(p_peer_id);
+    *p_peer_id = im_peer_id_get_by_addr(p_addr);
+    return NRF_SUCCESS;
+}
+
+
 uint32_t pm_peer_count(void)
 {
     if (!MODULE_INITIALIZED)
@@ -683,6 +1175,96 @@ static bool peer_is_irk(ble_gap_irk_t const * const p_irk)
 }
 
 
+/**@brief Function for checking whether a peer is filtered out of a peer ID list.
+ *
+ * @param[in]  peer_id  The peer to check.
+ * @param[in]  skip_id  The filters to apply, see @ref pm_peer_id_list_skip_t.
+ * @param[out] p_skip   Whether the peer is filtered out.
+ *
+ * @return Any error from @ref pds_peer_data_read other than @ref NRF_ERROR_NOT_FOUND.
+ */
+static ret_code_t peer_id_list_skip_get(pm_peer_id_t           peer_id,
+                                        pm_peer_id_list_skip_t skip_id,
+                                        bool                 * p_skip)
+{
+    ret_code_t             err_code;
+    pm_peer_data_t         pm_car_data;
+    pm_peer_data_t         pm_bond_data;
+    ble_gap_addr_t const * p_gap_addr;
+    bool                   skip_no_addr = skip_id & PM_PEER_ID_LIST_SKIP_NO_ID_ADDR;
+    bool                   skip_no_irk  = skip_id & PM_PEER_ID_LIST_SKIP_NO_IRK;
+    bool                   skip_no_car  = skip_id & PM_PEER_ID_LIST_SKIP_NO_CAR;
+
+    *p_skip = false;
+
+    memset(&pm_car_data, 0, sizeof(pm_peer_data_t));
+    memset(&pm_bond_data, 0, sizeof(pm_peer_data_t));
+
+    if (skip_no_addr || skip_no_irk)
+    {
+        // Get data
+        pm_bond_data.p_bonding_data = NULL;
+
+        err_code = pds_peer_data_read(peer_id,
+                                      PM_PEER_DATA_ID_BONDING,
+                                      &pm_bond_data,
+                                      NULL);
+
+        if (err_code == NRF_ERROR_NOT_FOUND)
+        {
+            *p_skip = true;
+            return NRF_SUCCESS;
+        }
+        VERIFY_SUCCESS(err_code);
+
+        // Check data
+        if (skip_no_addr)
+        {
+            p_gap_addr = &pm_bond_data.p_bonding_data->peer_ble_id.id_addr_info;
+
+            if ((p_gap_addr->addr_type != BLE_GAP_ADDR_TYPE_PUBLIC) &&
+                (p_gap_addr->addr_type != BLE_GAP_ADDR_TYPE_RANDOM_STATIC))
+            {
+                *p_skip = true;
+            }
+        }
+        if (skip_no_irk)
+        {
+            if (!peer_is_irk(&pm_bond_data.p_bonding_data->peer_ble_id.id_info))
+            {
+                *p_skip = true;
+            }
+        }
+    }
+
+    if (skip_no_car)
+    {
+        // Get data
+        pm_car_data.p_central_addr_res = NULL;
+
+        err_code = pds_peer_data_read(peer_id,
+                                      PM_PEER_DATA_ID_CENTRAL_ADDR_RES,
+                                      &pm_car_data,
+                                      NULL);
+
+        if (err_code == NRF_ERROR_NOT_FOUND)
+        {
+            *p_skip = true;
+            return NRF_SUCCESS;
+        }
+        VERIFY_SUCCESS(err_code);
+
+        // Check data
+        if (*pm_car_data.p_central_addr_res == 0)
+        {
+            *p_skip = true;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
+
+
 ret_code_t pm_peer_id_list(pm_peer_id_t         * p_peer_list,
                            uint32_t       * const p_list_size,
                            pm_peer_id_t           first_peer_id,
@@ -695,13 +1277,7 @@ ret_code_t pm_peer_id_list(pm_peer_id_t         * p_peer_list,
     ret_code_t             err_code;
     uint32_t               size            = *p_list_size;
     uint32_t               current_size    = 0;
-    pm_peer_data_t         pm_car_data;
-    pm_peer_data_t         pm_bond_data;
     pm_peer_id_t           current_peer_id = first_peer_id;
-    ble_gap_addr_t const * p_gap_addr;
-    bool                   skip_no_addr = skip_id & PM_PEER_ID_LIST_SKIP_NO_ID_ADDR;
-    bool                   skip_no_irk  = skip_id & PM_PEER_ID_LIST_SKIP_NO_IRK;
-    bool                   skip_no_car  = skip_id & PM_PEER_ID_LIST_SKIP_NO_CAR;
 
     //lint -save -e685
     if ((*p_list_size < 1) ||
@@ -723,77 +1299,12 @@ ret_code_t pm_peer_id_list(pm_peer_id_t         * p_peer_list,
         }
     }
 
-    memset(&pm_car_data, 0, sizeof(pm_peer_data_t));
-    memset(&pm_bond_data, 0, sizeof(pm_peer_data_t));
-
     while (current_peer_id != PM_PEER_ID_INVALID)
     {
-        bool skip = false;
-
-        if (skip_no_addr || skip_no_irk)
-        {
-            // Get data
-            pm_bond_data.p_bonding_data = NULL;
-
-            err_code = pds_peer_data_read(current_peer_id,
-                                          PM_PEER_DATA_ID_BONDING,
-                                          &pm_bond_data,
-                                          NULL);
-
-            if (err_code == NRF_ERROR_NOT_FOUND)
-            {
-                skip = true;
-            }
-            else
-            {
-                VERIFY_SUCCESS(err_code);
-            }
-
-            // Check data
-            if (skip_no_addr)
-            {
-                p_gap_addr = &pm_bond_data.p_bonding_data->peer_ble_id.id_addr_info;
-
-                if ((p_gap_addr->addr_type != BLE_GAP_ADDR_TYPE_PUBLIC) &&
-                    (p_gap_addr->addr_type != BLE_GAP_ADDR_TYPE_RANDOM_STATIC))
-                {
-                    skip = true;
-                }
-            }
-            if (skip_no_irk)
-            {
-                if (!peer_is_irk(&pm_bond_data.p_bonding_data->peer_ble_id.id_info))
-                {
-                    skip = true;
-                }
-            }
-        }
+        bool skip;
 
-        if (skip_no_car)
-        {
-            // Get data
-            pm_car_data.p_central_addr_res = NULL;
-
-            err_code = pds_peer_data_read(current_peer_id,
-                                          PM_PEER_DATA_ID_CENTRAL_ADDR_RES,
-                                          &pm_car_data,
-                                          NULL);
-
-            if (err_code == NRF_ERROR_NOT_FOUND)
-            {
-                skip = true;
-            }
-            else
-            {
-                VERIFY_SUCCESS(err_code);
-            }
-
-            // Check data
-            if (*pm_car_data.p_central_addr_res == 0)
-            {
-                skip = true;
-            }
-        }
+        err_code = peer_id_list_skip_get(current_peer_id, skip_id, &skip);
+        VERIFY_SUCCESS(err_code);
 
         if (!skip)
         {
@@ -1029,6 +1540,11 @@ ret_code_t pm_peers_delete(void)
 {
     VERIFY_MODULE_INITIALIZED();
 
+#if PM_BULK_DELETE_ENABLED
+    // All peers are deleted as one operation, which sends PM_EVT_PEERS_DELETE_SUCCEEDED or
+    // PM_EVT_PEERS_DELETE_FAILED, also when there are no peers.
+    return im_peers_free(PM_PEER_ID_INVALID);
+#else
     m_deleting_all = true;
 
     pm_peer_id_t current_peer_id = pds_next_peer_id_get(PM_PEER_ID_INVALID);
@@ -1063,6 +1579,20 @@ ret_code_t pm_peers_delete(void)
     }
 
     return NRF_SUCCESS;
+#endif
+}
+
+
+ret_code_t pm_peers_delete_except(pm_peer_id_t peer_id)
+{
+#if PM_BULK_DELETE_ENABLED
+    VERIFY_MODULE_INITIALIZED();
+
+    return im_peers_free(peer_id);
+#else
+    UNUSED_PARAMETER(peer_id);
+    return NRF_ERROR_NOT_SUPPORTED;
+#endif
 }
 
 
@@ -1073,6 +1603,54 @@ ret_code_t pm_peer_ranks_get(pm_peer_id_t * p_highest_ranked_peer,
 {
 #if PM_PEER_RANKS_ENABLED == 0
     return NRF_ERROR_NOT_SUPPORTED;
+#elif PM_RANK_INDEX_ENABLED
+    VERIFY_MODULE_INITIALIZED();
+
+    pm_peer_id_t highest_ranked_peer;
+    pm_peer_id_t lowest_ranked_peer;
+
+    if (!m_rank_index_built)
+    {
+        ret_code_t err_code = rank_index_build();
+        VERIFY_SUCCESS(err_code);
+    }
+
+    // Peers being deleted are still in the index until they are gone from flash.
+    highest_ranked_peer = m_rank_head;
+    while ((highest_ranked_peer != PM_PEER_ID_INVALID) && pds_peer_id_is_deleted(highest_ranked_peer))
+    {
+        highest_ranked_peer = m_rank_lower[highest_ranked_peer];
+    }
+
+    lowest_ranked_peer = m_rank_tail;
+    while ((lowest_ranked_peer != PM_PEER_ID_INVALID) && pds_peer_id_is_deleted(lowest_ranked_peer))
+    {
+        lowest_ranked_peer = m_rank_higher[lowest_ranked_peer];
+    }
+
+    if (highest_ranked_peer == PM_PEER_ID_INVALID)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    if (p_highest_ranked_peer != NULL)
+    {
+        *p_highest_ranked_peer = highest_ranked_peer;
+    }
+    if (p_highest_rank != NULL)
+    {
+        *p_highest_rank = m_rank[highest_ranked_peer];
+    }
+    if (p_lowest_ranked_peer != NULL)
+    {
+        *p_lowest_ranked_peer = lowest_ranked_peer;
+    }
+    if (p_lowest_rank != NULL)
+    {
+        *p_lowest_rank = m_rank[lowest_ranked_peer];
+    }
+
+    return NRF_SUCCESS;
 #else
     VERIFY_MODULE_INITIALIZED();
 
@@ -1155,6 +1733,152 @@ ret_code_t pm_peer_ranks_get(pm_peer_id_t * p_highest_ranked_peer,
 }
 
 
+#if (PM_PEER_RANKS_ENABLED == 1) && !PM_RANK_INDEX_ENABLED
+/**@brief Function for checking whether a peer goes before another in rank order.
+ *
+ * @details Ties are ordered by peer ID, as in @ref pm_peer_ranks_get.
+ */
+static bool rank_is_before(uint32_t rank0, pm_peer_id_t peer_id0, uint32_t rank1, pm_peer_id_t peer_id1)
+{
+    return (rank0 > rank1) || ((rank0 == rank1) && (peer_id0 > peer_id1));
+}
+
+
+/**@brief Function for finding the highest ranked peer ranked after a given peer.
+ *
+ * @param[in]  prev_peer_id  The previous peer, or @ref PM_PEER_ID_INVALID to find the highest
+ *                           ranked peer.
+ * @param[in]  prev_rank     The rank of the previous peer.
+ * @param[out] p_peer_id     The peer found, or @ref PM_PEER_ID_INVALID.
+ * @param[out] p_rank        The rank of the peer found.
+ *
+ * @retval NRF_SUCCESS         If the search completed.
+ * @retval NRF_ERROR_INTERNAL  If a rank could not be read.
+ */
+static ret_code_t rank_next_get(pm_peer_id_t   prev_peer_id,
+                                uint32_t       prev_rank,
+                                pm_peer_id_t * p_peer_id,
+                                uint32_t     * p_rank)
+{
+    pm_peer_id_t peer_id = pm_next_peer_id_get(PM_PEER_ID_INVALID);
+
+    *p_peer_id = PM_PEER_ID_INVALID;
+    *p_rank    = 0;
+
+    while (peer_id != PM_PEER_ID_INVALID)
+    {
+        uint32_t       peer_rank = 0;
+        //lint -save -e65 -e64
+        uint32_t       length    = sizeof(peer_rank);
+        pm_peer_data_t peer_data = {.p_peer_rank = &peer_rank};
+        //lint -restore
+        ret_code_t     err_code  = pds_peer_data_read(peer_id,
+                                                      PM_PEER_DATA_ID_PEER_RANK,
+                                                      &peer_data,
+                                                      &length);
+
+        if (err_code == NRF_SUCCESS)
+        {
+            if (   ((prev_peer_id == PM_PEER_ID_INVALID)
+                    || rank_is_before(prev_rank, prev_peer_id, peer_rank, peer_id))
+                && ((*p_peer_id == PM_PEER_ID_INVALID)
+                    || rank_is_before(peer_rank, peer_id, *p_rank, *p_peer_id)))
+            {
+                *p_peer_id = peer_id;
+                *p_rank    = peer_rank;
+            }
+        }
+        else if (err_code != NRF_ERROR_NOT_FOUND)
+        {
+            NRF_LOG_ERROR("Could not retreive ranks. pds_peer_data_read() returned %s. peer_id: %d",
+                          nrf_strerror_get(err_code),
+                          peer_id);
+            return NRF_ERROR_INTERNAL;
+        }
+
+        peer_id = pm_next_peer_id_get(peer_id);
+    }
+
+    return NRF_SUCCESS;
+}
+#endif
+
+
+ret_code_t pm_peer_ranked_list_get(pm_peer_id_t         * p_peer_list,
+                                   uint32_t       * const p_list_size,
+                                   pm_peer_id_list_skip_t skip_id)
+{
+#if PM_PEER_RANKS_ENABLED == 0
+    UNUSED_PARAMETER(p_peer_list);
+    UNUSED_PARAMETER(p_list_size);
+    UNUSED_PARAMETER(skip_id);
+    return NRF_ERROR_NOT_SUPPORTED;
+#else
+    VERIFY_MODULE_INITIALIZED();
+    VERIFY_PARAM_NOT_NULL(p_list_size);
+    VERIFY_PARAM_NOT_NULL(p_peer_list);
+
+    ret_code_t   err_code;
+    uint32_t     size         = *p_list_size;
+    uint32_t     current_size = 0;
+    pm_peer_id_t peer_id;
+#if !PM_RANK_INDEX_ENABLED
+    uint32_t     peer_rank;
+#endif
+
+    //lint -save -e685
+    if ((*p_list_size < 1) ||
+        (skip_id > (PM_PEER_ID_LIST_SKIP_NO_ID_ADDR | PM_PEER_ID_LIST_SKIP_ALL)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+    //lint -restore
+
+    *p_list_size = 0;
+
+#if PM_RANK_INDEX_ENABLED
+    if (!m_rank_index_built)
+    {
+        err_code = rank_index_build();
+        VERIFY_SUCCESS(err_code);
+    }
+
+    peer_id = m_rank_head;
+#else
+    err_code = rank_next_get(PM_PEER_ID_INVALID, 0, &peer_id, &peer_rank);
+    VERIFY_SUCCESS(err_code);
+#endif
+
+    while ((peer_id != PM_PEER_ID_INVALID) && (current_size < size))
+    {
+        bool skip = pds_peer_id_is_deleted(peer_id);
+
+        if (!skip)
+        {
+            err_code = peer_id_list_skip_get(peer_id, skip_id, &skip);
+            VERIFY_SUCCESS(err_code);
+        }
+
+        if (!skip)
+        {
+            p_peer_list[current_size++] = peer_id;
+        }
+
+#if PM_RANK_INDEX_ENABLED
+        peer_id = m_rank_lower[peer_id];
+#else
+        err_code = rank_next_get(peer_id, peer_rank, &peer_id, &peer_rank);
+        VERIFY_SUCCESS(err_code);
+#endif
+    }
+
+    *p_list_size = current_size;
+
+    return NRF_SUCCESS;
+#endif
+}
+
+
 #if PM_PEER_RANKS_ENABLED == 1
 /**@brief Function for initializing peer rank functionality.
  */
@@ -1180,6 +1904,14 @@ ret_code_t pm_peer_rank_highest(pm_peer_id_t peer_id)
     //lint -restore
 
 
+#if PM_RANK_INDEX_ENABLED
+    if (!m_rank_index_built)
+    {
+        // A rank was changed by the application.
+        m_peer_rank_initialized = false;
+    }
+#endif
+
     if (!m_peer_rank_initialized)
     {
         rank_init();
@@ -1215,6 +1947,31 @@ ret_code_t pm_peer_rank_highest(pm_peer_id_t peer_id)
             {
                 err_code = NRF_ERROR_RESOURCES;
             }
+#if PM_RANK_INDEX_ENABLED
+            else if (!pds_peer_id_is_allocated(peer_id) || pds_peer_id_is_deleted(peer_id))
+            {
+                err_code = NRF_ERROR_INVALID_PARAM;
+            }
+            else
+            {
+                pm_evt_t pm_evt;
+
+                // The rank is written to flash later, merged with any later ranks of the peer.
+                rank_index_highest_set(peer_id);
+                err_code = NRF_SUCCESS;
+
+                memset(&pm_evt, 0, sizeof(pm_evt));
+                pm_evt.evt_id      = PM_EVT_PEER_DATA_UPDATE_SUCCEEDED;
+                pm_evt.conn_handle = im_conn_handle_get(peer_id);
+                pm_evt.peer_id     = peer_id;
+                pm_evt.params.peer_data_update_succeeded.data_id       = PM_PEER_DATA_ID_PEER_RANK;
+                pm_evt.params.peer_data_update_succeeded.action        = PM_PEER_DATA_OP_UPDATE;
+                pm_evt.params.peer_data_update_succeeded.token         = PM_STORE_TOKEN_INVALID;
+                pm_evt.params.peer_data_update_succeeded.flash_changed = false;
+
+                evt_send(&pm_evt);
+            }
+#else
             else
             {
                 m_current_highest_peer_rank += 1;
@@ -1235,6 +1992,7 @@ ret_code_t pm_peer_rank_highest(pm_peer_id_t peer_id)
                     }
                 }
             }
+#endif // PM_RANK_INDEX_ENABLED
         }
     }
     return err_code;
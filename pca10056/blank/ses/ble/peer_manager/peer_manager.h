@@ -233,6 +233,10 @@ ret_code_t pm_conn_sec_params_reply(uint16_t               conn_handle,
  *          changed characteristic is not present in the local database, or if the @ref
  *          PM_SERVICE_CHANGED_ENABLED is set to 0, no indications are sent peers, and no events are
  *          sent to the user.
+ *
+ * @note If @ref PM_GATT_CACHING_ENABLED is set, the Database Hash is also recomputed the next time
+ *       a peer reads it. A peer that reads the new hash before its service changed indication has
+ *       been sent is considered aware of the change, and the indication is dropped.
  */
 void pm_local_database_has_changed(void);
 
@@ -372,6 +376,35 @@ ret_code_t pm_device_identities_list_set(pm_peer_id_t const * p_peers,
                                          uint32_t             peer_cnt);
 
 
+/**@brief Function for making the whitelist and the device identities list follow the bonded peers.
+ *
+ * @details When enabled, all bonded peers with an identity address that can be whitelisted are
+ *          given to the SoftDevice as the whitelist and the device identities list, up to
+ *          @ref BLE_GAP_WHITELIST_ADDR_MAX_COUNT peers. The lists are updated in RAM when bonds
+ *          are added, changed, or deleted, so they are not read from flash again. A list
+ *          that is in use when the bonds change is set again on the next call to
+ *          @ref pm_whitelist_get, which @ref lib_ble_advertising makes before using it.
+ *
+ * @note Lists set with @ref pm_whitelist_set or @ref pm_device_identities_list_set while this is
+ *       enabled are replaced on the next bond change.
+ *
+ * @note Requires @ref PM_ID_KEY_CACHE_ENABLED. The first @ref PM_ID_KEY_CACHE_SIZE bonds are kept
+ *       in RAM.
+ *
+ * @param[in] enable  Whether the lists follow the bonded peers. Disabling leaves the lists as
+ *                    they are.
+ *
+ * @retval NRF_SUCCESS                              If the lists were set.
+ * @retval BLE_ERROR_GAP_WHITELIST_IN_USE           If the whitelist is in use. It will be set on
+ *                                                  the next call to @ref pm_whitelist_get.
+ * @retval BLE_ERROR_GAP_DEVICE_IDENTITIES_IN_USE   If the device identities list is in use. It will
+ *                                                  be set on the next call to @ref pm_whitelist_get.
+ * @retval NRF_ERROR_INVALID_STATE                  If the Peer Manager is not initialized.
+ * @retval NRF_ERROR_NOT_SUPPORTED                  If @ref PM_ID_KEY_CACHE_ENABLED is not set.
+ */
+ret_code_t pm_whitelist_all_bonded_set(bool enable);
+
+
 /**@brief Function for setting the local <em>Bluetooth</em> identity address.
  *
  * @details The local <em>Bluetooth</em> identity address is the address that identifies the device
@@ -493,6 +526,24 @@ ret_code_t pm_conn_handle_get(pm_peer_id_t peer_id, uint16_t * p_conn_handle);
 ret_code_t pm_peer_id_get(uint16_t conn_handle, pm_peer_id_t * p_peer_id);
 
 
+/**@brief Function for retrieving the ID of a bonded peer, given one of its addresses.
+ *
+ * @details This can be used for example with the addresses in advertising reports. Resolvable
+ *          private addresses are resolved against the IRKs of all bonded peers. If
+ *          @ref PM_RPA_CACHE_ENABLED is set, the results are cached, so that repeated lookups of the
+ *          same address are fast.
+ *
+ * @param[in]  p_addr     The address of the peer.
+ * @param[out] p_peer_id  The peer ID, or @ref PM_PEER_ID_INVALID if no bonded peer matched the
+ *                        address.
+ *
+ * @retval NRF_SUCCESS              If the lookup was done successfully.
+ * @retval NRF_ERROR_NULL           If @p p_addr or @p p_peer_id was NULL.
+ * @retval NRF_ERROR_INVALID_STATE  If the Peer Manager is not initialized.
+ */
+ret_code_t pm_peer_id_get_by_addr(ble_gap_addr_t const * p_addr, pm_peer_id_t * p_peer_id);
+
+
 /**@brief Function for retrieving a filtered list of peer IDs.
  *
  * @details This function starts searching from @p first_peer_id. IDs ordering
@@ -760,6 +811,12 @@ ret_code_t pm_peer_delete(pm_peer_id_t peer_id);
  *          PM_EVT_PEERS_DELETE_FAILED event. In addition, a @ref PM_EVT_PEER_DELETE_SUCCEEDED or
  *          @ref PM_EVT_PEER_DELETE_FAILED event is sent for each deleted peer.
  *
+ *          With @ref PM_BULK_DELETE_ENABLED, all peers are marked as deleted at once, the deletion
+ *          of their data is queued in flash back-to-back, and flash garbage collection is run once
+ *          when all data is deleted. Only the @ref PM_EVT_PEERS_DELETE_SUCCEEDED or @ref
+ *          PM_EVT_PEERS_DELETE_FAILED event is sent, after the @ref PM_EVT_FLASH_GARBAGE_COLLECTED
+ *          event.
+ *
  * @note When there is no peer data in flash the @ref PM_EVT_PEER_DELETE_SUCCEEDED event is sent synchronously.
  *
  * @warning Use this function only when not connected or connectable. If a peer is or becomes
@@ -768,9 +825,31 @@ ret_code_t pm_peer_delete(pm_peer_id_t peer_id);
  *
  * @retval NRF_SUCCESS              If the deletion process was initiated successfully.
  * @retval NRF_ERROR_INVALID_STATE  If the Peer Manager is not initialized.
+ * @retval NRF_ERROR_BUSY           If a bulk delete is already in progress.
  * @retval NRF_ERROR_INTERNAL       If an internal error occurred.
  */
 ret_code_t pm_peers_delete(void);
+
+
+/**@brief Function for deleting all data stored for all peers except one.
+ *
+ * @details This function works like @ref pm_peers_delete with @ref PM_BULK_DELETE_ENABLED, but keeps
+ *          the data of @p peer_id, for example the peer that requested the deletion through the Bond
+ *          Management Service. When the @ref PM_EVT_PEERS_DELETE_SUCCEEDED event is sent, flash
+ *          storage contains no data for other peers.
+ *
+ * @warning Use this function only when not connected to or connectable for the peers that are being
+ *          deleted.
+ *
+ * @param[in]  peer_id  Peer ID to keep, or @ref PM_PEER_ID_INVALID to delete all peers.
+ *
+ * @retval NRF_SUCCESS              If the deletion process was initiated successfully.
+ * @retval NRF_ERROR_INVALID_STATE  If the Peer Manager is not initialized.
+ * @retval NRF_ERROR_BUSY           If a bulk delete is already in progress.
+ * @retval NRF_ERROR_NOT_SUPPORTED  If @ref PM_BULK_DELETE_ENABLED is 0.
+ * @retval NRF_ERROR_INTERNAL       If an internal error occurred.
+ */
+ret_code_t pm_peers_delete_except(pm_peer_id_t peer_id);
 /** @}*/
 
 
@@ -810,6 +889,32 @@ ret_code_t pm_peer_ranks_get(pm_peer_id_t * p_highest_ranked_peer,
                              uint32_t     * p_lowest_rank);
 
 
+/**@brief Function for retrieving a filtered list of peer IDs ordered by rank.
+ *
+ * @details Peers are returned starting with the highest ranked peer, for example, the most
+ *          recently used peer. Peers are filtered as in @ref pm_peer_id_list. With
+ *          @ref PM_RANK_INDEX_ENABLED, the list is taken from the rank index in RAM. Without it,
+ *          the ranks of all peers are read from persistent storage for each peer examined.
+ *
+ * @note Peers with no stored rank and peers pending deletion are not returned.
+ *
+ * @param[out]    p_peer_list  Pointer to peer IDs list buffer.
+ * @param[in,out] p_list_size  The amount of IDs to return / The number of returned IDs.
+ * @param[in]     skip_id      It determines which peer ID will be added to list.
+ *
+ * @retval NRF_SUCCESS              If the ID list has been filled out.
+ * @retval NRF_ERROR_INVALID_PARAM  If @p skip_id or the list size was invalid.
+ * @retval NRF_ERROR_NULL           If peer_list or list_size was NULL.
+ * @retval NRF_ERROR_INVALID_STATE  If the Peer Manager is not initialized.
+ * @retval NRF_ERROR_INTERNAL       If an internal error occurred.
+ * @retval NRF_ERROR_NOT_SUPPORTED  If peer rank functionality has been disabled via the @ref
+ *                                  PM_PEER_RANKS_ENABLED configuration option.
+ */
+ret_code_t pm_peer_ranked_list_get(pm_peer_id_t         * p_peer_list,
+                                   uint32_t       * const p_list_size,
+                                   pm_peer_id_list_skip_t skip_id);
+
+
 /**@brief Function for updating the rank of a peer to be highest among all stored peers.
  *
  * @details If this function returns @ref NRF_SUCCESS, either a @ref PM_EVT_PEER_DATA_UPDATE_SUCCEEDED or a
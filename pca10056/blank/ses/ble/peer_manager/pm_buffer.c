@@ -45,6 +45,7 @@
 #include <string.h>
 #include "nrf_error.h"
 #include "nrf_atflags.h"
+#include "nrf_atomic.h"
 
 
 #define BUFFER_IS_VALID(p_buffer) ((p_buffer != NULL)             \
@@ -53,14 +54,6 @@
 
 
 
-static bool mutex_lock(nrf_atflags_t * p_mutex, uint32_t mutex_id)
-{
-    bool locked = !nrf_atflags_fetch_set(p_mutex, mutex_id);
-    __DMB();
-    return locked;
-}
-
-
 static void mutex_unlock(nrf_atflags_t * p_mutex, uint32_t mutex_id)
 {
     __DMB();
@@ -103,39 +96,151 @@ ret_code_t pm_buffer_init(pm_buffer_t   * p_buffer,
 }
 
 
-uint8_t pm_buffer_block_acquire(pm_buffer_t * p_buffer, uint32_t n_blocks)
+/**@brief Function for getting the mask of the mutexes of a run of blocks within one mutex word.
+ *
+ * @param[in]    first     The first block in the run.
+ * @param[inout] p_n_left  In: The number of blocks in the run. Out: The number of blocks in the run
+ *                         that are after this word.
+ *
+ * @return The mask of the blocks of the run that are in the word containing block @p first.
+ */
+static uint32_t run_word_mask(uint32_t first, uint32_t * p_n_left)
 {
-    if (!BUFFER_IS_VALID(p_buffer))
+    uint32_t bit = first % NRF_ATFLAGS_FLAGS_PER_ELEMENT;
+    uint32_t n   = MIN(NRF_ATFLAGS_FLAGS_PER_ELEMENT - bit, *p_n_left);
+
+    *p_n_left -= n;
+
+    return ((n == NRF_ATFLAGS_FLAGS_PER_ELEMENT) ? UINT32_MAX : ((1UL << n) - 1)) << bit;
+}
+
+
+/**@brief Function for unlocking the mutexes of a run of blocks, one word at a time.
+ */
+static void run_unlock(nrf_atflags_t * p_mutex, uint32_t first, uint32_t n_blocks)
+{
+    __DMB();
+    while (n_blocks > 0)
     {
-        return ( PM_BUFFER_INVALID_ID );
+        uint32_t word = first / NRF_ATFLAGS_FLAGS_PER_ELEMENT;
+        uint32_t n    = n_blocks;
+        uint32_t mask = run_word_mask(first, &n_blocks);
+
+        UNUSED_RETURN_VALUE(nrf_atomic_u32_and((nrf_atomic_u32_t *)&p_mutex[word], ~mask));
+        first += n - n_blocks;
     }
+}
 
-    uint8_t first_locked_mutex = PM_BUFFER_INVALID_ID;
 
-    for (uint8_t i = 0; i < p_buffer->n_blocks; i++)
+/**@brief Function for locking the mutexes of a run of blocks, one word at a time.
+ *
+ * @return Whether the whole run was locked. If not, no mutexes were changed.
+ */
+static bool run_lock(nrf_atflags_t * p_mutex, uint32_t first, uint32_t n_blocks)
+{
+    uint32_t start = first;
+
+    while (n_blocks > 0)
     {
-        if (mutex_lock(p_buffer->p_mutex, i))
+        uint32_t word = first / NRF_ATFLAGS_FLAGS_PER_ELEMENT;
+        uint32_t n    = n_blocks;
+        uint32_t mask = run_word_mask(first, &n_blocks);
+        uint32_t prev = nrf_atomic_u32_fetch_or((nrf_atomic_u32_t *)&p_mutex[word], mask);
+
+        if ((prev & mask) != 0)
         {
-            if (first_locked_mutex == PM_BUFFER_INVALID_ID)
+            // Some of the blocks were taken since the search. Undo the rest.
+            UNUSED_RETURN_VALUE(nrf_atomic_u32_and((nrf_atomic_u32_t *)&p_mutex[word], ~(mask & ~prev)));
+            run_unlock(p_mutex, start, first - start);
+            return false;
+        }
+        first += n - n_blocks;
+    }
+    __DMB();
+
+    return true;
+}
+
+
+/**@brief Function for finding the smallest run of free blocks that fits a request.
+ *
+ * @details Taking the smallest run that fits leaves the larger runs for requests of several blocks.
+ *          Fully used mutex words are skipped without looking at each block.
+ *
+ * @return The first block of the run, or @ref PM_BUFFER_INVALID_ID if no run is long enough.
+ */
+static uint8_t free_run_find(pm_buffer_t * p_buffer, uint32_t n_blocks)
+{
+    uint32_t best_first = PM_BUFFER_INVALID_ID;
+    uint32_t best_len   = UINT32_MAX;
+    uint32_t run_first  = 0;
+    uint32_t run_len    = 0;
+
+    __DMB();
+    for (uint32_t i = 0; (i <= p_buffer->n_blocks) && (best_len != n_blocks); i++)
+    {
+        bool     used = true;
+        uint32_t skip = 0;
+
+        if (i < p_buffer->n_blocks)
+        {
+            if (   ((i % NRF_ATFLAGS_FLAGS_PER_ELEMENT) == 0)
+                && ((p_buffer->n_blocks - i) >= NRF_ATFLAGS_FLAGS_PER_ELEMENT)
+                && (p_buffer->p_mutex[i / NRF_ATFLAGS_FLAGS_PER_ELEMENT] == UINT32_MAX))
+            {
+                skip = NRF_ATFLAGS_FLAGS_PER_ELEMENT - 1;
+            }
+            else
             {
-                first_locked_mutex = i;
+                used = nrf_atflags_get(p_buffer->p_mutex, i);
             }
-            if ((i - first_locked_mutex + 1U) == n_blocks)
+        }
+
+        if (!used)
+        {
+            if (run_len++ == 0)
             {
-                return first_locked_mutex;
+                run_first = i;
             }
         }
-        else if (first_locked_mutex != PM_BUFFER_INVALID_ID)
+        else
         {
-            for (uint8_t j = first_locked_mutex; j < i; j++)
+            if ((run_len >= n_blocks) && (run_len < best_len))
             {
-                pm_buffer_release(p_buffer, j);
+                best_first = run_first;
+                best_len   = run_len;
             }
-            first_locked_mutex = PM_BUFFER_INVALID_ID;
+            run_len = 0;
+            i      += skip;
         }
     }
 
-    return ( PM_BUFFER_INVALID_ID );
+    return (uint8_t)best_first;
+}
+
+
+uint8_t pm_buffer_block_acquire(pm_buffer_t * p_buffer, uint32_t n_blocks)
+{
+    if (!BUFFER_IS_VALID(p_buffer) || (n_blocks == 0))
+    {
+        return ( PM_BUFFER_INVALID_ID );
+    }
+
+    uint8_t first;
+
+    do
+    {
+        first = free_run_find(p_buffer, n_blocks);
+    } while ((first != PM_BUFFER_INVALID_ID) && !run_lock(p_buffer->p_mutex, first, n_blocks));
+
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+    if (first == PM_BUFFER_INVALID_ID)
+    {
+        nrf_mem_telemetry_failure_record(p_buffer);
+    }
+#endif
+
+    return first;
 }
 
 
@@ -167,4 +272,34 @@ void pm_buffer_release(pm_buffer_t * p_buffer, uint8_t id)
         mutex_unlock(p_buffer->p_mutex, id);
     }
 }
+
+
+void pm_buffer_run_release(pm_buffer_t * p_buffer, uint8_t id, uint32_t n_blocks)
+{
+    if (    BUFFER_IS_VALID(p_buffer)
+       &&  (id != PM_BUFFER_INVALID_ID)
+       &&  ((id + n_blocks) <= p_buffer->n_blocks))
+    {
+        run_unlock(p_buffer->p_mutex, id, n_blocks);
+    }
+}
+
+
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+void pm_buffer_mem_telemetry_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats)
+{
+    pm_buffer_t const * p_buffer = p_object;
+
+    if (!BUFFER_IS_VALID(p_buffer))
+    {
+        return;
+    }
+
+    p_stats->capacity = p_buffer->n_blocks;
+    for (uint32_t i = 0; i < p_buffer->n_blocks; i++)
+    {
+        p_stats->used += nrf_atflags_get(p_buffer->p_mutex, i) ? 1 : 0;
+    }
+}
+#endif
 #endif // NRF_MODULE_ENABLED(PEER_MANAGER)
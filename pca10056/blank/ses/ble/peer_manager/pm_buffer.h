@@ -44,6 +44,7 @@
 #include "compiler_abstraction.h"
 #include "sdk_errors.h"
 #include "nrf_atflags.h"
+#include "nrf_mem_telemetry.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -114,6 +115,9 @@ ret_code_t pm_buffer_init(pm_buffer_t   * p_buffer,
 
 
 /**@brief Function for acquiring a buffer block in a buffer.
+ *
+ * @details The smallest run of free blocks that fits is used, so that runs long enough for
+ *          requests of several blocks are kept free where possible.
  *
  * @param[in]  p_buffer  The buffer instance acquire from.
  * @param[in]  n_blocks  The number of contiguous blocks to acquire.
@@ -143,6 +147,27 @@ uint8_t * pm_buffer_ptr_get(pm_buffer_t * p_buffer, uint8_t id);
 void pm_buffer_release(pm_buffer_t * p_buffer, uint8_t id);
 
 
+/**@brief Function for releasing a run of buffer blocks acquired with @ref pm_buffer_block_acquire.
+ *
+ * @details The mutexes are cleared one word at a time instead of one block at a time.
+ *
+ * @param[in]  p_buffer  The buffer instance containing the blocks to release.
+ * @param[in]  id        The id of the first block to release.
+ * @param[in]  n_blocks  The number of blocks to release.
+ */
+void pm_buffer_run_release(pm_buffer_t * p_buffer, uint8_t id, uint32_t n_blocks);
+
+
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+/**@brief Function for getting the use of a buffer, in blocks. Used with @ref nrf_mem_telemetry.
+ *
+ * @param[in]  p_object  The buffer instance.
+ * @param[out] p_stats   The use of the buffer.
+ */
+void pm_buffer_mem_telemetry_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats);
+#endif
+
+
 
 #ifdef __cplusplus
 }
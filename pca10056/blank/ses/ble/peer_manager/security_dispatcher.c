@@ -71,6 +71,10 @@ NRF_LOG_MODULE_REGISTER();
     #define PM_CENTRAL_ENABLED 1
 #endif
 
+#ifndef PM_CONCURRENT_PAIRING_ENABLED
+    #define PM_CONCURRENT_PAIRING_ENABLED 0
+#endif
+
 // The number of registered event handlers.
 #define SMD_EVENT_HANDLERS_CNT      (sizeof(m_evt_handlers) / sizeof(m_evt_handlers[0]))
 
@@ -94,7 +98,23 @@ static ble_conn_state_user_flag_id_t m_flag_sec_proc_pairing  = BLE_CONN_STATE_U
 static ble_conn_state_user_flag_id_t m_flag_sec_proc_bonding  = BLE_CONN_STATE_USER_FLAG_INVALID;
 static ble_conn_state_user_flag_id_t m_flag_allow_repairing   = BLE_CONN_STATE_USER_FLAG_INVALID;
 
+#if PM_CONCURRENT_PAIRING_ENABLED
+/**@brief Struct for keeping the keys received during bonding on one link, until they have been
+ *        copied into a flash buffer in Peer Database.
+ */
+typedef struct
+{
+    pm_peer_data_bonding_t bonding_data;  /**< The keys. Written by the SoftDevice during the security procedure. */
+    ble_gap_lesc_p256_pk_t peer_pk;       /**< The LESC public key of the peer. Written by the SoftDevice during the security procedure. */
+    uint16_t               conn_handle;   /**< The connection the keys were received on. */
+    pm_peer_id_t           store_peer_id; /**< The peer the keys are waiting to be stored for, or @ref PM_PEER_ID_INVALID if they are not waiting. */
+    bool                   new_peer_id;   /**< Whether store_peer_id was allocated for this bond, and must be freed if storing fails. */
+} smd_link_keys_t;
+
+static smd_link_keys_t               m_link_keys[BLE_CONN_STATE_MAX_CONNECTIONS];
+#else
 static ble_gap_lesc_p256_pk_t        m_peer_pk;
+#endif
 
 
 static __INLINE bool sec_procedure(uint16_t conn_handle)
@@ -117,6 +137,15 @@ static __INLINE bool allow_repairing(uint16_t conn_handle)
     return ble_conn_state_user_flag_get(conn_handle, m_flag_allow_repairing);
 }
 
+#if PM_CONCURRENT_PAIRING_ENABLED
+static __INLINE smd_link_keys_t * link_keys_get(uint16_t conn_handle)
+{
+    uint16_t conn_idx = ble_conn_state_conn_idx(conn_handle);
+
+    return (conn_idx < BLE_CONN_STATE_MAX_CONNECTIONS) ? &m_link_keys[conn_idx] : NULL;
+}
+#endif
+
 
 /**@brief Function for sending an SMD event to all event handlers.
  *
@@ -503,6 +532,104 @@ static void pairing_success_evt_send(ble_gap_evt_t const * p_gap_evt, bool data_
 }
 
 
+#if PM_CONCURRENT_PAIRING_ENABLED
+/**@brief Function for copying the keys of a link into a flash buffer and storing them.
+ *
+ * @details If no flash buffer is available, the keys are left waiting on the link, and this is
+ *          reattempted from @ref link_keys_store_pending.
+ *
+ * @param[in]  p_link_keys  The keys to store. store_peer_id must be valid.
+ *
+ * @retval NRF_SUCCESS             The keys are being stored, or are waiting for a flash buffer.
+ * @retval NRF_ERROR_STORAGE_FULL  No space in flash. Storing is reattempted after the next compression.
+ * @retval Other                   Other error codes might be returned by @ref pdb_write_buf_get
+ *                                 and @ref pdb_write_buf_store.
+ */
+static ret_code_t link_keys_store(smd_link_keys_t * p_link_keys)
+{
+    ret_code_t     err_code;
+    pm_peer_data_t peer_data;
+    pm_peer_id_t   temp_peer_id = PDB_TEMP_PEER_ID(p_link_keys->conn_handle);
+    pm_peer_id_t   peer_id      = p_link_keys->store_peer_id;
+
+    if (!pds_peer_id_is_allocated(peer_id))
+    {
+        // The peer was deleted while the keys were waiting.
+        p_link_keys->store_peer_id = PM_PEER_ID_INVALID;
+        return NRF_SUCCESS;
+    }
+
+    err_code = pdb_write_buf_get(temp_peer_id, PM_PEER_DATA_ID_BONDING, 1, &peer_data);
+    if (err_code == NRF_ERROR_BUSY)
+    {
+        // All flash buffers are in use. Keep waiting.
+        return NRF_SUCCESS;
+    }
+
+    p_link_keys->store_peer_id = PM_PEER_ID_INVALID;
+
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    memcpy(peer_data.p_bonding_data, &p_link_keys->bonding_data, sizeof(pm_peer_data_bonding_t));
+
+    err_code = pdb_write_buf_store(temp_peer_id, PM_PEER_DATA_ID_BONDING, peer_id);
+    if ((err_code != NRF_SUCCESS) && (err_code != NRF_ERROR_STORAGE_FULL))
+    {
+        UNUSED_RETURN_VALUE(pdb_write_buf_release(temp_peer_id, PM_PEER_DATA_ID_BONDING));
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for storing the keys of all links that are waiting for a flash buffer.
+ */
+static void link_keys_store_pending(void)
+{
+    for (uint32_t i = 0; i < BLE_CONN_STATE_MAX_CONNECTIONS; i++)
+    {
+        smd_link_keys_t * p_link_keys = &m_link_keys[i];
+        pm_peer_id_t      peer_id     = p_link_keys->store_peer_id;
+        ret_code_t        err_code;
+
+        if (peer_id == PM_PEER_ID_INVALID)
+        {
+            continue;
+        }
+
+        err_code = link_keys_store(p_link_keys);
+
+        if (p_link_keys->store_peer_id != PM_PEER_ID_INVALID)
+        {
+            // Still no flash buffer available, so the remaining links need not be tried.
+            return;
+        }
+
+        if (err_code == NRF_ERROR_STORAGE_FULL)
+        {
+            send_storage_full_evt(p_link_keys->conn_handle);
+        }
+        else if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_ERROR("Could not store bond. link_keys_store() returned %s. "\
+                          "conn_handle: %d, peer_id: %d",
+                          nrf_strerror_get(err_code),
+                          p_link_keys->conn_handle,
+                          peer_id);
+            send_unexpected_error(p_link_keys->conn_handle, err_code);
+            if (p_link_keys->new_peer_id)
+            {
+                UNUSED_RETURN_VALUE(im_peer_free(peer_id)); // We are already in a bad state.
+            }
+        }
+    }
+}
+#endif // PM_CONCURRENT_PAIRING_ENABLED
+
+
 /**@brief Function for processing the @ref BLE_GAP_EVT_AUTH_STATUS event from the SoftDevice, when
  *        the auth_status is success.
  *
@@ -524,6 +651,19 @@ static void auth_status_success_process(ble_gap_evt_t const * p_gap_evt)
         return;
     }
 
+#if PM_CONCURRENT_PAIRING_ENABLED
+    smd_link_keys_t * p_link_keys = link_keys_get(conn_handle);
+
+    if (p_link_keys == NULL)
+    {
+        NRF_LOG_ERROR("RAM buffer for new bond was unavailable. conn_handle: %d.", conn_handle);
+        send_unexpected_error(conn_handle, NRF_ERROR_INTERNAL);
+        pairing_success_evt_send(p_gap_evt, false);
+        return;
+    }
+
+    peer_data.p_bonding_data = &p_link_keys->bonding_data;
+#else
     err_code = pdb_write_buf_get(PDB_TEMP_PEER_ID(conn_handle), PM_PEER_DATA_ID_BONDING, 1, &peer_data);
     if (err_code != NRF_SUCCESS)
     {
@@ -534,6 +674,7 @@ static void auth_status_success_process(ble_gap_evt_t const * p_gap_evt)
         pairing_success_evt_send(p_gap_evt, false);
         return;
     }
+#endif
 
     peer_id = im_peer_id_get_by_conn_handle(conn_handle);
 
@@ -573,7 +714,15 @@ static void auth_status_success_process(ble_gap_evt_t const * p_gap_evt)
         new_peer_id = true;
     }
 
+#if PM_CONCURRENT_PAIRING_ENABLED
+    p_link_keys->conn_handle   = conn_handle;
+    p_link_keys->store_peer_id = peer_id;
+    p_link_keys->new_peer_id   = new_peer_id;
+
+    err_code = link_keys_store(p_link_keys);
+#else
     err_code = pdb_write_buf_store(PDB_TEMP_PEER_ID(conn_handle), PM_PEER_DATA_ID_BONDING, peer_id);
+#endif
 
     if (err_code == NRF_SUCCESS)
     {
@@ -712,6 +861,13 @@ ret_code_t smd_init(void)
     }
 #endif // PM_RA_PROTECTION_ENABLED
 
+#if PM_CONCURRENT_PAIRING_ENABLED
+    for (uint32_t i = 0; i < BLE_CONN_STATE_MAX_CONNECTIONS; i++)
+    {
+        m_link_keys[i].store_peer_id = PM_PEER_ID_INVALID;
+    }
+#endif
+
     m_module_initialized = true;
 
     return NRF_SUCCESS;
@@ -745,8 +901,27 @@ static ret_code_t sec_keyset_fill(uint16_t                 conn_handle,
         return NRF_ERROR_INTERNAL;
     }
 
+#if PM_CONCURRENT_PAIRING_ENABLED
+    // Receive bonding data into the buffer of the link.
+    smd_link_keys_t * p_link_keys = link_keys_get(conn_handle);
+
+    if (p_link_keys == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (p_link_keys->store_peer_id != PM_PEER_ID_INVALID)
+    {
+        // The keys of a previous bond on this connection index are still waiting for a flash buffer.
+        return NRF_ERROR_BUSY;
+    }
+
+    peer_data.p_bonding_data = &p_link_keys->bonding_data;
+    err_code                 = NRF_SUCCESS;
+#else
     // Acquire a memory buffer to receive bonding data into.
     err_code = pdb_write_buf_get(PDB_TEMP_PEER_ID(conn_handle), PM_PEER_DATA_ID_BONDING, 1, &peer_data);
+#endif
 
     if (err_code == NRF_ERROR_BUSY)
     {
@@ -770,7 +945,11 @@ static ret_code_t sec_keyset_fill(uint16_t                 conn_handle,
         p_sec_keyset->keys_own.p_pk       = p_public_key;
         p_sec_keyset->keys_peer.p_enc_key = &peer_data.p_bonding_data->peer_ltk;
         p_sec_keyset->keys_peer.p_id_key  = &peer_data.p_bonding_data->peer_ble_id;
+#if PM_CONCURRENT_PAIRING_ENABLED
+        p_sec_keyset->keys_peer.p_pk      = &p_link_keys->peer_pk;
+#else
         p_sec_keyset->keys_peer.p_pk      = &m_peer_pk;
+#endif
 
         // Retrieve the address the peer used during connection establishment.
         // This address will be overwritten if ID is shared. Should not fail.
@@ -846,7 +1025,12 @@ ret_code_t smd_params_reply(uint16_t                 conn_handle,
         {
             // Pairing, no bonding.
             sec_keyset.keys_own.p_pk  = p_public_key;
+#if PM_CONCURRENT_PAIRING_ENABLED
+            smd_link_keys_t * p_link_keys = link_keys_get(conn_handle);
+            sec_keyset.keys_peer.p_pk = (p_link_keys != NULL) ? &p_link_keys->peer_pk : NULL;
+#else
             sec_keyset.keys_peer.p_pk = &m_peer_pk;
+#endif
         }
         else if (sec_status != BLE_GAP_SEC_STATUS_PAIRING_NOT_SUPP)
         {
@@ -1092,5 +1276,32 @@ void smd_ble_evt_handler(ble_evt_t const * p_ble_evt)
             conn_sec_update_process(&(p_ble_evt->evt.gap_evt));
             break;
     };
+
+#if PM_CONCURRENT_PAIRING_ENABLED
+    // Flash buffers can also be released without a Peer Database event.
+    link_keys_store_pending();
+#endif
+}
+
+
+void smd_pdb_evt_handler(pm_evt_t * p_event)
+{
+#if PM_CONCURRENT_PAIRING_ENABLED
+    switch (p_event->evt_id)
+    {
+        case PM_EVT_FLASH_GARBAGE_COLLECTED:
+        case PM_EVT_PEER_DATA_UPDATE_SUCCEEDED:
+        case PM_EVT_PEER_DATA_UPDATE_FAILED:
+        case PM_EVT_PEER_DELETE_SUCCEEDED:
+        case PM_EVT_PEER_DELETE_FAILED:
+            link_keys_store_pending();
+            break;
+        default:
+            // Do nothing.
+            break;
+    }
+#else
+    UNUSED_PARAMETER(p_event);
+#endif
 }
 #endif //NRF_MODULE_ENABLED(PEER_MANAGER)
@@ -77,6 +77,16 @@ ret_code_t smd_init(void);
 void smd_ble_evt_handler(ble_evt_t const * ble_evt);
 
 
+/**@brief Function for dispatching Peer Database events to the Security Dispatcher module.
+ *
+ * @details Used to store bonds that are waiting for a flash buffer, see
+ *          @ref PM_CONCURRENT_PAIRING_ENABLED.
+ *
+ * @param[in]  p_event  The Peer Database event.
+ */
+void smd_pdb_evt_handler(pm_evt_t * p_event);
+
+
 /**@brief Function for providing security configuration for a link.
  *
  * @details This function is optional, and must be called in reply to a @ref
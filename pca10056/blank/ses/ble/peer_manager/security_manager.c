@@ -515,6 +515,8 @@ static void link_secure_pending_handle(uint16_t conn_handle, void * p_context)
  */
 void sm_pdb_evt_handler(pm_evt_t * p_event)
 {
+    smd_pdb_evt_handler(p_event);
+
     switch (p_event->evt_id)
     {
         case PM_EVT_FLASH_GARBAGE_COLLECTED:
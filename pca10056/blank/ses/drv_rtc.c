@@ -41,11 +41,18 @@
 #include <nrfx.h>
 #include <nrf_delay.h>
 #include <drv_rtc.h>
+#include "nrf_ramfunc.h"
 
 /* Module is integral part of app_timer implementation. */
 #define NRF_LOG_MODULE_NAME app_timer
 #include <nrf_log.h>
 
+#if APP_TIMER_CONFIG_RAMFUNC_ENABLED
+#define DRV_RTC_RAMFUNC NRF_RAMFUNC
+#else
+#define DRV_RTC_RAMFUNC
+#endif
+
 #define EVT_TO_STR(event)                                           \
     (event == NRF_RTC_EVENT_TICK      ? "NRF_RTC_EVENT_TICK"      : \
     (event == NRF_RTC_EVENT_OVERFLOW  ? "NRF_RTC_EVENT_OVERFLOW"  : \
@@ -164,7 +171,7 @@ void drv_rtc_compare_set(drv_rtc_t const * const p_instance,
     }
 }
 
-static void evt_enable(drv_rtc_t const * const p_instance, uint32_t mask, bool irq_enable)
+DRV_RTC_RAMFUNC static void evt_enable(drv_rtc_t const * const p_instance, uint32_t mask, bool irq_enable)
 {
     ASSERT(p_instance);
     nrf_rtc_event_enable(p_instance->p_reg, mask);
@@ -174,14 +181,14 @@ static void evt_enable(drv_rtc_t const * const p_instance, uint32_t mask, bool i
     }
 }
 
-static void evt_disable(drv_rtc_t const * const p_instance, uint32_t mask)
+DRV_RTC_RAMFUNC static void evt_disable(drv_rtc_t const * const p_instance, uint32_t mask)
 {
     ASSERT(p_instance);
     nrf_rtc_event_disable(p_instance->p_reg, mask);
     nrf_rtc_int_disable(p_instance->p_reg, mask);
 }
 
-static bool evt_pending(drv_rtc_t const * const p_instance, nrf_rtc_event_t event)
+DRV_RTC_RAMFUNC static bool evt_pending(drv_rtc_t const * const p_instance, nrf_rtc_event_t event)
 {
     ASSERT(p_instance);
     if (nrf_rtc_event_pending(p_instance->p_reg, event))
@@ -192,12 +199,12 @@ static bool evt_pending(drv_rtc_t const * const p_instance, nrf_rtc_event_t even
     return false;
 }
 
-static uint32_t ticks_sub(uint32_t a, uint32_t b)
+DRV_RTC_RAMFUNC static uint32_t ticks_sub(uint32_t a, uint32_t b)
 {
     return (a - b) & RTC_COUNTER_COUNTER_Msk;
 }
 
-ret_code_t drv_rtc_windowed_compare_set(drv_rtc_t const * const p_instance,
+DRV_RTC_RAMFUNC ret_code_t drv_rtc_windowed_compare_set(drv_rtc_t const * const p_instance,
                                         uint32_t                cc,
                                         uint32_t                abs_value,
                                         uint32_t                safe_window)
@@ -284,7 +291,7 @@ void drv_rtc_overflow_disable(drv_rtc_t const * const p_instance)
     evt_disable(p_instance, NRF_RTC_INT_OVERFLOW_MASK);
 }
 
-bool drv_rtc_overflow_pending(drv_rtc_t const * const p_instance)
+DRV_RTC_RAMFUNC bool drv_rtc_overflow_pending(drv_rtc_t const * const p_instance)
 {
     return evt_pending(p_instance, NRF_RTC_EVENT_OVERFLOW);
 }
@@ -304,30 +311,30 @@ bool drv_rtc_tick_pending(drv_rtc_t const * const p_instance)
     return evt_pending(p_instance, NRF_RTC_EVENT_TICK);
 }
 
-void drv_rtc_compare_enable(drv_rtc_t const * const p_instance,
+DRV_RTC_RAMFUNC void drv_rtc_compare_enable(drv_rtc_t const * const p_instance,
                             uint32_t                cc,
                             bool                    irq_enable)
 {
     evt_enable(p_instance, (uint32_t)NRF_RTC_INT_COMPARE0_MASK << cc, irq_enable);
 }
 
-void drv_rtc_compare_disable(drv_rtc_t const * const p_instance, uint32_t cc)
+DRV_RTC_RAMFUNC void drv_rtc_compare_disable(drv_rtc_t const * const p_instance, uint32_t cc)
 {
     evt_disable(p_instance, (uint32_t)NRF_RTC_INT_COMPARE0_MASK << cc);
 }
 
-bool drv_rtc_compare_pending(drv_rtc_t const * const p_instance, uint32_t cc)
+DRV_RTC_RAMFUNC bool drv_rtc_compare_pending(drv_rtc_t const * const p_instance, uint32_t cc)
 {
     nrf_rtc_event_t cc_evt = CC_IDX_TO_CC_EVENT(cc);
     return evt_pending(p_instance, cc_evt);
 }
 
-uint32_t drv_rtc_compare_get(drv_rtc_t const * const p_instance, uint32_t cc)
+DRV_RTC_RAMFUNC uint32_t drv_rtc_compare_get(drv_rtc_t const * const p_instance, uint32_t cc)
 {
     return nrf_rtc_cc_get(p_instance->p_reg, cc);
 }
 
-uint32_t drv_rtc_counter_get(drv_rtc_t const * const p_instance)
+DRV_RTC_RAMFUNC uint32_t drv_rtc_counter_get(drv_rtc_t const * const p_instance)
 {
     return nrf_rtc_counter_get(p_instance->p_reg);
 }
@@ -342,21 +349,21 @@ void drv_rtc_irq_trigger(drv_rtc_t const * const p_instance)
 #define drv_rtc_rtc_2_irq_handler RTC2_IRQHandler
 
 #if defined(APP_TIMER_V2_RTC0_ENABLED)
-void drv_rtc_rtc_0_irq_handler(void)
+DRV_RTC_RAMFUNC void drv_rtc_rtc_0_irq_handler(void)
 {
     m_handlers[DRV_RTC_RTC0_INST_IDX](m_cb[DRV_RTC_RTC0_INST_IDX].p_instance);
 }
 #endif
 
 #if defined(APP_TIMER_V2_RTC1_ENABLED)
-void drv_rtc_rtc_1_irq_handler(void)
+DRV_RTC_RAMFUNC void drv_rtc_rtc_1_irq_handler(void)
 {
     m_handlers[DRV_RTC_RTC1_INST_IDX](m_cb[DRV_RTC_RTC1_INST_IDX].p_instance);
 }
 #endif
 
 #if defined(APP_TIMER_V2_RTC2_ENABLED)
-void drv_rtc_rtc_2_irq_handler(void)
+DRV_RTC_RAMFUNC void drv_rtc_rtc_2_irq_handler(void)
 {
     m_handlers[DRV_RTC_RTC2_INST_IDX](m_cb[DRV_RTC_RTC2_INST_IDX].p_instance);
 }
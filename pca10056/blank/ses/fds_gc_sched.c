@@ -0,0 +1,286 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(FDS_GC_SCHED)
+#include "fds_gc_sched.h"
+#include "fds.h"
+#include "app_timer.h"
+#include "app_timer_deadline.h"
+#include "app_util_platform.h"
+#if FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED
+#include "ble_radio_notification.h"
+#endif
+
+#define NRF_LOG_MODULE_NAME fds_gc_sched
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#if FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED && !NRF_MODULE_ENABLED(BLE_RADIO_NOTIFICATION_SCHED)
+#error "FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED requires BLE_RADIO_NOTIFICATION_SCHED_ENABLED."
+#endif
+
+#define RADIO_INTERVALS         4   /**< Number of intervals between radio events the prediction is based on. */
+#define RADIO_TASK_BUDGET_US    10  /**< Longest time the radio notification task runs, in microseconds. */
+
+static volatile bool m_stat_stale = true; /**< FDS data changed since the flash usage was last read. */
+static volatile bool m_gc_running;        /**< A collection started by this module has not completed. */
+static bool          m_pending;           /**< The flash usage calls for a collection. */
+static uint32_t      m_pending_ticks;     /**< app_timer counter when the collection became pending. */
+
+#if FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED
+static ble_radio_notification_task_t m_radio_task;                        /**< Task run after every radio event. */
+static uint32_t                      m_radio_intervals[RADIO_INTERVALS];  /**< Last intervals between the ends of radio events, in ticks. */
+static uint8_t                       m_radio_interval_idx;                /**< Index of the oldest interval. */
+static volatile uint32_t             m_radio_end_ticks;                   /**< app_timer counter at the end of the last radio event. */
+static volatile uint32_t             m_radio_interval_ticks;              /**< Shortest of the last intervals, 0 while fewer were measured. */
+static volatile bool                 m_radio_seen;                        /**< A radio event has ended since initialization. */
+
+
+/**@brief Function for recording the end of a radio event. Runs in the radio notification interrupt.
+ *
+ * @param[in] p_context Unused.
+ *
+ * @return True, to run again after the next radio event.
+ */
+static bool radio_task_handler(void * p_context)
+{
+    uint32_t now      = app_timer_cnt_get();
+    uint32_t interval = UINT32_MAX;
+
+    UNUSED_PARAMETER(p_context);
+
+    if (m_radio_seen)
+    {
+        m_radio_intervals[m_radio_interval_idx] = app_timer_cnt_diff_compute(now, m_radio_end_ticks);
+        m_radio_interval_idx                    = (m_radio_interval_idx + 1) % RADIO_INTERVALS;
+    }
+
+    for (uint32_t i = 0; i < RADIO_INTERVALS; i++)
+    {
+        interval = MIN(interval, m_radio_intervals[i]);
+    }
+
+    m_radio_end_ticks      = now;
+    m_radio_interval_ticks = interval;
+    m_radio_seen           = true;
+
+    return true;
+}
+
+
+/**@brief Function for predicting how long the radio stays off.
+ *
+ * @details The next radio event is expected one interval after the end of the last one. Once
+ *          that time has passed without a radio event, the radio is assumed to stay off for as
+ *          long as it has already been off.
+ *
+ * @return Number of ticks, or APP_TIMER_NO_DEADLINE if the radio has not been used.
+ */
+static uint32_t radio_free_ticks_get(void)
+{
+    uint32_t interval;
+    uint32_t elapsed;
+
+    if (!m_radio_seen)
+    {
+        return APP_TIMER_NO_DEADLINE;
+    }
+
+    CRITICAL_REGION_ENTER();
+    interval = m_radio_interval_ticks;
+    elapsed  = app_timer_cnt_diff_compute(app_timer_cnt_get(), m_radio_end_ticks);
+    CRITICAL_REGION_EXIT();
+
+    return (elapsed < interval) ? (interval - elapsed) : elapsed;
+}
+#endif // FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED
+
+
+/**@brief Function for updating the pending state from the flash usage, if FDS data changed. */
+static void stat_update(void)
+{
+    fds_stat_t stat;
+    uint32_t   data_words;
+    bool       needed;
+
+    if (!m_stat_stale)
+    {
+        return;
+    }
+
+    m_stat_stale = false;
+
+    if (fds_stat(&stat) != NRF_SUCCESS)
+    {
+        // FDS is not initialized yet. Its FDS_EVT_INIT event marks the usage as changed.
+        return;
+    }
+
+    data_words = (uint32_t)stat.pages_available * FDS_VIRTUAL_PAGE_SIZE;
+    needed     =    (stat.freeable_words > 0)
+                 && (   ((stat.freeable_words * 100) >= (data_words * FDS_GC_SCHED_DIRTY_PERCENT))
+                     || (stat.largest_contig < FDS_GC_SCHED_LOW_WATER_WORDS));
+
+    if (needed && !m_pending)
+    {
+        m_pending_ticks = app_timer_cnt_get();
+
+        NRF_LOG_DEBUG("Collection pending, %d of %d words freeable.", stat.freeable_words, data_words);
+    }
+
+    m_pending = needed;
+}
+
+
+/**@brief Function for checking whether a pending collection has waited too long for idle time. */
+static bool force_is_due(void)
+{
+    if (FDS_GC_SCHED_FORCE_MS == 0)
+    {
+        return false;
+    }
+
+    return app_timer_cnt_diff_compute(app_timer_cnt_get(), m_pending_ticks) >=
+           APP_TIMER_TICKS(FDS_GC_SCHED_FORCE_MS);
+}
+
+
+/**@brief Function for handling the events of all FDS users. */
+static void fds_evt_handler(fds_evt_t const * p_evt)
+{
+    switch (p_evt->id)
+    {
+        case FDS_EVT_INIT:
+        case FDS_EVT_WRITE:
+        case FDS_EVT_UPDATE:
+        case FDS_EVT_DEL_RECORD:
+        case FDS_EVT_DEL_FILE:
+            m_stat_stale = true;
+            break;
+
+        case FDS_EVT_GC:
+            // Also completes collections started by other users.
+            m_gc_running = false;
+            m_stat_stale = true;
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+ret_code_t fds_gc_sched_init(void)
+{
+    ret_code_t err_code;
+
+    err_code = fds_register(fds_evt_handler);
+    VERIFY_SUCCESS(err_code);
+
+    m_stat_stale = true;
+    m_gc_running = false;
+    m_pending    = false;
+
+#if FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED
+    m_radio_task.handler   = radio_task_handler;
+    m_radio_task.p_context = NULL;
+    m_radio_task.slot      = BLE_RADIO_NOTIFICATION_SLOT_AFTER_RADIO;
+    m_radio_task.budget_us = RADIO_TASK_BUDGET_US;
+
+    err_code = ble_radio_notification_task_register(&m_radio_task);
+    VERIFY_SUCCESS(err_code);
+
+    ble_radio_notification_task_request(&m_radio_task);
+#endif
+
+    return NRF_SUCCESS;
+}
+
+
+bool fds_gc_sched_on_idle(uint32_t idle_ticks)
+{
+    ret_code_t err_code;
+
+    stat_update();
+
+    if (!m_pending || m_gc_running)
+    {
+        return false;
+    }
+
+    if (!force_is_due())
+    {
+        if (idle_ticks < APP_TIMER_TICKS(FDS_GC_SCHED_IDLE_MS))
+        {
+            return false;
+        }
+
+#if FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED
+        if (radio_free_ticks_get() < APP_TIMER_TICKS(FDS_GC_SCHED_RADIO_GAP_MS))
+        {
+            return false;
+        }
+#endif
+    }
+
+    err_code = fds_gc();
+    if (err_code != NRF_SUCCESS)
+    {
+        // The FDS queue is full, try again on the next call.
+        NRF_LOG_DEBUG("fds_gc() returned 0x%x.", err_code);
+        return false;
+    }
+
+    m_gc_running = true;
+
+    NRF_LOG_DEBUG("Collection started.");
+
+    return true;
+}
+
+
+bool fds_gc_sched_is_pending(void)
+{
+    stat_update();
+
+    return m_pending || m_gc_running;
+}
+
+#endif // NRF_MODULE_ENABLED(FDS_GC_SCHED)
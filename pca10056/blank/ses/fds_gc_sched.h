@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup fds_gc_sched FDS garbage collection scheduler
+ * @{
+ * @ingroup fds
+ *
+ * @brief Garbage collection of FDS started ahead of need, in idle and radio-free periods.
+ *
+ * @details FDS users usually run @ref fds_gc when a write fails with FDS_ERR_NO_SPACE_IN_FLASH,
+ *          so the collection runs at the moment the data has to be stored, whatever the radio
+ *          and the application are doing. This module watches the flash usage of all FDS users
+ *          and starts the collection before that happens:
+ *          - The collection becomes pending when the freeable words reach
+ *            FDS_GC_SCHED_DIRTY_PERCENT of the data pages, or when the largest free space drops
+ *            below FDS_GC_SCHED_LOW_WATER_WORDS while there are freeable words.
+ *          - A pending collection starts in @ref fds_gc_sched_on_idle if no app_timer expires
+ *            within FDS_GC_SCHED_IDLE_MS and, with FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED, the
+ *            radio is expected to stay off for at least FDS_GC_SCHED_RADIO_GAP_MS.
+ *          - A collection pending for FDS_GC_SCHED_FORCE_MS starts at the next call anyway.
+ *
+ *          FDS compacts all dirty pages in one collection, which is the smallest unit this
+ *          module can start. The flash operations of a collection are still scheduled by the
+ *          SoftDevice between radio events, and only one collection is started at a time.
+ *
+ *          The radio-free time is predicted from the intervals between the ends of the last
+ *          radio events, reported by @ref ble_radio_notification in the
+ *          BLE_RADIO_NOTIFICATION_SLOT_AFTER_RADIO slot. It is short while a link has a short
+ *          connection interval, and unlimited if the radio has not been used for a while.
+ *
+ * @note    The module uses one of the FDS_MAX_USERS event handlers.
+ */
+
+#ifndef FDS_GC_SCHED_H__
+#define FDS_GC_SCHED_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function for initializing the module.
+ *
+ * @details Registers the FDS event handler and, if enabled, the radio notification task. Can be
+ *          called before or after @ref fds_init. With FDS_GC_SCHED_RADIO_NOTIFICATION_ENABLED,
+ *          @ref ble_radio_notification_init must also be called by the application.
+ *
+ * @retval NRF_SUCCESS If the module was initialized.
+ * @return Other error code returned by @ref fds_register or
+ *         @ref ble_radio_notification_task_register.
+ */
+ret_code_t fds_gc_sched_init(void);
+
+/**@brief Function for starting a pending garbage collection if the system is idle.
+ *
+ * @details Must be called from the main context, for example from the idle loop before
+ *          @ref nrf_pwr_mgmt_run with @ref app_timer_next_deadline_get, or from an application
+ *          implementation of @ref nrf_pwr_mgmt_idle_prepare with its idle_ticks.
+ *
+ * @param[in] idle_ticks Number of RTC ticks until the next app_timer expiry, or
+ *                       APP_TIMER_NO_DEADLINE if no timer is running.
+ *
+ * @return True if a garbage collection was started.
+ */
+bool fds_gc_sched_on_idle(uint32_t idle_ticks);
+
+/**@brief Function for checking whether a garbage collection is pending or running.
+ *
+ * @return True if the flash usage calls for a collection that has not completed yet.
+ */
+bool fds_gc_sched_is_pending(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FDS_GC_SCHED_H__
+
+/** @} */
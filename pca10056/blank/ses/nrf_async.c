@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_ASYNC)
+#include "nrf_async.h"
+#include "app_scheduler.h"
+#include "app_error.h"
+#include "nrf_assert.h"
+#include "nrf_trace.h"
+
+#define NRF_LOG_MODULE_NAME nrf_async
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+/**@brief Run a task from the scheduler. */
+static void task_run_evt(void * p_event_data, uint16_t event_size)
+{
+    nrf_async_task_t  * p_task = *(nrf_async_task_t **)p_event_data;
+    nrf_async_task_fn_t fn     = p_task->fn;
+
+    UNUSED_PARAMETER(event_size);
+    // The task may end and be started again with another function while it runs.
+    NRF_TRACE_SCHED_START(fn);
+    fn(p_task);
+    NRF_TRACE_SCHED_STOP(fn);
+}
+
+/**@brief Schedule a task, handing it the reference for running. */
+static ret_code_t task_schedule(nrf_async_task_t * p_task)
+{
+    return app_sched_event_put(&p_task, sizeof(p_task), task_run_evt);
+}
+
+/**@brief End the delay of @ref NRF_ASYNC_SLEEP. */
+static void sleep_timeout_handler(void * p_context)
+{
+    nrf_async_op_end((nrf_async_task_t *)p_context, NRF_SUCCESS);
+}
+
+ret_code_t nrf_async_task_start(nrf_async_task_t       * p_task,
+                                nrf_async_task_fn_t      fn,
+                                void                   * p_context,
+                                nrf_async_done_handler_t done_handler,
+                                nrf_async_task_t       * p_parent)
+{
+    ret_code_t err_code;
+
+    VERIFY_PARAM_NOT_NULL(p_task);
+    VERIFY_PARAM_NOT_NULL(fn);
+
+    if (p_task->running)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    p_task->fn           = fn;
+    p_task->p_context    = p_context;
+    p_task->done_handler = done_handler;
+    p_task->p_parent     = p_parent;
+    p_task->refs         = 1;
+    p_task->result       = NRF_SUCCESS;
+    p_task->lc           = 0;
+    p_task->timer_id     = &p_task->timer_data;
+
+    err_code = app_timer_create(&p_task->timer_id, APP_TIMER_MODE_SINGLE_SHOT, sleep_timeout_handler);
+    VERIFY_SUCCESS(err_code);
+
+    if (p_parent != NULL)
+    {
+        nrf_async_op_begin(p_parent);
+    }
+
+    p_task->running = true;
+    err_code = task_schedule(p_task);
+    if (err_code != NRF_SUCCESS)
+    {
+        p_task->running = false;
+        if (p_parent != NULL)
+        {
+            nrf_async_op_end(p_parent, err_code);
+        }
+    }
+
+    return err_code;
+}
+
+bool nrf_async_task_is_running(nrf_async_task_t const * p_task)
+{
+    return p_task->running;
+}
+
+void nrf_async_op_begin(nrf_async_task_t * p_task)
+{
+    ASSERT(p_task->running);
+    UNUSED_RETURN_VALUE(nrf_atomic_u32_add(&p_task->refs, 1));
+}
+
+void nrf_async_op_end(nrf_async_task_t * p_task, ret_code_t err_code)
+{
+    if (err_code != NRF_SUCCESS)
+    {
+        // Only the first error of a step is kept.
+        uint32_t expected = NRF_SUCCESS;
+        UNUSED_RETURN_VALUE(nrf_atomic_u32_cmp_exch(&p_task->result, &expected, err_code));
+    }
+
+    if (nrf_atomic_u32_sub(&p_task->refs, 1) == 0)
+    {
+        // The task was waiting for this operation. Nothing else refers to it until it runs.
+        p_task->refs = 1;
+        APP_ERROR_CHECK(task_schedule(p_task));
+    }
+}
+
+void nrf_async_sleep_start(nrf_async_task_t * p_task, uint32_t ticks)
+{
+    ret_code_t err_code;
+
+    nrf_async_op_begin(p_task);
+    err_code = app_timer_start(p_task->timer_id, ticks, p_task);
+    if (err_code != NRF_SUCCESS)
+    {
+        nrf_async_op_end(p_task, err_code);
+    }
+}
+
+bool nrf_async_task_suspend(nrf_async_task_t * p_task)
+{
+    if (nrf_atomic_u32_sub(&p_task->refs, 1) == 0)
+    {
+        // All operations have completed already, continue without going through the scheduler.
+        p_task->refs = 1;
+        return false;
+    }
+    return true;
+}
+
+void nrf_async_task_yield(nrf_async_task_t * p_task)
+{
+    APP_ERROR_CHECK(task_schedule(p_task));
+}
+
+ret_code_t nrf_async_task_result_take(nrf_async_task_t * p_task)
+{
+    return nrf_atomic_u32_fetch_store(&p_task->result, NRF_SUCCESS);
+}
+
+void nrf_async_task_exit(nrf_async_task_t * p_task, ret_code_t result)
+{
+    nrf_async_task_t * p_parent = p_task->p_parent;
+
+    // Operations still pending would resume a task that has ended.
+    ASSERT(p_task->refs == 1);
+
+    NRF_LOG_DEBUG("Task 0x%08x ended: %d", (uint32_t)p_task, result);
+
+    p_task->refs    = 0;
+    p_task->running = false;
+
+    if (p_task->done_handler != NULL)
+    {
+        p_task->done_handler(p_task, result);
+    }
+    if (p_parent != NULL)
+    {
+        nrf_async_op_end(p_parent, result);
+    }
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_ASYNC)
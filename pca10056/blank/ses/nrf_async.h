@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_async Cooperative tasks
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Stackless tasks that wait for several operations at a time.
+ *
+ * @details A task is a function written as a sequence of steps between @ref NRF_ASYNC_BEGIN and
+ *          @ref NRF_ASYNC_END. A step starts any number of operations, for example GATT requests
+ *          with @ref nrf_ble_async, a delay with @ref NRF_ASYNC_SLEEP or child tasks with
+ *          @ref nrf_async_task_start, and then waits for all of them with
+ *          @ref NRF_ASYNC_AWAIT_ALL. The operations complete in any order and from any context.
+ *          When the last one completes, the task is resumed through @ref app_scheduler after the
+ *          await, so independent steps run concurrently without a hand-written state machine.
+ *
+ *          An operation is started with @ref nrf_async_op_begin and ends with
+ *          @ref nrf_async_op_end, which records the first error of the step. The task itself
+ *          holds a reference while it is running or scheduled, so an operation that completes
+ *          before the task reaches the await does not resume it a second time.
+ *
+ * @note    A task is resumed by jumping back into its function, so local variables do not keep
+ *          their values across @ref NRF_ASYNC_AWAIT_ALL, @ref NRF_ASYNC_SLEEP and
+ *          @ref NRF_ASYNC_YIELD. Keep the state of a task in the structure pointed to by
+ *          @ref nrf_async_task_t::p_context. The macros use a switch statement, so the task
+ *          function cannot await from inside a switch statement of its own.
+ *
+ * @note    The app_scheduler module must be initialized with an event size of at least
+ *          sizeof(nrf_async_task_t *), and the app_timer module for @ref NRF_ASYNC_SLEEP.
+ */
+
+#ifndef NRF_ASYNC_H__
+#define NRF_ASYNC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "nrf_atomic.h"
+#include "app_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct nrf_async_task_s nrf_async_task_t;
+
+/**@brief Task function.
+ *
+ * @param[in] p_task Task being run.
+ */
+typedef void (* nrf_async_task_fn_t)(nrf_async_task_t * p_task);
+
+/**@brief Handler called when a task ends.
+ *
+ * @param[in] p_task Task that ended.
+ * @param[in] result Result passed to @ref NRF_ASYNC_EXIT, or NRF_SUCCESS.
+ */
+typedef void (* nrf_async_done_handler_t)(nrf_async_task_t * p_task, ret_code_t result);
+
+/**@brief Task structure. Only @ref nrf_async_task_t::p_context is meant to be used by the task. */
+struct nrf_async_task_s
+{
+    nrf_async_task_fn_t        fn;           /**< Task function. */
+    void                     * p_context;    /**< Task state, passed to @ref nrf_async_task_start. */
+    nrf_async_done_handler_t   done_handler; /**< Handler called when the task ends, or NULL. */
+    nrf_async_task_t         * p_parent;     /**< Task waiting for this one to end, or NULL. */
+    nrf_atomic_u32_t           refs;         /**< Pending operations, plus one while the task is running or scheduled. */
+    nrf_atomic_u32_t           result;       /**< First error of the operations of the current step. */
+    uint16_t                   lc;           /**< Line to resume the task function at. */
+    bool                       running;      /**< True from start until the task ends. */
+    app_timer_t                timer_data;   /**< Timer used by @ref NRF_ASYNC_SLEEP. */
+    app_timer_id_t             timer_id;     /**< Identifier of @ref nrf_async_task_t::timer_data. */
+};
+
+/**@brief Macro for starting the body of a task function.
+ *
+ * @param[in] _p_task Task being run.
+ */
+#define NRF_ASYNC_BEGIN(_p_task)  switch ((_p_task)->lc) { case 0:
+
+/**@brief Macro for ending the body of a task function. The task ends with NRF_SUCCESS.
+ *
+ * @param[in] _p_task Task being run.
+ */
+#define NRF_ASYNC_END(_p_task)                                \
+        nrf_async_task_exit((_p_task), NRF_SUCCESS);          \
+    } /* switch */                                            \
+    return
+
+/**@brief Macro for ending a task early.
+ *
+ * @param[in] _p_task Task being run.
+ * @param[in] _result Result passed to the done handler and to the parent task.
+ */
+#define NRF_ASYNC_EXIT(_p_task, _result)                      \
+    do                                                        \
+    {                                                         \
+        nrf_async_task_exit((_p_task), (_result));            \
+        return;                                               \
+    } while (0)
+
+/**@brief Macro for waiting until all operations started by the task have completed.
+ *
+ * @param[in]  _p_task   Task being run.
+ * @param[out] _err_code Variable set to the first error of the operations, or NRF_SUCCESS.
+ */
+#define NRF_ASYNC_AWAIT_ALL(_p_task, _err_code)               \
+    do                                                        \
+    {                                                         \
+        (_p_task)->lc = __LINE__;                             \
+        if (nrf_async_task_suspend(_p_task))                  \
+        {                                                     \
+            return;                                           \
+        }                                                     \
+        case __LINE__:                                        \
+        (_err_code) = nrf_async_task_result_take(_p_task);   \
+    } while (0)
+
+/**@brief Macro for letting other scheduler events run before the task continues.
+ *
+ * @param[in] _p_task Task being run.
+ */
+#define NRF_ASYNC_YIELD(_p_task)                              \
+    do                                                        \
+    {                                                         \
+        (_p_task)->lc = __LINE__;                             \
+        nrf_async_task_yield(_p_task);                        \
+        return;                                               \
+        case __LINE__:;                                       \
+    } while (0)
+
+/**@brief Macro for waiting for a number of app_timer ticks, and for all other operations of the
+ *        task.
+ *
+ * @param[in]  _p_task   Task being run.
+ * @param[in]  _ticks    Number of ticks, see APP_TIMER_TICKS.
+ * @param[out] _err_code Variable set to the first error of the operations, or NRF_SUCCESS.
+ */
+#define NRF_ASYNC_SLEEP(_p_task, _ticks, _err_code)           \
+    do                                                        \
+    {                                                         \
+        nrf_async_sleep_start((_p_task), (_ticks));           \
+        NRF_ASYNC_AWAIT_ALL((_p_task), (_err_code));          \
+    } while (0)
+
+/**@brief Function for starting a task.
+ *
+ * @details The task function is first run from the scheduler. If @p p_parent is not NULL, the
+ *          task is an operation of the parent, which completes with the result of the task.
+ *
+ * @param[out] p_task       Task structure, which must not be in use.
+ * @param[in]  fn           Task function.
+ * @param[in]  p_context    Task state.
+ * @param[in]  done_handler Handler called when the task ends, or NULL.
+ * @param[in]  p_parent     Task waiting for this one, or NULL.
+ *
+ * @retval NRF_SUCCESS             If the task was started.
+ * @retval NRF_ERROR_NULL          If @p p_task or @p fn is NULL.
+ * @retval NRF_ERROR_INVALID_STATE If the task is already running.
+ * @retval err_code                Otherwise, the error returned by app_timer_create or
+ *                                 app_sched_event_put.
+ */
+ret_code_t nrf_async_task_start(nrf_async_task_t       * p_task,
+                                nrf_async_task_fn_t      fn,
+                                void                   * p_context,
+                                nrf_async_done_handler_t done_handler,
+                                nrf_async_task_t       * p_parent);
+
+/**@brief Function for checking if a task is running.
+ *
+ * @param[in] p_task Task structure.
+ *
+ * @return True from @ref nrf_async_task_start until the task ends.
+ */
+bool nrf_async_task_is_running(nrf_async_task_t const * p_task);
+
+/**@brief Function for registering the start of an operation of a task.
+ *
+ * @details Called by modules that provide operations, before the operation is started. Each call
+ *          must be followed by exactly one call to @ref nrf_async_op_end, also if the operation
+ *          fails to start.
+ *
+ * @param[in] p_task Task that waits for the operation.
+ */
+void nrf_async_op_begin(nrf_async_task_t * p_task);
+
+/**@brief Function for registering the completion of an operation of a task.
+ *
+ * @details Can be called from any context. If this was the last operation the task waits for,
+ *          the task is resumed from the scheduler.
+ *
+ * @param[in] p_task   Task that waits for the operation.
+ * @param[in] err_code Result of the operation.
+ */
+void nrf_async_op_end(nrf_async_task_t * p_task, ret_code_t err_code);
+
+/**@brief Function for starting a delay as an operation of a task. Used by @ref NRF_ASYNC_SLEEP.
+ *
+ * @param[in] p_task Task being run.
+ * @param[in] ticks  Number of app_timer ticks.
+ */
+void nrf_async_sleep_start(nrf_async_task_t * p_task, uint32_t ticks);
+
+/**@cond */
+bool       nrf_async_task_suspend(nrf_async_task_t * p_task);
+void       nrf_async_task_yield(nrf_async_task_t * p_task);
+ret_code_t nrf_async_task_result_take(nrf_async_task_t * p_task);
+void       nrf_async_task_exit(nrf_async_task_t * p_task, ret_code_t result);
+/**@endcond */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_ASYNC_H__
+
+/** @} */
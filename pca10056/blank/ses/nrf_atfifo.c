@@ -44,6 +44,15 @@
 #include "app_util.h"
 #include "nrf_atfifo.h"
 #include "nrf_atfifo_internal.h"
+#include "nrf_atfifo_batch.h"
+#include "nrf_ramfunc.h"
+#include "nrf_mem_telemetry.h"
+
+#if NRF_ATFIFO_CONFIG_RAMFUNC_ENABLED
+#define ATFIFO_RAMFUNC NRF_RAMFUNC
+#else
+#define ATFIFO_RAMFUNC
+#endif
 
 #if NRF_ATFIFO_CONFIG_LOG_ENABLED
     #define NRF_LOG_LEVEL             NRF_ATFIFO_CONFIG_LOG_LEVEL
@@ -58,6 +67,123 @@
 /* Unions testing */
 STATIC_ASSERT(sizeof(nrf_atfifo_postag_t) == sizeof(uint32_t));
 
+#if NRF_ATFIFO_CONFIG_SPSC_ENABLED
+#include "nrf_atfifo_spsc.h"
+
+NRF_SECTION_DEF(atfifo_spsc, nrf_atfifo_t);
+
+/**@brief Function for checking if the FIFO was defined with NRF_ATFIFO_SPSC_DEF. */
+__STATIC_INLINE bool atfifo_is_spsc(nrf_atfifo_t const * const p_fifo)
+{
+    return ((void const *)p_fifo >= (void const *)NRF_SECTION_START_ADDR(atfifo_spsc)) &&
+           ((void const *)p_fifo <  (void const *)NRF_SECTION_END_ADDR(atfifo_spsc));
+}
+
+/*
+ * Single producer, single consumer versions of the space request and close functions.
+ * The tail positions are written only by the producer and the head positions only by the
+ * consumer, so plain stores are enough. Barriers keep the item data accesses on the right side
+ * of the position updates.
+ */
+ATFIFO_RAMFUNC static bool atfifo_spsc_wspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_tail)
+{
+    p_old_tail->tag = p_fifo->tail.tag;
+
+    uint16_t wr = p_old_tail->pos.wr + p_fifo->item_size;
+    if (wr >= p_fifo->buf_size)
+    {
+        wr = 0;
+    }
+    if (wr == ((nrf_atfifo_postag_t volatile *)&(p_fifo->head))->pos.wr)
+    {
+        return false;
+    }
+    p_fifo->tail.pos.wr = wr;
+    return true;
+}
+
+ATFIFO_RAMFUNC static void atfifo_spsc_wspace_close(nrf_atfifo_t * const p_fifo)
+{
+    // Item data must be written before it is made visible to the consumer.
+    __DMB();
+    ((nrf_atfifo_postag_t volatile *)&(p_fifo->tail))->pos.rd = p_fifo->tail.pos.wr;
+}
+
+ATFIFO_RAMFUNC static bool atfifo_spsc_rspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_head)
+{
+    uint16_t tail_rd = ((nrf_atfifo_postag_t volatile *)&(p_fifo->tail))->pos.rd;
+
+    p_old_head->tag = p_fifo->head.tag;
+    if (p_old_head->pos.rd == tail_rd)
+    {
+        return false;
+    }
+    // Item data must not be read before the position it was published with.
+    __DMB();
+
+    uint16_t rd = p_old_head->pos.rd + p_fifo->item_size;
+    if (rd >= p_fifo->buf_size)
+    {
+        rd = 0;
+    }
+    p_fifo->head.pos.rd = rd;
+    return true;
+}
+
+ATFIFO_RAMFUNC static void atfifo_spsc_rspace_close(nrf_atfifo_t * const p_fifo)
+{
+    // Item data must be read before the space is released to the producer.
+    __DMB();
+    ((nrf_atfifo_postag_t volatile *)&(p_fifo->head))->pos.wr = p_fifo->head.pos.rd;
+}
+#endif // NRF_ATFIFO_CONFIG_SPSC_ENABLED
+
+__STATIC_INLINE bool atfifo_wspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_tail)
+{
+#if NRF_ATFIFO_CONFIG_SPSC_ENABLED
+    if (atfifo_is_spsc(p_fifo))
+    {
+        return atfifo_spsc_wspace_req(p_fifo, p_old_tail);
+    }
+#endif
+    return nrf_atfifo_wspace_req(p_fifo, p_old_tail);
+}
+
+__STATIC_INLINE void atfifo_wspace_close(nrf_atfifo_t * const p_fifo)
+{
+#if NRF_ATFIFO_CONFIG_SPSC_ENABLED
+    if (atfifo_is_spsc(p_fifo))
+    {
+        atfifo_spsc_wspace_close(p_fifo);
+        return;
+    }
+#endif
+    nrf_atfifo_wspace_close(p_fifo);
+}
+
+__STATIC_INLINE bool atfifo_rspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_head)
+{
+#if NRF_ATFIFO_CONFIG_SPSC_ENABLED
+    if (atfifo_is_spsc(p_fifo))
+    {
+        return atfifo_spsc_rspace_req(p_fifo, p_old_head);
+    }
+#endif
+    return nrf_atfifo_rspace_req(p_fifo, p_old_head);
+}
+
+__STATIC_INLINE void atfifo_rspace_close(nrf_atfifo_t * const p_fifo)
+{
+#if NRF_ATFIFO_CONFIG_SPSC_ENABLED
+    if (atfifo_is_spsc(p_fifo))
+    {
+        atfifo_spsc_rspace_close(p_fifo);
+        return;
+    }
+#endif
+    nrf_atfifo_rspace_close(p_fifo);
+}
+
 
 ret_code_t nrf_atfifo_init(nrf_atfifo_t * const p_fifo, void * p_buf, uint16_t buf_size, uint16_t item_size)
 {
@@ -91,7 +217,7 @@ ret_code_t nrf_atfifo_clear(nrf_atfifo_t * const p_fifo)
 }
 
 
-ret_code_t nrf_atfifo_alloc_put(nrf_atfifo_t * const p_fifo, void const * p_var, size_t size, bool * const p_visible)
+ATFIFO_RAMFUNC ret_code_t nrf_atfifo_alloc_put(nrf_atfifo_t * const p_fifo, void const * p_var, size_t size, bool * const p_visible)
 {
     nrf_atfifo_item_put_t context;
     bool visible;
@@ -114,25 +240,28 @@ ret_code_t nrf_atfifo_alloc_put(nrf_atfifo_t * const p_fifo, void const * p_var,
 }
 
 
-void * nrf_atfifo_item_alloc(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
+ATFIFO_RAMFUNC void * nrf_atfifo_item_alloc(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
 {
-    if (nrf_atfifo_wspace_req(p_fifo, &(p_context->last_tail)))
+    if (atfifo_wspace_req(p_fifo, &(p_context->last_tail)))
     {
         void * p_item = ((uint8_t*)(p_fifo->p_buf)) + p_context->last_tail.pos.wr;
         NRF_LOG_INST_DEBUG(p_fifo->p_log, "Allocated  element (0x%08X).", p_item);
         return p_item;
     }
     NRF_LOG_INST_WARNING(p_fifo->p_log, "Allocation failed - no space.");
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+    nrf_mem_telemetry_failure_record(p_fifo);
+#endif
     return NULL;
 }
 
 
-bool nrf_atfifo_item_put(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
+ATFIFO_RAMFUNC bool nrf_atfifo_item_put(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
 {
     if ((p_context->last_tail.pos.wr) == (p_context->last_tail.pos.rd))
     {
         NRF_LOG_INST_DEBUG(p_fifo->p_log, "Put (uninterrupted)");
-        nrf_atfifo_wspace_close(p_fifo);
+        atfifo_wspace_close(p_fifo);
         return true;
     }
     NRF_LOG_INST_DEBUG(p_fifo->p_log, "Put (interrupted!)");
@@ -140,7 +269,7 @@ bool nrf_atfifo_item_put(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_
 }
 
 
-ret_code_t nrf_atfifo_get_free(nrf_atfifo_t * const p_fifo, void * const p_var, size_t size, bool * p_released)
+ATFIFO_RAMFUNC ret_code_t nrf_atfifo_get_free(nrf_atfifo_t * const p_fifo, void * const p_var, size_t size, bool * p_released)
 {
     nrf_atfifo_item_get_t context;
     bool released;
@@ -163,9 +292,9 @@ ret_code_t nrf_atfifo_get_free(nrf_atfifo_t * const p_fifo, void * const p_var,
 }
 
 
-void * nrf_atfifo_item_get(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
+ATFIFO_RAMFUNC void * nrf_atfifo_item_get(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
 {
-    if (nrf_atfifo_rspace_req(p_fifo, &(p_context->last_head)))
+    if (atfifo_rspace_req(p_fifo, &(p_context->last_head)))
     {
         void * p_item = ((uint8_t*)(p_fifo->p_buf)) + p_context->last_head.pos.rd;
         NRF_LOG_INST_DEBUG(p_fifo->p_log, "Get element: 0x%08X", p_item);
@@ -176,14 +305,286 @@ void * nrf_atfifo_item_get(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t *
 }
 
 
-bool nrf_atfifo_item_free(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
+ATFIFO_RAMFUNC bool nrf_atfifo_item_free(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
 {
     if ((p_context->last_head.pos.wr) == (p_context->last_head.pos.rd))
     {
         NRF_LOG_INST_DEBUG(p_fifo->p_log, "Free (uninterrupted)");
-        nrf_atfifo_rspace_close(p_fifo);
+        atfifo_rspace_close(p_fifo);
         return true;
     }
     NRF_LOG_INST_DEBUG(p_fifo->p_log, "Free (interrupted)");
     return false;
 }
+
+
+/**
+ * @brief Function for filling a span of items starting at the given buffer position.
+ */
+ATFIFO_RAMFUNC static void atfifo_span_set(nrf_atfifo_t const * const p_fifo,
+                                           uint16_t                   pos,
+                                           uint16_t                   count,
+                                           nrf_atfifo_span_t *        p_span)
+{
+    uint16_t to_end = (p_fifo->buf_size - pos) / p_fifo->item_size;
+
+    p_span->p_data[0] = ((uint8_t*)(p_fifo->p_buf)) + pos;
+    p_span->count[0]  = MIN(count, to_end);
+    p_span->count[1]  = count - p_span->count[0];
+    p_span->p_data[1] = (p_span->count[1] != 0) ? p_fifo->p_buf : NULL;
+}
+
+
+/**
+ * @brief Function for moving the tail write position by up to @p count items.
+ *
+ * @param[in]     p_fifo FIFO object.
+ * @param[in,out] p_tail Tail position to update.
+ * @param[in]     count  Number of items requested.
+ *
+ * @return Number of items the position was moved by.
+ */
+ATFIFO_RAMFUNC static uint16_t atfifo_wspace_n_move(nrf_atfifo_t const * const p_fifo,
+                                                    nrf_atfifo_postag_t *      p_tail,
+                                                    uint16_t                   count)
+{
+    uint16_t head_wr = ((nrf_atfifo_postag_t volatile *)&(p_fifo->head))->pos.wr;
+    uint16_t wr      = p_tail->pos.wr;
+    uint32_t space   = (head_wr > wr) ? (head_wr - wr) : (p_fifo->buf_size - wr + head_wr);
+
+    // One item is always left empty to tell a full FIFO from an empty one.
+    count = MIN(count, (space / p_fifo->item_size) - 1);
+
+    uint32_t new_wr = wr + (count * p_fifo->item_size);
+    if (new_wr >= p_fifo->buf_size)
+    {
+        new_wr -= p_fifo->buf_size;
+    }
+    p_tail->pos.wr = (uint16_t)new_wr;
+    return count;
+}
+
+
+/**
+ * @brief Function for moving the head read position by up to @p count items.
+ *
+ * @param[in]     p_fifo FIFO object.
+ * @param[in,out] p_head Head position to update.
+ * @param[in]     count  Number of items requested.
+ *
+ * @return Number of items the position was moved by.
+ */
+ATFIFO_RAMFUNC static uint16_t atfifo_rspace_n_move(nrf_atfifo_t const * const p_fifo,
+                                                    nrf_atfifo_postag_t *      p_head,
+                                                    uint16_t                   count)
+{
+    uint16_t tail_rd = ((nrf_atfifo_postag_t volatile *)&(p_fifo->tail))->pos.rd;
+    uint16_t rd      = p_head->pos.rd;
+    uint32_t used    = (tail_rd >= rd) ? (tail_rd - rd) : (p_fifo->buf_size - rd + tail_rd);
+
+    count = MIN(count, used / p_fifo->item_size);
+
+    uint32_t new_rd = rd + (count * p_fifo->item_size);
+    if (new_rd >= p_fifo->buf_size)
+    {
+        new_rd -= p_fifo->buf_size;
+    }
+    p_head->pos.rd = (uint16_t)new_rd;
+    return count;
+}
+
+
+/**
+ * @brief Function for reserving space for up to @p *p_count items in one exclusive access.
+ *
+ * Same as nrf_atfifo_wspace_req but moves the tail write position by several items.
+ */
+ATFIFO_RAMFUNC static bool atfifo_wspace_req_n(nrf_atfifo_t * const p_fifo,
+                                               uint16_t *           p_count,
+                                               nrf_atfifo_postag_t * p_old_tail)
+{
+    nrf_atfifo_postag_t new_tail;
+    uint16_t            count;
+
+#if NRF_ATFIFO_CONFIG_SPSC_ENABLED
+    if (atfifo_is_spsc(p_fifo))
+    {
+        p_old_tail->tag = p_fifo->tail.tag;
+        new_tail.tag    = p_old_tail->tag;
+        count = atfifo_wspace_n_move(p_fifo, &new_tail, *p_count);
+        if (count == 0)
+        {
+            return false;
+        }
+        p_fifo->tail.pos.wr = new_tail.pos.wr;
+        *p_count = count;
+        return true;
+    }
+#endif
+
+    do
+    {
+        p_old_tail->tag = __LDREXW(&(p_fifo->tail.tag));
+        new_tail.tag    = p_old_tail->tag;
+        count = atfifo_wspace_n_move(p_fifo, &new_tail, *p_count);
+        if (count == 0)
+        {
+            __CLREX();
+            return false;
+        }
+    } while (__STREXW(new_tail.tag, &(p_fifo->tail.tag)));
+
+    *p_count = count;
+    return true;
+}
+
+
+/**
+ * @brief Function for getting up to @p *p_count items in one exclusive access.
+ *
+ * Same as nrf_atfifo_rspace_req but moves the head read position by several items.
+ */
+ATFIFO_RAMFUNC static bool atfifo_rspace_req_n(nrf_atfifo_t * const p_fifo,
+                                               uint16_t *           p_count,
+                                               nrf_atfifo_postag_t * p_old_head)
+{
+    nrf_atfifo_postag_t new_head;
+    uint16_t            count;
+
+#if NRF_ATFIFO_CONFIG_SPSC_ENABLED
+    if (atfifo_is_spsc(p_fifo))
+    {
+        p_old_head->tag = p_fifo->head.tag;
+        new_head.tag    = p_old_head->tag;
+        count = atfifo_rspace_n_move(p_fifo, &new_head, *p_count);
+        if (count == 0)
+        {
+            return false;
+        }
+        // Item data must not be read before the position it was published with.
+        __DMB();
+        p_fifo->head.pos.rd = new_head.pos.rd;
+        *p_count = count;
+        return true;
+    }
+#endif
+
+    do
+    {
+        p_old_head->tag = __LDREXW(&(p_fifo->head.tag));
+        new_head.tag    = p_old_head->tag;
+        count = atfifo_rspace_n_move(p_fifo, &new_head, *p_count);
+        if (count == 0)
+        {
+            __CLREX();
+            return false;
+        }
+    } while (__STREXW(new_head.tag, &(p_fifo->head.tag)));
+
+    *p_count = count;
+    return true;
+}
+
+
+ATFIFO_RAMFUNC uint16_t nrf_atfifo_items_alloc(nrf_atfifo_t * const     p_fifo,
+                                               uint16_t                 count,
+                                               nrf_atfifo_span_t *      p_span,
+                                               nrf_atfifo_item_put_t *  p_context)
+{
+    if ((count != 0) && atfifo_wspace_req_n(p_fifo, &count, &(p_context->last_tail)))
+    {
+        atfifo_span_set(p_fifo, p_context->last_tail.pos.wr, count, p_span);
+        NRF_LOG_INST_DEBUG(p_fifo->p_log, "Allocated %d elements (0x%08X).", count, p_span->p_data[0]);
+        return count;
+    }
+    NRF_LOG_INST_WARNING(p_fifo->p_log, "Allocation failed - no space.");
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+    if (count != 0)
+    {
+        nrf_mem_telemetry_failure_record(p_fifo);
+    }
+#endif
+    return 0;
+}
+
+
+ATFIFO_RAMFUNC uint16_t nrf_atfifo_items_get(nrf_atfifo_t * const    p_fifo,
+                                             uint16_t                count,
+                                             nrf_atfifo_span_t *     p_span,
+                                             nrf_atfifo_item_get_t * p_context)
+{
+    if ((count != 0) && atfifo_rspace_req_n(p_fifo, &count, &(p_context->last_head)))
+    {
+        atfifo_span_set(p_fifo, p_context->last_head.pos.rd, count, p_span);
+        NRF_LOG_INST_DEBUG(p_fifo->p_log, "Get %d elements: 0x%08X", count, p_span->p_data[0]);
+        return count;
+    }
+    NRF_LOG_INST_WARNING(p_fifo->p_log, "Get failed - no item in the FIFO.");
+    return 0;
+}
+
+
+ATFIFO_RAMFUNC ret_code_t nrf_atfifo_alloc_put_n(nrf_atfifo_t * const p_fifo,
+                                                 void const *         p_var,
+                                                 uint16_t *           p_count,
+                                                 bool * const         p_visible)
+{
+    nrf_atfifo_item_put_t context;
+    nrf_atfifo_span_t     span;
+    bool visible;
+
+    *p_count = nrf_atfifo_items_alloc(p_fifo, *p_count, &span, &context);
+    if (*p_count == 0)
+    {
+        NRF_LOG_INST_WARNING(p_fifo->p_log, "Copying in elements (0x%08X) failed - no space.", p_var);
+        return NRF_ERROR_NO_MEM;
+    }
+
+    size_t len0 = span.count[0] * p_fifo->item_size;
+    memcpy(span.p_data[0], p_var, len0);
+    if (span.count[1] != 0)
+    {
+        memcpy(span.p_data[1], ((uint8_t const *)p_var) + len0, span.count[1] * p_fifo->item_size);
+    }
+
+    visible = nrf_atfifo_items_put(p_fifo, &context);
+    if (NULL != p_visible)
+    {
+        *p_visible = visible;
+    }
+    NRF_LOG_INST_DEBUG(p_fifo->p_log, "%d elements (0x%08X) copied in.", *p_count, p_var);
+    return NRF_SUCCESS;
+}
+
+
+ATFIFO_RAMFUNC ret_code_t nrf_atfifo_get_free_n(nrf_atfifo_t * const p_fifo,
+                                                void *               p_var,
+                                                uint16_t *           p_count,
+                                                bool *               p_released)
+{
+    nrf_atfifo_item_get_t context;
+    nrf_atfifo_span_t     span;
+    bool released;
+
+    *p_count = nrf_atfifo_items_get(p_fifo, *p_count, &span, &context);
+    if (*p_count == 0)
+    {
+        NRF_LOG_INST_WARNING(p_fifo->p_log, "Copying out failed - no item in the FIFO.");
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    size_t len0 = span.count[0] * p_fifo->item_size;
+    memcpy(p_var, span.p_data[0], len0);
+    if (span.count[1] != 0)
+    {
+        memcpy(((uint8_t *)p_var) + len0, span.p_data[1], span.count[1] * p_fifo->item_size);
+    }
+
+    released = nrf_atfifo_items_free(p_fifo, &context);
+    if (NULL != p_released)
+    {
+        *p_released = released;
+    }
+    NRF_LOG_INST_DEBUG(p_fifo->p_log, "%d elements (0x%08X) copied out.", *p_count, p_var);
+    return NRF_SUCCESS;
+}
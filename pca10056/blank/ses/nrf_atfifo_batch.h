@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_atfifo_batch Atomic FIFO batch access
+ * @{
+ * @ingroup nrf_atfifo
+ *
+ * @brief Reserving, committing, getting and freeing several items in one atomic operation.
+ *
+ * @details The batch functions work on the same FIFO instances as the single item functions and
+ *          can be mixed with them. A batch is reserved with one exclusive access round trip and
+ *          is described by a span of at most two segments, the second one is used when the batch
+ *          wraps at the end of the FIFO buffer. The batch is committed or freed with the same
+ *          rules as a single item: the data becomes visible (or the space released) when the
+ *          outermost pending operation finishes.
+ */
+
+#ifndef NRF_ATFIFO_BATCH_H__
+#define NRF_ATFIFO_BATCH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "nrf_atfifo.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Span of items in the FIFO buffer. */
+typedef struct
+{
+    void *   p_data[2]; ///< Start of the first segment and of the segment after the wrap (NULL if not used).
+    uint16_t count[2];  ///< Number of items in each segment.
+} nrf_atfifo_span_t;
+
+/**
+ * @brief Function for reserving space for up to @p count items.
+ *
+ * @param[in,out] p_fifo    FIFO object.
+ * @param[in]     count     Number of items requested.
+ * @param[out]    p_span    Span of the reserved items.
+ * @param[out]    p_context Context to pass to @ref nrf_atfifo_items_put.
+ *
+ * @return Number of items reserved, 0 if there is no space in the FIFO.
+ */
+uint16_t nrf_atfifo_items_alloc(nrf_atfifo_t * const     p_fifo,
+                                uint16_t                 count,
+                                nrf_atfifo_span_t *      p_span,
+                                nrf_atfifo_item_put_t *  p_context);
+
+/**
+ * @brief Function for committing items reserved with @ref nrf_atfifo_items_alloc.
+ *
+ * @param[in,out] p_fifo    FIFO object.
+ * @param[in]     p_context Context filled by @ref nrf_atfifo_items_alloc.
+ *
+ * @retval true  The items are visible to the consumer.
+ * @retval false The items will become visible when the interrupted allocation is committed.
+ */
+__STATIC_INLINE bool nrf_atfifo_items_put(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
+{
+    return nrf_atfifo_item_put(p_fifo, p_context);
+}
+
+/**
+ * @brief Function for getting up to @p count items from the FIFO.
+ *
+ * @param[in,out] p_fifo    FIFO object.
+ * @param[in]     count     Number of items requested.
+ * @param[out]    p_span    Span of the items.
+ * @param[out]    p_context Context to pass to @ref nrf_atfifo_items_free.
+ *
+ * @return Number of items got, 0 if the FIFO is empty.
+ */
+uint16_t nrf_atfifo_items_get(nrf_atfifo_t * const    p_fifo,
+                              uint16_t                count,
+                              nrf_atfifo_span_t *     p_span,
+                              nrf_atfifo_item_get_t * p_context);
+
+/**
+ * @brief Function for freeing items got with @ref nrf_atfifo_items_get.
+ *
+ * @param[in,out] p_fifo    FIFO object.
+ * @param[in]     p_context Context filled by @ref nrf_atfifo_items_get.
+ *
+ * @retval true  The space is released.
+ * @retval false The space will be released when the interrupted get is freed.
+ */
+__STATIC_INLINE bool nrf_atfifo_items_free(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
+{
+    return nrf_atfifo_item_free(p_fifo, p_context);
+}
+
+/**
+ * @brief Function for copying an array of items into the FIFO.
+ *
+ * @param[in,out] p_fifo    FIFO object.
+ * @param[in]     p_var     Array of items, each of the FIFO item size.
+ * @param[in,out] p_count   Number of items to copy in, set to the number of items copied.
+ * @param[out]    p_visible See @ref nrf_atfifo_items_put. May be NULL.
+ *
+ * @retval NRF_SUCCESS       At least one item was copied in.
+ * @retval NRF_ERROR_NO_MEM  There is no space in the FIFO.
+ */
+ret_code_t nrf_atfifo_alloc_put_n(nrf_atfifo_t * const p_fifo,
+                                  void const *         p_var,
+                                  uint16_t *           p_count,
+                                  bool * const         p_visible);
+
+/**
+ * @brief Function for copying an array of items out of the FIFO.
+ *
+ * @param[in,out] p_fifo     FIFO object.
+ * @param[out]    p_var      Array for the items, each of the FIFO item size.
+ * @param[in,out] p_count    Number of items to copy out, set to the number of items copied.
+ * @param[out]    p_released See @ref nrf_atfifo_items_free. May be NULL.
+ *
+ * @retval NRF_SUCCESS         At least one item was copied out.
+ * @retval NRF_ERROR_NOT_FOUND The FIFO is empty.
+ */
+ret_code_t nrf_atfifo_get_free_n(nrf_atfifo_t * const p_fifo,
+                                 void *               p_var,
+                                 uint16_t *           p_count,
+                                 bool *               p_released);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_ATFIFO_BATCH_H__
+
+/** @} */
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_atfifo_spsc Single producer, single consumer atomic FIFO
+ * @{
+ * @ingroup nrf_atfifo
+ *
+ * @brief Defining FIFO instances that skip the exclusive access loops.
+ *
+ * @details A FIFO defined with @ref NRF_ATFIFO_SPSC_DEF is used with the same functions as one
+ *          defined with NRF_ATFIFO_DEF. Such instances are placed in the atfifo_spsc section and
+ *          the FIFO functions tell them apart by address. For these instances the positions are
+ *          updated with plain loads and stores ordered with memory barriers, so there must be only
+ *          one context putting items and one context getting them, for example an interrupt
+ *          handler and the main loop. Nested allocation from the same context is still supported.
+ *
+ *          If NRF_ATFIFO_CONFIG_SPSC_ENABLED is not set, @ref NRF_ATFIFO_SPSC_DEF defines a regular
+ *          FIFO.
+ */
+
+#ifndef NRF_ATFIFO_SPSC_H__
+#define NRF_ATFIFO_SPSC_H__
+
+#include "sdk_common.h"
+#include "nrf_atfifo.h"
+#include "nrf_section.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if NRF_ATFIFO_CONFIG_SPSC_ENABLED || defined(__SDK_DOXYGEN__)
+/**
+ * @brief Macro for defining a single producer, single consumer FIFO.
+ *
+ * The FIFO is initialized with NRF_ATFIFO_INIT, same as a regular one.
+ *
+ * @param fifo_id      Identifier of the FIFO object.
+ * @param storage_type Type of the stored items.
+ * @param item_cnt     Capacity of the FIFO.
+ */
+#define NRF_ATFIFO_SPSC_DEF(fifo_id, storage_type, item_cnt)                                \
+    static storage_type NRF_ATFIFO_BUF_NAME(fifo_id)[(item_cnt)+1];                         \
+    NRF_LOG_INSTANCE_REGISTER(NRF_ATFIFO_LOG_NAME, fifo_id,                                 \
+                              NRF_ATFIFO_CONFIG_INFO_COLOR,                                 \
+                              NRF_ATFIFO_CONFIG_DEBUG_COLOR,                                \
+                              NRF_ATFIFO_CONFIG_LOG_INIT_FILTER_LEVEL,                      \
+                              NRF_ATFIFO_CONFIG_LOG_ENABLED ?                               \
+                                      NRF_ATFIFO_CONFIG_LOG_LEVEL : NRF_LOG_SEVERITY_NONE); \
+    NRF_SECTION_ITEM_REGISTER(atfifo_spsc, static nrf_atfifo_t NRF_ATFIFO_INST_NAME(fifo_id)) = \
+    {                                                                                       \
+        .p_buf = NULL,                                                                      \
+        NRF_LOG_INSTANCE_PTR_INIT(p_log, NRF_ATFIFO_LOG_NAME, fifo_id)                      \
+    };                                                                                      \
+    static nrf_atfifo_t * const fifo_id = &NRF_ATFIFO_INST_NAME(fifo_id)
+#else
+#define NRF_ATFIFO_SPSC_DEF(fifo_id, storage_type, item_cnt) \
+    NRF_ATFIFO_DEF(fifo_id, storage_type, item_cnt)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_ATFIFO_SPSC_H__
+
+/** @} */
@@ -38,6 +38,7 @@
  *
  */
 #include "nrf_atomic.h"
+#include "nrf_atomic_bitset.h"
 
 #ifndef NRF_ATOMIC_USE_BUILD_IN
 #if (defined(__GNUC__) && defined(WIN32))
@@ -447,3 +448,68 @@ uint32_t nrf_atomic_flag_clear(nrf_atomic_flag_t * p_data)
     return nrf_atomic_u32_and(p_data, 0);
 }
 
+
+void nrf_atomic_bitset_fetch_or(nrf_atomic_u32_t * p_set,
+                                uint32_t const   * p_mask,
+                                uint32_t         * p_old,
+                                size_t             word_cnt)
+{
+    for (size_t i = 0; i < word_cnt; i++)
+    {
+        uint32_t old_val = nrf_atomic_u32_fetch_or(&p_set[i], p_mask[i]);
+        if (p_old != NULL)
+        {
+            p_old[i] = old_val;
+        }
+    }
+}
+
+void nrf_atomic_bitset_fetch_and(nrf_atomic_u32_t * p_set,
+                                 uint32_t const   * p_mask,
+                                 uint32_t         * p_old,
+                                 size_t             word_cnt)
+{
+    for (size_t i = 0; i < word_cnt; i++)
+    {
+        uint32_t old_val = nrf_atomic_u32_fetch_and(&p_set[i], p_mask[i]);
+        if (p_old != NULL)
+        {
+            p_old[i] = old_val;
+        }
+    }
+}
+
+uint32_t nrf_atomic_bitset_find_first(nrf_atomic_u32_t const * p_set, size_t word_cnt)
+{
+    return nrf_atomic_bitset_find_next(p_set, word_cnt, 0);
+}
+
+uint32_t nrf_atomic_bitset_find_next(nrf_atomic_u32_t const * p_set,
+                                     size_t                   word_cnt,
+                                     uint32_t                 start)
+{
+    size_t   i    = start / 32;
+    uint32_t mask = UINT32_MAX << (start % 32);
+
+    for (; i < word_cnt; i++)
+    {
+        uint32_t word = p_set[i] & mask;
+        if (word != 0)
+        {
+            return (i * 32) + nrf_atomic_bits_find_first(word);
+        }
+        mask = UINT32_MAX;
+    }
+    return NRF_ATOMIC_BITSET_NONE;
+}
+
+uint32_t nrf_atomic_bitset_count(nrf_atomic_u32_t const * p_set, size_t word_cnt)
+{
+    uint32_t count = 0;
+
+    for (size_t i = 0; i < word_cnt; i++)
+    {
+        count += nrf_atomic_bits_count(p_set[i]);
+    }
+    return count;
+}
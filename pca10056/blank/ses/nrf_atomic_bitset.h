@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_atomic_bitset Atomic multi-word bitsets
+ * @{
+ * @ingroup nrf_atomic
+ *
+ * @brief Operations on bitsets stored in arrays of 32-bit words.
+ *
+ * @details Masks are applied with one atomic operation per word, so each word changes atomically
+ *          and the old value of each word is returned. The bitset as a whole is not updated in
+ *          one step. Searching and counting read each word once and use CLZ and RBIT instead of
+ *          testing bits one at a time. Bit @c n is bit <tt>n % 32</tt> of word <tt>n / 32</tt>,
+ *          the same layout as nrf_atflags.
+ */
+
+#ifndef NRF_ATOMIC_BITSET_H__
+#define NRF_ATOMIC_BITSET_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sdk_common.h"
+#include "nrf_atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Value returned by the search functions when no bit is set. */
+#define NRF_ATOMIC_BITSET_NONE  UINT32_MAX
+
+/**@brief Number of words needed for a bitset of @p bit_cnt bits. */
+#define NRF_ATOMIC_BITSET_WORDS(bit_cnt)  (((bit_cnt) + 31) / 32)
+
+/**
+ * @brief Function for finding the lowest set bit in a word.
+ *
+ * @param[in] value Word to search.
+ *
+ * @return Index of the lowest set bit or 32 if no bit is set.
+ */
+__STATIC_INLINE uint32_t nrf_atomic_bits_find_first(uint32_t value)
+{
+    // CLZ of 0 is 32 in hardware, but the compiler intrinsic may leave it undefined.
+    return (value == 0) ? 32 : __CLZ(__RBIT(value));
+}
+
+/**
+ * @brief Function for counting the set bits in a word.
+ *
+ * @param[in] value Word to count.
+ *
+ * @return Number of set bits.
+ */
+__STATIC_INLINE uint32_t nrf_atomic_bits_count(uint32_t value)
+{
+    value = value - ((value >> 1) & 0x55555555U);
+    value = (value & 0x33333333U) + ((value >> 2) & 0x33333333U);
+    value = (value + (value >> 4)) & 0x0F0F0F0FU;
+    return (value * 0x01010101U) >> 24;
+}
+
+/**
+ * @brief Function for setting the bits of a mask in a bitset.
+ *
+ * @param[in,out] p_set    Bitset.
+ * @param[in]     p_mask   Bits to set, @p word_cnt words.
+ * @param[out]    p_old    Old value of the bitset, @p word_cnt words. Can be NULL.
+ * @param[in]     word_cnt Number of words in the bitset.
+ */
+void nrf_atomic_bitset_fetch_or(nrf_atomic_u32_t * p_set,
+                                uint32_t const   * p_mask,
+                                uint32_t         * p_old,
+                                size_t             word_cnt);
+
+/**
+ * @brief Function for keeping only the bits of a mask in a bitset.
+ *
+ * @param[in,out] p_set    Bitset.
+ * @param[in]     p_mask   Bits to keep, @p word_cnt words.
+ * @param[out]    p_old    Old value of the bitset, @p word_cnt words. Can be NULL.
+ * @param[in]     word_cnt Number of words in the bitset.
+ */
+void nrf_atomic_bitset_fetch_and(nrf_atomic_u32_t * p_set,
+                                 uint32_t const   * p_mask,
+                                 uint32_t         * p_old,
+                                 size_t             word_cnt);
+
+/**
+ * @brief Function for finding the lowest set bit in a bitset.
+ *
+ * @param[in] p_set    Bitset.
+ * @param[in] word_cnt Number of words in the bitset.
+ *
+ * @return Index of the lowest set bit or @ref NRF_ATOMIC_BITSET_NONE if no bit is set.
+ */
+uint32_t nrf_atomic_bitset_find_first(nrf_atomic_u32_t const * p_set, size_t word_cnt);
+
+/**
+ * @brief Function for finding the lowest set bit at or above a given index.
+ *
+ * Used for iterating over the set bits without testing each bit.
+ *
+ * @param[in] p_set    Bitset.
+ * @param[in] word_cnt Number of words in the bitset.
+ * @param[in] start    Index of the first bit to consider.
+ *
+ * @return Index of the set bit or @ref NRF_ATOMIC_BITSET_NONE if no bit is set from @p start.
+ */
+uint32_t nrf_atomic_bitset_find_next(nrf_atomic_u32_t const * p_set,
+                                     size_t                   word_cnt,
+                                     uint32_t                 start);
+
+/**
+ * @brief Function for counting the set bits in a bitset.
+ *
+ * @param[in] p_set    Bitset.
+ * @param[in] word_cnt Number of words in the bitset.
+ *
+ * @return Number of set bits.
+ */
+uint32_t nrf_atomic_bitset_count(nrf_atomic_u32_t const * p_set, size_t word_cnt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_ATOMIC_BITSET_H__
+
+/** @} */
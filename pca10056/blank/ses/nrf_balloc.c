@@ -42,7 +42,26 @@
 
 #include "nrf_section.h"
 #include "nrf_balloc.h"
+#include "nrf_balloc_idx.h"
 #include "app_util_platform.h"
+#include "nrf_ramfunc.h"
+#include "nrf_mem_telemetry.h"
+
+#if NRF_BALLOC_CONFIG_RAMFUNC_ENABLED
+#define BALLOC_RAMFUNC NRF_RAMFUNC
+#else
+#define BALLOC_RAMFUNC
+#endif
+
+#include "app_util_basepri.h"
+
+#ifndef NRF_BALLOC_CONFIG_BASEPRI_CEILING
+#define NRF_BALLOC_CONFIG_BASEPRI_CEILING 0
+#endif
+APP_UTIL_BASEPRI_CEILING_CHECK(NRF_BALLOC_CONFIG_BASEPRI_CEILING);
+
+#define BALLOC_REGION_ENTER() APP_UTIL_BASEPRI_REGION_ENTER(NRF_BALLOC_CONFIG_BASEPRI_CEILING)
+#define BALLOC_REGION_EXIT()  APP_UTIL_BASEPRI_REGION_EXIT(NRF_BALLOC_CONFIG_BASEPRI_CEILING)
 
 
 #if NRF_BALLOC_CONFIG_LOG_ENABLED
@@ -97,9 +116,9 @@ static void nrf_balloc_status(nrf_cli_t const * p_cli, size_t argc, char **argv)
 
         uint32_t element_size = NRF_BALLOC_ELEMENT_SIZE(p_instance);
         uint32_t dbg_addon  = p_instance->block_size - element_size;
-        uint32_t pool_size  = p_instance->p_stack_limit - p_instance->p_stack_base;
+        uint32_t pool_size  = nrf_balloc_idx_pool_size_get(p_instance);
         uint32_t max_util   = nrf_balloc_max_utilization_get(p_instance);
-        uint32_t util       = nrf_balloc_utilization_get(p_instance);
+        uint32_t util       = nrf_balloc_idx_utilization_get(p_instance);
         const char * p_name = p_instance->p_name;
         nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL,
                         "%s\r\n\t- Element size:\t%d + %d bytes of debug information\r\n"
@@ -227,7 +246,7 @@ __STATIC_INLINE void * nrf_balloc_element_wrap(nrf_balloc_t const * p_pool, void
  *
  * @return      Pointer to the beginning of the block.
  */
-static void * nrf_balloc_idx2block(nrf_balloc_t const * p_pool, uint8_t idx)
+BALLOC_RAMFUNC static void * nrf_balloc_idx2block(nrf_balloc_t const * p_pool, nrf_balloc_idx_t idx)
 {
     ASSERT(p_pool != NULL);
     return (uint8_t *)(p_pool->p_memory_begin) + ((size_t)(idx) * p_pool->block_size);
@@ -240,15 +259,109 @@ static void * nrf_balloc_idx2block(nrf_balloc_t const * p_pool, uint8_t idx)
  *
  * @return      Index of the block.
  */
-static uint8_t nrf_balloc_block2idx(nrf_balloc_t const * p_pool, void const * p_block)
+BALLOC_RAMFUNC static nrf_balloc_idx_t nrf_balloc_block2idx(nrf_balloc_t const * p_pool, void const * p_block)
 {
     ASSERT(p_pool != NULL);
     return ((size_t)(p_block) - (size_t)(p_pool->p_memory_begin)) / p_pool->block_size;
 }
 
+#if NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+NRF_SECTION_DEF(balloc_idx, nrf_balloc_idx_t);
+
+/**@brief Function for checking if the pool was defined with the 16-bit stack of nrf_balloc_idx.h. */
+__STATIC_INLINE bool balloc_stack_is_wide(nrf_balloc_t const * p_pool)
+{
+    return ((void const *)p_pool->p_stack_base >= (void const *)NRF_SECTION_START_ADDR(balloc_idx)) &&
+           ((void const *)p_pool->p_stack_limit <= (void const *)NRF_SECTION_END_ADDR(balloc_idx));
+}
+#endif // NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+
+#if NRF_BALLOC_CONFIG_LOCKFREE_ENABLED
+#include "nrf_balloc_lockfree.h"
+
+NRF_SECTION_DEF(balloc_lockfree, nrf_balloc_cb_t);
+
+/**@brief Function for checking if the pool was defined with NRF_BALLOC_LOCKFREE_DEF. */
+__STATIC_INLINE bool balloc_is_lockfree(nrf_balloc_t const * p_pool)
+{
+    return ((void const *)p_pool->p_cb >= (void const *)NRF_SECTION_START_ADDR(balloc_lockfree)) &&
+           ((void const *)p_pool->p_cb <  (void const *)NRF_SECTION_END_ADDR(balloc_lockfree));
+}
+
+/**@brief Pop a free block index from the stack of a lock-free pool.
+ *
+ * The index is read between the exclusive load and store of the stack pointer. Any preemption
+ * in between clears the exclusive monitor and the sequence is retried on the updated stack.
+ *
+ * @param[in]   p_pool      Pointer to the memory pool.
+ *
+ * @return      Pointer to the beginning of the block or NULL if the pool is empty.
+ */
+BALLOC_RAMFUNC static void * balloc_lockfree_pop(nrf_balloc_t const * p_pool)
+{
+    volatile uint32_t * p_sp = (volatile uint32_t *)&p_pool->p_cb->p_stack_pointer;
+    nrf_balloc_idx_t *  p_stack_pointer;
+    nrf_balloc_idx_t    idx;
+
+    do
+    {
+        p_stack_pointer = (nrf_balloc_idx_t *)__LDREXW(p_sp);
+        if (p_stack_pointer <= (nrf_balloc_idx_t *)p_pool->p_stack_base)
+        {
+            __CLREX();
+            return NULL;
+        }
+        idx = *--p_stack_pointer;
+    } while (__STREXW((uint32_t)p_stack_pointer, p_sp));
+    __DMB();
+
+    // Update utilization statistics, saturated to the 8-bit statistics field. The update is not
+    // synchronized, a concurrent peak may be missed.
+    size_t utilization = MIN((nrf_balloc_idx_t *)p_pool->p_stack_limit - p_stack_pointer,
+                             UINT8_MAX);
+    if (p_pool->p_cb->max_utilization < utilization)
+    {
+        p_pool->p_cb->max_utilization = utilization;
+    }
+
+    return nrf_balloc_idx2block(p_pool, idx);
+}
+
+/**@brief Push a free block index to the stack of a lock-free pool.
+ *
+ * The index is written above the current top before the stack pointer is moved, so two pushes
+ * must not overlap: one preempting the other between the write and the store would write the
+ * same slot, and the retry of the preempted one would overwrite the other index. Pushes are
+ * therefore serialized with the same region as regular pools. Pops never write the stack, so a
+ * pop preempting a push only makes its store fail, and the index is written again above the
+ * new top.
+ *
+ * @param[in]   p_pool      Pointer to the memory pool.
+ * @param[in]   idx         Index of the block.
+ */
+BALLOC_RAMFUNC static void balloc_lockfree_push(nrf_balloc_t const * p_pool, nrf_balloc_idx_t idx)
+{
+    volatile uint32_t * p_sp = (volatile uint32_t *)&p_pool->p_cb->p_stack_pointer;
+    nrf_balloc_idx_t *  p_stack_pointer;
+
+    BALLOC_REGION_ENTER();
+
+    __DMB();
+    do
+    {
+        p_stack_pointer = (nrf_balloc_idx_t *)__LDREXW(p_sp);
+        ASSERT(p_stack_pointer < (nrf_balloc_idx_t *)p_pool->p_stack_limit);
+        *p_stack_pointer++ = idx;
+    } while (__STREXW((uint32_t)p_stack_pointer, p_sp));
+
+    BALLOC_REGION_EXIT();
+}
+#endif // NRF_BALLOC_CONFIG_LOCKFREE_ENABLED
+
 ret_code_t nrf_balloc_init(nrf_balloc_t const * p_pool)
 {
-    uint8_t pool_size;
+    size_t             pool_size;
+    nrf_balloc_idx_t * p_stack_pointer;
 
     VERIFY_PARAM_NOT_NULL(p_pool);
 
@@ -258,7 +371,16 @@ ret_code_t nrf_balloc_init(nrf_balloc_t const * p_pool)
     ASSERT(p_pool->p_memory_begin);
     ASSERT(p_pool->block_size);
 
-    pool_size       = p_pool->p_stack_limit - p_pool->p_stack_base;
+#if NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+    if (!balloc_stack_is_wide(p_pool))
+    {
+        // Defined with the 8-bit stack of nrf_balloc.h, too small for 16-bit indices.
+        NRF_LOG_INST_ERROR(p_pool->p_log, "Pool defined without nrf_balloc_idx.h.");
+        return NRF_ERROR_INVALID_PARAM;
+    }
+#endif
+
+    pool_size       = nrf_balloc_idx_pool_size_get(p_pool);
 
 #if NRF_BALLOC_CONFIG_DEBUG_ENABLED
     void *p_memory_end = (uint8_t *)(p_pool->p_memory_begin) + (pool_size * p_pool->block_size);
@@ -276,39 +398,59 @@ ret_code_t nrf_balloc_init(nrf_balloc_t const * p_pool)
                       p_pool->block_size,
                       pool_size * p_pool->block_size);
 
-    p_pool->p_cb->p_stack_pointer = p_pool->p_stack_base;
+    p_stack_pointer = (nrf_balloc_idx_t *)p_pool->p_stack_base;
     while (pool_size--)
     {
-        *(p_pool->p_cb->p_stack_pointer)++ = pool_size;
+        *p_stack_pointer++ = pool_size;
     }
+    p_pool->p_cb->p_stack_pointer = (uint8_t *)p_stack_pointer;
 
     p_pool->p_cb->max_utilization = 0;
 
     return NRF_SUCCESS;
 }
 
-void * nrf_balloc_alloc(nrf_balloc_t const * p_pool)
+BALLOC_RAMFUNC void * nrf_balloc_alloc(nrf_balloc_t const * p_pool)
 {
     ASSERT(p_pool != NULL);
 
     void * p_block = NULL;
 
-    CRITICAL_REGION_ENTER();
-
-    if (p_pool->p_cb->p_stack_pointer > p_pool->p_stack_base)
+#if NRF_BALLOC_CONFIG_LOCKFREE_ENABLED
+    if (balloc_is_lockfree(p_pool))
     {
-        // Allocate block.
-        p_block = nrf_balloc_idx2block(p_pool, *--(p_pool->p_cb->p_stack_pointer));
+        p_block = balloc_lockfree_pop(p_pool);
+    }
+    else
+#endif
+    {
+        BALLOC_REGION_ENTER();
+
+        nrf_balloc_idx_t * p_stack_pointer = (nrf_balloc_idx_t *)p_pool->p_cb->p_stack_pointer;
 
-        // Update utilization statistics.
-        uint8_t utilization = p_pool->p_stack_limit - p_pool->p_cb->p_stack_pointer;
-        if (p_pool->p_cb->max_utilization < utilization)
+        if (p_stack_pointer > (nrf_balloc_idx_t *)p_pool->p_stack_base)
         {
-            p_pool->p_cb->max_utilization = utilization;
+            // Allocate block.
+            p_block = nrf_balloc_idx2block(p_pool, *--p_stack_pointer);
+            p_pool->p_cb->p_stack_pointer = (uint8_t *)p_stack_pointer;
+
+            // Update utilization statistics, saturated to the 8-bit statistics field.
+            size_t utilization = MIN(nrf_balloc_idx_utilization_get(p_pool), UINT8_MAX);
+            if (p_pool->p_cb->max_utilization < utilization)
+            {
+                p_pool->p_cb->max_utilization = utilization;
+            }
         }
+
+        BALLOC_REGION_EXIT();
     }
 
-    CRITICAL_REGION_EXIT();
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+    if (p_block == NULL)
+    {
+        nrf_mem_telemetry_failure_record(p_pool);
+    }
+#endif
 
 #if NRF_BALLOC_CONFIG_DEBUG_ENABLED
     if (p_block != NULL)
@@ -322,7 +464,7 @@ void * nrf_balloc_alloc(nrf_balloc_t const * p_pool)
     return p_block;
 }
 
-void nrf_balloc_free(nrf_balloc_t const * p_pool, void * p_element)
+BALLOC_RAMFUNC void nrf_balloc_free(nrf_balloc_t const * p_pool, void * p_element)
 {
     ASSERT(p_pool != NULL);
     ASSERT(p_element != NULL)
@@ -335,7 +477,7 @@ void nrf_balloc_free(nrf_balloc_t const * p_pool, void * p_element)
     // These checks could be done outside critical region as they use only pool configuration data.
     if (NRF_BALLOC_DEBUG_BASIC_CHECKS_GET(p_pool->debug_flags))
     {
-        uint8_t pool_size  = p_pool->p_stack_limit - p_pool->p_stack_base;
+        size_t pool_size   = nrf_balloc_idx_pool_size_get(p_pool);
         void *p_memory_end = (uint8_t *)(p_pool->p_memory_begin) + (pool_size * p_pool->block_size);
 
         // Check if the element belongs to this pool.
@@ -359,7 +501,15 @@ void nrf_balloc_free(nrf_balloc_t const * p_pool, void * p_element)
     void * p_block = p_element;
 #endif // NRF_BALLOC_CONFIG_DEBUG_ENABLED
 
-    CRITICAL_REGION_ENTER();
+#if NRF_BALLOC_CONFIG_LOCKFREE_ENABLED
+    if (balloc_is_lockfree(p_pool))
+    {
+        balloc_lockfree_push(p_pool, nrf_balloc_block2idx(p_pool, p_block));
+        return;
+    }
+#endif
+
+    BALLOC_REGION_ENTER();
 
 #if NRF_BALLOC_CONFIG_DEBUG_ENABLED
     // These checks have to be done in critical region as they use p_pool->p_stack_pointer.
@@ -378,7 +528,9 @@ void nrf_balloc_free(nrf_balloc_t const * p_pool, void * p_element)
     if (NRF_BALLOC_DEBUG_DOUBLE_FREE_CHECK_GET(p_pool->debug_flags))
     {
         // Check for double free.
-        for (uint8_t * p_idx = p_pool->p_stack_base; p_idx < p_pool->p_cb->p_stack_pointer; p_idx++)
+        for (nrf_balloc_idx_t * p_idx = (nrf_balloc_idx_t *)p_pool->p_stack_base;
+             p_idx < (nrf_balloc_idx_t *)p_pool->p_cb->p_stack_pointer;
+             p_idx++)
         {
             if (nrf_balloc_idx2block(p_pool, *p_idx) == p_block)
             {
@@ -391,9 +543,11 @@ void nrf_balloc_free(nrf_balloc_t const * p_pool, void * p_element)
 #endif // NRF_BALLOC_CONFIG_DEBUG_ENABLED
 
     // Free the element.
-    *(p_pool->p_cb->p_stack_pointer)++ = nrf_balloc_block2idx(p_pool, p_block);
+    nrf_balloc_idx_t * p_stack_pointer = (nrf_balloc_idx_t *)p_pool->p_cb->p_stack_pointer;
+    *p_stack_pointer++ = nrf_balloc_block2idx(p_pool, p_block);
+    p_pool->p_cb->p_stack_pointer = (uint8_t *)p_stack_pointer;
 
-    CRITICAL_REGION_EXIT();
+    BALLOC_REGION_EXIT();
 }
 
 #endif // NRF_MODULE_ENABLED(NRF_BALLOC)
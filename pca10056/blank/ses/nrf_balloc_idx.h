@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_balloc_idx Block allocator free list index width
+ * @{
+ * @ingroup nrf_balloc
+ *
+ * @brief Type of the free block indices kept on the nrf_balloc stack.
+ *
+ * @details By default a free block is identified by an 8-bit index, so a pool holds at most
+ *          255 blocks. With NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED the indices are 16-bit and a pool
+ *          can hold up to 65535 blocks. In this mode this header redefines NRF_BALLOC_DBG_DEF (and so
+ *          NRF_BALLOC_DEF) to allocate the wider stack. It must be included after nrf_balloc.h in
+ *          every file defining a pool. Allocation and release stay O(1).
+ *
+ *          The wider stacks are placed in the balloc_idx section. A pool defined where this header
+ *          was not included has an 8-bit stack outside of it, and nrf_balloc_init() rejects it
+ *          with NRF_ERROR_INVALID_PARAM instead of overrunning the stack. Pools defined in SDK
+ *          sources, such as the nrf_log message pool, are rejected too unless these sources are
+ *          built with this header, for example as a forced include.
+ *
+ * @note nrf_balloc_utilization_get() and nrf_balloc_max_utilization_get() return 8-bit values.
+ *       Use @ref nrf_balloc_idx_utilization_get for pools larger than 255 blocks. The maximum
+ *       utilization saturates at 255.
+ */
+
+#ifndef NRF_BALLOC_IDX_H__
+#define NRF_BALLOC_IDX_H__
+
+#include "sdk_common.h"
+#include "nrf_balloc.h"
+#include "nrf_section.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+typedef uint16_t nrf_balloc_idx_t;      ///< Free block index.
+#define NRF_BALLOC_IDX_MAX  UINT16_MAX  ///< Maximum number of blocks in a pool.
+#else
+typedef uint8_t nrf_balloc_idx_t;       ///< Free block index.
+#define NRF_BALLOC_IDX_MAX  UINT8_MAX   ///< Maximum number of blocks in a pool.
+#endif // NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+
+/**@brief Control block declaration used by @ref NRF_BALLOC_IDX_POOL_DEF for regular pools. */
+#define NRF_BALLOC_IDX_CB_DECLARE(_cb_decl) _cb_decl
+
+#if NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+/**@brief Free block stack declaration used by @ref NRF_BALLOC_IDX_POOL_DEF. */
+#define NRF_BALLOC_IDX_STACK_DECLARE(_stack_decl) NRF_SECTION_ITEM_REGISTER(balloc_idx, _stack_decl)
+#else
+#define NRF_BALLOC_IDX_STACK_DECLARE(_stack_decl) _stack_decl
+#endif // NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+
+/**
+ * @brief Macro for defining a pool with a stack of @ref nrf_balloc_idx_t indices.
+ *
+ * Same as NRF_BALLOC_DBG_DEF, the control block is declared through @p _cb_declare so that it
+ * can be placed in a section.
+ *
+ * @param _name         Name of the allocator.
+ * @param _element_size Size of one element.
+ * @param _pool_size    Size of the pool.
+ * @param _debug_flags  Debug flags.
+ * @param _cb_declare   Macro taking the control block declaration.
+ */
+#define NRF_BALLOC_IDX_POOL_DEF(_name, _element_size, _pool_size, _debug_flags, _cb_declare)   \
+    STATIC_ASSERT((_pool_size) <= NRF_BALLOC_IDX_MAX);                                          \
+    NRF_BALLOC_IDX_STACK_DECLARE(                                                               \
+        static nrf_balloc_idx_t   CONCAT_2(_name, _nrf_balloc_pool_stack)[(_pool_size)]);       \
+    static uint32_t               CONCAT_2(_name,_nrf_balloc_pool_mem)                          \
+        [NRF_BALLOC_BLOCK_SIZE(_element_size, _debug_flags) * (_pool_size) / sizeof(uint32_t)]; \
+    _cb_declare(static nrf_balloc_cb_t CONCAT_2(_name,_nrf_balloc_cb));                         \
+    NRF_LOG_INSTANCE_REGISTER(NRF_BALLOC_LOG_NAME, _name,                                       \
+                              NRF_BALLOC_CONFIG_INFO_COLOR,                                     \
+                              NRF_BALLOC_CONFIG_DEBUG_COLOR,                                    \
+                              NRF_BALLOC_CONFIG_INITIAL_LOG_LEVEL,                              \
+                              NRF_BALLOC_CONFIG_LOG_ENABLED ?                                   \
+                                      NRF_BALLOC_CONFIG_LOG_LEVEL : NRF_LOG_SEVERITY_NONE);     \
+    NRF_SECTION_ITEM_REGISTER(nrf_balloc, const nrf_balloc_t _name) =                           \
+        {                                                                                       \
+            .p_cb           = &CONCAT_2(_name,_nrf_balloc_cb),                                  \
+            .p_stack_base   = (uint8_t *)CONCAT_2(_name,_nrf_balloc_pool_stack),                \
+            .p_stack_limit  = (uint8_t *)(CONCAT_2(_name,_nrf_balloc_pool_stack) + (_pool_size)), \
+            .p_memory_begin = CONCAT_2(_name,_nrf_balloc_pool_mem),                             \
+            .block_size     = NRF_BALLOC_BLOCK_SIZE(_element_size, _debug_flags),               \
+                                                                                                \
+            NRF_LOG_INSTANCE_PTR_INIT(p_log, NRF_BALLOC_LOG_NAME, _name)                        \
+            __NRF_BALLOC_ASSIGN_POOL_NAME(_name)                                                \
+            __NRF_BALLOC_ASSIGN_DEBUG_FLAGS(_debug_flags)                                       \
+        }
+
+#if NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+#undef NRF_BALLOC_DBG_DEF
+#define NRF_BALLOC_DBG_DEF(_name, _element_size, _pool_size, _debug_flags)                      \
+    NRF_BALLOC_IDX_POOL_DEF(_name, _element_size, _pool_size, _debug_flags,                     \
+                            NRF_BALLOC_IDX_CB_DECLARE)
+#endif // NRF_BALLOC_CONFIG_IDX_16BIT_ENABLED
+
+/**
+ * @brief Function for getting the number of blocks in the pool.
+ *
+ * @param[in] p_pool Pointer to the memory pool.
+ *
+ * @return Number of blocks.
+ */
+__STATIC_INLINE size_t nrf_balloc_idx_pool_size_get(nrf_balloc_t const * p_pool)
+{
+    return (nrf_balloc_idx_t const *)p_pool->p_stack_limit -
+           (nrf_balloc_idx_t const *)p_pool->p_stack_base;
+}
+
+/**
+ * @brief Function for getting the number of blocks currently allocated.
+ *
+ * @param[in] p_pool Pointer to the memory pool.
+ *
+ * @return Number of allocated blocks.
+ */
+__STATIC_INLINE size_t nrf_balloc_idx_utilization_get(nrf_balloc_t const * p_pool)
+{
+    return (nrf_balloc_idx_t const *)p_pool->p_stack_limit -
+           (nrf_balloc_idx_t const *)p_pool->p_cb->p_stack_pointer;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BALLOC_IDX_H__
+
+/** @} */
@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_balloc_lockfree Lock-free block allocator pools
+ * @{
+ * @ingroup nrf_balloc
+ *
+ * @brief Defining block allocator pools that are allocated and released without critical regions.
+ *
+ * @details A pool defined with @ref NRF_BALLOC_LOCKFREE_DEF is used with the same functions as one
+ *          defined with NRF_BALLOC_DEF. Its control block is placed in the balloc_lockfree section
+ *          and nrf_balloc_alloc() and nrf_balloc_free() tell such pools apart by address. For these
+ *          pools nrf_balloc_alloc() takes a block with exclusive load and store instructions
+ *          instead of a critical region, so allocating from interrupt handlers does not add to
+ *          the interrupt latency of the application.
+ *
+ *          The exclusive monitor is cleared on exception entry and return. If an allocation is
+ *          preempted between reading the free block index and storing the new stack pointer, the
+ *          store fails and the sequence is retried, so the index cannot be taken from a stack that
+ *          was changed in between.
+ *
+ *          nrf_balloc_free() writes the index above the top of the stack before storing the
+ *          stack pointer, and two releases interleaved there would write the same slot. Releases
+ *          are therefore serialized with the same region as for regular pools (a critical region,
+ *          or the BASEPRI ceiling NRF_BALLOC_CONFIG_BASEPRI_CEILING), and a lock-free pool must
+ *          not be released to from interrupts above that ceiling.
+ *
+ *          If NRF_BALLOC_CONFIG_LOCKFREE_ENABLED is not set, @ref NRF_BALLOC_LOCKFREE_DEF defines a
+ *          regular pool.
+ *
+ * @note The debug checks that read the free block stack (double free and allocated/free balance)
+ *       are skipped for lock-free pools. The maximum utilization is updated without
+ *       synchronization and may miss a concurrent peak.
+ */
+
+#ifndef NRF_BALLOC_LOCKFREE_H__
+#define NRF_BALLOC_LOCKFREE_H__
+
+#include "sdk_common.h"
+#include "nrf_balloc.h"
+#include "nrf_balloc_idx.h"
+#include "nrf_section.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if NRF_BALLOC_CONFIG_LOCKFREE_ENABLED || defined(__SDK_DOXYGEN__)
+/**@brief Control block declaration used by @ref NRF_BALLOC_IDX_POOL_DEF for lock-free pools. */
+#define NRF_BALLOC_LOCKFREE_CB_DECLARE(_cb_decl) NRF_SECTION_ITEM_REGISTER(balloc_lockfree, _cb_decl)
+
+/**
+ * @brief Macro for defining a lock-free pool.
+ *
+ * The pool is initialized with nrf_balloc_init(), same as a regular one.
+ *
+ * @param _name         Name of the allocator.
+ * @param _element_size Size of one element.
+ * @param _pool_size    Size of the pool.
+ */
+#define NRF_BALLOC_LOCKFREE_DEF(_name, _element_size, _pool_size)                               \
+    NRF_BALLOC_IDX_POOL_DEF(_name, _element_size, _pool_size, NRF_BALLOC_DEFAULT_DEBUG_FLAGS,   \
+                            NRF_BALLOC_LOCKFREE_CB_DECLARE)
+#else
+#define NRF_BALLOC_LOCKFREE_DEF(_name, _element_size, _pool_size) \
+    NRF_BALLOC_DEF(_name, _element_size, _pool_size)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BALLOC_LOCKFREE_H__
+
+/** @} */
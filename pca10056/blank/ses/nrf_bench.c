@@ -0,0 +1,667 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BENCH)
+#include "nrf_bench.h"
+#include <string.h>
+#include "nrf.h"
+#include "nrf_atfifo.h"
+#include "nrf_balloc.h"
+#include "nrf_balloc_idx.h"
+#include "nrf_fprintf.h"
+#include "nrf_memobj.h"
+#include "nrf_ringbuf.h"
+#include "nrf_sortlist.h"
+#if NRF_BENCH_CONFIG_ADVDATA_ENABLED
+#include "ble_advdata.h"
+#endif
+
+#define NRF_LOG_MODULE_NAME nrf_bench
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#ifndef NRF_BENCH_CYCLES_GET
+#define NRF_BENCH_DWT           1                       /**< The DWT cycle counter is used, and must be enabled. */
+#define NRF_BENCH_CYCLES_GET()  (DWT->CYCCNT)           /**< Current value of the cycle counter. */
+#endif
+
+#ifndef NRF_BENCH_CLOCK_HZ
+#define NRF_BENCH_CLOCK_HZ      SystemCoreClock         /**< Frequency of the cycle counter. */
+#endif
+
+#define FIFO_SIZE               16                      /**< Number of items of the atomic FIFO. */
+#define BALLOC_POOL_SIZE        16                      /**< Number of blocks of the block allocator pool. */
+#define BALLOC_IN_USE           (BALLOC_POOL_SIZE / 2)  /**< Number of blocks kept allocated during the workload. */
+#define RINGBUF_SIZE            256                     /**< Size of the ring buffer, a power of 2. */
+#define RINGBUF_OP_LEN          16                      /**< Number of bytes of each put and get. */
+#define MEMOBJ_CHUNK_SIZE       32                      /**< Size of a memory object chunk. */
+#define MEMOBJ_POOL_SIZE        8                       /**< Number of chunks of the memory object pool. */
+#define MEMOBJ_OBJ_SIZE         64                      /**< Size of each memory object. */
+#define SORTLIST_MAX            256                     /**< Largest number of items in the sorted list. */
+#define FPRINTF_OUT_SIZE        64                      /**< Size of the formatted output buffer. */
+
+NRF_ATFIFO_DEF(m_fifo, uint32_t, FIFO_SIZE);
+NRF_BALLOC_DEF(m_balloc_pool, 32, BALLOC_POOL_SIZE);
+NRF_RINGBUF_DEF(m_ringbuf, RINGBUF_SIZE);
+NRF_MEMOBJ_POOL_DEF(m_memobj_pool, MEMOBJ_CHUNK_SIZE, MEMOBJ_POOL_SIZE);
+
+/**@brief Sorted list item with its key. */
+typedef struct
+{
+    nrf_sortlist_item_t item;   ///< Sorted list item.
+    uint32_t            key;    ///< Key the list is sorted by.
+} sortlist_entry_t;
+
+static bool sortlist_compare(nrf_sortlist_item_t * p_item0, nrf_sortlist_item_t * p_item1);
+
+NRF_SORTLIST_DEF(m_sortlist, sortlist_compare);
+
+static sortlist_entry_t m_sortlist_entries[SORTLIST_MAX + 1];   ///< Items of the list, and the item inserted.
+
+static void fprintf_write(void const * p_user_ctx, char const * p_str, size_t length);
+
+static char   m_fprintf_io[16];             ///< I/O buffer of the fprintf context.
+static char   m_fprintf_out[FPRINTF_OUT_SIZE]; ///< Formatted output.
+static size_t m_fprintf_out_len;            ///< Length of the formatted output.
+
+NRF_FPRINTF_DEF(m_fprintf, NULL, m_fprintf_io, sizeof(m_fprintf_io), true, fprintf_write);
+
+static uint32_t m_seed = 0x2545F491;        ///< State of the pseudo-random generator.
+static uint32_t m_overhead;                 ///< Cycles spent in reading the cycle counter twice.
+
+
+/**@brief Function for getting a pseudo-random number. */
+static uint32_t random_get(void)
+{
+    // xorshift32
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+
+    return m_seed;
+}
+
+
+/**@brief Function for comparing the keys of two sorted list items.
+ *
+ * @return True if @p p_item0 is to be placed before @p p_item1.
+ */
+static bool sortlist_compare(nrf_sortlist_item_t * p_item0, nrf_sortlist_item_t * p_item1)
+{
+    return CONTAINER_OF(p_item0, sortlist_entry_t, item)->key <=
+           CONTAINER_OF(p_item1, sortlist_entry_t, item)->key;
+}
+
+
+/**@brief Function for collecting the output of fprintf.
+ *
+ * @param[in] p_user_ctx Not used.
+ * @param[in] p_str      Formatted string.
+ * @param[in] length     Length of the string.
+ */
+static void fprintf_write(void const * p_user_ctx, char const * p_str, size_t length)
+{
+    size_t copy = MIN(length, sizeof(m_fprintf_out) - m_fprintf_out_len);
+
+    UNUSED_PARAMETER(p_user_ctx);
+
+    memcpy(&m_fprintf_out[m_fprintf_out_len], p_str, copy);
+    m_fprintf_out_len += copy;
+}
+
+
+/**@brief Function for running the atomic FIFO workload.
+ *
+ * @param[in]  ops      Number of operations.
+ * @param[out] p_cycles Cycles spent in the operations.
+ */
+static ret_code_t atfifo_run(uint32_t ops, uint32_t * p_cycles)
+{
+    uint32_t start = NRF_BENCH_CYCLES_GET();
+
+    for (uint32_t i = 0; i < ops; i++)
+    {
+        uint32_t   value;
+        bool       flag;
+        ret_code_t err_code = nrf_atfifo_alloc_put(m_fifo, &i, sizeof(i), &flag);
+
+        VERIFY_SUCCESS(err_code);
+
+        err_code = nrf_atfifo_get_free(m_fifo, &value, sizeof(value), &flag);
+        VERIFY_SUCCESS(err_code);
+
+        if (value != i)
+        {
+            return NRF_ERROR_INTERNAL;
+        }
+    }
+
+    *p_cycles = NRF_BENCH_CYCLES_GET() - start;
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for running the block allocator workload.
+ *
+ * @param[in]  ops      Number of operations.
+ * @param[out] p_cycles Cycles spent in the operations.
+ */
+static ret_code_t balloc_run(uint32_t ops, uint32_t * p_cycles)
+{
+    void     * p_blocks[BALLOC_IN_USE];
+    ret_code_t err_code = NRF_SUCCESS;
+    uint32_t   start;
+
+    for (uint32_t i = 0; i < BALLOC_IN_USE; i++)
+    {
+        p_blocks[i] = nrf_balloc_alloc(&m_balloc_pool);
+    }
+
+    start = NRF_BENCH_CYCLES_GET();
+
+    for (uint32_t i = 0; (i < ops) && (err_code == NRF_SUCCESS); i++)
+    {
+        uint32_t idx = random_get() % BALLOC_IN_USE;
+
+        nrf_balloc_free(&m_balloc_pool, p_blocks[idx]);
+        p_blocks[idx] = nrf_balloc_alloc(&m_balloc_pool);
+
+        if (p_blocks[idx] == NULL)
+        {
+            err_code = NRF_ERROR_INTERNAL;
+        }
+    }
+
+    *p_cycles = NRF_BENCH_CYCLES_GET() - start;
+
+    for (uint32_t i = 0; i < BALLOC_IN_USE; i++)
+    {
+        if (p_blocks[i] != NULL)
+        {
+            nrf_balloc_free(&m_balloc_pool, p_blocks[i]);
+        }
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for running the ring buffer workload.
+ *
+ * @param[in]  ops      Number of operations.
+ * @param[out] p_cycles Cycles spent in the operations.
+ */
+static ret_code_t ringbuf_run(uint32_t ops, uint32_t * p_cycles)
+{
+    uint8_t  in[RINGBUF_OP_LEN];
+    uint8_t  out[RINGBUF_OP_LEN];
+    uint32_t start;
+
+    memset(in, 0xA5, sizeof(in));
+
+    start = NRF_BENCH_CYCLES_GET();
+
+    for (uint32_t i = 0; i < ops; i++)
+    {
+        size_t     len = sizeof(in);
+        ret_code_t err_code;
+
+        in[0]    = (uint8_t)i;
+        err_code = nrf_ringbuf_cpy_put(&m_ringbuf, in, &len);
+        VERIFY_SUCCESS(err_code);
+
+        len      = sizeof(out);
+        err_code = nrf_ringbuf_cpy_get(&m_ringbuf, out, &len);
+        VERIFY_SUCCESS(err_code);
+
+        if ((len != sizeof(out)) || (out[0] != in[0]))
+        {
+            return NRF_ERROR_INTERNAL;
+        }
+    }
+
+    *p_cycles = NRF_BENCH_CYCLES_GET() - start;
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for running the memory object workload.
+ *
+ * @param[in]  ops      Number of operations.
+ * @param[out] p_cycles Cycles spent in the operations.
+ */
+static ret_code_t memobj_run(uint32_t ops, uint32_t * p_cycles)
+{
+    uint8_t  in[MEMOBJ_OBJ_SIZE];
+    uint8_t  out[MEMOBJ_OBJ_SIZE];
+    uint32_t start;
+
+    for (uint32_t i = 0; i < sizeof(in); i++)
+    {
+        in[i] = (uint8_t)i;
+    }
+
+    start = NRF_BENCH_CYCLES_GET();
+
+    for (uint32_t i = 0; i < ops; i++)
+    {
+        nrf_memobj_t * p_obj = nrf_memobj_alloc(&m_memobj_pool, sizeof(in));
+
+        if (p_obj == NULL)
+        {
+            return NRF_ERROR_NO_MEM;
+        }
+
+        in[0] = (uint8_t)i;
+        nrf_memobj_write(p_obj, in, sizeof(in), 0);
+        nrf_memobj_read(p_obj, out, sizeof(out), 0);
+        nrf_memobj_free(p_obj);
+
+        if ((out[0] != in[0]) || (out[sizeof(out) - 1] != in[sizeof(in) - 1]))
+        {
+            return NRF_ERROR_INTERNAL;
+        }
+    }
+
+    *p_cycles = NRF_BENCH_CYCLES_GET() - start;
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for running a sorted list workload.
+ *
+ * @details Only the insertion is counted. The inserted item is removed again before the next
+ *          operation, so the list always holds @p count items when an item is inserted.
+ *
+ * @param[in]  count    Number of items in the list.
+ * @param[in]  ops      Number of operations.
+ * @param[out] p_cycles Cycles spent in the operations.
+ */
+static ret_code_t sortlist_run(uint32_t count, uint32_t ops, uint32_t * p_cycles)
+{
+    sortlist_entry_t          * p_new    = &m_sortlist_entries[count];
+    nrf_sortlist_item_t const * p_item;
+    ret_code_t                  err_code = NRF_SUCCESS;
+    uint32_t                    cycles   = 0;
+    uint32_t                    prev_key = 0;
+    uint32_t                    found    = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        m_sortlist_entries[i].key = random_get();
+        nrf_sortlist_add(&m_sortlist, &m_sortlist_entries[i].item);
+    }
+
+    for (uint32_t i = 0; (i < ops) && (err_code == NRF_SUCCESS); i++)
+    {
+        uint32_t start;
+
+        p_new->key = random_get();
+
+        start = NRF_BENCH_CYCLES_GET();
+        nrf_sortlist_add(&m_sortlist, &p_new->item);
+        cycles += NRF_BENCH_CYCLES_GET() - start - m_overhead;
+
+        if (!nrf_sortlist_remove(&m_sortlist, &p_new->item))
+        {
+            err_code = NRF_ERROR_INTERNAL;
+        }
+    }
+
+    *p_cycles = cycles;
+
+    // The list must still hold every item, in order.
+    for (p_item = nrf_sortlist_peek(&m_sortlist); p_item != NULL; p_item = nrf_sortlist_next(p_item))
+    {
+        uint32_t key = CONTAINER_OF(p_item, sortlist_entry_t, item)->key;
+
+        if (key < prev_key)
+        {
+            err_code = NRF_ERROR_INTERNAL;
+        }
+        prev_key = key;
+        found++;
+    }
+    if (found != count)
+    {
+        err_code = NRF_ERROR_INTERNAL;
+    }
+
+    while (nrf_sortlist_pop(&m_sortlist) != NULL)
+    {
+        // Empty the list for the next run.
+    }
+
+    return err_code;
+}
+
+
+#if NRF_BENCH_CONFIG_ADVDATA_ENABLED
+static int8_t                   m_tx_power  = -4;                           ///< TX Power Level field.
+static ble_uuid_t               m_uuids[]   = {{BLE_UUID_HEART_RATE_SERVICE, BLE_UUID_TYPE_BLE},
+                                               {BLE_UUID_BATTERY_SERVICE,    BLE_UUID_TYPE_BLE}};
+static uint8_t                  m_manuf_payload[8];                         ///< Manufacturer specific data.
+static ble_advdata_manuf_data_t m_manuf     =
+{
+    .company_identifier = 0x0059,
+    .data               = {.size = sizeof(m_manuf_payload), .p_data = m_manuf_payload}
+};
+static ble_advdata_t const      m_advdata   =
+{
+    .name_type             = BLE_ADVDATA_NO_NAME,
+    .flags                 = BLE_GAP_ADV_FLAGS_LE_ONLY_GENERAL_DISC_MODE,
+    .p_tx_power_level      = &m_tx_power,
+    .uuids_complete        = {.uuid_cnt = ARRAY_SIZE(m_uuids), .p_uuids = m_uuids},
+    .p_manuf_specific_data = &m_manuf
+};
+
+// Length of the encoded fields: flags, TX power, UUID list and manufacturer specific data.
+#define ADVDATA_ENCODED_LEN ((2 + 1) + (2 + 1) + (2 + 2 * ARRAY_SIZE(m_uuids)) + (2 + 2 + sizeof(m_manuf_payload)))
+
+static uint8_t const m_ad_types[] =
+{
+    BLE_GAP_AD_TYPE_FLAGS,
+    BLE_GAP_AD_TYPE_TX_POWER_LEVEL,
+    BLE_GAP_AD_TYPE_16BIT_SERVICE_UUID_COMPLETE,
+    BLE_GAP_AD_TYPE_MANUFACTURER_SPECIFIC_DATA
+};
+
+
+/**@brief Function for running the advertising data encoding workload.
+ *
+ * @param[in]  ops      Number of operations.
+ * @param[out] p_cycles Cycles spent in the operations.
+ */
+static ret_code_t advdata_encode_run(uint32_t ops, uint32_t * p_cycles)
+{
+    uint8_t  encoded[BLE_GAP_ADV_SET_DATA_SIZE_MAX];
+    uint32_t start = NRF_BENCH_CYCLES_GET();
+
+    for (uint32_t i = 0; i < ops; i++)
+    {
+        uint16_t   len      = sizeof(encoded);
+        ret_code_t err_code = ble_advdata_encode(&m_advdata, encoded, &len);
+
+        VERIFY_SUCCESS(err_code);
+
+        if (len != ADVDATA_ENCODED_LEN)
+        {
+            return NRF_ERROR_INTERNAL;
+        }
+    }
+
+    *p_cycles = NRF_BENCH_CYCLES_GET() - start;
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for running the advertising data parsing workload.
+ *
+ * @details An operation is the search of every field of the encoded data.
+ *
+ * @param[in]  ops      Number of operations.
+ * @param[out] p_cycles Cycles spent in the operations.
+ */
+static ret_code_t advdata_parse_run(uint32_t ops, uint32_t * p_cycles)
+{
+    uint8_t    encoded[BLE_GAP_ADV_SET_DATA_SIZE_MAX];
+    uint16_t   len      = sizeof(encoded);
+    ret_code_t err_code = ble_advdata_encode(&m_advdata, encoded, &len);
+    uint32_t   start;
+
+    VERIFY_SUCCESS(err_code);
+
+    start = NRF_BENCH_CYCLES_GET();
+
+    for (uint32_t i = 0; i < ops; i++)
+    {
+        for (uint32_t j = 0; j < ARRAY_SIZE(m_ad_types); j++)
+        {
+            uint16_t offset = 0;
+
+            if (ble_advdata_search(encoded, len, &offset, m_ad_types[j]) == 0)
+            {
+                return NRF_ERROR_INTERNAL;
+            }
+        }
+    }
+
+    *p_cycles = NRF_BENCH_CYCLES_GET() - start;
+
+    return NRF_SUCCESS;
+}
+#endif // NRF_BENCH_CONFIG_ADVDATA_ENABLED
+
+
+/**@brief Function for running the fprintf workload.
+ *
+ * @param[in]  ops      Number of operations.
+ * @param[out] p_cycles Cycles spent in the operations.
+ */
+static ret_code_t fprintf_run(uint32_t ops, uint32_t * p_cycles)
+{
+    static char const expected[] = "temp=-1234 0x0000BEEF 42  !% ok  ";
+    uint32_t          start      = NRF_BENCH_CYCLES_GET();
+
+    for (uint32_t i = 0; i < ops; i++)
+    {
+        m_fprintf_out_len = 0;
+        nrf_fprintf(&m_fprintf, "%s=%5d 0x%08X %-4u%c%% %-4s", "temp", -1234, 0xBEEFu, 42u, '!', "ok");
+
+        if (   (m_fprintf_out_len != (sizeof(expected) - 1))
+            || (memcmp(m_fprintf_out, expected, m_fprintf_out_len) != 0))
+        {
+            return NRF_ERROR_INTERNAL;
+        }
+    }
+
+    *p_cycles = NRF_BENCH_CYCLES_GET() - start;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_bench_init(void)
+{
+    ret_code_t err_code;
+    uint32_t   start;
+
+#if NRF_BENCH_DWT
+    // Enable the DWT cycle counter.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    start      = NRF_BENCH_CYCLES_GET();
+    m_overhead = NRF_BENCH_CYCLES_GET() - start;
+
+    err_code = NRF_ATFIFO_INIT(m_fifo);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = nrf_balloc_init(&m_balloc_pool);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = nrf_memobj_pool_init(&m_memobj_pool);
+    VERIFY_SUCCESS(err_code);
+
+    nrf_ringbuf_init(&m_ringbuf);
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_bench_run(nrf_bench_id_t id, uint32_t iterations, nrf_bench_result_t * p_result)
+{
+    ret_code_t err_code;
+    uint32_t   cycles = 0;
+
+    VERIFY_PARAM_NOT_NULL(p_result);
+
+    if (iterations == 0)
+    {
+        iterations = NRF_BENCH_CONFIG_ITERATIONS;
+    }
+
+    switch (id)
+    {
+        case NRF_BENCH_ATFIFO:
+            err_code = atfifo_run(iterations, &cycles);
+            break;
+
+        case NRF_BENCH_BALLOC:
+            err_code = balloc_run(iterations, &cycles);
+            break;
+
+        case NRF_BENCH_RINGBUF:
+            err_code = ringbuf_run(iterations, &cycles);
+            break;
+
+        case NRF_BENCH_MEMOBJ:
+            err_code = memobj_run(iterations, &cycles);
+            break;
+
+        case NRF_BENCH_SORTLIST_16:
+            err_code = sortlist_run(16, iterations, &cycles);
+            break;
+
+        case NRF_BENCH_SORTLIST_64:
+            err_code = sortlist_run(64, iterations, &cycles);
+            break;
+
+        case NRF_BENCH_SORTLIST_256:
+            err_code = sortlist_run(SORTLIST_MAX, iterations, &cycles);
+            break;
+
+#if NRF_BENCH_CONFIG_ADVDATA_ENABLED
+        case NRF_BENCH_ADVDATA_ENCODE:
+            err_code = advdata_encode_run(iterations, &cycles);
+            break;
+
+        case NRF_BENCH_ADVDATA_PARSE:
+            err_code = advdata_parse_run(iterations, &cycles);
+            break;
+#else
+        case NRF_BENCH_ADVDATA_ENCODE:
+        case NRF_BENCH_ADVDATA_PARSE:
+            return NRF_ERROR_NOT_SUPPORTED;
+#endif
+
+        case NRF_BENCH_FPRINTF:
+            err_code = fprintf_run(iterations, &cycles);
+            break;
+
+        default:
+            return NRF_ERROR_INVALID_PARAM;
+    }
+
+    VERIFY_SUCCESS(err_code);
+
+    p_result->ops           = iterations;
+    p_result->cycles        = cycles;
+    p_result->cycles_per_op = cycles / iterations;
+    p_result->ops_per_sec   = (cycles == 0) ? UINT32_MAX :
+                              (uint32_t)(((uint64_t)iterations * NRF_BENCH_CLOCK_HZ) / cycles);
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_bench_run_all(uint32_t iterations, nrf_bench_result_t * p_results)
+{
+    ret_code_t ret = NRF_SUCCESS;
+
+    for (uint32_t i = 0; i < NRF_BENCH_COUNT; i++)
+    {
+        nrf_bench_result_t result;
+        ret_code_t         err_code = nrf_bench_run((nrf_bench_id_t)i, iterations, &result);
+
+        if (err_code == NRF_ERROR_NOT_SUPPORTED)
+        {
+            continue;
+        }
+        if (err_code != NRF_SUCCESS)
+        {
+            NRF_LOG_ERROR("%s: failed, error 0x%x.", nrf_bench_name_get((nrf_bench_id_t)i), err_code);
+            if (ret == NRF_SUCCESS)
+            {
+                ret = err_code;
+            }
+            continue;
+        }
+
+        NRF_LOG_INFO("%s: %u cycles/op, %u ops/s.",
+                     nrf_bench_name_get((nrf_bench_id_t)i),
+                     result.cycles_per_op,
+                     result.ops_per_sec);
+
+        if (p_results != NULL)
+        {
+            p_results[i] = result;
+        }
+    }
+
+    return ret;
+}
+
+
+char const * nrf_bench_name_get(nrf_bench_id_t id)
+{
+    static char const * const names[NRF_BENCH_COUNT] =
+    {
+        "atfifo",
+        "balloc",
+        "ringbuf",
+        "memobj",
+        "sortlist_16",
+        "sortlist_64",
+        "sortlist_256",
+        "advdata_encode",
+        "advdata_parse",
+        "fprintf",
+    };
+
+    return ((uint32_t)id < NRF_BENCH_COUNT) ? names[id] : "unknown";
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_BENCH)
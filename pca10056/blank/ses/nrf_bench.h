@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_bench Core library microbenchmark
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Measurement and regression check of the core libraries under standard workloads.
+ *
+ * @details Each workload runs a number of operations of a library, checks that the library
+ *          gives the expected results, and reports the cost of an operation in CPU cycles, counted
+ *          by the DWT cycle counter:
+ *          - @ref NRF_BENCH_ATFIFO: @ref nrf_atfifo_alloc_put and @ref nrf_atfifo_get_free of a
+ *            32-bit item.
+ *          - @ref NRF_BENCH_BALLOC: allocation and release of a @ref nrf_balloc block, with up to
+ *            half of the pool in use.
+ *          - @ref NRF_BENCH_RINGBUF: @ref nrf_ringbuf_cpy_put and @ref nrf_ringbuf_cpy_get of
+ *            16 bytes.
+ *          - @ref NRF_BENCH_MEMOBJ: allocation, write, read and release of a 64-byte
+ *            @ref nrf_memobj object spanning several chunks.
+ *          - @ref NRF_BENCH_SORTLIST_16, @ref NRF_BENCH_SORTLIST_64, @ref NRF_BENCH_SORTLIST_256:
+ *            @ref nrf_sortlist_add of an item with a random key into a list of 16, 64 or 256 items.
+ *            Only the insertion is counted.
+ *          - @ref NRF_BENCH_ADVDATA_ENCODE and @ref NRF_BENCH_ADVDATA_PARSE: @ref ble_advdata_encode
+ *            of flags, TX power, a 16-bit UUID list and manufacturer specific data, and
+ *            @ref ble_advdata_search of each of these fields. Only built if
+ *            NRF_BENCH_CONFIG_ADVDATA_ENABLED is set, as ble_advdata is not part of every project.
+ *          - @ref NRF_BENCH_FPRINTF: @ref nrf_fprintf of a format mixing strings, characters,
+ *            signed, unsigned and hexadecimal values with width and flags, into a buffer.
+ *
+ *          Interrupts are not disabled during a workload, so results are most stable when nothing
+ *          else runs. The same workloads can be built on a host to compare with the numbers of the
+ *          MCU: define NRF_BENCH_CYCLES_GET() and NRF_BENCH_CLOCK_HZ for the host counter, and
+ *          build the library sources against stubs of the critical region and atomic functions.
+ */
+
+#ifndef NRF_BENCH_H__
+#define NRF_BENCH_H__
+
+#include <stdint.h>
+#include "sdk_errors.h"
+#include "nordic_common.h"
+#include "sdk_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Workloads. */
+typedef enum
+{
+    NRF_BENCH_ATFIFO,           ///< Put and get of an atomic FIFO item.
+    NRF_BENCH_BALLOC,           ///< Allocation and release of a block.
+    NRF_BENCH_RINGBUF,          ///< Copying put and get on a ring buffer.
+    NRF_BENCH_MEMOBJ,           ///< Allocation, write, read and release of a memory object.
+    NRF_BENCH_SORTLIST_16,      ///< Insertion into a sorted list of 16 items.
+    NRF_BENCH_SORTLIST_64,      ///< Insertion into a sorted list of 64 items.
+    NRF_BENCH_SORTLIST_256,     ///< Insertion into a sorted list of 256 items.
+    NRF_BENCH_ADVDATA_ENCODE,   ///< Encoding of advertising data.
+    NRF_BENCH_ADVDATA_PARSE,    ///< Search of the fields of advertising data.
+    NRF_BENCH_FPRINTF,          ///< Formatting of mixed formats.
+    NRF_BENCH_COUNT             ///< Number of workloads.
+} nrf_bench_id_t;
+
+/**@brief Results of a workload. */
+typedef struct
+{
+    uint32_t ops;           ///< Number of operations.
+    uint32_t cycles;        ///< CPU cycles spent in all the operations.
+    uint32_t cycles_per_op; ///< Average CPU cycles of an operation.
+    uint32_t ops_per_sec;   ///< Operations per second at NRF_BENCH_CLOCK_HZ.
+} nrf_bench_result_t;
+
+/**@brief Function for initializing the benchmark.
+ *
+ * @details Enables the DWT cycle counter, and initializes the pools and buffers of the workloads.
+ *
+ * @retval NRF_SUCCESS If the benchmark was initialized.
+ * @retval Other       Error from the initialization of a library.
+ */
+ret_code_t nrf_bench_init(void);
+
+/**@brief Function for running a workload.
+ *
+ * @param[in]  id         Workload.
+ * @param[in]  iterations Number of operations. 0 for NRF_BENCH_CONFIG_ITERATIONS.
+ * @param[out] p_result   Results of the workload.
+ *
+ * @retval NRF_SUCCESS             If the workload was run and the library gave the expected results.
+ * @retval NRF_ERROR_NULL          If @p p_result is NULL.
+ * @retval NRF_ERROR_NOT_SUPPORTED If the workload is not built.
+ * @retval NRF_ERROR_INVALID_PARAM If @p id is not a workload.
+ * @retval NRF_ERROR_INTERNAL      If the library gave an unexpected result.
+ * @retval Other                   Error returned by the library.
+ */
+ret_code_t nrf_bench_run(nrf_bench_id_t id, uint32_t iterations, nrf_bench_result_t * p_result);
+
+/**@brief Function for running all workloads and logging their results.
+ *
+ * @param[in]  iterations Number of operations of each workload. 0 for NRF_BENCH_CONFIG_ITERATIONS.
+ * @param[out] p_results  Array of @ref NRF_BENCH_COUNT results, or NULL.
+ *
+ * @retval NRF_SUCCESS If every workload built was run and gave the expected results.
+ * @return Otherwise, the error of the first workload that failed. The other workloads are run.
+ */
+ret_code_t nrf_bench_run_all(uint32_t iterations, nrf_bench_result_t * p_results);
+
+/**@brief Function for getting the name of a workload.
+ *
+ * @param[in] id Workload.
+ *
+ * @return Name of the workload, or "unknown".
+ */
+char const * nrf_bench_name_get(nrf_bench_id_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_BENCH_H__
+
+/** @} */
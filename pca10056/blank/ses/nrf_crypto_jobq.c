@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
+#include "nrf_crypto_jobq.h"
+#include "app_scheduler.h"
+#include "app_util_platform.h"
+
+/**@brief Queue of the jobs of one priority. */
+typedef struct
+{
+    nrf_crypto_jobq_job_t * p_head; /**< First job to run. */
+    nrf_crypto_jobq_job_t * p_tail; /**< Last job submitted. */
+} job_list_t;
+
+static job_list_t    m_lists[NRF_CRYPTO_JOBQ_PRIO_COUNT]; /**< Queued jobs, by priority. */
+static volatile bool m_scheduled;                          /**< True while a scheduler event for running a job is pending. */
+static volatile bool m_running;                            /**< True while a job function or completion handler runs. */
+
+
+/**@brief Function for checking if any job is queued.
+ *
+ * @note Must be called with interrupts disabled.
+ */
+static bool job_pending(void)
+{
+    for (uint32_t i = 0; i < NRF_CRYPTO_JOBQ_PRIO_COUNT; i++)
+    {
+        if (m_lists[i].p_head != NULL)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**@brief Function for taking the job to run next.
+ *
+ * @return The first job of the highest priority, or NULL if no job is queued.
+ */
+static nrf_crypto_jobq_job_t * job_take(void)
+{
+    nrf_crypto_jobq_job_t * p_job = NULL;
+
+    CRITICAL_REGION_ENTER();
+
+    for (uint32_t i = 0; i < NRF_CRYPTO_JOBQ_PRIO_COUNT; i++)
+    {
+        p_job = m_lists[i].p_head;
+        if (p_job != NULL)
+        {
+            m_lists[i].p_head = p_job->p_next;
+            if (m_lists[i].p_head == NULL)
+            {
+                m_lists[i].p_tail = NULL;
+            }
+            p_job->queued = false;
+            break;
+        }
+    }
+
+    CRITICAL_REGION_EXIT();
+
+    return p_job;
+}
+
+
+/**@brief Function for unlinking a queued job.
+ *
+ * @note Must be called with interrupts disabled.
+ *
+ * @param[in] p_job Job to unlink.
+ */
+static void job_unlink(nrf_crypto_jobq_job_t * p_job)
+{
+    job_list_t            * p_list = &m_lists[p_job->prio];
+    nrf_crypto_jobq_job_t * p_prev = NULL;
+
+    for (nrf_crypto_jobq_job_t * p_it = p_list->p_head; p_it != NULL; p_it = p_it->p_next)
+    {
+        if (p_it == p_job)
+        {
+            if (p_prev == NULL)
+            {
+                p_list->p_head = p_job->p_next;
+            }
+            else
+            {
+                p_prev->p_next = p_job->p_next;
+            }
+            if (p_list->p_tail == p_job)
+            {
+                p_list->p_tail = p_prev;
+            }
+            break;
+        }
+        p_prev = p_it;
+    }
+
+    p_job->queued = false;
+}
+
+
+static void job_run_evt(void * p_event_data, uint16_t event_size);
+
+
+/**@brief Function for scheduling the next job run, if a job is queued and no run is scheduled.
+ *
+ * @return NRF_SUCCESS, or the error returned by app_sched_event_put.
+ */
+static ret_code_t run_schedule(void)
+{
+    ret_code_t err_code = NRF_SUCCESS;
+    bool       schedule;
+
+    CRITICAL_REGION_ENTER();
+    schedule    = !m_scheduled && job_pending();
+    m_scheduled = m_scheduled || schedule;
+    CRITICAL_REGION_EXIT();
+
+    if (schedule)
+    {
+        err_code = app_sched_event_put(NULL, 0, job_run_evt);
+        if (err_code != NRF_SUCCESS)
+        {
+            // Retried on the next submission.
+            m_scheduled = false;
+        }
+    }
+
+    return err_code;
+}
+
+
+/**@brief Run one job from the scheduler. */
+static void job_run_evt(void * p_event_data, uint16_t event_size)
+{
+    nrf_crypto_jobq_job_t * p_job;
+
+    UNUSED_PARAMETER(p_event_data);
+    UNUSED_PARAMETER(event_size);
+
+    m_scheduled = false;
+
+    p_job = job_take();
+    if (p_job != NULL)
+    {
+        ret_code_t result;
+
+        m_running = true;
+        result    = p_job->fn(p_job);
+        if (p_job->done != NULL)
+        {
+            p_job->done(p_job, result);
+        }
+        m_running = false;
+    }
+
+    // The next job runs from its own scheduler event, after the events queued in the meantime.
+    UNUSED_RETURN_VALUE(run_schedule());
+}
+
+
+ret_code_t nrf_crypto_jobq_submit(nrf_crypto_jobq_job_t  * p_job,
+                                  nrf_crypto_jobq_prio_t   prio,
+                                  nrf_crypto_jobq_fn_t     fn,
+                                  nrf_crypto_jobq_done_t   done,
+                                  void                   * p_context)
+{
+    ret_code_t err_code = NRF_SUCCESS;
+
+    VERIFY_PARAM_NOT_NULL(p_job);
+    VERIFY_PARAM_NOT_NULL(fn);
+
+    if (prio >= NRF_CRYPTO_JOBQ_PRIO_COUNT)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    CRITICAL_REGION_ENTER();
+
+    if (p_job->queued)
+    {
+        err_code = NRF_ERROR_BUSY;
+    }
+    else
+    {
+        job_list_t * p_list = &m_lists[prio];
+
+        p_job->fn        = fn;
+        p_job->done      = done;
+        p_job->p_context = p_context;
+        p_job->prio      = (uint8_t)prio;
+        p_job->p_next    = NULL;
+        p_job->queued    = true;
+
+        if (p_list->p_tail == NULL)
+        {
+            p_list->p_head = p_job;
+        }
+        else
+        {
+            p_list->p_tail->p_next = p_job;
+        }
+        p_list->p_tail = p_job;
+    }
+
+    CRITICAL_REGION_EXIT();
+
+    VERIFY_SUCCESS(err_code);
+
+    err_code = run_schedule();
+    if (err_code != NRF_SUCCESS)
+    {
+        CRITICAL_REGION_ENTER();
+        if (p_job->queued)
+        {
+            job_unlink(p_job);
+        }
+        CRITICAL_REGION_EXIT();
+    }
+
+    return err_code;
+}
+
+
+bool nrf_crypto_jobq_cancel(nrf_crypto_jobq_job_t * p_job)
+{
+    bool removed = false;
+
+    if (p_job == NULL)
+    {
+        return false;
+    }
+
+    CRITICAL_REGION_ENTER();
+    if (p_job->queued)
+    {
+        job_unlink(p_job);
+        removed = true;
+    }
+    CRITICAL_REGION_EXIT();
+
+    return removed;
+}
+
+
+bool nrf_crypto_jobq_is_idle(void)
+{
+    bool idle;
+
+    CRITICAL_REGION_ENTER();
+    idle = !m_running && !job_pending();
+    CRITICAL_REGION_EXIT();
+
+    return idle;
+}
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_JOBQ)
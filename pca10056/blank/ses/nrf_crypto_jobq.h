@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_crypto_jobq Crypto job queue
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Prioritized queue of long crypto operations, run from the scheduler.
+ *
+ * @details Modules that need an ECDH computation, a key pair generation or another operation that
+ *          takes milliseconds submit it as a job instead of running it where the need arises.
+ *          The jobs run from @ref app_scheduler, one job per scheduler event and highest priority
+ *          first, so other scheduler events run between two jobs and jobs of independent modules
+ *          never run nested in each other. Jobs of the same priority run in submission order.
+ *          The job function can use any nrf_crypto backend, including CryptoCell-310.
+ *
+ *          The completion handler is called right after the job function, from the scheduler.
+ *          The job can be submitted again from it.
+ *
+ * @note    The app_scheduler module must be initialized.
+ */
+
+#ifndef NRF_CRYPTO_JOBQ_H__
+#define NRF_CRYPTO_JOBQ_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Job priorities. */
+typedef enum
+{
+    NRF_CRYPTO_JOBQ_PRIO_HIGH,   /**< Work a peer is waiting for, such as a DH key during pairing. */
+    NRF_CRYPTO_JOBQ_PRIO_NORMAL, /**< Work needed soon. */
+    NRF_CRYPTO_JOBQ_PRIO_LOW,    /**< Background work. */
+    NRF_CRYPTO_JOBQ_PRIO_COUNT   /**< Number of priorities. */
+} nrf_crypto_jobq_prio_t;
+
+typedef struct nrf_crypto_jobq_job_s nrf_crypto_jobq_job_t;
+
+/**@brief Job function.
+ *
+ * @param[in] p_job Job being run.
+ *
+ * @return Result passed to the completion handler.
+ */
+typedef ret_code_t (* nrf_crypto_jobq_fn_t)(nrf_crypto_jobq_job_t * p_job);
+
+/**@brief Completion handler.
+ *
+ * @param[in] p_job  Job that was run.
+ * @param[in] result Result of the job function.
+ */
+typedef void (* nrf_crypto_jobq_done_t)(nrf_crypto_jobq_job_t * p_job, ret_code_t result);
+
+/**@brief Job structure. Only @ref nrf_crypto_jobq_job_t::p_context is meant to be used by the
+ *        job function and the completion handler.
+ */
+struct nrf_crypto_jobq_job_s
+{
+    nrf_crypto_jobq_job_t  * p_next;    /**< Next job of the same priority. */
+    nrf_crypto_jobq_fn_t     fn;        /**< Job function. */
+    nrf_crypto_jobq_done_t   done;      /**< Completion handler, or NULL. */
+    void                   * p_context; /**< Job state, passed to @ref nrf_crypto_jobq_submit. */
+    uint8_t                  prio;      /**< Priority of the job. */
+    volatile bool            queued;    /**< True from submission until the job function is called. */
+};
+
+/**@brief Function for submitting a job.
+ *
+ * @details Can be called from any context. The job is run later from the scheduler.
+ *
+ * @param[in] p_job     Job structure, which must stay valid until the job was run.
+ * @param[in] prio      Priority of the job.
+ * @param[in] fn        Job function.
+ * @param[in] done      Completion handler, or NULL.
+ * @param[in] p_context Job state.
+ *
+ * @retval NRF_SUCCESS             If the job was queued.
+ * @retval NRF_ERROR_NULL          If @p p_job or @p fn is NULL.
+ * @retval NRF_ERROR_INVALID_PARAM If @p prio is not valid.
+ * @retval NRF_ERROR_BUSY          If the job is already queued.
+ * @retval err_code                Otherwise, the error returned by app_sched_event_put.
+ */
+ret_code_t nrf_crypto_jobq_submit(nrf_crypto_jobq_job_t  * p_job,
+                                  nrf_crypto_jobq_prio_t   prio,
+                                  nrf_crypto_jobq_fn_t     fn,
+                                  nrf_crypto_jobq_done_t   done,
+                                  void                   * p_context);
+
+/**@brief Function for removing a job that has not been run yet.
+ *
+ * @param[in] p_job Job structure.
+ *
+ * @retval true  If the job was removed. Its completion handler is not called.
+ * @retval false If the job was not queued.
+ */
+bool nrf_crypto_jobq_cancel(nrf_crypto_jobq_job_t * p_job);
+
+/**@brief Function for checking if no job is queued or running.
+ *
+ * @retval true  If the queue is idle.
+ * @retval false Otherwise.
+ */
+bool nrf_crypto_jobq_is_idle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_CRYPTO_JOBQ_H__
+
+/** @} */
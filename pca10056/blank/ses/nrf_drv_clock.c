@@ -50,6 +50,29 @@
 
 #include <hal/nrf_wdt.h>
 
+#if CLOCK_CONFIG_HF_AHEAD_ENABLED
+#include <string.h>
+#include "nrf_drv_clock_ahead.h"
+
+/**@brief HFXO start-up time from the configuration, in app_timer ticks, rounded up. */
+#define HFXO_STARTUP_CONFIG_TICKS                                                       \
+    ((uint32_t)((((uint64_t)CLOCK_CONFIG_HFXO_STARTUP_US *                              \
+                  (APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1))) +      \
+                 999999) / 1000000))
+#endif // CLOCK_CONFIG_HF_AHEAD_ENABLED
+
+#if CLOCK_CONFIG_LFRC_SCHED_ENABLED
+#include <stdlib.h>
+#include "nrf_drv_clock_lfrc.h"
+#include "app_timer.h"
+#include "nrfx_ppi.h"
+#include "nrfx_timer.h"
+#include <hal/nrf_rtc.h>
+#ifdef SOFTDEVICE_PRESENT
+#include "nrf_soc.h"
+#endif
+#endif // CLOCK_CONFIG_LFRC_SCHED_ENABLED
+
 #define NRF_LOG_MODULE_NAME clock
 #if CLOCK_CONFIG_LOG_ENABLED
     #define NRF_LOG_LEVEL       CLOCK_CONFIG_LOG_LEVEL
@@ -80,6 +103,16 @@ NRF_LOG_MODULE_REGISTER();
 #else
 #define CALIBRATION_SUPPORT 0
 #endif
+
+#if CLOCK_CONFIG_LFRC_SCHED_ENABLED
+#ifdef SOFTDEVICE_PRESENT
+#if NRF_SDH_CLOCK_LF_SRC != 0
+#error "CLOCK_CONFIG_LFRC_SCHED_ENABLED requires NRF_SDH_CLOCK_LF_SRC to be NRF_CLOCK_LF_SRC_RC."
+#endif
+#elif !CALIBRATION_SUPPORT
+#error "CLOCK_CONFIG_LFRC_SCHED_ENABLED requires CLOCK_CONFIG_LF_SRC to be RC."
+#endif
+#endif // CLOCK_CONFIG_LFRC_SCHED_ENABLED
 typedef enum
 {
     CAL_STATE_IDLE,
@@ -99,6 +132,12 @@ typedef struct
     volatile nrf_drv_clock_handler_item_t * p_hf_head;
     volatile uint32_t                       lfclk_requests;     /*< Low-frequency clock request counter. */
     volatile nrf_drv_clock_handler_item_t * p_lf_head;
+#if CLOCK_CONFIG_HF_AHEAD_ENABLED
+    nrf_drv_clock_hf_user_t *               p_hf_wait_head;     /*< Requesters waiting for HFXO. */
+    uint32_t                                hf_start_ticks;     /*< Time when HFXO was started. */
+    bool                                    hf_start_measure;   /*< HFXO start-up is measured. */
+    uint32_t                                hf_startup_max;     /*< Longest measured HFXO start-up. */
+#endif // CLOCK_CONFIG_HF_AHEAD_ENABLED
 #if CALIBRATION_SUPPORT
     nrf_drv_clock_handler_item_t            cal_hfclk_started_handler_item;
     nrf_drv_clock_event_handler_t           cal_done_handler;
@@ -135,6 +174,11 @@ static void lfclk_stop(void)
 
 static void hfclk_start(void)
 {
+#if CLOCK_CONFIG_HF_AHEAD_ENABLED
+    m_clock_cb.hf_start_ticks   = app_timer_cnt_get();
+    m_clock_cb.hf_start_measure = true;
+#endif
+
 #ifdef SOFTDEVICE_PRESENT
     if (nrf_sdh_is_enabled())
     {
@@ -179,6 +223,9 @@ ret_code_t nrf_drv_clock_init(void)
         m_clock_cb.hfclk_requests = 0;
         m_clock_cb.p_lf_head      = NULL;
         m_clock_cb.lfclk_requests = 0;
+#if CLOCK_CONFIG_HF_AHEAD_ENABLED
+        m_clock_cb.p_hf_wait_head = NULL;
+#endif
         err_code = nrfx_clock_init(clock_irq_handler);
 #ifdef SOFTDEVICE_PRESENT
         if (!nrf_sdh_is_enabled())
@@ -231,6 +278,22 @@ static void item_enqueue(nrf_drv_clock_handler_item_t ** p_head,
     *p_head = p_item;
 }
 
+#if CLOCK_CONFIG_HF_AHEAD_ENABLED
+static void item_remove(nrf_drv_clock_handler_item_t ** p_head,
+                        nrf_drv_clock_handler_item_t *  p_item)
+{
+    while (*p_head)
+    {
+        if (*p_head == p_item)
+        {
+            *p_head = p_item->p_next;
+            return;
+        }
+        p_head = &(*p_head)->p_next;
+    }
+}
+#endif // CLOCK_CONFIG_HF_AHEAD_ENABLED
+
 static nrf_drv_clock_handler_item_t * item_dequeue(nrf_drv_clock_handler_item_t ** p_head)
 {
     nrf_drv_clock_handler_item_t * p_item = *p_head;
@@ -365,6 +428,224 @@ bool nrf_drv_clock_hfclk_is_running(void)
     return nrfx_clock_hfclk_is_running();
 }
 
+#if CLOCK_CONFIG_HF_AHEAD_ENABLED
+static void hf_user_stats_record(nrf_drv_clock_hf_user_t * p_user, uint32_t now)
+{
+    nrf_drv_clock_hf_stats_t * p_stats = &p_user->stats;
+    uint32_t                   wait    = app_timer_cnt_diff_compute(now, p_user->need_ticks);
+
+    ++(p_stats->request_count);
+    if (wait > (APP_TIMER_MAX_CNT_VAL / 2))
+    {
+        // HFXO was running before it was needed.
+        p_stats->early_sum += app_timer_cnt_diff_compute(p_user->need_ticks, now);
+        wait = 0;
+    }
+    else if (wait > 0)
+    {
+        ++(p_stats->wait_count);
+    }
+    p_stats->wait_last = wait;
+    p_stats->wait_max  = MAX(p_stats->wait_max, wait);
+    p_stats->wait_sum += wait;
+}
+
+/**
+ * @brief Function for updating the requesters waiting for HFXO when it has started.
+ *
+ * Called before the handlers of the started event are notified.
+ */
+static void hf_users_started(void)
+{
+    uint32_t now = app_timer_cnt_get();
+
+    CRITICAL_REGION_ENTER();
+    if (m_clock_cb.hf_start_measure)
+    {
+        m_clock_cb.hf_start_measure = false;
+        m_clock_cb.hf_startup_max   = MAX(m_clock_cb.hf_startup_max,
+                                          app_timer_cnt_diff_compute(now,
+                                                                     m_clock_cb.hf_start_ticks));
+    }
+
+    nrf_drv_clock_hf_user_t * p_user = m_clock_cb.p_hf_wait_head;
+    m_clock_cb.p_hf_wait_head = NULL;
+    while (p_user)
+    {
+        p_user->state = NRF_DRV_CLOCK_HF_USER_RUNNING;
+        hf_user_stats_record(p_user, now);
+        p_user = p_user->p_next_wait;
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+static void hf_user_wait_remove(nrf_drv_clock_hf_user_t * p_user)
+{
+    nrf_drv_clock_hf_user_t ** p_link = &m_clock_cb.p_hf_wait_head;
+
+    while (*p_link)
+    {
+        if (*p_link == p_user)
+        {
+            *p_link = p_user->p_next_wait;
+            return;
+        }
+        p_link = &(*p_link)->p_next_wait;
+    }
+}
+
+/**
+ * @brief Function for requesting HFCLK for a requester with a scheduled request.
+ *
+ * Nothing is done if the request was cancelled in the meantime.
+ */
+static void hf_user_start(nrf_drv_clock_hf_user_t * p_user)
+{
+    bool start = false;
+
+    CRITICAL_REGION_ENTER();
+    if (p_user->state == NRF_DRV_CLOCK_HF_USER_SCHEDULED)
+    {
+        start = true;
+        if (m_clock_cb.hfclk_on)
+        {
+            p_user->state = NRF_DRV_CLOCK_HF_USER_RUNNING;
+            hf_user_stats_record(p_user, app_timer_cnt_get());
+        }
+        else
+        {
+            p_user->state             = NRF_DRV_CLOCK_HF_USER_WAITING;
+            p_user->p_next_wait       = m_clock_cb.p_hf_wait_head;
+            m_clock_cb.p_hf_wait_head = p_user;
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (start)
+    {
+        NRF_LOG_DEBUG("%s: HFCLK requested.", (uint32_t)p_user->p_name);
+        nrf_drv_clock_hfclk_request(p_user->item.event_handler ? &p_user->item : NULL);
+    }
+}
+
+static void hf_user_timeout_handler(void * p_context)
+{
+    hf_user_start((nrf_drv_clock_hf_user_t *)p_context);
+}
+
+ret_code_t nrf_drv_clock_hf_user_init(nrf_drv_clock_hf_user_t *     p_user,
+                                      char const *                  p_name,
+                                      nrf_drv_clock_event_handler_t handler)
+{
+    memset(p_user, 0, sizeof(*p_user));
+    p_user->item.event_handler = handler;
+    p_user->p_name             = p_name;
+    p_user->timer_id           = &p_user->timer;
+
+    return app_timer_create(&p_user->timer_id, APP_TIMER_MODE_SINGLE_SHOT, hf_user_timeout_handler);
+}
+
+ret_code_t nrf_drv_clock_hf_user_request_ahead(nrf_drv_clock_hf_user_t * p_user,
+                                               uint32_t                  deadline)
+{
+    ret_code_t err_code = NRF_SUCCESS;
+
+    ASSERT(m_clock_cb.module_initialized);
+
+    CRITICAL_REGION_ENTER();
+    if (p_user->state != NRF_DRV_CLOCK_HF_USER_IDLE)
+    {
+        err_code = NRF_ERROR_INVALID_STATE;
+    }
+    else
+    {
+        p_user->state      = NRF_DRV_CLOCK_HF_USER_SCHEDULED;
+        p_user->need_ticks = deadline;
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (err_code == NRF_SUCCESS)
+    {
+        uint32_t lead  = nrf_drv_clock_hfxo_startup_ticks_get();
+        uint32_t ahead = app_timer_cnt_diff_compute(deadline, app_timer_cnt_get());
+
+        // A deadline in the past or too close for a timer is served at once.
+        if ((ahead > (APP_TIMER_MAX_CNT_VAL / 2)) ||
+            (ahead < (lead + APP_TIMER_MIN_TIMEOUT_TICKS)))
+        {
+            hf_user_start(p_user);
+        }
+        else
+        {
+            err_code = app_timer_start(p_user->timer_id, ahead - lead, p_user);
+            if (err_code != NRF_SUCCESS)
+            {
+                p_user->state = NRF_DRV_CLOCK_HF_USER_IDLE;
+            }
+            else
+            {
+                NRF_LOG_DEBUG("%s: HFCLK request in %d ticks.",
+                              (uint32_t)p_user->p_name, ahead - lead);
+            }
+        }
+    }
+
+    return err_code;
+}
+
+ret_code_t nrf_drv_clock_hf_user_request(nrf_drv_clock_hf_user_t * p_user)
+{
+    return nrf_drv_clock_hf_user_request_ahead(p_user, app_timer_cnt_get());
+}
+
+void nrf_drv_clock_hf_user_release(nrf_drv_clock_hf_user_t * p_user)
+{
+    nrf_drv_clock_hf_user_state_t state;
+
+    ASSERT(m_clock_cb.module_initialized);
+
+    CRITICAL_REGION_ENTER();
+    state         = p_user->state;
+    p_user->state = NRF_DRV_CLOCK_HF_USER_IDLE;
+    if (state == NRF_DRV_CLOCK_HF_USER_WAITING)
+    {
+        hf_user_wait_remove(p_user);
+        item_remove((nrf_drv_clock_handler_item_t **)&m_clock_cb.p_hf_head, &p_user->item);
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (state == NRF_DRV_CLOCK_HF_USER_SCHEDULED)
+    {
+        // A timeout already pending finds the requester idle and does nothing.
+        (void)app_timer_stop(p_user->timer_id);
+    }
+    else if (state != NRF_DRV_CLOCK_HF_USER_IDLE)
+    {
+        nrf_drv_clock_hfclk_release();
+    }
+}
+
+void nrf_drv_clock_hf_user_stats_get(nrf_drv_clock_hf_user_t const * p_user,
+                                     nrf_drv_clock_hf_stats_t *      p_stats)
+{
+    CRITICAL_REGION_ENTER();
+    *p_stats = p_user->stats;
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf_drv_clock_hf_user_stats_reset(nrf_drv_clock_hf_user_t * p_user)
+{
+    CRITICAL_REGION_ENTER();
+    memset(&p_user->stats, 0, sizeof(p_user->stats));
+    CRITICAL_REGION_EXIT();
+}
+
+uint32_t nrf_drv_clock_hfxo_startup_ticks_get(void)
+{
+    return MAX(HFXO_STARTUP_CONFIG_TICKS, m_clock_cb.hf_startup_max) + 1;
+}
+#endif // CLOCK_CONFIG_HF_AHEAD_ENABLED
+
 #if CALIBRATION_SUPPORT
 static void clock_calibration_hf_started(nrf_drv_clock_evt_type_t event)
 {
@@ -489,6 +770,480 @@ ret_code_t nrf_drv_clock_is_calibrating(bool * p_is_calibrating)
 #endif // CALIBRATION_SUPPORT
 }
 
+#if CLOCK_CONFIG_LFRC_SCHED_ENABLED
+/**@brief Error which LFCLK is kept within, as measured against HFXO, in ppm. */
+#define LFRC_LIMIT_PPM (CLOCK_CONFIG_LFRC_TARGET_PPM -      \
+                        CLOCK_CONFIG_LFRC_HFXO_PPM -        \
+                        NRF_DRV_CLOCK_LFRC_RESOLUTION_PPM)
+
+STATIC_ASSERT(CLOCK_CONFIG_LFRC_TARGET_PPM >
+              (CLOCK_CONFIG_LFRC_HFXO_PPM + NRF_DRV_CLOCK_LFRC_RESOLUTION_PPM));
+// One RTC1 tick must be short, as the TICK event is waited for when the window is captured.
+STATIC_ASSERT(APP_TIMER_CONFIG_RTC_FREQUENCY == 0);
+
+/**@brief Longest time between two measurements, in milliseconds. */
+#define LFRC_MAX_INTERVAL_MS (CLOCK_CONFIG_LFRC_MAX_INTERVAL_S * 1000UL)
+
+typedef enum
+{
+    LFRC_STATE_IDLE,    ///< Scheduler stopped.
+    LFRC_STATE_POLL,    ///< Waiting for the next temperature reading.
+    LFRC_STATE_HF_WAIT, ///< HFCLK requested for a measurement.
+    LFRC_STATE_MEASURE, ///< Measurement window running.
+    LFRC_STATE_CAL,     ///< Calibration running.
+} nrf_drv_clock_lfrc_state_t;
+
+/**@brief LFRC scheduler control block. */
+typedef struct
+{
+    nrf_drv_clock_handler_item_t        hf_item;        ///< Item used for the HFCLK started event.
+    nrf_drv_clock_event_handler_t       cal_handler;    ///< Handler of calibration events.
+    app_timer_t                         timer;          ///< Timer of polls and measurement windows.
+    app_timer_id_t                      timer_id;       ///< Identifier of the timer.
+    nrf_ppi_channel_t                   ppi;            ///< PPI channel from TICK to the capture task.
+    bool                                resources_init; ///< Timers and PPI channel allocated.
+    volatile bool                       active;         ///< Scheduler started and not stopped.
+    volatile nrf_drv_clock_lfrc_state_t state;          ///< Scheduler state.
+    bool                                after_cal;      ///< Measurement of the error left by a calibration.
+    bool                                rate_known;     ///< Drift rate measured at least once.
+    bool                                base_valid;     ///< A measurement was made since the start.
+    uint32_t                            lf_start;       ///< RTC1 counter at the start of the window.
+    uint32_t                            hf_start;       ///< TIMER capture at the start of the window.
+    uint32_t                            last_ticks;     ///< app_timer counter when elapsed was updated.
+    uint64_t                            elapsed;        ///< Time since the last measurement, in app_timer ticks.
+    uint32_t                            interval_ticks; ///< Time from the last measurement to the next one.
+    int32_t                             base_error;     ///< Error at the last measurement, in ppm.
+    int32_t                             base_temp;      ///< Temperature at the last measurement.
+    nrf_drv_clock_lfrc_stats_t          stats;          ///< Measurement statistics.
+} nrf_drv_clock_lfrc_cb_t;
+
+static nrf_drv_clock_lfrc_cb_t m_lfrc;
+static nrfx_timer_t const      m_lfrc_timer = NRFX_TIMER_INSTANCE(CLOCK_CONFIG_LFRC_TIMER_INSTANCE);
+
+/**@brief Function for reading the die temperature, in 0.25 degree Celsius units. */
+static int32_t lfrc_temp_read(void)
+{
+    int32_t temp;
+
+#ifdef SOFTDEVICE_PRESENT
+    // The TEMP peripheral is restricted while the SoftDevice is enabled.
+    APP_ERROR_CHECK(sd_temp_get(&temp));
+#else
+    NRF_TEMP->EVENTS_DATARDY = 0;
+    NRF_TEMP->TASKS_START    = 1;
+    while (NRF_TEMP->EVENTS_DATARDY == 0)
+    {}
+    NRF_TEMP->EVENTS_DATARDY = 0;
+    temp = (int32_t)NRF_TEMP->TEMP;
+    NRF_TEMP->TASKS_STOP     = 1;
+#endif
+
+    return temp;
+}
+
+/**@brief Function for adding the time since the last call to the time since the last measurement. */
+static void lfrc_elapsed_update(void)
+{
+    uint32_t now = app_timer_cnt_get();
+
+    m_lfrc.elapsed   += app_timer_cnt_diff_compute(now, m_lfrc.last_ticks);
+    m_lfrc.last_ticks = now;
+}
+
+/**@brief Function for reading an RTC1 counter value together with the TIMER count at its TICK event.
+ *
+ * @details The TIMER is captured on every TICK, so the capture is read after the counter
+ *          changed and the capture changed, and read again if another tick came meanwhile,
+ *          for example because an interrupt delayed this function.
+ */
+static void lfrc_capture(uint32_t * p_lf, uint32_t * p_hf)
+{
+    uint32_t lf;
+    uint32_t hf;
+
+    do
+    {
+        uint32_t lf_prev = nrf_rtc_counter_get(NRF_RTC1);
+        uint32_t hf_prev = nrfx_timer_capture_get(&m_lfrc_timer, NRF_TIMER_CC_CHANNEL0);
+
+        do
+        {
+            lf = nrf_rtc_counter_get(NRF_RTC1);
+        } while (lf == lf_prev);
+
+        do
+        {
+            hf = nrfx_timer_capture_get(&m_lfrc_timer, NRF_TIMER_CC_CHANNEL0);
+        } while (hf == hf_prev);
+    } while (nrf_rtc_counter_get(NRF_RTC1) != lf);
+
+    *p_lf = lf;
+    *p_hf = hf;
+}
+
+/**@brief Function for starting a measurement window. HFCLK must be running. */
+static void lfrc_measure_begin(void)
+{
+    nrfx_timer_clear(&m_lfrc_timer);
+    nrfx_timer_enable(&m_lfrc_timer);
+    nrf_rtc_event_enable(NRF_RTC1, NRF_RTC_INT_TICK_MASK);
+    APP_ERROR_CHECK(nrfx_ppi_channel_enable(m_lfrc.ppi));
+
+    lfrc_capture(&m_lfrc.lf_start, &m_lfrc.hf_start);
+
+    m_lfrc.state = LFRC_STATE_MEASURE;
+    APP_ERROR_CHECK(app_timer_start(m_lfrc.timer_id,
+                                    APP_TIMER_TICKS(CLOCK_CONFIG_LFRC_MEASURE_MS),
+                                    NULL));
+}
+
+/**@brief Function for ending a measurement window.
+ *
+ * @return Frequency error of LFCLK relative to HFXO, in ppm.
+ */
+static int32_t lfrc_measure_end(void)
+{
+    uint32_t lf;
+    uint32_t hf;
+
+    lfrc_capture(&lf, &hf);
+
+    APP_ERROR_CHECK(nrfx_ppi_channel_disable(m_lfrc.ppi));
+    nrf_rtc_event_disable(NRF_RTC1, NRF_RTC_INT_TICK_MASK);
+    nrfx_timer_disable(&m_lfrc_timer);
+
+    // One RTC tick is 16 MHz / 32768 = 15625 / 32 TIMER ticks.
+    int64_t lf_ticks = (int64_t)((lf - m_lfrc.lf_start) & RTC_COUNTER_COUNTER_Msk);
+    int64_t hf_ticks = (int64_t)(uint32_t)(hf - m_lfrc.hf_start);
+    int64_t ideal    = hf_ticks * 32;
+
+    return (int32_t)(((lf_ticks * 15625 - ideal) * 1000000) / ideal);
+}
+
+/**@brief Function for getting the time until the error reaches the limit at the measured drift.
+ *
+ * @param[in] error Error measured last, in ppm.
+ *
+ * @return Time in milliseconds, 0 if the error is at the limit already.
+ */
+static uint32_t lfrc_time_to_limit_ms(int32_t error)
+{
+    // The error may be larger than measured by the resolution of the measurement.
+    uint32_t magnitude = (uint32_t)abs(error) + NRF_DRV_CLOCK_LFRC_RESOLUTION_PPM;
+
+    if (magnitude >= LFRC_LIMIT_PPM)
+    {
+        return 0;
+    }
+    if (m_lfrc.stats.drift_rate == 0)
+    {
+        return UINT32_MAX;
+    }
+    // ppm to ppb is * 1000, seconds to milliseconds is * 1000.
+    uint64_t ms = ((uint64_t)(LFRC_LIMIT_PPM - magnitude) * 1000000) / m_lfrc.stats.drift_rate;
+    return (uint32_t)MIN(ms, UINT32_MAX);
+}
+
+/**@brief Function for releasing HFCLK and waiting for the next measurement, or stopping. */
+static void lfrc_schedule(int32_t error)
+{
+    uint32_t interval_ms;
+
+#ifdef SOFTDEVICE_PRESENT
+    // The SoftDevice calibrates on its own schedule, so the drift of one interval does not tell
+    // when the next calibration is needed. Measure periodically and on temperature changes.
+    UNUSED_PARAMETER(error);
+    interval_ms = LFRC_MAX_INTERVAL_MS;
+#else
+    if (!m_lfrc.rate_known)
+    {
+        interval_ms = CLOCK_CONFIG_LFRC_POLL_MS;
+    }
+    else
+    {
+        // Measure halfway to the limit, so that a faster drift is seen before it is reached.
+        interval_ms = lfrc_time_to_limit_ms(error) / 2;
+    }
+    interval_ms = MAX(interval_ms, CLOCK_CONFIG_LFRC_POLL_MS);
+    interval_ms = MIN(interval_ms, LFRC_MAX_INTERVAL_MS);
+#endif
+
+    m_lfrc.stats.interval_ms = interval_ms;
+    m_lfrc.interval_ticks    = APP_TIMER_TICKS(interval_ms);
+
+    nrf_drv_clock_hfclk_release();
+
+    if (!m_lfrc.active)
+    {
+        m_lfrc.state = LFRC_STATE_IDLE;
+        return;
+    }
+
+    m_lfrc.state = LFRC_STATE_POLL;
+    APP_ERROR_CHECK(app_timer_start(m_lfrc.timer_id,
+                                    APP_TIMER_TICKS(CLOCK_CONFIG_LFRC_POLL_MS),
+                                    NULL));
+}
+
+/**@brief Function for handling the HFCLK started event of a measurement. */
+static void lfrc_hf_started(nrf_drv_clock_evt_type_t event)
+{
+    ASSERT(event == NRF_DRV_CLOCK_EVT_HFCLK_STARTED);
+    UNUSED_PARAMETER(event);
+
+    if (!m_lfrc.active)
+    {
+        nrf_drv_clock_hfclk_release();
+        m_lfrc.state = LFRC_STATE_IDLE;
+        return;
+    }
+
+    lfrc_measure_begin();
+}
+
+/**@brief Function for requesting HFCLK for a measurement. */
+static void lfrc_measure_request(void)
+{
+    m_lfrc.state = LFRC_STATE_HF_WAIT;
+    nrf_drv_clock_hfclk_request(&m_lfrc.hf_item);
+}
+
+#if CALIBRATION_SUPPORT
+/**@brief Function for handling the end of a calibration started by the scheduler. */
+static void lfrc_cal_done(nrf_drv_clock_evt_type_t event)
+{
+    if (m_lfrc.cal_handler)
+    {
+        m_lfrc.cal_handler(event);
+    }
+
+    if ((event == NRF_DRV_CLOCK_EVT_CAL_DONE) && m_lfrc.active)
+    {
+        // HFCLK is still requested by the scheduler.
+        m_lfrc.after_cal = true;
+        lfrc_measure_begin();
+    }
+    else
+    {
+        lfrc_schedule(m_lfrc.base_error);
+    }
+}
+#endif // CALIBRATION_SUPPORT
+
+/**@brief Function for handling the end of a measurement window. */
+static void lfrc_measure_done(void)
+{
+    int32_t  error     = lfrc_measure_end();
+    uint32_t magnitude = (uint32_t)abs(error);
+
+    lfrc_elapsed_update();
+
+    m_lfrc.stats.measure_count++;
+    m_lfrc.stats.error_last = error;
+    m_lfrc.stats.error_max  = MAX(m_lfrc.stats.error_max, magnitude);
+    m_lfrc.stats.temp       = lfrc_temp_read();
+
+    bool residual = m_lfrc.after_cal;
+    if (residual)
+    {
+        m_lfrc.after_cal           = false;
+        m_lfrc.stats.residual_last = error;
+    }
+    else
+    {
+        uint64_t ms = ROUNDED_DIV(m_lfrc.elapsed * 1000 * (APP_TIMER_CONFIG_RTC_FREQUENCY + 1),
+                                  APP_TIMER_CLOCK_FREQ);
+        if (m_lfrc.base_valid && (ms > 0))
+        {
+            // ppm to ppb is * 1000, milliseconds to seconds is * 1000.
+            uint64_t rate = ((uint64_t)abs(error - m_lfrc.base_error) * 1000000) / ms;
+            m_lfrc.stats.drift_rate = (uint32_t)MIN(rate, UINT32_MAX);
+            m_lfrc.rate_known       = true;
+        }
+    }
+
+    NRF_LOG_DEBUG("LFRC error %d ppm, drift %u ppb/s.", error, m_lfrc.stats.drift_rate);
+
+    m_lfrc.base_error = error;
+    m_lfrc.base_temp  = m_lfrc.stats.temp;
+    m_lfrc.base_valid = true;
+    m_lfrc.elapsed    = 0;
+
+#if CALIBRATION_SUPPORT
+    // Calibrate if the error could reach the limit before the measurement after the next poll.
+    // The error left by a calibration is not calibrated again at once.
+    if (m_lfrc.active && !residual &&
+        (lfrc_time_to_limit_ms(error) < (2 * CLOCK_CONFIG_LFRC_POLL_MS)))
+    {
+        m_lfrc.state = LFRC_STATE_CAL;
+        if (nrf_drv_clock_calibration_start(0, lfrc_cal_done) == NRF_SUCCESS)
+        {
+            m_lfrc.stats.cal_count++;
+            return;
+        }
+    }
+#endif // CALIBRATION_SUPPORT
+
+    lfrc_schedule(error);
+}
+
+/**@brief Function for reading the temperature and measuring if it changed or the interval passed. */
+static void lfrc_poll(void)
+{
+    lfrc_elapsed_update();
+
+    int32_t temp = lfrc_temp_read();
+
+    if ((abs(temp - m_lfrc.base_temp) >= CLOCK_CONFIG_LFRC_TEMP_STEP) ||
+        (m_lfrc.elapsed >= m_lfrc.interval_ticks))
+    {
+        lfrc_measure_request();
+    }
+    else
+    {
+        APP_ERROR_CHECK(app_timer_start(m_lfrc.timer_id,
+                                        APP_TIMER_TICKS(CLOCK_CONFIG_LFRC_POLL_MS),
+                                        NULL));
+    }
+}
+
+static void lfrc_timeout_handler(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    switch (m_lfrc.state)
+    {
+        case LFRC_STATE_POLL:
+            if (m_lfrc.active)
+            {
+                lfrc_poll();
+            }
+            else
+            {
+                m_lfrc.state = LFRC_STATE_IDLE;
+            }
+            break;
+
+        case LFRC_STATE_MEASURE:
+            lfrc_measure_done();
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void lfrc_timer_evt_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    // No TIMER interrupts are enabled.
+    UNUSED_PARAMETER(event_type);
+    UNUSED_PARAMETER(p_context);
+}
+
+/**@brief Function for allocating the timers and the PPI channel used by the scheduler. */
+static ret_code_t lfrc_resources_init(void)
+{
+    ret_code_t          err_code;
+    nrfx_timer_config_t config = NRFX_TIMER_DEFAULT_CONFIG;
+
+    config.frequency = NRF_TIMER_FREQ_16MHz;
+    config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+    err_code = nrfx_timer_init(&m_lfrc_timer, &config, lfrc_timer_evt_handler);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = nrfx_ppi_channel_alloc(&m_lfrc.ppi);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = nrfx_ppi_channel_assign(m_lfrc.ppi,
+                   nrf_rtc_event_address_get(NRF_RTC1, NRF_RTC_EVENT_TICK),
+                   nrfx_timer_capture_task_address_get(&m_lfrc_timer, NRF_TIMER_CC_CHANNEL0));
+    VERIFY_SUCCESS(err_code);
+
+    m_lfrc.timer_id = &m_lfrc.timer;
+    err_code = app_timer_create(&m_lfrc.timer_id, APP_TIMER_MODE_SINGLE_SHOT, lfrc_timeout_handler);
+    VERIFY_SUCCESS(err_code);
+
+    m_lfrc.hf_item.event_handler = lfrc_hf_started;
+    m_lfrc.resources_init        = true;
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_drv_clock_lfrc_start(nrf_drv_clock_event_handler_t handler)
+{
+    ret_code_t err_code;
+
+    ASSERT(m_clock_cb.module_initialized);
+
+    if (!m_clock_cb.lfclk_on || (m_lfrc.state != LFRC_STATE_IDLE))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (!m_lfrc.resources_init)
+    {
+        err_code = lfrc_resources_init();
+        VERIFY_SUCCESS(err_code);
+    }
+
+    m_lfrc.cal_handler = handler;
+    m_lfrc.after_cal   = false;
+    m_lfrc.rate_known  = false;
+    m_lfrc.base_valid  = false;
+    m_lfrc.last_ticks  = app_timer_cnt_get();
+    m_lfrc.elapsed     = 0;
+    m_lfrc.active      = true;
+
+    lfrc_measure_request();
+
+    NRF_LOG_INFO("LFRC scheduler started, limit %u ppm.", LFRC_LIMIT_PPM);
+    return NRF_SUCCESS;
+}
+
+void nrf_drv_clock_lfrc_stop(void)
+{
+    CRITICAL_REGION_ENTER();
+    m_lfrc.active = false;
+    if (m_lfrc.state == LFRC_STATE_POLL)
+    {
+        (void)app_timer_stop(m_lfrc.timer_id);
+        m_lfrc.state = LFRC_STATE_IDLE;
+    }
+#if CALIBRATION_SUPPORT
+    else if (m_lfrc.state == LFRC_STATE_CAL)
+    {
+        (void)nrf_drv_clock_calibration_abort();
+    }
+#endif
+    CRITICAL_REGION_EXIT();
+}
+
+uint32_t nrf_drv_clock_lfrc_accuracy_ppm_get(void)
+{
+    if (m_lfrc.stats.measure_count == 0)
+    {
+        return NRF_DRV_CLOCK_LFRC_ACCURACY_UNKNOWN;
+    }
+    return m_lfrc.stats.error_max + NRF_DRV_CLOCK_LFRC_RESOLUTION_PPM + CLOCK_CONFIG_LFRC_HFXO_PPM;
+}
+
+void nrf_drv_clock_lfrc_stats_get(nrf_drv_clock_lfrc_stats_t * p_stats)
+{
+    CRITICAL_REGION_ENTER();
+    *p_stats = m_lfrc.stats;
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf_drv_clock_lfrc_stats_reset(void)
+{
+    CRITICAL_REGION_ENTER();
+    m_lfrc.stats.measure_count = 0;
+    m_lfrc.stats.cal_count     = 0;
+    m_lfrc.stats.error_max     = 0;
+    CRITICAL_REGION_EXIT();
+}
+#endif // CLOCK_CONFIG_LFRC_SCHED_ENABLED
+
 __STATIC_INLINE void clock_clk_started_notify(nrf_drv_clock_evt_type_t evt_type)
 {
     nrf_drv_clock_handler_item_t **p_head;
@@ -518,6 +1273,9 @@ static void clock_irq_handler(nrfx_clock_evt_type_t evt)
     if (evt == NRFX_CLOCK_EVT_HFCLK_STARTED)
     {
         m_clock_cb.hfclk_on = true;
+#if CLOCK_CONFIG_HF_AHEAD_ENABLED
+        hf_users_started();
+#endif
         clock_clk_started_notify(NRF_DRV_CLOCK_EVT_HFCLK_STARTED);
     }
     if (evt == NRFX_CLOCK_EVT_LFCLK_STARTED)
@@ -557,6 +1315,9 @@ static void soc_evt_handler(uint32_t evt_id, void * p_context)
     if (evt_id == NRF_EVT_HFCLKSTARTED)
     {
         m_clock_cb.hfclk_on = true;
+#if CLOCK_CONFIG_HF_AHEAD_ENABLED
+        hf_users_started();
+#endif
         clock_clk_started_notify(NRF_DRV_CLOCK_EVT_HFCLK_STARTED);
     }
 }
@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_drv_clock_ahead HFCLK requests ahead of time
+ * @{
+ * @ingroup nrf_drv_clock
+ *
+ * @brief Starting HFXO before a deadline, with per requester wait time accounting.
+ *
+ * @details A requester which knows when it will need HFXO, for example from an app_timer
+ *          deadline, calls @ref nrf_drv_clock_hf_user_request_ahead with that time. The driver
+ *          starts the crystal its start-up time before the deadline, so the requester does not
+ *          wait and HFXO does not have to be held between uses. The start-up time used is the
+ *          larger of CLOCK_CONFIG_HFXO_STARTUP_US and the longest start-up measured by the driver.
+ *
+ *          Requests are counted together with the ones made with nrf_drv_clock_hfclk_request(),
+ *          so HFXO stays on until the last requester releases it. For each requester the driver
+ *          records how long it waited for HFXO after the time it needed it, and how long HFXO
+ *          was running before that time. Times are in app_timer ticks and are measured in the
+ *          CLOCK (or SoftDevice SoC event) interrupt, so they include its latency.
+ */
+
+#ifndef NRF_DRV_CLOCK_AHEAD_H__
+#define NRF_DRV_CLOCK_AHEAD_H__
+
+#include "nrf_drv_clock.h"
+#include "app_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Wait time statistics of an HFCLK requester, in app_timer ticks. */
+typedef struct
+{
+    uint32_t request_count; ///< Number of requests for which HFXO was provided.
+    uint32_t wait_count;    ///< Number of requests for which HFXO was started after it was needed.
+    uint32_t wait_last;     ///< Wait of the last request.
+    uint32_t wait_max;      ///< Longest wait.
+    uint64_t wait_sum;      ///< Sum of waits of all requests.
+    uint64_t early_sum;     ///< Sum of the time HFXO was running before it was needed.
+} nrf_drv_clock_hf_stats_t;
+
+/**@brief State of an HFCLK requester. */
+typedef enum
+{
+    NRF_DRV_CLOCK_HF_USER_IDLE,      ///< HFCLK not requested.
+    NRF_DRV_CLOCK_HF_USER_SCHEDULED, ///< Request scheduled ahead of the deadline.
+    NRF_DRV_CLOCK_HF_USER_WAITING,   ///< HFCLK requested, waiting for HFXO to start.
+    NRF_DRV_CLOCK_HF_USER_RUNNING,   ///< HFCLK requested and running.
+} nrf_drv_clock_hf_user_state_t;
+
+typedef struct nrf_drv_clock_hf_user_s nrf_drv_clock_hf_user_t;
+
+/**@brief HFCLK requester. All fields are used by the driver. */
+struct nrf_drv_clock_hf_user_s
+{
+    nrf_drv_clock_handler_item_t           item;        ///< Item used for the HFCLK started event.
+    char const *                           p_name;      ///< Name used in the log.
+    app_timer_t                            timer;       ///< Timer starting a scheduled request.
+    app_timer_id_t                         timer_id;    ///< Identifier of the timer.
+    uint32_t                               need_ticks;  ///< Time when HFXO is needed.
+    nrf_drv_clock_hf_user_t *              p_next_wait; ///< Next requester waiting for HFXO.
+    volatile nrf_drv_clock_hf_user_state_t state;       ///< Requester state.
+    nrf_drv_clock_hf_stats_t               stats;       ///< Wait time statistics.
+};
+
+/**
+ * @brief Function for initializing an HFCLK requester.
+ *
+ * @param[out] p_user  Requester.
+ * @param[in]  p_name  Name used in the log.
+ * @param[in]  handler Handler called when HFXO is running, or NULL. It is called from the
+ *                     CLOCK interrupt, or from the context of the request if HFXO is already
+ *                     running.
+ *
+ * @return Error code returned by app_timer_create().
+ */
+ret_code_t nrf_drv_clock_hf_user_init(nrf_drv_clock_hf_user_t *     p_user,
+                                      char const *                  p_name,
+                                      nrf_drv_clock_event_handler_t handler);
+
+/**
+ * @brief Function for requesting HFCLK to be running at a given time.
+ *
+ * If the deadline is closer than the HFXO start-up time, HFCLK is requested at once.
+ * Otherwise an app_timer is started which requests it just in time.
+ *
+ * @param[in] p_user   Requester.
+ * @param[in] deadline Time when HFXO is needed, as a value of app_timer_cnt_get().
+ *                     It must be less than half of the RTC counter range away.
+ *
+ * @retval NRF_SUCCESS             Request made or scheduled.
+ * @retval NRF_ERROR_INVALID_STATE The requester already has a request.
+ * @return Other error code returned by app_timer_start().
+ */
+ret_code_t nrf_drv_clock_hf_user_request_ahead(nrf_drv_clock_hf_user_t * p_user,
+                                               uint32_t                  deadline);
+
+/**
+ * @brief Function for requesting HFCLK at once.
+ *
+ * @param[in] p_user Requester.
+ *
+ * @retval NRF_SUCCESS             Request made.
+ * @retval NRF_ERROR_INVALID_STATE The requester already has a request.
+ */
+ret_code_t nrf_drv_clock_hf_user_request(nrf_drv_clock_hf_user_t * p_user);
+
+/**
+ * @brief Function for releasing HFCLK, or cancelling a scheduled request.
+ *
+ * The handler of the requester is not called after this function returns.
+ *
+ * @param[in] p_user Requester.
+ */
+void nrf_drv_clock_hf_user_release(nrf_drv_clock_hf_user_t * p_user);
+
+/**
+ * @brief Function for getting the wait time statistics of a requester.
+ *
+ * @param[in]  p_user  Requester.
+ * @param[out] p_stats Copy of the statistics.
+ */
+void nrf_drv_clock_hf_user_stats_get(nrf_drv_clock_hf_user_t const * p_user,
+                                     nrf_drv_clock_hf_stats_t *      p_stats);
+
+/**
+ * @brief Function for clearing the wait time statistics of a requester.
+ *
+ * @param[in] p_user Requester.
+ */
+void nrf_drv_clock_hf_user_stats_reset(nrf_drv_clock_hf_user_t * p_user);
+
+/**
+ * @brief Function for getting the time by which HFXO is started ahead of a deadline.
+ *
+ * @return The larger of CLOCK_CONFIG_HFXO_STARTUP_US and the longest measured start-up,
+ *         plus one tick, in app_timer ticks.
+ */
+uint32_t nrf_drv_clock_hfxo_startup_ticks_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_DRV_CLOCK_AHEAD_H__
+
+/** @} */
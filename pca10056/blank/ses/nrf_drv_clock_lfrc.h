@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_drv_clock_lfrc Drift measuring LFRC calibration scheduler
+ * @{
+ * @ingroup nrf_drv_clock
+ *
+ * @brief Calibrating the LFRC oscillator when its measured error requires it, and reporting
+ *        the sleep clock accuracy which the measurements prove.
+ *
+ * @details The scheduler measures the frequency error of LFCLK against HFXO: a TIMER running
+ *          at 16 MHz captures its count on RTC1 TICK events, which are routed through PPI while
+ *          a measurement is running. The error of a measurement window of
+ *          CLOCK_CONFIG_LFRC_MEASURE_MS is known to within @ref NRF_DRV_CLOCK_LFRC_RESOLUTION_PPM.
+ *
+ *          The die temperature is read every CLOCK_CONFIG_LFRC_POLL_MS, which does not need
+ *          HFXO. The error is measured when the temperature has changed by
+ *          CLOCK_CONFIG_LFRC_TEMP_STEP since the last measurement, or when the time predicted
+ *          from the drift between the previous measurements has passed. Without a SoftDevice,
+ *          the scheduler then calibrates the oscillator if the error would reach the limit
+ *          derived from CLOCK_CONFIG_LFRC_TARGET_PPM before the next measurement, and measures
+ *          the error left by the calibration. A stable oscillator is measured and calibrated
+ *          less often than with a fixed calibration interval, down to once every
+ *          CLOCK_CONFIG_LFRC_MAX_INTERVAL_S.
+ *
+ *          When the SoftDevice is present, it calibrates the oscillator as configured with
+ *          NRF_SDH_CLOCK_LF_RC_CTIV and NRF_SDH_CLOCK_LF_RC_TEMP_CTIV, and the scheduler only
+ *          measures. Either way, @ref nrf_drv_clock_lfrc_accuracy_ppm_get returns the largest
+ *          measured error plus the measurement resolution and CLOCK_CONFIG_LFRC_HFXO_PPM, which
+ *          can be used to select a lower NRF_SDH_CLOCK_LF_ACCURACY than the 500 ppm declared
+ *          for an uncharacterized oscillator.
+ *
+ * @note The scheduler uses app_timer, which must run RTC1 without prescaler for the TICK
+ *       events to be 30.5 us apart, and the TIMER instance CLOCK_CONFIG_LFRC_TIMER_INSTANCE,
+ *       which must be enabled in the nrfx_timer configuration. Do not call
+ *       nrf_drv_clock_calibration_start() while the scheduler is running.
+ */
+
+#ifndef NRF_DRV_CLOCK_LFRC_H__
+#define NRF_DRV_CLOCK_LFRC_H__
+
+#include "nrf_drv_clock.h"
+#ifdef SOFTDEVICE_PRESENT
+#include "nrf_sdm.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Uncertainty of one error measurement, in ppm.
+ *
+ * @details Each end of the window is captured to within one period of the 16 MHz TIMER.
+ */
+#define NRF_DRV_CLOCK_LFRC_RESOLUTION_PPM \
+    ((125 + CLOCK_CONFIG_LFRC_MEASURE_MS - 1) / CLOCK_CONFIG_LFRC_MEASURE_MS)
+
+/**@brief Accuracy reported before the first measurement, in ppm. */
+#define NRF_DRV_CLOCK_LFRC_ACCURACY_UNKNOWN 500
+
+/**@brief Measurement statistics of the scheduler. */
+typedef struct
+{
+    uint32_t measure_count; ///< Number of error measurements, including those after a calibration.
+    uint32_t cal_count;     ///< Number of calibrations started by the scheduler.
+    int32_t  error_last;    ///< Error measured last, in ppm. Positive if LFCLK runs fast.
+    int32_t  residual_last; ///< Error measured after the last calibration, in ppm.
+    uint32_t error_max;     ///< Largest magnitude of a measured error, in ppm.
+    uint32_t drift_rate;    ///< Drift between the last two measurements, in ppb per second.
+    uint32_t interval_ms;   ///< Time from the last measurement to the next one.
+    int32_t  temp;          ///< Die temperature at the last measurement, in 0.25 degree units.
+} nrf_drv_clock_lfrc_stats_t;
+
+/**
+ * @brief Function for starting the scheduler.
+ *
+ * The first measurement is made at once. LFCLK must be running.
+ *
+ * @param[in] handler Handler called with @ref NRF_DRV_CLOCK_EVT_CAL_DONE or
+ *                    @ref NRF_DRV_CLOCK_EVT_CAL_ABORTED after each calibration started by the
+ *                    scheduler, or NULL. It is called from the CLOCK interrupt.
+ *
+ * @retval NRF_SUCCESS             Scheduler started.
+ * @retval NRF_ERROR_INVALID_STATE LFCLK is not running, or the scheduler is already running.
+ * @return Other error code returned by app_timer, nrfx_timer or nrfx_ppi.
+ */
+ret_code_t nrf_drv_clock_lfrc_start(nrf_drv_clock_event_handler_t handler);
+
+/**
+ * @brief Function for stopping the scheduler.
+ *
+ * A measurement or calibration in progress is completed or aborted before HFCLK is released.
+ * The statistics are kept.
+ */
+void nrf_drv_clock_lfrc_stop(void);
+
+/**
+ * @brief Function for getting the sleep clock accuracy proven by the measurements.
+ *
+ * @return Largest measured error plus @ref NRF_DRV_CLOCK_LFRC_RESOLUTION_PPM and
+ *         CLOCK_CONFIG_LFRC_HFXO_PPM, or @ref NRF_DRV_CLOCK_LFRC_ACCURACY_UNKNOWN before the
+ *         first measurement, in ppm.
+ */
+uint32_t nrf_drv_clock_lfrc_accuracy_ppm_get(void);
+
+/**
+ * @brief Function for getting the measurement statistics of the scheduler.
+ *
+ * @param[out] p_stats Copy of the statistics.
+ */
+void nrf_drv_clock_lfrc_stats_get(nrf_drv_clock_lfrc_stats_t * p_stats);
+
+/**
+ * @brief Function for clearing the largest measured error and the counters.
+ *
+ * Use it after a change of conditions, for example a new temperature range, to prove the
+ * accuracy again. The accuracy is unknown until the next measurement.
+ */
+void nrf_drv_clock_lfrc_stats_reset(void);
+
+#ifdef SOFTDEVICE_PRESENT
+/**
+ * @brief Function for converting an accuracy in ppm to the SoftDevice clock accuracy.
+ *
+ * @param[in] ppm Accuracy, for example from @ref nrf_drv_clock_lfrc_accuracy_ppm_get.
+ *
+ * @return The tightest NRF_CLOCK_LF_ACCURACY_* value which is not tighter than @p ppm.
+ */
+__STATIC_INLINE uint8_t nrf_drv_clock_lfrc_sd_accuracy(uint32_t ppm)
+{
+    static const struct
+    {
+        uint16_t ppm;
+        uint8_t  accuracy;
+    } accuracies[] =
+    {
+        {1,   NRF_CLOCK_LF_ACCURACY_1_PPM},   {2,   NRF_CLOCK_LF_ACCURACY_2_PPM},
+        {5,   NRF_CLOCK_LF_ACCURACY_5_PPM},   {10,  NRF_CLOCK_LF_ACCURACY_10_PPM},
+        {20,  NRF_CLOCK_LF_ACCURACY_20_PPM},  {30,  NRF_CLOCK_LF_ACCURACY_30_PPM},
+        {50,  NRF_CLOCK_LF_ACCURACY_50_PPM},  {75,  NRF_CLOCK_LF_ACCURACY_75_PPM},
+        {100, NRF_CLOCK_LF_ACCURACY_100_PPM}, {150, NRF_CLOCK_LF_ACCURACY_150_PPM},
+        {250, NRF_CLOCK_LF_ACCURACY_250_PPM},
+    };
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(accuracies); i++)
+    {
+        if (ppm <= accuracies[i].ppm)
+        {
+            return accuracies[i].accuracy;
+        }
+    }
+    return NRF_CLOCK_LF_ACCURACY_500_PPM;
+}
+#endif // SOFTDEVICE_PRESENT
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_DRV_CLOCK_LFRC_H__
+
+/** @} */
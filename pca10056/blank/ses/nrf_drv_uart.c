@@ -53,53 +53,53 @@ static void *                   m_contexts[INSTANCE_COUNT];
 uint8_t nrf_drv_uart_use_easy_dma[INSTANCE_COUNT];
 #endif
 
+/*
+ * The events of the legacy layer have the layout of the nrfx events, so the handlers pass the
+ * nrfx event on instead of translating it.
+ */
+#define EVENT_LAYOUT_CHECK(_prefix)                                                               \
+    STATIC_ASSERT(sizeof(nrf_drv_uart_event_t) == sizeof(CONCAT_2(_prefix, _event_t)));          \
+    STATIC_ASSERT(offsetof(nrf_drv_uart_event_t, type) ==                                         \
+                  offsetof(CONCAT_2(_prefix, _event_t), type));                                   \
+    STATIC_ASSERT(sizeof(nrf_drv_uart_evt_type_t) == sizeof(CONCAT_2(_prefix, _evt_type_t)));    \
+    STATIC_ASSERT(offsetof(nrf_drv_uart_event_t, data.rxtx.p_data) ==                             \
+                  offsetof(CONCAT_2(_prefix, _event_t), data.rxtx.p_data));                       \
+    STATIC_ASSERT(offsetof(nrf_drv_uart_event_t, data.rxtx.bytes) ==                              \
+                  offsetof(CONCAT_2(_prefix, _event_t), data.rxtx.bytes));                        \
+    STATIC_ASSERT(sizeof(((nrf_drv_uart_event_t *)0)->data.rxtx.bytes) ==                         \
+                  sizeof(((CONCAT_2(_prefix, _event_t) *)0)->data.rxtx.bytes));                   \
+    STATIC_ASSERT(offsetof(nrf_drv_uart_event_t, data.error.rxtx.p_data) ==                       \
+                  offsetof(CONCAT_2(_prefix, _event_t), data.error.rxtx.p_data));                 \
+    STATIC_ASSERT(offsetof(nrf_drv_uart_event_t, data.error.rxtx.bytes) ==                        \
+                  offsetof(CONCAT_2(_prefix, _event_t), data.error.rxtx.bytes));                  \
+    STATIC_ASSERT(offsetof(nrf_drv_uart_event_t, data.error.error_mask) ==                        \
+                  offsetof(CONCAT_2(_prefix, _event_t), data.error.error_mask))
+
 #if defined(NRF_DRV_UART_WITH_UARTE)
+EVENT_LAYOUT_CHECK(nrfx_uarte);
+STATIC_ASSERT((uint32_t)NRF_DRV_UART_EVT_TX_DONE == (uint32_t)NRFX_UARTE_EVT_TX_DONE);
+STATIC_ASSERT((uint32_t)NRF_DRV_UART_EVT_RX_DONE == (uint32_t)NRFX_UARTE_EVT_RX_DONE);
+STATIC_ASSERT((uint32_t)NRF_DRV_UART_EVT_ERROR   == (uint32_t)NRFX_UARTE_EVT_ERROR);
+
 static void uarte_evt_handler(nrfx_uarte_event_t const * p_event,
                               void *                     p_context)
 {
     uint32_t inst_idx = (uint32_t)p_context;
-    nrf_drv_uart_event_t event =
-    {
-        .type = (nrf_drv_uart_evt_type_t)p_event->type,
-        .data =
-        {
-            .error =
-            {
-                .rxtx =
-                {
-                    .p_data = p_event->data.error.rxtx.p_data,
-                    .bytes  = p_event->data.error.rxtx.bytes,
-                },
-                .error_mask = p_event->data.error.error_mask,
-            }
-        }
-    };
-    m_handlers[inst_idx](&event, m_contexts[inst_idx]);
+    m_handlers[inst_idx]((nrf_drv_uart_event_t *)p_event, m_contexts[inst_idx]);
 }
 #endif // defined(NRF_DRV_UART_WITH_UARTE)
 
 #if defined(NRF_DRV_UART_WITH_UART)
+EVENT_LAYOUT_CHECK(nrfx_uart);
+STATIC_ASSERT((uint32_t)NRF_DRV_UART_EVT_TX_DONE == (uint32_t)NRFX_UART_EVT_TX_DONE);
+STATIC_ASSERT((uint32_t)NRF_DRV_UART_EVT_RX_DONE == (uint32_t)NRFX_UART_EVT_RX_DONE);
+STATIC_ASSERT((uint32_t)NRF_DRV_UART_EVT_ERROR   == (uint32_t)NRFX_UART_EVT_ERROR);
+
 static void uart_evt_handler(nrfx_uart_event_t const * p_event,
                              void *                    p_context)
 {
     uint32_t inst_idx = (uint32_t)p_context;
-    nrf_drv_uart_event_t event =
-    {
-        .type = (nrf_drv_uart_evt_type_t)p_event->type,
-        .data =
-        {
-            .error =
-            {
-                .rxtx =
-                {
-                    .p_data = p_event->data.error.rxtx.p_data,
-                    .bytes  = p_event->data.error.rxtx.bytes,
-                },
-                .error_mask = p_event->data.error.error_mask,
-            }
-        }
-    };
-    m_handlers[inst_idx](&event, m_contexts[inst_idx]);
+    m_handlers[inst_idx]((nrf_drv_uart_event_t *)p_event, m_contexts[inst_idx]);
 }
 #endif // defined(NRF_DRV_UART_WITH_UART)
 
@@ -125,6 +125,7 @@ ret_code_t nrf_drv_uart_init(nrf_drv_uart_t const *        p_instance,
     config.p_context = (void *)inst_idx;
 
     ret_code_t result = 0;
+#if defined(NRF_DRV_UART_WITH_UARTE) && defined(NRF_DRV_UART_WITH_UART)
     if (NRF_DRV_UART_USE_UARTE)
     {
         result = nrfx_uarte_init(&p_instance->uarte,
@@ -137,5 +138,15 @@ ret_code_t nrf_drv_uart_init(nrf_drv_uart_t const *        p_instance,
                                 (nrfx_uart_config_t const *)&config,
                                 event_handler ? uart_evt_handler : NULL);
     }
+#elif defined(NRF_DRV_UART_WITH_UARTE)
+    // Only the UARTE backend is built, so the instance is always driven by nrfx_uarte.
+    result = nrfx_uarte_init(&p_instance->uarte,
+                             (nrfx_uarte_config_t const *)&config,
+                             event_handler ? uarte_evt_handler : NULL);
+#elif defined(NRF_DRV_UART_WITH_UART)
+    result = nrfx_uart_init(&p_instance->uart,
+                            (nrfx_uart_config_t const *)&config,
+                            event_handler ? uart_evt_handler : NULL);
+#endif
     return result;
 }
@@ -0,0 +1,345 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_ENERGY)
+#include "nrf_energy.h"
+#include <string.h>
+#include "nrf.h"
+#include "nrf_gpio.h"
+#include "nrf_delay.h"
+#include "app_timer.h"
+#include "app_util_platform.h"
+
+#define NRF_LOG_MODULE_NAME nrf_energy
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define TICKS_PER_SECOND    (APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1)) /**< Frequency of the app_timer counter. */
+#define FOLD_INTERVAL       ((RTC_COUNTER_COUNTER_Msk + 1) / 4)                          /**< Interval (in ticks) at which the counters are folded, well within the wrap-around. */
+
+APP_TIMER_DEF(m_fold_timer);                                    /**< Timer folding the counters. */
+
+/**@brief GPIO marking each phase. */
+static uint8_t const m_pins[NRF_ENERGY_PHASE_COUNT] =
+{
+    [NRF_ENERGY_PHASE_CPU]   = NRF_ENERGY_CONFIG_CPU_PIN,
+    [NRF_ENERGY_PHASE_RADIO] = NRF_ENERGY_CONFIG_RADIO_PIN,
+    [NRF_ENERGY_PHASE_SAADC] = NRF_ENERGY_CONFIG_SAADC_PIN,
+};
+
+/**@brief Current added by each phase, in nanoamperes. */
+static uint32_t const m_current_na[NRF_ENERGY_PHASE_COUNT] =
+{
+    [NRF_ENERGY_PHASE_CPU]   = NRF_ENERGY_CONFIG_CPU_CURRENT_NA,
+    [NRF_ENERGY_PHASE_RADIO] = NRF_ENERGY_CONFIG_RADIO_CURRENT_NA,
+    [NRF_ENERGY_PHASE_SAADC] = NRF_ENERGY_CONFIG_SAADC_CURRENT_NA,
+};
+
+/**@brief Name of each phase in the log. */
+static char const * const m_names[NRF_ENERGY_PHASE_COUNT] =
+{
+    [NRF_ENERGY_PHASE_CPU]   = "CPU",
+    [NRF_ENERGY_PHASE_RADIO] = "Radio",
+    [NRF_ENERGY_PHASE_SAADC] = "SAADC",
+};
+
+static struct
+{
+    bool     initialized;                               /**< The harness is initialized. */
+    bool     active[NRF_ENERGY_PHASE_COUNT];            /**< State of each phase. */
+    uint32_t active_ticks[NRF_ENERGY_PHASE_COUNT];      /**< Time each phase was active, up to its start tick. */
+    uint32_t active_cnt[NRF_ENERGY_PHASE_COUNT];        /**< Number of times each phase became active. */
+    uint32_t start_ticks[NRF_ENERGY_PHASE_COUNT];       /**< Tick at which each active phase started or was last folded. */
+    uint32_t elapsed_ticks;                             /**< Length of the window, up to the last tick. */
+    uint32_t last_ticks;                                /**< Tick at which the window was last folded. */
+    uint32_t bytes;                                     /**< Number of bytes counted. */
+    uint32_t samples;                                   /**< Number of samples counted. */
+} m_cb;
+
+
+/**@brief Function for setting a GPIO if it is used.
+ *
+ * @param[in] pin   Pin number, or NRF_ENERGY_PIN_NOT_USED.
+ * @param[in] value Value of the pin.
+ */
+static void pin_write(uint8_t pin, bool value)
+{
+    if (pin != NRF_ENERGY_PIN_NOT_USED)
+    {
+        nrf_gpio_pin_write(pin, value ? 1 : 0);
+    }
+}
+
+
+/**@brief Function for adding the time up to now to the window and to the active phases.
+ *
+ * @details Must be called in a critical region.
+ *
+ * @param[in] ticks Current app_timer counter.
+ */
+static void counters_fold(uint32_t ticks)
+{
+    m_cb.elapsed_ticks += app_timer_cnt_diff_compute(ticks, m_cb.last_ticks);
+    m_cb.last_ticks     = ticks;
+
+    for (uint32_t i = 0; i < NRF_ENERGY_PHASE_COUNT; i++)
+    {
+        if (m_cb.active[i])
+        {
+            m_cb.active_ticks[i] += app_timer_cnt_diff_compute(ticks, m_cb.start_ticks[i]);
+            m_cb.start_ticks[i]   = ticks;
+        }
+    }
+}
+
+
+/**@brief Function for clearing the counters and starting a new window.
+ *
+ * @details Must be called in a critical region.
+ *
+ * @param[in] ticks Current app_timer counter.
+ */
+static void counters_clear(uint32_t ticks)
+{
+    m_cb.elapsed_ticks = 0;
+    m_cb.last_ticks    = ticks;
+    m_cb.bytes         = 0;
+    m_cb.samples       = 0;
+
+    for (uint32_t i = 0; i < NRF_ENERGY_PHASE_COUNT; i++)
+    {
+        m_cb.active_ticks[i] = 0;
+        m_cb.active_cnt[i]   = 0;
+        m_cb.start_ticks[i]  = ticks;
+    }
+}
+
+
+/**@brief Function for converting a time at a given current to a charge.
+ *
+ * @param[in] current_na Current, in nanoamperes.
+ * @param[in] ticks      Time, in app_timer ticks.
+ *
+ * @return Charge, in nanocoulombs.
+ */
+static uint64_t charge_get(uint32_t current_na, uint32_t ticks)
+{
+    return ((uint64_t)current_na * ticks) / TICKS_PER_SECOND;
+}
+
+
+/**@brief Handler of the timer folding the counters. */
+static void fold_timeout_handler(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    CRITICAL_REGION_ENTER();
+    counters_fold(app_timer_cnt_get());
+    CRITICAL_REGION_EXIT();
+}
+
+
+void nrf_energy_phase_set(nrf_energy_phase_t phase, bool active)
+{
+    if (!m_cb.initialized || (phase >= NRF_ENERGY_PHASE_COUNT))
+    {
+        return;
+    }
+
+    CRITICAL_REGION_ENTER();
+    if (m_cb.active[phase] != active)
+    {
+        uint32_t ticks = app_timer_cnt_get();
+
+        if (active)
+        {
+            m_cb.start_ticks[phase] = ticks;
+            m_cb.active_cnt[phase]++;
+        }
+        else
+        {
+            m_cb.active_ticks[phase] += app_timer_cnt_diff_compute(ticks, m_cb.start_ticks[phase]);
+        }
+        m_cb.active[phase] = active;
+        pin_write(m_pins[phase], active);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+
+void nrf_energy_radio_evt_handler(bool radio_active)
+{
+    nrf_energy_phase_set(NRF_ENERGY_PHASE_RADIO, radio_active);
+}
+
+
+void nrf_energy_bytes_add(uint32_t count)
+{
+    CRITICAL_REGION_ENTER();
+    m_cb.bytes += count;
+    CRITICAL_REGION_EXIT();
+}
+
+
+void nrf_energy_samples_add(uint32_t count)
+{
+    CRITICAL_REGION_ENTER();
+    m_cb.samples += count;
+    CRITICAL_REGION_EXIT();
+}
+
+
+void nrf_energy_sync(void)
+{
+    CRITICAL_REGION_ENTER();
+    pin_write(NRF_ENERGY_CONFIG_SYNC_PIN, true);
+    counters_clear(app_timer_cnt_get());
+    CRITICAL_REGION_EXIT();
+
+    nrf_delay_us(NRF_ENERGY_CONFIG_SYNC_PULSE_US);
+    pin_write(NRF_ENERGY_CONFIG_SYNC_PIN, false);
+}
+
+
+void nrf_energy_report_get(nrf_energy_report_t * p_report)
+{
+    uint32_t active_ticks[NRF_ENERGY_PHASE_COUNT];
+    uint32_t active_cnt[NRF_ENERGY_PHASE_COUNT];
+    uint32_t elapsed;
+
+    CRITICAL_REGION_ENTER();
+    counters_fold(app_timer_cnt_get());
+    memcpy(active_ticks, m_cb.active_ticks, sizeof(active_ticks));
+    memcpy(active_cnt, m_cb.active_cnt, sizeof(active_cnt));
+    elapsed           = m_cb.elapsed_ticks;
+    p_report->bytes   = m_cb.bytes;
+    p_report->samples = m_cb.samples;
+    CRITICAL_REGION_EXIT();
+
+    p_report->elapsed_ticks   = elapsed;
+    p_report->elapsed_ms      = (uint32_t)(((uint64_t)elapsed * 1000) / TICKS_PER_SECOND);
+    p_report->sleep_charge_nc = charge_get(NRF_ENERGY_CONFIG_SLEEP_CURRENT_NA, elapsed);
+    p_report->charge_nc       = p_report->sleep_charge_nc;
+
+    for (uint32_t i = 0; i < NRF_ENERGY_PHASE_COUNT; i++)
+    {
+        nrf_energy_phase_report_t * p_phase = &p_report->phase[i];
+
+        p_phase->active_ticks = active_ticks[i];
+        p_phase->active_cnt   = active_cnt[i];
+        p_phase->duty_ppm     = (elapsed == 0) ? 0 :
+                                (uint32_t)(((uint64_t)active_ticks[i] * 1000000) / elapsed);
+        p_phase->charge_nc    = charge_get(m_current_na[i], active_ticks[i]);
+        p_report->charge_nc  += p_phase->charge_nc;
+    }
+
+    p_report->avg_current_na = (elapsed == 0) ? 0 :
+                               (uint32_t)((p_report->charge_nc * TICKS_PER_SECOND) / elapsed);
+    p_report->energy_nj      = (p_report->charge_nc * NRF_ENERGY_CONFIG_SUPPLY_MV) / 1000;
+    p_report->nj_per_byte    = (p_report->bytes == 0) ? 0 :
+                               (uint32_t)(p_report->energy_nj / p_report->bytes);
+    p_report->nj_per_sample  = (p_report->samples == 0) ? 0 :
+                               (uint32_t)(p_report->energy_nj / p_report->samples);
+}
+
+
+void nrf_energy_log(void)
+{
+    nrf_energy_report_t report;
+
+    nrf_energy_report_get(&report);
+
+    NRF_LOG_INFO("Window of %u ms: %u nA average, %u uJ.",
+                 report.elapsed_ms,
+                 report.avg_current_na,
+                 (uint32_t)(report.energy_nj / 1000));
+    for (uint32_t i = 0; i < NRF_ENERGY_PHASE_COUNT; i++)
+    {
+        NRF_LOG_INFO("%s: %u.%04u%% duty, %u times, %u nC.",
+                     m_names[i],
+                     report.phase[i].duty_ppm / 10000,
+                     report.phase[i].duty_ppm % 10000,
+                     report.phase[i].active_cnt,
+                     (uint32_t)report.phase[i].charge_nc);
+    }
+    NRF_LOG_INFO("Sleep: %u nC.", (uint32_t)report.sleep_charge_nc);
+    NRF_LOG_INFO("%u bytes, %u nJ/byte. %u samples, %u nJ/sample.",
+                 report.bytes,
+                 report.nj_per_byte,
+                 report.samples,
+                 report.nj_per_sample);
+}
+
+
+ret_code_t nrf_energy_init(void)
+{
+    ret_code_t err_code;
+
+    if (NRF_ENERGY_CONFIG_SYNC_PIN != NRF_ENERGY_PIN_NOT_USED)
+    {
+        nrf_gpio_pin_clear(NRF_ENERGY_CONFIG_SYNC_PIN);
+        nrf_gpio_cfg_output(NRF_ENERGY_CONFIG_SYNC_PIN);
+    }
+
+    CRITICAL_REGION_ENTER();
+    memset(&m_cb, 0, sizeof(m_cb));
+    counters_clear(app_timer_cnt_get());
+    for (uint32_t i = 0; i < NRF_ENERGY_PHASE_COUNT; i++)
+    {
+        if (m_pins[i] != NRF_ENERGY_PIN_NOT_USED)
+        {
+            nrf_gpio_pin_clear(m_pins[i]);
+            nrf_gpio_cfg_output(m_pins[i]);
+        }
+    }
+    // This code runs, so the CPU phase is active.
+    m_cb.active[NRF_ENERGY_PHASE_CPU]     = true;
+    m_cb.active_cnt[NRF_ENERGY_PHASE_CPU] = 1;
+    pin_write(m_pins[NRF_ENERGY_PHASE_CPU], true);
+    m_cb.initialized = true;
+    CRITICAL_REGION_EXIT();
+
+    err_code = app_timer_create(&m_fold_timer, APP_TIMER_MODE_REPEATED, fold_timeout_handler);
+    VERIFY_SUCCESS(err_code);
+
+    return app_timer_start(m_fold_timer, FOLD_INTERVAL, NULL);
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_ENERGY)
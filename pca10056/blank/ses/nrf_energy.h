@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_energy Energy attribution harness
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Module for attributing charge and energy to the phases of the application.
+ *
+ * @details Three phases are tracked, each marked on a GPIO while it is active:
+ *          - CPU running, from @ref nrf_pwr_mgmt_run. The phase ends before the CPU sleeps and
+ *            starts again when it wakes up. SoftDevice interrupts served while the application
+ *            sleeps are not counted.
+ *          - Radio active, from the Radio Notification events. Pass
+ *            @ref nrf_energy_radio_evt_handler to @ref ble_radio_notification_init, or call it
+ *            from the handler given there. The phase starts with the Active event, so use
+ *            NRF_RADIO_NOTIFICATION_DISTANCE_NONE to keep it close to the radio activity.
+ *          - SAADC acquisition running, from @ref app_saadc, from the start to the stop of the
+ *            sample pacing.
+ *
+ *          To correlate with a current trace from an external power analyzer, connect the GPIOs
+ *          to its logic inputs and call @ref nrf_energy_sync. The sync pin is pulsed, and the
+ *          accounting starts again at the rising edge, so the on-target report covers the same
+ *          window as the trace from that edge.
+ *
+ *          The report gives the duty cycle of each phase and a charge estimate from the
+ *          configured currents. The sleep current is drawn over the whole window, and the
+ *          current of each phase is added while the phase is active, so each configured current
+ *          must be the increase over sleep caused by that phase. The defaults are nRF52840
+ *          datasheet figures at 3 V with the DC/DC regulator. Bytes sent and samples acquired
+ *          are counted with @ref nrf_energy_bytes_add and @ref nrf_energy_samples_add (the
+ *          latter is called by @ref app_saadc), to give the energy per byte and per sample.
+ *
+ *          Time is counted in app_timer ticks. A timer folds the counters well within the
+ *          wrap-around of the RTC, so reports can cover long windows.
+ */
+
+#ifndef NRF_ENERGY_H__
+#define NRF_ENERGY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "nordic_common.h"
+#include "sdk_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_ENERGY_PIN_NOT_USED 0xFF ///< Value of a pin setting that leaves the phase unmarked.
+
+/**@brief Phases. */
+typedef enum
+{
+    NRF_ENERGY_PHASE_CPU,   ///< CPU running.
+    NRF_ENERGY_PHASE_RADIO, ///< Radio active.
+    NRF_ENERGY_PHASE_SAADC, ///< SAADC acquisition running.
+    NRF_ENERGY_PHASE_COUNT  ///< Number of phases.
+} nrf_energy_phase_t;
+
+/**@brief Report of a phase. */
+typedef struct
+{
+    uint32_t active_ticks;  ///< Time the phase was active, in app_timer ticks.
+    uint32_t active_cnt;    ///< Number of times the phase became active.
+    uint32_t duty_ppm;      ///< Duty cycle, in parts per million of the window.
+    uint64_t charge_nc;     ///< Estimated charge, in nanocoulombs.
+} nrf_energy_phase_report_t;
+
+/**@brief Report of the window since the last sync. */
+typedef struct
+{
+    uint32_t                  elapsed_ticks;                    ///< Length of the window, in app_timer ticks.
+    uint32_t                  elapsed_ms;                       ///< Length of the window, in milliseconds.
+    nrf_energy_phase_report_t phase[NRF_ENERGY_PHASE_COUNT];    ///< Report of each phase.
+    uint64_t                  sleep_charge_nc;                  ///< Estimated charge of the sleep current, in nanocoulombs.
+    uint64_t                  charge_nc;                        ///< Estimated total charge, in nanocoulombs.
+    uint32_t                  avg_current_na;                   ///< Estimated average current, in nanoamperes.
+    uint64_t                  energy_nj;                        ///< Estimated total energy, in nanojoules.
+    uint32_t                  bytes;                            ///< Number of bytes counted with @ref nrf_energy_bytes_add.
+    uint32_t                  samples;                          ///< Number of samples counted with @ref nrf_energy_samples_add.
+    uint32_t                  nj_per_byte;                      ///< Total energy per byte, in nanojoules, or 0 if no byte was counted.
+    uint32_t                  nj_per_sample;                    ///< Total energy per sample, in nanojoules, or 0 if no sample was counted.
+} nrf_energy_report_t;
+
+/**@brief Function for initializing the harness.
+ *
+ * @details Configures the GPIOs and starts the window. The CPU phase is active. The app_timer
+ *          module must be initialized.
+ *
+ * @retval NRF_SUCCESS If the harness was initialized.
+ * @retval Other       Error from @ref app_timer_create or @ref app_timer_start.
+ */
+ret_code_t nrf_energy_init(void);
+
+/**@brief Function for pulsing the sync pin and starting a new window.
+ *
+ * @details The counters are cleared at the rising edge. The pulse lasts
+ *          NRF_ENERGY_CONFIG_SYNC_PULSE_US, in a busy wait.
+ */
+void nrf_energy_sync(void);
+
+/**@brief Function for handling Radio Notification events.
+ *
+ * @param[in] radio_active True on the Active event, false on the nACTIVE event.
+ */
+void nrf_energy_radio_evt_handler(bool radio_active);
+
+/**@brief Function for counting bytes sent.
+ *
+ * @param[in] count Number of bytes.
+ */
+void nrf_energy_bytes_add(uint32_t count);
+
+/**@brief Function for reading the report of the window since the last sync.
+ *
+ * @param[out] p_report Report. Phases still active are counted up to now.
+ */
+void nrf_energy_report_get(nrf_energy_report_t * p_report);
+
+/**@brief Function for logging the report of the window since the last sync. */
+void nrf_energy_log(void);
+
+#if NRF_MODULE_ENABLED(NRF_ENERGY) || defined(__SDK_DOXYGEN__)
+/**@brief Function for marking the start or the end of a phase.
+ *
+ * @details May be called from any context. Calls that do not change the state of the phase are
+ *          ignored.
+ *
+ * @param[in] phase  Phase.
+ * @param[in] active True if the phase starts, false if it ends.
+ */
+void nrf_energy_phase_set(nrf_energy_phase_t phase, bool active);
+
+/**@brief Function for counting samples acquired.
+ *
+ * @param[in] count Number of samples.
+ */
+void nrf_energy_samples_add(uint32_t count);
+#else
+#define nrf_energy_phase_set(phase, active)
+#define nrf_energy_samples_add(count)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_ENERGY_H__
+
+/** @} */
@@ -106,6 +106,55 @@ static void buffer_add(nrf_fprintf_ctx_t * const p_ctx, char c)
     }
 }
 
+/**
+ * @brief Add @p len characters to the buffer at once.
+ *
+ * Used for digits and padding, which never contain a line feed, so no automatic CR is added.
+ */
+static void buffer_add_n(nrf_fprintf_ctx_t * const p_ctx, char const * p_str, size_t len)
+{
+    while (len > 0)
+    {
+        size_t chunk = p_ctx->io_buffer_size - p_ctx->io_buffer_cnt;
+
+        if (chunk > len)
+        {
+            chunk = len;
+        }
+        memcpy(&p_ctx->p_io_buffer[p_ctx->io_buffer_cnt], p_str, chunk);
+        p_ctx->io_buffer_cnt += chunk;
+        p_str += chunk;
+        len   -= chunk;
+
+        if (p_ctx->io_buffer_cnt >= p_ctx->io_buffer_size)
+        {
+            nrf_fprintf_buffer_flush(p_ctx);
+        }
+    }
+}
+
+/**@brief Add @p cnt copies of @p c to the buffer. */
+static void buffer_fill(nrf_fprintf_ctx_t * const p_ctx, char c, uint32_t cnt)
+{
+    while (cnt > 0)
+    {
+        size_t chunk = p_ctx->io_buffer_size - p_ctx->io_buffer_cnt;
+
+        if (chunk > cnt)
+        {
+            chunk = cnt;
+        }
+        memset(&p_ctx->p_io_buffer[p_ctx->io_buffer_cnt], c, chunk);
+        p_ctx->io_buffer_cnt += chunk;
+        cnt -= chunk;
+
+        if (p_ctx->io_buffer_cnt >= p_ctx->io_buffer_size)
+        {
+            nrf_fprintf_buffer_flush(p_ctx);
+        }
+    }
+}
+
 static void string_print(nrf_fprintf_ctx_t * const p_ctx,
                          char const *              p_str,
                          uint32_t                  FieldWidth,
@@ -151,111 +200,143 @@ static void string_print(nrf_fprintf_ctx_t * const p_ctx,
     }
 }
 
-static void unsigned_print(nrf_fprintf_ctx_t * const p_ctx,
-                           uint32_t                  v,
-                           uint32_t                  Base,
-                           uint32_t                  NumDigits,
-                           uint32_t                  FieldWidth,
-                           uint32_t                  FormatFlags)
+/**@brief Maximum number of digits of a 32-bit value (base 2). */
+#define NRF_CLI_FORMAT_DIGITS_MAX               32u
+
+/**
+ * @brief Convert a value to digits.
+ *
+ * Decimal values are converted two digits at a time with division by a constant, which the
+ * compiler turns into a multiplication. Hexadecimal values are converted with shifts. Other
+ * bases use the generic division.
+ *
+ * @param[in] p_end End of the buffer, the digits are written right before it.
+ * @param[in] v     Value.
+ * @param[in] Base  Base.
+ *
+ * @return Number of digits written.
+ */
+static uint32_t digits_get(char * p_end, uint32_t v, uint32_t Base)
 {
     static const char _aV2C[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
                                    'A', 'B', 'C', 'D', 'E', 'F' };
-    uint32_t Div;
-    uint32_t Value;
-    uint32_t Width;
-    char c;
+    static const char _aD2C[200] = "00010203040506070809"
+                                   "10111213141516171819"
+                                   "20212223242526272829"
+                                   "30313233343536373839"
+                                   "40414243444546474849"
+                                   "50515253545556575859"
+                                   "60616263646566676869"
+                                   "70717273747576777879"
+                                   "80818283848586878889"
+                                   "90919293949596979899";
+    char * p_digit = p_end;
+
+    if (Base == 10u)
+    {
+        while (v >= 100u)
+        {
+            uint32_t Div = v / 100u;
+            uint32_t Rem = v - (Div * 100u);
 
-    Value = v;
-    //
-    // Get actual field width
-    //
-    Width = 1u;
-    while (Value >= Base)
-    {
-        Value = (Value / Base);
-        Width++;
+            p_digit -= 2;
+            p_digit[0] = _aD2C[2u * Rem];
+            p_digit[1] = _aD2C[2u * Rem + 1u];
+            v = Div;
+        }
+        if (v >= 10u)
+        {
+            p_digit -= 2;
+            p_digit[0] = _aD2C[2u * v];
+            p_digit[1] = _aD2C[2u * v + 1u];
+        }
+        else
+        {
+            *--p_digit = (char)('0' + v);
+        }
     }
-    if (NumDigits > Width)
+    else if (Base == 16u)
     {
-        Width = NumDigits;
+        do
+        {
+            *--p_digit = _aV2C[v & 0xFu];
+            v >>= 4;
+        } while (v);
     }
-    //
-    // Print leading chars if necessary
-    //
-    if ((FormatFlags & NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY) == 0u)
+    else
     {
-        if (FieldWidth != 0u)
+        do
         {
-            if (((FormatFlags & NRF_CLI_FORMAT_FLAG_PAD_ZERO) == NRF_CLI_FORMAT_FLAG_PAD_ZERO) &&
-                (NumDigits == 0u))
-            {
-                c = '0';
-            }
-            else
-            {
-                c = ' ';
-            }
-            while ((FieldWidth != 0u) && (Width < FieldWidth))
-            {
-                FieldWidth--;
-                buffer_add(p_ctx, c);
-            }
-        }
+            *--p_digit = _aV2C[v % Base];
+            v /= Base;
+        } while (v);
     }
 
-    Value = 1;
-    /*
-     * Compute Digit.
-     * Loop until Digit has the value of the highest digit required.
-     * Example: If the output is 345 (Base 10), loop 2 times until Digit is 100.
-     */
-    while (1)
+    return (uint32_t)(p_end - p_digit);
+}
+
+static void digits_print(nrf_fprintf_ctx_t * const p_ctx,
+                         char const *              p_digits,
+                         uint32_t                  Len,
+                         uint32_t                  NumDigits,
+                         uint32_t                  FieldWidth,
+                         uint32_t                  FormatFlags)
+{
+    uint32_t Width;
+
+    //
+    // Get actual field width
+    //
+    Width = (NumDigits > Len) ? NumDigits : Len;
+    //
+    // Print leading chars if necessary
+    //
+    if (((FormatFlags & NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY) == 0u) && (FieldWidth > Width))
     {
-        /* User specified a min number of digits to print? => Make sure we loop at least that
-         * often, before checking anything else (> 1 check avoids problems with NumDigits
-         * being signed / unsigned)
-         */
-        if (NumDigits > 1u)
+        if (((FormatFlags & NRF_CLI_FORMAT_FLAG_PAD_ZERO) == NRF_CLI_FORMAT_FLAG_PAD_ZERO) &&
+            (NumDigits == 0u))
         {
-            NumDigits--;
+            buffer_fill(p_ctx, '0', FieldWidth - Width);
         }
         else
         {
-            Div = v / Value;
-            // Is our divider big enough to extract the highest digit from value? => Done
-            if (Div < Base)
-            {
-                break;
-            }
+            buffer_fill(p_ctx, ' ', FieldWidth - Width);
         }
-        Value *= Base;
     }
     //
-    // Output digits
+    // Output digits, padded with zeros to the requested number of digits
     //
-    do
-    {
-        Div = v / Value;
-        v -= Div * Value;
-        buffer_add(p_ctx, _aV2C[Div]);
-        Value /= Base;
-    } while (Value);
+    buffer_fill(p_ctx, '0', Width - Len);
+    buffer_add_n(p_ctx, p_digits, Len);
     //
     // Print trailing spaces if necessary
     //
-    if ((FormatFlags & NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY) == NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY)
+    if (((FormatFlags & NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY) == NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY) &&
+        (FieldWidth > Width))
     {
-        if (FieldWidth != 0u)
-        {
-            while ((FieldWidth != 0u) && (Width < FieldWidth))
-            {
-                FieldWidth--;
-                buffer_add(p_ctx, ' ');
-            }
-        }
+        buffer_fill(p_ctx, ' ', FieldWidth - Width);
     }
 }
 
+static void unsigned_print(nrf_fprintf_ctx_t * const p_ctx,
+                           uint32_t                  v,
+                           uint32_t                  Base,
+                           uint32_t                  NumDigits,
+                           uint32_t                  FieldWidth,
+                           uint32_t                  FormatFlags)
+{
+    char digits[NRF_CLI_FORMAT_DIGITS_MAX];
+    uint32_t Len;
+
+    Len = digits_get(&digits[NRF_CLI_FORMAT_DIGITS_MAX], v, Base);
+    digits_print(p_ctx,
+                 &digits[NRF_CLI_FORMAT_DIGITS_MAX - Len],
+                 Len,
+                 NumDigits,
+                 FieldWidth,
+                 FormatFlags);
+}
+
 static void int_print(nrf_fprintf_ctx_t * const p_ctx,
                       int32_t                   v,
                       uint32_t                  Base,
@@ -263,24 +344,18 @@ static void int_print(nrf_fprintf_ctx_t * const p_ctx,
                       uint32_t                  FieldWidth,
                       uint32_t                  FormatFlags)
 {
+    char digits[NRF_CLI_FORMAT_DIGITS_MAX];
     uint32_t Width;
-    int32_t Number;
+    uint32_t Len;
+    uint32_t Number;
 
-    Number = (v < 0) ? -v : v;
+    Number = (v < 0) ? (0u - (uint32_t)v) : (uint32_t)v;
 
     //
     // Get actual field width
     //
-    Width = 1u;
-    while (Number >= (int32_t)Base)
-    {
-        Number = (Number / (int32_t)Base);
-        Width++;
-    }
-    if (NumDigits > Width)
-    {
-        Width = NumDigits;
-    }
+    Len = digits_get(&digits[NRF_CLI_FORMAT_DIGITS_MAX], Number, Base);
+    Width = (NumDigits > Len) ? NumDigits : Len;
     if ((FieldWidth > 0u) && ((v < 0) ||
         ((FormatFlags & NRF_CLI_FORMAT_FLAG_PRINT_SIGN) == NRF_CLI_FORMAT_FLAG_PRINT_SIGN)))
     {
@@ -290,23 +365,17 @@ static void int_print(nrf_fprintf_ctx_t * const p_ctx,
     // Print leading spaces if necessary
     //
     if ((((FormatFlags & NRF_CLI_FORMAT_FLAG_PAD_ZERO) == 0u) || (NumDigits != 0u)) &&
-        ((FormatFlags & NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY) == 0u))
+        ((FormatFlags & NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY) == 0u) &&
+        (FieldWidth > Width))
     {
-        if (FieldWidth != 0u)
-        {
-            while ((FieldWidth != 0u) && (Width < FieldWidth))
-            {
-                FieldWidth--;
-                buffer_add(p_ctx, ' ');
-            }
-        }
+        buffer_fill(p_ctx, ' ', FieldWidth - Width);
+        FieldWidth = Width;
     }
     //
     // Print sign if necessary
     //
     if (v < 0)
     {
-        v = -v;
         buffer_add(p_ctx, '-');
     }
     else if ((FormatFlags & NRF_CLI_FORMAT_FLAG_PRINT_SIGN) == NRF_CLI_FORMAT_FLAG_PRINT_SIGN)
@@ -321,21 +390,21 @@ static void int_print(nrf_fprintf_ctx_t * const p_ctx,
     // Print leading zeros if necessary
     //
     if (((FormatFlags & NRF_CLI_FORMAT_FLAG_PAD_ZERO) == NRF_CLI_FORMAT_FLAG_PAD_ZERO) &&
-        ((FormatFlags & NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY) == 0u) && (NumDigits == 0u))
+        ((FormatFlags & NRF_CLI_FORMAT_FLAG_LEFT_JUSTIFY) == 0u) && (NumDigits == 0u) &&
+        (FieldWidth > Width))
     {
-        if (FieldWidth != 0u)
-        {
-            while ((FieldWidth != 0u) && (Width < FieldWidth))
-            {
-                FieldWidth--;
-                buffer_add(p_ctx, '0');
-            }
-        }
+        buffer_fill(p_ctx, '0', FieldWidth - Width);
+        FieldWidth = Width;
     }
     //
     // Print number without sign
     //
-    unsigned_print(p_ctx, (uint32_t)v, Base, NumDigits, FieldWidth, FormatFlags);
+    digits_print(p_ctx,
+                 &digits[NRF_CLI_FORMAT_DIGITS_MAX - Len],
+                 Len,
+                 NumDigits,
+                 FieldWidth,
+                 FormatFlags);
 }
 
 #if NRF_MODULE_ENABLED(NRF_FPRINTF_DOUBLE)
@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_FPRINTF_SINK)
+#include "nrf_fprintf_sink.h"
+#include <string.h>
+#include "nrf_assert.h"
+#include "app_util_platform.h"
+
+#define BLOCK_GET(_p_sink, _idx) (&(_p_sink)->p_blocks[(size_t)(_idx) * (_p_sink)->block_size])
+#define BLOCK_NEXT(_p_sink, _idx) ((uint8_t)(((_idx) + 1u) == (_p_sink)->block_cnt ? 0u : ((_idx) + 1u)))
+
+/**@brief Function for handing the block being filled over to the writer.
+ *
+ * @details The block is queued. It is written at once if the writer does not own a block.
+ */
+static void block_submit(nrf_fprintf_sink_t const * p_sink)
+{
+    nrf_fprintf_sink_cb_t * p_cb = p_sink->p_cb;
+    bool                    start = false;
+    uint8_t                 idx;
+
+    p_sink->p_length[p_cb->fill_idx] = p_cb->fill_cnt;
+
+    CRITICAL_REGION_ENTER();
+    p_cb->fill_idx = BLOCK_NEXT(p_sink, p_cb->fill_idx);
+    p_cb->fill_cnt = 0;
+    p_cb->queued++;
+    if (!p_cb->busy)
+    {
+        p_cb->busy = true;
+        start      = true;
+    }
+    idx = p_cb->tx_idx;
+    CRITICAL_REGION_EXIT();
+
+    if (start)
+    {
+        p_sink->write(p_sink, BLOCK_GET(p_sink, idx), p_sink->p_length[idx]);
+    }
+}
+
+/**@brief Function for waiting for a free block.
+ *
+ * @retval true  The block at fill_idx can be filled.
+ * @retval false No block is free and the output must be dropped.
+ */
+static bool block_wait(nrf_fprintf_sink_t const * p_sink)
+{
+    while (p_sink->p_cb->queued == p_sink->block_cnt)
+    {
+        if (p_sink->wait == NULL)
+        {
+            return false;
+        }
+        p_sink->wait();
+    }
+    return true;
+}
+
+void nrf_fprintf_sink_fwrite(void const * p_user_ctx, char const * p_str, size_t length)
+{
+    nrf_fprintf_sink_t const * p_sink = (nrf_fprintf_sink_t const *)p_user_ctx;
+    nrf_fprintf_sink_cb_t    * p_cb;
+
+    ASSERT(p_sink != NULL);
+    ASSERT(p_str != NULL);
+
+    p_cb = p_sink->p_cb;
+
+    while (length > 0)
+    {
+        if (!block_wait(p_sink))
+        {
+            p_cb->dropped += length;
+            return;
+        }
+
+        size_t chunk = MIN(length, p_sink->block_size - p_cb->fill_cnt);
+        bool   eol   = false;
+
+        if (p_sink->flags & NRF_FPRINTF_SINK_FLUSH_EOL)
+        {
+            char const * p_eol = memchr(p_str, '\n', chunk);
+
+            if (p_eol != NULL)
+            {
+                chunk = (size_t)(p_eol - p_str) + 1;
+                eol   = true;
+            }
+        }
+
+        memcpy(&BLOCK_GET(p_sink, p_cb->fill_idx)[p_cb->fill_cnt], p_str, chunk);
+        p_cb->fill_cnt += chunk;
+        p_str          += chunk;
+        length         -= chunk;
+
+        if (eol || (p_cb->fill_cnt == p_sink->block_size))
+        {
+            block_submit(p_sink);
+        }
+    }
+
+    if (p_cb->fill_cnt >= p_sink->threshold)
+    {
+        block_submit(p_sink);
+    }
+}
+
+void nrf_fprintf_sink_flush(nrf_fprintf_sink_t const * p_sink, nrf_fprintf_ctx_t * const p_ctx)
+{
+    ASSERT(p_sink != NULL);
+
+    if (p_ctx != NULL)
+    {
+        nrf_fprintf_buffer_flush(p_ctx);
+    }
+
+    if (p_sink->p_cb->fill_cnt > 0)
+    {
+        block_submit(p_sink);
+    }
+}
+
+void nrf_fprintf_sink_write_done(nrf_fprintf_sink_t const * p_sink)
+{
+    nrf_fprintf_sink_cb_t * p_cb = p_sink->p_cb;
+    bool                    start = false;
+    uint8_t                 idx;
+
+    ASSERT(p_cb->busy);
+
+    CRITICAL_REGION_ENTER();
+    p_cb->tx_idx = BLOCK_NEXT(p_sink, p_cb->tx_idx);
+    p_cb->queued--;
+    if (p_cb->queued > 0)
+    {
+        start = true;
+    }
+    else
+    {
+        p_cb->busy = false;
+    }
+    idx = p_cb->tx_idx;
+    CRITICAL_REGION_EXIT();
+
+    if (start)
+    {
+        p_sink->write(p_sink, BLOCK_GET(p_sink, idx), p_sink->p_length[idx]);
+    }
+}
+
+bool nrf_fprintf_sink_is_idle(nrf_fprintf_sink_t const * p_sink)
+{
+    return (p_sink->p_cb->queued == 0) && (p_sink->p_cb->fill_cnt == 0);
+}
+
+uint32_t nrf_fprintf_sink_dropped_get(nrf_fprintf_sink_t const * p_sink)
+{
+    uint32_t dropped;
+
+    CRITICAL_REGION_ENTER();
+    dropped               = p_sink->p_cb->dropped;
+    p_sink->p_cb->dropped  = 0;
+    CRITICAL_REGION_EXIT();
+
+    return dropped;
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_FPRINTF_SINK)
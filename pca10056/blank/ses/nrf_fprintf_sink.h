@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_fprintf_sink Batching sink for nrf_fprintf
+ * @{
+ * @ingroup nrf_fprintf
+ *
+ * @brief Module for collecting nrf_fprintf output in large blocks and handing whole blocks to a
+ *        writer.
+ *
+ * @details The sink is used as the fwrite function of an nrf_fprintf context, with the sink
+ *          instance as the user context:
+ *          @code
+ *          NRF_FPRINTF_SINK_DEF(m_sink, 512, 2, 0, NRF_FPRINTF_SINK_FLUSH_FULL, uarte_write, NULL);
+ *          NRF_FPRINTF_DEF(m_fprintf, &m_sink, m_io_buffer, sizeof(m_io_buffer), false,
+ *                          nrf_fprintf_sink_fwrite);
+ *          @endcode
+ *
+ *          Output is copied into the block being filled. A block is handed to the writer when:
+ *          - it is full,
+ *          - it holds at least the threshold number of bytes at the end of a write from the
+ *            context,
+ *          - a line ends and @ref NRF_FPRINTF_SINK_FLUSH_EOL is set,
+ *          - @ref nrf_fprintf_sink_flush is called.
+ *
+ *          The writer owns the block until it calls @ref nrf_fprintf_sink_write_done, so a block
+ *          can be transferred with EasyDMA without copying. Blocks are handed over one at a time,
+ *          in order. The next block is handed over from @ref nrf_fprintf_sink_write_done, and
+ *          the other blocks are filled in the meantime.
+ *
+ *          When all blocks are owned by the writer, the sink calls the wait function until a
+ *          block is released. Without a wait function, the output is dropped and counted.
+ *
+ *          Use a context with auto_flush set to false so that every nrf_fprintf call does not
+ *          end a block. The io buffer of the context can then be small.
+ *
+ * @note Output must be written from one context at a time. @ref nrf_fprintf_sink_write_done can
+ *       be called from any interrupt priority.
+ */
+
+#ifndef NRF_FPRINTF_SINK_H__
+#define NRF_FPRINTF_SINK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "nordic_common.h"
+#include "nrf_fprintf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Hand a block over only when it is full, when it reaches the threshold or on flush. */
+#define NRF_FPRINTF_SINK_FLUSH_FULL 0x00
+
+/**@brief Also hand a block over at the end of every line. */
+#define NRF_FPRINTF_SINK_FLUSH_EOL  0x01
+
+typedef struct nrf_fprintf_sink_s nrf_fprintf_sink_t;
+
+/**@brief Function for writing a block.
+ *
+ * @details The data must stay untouched until @ref nrf_fprintf_sink_write_done is called. It may
+ *          be called from within this function if the write completes at once.
+ *
+ * @param[in] p_sink Sink instance.
+ * @param[in] p_data Data to write. In RAM, so it can be used with EasyDMA.
+ * @param[in] length Number of bytes to write.
+ */
+typedef void (*nrf_fprintf_sink_write_t)(nrf_fprintf_sink_t const * p_sink,
+                                         uint8_t const *            p_data,
+                                         size_t                     length);
+
+/**@brief Function for waiting until the writer releases a block, for example by sleeping. */
+typedef void (*nrf_fprintf_sink_wait_t)(void);
+
+/**@brief Control block of a sink instance. */
+typedef struct
+{
+    size_t            fill_cnt; ///< Bytes in the block being filled.
+    uint32_t          dropped;  ///< Bytes dropped because no block was free.
+    uint8_t           fill_idx; ///< Block being filled.
+    uint8_t           tx_idx;   ///< Oldest block owned by the writer or waiting for it.
+    uint8_t volatile  queued;   ///< Blocks handed over and not released yet.
+    bool              busy;     ///< The writer owns the block at tx_idx.
+} nrf_fprintf_sink_cb_t;
+
+/**@brief Sink instance. */
+struct nrf_fprintf_sink_s
+{
+    uint8_t                 * p_blocks;     ///< Block memory.
+    size_t                  * p_length;     ///< Length of every block handed over.
+    nrf_fprintf_sink_cb_t   * p_cb;         ///< Control block.
+    nrf_fprintf_sink_write_t  write;        ///< Writer.
+    nrf_fprintf_sink_wait_t   wait;         ///< Wait function, or NULL to drop output.
+    size_t                    block_size;   ///< Size of a block.
+    size_t                    threshold;    ///< Fill level at which a block is handed over after a write.
+    uint8_t                   block_cnt;    ///< Number of blocks.
+    uint8_t                   flags;        ///< Flush policy, @ref NRF_FPRINTF_SINK_FLUSH_EOL.
+};
+
+/**@brief Macro for defining a sink instance.
+ *
+ * @param _name       Name of the instance.
+ * @param _block_size Size of a block, in bytes.
+ * @param _block_cnt  Number of blocks, 1 to 255. Use 2 or more to fill a block while another
+ *                    is written.
+ * @param _threshold  Fill level at which a block is handed over after a write from the context,
+ *                    or 0 to hand over full blocks only.
+ * @param _flags      Flush policy, @ref NRF_FPRINTF_SINK_FLUSH_FULL or
+ *                    @ref NRF_FPRINTF_SINK_FLUSH_EOL.
+ * @param _write      Writer, see @ref nrf_fprintf_sink_write_t.
+ * @param _wait       Wait function, or NULL to drop output when no block is free.
+ * @hideinitializer
+ */
+#define NRF_FPRINTF_SINK_DEF(_name, _block_size, _block_cnt, _threshold, _flags, _write, _wait) \
+    STATIC_ASSERT(((_block_cnt) > 0) && ((_block_cnt) <= UINT8_MAX));                          \
+    STATIC_ASSERT((_threshold) <= (_block_size));                                               \
+    static uint8_t CONCAT_2(_name, _blocks)[(_block_cnt) * (_block_size)];                     \
+    static size_t CONCAT_2(_name, _length)[(_block_cnt)];                                       \
+    static nrf_fprintf_sink_cb_t CONCAT_2(_name, _cb);                                          \
+    static const nrf_fprintf_sink_t _name =                                                     \
+    {                                                                                           \
+        .p_blocks   = CONCAT_2(_name, _blocks),                                                 \
+        .p_length   = CONCAT_2(_name, _length),                                                 \
+        .p_cb       = &CONCAT_2(_name, _cb),                                                    \
+        .write      = (_write),                                                                 \
+        .wait       = (_wait),                                                                  \
+        .block_size = (_block_size),                                                            \
+        .threshold  = ((_threshold) == 0) ? (_block_size) : (_threshold),                       \
+        .block_cnt  = (_block_cnt),                                                             \
+        .flags      = (_flags),                                                                 \
+    }
+
+/**@brief Function for adding output to a sink. Used as the fwrite function of a context.
+ *
+ * @param[in] p_user_ctx Sink instance.
+ * @param[in] p_str      Output.
+ * @param[in] length     Number of bytes of output.
+ */
+void nrf_fprintf_sink_fwrite(void const * p_user_ctx, char const * p_str, size_t length);
+
+/**@brief Function for handing the output collected so far to the writer.
+ *
+ * @details Writes the io buffer of @p p_ctx to the sink first, then hands over the block being
+ *          filled even if it is below the threshold. Does not wait for the writer.
+ *
+ * @param[in] p_sink Sink instance.
+ * @param[in] p_ctx  Context that writes to the sink, or NULL.
+ */
+void nrf_fprintf_sink_flush(nrf_fprintf_sink_t const * p_sink, nrf_fprintf_ctx_t * const p_ctx);
+
+/**@brief Function for releasing the block the writer owns. Called by the writer.
+ *
+ * @details Hands the next block over to the writer, if one is waiting.
+ *
+ * @param[in] p_sink Sink instance.
+ */
+void nrf_fprintf_sink_write_done(nrf_fprintf_sink_t const * p_sink);
+
+/**@brief Function for checking if all output has been written.
+ *
+ * @param[in] p_sink Sink instance.
+ *
+ * @retval true  No output is collected or owned by the writer.
+ * @retval false Otherwise.
+ */
+bool nrf_fprintf_sink_is_idle(nrf_fprintf_sink_t const * p_sink);
+
+/**@brief Function for getting and clearing the number of bytes dropped because no block was free.
+ *
+ * @param[in] p_sink Sink instance.
+ *
+ * @return Number of bytes dropped since the last call.
+ */
+uint32_t nrf_fprintf_sink_dropped_get(nrf_fprintf_sink_t const * p_sink);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_FPRINTF_SINK_H__
+
+/** @} */
@@ -0,0 +1,362 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_LOG) && NRF_MODULE_ENABLED(NRF_LOG_BACKEND_UARTE)
+#include "nrf_log_backend_uarte.h"
+#include "nrf_log_str_formatter.h"
+#include "nrf_log_internal.h"
+#include "nrf_memobj.h"
+#include "nrf_fprintf.h"
+#include "nrfx_uarte.h"
+#include "app_util_platform.h"
+#include "nrf_assert.h"
+#if NRF_MODULE_ENABLED(NRF_PWR_MGMT) && NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED
+#include "nrf_pwr_mgmt_policy.h"
+#define UARTE_PWR_MGMT 1
+#else
+#define UARTE_PWR_MGMT 0
+#endif
+
+#define UARTE_BUF_CNT   NRF_LOG_BACKEND_UARTE_BUFFER_COUNT
+#define UARTE_BUF_SIZE  NRF_LOG_BACKEND_UARTE_BUFFER_SIZE
+
+STATIC_ASSERT((UARTE_BUF_CNT >= 2) && (UARTE_BUF_CNT <= UINT8_MAX));
+STATIC_ASSERT(UARTE_BUF_SIZE <= UINT16_MAX);
+
+static nrfx_uarte_t const m_uarte = NRFX_UARTE_INSTANCE(NRF_LOG_BACKEND_UARTE_INSTANCE);
+
+static uint8_t           m_buf[UARTE_BUF_CNT][UARTE_BUF_SIZE]; /**< EasyDMA buffers. */
+static uint16_t          m_len[UARTE_BUF_CNT];                 /**< Length of the queued buffers. */
+
+/* The buffer being filled always follows the queued ones: m_fill_idx == m_tx_idx + m_queued. */
+static volatile uint8_t  m_tx_idx;     /**< Oldest queued buffer, transmitted if m_tx_busy is set. */
+static volatile uint8_t  m_queued;     /**< Number of queued buffers. */
+static volatile uint8_t  m_fill_idx;   /**< Buffer being filled. */
+static volatile uint16_t m_fill_len;   /**< Number of bytes in the buffer being filled. */
+static volatile bool     m_tx_busy;    /**< Transfer ongoing. */
+static volatile bool     m_formatting; /**< Entry being formatted into the buffer being filled. */
+static bool              m_panic;      /**< Blocking mode. */
+
+static void uarte_fwrite(void const * p_context, char const * p_buffer, size_t len);
+
+static nrf_fprintf_ctx_t m_fprintf_ctx =
+{
+    .p_io_buffer    = (char *)m_buf[0],
+    .io_buffer_size = UARTE_BUF_SIZE,
+    .io_buffer_cnt  = 0,
+    .auto_flush     = false,
+    .p_user_ctx     = NULL,
+    .fwrite         = uarte_fwrite
+};
+
+#if UARTE_PWR_MGMT
+/**@brief Power handler of the UARTE, called by the sleep policy while no transfer is ongoing. */
+static void uarte_power_handler(bool on)
+{
+    if (on)
+    {
+        nrf_uarte_enable(m_uarte.p_reg);
+    }
+    else
+    {
+        nrf_uarte_disable(m_uarte.p_reg);
+    }
+}
+#endif
+
+/**@brief Mark the UARTE as required during sleep while a transfer is ongoing. */
+static void uarte_power_require(bool required)
+{
+#if UARTE_PWR_MGMT
+    nrf_pwr_mgmt_periph_require(NRF_PWR_MGMT_PERIPH_UARTE, required);
+#else
+    UNUSED_PARAMETER(required);
+#endif
+}
+
+/**@brief Start the transfer of the oldest queued buffer. */
+static void uarte_tx_start(void)
+{
+    m_tx_busy = true;
+    uarte_power_require(true);
+    ret_code_t err_code = nrfx_uarte_tx(&m_uarte, m_buf[m_tx_idx], m_len[m_tx_idx]);
+    ASSERT(err_code == NRFX_SUCCESS);
+    UNUSED_VARIABLE(err_code);
+}
+
+/**@brief Queue the buffer being filled. Called from a critical region or the UARTE interrupt. */
+static void uarte_fill_commit(void)
+{
+    m_len[m_fill_idx] = m_fill_len;
+    m_fill_idx        = (m_fill_idx + 1) % UARTE_BUF_CNT;
+    m_fill_len        = 0;
+    m_queued++;
+
+    if (!m_tx_busy)
+    {
+        uarte_tx_start();
+    }
+}
+
+/**@brief Point the formatter at the free part of the buffer being filled. */
+static void uarte_fprintf_ctx_set(void)
+{
+    m_fprintf_ctx.p_io_buffer    = (char *)&m_buf[m_fill_idx][m_fill_len];
+    m_fprintf_ctx.io_buffer_size = UARTE_BUF_SIZE - m_fill_len;
+}
+
+static void uarte_evt_handler(nrfx_uarte_event_t const * p_event, void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if (p_event->type != NRFX_UARTE_EVT_TX_DONE)
+    {
+        return;
+    }
+
+    m_tx_idx  = (m_tx_idx + 1) % UARTE_BUF_CNT;
+    m_queued--;
+    m_tx_busy = false;
+
+    if (m_queued > 0)
+    {
+        uarte_tx_start();
+    }
+    else if (!m_formatting && (m_fill_len > 0))
+    {
+        // Entries appended while the previous transfer was ongoing.
+        uarte_fill_commit();
+    }
+
+    if (!m_tx_busy)
+    {
+        uarte_power_require(false);
+    }
+}
+
+static void uarte_init(bool async_mode)
+{
+    nrfx_uarte_config_t config = NRFX_UARTE_DEFAULT_CONFIG;
+
+    config.pseltxd  = NRF_LOG_BACKEND_UARTE_TX_PIN;
+    config.pselrxd  = NRF_UARTE_PSEL_DISCONNECTED;
+    config.pselcts  = NRF_UARTE_PSEL_DISCONNECTED;
+    config.pselrts  = NRF_UARTE_PSEL_DISCONNECTED;
+    config.baudrate = (nrf_uarte_baudrate_t)NRF_LOG_BACKEND_UARTE_BAUDRATE;
+
+    ret_code_t err_code = nrfx_uarte_init(&m_uarte, &config, async_mode ? uarte_evt_handler : NULL);
+    APP_ERROR_CHECK(err_code);
+}
+
+void nrf_log_backend_uarte_init(void)
+{
+    m_tx_idx   = 0;
+    m_queued   = 0;
+    m_fill_idx = 0;
+    m_fill_len = 0;
+    m_tx_busy  = false;
+    m_panic    = false;
+    uarte_init(true);
+#if UARTE_PWR_MGMT
+    nrf_pwr_mgmt_periph_power_handler_set(NRF_PWR_MGMT_PERIPH_UARTE, uarte_power_handler);
+#endif
+}
+
+static void uarte_fwrite(void const * p_context, char const * p_buffer, size_t len)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if (m_panic)
+    {
+        UNUSED_RETURN_VALUE(nrfx_uarte_tx(&m_uarte, (uint8_t const *)p_buffer, len));
+        return;
+    }
+
+    m_fill_len += len;
+
+    CRITICAL_REGION_ENTER();
+    if (!m_tx_busy || (m_fill_len == UARTE_BUF_SIZE))
+    {
+        uarte_fill_commit();
+    }
+    CRITICAL_REGION_EXIT();
+
+    // Wait for a free buffer.
+    while (m_queued == UARTE_BUF_CNT)
+    {
+    }
+
+    uarte_fprintf_ctx_set();
+}
+
+static void nrf_log_backend_uarte_put(nrf_log_backend_t const * p_backend,
+                                      nrf_log_entry_t * p_msg)
+{
+    UNUSED_PARAMETER(p_backend);
+
+    nrf_log_str_formatter_entry_params_t params;
+    nrf_log_header_t header;
+    size_t           memobj_offset = HEADER_SIZE * sizeof(uint32_t);
+
+    nrf_memobj_get(p_msg);
+    nrf_memobj_read(p_msg, &header, HEADER_SIZE * sizeof(uint32_t), 0);
+
+    params.timestamp  = header.timestamp;
+    params.module_id  = header.module_id;
+    params.dropped    = header.dropped;
+    params.use_colors = NRF_LOG_USES_COLORS;
+
+    CRITICAL_REGION_ENTER();
+    m_formatting = true;
+    CRITICAL_REGION_EXIT();
+    if (!m_panic)
+    {
+        uarte_fprintf_ctx_set();
+    }
+
+    if (header.base.generic.type == HEADER_TYPE_STD)
+    {
+        char const * p_log_str = (char const *)((uint32_t)header.base.std.addr);
+        uint32_t     nargs     = header.base.std.nargs;
+        uint32_t     args[NRF_LOG_MAX_NUM_OF_ARGS];
+
+        params.severity = (nrf_log_severity_t)header.base.std.severity;
+        nrf_memobj_read(p_msg, args, nargs * sizeof(uint32_t), memobj_offset);
+
+        nrf_log_std_entry_process(p_log_str, args, nargs, &params, &m_fprintf_ctx);
+    }
+    else if (header.base.generic.type == HEADER_TYPE_HEXDUMP)
+    {
+        uint32_t data_len = header.base.hexdump.len;
+        uint8_t  data_buf[8];
+        uint32_t chunk_len;
+
+        params.severity = (nrf_log_severity_t)header.base.hexdump.severity;
+        do
+        {
+            chunk_len = sizeof(data_buf) > data_len ? data_len : sizeof(data_buf);
+            nrf_memobj_read(p_msg, data_buf, chunk_len, memobj_offset);
+            memobj_offset += chunk_len;
+            data_len      -= chunk_len;
+
+            nrf_log_hexdump_entry_process(data_buf, chunk_len, &params, &m_fprintf_ctx);
+        } while (data_len > 0);
+    }
+
+    // The formatter flushes at the end of each entry, so the fill buffer state is up to date.
+    CRITICAL_REGION_ENTER();
+    m_formatting = false;
+    if (!m_panic && !m_tx_busy && (m_fill_len > 0))
+    {
+        uarte_fill_commit();
+    }
+    CRITICAL_REGION_EXIT();
+
+    nrf_memobj_put(p_msg);
+}
+
+static void nrf_log_backend_uarte_flush(nrf_log_backend_t const * p_backend)
+{
+    UNUSED_PARAMETER(p_backend);
+
+    if (m_panic)
+    {
+        return;
+    }
+
+    while (m_tx_busy)
+    {
+    }
+}
+
+static void nrf_log_backend_uarte_panic_set(nrf_log_backend_t const * p_backend)
+{
+    UNUSED_PARAMETER(p_backend);
+
+    if (m_panic)
+    {
+        return;
+    }
+
+#if UARTE_PWR_MGMT
+    // Blocking transfers from here on, the UARTE must not be switched off.
+    nrf_pwr_mgmt_periph_power_handler_set(NRF_PWR_MGMT_PERIPH_UARTE, NULL);
+#endif
+
+    // Complete the ongoing transfer without the interrupt, which may no longer be serviced.
+    NRFX_IRQ_DISABLE(nrfx_get_irq_number(m_uarte.p_reg));
+    if (m_tx_busy)
+    {
+        while (!nrf_uarte_event_check(m_uarte.p_reg, NRF_UARTE_EVENT_ENDTX))
+        {
+        }
+        m_tx_idx  = (m_tx_idx + 1) % UARTE_BUF_CNT;
+        m_queued--;
+        m_tx_busy = false;
+    }
+
+    nrfx_uarte_uninit(&m_uarte);
+    uarte_init(false);
+    m_panic = true;
+
+    // Send the remaining buffers before any new output.
+    for (; m_queued > 0; m_queued--)
+    {
+        UNUSED_RETURN_VALUE(nrfx_uarte_tx(&m_uarte, m_buf[m_tx_idx], m_len[m_tx_idx]));
+        m_tx_idx = (m_tx_idx + 1) % UARTE_BUF_CNT;
+    }
+    if (m_fill_len > 0)
+    {
+        UNUSED_RETURN_VALUE(nrfx_uarte_tx(&m_uarte, m_buf[m_fill_idx], m_fill_len));
+        m_fill_len = 0;
+    }
+
+    // Entries are formatted from the start of a buffer and sent before returning.
+    m_fprintf_ctx.p_io_buffer    = (char *)m_buf[m_fill_idx];
+    m_fprintf_ctx.io_buffer_size = UARTE_BUF_SIZE;
+    m_fprintf_ctx.io_buffer_cnt  = 0;
+}
+
+const nrf_log_backend_api_t nrf_log_backend_uarte_api = {
+        .put       = nrf_log_backend_uarte_put,
+        .flush     = nrf_log_backend_uarte_flush,
+        .panic_set = nrf_log_backend_uarte_panic_set,
+};
+#endif //NRF_MODULE_ENABLED(NRF_LOG) && NRF_MODULE_ENABLED(NRF_LOG_BACKEND_UARTE)
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_log_backend_uarte Log UARTE backend
+ * @{
+ * @ingroup  nrf_log
+ * @brief Log backend formatting directly into UARTE EasyDMA buffers.
+ *
+ * @details Entries are formatted into a ring of NRF_LOG_BACKEND_UARTE_BUFFER_COUNT RAM buffers,
+ *          which are passed to nrfx_uarte_tx() without copying. The next buffer is started from
+ *          the TX done event, so the put function returns as soon as the entry is formatted and
+ *          the CPU can sleep while the data is clocked out. While a transfer is ongoing, entries
+ *          are appended to the buffer being filled, so that longer transfers are done when
+ *          the output is busy. The put function waits only if all buffers are queued.
+ *
+ *          Consecutive transfers are separated only by the interrupt latency of the instance,
+ *          which keeps output at 1 Mbaud continuous with typical interrupt priorities.
+ *
+ *          The backend is used instead of the UART backend and must not share its instance:
+ *          @code
+ *          NRF_LOG_BACKEND_UARTE_DEF(m_log_backend_uarte);
+ *
+ *          nrf_log_backend_uarte_init();
+ *          int32_t backend_id = nrf_log_backend_add(&m_log_backend_uarte, NRF_LOG_SEVERITY_DEBUG);
+ *          nrf_log_backend_enable(&m_log_backend_uarte);
+ *          @endcode
+ */
+
+#ifndef NRF_LOG_BACKEND_UARTE_H__
+#define NRF_LOG_BACKEND_UARTE_H__
+
+#include "nrf_log_backend_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const nrf_log_backend_api_t nrf_log_backend_uarte_api;
+
+typedef struct {
+    nrf_log_backend_t               backend;
+} nrf_log_backend_uarte_t;
+
+#define NRF_LOG_BACKEND_UARTE_DEF(_name) \
+    NRF_LOG_BACKEND_DEF(_name, nrf_log_backend_uarte_api, NULL)
+
+/**@brief Function for initializing the UARTE backend. */
+void nrf_log_backend_uarte_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //NRF_LOG_BACKEND_UARTE_H__
+
+/** @} */
@@ -0,0 +1,268 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_LOG_BIN)
+#include "nrf_log_bin.h"
+#include "nrf_atomic.h"
+#include "nrf_assert.h"
+#include "app_util_platform.h"
+
+/**@brief Number of words in the frame buffer. */
+#define LOG_BIN_BUF_WORDS       (NRF_LOG_BIN_CONFIG_BUFSIZE / sizeof(uint32_t))
+
+/**@brief Mask for converting a word counter into a buffer index. */
+#define LOG_BIN_BUF_MASK        (LOG_BIN_BUF_WORDS - 1)
+
+/**@brief Record header flag set by the producer once the frame is written. */
+#define LOG_BIN_HDR_COMMIT      (1UL << 31)
+
+/**@brief Record header flag marking padding up to the end of the buffer. */
+#define LOG_BIN_HDR_PAD         (1UL << 30)
+
+/**@brief Mask of the record length, in words including the header, in a record header. */
+#define LOG_BIN_HDR_WORDS_Msk   0xFFFFUL
+
+/**@brief Number of drop counters: one per interrupt priority and one for thread mode. */
+#define LOG_BIN_DROP_CNT        ((1UL << __NVIC_PRIO_BITS) + 1)
+
+STATIC_ASSERT(IS_POWER_OF_TWO(NRF_LOG_BIN_CONFIG_BUFSIZE));
+STATIC_ASSERT(LOG_BIN_BUF_WORDS >= 2 * (3 + NRF_LOG_BIN_MAX_ARGS));
+
+NRF_SECTION_DEF(log_bin_str, char const);
+
+/*
+ * The buffer holds records of whole words: a header word followed by the frame. Producers reserve
+ * a record by advancing the write counter with compare and exchange, write the frame and then the
+ * header, so producers at different priorities never wait for each other. The consumer stops at
+ * a zero header, which is a record that is reserved but not yet committed, and zeroes the records
+ * it has passed on before releasing them. A record never wraps: if it does not fit before the end
+ * of the buffer, the remaining words are reserved with it and marked as padding.
+ */
+static uint32_t                 m_log_bin_buf[LOG_BIN_BUF_WORDS];
+static nrf_atomic_u32_t         m_wr_idx;         /**< Words reserved by producers, free running. */
+static uint32_t volatile        m_rd_idx;         /**< Words released by the consumer, free running. */
+static uint32_t                 m_rd_offset;      /**< Bytes of the oldest frame already passed on. */
+static nrf_atomic_flag_t        m_processing;     /**< Set while the buffer is being processed. */
+static nrf_log_bin_tx_t         m_tx_func;        /**< Transport for the frames. */
+static nrf_log_timestamp_func_t m_timestamp_func; /**< Timestamp function, NULL if not used. */
+
+/**@brief Number of dropped entries per priority. Each counter is only written from one priority,
+ *        which cannot preempt itself, so no synchronization is needed. */
+static uint32_t volatile        m_dropped[LOG_BIN_DROP_CNT];
+
+/**@brief Store a 32-bit value in little endian byte order. */
+static uint8_t * log_bin_u32_put(uint8_t * p_dst, uint32_t value)
+{
+    *p_dst++ = (uint8_t)value;
+    *p_dst++ = (uint8_t)(value >> 8);
+    *p_dst++ = (uint8_t)(value >> 16);
+    *p_dst++ = (uint8_t)(value >> 24);
+    return p_dst;
+}
+
+/**@brief Get the drop counter index of a priority. */
+static uint32_t log_bin_drop_idx(uint8_t priority)
+{
+    return (priority < (LOG_BIN_DROP_CNT - 1)) ? priority : (LOG_BIN_DROP_CNT - 1);
+}
+
+/**@brief Reserve a record.
+ *
+ * @param[in]  words  Length of the record in words, including the header.
+ * @param[out] p_idx  Buffer index of the record header.
+ *
+ * @retval true  If the record was reserved.
+ * @retval false If there is not enough free space.
+ */
+static bool log_bin_reserve(uint32_t words, uint32_t * p_idx)
+{
+    uint32_t wr = m_wr_idx;
+    uint32_t pos;
+    uint32_t pad;
+
+    do
+    {
+        pos = wr & LOG_BIN_BUF_MASK;
+        pad = (pos + words > LOG_BIN_BUF_WORDS) ? (LOG_BIN_BUF_WORDS - pos) : 0;
+
+        // A stale read counter only underestimates the free space.
+        if ((wr - m_rd_idx) + pad + words > LOG_BIN_BUF_WORDS)
+        {
+            return false;
+        }
+    } while (!nrf_atomic_u32_cmp_exch(&m_wr_idx, &wr, wr + pad + words));
+
+    if (pad != 0)
+    {
+        m_log_bin_buf[pos] = LOG_BIN_HDR_PAD | pad;
+        pos = 0;
+    }
+    *p_idx = pos;
+
+    return true;
+}
+
+ret_code_t nrf_log_bin_init(nrf_log_bin_tx_t tx_func, nrf_log_timestamp_func_t timestamp_func)
+{
+    if (tx_func == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    m_tx_func        = tx_func;
+    m_timestamp_func = timestamp_func;
+    m_wr_idx         = 0;
+    m_rd_idx         = 0;
+    m_rd_offset      = 0;
+    m_processing     = 0;
+    memset(m_log_bin_buf, 0, sizeof(m_log_bin_buf));
+    memset((void *)m_dropped, 0, sizeof(m_dropped));
+
+    return NRF_SUCCESS;
+}
+
+void nrf_log_bin_push(uint8_t level, char const * p_str, uint32_t nargs, uint32_t const * p_args)
+{
+    uint32_t  offset = (uint32_t)(p_str - NRF_SECTION_START_ADDR(log_bin_str));
+    bool      ts     = (m_timestamp_func != NULL);
+    uint32_t  words  = 2 + (ts ? 1 : 0) + nargs;
+    uint32_t  idx;
+    uint8_t * p_frame;
+
+    ASSERT(nargs <= NRF_LOG_BIN_MAX_ARGS);
+    ASSERT(offset <= UINT16_MAX);
+
+    if (!log_bin_reserve(words, &idx))
+    {
+        m_dropped[log_bin_drop_idx(current_int_priority_get())]++;
+        return;
+    }
+
+    p_frame = (uint8_t *)&m_log_bin_buf[idx + 1];
+    *p_frame++ = NRF_LOG_BIN_FRAME_SYNC | (ts ? NRF_LOG_BIN_FRAME_TIMESTAMP : 0) | (uint8_t)nargs;
+    *p_frame++ = level;
+    *p_frame++ = (uint8_t)offset;
+    *p_frame++ = (uint8_t)(offset >> 8);
+    if (ts)
+    {
+        p_frame = log_bin_u32_put(p_frame, m_timestamp_func());
+    }
+    for (uint32_t i = 0; i < nargs; i++)
+    {
+        p_frame = log_bin_u32_put(p_frame, p_args[i]);
+    }
+
+    // The frame must be complete before the consumer can see the header.
+    __DMB();
+    m_log_bin_buf[idx] = LOG_BIN_HDR_COMMIT | words;
+}
+
+bool nrf_log_bin_process(void)
+{
+    uint32_t pos;
+    uint32_t hdr;
+    uint32_t words;
+    size_t   sent = 0;
+
+    ASSERT(m_tx_func != NULL);
+
+    if (nrf_atomic_flag_set_fetch(&m_processing))
+    {
+        // Processed in another context.
+        return false;
+    }
+
+    pos = m_rd_idx & LOG_BIN_BUF_MASK;
+    hdr = m_log_bin_buf[pos];
+    if (hdr & LOG_BIN_HDR_PAD)
+    {
+        words = hdr & LOG_BIN_HDR_WORDS_Msk;
+        memset(&m_log_bin_buf[pos], 0, words * sizeof(uint32_t));
+        __DMB();
+        m_rd_idx += words;
+
+        pos = 0;
+        hdr = m_log_bin_buf[pos];
+    }
+
+    if (hdr & LOG_BIN_HDR_COMMIT)
+    {
+        // The frame must not be read before the header.
+        __DMB();
+
+        words = hdr & LOG_BIN_HDR_WORDS_Msk;
+        size_t len = (words - 1) * sizeof(uint32_t);
+
+        sent = m_tx_func((uint8_t const *)&m_log_bin_buf[pos + 1] + m_rd_offset,
+                         len - m_rd_offset);
+        ASSERT(sent <= len - m_rd_offset);
+        m_rd_offset += sent;
+
+        if (m_rd_offset == len)
+        {
+            memset(&m_log_bin_buf[pos], 0, words * sizeof(uint32_t));
+            __DMB();
+            m_rd_idx   += words;
+            m_rd_offset = 0;
+        }
+    }
+
+    UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&m_processing));
+
+    return (sent > 0);
+}
+
+uint32_t nrf_log_bin_dropped_get(void)
+{
+    uint32_t dropped = 0;
+
+    for (uint32_t i = 0; i < LOG_BIN_DROP_CNT; i++)
+    {
+        dropped += m_dropped[i];
+    }
+    return dropped;
+}
+
+uint32_t nrf_log_bin_dropped_prio_get(uint8_t priority)
+{
+    return m_dropped[log_bin_drop_idx(priority)];
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_LOG_BIN)
@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_log_bin Binary trace log
+ * @{
+ * @ingroup nrf_log
+ *
+ * @brief Logging of format string identifiers and raw arguments, formatted on the host.
+ *
+ * @details The format strings of @ref NRF_LOG_BIN_INFO and the other macros are placed in the
+ *          log_bin_str section and are never read on the target. A log entry is a small frame
+ *          holding the offset of its format string in that section and the raw 32-bit
+ *          arguments. Frames are collected in a ring buffer and passed to the transport given to
+ *          @ref nrf_log_bin_init when @ref nrf_log_bin_process is called, typically from the idle
+ *          loop. No formatting is done on the target.
+ *
+ *          Space for a frame is reserved by advancing the write position with compare and
+ *          exchange, and the frame is committed by writing its header last. Producers at any
+ *          priority never disable interrupts or wait for each other, and a producer that
+ *          preempts another one only fails if the buffer is full. The consumer stops at the
+ *          oldest frame that is not committed yet. Dropped entries are counted per priority.
+ *
+ *          Frame layout, all fields little endian:
+ *          - 1 byte: 0xA0 | timestamp flag (0x08) | number of arguments (0 to 6).
+ *          - 1 byte: severity level.
+ *          - 2 bytes: offset of the format string in the log_bin_str section.
+ *          - 4 bytes: timestamp, if the timestamp flag is set.
+ *          - 4 bytes per argument.
+ *
+ *          nrf_log_bin_decode.py decodes the stream with the string table from the ELF file.
+ *          Since the target does not read the log_bin_str section, it can be left out of the
+ *          programmed image, for example with <tt>objcopy --remove-section=.log_bin_str</tt>.
+ *
+ * @note As in deferred nrf_log, a string argument is logged as a pointer, so it
+ *       must point to a constant string in flash for the host to resolve it.
+ */
+
+#ifndef NRF_LOG_BIN_H__
+#define NRF_LOG_BIN_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sdk_common.h"
+#include "nrf_section.h"
+#include "nrf_log_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_LOG_BIN_FRAME_SYNC      0xA0 ///< Upper bits of the first frame byte.
+#define NRF_LOG_BIN_FRAME_TIMESTAMP 0x08 ///< Timestamp flag in the first frame byte.
+#define NRF_LOG_BIN_MAX_ARGS        6    ///< Maximum number of arguments.
+
+/**@brief Transport for the frames.
+ *
+ * @param[in] p_data Frame data.
+ * @param[in] len    Length of the data.
+ *
+ * @return Number of bytes accepted. The rest is passed again on the next call.
+ */
+typedef size_t (* nrf_log_bin_tx_t)(uint8_t const * p_data, size_t len);
+
+/**
+ * @brief Function for initializing the binary log.
+ *
+ * @param[in] tx_func        Transport for the frames.
+ * @param[in] timestamp_func Timestamp function, or NULL for frames without timestamps.
+ *
+ * @retval NRF_SUCCESS             Initialization successful.
+ * @retval NRF_ERROR_INVALID_PARAM Transport is NULL.
+ */
+ret_code_t nrf_log_bin_init(nrf_log_bin_tx_t tx_func, nrf_log_timestamp_func_t timestamp_func);
+
+/**
+ * @brief Function for passing the oldest buffered frame to the transport.
+ *
+ * Call until it returns false to pass all buffered frames.
+ *
+ * @return False if there were no committed frames to pass or the transport accepted none.
+ */
+bool nrf_log_bin_process(void);
+
+/**
+ * @brief Function for getting the number of entries dropped because the buffer was full.
+ *
+ * @return Number of dropped entries, at all priorities.
+ */
+uint32_t nrf_log_bin_dropped_get(void);
+
+/**
+ * @brief Function for getting the number of entries dropped at one priority.
+ *
+ * @param[in] priority Interrupt priority, or APP_IRQ_PRIORITY_THREAD for thread mode.
+ *
+ * @return Number of entries dropped by producers running at @p priority.
+ */
+uint32_t nrf_log_bin_dropped_prio_get(uint8_t priority);
+
+/**
+ * @brief Function for adding a frame. Used by the logging macros.
+ *
+ * @param[in] level  Severity level.
+ * @param[in] p_str  Format string in the log_bin_str section.
+ * @param[in] nargs  Number of arguments.
+ * @param[in] p_args Arguments.
+ */
+void nrf_log_bin_push(uint8_t level, char const * p_str, uint32_t nargs, uint32_t const * p_args);
+
+/**@cond */
+#define NRF_LOG_BIN_FRAME(level, fmt, nargs, ...)                                         \
+    do                                                                                    \
+    {                                                                                     \
+        NRF_SECTION_ITEM_REGISTER(log_bin_str, static char const m_log_bin_str[]) = fmt;  \
+        uint32_t const m_log_bin_args[] = { __VA_ARGS__ };                                \
+        nrf_log_bin_push(level, m_log_bin_str, nargs, m_log_bin_args);                    \
+    } while (0)
+
+#define NRF_LOG_BIN_INTERNAL_0(level, fmt) \
+    NRF_LOG_BIN_FRAME(level, fmt, 0, 0)
+#define NRF_LOG_BIN_INTERNAL_1(level, fmt, a0) \
+    NRF_LOG_BIN_FRAME(level, fmt, 1, (uint32_t)(a0))
+#define NRF_LOG_BIN_INTERNAL_2(level, fmt, a0, a1) \
+    NRF_LOG_BIN_FRAME(level, fmt, 2, (uint32_t)(a0), (uint32_t)(a1))
+#define NRF_LOG_BIN_INTERNAL_3(level, fmt, a0, a1, a2) \
+    NRF_LOG_BIN_FRAME(level, fmt, 3, (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2))
+#define NRF_LOG_BIN_INTERNAL_4(level, fmt, a0, a1, a2, a3) \
+    NRF_LOG_BIN_FRAME(level, fmt, 4, (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2),   \
+                      (uint32_t)(a3))
+#define NRF_LOG_BIN_INTERNAL_5(level, fmt, a0, a1, a2, a3, a4) \
+    NRF_LOG_BIN_FRAME(level, fmt, 5, (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2),   \
+                      (uint32_t)(a3), (uint32_t)(a4))
+#define NRF_LOG_BIN_INTERNAL_6(level, fmt, a0, a1, a2, a3, a4, a5) \
+    NRF_LOG_BIN_FRAME(level, fmt, 6, (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2),   \
+                      (uint32_t)(a3), (uint32_t)(a4), (uint32_t)(a5))
+
+#if NRF_MODULE_ENABLED(NRF_LOG_BIN)
+#define NRF_LOG_BIN_INTERNAL(level, ...)                                                   \
+    if (NRF_LOG_BIN_CONFIG_LEVEL >= level)                                                 \
+    {                                                                                      \
+        CONCAT_2(NRF_LOG_BIN_INTERNAL_, NUM_VA_ARGS_LESS_1(__VA_ARGS__))(level, __VA_ARGS__); \
+    }
+#else
+#define NRF_LOG_BIN_INTERNAL(level, ...)
+#endif
+/**@endcond */
+
+#define NRF_LOG_BIN_ERROR(...)   NRF_LOG_BIN_INTERNAL(NRF_LOG_SEVERITY_ERROR, __VA_ARGS__)   ///< Log an error.
+#define NRF_LOG_BIN_WARNING(...) NRF_LOG_BIN_INTERNAL(NRF_LOG_SEVERITY_WARNING, __VA_ARGS__) ///< Log a warning.
+#define NRF_LOG_BIN_INFO(...)    NRF_LOG_BIN_INTERNAL(NRF_LOG_SEVERITY_INFO, __VA_ARGS__)    ///< Log an info message.
+#define NRF_LOG_BIN_DEBUG(...)   NRF_LOG_BIN_INTERNAL(NRF_LOG_SEVERITY_DEBUG, __VA_ARGS__)   ///< Log a debug message.
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_LOG_BIN_H__
+
+/** @} */
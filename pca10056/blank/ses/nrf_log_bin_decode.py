@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+#
+# Decoder for the nrf_log_bin binary trace stream.
+#
+# Usage: nrf_log_bin_decode.py app.elf stream.bin
+#        nrf_log_bin_decode.py app.elf - < stream.bin
+#
+# Format strings are read from the .log_bin_str section of the ELF file. String
+# arguments are resolved from any allocated section of the same file.
+
+import re
+import struct
+import sys
+
+LEVELS = {1: "error", 2: "warning", 3: "info", 4: "debug"}
+SYNC_MASK = 0xF0
+SYNC = 0xA0
+TIMESTAMP = 0x08
+NARGS_MASK = 0x07
+FORMAT_SPEC = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z|j|t)?([diouxXcsp%])")
+
+
+def elf_sections(data):
+    """Return a list of (name, address, bytes) for the sections of a 32-bit ELF file."""
+    if data[:4] != b"\x7fELF" or data[4] != 1:
+        raise ValueError("not a 32-bit ELF file")
+    shoff, = struct.unpack_from("<I", data, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+    headers = [struct.unpack_from("<IIIIIIIIII", data, shoff + i * shentsize)
+               for i in range(shnum)]
+    names = headers[shstrndx]
+    sections = []
+    for name, sh_type, _, addr, offset, size, _, _, _, _ in headers:
+        end = data.index(b"\0", names[4] + name)
+        sec_name = data[names[4] + name:end].decode()
+        content = data[offset:offset + size] if sh_type != 8 else b""  # SHT_NOBITS
+        sections.append((sec_name, addr, content))
+    return sections
+
+
+def c_string(content, offset):
+    end = content.find(b"\0", offset)
+    return content[offset:end if end >= 0 else len(content)].decode(errors="replace")
+
+
+def format_entry(fmt, args, sections):
+    args = list(args)
+
+    def convert(match):
+        flags, conv = match.groups()
+        if conv == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        if conv in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+        elif conv == "s":
+            for _, addr, content in sections:
+                if addr and addr <= value < addr + len(content):
+                    value = c_string(content, value - addr)
+                    break
+            else:
+                value = "<0x%08X>" % value
+        elif conv == "c":
+            value = chr(value & 0xFF)
+        elif conv == "p":
+            conv, flags = "X", "08"
+        elif conv == "u":
+            conv = "d"
+        return ("%" + flags + conv) % value
+
+    return FORMAT_SPEC.sub(convert, fmt)
+
+
+def decode(stream, sections):
+    table = next((content for name, _, content in sections if name == ".log_bin_str"), None)
+    if table is None:
+        raise ValueError("no .log_bin_str section")
+    pos = 0
+    while pos + 4 <= len(stream):
+        header = stream[pos]
+        if header & SYNC_MASK != SYNC:
+            pos += 1        # Resynchronize on the next frame start.
+            continue
+        nargs = header & NARGS_MASK
+        length = 4 + (4 if header & TIMESTAMP else 0) + 4 * nargs
+        if pos + length > len(stream):
+            break
+        level = stream[pos + 1]
+        offset, = struct.unpack_from("<H", stream, pos + 2)
+        fields = struct.unpack_from("<%dI" % (length // 4 - 1), stream, pos + 4)
+        timestamp = fields[0] if header & TIMESTAMP else None
+        args = fields[1:] if header & TIMESTAMP else fields
+        text = format_entry(c_string(table, offset), args, sections)
+        prefix = "[%08u] " % timestamp if timestamp is not None else ""
+        yield "%s<%s> %s" % (prefix, LEVELS.get(level, level), text)
+        pos += length
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write("usage: %s app.elf stream.bin|-\n" % argv[0])
+        return 2
+    with open(argv[1], "rb") as elf:
+        sections = elf_sections(elf.read())
+    if argv[2] == "-":
+        stream = sys.stdin.buffer.read()
+    else:
+        with open(argv[2], "rb") as f:
+            stream = f.read()
+    for line in decode(stream, sections):
+        print(line)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
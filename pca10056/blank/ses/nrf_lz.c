@@ -0,0 +1,434 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_LZ)
+#include <string.h>
+#include "nrf_lz.h"
+#include "nrf_assert.h"
+
+#define LZ_WINDOW_MASK   (NRF_LZ_WINDOW_SIZE - 1)
+#define LZ_GROUP_ITEMS   8 ///< Number of items after a control byte.
+#define LZ_MATCH_LEN     2 ///< Length of an encoded match.
+
+/**@brief Function for getting the hash table index of the 3-byte sequence at @p p_data. */
+__STATIC_INLINE uint32_t lz_hash(uint8_t const * p_data)
+{
+    uint32_t seq = ((uint32_t)p_data[0] << 16) | ((uint32_t)p_data[1] << 8) | p_data[2];
+
+    // Fibonacci hashing, keeping the upper bits of the product.
+    return (uint32_t)(seq * 0x9E3779B1UL) >> (32 - NRF_LZ_CONFIG_HASH_BITS);
+}
+
+/**@brief Function for getting the number of length bits of a match. */
+__STATIC_INLINE uint32_t lz_len_bits(uint8_t window_bits)
+{
+    return 16 - window_bits;
+}
+
+/**@brief Function for getting a byte of the stream while encoding.
+ *
+ * @details Positions from @p base on are in the data being encoded, earlier ones in the window.
+ */
+__STATIC_INLINE uint8_t enc_byte_get(nrf_lz_enc_t const * p_enc,
+                                     uint8_t const      * p_data,
+                                     uint32_t             base,
+                                     uint32_t             pos)
+{
+    return (pos >= base) ? p_data[pos - base] : p_enc->window[pos & LZ_WINDOW_MASK];
+}
+
+/**@brief Function for finding the longest match of the data at @p offset.
+ *
+ * @details The candidate is the last position with the same hash. Its bytes are compared, so a
+ *          stale or colliding hash entry only costs a shorter match.
+ *
+ * @param[in]  p_enc   Encoder.
+ * @param[in]  p_data  Data being encoded.
+ * @param[in]  length  Length of the data.
+ * @param[in]  offset  Offset of the bytes to match in @p p_data.
+ * @param[out] p_dist  Distance of the match.
+ *
+ * @return Length of the match, less than @ref NRF_LZ_MATCH_LEN_MIN if none was found.
+ */
+static uint32_t enc_match_find(nrf_lz_enc_t  * p_enc,
+                               uint8_t const * p_data,
+                               size_t          length,
+                               size_t          offset,
+                               uint32_t      * p_dist)
+{
+    uint32_t   pos     = p_enc->pos + offset;
+    uint32_t   max_len = NRF_LZ_MATCH_LEN_MIN + (1UL << lz_len_bits(p_enc->window_bits)) - 1;
+    uint32_t   len     = 0;
+    uint32_t   dist;
+    uint32_t   cand;
+    uint16_t * p_entry;
+
+    if (length - offset < NRF_LZ_MATCH_LEN_MIN)
+    {
+        return 0;
+    }
+
+    p_entry  = &p_enc->hash[lz_hash(&p_data[offset])];
+    dist     = (uint16_t)((uint16_t)pos - *p_entry);
+    *p_entry = (uint16_t)pos;
+
+    if ((dist == 0) || (dist > (1UL << p_enc->window_bits)) || (dist > pos))
+    {
+        return 0;
+    }
+
+    max_len = MIN(max_len, length - offset);
+    cand    = pos - dist;
+
+    while ((len < max_len) &&
+           (enc_byte_get(p_enc, p_data, p_enc->pos, cand + len) == p_data[offset + len]))
+    {
+        len++;
+    }
+
+    *p_dist = dist;
+    return len;
+}
+
+/**@brief Function for checking a format and getting its window bits. */
+static bool format_window_bits_get(uint8_t format, uint8_t * p_window_bits)
+{
+    uint8_t window_bits = format & 0x0F;
+
+    if (((format >> 4) != NRF_LZ_FORMAT_VERSION) ||
+        (window_bits < NRF_LZ_WINDOW_BITS_MIN)   ||
+        (window_bits > NRF_LZ_CONFIG_WINDOW_BITS))
+    {
+        return false;
+    }
+
+    *p_window_bits = window_bits;
+    return true;
+}
+
+uint8_t nrf_lz_format_negotiate(uint8_t peer_format)
+{
+    uint8_t window_bits = peer_format & 0x0F;
+
+    if (((peer_format >> 4) != NRF_LZ_FORMAT_VERSION) || (window_bits < NRF_LZ_WINDOW_BITS_MIN))
+    {
+        return 0;
+    }
+
+    return NRF_LZ_FORMAT(MIN(window_bits, NRF_LZ_CONFIG_WINDOW_BITS));
+}
+
+bool nrf_lz_format_is_supported(uint8_t format)
+{
+    uint8_t window_bits;
+
+    return format_window_bits_get(format, &window_bits);
+}
+
+ret_code_t nrf_lz_enc_init(nrf_lz_enc_t * p_enc, uint8_t format)
+{
+    ASSERT(p_enc);
+
+    if (!format_window_bits_get(format, &p_enc->window_bits))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    memset(p_enc->window, 0, sizeof(p_enc->window));
+    memset(p_enc->hash, 0, sizeof(p_enc->hash));
+    p_enc->pos = 0;
+
+    return NRF_SUCCESS;
+}
+
+size_t nrf_lz_encode(nrf_lz_enc_t  * p_enc,
+                     uint8_t const * p_data,
+                     size_t          length,
+                     uint8_t       * p_packet,
+                     size_t          size,
+                     size_t        * p_taken)
+{
+    uint32_t len_bits  = lz_len_bits(p_enc->window_bits);
+    size_t   offset    = 0;
+    size_t   out_len   = 0;
+    size_t   ctrl_idx  = 0;
+    uint32_t item      = LZ_GROUP_ITEMS;
+    uint32_t match_len;
+    uint32_t dist      = 0;
+    uint32_t code;
+
+    ASSERT(p_enc);
+    ASSERT(p_data || (length == 0));
+    ASSERT(p_packet);
+    ASSERT(p_taken);
+
+    while (offset < length)
+    {
+        if (item == LZ_GROUP_ITEMS)
+        {
+            // A group is only opened if at least a literal fits after the control byte.
+            if (size - out_len < 2)
+            {
+                break;
+            }
+            ctrl_idx           = out_len++;
+            p_packet[ctrl_idx] = 0;
+            item               = 0;
+        }
+
+        match_len = enc_match_find(p_enc, p_data, length, offset, &dist);
+
+        if ((match_len >= NRF_LZ_MATCH_LEN_MIN) && (size - out_len >= LZ_MATCH_LEN))
+        {
+            code                 = ((dist - 1) << len_bits) | (match_len - NRF_LZ_MATCH_LEN_MIN);
+            p_packet[out_len++]  = (uint8_t)(code >> 8);
+            p_packet[out_len++]  = (uint8_t)code;
+            p_packet[ctrl_idx]  |= (uint8_t)(1 << item);
+
+            // Hash the positions within the match too, to find them in later data.
+            for (uint32_t i = 1; i < match_len; i++)
+            {
+                if (length - (offset + i) >= NRF_LZ_MATCH_LEN_MIN)
+                {
+                    p_enc->hash[lz_hash(&p_data[offset + i])] = (uint16_t)(p_enc->pos + offset + i);
+                }
+            }
+            offset += match_len;
+        }
+        else if (size - out_len >= 1)
+        {
+            p_packet[out_len++] = p_data[offset++];
+        }
+        else
+        {
+            break;
+        }
+
+        item++;
+    }
+
+    *p_taken = offset;
+    return out_len;
+}
+
+void nrf_lz_enc_commit(nrf_lz_enc_t * p_enc, uint8_t const * p_data, size_t length)
+{
+    ASSERT(p_enc);
+    ASSERT(p_data || (length == 0));
+
+    if (length > NRF_LZ_WINDOW_SIZE)
+    {
+        // Only the last bytes stay in the window.
+        p_enc->pos += length - NRF_LZ_WINDOW_SIZE;
+        p_data     += length - NRF_LZ_WINDOW_SIZE;
+        length      = NRF_LZ_WINDOW_SIZE;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        p_enc->window[(p_enc->pos + i) & LZ_WINDOW_MASK] = p_data[i];
+    }
+    p_enc->pos += length;
+}
+
+ret_code_t nrf_lz_dec_init(nrf_lz_dec_t * p_dec, uint8_t format)
+{
+    ASSERT(p_dec);
+
+    if (!format_window_bits_get(format, &p_dec->window_bits))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    memset(p_dec->window, 0, sizeof(p_dec->window));
+    p_dec->pos = 0;
+
+    return NRF_SUCCESS;
+}
+
+/**@brief Function for checking a packet and getting its decoded length.
+ *
+ * @param[in]  p_dec    Decoder.
+ * @param[in]  p_packet Packet.
+ * @param[in]  length   Length of the packet.
+ * @param[out] p_length Decoded length.
+ *
+ * @retval NRF_SUCCESS            The packet can be decoded.
+ * @retval NRF_ERROR_INVALID_DATA The packet is invalid.
+ */
+static ret_code_t dec_packet_check(nrf_lz_dec_t const * p_dec,
+                                   uint8_t const      * p_packet,
+                                   size_t               length,
+                                   size_t             * p_length)
+{
+    uint32_t len_bits = lz_len_bits(p_dec->window_bits);
+    uint32_t decoded  = 0;
+    size_t   idx      = 0;
+    uint32_t code;
+    uint32_t dist;
+    uint8_t  ctrl;
+
+    while (idx < length)
+    {
+        ctrl = p_packet[idx++];
+
+        for (uint32_t item = 0; (item < LZ_GROUP_ITEMS) && (idx < length); item++)
+        {
+            if ((ctrl & (1 << item)) == 0)
+            {
+                idx++;
+                decoded++;
+                continue;
+            }
+
+            if (length - idx < LZ_MATCH_LEN)
+            {
+                return NRF_ERROR_INVALID_DATA;
+            }
+
+            code = ((uint32_t)p_packet[idx] << 8) | p_packet[idx + 1];
+            dist = (code >> len_bits) + 1;
+            if (dist > p_dec->pos + decoded)
+            {
+                return NRF_ERROR_INVALID_DATA;
+            }
+
+            idx     += LZ_MATCH_LEN;
+            decoded += (code & ((1UL << len_bits) - 1)) + NRF_LZ_MATCH_LEN_MIN;
+        }
+    }
+
+    *p_length = decoded;
+    return NRF_SUCCESS;
+}
+
+/**@brief Function for adding a decoded byte to the window.
+ *
+ * @details The window is passed to the handler when it wraps, from @p p_start on.
+ */
+__STATIC_INLINE void dec_byte_put(nrf_lz_dec_t        * p_dec,
+                                  uint8_t               byte,
+                                  uint32_t            * p_start,
+                                  nrf_lz_data_handler_t handler,
+                                  void                * p_context)
+{
+    p_dec->window[p_dec->pos & LZ_WINDOW_MASK] = byte;
+    p_dec->pos++;
+
+    if ((p_dec->pos & LZ_WINDOW_MASK) == 0)
+    {
+        handler(&p_dec->window[*p_start], NRF_LZ_WINDOW_SIZE - *p_start, p_context);
+        *p_start = 0;
+    }
+}
+
+ret_code_t nrf_lz_decode(nrf_lz_dec_t        * p_dec,
+                         uint8_t const       * p_packet,
+                         size_t                length,
+                         nrf_lz_data_handler_t handler,
+                         void                * p_context,
+                         size_t              * p_length)
+{
+    ret_code_t err_code;
+    uint32_t   len_bits;
+    uint32_t   start;
+    uint32_t   code;
+    uint32_t   dist;
+    uint32_t   match_len;
+    size_t     decoded;
+    size_t     idx = 0;
+    uint8_t    ctrl;
+
+    ASSERT(p_dec);
+    ASSERT(p_packet || (length == 0));
+    ASSERT(handler);
+
+    err_code = dec_packet_check(p_dec, p_packet, length, &decoded);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    len_bits = lz_len_bits(p_dec->window_bits);
+    start    = p_dec->pos & LZ_WINDOW_MASK;
+
+    while (idx < length)
+    {
+        ctrl = p_packet[idx++];
+
+        for (uint32_t item = 0; (item < LZ_GROUP_ITEMS) && (idx < length); item++)
+        {
+            if ((ctrl & (1 << item)) == 0)
+            {
+                dec_byte_put(p_dec, p_packet[idx++], &start, handler, p_context);
+                continue;
+            }
+
+            code       = ((uint32_t)p_packet[idx] << 8) | p_packet[idx + 1];
+            dist       = (code >> len_bits) + 1;
+            match_len  = (code & ((1UL << len_bits) - 1)) + NRF_LZ_MATCH_LEN_MIN;
+            idx       += LZ_MATCH_LEN;
+
+            // The match can overlap the bytes it produces, so they are copied one by one.
+            while (match_len-- > 0)
+            {
+                dec_byte_put(p_dec,
+                             p_dec->window[(p_dec->pos - dist) & LZ_WINDOW_MASK],
+                             &start,
+                             handler,
+                             p_context);
+            }
+        }
+    }
+
+    if ((p_dec->pos & LZ_WINDOW_MASK) != start)
+    {
+        handler(&p_dec->window[start], (p_dec->pos & LZ_WINDOW_MASK) - start, p_context);
+    }
+
+    if (p_length != NULL)
+    {
+        *p_length = decoded;
+    }
+
+    return NRF_SUCCESS;
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_LZ)
@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_lz Streaming LZ compression
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Small window LZ77 compression of a byte stream sent in packets.
+ *
+ * @details The stream is compressed into packets of a size given by the caller, typically one
+ *          ATT payload. Every packet can be decoded on its own, with the bytes of the earlier
+ *          packets as dictionary, so the packets must be decoded in the order they were made
+ *          and none can be lost, as is the case for GATT notifications and writes on one link.
+ *
+ *          A packet is a sequence of groups. A group starts with a control byte followed by up
+ *          to 8 items, one per bit of the control byte starting from the least significant bit.
+ *          A cleared bit is a literal byte. A set bit is a 16-bit big-endian match: the upper
+ *          window bits hold the distance back in the stream minus 1, the lower bits the length
+ *          minus @ref NRF_LZ_MATCH_LEN_MIN. An item never spans two packets, and the control
+ *          bits of the items missing from the last group are ignored. Data that does not
+ *          compress grows by one byte in 8.
+ *
+ *          The window bits of the stream are given with its format, see @ref NRF_LZ_FORMAT. The
+ *          encoder and the decoder use fixed RAM: the window of
+ *          (1 << @c NRF_LZ_CONFIG_WINDOW_BITS) bytes, plus a hash table of
+ *          (2 << @c NRF_LZ_CONFIG_HASH_BITS) bytes in the encoder.
+ *
+ *          A packet made by @ref nrf_lz_encode is only added to the dictionary by
+ *          @ref nrf_lz_enc_commit, so a packet that could not be sent can be dropped and the
+ *          data encoded again later.
+ */
+
+#ifndef NRF_LZ_H__
+#define NRF_LZ_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "sdk_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_LZ_FORMAT_VERSION  1  ///< Version of the packet format.
+#define NRF_LZ_WINDOW_BITS_MIN 8  ///< Smallest window of a stream, as a power of 2.
+#define NRF_LZ_WINDOW_BITS_MAX 12 ///< Largest window of a stream, as a power of 2.
+#define NRF_LZ_MATCH_LEN_MIN   3  ///< Length of the shortest match.
+#define NRF_LZ_PACKET_LEN_MIN  2  ///< Shortest packet that can hold data.
+
+#if (NRF_LZ_CONFIG_WINDOW_BITS < NRF_LZ_WINDOW_BITS_MIN) || \
+    (NRF_LZ_CONFIG_WINDOW_BITS > NRF_LZ_WINDOW_BITS_MAX)
+#error "NRF_LZ_CONFIG_WINDOW_BITS must be in the range of 8 to 12."
+#endif
+
+/**@brief Size of the window kept by the encoder and the decoder. */
+#define NRF_LZ_WINDOW_SIZE (1UL << NRF_LZ_CONFIG_WINDOW_BITS)
+
+/**
+ * @brief Macro for getting the format byte of a stream.
+ *
+ * @details The format is exchanged by the peers before the stream starts. The upper 4 bits hold
+ *          @ref NRF_LZ_FORMAT_VERSION and the lower 4 bits the window bits of the stream.
+ *
+ * @param _window_bits Window of the stream as a power of 2, from @ref NRF_LZ_WINDOW_BITS_MIN to
+ *                     @c NRF_LZ_CONFIG_WINDOW_BITS.
+ */
+#define NRF_LZ_FORMAT(_window_bits) ((uint8_t)((NRF_LZ_FORMAT_VERSION << 4) | (_window_bits)))
+
+/**@brief Format with the largest window supported by this build. */
+#define NRF_LZ_FORMAT_DEFAULT NRF_LZ_FORMAT(NRF_LZ_CONFIG_WINDOW_BITS)
+
+/**@brief Encoder of a stream. */
+typedef struct
+{
+    uint8_t  window[NRF_LZ_WINDOW_SIZE];          ///< Last bytes committed to the stream.
+    uint16_t hash[1UL << NRF_LZ_CONFIG_HASH_BITS]; ///< Lower 16 bits of the last position of each hashed 3-byte sequence.
+    uint32_t pos;                                  ///< Number of bytes committed to the stream.
+    uint8_t  window_bits;                          ///< Window of the stream as a power of 2.
+} nrf_lz_enc_t;
+
+/**@brief Decoder of a stream. */
+typedef struct
+{
+    uint8_t  window[NRF_LZ_WINDOW_SIZE]; ///< Last bytes decoded from the stream.
+    uint32_t pos;                        ///< Number of bytes decoded from the stream.
+    uint8_t  window_bits;                ///< Window of the stream as a power of 2.
+} nrf_lz_dec_t;
+
+/**
+ * @brief Decoded data handler.
+ *
+ * @param[in] p_data    Decoded data, valid until the handler returns.
+ * @param[in] length    Length of the data.
+ * @param[in] p_context Context given to @ref nrf_lz_decode.
+ */
+typedef void (* nrf_lz_data_handler_t)(uint8_t const * p_data, size_t length, void * p_context);
+
+/**
+ * @brief Function for choosing the format of a stream from the format supported by the peer.
+ *
+ * @param[in] peer_format Largest format supported by the peer.
+ *
+ * @return Format with the smaller of both windows, or 0 if the peer uses another version.
+ */
+uint8_t nrf_lz_format_negotiate(uint8_t peer_format);
+
+/**
+ * @brief Function for checking if a stream format can be encoded and decoded.
+ *
+ * @param[in] format Format of the stream.
+ *
+ * @retval true  If the version matches and the window fits this build.
+ * @retval false Otherwise.
+ */
+bool nrf_lz_format_is_supported(uint8_t format);
+
+/**
+ * @brief Function for starting a new stream in the encoder.
+ *
+ * @param[out] p_enc  Encoder.
+ * @param[in]  format Format of the stream.
+ *
+ * @retval NRF_SUCCESS             The encoder is ready.
+ * @retval NRF_ERROR_INVALID_PARAM The format is not supported, see @ref nrf_lz_format_is_supported.
+ */
+ret_code_t nrf_lz_enc_init(nrf_lz_enc_t * p_enc, uint8_t format);
+
+/**
+ * @brief Function for encoding data into one packet.
+ *
+ * @details The data is encoded until the packet is full or all data is taken. The dictionary
+ *          is not changed, so the same call gives the same packet until
+ *          @ref nrf_lz_enc_commit is called.
+ *
+ * @param[in]  p_enc     Encoder.
+ * @param[in]  p_data    Data to encode.
+ * @param[in]  length    Length of the data.
+ * @param[out] p_packet  Packet.
+ * @param[in]  size      Size of the packet buffer, at least @ref NRF_LZ_PACKET_LEN_MIN to take
+ *                       any data.
+ * @param[out] p_taken   Number of bytes of @p p_data encoded in the packet.
+ *
+ * @return Length of the packet, 0 if no data was taken.
+ */
+size_t nrf_lz_encode(nrf_lz_enc_t  * p_enc,
+                     uint8_t const * p_data,
+                     size_t          length,
+                     uint8_t       * p_packet,
+                     size_t          size,
+                     size_t        * p_taken);
+
+/**
+ * @brief Function for adding the data of a sent packet to the stream.
+ *
+ * @param[in] p_enc  Encoder.
+ * @param[in] p_data Data given to @ref nrf_lz_encode.
+ * @param[in] length Number of bytes taken by @ref nrf_lz_encode.
+ */
+void nrf_lz_enc_commit(nrf_lz_enc_t * p_enc, uint8_t const * p_data, size_t length);
+
+/**
+ * @brief Function for starting a new stream in the decoder.
+ *
+ * @param[out] p_dec  Decoder.
+ * @param[in]  format Format of the stream.
+ *
+ * @retval NRF_SUCCESS             The decoder is ready.
+ * @retval NRF_ERROR_INVALID_PARAM The format is not supported, see @ref nrf_lz_format_is_supported.
+ */
+ret_code_t nrf_lz_dec_init(nrf_lz_dec_t * p_dec, uint8_t format);
+
+/**
+ * @brief Function for decoding a packet.
+ *
+ * @details The packet is checked before it is decoded, so an invalid packet does not change
+ *          the decoder. The decoded data is passed to @p handler straight from the window, in
+ *          one or more pieces.
+ *
+ * @param[in]  p_dec     Decoder.
+ * @param[in]  p_packet  Packet.
+ * @param[in]  length    Length of the packet.
+ * @param[in]  handler   Handler of the decoded data.
+ * @param[in]  p_context Context passed to @p handler.
+ * @param[out] p_length  Number of bytes decoded. Can be NULL.
+ *
+ * @retval NRF_SUCCESS            The packet was decoded.
+ * @retval NRF_ERROR_INVALID_DATA The packet ends within a match or refers to data before the
+ *                                window or the stream. The stream cannot be decoded further.
+ */
+ret_code_t nrf_lz_decode(nrf_lz_dec_t        * p_dec,
+                         uint8_t const       * p_packet,
+                         size_t                length,
+                         nrf_lz_data_handler_t handler,
+                         void                * p_context,
+                         size_t              * p_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_LZ_H__
+
+/** @} */
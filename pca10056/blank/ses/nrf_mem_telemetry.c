@@ -0,0 +1,385 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+#include "nrf_mem_telemetry.h"
+#include <string.h>
+#include "nrf.h"
+#include "nrf_section.h"
+#include "nrf_atfifo.h"
+#include "nrf_ringbuf.h"
+#include "app_util_platform.h"
+#if NRF_MODULE_ENABLED(NRF_BALLOC)
+#include "nrf_balloc.h"
+#include "nrf_balloc_idx.h"
+#endif
+#if NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE
+#include "app_scheduler.h"
+#endif
+
+#define NRF_LOG_MODULE_NAME nrf_mem_telemetry
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#if NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE && !APP_SCHEDULER_ENABLED
+#error "NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE requires APP_SCHEDULER_ENABLED."
+#endif
+
+NRF_SECTION_DEF(nrf_mem_telemetry, nrf_mem_telemetry_source_t);
+
+#define SOURCE_COUNT()  NRF_SECTION_ITEM_COUNT(nrf_mem_telemetry, nrf_mem_telemetry_source_t)
+#define SOURCE_GET(_i)  NRF_SECTION_ITEM_GET(nrf_mem_telemetry, nrf_mem_telemetry_source_t, (_i))
+
+
+#if NRF_MODULE_ENABLED(NRF_BALLOC)
+NRF_SECTION_DEF(nrf_balloc, nrf_balloc_t);
+
+#define BALLOC_COUNT()  NRF_SECTION_ITEM_COUNT(nrf_balloc, nrf_balloc_t)
+#define BALLOC_GET(_i)  NRF_SECTION_ITEM_GET(nrf_balloc, nrf_balloc_t, (_i))
+
+#if NRF_BALLOC_CONFIG_DEBUG_ENABLED || NRF_BALLOC_CLI_CMDS
+#define BALLOC_NAME(_p_pool) ((_p_pool)->p_name)
+#else
+#define BALLOC_NAME(_p_pool) "balloc"
+#endif
+
+/**@brief Statistics kept for the first pools of the nrf_balloc section. */
+static nrf_mem_telemetry_cb_t m_balloc_cb[NRF_MEM_TELEMETRY_CONFIG_BALLOC_MAX_POOLS];
+
+/**@brief Function for getting the number of allocated blocks of a pool, 0 if it is not initialized. */
+static uint32_t balloc_used_get(nrf_balloc_t const * p_pool)
+{
+    return (p_pool->p_cb->p_stack_pointer != NULL) ? nrf_balloc_idx_utilization_get(p_pool) : 0;
+}
+#else
+#define BALLOC_COUNT()  0
+#endif // NRF_MODULE_ENABLED(NRF_BALLOC)
+
+
+#if NRF_MEM_TELEMETRY_CONFIG_STACK_ENABLED
+#define STACK_PAINT         0x5AC55AC5UL    /**< Pattern written to the unused stack. */
+#define STACK_PAINT_MARGIN  64              /**< Bytes below the stack pointer left for the painting code. */
+
+extern uint32_t __StackLimit;   /**< Lowest address of the main stack. From the linker configuration. */
+extern uint32_t __StackTop;     /**< Address above the main stack. From the linker configuration. */
+
+static bool m_stack_painted;
+
+static void stack_paint(void)
+{
+    uint32_t * p_word = &__StackLimit;
+    uint32_t * p_end  = (uint32_t *)((__get_MSP() - STACK_PAINT_MARGIN) & ~0x3UL);
+
+    // Interrupts may use the stack below the pointer meanwhile, but only while this loop is
+    // preempted, so the words written are never in use.
+    while (p_word < p_end)
+    {
+        *p_word++ = STACK_PAINT;
+    }
+    m_stack_painted = true;
+}
+
+static void stack_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats)
+{
+    uint32_t const * p_word = &__StackLimit;
+    uint32_t const * p_top  = &__StackTop;
+
+    UNUSED_PARAMETER(p_object);
+
+    p_stats->capacity = (p_top - p_word) * sizeof(uint32_t);
+    p_stats->used     = (uint32_t)p_top - __get_MSP();
+
+    if (m_stack_painted)
+    {
+        // The stack grows down, so the lowest word that is not the pattern any more gives the
+        // deepest use. A frame that happened to leave the pattern in place is missed.
+        while ((p_word < p_top) && (*p_word == STACK_PAINT))
+        {
+            p_word++;
+        }
+        p_stats->high_water = (p_top - p_word) * sizeof(uint32_t);
+    }
+}
+
+NRF_MEM_TELEMETRY_SOURCE_DEF(m_stack, "stack", NULL, NRF_MEM_TELEMETRY_UNIT_BYTES,
+                             stack_usage_get, NULL);
+#endif // NRF_MEM_TELEMETRY_CONFIG_STACK_ENABLED
+
+
+#if NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE
+static void app_sched_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats)
+{
+    UNUSED_PARAMETER(p_object);
+
+    p_stats->capacity = NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE;
+    p_stats->used     = NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE - app_sched_queue_space_get();
+#if APP_SCHEDULER_WITH_PROFILER
+    p_stats->high_water = app_sched_queue_utilization_get();
+#endif
+}
+
+NRF_MEM_TELEMETRY_SOURCE_DEF(m_app_sched, "app_scheduler", NULL, NRF_MEM_TELEMETRY_UNIT_ELEMENTS,
+                             app_sched_usage_get, NULL);
+#endif // NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE
+
+
+void nrf_mem_telemetry_atfifo_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats)
+{
+    nrf_atfifo_t const * p_fifo = p_object;
+
+    // One item of the buffer is always left empty. Writers may use the space up to the position
+    // released by the readers, so items being written or read are counted.
+    uint32_t used = p_fifo->tail.pos.wr + p_fifo->buf_size - p_fifo->head.pos.wr;
+
+    p_stats->capacity = (p_fifo->buf_size / p_fifo->item_size) - 1;
+    p_stats->used     = (used % p_fifo->buf_size) / p_fifo->item_size;
+}
+
+
+void nrf_mem_telemetry_ringbuf_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats)
+{
+    nrf_ringbuf_t const * p_ringbuf = p_object;
+
+    p_stats->capacity = p_ringbuf->bufsize_mask + 1;
+    p_stats->used     = p_ringbuf->p_cb->tmp_wr_idx - p_ringbuf->p_cb->rd_idx;
+}
+
+
+/**@brief Function for merging the statistics of an object with the statistics kept for it.
+ *
+ * @param[in]    p_cb    Statistics kept for the object, or NULL.
+ * @param[inout] p_stats Statistics of the object, updated with the kept ones.
+ * @param[in]    failed  Whether an allocation failed.
+ */
+static void stats_merge(nrf_mem_telemetry_cb_t * p_cb, nrf_mem_telemetry_stats_t * p_stats, bool failed)
+{
+    p_stats->high_water = MAX(p_stats->high_water, p_stats->used);
+
+    if (p_cb == NULL)
+    {
+        return;
+    }
+
+    CRITICAL_REGION_ENTER();
+
+    if (failed)
+    {
+        p_cb->failures++;
+    }
+    p_cb->high_water     = MAX(p_cb->high_water, p_stats->high_water);
+    p_stats->high_water  = p_cb->high_water;
+    p_stats->failures   += p_cb->failures;
+
+    CRITICAL_REGION_EXIT();
+}
+
+
+/**@brief Function for reading a source. Balloc pools come first, then the registered sources.
+ *
+ * @param[in]  idx     Index of the source, less than @ref nrf_mem_telemetry_count.
+ * @param[out] p_entry Statistics of the source.
+ * @param[in]  failed  Whether an allocation failed.
+ */
+static void entry_read(uint32_t idx, nrf_mem_telemetry_entry_t * p_entry, bool failed)
+{
+    nrf_mem_telemetry_cb_t * p_cb;
+
+    memset(&p_entry->stats, 0, sizeof(p_entry->stats));
+
+#if NRF_MODULE_ENABLED(NRF_BALLOC)
+    if (idx < BALLOC_COUNT())
+    {
+        nrf_balloc_t const * p_pool = BALLOC_GET(idx);
+
+        p_entry->p_name           = BALLOC_NAME(p_pool);
+        p_entry->unit             = NRF_MEM_TELEMETRY_UNIT_ELEMENTS;
+        p_entry->stats.capacity   = nrf_balloc_idx_pool_size_get(p_pool);
+        p_entry->stats.used       = balloc_used_get(p_pool);
+        p_entry->stats.high_water = p_pool->p_cb->max_utilization;
+
+        p_cb = (idx < ARRAY_SIZE(m_balloc_cb)) ? &m_balloc_cb[idx] : NULL;
+        stats_merge(p_cb, &p_entry->stats, failed);
+        return;
+    }
+#endif
+
+    nrf_mem_telemetry_source_t const * p_source = SOURCE_GET(idx - BALLOC_COUNT());
+
+    p_entry->p_name = p_source->p_name;
+    p_entry->unit   = p_source->unit;
+    p_source->usage_get(p_source->p_object, &p_entry->stats);
+    stats_merge(p_source->p_cb, &p_entry->stats, failed);
+}
+
+
+void nrf_mem_telemetry_init(void)
+{
+#if NRF_MEM_TELEMETRY_CONFIG_STACK_ENABLED
+    stack_paint();
+#endif
+    nrf_mem_telemetry_reset();
+}
+
+
+uint32_t nrf_mem_telemetry_count(void)
+{
+    return BALLOC_COUNT() + SOURCE_COUNT();
+}
+
+
+uint32_t nrf_mem_telemetry_get(nrf_mem_telemetry_entry_t * p_entries, uint32_t max_entries)
+{
+    uint32_t count = MIN(nrf_mem_telemetry_count(), max_entries);
+
+    if (p_entries == NULL)
+    {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        entry_read(i, &p_entries[i], false);
+    }
+
+    return count;
+}
+
+
+void nrf_mem_telemetry_sample(void)
+{
+    uint32_t count = nrf_mem_telemetry_count();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrf_mem_telemetry_entry_t entry;
+
+        entry_read(i, &entry, false);
+    }
+}
+
+
+void nrf_mem_telemetry_failure_record(void const * p_object)
+{
+    nrf_mem_telemetry_entry_t entry;
+
+    if (p_object == NULL)
+    {
+        return;
+    }
+
+#if NRF_MODULE_ENABLED(NRF_BALLOC)
+    nrf_balloc_t const * p_pool = p_object;
+
+    if ((p_object >= NRF_SECTION_START_ADDR(nrf_balloc)) &&
+        (p_object <  NRF_SECTION_END_ADDR(nrf_balloc)))
+    {
+        entry_read(p_pool - BALLOC_GET(0), &entry, true);
+        return;
+    }
+#endif
+
+    // Failures are rare, so the sources are searched rather than indexed.
+    for (uint32_t i = 0; i < SOURCE_COUNT(); i++)
+    {
+        if (SOURCE_GET(i)->p_object == p_object)
+        {
+            entry_read(BALLOC_COUNT() + i, &entry, true);
+            return;
+        }
+    }
+}
+
+
+void nrf_mem_telemetry_log(void)
+{
+    static char const * const units[] = { "elements", "bytes" };
+
+    uint32_t count = nrf_mem_telemetry_count();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrf_mem_telemetry_entry_t entry;
+
+        entry_read(i, &entry, false);
+
+        NRF_LOG_INFO("%s: %u of %u %s used, high-water %u, %u failures.",
+                     entry.p_name,
+                     entry.stats.used,
+                     entry.stats.capacity,
+                     units[entry.unit],
+                     entry.stats.high_water,
+                     entry.stats.failures);
+    }
+}
+
+
+void nrf_mem_telemetry_reset(void)
+{
+#if NRF_MODULE_ENABLED(NRF_BALLOC)
+    for (uint32_t i = 0; i < BALLOC_COUNT(); i++)
+    {
+        nrf_balloc_t const * p_pool = BALLOC_GET(i);
+
+        CRITICAL_REGION_ENTER();
+        p_pool->p_cb->max_utilization = MIN(balloc_used_get(p_pool), UINT8_MAX);
+        CRITICAL_REGION_EXIT();
+    }
+
+    CRITICAL_REGION_ENTER();
+    memset(m_balloc_cb, 0, sizeof(m_balloc_cb));
+    CRITICAL_REGION_EXIT();
+#endif
+
+    for (uint32_t i = 0; i < SOURCE_COUNT(); i++)
+    {
+        nrf_mem_telemetry_source_t const * p_source = SOURCE_GET(i);
+
+        if (p_source->reset != NULL)
+        {
+            p_source->reset(p_source->p_object);
+        }
+
+        CRITICAL_REGION_ENTER();
+        memset(p_source->p_cb, 0, sizeof(nrf_mem_telemetry_cb_t));
+        CRITICAL_REGION_EXIT();
+    }
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_mem_telemetry Memory pool and stack telemetry
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Module for reporting the use of memory pools, queues and the stack in one place.
+ *
+ * @details For every source, the module reports the capacity, the current use, the highest use
+ *          (high-water mark) and the number of allocations that failed because the source was
+ *          full. @ref nrf_mem_telemetry_get copies the statistics of all sources in one call.
+ *
+ *          The sources are:
+ *          - every nrf_balloc pool, including the pools of nrf_memobj and the data pool of
+ *            nrf_ble_gq. Pools are found in the nrf_balloc section, so they need no registration.
+ *            Failures are counted for the first NRF_MEM_TELEMETRY_CONFIG_BALLOC_MAX_POOLS pools.
+ *          - FIFOs and ring buffers registered with @ref NRF_MEM_TELEMETRY_ATFIFO_DEF and
+ *            @ref NRF_MEM_TELEMETRY_RINGBUF_DEF.
+ *          - the request queues of every nrf_ble_gq instance, summed over the connections.
+ *          - the levels of app_sched_prio, or the queue of app_scheduler when
+ *            NRF_MEM_TELEMETRY_CONFIG_APP_SCHED_QUEUE_SIZE is set.
+ *          - the write buffer of the Peer Database.
+ *          - the main stack, when NRF_MEM_TELEMETRY_CONFIG_STACK_ENABLED is set.
+ *
+ *          Other modules are added with @ref NRF_MEM_TELEMETRY_SOURCE_DEF. Sources are registered
+ *          in the nrf_mem_telemetry section, which must be present in the linker configuration.
+ *
+ *          Sources that do not track their own highest use (balloc pools larger than 255 blocks,
+ *          FIFOs, ring buffers, app_scheduler and the Peer Database buffer) get a high-water mark
+ *          sampled by @ref nrf_mem_telemetry_sample and on every failure. Call it regularly, for
+ *          example before going to sleep, so that short peaks are seen.
+ *
+ *          The stack high-water mark is estimated by painting the unused stack with a pattern in
+ *          @ref nrf_mem_telemetry_init and finding the lowest word that was overwritten. Call it
+ *          as early as possible in main().
+ */
+
+#ifndef NRF_MEM_TELEMETRY_H__
+#define NRF_MEM_TELEMETRY_H__
+
+#include <stdint.h>
+#include "sdk_errors.h"
+#include "nordic_common.h"
+#include "sdk_config.h"
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+#include "nrf_section.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Unit of the capacity and use of a source. */
+typedef enum
+{
+    NRF_MEM_TELEMETRY_UNIT_ELEMENTS,    ///< Blocks, items or events.
+    NRF_MEM_TELEMETRY_UNIT_BYTES        ///< Bytes.
+} nrf_mem_telemetry_unit_t;
+
+/**@brief Statistics of a source. */
+typedef struct
+{
+    uint32_t capacity;      ///< Largest possible use.
+    uint32_t used;          ///< Current use.
+    uint32_t high_water;    ///< Highest use since the last reset.
+    uint32_t failures;      ///< Allocations that failed because the source was full.
+} nrf_mem_telemetry_stats_t;
+
+/**@brief Statistics of a source, with its name. Filled by @ref nrf_mem_telemetry_get. */
+typedef struct
+{
+    char const              * p_name;   ///< Name of the source.
+    nrf_mem_telemetry_unit_t  unit;     ///< Unit of the statistics.
+    nrf_mem_telemetry_stats_t stats;    ///< Statistics.
+} nrf_mem_telemetry_entry_t;
+
+/**@brief Function for getting the use of a source.
+ *
+ * @details Called with @p p_stats cleared. Must fill the capacity and the current use. The
+ *          high-water mark and the failures may be left at 0 if the source does not track them.
+ *
+ * @param[in]  p_object Object of the source.
+ * @param[out] p_stats  Statistics of the object.
+ */
+typedef void (*nrf_mem_telemetry_usage_get_t)(void const * p_object, nrf_mem_telemetry_stats_t * p_stats);
+
+/**@brief Function for clearing the statistics a source tracks itself. */
+typedef void (*nrf_mem_telemetry_reset_t)(void const * p_object);
+
+/**@brief Statistics kept by the module for a source. */
+typedef struct
+{
+    uint32_t high_water;    ///< Highest use seen by sampling.
+    uint32_t failures;      ///< Failures recorded with @ref nrf_mem_telemetry_failure_record.
+} nrf_mem_telemetry_cb_t;
+
+/**@brief Source. */
+typedef struct
+{
+    char const                  * p_name;       ///< Name of the source.
+    void const                  * p_object;     ///< Object of the source.
+    nrf_mem_telemetry_usage_get_t usage_get;    ///< Function for getting the use of the object.
+    nrf_mem_telemetry_reset_t     reset;        ///< Function for clearing the statistics of the object, or NULL.
+    nrf_mem_telemetry_cb_t      * p_cb;         ///< Statistics kept by the module.
+    nrf_mem_telemetry_unit_t      unit;         ///< Unit of the statistics.
+} nrf_mem_telemetry_source_t;
+
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY) || defined(__SDK_DOXYGEN__)
+/**@brief Macro for registering a source.
+ *
+ * @param _id        Identifier of the source, unique in the file.
+ * @param _name      Name of the source, a string.
+ * @param _p_object  Object of the source, passed to @p _usage_get and @p _reset.
+ * @param _unit      Unit of the statistics, see @ref nrf_mem_telemetry_unit_t.
+ * @param _usage_get Function for getting the use of the object.
+ * @param _reset     Function for clearing the statistics of the object, or NULL.
+ * @hideinitializer
+ */
+#define NRF_MEM_TELEMETRY_SOURCE_DEF(_id, _name, _p_object, _unit, _usage_get, _reset)    \
+    static nrf_mem_telemetry_cb_t CONCAT_2(_id, _mem_telemetry_cb);                         \
+    NRF_SECTION_ITEM_REGISTER(nrf_mem_telemetry,                                            \
+                              static nrf_mem_telemetry_source_t const                       \
+                              CONCAT_2(_id, _mem_telemetry_source)) =                       \
+    {                                                                                       \
+        .p_name    = (_name),                                                               \
+        .p_object  = (_p_object),                                                           \
+        .usage_get = (_usage_get),                                                          \
+        .reset     = (_reset),                                                              \
+        .p_cb      = &CONCAT_2(_id, _mem_telemetry_cb),                                     \
+        .unit      = (_unit)                                                                \
+    }
+
+/**@brief Macro for registering a FIFO defined with NRF_ATFIFO_DEF or NRF_ATFIFO_SPSC_DEF.
+ *
+ * @details Reported in items. Items allocated but not put yet, and items got but not freed yet,
+ *          are counted as used.
+ *
+ * @param _fifo_id Identifier of the FIFO, as given to NRF_ATFIFO_DEF.
+ * @hideinitializer
+ */
+#define NRF_MEM_TELEMETRY_ATFIFO_DEF(_fifo_id)                                \
+    NRF_MEM_TELEMETRY_SOURCE_DEF(_fifo_id,                                  \
+                                 STRINGIFY(_fifo_id),                       \
+                                 &NRF_ATFIFO_INST_NAME(_fifo_id),           \
+                                 NRF_MEM_TELEMETRY_UNIT_ELEMENTS,           \
+                                 nrf_mem_telemetry_atfifo_usage_get,        \
+                                 NULL)
+
+/**@brief Macro for registering a ring buffer defined with NRF_RINGBUF_DEF.
+ *
+ * @details Reported in bytes. Bytes allocated but not put yet are counted as used.
+ *
+ * @param _name Name of the ring buffer.
+ * @hideinitializer
+ */
+#define NRF_MEM_TELEMETRY_RINGBUF_DEF(_name)                                  \
+    NRF_MEM_TELEMETRY_SOURCE_DEF(_name,                                     \
+                                 STRINGIFY(_name),                          \
+                                 &_name,                                    \
+                                 NRF_MEM_TELEMETRY_UNIT_BYTES,              \
+                                 nrf_mem_telemetry_ringbuf_usage_get,       \
+                                 NULL)
+#else
+#define NRF_MEM_TELEMETRY_SOURCE_DEF(_id, _name, _p_object, _unit, _usage_get, _reset)
+#define NRF_MEM_TELEMETRY_ATFIFO_DEF(_fifo_id)
+#define NRF_MEM_TELEMETRY_RINGBUF_DEF(_name)
+#endif
+
+/**@brief Function for initializing the module.
+ *
+ * @details Paints the unused part of the stack when NRF_MEM_TELEMETRY_CONFIG_STACK_ENABLED is
+ *          set, and clears the statistics of all sources.
+ */
+void nrf_mem_telemetry_init(void);
+
+/**@brief Function for getting the number of sources.
+ *
+ * @return Number of entries filled by @ref nrf_mem_telemetry_get.
+ */
+uint32_t nrf_mem_telemetry_count(void);
+
+/**@brief Function for getting the statistics of all sources.
+ *
+ * @details Samples every source first, so the high-water marks include the current use.
+ *
+ * @param[out] p_entries   Entries to fill.
+ * @param[in]  max_entries Number of entries in @p p_entries.
+ *
+ * @return Number of entries filled, at most @ref nrf_mem_telemetry_count.
+ */
+uint32_t nrf_mem_telemetry_get(nrf_mem_telemetry_entry_t * p_entries, uint32_t max_entries);
+
+/**@brief Function for updating the sampled high-water marks of all sources.
+ *
+ * @details Can be called from any interrupt priority.
+ */
+void nrf_mem_telemetry_sample(void);
+
+/**@brief Function for recording an allocation that failed because a source was full.
+ *
+ * @details Called by the modules of the sources. Objects that are not registered are ignored.
+ *          Can be called from any interrupt priority.
+ *
+ * @param[in] p_object Balloc pool, or object of a registered source.
+ */
+void nrf_mem_telemetry_failure_record(void const * p_object);
+
+/**@brief Function for logging the statistics of all sources. */
+void nrf_mem_telemetry_log(void);
+
+/**@brief Function for clearing the high-water marks and the failures of all sources.
+ *
+ * @details The high-water marks restart from the current use. The stack is not painted again, so
+ *          its high-water mark is not cleared.
+ */
+void nrf_mem_telemetry_reset(void);
+
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+/**@brief Function for getting the use of a FIFO. Used by @ref NRF_MEM_TELEMETRY_ATFIFO_DEF. */
+void nrf_mem_telemetry_atfifo_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats);
+
+/**@brief Function for getting the use of a ring buffer. Used by @ref NRF_MEM_TELEMETRY_RINGBUF_DEF. */
+void nrf_mem_telemetry_ringbuf_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_MEM_TELEMETRY_H__
+
+/** @} */
@@ -39,6 +39,7 @@
  */
 
 #include "nrf_memobj.h"
+#include "nrf_memobj_iov.h"
 #include "nrf_atomic.h"
 #include "nrf_assert.h"
 
@@ -172,69 +173,225 @@ void nrf_memobj_put(nrf_memobj_t * p_obj)
     }
 }
 
-static void memobj_op(nrf_memobj_t * p_obj,
-                      void *         p_data,
-                      size_t *       p_len,
-                      size_t         offset,
-                      bool read)
+/**@brief Function for getting the capacity of a memory object. */
+static size_t memobj_capacity_get(memobj_head_t const * p_head)
 {
+    return (p_head->head_header.data.fields.chunk_size *
+            p_head->head_header.data.fields.chunk_cnt) -
+            sizeof(memobj_head_header_fields_t);
+}
 
+size_t nrf_memobj_capacity_get(nrf_memobj_t const * p_obj)
+{
     ASSERT(p_obj);
+    return memobj_capacity_get((memobj_head_t const *)p_obj);
+}
 
-    memobj_head_t * p_head       = (memobj_head_t *)p_obj;
-    memobj_elem_t * p_curr_chunk = (memobj_elem_t *)p_obj;
-    size_t          obj_capacity;
-    size_t          chunk_size;
-    size_t          chunk_idx;
-    size_t          chunk_offset;
-    size_t          len;
+void * nrf_memobj_contiguous_get(nrf_memobj_t * p_obj, size_t * p_len)
+{
+    ASSERT(p_obj);
 
-    obj_capacity = (p_head->head_header.data.fields.chunk_size *
-                    p_head->head_header.data.fields.chunk_cnt) -
-                    sizeof(memobj_head_header_fields_t);
+    memobj_head_t * p_head = (memobj_head_t *)p_obj;
 
-    ASSERT(offset < obj_capacity);
+    if (p_head->head_header.data.fields.chunk_cnt != 1)
+    {
+        return NULL;
+    }
 
-    chunk_size   = p_head->head_header.data.fields.chunk_size;
-    chunk_idx    = (offset + sizeof(memobj_head_header_fields_t)) / chunk_size;
-    chunk_offset = (offset + sizeof(memobj_head_header_fields_t)) % chunk_size;
-    len          = ((*p_len + offset) > obj_capacity) ? obj_capacity - offset : *p_len;
+    if (p_len != NULL)
+    {
+        *p_len = memobj_capacity_get(p_head);
+    }
+    return p_head->data;
+}
 
-    //Return number of available bytes
-    *p_len = len;
+void nrf_memobj_cursor_init(nrf_memobj_cursor_t * p_cursor,
+                            nrf_memobj_t *        p_obj,
+                            size_t                offset)
+{
+    ASSERT(p_cursor);
+    ASSERT(p_obj);
 
-    //Move to the first chunk to be used
+    memobj_head_t * p_head       = (memobj_head_t *)p_obj;
+    memobj_elem_t * p_curr_chunk = (memobj_elem_t *)p_obj;
+    size_t          obj_capacity = memobj_capacity_get(p_head);
+    size_t          chunk_size   = p_head->head_header.data.fields.chunk_size;
+    // Data of the head chunk starts with the head header fields. The position is never 0, so the
+    // cursor is placed at the end of the previous chunk rather than at the start of the next one.
+    // That way an offset equal to the capacity does not need a chunk after the last one.
+    size_t          pos          = offset + sizeof(memobj_head_header_fields_t);
+    size_t          chunk_idx    = (pos - 1) / chunk_size;
+
+    ASSERT(offset <= obj_capacity);
+
+    p_cursor->chunk_offset = (uint16_t)((pos - 1) % chunk_size + 1);
+    p_cursor->chunk_size   = (uint16_t)chunk_size;
+    p_cursor->remaining    = obj_capacity - offset;
+
+    //Move to the chunk holding the cursor
     while (chunk_idx > 0)
     {
         p_curr_chunk = p_curr_chunk->header.p_next;
         chunk_idx--;
     }
+    p_cursor->p_chunk = p_curr_chunk;
+}
+
+size_t nrf_memobj_cursor_chunk_get(nrf_memobj_cursor_t * p_cursor, uint8_t ** pp_data)
+{
+    ASSERT(p_cursor);
+    ASSERT(pp_data);
+
+    if (p_cursor->remaining == 0)
+    {
+        return 0;
+    }
+
+    memobj_elem_t * p_curr_chunk = (memobj_elem_t *)p_cursor->p_chunk;
+    if (p_cursor->chunk_offset == p_cursor->chunk_size)
+    {
+        // Bytes remain, so there is a next chunk.
+        p_curr_chunk           = p_curr_chunk->header.p_next;
+        p_cursor->p_chunk      = p_curr_chunk;
+        p_cursor->chunk_offset = 0;
+    }
+
+    *pp_data = &p_curr_chunk->data[p_cursor->chunk_offset];
+    return MIN((size_t)(p_cursor->chunk_size - p_cursor->chunk_offset), p_cursor->remaining);
+}
+
+/**
+ * @brief Function for copying data at the cursor and moving it forward.
+ *
+ * @param[in,out] p_cursor Pointer to the cursor.
+ * @param[in,out] p_data   User buffer. If NULL, the cursor is only moved.
+ * @param[in]     len      Length of the user buffer.
+ * @param[in]     read     True to copy from the object, false to copy to it.
+ *
+ * @return Number of bytes processed.
+ */
+static size_t memobj_cursor_op(nrf_memobj_cursor_t * p_cursor,
+                               uint8_t *             p_data,
+                               size_t                len,
+                               bool                  read)
+{
+    size_t done = 0;
 
-    size_t user_mem_offset  = 0;
-    size_t curr_cpy_size    = chunk_size - chunk_offset;
-    curr_cpy_size = curr_cpy_size > len ? len : curr_cpy_size;
+    len = MIN(len, p_cursor->remaining);
 
-    while (len)
+    while (done < len)
     {
-        void * p_user_mem = &((uint8_t *)p_data)[user_mem_offset];
-        void * p_obj_mem  = &p_curr_chunk->data[chunk_offset];
+        uint8_t * p_obj_mem;
+        size_t    curr_cpy_size = nrf_memobj_cursor_chunk_get(p_cursor, &p_obj_mem);
+
+        curr_cpy_size = MIN(curr_cpy_size, len - done);
+        if (p_data != NULL)
+        {
+            if (read)
+            {
+                memcpy(&p_data[done], p_obj_mem, curr_cpy_size);
+            }
+            else
+            {
+                memcpy(p_obj_mem, &p_data[done], curr_cpy_size);
+            }
+        }
+
+        p_cursor->chunk_offset += curr_cpy_size;
+        p_cursor->remaining    -= curr_cpy_size;
+        done                   += curr_cpy_size;
+    }
+
+    return done;
+}
+
+size_t nrf_memobj_cursor_write(nrf_memobj_cursor_t * p_cursor, void const * p_data, size_t len)
+{
+    ASSERT(p_cursor);
+    return memobj_cursor_op(p_cursor, (uint8_t *)p_data, len, false);
+}
+
+size_t nrf_memobj_cursor_read(nrf_memobj_cursor_t * p_cursor, void * p_data, size_t len)
+{
+    ASSERT(p_cursor);
+    return memobj_cursor_op(p_cursor, (uint8_t *)p_data, len, true);
+}
+
+size_t nrf_memobj_cursor_advance(nrf_memobj_cursor_t * p_cursor, size_t len)
+{
+    ASSERT(p_cursor);
+    return memobj_cursor_op(p_cursor, NULL, len, true);
+}
+
+static void memobj_op(nrf_memobj_t * p_obj,
+                      void *         p_data,
+                      size_t *       p_len,
+                      size_t         offset,
+                      bool read)
+{
+    nrf_memobj_cursor_t cursor;
+    memobj_head_t *     p_head = (memobj_head_t *)p_obj;
+
+    ASSERT(p_obj);
+    ASSERT(offset < memobj_capacity_get(p_head));
+
+    if (p_head->head_header.data.fields.chunk_cnt == 1)
+    {
+        // Contiguous object, the data directly follows the head header.
+        size_t len = MIN(*p_len, memobj_capacity_get(p_head) - offset);
         if (read)
         {
-            memcpy(p_user_mem, p_obj_mem, curr_cpy_size);
+            memcpy(p_data, &p_head->data[offset], len);
         }
         else
         {
-            memcpy(p_obj_mem, p_user_mem, curr_cpy_size);
+            memcpy(&p_head->data[offset], p_data, len);
         }
+        *p_len = len;
+        return;
+    }
 
-        chunk_offset     = 0;
-        p_curr_chunk     = p_curr_chunk->header.p_next;
-        len             -= curr_cpy_size;
-        user_mem_offset += curr_cpy_size;
-        curr_cpy_size    = (chunk_size > len) ? len : chunk_size;
+    nrf_memobj_cursor_init(&cursor, p_obj, offset);
+
+    //Return number of available bytes
+    *p_len = memobj_cursor_op(&cursor, p_data, *p_len, read);
+}
+
+static void memobj_iov_op(nrf_memobj_t *             p_obj,
+                          nrf_memobj_iovec_t const * p_iov,
+                          size_t                     iov_cnt,
+                          size_t                     offset,
+                          bool                       read)
+{
+    nrf_memobj_cursor_t cursor;
+
+    ASSERT(p_iov || (iov_cnt == 0));
+
+    nrf_memobj_cursor_init(&cursor, p_obj, offset);
+
+    for (size_t i = 0; i < iov_cnt; i++)
+    {
+        size_t op_len = memobj_cursor_op(&cursor, p_iov[i].p_data, p_iov[i].len, read);
+        ASSERT(op_len == p_iov[i].len);
     }
 }
 
+void nrf_memobj_writev(nrf_memobj_t *             p_obj,
+                       nrf_memobj_iovec_t const * p_iov,
+                       size_t                     iov_cnt,
+                       size_t                     offset)
+{
+    memobj_iov_op(p_obj, p_iov, iov_cnt, offset, false);
+}
+
+void nrf_memobj_readv(nrf_memobj_t *             p_obj,
+                      nrf_memobj_iovec_t const * p_iov,
+                      size_t                     iov_cnt,
+                      size_t                     offset)
+{
+    memobj_iov_op(p_obj, p_iov, iov_cnt, offset, true);
+}
+
 void nrf_memobj_write(nrf_memobj_t * p_obj,
                       void *         p_data,
                       size_t         len,
@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_memobj_iov Memory object scatter-gather access
+ * @{
+ * @ingroup nrf_memobj
+ *
+ * @brief Multi-segment and cursor based access to memory objects.
+ *
+ * @details nrf_memobj_write() and nrf_memobj_read() walk the chunk chain from the head on every
+ *          call. The functions in this module locate the starting chunk once and then continue
+ *          from it:
+ *          - @ref nrf_memobj_writev and @ref nrf_memobj_readv copy a list of segments, for example
+ *            a header, a payload and a trailer, in a single pass.
+ *          - A cursor (@ref nrf_memobj_cursor_t) keeps the current chunk between calls, so
+ *            consecutive reads or writes do not restart from the head.
+ *          - @ref nrf_memobj_cursor_chunk_get gives direct access to the contiguous part of the
+ *            current chunk, for example to start a DMA transfer, and
+ *            @ref nrf_memobj_cursor_advance moves past it without copying.
+ *
+ *          An object allocated with a size that fits in one chunk is contiguous. For such objects
+ *          nrf_memobj_write() and nrf_memobj_read() copy directly without walking the chain, and
+ *          @ref nrf_memobj_contiguous_get returns a pointer to the whole object data.
+ */
+
+#ifndef NRF_MEMOBJ_IOV_H__
+#define NRF_MEMOBJ_IOV_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sdk_common.h"
+#include "nrf_memobj.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Single segment of a scatter-gather list. */
+typedef struct
+{
+    void * p_data; ///< User buffer.
+    size_t len;    ///< Length of the user buffer.
+} nrf_memobj_iovec_t;
+
+/**@brief Memory object cursor.
+ *
+ * @note The fields are internal, use the cursor functions to access the object.
+ */
+typedef struct
+{
+    void *   p_chunk;      ///< Current chunk.
+    uint16_t chunk_offset; ///< Offset in the current chunk, equal to the chunk size at its end.
+    uint16_t chunk_size;   ///< Size of the chunk data.
+    size_t   remaining;    ///< Number of bytes from the cursor to the end of the object.
+} nrf_memobj_cursor_t;
+
+/**
+ * @brief Function for getting the number of bytes that fit in the memory object.
+ *
+ * @param[in] p_obj Pointer to a memory object.
+ *
+ * @return Capacity of the object.
+ */
+size_t nrf_memobj_capacity_get(nrf_memobj_t const * p_obj);
+
+/**
+ * @brief Function for getting direct access to the data of a contiguous memory object.
+ *
+ * @param[in]  p_obj Pointer to a memory object.
+ * @param[out] p_len Capacity of the object. Can be NULL.
+ *
+ * @return Pointer to the object data or NULL if the object spans more than one chunk.
+ */
+void * nrf_memobj_contiguous_get(nrf_memobj_t * p_obj, size_t * p_len);
+
+/**
+ * @brief Function for writing a list of segments to a memory object.
+ *
+ * The segments are written one after another starting at @p offset.
+ *
+ * @param[in] p_obj   Pointer to a memory object.
+ * @param[in] p_iov   Segments to write.
+ * @param[in] iov_cnt Number of segments.
+ * @param[in] offset  Offset (in bytes) in the memory object.
+ */
+void nrf_memobj_writev(nrf_memobj_t *             p_obj,
+                       nrf_memobj_iovec_t const * p_iov,
+                       size_t                     iov_cnt,
+                       size_t                     offset);
+
+/**
+ * @brief Function for reading a list of segments from a memory object.
+ *
+ * The segments are filled one after another starting at @p offset.
+ *
+ * @param[in] p_obj   Pointer to a memory object.
+ * @param[in] p_iov   Segments to fill.
+ * @param[in] iov_cnt Number of segments.
+ * @param[in] offset  Offset (in bytes) in the memory object.
+ */
+void nrf_memobj_readv(nrf_memobj_t *             p_obj,
+                      nrf_memobj_iovec_t const * p_iov,
+                      size_t                     iov_cnt,
+                      size_t                     offset);
+
+/**
+ * @brief Function for placing a cursor in a memory object.
+ *
+ * @param[out] p_cursor Pointer to the cursor.
+ * @param[in]  p_obj    Pointer to a memory object.
+ * @param[in]  offset   Offset (in bytes) in the memory object. It can be equal to the capacity.
+ */
+void nrf_memobj_cursor_init(nrf_memobj_cursor_t * p_cursor,
+                            nrf_memobj_t *        p_obj,
+                            size_t                offset);
+
+/**
+ * @brief Function for writing data at the cursor and moving it forward.
+ *
+ * @param[in,out] p_cursor Pointer to the cursor.
+ * @param[in]     p_data   Data to write.
+ * @param[in]     len      Length of the data.
+ *
+ * @return Number of bytes written. It is lower than @p len if the end of the object is reached.
+ */
+size_t nrf_memobj_cursor_write(nrf_memobj_cursor_t * p_cursor, void const * p_data, size_t len);
+
+/**
+ * @brief Function for reading data at the cursor and moving it forward.
+ *
+ * @param[in,out] p_cursor Pointer to the cursor.
+ * @param[out]    p_data   Buffer for the data.
+ * @param[in]     len      Length of the buffer.
+ *
+ * @return Number of bytes read. It is lower than @p len if the end of the object is reached.
+ */
+size_t nrf_memobj_cursor_read(nrf_memobj_cursor_t * p_cursor, void * p_data, size_t len);
+
+/**
+ * @brief Function for getting direct access to the memory at the cursor.
+ *
+ * The cursor is not moved. Use @ref nrf_memobj_cursor_advance after the memory is processed.
+ *
+ * @param[in,out] p_cursor Pointer to the cursor.
+ * @param[out]    pp_data  Pointer to the memory at the cursor.
+ *
+ * @return Number of contiguous bytes available at @p pp_data, 0 at the end of the object.
+ */
+size_t nrf_memobj_cursor_chunk_get(nrf_memobj_cursor_t * p_cursor, uint8_t ** pp_data);
+
+/**
+ * @brief Function for moving the cursor forward without copying.
+ *
+ * @param[in,out] p_cursor Pointer to the cursor.
+ * @param[in]     len      Number of bytes to skip.
+ *
+ * @return Number of bytes skipped. It is lower than @p len if the end of the object is reached.
+ */
+size_t nrf_memobj_cursor_advance(nrf_memobj_cursor_t * p_cursor, size_t len);
+
+/**
+ * @brief Function for getting the number of bytes from the cursor to the end of the object.
+ *
+ * @param[in] p_cursor Pointer to the cursor.
+ *
+ * @return Number of remaining bytes.
+ */
+__STATIC_INLINE size_t nrf_memobj_cursor_remaining_get(nrf_memobj_cursor_t const * p_cursor)
+{
+    return p_cursor->remaining;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_MEMOBJ_IOV_H__
+
+/** @} */
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_PROFILER)
+#include "nrf_profiler.h"
+#include <string.h>
+#include "nrf.h"
+#include "nrf_section.h"
+#include "app_util_platform.h"
+
+#define NRF_LOG_MODULE_NAME nrf_profiler
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+NRF_SECTION_DEF(nrf_profiler, nrf_profiler_probe_t);
+
+
+void nrf_profiler_init(void)
+{
+    // Enable the DWT cycle counter.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    nrf_profiler_reset();
+}
+
+
+void nrf_profiler_record(nrf_profiler_probe_t const * p_probe, uint32_t cycles)
+{
+    nrf_profiler_stats_t * p_stats = p_probe->p_stats;
+
+    CRITICAL_REGION_ENTER();
+
+    if ((p_stats->count == 0) || (cycles < p_stats->cycles_min))
+    {
+        p_stats->cycles_min = cycles;
+    }
+    if (cycles > p_stats->cycles_max)
+    {
+        p_stats->cycles_max = cycles;
+    }
+    p_stats->cycles_sum += cycles;
+    p_stats->count++;
+
+    CRITICAL_REGION_EXIT();
+}
+
+
+uint32_t nrf_profiler_probe_count(void)
+{
+    return NRF_SECTION_ITEM_COUNT(nrf_profiler, nrf_profiler_probe_t);
+}
+
+
+char const * nrf_profiler_stats_get(uint32_t idx, nrf_profiler_stats_t * p_stats)
+{
+    nrf_profiler_probe_t const * p_probe;
+
+    if ((p_stats == NULL) || (idx >= nrf_profiler_probe_count()))
+    {
+        return NULL;
+    }
+
+    p_probe = NRF_SECTION_ITEM_GET(nrf_profiler, nrf_profiler_probe_t, idx);
+
+    CRITICAL_REGION_ENTER();
+    *p_stats = *p_probe->p_stats;
+    CRITICAL_REGION_EXIT();
+
+    return p_probe->p_name;
+}
+
+
+void nrf_profiler_log(void)
+{
+    uint32_t count = nrf_profiler_probe_count();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrf_profiler_stats_t stats;
+        char const         * p_name = nrf_profiler_stats_get(i, &stats);
+
+        if (stats.count == 0)
+        {
+            continue;
+        }
+
+        NRF_LOG_INFO("%s: %u runs, min %u, max %u, mean %u cycles.",
+                     p_name,
+                     stats.count,
+                     stats.cycles_min,
+                     stats.cycles_max,
+                     (uint32_t)(stats.cycles_sum / stats.count));
+    }
+}
+
+
+void nrf_profiler_reset(void)
+{
+    uint32_t count = nrf_profiler_probe_count();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrf_profiler_probe_t const * p_probe = NRF_SECTION_ITEM_GET(nrf_profiler,
+                                                                    nrf_profiler_probe_t,
+                                                                    i);
+
+        CRITICAL_REGION_ENTER();
+        memset(p_probe->p_stats, 0, sizeof(nrf_profiler_stats_t));
+        CRITICAL_REGION_EXIT();
+    }
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_PROFILER)
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_profiler Code region profiler
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Module for timing code regions with named probes, in CPU cycles.
+ *
+ * @details A probe is defined once with @ref NRF_PROFILER_PROBE_DEF, and a code region is timed
+ *          by enclosing it in @ref NRF_PROFILER_BEGIN and @ref NRF_PROFILER_END with the name of
+ *          the probe. Each probe keeps the number of times its region ran and the smallest,
+ *          largest and mean run time, counted by the DWT cycle counter. Regions may run in
+ *          interrupt context and may be nested.
+ *
+ *          Probes are registered in the nrf_profiler section, so @ref nrf_profiler_log reports all
+ *          of them without a central list. Results are reported through nrf_log, so they reach
+ *          RTT when the RTT backend is used.
+ *
+ *          When the module is disabled, the macros are empty and the probes cost nothing.
+ *
+ *          Probes are placed in:
+ *          - nrfx_saadc_irq_handler() (saadc_irq),
+ *          - the RTC interrupt handler of app_timer (app_timer_rtc_irq),
+ *          - nrf_sdh_evts_poll() (sdh_evts_poll),
+ *          - the request processing of nrf_ble_gq (ble_gq_queue_process).
+ */
+
+#ifndef NRF_PROFILER_H__
+#define NRF_PROFILER_H__
+
+#include <stdint.h>
+#include "sdk_errors.h"
+#include "nordic_common.h"
+#include "sdk_config.h"
+#if NRF_MODULE_ENABLED(NRF_PROFILER)
+#include "nrf.h"
+#include "nrf_section.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Statistics of a probe. */
+typedef struct
+{
+    uint32_t count;         ///< Number of times the region ran.
+    uint32_t cycles_min;    ///< Shortest run time, in CPU cycles.
+    uint32_t cycles_max;    ///< Longest run time, in CPU cycles.
+    uint64_t cycles_sum;    ///< Total run time, in CPU cycles.
+} nrf_profiler_stats_t;
+
+/**@brief Probe. */
+typedef struct
+{
+    char const           * p_name;  ///< Name of the probe.
+    nrf_profiler_stats_t * p_stats; ///< Statistics of the probe.
+} nrf_profiler_probe_t;
+
+#if NRF_MODULE_ENABLED(NRF_PROFILER) || defined(__SDK_DOXYGEN__)
+/**@brief Macro for defining a probe.
+ *
+ * @param _name Name of the probe, used with @ref NRF_PROFILER_BEGIN and @ref NRF_PROFILER_END.
+ *              Must be unique in the file.
+ * @hideinitializer
+ */
+#define NRF_PROFILER_PROBE_DEF(_name)                                                   \
+    static nrf_profiler_stats_t CONCAT_2(m_profiler_stats_, _name);                     \
+    NRF_SECTION_ITEM_REGISTER(nrf_profiler,                                             \
+                              static nrf_profiler_probe_t const                         \
+                              CONCAT_2(m_profiler_probe_, _name)) =                     \
+    {                                                                                   \
+        .p_name  = STRINGIFY(_name),                                                    \
+        .p_stats = &CONCAT_2(m_profiler_stats_, _name)                                  \
+    }
+
+/**@brief Macro for starting a timed region.
+ *
+ * @details Declares a variable, so it must be placed where a declaration is allowed.
+ *
+ * @param _name Name of the probe.
+ * @hideinitializer
+ */
+#define NRF_PROFILER_BEGIN(_name) \
+    uint32_t const CONCAT_2(_name, _profiler_start) = DWT->CYCCNT
+
+/**@brief Macro for ending a timed region.
+ *
+ * @details Must be in the scope of the matching @ref NRF_PROFILER_BEGIN.
+ *
+ * @param _name Name of the probe.
+ * @hideinitializer
+ */
+#define NRF_PROFILER_END(_name)                                                     \
+    nrf_profiler_record(&CONCAT_2(m_profiler_probe_, _name),                        \
+                        DWT->CYCCNT - CONCAT_2(_name, _profiler_start))
+#else
+#define NRF_PROFILER_PROBE_DEF(_name)
+#define NRF_PROFILER_BEGIN(_name)
+#define NRF_PROFILER_END(_name)
+#endif
+
+/**@brief Function for initializing the profiler.
+ *
+ * @details Enables the DWT cycle counter and clears the statistics of all probes.
+ */
+void nrf_profiler_init(void);
+
+/**@brief Function for adding a run time to the statistics of a probe.
+ *
+ * @details Called by @ref NRF_PROFILER_END. Can be called from any interrupt priority.
+ *
+ * @param[in] p_probe Probe.
+ * @param[in] cycles  Run time, in CPU cycles.
+ */
+void nrf_profiler_record(nrf_profiler_probe_t const * p_probe, uint32_t cycles);
+
+/**@brief Function for getting the number of probes.
+ *
+ * @return Number of probes registered.
+ */
+uint32_t nrf_profiler_probe_count(void);
+
+/**@brief Function for getting the statistics of a probe.
+ *
+ * @details The statistics are copied atomically, so they are consistent even if the region runs
+ *          meanwhile.
+ *
+ * @param[in]  idx      Index of the probe, less than @ref nrf_profiler_probe_count.
+ * @param[out] p_stats  Statistics of the probe.
+ *
+ * @return Name of the probe, or NULL if @p idx is out of range.
+ */
+char const * nrf_profiler_stats_get(uint32_t idx, nrf_profiler_stats_t * p_stats);
+
+/**@brief Function for logging the statistics of all probes that have run.
+ */
+void nrf_profiler_log(void);
+
+/**@brief Function for clearing the statistics of all probes.
+ */
+void nrf_profiler_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_PROFILER_H__
+
+/** @} */
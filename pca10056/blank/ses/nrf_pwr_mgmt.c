@@ -71,6 +71,14 @@ NRF_LOG_MODULE_REGISTER();
         #error "APP_SCHEDULER is required."
     #endif
     #include "app_scheduler.h"
+    #if NRF_MODULE_ENABLED(APP_SCHED_PRIO)
+        #include "app_sched_prio.h"
+        #define PWR_MGMT_SCHED_EVENT_PUT(_handler)                  \
+            app_sched_prio_event_put(NULL, 0, (_handler),           \
+                (app_sched_prio_level_t)APP_SCHED_PRIO_PWR_MGMT_LEVEL)
+    #else
+        #define PWR_MGMT_SCHED_EVENT_PUT(_handler) app_sched_event_put(NULL, 0, (_handler))
+    #endif
 #endif // NRF_PWR_MGMT_CONFIG_USE_SCHEDULER
 
 
@@ -215,6 +223,172 @@ static nrf_section_iter_t   m_handlers_iter;    /**< Shutdown handlers iterator.
 #endif // NRF_PWR_MGMT_CONFIG_CPU_USAGE_MONITOR_ENABLED
 
 
+#if NRF_PWR_MGMT_CONFIG_STATS_ENABLED
+    #undef  PWR_MGMT_SLEEP_IN_CRITICAL_SECTION_REQUIRED
+    #define PWR_MGMT_SLEEP_IN_CRITICAL_SECTION_REQUIRED
+
+    #undef  PWR_MGMT_TIMER_REQUIRED
+    #define PWR_MGMT_TIMER_REQUIRED
+    #include "app_timer.h"
+    #include "nrf_pwr_mgmt_stats.h"
+
+    #define PWR_MGMT_STATS_INIT()            pwr_mgmt_stats_init()
+    #define PWR_MGMT_STATS_UPDATE()          pwr_mgmt_stats_update()
+    #define PWR_MGMT_STATS_PREPARE()         pwr_mgmt_stats_irq_snapshot()
+    #define PWR_MGMT_STATS_SECTION_ENTER()              \
+        {                                               \
+            uint32_t stats_sleep_start = app_timer_cnt_get()
+
+    #define PWR_MGMT_STATS_SECTION_EXIT()               \
+            pwr_mgmt_stats_wakeup(stats_sleep_start);   \
+        }
+
+    static nrf_pwr_mgmt_stats_t m_stats;            /**< Sleep and wakeup statistics. */
+    static uint32_t             m_stats_ticks_last; /**< Ticks at the last elapsed time update. */
+    static uint32_t             m_stats_wakeup_last; /**< Number of wakeups at the last timer tick. */
+    static uint32_t             m_stats_wake_cyc;   /**< Cycle counter at the last wakeup. */
+    static volatile bool        m_stats_wake_open;  /**< True until the first handler after wakeup. */
+    static uint32_t             m_stats_irq_enabled[(NRF_PWR_MGMT_STATS_IRQ_COUNT + 31) / 32]; /**< Interrupts enabled before the sleep lock was taken. */
+
+    /**@brief Add the ticks since the last update to the elapsed time.
+     *
+     * Called at least once per second, so the RTC counter cannot wrap in between.
+     */
+    __STATIC_INLINE void pwr_mgmt_stats_elapsed_update(void)
+    {
+        uint32_t ticks = app_timer_cnt_get();
+
+        m_stats.elapsed_ticks += app_timer_cnt_diff_compute(ticks, m_stats_ticks_last);
+        m_stats_ticks_last     = ticks;
+    }
+
+    __STATIC_INLINE void pwr_mgmt_stats_init(void)
+    {
+        // Cycle counter for the wakeup latency.
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+        nrf_pwr_mgmt_stats_reset();
+    }
+
+    __STATIC_INLINE void pwr_mgmt_stats_update(void)
+    {
+        CRITICAL_REGION_ENTER();
+        pwr_mgmt_stats_elapsed_update();
+        m_stats.wakeups_per_second = m_stats.wakeup_cnt - m_stats_wakeup_last;
+        m_stats_wakeup_last        = m_stats.wakeup_cnt;
+        CRITICAL_REGION_EXIT();
+    }
+
+    /**@brief Save the enabled interrupts before the sleep lock is taken.
+     *
+     * With the SoftDevice, the critical region clears the application interrupts in ISER, so
+     * ISER cannot be read back after wakeup.
+     */
+    __STATIC_INLINE void pwr_mgmt_stats_irq_snapshot(void)
+    {
+        for (uint32_t i = 0; i < ARRAY_SIZE(m_stats_irq_enabled); i++)
+        {
+            m_stats_irq_enabled[i] = NVIC->ISER[i];
+        }
+    }
+
+    /**@brief Record a wakeup. Called with interrupts masked, right after the CPU wakes up.
+     *
+     * @param[in] sleep_start Ticks at the start of the sleep.
+     */
+    static void pwr_mgmt_stats_wakeup(uint32_t sleep_start)
+    {
+        uint32_t sleep_duration = app_timer_cnt_diff_compute(app_timer_cnt_get(), sleep_start);
+        uint32_t bin;
+        uint32_t i;
+
+        m_stats_wake_cyc  = DWT->CYCCNT;
+        m_stats_wake_open = true;
+
+        // Bins grow by a factor of 4: bin n holds durations below 4^(n+1) ticks.
+        bin = (31 - __CLZ(sleep_duration | 1)) / 2;
+        m_stats.sleep_cnt[MIN(bin, NRF_PWR_MGMT_STATS_RESIDENCY_BINS - 1)]++;
+        m_stats.sleep_ticks += sleep_duration;
+        m_stats.wakeup_cnt++;
+
+        // The interrupt that ended the sleep stays pending until the critical region is left.
+        for (i = 0; i < NRF_PWR_MGMT_STATS_IRQ_COUNT; i += 32)
+        {
+            uint32_t pending = NVIC->ISPR[i / 32] & m_stats_irq_enabled[i / 32];
+            if (NRF_PWR_MGMT_STATS_IRQ_COUNT - i < 32)
+            {
+                pending &= (1UL << (NRF_PWR_MGMT_STATS_IRQ_COUNT - i)) - 1;
+            }
+            if (pending != 0)
+            {
+                m_stats.wakeup_irq_cnt[i + __CLZ(__RBIT(pending))]++;
+                break;
+            }
+        }
+        if (i >= NRF_PWR_MGMT_STATS_IRQ_COUNT)
+        {
+            m_stats.wakeup_unknown_cnt++;
+        }
+    }
+
+    void nrf_pwr_mgmt_stats_handler_enter(void)
+    {
+        if (m_stats_wake_open)
+        {
+            uint32_t latency = DWT->CYCCNT - m_stats_wake_cyc;
+
+            m_stats_wake_open         = false;
+            m_stats.wake_latency_last = latency;
+            if (m_stats.wake_latency_max < latency)
+            {
+                m_stats.wake_latency_max = latency;
+            }
+        }
+    }
+
+    void nrf_pwr_mgmt_stats_get(nrf_pwr_mgmt_stats_t * p_stats)
+    {
+        ASSERT(p_stats != NULL);
+
+        CRITICAL_REGION_ENTER();
+        pwr_mgmt_stats_elapsed_update();
+        *p_stats = m_stats;
+        CRITICAL_REGION_EXIT();
+    }
+
+    void nrf_pwr_mgmt_stats_reset(void)
+    {
+        CRITICAL_REGION_ENTER();
+        memset(&m_stats, 0, sizeof(m_stats));
+        m_stats_ticks_last  = app_timer_cnt_get();
+        m_stats_wakeup_last = 0;
+        m_stats_wake_open   = false;
+        CRITICAL_REGION_EXIT();
+    }
+
+#else
+    #define PWR_MGMT_STATS_INIT()
+    #define PWR_MGMT_STATS_UPDATE()
+    #define PWR_MGMT_STATS_PREPARE()
+    #define PWR_MGMT_STATS_SECTION_ENTER()
+    #define PWR_MGMT_STATS_SECTION_EXIT()
+#endif // NRF_PWR_MGMT_CONFIG_STATS_ENABLED
+
+
+#if NRF_MODULE_ENABLED(NRF_ENERGY)
+    #undef  PWR_MGMT_SLEEP_IN_CRITICAL_SECTION_REQUIRED
+    #define PWR_MGMT_SLEEP_IN_CRITICAL_SECTION_REQUIRED
+    #include "nrf_energy.h"
+
+    #define PWR_MGMT_ENERGY_SECTION_ENTER() nrf_energy_phase_set(NRF_ENERGY_PHASE_CPU, false)
+    #define PWR_MGMT_ENERGY_SECTION_EXIT()  nrf_energy_phase_set(NRF_ENERGY_PHASE_CPU, true)
+#else
+    #define PWR_MGMT_ENERGY_SECTION_ENTER()
+    #define PWR_MGMT_ENERGY_SECTION_EXIT()
+#endif // NRF_MODULE_ENABLED(NRF_ENERGY)
+
+
 #if NRF_PWR_MGMT_CONFIG_STANDBY_TIMEOUT_ENABLED
     #undef  PWR_MGMT_TIMER_REQUIRED
     #define PWR_MGMT_TIMER_REQUIRED
@@ -270,6 +444,14 @@ static nrf_section_iter_t   m_handlers_iter;    /**< Shutdown handlers iterator.
 #endif // NRF_PWR_MGMT_CONFIG_AUTO_SHUTDOWN_RETRY
 
 
+#if NRF_PWR_MGMT_CONFIG_TICKLESS_IDLE_ENABLED && NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED
+    // Peripherals are switched off and on with interrupts masked, so that no handler runs
+    // between the sleep plan being applied and the peripherals being resumed.
+    #undef  PWR_MGMT_SLEEP_IN_CRITICAL_SECTION_REQUIRED
+    #define PWR_MGMT_SLEEP_IN_CRITICAL_SECTION_REQUIRED
+#endif
+
+
 #ifdef PWR_MGMT_SLEEP_IN_CRITICAL_SECTION_REQUIRED
     #define PWR_MGMT_SLEEP_INIT()           pwr_mgmt_sleep_init()
     #define PWR_MGMT_SLEEP_LOCK_ACQUIRE()   CRITICAL_REGION_ENTER()
@@ -290,6 +472,206 @@ static nrf_section_iter_t   m_handlers_iter;    /**< Shutdown handlers iterator.
 #endif // PWR_MGMT_SLEEP_IN_CRITICAL_SECTION_REQUIRED
 
 
+#if NRF_PWR_MGMT_CONFIG_TICKLESS_IDLE_ENABLED
+    #include "nrf_pwr_mgmt_tickless.h"
+    #include "app_timer.h"
+    #include "app_timer_deadline.h"
+    #include "nrf_drv_clock.h"
+
+    #define PWR_MGMT_TICKLESS_IDLE_PREPARE() pwr_mgmt_tickless_idle_prepare()
+
+    #define PWR_MGMT_LONG_IDLE_TICKS APP_TIMER_TICKS(NRF_PWR_MGMT_CONFIG_TICKLESS_LONG_IDLE_MS)
+
+    static bool     m_hfclk_held;       /**< True if HFCLK is requested by this module over sleep. */
+    static uint32_t m_idle_predicted;   /**< Ticks to the next timer expiry, before the last sleep. */
+
+    /**@brief Request or release HFCLK for the time of the sleep. */
+    __STATIC_INLINE void pwr_mgmt_hfclk_hold_set(bool hold)
+    {
+        if (!hold && m_hfclk_held)
+        {
+            nrf_drv_clock_hfclk_release();
+            m_hfclk_held = false;
+        }
+        else if (hold && !m_hfclk_held)
+        {
+            nrf_drv_clock_hfclk_request(NULL);
+            m_hfclk_held = true;
+        }
+    }
+
+#if NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED
+    #include "nrf_pwr_mgmt_policy.h"
+    #include "nrf_atomic.h"
+
+    #define PWR_MGMT_SLEEP_POLICY_APPLY()   pwr_mgmt_policy_apply()
+    #define PWR_MGMT_TICKLESS_IDLE_RESUME() pwr_mgmt_policy_resume()
+
+    static nrf_pwr_mgmt_policy_t       m_policy = nrf_pwr_mgmt_policy_default; /**< Sleep policy. */
+    static nrf_atomic_u32_t            m_periph_required;  /**< Peripherals required during sleep. */
+    static nrf_pwr_mgmt_periph_power_t m_periph_power[NRF_PWR_MGMT_PERIPH_COUNT]; /**< Power handlers. */
+    static uint32_t                    m_periph_suspended; /**< Peripherals switched off for the current sleep. */
+    static bool                        m_constlat;         /**< True if constant latency sub-mode is set. */
+    static bool                        m_long_idle;        /**< True if the coming sleep is a long idle period. */
+
+    void nrf_pwr_mgmt_policy_default(nrf_pwr_mgmt_policy_input_t const * p_input,
+                                     nrf_pwr_mgmt_sleep_plan_t         * p_plan)
+    {
+        p_plan->hfclk_hold = (p_input->required & NRF_PWR_MGMT_PERIPH_MASK(NRF_PWR_MGMT_PERIPH_HFCLK))
+                             || (!p_input->long_idle && p_input->hfclk_running);
+        p_plan->suspend    = p_input->long_idle ? (p_input->registered & ~p_input->required) : 0;
+        p_plan->constlat   = (p_input->required & NRF_PWR_MGMT_PERIPH_MASK(NRF_PWR_MGMT_PERIPH_SAADC))
+                             != 0;
+    }
+
+    void nrf_pwr_mgmt_policy_set(nrf_pwr_mgmt_policy_t policy)
+    {
+        m_policy = (policy != NULL) ? policy : nrf_pwr_mgmt_policy_default;
+    }
+
+    void nrf_pwr_mgmt_periph_require(nrf_pwr_mgmt_periph_t periph, bool required)
+    {
+        ASSERT(periph < NRF_PWR_MGMT_PERIPH_COUNT);
+
+        if (required)
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_u32_or(&m_periph_required,
+                                                  NRF_PWR_MGMT_PERIPH_MASK(periph)));
+        }
+        else
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_u32_and(&m_periph_required,
+                                                   ~NRF_PWR_MGMT_PERIPH_MASK(periph)));
+        }
+    }
+
+    void nrf_pwr_mgmt_periph_power_handler_set(nrf_pwr_mgmt_periph_t       periph,
+                                               nrf_pwr_mgmt_periph_power_t handler)
+    {
+        ASSERT(periph < NRF_PWR_MGMT_PERIPH_COUNT);
+        ASSERT(periph != NRF_PWR_MGMT_PERIPH_HFCLK);
+
+        m_periph_power[periph] = handler;
+    }
+
+    /**@brief Select the constant latency or low power sub-mode. */
+    static void pwr_mgmt_submode_set(bool constlat)
+    {
+        if (constlat == m_constlat)
+        {
+            return;
+        }
+        m_constlat = constlat;
+
+    #ifdef SOFTDEVICE_PRESENT
+        if (nrf_sdh_is_enabled())
+        {
+            ret_code_t ret_code = sd_power_mode_set(constlat ? NRF_POWER_MODE_CONSTLAT :
+                                                               NRF_POWER_MODE_LOWPWR);
+            ASSERT(ret_code == NRF_SUCCESS);
+            UNUSED_VARIABLE(ret_code);
+            return;
+        }
+    #endif // SOFTDEVICE_PRESENT
+        nrf_power_task_trigger(constlat ? NRF_POWER_TASK_CONSTLAT : NRF_POWER_TASK_LOWPWR);
+    }
+
+    /**@brief Get a sleep plan from the policy and apply it.
+     *
+     * @note Called with the sleep lock held.
+     */
+    static void pwr_mgmt_policy_apply(void)
+    {
+        nrf_pwr_mgmt_policy_input_t input;
+        nrf_pwr_mgmt_sleep_plan_t   plan;
+        uint32_t                    i;
+
+        input.idle_ticks    = m_idle_predicted;
+        input.long_idle     = m_long_idle;
+        input.hfclk_running = nrf_drv_clock_hfclk_is_running();
+        input.required      = m_periph_required;
+        input.registered    = 0;
+        for (i = 0; i < NRF_PWR_MGMT_PERIPH_COUNT; i++)
+        {
+            if (m_periph_power[i] != NULL)
+            {
+                input.registered |= NRF_PWR_MGMT_PERIPH_MASK(i);
+            }
+        }
+
+        m_policy(&input, &plan);
+
+        pwr_mgmt_hfclk_hold_set(plan.hfclk_hold);
+        pwr_mgmt_submode_set(plan.constlat);
+
+        m_periph_suspended = plan.suspend & input.registered;
+        for (i = 0; i < NRF_PWR_MGMT_PERIPH_COUNT; i++)
+        {
+            if (m_periph_suspended & NRF_PWR_MGMT_PERIPH_MASK(i))
+            {
+                m_periph_power[i](false);
+            }
+        }
+    }
+
+    /**@brief Switch on the peripherals suspended for the sleep.
+     *
+     * @note Called with the sleep lock held, before the handler of the wakeup interrupt runs.
+     */
+    __STATIC_INLINE void pwr_mgmt_policy_resume(void)
+    {
+        for (uint32_t i = 0; m_periph_suspended != 0; i++)
+        {
+            if (m_periph_suspended & NRF_PWR_MGMT_PERIPH_MASK(i))
+            {
+                m_periph_suspended &= ~NRF_PWR_MGMT_PERIPH_MASK(i);
+                m_periph_power[i](true);
+            }
+        }
+    }
+#else
+    #define PWR_MGMT_SLEEP_POLICY_APPLY()
+    #define PWR_MGMT_TICKLESS_IDLE_RESUME()
+#endif // NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED
+
+    /**@brief Decide on HFCLK and peripherals from the time to the next timer expiry.
+     *
+     * If the next expiry is close and HFCLK is running, it is kept requested so that it does
+     * not have to start again on wakeup. Before a long idle period the request is released.
+     * With the sleep policy enabled, the decision is taken by the policy later, inside
+     * the sleep lock.
+     */
+    __STATIC_INLINE void pwr_mgmt_tickless_idle_prepare(void)
+    {
+        m_idle_predicted = app_timer_next_deadline_get();
+        bool long_idle   = (m_idle_predicted >= PWR_MGMT_LONG_IDLE_TICKS);
+
+    #if NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED
+        m_long_idle = long_idle;
+    #else
+        pwr_mgmt_hfclk_hold_set(!long_idle && (m_hfclk_held || nrf_drv_clock_hfclk_is_running()));
+    #endif
+
+        nrf_pwr_mgmt_idle_prepare(m_idle_predicted, long_idle);
+    }
+
+    __WEAK void nrf_pwr_mgmt_idle_prepare(uint32_t idle_ticks, bool long_idle)
+    {
+        UNUSED_PARAMETER(idle_ticks);
+        UNUSED_PARAMETER(long_idle);
+    }
+
+    uint32_t nrf_pwr_mgmt_idle_predicted_get(void)
+    {
+        return m_idle_predicted;
+    }
+#else
+    #define PWR_MGMT_TICKLESS_IDLE_PREPARE()
+    #define PWR_MGMT_SLEEP_POLICY_APPLY()
+    #define PWR_MGMT_TICKLESS_IDLE_RESUME()
+#endif // NRF_PWR_MGMT_CONFIG_TICKLESS_IDLE_ENABLED
+
+
 #ifdef PWR_MGMT_TIMER_REQUIRED
     #include "app_timer.h"
     #define PWR_MGMT_TIMER_CREATE()     pwr_mgmt_timer_create()
@@ -301,6 +683,7 @@ static nrf_section_iter_t   m_handlers_iter;    /**< Shutdown handlers iterator.
     static void nrf_pwr_mgmt_timeout_handler(void * p_context)
     {
         PWR_MGMT_CPU_USAGE_MONITOR_UPDATE();
+        PWR_MGMT_STATS_UPDATE();
         PWR_MGMT_AUTO_SHUTDOWN_RETRY();
         PWR_MGMT_STANDBY_TIMEOUT_CHECK();
     }
@@ -333,15 +716,21 @@ ret_code_t nrf_pwr_mgmt_init(void)
     PWR_MGMT_DEBUG_PINS_INIT();
     PWR_MGMT_STANDBY_TIMEOUT_INIT();
     PWR_MGMT_CPU_USAGE_MONITOR_INIT();
+    PWR_MGMT_STATS_INIT();
 
     return PWR_MGMT_TIMER_CREATE();
 }
 
 void nrf_pwr_mgmt_run(void)
 {
+    PWR_MGMT_TICKLESS_IDLE_PREPARE();
     PWR_MGMT_FPU_SLEEP_PREPARE();
+    PWR_MGMT_STATS_PREPARE();
     PWR_MGMT_SLEEP_LOCK_ACQUIRE();
+    PWR_MGMT_SLEEP_POLICY_APPLY();
     PWR_MGMT_CPU_USAGE_MONITOR_SECTION_ENTER();
+    PWR_MGMT_STATS_SECTION_ENTER();
+    PWR_MGMT_ENERGY_SECTION_ENTER();
     PWR_MGMT_DEBUG_PIN_SET();
 
     // Wait for an event.
@@ -363,7 +752,10 @@ void nrf_pwr_mgmt_run(void)
     }
 
     PWR_MGMT_DEBUG_PIN_CLEAR();
+    PWR_MGMT_ENERGY_SECTION_EXIT();
+    PWR_MGMT_STATS_SECTION_EXIT();
     PWR_MGMT_CPU_USAGE_MONITOR_SECTION_EXIT();
+    PWR_MGMT_TICKLESS_IDLE_RESUME();
     PWR_MGMT_SLEEP_LOCK_RELEASE();
 }
 
@@ -470,7 +862,7 @@ void nrf_pwr_mgmt_shutdown(nrf_pwr_mgmt_shutdown_t shutdown_type)
     NRF_LOG_INFO("Shutdown request %d", shutdown_type);
 
 #if NRF_PWR_MGMT_CONFIG_USE_SCHEDULER
-    ret_code_t ret_code = app_sched_event_put(NULL, 0, scheduler_shutdown_handler);
+    ret_code_t ret_code = PWR_MGMT_SCHED_EVENT_PUT(scheduler_shutdown_handler);
     APP_ERROR_CHECK(ret_code);
 #else
     shutdown_process();
@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_pwr_mgmt_policy Sleep policy
+ * @{
+ * @ingroup nrf_pwr_mgmt_tickless
+ *
+ * @brief Pluggable decisions on peripheral power and sleep sub-mode before each sleep.
+ *
+ * @details With NRF_PWR_MGMT_CONFIG_SLEEP_POLICY_ENABLED, @ref nrf_pwr_mgmt_run asks a policy
+ *          for a sleep plan before each sleep. The policy gets the time to the next app_timer
+ *          expiry and the peripherals that have been marked as required with
+ *          @ref nrf_pwr_mgmt_periph_require. The plan is applied as follows:
+ *          - Peripherals in the suspend mask are switched off through the power handlers set
+ *            with @ref nrf_pwr_mgmt_periph_power_handler_set and switched on again right after
+ *            wakeup. The sleep is run in a critical region while the policy is enabled, so
+ *            the handler of the wakeup interrupt runs only after the peripherals are back on.
+ *          - HFCLK is kept requested through nrf_drv_clock or released, so that HFXO can stop.
+ *          - The constant latency or low power sub-mode is selected, through the SoftDevice if
+ *            it is enabled.
+ *
+ *          @ref nrf_pwr_mgmt_policy_default is used unless another policy is set.
+ *
+ *          @ref app_saadc and the UARTE log backend set the SAADC and UARTE power handlers
+ *          when they are initialized, and mark their peripheral as required while an
+ *          acquisition runs or a transfer is ongoing. Other users of these peripherals must
+ *          keep them required while they use them.
+ */
+
+#ifndef NRF_PWR_MGMT_POLICY_H__
+#define NRF_PWR_MGMT_POLICY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Peripherals known to the sleep policy. */
+typedef enum
+{
+    NRF_PWR_MGMT_PERIPH_SAADC,  ///< SAADC.
+    NRF_PWR_MGMT_PERIPH_UARTE,  ///< UARTE.
+    NRF_PWR_MGMT_PERIPH_HFCLK,  ///< High frequency clock.
+    NRF_PWR_MGMT_PERIPH_COUNT   ///< Number of peripherals.
+} nrf_pwr_mgmt_periph_t;
+
+/**@brief Bit of a peripheral in the masks of @ref nrf_pwr_mgmt_policy_input_t and
+ *        @ref nrf_pwr_mgmt_sleep_plan_t. */
+#define NRF_PWR_MGMT_PERIPH_MASK(periph) (1UL << (periph))
+
+/**@brief Peripheral power handler.
+ *
+ * @param[in] on False to switch the peripheral off before sleep, true to switch it on after.
+ *
+ * @note Called with interrupts masked. The handler must not wait for a peripheral event.
+ */
+typedef void (* nrf_pwr_mgmt_periph_power_t)(bool on);
+
+/**@brief Input of the sleep policy. */
+typedef struct
+{
+    uint32_t idle_ticks;    ///< Number of ticks to the next timer expiry, or APP_TIMER_NO_DEADLINE.
+    bool     long_idle;     ///< True if the idle time is at least NRF_PWR_MGMT_CONFIG_TICKLESS_LONG_IDLE_MS.
+    bool     hfclk_running; ///< True if HFCLK is running.
+    uint32_t required;      ///< Peripherals required during sleep.
+    uint32_t registered;    ///< Peripherals with a power handler.
+} nrf_pwr_mgmt_policy_input_t;
+
+/**@brief Sleep plan returned by the policy. */
+typedef struct
+{
+    uint32_t suspend;       ///< Peripherals to switch off for the sleep. Only registered ones are used.
+    bool     hfclk_hold;    ///< True to keep HFCLK requested over the sleep.
+    bool     constlat;      ///< True for the constant latency sub-mode, false for low power.
+} nrf_pwr_mgmt_sleep_plan_t;
+
+/**@brief Sleep policy.
+ *
+ * @param[in]  p_input Idle time and peripheral state.
+ * @param[out] p_plan  Plan for the sleep.
+ */
+typedef void (* nrf_pwr_mgmt_policy_t)(nrf_pwr_mgmt_policy_input_t const * p_input,
+                                       nrf_pwr_mgmt_sleep_plan_t         * p_plan);
+
+/**@brief Default sleep policy.
+ *
+ * @details HFCLK is kept over short idle periods if it is running and always if it is required.
+ *          Registered peripherals that are not required are suspended over long idle periods.
+ *          The constant latency sub-mode is used while the SAADC is required, so that sampling
+ *          is not delayed by regulator start-up.
+ */
+void nrf_pwr_mgmt_policy_default(nrf_pwr_mgmt_policy_input_t const * p_input,
+                                 nrf_pwr_mgmt_sleep_plan_t         * p_plan);
+
+/**@brief Function for setting the sleep policy.
+ *
+ * @param[in] policy Policy, or NULL for @ref nrf_pwr_mgmt_policy_default.
+ */
+void nrf_pwr_mgmt_policy_set(nrf_pwr_mgmt_policy_t policy);
+
+/**@brief Function for marking a peripheral as required or not required during sleep.
+ *
+ * Can be called from any context.
+ *
+ * @param[in] periph   Peripheral.
+ * @param[in] required True if the peripheral must stay on during sleep.
+ */
+void nrf_pwr_mgmt_periph_require(nrf_pwr_mgmt_periph_t periph, bool required);
+
+/**@brief Function for setting the power handler of a peripheral.
+ *
+ * @param[in] periph  Peripheral. HFCLK is controlled by the module and cannot have a handler.
+ * @param[in] handler Handler, or NULL to never suspend the peripheral.
+ */
+void nrf_pwr_mgmt_periph_power_handler_set(nrf_pwr_mgmt_periph_t       periph,
+                                           nrf_pwr_mgmt_periph_power_t handler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_PWR_MGMT_POLICY_H__
+
+/** @} */
@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_pwr_mgmt_stats Sleep and wakeup statistics
+ * @{
+ * @ingroup nrf_pwr_mgmt
+ *
+ * @brief Instrumentation of @ref nrf_pwr_mgmt_run.
+ *
+ * @details With NRF_PWR_MGMT_CONFIG_STATS_ENABLED, each sleep is measured with app_timer ticks
+ *          and counted in a duration histogram. Sleep is entered in a critical region, so the
+ *          interrupt that ended it is still pending when the CPU wakes up. The lowest numbered
+ *          pending interrupt among those enabled before the critical region was entered is
+ *          recorded as the wakeup cause. The number of wakeups in the last full second is
+ *          updated by the module timer.
+ *
+ *          The time from wakeup to the first handler is measured in CPU cycles with the DWT
+ *          cycle counter. It is recorded by handlers that call @ref nrf_pwr_mgmt_stats_handler_enter
+ *          at their start.
+ */
+
+#ifndef NRF_PWR_MGMT_STATS_H__
+#define NRF_PWR_MGMT_STATS_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_PWR_MGMT_STATS_RESIDENCY_BINS   8   ///< Number of sleep duration bins.
+#define NRF_PWR_MGMT_STATS_IRQ_COUNT        48  ///< Number of interrupts tracked as wakeup causes.
+
+/**@brief Sleep and wakeup statistics. */
+typedef struct
+{
+    uint32_t sleep_cnt[NRF_PWR_MGMT_STATS_RESIDENCY_BINS];  ///< Number of sleeps per duration bin. Bin n counts sleeps shorter than 4^(n+1) ticks, the last bin counts all longer sleeps.
+    uint32_t sleep_ticks;                                   ///< Total number of ticks spent sleeping.
+    uint32_t elapsed_ticks;                                 ///< Number of ticks since the statistics were reset.
+    uint32_t wakeup_cnt;                                    ///< Total number of wakeups.
+    uint32_t wakeups_per_second;                            ///< Number of wakeups in the last full second.
+    uint32_t wakeup_irq_cnt[NRF_PWR_MGMT_STATS_IRQ_COUNT];  ///< Number of wakeups per interrupt number.
+    uint32_t wakeup_unknown_cnt;                            ///< Number of wakeups without a pending interrupt.
+    uint32_t wake_latency_last;                             ///< CPU cycles from the last measured wakeup to the first handler.
+    uint32_t wake_latency_max;                              ///< Maximum number of CPU cycles from wakeup to the first handler.
+} nrf_pwr_mgmt_stats_t;
+
+/**
+ * @brief Function for reading the statistics.
+ *
+ * @param[out] p_stats Statistics.
+ */
+void nrf_pwr_mgmt_stats_get(nrf_pwr_mgmt_stats_t * p_stats);
+
+/**
+ * @brief Function for clearing the statistics.
+ */
+void nrf_pwr_mgmt_stats_reset(void);
+
+/**
+ * @brief Function for marking the start of an interrupt handler.
+ *
+ * @details If called by the first handler after a wakeup, the time from the wakeup is recorded.
+ *          Later calls before the next sleep are ignored.
+ */
+void nrf_pwr_mgmt_stats_handler_enter(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_PWR_MGMT_STATS_H__
+
+/** @} */
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_pwr_mgmt_tickless Tickless idle
+ * @{
+ * @ingroup nrf_pwr_mgmt
+ *
+ * @brief Sleep decisions of @ref nrf_pwr_mgmt_run based on the next app_timer expiry.
+ *
+ * @details Before each sleep, the time to the next app_timer expiry is read. If it is shorter
+ *          than NRF_PWR_MGMT_CONFIG_TICKLESS_LONG_IDLE_MS and HFCLK is running, HFCLK is kept
+ *          requested through nrf_drv_clock so that it does not restart on wakeup. Before a
+ *          longer idle period that request is released, so HFXO stops unless another user
+ *          requests it. The clock driver must be initialized.
+ */
+
+#ifndef NRF_PWR_MGMT_TICKLESS_H__
+#define NRF_PWR_MGMT_TICKLESS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function called before each sleep, with the predicted idle time.
+ *
+ * @details Weak, empty by default. The application can override it to switch off peripherals
+ *          before a long idle period. Called from the context of @ref nrf_pwr_mgmt_run.
+ *
+ * @param[in] idle_ticks Number of RTC ticks until the next timer expiry, or
+ *                       APP_TIMER_NO_DEADLINE if no timer is running.
+ * @param[in] long_idle  True if the idle time is at least NRF_PWR_MGMT_CONFIG_TICKLESS_LONG_IDLE_MS.
+ */
+void nrf_pwr_mgmt_idle_prepare(uint32_t idle_ticks, bool long_idle);
+
+/**@brief Function for getting the idle time predicted before the last sleep.
+ *
+ * @return Number of RTC ticks, or APP_TIMER_NO_DEADLINE if no timer was running.
+ */
+uint32_t nrf_pwr_mgmt_idle_predicted_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_PWR_MGMT_TICKLESS_H__
+
+/** @} */
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup nrf_ramfunc RAM-resident functions
+ * @{
+ * @ingroup app_common
+ * @brief    Macros for running functions from RAM.
+ *
+ * @details  A function marked with @ref NRF_RAMFUNC is linked into the .ramfunc section, which is
+ *           loaded to flash and copied to RAM by the startup code together with the other
+ *           nrf_sections (see flash_placement.xml). The function does not pay flash wait states.
+ *
+ * @note     Only the marked functions run from RAM. Functions that are not marked, constants
+ *           and the interrupt vector table stay in flash, and the CPU stalls on them while the
+ *           NVMC is busy. A RAM function keeps running during a flash erase or write only if it
+ *           does not touch flash, and neither does anything it calls or the interrupt entry that
+ *           leads to it. The RAMFUNC option of each module in sdk_config.h lists what the module
+ *           leaves in flash. Calls between flash and RAM go through veneers added by the linker.
+ */
+
+#ifndef NRF_RAMFUNC_H__
+#define NRF_RAMFUNC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Attribute for placing a function in RAM. */
+#if defined(__ICCARM__)
+#define NRF_RAMFUNC __ramfunc
+#else
+#define NRF_RAMFUNC __attribute__((section(".ramfunc")))
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_RAMFUNC_H__
+
+/** @} */
@@ -38,8 +38,10 @@
  *
  */
 #include "nrf_ringbuf.h"
+#include "nrf_ringbuf_span.h"
 #include "app_util_platform.h"
 #include "nrf_assert.h"
+#include "nrf_mem_telemetry.h"
 
 #define WR_OFFSET 0
 #define RD_OFFSET 1
@@ -69,6 +71,9 @@ ret_code_t nrf_ringbuf_alloc(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_dat
 
     if (p_ringbuf->p_cb->tmp_wr_idx - p_ringbuf->p_cb->rd_idx == p_ringbuf->bufsize_mask + 1)
     {
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+        nrf_mem_telemetry_failure_record(p_ringbuf);
+#endif
         *p_length = 0;
         if (start)
         {
@@ -121,6 +126,12 @@ ret_code_t nrf_ringbuf_cpy_put(nrf_ringbuf_t const * p_ringbuf,
 
     uint32_t available = p_ringbuf->bufsize_mask + 1 -
                                 (p_ringbuf->p_cb->wr_idx -  p_ringbuf->p_cb->rd_idx);
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+    if (available < *p_length)
+    {
+        nrf_mem_telemetry_failure_record(p_ringbuf);
+    }
+#endif
     *p_length = available > *p_length ? *p_length : available;
     size_t   length        = *p_length;
     uint32_t masked_wr_idx = (p_ringbuf->p_cb->wr_idx & p_ringbuf->bufsize_mask);
@@ -237,3 +248,140 @@ ret_code_t nrf_ringbuf_free(nrf_ringbuf_t const * p_ringbuf, size_t length)
 
     return NRF_SUCCESS;
 }
+
+/**
+ * @brief Function for splitting the data starting at the given index at the buffer wrap.
+ */
+static void ringbuf_span_set(nrf_ringbuf_t const * p_ringbuf,
+                             uint32_t              idx,
+                             size_t                length,
+                             nrf_ringbuf_span_t *  p_span)
+{
+    uint32_t masked_idx = idx & p_ringbuf->bufsize_mask;
+    uint32_t trail      = p_ringbuf->bufsize_mask + 1 - masked_idx;
+
+    p_span->p_data[0] = &p_ringbuf->p_buffer[masked_idx];
+    p_span->length[0] = length > trail ? trail : length;
+    p_span->length[1] = length - p_span->length[0];
+    p_span->p_data[1] = (p_span->length[1] != 0) ? p_ringbuf->p_buffer : NULL;
+}
+
+ret_code_t nrf_ringbuf_span_alloc(nrf_ringbuf_t const * p_ringbuf,
+                                  nrf_ringbuf_span_t *  p_span,
+                                  size_t *              p_length,
+                                  bool                  start)
+{
+    ASSERT(p_span);
+    ASSERT(p_length);
+
+    if (start)
+    {
+        if (nrf_atomic_flag_set_fetch(&p_ringbuf->p_cb->wr_flag))
+        {
+            return NRF_ERROR_BUSY;
+        }
+    }
+
+    uint32_t available = p_ringbuf->bufsize_mask + 1 -
+            (p_ringbuf->p_cb->tmp_wr_idx - p_ringbuf->p_cb->rd_idx);
+    if (available == 0)
+    {
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+        nrf_mem_telemetry_failure_record(p_ringbuf);
+#endif
+        *p_length = 0;
+        if (start)
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_ringbuf->p_cb->wr_flag));
+        }
+        return NRF_SUCCESS;
+    }
+
+    *p_length = *p_length < available ? *p_length : available;
+    ringbuf_span_set(p_ringbuf, p_ringbuf->p_cb->tmp_wr_idx, *p_length, p_span);
+    p_ringbuf->p_cb->tmp_wr_idx += *p_length;
+
+    return NRF_SUCCESS;
+}
+
+/**
+ * @brief Function for getting the data with the part after the wrap limited to @p max_wrapped.
+ */
+static ret_code_t ringbuf_span_get(nrf_ringbuf_t const * p_ringbuf,
+                                   nrf_ringbuf_span_t *  p_span,
+                                   size_t *              p_length,
+                                   size_t                max_wrapped,
+                                   bool                  start)
+{
+    ASSERT(p_span);
+    ASSERT(p_length);
+
+    if (start)
+    {
+        if (nrf_atomic_flag_set_fetch(&p_ringbuf->p_cb->rd_flag))
+        {
+            return NRF_ERROR_BUSY;
+        }
+    }
+
+    uint32_t available = p_ringbuf->p_cb->wr_idx - p_ringbuf->p_cb->tmp_rd_idx;
+    if (available == 0)
+    {
+        *p_length = 0;
+        if (start)
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_ringbuf->p_cb->rd_flag));
+        }
+        return NRF_SUCCESS;
+    }
+
+    uint32_t trail = p_ringbuf->bufsize_mask + 1 -
+                     (p_ringbuf->p_cb->tmp_rd_idx & p_ringbuf->bufsize_mask);
+    if (available > trail + max_wrapped)
+    {
+        available = trail + max_wrapped;
+    }
+    *p_length = *p_length < available ? *p_length : available;
+    ringbuf_span_set(p_ringbuf, p_ringbuf->p_cb->tmp_rd_idx, *p_length, p_span);
+    p_ringbuf->p_cb->tmp_rd_idx += *p_length;
+
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_ringbuf_span_get(nrf_ringbuf_t const * p_ringbuf,
+                                nrf_ringbuf_span_t *  p_span,
+                                size_t *              p_length,
+                                bool                  start)
+{
+    return ringbuf_span_get(p_ringbuf, p_span, p_length, p_ringbuf->bufsize_mask + 1, start);
+}
+
+ret_code_t nrf_ringbuf_mirrored_get(nrf_ringbuf_mirrored_t const * p_mirrored,
+                                    size_t                         max_wrapped,
+                                    uint8_t * *                    pp_data,
+                                    size_t *                       p_length,
+                                    bool                           start)
+{
+    ASSERT(p_mirrored);
+    ASSERT(pp_data);
+
+    if (max_wrapped > p_mirrored->mirror_size)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    nrf_ringbuf_t const * p_ringbuf = &p_mirrored->ringbuf;
+    nrf_ringbuf_span_t    span;
+    ret_code_t            ret = ringbuf_span_get(p_ringbuf, &span, p_length, max_wrapped, start);
+
+    if ((ret == NRF_SUCCESS) && (*p_length != 0))
+    {
+        if (span.length[1] != 0)
+        {
+            // The mirror area directly follows the end of the buffer.
+            memcpy(&p_ringbuf->p_buffer[p_ringbuf->bufsize_mask + 1], span.p_data[1], span.length[1]);
+        }
+        *pp_data = span.p_data[0];
+    }
+    return ret;
+}
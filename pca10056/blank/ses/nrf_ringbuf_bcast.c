@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "nrf_ringbuf_bcast.h"
+#include <string.h>
+#include "app_util_platform.h"
+#include "nrf_assert.h"
+
+void nrf_ringbuf_bcast_init(nrf_ringbuf_bcast_t const * p_ringbuf)
+{
+    p_ringbuf->p_cb->wr_idx     = 0;
+    p_ringbuf->p_cb->tmp_wr_idx = 0;
+    p_ringbuf->p_cb->wr_flag    = 0;
+    memset(p_ringbuf->p_readers, 0, p_ringbuf->reader_cnt * sizeof(p_ringbuf->p_readers[0]));
+}
+
+/**
+ * @brief Function for getting the free space, dropping data of the readers that allow it.
+ *
+ * @param[in] p_ringbuf Pointer to the instance.
+ * @param[in] needed    Space wanted by the producer.
+ *
+ * @return Free space, can be less than @p needed.
+ */
+static uint32_t bcast_space_reclaim(nrf_ringbuf_bcast_t const * p_ringbuf, uint32_t needed)
+{
+    nrf_ringbuf_bcast_cb_t * p_cb       = p_ringbuf->p_cb;
+    uint32_t                 size       = p_ringbuf->bufsize_mask + 1;
+    uint32_t                 block_used = 0;
+    uint32_t                 used;
+
+    // Space held by the readers that block the producer cannot be reclaimed, so dropping more
+    // than the rest of the buffer would lose data for nothing.
+    for (uint8_t i = 0; i < p_ringbuf->reader_cnt; i++)
+    {
+        if (p_ringbuf->p_overrun[i] == NRF_RINGBUF_BCAST_OVERRUN_BLOCK)
+        {
+            block_used = MAX(block_used, p_cb->tmp_wr_idx - p_ringbuf->p_readers[i].rd_idx);
+        }
+    }
+    needed = MIN(needed, size - block_used);
+    used   = block_used;
+
+    for (uint8_t i = 0; i < p_ringbuf->reader_cnt; i++)
+    {
+        if (p_ringbuf->p_overrun[i] != NRF_RINGBUF_BCAST_OVERRUN_DROP_OLDEST)
+        {
+            continue;
+        }
+
+        nrf_ringbuf_bcast_reader_cb_t * p_reader = &p_ringbuf->p_readers[i];
+        uint32_t                        backlog  = p_cb->tmp_wr_idx - p_reader->rd_idx;
+
+        if ((backlog > size - needed) && (nrf_atomic_flag_set_fetch(&p_reader->rd_flag) == 0))
+        {
+            // Only committed data can be dropped.
+            uint32_t drop = MIN(backlog - (size - needed), p_cb->wr_idx - p_reader->rd_idx);
+
+            p_reader->rd_idx    += drop;
+            p_reader->tmp_rd_idx = p_reader->rd_idx;
+            p_reader->dropped   += drop;
+            backlog             -= drop;
+            UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_reader->rd_flag));
+        }
+        used = MAX(used, backlog);
+    }
+    return size - used;
+}
+
+ret_code_t nrf_ringbuf_bcast_alloc(nrf_ringbuf_bcast_t const * p_ringbuf,
+                                   uint8_t * *                 pp_data,
+                                   size_t *                    p_length,
+                                   bool                        start)
+{
+    ASSERT(pp_data);
+    ASSERT(p_length);
+
+    if (start)
+    {
+        if (nrf_atomic_flag_set_fetch(&p_ringbuf->p_cb->wr_flag))
+        {
+            return NRF_ERROR_BUSY;
+        }
+    }
+
+    uint32_t masked_wr_idx = p_ringbuf->p_cb->tmp_wr_idx & p_ringbuf->bufsize_mask;
+    uint32_t trail         = p_ringbuf->bufsize_mask + 1 - masked_wr_idx;
+    uint32_t available     = bcast_space_reclaim(p_ringbuf, MIN(*p_length, trail));
+
+    if (available == 0)
+    {
+        *p_length = 0;
+        if (start)
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_ringbuf->p_cb->wr_flag));
+        }
+        return NRF_SUCCESS;
+    }
+
+    available = MIN(available, trail);
+    *p_length = *p_length < available ? *p_length : available;
+    *pp_data  = &p_ringbuf->p_buffer[masked_wr_idx];
+    p_ringbuf->p_cb->tmp_wr_idx += *p_length;
+
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_ringbuf_bcast_put(nrf_ringbuf_bcast_t const * p_ringbuf, size_t length)
+{
+    if (length > p_ringbuf->p_cb->tmp_wr_idx - p_ringbuf->p_cb->wr_idx)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    p_ringbuf->p_cb->wr_idx    += length;
+    p_ringbuf->p_cb->tmp_wr_idx = p_ringbuf->p_cb->wr_idx;
+    if (nrf_atomic_flag_clear_fetch(&p_ringbuf->p_cb->wr_flag) == 0)
+    {
+        /* Flag was already cleared. Suggests misuse. */
+        return NRF_ERROR_INVALID_STATE;
+    }
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_ringbuf_bcast_cpy_put(nrf_ringbuf_bcast_t const * p_ringbuf,
+                                     uint8_t const *             p_data,
+                                     size_t *                    p_length)
+{
+    ASSERT(p_data);
+    ASSERT(p_length);
+
+    if (nrf_atomic_flag_set_fetch(&p_ringbuf->p_cb->wr_flag))
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    uint32_t available = bcast_space_reclaim(p_ringbuf, *p_length);
+    *p_length = available > *p_length ? *p_length : available;
+    size_t   length        = *p_length;
+    uint32_t masked_wr_idx = (p_ringbuf->p_cb->wr_idx & p_ringbuf->bufsize_mask);
+    uint32_t trail         = p_ringbuf->bufsize_mask + 1 - masked_wr_idx;
+
+    if (length > trail)
+    {
+        memcpy(&p_ringbuf->p_buffer[masked_wr_idx], p_data, trail);
+        length -= trail;
+        masked_wr_idx = 0;
+        p_data += trail;
+    }
+    memcpy(&p_ringbuf->p_buffer[masked_wr_idx], p_data, length);
+    p_ringbuf->p_cb->wr_idx += *p_length;
+    p_ringbuf->p_cb->tmp_wr_idx = p_ringbuf->p_cb->wr_idx;
+
+    UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_ringbuf->p_cb->wr_flag));
+
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_ringbuf_bcast_get(nrf_ringbuf_bcast_t const * p_ringbuf,
+                                 uint8_t                     reader,
+                                 uint8_t * *                 pp_data,
+                                 size_t *                    p_length,
+                                 bool                        start)
+{
+    ASSERT(pp_data);
+    ASSERT(p_length);
+    ASSERT(reader < p_ringbuf->reader_cnt);
+
+    nrf_ringbuf_bcast_reader_cb_t * p_reader = &p_ringbuf->p_readers[reader];
+
+    if (start)
+    {
+        if (nrf_atomic_flag_set_fetch(&p_reader->rd_flag))
+        {
+            return NRF_ERROR_BUSY;
+        }
+    }
+
+    uint32_t available = p_ringbuf->p_cb->wr_idx - p_reader->tmp_rd_idx;
+    if (available == 0)
+    {
+        *p_length = 0;
+        if (start)
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_reader->rd_flag));
+        }
+        return NRF_SUCCESS;
+    }
+
+    uint32_t masked_tmp_rd_idx = p_reader->tmp_rd_idx & p_ringbuf->bufsize_mask;
+    uint32_t trail             = p_ringbuf->bufsize_mask + 1 - masked_tmp_rd_idx;
+
+    available = MIN(available, trail);
+    *p_length = *p_length < available ? *p_length : available;
+    *pp_data  = &p_ringbuf->p_buffer[masked_tmp_rd_idx];
+    p_reader->tmp_rd_idx += *p_length;
+
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_ringbuf_bcast_free(nrf_ringbuf_bcast_t const * p_ringbuf, uint8_t reader, size_t length)
+{
+    ASSERT(reader < p_ringbuf->reader_cnt);
+
+    nrf_ringbuf_bcast_reader_cb_t * p_reader = &p_ringbuf->p_readers[reader];
+
+    if (length > p_ringbuf->p_cb->wr_idx - p_reader->rd_idx)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    p_reader->rd_idx    += length;
+    p_reader->tmp_rd_idx = p_reader->rd_idx;
+    UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_reader->rd_flag));
+
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_ringbuf_bcast_cpy_get(nrf_ringbuf_bcast_t const * p_ringbuf,
+                                     uint8_t                     reader,
+                                     uint8_t *                   p_data,
+                                     size_t *                    p_length)
+{
+    ASSERT(p_data);
+    ASSERT(p_length);
+    ASSERT(reader < p_ringbuf->reader_cnt);
+
+    nrf_ringbuf_bcast_reader_cb_t * p_reader = &p_ringbuf->p_readers[reader];
+
+    if (nrf_atomic_flag_set_fetch(&p_reader->rd_flag))
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    uint32_t available = p_ringbuf->p_cb->wr_idx - p_reader->rd_idx;
+    *p_length = available > *p_length ? *p_length : available;
+    size_t   length        = *p_length;
+    uint32_t masked_rd_idx = (p_reader->rd_idx & p_ringbuf->bufsize_mask);
+    uint32_t trail         = p_ringbuf->bufsize_mask + 1 - masked_rd_idx;
+
+    if (length > trail)
+    {
+        memcpy(p_data, &p_ringbuf->p_buffer[masked_rd_idx], trail);
+        length -= trail;
+        masked_rd_idx = 0;
+        p_data += trail;
+    }
+    memcpy(p_data, &p_ringbuf->p_buffer[masked_rd_idx], length);
+    p_reader->rd_idx    += *p_length;
+    p_reader->tmp_rd_idx = p_reader->rd_idx;
+
+    UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_reader->rd_flag));
+
+    return NRF_SUCCESS;
+}
+
+uint32_t nrf_ringbuf_bcast_dropped_get(nrf_ringbuf_bcast_t const * p_ringbuf, uint8_t reader)
+{
+    ASSERT(reader < p_ringbuf->reader_cnt);
+    return p_ringbuf->p_readers[reader].dropped;
+}
@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ringbuf_bcast Broadcast ring buffer
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Ring buffer with one producer and several independent consumers of the same data.
+ *
+ * @details Each consumer (reader) has its own read index. Data is written once and space is
+ *          reclaimed when all readers have freed it. The overrun policy is set per reader when
+ *          the instance is defined:
+ *          - @ref NRF_RINGBUF_BCAST_OVERRUN_BLOCK: the reader holds back the producer, space it
+ *            did not free is not reused.
+ *          - @ref NRF_RINGBUF_BCAST_OVERRUN_DROP_OLDEST: when the producer needs space, the oldest
+ *            data of this reader is dropped. The other readers are not affected. Data is never
+ *            dropped while the reader is in the middle of a get.
+ *
+ *          The producer and reader functions follow the nrf_ringbuf semantics. Each reader is
+ *          protected by its own flag, so readers can run in different contexts.
+ */
+
+#ifndef NRF_RINGBUF_BCAST_H__
+#define NRF_RINGBUF_BCAST_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sdk_errors.h"
+#include "app_util.h"
+#include "nrf_atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Reader overrun policy. */
+typedef enum
+{
+    NRF_RINGBUF_BCAST_OVERRUN_BLOCK,       ///< Producer waits until the reader frees space.
+    NRF_RINGBUF_BCAST_OVERRUN_DROP_OLDEST, ///< Oldest data of the reader is dropped to make space.
+} nrf_ringbuf_bcast_overrun_t;
+
+/**@brief Reader control block. */
+typedef struct
+{
+    nrf_atomic_flag_t rd_flag;    ///< Reader busy flag, also taken by the producer when dropping data.
+    uint32_t          rd_idx;     ///< Read index.
+    uint32_t          tmp_rd_idx; ///< Read index including data got but not freed.
+    uint32_t          dropped;    ///< Number of bytes dropped for the reader.
+} nrf_ringbuf_bcast_reader_cb_t;
+
+/**@brief Producer control block. */
+typedef struct
+{
+    nrf_atomic_flag_t wr_flag;    ///< Producer busy flag.
+    uint32_t          wr_idx;     ///< Write index.
+    uint32_t          tmp_wr_idx; ///< Write index including allocated space.
+} nrf_ringbuf_bcast_cb_t;
+
+/**@brief Broadcast ring buffer instance. */
+typedef struct
+{
+    uint8_t                           * p_buffer;     ///< Pointer to the buffer.
+    uint32_t                            bufsize_mask; ///< Buffer size mask.
+    nrf_ringbuf_bcast_cb_t            * p_cb;         ///< Pointer to the producer control block.
+    nrf_ringbuf_bcast_reader_cb_t     * p_readers;    ///< Reader control blocks.
+    nrf_ringbuf_bcast_overrun_t const * p_overrun;    ///< Overrun policy of each reader.
+    uint8_t                             reader_cnt;   ///< Number of readers.
+} nrf_ringbuf_bcast_t;
+
+/**
+ * @brief Macro for defining a broadcast ring buffer instance.
+ *
+ * Readers are identified by their position in the list of overrun policies, starting from 0.
+ *
+ * @param _name Instance name.
+ * @param _size Size of the buffer (must be a power of 2).
+ * @param ...   Overrun policy (@ref nrf_ringbuf_bcast_overrun_t) of each reader.
+ */
+#define NRF_RINGBUF_BCAST_DEF(_name, _size, ...)                                         \
+    STATIC_ASSERT(IS_POWER_OF_TWO(_size));                                               \
+    static uint8_t CONCAT_2(_name,_buf)[_size];                                          \
+    static const nrf_ringbuf_bcast_overrun_t CONCAT_2(_name,_overrun)[] = {__VA_ARGS__}; \
+    static nrf_ringbuf_bcast_reader_cb_t                                                 \
+                CONCAT_2(_name,_readers)[ARRAY_SIZE(CONCAT_2(_name,_overrun))];          \
+    static nrf_ringbuf_bcast_cb_t CONCAT_2(_name,_cb);                                   \
+    static const nrf_ringbuf_bcast_t _name = {                                           \
+        .p_buffer     = CONCAT_2(_name,_buf),                                            \
+        .bufsize_mask = _size - 1,                                                       \
+        .p_cb         = &CONCAT_2(_name,_cb),                                            \
+        .p_readers    = CONCAT_2(_name,_readers),                                        \
+        .p_overrun    = CONCAT_2(_name,_overrun),                                        \
+        .reader_cnt   = ARRAY_SIZE(CONCAT_2(_name,_overrun)),                            \
+    }
+
+/**
+ * @brief Function for initializing the broadcast ring buffer.
+ *
+ * @param p_ringbuf Pointer to the instance.
+ */
+void nrf_ringbuf_bcast_init(nrf_ringbuf_bcast_t const * p_ringbuf);
+
+/**
+ * @brief Function for allocating contiguous space for the data.
+ *
+ * Same as nrf_ringbuf_alloc(). Data of the readers with the drop oldest policy is dropped if
+ * needed to fit the requested length.
+ *
+ * @param[in]     p_ringbuf Pointer to the instance.
+ * @param[out]    pp_data   Pointer to the allocated space.
+ * @param[in,out] p_length  Requested length, set to the allocated length.
+ * @param[in]     start     Set to true if exclusive access is to be taken.
+ *
+ * @retval NRF_SUCCESS    Successful allocation (can be of 0 length).
+ * @retval NRF_ERROR_BUSY Ring buffer is taken by the producer.
+ */
+ret_code_t nrf_ringbuf_bcast_alloc(nrf_ringbuf_bcast_t const * p_ringbuf,
+                                   uint8_t * *                 pp_data,
+                                   size_t *                    p_length,
+                                   bool                        start);
+
+/**
+ * @brief Function for committing the allocated data and releasing the producer access.
+ *
+ * @param[in] p_ringbuf Pointer to the instance.
+ * @param[in] length    Length of the data to commit.
+ *
+ * @retval NRF_SUCCESS             Data committed.
+ * @retval NRF_ERROR_NO_MEM        Length exceeds the allocated space.
+ * @retval NRF_ERROR_INVALID_STATE Producer access was not taken.
+ */
+ret_code_t nrf_ringbuf_bcast_put(nrf_ringbuf_bcast_t const * p_ringbuf, size_t length);
+
+/**
+ * @brief Function for copying the data into the buffer.
+ *
+ * @param[in]     p_ringbuf Pointer to the instance.
+ * @param[in]     p_data    Data to copy.
+ * @param[in,out] p_length  Length of the data, set to the length copied.
+ *
+ * @retval NRF_SUCCESS    Data copied (can be of 0 length).
+ * @retval NRF_ERROR_BUSY Ring buffer is taken by the producer.
+ */
+ret_code_t nrf_ringbuf_bcast_cpy_put(nrf_ringbuf_bcast_t const * p_ringbuf,
+                                     uint8_t const *             p_data,
+                                     size_t *                    p_length);
+
+/**
+ * @brief Function for getting contiguous data for a reader.
+ *
+ * Same as nrf_ringbuf_get(), the data is released with @ref nrf_ringbuf_bcast_free.
+ *
+ * @param[in]     p_ringbuf Pointer to the instance.
+ * @param[in]     reader    Reader index.
+ * @param[out]    pp_data   Pointer to the data.
+ * @param[in,out] p_length  Requested length, set to the length got.
+ * @param[in]     start     Set to true if exclusive access is to be taken.
+ *
+ * @retval NRF_SUCCESS    Data got (can be of 0 length).
+ * @retval NRF_ERROR_BUSY Reader is busy or the producer is dropping its data.
+ */
+ret_code_t nrf_ringbuf_bcast_get(nrf_ringbuf_bcast_t const * p_ringbuf,
+                                 uint8_t                     reader,
+                                 uint8_t * *                 pp_data,
+                                 size_t *                    p_length,
+                                 bool                        start);
+
+/**
+ * @brief Function for freeing the data got by a reader and releasing the reader access.
+ *
+ * @param[in] p_ringbuf Pointer to the instance.
+ * @param[in] reader    Reader index.
+ * @param[in] length    Length of the data to free.
+ *
+ * @retval NRF_SUCCESS      Data freed.
+ * @retval NRF_ERROR_NO_MEM Length exceeds the data available to the reader.
+ */
+ret_code_t nrf_ringbuf_bcast_free(nrf_ringbuf_bcast_t const * p_ringbuf, uint8_t reader, size_t length);
+
+/**
+ * @brief Function for copying the data out of the buffer for a reader.
+ *
+ * @param[in]     p_ringbuf Pointer to the instance.
+ * @param[in]     reader    Reader index.
+ * @param[out]    p_data    Destination.
+ * @param[in,out] p_length  Requested length, set to the length copied.
+ *
+ * @retval NRF_SUCCESS    Data copied (can be of 0 length).
+ * @retval NRF_ERROR_BUSY Reader is busy or the producer is dropping its data.
+ */
+ret_code_t nrf_ringbuf_bcast_cpy_get(nrf_ringbuf_bcast_t const * p_ringbuf,
+                                     uint8_t                     reader,
+                                     uint8_t *                   p_data,
+                                     size_t *                    p_length);
+
+/**
+ * @brief Function for getting the number of bytes dropped for a reader.
+ *
+ * @param[in] p_ringbuf Pointer to the instance.
+ * @param[in] reader    Reader index.
+ *
+ * @return Number of bytes dropped since initialization.
+ */
+uint32_t nrf_ringbuf_bcast_dropped_get(nrf_ringbuf_bcast_t const * p_ringbuf, uint8_t reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_RINGBUF_BCAST_H__
+
+/** @} */
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_ringbuf_span Ring buffer spans
+ * @{
+ * @ingroup nrf_ringbuf
+ *
+ * @brief Zero copy access to data that wraps at the end of the ring buffer.
+ *
+ * @details @ref nrf_ringbuf_span_alloc and @ref nrf_ringbuf_span_get return up to two segments,
+ *          the second one starting at the beginning of the buffer, so wrapped data can be handed
+ *          to a peripheral without copying. Spans are committed with nrf_ringbuf_put() and
+ *          released with nrf_ringbuf_free(), same as the data returned by nrf_ringbuf_alloc() and
+ *          nrf_ringbuf_get().
+ *
+ *          A ring buffer defined with @ref NRF_RINGBUF_MIRRORED_DEF has a mirror area after the
+ *          end of the buffer. @ref nrf_ringbuf_mirrored_get copies the wrapped part of the data
+ *          (at most the mirror size) to this area and returns one contiguous block, so a consumer
+ *          like nrfx_uarte_tx() needs a single transfer.
+ */
+
+#ifndef NRF_RINGBUF_SPAN_H__
+#define NRF_RINGBUF_SPAN_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "nrf_ringbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Ring buffer with a mirror area after the end of the buffer. */
+typedef struct
+{
+    nrf_ringbuf_t ringbuf;     ///< Ring buffer instance, used with the other ring buffer functions.
+    size_t        mirror_size; ///< Size of the mirror area.
+} nrf_ringbuf_mirrored_t;
+
+/**
+ * @brief Macro for defining a ring buffer instance with a mirror area.
+ *
+ * The instance is of type @ref nrf_ringbuf_mirrored_t. Pass its ringbuf member to the other ring
+ * buffer functions.
+ *
+ * @param _name        Instance name.
+ * @param _size        Size of the ring buffer (must be a power of 2).
+ * @param _mirror_size Size of the mirror area, the longest wrapped part returned by
+ *                     @ref nrf_ringbuf_mirrored_get.
+ */
+#define NRF_RINGBUF_MIRRORED_DEF(_name, _size, _mirror_size) \
+    STATIC_ASSERT(IS_POWER_OF_TWO(_size));                   \
+    static uint8_t CONCAT_2(_name,_buf)[(_size) + (_mirror_size)]; \
+    static nrf_ringbuf_cb_t CONCAT_2(_name,_cb);             \
+    static const nrf_ringbuf_mirrored_t _name = {            \
+        .ringbuf =                                           \
+        {                                                    \
+            .p_buffer     = CONCAT_2(_name,_buf),            \
+            .bufsize_mask = (_size) - 1,                     \
+            .p_cb         = &CONCAT_2(_name,_cb),            \
+        },                                                   \
+        .mirror_size = (_mirror_size),                       \
+    }
+
+/**@brief Span of data in the ring buffer. */
+typedef struct
+{
+    uint8_t * p_data[2]; ///< Start of the first segment and of the segment after the wrap (NULL if not used).
+    size_t    length[2]; ///< Length of each segment.
+} nrf_ringbuf_span_t;
+
+/**
+ * @brief Function for allocating space for the data, including the part after the wrap.
+ *
+ * @param[in]     p_ringbuf Pointer to the ring buffer instance.
+ * @param[out]    p_span    Span of the allocated space.
+ * @param[in,out] p_length  Requested length, set to the allocated length (0 if the buffer is full).
+ * @param[in]     start     Set to true if exclusive access is to be taken, same as in
+ *                          nrf_ringbuf_alloc().
+ *
+ * @retval NRF_SUCCESS    Successful allocation (can be of 0 length).
+ * @retval NRF_ERROR_BUSY Ring buffer is taken by another producer.
+ */
+ret_code_t nrf_ringbuf_span_alloc(nrf_ringbuf_t const * p_ringbuf,
+                                  nrf_ringbuf_span_t *  p_span,
+                                  size_t *              p_length,
+                                  bool                  start);
+
+/**
+ * @brief Function for getting the data, including the part after the wrap.
+ *
+ * @param[in]     p_ringbuf Pointer to the ring buffer instance.
+ * @param[out]    p_span    Span of the data.
+ * @param[in,out] p_length  Requested length, set to the length got (0 if the buffer is empty).
+ * @param[in]     start     Set to true if exclusive access is to be taken, same as in
+ *                          nrf_ringbuf_get().
+ *
+ * @retval NRF_SUCCESS    Data got (can be of 0 length).
+ * @retval NRF_ERROR_BUSY Ring buffer is taken by another consumer.
+ */
+ret_code_t nrf_ringbuf_span_get(nrf_ringbuf_t const * p_ringbuf,
+                                nrf_ringbuf_span_t *  p_span,
+                                size_t *              p_length,
+                                bool                  start);
+
+/**
+ * @brief Function for getting the data as one contiguous block from a mirrored ring buffer.
+ *
+ * The wrapped part of the data is copied to the mirror area. It is limited to @p max_wrapped,
+ * so the returned length can be shorter than the data available.
+ *
+ * @param[in]     p_mirrored  Pointer to the instance defined with @ref NRF_RINGBUF_MIRRORED_DEF.
+ * @param[in]     max_wrapped Longest wrapped part to copy. Must not exceed the mirror size given
+ *                            to @ref NRF_RINGBUF_MIRRORED_DEF.
+ * @param[out]    pp_data     Pointer to the data.
+ * @param[in,out] p_length    Requested length, set to the length got (0 if the buffer is empty).
+ * @param[in]     start       Set to true if exclusive access is to be taken.
+ *
+ * @retval NRF_SUCCESS             Data got (can be of 0 length).
+ * @retval NRF_ERROR_INVALID_PARAM @p max_wrapped is larger than the mirror area.
+ * @retval NRF_ERROR_BUSY          Ring buffer is taken by another consumer.
+ */
+ret_code_t nrf_ringbuf_mirrored_get(nrf_ringbuf_mirrored_t const * p_mirrored,
+                                    size_t                         max_wrapped,
+                                    uint8_t * *                    pp_data,
+                                    size_t *                       p_length,
+                                    bool                           start);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_RINGBUF_SPAN_H__
+
+/** @} */
@@ -50,7 +50,13 @@
 #include "sdk_config.h"
 #include "app_error.h"
 #include "app_util_platform.h"
+#include "nrf_section_cache.h"
+#include "nrf_profiler.h"
+#include "nrf_trace.h"
 
+#if NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
+#include "nrf_sdh_dispatch.h"
+#endif
 
 #define NRF_LOG_MODULE_NAME nrf_sdh
 #if NRF_SDH_LOG_ENABLED
@@ -63,6 +69,8 @@
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
 
+NRF_PROFILER_PROBE_DEF(sdh_evts_poll);
+
 
 // Validate configuration options.
 
@@ -71,6 +79,13 @@ NRF_LOG_MODULE_REGISTER();
         #error app_scheduler is required when NRF_SDH_DISPATCH_MODEL is set to NRF_SDH_DISPATCH_MODEL_APPSH
     #endif
     #include "app_scheduler.h"
+    #if NRF_MODULE_ENABLED(APP_SCHED_PRIO)
+        #include "app_sched_prio.h"
+        #define SDH_SCHED_EVENT_PUT(_handler) \
+            app_sched_prio_event_put(NULL, 0, (_handler), (app_sched_prio_level_t)APP_SCHED_PRIO_SDH_LEVEL)
+    #else
+        #define SDH_SCHED_EVENT_PUT(_handler) app_sched_event_put(NULL, 0, (_handler))
+    #endif
 #endif
 
 #if (   (NRF_SDH_CLOCK_LF_SRC      == NRF_CLOCK_LF_SRC_RC)          \
@@ -89,6 +104,14 @@ NRF_SECTION_SET_DEF(sdh_state_observers, nrf_sdh_state_observer_t, NRF_SDH_STATE
 NRF_SECTION_SET_DEF(sdh_stack_observers, nrf_sdh_stack_observer_t, NRF_SDH_STACK_OBSERVER_PRIO_LEVELS);
 
 
+/**@brief   Maximum number of cached stack observers: the ANT, BLE and SoC pollers and the
+ *          application ones. */
+#define SDH_STACK_OBSERVERS_CACHE_SIZE  8
+
+// Stack observers are called for every event signal, so they are walked from a cache.
+NRF_SECTION_CACHE_DEF(m_stack_observers, SDH_STACK_OBSERVERS_CACHE_SIZE);
+
+
 static bool m_nrf_sdh_enabled;   /**< Variable to indicate whether the SoftDevice is enabled. */
 static bool m_nrf_sdh_suspended; /**< Variable to indicate whether this module is suspended. */
 static bool m_nrf_sdh_continue;  /**< Variable to indicate whether enable/disable process was started. */
@@ -224,6 +247,11 @@ ret_code_t nrf_sdh_enable_request(void)
     m_nrf_sdh_continue  = false;
     m_nrf_sdh_suspended = false;
 
+    if (nrf_section_cache_build(&m_stack_observers, &sdh_stack_observers) != NRF_SUCCESS)
+    {
+        NRF_LOG_WARNING("Too many stack observers to cache.");
+    }
+
     // Enable event interrupt.
     // Interrupt priority has already been set by the stack.
     softdevices_evt_irq_enable();
@@ -340,11 +368,64 @@ bool nrf_sdh_is_suspended(void)
 }
 
 
-void nrf_sdh_evts_poll(void)
+#if NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
+#if (NRF_SDH_DISPATCH_MODEL == NRF_SDH_DISPATCH_MODEL_APPSH)
+static void appsh_events_poll(void * p_event_data, uint16_t event_size);
+#endif
+
+void nrf_sdh_evts_poll_repeat(void)
+{
+#if (NRF_SDH_DISPATCH_MODEL == NRF_SDH_DISPATCH_MODEL_INTERRUPT)
+    // Interrupts of the same priority pending in the meantime are served first.
+#ifdef SOFTDEVICE_PRESENT
+    ret_code_t ret_code = sd_nvic_SetPendingIRQ((IRQn_Type)SD_EVT_IRQn);
+    APP_ERROR_CHECK(ret_code);
+#else
+    NVIC_SetPendingIRQ((IRQn_Type)SD_EVT_IRQn);
+#endif
+#elif (NRF_SDH_DISPATCH_MODEL == NRF_SDH_DISPATCH_MODEL_APPSH)
+    ret_code_t ret_code = SDH_SCHED_EVENT_PUT(appsh_events_poll);
+    APP_ERROR_CHECK(ret_code);
+#endif
+    // In the polling model, the next call from the main loop takes the rest.
+}
+#endif // NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
+
+
+/**@brief Function for polling SoftDevice events and notifying the stack observers. */
+static void sdh_evts_poll(void)
 {
     nrf_section_iter_t iter;
 
+#if NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
+    // BLE and SoC events are taken here, so the pollers among the stack observers find no events.
+    // The stack observers are called only when no events are left.
+    if (!nrf_sdh_dispatch_poll())
+    {
+        // Without a free pooled event, the poll is repeated when a retained event is released.
+        if (!nrf_sdh_dispatch_is_starved())
+        {
+            nrf_sdh_evts_poll_repeat();
+        }
+        return;
+    }
+#endif
+
     // Notify observers about pending SoftDevice event.
+    if (m_stack_observers.count != 0)
+    {
+        void const * const * pp_item = nrf_section_cache_begin(&m_stack_observers);
+        void const * const * pp_end  = nrf_section_cache_end(&m_stack_observers);
+
+        for (; pp_item != pp_end; pp_item++)
+        {
+            nrf_sdh_stack_observer_t * p_observer = (nrf_sdh_stack_observer_t *)*pp_item;
+
+            p_observer->handler(p_observer->p_context);
+        }
+        return;
+    }
+
     for (nrf_section_iter_init(&iter, &sdh_stack_observers);
          nrf_section_iter_get(&iter) != NULL;
          nrf_section_iter_next(&iter))
@@ -360,11 +441,24 @@ void nrf_sdh_evts_poll(void)
 }
 
 
+void nrf_sdh_evts_poll(void)
+{
+    NRF_PROFILER_BEGIN(sdh_evts_poll);
+    sdh_evts_poll();
+    NRF_PROFILER_END(sdh_evts_poll);
+}
+
+
 #if (NRF_SDH_DISPATCH_MODEL == NRF_SDH_DISPATCH_MODEL_INTERRUPT)
 
 void SD_EVT_IRQHandler(void)
 {
+    NRF_TRACE_ISR_ENTER();
+#if NRF_MODULE_ENABLED(NRF_SDH_DISPATCH) && NRF_SDH_DISPATCH_PROFILER_ENABLED
+    nrf_sdh_dispatch_pend_mark();
+#endif
     nrf_sdh_evts_poll();
+    NRF_TRACE_ISR_EXIT();
 }
 
 #elif (NRF_SDH_DISPATCH_MODEL == NRF_SDH_DISPATCH_MODEL_APPSH)
@@ -381,14 +475,21 @@ static void appsh_events_poll(void * p_event_data, uint16_t event_size)
     UNUSED_PARAMETER(p_event_data);
     UNUSED_PARAMETER(event_size);
 
+    NRF_TRACE_SCHED_START(appsh_events_poll);
     nrf_sdh_evts_poll();
+    NRF_TRACE_SCHED_STOP(appsh_events_poll);
 }
 
 
 void SD_EVT_IRQHandler(void)
 {
-    ret_code_t ret_code = app_sched_event_put(NULL, 0, appsh_events_poll);
+    NRF_TRACE_ISR_ENTER();
+#if NRF_MODULE_ENABLED(NRF_SDH_DISPATCH) && NRF_SDH_DISPATCH_PROFILER_ENABLED
+    nrf_sdh_dispatch_pend_mark();
+#endif
+    ret_code_t ret_code = SDH_SCHED_EVENT_PUT(appsh_events_poll);
     APP_ERROR_CHECK(ret_code);
+    NRF_TRACE_ISR_EXIT();
 }
 
 #elif (NRF_SDH_DISPATCH_MODEL == NRF_SDH_DISPATCH_MODEL_POLLING)
@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE_TRACE)
+#include "nrf_sdh_ble_trace.h"
+#include <string.h>
+#include "nrf_sdh_ble.h"
+#include "nrf_assert.h"
+#include "app_util_platform.h"
+#include "nrf_mem_telemetry.h"
+#if NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
+#include "nrf_sdh_dispatch.h"
+#endif
+
+/**@brief Mask for converting a byte counter into a buffer index. */
+#define BLE_TRACE_BUF_MASK      (NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE - 1)
+
+STATIC_ASSERT(IS_POWER_OF_TWO(NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE));
+
+/*
+ * Frames are written by the BLE observer, which runs in the single context the SoftDevice events
+ * are passed in, and read by nrf_sdh_ble_trace_process(). With one producer and one consumer, each
+ * counter is written on one side only, and the buffer needs no lock. Frames are written as a byte
+ * stream and may wrap at the end of the buffer.
+ */
+static uint8_t                  m_buf[NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE];
+static uint32_t volatile        m_wr_idx;         /**< Bytes written by the observer, free running. */
+static uint32_t volatile        m_rd_idx;         /**< Bytes passed to the transport, free running. */
+static uint32_t                 m_high_water;     /**< Largest number of buffered bytes. */
+static uint32_t volatile        m_dropped;        /**< Events dropped because the buffer was full. */
+static uint8_t                  m_seq;            /**< Sequence number of the next event. */
+static bool volatile            m_enabled;        /**< Events are recorded. */
+static bool volatile            m_replaying;      /**< A replay is in progress. */
+static nrf_sdh_ble_trace_tx_t   m_tx_func;        /**< Transport for the frames. */
+static nrf_log_timestamp_func_t m_timestamp_func; /**< Timestamp function, NULL if not used. */
+
+/**@brief Copy bytes into the buffer at a free running index, wrapping at the end. */
+static void ble_trace_write(uint32_t idx, uint8_t const * p_data, uint32_t len)
+{
+    uint32_t pos   = idx & BLE_TRACE_BUF_MASK;
+    uint32_t first = MIN(len, NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE - pos);
+
+    memcpy(&m_buf[pos], p_data, first);
+    memcpy(m_buf, p_data + first, len - first);
+}
+
+/**@brief BLE observer recording the events. */
+static void ble_trace_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    uint16_t evt_len = p_ble_evt->header.evt_len;
+    uint32_t len     = NRF_SDH_BLE_TRACE_HDR_LEN + evt_len;
+    uint32_t wr      = m_wr_idx;
+    uint32_t used    = wr - m_rd_idx;
+    uint32_t timestamp;
+    uint8_t  hdr[NRF_SDH_BLE_TRACE_HDR_LEN];
+
+    UNUSED_PARAMETER(p_context);
+
+    if (!m_enabled || m_replaying)
+    {
+        return;
+    }
+
+    if (used + len > NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE)
+    {
+        m_dropped++;
+        m_seq++;
+        return;
+    }
+
+    timestamp = (m_timestamp_func != NULL) ? m_timestamp_func() : 0;
+
+    hdr[0] = NRF_SDH_BLE_TRACE_FRAME_SYNC;
+    hdr[1] = m_seq++;
+    UNUSED_RETURN_VALUE(uint16_encode(evt_len, &hdr[2]));
+    UNUSED_RETURN_VALUE(uint32_encode(timestamp, &hdr[4]));
+
+    ble_trace_write(wr, hdr, sizeof(hdr));
+    ble_trace_write(wr + sizeof(hdr), (uint8_t const *)p_ble_evt, evt_len);
+
+    if (used + len > m_high_water)
+    {
+        m_high_water = used + len;
+    }
+
+    // The frame must be complete before the consumer can see it.
+    __DMB();
+    m_wr_idx = wr + len;
+}
+
+NRF_SDH_BLE_OBSERVER(m_ble_trace_observer, 0, ble_trace_on_ble_evt, NULL);
+
+#if NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+static void mem_telemetry_usage_get(void const * p_object, nrf_mem_telemetry_stats_t * p_stats)
+{
+    UNUSED_PARAMETER(p_object);
+
+    p_stats->capacity   = NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE;
+    p_stats->used       = m_wr_idx - m_rd_idx;
+    p_stats->high_water = m_high_water;
+}
+
+static void mem_telemetry_reset(void const * p_object)
+{
+    UNUSED_PARAMETER(p_object);
+
+    m_high_water = m_wr_idx - m_rd_idx;
+}
+
+NRF_MEM_TELEMETRY_SOURCE_DEF(m_ble_trace, "sdh_ble_trace", m_buf,
+                             NRF_MEM_TELEMETRY_UNIT_BYTES,
+                             mem_telemetry_usage_get, mem_telemetry_reset);
+#endif // NRF_MODULE_ENABLED(NRF_MEM_TELEMETRY)
+
+ret_code_t nrf_sdh_ble_trace_init(nrf_sdh_ble_trace_tx_t   tx_func,
+                                  nrf_log_timestamp_func_t timestamp_func)
+{
+    if (tx_func == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    m_enabled        = false;
+    m_tx_func        = tx_func;
+    m_timestamp_func = timestamp_func;
+    m_wr_idx         = 0;
+    m_rd_idx         = 0;
+    m_high_water     = 0;
+    m_dropped        = 0;
+    m_seq            = 0;
+    m_enabled        = true;
+
+    return NRF_SUCCESS;
+}
+
+void nrf_sdh_ble_trace_enable(bool enable)
+{
+    m_enabled = enable && (m_tx_func != NULL);
+}
+
+bool nrf_sdh_ble_trace_process(void)
+{
+    uint32_t rd = m_rd_idx;
+    uint32_t pos;
+    size_t   len;
+    size_t   sent;
+
+    ASSERT(m_tx_func != NULL);
+
+    if (m_wr_idx == rd)
+    {
+        return false;
+    }
+
+    // The frame must not be read before the write counter.
+    __DMB();
+
+    pos  = rd & BLE_TRACE_BUF_MASK;
+    len  = MIN(m_wr_idx - rd, NRF_SDH_BLE_TRACE_CONFIG_BUFSIZE - pos);
+    sent = m_tx_func(&m_buf[pos], len);
+    ASSERT(sent <= len);
+
+    m_rd_idx = rd + sent;
+
+    return (sent > 0);
+}
+
+uint32_t nrf_sdh_ble_trace_dropped_get(void)
+{
+    return m_dropped;
+}
+
+#if NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
+ret_code_t nrf_sdh_ble_trace_replay(uint8_t const * p_stream,
+                                    size_t          len,
+                                    uint32_t        max_evts,
+                                    size_t        * p_used)
+{
+    static __ALIGN(4) uint8_t evt_buf[NRF_SDH_BLE_EVT_BUF_SIZE];
+
+    ret_code_t ret_code = NRF_SUCCESS;
+    uint32_t   count    = 0;
+    size_t     pos      = 0;
+
+    VERIFY_PARAM_NOT_NULL(p_stream);
+    VERIFY_PARAM_NOT_NULL(p_used);
+
+    m_replaying = true;
+
+    while ((pos + NRF_SDH_BLE_TRACE_HDR_LEN <= len) && ((max_evts == 0) || (count < max_evts)))
+    {
+        uint16_t evt_len = uint16_decode(&p_stream[pos + 2]);
+
+        if ((p_stream[pos] != NRF_SDH_BLE_TRACE_FRAME_SYNC) || (evt_len < sizeof(ble_evt_hdr_t)))
+        {
+            // Resynchronize on the next frame start.
+            pos++;
+            continue;
+        }
+
+        if (pos + NRF_SDH_BLE_TRACE_HDR_LEN + evt_len > len)
+        {
+            // The capture ended inside this frame.
+            pos = len;
+            break;
+        }
+
+        pos += NRF_SDH_BLE_TRACE_HDR_LEN;
+        if (evt_len > sizeof(evt_buf))
+        {
+            pos     += evt_len;
+            ret_code = NRF_ERROR_DATA_SIZE;
+            break;
+        }
+
+        memcpy(evt_buf, &p_stream[pos], evt_len);
+        pos += evt_len;
+        count++;
+
+        nrf_sdh_dispatch_ble_evt_inject((ble_evt_t const *)evt_buf);
+    }
+
+    // Too short to hold another frame.
+    if ((ret_code == NRF_SUCCESS) && (pos + NRF_SDH_BLE_TRACE_HDR_LEN > len))
+    {
+        pos = len;
+    }
+
+    m_replaying = false;
+    *p_used     = pos;
+
+    return ret_code;
+}
+#endif // NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
+
+#endif // NRF_MODULE_ENABLED(NRF_SDH_BLE_TRACE)
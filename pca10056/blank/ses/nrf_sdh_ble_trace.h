@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_sdh_ble_trace BLE event trace recording and replay
+ * @{
+ * @ingroup  nrf_sdh
+ * @brief    Recording of the BLE event stream, and replay of it through the BLE observers.
+ *
+ * @details A BLE observer of priority 0 copies every BLE event into a frame buffer. The frames
+ *          are passed to the transport given to @ref nrf_sdh_ble_trace_init when
+ *          @ref nrf_sdh_ble_trace_process is called, typically from the idle loop. The transport
+ *          is usually an RTT up channel of its own, for example SEGGER_RTT_WriteNoLock(), so
+ *          that the stream can be captured with J-Link RTT Logger while the device is in use.
+ *          Events that do not fit in the buffer are dropped and counted, and the gap is seen
+ *          by the host from the sequence numbers.
+ *
+ *          Frame layout, all fields little endian:
+ *          - 1 byte: 0xE1.
+ *          - 1 byte: sequence number, incremented for every event, including dropped ones.
+ *          - 2 bytes: length of the event.
+ *          - 4 bytes: timestamp, 0 if no timestamp function is used.
+ *          - The event, as written by the SoftDevice, starting with ble_evt_hdr_t.
+ *
+ *          @ref nrf_sdh_ble_trace_replay passes the events of a captured stream to the BLE
+ *          observers through @ref nrf_sdh_dispatch_ble_evt_inject, as fast as they are handled.
+ *          Together with NRF_SDH_DISPATCH_PROFILER_ENABLED and @ref nrf_mem_telemetry, this
+ *          gives the run time of each observer per event ID and the memory high-water marks
+ *          for a load such as a dense scanning environment, repeatably and on one device.
+ *          Events are not recorded during a replay.
+ *
+ *          nrf_sdh_ble_trace_decode.py prints a captured stream, summarizes it per event ID and
+ *          connection, and converts it into a C array to be built in for the replay.
+ *
+ * @note During a replay, the SoftDevice functions called by the observers are executed by the
+ *       SoftDevice, which does not know the recorded links. Replay on a device without
+ *       connections, and do not treat errors returned for the recorded connection handles as
+ *       fatal in the modules being profiled.
+ */
+
+#ifndef NRF_SDH_BLE_TRACE_H__
+#define NRF_SDH_BLE_TRACE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sdk_common.h"
+#include "nrf_log_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_SDH_BLE_TRACE_FRAME_SYNC    0xE1 ///< First byte of a frame.
+#define NRF_SDH_BLE_TRACE_HDR_LEN       8    ///< Length of the frame header.
+
+/**@brief Transport for the frames.
+ *
+ * @param[in] p_data Frame data.
+ * @param[in] len    Length of the data.
+ *
+ * @return Number of bytes accepted. The rest is passed again on the next call.
+ */
+typedef size_t (* nrf_sdh_ble_trace_tx_t)(uint8_t const * p_data, size_t len);
+
+/**@brief Function for initializing the recording.
+ *
+ * @param[in] tx_func        Transport for the frames.
+ * @param[in] timestamp_func Timestamp function, or NULL for frames without timestamps.
+ *
+ * @retval NRF_SUCCESS             Initialization successful.
+ * @retval NRF_ERROR_INVALID_PARAM Transport is NULL.
+ */
+ret_code_t nrf_sdh_ble_trace_init(nrf_sdh_ble_trace_tx_t   tx_func,
+                                  nrf_log_timestamp_func_t timestamp_func);
+
+/**@brief Function for starting or stopping the recording.
+ *
+ * @details The recording is started by @ref nrf_sdh_ble_trace_init.
+ *
+ * @param[in] enable True to record the events, false to stop.
+ */
+void nrf_sdh_ble_trace_enable(bool enable);
+
+/**@brief Function for passing buffered frames to the transport.
+ *
+ * @details Call until it returns false to pass all buffered frames.
+ *
+ * @return False if the buffer was empty or the transport accepted nothing.
+ */
+bool nrf_sdh_ble_trace_process(void);
+
+/**@brief Function for getting the number of events dropped because the buffer was full. */
+uint32_t nrf_sdh_ble_trace_dropped_get(void);
+
+#if NRF_MODULE_ENABLED(NRF_SDH_DISPATCH) || defined(__SDK_DOXYGEN__)
+/**@brief Function for replaying captured events.
+ *
+ * @details Passes at most @p max_evts events from @p p_stream to the BLE observers and returns,
+ *          so that a long stream can be replayed in steps between other work. Bytes that are
+ *          not a frame are skipped. Must be called in the context the SoftDevice events are
+ *          passed in.
+ *
+ * @param[in]  p_stream Captured stream.
+ * @param[in]  len      Length of the stream.
+ * @param[in]  max_evts Maximum number of events to pass, 0 for no limit.
+ * @param[out] p_used   Number of bytes of the stream consumed. Continue from there in the next
+ *                      call, until it equals @p len.
+ *
+ * @retval NRF_SUCCESS             If the events were passed.
+ * @retval NRF_ERROR_NULL          If a pointer is NULL.
+ * @retval NRF_ERROR_DATA_SIZE     If an event is larger than NRF_SDH_BLE_EVT_BUF_SIZE. It is
+ *                                 skipped, and @p p_used points after it.
+ */
+ret_code_t nrf_sdh_ble_trace_replay(uint8_t const * p_stream,
+                                    size_t          len,
+                                    uint32_t        max_evts,
+                                    size_t        * p_used);
+#endif // NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_SDH_BLE_TRACE_H__
+
+/** @} */
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+#
+# Decoder for the nrf_sdh_ble_trace BLE event stream.
+#
+# Usage: nrf_sdh_ble_trace_decode.py stream.bin
+#        nrf_sdh_ble_trace_decode.py --stats stream.bin
+#        nrf_sdh_ble_trace_decode.py --c-array NAME stream.bin > replay.c
+#
+# Without options, every event is printed with its timestamp, ID and connection
+# handle. --stats prints the number of events and bytes per event ID and per
+# connection, and the events lost to a full buffer. --c-array prints the valid
+# frames as a C array to be passed to nrf_sdh_ble_trace_replay(). "-" reads the
+# stream from standard input.
+
+import struct
+import sys
+
+SYNC = 0xE1
+HDR_LEN = 8
+EVT_HDR_LEN = 4
+
+EVT_NAMES = {
+    0x01: "USER_MEM_REQUEST", 0x02: "USER_MEM_RELEASE",
+    0x10: "GAP_CONNECTED", 0x11: "GAP_DISCONNECTED", 0x12: "GAP_CONN_PARAM_UPDATE",
+    0x13: "GAP_SEC_PARAMS_REQUEST", 0x14: "GAP_SEC_INFO_REQUEST", 0x15: "GAP_PASSKEY_DISPLAY",
+    0x16: "GAP_KEY_PRESSED", 0x17: "GAP_AUTH_KEY_REQUEST", 0x18: "GAP_LESC_DHKEY_REQUEST",
+    0x19: "GAP_AUTH_STATUS", 0x1A: "GAP_CONN_SEC_UPDATE", 0x1B: "GAP_TIMEOUT",
+    0x1C: "GAP_RSSI_CHANGED", 0x1D: "GAP_ADV_REPORT", 0x1E: "GAP_SEC_REQUEST",
+    0x1F: "GAP_CONN_PARAM_UPDATE_REQUEST", 0x20: "GAP_SCAN_REQ_REPORT",
+    0x21: "GAP_PHY_UPDATE_REQUEST", 0x22: "GAP_PHY_UPDATE",
+    0x23: "GAP_DATA_LENGTH_UPDATE_REQUEST", 0x24: "GAP_DATA_LENGTH_UPDATE",
+    0x25: "GAP_QOS_CHANNEL_SURVEY_REPORT", 0x26: "GAP_ADV_SET_TERMINATED",
+    0x30: "GATTC_PRIM_SRVC_DISC_RSP", 0x31: "GATTC_REL_DISC_RSP", 0x32: "GATTC_CHAR_DISC_RSP",
+    0x33: "GATTC_DESC_DISC_RSP", 0x34: "GATTC_ATTR_INFO_DISC_RSP",
+    0x35: "GATTC_CHAR_VAL_BY_UUID_READ_RSP", 0x36: "GATTC_READ_RSP",
+    0x37: "GATTC_CHAR_VALS_READ_RSP", 0x38: "GATTC_WRITE_RSP", 0x39: "GATTC_HVX",
+    0x3A: "GATTC_EXCHANGE_MTU_RSP", 0x3B: "GATTC_TIMEOUT", 0x3C: "GATTC_WRITE_CMD_TX_COMPLETE",
+    0x50: "GATTS_WRITE", 0x51: "GATTS_RW_AUTHORIZE_REQUEST", 0x52: "GATTS_SYS_ATTR_MISSING",
+    0x53: "GATTS_HVC", 0x54: "GATTS_SC_CONFIRM", 0x55: "GATTS_EXCHANGE_MTU_REQUEST",
+    0x56: "GATTS_TIMEOUT", 0x57: "GATTS_HVN_TX_COMPLETE",
+    0x70: "L2CAP_CH_SETUP_REQUEST", 0x71: "L2CAP_CH_SETUP_REFUSED", 0x72: "L2CAP_CH_SETUP",
+    0x73: "L2CAP_CH_RELEASED", 0x74: "L2CAP_CH_SDU_BUF_RELEASED", 0x75: "L2CAP_CH_CREDIT",
+    0x76: "L2CAP_CH_RX", 0x77: "L2CAP_CH_TX",
+}
+
+
+def evt_name(evt_id):
+    return EVT_NAMES.get(evt_id, "0x%04X" % evt_id)
+
+
+def frames(stream):
+    """Yield (offset, sequence, timestamp, event bytes) for each complete frame."""
+    pos = 0
+    while pos + HDR_LEN <= len(stream):
+        seq, length, timestamp = struct.unpack_from("<BHI", stream, pos + 1)
+        if stream[pos] != SYNC or length < EVT_HDR_LEN:
+            pos += 1        # Resynchronize on the next frame start.
+            continue
+        if pos + HDR_LEN + length > len(stream):
+            break
+        yield pos, seq, timestamp, stream[pos + HDR_LEN:pos + HDR_LEN + length]
+        pos += HDR_LEN + length
+
+
+def conn_handle(evt):
+    # Every event handled by the BLE modules starts with the connection handle.
+    return struct.unpack_from("<H", evt, EVT_HDR_LEN)[0] if len(evt) >= EVT_HDR_LEN + 2 else None
+
+
+def print_events(stream):
+    for _, seq, timestamp, evt in frames(stream):
+        evt_id, = struct.unpack_from("<H", evt, 0)
+        handle = conn_handle(evt)
+        print("[%08u] #%03u %-32s conn 0x%04X len %u"
+              % (timestamp, seq, evt_name(evt_id), handle if handle is not None else 0xFFFF,
+                 len(evt)))
+
+
+def print_stats(stream):
+    per_id = {}
+    per_conn = {}
+    lost = 0
+    count = 0
+    first = last = None
+    expected = None
+    for _, seq, timestamp, evt in frames(stream):
+        if expected is not None:
+            lost += (seq - expected) & 0xFF
+        expected = (seq + 1) & 0xFF
+        evt_id, = struct.unpack_from("<H", evt, 0)
+        n, size = per_id.get(evt_id, (0, 0))
+        per_id[evt_id] = (n + 1, size + len(evt))
+        handle = conn_handle(evt)
+        per_conn[handle] = per_conn.get(handle, 0) + 1
+        first = timestamp if first is None else first
+        last = timestamp
+        count += 1
+
+    print("%u events, %u lost, timestamps %s to %s" % (count, lost, first, last))
+    print("%-32s %8s %10s" % ("event", "count", "bytes"))
+    for evt_id in sorted(per_id):
+        n, size = per_id[evt_id]
+        print("%-32s %8u %10u" % (evt_name(evt_id), n, size))
+    print("%-32s %8s" % ("connection", "count"))
+    for handle in sorted(per_conn, key=lambda h: -1 if h is None else h):
+        print("%-32s %8u" % ("-" if handle is None else "0x%04X" % handle, per_conn[handle]))
+
+
+def print_c_array(stream, name):
+    data = b"".join(stream[pos:pos + HDR_LEN + len(evt)] for pos, _, _, evt in frames(stream))
+    print("#include <stdint.h>")
+    print("#include <stddef.h>")
+    print("")
+    print("uint8_t const %s[] __attribute__((aligned(4))) =" % name)
+    print("{")
+    for i in range(0, len(data), 16):
+        print("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    print("};")
+    print("")
+    print("size_t const %s_len = sizeof(%s);" % (name, name))
+
+
+def main(argv):
+    args = argv[1:]
+    mode = None
+    name = None
+    if args and args[0] == "--stats":
+        mode = args.pop(0)
+    elif len(args) > 1 and args[0] == "--c-array":
+        mode = args.pop(0)
+        name = args.pop(0)
+    if len(args) != 1:
+        sys.stderr.write("usage: %s [--stats | --c-array NAME] stream.bin|-\n" % argv[0])
+        return 2
+    if args[0] == "-":
+        stream = sys.stdin.buffer.read()
+    else:
+        with open(args[0], "rb") as f:
+            stream = f.read()
+    if mode == "--stats":
+        print_stats(stream)
+    elif mode == "--c-array":
+        print_c_array(stream, name)
+    else:
+        print_events(stream)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
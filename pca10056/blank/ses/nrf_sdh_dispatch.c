@@ -0,0 +1,781 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
+
+#include "nrf_sdh_dispatch.h"
+
+#include <string.h>
+
+#include "nrf_sdh.h"
+#include "nrf_section.h"
+#include "app_error.h"
+#include "app_util_platform.h"
+#include "nrf_trace.h"
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE) && (NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE > 0)
+#include <stddef.h>
+#include "nrf_atomic.h"
+#include "nrf_balloc.h"
+#include "nrf_balloc_idx.h"
+#endif
+
+#define NRF_LOG_MODULE_NAME nrf_sdh_dispatch
+#if NRF_SDH_LOG_ENABLED
+    #define NRF_LOG_LEVEL       NRF_SDH_LOG_LEVEL
+    #define NRF_LOG_INFO_COLOR  NRF_SDH_INFO_COLOR
+    #define NRF_LOG_DEBUG_COLOR NRF_SDH_DEBUG_COLOR
+#else
+    #define NRF_LOG_LEVEL       0
+#endif // NRF_SDH_LOG_ENABLED
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+
+/**@brief   Number of words of an observer bitmap. */
+#define OBSERVER_WORDS  ((NRF_SDH_DISPATCH_OBSERVERS_MAX + 31) / 32)
+
+/**@brief   Number of SoC event IDs covered by the dispatch table. */
+#define SOC_EVT_ID_COUNT    32
+
+/**@brief   Bitmaps of the observers getting each event ID, bit n for the nth observer in the
+ *          section. */
+typedef uint32_t dispatch_entry_t[OBSERVER_WORDS];
+
+
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE)
+// Section of the BLE observers, created in nrf_sdh_ble.c.
+NRF_SECTION_SET_DEF(sdh_ble_observers, nrf_sdh_ble_evt_observer_t, NRF_SDH_BLE_OBSERVER_PRIO_LEVELS);
+
+static dispatch_entry_t             m_ble_table[NRF_SDH_DISPATCH_BLE_EVT_ID_COUNT]; /**< BLE dispatch table. */
+static nrf_sdh_ble_evt_observer_t * m_ble_observers[NRF_SDH_DISPATCH_OBSERVERS_MAX];   /**< BLE observers in section order. */
+static bool                         m_ble_table_valid;                                  /**< BLE table is built. */
+
+#if NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE > 0
+#define BLE_EVT_POOL    1
+
+/**@brief   Pooled BLE event. */
+typedef struct
+{
+    nrf_atomic_u32_t   refs;                            /**< Number of holders of the event. */
+    __ALIGN(4) uint8_t evt[NRF_SDH_BLE_EVT_BUF_SIZE];   /**< Event written by sd_ble_evt_get(). */
+} ble_evt_block_t;
+
+NRF_BALLOC_DEF(m_ble_evt_pool, sizeof(ble_evt_block_t), NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE);
+
+static bool          m_ble_evt_pool_init;       /**< Pool is initialized. */
+static volatile bool m_ble_evt_pool_starved;    /**< BLE events are left and no block is free. */
+#else
+#define BLE_EVT_POOL    0
+#endif // NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE > 0
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_SDH_SOC)
+// Section of the SoC observers, created in nrf_sdh_soc.c.
+NRF_SECTION_SET_DEF(sdh_soc_observers, nrf_sdh_soc_evt_observer_t, NRF_SDH_SOC_OBSERVER_PRIO_LEVELS);
+
+static dispatch_entry_t             m_soc_table[SOC_EVT_ID_COUNT];                  /**< SoC dispatch table. */
+static nrf_sdh_soc_evt_observer_t * m_soc_observers[NRF_SDH_DISPATCH_OBSERVERS_MAX];   /**< SoC observers in section order. */
+static bool                         m_soc_table_valid;                                  /**< SoC table is built. */
+#endif
+
+
+/**@brief   Function for getting the index of the first observer in a bitmap and clearing it.
+ *
+ * @param[in,out]   entry   Observer bitmap.
+ * @param[in,out]   p_word  Word of the bitmap to start from.
+ *
+ * @return  Observer index, or NRF_SDH_DISPATCH_OBSERVERS_MAX if the bitmap is empty.
+ */
+static uint32_t entry_first_pop(dispatch_entry_t entry, uint32_t * p_word)
+{
+    for (; *p_word < OBSERVER_WORDS; (*p_word)++)
+    {
+        uint32_t bits = entry[*p_word];
+        if (bits != 0)
+        {
+            uint32_t bit = __CLZ(__RBIT(bits));
+            entry[*p_word] = bits & (bits - 1);
+            return (*p_word * 32) + bit;
+        }
+    }
+    return NRF_SDH_DISPATCH_OBSERVERS_MAX;
+}
+
+
+static void entry_set(dispatch_entry_t entry, uint32_t idx)
+{
+    entry[idx / 32] |= (1UL << (idx % 32));
+}
+
+
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE)
+#if NRF_SDH_DISPATCH_PROFILER_ENABLED
+static nrf_sdh_dispatch_profile_t m_profile[NRF_SDH_DISPATCH_PROFILER_SLOTS]; /**< Profiler entries. */
+static uint32_t                   m_profile_dropped;  /**< Records not kept because all entries are used. */
+static uint32_t                   m_pend_cycles;      /**< Cycle count when events were signalled. */
+static bool                       m_pend_marked;      /**< @ref m_pend_cycles is set. */
+
+
+/**@brief   Function for adding a handler run time or an event age to the profiler entries.
+ *
+ * @param[in]   observer    Observer index, or @ref NRF_SDH_DISPATCH_PROFILE_LATENCY.
+ * @param[in]   evt_id      BLE event ID.
+ * @param[in]   cycles      Number of CPU cycles.
+ */
+static void profile_record(uint32_t observer, uint16_t evt_id, uint32_t cycles)
+{
+    uint32_t slot;
+
+    if (observer > NRF_SDH_DISPATCH_PROFILE_LATENCY)
+    {
+        m_profile_dropped++;
+        return;
+    }
+
+    slot = ((observer * 31) + evt_id) % NRF_SDH_DISPATCH_PROFILER_SLOTS;
+    for (uint32_t i = 0; i < NRF_SDH_DISPATCH_PROFILER_SLOTS; i++)
+    {
+        nrf_sdh_dispatch_profile_t * p_entry = &m_profile[slot];
+
+        if (p_entry->count == 0)
+        {
+            p_entry->observer = (uint8_t)observer;
+            p_entry->evt_id   = evt_id;
+        }
+        if ((p_entry->observer == observer) && (p_entry->evt_id == evt_id))
+        {
+            p_entry->count++;
+            p_entry->cycles_max  = MAX(p_entry->cycles_max, cycles);
+            p_entry->cycles_sum += cycles;
+            return;
+        }
+
+        slot = (slot + 1) % NRF_SDH_DISPATCH_PROFILER_SLOTS;
+    }
+
+    m_profile_dropped++;
+}
+
+
+void nrf_sdh_dispatch_pend_mark(void)
+{
+    if (!m_pend_marked)
+    {
+        m_pend_cycles = DWT->CYCCNT;
+        m_pend_marked = true;
+    }
+}
+
+
+ret_code_t nrf_sdh_dispatch_profile_get(uint32_t idx, nrf_sdh_dispatch_profile_t * p_entry)
+{
+    ret_code_t err_code = NRF_ERROR_NOT_FOUND;
+
+    CRITICAL_REGION_ENTER();
+    for (uint32_t slot = 0; slot < NRF_SDH_DISPATCH_PROFILER_SLOTS; slot++)
+    {
+        if ((m_profile[slot].count != 0) && (idx-- == 0))
+        {
+            *p_entry = m_profile[slot];
+            err_code = NRF_SUCCESS;
+            break;
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    return err_code;
+}
+
+
+uint32_t nrf_sdh_dispatch_profile_dropped_get(void)
+{
+    return m_profile_dropped;
+}
+
+
+void nrf_sdh_dispatch_profile_reset(void)
+{
+    CRITICAL_REGION_ENTER();
+    memset(m_profile, 0, sizeof(m_profile));
+    m_profile_dropped = 0;
+    CRITICAL_REGION_EXIT();
+}
+
+
+void nrf_sdh_dispatch_profile_log(void)
+{
+    nrf_sdh_dispatch_profile_t entry;
+
+    for (uint32_t i = 0; nrf_sdh_dispatch_profile_get(i, &entry) == NRF_SUCCESS; i++)
+    {
+        uint32_t avg = (uint32_t)(entry.cycles_sum / entry.count);
+
+        if (entry.observer == NRF_SDH_DISPATCH_PROFILE_LATENCY)
+        {
+            NRF_LOG_INFO("Event 0x%02x: %u events, age max %u avg %u cycles.",
+                         entry.evt_id, entry.count, entry.cycles_max, avg);
+        }
+        else
+        {
+            nrf_sdh_ble_evt_observer_t * p_observer = m_ble_observers[entry.observer];
+            void const                 * p_handler  = (void const *)p_observer->handler;
+
+            if (p_observer->handler == nrf_sdh_dispatch_ble_range_handler)
+            {
+                p_handler = (void const *)((nrf_sdh_ble_range_t *)p_observer->p_context)->handler;
+            }
+            NRF_LOG_INFO("Observer %u (0x%08x) event 0x%02x: %u calls, max %u avg %u cycles.",
+                         entry.observer, (uint32_t)p_handler, entry.evt_id, entry.count,
+                         entry.cycles_max, avg);
+        }
+    }
+
+    if (m_profile_dropped != 0)
+    {
+        NRF_LOG_WARNING("%u records dropped, increase NRF_SDH_DISPATCH_PROFILER_SLOTS.",
+                        m_profile_dropped);
+    }
+}
+#endif // NRF_SDH_DISPATCH_PROFILER_ENABLED
+
+
+void nrf_sdh_dispatch_ble_range_handler(ble_evt_t const * p_ble_evt, void * p_context)
+{
+    nrf_sdh_ble_range_t * p_range = (nrf_sdh_ble_range_t *)p_context;
+
+    if ((p_ble_evt->header.evt_id >= p_range->first_id) &&
+        (p_ble_evt->header.evt_id <= p_range->last_id))
+    {
+        p_range->handler(p_ble_evt, p_range->p_context);
+    }
+}
+
+
+/**@brief   Function for building the BLE dispatch table. */
+static void ble_table_build(void)
+{
+    nrf_section_iter_t iter;
+    uint32_t           idx = 0;
+
+    memset(m_ble_table, 0, sizeof(m_ble_table));
+    m_ble_table_valid = false;
+
+    for (nrf_section_iter_init(&iter, &sdh_ble_observers);
+         nrf_section_iter_get(&iter) != NULL;
+         nrf_section_iter_next(&iter), idx++)
+    {
+        nrf_sdh_ble_evt_observer_t * p_observer;
+        uint32_t                     first = 0;
+        uint32_t                     last  = NRF_SDH_DISPATCH_BLE_EVT_ID_COUNT - 1;
+
+        if (idx == NRF_SDH_DISPATCH_OBSERVERS_MAX)
+        {
+            NRF_LOG_WARNING("Too many BLE observers, dispatch table not used.");
+            return;
+        }
+
+        p_observer           = (nrf_sdh_ble_evt_observer_t *) nrf_section_iter_get(&iter);
+        m_ble_observers[idx] = p_observer;
+        if (p_observer->handler == nrf_sdh_dispatch_ble_range_handler)
+        {
+            nrf_sdh_ble_range_t * p_range = (nrf_sdh_ble_range_t *)p_observer->p_context;
+
+            first = p_range->first_id;
+            last  = MIN(p_range->last_id, last);
+        }
+
+        for (uint32_t id = first; id <= last; id++)
+        {
+            entry_set(m_ble_table[id], idx);
+        }
+    }
+
+    NRF_LOG_DEBUG("BLE dispatch table built, %d observers.", idx);
+    m_ble_table_valid = true;
+}
+
+
+/**@brief   Function for calling the handler of a BLE observer.
+ *
+ * @param[in]   idx         Index of the observer in the section.
+ * @param[in]   p_observer  Observer.
+ * @param[in]   p_ble_evt   BLE event.
+ */
+static void ble_observer_call(uint32_t                     idx,
+                              nrf_sdh_ble_evt_observer_t * p_observer,
+                              ble_evt_t const            * p_ble_evt)
+{
+    nrf_sdh_ble_evt_handler_t handler   = p_observer->handler;
+    void                    * p_context = p_observer->p_context;
+
+    if (handler == nrf_sdh_dispatch_ble_range_handler)
+    {
+        // Out of range only when the observers are walked without the table.
+        nrf_sdh_ble_range_t * p_range = (nrf_sdh_ble_range_t *)p_context;
+        if ((p_ble_evt->header.evt_id < p_range->first_id) ||
+            (p_ble_evt->header.evt_id > p_range->last_id))
+        {
+            return;
+        }
+        handler   = p_range->handler;
+        p_context = p_range->p_context;
+    }
+
+#if NRF_SDH_DISPATCH_PROFILER_ENABLED
+    uint32_t start = DWT->CYCCNT;
+    handler(p_ble_evt, p_context);
+    profile_record(idx, p_ble_evt->header.evt_id, DWT->CYCCNT - start);
+#else
+    UNUSED_PARAMETER(idx);
+    handler(p_ble_evt, p_context);
+#endif
+}
+
+
+/**@brief   Function for passing a BLE event to the observers. */
+static void ble_evt_dispatch(ble_evt_t const * p_ble_evt)
+{
+    nrf_section_iter_t iter;
+    uint16_t           evt_id = p_ble_evt->header.evt_id;
+    uint32_t           idx;
+
+    if (m_ble_table_valid && (evt_id < NRF_SDH_DISPATCH_BLE_EVT_ID_COUNT))
+    {
+        dispatch_entry_t entry;
+        uint32_t         word = 0;
+
+        memcpy(entry, m_ble_table[evt_id], sizeof(entry));
+        while ((idx = entry_first_pop(entry, &word)) != NRF_SDH_DISPATCH_OBSERVERS_MAX)
+        {
+            ble_observer_call(idx, m_ble_observers[idx], p_ble_evt);
+        }
+        return;
+    }
+
+    idx = 0;
+    for (nrf_section_iter_init(&iter, &sdh_ble_observers);
+         nrf_section_iter_get(&iter) != NULL;
+         nrf_section_iter_next(&iter), idx++)
+    {
+        ble_observer_call(idx, (nrf_sdh_ble_evt_observer_t *) nrf_section_iter_get(&iter), p_ble_evt);
+    }
+}
+
+
+#if BLE_EVT_POOL
+/**@brief   Function for getting the pool block of a BLE event.
+ *
+ * @param[in]   p_ble_evt   BLE event.
+ *
+ * @return  Block holding the event, or NULL if the event is not from the pool.
+ */
+static ble_evt_block_t * ble_evt_block_get(ble_evt_t const * p_ble_evt)
+{
+    uint8_t const * p_begin = (uint8_t const *)m_ble_evt_pool.p_memory_begin;
+    uint8_t const * p_end   = p_begin + (m_ble_evt_pool.block_size * NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE);
+    uint8_t const * p_evt   = (uint8_t const *)p_ble_evt;
+
+    if ((p_evt < (p_begin + offsetof(ble_evt_block_t, evt))) || (p_evt >= p_end))
+    {
+        return NULL;
+    }
+    return (ble_evt_block_t *)(p_evt - offsetof(ble_evt_block_t, evt));
+}
+
+
+/**@brief   Function for allocating a block for the next BLE event.
+ *
+ * @return  Block with one holder, or NULL if all blocks are held.
+ */
+static ble_evt_block_t * ble_evt_block_alloc(void)
+{
+    ble_evt_block_t * p_block = nrf_balloc_alloc(&m_ble_evt_pool);
+
+    if (p_block == NULL)
+    {
+        // Set before trying again, so that a block freed in between repeats the poll.
+        m_ble_evt_pool_starved = true;
+        p_block = nrf_balloc_alloc(&m_ble_evt_pool);
+        if (p_block == NULL)
+        {
+            NRF_LOG_DEBUG("All BLE events held, polling deferred.");
+            return NULL;
+        }
+        m_ble_evt_pool_starved = false;
+    }
+
+    p_block->refs = 1;
+    return p_block;
+}
+
+
+ret_code_t nrf_sdh_dispatch_ble_evt_get(ble_evt_t const * p_ble_evt)
+{
+    ble_evt_block_t * p_block = ble_evt_block_get(p_ble_evt);
+
+    if (p_block == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    ASSERT(p_block->refs != 0);
+    (void)nrf_atomic_u32_add(&p_block->refs, 1);
+    return NRF_SUCCESS;
+}
+
+
+void nrf_sdh_dispatch_ble_evt_put(ble_evt_t const * p_ble_evt)
+{
+    ble_evt_block_t * p_block = ble_evt_block_get(p_ble_evt);
+
+    ASSERT(p_block != NULL);
+    if (p_block == NULL)
+    {
+        return;
+    }
+
+    ASSERT(p_block->refs != 0);
+    if (nrf_atomic_u32_sub(&p_block->refs, 1) == 0)
+    {
+        nrf_balloc_free(&m_ble_evt_pool, p_block);
+        if (m_ble_evt_pool_starved)
+        {
+            m_ble_evt_pool_starved = false;
+            nrf_sdh_evts_poll_repeat();
+        }
+    }
+}
+#endif // BLE_EVT_POOL
+
+
+/**@brief   Function for taking BLE events from the SoftDevice.
+ *
+ * @param[in,out]   p_budget    Number of events which may still be taken.
+ *
+ * @retval  true    No BLE events are left.
+ * @retval  false   The budget was used up, or all pooled events are held.
+ */
+static bool ble_evts_poll(uint32_t * p_budget)
+{
+    ret_code_t ret_code;
+
+    while (*p_budget > 0)
+    {
+#if BLE_EVT_POOL
+        ble_evt_block_t * p_block = ble_evt_block_alloc();
+
+        if (p_block == NULL)
+        {
+            uint16_t next_len = 0;
+
+            // Without a destination, the length of the next event is returned and it is kept.
+            if (sd_ble_evt_get(NULL, &next_len) == NRF_ERROR_NOT_FOUND)
+            {
+                m_ble_evt_pool_starved = false;
+                return true;
+            }
+            return false;
+        }
+
+        uint8_t * evt_buffer = p_block->evt;
+        uint16_t  evt_len    = (uint16_t)sizeof(p_block->evt);
+#else
+        __ALIGN(4) uint8_t evt_buffer[NRF_SDH_BLE_EVT_BUF_SIZE];
+
+        uint16_t evt_len = (uint16_t)sizeof(evt_buffer);
+#endif
+
+        ret_code = sd_ble_evt_get(evt_buffer, &evt_len);
+        if (ret_code != NRF_SUCCESS)
+        {
+#if BLE_EVT_POOL
+            nrf_balloc_free(&m_ble_evt_pool, p_block);
+#endif
+            if (ret_code != NRF_ERROR_NOT_FOUND)
+            {
+                APP_ERROR_HANDLER(ret_code);
+            }
+            return true;
+        }
+
+        NRF_LOG_DEBUG("BLE event: 0x%x.", ((ble_evt_t *)evt_buffer)->header.evt_id);
+#if NRF_SDH_DISPATCH_PROFILER_ENABLED
+        profile_record(NRF_SDH_DISPATCH_PROFILE_LATENCY,
+                       ((ble_evt_t *)evt_buffer)->header.evt_id,
+                       DWT->CYCCNT - m_pend_cycles);
+#endif
+        NRF_TRACE_MARK_START(NRF_TRACE_MARKER_SDH_BLE | ((ble_evt_t *)evt_buffer)->header.evt_id);
+        ble_evt_dispatch((ble_evt_t *)evt_buffer);
+        NRF_TRACE_MARK_STOP(NRF_TRACE_MARKER_SDH_BLE | ((ble_evt_t *)evt_buffer)->header.evt_id);
+#if BLE_EVT_POOL
+        // Freed here unless an observer retained the event.
+        nrf_sdh_dispatch_ble_evt_put((ble_evt_t *)evt_buffer);
+#endif
+        (*p_budget)--;
+    }
+
+    return false;
+}
+
+
+void nrf_sdh_dispatch_ble_evt_inject(ble_evt_t const * p_ble_evt)
+{
+    ASSERT(p_ble_evt != NULL);
+
+    NRF_TRACE_MARK_START(NRF_TRACE_MARKER_SDH_BLE | p_ble_evt->header.evt_id);
+    ble_evt_dispatch(p_ble_evt);
+    NRF_TRACE_MARK_STOP(NRF_TRACE_MARKER_SDH_BLE | p_ble_evt->header.evt_id);
+}
+#endif // NRF_MODULE_ENABLED(NRF_SDH_BLE)
+
+
+#if NRF_MODULE_ENABLED(NRF_SDH_SOC)
+void nrf_sdh_dispatch_soc_mask_handler(uint32_t evt_id, void * p_context)
+{
+    nrf_sdh_soc_mask_t * p_mask = (nrf_sdh_soc_mask_t *)p_context;
+
+    if ((evt_id < SOC_EVT_ID_COUNT) && (p_mask->evt_mask & (1UL << evt_id)))
+    {
+        p_mask->handler(evt_id, p_mask->p_context);
+    }
+}
+
+
+/**@brief   Function for building the SoC dispatch table. */
+static void soc_table_build(void)
+{
+    nrf_section_iter_t iter;
+    uint32_t           idx = 0;
+
+    memset(m_soc_table, 0, sizeof(m_soc_table));
+    m_soc_table_valid = false;
+
+    for (nrf_section_iter_init(&iter, &sdh_soc_observers);
+         nrf_section_iter_get(&iter) != NULL;
+         nrf_section_iter_next(&iter), idx++)
+    {
+        nrf_sdh_soc_evt_observer_t * p_observer;
+        uint32_t                     mask = UINT32_MAX;
+
+        if (idx == NRF_SDH_DISPATCH_OBSERVERS_MAX)
+        {
+            NRF_LOG_WARNING("Too many SoC observers, dispatch table not used.");
+            return;
+        }
+
+        p_observer           = (nrf_sdh_soc_evt_observer_t *) nrf_section_iter_get(&iter);
+        m_soc_observers[idx] = p_observer;
+        if (p_observer->handler == nrf_sdh_dispatch_soc_mask_handler)
+        {
+            mask = ((nrf_sdh_soc_mask_t *)p_observer->p_context)->evt_mask;
+        }
+
+        for (uint32_t id = 0; id < SOC_EVT_ID_COUNT; id++)
+        {
+            if (mask & (1UL << id))
+            {
+                entry_set(m_soc_table[id], idx);
+            }
+        }
+    }
+
+    NRF_LOG_DEBUG("SoC dispatch table built, %d observers.", idx);
+    m_soc_table_valid = true;
+}
+
+
+/**@brief   Function for passing a SoC event to the observers. */
+static void soc_evt_dispatch(uint32_t evt_id)
+{
+    nrf_section_iter_t iter;
+
+    if (m_soc_table_valid && (evt_id < SOC_EVT_ID_COUNT))
+    {
+        dispatch_entry_t entry;
+        uint32_t         word = 0;
+        uint32_t         idx;
+
+        memcpy(entry, m_soc_table[evt_id], sizeof(entry));
+        while ((idx = entry_first_pop(entry, &word)) != NRF_SDH_DISPATCH_OBSERVERS_MAX)
+        {
+            nrf_sdh_soc_evt_observer_t * p_observer = m_soc_observers[idx];
+
+            if (p_observer->handler == nrf_sdh_dispatch_soc_mask_handler)
+            {
+                // The table already holds the mask check.
+                nrf_sdh_soc_mask_t * p_mask = (nrf_sdh_soc_mask_t *)p_observer->p_context;
+                p_mask->handler(evt_id, p_mask->p_context);
+            }
+            else
+            {
+                p_observer->handler(evt_id, p_observer->p_context);
+            }
+        }
+        return;
+    }
+
+    for (nrf_section_iter_init(&iter, &sdh_soc_observers);
+         nrf_section_iter_get(&iter) != NULL;
+         nrf_section_iter_next(&iter))
+    {
+        nrf_sdh_soc_evt_observer_t * p_observer;
+
+        p_observer = (nrf_sdh_soc_evt_observer_t *) nrf_section_iter_get(&iter);
+        p_observer->handler(evt_id, p_observer->p_context);
+    }
+}
+
+
+/**@brief   Function for taking SoC events from the SoftDevice.
+ *
+ * @param[in,out]   p_budget    Number of events which may still be taken.
+ *
+ * @retval  true    No SoC events are left.
+ * @retval  false   The budget was used up.
+ */
+static bool soc_evts_poll(uint32_t * p_budget)
+{
+    ret_code_t ret_code;
+
+    while (*p_budget > 0)
+    {
+        uint32_t evt_id;
+
+        ret_code = sd_evt_get(&evt_id);
+        if (ret_code == NRF_ERROR_NOT_FOUND)
+        {
+            return true;
+        }
+        if (ret_code != NRF_SUCCESS)
+        {
+            APP_ERROR_HANDLER(ret_code);
+            return true;
+        }
+
+        NRF_LOG_DEBUG("SoC event: 0x%x.", evt_id);
+        NRF_TRACE_MARK_START(NRF_TRACE_MARKER_SDH_SOC | evt_id);
+        soc_evt_dispatch(evt_id);
+        NRF_TRACE_MARK_STOP(NRF_TRACE_MARKER_SDH_SOC | evt_id);
+        (*p_budget)--;
+    }
+
+    return false;
+}
+#endif // NRF_MODULE_ENABLED(NRF_SDH_SOC)
+
+
+bool nrf_sdh_dispatch_poll(void)
+{
+    uint32_t budget = (NRF_SDH_DISPATCH_EVT_BUDGET != 0) ? NRF_SDH_DISPATCH_EVT_BUDGET : UINT32_MAX;
+    bool     done   = true;
+
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE) && NRF_SDH_DISPATCH_PROFILER_ENABLED
+    // Without the event interrupt, event age is measured from the first poll that finds them.
+    nrf_sdh_dispatch_pend_mark();
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_SDH_SOC)
+    done = soc_evts_poll(&budget);
+#endif
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE)
+    done = done && ble_evts_poll(&budget);
+#if NRF_SDH_DISPATCH_PROFILER_ENABLED
+    if (done)
+    {
+        m_pend_marked = false;
+    }
+#endif
+#endif
+
+    return done;
+}
+
+
+bool nrf_sdh_dispatch_is_starved(void)
+{
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE) && BLE_EVT_POOL
+    return m_ble_evt_pool_starved;
+#else
+    return false;
+#endif
+}
+
+
+/**@brief   Function for building the dispatch tables when the SoftDevice is being enabled.
+ *
+ * @param[in]   state       State event.
+ * @param[in]   p_context   Context.
+ */
+static void sdh_state_evt_handler(nrf_sdh_state_evt_t state, void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    if (state == NRF_SDH_EVT_STATE_ENABLE_PREPARE)
+    {
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE)
+        ble_table_build();
+#if BLE_EVT_POOL
+        // Events retained before the SoftDevice was disabled stay valid.
+        if (!m_ble_evt_pool_init)
+        {
+            APP_ERROR_CHECK(nrf_balloc_init(&m_ble_evt_pool));
+            m_ble_evt_pool_init = true;
+        }
+#endif
+#if NRF_SDH_DISPATCH_PROFILER_ENABLED
+        // Enable the DWT cycle counter used for handler run time and event age.
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+#endif
+#if NRF_MODULE_ENABLED(NRF_SDH_SOC)
+        soc_table_build();
+#endif
+    }
+}
+
+NRF_SDH_STATE_OBSERVER(m_nrf_sdh_dispatch_state_observer, 0) =
+{
+    .handler   = sdh_state_evt_handler,
+    .p_context = NULL,
+};
+
+#endif // NRF_MODULE_ENABLED(NRF_SDH_DISPATCH)
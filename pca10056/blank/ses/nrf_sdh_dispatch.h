@@ -0,0 +1,288 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_sdh_dispatch Filtered SoftDevice event dispatch
+ * @{
+ * @ingroup  nrf_sdh
+ * @brief    Dispatch of BLE and SoC events only to the observers interested in them, in batches.
+ *
+ * @details An observer defined with @ref NRF_SDH_BLE_RANGE_OBSERVER or
+ *          @ref NRF_SDH_SOC_MASK_OBSERVER declares which events it handles. It is registered in
+ *          the same section as the regular observers, so the priority order is kept. When the
+ *          SoftDevice is being enabled, a table stating which observers get each event ID is
+ *          built, and events are passed only to those observers. Regular observers get all
+ *          events, as before.
+ *
+ *          @ref nrf_sdh_evts_poll takes the events from the SoftDevice itself, at most
+ *          NRF_SDH_DISPATCH_EVT_BUDGET of them per call. If more events are pending, the call is
+ *          repeated later: the SoftDevice event interrupt is pended again, or another
+ *          app_scheduler event is put, depending on NRF_SDH_DISPATCH_MODEL. With the polling
+ *          model, the next call from the main loop takes the rest.
+ *
+ *          If there are more than NRF_SDH_DISPATCH_OBSERVERS_MAX observers, or an event ID is
+ *          outside the table, observers are walked in order and the filtered ones check the ID
+ *          themselves.
+ *
+ *          With NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE set, BLE events are taken into reference
+ *          counted blocks of a pool, and an observer can keep an event with
+ *          @ref nrf_sdh_dispatch_ble_evt_get rather than copy it.
+ */
+
+#ifndef NRF_SDH_DISPATCH_H__
+#define NRF_SDH_DISPATCH_H__
+
+#include "sdk_common.h"
+#include "nrf_sdh_soc.h"
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE)
+#include "nrf_sdh_ble.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE) || defined(__SDK_DOXYGEN__)
+/**@brief Range of BLE events handled by an observer. */
+typedef struct
+{
+    uint16_t                  first_id;  //!< First BLE event ID handled.
+    uint16_t                  last_id;   //!< Last BLE event ID handled.
+    nrf_sdh_ble_evt_handler_t handler;   //!< BLE event handler.
+    void                    * p_context; //!< A parameter to the event handler.
+} const nrf_sdh_ble_range_t;
+
+/**@brief Handler of the regular observer entry of a BLE range observer.
+ *
+ * @details Used as the marker of such entries, and checks the range when the entry is called
+ *          as a regular observer.
+ *
+ * @param[in] p_ble_evt BLE event.
+ * @param[in] p_context Pointer to the @ref nrf_sdh_ble_range_t of the observer.
+ */
+void nrf_sdh_dispatch_ble_range_handler(ble_evt_t const * p_ble_evt, void * p_context);
+
+/**@brief   Macro for registering a BLE observer of a range of event IDs.
+ *
+ * @param[in]   _name       Observer name.
+ * @param[in]   _prio       Priority of the observer event handler, same as for
+ *                          NRF_SDH_BLE_OBSERVER.
+ * @param[in]   _first_id   First BLE event ID handled, for example BLE_GAP_EVT_BASE.
+ * @param[in]   _last_id    Last BLE event ID handled, for example BLE_GAP_EVT_LAST.
+ * @param[in]   _handler    BLE event handler.
+ * @param[in]   _context    Parameter to the event handler.
+ * @hideinitializer
+ */
+#define NRF_SDH_BLE_RANGE_OBSERVER(_name, _prio, _first_id, _last_id, _handler, _context)       \
+STATIC_ASSERT((_first_id) <= (_last_id), "Invalid BLE event range.");                          \
+static nrf_sdh_ble_range_t CONCAT_2(_name, _range) =                                           \
+{                                                                                              \
+    .first_id  = (_first_id),                                                                  \
+    .last_id   = (_last_id),                                                                   \
+    .handler   = (_handler),                                                                   \
+    .p_context = (_context),                                                                   \
+};                                                                                             \
+NRF_SDH_BLE_OBSERVER(_name, _prio, nrf_sdh_dispatch_ble_range_handler,                         \
+                     (void *)&CONCAT_2(_name, _range))
+#endif // NRF_MODULE_ENABLED(NRF_SDH_BLE)
+
+/**@brief SoC events handled by an observer. */
+typedef struct
+{
+    uint32_t                  evt_mask;  //!< Bit n set if the SoC event with ID n is handled.
+    nrf_sdh_soc_evt_handler_t handler;   //!< SoC event handler.
+    void                    * p_context; //!< A parameter to the event handler.
+} const nrf_sdh_soc_mask_t;
+
+/**@brief Handler of the regular observer entry of a SoC mask observer.
+ *
+ * @param[in] evt_id    SoC event ID.
+ * @param[in] p_context Pointer to the @ref nrf_sdh_soc_mask_t of the observer.
+ */
+void nrf_sdh_dispatch_soc_mask_handler(uint32_t evt_id, void * p_context);
+
+/**@brief   Macro for registering a SoC observer of a set of event IDs.
+ *
+ * @param[in]   _name       Observer name.
+ * @param[in]   _prio       Priority of the observer event handler, same as for
+ *                          NRF_SDH_SOC_OBSERVER.
+ * @param[in]   _evt_mask   Mask of the handled event IDs, for example
+ *                          (1UL << NRF_EVT_FLASH_OPERATION_SUCCESS).
+ * @param[in]   _handler    SoC event handler.
+ * @param[in]   _context    Parameter to the event handler.
+ * @hideinitializer
+ */
+#define NRF_SDH_SOC_MASK_OBSERVER(_name, _prio, _evt_mask, _handler, _context)                  \
+static nrf_sdh_soc_mask_t CONCAT_2(_name, _mask) =                                             \
+{                                                                                              \
+    .evt_mask  = (_evt_mask),                                                                  \
+    .handler   = (_handler),                                                                   \
+    .p_context = (_context),                                                                   \
+};                                                                                             \
+NRF_SDH_SOC_OBSERVER(_name, _prio, nrf_sdh_dispatch_soc_mask_handler,                          \
+                     (void *)&CONCAT_2(_name, _mask))
+
+#if (NRF_MODULE_ENABLED(NRF_SDH_BLE) && NRF_SDH_DISPATCH_PROFILER_ENABLED) || defined(__SDK_DOXYGEN__)
+/**@brief Observer index of the profiler entries holding the age of BLE events when dispatched. */
+#define NRF_SDH_DISPATCH_PROFILE_LATENCY    0xFF
+
+/**@brief Profiler entry of a BLE observer and event ID.
+ *
+ * @details Run time of an observer handler is measured with the DWT cycle counter around the
+ *          call. Event age is counted from the SoftDevice event interrupt, or from the poll
+ *          in the polling model, to the dispatch of the event. It is kept in entries with
+ *          @ref NRF_SDH_DISPATCH_PROFILE_LATENCY as the observer index.
+ */
+typedef struct
+{
+    uint8_t  observer;      //!< Index of the observer in the BLE observer section.
+    uint16_t evt_id;        //!< BLE event ID.
+    uint32_t count;         //!< Number of handler calls or events.
+    uint32_t cycles_max;    //!< Longest handler run or largest event age, in CPU cycles.
+    uint64_t cycles_sum;    //!< Sum of handler runs or event ages, in CPU cycles.
+} nrf_sdh_dispatch_profile_t;
+
+/**@brief   Function for marking the time when the SoftDevice signalled events.
+ *
+ * @details Called from SD_EVT_IRQHandler. Only the first mark until all events are taken is kept.
+ */
+void nrf_sdh_dispatch_pend_mark(void);
+
+/**@brief   Function for getting a profiler entry.
+ *
+ * @param[in]   idx     Index of the entry, from 0.
+ * @param[out]  p_entry Copy of the entry.
+ *
+ * @retval  NRF_SUCCESS         If the entry was copied.
+ * @retval  NRF_ERROR_NOT_FOUND If there are fewer entries.
+ */
+ret_code_t nrf_sdh_dispatch_profile_get(uint32_t idx, nrf_sdh_dispatch_profile_t * p_entry);
+
+/**@brief   Function for getting the number of records which did not fit in the entries. */
+uint32_t nrf_sdh_dispatch_profile_dropped_get(void);
+
+/**@brief   Function for clearing all profiler entries. */
+void nrf_sdh_dispatch_profile_reset(void);
+
+/**@brief   Function for printing all profiler entries with nrf_log.
+ *
+ * @details Observers are printed with their index and handler address, which can be looked up in
+ *          the map file.
+ */
+void nrf_sdh_dispatch_profile_log(void);
+#endif // NRF_MODULE_ENABLED(NRF_SDH_BLE) && NRF_SDH_DISPATCH_PROFILER_ENABLED
+
+#if (NRF_MODULE_ENABLED(NRF_SDH_BLE) && (NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE > 0)) || defined(__SDK_DOXYGEN__)
+/**@brief   Function for keeping a BLE event after the observer handler returns.
+ *
+ * @details With NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE set, each BLE event is taken from the
+ *          SoftDevice into a block of a pool, held by the dispatch while the observers are called.
+ *          An observer which defers the handling of the event, for example to app_scheduler or
+ *          to a queue, can pass the pointer on instead of copying the event, after calling this
+ *          function. The block is freed when the dispatch and every holder have called
+ *          @ref nrf_sdh_dispatch_ble_evt_put.
+ *
+ *          While all blocks are held, no BLE events are taken from the SoftDevice. They are
+ *          taken when a block is freed, so the pool must hold the events retained at a time plus
+ *          one.
+ *
+ * @param[in]   p_ble_evt   BLE event passed to the observer.
+ *
+ * @retval  NRF_SUCCESS             If the event is retained.
+ * @retval  NRF_ERROR_INVALID_PARAM If the event is not from the pool, for example an event built
+ *                                  by the application. The event must be copied instead.
+ */
+ret_code_t nrf_sdh_dispatch_ble_evt_get(ble_evt_t const * p_ble_evt);
+
+/**@brief   Function for releasing a BLE event retained with @ref nrf_sdh_dispatch_ble_evt_get.
+ *
+ * @details The event must not be used after the call. May be called from any context.
+ *
+ * @param[in]   p_ble_evt   Retained BLE event.
+ */
+void nrf_sdh_dispatch_ble_evt_put(ble_evt_t const * p_ble_evt);
+#endif // NRF_MODULE_ENABLED(NRF_SDH_BLE) && (NRF_SDH_DISPATCH_BLE_EVT_POOL_SIZE > 0)
+
+#if NRF_MODULE_ENABLED(NRF_SDH_BLE) || defined(__SDK_DOXYGEN__)
+/**@brief   Function for passing a BLE event that does not come from the SoftDevice to the
+ *          observers.
+ *
+ * @details Used to replay recorded events, see @ref nrf_sdh_ble_trace. The event goes through
+ *          the same table and profiler entries as events from the SoftDevice, but no event age
+ *          is recorded for it. Must be called in the context the SoftDevice events are passed in.
+ *
+ * @param[in]   p_ble_evt   BLE event, aligned to 4 bytes.
+ */
+void nrf_sdh_dispatch_ble_evt_inject(ble_evt_t const * p_ble_evt);
+#endif // NRF_MODULE_ENABLED(NRF_SDH_BLE)
+
+/**@brief   Function for taking events from the SoftDevice and passing them to the observers.
+ *
+ * @details Called by @ref nrf_sdh_evts_poll before the stack observers.
+ *
+ * @retval  true    No events are left.
+ * @retval  false   The budget was used up, or no pooled event is free, and events may be left.
+ */
+bool nrf_sdh_dispatch_poll(void);
+
+/**@brief   Function for checking if @ref nrf_sdh_dispatch_poll stopped because all pooled BLE
+ *          events are held.
+ *
+ * @details The poll is then repeated by @ref nrf_sdh_dispatch_ble_evt_put, not at once.
+ *
+ * @retval  true    All pooled events are held and BLE events are left.
+ * @retval  false   Otherwise, or if the pool is not used.
+ */
+bool nrf_sdh_dispatch_is_starved(void);
+
+/**@brief   Function for making @ref nrf_sdh_evts_poll run again for the events left.
+ *
+ * @details Implemented in nrf_sdh.c for the selected NRF_SDH_DISPATCH_MODEL. In the polling
+ *          model, nothing is done, as the next call from the main loop takes the rest.
+ */
+void nrf_sdh_evts_poll_repeat(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_SDH_DISPATCH_H__
+
+/** @} */
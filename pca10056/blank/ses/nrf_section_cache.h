@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_section_cache Section set item cache
+ * @{
+ * @ingroup nrf_section_iter
+ *
+ * @brief Flat array of pointers to the items of a section set.
+ *
+ * @details Walking a section set with nrf_section_iter_next() checks the section boundaries on
+ *          every step. A cache is filled once with @ref nrf_section_cache_build, for example when
+ *          a module is initialized, and holds pointers to all items in the priority order of the
+ *          set. Dispatch loops then go over the items as a plain pointer range from
+ *          @ref nrf_section_cache_begin to @ref nrf_section_cache_end.
+ *
+ *          Section contents are fixed at link time, so a cache stays valid once built.
+ */
+
+#ifndef NRF_SECTION_CACHE_H__
+#define NRF_SECTION_CACHE_H__
+
+#include <stddef.h>
+#include "sdk_common.h"
+#include "nrf_section_iter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Section set item cache. */
+typedef struct
+{
+    void const ** pp_items; //!< Buffer of item pointers.
+    size_t        size;     //!< Number of pointers the buffer holds.
+    size_t        count;    //!< Number of cached items.
+} nrf_section_cache_t;
+
+/**@brief Macro for defining a section set item cache.
+ *
+ * @param[in] _name Name of the cache.
+ * @param[in] _size Maximum number of items.
+ */
+#define NRF_SECTION_CACHE_DEF(_name, _size)                     \
+    static void const * CONCAT_2(_name, _items)[(_size)];       \
+    static nrf_section_cache_t _name =                          \
+    {                                                           \
+        .pp_items = CONCAT_2(_name, _items),                    \
+        .size     = (_size),                                    \
+        .count    = 0,                                          \
+    }
+
+/**@brief Function for filling a cache with the items of a section set.
+ *
+ * @param[in,out] p_cache Cache.
+ * @param[in]     p_set   Section set.
+ *
+ * @retval NRF_SUCCESS      If all items are cached.
+ * @retval NRF_ERROR_NO_MEM If the set has more items than the cache holds. The cache is emptied.
+ */
+ret_code_t nrf_section_cache_build(nrf_section_cache_t * p_cache, nrf_section_set_t const * p_set);
+
+/**@brief Function for getting the pointer to the first cached item pointer.
+ *
+ * @param[in] p_cache Cache.
+ *
+ * @return Start of the item pointer range.
+ */
+__STATIC_INLINE void const * const * nrf_section_cache_begin(nrf_section_cache_t const * p_cache)
+{
+    return p_cache->pp_items;
+}
+
+/**@brief Function for getting the pointer past the last cached item pointer.
+ *
+ * @param[in] p_cache Cache.
+ *
+ * @return End of the item pointer range.
+ */
+__STATIC_INLINE void const * const * nrf_section_cache_end(nrf_section_cache_t const * p_cache)
+{
+    return p_cache->pp_items + p_cache->count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_SECTION_CACHE_H__
+
+/** @} */
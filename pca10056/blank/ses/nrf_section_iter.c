@@ -43,6 +43,7 @@
 #if NRF_MODULE_ENABLED(NRF_SECTION_ITER)
 
 #include "nrf_section_iter.h"
+#include "nrf_section_cache.h"
 
 
 #if !defined(__GNUC__)
@@ -122,4 +123,29 @@ void nrf_section_iter_next(nrf_section_iter_t * p_iter)
 #endif
 }
 
+ret_code_t nrf_section_cache_build(nrf_section_cache_t * p_cache, nrf_section_set_t const * p_set)
+{
+    nrf_section_iter_t iter;
+    size_t             count = 0;
+
+    ASSERT(p_cache != NULL);
+    ASSERT(p_set   != NULL);
+
+    p_cache->count = 0;
+
+    for (nrf_section_iter_init(&iter, p_set);
+         nrf_section_iter_get(&iter) != NULL;
+         nrf_section_iter_next(&iter))
+    {
+        if (count == p_cache->size)
+        {
+            return NRF_ERROR_NO_MEM;
+        }
+        p_cache->pp_items[count++] = nrf_section_iter_get(&iter);
+    }
+
+    p_cache->count = count;
+    return NRF_SUCCESS;
+}
+
 #endif // NRF_MODULE_ENABLED(NRF_SECTION_ITER)
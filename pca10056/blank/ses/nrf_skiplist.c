@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_SKIPLIST)
+#include "nrf_skiplist.h"
+#include "nrf_assert.h"
+
+#define NRF_LOG_MODULE_NAME skiplist
+#if NRF_SKIPLIST_CONFIG_LOG_ENABLED
+    #define NRF_LOG_LEVEL       NRF_SKIPLIST_CONFIG_LOG_LEVEL
+    #define NRF_LOG_INFO_COLOR  NRF_SKIPLIST_CONFIG_INFO_COLOR
+    #define NRF_LOG_DEBUG_COLOR NRF_SKIPLIST_CONFIG_DEBUG_COLOR
+#else
+    #define NRF_LOG_LEVEL       0
+#endif // NRF_SKIPLIST_CONFIG_LOG_ENABLED
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+STATIC_ASSERT((NRF_SKIPLIST_CONFIG_MAX_LEVEL >= 1) && (NRF_SKIPLIST_CONFIG_MAX_LEVEL <= UINT8_MAX));
+
+/**
+ * @brief Function for drawing the level of a new item.
+ *
+ * Each level above the first is taken with probability 1/4, using a xorshift generator.
+ */
+static uint8_t level_draw(nrf_skiplist_cb_t * p_cb)
+{
+    uint32_t x = p_cb->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    p_cb->seed = x;
+
+    uint8_t level = 1;
+    while ((level < NRF_SKIPLIST_CONFIG_MAX_LEVEL) && ((x & 0x3) == 0))
+    {
+        level++;
+        x >>= 2;
+    }
+    return level;
+}
+
+void nrf_skiplist_add(nrf_skiplist_t const * p_list, nrf_skiplist_item_t * p_item)
+{
+    ASSERT(p_list);
+    ASSERT(p_item);
+
+    nrf_skiplist_cb_t *   p_cb = p_list->p_cb;
+    nrf_skiplist_item_t * p_update[NRF_SKIPLIST_CONFIG_MAX_LEVEL];
+    nrf_skiplist_item_t * p_curr = &p_cb->head;
+
+    for (int32_t i = p_cb->level - 1; i >= 0; i--)
+    {
+        while ((p_curr->p_next[i] != NULL) && p_list->compare_func(p_curr->p_next[i], p_item))
+        {
+            p_curr = p_curr->p_next[i];
+        }
+        p_update[i] = p_curr;
+    }
+
+    uint8_t level = level_draw(p_cb);
+    while (p_cb->level < level)
+    {
+        p_update[p_cb->level] = &p_cb->head;
+        p_cb->level++;
+    }
+
+    p_item->level = level;
+    for (uint32_t i = 0; i < level; i++)
+    {
+        p_item->p_next[i]     = p_update[i]->p_next[i];
+        p_update[i]->p_next[i] = p_item;
+    }
+
+    NRF_LOG_INFO("List:%s, adding element:%08X level:%d, before:%08X",
+                                  p_list->p_name, p_item, level, p_item->p_next[0]);
+}
+
+nrf_skiplist_item_t * nrf_skiplist_pop(nrf_skiplist_t const * p_list)
+{
+    ASSERT(p_list);
+    nrf_skiplist_cb_t *   p_cb = p_list->p_cb;
+    nrf_skiplist_item_t * ret  = p_cb->head.p_next[0];
+    if (ret != NULL)
+    {
+        // First item is the first one on every level it is linked on.
+        for (uint32_t i = 0; i < ret->level; i++)
+        {
+            p_cb->head.p_next[i] = ret->p_next[i];
+        }
+    }
+    NRF_LOG_INFO("List:%s, poping element:%08X", p_list->p_name, ret);
+    return ret;
+}
+
+nrf_skiplist_item_t const * nrf_skiplist_peek(nrf_skiplist_t const * p_list)
+{
+    ASSERT(p_list);
+    return p_list->p_cb->head.p_next[0];
+}
+
+nrf_skiplist_item_t const * nrf_skiplist_next(nrf_skiplist_item_t const * p_item)
+{
+    ASSERT(p_item);
+    return p_item->p_next[0];
+}
+
+bool nrf_skiplist_remove(nrf_skiplist_t const * p_list, nrf_skiplist_item_t * p_item)
+{
+    ASSERT(p_list);
+    ASSERT(p_item);
+
+    nrf_skiplist_cb_t *   p_cb = p_list->p_cb;
+    nrf_skiplist_item_t * p_update[NRF_SKIPLIST_CONFIG_MAX_LEVEL];
+    nrf_skiplist_item_t * p_curr = &p_cb->head;
+    bool                  ret    = false;
+
+    // Find the last item strictly before p_item on each level, then walk over the items that
+    // compare equal to p_item until the item itself is found.
+    for (int32_t i = p_cb->level - 1; i >= 0; i--)
+    {
+        while ((p_curr->p_next[i] != NULL) &&
+               (p_curr->p_next[i] != p_item) &&
+               !p_list->compare_func(p_item, p_curr->p_next[i]))
+        {
+            p_curr = p_curr->p_next[i];
+        }
+        p_update[i] = p_curr;
+    }
+
+    p_curr = p_update[0];
+    while ((p_curr->p_next[0] != NULL) &&
+           (p_curr->p_next[0] != p_item) &&
+           p_list->compare_func(p_curr->p_next[0], p_item))
+    {
+        p_curr = p_curr->p_next[0];
+    }
+
+    if (p_curr->p_next[0] == p_item)
+    {
+        for (uint32_t i = 0; i < p_item->level; i++)
+        {
+            p_curr = p_update[i];
+            while (p_curr->p_next[i] != p_item)
+            {
+                ASSERT(p_curr->p_next[i] != NULL);
+                p_curr = p_curr->p_next[i];
+            }
+            p_curr->p_next[i] = p_item->p_next[i];
+        }
+
+        while ((p_cb->level > 1) && (p_cb->head.p_next[p_cb->level - 1] == NULL))
+        {
+            p_cb->level--;
+        }
+        ret = true;
+    }
+
+    NRF_LOG_INFO("List:%s, removing element:%08X %s",
+                                  p_list->p_name, p_item, ret ? "succeeded" : "not found");
+    return ret;
+}
+#endif //NRF_SKIPLIST_ENABLED
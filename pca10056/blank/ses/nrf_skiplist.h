@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_skiplist Skip list
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Ordered set with O(log n) insert and remove, for sets too large for nrf_sortlist.
+ *
+ * @details Items are ordered with a user compare function, same as in nrf_sortlist: the function
+ *          must return true when the first item is to be placed before or at the same position
+ *          as the second one. Items that compare equal keep insertion order.
+ *
+ *          Each item is linked on 1 to NRF_SKIPLIST_CONFIG_MAX_LEVEL levels, the level is drawn
+ *          from a pseudo random generator kept in the list control block (probability 1/4 per
+ *          level), so no memory is allocated. With p = 1/4, a maximum level of L handles sets of
+ *          up to about 4^L items in O(log n).
+ *
+ *          The first member of @ref nrf_skiplist_item_t is the level 0 link, so an item can be
+ *          iterated in order with @ref nrf_skiplist_next or, cast to nrf_sortlist_item_t, with
+ *          nrf_sortlist_next().
+ *
+ * @note The module is not thread safe, same as nrf_sortlist.
+ */
+
+#ifndef NRF_SKIPLIST_H__
+#define NRF_SKIPLIST_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef NRF_SKIPLIST_CONFIG_MAX_LEVEL
+#define NRF_SKIPLIST_CONFIG_MAX_LEVEL 6
+#endif
+
+/**@brief Skip list item. */
+typedef struct nrf_skiplist_item_s nrf_skiplist_item_t;
+
+struct nrf_skiplist_item_s
+{
+    nrf_skiplist_item_t * p_next[NRF_SKIPLIST_CONFIG_MAX_LEVEL]; ///< Next item on each level, p_next[0] is the next item in order.
+    uint8_t               level;                                 ///< Number of levels on which the item is linked.
+};
+
+/**
+ * @brief Function for comparing items.
+ *
+ * @param p_item0 Pointer to the first item.
+ * @param p_item1 Pointer to the second item.
+ *
+ * @return True if @p p_item0 is to be placed before or at the same position as @p p_item1.
+ */
+typedef bool (*nrf_skiplist_compare_func_t)(nrf_skiplist_item_t * p_item0,
+                                            nrf_skiplist_item_t * p_item1);
+
+/**@brief Skip list control block. */
+typedef struct
+{
+    nrf_skiplist_item_t head;  ///< Head item, its links point to the first item on each level.
+    uint32_t            seed;  ///< State of the level generator.
+    uint8_t             level; ///< Highest level in use.
+} nrf_skiplist_cb_t;
+
+/**@brief Skip list instance. */
+typedef struct
+{
+    nrf_skiplist_cb_t *         p_cb;         ///< Pointer to the control block.
+    nrf_skiplist_compare_func_t compare_func; ///< Compare function.
+    char const *                p_name;       ///< List name.
+} nrf_skiplist_t;
+
+/**@brief Macro for defining a skip list instance.
+ *
+ * @param _name         Instance name.
+ * @param _compare_func Compare function used to order the items.
+ */
+#define NRF_SKIPLIST_DEF(_name, _compare_func)                  \
+    static nrf_skiplist_cb_t CONCAT_2(_name, _sl_cb) =          \
+    {                                                           \
+        .seed  = 0x2545F491,                                    \
+        .level = 1                                              \
+    };                                                          \
+    static const nrf_skiplist_t _name =                         \
+    {                                                           \
+        .p_cb         = &CONCAT_2(_name, _sl_cb),               \
+        .compare_func = _compare_func,                          \
+        .p_name       = #_name                                  \
+    }
+
+/**
+ * @brief Function for adding an item to the list.
+ *
+ * The item is placed after all items that compare equal to it.
+ *
+ * @param p_list Pointer to the list instance.
+ * @param p_item Pointer to the item.
+ */
+void nrf_skiplist_add(nrf_skiplist_t const * p_list, nrf_skiplist_item_t * p_item);
+
+/**
+ * @brief Function for getting and removing the first item from the list.
+ *
+ * @param p_list Pointer to the list instance.
+ *
+ * @return Pointer to the first item or NULL if the list is empty.
+ */
+nrf_skiplist_item_t * nrf_skiplist_pop(nrf_skiplist_t const * p_list);
+
+/**
+ * @brief Function for getting the first item from the list without removing it.
+ *
+ * @param p_list Pointer to the list instance.
+ *
+ * @return Pointer to the first item or NULL if the list is empty.
+ */
+nrf_skiplist_item_t const * nrf_skiplist_peek(nrf_skiplist_t const * p_list);
+
+/**
+ * @brief Function for getting the next item in order.
+ *
+ * @param p_item Pointer to the current item.
+ *
+ * @return Pointer to the next item or NULL if @p p_item is the last one.
+ */
+nrf_skiplist_item_t const * nrf_skiplist_next(nrf_skiplist_item_t const * p_item);
+
+/**
+ * @brief Function for removing an item from the list.
+ *
+ * @param p_list Pointer to the list instance.
+ * @param p_item Pointer to the item.
+ *
+ * @retval true  Item was removed.
+ * @retval false Item was not found in the list.
+ */
+bool nrf_skiplist_remove(nrf_skiplist_t const * p_list, nrf_skiplist_item_t * p_item);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_SKIPLIST_H__
+
+/** @} */
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_SLAB)
+#include <string.h>
+#include "nrf_slab.h"
+#include "nrf_balloc_idx.h"
+#include "app_util_platform.h"
+#include "nrf_assert.h"
+
+/**@brief Function for getting the first class with blocks large enough for @p size. */
+__STATIC_INLINE uint32_t slab_class_get(nrf_slab_t const * p_slab, size_t size)
+{
+    if (size <= (1UL << p_slab->min_shift))
+    {
+        return 0;
+    }
+    // Number of bits needed to hold (size - 1) is the log2 of size rounded up.
+    return (32 - __CLZ((uint32_t)(size - 1))) - p_slab->min_shift;
+}
+
+/**@brief Function for checking if the pointer belongs to the pool memory. */
+__STATIC_INLINE bool slab_pool_contains(nrf_balloc_t const * p_pool, void const * p_mem)
+{
+    uint8_t const * p_begin = p_pool->p_memory_begin;
+    uint8_t const * p_end   = p_begin + (nrf_balloc_idx_pool_size_get(p_pool) * p_pool->block_size);
+
+    return ((uint8_t const *)p_mem >= p_begin) && ((uint8_t const *)p_mem < p_end);
+}
+
+ret_code_t nrf_slab_init(nrf_slab_t const * p_slab)
+{
+    ASSERT(p_slab);
+
+    for (uint32_t i = 0; i < p_slab->class_cnt; i++)
+    {
+        nrf_balloc_t const * p_pool = p_slab->pp_pools[i];
+
+        if (NRF_BALLOC_ELEMENT_SIZE(p_pool) < (1UL << (p_slab->min_shift + i)))
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+        ret_code_t ret = nrf_balloc_init(p_pool);
+        VERIFY_SUCCESS(ret);
+        memset(&p_slab->p_stats[i], 0, sizeof(p_slab->p_stats[i]));
+    }
+    return NRF_SUCCESS;
+}
+
+void * nrf_slab_alloc(nrf_slab_t const * p_slab, size_t size)
+{
+    ASSERT(p_slab);
+
+    uint32_t first = slab_class_get(p_slab, size);
+
+    for (uint32_t i = first; i < p_slab->class_cnt; i++)
+    {
+        void * p_mem = nrf_balloc_alloc(p_slab->pp_pools[i]);
+        if (p_mem != NULL)
+        {
+            nrf_slab_stats_t * p_stats = &p_slab->p_stats[i];
+
+            CRITICAL_REGION_ENTER();
+            p_stats->alloc_cnt++;
+            p_stats->fallback_cnt    += (i != first) ? 1 : 0;
+            p_stats->requested_bytes += size;
+            p_stats->in_use++;
+            if (p_stats->max_in_use < p_stats->in_use)
+            {
+                p_stats->max_in_use = p_stats->in_use;
+            }
+            CRITICAL_REGION_EXIT();
+            return p_mem;
+        }
+    }
+
+    if (first < p_slab->class_cnt)
+    {
+        CRITICAL_REGION_ENTER();
+        p_slab->p_stats[first].fail_cnt++;
+        CRITICAL_REGION_EXIT();
+    }
+    return NULL;
+}
+
+void nrf_slab_free(nrf_slab_t const * p_slab, void * p_mem)
+{
+    ASSERT(p_slab);
+    ASSERT(p_mem);
+
+    for (uint32_t i = 0; i < p_slab->class_cnt; i++)
+    {
+        if (slab_pool_contains(p_slab->pp_pools[i], p_mem))
+        {
+            nrf_balloc_free(p_slab->pp_pools[i], p_mem);
+
+            CRITICAL_REGION_ENTER();
+            p_slab->p_stats[i].in_use--;
+            CRITICAL_REGION_EXIT();
+            return;
+        }
+    }
+
+    // Block does not belong to any class of this allocator.
+    ASSERT(false);
+}
+
+void nrf_slab_stats_get(nrf_slab_t const * p_slab, uint8_t class_idx, nrf_slab_stats_t * p_stats)
+{
+    ASSERT(p_slab);
+    ASSERT(p_stats);
+    ASSERT(class_idx < p_slab->class_cnt);
+
+    CRITICAL_REGION_ENTER();
+    *p_stats = p_slab->p_stats[class_idx];
+    CRITICAL_REGION_EXIT();
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_SLAB)
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_slab Size class allocator
+ * @{
+ * @ingroup nrf_balloc
+ *
+ * @brief Allocator of variable sized blocks built on nrf_balloc pools of power of two sizes.
+ *
+ * @details Each size class is an nrf_balloc pool defined by the user. Class i holds blocks of
+ *          (1 << (min_shift + i)) bytes. A request is served from the smallest class that fits
+ *          it, or from the next larger class if that one is empty. The class of a freed block
+ *          is found from the address range of the pools, so no header is stored with the blocks.
+ *          Statistics are kept per class to help sizing the pools.
+ *
+ * @code
+ * NRF_BALLOC_DEF(m_slab_16,  16,  32);
+ * NRF_BALLOC_DEF(m_slab_32,  32,  16);
+ * NRF_BALLOC_DEF(m_slab_64,  64,  8);
+ * NRF_SLAB_DEF(m_slab, 4, &m_slab_16, &m_slab_32, &m_slab_64);
+ * @endcode
+ */
+
+#ifndef NRF_SLAB_H__
+#define NRF_SLAB_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sdk_errors.h"
+#include "nrf_balloc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Statistics of a size class. */
+typedef struct
+{
+    uint32_t alloc_cnt;       ///< Number of blocks allocated from the class.
+    uint32_t fallback_cnt;    ///< Number of those allocations made because a smaller class was empty.
+    uint32_t fail_cnt;        ///< Number of requests fitting the class that could not be served.
+    uint32_t requested_bytes; ///< Sum of the sizes requested in the allocations from the class.
+    uint16_t in_use;          ///< Number of blocks currently allocated.
+    uint16_t max_in_use;      ///< Maximum number of blocks allocated at the same time.
+} nrf_slab_stats_t;
+
+/**@brief Slab allocator instance. */
+typedef struct
+{
+    nrf_balloc_t const * const * pp_pools;  ///< Pools of the classes, smallest first.
+    nrf_slab_stats_t *           p_stats;   ///< Statistics of the classes.
+    uint8_t                      class_cnt; ///< Number of classes.
+    uint8_t                      min_shift; ///< Block size of the first class is (1 << min_shift).
+} nrf_slab_t;
+
+/**
+ * @brief Macro for defining a slab allocator instance.
+ *
+ * @param _name      Instance name.
+ * @param _min_shift Block size of the smallest class is (1 << _min_shift) bytes.
+ * @param ...        Pointers to the nrf_balloc pools of the classes, smallest first. The element
+ *                   size of pool i must be at least (1 << (_min_shift + i)) bytes.
+ */
+#define NRF_SLAB_DEF(_name, _min_shift, ...)                                             \
+    static nrf_balloc_t const * const CONCAT_2(_name, _pools)[] = {__VA_ARGS__};         \
+    static nrf_slab_stats_t CONCAT_2(_name, _stats)[ARRAY_SIZE(CONCAT_2(_name, _pools))]; \
+    static const nrf_slab_t _name =                                                      \
+    {                                                                                    \
+        .pp_pools  = CONCAT_2(_name, _pools),                                            \
+        .p_stats   = CONCAT_2(_name, _stats),                                            \
+        .class_cnt = ARRAY_SIZE(CONCAT_2(_name, _pools)),                                \
+        .min_shift = (_min_shift),                                                       \
+    }
+
+/**
+ * @brief Function for initializing the slab allocator and its pools.
+ *
+ * @param[in] p_slab Pointer to the instance.
+ *
+ * @retval NRF_SUCCESS             Initialization successful.
+ * @retval NRF_ERROR_INVALID_PARAM Elements of a pool are smaller than the block size of its class.
+ */
+ret_code_t nrf_slab_init(nrf_slab_t const * p_slab);
+
+/**
+ * @brief Function for allocating a block.
+ *
+ * @param[in] p_slab Pointer to the instance.
+ * @param[in] size   Requested size in bytes.
+ *
+ * @return Pointer to the block or NULL if no class that fits @p size has a free block.
+ */
+void * nrf_slab_alloc(nrf_slab_t const * p_slab, size_t size);
+
+/**
+ * @brief Function for freeing a block.
+ *
+ * @param[in] p_slab Pointer to the instance.
+ * @param[in] p_mem  Pointer to the block returned by @ref nrf_slab_alloc.
+ */
+void nrf_slab_free(nrf_slab_t const * p_slab, void * p_mem);
+
+/**
+ * @brief Function for getting the statistics of a class.
+ *
+ * @param[in]  p_slab    Pointer to the instance.
+ * @param[in]  class_idx Class index, 0 is the smallest class.
+ * @param[out] p_stats   Statistics.
+ */
+void nrf_slab_stats_get(nrf_slab_t const * p_slab, uint8_t class_idx, nrf_slab_stats_t * p_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_SLAB_H__
+
+/** @} */
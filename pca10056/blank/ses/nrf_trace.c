@@ -0,0 +1,412 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_TRACE)
+#include "nrf_trace.h"
+#include <string.h>
+#include "nrf.h"
+#include "nrf_atomic.h"
+#include "SEGGER_RTT.h"
+
+#define NRF_LOG_MODULE_NAME nrf_trace
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define RECORD_MASK      (NRF_TRACE_CONFIG_RECORDS - 1)  /**< Mask of the record index. */
+#define PACKET_MAX_LEN   32                              /**< Size of the largest packet, except the system description. */
+#define SYSDESC_MAX_LEN  128                             /**< Longest system description accepted by the host. */
+
+/**@brief Commands of the host. */
+#define CMD_START           1
+#define CMD_STOP            2
+#define CMD_GET_SYSTIME     3
+#define CMD_GET_SYSDESC     5
+#define CMD_GET_NUMMODULES  6
+
+STATIC_ASSERT(IS_POWER_OF_TWO(NRF_TRACE_CONFIG_RECORDS));
+
+/**@brief Description of the system shown by the host. */
+static char const m_sysdesc[] =
+    "N=nRF5 SDK,D=nRF52840,O=NoOS,I#23=SAADC,I#33=RTC1,I#38=SD_EVT";
+
+STATIC_ASSERT(sizeof(m_sysdesc) <= SYSDESC_MAX_LEN);
+
+/**@brief Record of an event. */
+typedef struct
+{
+    uint32_t timestamp; //!< DWT cycle counter when the event was recorded.
+    uint32_t evt;       //!< Event word, 0 while the record is being written.
+} trace_record_t;
+
+static volatile trace_record_t m_records[NRF_TRACE_CONFIG_RECORDS];   /**< Records, indexed by sequence number. */
+static nrf_atomic_u32_t        m_wr_idx;                              /**< Sequence number of the next record to be taken. */
+static volatile uint32_t       m_rd_idx;                              /**< Sequence number of the next record to be sent. */
+static nrf_atomic_u32_t        m_dropped;                             /**< Records dropped and not yet reported to the host. */
+static uint32_t                m_dropped_total;                       /**< Records dropped since initialization. */
+static volatile bool           m_started;                             /**< True while the host is recording. */
+static uint32_t                m_last_timestamp;                      /**< Timestamp of the last packet sent. */
+
+static uint8_t m_up_buf[NRF_TRACE_CONFIG_RTT_BUFFER_SIZE];            /**< RTT buffer towards the host. */
+static uint8_t m_down_buf[8];                                         /**< RTT buffer for the commands of the host. */
+
+
+/**@brief Function for encoding an unsigned value in 7-bit groups, least significant first.
+ *
+ * @return Pointer past the encoded value.
+ */
+static uint8_t * u32_encode(uint8_t * p_dst, uint32_t value)
+{
+    while (value > 0x7F)
+    {
+        *p_dst++ = (uint8_t)(value | 0x80);
+        value  >>= 7;
+    }
+    *p_dst++ = (uint8_t)value;
+
+    return p_dst;
+}
+
+
+/**@brief Function for sending a packet to the host.
+ *
+ * @details The payload must start at @p p_packet + 2, which leaves room for the event ID and
+ *          the payload length. The timestamp delta is added after the payload, so the buffer
+ *          must have 5 bytes free past @p p_payload_end.
+ *
+ * @param[in] p_packet      Packet buffer.
+ * @param[in] p_payload_end End of the payload.
+ * @param[in] id            Event ID.
+ * @param[in] timestamp     Timestamp of the event.
+ *
+ * @retval true  If the packet was sent.
+ * @retval false If the RTT buffer is full. Nothing was sent.
+ */
+static bool packet_send(uint8_t * p_packet, uint8_t * p_payload_end, uint8_t id, uint32_t timestamp)
+{
+    uint8_t * p_start = &p_packet[2];
+    uint8_t * p_end;
+
+    if (id < 24)
+    {
+        // Events below 24 have an implicit payload length.
+        *--p_start = id;
+    }
+    else
+    {
+        uint8_t len = (uint8_t)(p_payload_end - p_start);
+
+        *--p_start = len;
+        *--p_start = id;
+    }
+
+    p_end = u32_encode(p_payload_end, timestamp - m_last_timestamp);
+
+    if (SEGGER_RTT_WriteSkipNoLock(NRF_TRACE_CONFIG_RTT_CHANNEL, p_start, p_end - p_start) == 0)
+    {
+        return false;
+    }
+
+    m_last_timestamp = timestamp;
+    return true;
+}
+
+
+/**@brief Function for sending a packet built from a record. */
+static bool record_send(uint32_t timestamp, uint32_t evt)
+{
+    uint8_t   packet[PACKET_MAX_LEN];
+    uint8_t * p_payload = &packet[2];
+    uint8_t   id        = (uint8_t)evt;
+
+    switch (id)
+    {
+        case NRF_TRACE_EVT_ISR_ENTER:
+        case NRF_TRACE_EVT_MARK_START:
+        case NRF_TRACE_EVT_MARK_STOP:
+        case NRF_TRACE_EVT_TIMER_ENTER:
+            p_payload = u32_encode(p_payload, evt >> 8);
+            break;
+
+        default:
+            break;
+    }
+
+    return packet_send(packet, p_payload, id, timestamp);
+}
+
+
+/**@brief Function for sending the system time. */
+static void systime_send(void)
+{
+    uint8_t   packet[PACKET_MAX_LEN];
+    uint32_t  now       = DWT->CYCCNT;
+    uint8_t * p_payload = u32_encode(&packet[2], now);
+
+    UNUSED_RETURN_VALUE(packet_send(packet, p_payload, NRF_TRACE_EVT_SYSTIME, now));
+}
+
+
+/**@brief Function for sending the system description. */
+static void sysdesc_send(void)
+{
+    uint8_t   packet[2 + 1 + SYSDESC_MAX_LEN + 5];
+    uint8_t * p_payload = &packet[2];
+
+    *p_payload++ = sizeof(m_sysdesc) - 1;
+    memcpy(p_payload, m_sysdesc, sizeof(m_sysdesc) - 1);
+    p_payload += sizeof(m_sysdesc) - 1;
+
+    UNUSED_RETURN_VALUE(packet_send(packet, p_payload, NRF_TRACE_EVT_SYSDESC, DWT->CYCCNT));
+}
+
+
+/**@brief Function for sending the number of modules, which is always 0. */
+static void nummodules_send(void)
+{
+    uint8_t   packet[PACKET_MAX_LEN];
+    uint8_t * p_payload = u32_encode(&packet[2], 0);
+
+    UNUSED_RETURN_VALUE(packet_send(packet, p_payload, NRF_TRACE_EVT_NUMMODULES, DWT->CYCCNT));
+}
+
+
+/**@brief Function for starting a recording on the request of the host. */
+static void trace_start(void)
+{
+    static uint8_t const sync[10] = {0};
+    uint8_t              packet[PACKET_MAX_LEN];
+    uint8_t            * p_payload;
+
+    if (m_started)
+    {
+        return;
+    }
+
+    // Records left by the previous recording may have been completed after it stopped.
+    memset((void *)m_records, 0, sizeof(m_records));
+    m_rd_idx         = m_wr_idx;
+    m_last_timestamp = DWT->CYCCNT;
+
+    UNUSED_RETURN_VALUE(SEGGER_RTT_WriteSkipNoLock(NRF_TRACE_CONFIG_RTT_CHANNEL, sync, sizeof(sync)));
+    UNUSED_RETURN_VALUE(packet_send(packet, &packet[2], NRF_TRACE_EVT_TRACE_START, DWT->CYCCNT));
+
+    p_payload = u32_encode(&packet[2], SystemCoreClock);     // Timestamp frequency.
+    p_payload = u32_encode(p_payload, SystemCoreClock);      // CPU frequency.
+    p_payload = u32_encode(p_payload, NRF_TRACE_RAM_BASE);
+    p_payload = u32_encode(p_payload, NRF_TRACE_ID_SHIFT);
+    UNUSED_RETURN_VALUE(packet_send(packet, p_payload, NRF_TRACE_EVT_INIT, DWT->CYCCNT));
+
+    sysdesc_send();
+    systime_send();
+    nummodules_send();
+
+    NRF_LOG_INFO("Recording started.");
+    m_started = true;
+}
+
+
+/**@brief Function for stopping a recording on the request of the host. */
+static void trace_stop(void)
+{
+    uint8_t packet[PACKET_MAX_LEN];
+
+    if (!m_started)
+    {
+        return;
+    }
+
+    // Records still in the buffer are of no use to the host any more.
+    m_started = false;
+    m_rd_idx  = m_wr_idx;
+
+    UNUSED_RETURN_VALUE(packet_send(packet, &packet[2], NRF_TRACE_EVT_TRACE_STOP, DWT->CYCCNT));
+    NRF_LOG_INFO("Recording stopped.");
+}
+
+
+/**@brief Function for handling the commands of the host. */
+static void commands_process(void)
+{
+    uint8_t cmd;
+
+    while (SEGGER_RTT_Read(NRF_TRACE_CONFIG_RTT_CHANNEL, &cmd, sizeof(cmd)) == sizeof(cmd))
+    {
+        switch (cmd)
+        {
+            case CMD_START:
+                trace_start();
+                break;
+
+            case CMD_STOP:
+                trace_stop();
+                break;
+
+            case CMD_GET_SYSTIME:
+                systime_send();
+                break;
+
+            case CMD_GET_SYSDESC:
+                sysdesc_send();
+                break;
+
+            case CMD_GET_NUMMODULES:
+                nummodules_send();
+                break;
+
+            default:
+                // No tasks and no modules to describe. Heartbeats need no answer.
+                break;
+        }
+    }
+}
+
+
+ret_code_t nrf_trace_init(void)
+{
+    int err;
+
+    // Enable the DWT cycle counter.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    memset((void *)m_records, 0, sizeof(m_records));
+    m_wr_idx        = 0;
+    m_rd_idx        = 0;
+    m_dropped       = 0;
+    m_dropped_total = 0;
+    m_started       = false;
+
+    err = SEGGER_RTT_ConfigUpBuffer(NRF_TRACE_CONFIG_RTT_CHANNEL, "SysView",
+                                    m_up_buf, sizeof(m_up_buf), SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+    if (err >= 0)
+    {
+        err = SEGGER_RTT_ConfigDownBuffer(NRF_TRACE_CONFIG_RTT_CHANNEL, "SysView",
+                                          m_down_buf, sizeof(m_down_buf), SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+    }
+
+    return (err < 0) ? NRF_ERROR_INVALID_PARAM : NRF_SUCCESS;
+}
+
+
+bool nrf_trace_process(void)
+{
+    uint32_t dropped;
+
+    commands_process();
+
+    if (!m_started)
+    {
+        return false;
+    }
+
+    dropped = nrf_atomic_u32_fetch_store(&m_dropped, 0);
+    if (dropped != 0)
+    {
+        uint8_t   packet[PACKET_MAX_LEN];
+        uint8_t * p_payload = u32_encode(&packet[2], dropped);
+
+        m_dropped_total += dropped;
+        if (!packet_send(packet, p_payload, NRF_TRACE_EVT_OVERFLOW, m_last_timestamp))
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_u32_add(&m_dropped, dropped));
+            m_dropped_total -= dropped;
+            return true;
+        }
+    }
+
+    while (m_rd_idx != m_wr_idx)
+    {
+        volatile trace_record_t * p_record = &m_records[m_rd_idx & RECORD_MASK];
+        uint32_t                  evt      = p_record->evt;
+
+        if (evt == 0)
+        {
+            // Taken by an interrupted context that has not finished writing it.
+            break;
+        }
+        if (!record_send(p_record->timestamp, evt))
+        {
+            return true;
+        }
+
+        p_record->evt = 0;
+        __DMB();
+        m_rd_idx++;
+    }
+
+    return false;
+}
+
+
+uint32_t nrf_trace_dropped_get(void)
+{
+    return m_dropped_total + m_dropped;
+}
+
+
+void nrf_trace_record(uint32_t evt)
+{
+    uint32_t idx;
+    uint32_t timestamp;
+
+    if (!m_started)
+    {
+        return;
+    }
+
+    do
+    {
+        idx = m_wr_idx;
+        // Taken before the exchange, so that a preempting record has both a later index and a
+        // later timestamp, or makes the exchange fail.
+        timestamp = DWT->CYCCNT;
+        if ((idx - m_rd_idx) >= NRF_TRACE_CONFIG_RECORDS)
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_u32_add(&m_dropped, 1));
+            return;
+        }
+    } while (!nrf_atomic_u32_cmp_exch(&m_wr_idx, &idx, idx + 1));
+
+    m_records[idx & RECORD_MASK].timestamp = timestamp;
+    __DMB();
+    m_records[idx & RECORD_MASK].evt       = evt;
+}
+
+#endif // NRF_MODULE_ENABLED(NRF_TRACE)
@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup nrf_trace Binary event trace
+ * @{
+ * @ingroup app_common
+ *
+ * @brief Module for recording interrupt, event and scheduler activity for SEGGER SystemView.
+ *
+ * @details Each event is stored as a record of two words, the DWT cycle counter and the event
+ *          with its argument, in a lock-free buffer that can be written from any interrupt
+ *          priority. Recording an event takes a few tens of cycles, and a single check while no
+ *          host is connected, so the trace points can stay in field-test builds.
+ *
+ *          @ref nrf_trace_process, called from the main loop, answers the commands of the host
+ *          and encodes the records into SystemView packets on a dedicated RTT channel named
+ *          "SysView". Records are only taken while the host is recording. If the buffer is full,
+ *          records are dropped and the host is told how many with an overflow packet.
+ *
+ *          Trace points are placed in:
+ *          - nrfx_saadc_irq_handler(), the RTC interrupt handler of app_timer and
+ *            SD_EVT_IRQHandler() (interrupt enter and exit),
+ *          - the BLE and SoC event dispatch of nrf_sdh_dispatch (markers
+ *            @ref NRF_TRACE_MARKER_SDH_BLE and @ref NRF_TRACE_MARKER_SDH_SOC, with the event ID),
+ *          - the scheduler event handlers of nrf_sdh, app_timer and nrf_async (marker
+ *            @ref NRF_TRACE_MARKER_SCHED, with the address of the handler),
+ *          - the expiry of app_timer timers (timer enter and exit, with the timer address).
+ *
+ *          When the module is disabled, the macros are empty and the trace points cost nothing.
+ */
+
+#ifndef NRF_TRACE_H__
+#define NRF_TRACE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "nordic_common.h"
+#include "sdk_config.h"
+#if NRF_MODULE_ENABLED(NRF_TRACE)
+#include "nrf.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief SystemView event IDs used by this module. */
+typedef enum
+{
+    NRF_TRACE_EVT_OVERFLOW    = 1,  ///< Records were dropped.
+    NRF_TRACE_EVT_ISR_ENTER   = 2,  ///< Interrupt entered. The argument is the exception number.
+    NRF_TRACE_EVT_ISR_EXIT    = 3,  ///< Interrupt exited.
+    NRF_TRACE_EVT_TRACE_START = 10, ///< Recording started.
+    NRF_TRACE_EVT_TRACE_STOP  = 11, ///< Recording stopped.
+    NRF_TRACE_EVT_SYSTIME     = 12, ///< System time, in timestamp cycles.
+    NRF_TRACE_EVT_SYSDESC     = 14, ///< System description.
+    NRF_TRACE_EVT_MARK_START  = 15, ///< Marker started. The argument is the marker.
+    NRF_TRACE_EVT_MARK_STOP   = 16, ///< Marker stopped. The argument is the marker.
+    NRF_TRACE_EVT_TIMER_ENTER = 19, ///< Timer handler entered. The argument is the timer ID.
+    NRF_TRACE_EVT_TIMER_EXIT  = 20, ///< Timer handler exited.
+    NRF_TRACE_EVT_INIT        = 24, ///< Recorder information.
+    NRF_TRACE_EVT_NUMMODULES  = 27, ///< Number of registered modules.
+} nrf_trace_evt_id_t;
+
+/**@brief Markers of the trace points.
+ *
+ * @details The lower bits of a marker hold the event ID or the handler address.
+ */
+#define NRF_TRACE_MARKER_SDH_BLE 0x010000UL ///< BLE event dispatched by nrf_sdh_dispatch.
+#define NRF_TRACE_MARKER_SDH_SOC 0x020000UL ///< SoC event dispatched by nrf_sdh_dispatch.
+#define NRF_TRACE_MARKER_SCHED   0x800000UL ///< Scheduler event handler run.
+
+#define NRF_TRACE_ARG_MASK  0x00FFFFFFUL ///< Argument bits of a record.
+#define NRF_TRACE_RAM_BASE  0x20000000UL ///< Base of the timer IDs reported to the host.
+#define NRF_TRACE_ID_SHIFT  2            ///< Number of low bits dropped from timer IDs.
+
+/**@brief Macro for building the event word of a record.
+ *
+ * @param _id  Event ID, see @ref nrf_trace_evt_id_t.
+ * @param _arg Argument, up to 24 bits.
+ */
+#define NRF_TRACE_EVT(_id, _arg) \
+    ((uint32_t)(_id) | (((uint32_t)(_arg) & NRF_TRACE_ARG_MASK) << 8))
+
+#if NRF_MODULE_ENABLED(NRF_TRACE) || defined(__SDK_DOXYGEN__)
+/**@brief Macro for recording the entry into the current interrupt handler.
+ * @hideinitializer
+ */
+#define NRF_TRACE_ISR_ENTER() \
+    nrf_trace_record(NRF_TRACE_EVT(NRF_TRACE_EVT_ISR_ENTER, __get_IPSR()))
+
+/**@brief Macro for recording the exit from the current interrupt handler.
+ * @hideinitializer
+ */
+#define NRF_TRACE_ISR_EXIT() \
+    nrf_trace_record(NRF_TRACE_EVT(NRF_TRACE_EVT_ISR_EXIT, 0))
+
+/**@brief Macro for recording the start of a marked region.
+ *
+ * @param _marker Marker, up to 24 bits.
+ * @hideinitializer
+ */
+#define NRF_TRACE_MARK_START(_marker) \
+    nrf_trace_record(NRF_TRACE_EVT(NRF_TRACE_EVT_MARK_START, (_marker)))
+
+/**@brief Macro for recording the end of a marked region.
+ *
+ * @param _marker Marker given to @ref NRF_TRACE_MARK_START.
+ * @hideinitializer
+ */
+#define NRF_TRACE_MARK_STOP(_marker) \
+    nrf_trace_record(NRF_TRACE_EVT(NRF_TRACE_EVT_MARK_STOP, (_marker)))
+
+/**@brief Macro for recording the start of a scheduler event handler.
+ *
+ * @param _handler Handler being run.
+ * @hideinitializer
+ */
+#define NRF_TRACE_SCHED_START(_handler) \
+    NRF_TRACE_MARK_START(NRF_TRACE_MARKER_SCHED | (uint32_t)(_handler))
+
+/**@brief Macro for recording the end of a scheduler event handler.
+ *
+ * @param _handler Handler given to @ref NRF_TRACE_SCHED_START.
+ * @hideinitializer
+ */
+#define NRF_TRACE_SCHED_STOP(_handler) \
+    NRF_TRACE_MARK_STOP(NRF_TRACE_MARKER_SCHED | (uint32_t)(_handler))
+
+/**@brief Macro for recording the expiry of a timer.
+ *
+ * @param _p_timer Timer instance, in RAM.
+ * @hideinitializer
+ */
+#define NRF_TRACE_TIMER_ENTER(_p_timer)                                           \
+    nrf_trace_record(NRF_TRACE_EVT(NRF_TRACE_EVT_TIMER_ENTER,                     \
+                                   ((uint32_t)(_p_timer) - NRF_TRACE_RAM_BASE)    \
+                                   >> NRF_TRACE_ID_SHIFT))
+
+/**@brief Macro for recording the end of the expiry of a timer.
+ * @hideinitializer
+ */
+#define NRF_TRACE_TIMER_EXIT() \
+    nrf_trace_record(NRF_TRACE_EVT(NRF_TRACE_EVT_TIMER_EXIT, 0))
+#else
+#define NRF_TRACE_ISR_ENTER()
+#define NRF_TRACE_ISR_EXIT()
+#define NRF_TRACE_MARK_START(_marker)
+#define NRF_TRACE_MARK_STOP(_marker)
+#define NRF_TRACE_SCHED_START(_handler)
+#define NRF_TRACE_SCHED_STOP(_handler)
+#define NRF_TRACE_TIMER_ENTER(_p_timer)
+#define NRF_TRACE_TIMER_EXIT()
+#endif
+
+
+/**@brief Function for initializing the module.
+ *
+ * @details Enables the DWT cycle counter and configures the RTT channel
+ *          @ref NRF_TRACE_CONFIG_RTT_CHANNEL. Recording starts when the host sends the start
+ *          command.
+ *
+ * @retval NRF_SUCCESS             If the module was initialized.
+ * @retval NRF_ERROR_INVALID_PARAM If the RTT channel does not exist.
+ */
+ret_code_t nrf_trace_init(void);
+
+
+/**@brief Function for answering the host and sending the records taken so far.
+ *
+ * @details Must be called from the main loop, or from an interrupt priority that no trace point
+ *          runs above.
+ *
+ * @retval true  If records are left, because the RTT buffer is full.
+ * @retval false If all records were sent.
+ */
+bool nrf_trace_process(void);
+
+
+/**@brief Function for getting the number of records dropped since initialization.
+ *
+ * @return Number of records dropped because the buffer was full.
+ */
+uint32_t nrf_trace_dropped_get(void);
+
+
+/**@brief Function for recording an event.
+ *
+ * @details Use the macros of this module instead of calling this function directly.
+ *
+ * @param[in] evt Event word, built with @ref NRF_TRACE_EVT.
+ */
+void nrf_trace_record(uint32_t evt);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_TRACE_H__
+
+/** @} */
@@ -42,6 +42,9 @@
 
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
 #include "nrfx_prs.h"
+#if NRFX_CHECK(NRFX_PRS_CONFIG_SWITCH_ENABLED)
+#include "nrfx_prs_switch.h"
+#endif
 
 #define NRFX_LOG_MODULE PRS
 #include <nrfx_log.h>
@@ -55,6 +58,10 @@
 typedef struct {
     nrfx_irq_handler_t handler;
     bool               acquired;
+#if NRFX_CHECK(NRFX_PRS_CONFIG_SWITCH_ENABLED)
+    nrfx_prs_role_t *  p_owner; ///< Role owning the box, NULL if owned by a driver directly.
+    nrfx_prs_role_t *  p_queue; ///< Queued roles, in the order of their requests.
+#endif
 } prs_box_t;
 
 #define PRS_BOX_DEFINE(n)                                                    \
@@ -113,6 +120,141 @@ static prs_box_t * prs_box_get(void const * p_base_addr)
     }
 }
 
+#if NRFX_CHECK(NRFX_PRS_CONFIG_SWITCH_ENABLED)
+// Registers at the same offsets in all the serial peripherals that share an ID.
+#define PRS_REG_EVENTS   0x100
+#define PRS_REG_SHORTS   0x200
+#define PRS_REG_INTEN    0x300
+#define PRS_REG_INTENCLR 0x308
+#define PRS_REG_ENABLE   0x500
+
+#define PRS_REG(_p_role, _offset) \
+    (*(volatile uint32_t *)((uint8_t *)(_p_role)->p_reg + (_offset)))
+
+#if defined(UARTE_PRESENT)
+static uint16_t const m_regs_uarte[] =
+{
+    offsetof(NRF_UARTE_Type, PSEL.RTS),
+    offsetof(NRF_UARTE_Type, PSEL.TXD),
+    offsetof(NRF_UARTE_Type, PSEL.CTS),
+    offsetof(NRF_UARTE_Type, PSEL.RXD),
+    offsetof(NRF_UARTE_Type, BAUDRATE),
+    offsetof(NRF_UARTE_Type, CONFIG),
+};
+nrfx_prs_role_regs_t const nrfx_prs_role_regs_uarte =
+{
+    .p_offsets = m_regs_uarte,
+    .count     = NRFX_ARRAY_SIZE(m_regs_uarte),
+};
+#endif
+
+#if defined(SPIM_PRESENT)
+static uint16_t const m_regs_spim[] =
+{
+    offsetof(NRF_SPIM_Type, PSEL.SCK),
+    offsetof(NRF_SPIM_Type, PSEL.MOSI),
+    offsetof(NRF_SPIM_Type, PSEL.MISO),
+#if defined(SPIM_PSEL_CSN_PIN_Msk)
+    offsetof(NRF_SPIM_Type, PSEL.CSN),
+#endif
+    offsetof(NRF_SPIM_Type, FREQUENCY),
+    offsetof(NRF_SPIM_Type, CONFIG),
+    offsetof(NRF_SPIM_Type, ORC),
+};
+nrfx_prs_role_regs_t const nrfx_prs_role_regs_spim =
+{
+    .p_offsets = m_regs_spim,
+    .count     = NRFX_ARRAY_SIZE(m_regs_spim),
+};
+#endif
+
+#if defined(TWIM_PRESENT)
+static uint16_t const m_regs_twim[] =
+{
+    offsetof(NRF_TWIM_Type, PSEL.SCL),
+    offsetof(NRF_TWIM_Type, PSEL.SDA),
+    offsetof(NRF_TWIM_Type, FREQUENCY),
+    offsetof(NRF_TWIM_Type, ADDRESS),
+};
+nrfx_prs_role_regs_t const nrfx_prs_role_regs_twim =
+{
+    .p_offsets = m_regs_twim,
+    .count     = NRFX_ARRAY_SIZE(m_regs_twim),
+};
+#endif
+
+static void role_save(nrfx_prs_role_t * p_role)
+{
+    for (uint8_t i = 0; i < p_role->p_regs->count; i++)
+    {
+        p_role->values[i] = PRS_REG(p_role, p_role->p_regs->p_offsets[i]);
+    }
+    p_role->shorts       = PRS_REG(p_role, PRS_REG_SHORTS);
+    p_role->inten        = PRS_REG(p_role, PRS_REG_INTEN);
+    p_role->enable       = PRS_REG(p_role, PRS_REG_ENABLE);
+    p_role->irq_priority = (uint8_t)NVIC_GetPriority(nrfx_get_irq_number(p_role->p_reg));
+}
+
+static void role_suspend(nrfx_prs_role_t * p_role)
+{
+    PRS_REG(p_role, PRS_REG_INTENCLR) = UINT32_MAX;
+    PRS_REG(p_role, PRS_REG_ENABLE)   = 0;
+    NRFX_IRQ_PENDING_CLEAR(nrfx_get_irq_number(p_role->p_reg));
+}
+
+static void role_restore(nrfx_prs_role_t * p_role)
+{
+    prs_box_t * p_box = p_role->p_box;
+
+    for (uint8_t i = 0; i < p_role->p_regs->count; i++)
+    {
+        PRS_REG(p_role, p_role->p_regs->p_offsets[i]) = p_role->values[i];
+    }
+    PRS_REG(p_role, PRS_REG_SHORTS) = p_role->shorts;
+
+    // Events left by the previous role would be taken for events of this one. Bit n of INTEN
+    // enables the event at offset 0x100 + 4 * n, so only the events that interrupt are cleared.
+    for (uint32_t inten = p_role->inten; inten != 0; inten &= inten - 1)
+    {
+        PRS_REG(p_role, PRS_REG_EVENTS + 4 * __CLZ(__RBIT(inten))) = 0;
+    }
+
+    NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(p_role->p_reg), p_role->irq_priority);
+    p_box->handler  = p_role->irq_handler;
+    p_box->p_owner  = p_role;
+    p_box->acquired = true;
+
+    PRS_REG(p_role, PRS_REG_ENABLE) = p_role->enable;
+    PRS_REG(p_role, PRS_REG_INTEN)  = p_role->inten;
+}
+
+/**
+ * @brief Function for passing a box to the first queued role, or freeing it.
+ *
+ * Must be called in a critical section.
+ *
+ * @return Role that got the box, or NULL.
+ */
+static nrfx_prs_role_t * box_release(prs_box_t * p_box)
+{
+    nrfx_prs_role_t * p_role = p_box->p_queue;
+
+    if (p_role != NULL)
+    {
+        p_box->p_queue = p_role->p_next;
+        p_role->p_next = NULL;
+        p_role->queued = false;
+        role_restore(p_role);
+        return p_role;
+    }
+
+    p_box->handler  = NULL;
+    p_box->p_owner  = NULL;
+    p_box->acquired = false;
+    return NULL;
+}
+#endif // NRFX_CHECK(NRFX_PRS_CONFIG_SWITCH_ENABLED)
+
 nrfx_err_t nrfx_prs_acquire(void       const * p_base_addr,
                             nrfx_irq_handler_t irq_handler)
 {
@@ -157,10 +299,171 @@ void nrfx_prs_release(void const * p_base_addr)
     prs_box_t * p_box = prs_box_get(p_base_addr);
     if (p_box != NULL)
     {
+#if NRFX_CHECK(NRFX_PRS_CONFIG_SWITCH_ENABLED)
+        NRFX_CRITICAL_SECTION_ENTER();
+        nrfx_prs_role_t * p_granted = box_release(p_box);
+        NRFX_CRITICAL_SECTION_EXIT();
+
+        if ((p_granted != NULL) && (p_granted->handler != NULL))
+        {
+            p_granted->handler(p_granted, p_granted->p_context);
+        }
+#else
         p_box->handler  = NULL;
         p_box->acquired = false;
+#endif
+    }
+}
+
+#if NRFX_CHECK(NRFX_PRS_CONFIG_SWITCH_ENABLED)
+nrfx_err_t nrfx_prs_role_capture(nrfx_prs_role_t *            p_role,
+                                 void const *                 p_base_addr,
+                                 nrfx_prs_role_regs_t const * p_regs,
+                                 nrfx_prs_role_handler_t      handler,
+                                 void *                       p_context)
+{
+    NRFX_ASSERT(p_role);
+    NRFX_ASSERT(p_base_addr);
+    NRFX_ASSERT(p_regs);
+
+    nrfx_err_t        ret_code;
+    nrfx_prs_role_t * p_granted = NULL;
+    prs_box_t *       p_box     = prs_box_get(p_base_addr);
+
+    if ((p_box == NULL) || (p_regs->count > NRFX_PRS_ROLE_REGS_MAX))
+    {
+        ret_code = NRFX_ERROR_INVALID_PARAM;
+        LOG_FUNCTION_EXIT(WARNING, ret_code);
+        return ret_code;
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (!p_box->acquired || (p_box->p_owner != NULL))
+    {
+        ret_code = NRFX_ERROR_INVALID_STATE;
+    }
+    else
+    {
+        p_role->p_next      = NULL;
+        p_role->p_box       = p_box;
+        p_role->p_reg       = (uint32_t *)p_base_addr;
+        p_role->p_regs      = p_regs;
+        p_role->irq_handler = p_box->handler;
+        p_role->handler     = handler;
+        p_role->p_context   = p_context;
+        p_role->queued      = false;
+
+        role_save(p_role);
+        role_suspend(p_role);
+
+        // A role may have been queued while the driver owned the box.
+        p_granted = box_release(p_box);
+        ret_code  = NRFX_SUCCESS;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (ret_code != NRFX_SUCCESS)
+    {
+        LOG_FUNCTION_EXIT(WARNING, ret_code);
+        return ret_code;
+    }
+
+    if ((p_granted != NULL) && (p_granted->handler != NULL))
+    {
+        p_granted->handler(p_granted, p_granted->p_context);
+    }
+
+    LOG_FUNCTION_EXIT(INFO, ret_code);
+    return ret_code;
+}
+
+nrfx_err_t nrfx_prs_role_acquire(nrfx_prs_role_t * p_role)
+{
+    NRFX_ASSERT(p_role);
+    NRFX_ASSERT(p_role->p_box);
+
+    prs_box_t * p_box = p_role->p_box;
+    bool        busy;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    busy = p_box->acquired;
+    if (!busy)
+    {
+        role_restore(p_role);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return busy ? NRFX_ERROR_BUSY : NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_prs_role_request(nrfx_prs_role_t * p_role)
+{
+    NRFX_ASSERT(p_role);
+    NRFX_ASSERT(p_role->p_box);
+
+    prs_box_t * p_box = p_role->p_box;
+    nrfx_err_t  ret_code;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_role->queued || (p_box->p_owner == p_role))
+    {
+        ret_code = NRFX_ERROR_INVALID_STATE;
+    }
+    else if (!p_box->acquired)
+    {
+        role_restore(p_role);
+        ret_code = NRFX_SUCCESS;
+    }
+    else
+    {
+        nrfx_prs_role_t ** pp_last = &p_box->p_queue;
+        while (*pp_last != NULL)
+        {
+            pp_last = &(*pp_last)->p_next;
+        }
+        *pp_last       = p_role;
+        p_role->queued = true;
+        ret_code = NRFX_ERROR_BUSY;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return ret_code;
+}
+
+void nrfx_prs_role_release(nrfx_prs_role_t * p_role)
+{
+    NRFX_ASSERT(p_role);
+    NRFX_ASSERT(p_role->p_box);
+
+    prs_box_t *       p_box     = p_role->p_box;
+    nrfx_prs_role_t * p_granted = NULL;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_role->queued)
+    {
+        nrfx_prs_role_t ** pp_role = &p_box->p_queue;
+        while (*pp_role != p_role)
+        {
+            pp_role = &(*pp_role)->p_next;
+        }
+        *pp_role       = p_role->p_next;
+        p_role->p_next = NULL;
+        p_role->queued = false;
+    }
+    else if (p_box->p_owner == p_role)
+    {
+        role_save(p_role);
+        role_suspend(p_role);
+        p_granted = box_release(p_box);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if ((p_granted != NULL) && (p_granted->handler != NULL))
+    {
+        p_granted->handler(p_granted, p_granted->p_context);
     }
 }
+#endif // NRFX_CHECK(NRFX_PRS_CONFIG_SWITCH_ENABLED)
 
 
 #endif // NRFX_CHECK(NRFX_PRS_ENABLED)
@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRFX_PRS_SWITCH_H__
+#define NRFX_PRS_SWITCH_H__
+
+#include <nrfx.h>
+#include "nrfx_prs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_prs_switch Fast switching of shared peripherals
+ * @{
+ * @ingroup nrfx_prs
+ * @brief   Switching a shared instance between drivers without uninitializing them.
+ *
+ * @details Each user of a shared instance (for example UARTE0 and SPIM0) is a role. A role is
+ *          set up once: its driver is initialized normally, then @ref nrfx_prs_role_capture
+ *          saves the configuration registers, the interrupt enable and shortcut registers, the
+ *          interrupt priority and the interrupt handler of the driver, disables the instance
+ *          and releases the box so that the next driver can be initialized.
+ *
+ *          Afterwards @ref nrfx_prs_role_acquire writes the saved registers back and installs
+ *          the interrupt handler of the role, which takes a few register writes instead of a
+ *          driver uninitialization and initialization. @ref nrfx_prs_role_release saves the
+ *          registers again, so configuration changes done by the driver are kept, and
+ *          disables the instance.
+ *
+ *          The drivers stay initialized the whole time, so the driver of a role must only be
+ *          used while the role owns the box, and a role must be released only when its driver
+ *          has no transfer in progress.
+ *
+ *          With @ref nrfx_prs_role_request, a role that finds the box owned is queued. The box
+ *          is passed to the first queued role as soon as it is released, from the context of
+ *          the release, and the handler of the role is called.
+ */
+
+/** @brief Maximum number of configuration registers saved for a role. */
+#define NRFX_PRS_ROLE_REGS_MAX 8
+
+/** @brief Configuration registers of a peripheral type. */
+typedef struct
+{
+    uint16_t const * p_offsets; ///< Offsets of the registers from the base address.
+    uint8_t          count;     ///< Number of registers, at most @ref NRFX_PRS_ROLE_REGS_MAX.
+} nrfx_prs_role_regs_t;
+
+#if defined(UARTE_PRESENT) || defined(__NRFX_DOXYGEN__)
+/** @brief Configuration registers of UARTE. */
+extern nrfx_prs_role_regs_t const nrfx_prs_role_regs_uarte;
+#endif
+#if defined(SPIM_PRESENT) || defined(__NRFX_DOXYGEN__)
+/** @brief Configuration registers of SPIM. */
+extern nrfx_prs_role_regs_t const nrfx_prs_role_regs_spim;
+#endif
+#if defined(TWIM_PRESENT) || defined(__NRFX_DOXYGEN__)
+/** @brief Configuration registers of TWIM. */
+extern nrfx_prs_role_regs_t const nrfx_prs_role_regs_twim;
+#endif
+
+struct nrfx_prs_role_s;
+
+/**
+ * @brief Handler called when a queued role gets the box.
+ *
+ * @param[in] p_role    Role that owns the box now.
+ * @param[in] p_context Context given to @ref nrfx_prs_role_capture.
+ */
+typedef void (* nrfx_prs_role_handler_t)(struct nrfx_prs_role_s * p_role, void * p_context);
+
+/** @brief Role. The fields are private to the module. */
+typedef struct nrfx_prs_role_s
+{
+    struct nrfx_prs_role_s *     p_next;       ///< Next queued role.
+    void *                       p_box;        ///< Box of the instance.
+    uint32_t *                   p_reg;        ///< Base address of the instance.
+    nrfx_prs_role_regs_t const * p_regs;       ///< Configuration registers.
+    nrfx_irq_handler_t           irq_handler;  ///< Interrupt handler of the driver.
+    nrfx_prs_role_handler_t      handler;      ///< Handler called when a queued role gets the box.
+    void *                       p_context;    ///< Context passed to the handler.
+    uint32_t                     values[NRFX_PRS_ROLE_REGS_MAX]; ///< Saved configuration registers.
+    uint32_t                     shorts;       ///< Saved SHORTS register.
+    uint32_t                     inten;        ///< Saved INTEN register.
+    uint32_t                     enable;       ///< Saved ENABLE register.
+    uint8_t                      irq_priority; ///< Saved interrupt priority.
+    bool                         queued;       ///< Whether the role waits for the box.
+} nrfx_prs_role_t;
+
+/**
+ * @brief Function for setting up a role from an initialized driver.
+ *
+ * Must be called right after the driver of the role was initialized, while it owns the box.
+ * The instance is disabled and the box is released.
+ *
+ * @param[out] p_role      Role.
+ * @param[in]  p_base_addr Base address of the instance.
+ * @param[in]  p_regs      Configuration registers of the peripheral type, for example
+ *                         @ref nrfx_prs_role_regs_uarte.
+ * @param[in]  handler     Handler called when the role gets the box from the queue. Can be NULL
+ *                         if @ref nrfx_prs_role_request is not used.
+ * @param[in]  p_context   Context passed to the handler.
+ *
+ * @retval NRFX_SUCCESS             The role is set up.
+ * @retval NRFX_ERROR_INVALID_PARAM The instance is not in an enabled box or has too many
+ *                                  registers.
+ * @retval NRFX_ERROR_INVALID_STATE The box is not owned by a driver.
+ */
+nrfx_err_t nrfx_prs_role_capture(nrfx_prs_role_t *            p_role,
+                                 void const *                 p_base_addr,
+                                 nrfx_prs_role_regs_t const * p_regs,
+                                 nrfx_prs_role_handler_t      handler,
+                                 void *                       p_context);
+
+/**
+ * @brief Function for making a role the owner of its box.
+ *
+ * @param[in] p_role Role.
+ *
+ * @retval NRFX_SUCCESS    The role owns the box and its driver can be used.
+ * @retval NRFX_ERROR_BUSY The box is owned.
+ */
+nrfx_err_t nrfx_prs_role_acquire(nrfx_prs_role_t * p_role);
+
+/**
+ * @brief Function for making a role the owner of its box, or queuing it.
+ *
+ * @param[in] p_role Role.
+ *
+ * @retval NRFX_SUCCESS             The role owns the box and its driver can be used.
+ * @retval NRFX_ERROR_BUSY          The box is owned. The role is queued and its handler is
+ *                                  called when it gets the box.
+ * @retval NRFX_ERROR_INVALID_STATE The role is already queued.
+ */
+nrfx_err_t nrfx_prs_role_request(nrfx_prs_role_t * p_role);
+
+/**
+ * @brief Function for releasing the box owned by a role, or cancelling its request.
+ *
+ * If another role is queued, it gets the box and its handler is called before this function
+ * returns.
+ *
+ * @param[in] p_role Role.
+ */
+void nrfx_prs_role_release(nrfx_prs_role_t * p_role);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PRS_SWITCH_H__
@@ -42,8 +42,23 @@
 #if NRFX_CHECK(NRFX_SAADC_ENABLED)
 #include <nrfx_saadc.h>
 
+#if defined(APP_SAADC_LITE_ENABLED) && APP_SAADC_LITE_ENABLED
+#error "app_saadc_lite owns the SAADC interrupt, disable it to use the nrfx_saadc driver."
+#endif
+
 #define NRFX_LOG_MODULE SAADC
 #include <nrfx_log.h>
+#include "nrf_profiler.h"
+#include "nrf_trace.h"
+#include "nrf_ramfunc.h"
+
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_RAMFUNC_ENABLED)
+#define SAADC_RAMFUNC NRF_RAMFUNC
+#else
+#define SAADC_RAMFUNC
+#endif
+
+NRF_PROFILER_PROBE_DEF(saadc_irq);
 
 #if !defined(NRFX_SAADC_API_V2)
 
@@ -101,8 +116,11 @@ static nrfx_saadc_cb_t m_cb;
                                             ? NRF_SAADC_LIMIT_LOW : NRF_SAADC_LIMIT_HIGH)
 #define HW_TIMEOUT 10000
 
-void nrfx_saadc_irq_handler(void)
+SAADC_RAMFUNC void nrfx_saadc_irq_handler(void)
 {
+    NRF_TRACE_ISR_ENTER();
+    NRF_PROFILER_BEGIN(saadc_irq);
+
     if (nrf_saadc_event_check(NRF_SAADC_EVENT_END))
     {
         nrf_saadc_event_clear(NRF_SAADC_EVENT_END);
@@ -207,6 +225,9 @@ void nrfx_saadc_irq_handler(void)
             }
         }
     }
+
+    NRF_PROFILER_END(saadc_irq);
+    NRF_TRACE_ISR_EXIT();
 }
 
 
@@ -1307,7 +1328,7 @@ nrfx_err_t nrfx_saadc_offset_calibrate(nrfx_saadc_event_handler_t event_handler)
     return NRFX_SUCCESS;
 }
 
-static void saadc_event_started_handle(void)
+SAADC_RAMFUNC static void saadc_event_started_handle(void)
 {
     nrfx_saadc_evt_t evt_data;
 
@@ -1356,7 +1377,7 @@ static void saadc_event_started_handle(void)
     }
 }
 
-static void saadc_event_end_handle(void)
+SAADC_RAMFUNC static void saadc_event_end_handle(void)
 {
     nrfx_saadc_evt_t evt_data;
     evt_data.type = NRFX_SAADC_EVT_DONE;
@@ -1396,7 +1417,7 @@ static void saadc_event_end_handle(void)
     }
 }
 
-static void saadc_event_limits_handle(uint8_t limits_activated, nrf_saadc_limit_t limit_type)
+SAADC_RAMFUNC static void saadc_event_limits_handle(uint8_t limits_activated, nrf_saadc_limit_t limit_type)
 {
     while (limits_activated)
     {
@@ -1417,8 +1438,11 @@ static void saadc_event_limits_handle(uint8_t limits_activated, nrf_saadc_limit_
     }
 }
 
-void nrfx_saadc_irq_handler(void)
+SAADC_RAMFUNC void nrfx_saadc_irq_handler(void)
 {
+    NRF_TRACE_ISR_ENTER();
+    NRF_PROFILER_BEGIN(saadc_irq);
+
     if (nrf_saadc_event_check(NRF_SAADC_EVENT_STARTED))
     {
         nrf_saadc_event_clear(NRF_SAADC_EVENT_STARTED);
@@ -1464,6 +1488,9 @@ void nrfx_saadc_irq_handler(void)
         m_cb.event_handler(&evt_data);
 
     }
+
+    NRF_PROFILER_END(saadc_irq);
+    NRF_TRACE_ISR_EXIT();
 }
 #endif // defined(NRFX_SAADC_API_V2) || defined(__NRFX_DOXYGEN__)
 
@@ -53,6 +53,15 @@
 #include "prs/nrfx_prs.h"
 #include <hal/nrf_gpio.h>
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_CONT_ENABLED)
+#include "nrfx_uarte_rx_cont.h"
+#include <nrfx_ppi.h>
+#endif
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+#include "nrfx_uarte_tx_queue.h"
+#endif
+
 #define NRFX_LOG_MODULE UARTE
 #include <nrfx_log.h>
 
@@ -94,6 +103,19 @@
      UARTE2_LENGTH_VALIDATE(drv_inst_idx, length, 0) || \
      UARTE3_LENGTH_VALIDATE(drv_inst_idx, length, 0))
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_CONT_ENABLED)
+typedef struct
+{
+    nrfx_uarte_rx_cont_config_t config;
+    nrf_ppi_channel_t           ppi_count;  // RXDRDY to the COUNT task of the counter, forked to
+                                            // the CLEAR task of the idle timer.
+    nrf_ppi_channel_t           ppi_idle;   // RXDRDY to the START task of the idle timer.
+    volatile uint32_t           released;   // Number of bytes released since the start.
+    uint32_t                    reported;   // Number of bytes received at the last data event.
+    uint8_t                     next_half;  // Half of the buffer to be set as the next one.
+} uarte_rx_cont_t;
+#endif
+
 typedef struct
 {
     void                     * p_context;
@@ -105,9 +127,24 @@ typedef struct
     size_t                     rx_buffer_length;
     size_t                     rx_secondary_buffer_length;
     nrfx_drv_state_t           state;
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_CONT_ENABLED)
+    uarte_rx_cont_t * volatile p_rx_cont;
+#endif
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+    nrfx_uarte_tx_desc_t     * p_txq_head;     // Descriptor being sent, followed by queued ones.
+    nrfx_uarte_tx_desc_t     * p_txq_tail;
+    size_t                     txq_iov_idx;    // Buffer of the head descriptor being sent.
+    bool                       txq_active;     // Transfer in progress is from the queue.
+    bool                       txq_aborted;    // Abort requested while sending the queue.
+    bool                       txq_stopping;   // STOPTX triggered, TXSTOPPED not received yet.
+#endif
 } uarte_control_block_t;
 static uarte_control_block_t m_cb[NRFX_UARTE_ENABLED_COUNT];
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_CONT_ENABLED)
+static uarte_rx_cont_t m_rx_cont[NRFX_UARTE_ENABLED_COUNT];
+#endif
+
 static void apply_config(nrfx_uarte_t        const * p_instance,
                          nrfx_uarte_config_t const * p_config)
 {
@@ -296,6 +333,10 @@ void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance)
     uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
     NRF_UARTE_Type * p_reg = p_instance->p_reg;
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_CONT_ENABLED)
+    nrfx_uarte_rx_cont_stop(p_instance);
+#endif
+
     if (p_cb->handler)
     {
         interrupts_disable(p_instance);
@@ -322,6 +363,15 @@ void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance)
     nrf_uarte_disable(p_reg);
     pins_to_default(p_instance);
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+    // Queued descriptors are dropped without calling their handlers.
+    p_cb->p_txq_head   = NULL;
+    p_cb->txq_iov_idx  = 0;
+    p_cb->txq_active   = false;
+    p_cb->txq_aborted  = false;
+    p_cb->txq_stopping = false;
+#endif
+
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
     nrfx_prs_release(p_reg);
 #endif
@@ -437,6 +487,17 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
         return err_code;
     }
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_CONT_ENABLED)
+    if (p_cb->p_rx_cont != NULL)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+#endif
+
     bool second_buffer = false;
 
     if (p_cb->handler)
@@ -564,6 +625,12 @@ void nrfx_uarte_tx_abort(nrfx_uarte_t const * p_instance)
 {
     uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_cb->txq_aborted  = p_cb->txq_active;
+    p_cb->txq_stopping = true;
+    NRFX_CRITICAL_SECTION_EXIT();
+#endif
     nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
     nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPTX);
     if (p_cb->handler == NULL)
@@ -588,9 +655,426 @@ void nrfx_uarte_rx_abort(nrfx_uarte_t const * p_instance)
     NRFX_LOG_INFO("RX transaction aborted.");
 }
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_CONT_ENABLED)
+static void rx_cont_next_half_set(NRF_UARTE_Type * p_uarte, uarte_rx_cont_t * p_rx)
+{
+    size_t half = p_rx->config.length / 2;
+
+    nrf_uarte_rx_buffer_set(p_uarte, &p_rx->config.p_buffer[p_rx->next_half * half], half);
+    p_rx->next_half ^= 1;
+}
+
+static void rx_cont_report(uarte_rx_cont_t * p_rx, bool idle)
+{
+    nrfx_uarte_rx_cont_evt_t event;
+    uint32_t received  = nrfx_timer_capture(&p_rx->config.counter, NRF_TIMER_CC_CHANNEL0);
+    size_t   available = received - p_rx->released;
+
+    if (available > p_rx->config.length)
+    {
+        event.type = NRFX_UARTE_RX_CONT_EVT_OVERRUN;
+    }
+    else if (received != p_rx->reported)
+    {
+        event.type              = NRFX_UARTE_RX_CONT_EVT_DATA;
+        event.data.rx.available = available;
+        event.data.rx.idle      = idle;
+    }
+    else
+    {
+        return;
+    }
+
+    p_rx->reported = received;
+    p_rx->config.handler(&event, p_rx->config.p_context);
+}
+
+static void rx_cont_counter_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    // No events are enabled for the counter.
+    (void)event_type;
+    (void)p_context;
+}
+
+static void rx_cont_idle_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    if (event_type == NRF_TIMER_EVENT_COMPARE0)
+    {
+        rx_cont_report((uarte_rx_cont_t *)p_context, true);
+    }
+}
+
+static void rx_cont_irq_handler(NRF_UARTE_Type * p_uarte, uarte_rx_cont_t * p_rx)
+{
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_RXSTARTED))
+    {
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_RXSTARTED);
+        // Used by the ENDRX_STARTRX short when the half that has just started is full.
+        rx_cont_next_half_set(p_uarte, p_rx);
+    }
+
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ERROR))
+    {
+        nrfx_uarte_rx_cont_evt_t event;
+
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ERROR);
+
+        event.type            = NRFX_UARTE_RX_CONT_EVT_ERROR;
+        event.data.error_mask = nrf_uarte_errorsrc_get_and_clear(p_uarte);
+        p_rx->config.handler(&event, p_rx->config.p_context);
+    }
+
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ENDRX))
+    {
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDRX);
+        rx_cont_report(p_rx, false);
+    }
+}
+
+static void rx_cont_resources_release(uarte_rx_cont_t * p_rx)
+{
+    (void)nrfx_ppi_channel_disable(p_rx->ppi_count);
+    (void)nrfx_ppi_channel_disable(p_rx->ppi_idle);
+    (void)nrfx_ppi_channel_free(p_rx->ppi_count);
+    (void)nrfx_ppi_channel_free(p_rx->ppi_idle);
+    nrfx_timer_uninit(&p_rx->config.idle_timer);
+    nrfx_timer_uninit(&p_rx->config.counter);
+}
+
+nrfx_err_t nrfx_uarte_rx_cont_start(nrfx_uarte_t const *                p_instance,
+                                    nrfx_uarte_rx_cont_config_t const * p_config)
+{
+    uarte_control_block_t * p_cb  = &m_cb[p_instance->drv_inst_idx];
+    uarte_rx_cont_t *       p_rx  = &m_rx_cont[p_instance->drv_inst_idx];
+    NRF_UARTE_Type *        p_reg = p_instance->p_reg;
+    nrfx_err_t              err_code;
+
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_cb->handler);
+    NRFX_ASSERT(p_config->handler);
+    NRFX_ASSERT(p_config->p_buffer);
+    NRFX_ASSERT((p_config->length >= 2) && ((p_config->length & (p_config->length - 1)) == 0));
+    NRFX_ASSERT(UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, p_config->length / 2));
+
+    if ((p_cb->rx_buffer_length != 0) || (p_cb->p_rx_cont != NULL))
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // EasyDMA requires that transfer buffers are placed in DataRAM,
+    // signal error if the are not.
+    if (!nrfx_is_in_ram(p_config->p_buffer))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_rx->config    = *p_config;
+    p_rx->released  = 0;
+    p_rx->reported  = 0;
+    p_rx->next_half = 0;
+
+    // The idle timer handler runs at the priority of the UARTE interrupt, so the two handlers
+    // do not preempt each other.
+    nrfx_timer_config_t timer_config = NRFX_TIMER_DEFAULT_CONFIG;
+    timer_config.frequency          = NRF_TIMER_FREQ_1MHz;
+    timer_config.bit_width          = NRF_TIMER_BIT_WIDTH_32;
+    timer_config.interrupt_priority =
+        NVIC_GetPriority(nrfx_get_irq_number((void *)p_instance->p_reg));
+    timer_config.p_context          = p_rx;
+
+    timer_config.mode = NRF_TIMER_MODE_COUNTER;
+    err_code = nrfx_timer_init(&p_rx->config.counter, &timer_config, rx_cont_counter_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    timer_config.mode = NRF_TIMER_MODE_TIMER;
+    err_code = nrfx_timer_init(&p_rx->config.idle_timer, &timer_config, rx_cont_idle_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        nrfx_timer_uninit(&p_rx->config.counter);
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    err_code = nrfx_ppi_channel_alloc(&p_rx->ppi_count);
+    if (err_code == NRFX_SUCCESS)
+    {
+        err_code = nrfx_ppi_channel_alloc(&p_rx->ppi_idle);
+        if (err_code != NRFX_SUCCESS)
+        {
+            (void)nrfx_ppi_channel_free(p_rx->ppi_count);
+        }
+    }
+    if (err_code != NRFX_SUCCESS)
+    {
+        nrfx_timer_uninit(&p_rx->config.idle_timer);
+        nrfx_timer_uninit(&p_rx->config.counter);
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // The idle timer is started and cleared by every received byte and stops itself when
+    // the line has been idle for the configured time.
+    nrfx_timer_extended_compare(&p_rx->config.idle_timer,
+                                NRF_TIMER_CC_CHANNEL0,
+                                nrfx_timer_us_to_ticks(&p_rx->config.idle_timer, p_config->idle_us),
+                                (nrf_timer_short_mask_t)(NRF_TIMER_SHORT_COMPARE0_STOP_MASK |
+                                                         NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK),
+                                true);
+    nrfx_timer_clear(&p_rx->config.counter);
+    nrfx_timer_enable(&p_rx->config.counter);
+
+    uint32_t rxdrdy = nrf_uarte_event_address_get(p_reg, NRF_UARTE_EVENT_RXDRDY);
+    (void)nrfx_ppi_channel_assign(p_rx->ppi_count,
+        rxdrdy, nrfx_timer_task_address_get(&p_rx->config.counter, NRF_TIMER_TASK_COUNT));
+    (void)nrfx_ppi_channel_fork_assign(p_rx->ppi_count,
+        nrfx_timer_task_address_get(&p_rx->config.idle_timer, NRF_TIMER_TASK_CLEAR));
+    (void)nrfx_ppi_channel_assign(p_rx->ppi_idle,
+        rxdrdy, nrfx_timer_task_address_get(&p_rx->config.idle_timer, NRF_TIMER_TASK_START));
+    (void)nrfx_ppi_channel_enable(p_rx->ppi_count);
+    (void)nrfx_ppi_channel_enable(p_rx->ppi_idle);
+
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_ENDRX);
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_RXSTARTED);
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_RXTO);
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_ERROR);
+    rx_cont_next_half_set(p_reg, p_rx);
+    p_cb->p_rx_cont = p_rx;
+    nrf_uarte_shorts_enable(p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
+    nrf_uarte_int_enable(p_reg, NRF_UARTE_INT_RXSTARTED_MASK |
+                                NRF_UARTE_INT_ENDRX_MASK     |
+                                NRF_UARTE_INT_ERROR_MASK);
+    nrf_uarte_task_trigger(p_reg, NRF_UARTE_TASK_STARTRX);
+
+    NRFX_LOG_INFO("Continuous reception started, length: %d.", p_config->length);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_uarte_rx_cont_stop(nrfx_uarte_t const * p_instance)
+{
+    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_rx_cont_t *       p_rx = p_cb->p_rx_cont;
+
+    if (p_rx == NULL)
+    {
+        return;
+    }
+
+    nrf_uarte_int_disable(p_instance->p_reg, NRF_UARTE_INT_RXSTARTED_MASK);
+    nrf_uarte_shorts_disable(p_instance->p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
+    rx_cont_resources_release(p_rx);
+    // ENDRX and RXTO caused by stopping are ignored by the regular reception handling.
+    p_cb->p_rx_cont = NULL;
+    nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPRX);
+    NRFX_LOG_INFO("Continuous reception stopped.");
+}
+
+size_t nrfx_uarte_rx_cont_get(nrfx_uarte_t const * p_instance, uint8_t ** pp_data)
+{
+    uarte_rx_cont_t * p_rx = m_cb[p_instance->drv_inst_idx].p_rx_cont;
+
+    NRFX_ASSERT(p_rx);
+    NRFX_ASSERT(pp_data);
+
+    uint32_t received  = nrfx_timer_capture(&p_rx->config.counter, NRF_TIMER_CC_CHANNEL1);
+    uint32_t released  = p_rx->released;
+    size_t   available = received - released;
+    size_t   offset;
+
+    if (available > p_rx->config.length)
+    {
+        // Overrun, the oldest bytes were overwritten. Drop everything received so far.
+        p_rx->released = received;
+        released       = received;
+        available      = 0;
+    }
+
+    offset = released & (p_rx->config.length - 1);
+    if (available > (p_rx->config.length - offset))
+    {
+        available = p_rx->config.length - offset;
+    }
+
+    *pp_data = &p_rx->config.p_buffer[offset];
+    return available;
+}
+
+void nrfx_uarte_rx_cont_free(nrfx_uarte_t const * p_instance, size_t length)
+{
+    uarte_rx_cont_t * p_rx = m_cb[p_instance->drv_inst_idx].p_rx_cont;
+
+    NRFX_ASSERT(p_rx);
+
+    p_rx->released += length;
+}
+#endif // NRFX_CHECK(NRFX_UARTE_CONFIG_RX_CONT_ENABLED)
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+static void txq_start(NRF_UARTE_Type * p_uarte, uarte_control_block_t * p_cb)
+{
+    nrfx_uarte_iovec_t const * p_iov = &p_cb->p_txq_head->p_iov[p_cb->txq_iov_idx];
+
+    p_cb->txq_active       = true;
+    p_cb->tx_buffer_length = p_iov->length;
+    p_cb->p_tx_buffer      = p_iov->p_data;
+
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDTX);
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_TXSTOPPED);
+    nrf_uarte_tx_buffer_set(p_uarte, p_iov->p_data, p_iov->length);
+    nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STARTTX);
+}
+
+static void txq_pending_start(NRF_UARTE_Type * p_uarte, uarte_control_block_t * p_cb)
+{
+    // A transfer started before TXSTOPPED could be ended by it, so wait for the stop to finish.
+    if ((p_cb->p_txq_head != NULL) && !p_cb->txq_active && !p_cb->txq_stopping &&
+        (p_cb->tx_buffer_length == 0))
+    {
+        txq_start(p_uarte, p_cb);
+    }
+}
+
+static void txq_stop(NRF_UARTE_Type * p_uarte, uarte_control_block_t * p_cb)
+{
+    // Transmitter has to be stopped by triggering STOPTX task to achieve
+    // the lowest possible level of the UARTE power consumption.
+    nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STOPTX);
+    p_cb->txq_stopping     = true;
+    p_cb->txq_active       = false;
+    p_cb->tx_buffer_length = 0;
+}
+
+static void txq_abort_complete(NRF_UARTE_Type * p_uarte, uarte_control_block_t * p_cb)
+{
+    nrfx_uarte_tx_desc_t * p_desc = p_cb->p_txq_head;
+
+    txq_stop(p_uarte, p_cb);
+    p_cb->p_txq_head  = NULL;
+    p_cb->txq_iov_idx = 0;
+    p_cb->txq_aborted = false;
+
+    while (p_desc != NULL)
+    {
+        nrfx_uarte_tx_desc_t * p_next = p_desc->p_next;
+
+        if (p_desc->handler != NULL)
+        {
+            p_desc->handler(p_desc, true);
+        }
+        p_desc = p_next;
+    }
+}
+
+static void txq_endtx_handle(NRF_UARTE_Type * p_uarte, uarte_control_block_t * p_cb)
+{
+    nrfx_uarte_tx_desc_t * p_done = NULL;
+
+    if (p_cb->txq_aborted || (nrf_uarte_tx_amount_get(p_uarte) != p_cb->tx_buffer_length))
+    {
+        txq_abort_complete(p_uarte, p_cb);
+        return;
+    }
+
+    if (++p_cb->txq_iov_idx == p_cb->p_txq_head->iov_cnt)
+    {
+        p_done            = p_cb->p_txq_head;
+        p_cb->p_txq_head  = p_done->p_next;
+        p_cb->txq_iov_idx = 0;
+    }
+
+    // The next buffer is started without stopping the transmitter, so there is no gap between
+    // the buffers other than the interrupt latency.
+    if (p_cb->p_txq_head != NULL)
+    {
+        txq_start(p_uarte, p_cb);
+    }
+    else
+    {
+        txq_stop(p_uarte, p_cb);
+    }
+
+    if ((p_done != NULL) && (p_done->handler != NULL))
+    {
+        p_done->handler(p_done, false);
+    }
+}
+
+nrfx_err_t nrfx_uarte_tx_queue(nrfx_uarte_t const *   p_instance,
+                               nrfx_uarte_tx_desc_t * p_desc)
+{
+    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    nrfx_err_t              err_code;
+
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_cb->handler);
+    NRFX_ASSERT(p_desc);
+    NRFX_ASSERT(p_desc->p_iov);
+    NRFX_ASSERT(p_desc->iov_cnt > 0);
+
+    for (size_t i = 0; i < p_desc->iov_cnt; i++)
+    {
+        NRFX_ASSERT(p_desc->p_iov[i].length > 0);
+        NRFX_ASSERT(UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, p_desc->p_iov[i].length));
+
+        // EasyDMA requires that transfer buffers are placed in DataRAM,
+        // signal error if the are not.
+        if (!nrfx_is_in_ram(p_desc->p_iov[i].p_data))
+        {
+            err_code = NRFX_ERROR_INVALID_ADDR;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+    }
+
+    p_desc->p_next = NULL;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_cb->p_txq_head == NULL)
+    {
+        p_cb->p_txq_head = p_desc;
+    }
+    else
+    {
+        p_cb->p_txq_tail->p_next = p_desc;
+    }
+    p_cb->p_txq_tail = p_desc;
+    txq_pending_start(p_instance->p_reg, p_cb);
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    NRFX_LOG_INFO("Descriptor queued, buffers: %d.", p_desc->iov_cnt);
+    return NRFX_SUCCESS;
+}
+#endif // NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+
 static void uarte_irq_handler(NRF_UARTE_Type *        p_uarte,
                               uarte_control_block_t * p_cb)
 {
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_CONT_ENABLED)
+    if (p_cb->p_rx_cont != NULL)
+    {
+        rx_cont_irq_handler(p_uarte, p_cb->p_rx_cont);
+    }
+#endif
+
     if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ERROR))
     {
         nrfx_uarte_event_t event;
@@ -651,23 +1135,47 @@ static void uarte_irq_handler(NRF_UARTE_Type *        p_uarte,
     {
         nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDTX);
 
-        // Transmitter has to be stopped by triggering STOPTX task to achieve
-        // the lowest possible level of the UARTE power consumption.
-        nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STOPTX);
-
-        if (p_cb->tx_buffer_length != 0)
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+        if (p_cb->txq_active)
         {
-            tx_done_event(p_cb, nrf_uarte_tx_amount_get(p_uarte));
+            txq_endtx_handle(p_uarte, p_cb);
+        }
+        else
+#endif
+        {
+            // Transmitter has to be stopped by triggering STOPTX task to achieve
+            // the lowest possible level of the UARTE power consumption.
+            nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STOPTX);
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+            p_cb->txq_stopping = true;
+#endif
+
+            if (p_cb->tx_buffer_length != 0)
+            {
+                tx_done_event(p_cb, nrf_uarte_tx_amount_get(p_uarte));
+            }
         }
     }
 
     if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_TXSTOPPED))
     {
         nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_TXSTOPPED);
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+        p_cb->txq_stopping = false;
+        if (p_cb->txq_active)
+        {
+            // Stopped without ENDTX of the queued buffer.
+            txq_abort_complete(p_uarte, p_cb);
+        }
+        else
+#endif
         if (p_cb->tx_buffer_length != 0)
         {
             tx_done_event(p_cb, nrf_uarte_tx_amount_get(p_uarte));
         }
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_QUEUE_ENABLED)
+        txq_pending_start(p_uarte, p_cb);
+#endif
     }
 }
 
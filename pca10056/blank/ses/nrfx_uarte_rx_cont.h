@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRFX_UARTE_RX_CONT_H__
+#define NRFX_UARTE_RX_CONT_H__
+
+#include <nrfx_uarte.h>
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_uarte_rx_cont UARTE continuous reception
+ * @{
+ * @ingroup nrfx_uarte
+ * @brief   Gapless reception into a ring buffer with hardware byte counting.
+ *
+ * @details The buffer is received in two halves chained with the ENDRX_STARTRX short. The
+ *          pointer to the next half is set when a half starts, so the interrupt has the time
+ *          of a whole half to be serviced and reception is not stopped by long interrupt
+ *          latencies, for example during radio events of the SoftDevice.
+ *
+ *          Received bytes are counted by a TIMER in counter mode connected to the RXDRDY
+ *          event through PPI. A second TIMER is restarted by every received byte and reports
+ *          an idle line when no byte has arrived for the configured time. The handler is
+ *          called when a half is full and when the line goes idle, with the number of bytes
+ *          available. The bytes are read with @ref nrfx_uarte_rx_cont_get and released with
+ *          @ref nrfx_uarte_rx_cont_free.
+ *
+ *          The UARTE driver instance must be initialized with an event handler. The handler of
+ *          the continuous reception is called at the interrupt priority of the instance.
+ */
+
+/** @brief Continuous reception event types. */
+typedef enum
+{
+    NRFX_UARTE_RX_CONT_EVT_DATA,    ///< New bytes are available.
+    NRFX_UARTE_RX_CONT_EVT_OVERRUN, ///< Bytes were overwritten before being released and are dropped.
+    NRFX_UARTE_RX_CONT_EVT_ERROR,   ///< Error reported by the peripheral. Reception continues.
+} nrfx_uarte_rx_cont_evt_type_t;
+
+/** @brief Continuous reception event. */
+typedef struct
+{
+    nrfx_uarte_rx_cont_evt_type_t type; ///< Event type.
+    union
+    {
+        struct
+        {
+            size_t available;           ///< Number of bytes not released yet.
+            bool   idle;                ///< True if reported because the line went idle.
+        } rx;                           ///< Data for @ref NRFX_UARTE_RX_CONT_EVT_DATA.
+        uint32_t error_mask;            ///< Content of the ERRORSRC register for @ref NRFX_UARTE_RX_CONT_EVT_ERROR.
+    } data;                             ///< Event data.
+} nrfx_uarte_rx_cont_evt_t;
+
+/**
+ * @brief Continuous reception event handler type.
+ *
+ * @param[in] p_event   Pointer to the event structure.
+ * @param[in] p_context Context passed in the configuration.
+ */
+typedef void (* nrfx_uarte_rx_cont_handler_t)(nrfx_uarte_rx_cont_evt_t const * p_event,
+                                             void *                           p_context);
+
+/** @brief Continuous reception configuration. */
+typedef struct
+{
+    nrfx_timer_t                 counter;    ///< TIMER instance counting the received bytes.
+    nrfx_timer_t                 idle_timer; ///< TIMER instance detecting the idle line.
+    uint32_t                     idle_us;    ///< Idle line time in microseconds.
+    uint8_t *                    p_buffer;   ///< Ring buffer in Data RAM.
+    size_t                       length;     ///< Length of the buffer. Must be a power of two.
+    nrfx_uarte_rx_cont_handler_t handler;    ///< Event handler.
+    void *                       p_context;  ///< Context passed to the event handler.
+} nrfx_uarte_rx_cont_config_t;
+
+/**
+ * @brief Function for starting the continuous reception.
+ *
+ * Both TIMER instances and two PPI channels are used until @ref nrfx_uarte_rx_cont_stop
+ * is called. The TIMER instances must be enabled and not initialized.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the configuration.
+ *
+ * @retval NRFX_SUCCESS             Reception started.
+ * @retval NRFX_ERROR_BUSY          A reception is already in progress.
+ * @retval NRFX_ERROR_INVALID_ADDR  The buffer is not placed in the Data RAM region.
+ * @retval NRFX_ERROR_INVALID_STATE A TIMER instance is already in use.
+ * @retval NRFX_ERROR_NO_MEM        No free PPI channels.
+ */
+nrfx_err_t nrfx_uarte_rx_cont_start(nrfx_uarte_t const *                p_instance,
+                                    nrfx_uarte_rx_cont_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the continuous reception.
+ *
+ * Bytes not read yet are discarded. The TIMER instances and PPI channels are released.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_uarte_rx_cont_stop(nrfx_uarte_t const * p_instance);
+
+/**
+ * @brief Function for getting the received bytes not released yet.
+ *
+ * @param[in]  p_instance Pointer to the driver instance structure.
+ * @param[out] pp_data    Pointer to the oldest byte not released yet.
+ *
+ * @return Number of contiguous bytes at @p pp_data. At the end of the ring buffer, the rest
+ *         is returned after these bytes are released.
+ */
+size_t nrfx_uarte_rx_cont_get(nrfx_uarte_t const * p_instance, uint8_t ** pp_data);
+
+/**
+ * @brief Function for releasing received bytes.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] length     Number of bytes to release, at most the number returned by
+ *                       @ref nrfx_uarte_rx_cont_get.
+ */
+void nrfx_uarte_rx_cont_free(nrfx_uarte_t const * p_instance, size_t length);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_UARTE_RX_CONT_H__
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRFX_UARTE_TX_QUEUE_H__
+#define NRFX_UARTE_TX_QUEUE_H__
+
+#include <nrfx_uarte.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_uarte_tx_queue UARTE transmission queue
+ * @{
+ * @ingroup nrfx_uarte
+ * @brief   Queue of scatter-gather transmission descriptors.
+ *
+ * @details A descriptor lists buffers sent one after another without copying, for example
+ *          a header, a payload and a CRC kept in separate places. Descriptors are queued with
+ *          @ref nrfx_uarte_tx_queue and sent in order. The next buffer is started from the
+ *          ENDTX interrupt without stopping the transmitter, and the handler of a descriptor
+ *          is called once when all its buffers are sent.
+ *
+ *          Descriptors and buffers are owned by the caller and must stay valid until the
+ *          handler of the descriptor is called. The UARTE driver instance must be initialized
+ *          with an event handler. Plain @ref nrfx_uarte_tx transfers return
+ *          NRFX_ERROR_BUSY while the queue is being sent. A descriptor queued during such a
+ *          transfer is started when it finishes.
+ *
+ *          Descriptors still queued when the instance is uninitialized are dropped without
+ *          calling their handlers.
+ */
+
+/** @brief Buffer of a transmission descriptor. */
+typedef struct
+{
+    uint8_t const * p_data; ///< Data in Data RAM.
+    size_t          length; ///< Length of the data, within the EasyDMA limit of the instance.
+} nrfx_uarte_iovec_t;
+
+typedef struct nrfx_uarte_tx_desc_s nrfx_uarte_tx_desc_t;
+
+/**
+ * @brief Transmission descriptor handler type.
+ *
+ * Called from the UARTE interrupt. A new descriptor may be queued from the handler.
+ *
+ * @param[in] p_desc  Descriptor whose buffers were sent.
+ * @param[in] aborted True if the transmission was aborted with @ref nrfx_uarte_tx_abort.
+ *                    All queued descriptors are then completed as aborted.
+ */
+typedef void (* nrfx_uarte_tx_desc_handler_t)(nrfx_uarte_tx_desc_t * p_desc, bool aborted);
+
+/** @brief Transmission descriptor. */
+struct nrfx_uarte_tx_desc_s
+{
+    nrfx_uarte_tx_desc_t *       p_next;    ///< Used by the driver.
+    nrfx_uarte_iovec_t const *   p_iov;     ///< Buffers to send.
+    size_t                       iov_cnt;   ///< Number of buffers, at least one.
+    nrfx_uarte_tx_desc_handler_t handler;   ///< Handler called when the buffers are sent, or NULL.
+    void *                       p_context; ///< User context, not used by the driver.
+};
+
+/**
+ * @brief Function for queuing a transmission descriptor.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_desc     Descriptor to send.
+ *
+ * @retval NRFX_SUCCESS            Descriptor queued.
+ * @retval NRFX_ERROR_INVALID_ADDR A buffer is not placed in the Data RAM region.
+ */
+nrfx_err_t nrfx_uarte_tx_queue(nrfx_uarte_t const *   p_instance,
+                               nrfx_uarte_tx_desc_t * p_desc);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_UARTE_TX_QUEUE_H__